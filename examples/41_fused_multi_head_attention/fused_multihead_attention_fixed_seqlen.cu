@@ -72,6 +72,17 @@
       Otherwise, we store it & accumulate in global memory (slower)
       - blocks are parallelized across the batch dimension, the number
       of heads, and the query sequence size
+      - with `--num_splits_key`, the keys are split across blocks as well
+      (split-KV). Each split writes its output and logsumexp, and a second
+      kernel combines them. This fills the GPU when there are few query
+      blocks, eg when decoding with a long context
+      - with `--head_number_kv`, several query heads share each K/V head
+      (GQA/MQA). When decoding (a single query), the query heads of a K/V
+      group are processed by the same block, so that they share each K/V load
+      - causal masks can be refined with `--mask_block_size` (block-causal)
+      and `--window_size` (sliding window). Key blocks that are fully masked
+      for a query block are skipped, and the mask is only applied on the key
+      blocks at its boundaries
 
 
     Examples:
@@ -82,6 +93,12 @@
       # Run an attention example with custom setup
       $ ./examples/41_fused_multi_head_attention/41_fused_multi_head_attention_fixed_seqlen --head_number=2 --batch_size=3 --head_size=32 --head_size_v=64 --seq_length=512 --seq_length_kv=1024 --causal=true
 
+      # Run a grouped-query attention decoding example (8 query heads per K/V head)
+      $ ./examples/41_fused_multi_head_attention/41_fused_multi_head_attention_fixed_seqlen --head_number=64 --head_number_kv=8 --seq_length=1 --seq_length_kv=4096 --causal=false
+
+      # Run an attention example with a sliding window of 256 keys
+      $ ./examples/41_fused_multi_head_attention/41_fused_multi_head_attention_fixed_seqlen --seq_length=4096 --causal=true --window_size=256
+
       Acknowledgement: Fixed-sequence-length FMHA code was upstreamed by Meta xFormers (https://github.com/facebookresearch/xformers).
 */
 
@@ -154,6 +171,8 @@ struct Options {
   bool reference_check;
   bool use_mask;
   bool causal;
+  int mask_block_size;
+  int window_size;
 
   std::vector<cutlass::gemm::GemmCoord> problem_sizes0;
   std::vector<cutlass::gemm::GemmCoord> problem_sizes1;
@@ -163,11 +182,13 @@ struct Options {
 
   int alignment;
   int head_number;
+  int head_number_kv;
   int batch_size;
   int head_size;
   int head_size_v;
   int seq_length;
   int seq_length_kv;
+  int num_splits_key;
   int iterations;
 
   // alpha0, alpha1 and beta are fixed 
@@ -186,14 +207,18 @@ struct Options {
     alignment(1),
     reference_check(true),
     head_number(12),
+    head_number_kv(12),
     batch_size(16),
     head_size(64),
     head_size_v(64),
     seq_length(1024),
     seq_length_kv(1024),
+    num_splits_key(1),
     use_mask(false),
     iterations(20),
-    causal(false)
+    causal(false),
+    mask_block_size(0),
+    window_size(0)
   { }
 
   // Parses the command line
@@ -207,15 +232,27 @@ struct Options {
 
     cmd.get_cmd_line_argument("alignment", alignment, 1);
     cmd.get_cmd_line_argument("head_number", head_number, 12);
+    cmd.get_cmd_line_argument("head_number_kv", head_number_kv, head_number);
+    if (head_number_kv <= 0 || head_number % head_number_kv != 0) {
+      std::cerr << "--head_number must be a multiple of --head_number_kv\n";
+      error = true;
+    }
     cmd.get_cmd_line_argument("batch_size", batch_size, 16);
     cmd.get_cmd_line_argument("head_size", head_size, 64);
     cmd.get_cmd_line_argument("head_size_v", head_size_v, head_size);
     cmd.get_cmd_line_argument("seq_length", seq_length, 1024);
     cmd.get_cmd_line_argument("seq_length_kv", seq_length_kv, seq_length);
+    cmd.get_cmd_line_argument("num_splits_key", num_splits_key, 1);
     cmd.get_cmd_line_argument("use_mask", use_mask, false);
     cmd.get_cmd_line_argument("iterations", iterations, 20);
     cmd.get_cmd_line_argument("reference-check", reference_check, true);
     cmd.get_cmd_line_argument("causal", causal, true);
+    cmd.get_cmd_line_argument("mask_block_size", mask_block_size, 0);
+    cmd.get_cmd_line_argument("window_size", window_size, 0);
+    if (!causal && (mask_block_size > 0 || window_size > 0)) {
+      std::cerr << "--mask_block_size and --window_size require --causal=true\n";
+      error = true;
+    }
 
     randomize_problems();
 
@@ -267,19 +304,36 @@ struct Options {
       << "Options:\n\n"
       << "  --help                      If specified, displays this usage statement.\n\n"
       << "  --head_number=<int>         Head number in multi-head attention (default: --head_number=12)\n"
+      << "  --head_number_kv=<int>      Number of K/V heads, each shared by head_number / head_number_kv query heads (default: --head_number_kv=head_number)\n"
       << "  --batch_size=<int>          Batch size in multi-head attention (default: --batch_size=16)\n"
       << "  --head_size=<int>           Head size in multi-head attention (default: --head_size=64)\n"
       << "  --head_size_v=<int>         Head size in multi-head attention for V (default: --head_size_v=head_size)\n"
       << "  --seq_length=<int>          Sequence length in multi-head attention for Q (default: --seq_length=1024)\n"
       << "  --seq_length_kv=<int>       Sequence length in multi-head attention for K/V (default: --seq_length_kv=seq_length)\n"
+      << "  --num_splits_key=<int>      Number of blocks the keys are split across, 0 to pick it from the SM count (default: --num_splits_key=1)\n"
       << "  --use_mask=<bool>           If true, performs padding-like masking in softmax.\n"
       << "  --iterations=<int>          Number of profiling iterations to perform.\n"
       << "  --reference-check=<bool>    If true, performs reference check.\n"
-      << "  --causal=<bool>             If true, uses causal masking.\n";
+      << "  --causal=<bool>             If true, uses causal masking.\n"
+      << "  --mask_block_size=<int>     If positive, makes the causal mask block-causal with blocks of this many keys.\n"
+      << "  --window_size=<int>         If positive, restricts the causal mask to a sliding window of this many keys.\n";
 
     return out;
   }
 
+  /// Range [begin, end) of the keys attended by query `row` (top-left causal)
+  void key_range(int row, int num_keys, int &begin, int &end) const {
+    begin = 0;
+    end = num_keys;
+    if (causal) {
+      end = mask_block_size > 0 ? (row / mask_block_size + 1) * mask_block_size : row + 1;
+      end = std::min(end, num_keys);
+      if (window_size > 0) {
+        begin = std::max(row - window_size + 1, 0);
+      }
+    }
+  }
+
   /// Compute performance in GFLOP/s
   double gflops(double runtime_s) const {
 
@@ -290,10 +344,9 @@ struct Options {
       auto const& problem0 = problem_sizes0[i];
       auto const& problem1 = problem_sizes1[i];
       for (int row = 0; row < problem0.m(); ++row) {
-        int num_cols0 = problem0.n();
-        if (causal) {
-          num_cols0 = std::min(row + 1, num_cols0);
-        }
+        int col_begin, col_end;
+        key_range(row, problem0.n(), col_begin, col_end);
+        int num_cols0 = col_end - col_begin;
         // P <- Q . K_t
         fops += 2 * num_cols0 * problem0.k();
         // P <- exp(P - max(P))
@@ -510,6 +563,7 @@ private:
     // H = num_heads
     // K = embedding size per head
     int64_t batch_offset_Q, batch_offset_K, batch_offset_V, batch_offset_O;
+    int32_t kv_group_size = options.head_number / options.head_number_kv;
 
     for (int32_t b = 0; b < options.batch_size; ++b) {
       batch_offset_Q = total_elements_Q;
@@ -523,18 +577,20 @@ private:
         auto problem1 = options.problem_sizes1.at(i);
 
         ldq_host.at(i) = LayoutQ::packed({problem0.m(), options.head_number * problem0.k()}).stride(0);
-        ldk_host.at(i) = LayoutK::packed({options.head_number * problem0.k(), problem0.n()}).stride(0);
+        ldk_host.at(i) = LayoutK::packed({options.head_number_kv * problem0.k(), problem0.n()}).stride(0);
         ldp_host.at(i) = LayoutP::packed({problem0.m(), problem0.n()}).stride(0);
-        ldv_host.at(i) = LayoutV::packed({problem1.k(), options.head_number * problem1.n()}).stride(0);
+        ldv_host.at(i) = LayoutV::packed({problem1.k(), options.head_number_kv * problem1.n()}).stride(0);
         ldo_host.at(i) = LayoutO::packed({problem1.m(), options.head_number * problem1.n()}).stride(0);
 
         // m = n for attention problems.
         seqlen_host.at(i) = problem0.m();
 
         offset_Q.push_back(batch_offset_Q + h * problem0.k());
-        offset_K.push_back(batch_offset_K + h * problem0.k());
+        // query heads of the same group share their K/V head
+        int32_t h_kv = h / kv_group_size;
+        offset_K.push_back(batch_offset_K + h_kv * problem0.k());
         offset_P.push_back(total_elements_P);
-        offset_V.push_back(batch_offset_V + h * problem0.k());
+        offset_V.push_back(batch_offset_V + h_kv * problem1.n());
         offset_O.push_back(batch_offset_O + h * problem1.n());
 
         int64_t elements_Q = problem0.m() * problem0.k();
@@ -544,10 +600,12 @@ private:
         int64_t elements_O = problem1.m() * problem1.n();
 
         total_elements_Q += elements_Q;
-        total_elements_K += elements_K;
         total_elements_P += elements_P;
-        total_elements_V += elements_V;
         total_elements_O += elements_O;
+        if (h % kv_group_size == 0) {
+          total_elements_K += elements_K;
+          total_elements_V += elements_V;
+        }
       }
     }
 
@@ -728,31 +786,32 @@ private:
 
         // Compute softmax for reference matrix
         for (int m = 0; m < problem0.m(); m++) {
-          int n_dim_row = n_dim;
-          if (options.causal) {
-            n_dim_row = std::min(m + 1, n_dim);
-          }
-          ElementSoftmaxCompute max = ElementSoftmaxCompute(view_Ref_host.ref().at({m, 0}));
-          for (int n = 1; n < n_dim_row; n++) {
+          int n_begin_row, n_dim_row;
+          options.key_range(m, n_dim, n_begin_row, n_dim_row);
+          ElementSoftmaxCompute max = ElementSoftmaxCompute(view_Ref_host.ref().at({m, n_begin_row}));
+          for (int n = n_begin_row + 1; n < n_dim_row; n++) {
             max = std::max(max, ElementSoftmaxCompute(view_Ref_host.ref().at({m, n})));
           }
 
           vector_Norm_Ref.at(m) = ElementNorm(max);
 
           ElementSoftmaxCompute sum = ElementSoftmaxCompute();
-          for (int n = 0; n < n_dim_row; n++) {
+          for (int n = n_begin_row; n < n_dim_row; n++) {
             sum += std::exp( ElementSoftmaxCompute(view_Ref_host.ref().at({m, n})) - max );
           }
           ElementSoftmaxCompute inv_sum = ElementSoftmaxCompute(1.0f / sum);
 
           vector_Sum_Ref.at(m) = ElementSum(inv_sum);
 
-          for (int n = 0; n < n_dim_row; n++) {
+          for (int n = n_begin_row; n < n_dim_row; n++) {
             view_Ref_host.ref().at({m, n}) = ElementP(
               std::exp( ElementSoftmaxCompute(view_Ref_host.ref().at({m, n})) - max ) * inv_sum
             );
           }
           // Mask out the rest of the attention matrix
+          for (int n = 0; n < n_begin_row; ++n) {
+            view_Ref_host.ref().at({m, n}) = ElementP(0);
+          }
           for (int n = n_dim_row; n < n_dim; ++n) {
             view_Ref_host.ref().at({m, n}) = ElementP(0);
           }
@@ -851,6 +910,7 @@ public:
       p.scale = options.alpha0;
 
       p.num_heads = options.head_number;
+      p.kv_group_size = options.head_number / options.head_number_kv;
       p.num_batches = options.batch_size;
       p.head_dim = options.head_size;
       p.head_dim_value = options.head_size_v;
@@ -858,6 +918,8 @@ public:
       p.num_keys = options.seq_length_kv;
       if (options.causal) {
         p.custom_mask_type = Attention::CausalFromTopLeft;
+        p.mask_block_size = options.mask_block_size;
+        p.window_size = options.window_size;
       }
 
       // All tensors are in BMHK shapes
@@ -873,6 +935,40 @@ public:
       p.o_strideM = p.head_dim_value * p.num_heads;
     }
 
+    // Split-KV: each split writes a partial output and logsumexp, which
+    // a second kernel combines into block_O
+    using CombineSplits = AttentionKernelCombineSplits<Attention>;
+    typename CombineSplits::Params combine_p;
+    cutlass::DeviceAllocation<ElementO> block_O_partial;
+    cutlass::DeviceAllocation<typename Attention::lse_scalar_t> block_LSE_partial;
+    {
+      int num_splits_key = options.num_splits_key;
+      if (num_splits_key == 0) {
+        int device_id = 0;
+        int num_sms = 0;
+        cudaGetDevice(&device_id);
+        cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device_id);
+        num_splits_key = p.suggestNumSplitsKey(num_sms);
+      }
+      if (num_splits_key > 1) {
+        int64_t lse_dim = ceil_div(p.num_queries, Attention::kAlignLSE) * Attention::kAlignLSE;
+        p.num_splits_key = num_splits_key;
+        p.o_strideSplit = block_O.size();
+        p.lse_strideSplit = lse_dim * p.num_heads * p.num_batches;
+        block_O_partial.reset(num_splits_key * block_O.size());
+        block_LSE_partial.reset(num_splits_key * p.lse_strideSplit);
+        p.output_ptr = block_O_partial.get();
+        p.logsumexp_ptr = block_LSE_partial.get();
+        if (p.output_accum_ptr != nullptr) {
+          cudaFree(p.output_accum_ptr);
+          cudaMalloc(&p.output_accum_ptr,
+            num_splits_key * block_O.size() * sizeof(typename Attention::output_accum_t));
+          p.o_accum_strideSplit = block_O.size();
+        }
+        combine_p = typename CombineSplits::Params(p, block_O.get(), nullptr);
+      }
+    }
+
     // launch kernel :)
     constexpr auto kernel_fn = attention_kernel_batched_impl<Attention>;
     int smem_bytes = sizeof(typename Attention::SharedStorage);
@@ -883,7 +979,14 @@ public:
       std::cerr << "Kernel does not support these inputs" << std::endl;
       return result;
     }
-    kernel_fn<<<p.getBlocksGrid(), p.getThreadsGrid(), smem_bytes>>>(p);
+    auto launch = [&]() {
+      kernel_fn<<<p.getBlocksGrid(), p.getThreadsGrid(), smem_bytes>>>(p);
+      if (p.num_splits_key > 1) {
+        attention_kernel_combine_splits<Attention>
+          <<<combine_p.getBlocksGrid(), combine_p.getThreadsGrid()>>>(combine_p);
+      }
+    };
+    launch();
 
     // Wait for completion
     result.error = cudaDeviceSynchronize();
@@ -906,7 +1009,7 @@ public:
     // Warm-up run
     //
 
-    kernel_fn<<<p.getBlocksGrid(), p.getThreadsGrid(), smem_bytes>>>(p);
+    launch();
 
     if (result.status != cutlass::Status::kSuccess) {
       std::cerr << "Failed to run CUTLASS Attention kernel." << std::endl;
@@ -939,7 +1042,7 @@ public:
     //
 
     for (int iter = 0; iter < options.iterations; ++iter) {
-      kernel_fn<<<p.getBlocksGrid(), p.getThreadsGrid(), smem_bytes>>>(p);
+      launch();
     }
 
     //
@@ -986,6 +1089,9 @@ public:
     std::cout << "    " << " {seq length Q, seq length KV, head size, head size V, head number, batch size} = {" << options.seq_length \
       << ", " << options.seq_length_kv << ", " << options.head_size << ", " << options.head_size_v << ", " << options.head_number\
       << ", " << options.batch_size << "}." << std::endl;
+    if (p.num_splits_key > 1) {
+      std::cout << "    " << "Keys split across " << p.num_splits_key << " blocks." << std::endl;
+    }
     std::cout << std::endl;
     std::cout << "    " << "Runtime: " << result.runtime_ms << " ms" << std::endl;
     std::cout << "    " << "GFLOPs: " << result.gflops << std::endl;
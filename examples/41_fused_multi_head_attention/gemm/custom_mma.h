@@ -36,6 +36,8 @@
 #include "cutlass/gemm/threadblock/mma_multistage.h"
 #include "cutlass/gemm/threadblock/mma_pipelined.h"
 
+#include "../iterators/dequantizing_tile_iterator.h"
+
 template <typename Mma, int kMaxK>
 struct MakeCustomMma;
 
@@ -122,3 +124,46 @@ struct MakeCustomMma<
       LayoutC,
       Policy>;
 };
+
+/// Rebuilds a threadblock-scoped Mma so that its B operand is stored in global
+/// memory as `StorageElementB`, and dequantized while staged through registers.
+/// Only pipelined mainloops can dequantize, so other Mmas are left unchanged.
+template <typename Mma_, typename StorageElementB>
+struct MakeDequantizingMma {
+  using Mma = Mma_;
+};
+
+template <
+    typename Shape,
+    typename IteratorA,
+    typename SmemIteratorA,
+    typename IteratorB,
+    typename SmemIteratorB,
+    typename ElementC,
+    typename LayoutC,
+    typename Policy,
+    typename StorageElementB>
+struct MakeDequantizingMma<
+    cutlass::gemm::threadblock::MmaPipelined<
+        Shape,
+        IteratorA,
+        SmemIteratorA,
+        IteratorB,
+        SmemIteratorB,
+        ElementC,
+        LayoutC,
+        Policy>,
+    StorageElementB> {
+  // The iterator yields fragments of the original element type, so the
+  // default transforms (and `MakeCustomMma`) still apply
+  using Mma = cutlass::gemm::threadblock::MmaPipelined<
+      Shape,
+      IteratorA,
+      SmemIteratorA,
+      typename cutlass::transform::threadblock::
+          MakeDequantizingIterator<IteratorB, StorageElementB>::Iterator,
+      SmemIteratorB,
+      ElementC,
+      LayoutC,
+      Policy>;
+};
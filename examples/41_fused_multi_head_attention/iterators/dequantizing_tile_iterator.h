@@ -0,0 +1,261 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tile iterator loading low-precision (eg FP8) tiles from global
+   memory and dequantizing them to the element type of the MMA in registers.
+
+    Only usable from mainloops staging global loads through registers (eg
+   `MmaPipelined`), since `cp.async` copies can't convert elements.
+*/
+
+#pragma once
+
+#include "cutlass/array.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/transform/threadblock/predicated_tile_iterator.h"
+
+#include "make_residual_last.h"
+
+namespace cutlass {
+namespace transform {
+namespace threadblock {
+
+template <
+    /// Iterator over tiles of the stored (low-precision) elements
+    typename BaseIterator_,
+    /// Element type returned by `load`
+    typename Element_>
+class DequantizingTileIterator {
+ public:
+  using BaseIterator = BaseIterator_;
+  using StorageElement = typename BaseIterator::Element;
+
+  using Shape = typename BaseIterator::Shape;
+  using Element = Element_;
+  using Layout = typename BaseIterator::Layout;
+  static int const kAdvanceRank = BaseIterator::kAdvanceRank;
+  using ThreadMap = typename BaseIterator::ThreadMap;
+
+  using Index = typename BaseIterator::Index;
+  using LongIndex = typename BaseIterator::LongIndex;
+  using TensorCoord = typename BaseIterator::TensorCoord;
+
+  using Pointer = typename BaseIterator::Pointer;
+  using NonConstPointer = typename BaseIterator::NonConstPointer;
+
+  using Params = typename BaseIterator::Params;
+  using Mask = typename BaseIterator::Mask;
+
+  using StorageFragment = typename BaseIterator::Fragment;
+  using Fragment = cutlass::Array<Element, StorageFragment::kElements>;
+
+ private:
+  using ToFloat = NumericArrayConverter<
+      float,
+      StorageElement,
+      StorageFragment::kElements,
+      FloatRoundStyle::round_to_nearest>;
+  using FromFloat = NumericArrayConverter<
+      Element,
+      float,
+      StorageFragment::kElements,
+      FloatRoundStyle::round_to_nearest>;
+
+  BaseIterator iterator_;
+
+  /// Dequantization scale applied to every element
+  float scale_;
+
+ public:
+  /// Constructs a TileIterator from its precomputed state, threadblock
+  /// offset, and thread ID
+  CUTLASS_HOST_DEVICE
+  DequantizingTileIterator(
+      Params const& params,
+      Pointer pointer,
+      TensorCoord extent,
+      int thread_id,
+      TensorCoord const& threadblock_offset,
+      int const* indices = nullptr)
+      : iterator_(params, pointer, extent, thread_id, threadblock_offset),
+        scale_(1.0f) {}
+
+  /// Construct a TileIterator with zero threadblock offset
+  CUTLASS_HOST_DEVICE
+  DequantizingTileIterator(
+      Params const& params,
+      Pointer pointer,
+      TensorCoord extent,
+      int thread_id)
+      : iterator_(params, pointer, extent, thread_id), scale_(1.0f) {}
+
+  /// Sets the dequantization scale
+  CUTLASS_HOST_DEVICE
+  void set_scale(float scale) {
+    scale_ = scale;
+  }
+
+  /// Adds a pointer offset in units of StorageElement
+  CUTLASS_HOST_DEVICE
+  void add_pointer_offset(LongIndex pointer_offset) {
+    iterator_.add_pointer_offset(pointer_offset);
+  }
+
+  /// Advances an iterator along logical dimensions of matrix in units of
+  /// whole tiles
+  CUTLASS_HOST_DEVICE
+  void add_tile_offset(TensorCoord const& tile_offset) {
+    iterator_.add_tile_offset(tile_offset);
+  }
+
+  /// Advances to the next tile in memory.
+  CUTLASS_HOST_DEVICE
+  DequantizingTileIterator& operator++() {
+    ++iterator_;
+    return *this;
+  }
+
+  /// Advances to the next tile in memory.
+  CUTLASS_HOST_DEVICE
+  DequantizingTileIterator operator++(int) {
+    DequantizingTileIterator self(*this);
+    operator++();
+    return self;
+  }
+
+  /// Clears the predicate set efficiently
+  CUTLASS_HOST_DEVICE
+  void clear_mask(bool enable = true) {
+    iterator_.clear_mask(enable);
+  }
+
+  /// Only available for residual-last base iterators
+  CUTLASS_HOST_DEVICE
+  void set_residual_tile(bool enable) {
+    iterator_.set_residual_tile(enable);
+  }
+
+  /// Clears the predicate set efficiently
+  CUTLASS_HOST_DEVICE
+  void enable_mask() {
+    iterator_.enable_mask();
+  }
+
+  /// Sets the predicate mask, overriding value stored in predicate iterator
+  CUTLASS_HOST_DEVICE
+  void set_mask(Mask const& mask) {
+    iterator_.set_mask(mask);
+  }
+
+  /// Gets the mask
+  CUTLASS_HOST_DEVICE
+  void get_mask(Mask& mask) {
+    iterator_.get_mask(mask);
+  }
+
+  /// Loads a fragment from memory and dequantizes it
+  CUTLASS_DEVICE
+  void load(Fragment& frag) {
+    StorageFragment storage_frag;
+    iterator_.load(storage_frag);
+
+    ToFloat to_float;
+    FromFloat from_float;
+    cutlass::multiplies<cutlass::Array<float, StorageFragment::kElements>>
+        mul;
+    frag = from_float(mul(scale_, to_float(storage_frag)));
+  }
+};
+
+/// Rebinds a global memory tile iterator to a different stored element type.
+/// Iterators used with `cp.async` (eg `PredicatedTileAccessIterator`) are
+/// left unchanged, as they can't dequantize.
+template <typename Iterator_, typename StorageElement>
+struct MakeDequantizingIterator {
+  using Iterator = Iterator_;
+};
+
+template <
+    typename Shape,
+    typename Element,
+    typename Layout,
+    int AdvanceRank,
+    typename ThreadMap,
+    int AccessSize,
+    bool Gather,
+    typename PermuteLayout,
+    typename StorageElement>
+struct MakeDequantizingIterator<
+    PredicatedTileIterator<
+        Shape,
+        Element,
+        Layout,
+        AdvanceRank,
+        ThreadMap,
+        AccessSize,
+        Gather,
+        PermuteLayout>,
+    StorageElement> {
+  using Iterator = DequantizingTileIterator<
+      PredicatedTileIterator<
+          Shape,
+          StorageElement,
+          Layout,
+          AdvanceRank,
+          ThreadMap,
+          AccessSize,
+          Gather,
+          PermuteLayout>,
+      Element>;
+};
+
+template <typename BaseIterator, typename Element>
+struct MakeIteratorResidualLast<DequantizingTileIterator<BaseIterator, Element>> {
+  using Iterator = DequantizingTileIterator<
+      typename MakeIteratorResidualLast<BaseIterator>::Iterator,
+      Element>;
+};
+
+/// Sets the dequantization scale of an iterator - no-op for regular iterators
+template <typename Iterator>
+CUTLASS_DEVICE void set_dequantization_scale(Iterator&, float) {}
+
+template <typename BaseIterator, typename Element>
+CUTLASS_DEVICE void set_dequantization_scale(
+    DequantizingTileIterator<BaseIterator, Element>& iterator,
+    float scale) {
+  iterator.set_scale(scale);
+}
+
+} // namespace threadblock
+} // namespace transform
+} // namespace cutlass
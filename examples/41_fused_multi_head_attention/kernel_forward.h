@@ -124,7 +124,10 @@ template <
     // Set to false if you know at compile-time you will never need dropout
     bool kSupportsDropout_ = true,
     bool kSupportsBias_ = true,
-    typename ToBatchHookType_ = DefaultToBatchHook>
+    typename ToBatchHookType_ = DefaultToBatchHook,
+    // The datatype K/V are stored in (eg a FP8 KV-cache). If it differs from
+    // `scalar_t`, K/V are dequantized to `scalar_t` as they are loaded
+    typename cache_t_ = scalar_t_>
 struct AttentionKernel {
   enum CustomMaskType {
     NoCustomMask = 0,
@@ -134,6 +137,7 @@ struct AttentionKernel {
   };
 
   using scalar_t = scalar_t_;
+  using cache_t = cache_t_;
   using accum_t = float;
   using lse_scalar_t = float;
   using output_t = scalar_t;
@@ -150,8 +154,12 @@ struct AttentionKernel {
   static constexpr bool kSingleValueIteration = kMaxK <= kKeysPerBlock;
   static constexpr int32_t kAlignLSE = 32; // block size of backward
   static constexpr bool kIsHalf = cutlass::sizeof_bits<scalar_t>::value == 16;
+  // Dequantizing K/V requires staging global loads through registers, so we
+  // use the pipelined (2 stages) mainloops, which can't preload V
+  static constexpr bool kDequantizeKV =
+      !cutlass::platform::is_same<cache_t, scalar_t>::value;
   static constexpr bool kPreloadV =
-      ArchTag::kMinComputeCapability >= 80 && kIsHalf;
+      ArchTag::kMinComputeCapability >= 80 && kIsHalf && !kDequantizeKV;
   static constexpr bool kKeepOutputInRF = kSingleValueIteration;
   static constexpr bool kNeedsOutputAccumulatorBuffer = !kKeepOutputInRF &&
       !cutlass::platform::is_same<output_accum_t, output_t>::value;
@@ -170,8 +178,8 @@ struct AttentionKernel {
   struct Params {
     // Input tensors
     scalar_t* query_ptr = nullptr; // [num_queries, num_heads, head_dim]
-    scalar_t* key_ptr = nullptr; // [num_keys, num_heads, head_dim]
-    scalar_t* value_ptr = nullptr; // [num_keys, num_heads, head_dim_value]
+    cache_t* key_ptr = nullptr; // [num_keys, num_heads, head_dim]
+    cache_t* value_ptr = nullptr; // [num_keys, num_heads, head_dim_value]
     scalar_t* attn_bias_ptr = nullptr; // [num_heads, num_queries, num_keys]
     int32_t* seqstart_q_ptr = nullptr;
     int32_t* seqstart_k_ptr = nullptr;
@@ -179,6 +187,19 @@ struct AttentionKernel {
     int32_t* seqlen_k_ptr = nullptr;
     uint32_t causal_diagonal_offset = 0;
 
+    // Paged KV-cache - can be null
+    // If set, K/V are stored in pages of `page_size` keys, and
+    // `block_table_ptr[batch_id, i]` is the page holding keys
+    // [i * page_size, (i + 1) * page_size) of the batch. Pages are
+    // `k_stridePage`/`v_stridePage` elements apart, and the number of keys
+    // of each batch is read from `seqlen_k_ptr` (or `num_keys` otherwise)
+    int32_t* block_table_ptr = nullptr; // [num_batches, max_num_pages]
+    int32_t page_size = 0;
+
+    // Dequantization scales of K/V - only used if `cache_t != scalar_t`
+    accum_t key_scale = 1.0;
+    accum_t value_scale = 1.0;
+
     // Output tensors
     output_t* output_ptr = nullptr; // [num_queries, num_heads, head_dim_value]
     // [num_queries, num_heads, head_dim_value]
@@ -186,6 +207,21 @@ struct AttentionKernel {
     // [num_heads, num_queries] - can be null
     lse_scalar_t* logsumexp_ptr = nullptr;
 
+    // Split-KV ("flash-decoding") - if `num_splits_key > 1`, the keys of each
+    // query block are split in `num_splits_key` chunks of whole key blocks,
+    // processed by different blocks. This keeps the GPU busy when there are
+    // few query blocks, eg when decoding with a long context.
+    // `output_ptr`, `output_accum_ptr` and `logsumexp_ptr` then point to
+    // `num_splits_key` partial results, `o_strideSplit`, `o_accum_strideSplit`
+    // and `lse_strideSplit` elements apart, each normalized by its own
+    // softmax sum. `AttentionKernelCombineSplits` merges them.
+    int32_t num_splits_key = 1;
+    int64_t o_strideSplit = 0;
+    int64_t o_accum_strideSplit = 0;
+    int64_t lse_strideSplit = 0;
+    // First key of the split - set in `advance_to_block`
+    int32_t key_start = 0;
+
     // Scale
     accum_t scale = 0.0;
 
@@ -197,6 +233,17 @@ struct AttentionKernel {
     int32_t num_keys_absolute = 0;
 
     uint8_t custom_mask_type = NoCustomMask;
+    // Refinements of the causal masks above. With `d = query +
+    // causal_diagonal_offset` the diagonal key of a query:
+    // - `mask_block_size > 0` makes the mask block-causal: keys are grouped
+    // in blocks of `mask_block_size` (from key 0), and a query attends to all
+    // the keys of the block of `d` (eg chunked prefill, packed documents)
+    // - `window_size > 0` adds a sliding window (local attention): a query
+    // only attends to keys after `d - window_size`
+    // Key blocks that are fully masked for the whole query block are not
+    // computed at all, and the mask is only applied on boundary key blocks.
+    int32_t mask_block_size = 0;
+    int32_t window_size = 0;
 
     int32_t q_strideM = 0;
     int32_t k_strideM = 0;
@@ -217,8 +264,20 @@ struct AttentionKernel {
     int64_t v_strideB = 0;
     int64_t bias_strideB = 0;
 
+    int64_t block_table_strideB = 0;
+    int64_t k_stridePage = 0;
+    int64_t v_stridePage = 0;
+
     int32_t num_batches = 0;
     int32_t num_heads = 0;
+    // Grouped-query attention: `kv_group_size` consecutive query heads share
+    // the same K/V head, so query head `h` reads K/V head
+    // `h / kv_group_size`. Multi-query attention is `kv_group_size =
+    // num_heads` (or `k_strideH = v_strideH = 0`).
+    int32_t kv_group_size = 1;
+    // Stride between the logsumexp of 2 rows of the block - set in
+    // `advance_to_block`
+    int32_t lse_strideM = 1;
 
     // dropout
     bool use_dropout = false;
@@ -231,7 +290,8 @@ struct AttentionKernel {
     // Moves pointers to what we should process
     // Returns "false" if there is no work to do
     CUTLASS_DEVICE bool advance_to_block() {
-      auto batch_id = blockIdx.z;
+      auto batch_id = blockIdx.z / num_splits_key;
+      auto split_id = blockIdx.z % num_splits_key;
       auto head_id = blockIdx.y;
       auto query_start = blockIdx.x * kQueriesPerBlock;
 
@@ -243,6 +303,17 @@ struct AttentionKernel {
             head_id * num_queries * num_keys;
       }
 
+      if (num_splits_key > 1) {
+        // Advance to the partial results of the split
+        output_ptr += split_id * o_strideSplit;
+        if (output_accum_ptr != nullptr) {
+          output_accum_ptr += split_id * o_accum_strideSplit;
+        }
+        if (logsumexp_ptr != nullptr) {
+          logsumexp_ptr += split_id * lse_strideSplit;
+        }
+      }
+
       int64_t q_start = 0, k_start = 0;
       // Advance to current batch - in case of different sequence lengths
       constexpr bool kToBatchHook =
@@ -262,7 +333,11 @@ struct AttentionKernel {
         int64_t k_end;
         seqstart_k_ptr += batch_id;
 
-        if (seqlen_k_ptr) {
+        if (block_table_ptr != nullptr) {
+          // keys are addressed through the block table
+          k_start = 0;
+          k_end = seqlen_k_ptr ? seqlen_k_ptr[batch_id] : num_keys;
+        } else if (seqlen_k_ptr) {
           k_start = seqstart_k_ptr[0];
           k_end = k_start + seqlen_k_ptr[batch_id];
         } else {
@@ -278,8 +353,12 @@ struct AttentionKernel {
         }
       } else {
         query_ptr += batch_id * q_strideB;
-        key_ptr += batch_id * k_strideB;
-        value_ptr += batch_id * v_strideB;
+        if (block_table_ptr == nullptr) {
+          key_ptr += batch_id * k_strideB;
+          value_ptr += batch_id * v_strideB;
+        } else if (seqlen_k_ptr) {
+          num_keys = seqlen_k_ptr[batch_id];
+        }
         output_ptr += int64_t(batch_id * num_queries) * o_strideM;
         if (output_accum_ptr != nullptr) {
           output_accum_ptr +=
@@ -291,15 +370,18 @@ struct AttentionKernel {
 
       // Advance to the current batch / head / query_start
       query_ptr += (q_start + query_start) * q_strideM + head_id * q_strideH;
-      key_ptr += k_start * k_strideM + head_id * k_strideH;
+      key_ptr += k_start * k_strideM + (head_id / kv_group_size) * k_strideH;
 
-      value_ptr += k_start * v_strideM + head_id * v_strideH;
+      value_ptr += k_start * v_strideM + (head_id / kv_group_size) * v_strideH;
       output_ptr +=
           int64_t(q_start + query_start) * o_strideM + head_id * head_dim_value;
 
       if (kSupportsBias && attn_bias_ptr != nullptr) {
         attn_bias_ptr += (batch_id * bias_strideB) + (head_id * bias_strideH);
       }
+      if (block_table_ptr != nullptr) {
+        block_table_ptr += batch_id * block_table_strideB;
+      }
       if (output_accum_ptr != nullptr) {
         output_accum_ptr +=
             int64_t(q_start + query_start) * (head_dim_value * num_heads) +
@@ -322,29 +404,65 @@ struct AttentionKernel {
       // We use num_keys_absolute to index into the rng_state
       // We need this index to match between forward and backwards
       num_keys_absolute = num_keys;
+      key_start = 0;
       if (custom_mask_type == CausalFromTopLeft ||
           custom_mask_type == CausalFromBottomRight) {
-        // the bottom row of the current block is query_start + kQueriesPerBlock
-        // the last active key is then query_start + causal_diagonal_offset +
-        // kQueriesPerBlock so num_keys is the min between actual num_keys and
-        // this to avoid extra computations
+        // the bottom row of the current block is query_start +
+        // kQueriesPerBlock - 1, and no query of the block attends to keys
+        // after its last active key, so num_keys is the min between actual
+        // num_keys and this to avoid extra computations
         num_keys = cutlass::fast_min(
-            int32_t(query_start + causal_diagonal_offset + kQueriesPerBlock),
+            mask_last_key(int32_t(query_start + kQueriesPerBlock - 1)) + 1,
             num_keys);
+        // Likewise with a sliding window, no query of the block attends to
+        // keys before the first active key of the top row. Start from its
+        // key block so that blocks of keys stay contiguous in a paged cache
+        if (window_size > 0) {
+          int32_t first_key = mask_first_key(int32_t(query_start));
+          key_start = first_key > 0
+              ? first_key / int32_t(kKeysPerBlock) * int32_t(kKeysPerBlock)
+              : 0;
+        }
+      }
+
+      if (num_splits_key > 1) {
+        // Split the key blocks evenly - the last splits can be empty, in
+        // which case only the logsumexp is written (see `attention_kernel`)
+        int32_t keys_per_split =
+            ceil_div(
+                ceil_div(num_keys - key_start, int32_t(kKeysPerBlock)),
+                num_splits_key) *
+            kKeysPerBlock;
+        key_start += split_id * keys_per_split;
+        num_keys = cutlass::fast_min(key_start + keys_per_split, num_keys);
       }
 
       num_queries -= query_start;
       num_batches = 0; // no longer used after
 
-      // If num_queries == 1, and there is only one key head we're wasting
-      // 15/16th of tensor core compute In that case :
-      //  - we only launch kernels for head_id % kQueriesPerBlock == 0
-      //  - we iterate over heads instead of queries (strideM = strideH)
-      if (num_queries == 1 && k_strideH == 0 && v_strideH == 0) {
-        if (head_id % kQueriesPerBlock != 0)
+      // If num_queries == 1, and several query heads share the same key head
+      // (MQA/GQA), we're wasting 15/16th of tensor core compute, and load
+      // each K/V block once per query head. In that case :
+      //  - we only launch kernels for the heads of each K/V group with
+      //  (head_id % group) % kQueriesPerBlock == 0
+      //  - we iterate over the heads of the group instead of queries
+      //  (strideM = strideH), so that they share every K/V block load
+      // This does not apply to split-KV, whose logsumexp must be written per
+      // head for the splits to be combined
+      // Neither does it apply to sliding windows, whose first key would
+      // change with the head as well, nor to bias and dropout which are per
+      // head
+      int32_t kv_group = (k_strideH == 0 && v_strideH == 0) ? num_heads
+                                                             : kv_group_size;
+      if (num_queries == 1 && kv_group > 1 && num_splits_key == 1 &&
+          window_size == 0 && (!kSupportsBias || attn_bias_ptr == nullptr) &&
+          !use_dropout) {
+        int32_t head_in_group = head_id % kv_group;
+        if (head_in_group % kQueriesPerBlock != 0)
           return false;
         q_strideM = q_strideH;
-        num_queries = num_heads;
+        num_queries = kv_group - head_in_group;
+        lse_strideM = lse_dim;
         num_heads = 1; // unused but here for intent
         // remove causal since n_query = 1
         // otherwise, offset would change with head !
@@ -358,6 +476,7 @@ struct AttentionKernel {
       query_ptr = warp_uniform(query_ptr);
       key_ptr = warp_uniform(key_ptr);
       value_ptr = warp_uniform(value_ptr);
+      block_table_ptr = warp_uniform(block_table_ptr);
       if (kSupportsBias) {
         attn_bias_ptr = warp_uniform(attn_bias_ptr);
       }
@@ -366,17 +485,61 @@ struct AttentionKernel {
       logsumexp_ptr = warp_uniform(logsumexp_ptr);
       num_queries = warp_uniform(num_queries);
       num_keys = warp_uniform(num_keys);
+      key_start = warp_uniform(key_start);
       num_heads = warp_uniform(num_heads);
       o_strideM = warp_uniform(o_strideM);
+      lse_strideM = warp_uniform(lse_strideM);
       custom_mask_type = warp_uniform(custom_mask_type);
       return true;
     }
 
+    // Last key attended by query `query` with a causal `custom_mask_type`
+    CUTLASS_HOST_DEVICE int32_t mask_last_key(int32_t query) const {
+      int32_t diagonal = query + int32_t(causal_diagonal_offset);
+      if (mask_block_size > 0) {
+        diagonal = (diagonal / mask_block_size + 1) * mask_block_size - 1;
+      }
+      return diagonal;
+    }
+
+    // First key attended by query `query` (can be negative)
+    CUTLASS_HOST_DEVICE int32_t mask_first_key(int32_t query) const {
+      if (window_size > 0) {
+        return query + int32_t(causal_diagonal_offset) - window_size + 1;
+      }
+      return 0;
+    }
+
+    // Returns the offset of key `key_start` in K/V - all the keys of a block
+    // of `kKeysPerBlock` keys starting at `key_start` are contiguous
+    CUTLASS_DEVICE int64_t
+    kv_offset(int32_t key_start, int32_t strideM, int64_t stridePage) const {
+      if (block_table_ptr == nullptr) {
+        return int64_t(key_start) * strideM;
+      }
+      int32_t page = block_table_ptr[key_start / page_size];
+      return page * stridePage + int64_t(key_start % page_size) * strideM;
+    }
+
     __host__ dim3 getBlocksGrid() const {
       return dim3(
           ceil_div(num_queries, (int32_t)kQueriesPerBlock),
           num_heads,
-          num_batches);
+          num_batches * num_splits_key);
+    }
+
+    // Number of key splits that gives each of the `num_sms` SMs
+    // `kMinBlocksPerSm` blocks, while keeping at least `kMinKeyBlocksPerSplit`
+    // key blocks per split so that the combination stays cheap
+    __host__ int32_t suggestNumSplitsKey(int32_t num_sms) const {
+      constexpr int32_t kMinKeyBlocksPerSplit = 4;
+      int32_t num_blocks = ceil_div(num_queries, (int32_t)kQueriesPerBlock) *
+          num_heads * num_batches;
+      int32_t max_splits =
+          ceil_div(num_keys, (int32_t)kKeysPerBlock) / kMinKeyBlocksPerSplit;
+      int32_t splits = ceil_div(num_sms * kMinBlocksPerSm, num_blocks);
+      splits = splits < max_splits ? splits : max_splits;
+      return splits > 1 ? splits : 1;
     }
 
     __host__ dim3 getThreadsGrid() const {
@@ -411,29 +574,51 @@ struct AttentionKernel {
     using ThreadblockShape = cutlass::gemm::
         GemmShape<kQueriesPerBlock, kKeysPerBlock, GemmType::ThreadK>;
     using WarpShape = cutlass::gemm::GemmShape<32, 32, GemmType::WarpK>;
-    using DefaultMma = typename cutlass::gemm::threadblock::FindDefaultMma<
-        scalar_t, // ElementA,
-        cutlass::layout::RowMajor, // LayoutA,
-        kAlignmentA,
-        scalar_t, // ElementB,
-        cutlass::layout::ColumnMajor, // LayoutB,
-        kAlignmentB,
-        accum_t,
-        cutlass::layout::RowMajor, // LayoutC,
-        OpClass,
-        ArchTag, // ArchTag
-        ThreadblockShape, // ThreadblockShape
-        WarpShape, // WarpShape
-        typename GemmType::InstructionShape, // InstructionShape
-        ArchTag::kMinComputeCapability >= 80 && kIsHalf
-            ? 4
-            : DefaultConfig::kStages,
-        typename GemmType::Operator // Operator
-        >::DefaultMma;
+    using DefaultMma = typename cutlass::platform::conditional<
+        kDequantizeKV,
+        cutlass::gemm::threadblock::DefaultMma<
+            scalar_t, // ElementA,
+            cutlass::layout::RowMajor, // LayoutA,
+            kAlignmentA,
+            scalar_t, // ElementB,
+            cutlass::layout::ColumnMajor, // LayoutB,
+            kAlignmentB,
+            accum_t,
+            cutlass::layout::RowMajor, // LayoutC,
+            OpClass,
+            ArchTag, // ArchTag
+            ThreadblockShape, // ThreadblockShape
+            WarpShape, // WarpShape
+            typename GemmType::InstructionShape, // InstructionShape
+            2, // Stages
+            typename GemmType::Operator // Operator
+            >,
+        typename cutlass::gemm::threadblock::FindDefaultMma<
+            scalar_t, // ElementA,
+            cutlass::layout::RowMajor, // LayoutA,
+            kAlignmentA,
+            scalar_t, // ElementB,
+            cutlass::layout::ColumnMajor, // LayoutB,
+            kAlignmentB,
+            accum_t,
+            cutlass::layout::RowMajor, // LayoutC,
+            OpClass,
+            ArchTag, // ArchTag
+            ThreadblockShape, // ThreadblockShape
+            WarpShape, // WarpShape
+            typename GemmType::InstructionShape, // InstructionShape
+            ArchTag::kMinComputeCapability >= 80 && kIsHalf
+                ? 4
+                : DefaultConfig::kStages,
+            typename GemmType::Operator // Operator
+            >::DefaultMma>::type;
     using MmaCore = typename DefaultMma::MmaCore;
     using IteratorA = typename DefaultMma::IteratorA;
-    using IteratorB = typename DefaultMma::IteratorB;
-    using DefaultThreadblockMma = typename DefaultMma::ThreadblockMma;
+    // K is loaded as `cache_t`, and dequantized to `scalar_t`
+    using DefaultThreadblockMma = typename MakeDequantizingMma<
+        typename DefaultMma::ThreadblockMma,
+        cache_t>::Mma;
+    using IteratorB = typename DefaultThreadblockMma::IteratorB;
     using Mma = typename cutlass::platform::conditional<
         kSingleValueIteration,
         typename MakeCustomMma<DefaultThreadblockMma, kMaxK>::Mma,
@@ -510,11 +695,15 @@ struct AttentionKernel {
         typename GemmType::InstructionShape,
         typename DefaultConfig::EpilogueOutputOp,
         void, // ThreadblockSwizzle - not used
-        ArchTag::kMinComputeCapability >= 80 && kIsHalf
+        kDequantizeKV ? 2
+            : ArchTag::kMinComputeCapability >= 80 && kIsHalf
             ? 4
             : DefaultConfig::kStages,
         false, // SplitKSerial
         typename GemmType::Operator>;
+    // V is loaded as `cache_t`, and dequantized to `scalar_t`
+    using DefaultThreadblockMma =
+        typename MakeDequantizingMma<typename DefaultGemm::Mma, cache_t>::Mma;
 
     using WarpIteratorA = typename cutlass::gemm::threadblock::
         DefaultWarpIteratorAFromSharedMemory<
@@ -524,7 +713,7 @@ struct AttentionKernel {
             typename DefaultGemm::Mma::Policy>::WarpIterator;
     using DefaultMmaFromSmem =
         typename cutlass::gemm::threadblock::DefaultMmaFromSharedMemory<
-            typename DefaultGemm::Mma,
+            DefaultThreadblockMma,
             MM0::AccumulatorSharedStorage::Shape::kN, // kMaxK
             WarpIteratorA,
             false>; // kScaleOperandA
@@ -646,6 +835,37 @@ struct AttentionKernel {
     XFORMERS_CHECK(
         p.custom_mask_type < NumCustomMaskTypes,
         "invalid value for `custom_mask_type`");
+    XFORMERS_CHECK(
+        p.mask_block_size >= 0 && p.window_size >= 0,
+        "invalid value for `mask_block_size` or `window_size`");
+    XFORMERS_CHECK(
+        p.custom_mask_type != NoCustomMask ||
+            (p.mask_block_size == 0 && p.window_size == 0),
+        "`mask_block_size` and `window_size` require a causal mask");
+    XFORMERS_CHECK(
+        p.kv_group_size >= 1 && p.num_heads % p.kv_group_size == 0,
+        "`num_heads` must be a multiple of `kv_group_size`");
+    XFORMERS_CHECK(p.num_splits_key >= 1, "invalid value for `num_splits_key`");
+    if (p.num_splits_key > 1) {
+      XFORMERS_CHECK(
+          p.logsumexp_ptr != nullptr,
+          "split-KV requires `logsumexp_ptr` to combine the splits");
+      XFORMERS_CHECK(
+          (cutlass::platform::is_same<ToBatchHookType_, DefaultToBatchHook>::
+               value),
+          "split-KV is not supported with a custom batch hook");
+    }
+    if (p.block_table_ptr != nullptr) {
+      XFORMERS_CHECK(
+          p.page_size > 0 && p.page_size % kKeysPerBlock == 0,
+          "page_size must be a multiple of kKeysPerBlock");
+      XFORMERS_CHECK(
+          p.k_stridePage % kAlignmentK == 0,
+          "key is not correctly aligned (stridePage)");
+      XFORMERS_CHECK(
+          p.v_stridePage % kAlignmentV == 0,
+          "value is not correctly aligned (stridePage)");
+    }
     return true;
   }
 
@@ -673,6 +893,16 @@ struct AttentionKernel {
     typename MM1::Mma::FragmentC accum_o;
     accum_o.clear();
 
+    if (p.num_splits_key > 1 && p.key_start >= p.num_keys) {
+      // Empty split: a logsumexp of -inf gives it no weight when the splits
+      // are combined, and the output is not read
+      if (thread_id() < p.num_queries && thread_id() < kQueriesPerBlock) {
+        p.logsumexp_ptr[thread_id()] =
+            -cutlass::platform::numeric_limits<accum_t>::infinity();
+      }
+      return;
+    }
+
     auto createOutputIter = [&](int col) -> typename MM1::OutputTileIterator {
       using OutputTileIterator = typename MM1::OutputTileIterator;
       return OutputTileIterator(
@@ -719,7 +949,7 @@ struct AttentionKernel {
 #endif
 
     // Iterate through keys
-    for (int32_t iter_key_start = 0; iter_key_start < p.num_keys;
+    for (int32_t iter_key_start = p.key_start; iter_key_start < p.num_keys;
          iter_key_start += kKeysPerBlock) {
       int32_t problem_size_0_m =
           cutlass::fast_min((int32_t)kQueriesPerBlock, p.num_queries);
@@ -732,10 +962,13 @@ struct AttentionKernel {
       auto prologueV = [&](int blockN) {
         typename MM1::Mma::IteratorB iterator_V(
             typename MM1::IteratorB::Params{typename MM1::LayoutB(p.v_strideM)},
-            p.value_ptr + iter_key_start * p.v_strideM,
+            p.value_ptr +
+                p.kv_offset(iter_key_start, p.v_strideM, p.v_stridePage),
             {problem_size_1_k, problem_size_1_n},
             thread_id(),
             cutlass::MatrixCoord{0, blockN * MM1::Mma::Shape::kN});
+        cutlass::transform::threadblock::set_dequantization_scale(
+            iterator_V, p.value_scale);
         MM1::Mma::prologue(
             shared_storage.after_mm0.mm1,
             iterator_V,
@@ -776,10 +1009,12 @@ struct AttentionKernel {
       typename MM0::IteratorB iterator_B(
           typename MM0::IteratorB::Params(
               typename MM0::MmaCore::LayoutB(p.k_strideM)),
-          p.key_ptr + iter_key_start * p.k_strideM,
+          p.key_ptr + p.kv_offset(iter_key_start, p.k_strideM, p.k_stridePage),
           {problem_size_0_k, problem_size_0_n},
           thread_id(),
           tb_offset_B);
+      cutlass::transform::threadblock::set_dequantization_scale(
+          iterator_B, p.key_scale);
 
       auto my_warp_id = warp_uniform(warp_id());
       auto my_lane_id = lane_id();
@@ -849,31 +1084,32 @@ struct AttentionKernel {
             [&](int accum_m) {});
       }
 
-      // Mask out last if causal
-      // This is only needed if upper-right corner of current query / key block
-      // intersects the mask Coordinates of upper-right corner of current block
-      // is y=query_start x=min(iter_key_start + kKeysPerBlock, num_keys)) The
-      // first masked element is x = y + offset -> query_start + offset There is
-      // intersection (and we need to mask) if min(iter_key_start +
-      // kKeysPerBlock, num_keys)) >= query_start + offset
+      // Mask out keys outside of [first key, last key] of each query if
+      // causal. The first/last keys only grow with the query, so this is only
+      // needed on boundary blocks: if the last key of the current key block is
+      // after the last key of the top row, or (sliding window) if its first
+      // key is before the first key of the bottom row
       if (p.custom_mask_type &&
-          cutlass::fast_min(iter_key_start + kKeysPerBlock, p.num_keys) >=
-              (query_start + p.causal_diagonal_offset)) {
+          (cutlass::fast_min(iter_key_start + kKeysPerBlock, p.num_keys) - 1 >
+               p.mask_last_key(int32_t(query_start)) ||
+           (p.window_size > 0 &&
+            iter_key_start < p.mask_first_key(int32_t(
+                                 query_start + problem_size_0_m - 1))))) {
         auto query_start = blockIdx.x * kQueriesPerBlock;
         auto lane_offset = MM0::AccumLambdaIterator::get_lane_offset(
             my_lane_id, my_warp_id, iteratorC_tile_offset);
-        int32_t last_col;
+        int32_t first_col, last_col;
         MM0::AccumLambdaIterator::iterateRows(
             lane_offset,
             [&](int accum_m) {
-              // last absolute col is (last absolute query + offset)
-              // last local col is (last absolute query + offset -
-              // iter_key_start)
-              last_col = query_start + accum_m + p.causal_diagonal_offset -
+              // local cols are absolute keys - iter_key_start
+              first_col = p.mask_first_key(int32_t(query_start + accum_m)) -
+                  iter_key_start;
+              last_col = p.mask_last_key(int32_t(query_start + accum_m)) -
                   iter_key_start;
             },
             [&](int accum_m, int accum_n, int idx) {
-              if (accum_n > last_col) {
+              if (accum_n > last_col || accum_n < first_col) {
                 accum[idx] =
                     -cutlass::platform::numeric_limits<accum_t>::infinity();
               }
@@ -894,7 +1130,7 @@ struct AttentionKernel {
           thread_id(),
           my_warp_id,
           p.num_keys - iter_key_start,
-          iter_key_start == 0,
+          iter_key_start == p.key_start,
           iteratorC_tile_offset,
           kSupportsBias ? 1.0f : p.scale);
 
@@ -996,10 +1232,13 @@ struct AttentionKernel {
 
         typename MM1::Mma::IteratorB iterator_V(
             typename MM1::IteratorB::Params{typename MM1::LayoutB(p.v_strideM)},
-            p.value_ptr + iter_key_start * p.v_strideM,
+            p.value_ptr +
+                p.kv_offset(iter_key_start, p.v_strideM, p.v_stridePage),
             {problem_size_1_k, problem_size_1_n},
             thread_id(),
             cutlass::MatrixCoord{0, blockN * MM1::Mma::Shape::kN});
+        cutlass::transform::threadblock::set_dequantization_scale(
+            iterator_V, p.value_scale);
         typename MM1::Mma mma_pv(
             // operand A: Pij_dropped in shared memory
             shared_storage.after_mm0.si.accum_ref(),
@@ -1023,7 +1262,7 @@ struct AttentionKernel {
         if (!kKeepOutputInRF) {
           MM1::Mma::drain_cp_asyncs();
           DISPATCH_BOOL(
-              iter_key_start == 0, kIsFirst, ([&] {
+              iter_key_start == p.key_start, kIsFirst, ([&] {
                 DISPATCH_BOOL(
                     (iter_key_start + kKeysPerBlock) >= p.num_keys,
                     kIsLast,
@@ -1140,9 +1379,10 @@ struct AttentionKernel {
       auto lse_dim = ceil_div((int32_t)p.num_queries, kAlignLSE) * kAlignLSE;
       constexpr float kLog2e = 1.4426950408889634074; // log_2(e) = M_LOG2E
       if (thread_id() < p.num_queries) {
-        p.logsumexp_ptr[thread_id()] = accum_t(mi[thread_id()] / kLog2e) +
+        p.logsumexp_ptr[thread_id() * p.lse_strideM] =
+            accum_t(mi[thread_id()] / kLog2e) +
             cutlass::fast_log(accum_t(s_prime[thread_id()]));
-      } else if (thread_id() < lse_dim) {
+      } else if (thread_id() < lse_dim && p.lse_strideM == 1) {
         p.logsumexp_ptr[thread_id()] =
             cutlass::platform::numeric_limits<accum_t>::infinity();
       }
@@ -1229,11 +1469,11 @@ struct AttentionKernel {
         out_rescale[id] = m_prime_exp;
         s_prime[id] *= m_prime_exp;
       } else {
-        // Only when bias is enabled, it's possible that all the first values
-        // of attention are masked to `-inf`. In that case we want to avoid
-        // `nan = exp2f(-inf - (-inf))` so we temporarily set `mi` to 0
-        if (kSupportsBias &&
-            mi_id == -cutlass::platform::numeric_limits<accum_t>::infinity()) {
+        // When bias or a sliding window is enabled, it's possible that all
+        // the first values of attention are masked to `-inf`. In that case we
+        // want to avoid `nan = exp2f(-inf - (-inf))` so we temporarily set
+        // `mi` to 0
+        if (mi_id == -cutlass::platform::numeric_limits<accum_t>::infinity()) {
           restore_mi_to_minus_inf = true;
           mi[id] = 0.0f;
         }
@@ -1320,3 +1560,131 @@ __global__ void __launch_bounds__(AK::kNumThreads, AK::kMinBlocksPerSm)
 template <typename AK>
 __global__ void __launch_bounds__(AK::kNumThreads, AK::kMinBlocksPerSm)
     attention_kernel_batched(typename AK::Params params);
+
+// Merges the partial results of `AttentionKernel` with `num_splits_key > 1`.
+// With m the largest logsumexp of the splits, the row's logsumexp is
+// `lse = m + log(sum_s exp(lse_s - m))` and its output
+// `sum_s exp(lse_s - lse) * output_s`.
+template <typename AK>
+struct AttentionKernelCombineSplits {
+  using output_t = typename AK::output_t;
+  using lse_scalar_t = typename AK::lse_scalar_t;
+  using accum_t = typename AK::accum_t;
+
+  static constexpr int kNumThreads = 128;
+
+  struct Params {
+    // Partial results, as written by `AK`
+    output_t const* output_partial_ptr = nullptr;
+    lse_scalar_t const* logsumexp_partial_ptr = nullptr;
+    // [num_queries, num_heads, head_dim_value]
+    output_t* output_ptr = nullptr;
+    // [num_heads, num_queries] - can be null
+    lse_scalar_t* logsumexp_ptr = nullptr;
+    int32_t* seqstart_q_ptr = nullptr;
+
+    int32_t head_dim_value = 0;
+    int32_t num_queries = 0;
+    int32_t num_heads = 0;
+    int32_t num_batches = 0;
+    int32_t num_splits_key = 1;
+
+    int32_t o_strideM = 0;
+    int64_t o_strideSplit = 0;
+    int64_t lse_strideSplit = 0;
+
+    Params() = default;
+
+    // Reads the partial results written by `AK` with the params `p`
+    __host__ Params(
+        typename AK::Params const& p,
+        output_t* output_ptr_,
+        lse_scalar_t* logsumexp_ptr_)
+        : output_partial_ptr(p.output_ptr),
+          logsumexp_partial_ptr(p.logsumexp_ptr),
+          output_ptr(output_ptr_),
+          logsumexp_ptr(logsumexp_ptr_),
+          seqstart_q_ptr(p.seqstart_q_ptr),
+          head_dim_value(p.head_dim_value),
+          num_queries(p.num_queries),
+          num_heads(p.num_heads),
+          num_batches(p.num_batches),
+          num_splits_key(p.num_splits_key),
+          o_strideM(p.o_strideM),
+          o_strideSplit(p.o_strideSplit),
+          lse_strideSplit(p.lse_strideSplit) {}
+
+    __host__ dim3 getBlocksGrid() const {
+      return dim3(num_queries, num_heads, num_batches);
+    }
+
+    __host__ dim3 getThreadsGrid() const {
+      return dim3(kNumThreads, 1, 1);
+    }
+  };
+
+  static void CUTLASS_DEVICE combine(Params const& p) {
+    int32_t query = blockIdx.x;
+    int32_t head_id = blockIdx.y;
+    int32_t batch_id = blockIdx.z;
+
+    // Same layouts as in `AK::Params::advance_to_block`
+    auto lse_dim = ceil_div(p.num_queries, AK::kAlignLSE) * AK::kAlignLSE;
+    int64_t q_start = int64_t(batch_id) * p.num_queries;
+    int32_t num_queries = p.num_queries;
+    if (p.seqstart_q_ptr != nullptr) {
+      q_start = p.seqstart_q_ptr[batch_id];
+      num_queries = p.seqstart_q_ptr[batch_id + 1] - q_start;
+    }
+    if (query >= num_queries) {
+      return;
+    }
+
+    int64_t lse_offset =
+        (int64_t(batch_id) * p.num_heads + head_id) * lse_dim + query;
+    int64_t o_offset =
+        (q_start + query) * p.o_strideM + int64_t(head_id) * p.head_dim_value;
+
+    accum_t const kInf = cutlass::platform::numeric_limits<accum_t>::infinity();
+    accum_t lse_max = -kInf;
+    for (int32_t split = 0; split < p.num_splits_key; ++split) {
+      lse_max = cutlass::fast_max(
+          lse_max,
+          accum_t(p.logsumexp_partial_ptr[split * p.lse_strideSplit + lse_offset]));
+    }
+    accum_t sum = 0;
+    if (lse_max != -kInf) {
+      for (int32_t split = 0; split < p.num_splits_key; ++split) {
+        sum += cutlass::fast_exp(
+            accum_t(p.logsumexp_partial_ptr[split * p.lse_strideSplit + lse_offset]) -
+            lse_max);
+      }
+    }
+    accum_t lse = sum > 0 ? lse_max + cutlass::fast_log(sum) : -kInf;
+
+    for (int32_t col = threadIdx.x; col < p.head_dim_value; col += blockDim.x) {
+      accum_t acc = 0;
+      for (int32_t split = 0; split < p.num_splits_key; ++split) {
+        accum_t lse_split =
+            p.logsumexp_partial_ptr[split * p.lse_strideSplit + lse_offset];
+        // Splits without any visible key have a meaningless output
+        if (lse_split != -kInf) {
+          acc += cutlass::fast_exp(lse_split - lse) *
+              accum_t(p.output_partial_ptr[split * p.o_strideSplit + o_offset + col]);
+        }
+      }
+      p.output_ptr[o_offset + col] = output_t(acc);
+    }
+
+    if (p.logsumexp_ptr != nullptr && threadIdx.x == 0) {
+      p.logsumexp_ptr[lse_offset] = lse;
+    }
+  }
+};
+
+template <typename AK>
+__global__ void __launch_bounds__(AttentionKernelCombineSplits<AK>::kNumThreads)
+    attention_kernel_combine_splits(
+        typename AttentionKernelCombineSplits<AK>::Params p) {
+  AttentionKernelCombineSplits<AK>::combine(p);
+}
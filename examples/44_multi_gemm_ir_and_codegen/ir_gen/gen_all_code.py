@@ -111,7 +111,7 @@ project_root = ""
 turing_plus = b2b_fused_generator.gen_device(fuse_gemm_info, gen_name, for_cutlass_gen_user_include_header_file, cutlass_deps_root, project_root, auto_gen_output_dir)
 turing_plus.gen_code(75, 'hmma1688', False)
 
-api = api_generator.gen_one_API(fuse_gemm_info, gen_name, for_fused_wrapper, output_dir)
+api = api_generator.gen_one_API(fuse_gemm_info, gen_name, for_fused_wrapper, output_dir, cutlass_deps_root)
 api.gen_code()
 
 # Generate C++ sample
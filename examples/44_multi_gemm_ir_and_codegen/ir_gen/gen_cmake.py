@@ -64,6 +64,10 @@ foreach(arch ${GPU_ARCHS})
     set(CMAKE_CXX_FLAGS  \"${CMAKE_CXX_FLAGS}  -DWMMA\")
     set(CMAKE_CUDA_FLAGS \"${CMAKE_CUDA_FLAGS} -DWMMA\")
 	endif()
+  # The SM90 chain launches consecutive layers with programmatic dependent launch
+	if(arch STREQUAL \"90a\")
+    set(CMAKE_CUDA_FLAGS \"${CMAKE_CUDA_FLAGS} -DCUTLASS_ENABLE_GDC_FOR_SM90\")
+	endif()
 endforeach()
 
 set(CMAKE_C_FLAGS    \"${CMAKE_C_FLAGS}\")
@@ -74,13 +78,14 @@ set(CMAKE_C_FLAGS_DEBUG    \"${CMAKE_C_FLAGS_DEBUG}    -Wall -O0\")
 set(CMAKE_CXX_FLAGS_DEBUG  \"${CMAKE_CXX_FLAGS_DEBUG}  -Wall -O0\")
 set(CMAKE_CUDA_FLAGS_DEBUG \"${CMAKE_CUDA_FLAGS_DEBUG} -O0 -G -Xcompiler -Wall\")
 
-set(CMAKE_CXX_STANDARD 11)
+# The SM90 implementation uses the CUTLASS 3.x collectives, which require C++17
+set(CMAKE_CXX_STANDARD 17)
 set(CMAKE_CXX_STANDARD_REQUIRED ON)
+set(CMAKE_CUDA_STANDARD 17)
+set(CMAKE_CUDA_STANDARD_REQUIRED ON)
 
-if(CMAKE_CXX_STANDARD STREQUAL \"11\")
-  set(CMAKE_CUDA_FLAGS \"${CMAKE_CUDA_FLAGS} --expt-extended-lambda\")
-  set(CMAKE_CUDA_FLAGS \"${CMAKE_CUDA_FLAGS} --expt-relaxed-constexpr\")
-endif()
+set(CMAKE_CUDA_FLAGS \"${CMAKE_CUDA_FLAGS} --expt-extended-lambda\")
+set(CMAKE_CUDA_FLAGS \"${CMAKE_CUDA_FLAGS} --expt-relaxed-constexpr\")
 
 set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -O3\")
 set(CMAKE_CUDA_FLAGS \"${CMAKE_CUDA_FLAGS} -Xcompiler -O3\")
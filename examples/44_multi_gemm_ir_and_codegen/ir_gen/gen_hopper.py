@@ -0,0 +1,249 @@
+#################################################################################################
+#
+# Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+import helper
+import gen_ir as ir
+
+# Emits the SM90 implementation of the GEMM chain. Each layer is a persistent
+# warp-specialized GEMM built with the 3.x CollectiveBuilders, with its bias and
+# activation fused in the epilogue. Consecutive layers are launched with
+# programmatic dependent launch (PDL), and every layer warms the weights of the
+# next one into L2 once it has issued its last loads, so the intermediates and
+# the next weights are read back from L2 rather than HBM.
+class gen_hopper_impl:
+    def __init__(self, fuse_gemm_info, gen_class_name, cutlass_deps_root, output_dir = "../"):
+        self.fuse_gemm_info = fuse_gemm_info
+        self.gen_class_name = gen_class_name + "_hopper_impl"
+        self.cutlass_deps_root = cutlass_deps_root
+        self.output_dir = output_dir
+        self.b2b_num = len(fuse_gemm_info)
+
+        # Upper bound of the weights prefetched into L2 for the next layer
+        self.l2_prefetch_budget = 8 << 20
+
+    def gen_include(self):
+        headers = [
+            "cute/tensor.hpp",
+            "cutlass/epilogue/collective/collective_builder.hpp",
+            "cutlass/epilogue/thread/activation.h",
+            "cutlass/gemm/collective/collective_builder.hpp",
+            "cutlass/gemm/device/gemm_universal_adapter.h",
+            "cutlass/gemm/kernel/gemm_universal.hpp",
+            "cutlass/util/packed_stride.hpp",
+        ]
+        code = ""
+        for header in headers:
+            code += "#include \"" + self.cutlass_deps_root + header + "\"\n"
+        return code
+
+    def perf_tiling(self, layer_mnk):
+        # 128 rows per CTA (2 consumer warp groups), the smallest GMMA-friendly
+        # N tile that covers the layer width
+        n = layer_mnk[1]
+        tile_n = 64
+        if n > 128:
+            tile_n = 256
+        elif n > 64:
+            tile_n = 128
+        return [128, tile_n, 64]
+
+    def process_activation(self, epilogue_tp):
+        epilogue_tp = epilogue_tp.lower()
+        if epilogue_tp == 'leakyrelu':
+            return "cutlass::epilogue::thread::LeakyReLU"
+        elif epilogue_tp == 'identity':
+            return "cutlass::epilogue::thread::Identity"
+        return "cutlass::epilogue::thread::ReLu"
+
+    def is_vec_bias(self, layer_info):
+        return helper.get_epilogue_add_bias_or_not(layer_info) and \
+            helper.get_epilogue_add_bias_tp(layer_info).lower() == 'vec'
+
+    def gen_using(self):
+        code = ""
+        for i in range(self.b2b_num):
+            layer = self.fuse_gemm_info[i]
+            tile = self.perf_tiling(layer['mnk'])
+
+            element_a = helper.type_2_cutlass_type(layer['A_tp'])
+            element_b = helper.type_2_cutlass_type(layer['B_tp'])
+            element_c = helper.type_2_cutlass_type(layer['C_tp'])
+            element_acc = helper.type_2_cutlass_type(layer['Acc_tp'])
+            activation = self.process_activation(helper.get_epilogue_tp(layer))
+
+            # D = act(alpha * acc + beta * C), where a `vec` bias is a row vector
+            # broadcast along M, ie a per-column bias
+            if self.is_vec_bias(layer):
+                fusion_op = "cutlass::epilogue::fusion::LinCombPerColBiasEltAct<\n" + \
+                    "        " + activation + ", " + element_c + ", float, " + element_c + ", " + element_c + ", float>"
+            else:
+                fusion_op = "cutlass::epilogue::fusion::LinCombEltAct<\n" + \
+                    "        " + activation + ", " + element_c + ", float, " + element_c + ", float>"
+
+            tile_shape = "cute::Shape<cute::_" + str(tile[0]) + ", cute::_" + str(tile[1]) + ", cute::_" + str(tile[2]) + ">"
+
+            code += "    " + helper.var_idx("using CollectiveEpilogue", i) + " = typename cutlass::epilogue::collective::CollectiveBuilder<\n"
+            code += "        " + "cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,\n"
+            code += "        " + tile_shape + ", cute::Shape<cute::_1, cute::_1, cute::_1>,\n"
+            code += "        " + "cutlass::epilogue::collective::EpilogueTileAuto,\n"
+            code += "        " + element_acc + ", float,\n"
+            code += "        " + element_c + ", " + helper.type_2_cutlass_type(layer['C_format']) + ", 128 / cutlass::sizeof_bits<" + element_c + ">::value,\n"
+            code += "        " + element_c + ", " + helper.type_2_cutlass_type(layer['C_format']) + ", 128 / cutlass::sizeof_bits<" + element_c + ">::value,\n"
+            code += "        " + "cutlass::epilogue::TmaWarpSpecializedCooperative,\n"
+            code += "        " + fusion_op + "\n"
+            code += "    " + "  >::CollectiveOp;\n"
+
+            code += "    " + helper.var_idx("using CollectiveMainloop", i) + " = typename cutlass::gemm::collective::CollectiveBuilder<\n"
+            code += "        " + "cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,\n"
+            code += "        " + element_a + ", " + helper.type_2_cutlass_type(layer['A_format']) + ", 128 / cutlass::sizeof_bits<" + element_a + ">::value,\n"
+            code += "        " + element_b + ", " + helper.type_2_cutlass_type(layer['B_format']) + ", 128 / cutlass::sizeof_bits<" + element_b + ">::value,\n"
+            code += "        " + element_acc + ",\n"
+            code += "        " + tile_shape + ", cute::Shape<cute::_1, cute::_1, cute::_1>,\n"
+            code += "        " + "cutlass::gemm::collective::StageCountAutoCarveout<\n"
+            code += "            " + "static_cast<int>(sizeof(typename " + helper.var_idx("CollectiveEpilogue", i) + "::SharedStorage))>,\n"
+            code += "        " + "cutlass::gemm::KernelTmaWarpSpecializedCooperative\n"
+            code += "    " + "  >::CollectiveOp;\n"
+
+            code += "    " + helper.var_idx("using Gemm", i) + " = cutlass::gemm::device::GemmUniversalAdapter<\n"
+            code += "        " + "cutlass::gemm::kernel::GemmUniversal<\n"
+            code += "            " + "cute::Shape<int, int, int, int>,\n"
+            code += "            " + helper.var_idx("CollectiveMainloop", i) + ",\n"
+            code += "            " + helper.var_idx("CollectiveEpilogue", i) + ">>;\n\n"
+
+        return code
+
+    def gen_initialize(self):
+        code = ""
+        code += "    " + "int device_id = 0;\n"
+        code += "    " + "cudaGetDevice(&device_id);\n"
+        code += "    " + "cutlass::KernelHardwareInfo hw_info;\n"
+        code += "    " + "hw_info.device_id = device_id;\n"
+        code += "    " + "hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(device_id);\n\n"
+
+        for i in range(self.b2b_num):
+            layer = self.fuse_gemm_info[i]
+            n_str = str(layer['mnk'][1])
+            k_str = str(layer['mnk'][2])
+            if i == 0:
+                k_str = "K0"
+            ptr_a = helper.var_idx("A", 0) if i == 0 else helper.var_idx("D", i - 1)
+            element_a = helper.type_2_cutlass_type(layer['A_tp'])
+            element_b = helper.type_2_cutlass_type(layer['B_tp'])
+            element_c = helper.type_2_cutlass_type(layer['C_tp'])
+            gemm = helper.var_idx("Gemm", i)
+            args = helper.var_idx("arguments_", i)
+            add_bias = helper.get_epilogue_add_bias_or_not(layer)
+            mat_bias = add_bias and not self.is_vec_bias(layer)
+
+            code += "    " + "typename " + gemm + "::Arguments " + args + "{\n"
+            code += "        " + "cutlass::gemm::GemmUniversalMode::kGemm,\n"
+            code += "        " + "{M, " + n_str + ", " + k_str + ", Batch},\n"
+            code += "        " + "{reinterpret_cast<" + element_a + " const*>(" + ptr_a + "),\n"
+            code += "         " + "cutlass::make_cute_packed_stride(typename " + gemm + "::GemmKernel::StrideA{}, {M, " + k_str + ", Batch}),\n"
+            code += "         " + "reinterpret_cast<" + element_b + " const*>(" + helper.var_idx("B", i) + "),\n"
+            code += "         " + "cutlass::make_cute_packed_stride(typename " + gemm + "::GemmKernel::StrideB{}, {" + n_str + ", " + k_str + ", Batch})},\n"
+            code += "        " + "{{},\n"
+            code += "         " + ("reinterpret_cast<" + element_c + " const*>(" + helper.var_idx("C", i) + ")" if mat_bias else "nullptr") + ",\n"
+            code += "         " + "cutlass::make_cute_packed_stride(typename " + gemm + "::GemmKernel::StrideC{}, {M, " + n_str + ", Batch}),\n"
+            code += "         " + "reinterpret_cast<" + element_c + "*>(" + helper.var_idx("D", i) + "),\n"
+            code += "         " + "cutlass::make_cute_packed_stride(typename " + gemm + "::GemmKernel::StrideD{}, {M, " + n_str + ", Batch})},\n"
+            code += "        " + "hw_info\n"
+            code += "    " + "};\n"
+
+            code += "    " + args + ".epilogue.thread.alpha = 1.0f;\n"
+            code += "    " + args + ".epilogue.thread.beta = " + ("1.0f" if mat_bias else "0.0f") + ";\n"
+            if self.is_vec_bias(layer):
+                code += "    " + args + ".epilogue.thread.bias_ptr = reinterpret_cast<" + element_c + " const*>(" + helper.var_idx("C", i) + ");\n"
+                code += "    " + args + ".epilogue.thread.dBias = {cute::_0{}, cute::_1{}, " + n_str + "};\n"
+            for epilogue_arg in helper.get_epilogue_args(layer):
+                arg_name = helper.var_idx("Epilogue", i) + "_" + epilogue_arg[1]
+                code += "    " + args + ".epilogue.thread.activation." + epilogue_arg[1] + " = " + arg_name + ";\n"
+
+            # Warm the weights of the next layer into L2 during the tail of this one
+            if i != self.b2b_num - 1:
+                next_layer = self.fuse_gemm_info[i + 1]
+                next_bytes = "size_t(Batch) * " + str(next_layer['mnk'][1]) + " * " + str(next_layer['mnk'][2]) + \
+                    " * sizeof(" + helper.type_2_cutlass_type(next_layer['B_tp']) + ")"
+                code += "    " + args + ".l2_prefetch.ptr = " + helper.var_idx("B", i + 1) + ";\n"
+                code += "    " + args + ".l2_prefetch.bytes = std::min(" + next_bytes + ", size_t(" + str(self.l2_prefetch_budget) + "));\n"
+
+            code += "    " + gemm + " " + helper.var_idx("gemm_op_", i) + ";\n"
+            code += "    " + "assert(" + gemm + "::get_workspace_size(" + args + ") == 0);\n"
+            code += "    " + "if (" + helper.var_idx("gemm_op_", i) + ".can_implement(" + args + ") != cutlass::Status::kSuccess) {\n"
+            code += "    " + "    " + "assert(0);\n"
+            code += "    " + "    " + "return;\n"
+            code += "    " + "}\n"
+            code += "    " + helper.var_idx("gemm_op_", i) + ".initialize(" + args + ", nullptr, stream);\n\n"
+
+        return code
+
+    def gen_run(self):
+        # Only layers after the first one depend on a kernel of the chain. PDL
+        # is only safe if the kernels wait on the previous grid, which requires
+        # CUTLASS_ENABLE_GDC_FOR_SM90.
+        code = ""
+        code += "#if defined(CUTLASS_ENABLE_GDC_FOR_SM90)\n"
+        code += "    " + "constexpr bool launch_with_pdl = true;\n"
+        code += "#else\n"
+        code += "    " + "constexpr bool launch_with_pdl = false;\n"
+        code += "#endif\n"
+        for i in range(self.b2b_num):
+            pdl = "false" if i == 0 else "launch_with_pdl"
+            code += "    " + helper.var_idx("gemm_op_", i) + ".run(stream, nullptr, " + pdl + ");\n"
+        return code
+
+    def gen_wrapper(self):
+        arg_lists = []
+        arg_lists.append(["int", "M"])
+        arg_lists.append(["int", "K0"])
+        arg_lists.append(["int", "Batch"])
+        arg_lists.append(["void*", helper.var_idx("A", 0)])
+        for i in range(self.b2b_num):
+            arg_lists.append(["void*", helper.var_idx("B", i)])
+            arg_lists.append(["void*", helper.var_idx("C", i)])
+            arg_lists.append(["void*", helper.var_idx("D", i)])
+            for arg in helper.get_epilogue_args(self.fuse_gemm_info[i]):
+                arg_lists.append([arg[0], helper.var_idx("Epilogue", i) + "_" + arg[1]])
+
+        code_body = ""
+        code_body += self.gen_using()
+        code_body += self.gen_initialize()
+        code_body += self.gen_run()
+
+        code = ""
+        code += "#include <algorithm>\n"
+        code += "#include \"" + self.cutlass_deps_root + "cutlass/arch/config.h\"\n"
+        code += "#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)\n"
+        code += self.gen_include()
+        code += ir.gen_func(self.gen_class_name, arg_lists, code_body)
+        code += "#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)\n"
+        return code
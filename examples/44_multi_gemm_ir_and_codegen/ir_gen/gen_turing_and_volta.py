@@ -32,6 +32,7 @@
 
 import helper
 import gen_ir as ir
+import gen_hopper
 
 class gen_turing_impl:
     def __init__(self,fuse_gemm_info, gen_class_name, user_header_file, output_dir = "../"):
@@ -364,7 +365,7 @@ class gen_volta_turing_fuse_act_impl:
         helper.write_2_headfile("volta_impl.h", self.output_dir, self.user_header_file + "\n" +  code)
 
 class gen_one_API:
-    def __init__(self, fuse_gemm_info, gen_class_name, user_header_file, output_dir = "../"):
+    def __init__(self, fuse_gemm_info, gen_class_name, user_header_file, output_dir = "../", cutlass_deps_root = ""):
         self.fuse_gemm_info = fuse_gemm_info
         self.gen_class_name = gen_class_name
         self.user_header_file = ""
@@ -377,6 +378,8 @@ class gen_one_API:
 
         self.gen_turing = gen_turing_impl(fuse_gemm_info, gen_class_name, user_header_file, output_dir)
 
+        self.gen_hopper = gen_hopper.gen_hopper_impl(fuse_gemm_info, gen_class_name, cutlass_deps_root, output_dir)
+
     def gen_CUTLASS_irrelevant_API(self):
         code = ""
         code += "#include <cuda_runtime.h>\n"
@@ -414,7 +417,23 @@ class gen_one_API:
         code += "#include \"cutlass_irrelevant.h\"\n"
         code += "#include \"api.h\"\n"
         code += "void one_api( const  Param & param, int sm, cudaStream_t stream) {\n"
-        
+
+        code += "#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)\n"
+        code += "    " + "if (sm == 90) {\n"
+        code += "    " + "    " + self.gen_class_name + "_hopper_impl(param.M, param.K0, param.Batch, const_cast<void*>(param.A0), "
+        for i in range(self.b2b_num):
+            code += helper.var_idx("const_cast<void*>(param.B", i) + "), "
+            code += helper.var_idx("const_cast<void*>(param.C", i) + "), "
+            code += helper.var_idx("param.D", i) + ", "
+            epilogue_args = helper.get_epilogue_args(self.fuse_gemm_info[i])
+            for arg in epilogue_args:
+                arg_name = helper.var_idx("Epilogue", i) + "_" +  arg[1]
+                code += "param." + arg_name + ", "
+        code += "stream);\n"
+        code += "    " + "    " + "return;\n"
+        code += "    " + "}\n"
+        code += "#endif\n"
+
         code += "    " + "if (sm == 70) \n"
         code += "    " + "    " + self.gen_class_name + "_volta_impl(param.M, param.K0, param.Batch, const_cast<void*>(param.A0), "
         for i in range(self.b2b_num):
@@ -445,6 +464,7 @@ class gen_one_API:
 
         turing_code = self.gen_turing.gen_wrapper()
         volta_code = self.gen_volta.gen_wrapper()
+        hopper_code = self.gen_hopper.gen_wrapper()
         cutlass_irrelevant_code = self.gen_CUTLASS_irrelevant_API()
 
         one_api_code = self.gen_one_api()
@@ -453,4 +473,4 @@ class gen_one_API:
  
         helper.write_2_headfile("cutlass_irrelevant.h", self.output_dir, cutlass_irrelevant_code)
 
-        helper.write_2_headfile("api.h", self.output_dir, self.user_header_file + "\n" +  turing_code + volta_code)
+        helper.write_2_headfile("api.h", self.output_dir, self.user_header_file + "\n" +  turing_code + volta_code + hopper_code)
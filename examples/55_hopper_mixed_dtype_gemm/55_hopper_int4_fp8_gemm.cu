@@ -41,6 +41,9 @@
     In a nutshell, the positive values of INT4 weights need to be encoded in the same way as negative values except for the sign bit. For each scale factor,
     8 negative results (-8 x scale, -7 x scale, ... -1 x scale) are packed together, forming a cutlass::Array<ElementScale, 8> value.
 
+    Asymmetric (zero point) quantization is supported as well by passing cutlass::Array<ElementScale, 8> as both the scale and the zero type. The zero point
+    is then folded into two tables per group on the host, see `initialize_packed_scale_and_zero`. In that mode the INT4 weights keep their 2's complement encoding.
+
     The narrower type always passes through the register file. Therefore, in cases where the narrower type is operand B, the collective will implicitly swap 
     A and B in the main loop. However, as a result of this collective performing implicit swaps, it does not support TMA epilogues. Consequently, it is essential to consider this when constructing the epilogue, 
     as illustrated in this example.
@@ -64,7 +67,7 @@
     equal to the gemm problem K.
 
     Limitations:
-      1) Only supports INT4 x { FP8, INT8, UINT8 }. The scales must be the same as mma Type. Scale with zero-point mode is not supported.
+      1) Only supports INT4 x { FP8, INT8, UINT8 }. The scales must be the same as mma Type. Scale with zero-point mode requires the zero to be a lookup table as well.
       2) The INT4 weights and scale factors have additional encoding requirements.
       3) The scales must be MN major. That means if A is scaled, it must be column major, but if B is scaled it must be row major.
       4) The scales must have the same layout and groupsize.
@@ -145,7 +148,7 @@ using StrideB = cutlass::detail::TagToStrideB_t<LayoutB>;
 // LayoutAtomQuant places values that will be read by the same thread in contiguous locations in global memory.
 // It specifies the reordering within a single warp's fragment
 using LayoutAtomQuant = decltype(compute_memory_reordering_atom<MmaType>());
-using LayoutB_Reordered = decltype(tile_to_shape(LayoutAtomQuant{}, Layout<Shape<int,int,int>, StrideB>{}));
+using LayoutB_Reordered = cutlass::ReorderedLayout<MmaType, StrideB>;
 
 using ElementScale = MmaType;
 using ElementZero = ElementScale; // only for verify
@@ -208,3 +208,51 @@ bool initialize_packed_scale(
   }
   return true;
 }
+
+// With a zero point, the dequantized value q * scale + zero is folded into two lookup tables per group.
+// The scale table holds the candidates for the codes [-8, -1] and the zero table holds the candidates
+// for the codes [0, 7], so the quantized weights are consumed in their plain 2's complement encoding and
+// must NOT be passed through `unify_quant_encoding`.
+template <class ElementScale>
+bool initialize_packed_scale_and_zero(
+  cutlass::DeviceAllocation<ElementScale> const& block_scale_in,
+  cutlass::DeviceAllocation<ElementScale> const& block_zero_in,
+  cutlass::DeviceAllocation<cutlass::Array<ElementScale, 8> > & block_scale_out,
+  cutlass::DeviceAllocation<cutlass::Array<ElementScale, 8> > & block_zero_out) {
+
+  if (block_scale_in.size() != block_zero_in.size()) {
+    std::cerr << "block_scale_in and block_zero_in must have same size.\n";
+    return false;
+  }
+
+  std::vector<ElementScale> scale_in(block_scale_in.size());
+  std::vector<ElementScale> zero_in(block_zero_in.size());
+  std::vector<cutlass::Array<ElementScale, 8> > scale_out(block_scale_in.size());
+  std::vector<cutlass::Array<ElementScale, 8> > zero_out(block_zero_in.size());
+  try {
+    block_scale_in.copy_to_host(scale_in.data());
+    block_zero_in.copy_to_host(zero_in.data());
+  } catch (cutlass::cuda_exception const& e)
+  {
+    std::cerr << "CUDA Error: " << cudaGetErrorString(e.cudaError()) << std::endl;
+    return false;
+  }
+  for (size_t i = 0; i < scale_in.size(); ++i)
+  {
+    float scale = float(scale_in[i]);
+    float zero = float(zero_in[i]);
+    for (int j = 0; j < 8; ++j) {
+      scale_out[i][j] = ElementScale(float(j - 8) * scale + zero);
+      zero_out[i][j] = ElementScale(float(j) * scale + zero);
+    }
+  }
+  try {
+    block_scale_out.copy_from_host(scale_out.data());
+    block_zero_out.copy_from_host(zero_out.data());
+  } catch (cutlass::cuda_exception const& e)
+  {
+    std::cerr << "CUDA Error: " << cudaGetErrorString(e.cudaError()) << std::endl;
+    return false;
+  }
+  return true;
+}
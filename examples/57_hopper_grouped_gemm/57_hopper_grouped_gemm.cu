@@ -57,6 +57,10 @@
         3 256x256x128
         4 256x512x1024
         5 1024x512x128 and so on
+
+    The example also runs each kernel with the problem shapes and the number of groups only available
+    on device, as happens when a MoE router produces the token counts per expert. In that mode the
+    group count passed on the host is an upper bound, and no host synchronization is needed before launch.
 */
 
 #include <iostream>
@@ -194,6 +198,14 @@ using StrideB = typename Gemm::GemmKernel::InternalStrideB;
 using StrideC = typename Gemm::GemmKernel::InternalStrideC;
 using StrideD = typename Gemm::GemmKernel::InternalStrideD;
 
+// Problem shapes, pointers and strides of all groups packed into one buffer
+using PackedArguments = cutlass::gemm::GroupedGemmPackedArguments<
+  typename ProblemShape::UnderlyingProblemShape,
+  typename Gemm::ElementA, StrideA,
+  typename Gemm::ElementB, StrideB,
+  typename Gemm::ElementC, StrideC,
+  typename Gemm::EpilogueOutputOp::ElementOutput, StrideD>;
+
 // Host-side allocations
 std::vector<int64_t> offset_A;
 std::vector<int64_t> offset_B;
@@ -209,7 +221,9 @@ std::vector<ElementAccumulator> alpha_host;
 std::vector<ElementAccumulator> beta_host;
 
 // Device-side allocations
-cutlass::DeviceAllocation<typename ProblemShape::UnderlyingProblemShape> problem_sizes;
+cutlass::DeviceAllocation<uint8_t> packed_arguments;
+PackedArguments packed_arguments_device;
+cutlass::DeviceAllocation<int32_t> device_group_count;
 
 cutlass::DeviceAllocation<typename Gemm::ElementA> block_A;
 cutlass::DeviceAllocation<typename Gemm::ElementB> block_B;
@@ -217,17 +231,8 @@ cutlass::DeviceAllocation<typename Gemm::ElementC> block_C;
 cutlass::DeviceAllocation<typename Gemm::EpilogueOutputOp::ElementOutput> block_D;
 cutlass::DeviceAllocation<typename Gemm::EpilogueOutputOp::ElementOutput> block_ref_D;
 
-cutlass::DeviceAllocation<const typename Gemm::ElementA *> ptr_A;
-cutlass::DeviceAllocation<const typename Gemm::ElementB *> ptr_B;
-cutlass::DeviceAllocation<const typename Gemm::ElementC *> ptr_C;
-cutlass::DeviceAllocation<typename Gemm::EpilogueOutputOp::ElementOutput *> ptr_D;
 cutlass::DeviceAllocation<typename Gemm::EpilogueOutputOp::ElementOutput *> ptr_ref_D;
 
-cutlass::DeviceAllocation<StrideA> stride_A;
-cutlass::DeviceAllocation<StrideB> stride_B;
-cutlass::DeviceAllocation<StrideC> stride_C;
-cutlass::DeviceAllocation<StrideD> stride_D;
-
 // Note, this is an array of pointers to alpha and beta scaling values per group
 cutlass::DeviceAllocation<ElementAccumulator*> alpha_device;
 cutlass::DeviceAllocation<ElementAccumulator*> beta_device;
@@ -485,54 +490,37 @@ void initialize(const Options &options) {
 
   uint64_t seed = 2020;
 
-  problem_sizes.reset(options.groups);
-  problem_sizes.copy_from_host(options.problem_sizes_host.data());
-
   //
-  // Assign pointers
+  // Pack the problem shapes, pointers and strides of all groups into one buffer
   //
 
-  std::vector<ElementA *> ptr_A_host(options.groups);
-  std::vector<ElementB *> ptr_B_host(options.groups);
-  std::vector<ElementC *> ptr_C_host(options.groups);
-  std::vector<ElementC *> ptr_D_host(options.groups);
+  size_t packed_bytes = PackedArguments::get_buffer_size(options.groups);
+  std::vector<uint8_t> packed_arguments_host(packed_bytes);
+  PackedArguments packed_host = PackedArguments::make_view(packed_arguments_host.data(), options.groups);
+
   std::vector<ElementAccumulator *> ptr_alpha_host(options.groups);
   std::vector<ElementAccumulator *> ptr_beta_host(options.groups);
 
   for (int32_t i = 0; i < options.groups; ++i) {
-    ptr_A_host.at(i) = block_A.get() + offset_A.at(i);
-    ptr_B_host.at(i) = block_B.get() + offset_B.at(i);
-    ptr_C_host.at(i) = block_C.get() + offset_C.at(i);
-    ptr_D_host.at(i) = block_D.get() + offset_D.at(i);
+    packed_host.problem_shapes[i] = options.problem_sizes_host.at(i);
+    packed_host.ptr_A[i] = block_A.get() + offset_A.at(i);
+    packed_host.ptr_B[i] = block_B.get() + offset_B.at(i);
+    packed_host.ptr_C[i] = block_C.get() + offset_C.at(i);
+    packed_host.ptr_D[i] = block_D.get() + offset_D.at(i);
+    packed_host.dA[i] = stride_A_host.at(i);
+    packed_host.dB[i] = stride_B_host.at(i);
+    packed_host.dC[i] = stride_C_host.at(i);
+    packed_host.dD[i] = stride_D_host.at(i);
     alpha_host.push_back((options.alpha == FLT_MAX) ? static_cast<ElementAccumulator>((rand() % 5) + 1) : options.alpha);
     beta_host.push_back((options.beta == FLT_MAX) ? static_cast<ElementAccumulator>(rand() % 5) : options.beta);
     ptr_alpha_host.at(i) = block_alpha.get() + i;
     ptr_beta_host.at(i) = block_beta.get() + i;
   }
 
-  ptr_A.reset(options.groups);
-  ptr_A.copy_from_host(ptr_A_host.data());
-
-  ptr_B.reset(options.groups);
-  ptr_B.copy_from_host(ptr_B_host.data());
-
-  ptr_C.reset(options.groups);
-  ptr_C.copy_from_host(ptr_C_host.data());
-
-  ptr_D.reset(options.groups);
-  ptr_D.copy_from_host(ptr_D_host.data());
-
-  stride_A.reset(options.groups);
-  stride_A.copy_from_host(stride_A_host.data());
-
-  stride_B.reset(options.groups);
-  stride_B.copy_from_host(stride_B_host.data());
-
-  stride_C.reset(options.groups);
-  stride_C.copy_from_host(stride_C_host.data());
-
-  stride_D.reset(options.groups);
-  stride_D.copy_from_host(stride_D_host.data());
+  // A single host-to-device copy for all nine per-group arrays
+  packed_arguments.reset(packed_bytes);
+  packed_arguments.copy_from_host(packed_arguments_host.data());
+  packed_arguments_device = PackedArguments::make_view(packed_arguments.get(), options.groups);
 
   alpha_device.reset(options.groups);
   alpha_device.copy_from_host(ptr_alpha_host.data());
@@ -548,7 +536,7 @@ void initialize(const Options &options) {
 
 /// Populates a Gemm::Arguments structure from the given commandline options
 template <typename GemmT>
-typename GemmT::Arguments args_from_options(const Options &options, bool host_problem_shapes_available = true)
+typename GemmT::Arguments args_from_options(const Options &options, bool host_problem_shapes_available = true, bool device_group_count_available = false)
 {
   // Change device_id to another value if you are running on a machine with multiple GPUs and wish
   // to use a GPU other than that with device ID 0.
@@ -583,21 +571,31 @@ typename GemmT::Arguments args_from_options(const Options &options, bool host_pr
     fusion_args.dBeta = {cute::_0{}, cute::_0{}, 1};
   }
 
-  if (host_problem_shapes_available) {
+  if (device_group_count_available) {
+    // The number of groups is read from device memory, options.groups only bounds it from above
     arguments = typename GemmT::Arguments {
       cutlass::gemm::GemmUniversalMode::kGrouped,
-      {options.groups, problem_sizes.get(), options.problem_sizes_host.data()},
-      {ptr_A.get(), stride_A.get(), ptr_B.get(), stride_B.get()},
-      {fusion_args, ptr_C.get(), stride_C.get(), ptr_D.get(), stride_D.get()},
+      {options.groups, packed_arguments_device.problem_shapes, nullptr, device_group_count.get()},
+      {packed_arguments_device.ptr_A, packed_arguments_device.dA, packed_arguments_device.ptr_B, packed_arguments_device.dB},
+      {fusion_args, packed_arguments_device.ptr_C, packed_arguments_device.dC, packed_arguments_device.ptr_D, packed_arguments_device.dD},
+      kernel_hw_info
+    };
+  }
+  else if (host_problem_shapes_available) {
+    arguments = typename GemmT::Arguments {
+      cutlass::gemm::GemmUniversalMode::kGrouped,
+      {options.groups, packed_arguments_device.problem_shapes, options.problem_sizes_host.data()},
+      {packed_arguments_device.ptr_A, packed_arguments_device.dA, packed_arguments_device.ptr_B, packed_arguments_device.dB},
+      {fusion_args, packed_arguments_device.ptr_C, packed_arguments_device.dC, packed_arguments_device.ptr_D, packed_arguments_device.dD},
       kernel_hw_info
     };
   }
   else {
     arguments = typename GemmT::Arguments {
       cutlass::gemm::GemmUniversalMode::kGrouped,
-      {options.groups, problem_sizes.get(), nullptr},
-      {ptr_A.get(), stride_A.get(), ptr_B.get(), stride_B.get()},
-      {fusion_args, ptr_C.get(), stride_C.get(), ptr_D.get(), stride_D.get()},
+      {options.groups, packed_arguments_device.problem_shapes, nullptr},
+      {packed_arguments_device.ptr_A, packed_arguments_device.dA, packed_arguments_device.ptr_B, packed_arguments_device.dB},
+      {fusion_args, packed_arguments_device.ptr_C, packed_arguments_device.dC, packed_arguments_device.ptr_D, packed_arguments_device.dD},
       kernel_hw_info
     };
   }
@@ -648,16 +646,22 @@ bool verify(const Options &options) {
 
 /// Execute a given example GEMM computation
 template <typename GemmT>
-int run(Options &options, bool host_problem_shapes_available = true)
+int run(Options &options, bool host_problem_shapes_available = true, bool device_group_count_available = false)
 {
   allocate(options);
   initialize(options);
 
+  if (device_group_count_available) {
+    // Stands in for a device-side producer of the group count, such as a MoE router
+    device_group_count.reset(1);
+    device_group_count.copy_from_host(&options.groups);
+  }
+
   // Instantiate CUTLASS kernel depending on templates
   GemmT gemm;
 
   // Create a structure of gemm kernel arguments suitable for invoking an instance of Gemm
-  auto arguments = args_from_options<GemmT>(options, host_problem_shapes_available);
+  auto arguments = args_from_options<GemmT>(options, host_problem_shapes_available, device_group_count_available);
 
   // Using the arguments, query for extra workspace required for matrix multiplication computation
   size_t workspace_size = GemmT::get_workspace_size(arguments);
@@ -759,10 +763,14 @@ int main(int argc, char const **args) {
   run<Gemm>(options);
   std::cout << "\n*** Cooperative schedule (host problem shapes unavailable) ***" << std::endl;
   run<Gemm>(options, false /*host_problem_shapes_available*/);
+  std::cout << "\n*** Cooperative schedule (device-resident group count) ***" << std::endl;
+  run<Gemm>(options, false /*host_problem_shapes_available*/, true /*device_group_count_available*/);
   std::cout << "\n*** Pingpong schedule ***" << std::endl;
   run<GemmPingpong>(options);
   std::cout << "\n*** Pingpong schedule (host problem shapes unavailable) ***" << std::endl;
   run<GemmPingpong>(options, false /*host_problem_shapes_available*/);
+  std::cout << "\n*** Pingpong schedule (device-resident group count) ***" << std::endl;
+  run<GemmPingpong>(options, false /*host_problem_shapes_available*/, true /*device_group_count_available*/);
 #endif
 
   return 0;
@@ -116,6 +116,7 @@
 #include "cutlass/experimental/distributed/device/dist_gemm_universal_wrapper.hpp"
 #include "cutlass/experimental/distributed/kernel/dist_gemm_kernel_wrapper.hpp"
 #include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_2d_schedules.hpp"
 
 #include "helper.h"
 
@@ -145,6 +146,13 @@ static constexpr int TP_ = TP{};
 // * GEMM + Reduce Scatter:
 //   * ReduceScatter1D_TilingA_RotatingC
 //   * ReduceScatter1D_TilingB_RotatingC
+//
+// * GEMM + All Reduce:
+//   * AllReduce1D_TilingA_RotatingC (requires row-major D)
+//   * AllReduce1D_TilingB_RotatingC (requires column-major D)
+//
+// * 2-D (mesh) All Gather + GEMM (requires TP to be a perfect square, e.g. TP = _4):
+//   * AllGather2D_TilingCD_RotatingAB
 
 using DistSchedule = cutlass::distributed::schedules::AllGather1D_TilingCD_RotatingA<TP>;
 
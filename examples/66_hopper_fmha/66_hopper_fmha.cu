@@ -0,0 +1,474 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Hopper fused multi-head attention forward using CuTe and TMA collectives.
+
+    This example computes O = softmax(scale * Q * K^T) * V, and the logsumexp of each row of the
+    scaled scores, for FP16 inputs on NVIDIA Hopper architecture. It demonstrates:
+
+    1. A warp-specialized kernel: a producer warp group issues the TMA loads of Q, K and V through
+    PipelineTmaAsync pipelines, and two math warp groups each compute 64 rows of a 128-row Q tile.
+
+    2. The online softmax: S = Q * K^T is computed with smem-sourced GMMAs, the softmax runs on the
+    accumulators in registers, and P is fed back to O += P * V as the register-sourced A operand,
+    so that S and P never leave the register file.
+
+    3. Ping-pong scheduling of the math warp groups: they take turns issuing their GMMAs, ordered by
+    an OrderedSequenceBarrier, so that the softmax of one warp group overlaps the tensor core work
+    of the other. Within a warp group, S for the next KV tile is issued together with P * V for
+    the current one.
+
+    4. A TMA store epilogue, which stages O in the shared memory of Q.
+
+    Tensors are laid out as (Batch, Seq, NumHeads, HeadDim), and the logsumexp as
+    (Batch, NumHeads, SeqQ).
+
+    Examples:
+
+      $ ./examples/66_hopper_fmha/66_hopper_fmha --b=4 --h=16 --q=4096 --k=4096 --d=128
+
+      $ ./examples/66_hopper_fmha/66_hopper_fmha --b=4 --h=16 --q=4096 --k=4096 --d=64 --causal
+*/
+
+#include <cmath>
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "collective/fmha_fusion.hpp"
+#include "collective/sm90_fmha_fwd_mainloop_tma_warpspecialized.hpp"
+#include "collective/sm90_fmha_fwd_epilogue_tma.hpp"
+#include "kernel/sm90_fmha_fwd_kernel_tma_warpspecialized_pingpong.hpp"
+#include "device/fmha.hpp"
+#include "reference/fmha_fwd_reference.hpp"
+
+#include "helper.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+
+  int b, h, q, k, d;
+  bool causal;
+  bool verify;
+  int iterations;
+
+  Options():
+    help(false),
+    b(4), h(16), q(4096), k(4096), d(128),
+    causal(false),
+    verify(true),
+    iterations(20)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("b", b);
+    cmd.get_cmd_line_argument("h", h);
+    cmd.get_cmd_line_argument("q", q);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("d", d);
+    cmd.get_cmd_line_argument("verify", verify, true);
+    cmd.get_cmd_line_argument("iterations", iterations);
+    causal = cmd.check_cmd_line_flag("causal");
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "66_hopper_fmha\n\n"
+      << "  Hopper FP16 fused multi-head attention forward using a warp-specialized kernel.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --b=<int>                   Sets the batch size\n"
+      << "  --h=<int>                   Sets the number of heads\n"
+      << "  --q=<int>                   Sets the query sequence length\n"
+      << "  --k=<int>                   Sets the key/value sequence length\n"
+      << "  --d=<int>                   Sets the head dimension (64 or 128)\n"
+      << "  --causal                    Applies a causal mask\n"
+      << "  --verify=<bool>             Compares the output against a reference kernel\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "66_hopper_fmha" << " --b=4 --h=16 --q=4096 --k=4096 --d=128 --causal \n\n";
+
+    return out;
+  }
+
+  /// Compute performance in TFLOP/s
+  double tflops(double runtime_s) const
+  {
+    // Two GEMMs of two flops per multiply-add, half of the scores are masked out if causal
+    double flop = 4.0 * b * h * double(q) * double(k) * d;
+    if (causal) {
+      flop *= 0.5;
+    }
+    return flop / double(1.0e12) / runtime_s;
+  }
+};
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms;
+  double tflops;
+  cutlass::Status status;
+  cudaError_t error;
+  bool passed;
+
+  Result(
+    double avg_runtime_ms = 0,
+    double tflops = 0,
+    cutlass::Status status = cutlass::Status::kSuccess,
+    cudaError_t error = cudaSuccess)
+  :
+    avg_runtime_ms(avg_runtime_ms), tflops(tflops), status(status), error(error), passed(false)
+  {}
+
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// FMHA kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Element            = cutlass::half_t;                                   // Element type of Q, K, V and O
+using ElementAccumulator = float;                                             // Element type for internal accumulation
+
+// (SeqQ, SeqKV, HeadDim, (NumHeads, Batch))
+using ProblemShape = cute::tuple<int, int, int, cute::tuple<int, int>>;
+
+// (Seq, HeadDim, (NumHeads, Batch)) with a unit HeadDim stride
+using StrideQKVO = cute::tuple<int64_t, _1, cute::tuple<int64_t, int64_t>>;
+// (SeqQ, (NumHeads, Batch))
+using StrideLSE = cute::tuple<_1, cute::tuple<int64_t, int64_t>>;
+
+template <class HeadDim, class Mask>
+struct FmhaConfig {
+  using TileShape = Shape<_128, _128, HeadDim>;                               // (BlkQ, BlkKV, HeadDim)
+
+  using CollectiveMainloop = cutlass::fmha::collective::Sm90FmhaFwdMainloopTmaWarpspecialized<
+      Element, ElementAccumulator, TileShape,
+      StrideQKVO, StrideQKVO, StrideQKVO,
+      Mask>;
+
+  using CollectiveEpilogue = cutlass::fmha::collective::Sm90FmhaFwdEpilogueTma<
+      Element, ElementAccumulator, TileShape,
+      StrideQKVO, StrideLSE,
+      typename CollectiveMainloop::SmemLayoutQ,
+      CollectiveMainloop::NumMmaThreads>;
+
+  using FmhaKernel = cutlass::fmha::kernel::Sm90FmhaFwdKernelTmaWarpspecializedPingpong<
+      ProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Fmha = cutlass::fmha::device::Fmha<FmhaKernel>;
+};
+
+//
+// Data members
+//
+
+/// Initialization
+StrideQKVO stride_Q;
+StrideQKVO stride_K;
+StrideQKVO stride_V;
+StrideQKVO stride_O;
+StrideLSE stride_LSE;
+uint64_t seed = 2024;
+
+cutlass::DeviceAllocation<Element> block_Q;
+cutlass::DeviceAllocation<Element> block_K;
+cutlass::DeviceAllocation<Element> block_V;
+cutlass::DeviceAllocation<Element> block_O;
+cutlass::DeviceAllocation<Element> block_ref_O;
+cutlass::DeviceAllocation<ElementAccumulator> block_LSE;
+cutlass::DeviceAllocation<ElementAccumulator> block_ref_LSE;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// FMHA setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Helper to initialize a block of device data
+template <class Element>
+bool initialize_block(
+  cutlass::DeviceAllocation<Element>& block,
+  uint64_t seed=2023) {
+
+  Element scope_max = Element(1);
+  Element scope_min = Element(-1);
+
+  cutlass::reference::device::BlockFillRandomUniform(
+    block.get(), block.size(), seed, scope_max, scope_min, 0);
+
+  return true;
+}
+
+/// Initialize operands to be used in the FMHA and reference FMHA
+void initialize(const Options &options) {
+
+  // (Batch, Seq, NumHeads, HeadDim)
+  auto make_stride_bshd = [&](int seq) {
+    return make_stride(int64_t(options.h) * options.d, _1{},
+                       make_stride(int64_t(options.d), int64_t(seq) * options.h * options.d));
+  };
+  stride_Q = make_stride_bshd(options.q);
+  stride_K = make_stride_bshd(options.k);
+  stride_V = make_stride_bshd(options.k);
+  stride_O = make_stride_bshd(options.q);
+  // (Batch, NumHeads, SeqQ)
+  stride_LSE = make_stride(_1{}, make_stride(int64_t(options.q), int64_t(options.q) * options.h));
+
+  size_t size_q = size_t(options.b) * options.q * options.h * options.d;
+  size_t size_kv = size_t(options.b) * options.k * options.h * options.d;
+  size_t size_lse = size_t(options.b) * options.h * options.q;
+
+  block_Q.reset(size_q);
+  block_K.reset(size_kv);
+  block_V.reset(size_kv);
+  block_O.reset(size_q);
+  block_ref_O.reset(size_q);
+  block_LSE.reset(size_lse);
+  block_ref_LSE.reset(size_lse);
+
+  initialize_block(block_Q, seed + 2023);
+  initialize_block(block_K, seed + 2022);
+  initialize_block(block_V, seed + 2021);
+}
+
+ProblemShape problem_shape_from_options(const Options &options) {
+  return ProblemShape{options.q, options.k, options.d, {options.h, options.b}};
+}
+
+/// Populates a Fmha::Arguments structure from the given commandline options
+template <class Fmha>
+typename Fmha::Arguments args_from_options(const Options &options)
+{
+  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
+  // to use a GPU other than that with device ID 0.
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Fmha::Arguments arguments{
+    problem_shape_from_options(options),
+    {block_Q.get(), stride_Q, block_K.get(), stride_K, block_V.get(), stride_V,
+     1.f / std::sqrt(float(options.d))},
+    {block_O.get(), stride_O, block_LSE.get(), stride_LSE},
+    hw_info
+  };
+
+  return arguments;
+}
+
+bool verify(const Options &options) {
+
+  //
+  // Compute reference output
+  //
+
+  cutlass::fmha::reference::fmha_fwd_reference(
+    problem_shape_from_options(options),
+    block_Q.get(), stride_Q,
+    block_K.get(), stride_K,
+    block_V.get(), stride_V,
+    block_ref_O.get(), stride_O,
+    block_ref_LSE.get(), stride_LSE,
+    1.f / std::sqrt(float(options.d)),
+    options.causal);
+
+  // Wait for kernel to finish
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Check if output from CUTLASS kernel and reference kernel are relatively equal or not
+  bool passed_O = cutlass::reference::device::BlockCompareRelativelyEqual(
+    block_ref_O.get(), block_O.get(), block_O.size(), Element(0.02f), Element(0.02f));
+  bool passed_LSE = cutlass::reference::device::BlockCompareRelativelyEqual(
+    block_ref_LSE.get(), block_LSE.get(), block_LSE.size(), ElementAccumulator(1e-3f), ElementAccumulator(1e-3f));
+
+  return passed_O && passed_LSE;
+}
+
+/// Execute a given example FMHA computation
+template <typename Fmha>
+int run(Options &options)
+{
+  initialize(options);
+
+  // Instantiate CUTLASS kernel depending on templates
+  Fmha fmha;
+
+  // Create a structure of fmha kernel arguments suitable for invoking an instance of Fmha
+  auto arguments = args_from_options<Fmha>(options);
+
+  // Using the arguments, query for extra workspace required for the computation
+  size_t workspace_size = Fmha::get_workspace_size(arguments);
+
+  // Allocate workspace memory
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(fmha.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer
+  CUTLASS_CHECK(fmha.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(fmha.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  Result result;
+  if (options.verify) {
+    result.passed = verify(options);
+
+    std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+    if (!result.passed) {
+      exit(-1);
+    }
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0)
+  {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(fmha.run());
+    }
+    timer.stop();
+
+    // Compute average runtime and TFLOPs.
+    float elapsed_ms = timer.elapsed_millis();
+    result.avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+    result.tflops = options.tflops(result.avg_runtime_ms / 1000.0);
+
+    std::cout << "  Problem Size: " << options.b << 'x' << options.h << 'x' << options.q << 'x' << options.k
+              << 'x' << options.d << (options.causal ? " (causal)" : "") << std::endl;
+    std::cout << "  Avg runtime: " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  TFLOPS: " << result.tflops << std::endl;
+  }
+
+  return 0;
+}
+
+template <class HeadDim>
+int run_head_dim(Options &options) {
+  if (options.causal) {
+    return run<typename FmhaConfig<HeadDim, cutlass::fmha::collective::CausalMask>::Fmha>(options);
+  }
+  return run<typename FmhaConfig<HeadDim, cutlass::fmha::collective::ResidualMask>::Fmha>(options);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture "
+      << "(compute capability 90).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  if (options.d == 128) {
+    run_head_dim<_128>(options);
+  }
+  else if (options.d == 64) {
+    run_head_dim<_64>(options);
+  }
+  else {
+    std::cerr << "Only head dimensions of 64 and 128 are supported.\n";
+    return -1;
+  }
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
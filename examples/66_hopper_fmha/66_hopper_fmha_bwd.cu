@@ -0,0 +1,613 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Hopper fused multi-head attention backward using CuTe and TMA collectives.
+
+    Given dO, the gradient of O = softmax(scale * Q * K^T) * V, this example computes dQ, dK and
+    dV for FP16 inputs on NVIDIA Hopper architecture. It demonstrates:
+
+    1. A warp-specialized kernel parallelized over the KV tiles: a producer warp group loads K and
+    V once per CTA, and streams the Q and dO tiles that see them through a multi-stage
+    PipelineTmaAsync. Two math warp groups each own 64 rows of a 128-row KV tile.
+
+    2. Register-resident gradients: S^T = K * Q^T and dP^T = V * dO^T are computed with
+    smem-sourced GMMAs, P^T and dS^T are recomputed from the logsumexp of the forward pass in
+    registers, and are fed to dV += P^T * dO and dK += dS^T * Q as register-sourced A operands.
+    dK and dV stay in registers across all the Q tiles.
+
+    3. dQ through TMA reduce-add: the partial dQ = dS * K of every KV tile is staged in shared
+    memory and added to a float accumulator in global memory by the TMA unit. A preprocessing
+    kernel computes rowsum(dO o O) and clears the accumulator, and a postprocessing kernel
+    converts it to FP16. The order of the additions, and therefore the rounding of dQ, depends on
+    the scheduling of the CTAs.
+
+    4. Variable sequence lengths (--varlen): the sequences of all the batches are packed along the
+    sequence mode, and the kernel looks up each batch in cumulative sequence length arrays.
+
+    Tensors are laid out as (Batch, Seq, NumHeads, HeadDim), and the logsumexp as
+    (Batch, NumHeads, SeqQ). With variable sequence lengths the batch mode is folded into the
+    sequence mode: (TotalSeq, NumHeads, HeadDim) and (NumHeads, TotalSeqQ).
+
+    Examples:
+
+      $ ./examples/66_hopper_fmha/66_hopper_fmha_bwd --b=4 --h=16 --q=4096 --k=4096 --d=128
+
+      $ ./examples/66_hopper_fmha/66_hopper_fmha_bwd --b=8 --h=16 --q=2048 --k=2048 --d=64 --causal --varlen
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "collective/fmha_fusion.hpp"
+#include "collective/sm90_fmha_bwd_mainloop_tma_warpspecialized.hpp"
+#include "collective/sm90_fmha_bwd_epilogue.hpp"
+#include "kernel/sm90_fmha_bwd_kernel_tma_warpspecialized.hpp"
+#include "device/fmha_bwd.hpp"
+#include "reference/fmha_fwd_reference.hpp"
+#include "reference/fmha_bwd_reference.hpp"
+
+#include "helper.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+
+  int b, h, q, k, d;
+  bool causal;
+  bool varlen;
+  bool verify;
+  int iterations;
+
+  Options():
+    help(false),
+    b(4), h(16), q(4096), k(4096), d(128),
+    causal(false),
+    varlen(false),
+    verify(true),
+    iterations(20)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("b", b);
+    cmd.get_cmd_line_argument("h", h);
+    cmd.get_cmd_line_argument("q", q);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("d", d);
+    cmd.get_cmd_line_argument("verify", verify, true);
+    cmd.get_cmd_line_argument("iterations", iterations);
+    causal = cmd.check_cmd_line_flag("causal");
+    varlen = cmd.check_cmd_line_flag("varlen");
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "66_hopper_fmha_bwd\n\n"
+      << "  Hopper FP16 fused multi-head attention backward using a warp-specialized kernel.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --b=<int>                   Sets the batch size\n"
+      << "  --h=<int>                   Sets the number of heads\n"
+      << "  --q=<int>                   Sets the query sequence length\n"
+      << "  --k=<int>                   Sets the key/value sequence length\n"
+      << "  --d=<int>                   Sets the head dimension (64 or 128)\n"
+      << "  --causal                    Applies a causal mask\n"
+      << "  --varlen                    Draws the sequence lengths of each batch at random, up to q and k\n"
+      << "  --verify=<bool>             Compares the gradients against a reference kernel\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "66_hopper_fmha_bwd" << " --b=4 --h=16 --q=4096 --k=4096 --d=128 --causal \n\n";
+
+    return out;
+  }
+};
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms;
+  double tflops;
+  cutlass::Status status;
+  cudaError_t error;
+  bool passed;
+
+  Result(
+    double avg_runtime_ms = 0,
+    double tflops = 0,
+    cutlass::Status status = cutlass::Status::kSuccess,
+    cudaError_t error = cudaSuccess)
+  :
+    avg_runtime_ms(avg_runtime_ms), tflops(tflops), status(status), error(error), passed(false)
+  {}
+
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// FMHA kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Element            = cutlass::half_t;                                   // Element type of Q, K, V, O and their gradients
+using ElementAccumulator = float;                                             // Element type for internal accumulation
+
+// (SeqQ, SeqKV, HeadDim, (NumHeads, Batch))
+using ProblemShape = cute::tuple<int, int, int, cute::tuple<int, int>>;
+
+// (Seq, HeadDim, (NumHeads, Batch)) with a unit HeadDim stride
+using StrideQKVO = cute::tuple<int64_t, _1, cute::tuple<int64_t, int64_t>>;
+// (SeqQ, (NumHeads, Batch))
+using StrideLSE = cute::tuple<_1, cute::tuple<int64_t, int64_t>>;
+
+template <class HeadDim, class Mask>
+struct FmhaBwdConfig {
+  using TileShape = Shape<_64, _128, HeadDim>;                                // (BlkQ, BlkKV, HeadDim)
+
+  using CollectiveMainloop = cutlass::fmha::collective::Sm90FmhaBwdMainloopTmaWarpspecialized<
+      Element, ElementAccumulator, TileShape,
+      StrideQKVO, StrideLSE,
+      Mask>;
+
+  using CollectiveEpilogue = cutlass::fmha::collective::Sm90FmhaBwdEpilogue<
+      Element, ElementAccumulator, TileShape,
+      StrideQKVO,
+      typename CollectiveMainloop::SmemLayoutK,
+      CollectiveMainloop::NumMmaThreads>;
+
+  using FmhaKernel = cutlass::fmha::kernel::Sm90FmhaBwdKernelTmaWarpspecialized<
+      ProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using FmhaBwd = cutlass::fmha::device::FmhaBwd<FmhaKernel>;
+};
+
+//
+// Data members
+//
+
+/// Initialization
+StrideQKVO stride_Q;
+StrideQKVO stride_K;
+StrideLSE stride_LSE;
+uint64_t seed = 2024;
+
+// Sequence lengths of each batch, and their prefix sums if they are variable
+std::vector<int> seqlen_q;
+std::vector<int> seqlen_kv;
+std::vector<int> cumulative_seqlen_q;
+std::vector<int> cumulative_seqlen_kv;
+int total_seqlen_q;
+int total_seqlen_kv;
+cutlass::DeviceAllocation<int> block_cumulative_seqlen_q;
+cutlass::DeviceAllocation<int> block_cumulative_seqlen_kv;
+
+cutlass::DeviceAllocation<Element> block_Q;
+cutlass::DeviceAllocation<Element> block_K;
+cutlass::DeviceAllocation<Element> block_V;
+cutlass::DeviceAllocation<Element> block_O;
+cutlass::DeviceAllocation<ElementAccumulator> block_LSE;
+cutlass::DeviceAllocation<Element> block_dO;
+cutlass::DeviceAllocation<Element> block_dQ;
+cutlass::DeviceAllocation<Element> block_dK;
+cutlass::DeviceAllocation<Element> block_dV;
+cutlass::DeviceAllocation<Element> block_ref_dQ;
+cutlass::DeviceAllocation<Element> block_ref_dK;
+cutlass::DeviceAllocation<Element> block_ref_dV;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// FMHA setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Helper to initialize a block of device data
+template <class Element>
+bool initialize_block(
+  cutlass::DeviceAllocation<Element>& block,
+  uint64_t seed=2023) {
+
+  Element scope_max = Element(1);
+  Element scope_min = Element(-1);
+
+  cutlass::reference::device::BlockFillRandomUniform(
+    block.get(), block.size(), seed, scope_max, scope_min, 0);
+
+  return true;
+}
+
+float softmax_scale(const Options &options) {
+  return 1.f / std::sqrt(float(options.d));
+}
+
+/// Problem shape seen by the kernel: the total sequence lengths if they are variable
+ProblemShape problem_shape_from_options(const Options &options) {
+  if (options.varlen) {
+    return ProblemShape{total_seqlen_q, total_seqlen_kv, options.d, {options.h, options.b}};
+  }
+  return ProblemShape{options.q, options.k, options.d, {options.h, options.b}};
+}
+
+/// Runs the forward pass of each batch with the reference kernel, to get O and LSE
+void compute_forward(const Options &options) {
+  int batches = options.varlen ? options.b : 1;
+  for (int batch = 0; batch < batches; ++batch) {
+    int64_t offset_q = options.varlen ? int64_t(cumulative_seqlen_q[batch]) : 0;
+    int64_t offset_kv = options.varlen ? int64_t(cumulative_seqlen_kv[batch]) : 0;
+    ProblemShape problem_shape = options.varlen
+      ? ProblemShape{seqlen_q[batch], seqlen_kv[batch], options.d, {options.h, 1}}
+      : problem_shape_from_options(options);
+
+    cutlass::fmha::reference::fmha_fwd_reference(
+      problem_shape,
+      block_Q.get() + offset_q * get<0>(stride_Q), stride_Q,
+      block_K.get() + offset_kv * get<0>(stride_K), stride_K,
+      block_V.get() + offset_kv * get<0>(stride_K), stride_K,
+      block_O.get() + offset_q * get<0>(stride_Q), stride_Q,
+      block_LSE.get() + offset_q, stride_LSE,
+      softmax_scale(options),
+      options.causal);
+  }
+}
+
+/// Initialize operands to be used in the FMHA and reference FMHA
+void initialize(const Options &options) {
+
+  seqlen_q.assign(options.b, options.q);
+  seqlen_kv.assign(options.b, options.k);
+  if (options.varlen) {
+    std::mt19937 rng(seed);
+    for (int batch = 0; batch < options.b; ++batch) {
+      seqlen_q[batch] = std::uniform_int_distribution<int>(1, options.q)(rng);
+      seqlen_kv[batch] = std::uniform_int_distribution<int>(1, options.k)(rng);
+    }
+  }
+  cumulative_seqlen_q.assign(options.b + 1, 0);
+  cumulative_seqlen_kv.assign(options.b + 1, 0);
+  for (int batch = 0; batch < options.b; ++batch) {
+    cumulative_seqlen_q[batch + 1] = cumulative_seqlen_q[batch] + seqlen_q[batch];
+    cumulative_seqlen_kv[batch + 1] = cumulative_seqlen_kv[batch] + seqlen_kv[batch];
+  }
+  total_seqlen_q = cumulative_seqlen_q.back();
+  total_seqlen_kv = cumulative_seqlen_kv.back();
+
+  block_cumulative_seqlen_q.reset(options.b + 1);
+  block_cumulative_seqlen_kv.reset(options.b + 1);
+  block_cumulative_seqlen_q.copy_from_host(cumulative_seqlen_q.data());
+  block_cumulative_seqlen_kv.copy_from_host(cumulative_seqlen_kv.data());
+
+  if (options.varlen) {
+    // (TotalSeq, NumHeads, HeadDim), the batch stride is not used
+    stride_Q = make_stride(int64_t(options.h) * options.d, _1{}, make_stride(int64_t(options.d), int64_t(0)));
+    stride_K = stride_Q;
+    // (NumHeads, TotalSeqQ)
+    stride_LSE = make_stride(_1{}, make_stride(int64_t(total_seqlen_q), int64_t(0)));
+  }
+  else {
+    // (Batch, Seq, NumHeads, HeadDim)
+    auto make_stride_bshd = [&](int seq) {
+      return make_stride(int64_t(options.h) * options.d, _1{},
+                         make_stride(int64_t(options.d), int64_t(seq) * options.h * options.d));
+    };
+    stride_Q = make_stride_bshd(options.q);
+    stride_K = make_stride_bshd(options.k);
+    // (Batch, NumHeads, SeqQ)
+    stride_LSE = make_stride(_1{}, make_stride(int64_t(options.q), int64_t(options.q) * options.h));
+  }
+
+  size_t size_q = size_t(total_seqlen_q) * options.h * options.d;
+  size_t size_kv = size_t(total_seqlen_kv) * options.h * options.d;
+  size_t size_lse = size_t(total_seqlen_q) * options.h;
+
+  block_Q.reset(size_q);
+  block_K.reset(size_kv);
+  block_V.reset(size_kv);
+  block_O.reset(size_q);
+  block_LSE.reset(size_lse);
+  block_dO.reset(size_q);
+  block_dQ.reset(size_q);
+  block_dK.reset(size_kv);
+  block_dV.reset(size_kv);
+  block_ref_dQ.reset(size_q);
+  block_ref_dK.reset(size_kv);
+  block_ref_dV.reset(size_kv);
+
+  initialize_block(block_Q, seed + 2023);
+  initialize_block(block_K, seed + 2022);
+  initialize_block(block_V, seed + 2021);
+  initialize_block(block_dO, seed + 2020);
+
+  compute_forward(options);
+  CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+/// Populates a FmhaBwd::Arguments structure from the given commandline options
+template <class FmhaBwd>
+typename FmhaBwd::Arguments args_from_options(const Options &options)
+{
+  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
+  // to use a GPU other than that with device ID 0.
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  cutlass::fmha::collective::VariableSeqlen varlen;
+  if (options.varlen) {
+    varlen.cumulative_seqlen_q = block_cumulative_seqlen_q.get();
+    varlen.cumulative_seqlen_kv = block_cumulative_seqlen_kv.get();
+    varlen.max_seqlen_q = *std::max_element(seqlen_q.begin(), seqlen_q.end());
+    varlen.max_seqlen_kv = *std::max_element(seqlen_kv.begin(), seqlen_kv.end());
+  }
+
+  typename FmhaBwd::Arguments arguments;
+  arguments.problem_shape = problem_shape_from_options(options);
+  arguments.ptr_Q = block_Q.get();
+  arguments.dQ = stride_Q;
+  arguments.ptr_K = block_K.get();
+  arguments.dK = stride_K;
+  arguments.ptr_V = block_V.get();
+  arguments.dV = stride_K;
+  arguments.ptr_O = block_O.get();
+  arguments.dO = stride_Q;
+  arguments.ptr_LSE = block_LSE.get();
+  arguments.dLSE = stride_LSE;
+  arguments.ptr_dO = block_dO.get();
+  arguments.ddO = stride_Q;
+  arguments.ptr_dQ = block_dQ.get();
+  arguments.ddQ = stride_Q;
+  arguments.ptr_dK = block_dK.get();
+  arguments.ddK = stride_K;
+  arguments.ptr_dV = block_dV.get();
+  arguments.ddV = stride_K;
+  arguments.scale_softmax = softmax_scale(options);
+  arguments.varlen = varlen;
+  arguments.hw_info = hw_info;
+
+  return arguments;
+}
+
+bool verify(const Options &options) {
+
+  //
+  // Compute reference gradients, one batch at a time if the sequence lengths are variable
+  //
+
+  int batches = options.varlen ? options.b : 1;
+  for (int batch = 0; batch < batches; ++batch) {
+    int64_t offset_q = options.varlen ? int64_t(cumulative_seqlen_q[batch]) : 0;
+    int64_t offset_kv = options.varlen ? int64_t(cumulative_seqlen_kv[batch]) : 0;
+    ProblemShape problem_shape = options.varlen
+      ? ProblemShape{seqlen_q[batch], seqlen_kv[batch], options.d, {options.h, 1}}
+      : problem_shape_from_options(options);
+    int64_t q = offset_q * get<0>(stride_Q);
+    int64_t kv = offset_kv * get<0>(stride_K);
+
+    cutlass::fmha::reference::fmha_bwd_reference(
+      problem_shape,
+      static_cast<Element const*>(block_Q.get() + q), stride_Q,
+      static_cast<Element const*>(block_K.get() + kv), stride_K,
+      static_cast<Element const*>(block_V.get() + kv), stride_K,
+      static_cast<Element const*>(block_O.get() + q), stride_Q,
+      static_cast<ElementAccumulator const*>(block_LSE.get() + offset_q), stride_LSE,
+      static_cast<Element const*>(block_dO.get() + q), stride_Q,
+      block_ref_dQ.get() + q, stride_Q,
+      block_ref_dK.get() + kv, stride_K,
+      block_ref_dV.get() + kv, stride_K,
+      softmax_scale(options),
+      options.causal);
+  }
+
+  // Wait for kernel to finish
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Check if output from CUTLASS kernel and reference kernel are relatively equal or not
+  bool passed_dQ = cutlass::reference::device::BlockCompareRelativelyEqual(
+    block_ref_dQ.get(), block_dQ.get(), block_dQ.size(), Element(0.05f), Element(0.05f));
+  bool passed_dK = cutlass::reference::device::BlockCompareRelativelyEqual(
+    block_ref_dK.get(), block_dK.get(), block_dK.size(), Element(0.05f), Element(0.05f));
+  bool passed_dV = cutlass::reference::device::BlockCompareRelativelyEqual(
+    block_ref_dV.get(), block_dV.get(), block_dV.size(), Element(0.05f), Element(0.05f));
+
+  return passed_dQ && passed_dK && passed_dV;
+}
+
+/// Compute performance in TFLOP/s
+double tflops(const Options &options, double runtime_s) {
+  // Five GEMMs of two flops per multiply-add, half of the scores are masked out if causal
+  double flop = 0;
+  for (int batch = 0; batch < options.b; ++batch) {
+    flop += 10.0 * options.h * double(seqlen_q[batch]) * double(seqlen_kv[batch]) * options.d;
+  }
+  if (options.causal) {
+    flop *= 0.5;
+  }
+  return flop / double(1.0e12) / runtime_s;
+}
+
+/// Execute a given example FMHA backward computation
+template <typename FmhaBwd>
+int run(Options &options)
+{
+  initialize(options);
+
+  // Instantiate CUTLASS kernel depending on templates
+  FmhaBwd fmha_bwd;
+
+  // Create a structure of fmha kernel arguments suitable for invoking an instance of FmhaBwd
+  auto arguments = args_from_options<FmhaBwd>(options);
+
+  // Using the arguments, query for extra workspace required for the computation
+  size_t workspace_size = FmhaBwd::get_workspace_size(arguments);
+
+  // Allocate workspace memory
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(fmha_bwd.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer
+  CUTLASS_CHECK(fmha_bwd.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(fmha_bwd.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  Result result;
+  if (options.verify) {
+    result.passed = verify(options);
+
+    std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+    if (!result.passed) {
+      exit(-1);
+    }
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0)
+  {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(fmha_bwd.run());
+    }
+    timer.stop();
+
+    // Compute average runtime and TFLOPs.
+    float elapsed_ms = timer.elapsed_millis();
+    result.avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+    result.tflops = tflops(options, result.avg_runtime_ms / 1000.0);
+
+    std::cout << "  Problem Size: " << options.b << 'x' << options.h << 'x' << options.q << 'x' << options.k
+              << 'x' << options.d << (options.causal ? " (causal)" : "")
+              << (options.varlen ? " (variable sequence lengths)" : "") << std::endl;
+    std::cout << "  Avg runtime: " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  TFLOPS: " << result.tflops << std::endl;
+  }
+
+  return 0;
+}
+
+template <class HeadDim>
+int run_head_dim(Options &options) {
+  if (options.causal) {
+    return run<typename FmhaBwdConfig<HeadDim, cutlass::fmha::collective::CausalMask>::FmhaBwd>(options);
+  }
+  return run<typename FmhaBwdConfig<HeadDim, cutlass::fmha::collective::ResidualMask>::FmhaBwd>(options);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture "
+      << "(compute capability 90).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  if (options.d == 128) {
+    run_head_dim<_128>(options);
+  }
+  else if (options.d == 64) {
+    run_head_dim<_64>(options);
+  }
+  else {
+    std::cerr << "Only head dimensions of 64 and 128 are supported.\n";
+    return -1;
+  }
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,160 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Helpers shared by the Hopper FMHA collectives: GMMA issue wrappers and conversions
+    between the accumulator layout of a GMMA and the layouts used for softmax and for register
+    sourced A operands, and the lookup of variable sequence lengths.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/arch/mma_sm90_desc.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Issues a batch of GMMAs for C = A * B (or C += A * B if ZeroInit is false) over all K blocks
+/// of the fragments, and commits it. Callers are responsible for waiting on the batch.
+template <bool ZeroInit, class TiledMma, class FrgTensorA, class FrgTensorB, class FrgTensorC>
+CUTLASS_DEVICE void
+gemm_and_commit(TiledMma& tiled_mma, FrgTensorA const& tCrA, FrgTensorB const& tCrB, FrgTensorC& tCrC) {
+  constexpr bool IsRegisterSourcedA =
+    not cute::is_base_of<GMMA::DescriptorIterator, typename TiledMma::FrgTypeA>::value;
+  if constexpr (IsRegisterSourcedA) {
+    warpgroup_fence_operand(const_cast<FrgTensorA&>(tCrA));
+  }
+  warpgroup_fence_operand(tCrC);
+  warpgroup_arrive();
+  if constexpr (ZeroInit) {
+    tiled_mma.accumulate_ = GMMA::ScaleOut::Zero;
+  }
+  CUTLASS_PRAGMA_UNROLL
+  for (int k_block = 0; k_block < size<2>(tCrA); ++k_block) {
+    // (V,M,K) x (V,N,K) => (V,M,N)
+    cute::gemm(tiled_mma, tCrA(_,_,k_block), tCrB(_,_,k_block), tCrC);
+    tiled_mma.accumulate_ = GMMA::ScaleOut::One;
+  }
+  warpgroup_commit_batch();
+  warpgroup_fence_operand(tCrC);
+  if constexpr (IsRegisterSourcedA) {
+    warpgroup_fence_operand(const_cast<FrgTensorA&>(tCrA));
+  }
+}
+
+/// Views a GMMA accumulator layout ((2,2,N/8),MMA_M,MMA_N) as ((2,MMA_M),(2,N/8,MMA_N)), i.e.
+/// (row, col) of the values held by a thread
+template <class Layout>
+CUTE_HOST_DEVICE constexpr auto
+convert_c_layout_to_rowcol(Layout const& acc_layout) {
+  static_assert(decltype(rank(acc_layout))::value == 3, "Expected a (MMA,MMA_M,MMA_N) accumulator");
+  static_assert(decltype(rank<0>(acc_layout))::value == 3, "Expected a GMMA accumulator");
+  return make_layout(
+    make_layout(get<0,1>(acc_layout), get<1>(acc_layout)),
+    make_layout(get<0,0>(acc_layout), get<0,2>(acc_layout), get<2>(acc_layout)));
+}
+
+/// Views a GMMA accumulator layout ((2,2,N/8),MMA_M,MMA_N) as the layout ((2,2,2),MMA_M,MMA_K)
+/// of a register sourced 16b A operand, so that the accumulator of a first GEMM can feed the
+/// A operand of a second without any data movement
+template <class Layout>
+CUTE_HOST_DEVICE constexpr auto
+convert_c_layout_to_a_layout(Layout const& acc_layout) {
+  static_assert(decltype(rank(acc_layout))::value == 3, "Expected a (MMA,MMA_M,MMA_N) accumulator");
+  static_assert(decltype(size<0,0>(acc_layout))::value == 2, "Expected a GMMA accumulator");
+  static_assert(decltype(size<0,1>(acc_layout))::value == 2, "Expected a GMMA accumulator");
+  // (2,2,(2,N/16))
+  auto l = logical_divide(get<0>(acc_layout), Shape<Underscore,Underscore,_2>{});
+  return make_layout(
+    make_layout(get<0>(l), get<1>(l), get<2,0>(l)),
+    get<1>(acc_layout),
+    make_layout(get<2,1>(l), get<2>(acc_layout)));
+}
+
+/// Reduces a value across the 4 threads of a quad, which hold the same rows of a GMMA accumulator
+template <class T, class ReductionOp>
+CUTLASS_DEVICE T
+quad_allreduce(T value, ReductionOp const& op) {
+  value = op(value, __shfl_xor_sync(0xffffffff, value, 1));
+  value = op(value, __shfl_xor_sync(0xffffffff, value, 2));
+  return value;
+}
+
+/// Variable sequence lengths. If cumulative_seqlen_q is non-null, the sequences of all the batches
+/// are packed along the sequence mode of the tensors: batch b occupies the rows
+/// [cumulative_seqlen_q[b], cumulative_seqlen_q[b+1]) of Q, O and dO, and likewise for K and V with
+/// cumulative_seqlen_kv. The sequence modes of the problem shape are then the total lengths, the
+/// batch mode of the tensor strides is ignored, and max_seqlen_* bound the length of any batch.
+struct VariableSeqlen {
+  int const* cumulative_seqlen_q = nullptr;
+  int const* cumulative_seqlen_kv = nullptr;
+  int max_seqlen_q = 0;
+  int max_seqlen_kv = 0;
+
+  CUTLASS_HOST_DEVICE
+  bool is_variable() const {
+    return cumulative_seqlen_q != nullptr;
+  }
+};
+
+/// Returns the problem shape of the (head, batch) at hb_coord, the (q, kv) offsets of its sequences
+/// along the sequence modes of the tensors, and its coordinate along their (NumHeads, Batch) mode.
+template <class ProblemShape, class HBCoord>
+CUTLASS_DEVICE auto
+get_batch_problem(ProblemShape const& problem_shape, VariableSeqlen const& varlen, HBCoord const& hb_coord) {
+  int head = get<0>(hb_coord);
+  int batch = get<1>(hb_coord);
+  if (varlen.is_variable()) {
+    int offset_q = varlen.cumulative_seqlen_q[batch];
+    int offset_kv = varlen.cumulative_seqlen_kv[batch];
+    ProblemShape batch_problem_shape{
+      varlen.cumulative_seqlen_q[batch + 1] - offset_q,
+      varlen.cumulative_seqlen_kv[batch + 1] - offset_kv,
+      get<2>(problem_shape),
+      get<3>(problem_shape)};
+    return cute::make_tuple(batch_problem_shape, cute::make_tuple(offset_q, offset_kv), cute::make_coord(head, 0));
+  }
+  return cute::make_tuple(problem_shape, cute::make_tuple(0, 0), cute::make_coord(head, batch));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,195 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Masks applied to the attention scores S = Q * K^T of the Hopper FMHA.
+
+    A mask decides how many KV tiles a Q tile visits (get_trip_count), how many of the trailing
+    tiles need element-wise masking (get_masked_trip_count), and applies it (apply_mask) given the
+    (q, k) coordinate of each accumulator element. The producer and the consumers of a CTA must
+    agree on the trip count, so it only depends on the block coordinate and the problem size.
+
+    The backward pass iterates over the Q tiles for a KV tile instead: get_bwd_q_tile_start is
+    the first Q tile that sees the KV tile at blk_coord = (_, kv_tile, _), and is_bwd_masked_q_tile
+    tells whether a Q tile needs element-wise masking.
+
+    Problem shapes are (SeqQ, SeqKV, HeadDim, (NumHeads, Batch)); tile shapes are
+    (BlkQ, BlkKV, HeadDim).
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/platform/platform.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Every key is visible to every query. Only valid if SeqKV is a multiple of BlkKV.
+struct NoMask {
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static int
+  get_trip_count(BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    return cutlass::ceil_div(int(get<1>(problem_shape)), int(get<1>(tile_shape)));
+  }
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static int
+  get_masked_trip_count(BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    return 0;
+  }
+
+  template <class AccQK, class IndexQK, class ProblemShape>
+  CUTLASS_DEVICE static void
+  apply_mask(AccQK& acc_qk, IndexQK const& index_qk, ProblemShape const& problem_shape) { }
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static int
+  get_bwd_q_tile_start(BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    return 0;
+  }
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static bool
+  is_bwd_masked_q_tile(int q_tile, BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    return false;
+  }
+
+  template <class ProblemShape, class TileShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, TileShape const& tile_shape) {
+    return get<1>(problem_shape) % get<1>(tile_shape) == 0;
+  }
+};
+
+/// Every key is visible to every query, and keys past SeqKV in the last KV tile are masked out.
+struct ResidualMask : NoMask {
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static int
+  get_masked_trip_count(BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    return get<1>(problem_shape) % get<1>(tile_shape) != 0 ? 1 : 0;
+  }
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static bool
+  is_bwd_masked_q_tile(int q_tile, BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    // Only the last KV tile can extend past SeqKV
+    return (int(get<1>(blk_coord)) + 1) * int(get<1>(tile_shape)) > int(get<1>(problem_shape));
+  }
+
+  template <class AccQK, class IndexQK, class ProblemShape>
+  CUTLASS_DEVICE static void
+  apply_mask(AccQK& acc_qk, IndexQK const& index_qk, ProblemShape const& problem_shape) {
+    using ElementAccumulator = typename AccQK::value_type;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); ++i) {
+      if (get<1>(index_qk(i)) >= get<1>(problem_shape)) {
+        acc_qk(i) = -cutlass::platform::numeric_limits<ElementAccumulator>::infinity();
+      }
+    }
+  }
+
+  template <class ProblemShape, class TileShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, TileShape const& tile_shape) {
+    return true;
+  }
+};
+
+/// Query q only sees keys k <= q (causal mask aligned to the top-left corner), and keys past
+/// SeqKV are masked out.
+struct CausalMask : ResidualMask {
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static int
+  get_trip_count(BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    // Last query of the tile sees keys up to (and including) itself
+    int max_trip_count = cutlass::ceil_div(
+      (int(get<0>(blk_coord)) + 1) * int(get<0>(tile_shape)), int(get<1>(tile_shape)));
+    return cutlass::const_min(
+      ResidualMask::get_trip_count(blk_coord, tile_shape, problem_shape), max_trip_count);
+  }
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static int
+  get_masked_trip_count(BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    int trip_count = get_trip_count(blk_coord, tile_shape, problem_shape);
+    // KV tiles starting past the first query of the Q tile cross the diagonal
+    int first_masked_tile = int(get<0>(blk_coord)) * int(get<0>(tile_shape)) / int(get<1>(tile_shape));
+    int causal_masked = trip_count - cutlass::const_min(trip_count, first_masked_tile);
+    int residual_masked = ResidualMask::get_masked_trip_count(blk_coord, tile_shape, problem_shape);
+    return cutlass::const_max(causal_masked, residual_masked);
+  }
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static int
+  get_bwd_q_tile_start(BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    // First query that sees the first key of the KV tile
+    return int(get<1>(blk_coord)) * int(get<1>(tile_shape)) / int(get<0>(tile_shape));
+  }
+
+  template <class BlkCoord, class TileShape, class ProblemShape>
+  CUTLASS_HOST_DEVICE static bool
+  is_bwd_masked_q_tile(int q_tile, BlkCoord const& blk_coord, TileShape const& tile_shape, ProblemShape const& problem_shape) {
+    // The Q tile crosses the diagonal if its first query precedes the last key of the KV tile
+    int last_k = (int(get<1>(blk_coord)) + 1) * int(get<1>(tile_shape)) - 1;
+    return q_tile * int(get<0>(tile_shape)) < last_k ||
+           ResidualMask::is_bwd_masked_q_tile(q_tile, blk_coord, tile_shape, problem_shape);
+  }
+
+  template <class AccQK, class IndexQK, class ProblemShape>
+  CUTLASS_DEVICE static void
+  apply_mask(AccQK& acc_qk, IndexQK const& index_qk, ProblemShape const& problem_shape) {
+    using ElementAccumulator = typename AccQK::value_type;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); ++i) {
+      auto [q, k] = index_qk(i);
+      if (k > q || k >= get<1>(problem_shape)) {
+        acc_qk(i) = -cutlass::platform::numeric_limits<ElementAccumulator>::infinity();
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,198 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief FMHA backward epilogue for Hopper: dK and dV are staged in the K and V buffers of the
+    mainloop and written with predicated 128-bit stores, so that the last KV tile of a variable
+    length batch does not overwrite the next batch.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+
+#include "fmha_common.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class Element_,
+  class ElementAccumulator_,
+  class TileShape_,             // (BlkQ, BlkKV, HeadDim)
+  class StrideKV_,              // (SeqKV, HeadDim, (NumHeads, Batch)) of dK and dV
+  class SmemLayoutKV_,          // (BlkKV, HeadDim), aliases the K and V buffers of the mainloop
+  int NumMmaThreads_ = 256
+>
+struct Sm90FmhaBwdEpilogue {
+  //
+  // Type Aliases
+  //
+  using Element = Element_;
+  using ElementAccumulator = ElementAccumulator_;
+  using TileShape = TileShape_;
+  using StrideKV = StrideKV_;
+  using SmemLayoutKV = SmemLayoutKV_;
+  static constexpr int NumMmaThreads = NumMmaThreads_;
+
+  static_assert(rank(SmemLayoutKV{}) == 2, "SmemLayoutKV must be rank 2 (BlkKV, HeadDim)");
+
+  using BlkKV = decltype(get<1>(TileShape{}));
+  using HeadDim = decltype(get<2>(TileShape{}));
+
+  // Each thread stores 128 bits of a row at a time
+  static constexpr int ElementsPerStore = 128 / sizeof_bits_v<Element>;
+  static_assert(HeadDim{} % ElementsPerStore == 0, "HeadDim must be a multiple of the store width.");
+  static constexpr int StoresPerRow = HeadDim{} / ElementsPerStore;
+  static_assert(NumMmaThreads % StoresPerRow == 0, "A row must be stored by a whole number of threads.");
+  static constexpr int RowsPerStore = NumMmaThreads / StoresPerRow;
+
+  // Host side epilogue arguments
+  struct Arguments {
+    Element* ptr_dK;
+    StrideKV ddK;
+    Element* ptr_dV;
+    StrideKV ddV;
+  };
+
+  // Device side epilogue params
+  using Params = Arguments;
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) problem_shape;
+    (void) workspace;
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto is_aligned = [](auto const& stride) {
+      return get<0>(stride)   % ElementsPerStore == 0 &&
+             get<2,0>(stride) % ElementsPerStore == 0 &&
+             get<2,1>(stride) % ElementsPerStore == 0;
+    };
+    bool implementable = is_aligned(args.ddK) && is_aligned(args.ddV);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: dK and dV rows must be aligned to 128 bits.\n");
+    }
+    return implementable;
+  }
+
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& params) { }
+
+  /// Writes the dK and dV accumulators of the KV tile at blk_coord. problem_shape, tensor_shape
+  /// and seq_offset are those given to the mainloop. Must be called by all the NumMmaThreads math
+  /// threads, thread_idx being the index among them.
+  template <class BlkCoord, class ProblemShape, class SeqOffset, class TiledMma, class FrgKV>
+  CUTLASS_DEVICE void
+  store(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      ProblemShape const& tensor_shape,
+      SeqOffset const& seq_offset,
+      Params const& params,
+      FrgKV const& tdKrdK,
+      FrgKV const& tdVrdV,
+      TiledMma const& tiled_mma,
+      int thread_idx,
+      Element* smem_k,
+      Element* smem_v) {
+    auto [Q, K, D, HB] = tensor_shape;
+    auto kv_coord = get<1>(blk_coord);
+    auto hb_coord = get<2>(blk_coord);
+    auto offset_kv = get<1>(seq_offset);
+
+    Tensor sdK = make_tensor(make_smem_ptr(smem_k), SmemLayoutKV{});                         // (BLK_KV,D)
+    Tensor sdV = make_tensor(make_smem_ptr(smem_v), SmemLayoutKV{});                         // (BLK_KV,D)
+    auto thread_mma = tiled_mma.get_thread_slice(thread_idx);
+    Tensor tdKsdK = thread_mma.partition_C(sdK);                                             // (MMA,MMA_KV,MMA_D)
+    Tensor tdVsdV = thread_mma.partition_C(sdV);                                             // (MMA,MMA_KV,MMA_D)
+
+    // All the GMMAs reading K and V must have retired before they are overwritten
+    cutlass::arch::NamedBarrier::sync(NumMmaThreads, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier);
+
+    cutlass::NumericConverter<Element, ElementAccumulator, FloatRoundStyle::round_to_nearest> convert;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(tdKrdK); ++i) {
+      tdKsdK(i) = convert(tdKrdK(i));
+      tdVsdV(i) = convert(tdVrdV(i));
+    }
+
+    cutlass::arch::NamedBarrier::sync(NumMmaThreads, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier);
+
+    Tensor mdK = make_tensor(make_gmem_ptr(params.ptr_dK), make_layout(make_shape(K, D, HB), params.ddK));  // (kv,d,hb)
+    Tensor mdV = make_tensor(make_gmem_ptr(params.ptr_dV), make_layout(make_shape(K, D, HB), params.ddV));  // (kv,d,hb)
+    Tensor gdK = local_tile(domain_offset(make_coord(offset_kv, _0{}), mdK(_,_,hb_coord)),
+                            select<1,2>(TileShape{}), make_coord(kv_coord, _0{}));            // (BLK_KV,D)
+    Tensor gdV = local_tile(domain_offset(make_coord(offset_kv, _0{}), mdV(_,_,hb_coord)),
+                            select<1,2>(TileShape{}), make_coord(kv_coord, _0{}));            // (BLK_KV,D)
+
+    // Swizzles keep 128-bit chunks of a row contiguous, so the stores read whole chunks
+    int col = (thread_idx % StoresPerRow) * ElementsPerStore;
+    int kv_residue = int(get<1>(problem_shape)) - int(kv_coord) * int(BlkKV{});
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = thread_idx / StoresPerRow; row < BlkKV{}; row += RowsPerStore) {
+      if (row < kv_residue) {
+        Array<Element, ElementsPerStore> frag_dk, frag_dv;
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < ElementsPerStore; ++i) {
+          frag_dk[i] = sdK(row, col + i);
+          frag_dv[i] = sdV(row, col + i);
+        }
+        *reinterpret_cast<uint128_t*>(&gdK(row, col)) = *reinterpret_cast<uint128_t const*>(frag_dk.data());
+        *reinterpret_cast<uint128_t*>(&gdV(row, col)) = *reinterpret_cast<uint128_t const*>(frag_dv.data());
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,657 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief FMHA backward mainloop for Hopper: a CTA owns a KV tile, keeps K and V in shared memory,
+    and streams the Q and dO tiles that see it through a PipelineTmaAsync.
+
+    Two math warp groups each own 64 rows of the KV tile. For every Q tile they compute
+
+      S^T  = K * Q^T                    P^T  = exp(scale * S^T - LSE)
+      dP^T = V * dO^T                   dS^T = P^T o (dP^T - rowsum(dO o O))
+      dV  += P^T * dO                   dK  += dS^T * Q
+      dQ   = dS * K
+
+    in the transposed orientation, so that dV and dK stay in registers across the Q tiles and P^T
+    and dS^T feed the GMMAs of dV and dK straight from registers. dS is staged in shared memory for
+    dQ, whose partial sum over this KV tile is added to a float accumulator in global memory with a
+    TMA reduce-add. dK is returned scaled by the softmax scale; dQ is scaled when the accumulator is
+    converted (see FmhaBwdConvertdQ).
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/gemm/collective/builders/sm90_common.inl"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/atom/copy_traits_sm90_tma.hpp"
+
+#include "fmha_common.hpp"
+#include "fmha_fusion.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class Element_,
+  class ElementAccumulator_,
+  class TileShape_,             // (BlkQ, BlkKV, HeadDim)
+  class StrideQKVO_,            // (Seq, HeadDim, (NumHeads, Batch)) of Q, K, V, dO and the dQ accumulator
+  class StrideLSE_,             // (SeqQ, (NumHeads, Batch)) of LSE and rowsum(dO o O)
+  class Mask_,
+  int Stages_ = 2
+>
+struct Sm90FmhaBwdMainloopTmaWarpspecialized {
+  //
+  // Type Aliases
+  //
+  using Element = Element_;
+  using ElementAccumulator = ElementAccumulator_;
+  using TileShape = TileShape_;
+  using StrideQKVO = StrideQKVO_;
+  using StrideLSE = StrideLSE_;
+  using Mask = Mask_;
+  using ArchTag = cutlass::arch::Sm90;
+  using ClusterShape = Shape<_1,_1,_1>;
+  static constexpr int Stages = Stages_;
+
+  static constexpr int NumMmaWarpGroups = 2;
+  static constexpr int NumMmaThreads = NumMmaWarpGroups * NumThreadsPerWarpGroup;
+
+  using BlkQ = decltype(get<0>(TileShape{}));
+  using BlkKV = decltype(get<1>(TileShape{}));
+  using HeadDim = decltype(get<2>(TileShape{}));
+
+  static_assert(BlkKV{} == 64 * NumMmaWarpGroups, "Each math warp group computes 64 rows of the KV tile.");
+  static_assert(BlkQ{} % 64 == 0, "The Q tile is the M mode of dQ = dS * K.");
+  static_assert(HeadDim{} % (8 * NumMmaWarpGroups) == 0, "The math warp groups split the head dimension of dQ.");
+  static_assert(sizeof_bits_v<Element> == 16, "P and dS are sourced from registers by GMMA, which requires 16b inputs.");
+  static_assert(Stages >= 2, "Specialization requires Stages set to value 2 or more.");
+
+  // S^T = K * Q^T and dP^T = V * dO^T : (BlkKV, BlkQ, HeadDim)
+  using TileShapeSdP = decltype(select<1,0,2>(TileShape{}));
+  // dV = P^T * dO and dK = dS^T * Q : (BlkKV, HeadDim, BlkQ)
+  using TileShapedKV = decltype(select<1,2,0>(TileShape{}));
+  // dQ = dS * K, one half of HeadDim per math warp group : (BlkQ, HeadDim / 2, BlkKV)
+  using TileShapedQ = Shape<BlkQ, Int<HeadDim{} / NumMmaWarpGroups>, BlkKV>;
+
+  using TiledMmaSdP = decltype(cute::make_tiled_mma(
+      cute::GMMA::ss_op_selector<Element, Element, ElementAccumulator, TileShapeSdP>(),
+      Layout<Shape<Int<NumMmaWarpGroups>,_1,_1>>{}));
+  // P^T and dS^T are sourced from registers, dO and Q are the MN-major B operands
+  using TiledMmadKV = decltype(cute::make_tiled_mma(
+      cute::GMMA::rs_op_selector<Element, Element, ElementAccumulator, TileShapedKV,
+                                 GMMA::Major::K, GMMA::Major::MN>(),
+      Layout<Shape<Int<NumMmaWarpGroups>,_1,_1>>{}));
+  // Both math warp groups read all of dS, K is the MN-major B operand
+  using TiledMmadQ = decltype(cute::make_tiled_mma(
+      cute::GMMA::ss_op_selector<Element, Element, ElementAccumulator, TileShapedQ,
+                                 GMMA::Major::K, GMMA::Major::MN>(),
+      Layout<Shape<_1,Int<NumMmaWarpGroups>,_1>>{}));
+
+  using SmemLayoutAtomQ = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, BlkQ, HeadDim>());
+  using SmemLayoutAtomKV = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, BlkKV, HeadDim>());
+  using SmemLayoutAtomdS = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, BlkQ, BlkKV>());
+
+  // Q and dO are stored as (BlkQ, HeadDim) tiles with HeadDim contiguous
+  using SmemLayoutQ = decltype(tile_to_shape(
+      SmemLayoutAtomQ{},
+      make_shape(BlkQ{}, HeadDim{}, Int<Stages>{})));
+  using SmemLayoutdO = SmemLayoutQ;
+  using SmemLayoutK = decltype(tile_to_shape(
+      SmemLayoutAtomKV{},
+      make_shape(BlkKV{}, HeadDim{})));
+  using SmemLayoutV = SmemLayoutK;
+  using SmemLayoutdS = decltype(tile_to_shape(
+      SmemLayoutAtomdS{},
+      make_shape(BlkQ{}, BlkKV{})));
+  // Unswizzled staging buffer of the dQ partial sums for the TMA reduce-add
+  using SmemLayoutdQaccum = Layout<Shape<BlkQ, HeadDim>, Stride<HeadDim, _1>>;
+
+  // Transposed views of the same buffers: a K-major tile read as the MN-major operand of another
+  // GMMA, and dS^T written from the accumulators of S^T
+  using SmemLayoutQt = decltype(cute::composition(SmemLayoutQ{},
+      make_layout(make_shape(HeadDim{}, BlkQ{}, Int<Stages>{}), make_stride(BlkQ{}, _1{}, BlkQ{} * HeadDim{}))));
+  using SmemLayoutdOt = SmemLayoutQt;
+  using SmemLayoutKt = decltype(cute::composition(SmemLayoutK{},
+      make_layout(make_shape(HeadDim{}, BlkKV{}), make_stride(BlkKV{}, _1{}))));
+  using SmemLayoutdSt = decltype(cute::composition(SmemLayoutdS{},
+      make_layout(make_shape(BlkKV{}, BlkQ{}), make_stride(BlkQ{}, _1{}))));
+
+  // K and V are loaded once per tile, Q and dO are streamed through the stages together
+  using MainloopPipelineKV = cutlass::PipelineTmaAsync<1>;
+  using MainloopPipelineQdO = cutlass::PipelineTmaAsync<Stages>;
+  using PipelineStateKV = cutlass::PipelineState<1>;
+  using PipelineStateQdO = cutlass::PipelineState<Stages>;
+
+  struct TensorStorage : cute::aligned_struct<128, _0> {
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutQ>> smem_q;
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutdO>> smem_do;
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutK>> smem_k;
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutV>> smem_v;
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutdS>> smem_ds;
+    cute::array_aligned<ElementAccumulator, cute::cosize_v<SmemLayoutdQaccum>> smem_dqaccum;
+  };
+
+  struct PipelineStorage {
+    alignas(16) typename MainloopPipelineKV::SharedStorage kv;
+    alignas(16) typename MainloopPipelineQdO::SharedStorage q_do;
+  };
+
+  static constexpr uint32_t TmaTransactionBytesKV =
+      2 * cutlass::bits_to_bytes(size(SmemLayoutK{}) * static_cast<uint32_t>(sizeof_bits<Element>::value));
+  static constexpr uint32_t TmaTransactionBytesQdO =
+      2 * cutlass::bits_to_bytes(size<0>(SmemLayoutQ{}) * size<1>(SmemLayoutQ{}) * static_cast<uint32_t>(sizeof_bits<Element>::value));
+
+  // Named barriers of the math warp groups around the dS and dQ staging buffers
+  static constexpr int dSBarrierId = static_cast<int>(cutlass::arch::ReservedNamedBarriers::FirstUserBarrier);
+  static constexpr int dQBarrierId = dSBarrierId + 1;
+
+  // Host side kernel arguments
+  struct Arguments {
+    Element const* ptr_Q;
+    StrideQKVO dQ;
+    Element const* ptr_K;
+    StrideQKVO dK;
+    Element const* ptr_V;
+    StrideQKVO dV;
+    Element const* ptr_dO;
+    StrideQKVO ddO;
+    // Logsumexp of the scaled scores written by the forward pass
+    ElementAccumulator const* ptr_LSE;
+    StrideLSE dLSE;
+    // rowsum(dO o O), see FmhaBwdSumOdO
+    ElementAccumulator const* ptr_dPsum;
+    StrideLSE ddPsum;
+    // Float accumulator of dQ, zero-initialized
+    ElementAccumulator* ptr_dQaccum;
+    StrideQKVO ddQaccum;
+    // Scale applied to S before the softmax, usually 1 / sqrt(HeadDim)
+    float scale_softmax = 1.f;
+  };
+
+  // Device side kernel params
+  struct Params {
+    using TMA_Q = decltype(make_tma_copy(
+        SM90_TMA_LOAD{},
+        make_tensor(make_gmem_ptr(static_cast<Element const*>(nullptr)), repeat_like(StrideQKVO{}, int32_t(0)), StrideQKVO{}),
+        SmemLayoutQ{}(_,_,_0{}),
+        select<0,2>(TileShape{}),
+        _1{}));
+    using TMA_K = decltype(make_tma_copy(
+        SM90_TMA_LOAD{},
+        make_tensor(make_gmem_ptr(static_cast<Element const*>(nullptr)), repeat_like(StrideQKVO{}, int32_t(0)), StrideQKVO{}),
+        SmemLayoutK{},
+        select<1,2>(TileShape{}),
+        _1{}));
+    using TMA_dQ = decltype(make_tma_copy(
+        SM90_TMA_REDUCE_ADD{},
+        make_tensor(make_gmem_ptr(static_cast<ElementAccumulator*>(nullptr)), repeat_like(StrideQKVO{}, int32_t(0)), StrideQKVO{}),
+        SmemLayoutdQaccum{},
+        select<0,2>(TileShape{}),
+        _1{}));
+
+    TMA_Q tma_load_q;
+    TMA_Q tma_load_do;
+    TMA_K tma_load_k;
+    TMA_K tma_load_v;
+    TMA_dQ tma_reduce_dq;
+    ElementAccumulator const* ptr_LSE;
+    StrideLSE dLSE;
+    ElementAccumulator const* ptr_dPsum;
+    StrideLSE ddPsum;
+    float scale_softmax;
+    float scale_softmax_log2;
+  };
+
+  //
+  // Methods
+  //
+
+  /// problem_shape is the shape of the tensors: the total sequence lengths and a single batch if
+  /// the sequence lengths are variable
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+    auto [Q, K, D, HB] = problem_shape;
+
+    Tensor mQ = make_tensor(make_gmem_ptr(args.ptr_Q), make_layout(make_shape(Q, D, HB), args.dQ));
+    Tensor mdO = make_tensor(make_gmem_ptr(args.ptr_dO), make_layout(make_shape(Q, D, HB), args.ddO));
+    Tensor mK = make_tensor(make_gmem_ptr(args.ptr_K), make_layout(make_shape(K, D, HB), args.dK));
+    Tensor mV = make_tensor(make_gmem_ptr(args.ptr_V), make_layout(make_shape(K, D, HB), args.dV));
+    Tensor mdQaccum = make_tensor(make_gmem_ptr(args.ptr_dQaccum), make_layout(make_shape(Q, D, HB), args.ddQaccum));
+
+    auto tma_load_q = make_tma_copy(SM90_TMA_LOAD{}, mQ, SmemLayoutQ{}(_,_,_0{}), select<0,2>(TileShape{}), _1{});
+    auto tma_load_do = make_tma_copy(SM90_TMA_LOAD{}, mdO, SmemLayoutdO{}(_,_,_0{}), select<0,2>(TileShape{}), _1{});
+    auto tma_load_k = make_tma_copy(SM90_TMA_LOAD{}, mK, SmemLayoutK{}, select<1,2>(TileShape{}), _1{});
+    auto tma_load_v = make_tma_copy(SM90_TMA_LOAD{}, mV, SmemLayoutV{}, select<1,2>(TileShape{}), _1{});
+    auto tma_reduce_dq = make_tma_copy(SM90_TMA_REDUCE_ADD{}, mdQaccum, SmemLayoutdQaccum{}, select<0,2>(TileShape{}), _1{});
+
+    return {
+      tma_load_q,
+      tma_load_do,
+      tma_load_k,
+      tma_load_v,
+      tma_reduce_dq,
+      args.ptr_LSE,
+      args.dLSE,
+      args.ptr_dPsum,
+      args.ddPsum,
+      args.scale_softmax,
+      args.scale_softmax * static_cast<float>(M_LOG2E)
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    constexpr int min_tma_aligned_elements = tma_alignment_bits / cutlass::sizeof_bits<Element>::value;
+    auto [Q, K, D, HB] = problem_shape;
+
+    bool implementable = D == HeadDim{};
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Head dimension must match the tile shape.\n");
+      return implementable;
+    }
+
+    auto is_aligned = [&](auto const& stride) {
+      return get<0>(stride)   % min_tma_aligned_elements == 0 &&
+             get<2,0>(stride) % min_tma_aligned_elements == 0 &&
+             get<2,1>(stride) % min_tma_aligned_elements == 0;
+    };
+    implementable = is_aligned(args.dQ) && is_aligned(args.dK) && is_aligned(args.dV) && is_aligned(args.ddO);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+      return implementable;
+    }
+
+    implementable = Mask::can_implement(problem_shape, TileShape{});
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size isn't supported by the mask.\n");
+    }
+    return implementable;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& params) {
+    cute::prefetch_tma_descriptor(params.tma_load_q.get_tma_descriptor());
+    cute::prefetch_tma_descriptor(params.tma_load_do.get_tma_descriptor());
+    cute::prefetch_tma_descriptor(params.tma_load_k.get_tma_descriptor());
+    cute::prefetch_tma_descriptor(params.tma_load_v.get_tma_descriptor());
+    cute::prefetch_tma_descriptor(params.tma_reduce_dq.get_tma_descriptor());
+  }
+
+  /// Range [start, end) of the Q tiles that see the KV tile at blk_coord
+  template <class BlkCoord, class ProblemShape>
+  CUTLASS_DEVICE static auto
+  get_q_tile_range(BlkCoord const& blk_coord, ProblemShape const& problem_shape) {
+    int q_tile_start = Mask::get_bwd_q_tile_start(blk_coord, TileShape{}, problem_shape);
+    int q_tile_end = cutlass::ceil_div(int(get<0>(problem_shape)), int(BlkQ{}));
+    return cute::make_tuple(q_tile_start, q_tile_end);
+  }
+
+  /// Loads K/V and streams Q/dO for the tile at blk_coord = (_, kv_tile, (head, batch)).
+  /// problem_shape is the shape of the batch, tensor_shape the one given to to_underlying_arguments,
+  /// and seq_offset the (q, kv) offset of the batch along the sequence modes of the tensors.
+  /// Producer Perspective
+  template <class BlkCoord, class ProblemShape, class SeqOffset>
+  CUTLASS_DEVICE void
+  load(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      ProblemShape const& tensor_shape,
+      SeqOffset const& seq_offset,
+      Params const& params,
+      MainloopPipelineKV& pipeline_kv,
+      PipelineStateKV& smem_pipe_write_kv,
+      MainloopPipelineQdO& pipeline_q_do,
+      PipelineStateQdO& smem_pipe_write_q_do,
+      TensorStorage& shared_tensors) {
+    auto [q_tile_start, q_tile_end] = get_q_tile_range(blk_coord, problem_shape);
+    if (q_tile_start >= q_tile_end) {
+      return;
+    }
+
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      auto [Q, K, D, HB] = tensor_shape;
+      auto kv_coord = get<1>(blk_coord);
+      auto hb_coord = get<2>(blk_coord);
+      auto [offset_q, offset_kv] = seq_offset;
+
+      Tensor sQ = make_tensor(make_smem_ptr(shared_tensors.smem_q.data()), SmemLayoutQ{});     // (BLK_Q,D,PIPE)
+      Tensor sdO = make_tensor(make_smem_ptr(shared_tensors.smem_do.data()), SmemLayoutdO{});  // (BLK_Q,D,PIPE)
+      Tensor sK = make_tensor(make_smem_ptr(shared_tensors.smem_k.data()), SmemLayoutK{});     // (BLK_KV,D)
+      Tensor sV = make_tensor(make_smem_ptr(shared_tensors.smem_v.data()), SmemLayoutV{});     // (BLK_KV,D)
+
+      // TMA requires special handling of strides to deal with coord codomain mapping
+      // Represent the full tensors -- get these from TMA
+      Tensor mQ = params.tma_load_q.get_tma_tensor(make_shape(Q, D, HB));                      // (q,d,hb)
+      Tensor mdO = params.tma_load_do.get_tma_tensor(make_shape(Q, D, HB));                    // (q,d,hb)
+      Tensor mK = params.tma_load_k.get_tma_tensor(make_shape(K, D, HB));                      // (kv,d,hb)
+      Tensor mV = params.tma_load_v.get_tma_tensor(make_shape(K, D, HB));                      // (kv,d,hb)
+
+      // Tiles of a variable length batch may extend into the next one, whose rows are masked out
+      Tensor gQ = local_tile(domain_offset(make_coord(offset_q, _0{}), mQ(_,_,hb_coord)),
+                             select<0,2>(TileShape{}), make_coord(_, _0{}));                  // (BLK_Q,D,q)
+      Tensor gdO = local_tile(domain_offset(make_coord(offset_q, _0{}), mdO(_,_,hb_coord)),
+                              select<0,2>(TileShape{}), make_coord(_, _0{}));                 // (BLK_Q,D,q)
+      Tensor gK = local_tile(domain_offset(make_coord(offset_kv, _0{}), mK(_,_,hb_coord)),
+                             select<1,2>(TileShape{}), make_coord(kv_coord, _0{}));           // (BLK_KV,D)
+      Tensor gV = local_tile(domain_offset(make_coord(offset_kv, _0{}), mV(_,_,hb_coord)),
+                             select<1,2>(TileShape{}), make_coord(kv_coord, _0{}));           // (BLK_KV,D)
+
+      auto cta_tma_q = params.tma_load_q.get_slice(_0{});
+      auto cta_tma_do = params.tma_load_do.get_slice(_0{});
+      auto cta_tma_k = params.tma_load_k.get_slice(_0{});
+      auto cta_tma_v = params.tma_load_v.get_slice(_0{});
+
+      Tensor tQgQ = cta_tma_q.partition_S(gQ);                                                 // (TMA,TMA_Q,TMA_D,q)
+      Tensor tQsQ = cta_tma_q.partition_D(sQ);                                                 // (TMA,TMA_Q,TMA_D,PIPE)
+      Tensor tdOgdO = cta_tma_do.partition_S(gdO);                                             // (TMA,TMA_Q,TMA_D,q)
+      Tensor tdOsdO = cta_tma_do.partition_D(sdO);                                             // (TMA,TMA_Q,TMA_D,PIPE)
+      Tensor tKgK = cta_tma_k.partition_S(gK);                                                 // (TMA,TMA_KV,TMA_D)
+      Tensor tKsK = cta_tma_k.partition_D(sK);                                                 // (TMA,TMA_KV,TMA_D)
+      Tensor tVgV = cta_tma_v.partition_S(gV);                                                 // (TMA,TMA_KV,TMA_D)
+      Tensor tVsV = cta_tma_v.partition_D(sV);                                                 // (TMA,TMA_KV,TMA_D)
+
+      using BarrierType = typename MainloopPipelineQdO::ProducerBarrierType;
+
+      pipeline_kv.producer_acquire(smem_pipe_write_kv);
+      BarrierType* tma_barrier_kv = pipeline_kv.producer_get_barrier(smem_pipe_write_kv);
+      copy(params.tma_load_k.with(*tma_barrier_kv), tKgK, tKsK);
+      copy(params.tma_load_v.with(*tma_barrier_kv), tVgV, tVsV);
+      ++smem_pipe_write_kv;
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int q_tile = q_tile_start; q_tile < q_tile_end; ++q_tile) {
+        pipeline_q_do.producer_acquire(smem_pipe_write_q_do);
+        BarrierType* tma_barrier = pipeline_q_do.producer_get_barrier(smem_pipe_write_q_do);
+        int write_stage = smem_pipe_write_q_do.index();
+        copy(params.tma_load_q.with(*tma_barrier), tQgQ(_,_,_,q_tile), tQsQ(_,_,_,write_stage));
+        copy(params.tma_load_do.with(*tma_barrier), tdOgdO(_,_,_,q_tile), tdOsdO(_,_,_,write_stage));
+        ++smem_pipe_write_q_do;
+      }
+    }
+  }
+
+  /// Perform a Producer Epilogue to prevent early exit of blocks in a Cluster
+  CUTLASS_DEVICE void
+  load_tail(
+      MainloopPipelineKV& pipeline_kv,
+      PipelineStateKV& smem_pipe_write_kv,
+      MainloopPipelineQdO& pipeline_q_do,
+      PipelineStateQdO& smem_pipe_write_q_do) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      pipeline_kv.producer_tail(smem_pipe_write_kv);
+      pipeline_q_do.producer_tail(smem_pipe_write_q_do);
+    }
+  }
+
+  /// Computes dK and dV of the KV tile at blk_coord, and adds its contribution to the dQ
+  /// accumulator. Returns the (dK, dV) accumulators; dK is already scaled by scale_softmax.
+  /// Must be called by all the NumMmaThreads math threads, thread_idx being the index among them.
+  /// Consumer Perspective
+  template <class BlkCoord, class ProblemShape, class SeqOffset>
+  CUTLASS_DEVICE auto
+  mma(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      ProblemShape const& tensor_shape,
+      SeqOffset const& seq_offset,
+      Params const& params,
+      MainloopPipelineKV& pipeline_kv,
+      PipelineStateKV& smem_pipe_read_kv,
+      MainloopPipelineQdO& pipeline_q_do,
+      PipelineStateQdO& smem_pipe_read_q_do,
+      int thread_idx,
+      TensorStorage& shared_tensors) {
+    Tensor sQ = make_tensor(make_smem_ptr(shared_tensors.smem_q.data()), SmemLayoutQ{});       // (BLK_Q,D,PIPE)
+    Tensor sQt = make_tensor(make_smem_ptr(shared_tensors.smem_q.data()), SmemLayoutQt{});     // (D,BLK_Q,PIPE)
+    Tensor sdO = make_tensor(make_smem_ptr(shared_tensors.smem_do.data()), SmemLayoutdO{});    // (BLK_Q,D,PIPE)
+    Tensor sdOt = make_tensor(make_smem_ptr(shared_tensors.smem_do.data()), SmemLayoutdOt{});  // (D,BLK_Q,PIPE)
+    Tensor sK = make_tensor(make_smem_ptr(shared_tensors.smem_k.data()), SmemLayoutK{});       // (BLK_KV,D)
+    Tensor sKt = make_tensor(make_smem_ptr(shared_tensors.smem_k.data()), SmemLayoutKt{});     // (D,BLK_KV)
+    Tensor sV = make_tensor(make_smem_ptr(shared_tensors.smem_v.data()), SmemLayoutV{});       // (BLK_KV,D)
+    Tensor sdS = make_tensor(make_smem_ptr(shared_tensors.smem_ds.data()), SmemLayoutdS{});    // (BLK_Q,BLK_KV)
+    Tensor sdSt = make_tensor(make_smem_ptr(shared_tensors.smem_ds.data()), SmemLayoutdSt{});  // (BLK_KV,BLK_Q)
+    Tensor sdQaccum = make_tensor(make_smem_ptr(shared_tensors.smem_dqaccum.data()), SmemLayoutdQaccum{}); // (BLK_Q,D)
+
+    //
+    // Define C accumulators and A/B partitioning
+    //
+
+    TiledMmaSdP tiled_mma_sdp;
+    TiledMmadKV tiled_mma_dkv;
+    TiledMmadQ tiled_mma_dq;
+    auto thread_mma_sdp = tiled_mma_sdp.get_thread_slice(thread_idx);
+    auto thread_mma_dkv = tiled_mma_dkv.get_thread_slice(thread_idx);
+    auto thread_mma_dq = tiled_mma_dq.get_thread_slice(thread_idx);
+
+    // Allocate "fragments/descriptors"
+    Tensor tSrK = thread_mma_sdp.make_fragment_A(thread_mma_sdp.partition_A(sK));             // (MMA,MMA_KV,MMA_D)
+    Tensor tSrQ = thread_mma_sdp.make_fragment_B(thread_mma_sdp.partition_B(sQ));             // (MMA,MMA_Q,MMA_D,PIPE)
+    Tensor tdPrV = thread_mma_sdp.make_fragment_A(thread_mma_sdp.partition_A(sV));            // (MMA,MMA_KV,MMA_D)
+    Tensor tdPrdO = thread_mma_sdp.make_fragment_B(thread_mma_sdp.partition_B(sdO));          // (MMA,MMA_Q,MMA_D,PIPE)
+    Tensor tdVrdO = thread_mma_dkv.make_fragment_B(thread_mma_dkv.partition_B(sdOt));         // (MMA,MMA_D,MMA_Q,PIPE)
+    Tensor tdKrQ = thread_mma_dkv.make_fragment_B(thread_mma_dkv.partition_B(sQt));           // (MMA,MMA_D,MMA_Q,PIPE)
+    Tensor tdQrdS = thread_mma_dq.make_fragment_A(thread_mma_dq.partition_A(sdS));            // (MMA,MMA_Q,MMA_KV)
+    Tensor tdQrK = thread_mma_dq.make_fragment_B(thread_mma_dq.partition_B(sKt));             // (MMA,MMA_D,MMA_KV)
+
+    Tensor tSrS = partition_fragment_C(tiled_mma_sdp, select<0,1>(TileShapeSdP{}));          // (MMA,MMA_KV,MMA_Q)
+    Tensor tdPrdP = partition_fragment_C(tiled_mma_sdp, select<0,1>(TileShapeSdP{}));        // (MMA,MMA_KV,MMA_Q)
+    Tensor tdVrdV = partition_fragment_C(tiled_mma_dkv, select<0,1>(TileShapedKV{}));        // (MMA,MMA_KV,MMA_D)
+    Tensor tdKrdK = partition_fragment_C(tiled_mma_dkv, select<0,1>(TileShapedKV{}));        // (MMA,MMA_KV,MMA_D)
+    Tensor tdQrdQ = partition_fragment_C(tiled_mma_dq, select<0,2>(TileShape{}));            // (MMA,MMA_Q,MMA_D)
+
+    // P^T and dS^T stay in registers as the A operands of dV and dK
+    Tensor tdVrP = make_tensor<Element>(convert_c_layout_to_a_layout(tSrS.layout()));        // (MMA,MMA_KV,MMA_Q)
+    Tensor tdVrP_acc = make_tensor(tdVrP.data(), tSrS.layout());                             // (MMA,MMA_KV,MMA_Q)
+    Tensor tdKrdS = make_tensor<Element>(convert_c_layout_to_a_layout(tdPrdP.layout()));     // (MMA,MMA_KV,MMA_Q)
+    Tensor tdKrdS_acc = make_tensor(tdKrdS.data(), tdPrdP.layout());                         // (MMA,MMA_KV,MMA_Q)
+
+    // dS^T is also written to shared memory for dQ, and dQ staged for the TMA reduce-add
+    Tensor tdSsdS = thread_mma_sdp.partition_C(sdSt);                                        // (MMA,MMA_KV,MMA_Q)
+    Tensor tdQsdQ = thread_mma_dq.partition_C(sdQaccum);                                     // (MMA,MMA_Q,MMA_D)
+
+    // (row, col) views, rows are keys and columns are queries
+    Tensor tSrS_rc = make_tensor(tSrS.data(), convert_c_layout_to_rowcol(tSrS.layout()));    // (ROW,COL)
+    Tensor tdPrdP_rc = make_tensor(tdPrdP.data(), convert_c_layout_to_rowcol(tdPrdP.layout())); // (ROW,COL)
+
+    // (q, kv) coordinates of the S^T accumulators, for masking and for the per-query statistics
+    Tensor cSt = make_counting_tensor(make_layout(
+        select<1,0>(problem_shape), make_stride(E<1>{}, E<0>{})));                            // (kv,q) -> (q,kv)
+    Tensor gcSt = local_tile(cSt, select<0,1>(TileShapeSdP{}), make_coord(get<1>(blk_coord), _)); // (BLK_KV,BLK_Q,q)
+    Tensor tScS = thread_mma_sdp.partition_C(gcSt);                                          // (MMA,MMA_KV,MMA_Q,q)
+
+    using ColShape = decltype(make_shape(size<1>(tSrS_rc)));
+    Tensor lse_log2 = make_tensor<ElementAccumulator>(ColShape{});
+    Tensor dpsum = make_tensor<ElementAccumulator>(ColShape{});
+
+    auto [Q, K, D, HB] = tensor_shape;
+    auto hb_coord = get<2>(blk_coord);
+    auto [offset_q, offset_kv] = seq_offset;
+    Tensor mLSE = make_tensor(make_gmem_ptr(params.ptr_LSE), make_layout(make_shape(Q, HB), params.dLSE));       // (q,hb)
+    Tensor mdPsum = make_tensor(make_gmem_ptr(params.ptr_dPsum), make_layout(make_shape(Q, HB), params.ddPsum));  // (q,hb)
+
+    Tensor mdQaccum = params.tma_reduce_dq.get_tma_tensor(make_shape(Q, D, HB));              // (q,d,hb)
+    Tensor gdQaccum = local_tile(domain_offset(make_coord(offset_q, _0{}), mdQaccum(_,_,hb_coord)),
+                                 select<0,2>(TileShape{}), make_coord(_, _0{}));              // (BLK_Q,D,q)
+    auto cta_tma_dq = params.tma_reduce_dq.get_slice(_0{});
+    Tensor tdQsdQaccum = cta_tma_dq.partition_S(sdQaccum);                                    // (TMA,TMA_Q,TMA_D)
+    Tensor tdQgdQaccum = cta_tma_dq.partition_D(gdQaccum);                                    // (TMA,TMA_Q,TMA_D,q)
+
+    clear(tdVrdV);
+    clear(tdKrdK);
+
+    auto [q_tile_start, q_tile_end] = get_q_tile_range(blk_coord, problem_shape);
+    if (q_tile_start >= q_tile_end) {
+      return cute::make_tuple(tdKrdK, tdVrdV);
+    }
+
+    pipeline_kv.consumer_wait(smem_pipe_read_kv);
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int q_tile = q_tile_start; q_tile < q_tile_end; ++q_tile) {
+      int read_stage = smem_pipe_read_q_do.index();
+
+      pipeline_q_do.consumer_wait(smem_pipe_read_q_do);
+      gemm_and_commit</*ZeroInit=*/true>(tiled_mma_sdp, tSrK, tSrQ(_,_,_,read_stage), tSrS);
+      gemm_and_commit</*ZeroInit=*/true>(tiled_mma_sdp, tdPrV, tdPrdO(_,_,_,read_stage), tdPrdP);
+
+      // Load the statistics of the queries held by the thread while the GEMMs run. Queries past
+      // SeqQ, and queries without any visible key, get an infinite LSE so that their P is 0.
+      Tensor tScS_rc = make_tensor(tScS(_,_,_,q_tile).data(),
+          convert_c_layout_to_rowcol(tScS(_,_,_,q_tile).layout()));                           // (ROW,COL)
+      CUTLASS_PRAGMA_UNROLL
+      for (int col = 0; col < size(lse_log2); ++col) {
+        int q = get<0>(tScS_rc(0, col));
+        ElementAccumulator lse = q < get<0>(problem_shape)
+          ? mLSE(offset_q + q, hb_coord)
+          : -cutlass::platform::numeric_limits<ElementAccumulator>::infinity();
+        bool is_empty = lse == -cutlass::platform::numeric_limits<ElementAccumulator>::infinity();
+        lse_log2(col) = is_empty
+          ? cutlass::platform::numeric_limits<ElementAccumulator>::infinity()
+          : lse * static_cast<float>(M_LOG2E);
+        dpsum(col) = is_empty ? ElementAccumulator(0) : mdPsum(offset_q + q, hb_coord);
+      }
+
+      warpgroup_wait<0>();
+
+      if (Mask::is_bwd_masked_q_tile(q_tile, blk_coord, TileShape{}, problem_shape)) {
+        Mask::apply_mask(tSrS, tScS(_,_,_,q_tile), problem_shape);
+      }
+
+      // P^T = exp(scale * S^T - LSE), dS^T = P^T o (dP^T - rowsum(dO o O))
+      CUTLASS_PRAGMA_UNROLL
+      for (int row = 0; row < size<0>(tSrS_rc); ++row) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int col = 0; col < size<1>(tSrS_rc); ++col) {
+          tSrS_rc(row, col) = exp2f(tSrS_rc(row, col) * params.scale_softmax_log2 - lse_log2(col));
+          tdPrdP_rc(row, col) = tSrS_rc(row, col) * (tdPrdP_rc(row, col) - dpsum(col));
+        }
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tSrS); ++i) {
+        tdVrP_acc(i) = static_cast<Element>(tSrS(i));
+        tdKrdS_acc(i) = static_cast<Element>(tdPrdP(i));
+      }
+
+      gemm_and_commit</*ZeroInit=*/false>(tiled_mma_dkv, tdVrP, tdVrdO(_,_,_,read_stage), tdVrdV);
+      gemm_and_commit</*ZeroInit=*/false>(tiled_mma_dkv, tdKrdS, tdKrQ(_,_,_,read_stage), tdKrdK);
+
+      // dQ needs the dS of both math warp groups. The previous dQ GEMMs have retired (see the
+      // barrier below), so dS can be overwritten.
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tdKrdS_acc); ++i) {
+        tdSsdS(i) = tdKrdS_acc(i);
+      }
+      if (thread_idx == 0) {
+        // The previous TMA reduce-add has read the dQ staging buffer
+        tma_store_wait<0>();
+      }
+      cutlass::arch::fence_view_async_shared();
+      cutlass::arch::NamedBarrier::sync(NumMmaThreads, dSBarrierId);
+
+      gemm_and_commit</*ZeroInit=*/true>(tiled_mma_dq, tdQrdS, tdQrK, tdQrdQ);
+      // Retires the GEMMs of dV, dK and dQ, after which Q and dO can be released
+      warpgroup_wait<0>();
+      pipeline_q_do.consumer_release(smem_pipe_read_q_do);
+      ++smem_pipe_read_q_do;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tdQrdQ); ++i) {
+        tdQsdQ(i) = tdQrdQ(i);
+      }
+      cutlass::arch::fence_view_async_shared();
+      cutlass::arch::NamedBarrier::sync(NumMmaThreads, dQBarrierId);
+
+      if (thread_idx == 0) {
+        // Rows past the end of the tensor are clipped by the TMA unit. Rows in the next batch of a
+        // variable length problem only add zeros, since their dS is 0.
+        copy(params.tma_reduce_dq, tdQsdQaccum, tdQgdQaccum(_,_,_,q_tile));
+        tma_store_arrive();
+      }
+    }
+
+    if (thread_idx == 0) {
+      tma_store_wait<0>();
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(tdKrdK); ++i) {
+      tdKrdK(i) *= params.scale_softmax;
+    }
+
+    return cute::make_tuple(tdKrdK, tdVrdV);
+  }
+
+  /// Releases K and V once the epilogue no longer needs their shared memory
+  template <class BlkCoord, class ProblemShape>
+  CUTLASS_DEVICE void
+  mma_tail(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      MainloopPipelineKV& pipeline_kv,
+      PipelineStateKV& smem_pipe_read_kv) {
+    auto [q_tile_start, q_tile_end] = get_q_tile_range(blk_coord, problem_shape);
+    if (q_tile_start < q_tile_end) {
+      pipeline_kv.consumer_release(smem_pipe_read_kv);
+      ++smem_pipe_read_kv;
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,216 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief FMHA forward epilogue for Hopper: the normalized O tile is staged in shared memory and
+    written with a single TMA store, and the logsumexp of each row is written directly.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/copy_traits_sm90_tma.hpp"
+
+#include "fmha_common.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class Element_,
+  class ElementAccumulator_,
+  class TileShape_,             // (BlkQ, BlkKV, HeadDim)
+  class StrideO_,               // (SeqQ, HeadDim, (NumHeads, Batch))
+  class StrideLSE_,             // (SeqQ, (NumHeads, Batch))
+  class SmemLayoutO_,           // (BlkQ, HeadDim), aliases the Q buffer of the mainloop
+  int NumMmaThreads_ = 256
+>
+struct Sm90FmhaFwdEpilogueTma {
+  //
+  // Type Aliases
+  //
+  using Element = Element_;
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementLSE = ElementAccumulator_;
+  using TileShape = TileShape_;
+  using StrideO = StrideO_;
+  using StrideLSE = StrideLSE_;
+  using SmemLayoutO = SmemLayoutO_;
+  static constexpr int NumMmaThreads = NumMmaThreads_;
+
+  static_assert(rank(SmemLayoutO{}) == 2, "SmemLayoutO must be rank 2 (BlkQ, HeadDim)");
+
+  // Host side epilogue arguments
+  struct Arguments {
+    Element* ptr_O;
+    StrideO dO;
+    // Optional, the logsumexp of each row is written if non-null
+    ElementLSE* ptr_LSE = nullptr;
+    StrideLSE dLSE{};
+  };
+
+  // Device side epilogue params
+  struct Params {
+    using TMA_O = decltype(make_tma_copy(
+        SM90_TMA_STORE{},
+        make_tensor(make_gmem_ptr(static_cast<Element*>(nullptr)), repeat_like(StrideO{}, int32_t(0)), StrideO{}),
+        SmemLayoutO{},
+        select<0,2>(TileShape{}),
+        _1{}));
+
+    TMA_O tma_store_o;
+    ElementLSE* ptr_LSE;
+    StrideLSE dLSE;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+    auto [Q, K, D, HB] = problem_shape;
+
+    Tensor mO = make_tensor(make_gmem_ptr(args.ptr_O), make_layout(make_shape(Q, D, HB), args.dO));
+    auto tma_store_o = make_tma_copy(SM90_TMA_STORE{}, mO, SmemLayoutO{}, select<0,2>(TileShape{}), _1{});
+
+    return {
+      tma_store_o,
+      args.ptr_LSE,
+      args.dLSE
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    constexpr int min_tma_aligned_elements = tma_alignment_bits / cutlass::sizeof_bits<Element>::value;
+
+    bool implementable =
+      get<0>(args.dO)   % min_tma_aligned_elements == 0 &&
+      get<2,0>(args.dO) % min_tma_aligned_elements == 0 &&
+      get<2,1>(args.dO) % min_tma_aligned_elements == 0;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+    }
+    return implementable;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& params) {
+    cute::prefetch_tma_descriptor(params.tma_store_o.get_tma_descriptor());
+  }
+
+  /// Writes the O accumulators of both math warp groups and their logsumexp. Must be called by
+  /// all the NumMmaThreads math threads, thread_idx being the index among them.
+  template <class BlkCoord, class ProblemShape, class TiledMma, class FrgO, class FrgLSE>
+  CUTLASS_DEVICE void
+  store(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      Params const& params,
+      FrgO const& tOrO,
+      FrgLSE const& lse,
+      TiledMma const& tiled_mma,
+      int thread_idx,
+      Element* smem_o) {
+    auto [Q, K, D, HB] = problem_shape;
+    auto q_coord = get<0>(blk_coord);
+    auto hb_coord = get<2>(blk_coord);
+
+    Tensor sO = make_tensor(make_smem_ptr(smem_o), SmemLayoutO{});                             // (BLK_Q,D)
+    auto thread_mma = tiled_mma.get_thread_slice(thread_idx);
+    Tensor tOsO = thread_mma.partition_C(sO);                                                  // (MMA,MMA_Q,MMA_D)
+
+    // Convert the accumulators into the output type and stage them in shared memory
+    cutlass::NumericConverter<Element, ElementAccumulator, FloatRoundStyle::round_to_nearest> convert;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(tOrO); ++i) {
+      tOsO(i) = convert(tOrO(i));
+    }
+
+    // Make the smem writes visible to the TMA unit before the store is issued
+    cutlass::arch::fence_view_async_shared();
+    cutlass::arch::NamedBarrier::sync(NumMmaThreads, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier);
+
+    if (thread_idx == 0) {
+      Tensor mO = params.tma_store_o.get_tma_tensor(make_shape(Q, D, HB));                     // (q,d,hb)
+      Tensor gO = local_tile(mO(_,_,hb_coord), select<0,2>(TileShape{}), make_coord(q_coord, _0{}));  // (BLK_Q,D)
+
+      auto cta_tma_o = params.tma_store_o.get_slice(_0{});
+      // Out of bounds rows of the last Q tile are clipped by the TMA unit
+      copy(params.tma_store_o, cta_tma_o.partition_S(sO), cta_tma_o.partition_D(gO));
+      tma_store_arrive();
+    }
+
+    if (params.ptr_LSE != nullptr) {
+      Tensor mLSE = make_tensor(make_gmem_ptr(params.ptr_LSE), make_layout(make_shape(Q, HB), params.dLSE));  // (q,hb)
+      Tensor cO = make_identity_tensor(select<0,2>(TileShape{}));                              // (BLK_Q,D)
+      Tensor tOcO = thread_mma.partition_C(cO);                                                // (MMA,MMA_Q,MMA_D)
+      Tensor tOcO_rc = make_tensor(tOcO.data(), convert_c_layout_to_rowcol(tOcO.layout()));   // (ROW,COL)
+
+      // The threads holding column 0 of a row write its logsumexp
+      if (get<1>(tOcO_rc(0, 0)) == 0) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int row = 0; row < size<0>(tOcO_rc); ++row) {
+          int q = int(q_coord) * int(get<0>(TileShape{})) + get<0>(tOcO_rc(row, 0));
+          if (q < Q) {
+            mLSE(q, hb_coord) = lse(row);
+          }
+        }
+      }
+    }
+
+    if (thread_idx == 0) {
+      // The smem buffer is reused by the next tile, wait for the store to read it
+      tma_store_wait<0>();
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,578 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief FMHA forward mainloop for Hopper: TMA loads of Q/K/V through PipelineTmaAsync, S = Q * K^T
+    with smem-sourced GMMAs, online softmax in registers, and O += P * V with P fed back to GMMA
+    straight from registers.
+
+    Two math warp groups each compute 64 rows of the Q tile, while sharing the K/V stages. Each
+    iteration issues S_j = Q * K_j^T together with O += P_{j-1} * V_{j-1}, so that the softmax of
+    tile j overlaps the second GEMM of tile j-1. The math warp groups issue their GMMAs in turns
+    (see MathWarpGroupOrderBarrier in the kernel), so that the softmax of one warp group overlaps
+    the GEMMs of the other.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/gemm/collective/builders/sm90_common.inl"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/atom/copy_traits_sm90_tma.hpp"
+
+#include "fmha_common.hpp"
+#include "fmha_fusion.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class Element_,
+  class ElementAccumulator_,
+  class TileShape_,             // (BlkQ, BlkKV, HeadDim)
+  class StrideQ_,               // (SeqQ, HeadDim, (NumHeads, Batch))
+  class StrideK_,               // (SeqKV, HeadDim, (NumHeads, Batch))
+  class StrideV_,               // (SeqKV, HeadDim, (NumHeads, Batch))
+  class Mask_,
+  int Stages_ = 2
+>
+struct Sm90FmhaFwdMainloopTmaWarpspecialized {
+  //
+  // Type Aliases
+  //
+  using Element = Element_;
+  using ElementAccumulator = ElementAccumulator_;
+  using TileShape = TileShape_;
+  using StrideQ = StrideQ_;
+  using StrideK = StrideK_;
+  using StrideV = StrideV_;
+  using Mask = Mask_;
+  using ArchTag = cutlass::arch::Sm90;
+  using ClusterShape = Shape<_1,_1,_1>;
+  static constexpr int Stages = Stages_;
+
+  static constexpr int NumMmaWarpGroups = 2;
+  static constexpr int NumMmaThreads = NumMmaWarpGroups * NumThreadsPerWarpGroup;
+
+  static_assert(size<0>(TileShape{}) == 64 * NumMmaWarpGroups, "Each math warp group computes 64 rows of the Q tile.");
+  static_assert(sizeof_bits_v<Element> == 16, "P is sourced from registers by GMMA, which requires 16b inputs.");
+  static_assert(Stages >= 2, "Specialization requires Stages set to value 2 or more.");
+
+  // S = Q * K^T : (BlkQ, BlkKV, HeadDim)
+  using TileShapeQK = TileShape;
+  // O = P * V : (BlkQ, HeadDim, BlkKV)
+  using TileShapePV = decltype(select<0,2,1>(TileShape{}));
+
+  using AtomLayoutMNK = Layout<Shape<Int<NumMmaWarpGroups>,_1,_1>>;
+  using TiledMmaQK = decltype(cute::make_tiled_mma(
+      cute::GMMA::ss_op_selector<Element, Element, ElementAccumulator, TileShapeQK>(),
+      AtomLayoutMNK{}));
+  // P is sourced from registers, V is the MN-major B operand
+  using TiledMmaPV = decltype(cute::make_tiled_mma(
+      cute::GMMA::rs_op_selector<Element, Element, ElementAccumulator, TileShapePV,
+                                 GMMA::Major::K, GMMA::Major::MN>(),
+      AtomLayoutMNK{}));
+
+  using SmemLayoutAtomQ = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, decltype(get<0>(TileShape{})), decltype(get<2>(TileShape{}))>());
+  using SmemLayoutAtomK = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, decltype(get<1>(TileShape{})), decltype(get<2>(TileShape{}))>());
+  using SmemLayoutAtomV = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::MN, Element, decltype(get<2>(TileShape{})), decltype(get<1>(TileShape{}))>());
+
+  using SmemLayoutQ = decltype(tile_to_shape(
+      SmemLayoutAtomQ{},
+      select<0,2>(TileShape{})));
+  using SmemLayoutK = decltype(tile_to_shape(
+      SmemLayoutAtomK{},
+      make_shape(get<1>(TileShape{}), get<2>(TileShape{}), Int<Stages>{})));
+  // V is stored as the (HeadDim, BlkKV) B operand of P * V
+  using SmemLayoutV = decltype(tile_to_shape(
+      SmemLayoutAtomV{},
+      make_shape(get<2>(TileShape{}), get<1>(TileShape{}), Int<Stages>{}),
+      Step<_2,_1,_3>{}));
+
+  // Q is loaded once per tile, K and V are streamed through their own stages
+  using MainloopPipelineQ = cutlass::PipelineTmaAsync<1>;
+  using MainloopPipelineKV = cutlass::PipelineTmaAsync<Stages>;
+  using PipelineStateQ = cutlass::PipelineState<1>;
+  using PipelineStateKV = cutlass::PipelineState<Stages>;
+
+  struct TensorStorage : cute::aligned_struct<128, _0> {
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutQ>> smem_q;
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutK>> smem_k;
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutV>> smem_v;
+  };
+
+  struct PipelineStorage {
+    alignas(16) typename MainloopPipelineQ::SharedStorage q;
+    alignas(16) typename MainloopPipelineKV::SharedStorage k;
+    alignas(16) typename MainloopPipelineKV::SharedStorage v;
+  };
+
+  static constexpr uint32_t TmaTransactionBytesQ =
+      cutlass::bits_to_bytes(size<0>(SmemLayoutQ{}) * size<1>(SmemLayoutQ{}) * static_cast<uint32_t>(sizeof_bits<Element>::value));
+  static constexpr uint32_t TmaTransactionBytesK =
+      cutlass::bits_to_bytes(size<0>(SmemLayoutK{}) * size<1>(SmemLayoutK{}) * static_cast<uint32_t>(sizeof_bits<Element>::value));
+  static constexpr uint32_t TmaTransactionBytesV =
+      cutlass::bits_to_bytes(size<0>(SmemLayoutV{}) * size<1>(SmemLayoutV{}) * static_cast<uint32_t>(sizeof_bits<Element>::value));
+
+  // Host side kernel arguments
+  struct Arguments {
+    Element const* ptr_Q;
+    StrideQ dQ;
+    Element const* ptr_K;
+    StrideK dK;
+    Element const* ptr_V;
+    StrideV dV;
+    // Scale applied to S before the softmax, usually 1 / sqrt(HeadDim)
+    float scale_softmax = 1.f;
+  };
+
+  // V is loaded as a (HeadDim, SeqKV) tensor
+  using StrideVt = decltype(select<1,0,2>(StrideV{}));
+
+  // Device side kernel params
+  struct Params {
+    using TMA_Q = decltype(make_tma_copy(
+        SM90_TMA_LOAD{},
+        make_tensor(make_gmem_ptr(static_cast<Element const*>(nullptr)), repeat_like(StrideQ{}, int32_t(0)), StrideQ{}),
+        SmemLayoutQ{},
+        select<0,2>(TileShape{}),
+        _1{}));
+    using TMA_K = decltype(make_tma_copy(
+        SM90_TMA_LOAD{},
+        make_tensor(make_gmem_ptr(static_cast<Element const*>(nullptr)), repeat_like(StrideK{}, int32_t(0)), StrideK{}),
+        SmemLayoutK{}(_,_,_0{}),
+        select<1,2>(TileShape{}),
+        _1{}));
+    using TMA_V = decltype(make_tma_copy(
+        SM90_TMA_LOAD{},
+        make_tensor(make_gmem_ptr(static_cast<Element const*>(nullptr)), repeat_like(StrideVt{}, int32_t(0)), StrideVt{}),
+        SmemLayoutV{}(_,_,_0{}),
+        select<2,1>(TileShape{}),
+        _1{}));
+
+    TMA_Q tma_load_q;
+    TMA_K tma_load_k;
+    TMA_V tma_load_v;
+    float scale_softmax;
+    float scale_softmax_log2;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+    auto [Q, K, D, HB] = problem_shape;
+
+    Tensor mQ = make_tensor(make_gmem_ptr(args.ptr_Q), make_layout(make_shape(Q, D, HB), args.dQ));
+    Tensor mK = make_tensor(make_gmem_ptr(args.ptr_K), make_layout(make_shape(K, D, HB), args.dK));
+    Tensor mVt = make_tensor(make_gmem_ptr(args.ptr_V), make_layout(make_shape(D, K, HB), select<1,0,2>(args.dV)));
+
+    auto tma_load_q = make_tma_copy(SM90_TMA_LOAD{}, mQ, SmemLayoutQ{}, select<0,2>(TileShape{}), _1{});
+    auto tma_load_k = make_tma_copy(SM90_TMA_LOAD{}, mK, SmemLayoutK{}(_,_,_0{}), select<1,2>(TileShape{}), _1{});
+    auto tma_load_v = make_tma_copy(SM90_TMA_LOAD{}, mVt, SmemLayoutV{}(_,_,_0{}), select<2,1>(TileShape{}), _1{});
+
+    // exp(x * scale) == exp2(x * scale * log2(e))
+    float scale_softmax_log2 = args.scale_softmax * static_cast<float>(M_LOG2E);
+
+    return {
+      tma_load_q,
+      tma_load_k,
+      tma_load_v,
+      args.scale_softmax,
+      scale_softmax_log2
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    constexpr int min_tma_aligned_elements = tma_alignment_bits / cutlass::sizeof_bits<Element>::value;
+    auto [Q, K, D, HB] = problem_shape;
+
+    bool implementable = D == size<2>(TileShape{});
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Head dimension must match the tile shape.\n");
+      return implementable;
+    }
+
+    auto is_aligned = [&](auto const& stride) {
+      return get<0>(stride)   % min_tma_aligned_elements == 0 &&
+             get<2,0>(stride) % min_tma_aligned_elements == 0 &&
+             get<2,1>(stride) % min_tma_aligned_elements == 0;
+    };
+    implementable = is_aligned(args.dQ) && is_aligned(args.dK) && is_aligned(args.dV);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+      return implementable;
+    }
+
+    implementable = Mask::can_implement(problem_shape, TileShape{});
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size isn't supported by the mask.\n");
+    }
+    return implementable;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& params) {
+    cute::prefetch_tma_descriptor(params.tma_load_q.get_tma_descriptor());
+    cute::prefetch_tma_descriptor(params.tma_load_k.get_tma_descriptor());
+    cute::prefetch_tma_descriptor(params.tma_load_v.get_tma_descriptor());
+  }
+
+  /// Loads Q and streams K/V for the tile at blk_coord = (q_tile, _, (head, batch))
+  /// Producer Perspective
+  template <class BlkCoord, class ProblemShape>
+  CUTLASS_DEVICE void
+  load(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      Params const& params,
+      MainloopPipelineQ& pipeline_q,
+      PipelineStateQ& smem_pipe_write_q,
+      MainloopPipelineKV& pipeline_k,
+      PipelineStateKV& smem_pipe_write_k,
+      MainloopPipelineKV& pipeline_v,
+      PipelineStateKV& smem_pipe_write_v,
+      TensorStorage& shared_tensors) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      auto [Q, K, D, HB] = problem_shape;
+      auto q_coord = get<0>(blk_coord);
+      auto hb_coord = get<2>(blk_coord);
+
+      Tensor sQ = make_tensor(make_smem_ptr(shared_tensors.smem_q.data()), SmemLayoutQ{});     // (BLK_Q,D)
+      Tensor sK = make_tensor(make_smem_ptr(shared_tensors.smem_k.data()), SmemLayoutK{});     // (BLK_KV,D,PIPE)
+      Tensor sV = make_tensor(make_smem_ptr(shared_tensors.smem_v.data()), SmemLayoutV{});     // (D,BLK_KV,PIPE)
+
+      // TMA requires special handling of strides to deal with coord codomain mapping
+      // Represent the full tensors -- get these from TMA
+      Tensor mQ = params.tma_load_q.get_tma_tensor(make_shape(Q, D, HB));                      // (q,d,hb)
+      Tensor mK = params.tma_load_k.get_tma_tensor(make_shape(K, D, HB));                      // (kv,d,hb)
+      Tensor mV = params.tma_load_v.get_tma_tensor(make_shape(D, K, HB));                      // (d,kv,hb)
+
+      Tensor gQ = local_tile(mQ(_,_,hb_coord), select<0,2>(TileShape{}), make_coord(q_coord, _0{}));   // (BLK_Q,D)
+      Tensor gK = local_tile(mK(_,_,hb_coord), select<1,2>(TileShape{}), make_coord(_, _0{}));         // (BLK_KV,D,kv)
+      Tensor gV = local_tile(mV(_,_,hb_coord), select<2,1>(TileShape{}), make_coord(_0{}, _));         // (D,BLK_KV,kv)
+
+      auto cta_tma_q = params.tma_load_q.get_slice(_0{});
+      auto cta_tma_k = params.tma_load_k.get_slice(_0{});
+      auto cta_tma_v = params.tma_load_v.get_slice(_0{});
+
+      Tensor tQgQ = cta_tma_q.partition_S(gQ);                                                 // (TMA,TMA_Q,TMA_D)
+      Tensor tQsQ = cta_tma_q.partition_D(sQ);                                                 // (TMA,TMA_Q,TMA_D)
+      Tensor tKgK = cta_tma_k.partition_S(gK);                                                 // (TMA,TMA_KV,TMA_D,kv)
+      Tensor tKsK = cta_tma_k.partition_D(sK);                                                 // (TMA,TMA_KV,TMA_D,PIPE)
+      Tensor tVgV = cta_tma_v.partition_S(gV);                                                 // (TMA,TMA_D,TMA_KV,kv)
+      Tensor tVsV = cta_tma_v.partition_D(sV);                                                 // (TMA,TMA_D,TMA_KV,PIPE)
+
+      using BarrierType = typename MainloopPipelineKV::ProducerBarrierType;
+
+      auto load_k = [&](int kv_tile) {
+        pipeline_k.producer_acquire(smem_pipe_write_k);
+        BarrierType* tma_barrier = pipeline_k.producer_get_barrier(smem_pipe_write_k);
+        copy(params.tma_load_k.with(*tma_barrier), tKgK(_,_,_,kv_tile), tKsK(_,_,_,smem_pipe_write_k.index()));
+        ++smem_pipe_write_k;
+      };
+
+      auto load_v = [&](int kv_tile) {
+        pipeline_v.producer_acquire(smem_pipe_write_v);
+        BarrierType* tma_barrier = pipeline_v.producer_get_barrier(smem_pipe_write_v);
+        copy(params.tma_load_v.with(*tma_barrier), tVgV(_,_,_,kv_tile), tVsV(_,_,_,smem_pipe_write_v.index()));
+        ++smem_pipe_write_v;
+      };
+
+      pipeline_q.producer_acquire(smem_pipe_write_q);
+      copy(params.tma_load_q.with(*pipeline_q.producer_get_barrier(smem_pipe_write_q)), tQgQ, tQsQ);
+      ++smem_pipe_write_q;
+
+      // Loads follow the order in which the math warp groups consume tiles: K_j+1 before V_j
+      int kv_tile_count = Mask::get_trip_count(blk_coord, TileShape{}, problem_shape);
+      load_k(0);
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int kv_tile = 1; kv_tile < kv_tile_count; ++kv_tile) {
+        load_k(kv_tile);
+        load_v(kv_tile - 1);
+      }
+      load_v(kv_tile_count - 1);
+    }
+  }
+
+  /// Perform a Producer Epilogue to prevent early exit of blocks in a Cluster
+  CUTLASS_DEVICE void
+  load_tail(
+      MainloopPipelineKV& pipeline_k,
+      PipelineStateKV& smem_pipe_write_k,
+      MainloopPipelineKV& pipeline_v,
+      PipelineStateKV& smem_pipe_write_v) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      pipeline_k.producer_tail(smem_pipe_write_k);
+      pipeline_v.producer_tail(smem_pipe_write_v);
+    }
+  }
+
+  /// Computes the un-normalized scores of S and P of a tile with an online softmax: updates the
+  /// running row max and row sum, and returns in scores_scale the factor by which previous
+  /// partial results must be rescaled. Row sums are kept per thread, and reduced at the end.
+  template <bool IsFirstTile, class TensorS, class TensorRow>
+  CUTLASS_DEVICE static void
+  online_softmax(
+      TensorS& tSrS_rc,
+      TensorRow& row_max,
+      TensorRow& row_sum,
+      TensorRow& scores_scale,
+      float scale_softmax_log2) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = 0; row < size<0>(tSrS_rc); ++row) {
+      ElementAccumulator max_prev = row_max(row);
+      ElementAccumulator max_cur = max_prev;
+      CUTLASS_PRAGMA_UNROLL
+      for (int col = 0; col < size<1>(tSrS_rc); ++col) {
+        max_cur = cutlass::maximum<ElementAccumulator>{}(max_cur, tSrS_rc(row, col));
+      }
+      max_cur = quad_allreduce(max_cur, cutlass::maximum<ElementAccumulator>{});
+      row_max(row) = max_cur;
+
+      // Rows without any visible key so far keep a max of -inf: shift them by 0 so P stays 0
+      ElementAccumulator max_scaled =
+          max_cur == -cutlass::platform::numeric_limits<ElementAccumulator>::infinity()
+            ? ElementAccumulator(0) : max_cur * scale_softmax_log2;
+      scores_scale(row) = IsFirstTile ? ElementAccumulator(1) : exp2f(max_prev * scale_softmax_log2 - max_scaled);
+
+      ElementAccumulator sum = 0;
+      CUTLASS_PRAGMA_UNROLL
+      for (int col = 0; col < size<1>(tSrS_rc); ++col) {
+        tSrS_rc(row, col) = exp2f(tSrS_rc(row, col) * scale_softmax_log2 - max_scaled);
+        sum += tSrS_rc(row, col);
+      }
+      row_sum(row) = IsFirstTile ? sum : row_sum(row) * scores_scale(row) + sum;
+    }
+  }
+
+  /// Perform the attention of the Q tile at blk_coord over all the KV tiles it visits.
+  /// Returns the normalized O accumulators and the logsumexp of each row held by the thread.
+  /// Consumer Perspective
+  template <class BlkCoord, class ProblemShape, class MathWarpGroupOrderBarrier>
+  CUTLASS_DEVICE auto
+  mma(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      Params const& params,
+      MainloopPipelineQ& pipeline_q,
+      PipelineStateQ& smem_pipe_read_q,
+      MainloopPipelineKV& pipeline_k,
+      PipelineStateKV& smem_pipe_read_k,
+      MainloopPipelineKV& pipeline_v,
+      PipelineStateKV& smem_pipe_read_v,
+      MathWarpGroupOrderBarrier& math_wg_order_barrier,
+      int thread_idx,
+      TensorStorage& shared_tensors) {
+    Tensor sQ = make_tensor(make_smem_ptr(shared_tensors.smem_q.data()), SmemLayoutQ{});       // (BLK_Q,D)
+    Tensor sK = make_tensor(make_smem_ptr(shared_tensors.smem_k.data()), SmemLayoutK{});       // (BLK_KV,D,PIPE)
+    Tensor sV = make_tensor(make_smem_ptr(shared_tensors.smem_v.data()), SmemLayoutV{});       // (D,BLK_KV,PIPE)
+
+    //
+    // Define C accumulators and A/B partitioning
+    //
+
+    TiledMmaQK tiled_mma_qk;
+    TiledMmaPV tiled_mma_pv;
+    auto thread_mma_qk = tiled_mma_qk.get_thread_slice(thread_idx);
+    auto thread_mma_pv = tiled_mma_pv.get_thread_slice(thread_idx);
+
+    // Allocate "fragments/descriptors"
+    Tensor tSrQ = thread_mma_qk.make_fragment_A(thread_mma_qk.partition_A(sQ));                // (MMA,MMA_Q,MMA_D)
+    Tensor tSrK = thread_mma_qk.make_fragment_B(thread_mma_qk.partition_B(sK));                // (MMA,MMA_KV,MMA_D,PIPE)
+    Tensor tOrV = thread_mma_pv.make_fragment_B(thread_mma_pv.partition_B(sV));                // (MMA,MMA_D,MMA_KV,PIPE)
+
+    Tensor tSrS = partition_fragment_C(tiled_mma_qk, select<0,1>(TileShapeQK{}));             // (MMA,MMA_Q,MMA_KV)
+    Tensor tOrO = partition_fragment_C(tiled_mma_pv, select<0,1>(TileShapePV{}));             // (MMA,MMA_Q,MMA_D)
+    // P stays in registers as the A operand of P * V
+    Tensor tOrP = make_tensor<Element>(convert_c_layout_to_a_layout(tSrS.layout()));          // (MMA,MMA_Q,MMA_KV)
+    Tensor tOrP_acc = make_tensor(tOrP.data(), tSrS.layout());                                // (MMA,MMA_Q,MMA_KV)
+
+    // (row, col) views for the softmax
+    Tensor tSrS_rc = make_tensor(tSrS.data(), convert_c_layout_to_rowcol(tSrS.layout()));     // (ROW,COL)
+    Tensor tOrO_rc = make_tensor(tOrO.data(), convert_c_layout_to_rowcol(tOrO.layout()));     // (ROW,COL)
+    CUTE_STATIC_ASSERT_V(size<0>(tSrS_rc) == size<0>(tOrO_rc));
+
+    using RowShape = decltype(make_shape(size<0>(tSrS_rc)));
+    Tensor row_max = make_tensor<ElementAccumulator>(RowShape{});
+    Tensor row_sum = make_tensor<ElementAccumulator>(RowShape{});
+    Tensor scores_scale = make_tensor<ElementAccumulator>(RowShape{});
+    fill(row_max, -cutlass::platform::numeric_limits<ElementAccumulator>::infinity());
+    fill(row_sum, ElementAccumulator(0));
+    clear(tOrO);
+
+    // (q, kv) coordinates of the scores held by this thread, for masking
+    Tensor cS = make_identity_tensor(select<0,1>(problem_shape));                               // (q,kv)
+    Tensor gcS = local_tile(cS, select<0,1>(TileShapeQK{}), make_coord(get<0>(blk_coord), _));  // (BLK_Q,BLK_KV,kv)
+    Tensor tScS = thread_mma_qk.partition_C(gcS);                                               // (MMA,MMA_Q,MMA_KV,kv)
+
+    int kv_tile_count = Mask::get_trip_count(blk_coord, TileShape{}, problem_shape);
+    int first_masked_kv_tile = kv_tile_count - Mask::get_masked_trip_count(blk_coord, TileShape{}, problem_shape);
+
+    auto convert_p = [&]() {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tSrS); ++i) {
+        tOrP_acc(i) = static_cast<Element>(tSrS(i));
+      }
+    };
+
+    //
+    // Prologue: S_0 = Q * K_0^T
+    //
+
+    math_wg_order_barrier.wait();
+    pipeline_q.consumer_wait(smem_pipe_read_q);
+    pipeline_k.consumer_wait(smem_pipe_read_k);
+    gemm_and_commit</*ZeroInit=*/true>(tiled_mma_qk, tSrQ, tSrK(_,_,_,smem_pipe_read_k.index()), tSrS);
+    // Cue for the other math WG's GMMAs to start
+    math_wg_order_barrier.arrive();
+
+    warpgroup_wait<0>();
+    pipeline_k.consumer_release(smem_pipe_read_k);
+    ++smem_pipe_read_k;
+
+    if (first_masked_kv_tile <= 0) {
+      Mask::apply_mask(tSrS, tScS(_,_,_,0), problem_shape);
+    }
+    online_softmax</*IsFirstTile=*/true>(tSrS_rc, row_max, row_sum, scores_scale, params.scale_softmax_log2);
+    convert_p();
+
+    //
+    // Mainloop: S_j = Q * K_j^T and O += P_j-1 * V_j-1
+    //
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int kv_tile = 1; kv_tile < kv_tile_count; ++kv_tile) {
+      // Bring O to the running max before accumulating P_j-1 * V_j-1
+      CUTLASS_PRAGMA_UNROLL
+      for (int row = 0; row < size<0>(tOrO_rc); ++row) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int col = 0; col < size<1>(tOrO_rc); ++col) {
+          tOrO_rc(row, col) *= scores_scale(row);
+        }
+      }
+
+      math_wg_order_barrier.wait();
+      pipeline_k.consumer_wait(smem_pipe_read_k);
+      gemm_and_commit</*ZeroInit=*/true>(tiled_mma_qk, tSrQ, tSrK(_,_,_,smem_pipe_read_k.index()), tSrS);
+      pipeline_v.consumer_wait(smem_pipe_read_v);
+      gemm_and_commit</*ZeroInit=*/false>(tiled_mma_pv, tOrP, tOrV(_,_,_,smem_pipe_read_v.index()), tOrO);
+      math_wg_order_barrier.arrive();
+
+      // Wait on S_j, P_j-1 * V_j-1 may still be in flight
+      warpgroup_wait<1>();
+      pipeline_k.consumer_release(smem_pipe_read_k);
+      ++smem_pipe_read_k;
+
+      if (kv_tile >= first_masked_kv_tile) {
+        Mask::apply_mask(tSrS, tScS(_,_,_,kv_tile), problem_shape);
+      }
+      online_softmax</*IsFirstTile=*/false>(tSrS_rc, row_max, row_sum, scores_scale, params.scale_softmax_log2);
+
+      // P_j-1 is read by the GMMAs until they retire
+      warpgroup_wait<0>();
+      pipeline_v.consumer_release(smem_pipe_read_v);
+      ++smem_pipe_read_v;
+
+      convert_p();
+    }
+
+    //
+    // Epilogue: O += P_last * V_last
+    //
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = 0; row < size<0>(tOrO_rc); ++row) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int col = 0; col < size<1>(tOrO_rc); ++col) {
+        tOrO_rc(row, col) *= scores_scale(row);
+      }
+    }
+
+    math_wg_order_barrier.wait();
+    pipeline_v.consumer_wait(smem_pipe_read_v);
+    gemm_and_commit</*ZeroInit=*/false>(tiled_mma_pv, tOrP, tOrV(_,_,_,smem_pipe_read_v.index()), tOrO);
+    math_wg_order_barrier.arrive();
+
+    warpgroup_wait<0>();
+    pipeline_v.consumer_release(smem_pipe_read_v);
+    ++smem_pipe_read_v;
+
+    // Normalize O and compute the logsumexp of each row
+    Tensor lse = make_tensor<ElementAccumulator>(RowShape{});
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = 0; row < size<0>(tOrO_rc); ++row) {
+      ElementAccumulator sum = quad_allreduce(row_sum(row), cutlass::plus<ElementAccumulator>{});
+      bool is_empty = sum == ElementAccumulator(0);
+      ElementAccumulator scale = is_empty ? ElementAccumulator(1) : ElementAccumulator(1) / sum;
+      lse(row) = is_empty
+        ? -cutlass::platform::numeric_limits<ElementAccumulator>::infinity()
+        : row_max(row) * params.scale_softmax + logf(sum);
+      CUTLASS_PRAGMA_UNROLL
+      for (int col = 0; col < size<1>(tOrO_rc); ++col) {
+        tOrO_rc(row, col) *= scale;
+      }
+    }
+
+    return cute::make_tuple(tOrO, lse);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,309 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host side adapter of the Hopper FMHA backward pass. It owns the float workspace holding
+    rowsum(dO o O) and the dQ accumulator, and launches the preprocessing kernel, the backward
+    kernel and the conversion of dQ in turn.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/trace.h"
+
+#include "../collective/fmha_common.hpp"
+#include "../kernel/fmha_bwd_sum_odo.hpp"
+#include "../kernel/fmha_bwd_convert_dq.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Kernel_>
+class FmhaBwd {
+public:
+  using Kernel = Kernel_;
+
+  using ProblemShape = typename Kernel::ProblemShape;
+  using CollectiveMainloop = typename Kernel::CollectiveMainloop;
+  using CollectiveEpilogue = typename Kernel::CollectiveEpilogue;
+  using Element = typename CollectiveMainloop::Element;
+  using ElementAccumulator = typename CollectiveMainloop::ElementAccumulator;
+  using StrideQKVO = typename CollectiveMainloop::StrideQKVO;
+  using StrideLSE = typename CollectiveMainloop::StrideLSE;
+  using VariableSeqlen = cutlass::fmha::collective::VariableSeqlen;
+
+  using KernelSumOdO = cutlass::fmha::kernel::FmhaBwdSumOdO<
+      ProblemShape, Element, ElementAccumulator, StrideQKVO, StrideLSE>;
+  using KernelConvertdQ = cutlass::fmha::kernel::FmhaBwdConvertdQ<
+      ProblemShape, Element, ElementAccumulator, StrideQKVO>;
+
+  static int const kThreadCount = Kernel::MaxThreadsPerBlock;
+
+  /// Argument structure: User API
+  struct Arguments {
+    // (SeqQ, SeqKV, HeadDim, (NumHeads, Batch)), see VariableSeqlen for variable sequence lengths
+    ProblemShape problem_shape{};
+
+    Element const* ptr_Q = nullptr;
+    StrideQKVO dQ{};
+    Element const* ptr_K = nullptr;
+    StrideQKVO dK{};
+    Element const* ptr_V = nullptr;
+    StrideQKVO dV{};
+    // Output and logsumexp of the forward pass
+    Element const* ptr_O = nullptr;
+    StrideQKVO dO{};
+    ElementAccumulator const* ptr_LSE = nullptr;
+    StrideLSE dLSE{};
+
+    // Gradient of the output
+    Element const* ptr_dO = nullptr;
+    StrideQKVO ddO{};
+
+    // Gradients of the inputs
+    Element* ptr_dQ = nullptr;
+    StrideQKVO ddQ{};
+    Element* ptr_dK = nullptr;
+    StrideQKVO ddK{};
+    Element* ptr_dV = nullptr;
+    StrideQKVO ddV{};
+
+    float scale_softmax = 1.f;
+    VariableSeqlen varlen{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  /// Argument structure: Kernel API
+  struct Params {
+    typename KernelSumOdO::Params sum_odo;
+    typename Kernel::Params bwd;
+    typename KernelConvertdQ::Params convert_dq;
+  };
+
+private:
+
+  /// Kernel API parameters object
+  Params params_;
+
+  // Workspace alignment, which the TMA reduce-add into the dQ accumulator requires
+  static constexpr size_t kWorkspaceAlignment = 128;
+
+  static size_t
+  align_up(size_t size) {
+    return (size + kWorkspaceAlignment - 1) / kWorkspaceAlignment * kWorkspaceAlignment;
+  }
+
+  static ProblemShape
+  get_tensor_shape(Arguments const& args) {
+    return Kernel::get_tensor_shape(args.problem_shape, args.varlen);
+  }
+
+  static size_t
+  get_dpsum_size(Arguments const& args) {
+    auto [Q, K, D, HB] = get_tensor_shape(args);
+    return align_up(size_t(Q) * size_t(get<0>(HB)) * size_t(get<1>(HB)) * sizeof(ElementAccumulator));
+  }
+
+  static size_t
+  get_dqaccum_size(Arguments const& args) {
+    auto [Q, K, D, HB] = get_tensor_shape(args);
+    return align_up(size_t(Q) * size_t(D) * size_t(get<0>(HB)) * size_t(get<1>(HB)) * sizeof(ElementAccumulator));
+  }
+
+  static typename Kernel::Arguments
+  to_kernel_arguments(Arguments const& args, void* workspace) {
+    auto [Q, K, D, HB] = get_tensor_shape(args);
+    int64_t H = get<0>(HB);
+
+    auto* ptr_dPsum = reinterpret_cast<ElementAccumulator*>(workspace);
+    auto* ptr_dQaccum = reinterpret_cast<ElementAccumulator*>(
+      reinterpret_cast<char*>(workspace) + get_dpsum_size(args));
+    StrideLSE ddPsum = make_stride(_1{}, make_stride(int64_t(Q), int64_t(Q) * H));
+    StrideQKVO ddQaccum = make_stride(int64_t(D), _1{}, make_stride(int64_t(Q) * D, int64_t(Q) * D * H));
+
+    typename Kernel::Arguments kernel_args;
+    kernel_args.problem_shape = args.problem_shape;
+    kernel_args.mainloop = {
+      args.ptr_Q, args.dQ,
+      args.ptr_K, args.dK,
+      args.ptr_V, args.dV,
+      args.ptr_dO, args.ddO,
+      args.ptr_LSE, args.dLSE,
+      ptr_dPsum, ddPsum,
+      ptr_dQaccum, ddQaccum,
+      args.scale_softmax
+    };
+    kernel_args.epilogue = {
+      args.ptr_dK, args.ddK,
+      args.ptr_dV, args.ddV
+    };
+    kernel_args.hw_info = args.hw_info;
+    kernel_args.varlen = args.varlen;
+    return kernel_args;
+  }
+
+public:
+
+  /// Access the Params structure
+  Params const& params() const {
+    return params_;
+  }
+
+  /// Determines whether the FMHA backward pass can execute the given problem.
+  static Status
+  can_implement(Arguments const& args) {
+    if (Kernel::can_implement(to_kernel_arguments(args, nullptr))) {
+      return Status::kSuccess;
+    }
+    else {
+      return Status::kInvalid;
+    }
+  }
+
+  /// Gets the workspace size: rowsum(dO o O) and the dQ accumulator, both in ElementAccumulator
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return get_dpsum_size(args) + get_dqaccum_size(args);
+  }
+
+  /// Initializes the FMHA backward state from arguments.
+  Status
+  initialize(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+    CUTLASS_TRACE_HOST("FmhaBwd::initialize() - workspace "
+      << workspace << ", stream: " << (stream ? "non-null" : "null"));
+
+    if (workspace == nullptr) {
+      CUTLASS_TRACE_HOST("  The backward pass requires a workspace");
+      return Status::kErrorWorkspaceNull;
+    }
+
+    auto kernel_args = to_kernel_arguments(args, workspace);
+    params_.bwd = Kernel::to_underlying_arguments(kernel_args, workspace);
+
+    auto const& mainloop = kernel_args.mainloop;
+    params_.sum_odo = {
+      get_tensor_shape(args),
+      args.ptr_O, args.dO,
+      args.ptr_dO, args.ddO,
+      const_cast<ElementAccumulator*>(mainloop.ptr_dPsum), mainloop.ddPsum,
+      mainloop.ptr_dQaccum, mainloop.ddQaccum
+    };
+    params_.convert_dq = {
+      get_tensor_shape(args),
+      mainloop.ptr_dQaccum, mainloop.ddQaccum,
+      args.ptr_dQ, args.ddQ,
+      args.scale_softmax
+    };
+
+    // account for dynamic smem capacity if needed
+    int smem_size = Kernel::SharedStorageSize;
+    if (smem_size >= (48 << 10)) {
+      CUTLASS_TRACE_HOST("  Setting smem size to " << smem_size);
+      cudaError_t result = cudaFuncSetAttribute(
+          device_kernel<Kernel>,
+          cudaFuncAttributeMaxDynamicSharedMemorySize,
+          smem_size);
+      if (cudaSuccess != result) {
+        result = cudaGetLastError(); // to clear the error bit
+        CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error: " << cudaGetErrorString(result));
+        return Status::kErrorInternal;
+      }
+    }
+
+    return Status::kSuccess;
+  }
+
+  /// Primary run() entry point API that is static allowing users to create and manage their own params.
+  static Status
+  run(Params& params, cudaStream_t stream = nullptr) {
+    CUTLASS_TRACE_HOST("FmhaBwd::run()");
+
+    // rowsum(dO o O), and clears the dQ accumulator
+    device_kernel<KernelSumOdO><<<
+      KernelSumOdO::get_grid_shape(params.sum_odo), KernelSumOdO::get_block_shape(), 0, stream>>>(params.sum_odo);
+
+    device_kernel<Kernel><<<
+      Kernel::get_grid_shape(params.bwd), Kernel::get_block_shape(), Kernel::SharedStorageSize, stream>>>(params.bwd);
+
+    device_kernel<KernelConvertdQ><<<
+      KernelConvertdQ::get_grid_shape(params.convert_dq), KernelConvertdQ::get_block_shape(), 0, stream>>>(params.convert_dq);
+
+    cudaError_t result = cudaGetLastError();
+    if (cudaSuccess != result) {
+      CUTLASS_TRACE_HOST("  Kernel launch failed. Reason: " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+    return Status::kSuccess;
+  }
+
+  //
+  // Non-static launch overloads that first create and set the internal params struct of this kernel handle.
+  //
+
+  /// Launches the kernels after first constructing Params internal state from supplied arguments.
+  Status
+  run(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+    Status status = initialize(args, workspace, stream);
+    if (Status::kSuccess == status) {
+      status = run(params_, stream);
+    }
+    return status;
+  }
+
+  /// Launches the kernels after first constructing Params internal state from supplied arguments.
+  Status
+  operator()(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+    return run(args, workspace, stream);
+  }
+
+  /// Overload that allows a user to re-launch the same kernels without updating internal params struct.
+  Status
+  run(cudaStream_t stream = nullptr) {
+    return run(params_, stream);
+  }
+
+  /// Overload that allows a user to re-launch the same kernels without updating internal params struct.
+  Status
+  operator()(cudaStream_t stream = nullptr) {
+    return run(params_, stream);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,132 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Preprocessing kernel of the FMHA backward pass: computes rowsum(dO o O) of every query,
+    which the softmax gradient subtracts from dP, and clears the float accumulator of dQ.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/arch.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::kernel {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// One warp per (query, head, batch)
+template <
+  class ProblemShape_,          // (SeqQ, SeqKV, HeadDim, (NumHeads, Batch))
+  class Element_,
+  class ElementAccumulator_,
+  class StrideQKVO_,            // (SeqQ, HeadDim, (NumHeads, Batch)) of O, dO and the dQ accumulator
+  class StrideLSE_              // (SeqQ, (NumHeads, Batch)) of rowsum(dO o O)
+>
+struct FmhaBwdSumOdO {
+  using ProblemShape = ProblemShape_;
+  using Element = Element_;
+  using ElementAccumulator = ElementAccumulator_;
+  using StrideQKVO = StrideQKVO_;
+  using StrideLSE = StrideLSE_;
+
+  static constexpr uint32_t MaxThreadsPerBlock = 256;
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+  static constexpr int RowsPerBlock = MaxThreadsPerBlock / NumThreadsPerWarp;
+  static constexpr int SharedStorageSize = 0;
+
+  struct Params {
+    ProblemShape problem_shape;
+    Element const* ptr_O;
+    StrideQKVO dO;
+    Element const* ptr_dO;
+    StrideQKVO ddO;
+    ElementAccumulator* ptr_dPsum;
+    StrideLSE ddPsum;
+    ElementAccumulator* ptr_dQaccum;
+    StrideQKVO ddQaccum;
+  };
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    auto [Q, K, D, HB] = params.problem_shape;
+    return dim3(cutlass::ceil_div(int(Q), RowsPerBlock), int(get<0>(HB)), int(get<1>(HB)));
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    auto [Q, K, D, HB] = params.problem_shape;
+
+    Tensor mO = make_tensor(make_gmem_ptr(params.ptr_O), make_layout(make_shape(Q, D, HB), params.dO));
+    Tensor mdO = make_tensor(make_gmem_ptr(params.ptr_dO), make_layout(make_shape(Q, D, HB), params.ddO));
+    Tensor mdPsum = make_tensor(make_gmem_ptr(params.ptr_dPsum), make_layout(make_shape(Q, HB), params.ddPsum));
+    Tensor mdQaccum = make_tensor(make_gmem_ptr(params.ptr_dQaccum), make_layout(make_shape(Q, D, HB), params.ddQaccum));
+
+    int q = int(blockIdx.x) * RowsPerBlock + int(threadIdx.x) / NumThreadsPerWarp;
+    int lane = int(threadIdx.x) % NumThreadsPerWarp;
+    auto hb = make_coord(int(blockIdx.y), int(blockIdx.z));
+    if (q >= Q) {
+      return;
+    }
+
+    ElementAccumulator acc = 0;
+    for (int d = lane; d < D; d += NumThreadsPerWarp) {
+      acc += static_cast<ElementAccumulator>(mO(q, d, hb)) * static_cast<ElementAccumulator>(mdO(q, d, hb));
+      mdQaccum(q, d, hb) = ElementAccumulator(0);
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int offset = NumThreadsPerWarp / 2; offset > 0; offset /= 2) {
+      acc += __shfl_xor_sync(0xffffffff, acc, offset);
+    }
+
+    if (lane == 0) {
+      mdPsum(q, hb) = acc;
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::kernel
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
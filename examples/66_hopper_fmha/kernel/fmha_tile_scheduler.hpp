@@ -0,0 +1,158 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tile schedulers of the Hopper FMHA kernels.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/kernel_hardware_info.h"
+
+#include "cute/layout.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::kernel {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// One CTA per (Q tile, head, batch). The block coordinate is (q_tile, _0, (head, batch)).
+struct IndividualTileScheduler {
+
+  struct Arguments { };
+
+  struct Params {
+    dim3 grid;
+  };
+
+  bool valid_ = true;
+
+  CUTLASS_DEVICE
+  IndividualTileScheduler(Params const&) { }
+
+  template <class ProblemShape, class TileShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShape const& problem_shape, KernelHardwareInfo hw_info,
+      TileShape const& tile_shape, Arguments const& args = {}) {
+    (void) hw_info;
+    (void) args;
+    dim3 grid(
+      cutlass::ceil_div(int(get<0>(problem_shape)), int(get<0>(tile_shape))),
+      int(get<3,0>(problem_shape)),
+      int(get<3,1>(problem_shape)));
+    return Params{ grid };
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return params.grid;
+  }
+
+  CUTLASS_DEVICE
+  bool is_valid() {
+    return valid_;
+  }
+
+  CUTLASS_DEVICE
+  auto get_block_coord() {
+    return make_coord(int(blockIdx.x), _0{}, make_coord(int(blockIdx.y), int(blockIdx.z)));
+  }
+
+  CUTLASS_DEVICE
+  IndividualTileScheduler& operator++() {
+    valid_ = false;
+    return *this;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// One CTA per (KV tile, head, batch), for the backward kernels which iterate over the Q tiles of
+/// a KV tile. The block coordinate is (_0, kv_tile, (head, batch)).
+struct IndividualKVTileScheduler {
+
+  struct Arguments { };
+
+  struct Params {
+    dim3 grid;
+  };
+
+  bool valid_ = true;
+
+  CUTLASS_DEVICE
+  IndividualKVTileScheduler(Params const&) { }
+
+  template <class ProblemShape, class TileShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShape const& problem_shape, KernelHardwareInfo hw_info,
+      TileShape const& tile_shape, Arguments const& args = {}) {
+    (void) hw_info;
+    (void) args;
+    dim3 grid(
+      cutlass::ceil_div(int(get<1>(problem_shape)), int(get<1>(tile_shape))),
+      int(get<3,0>(problem_shape)),
+      int(get<3,1>(problem_shape)));
+    return Params{ grid };
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return params.grid;
+  }
+
+  CUTLASS_DEVICE
+  bool is_valid() {
+    return valid_;
+  }
+
+  CUTLASS_DEVICE
+  auto get_block_coord() {
+    return make_coord(_0{}, int(blockIdx.x), make_coord(int(blockIdx.y), int(blockIdx.z)));
+  }
+
+  CUTLASS_DEVICE
+  IndividualKVTileScheduler& operator++() {
+    valid_ = false;
+    return *this;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::kernel
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
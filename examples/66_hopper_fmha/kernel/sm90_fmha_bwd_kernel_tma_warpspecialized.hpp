@@ -0,0 +1,394 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Warp-specialized FMHA backward kernel for Hopper.
+
+    One producer warp group issues the TMA loads of K/V and Q/dO, two math warp groups each compute
+    dK and dV for 64 rows of the KV tile. The partial dQ of every KV tile is accumulated into a
+    float workspace, which FmhaBwdSumOdO clears beforehand and FmhaBwdConvertdQ converts afterwards;
+    device::FmhaBwd runs the three kernels.
+
+    If the sequence lengths are variable, the problem shape holds the total sequence lengths and
+    a single batch, as the tensors do, while the grid covers max_seqlen_kv and the real batch count.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/arch/reg_reconfig.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+#include "../collective/fmha_common.hpp"
+#include "../collective/fmha_fusion.hpp"
+#include "fmha_tile_scheduler.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::kernel {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class ProblemShape_,          // (SeqQ, SeqKV, HeadDim, (NumHeads, Batch))
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_,
+  class TileScheduler_ = IndividualKVTileScheduler
+>
+class Sm90FmhaBwdKernelTmaWarpspecialized {
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+  static_assert(rank(ProblemShape{}) == 4, "ProblemShape{} should be <SeqQ, SeqKV, HeadDim, (NumHeads, Batch)>");
+
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using TileShape = typename CollectiveMainloop::TileShape;
+  using ArchTag = typename CollectiveMainloop::ArchTag;
+  using ClusterShape = typename CollectiveMainloop::ClusterShape;
+  using MainloopArguments = typename CollectiveMainloop::Arguments;
+  using MainloopParams = typename CollectiveMainloop::Params;
+  static_assert(ArchTag::kMinComputeCapability >= 90);
+
+  // Epilogue derived types
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using EpilogueArguments = typename CollectiveEpilogue::Arguments;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+
+  using TileScheduler = TileScheduler_;
+  using TileSchedulerArguments = typename TileScheduler::Arguments;
+  using TileSchedulerParams = typename TileScheduler::Params;
+
+  using VariableSeqlen = cutlass::fmha::collective::VariableSeqlen;
+
+  // Warp specialization thread count per threadblock
+  static constexpr uint32_t NumLoadWarpGroups = 1;
+  static constexpr uint32_t NumMmaWarpGroups = CollectiveMainloop::NumMmaWarpGroups;
+  static constexpr uint32_t NumMmaThreads = CollectiveMainloop::NumMmaThreads;
+  static constexpr uint32_t MaxThreadsPerBlock = NumMmaThreads + (NumLoadWarpGroups * NumThreadsPerWarpGroup);
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  static_assert(CollectiveEpilogue::NumMmaThreads == NumMmaThreads,
+    "The epilogue must be shared by all the math threads.");
+
+  /// Register requirement for Load and Math WGs. dK, dV, S and dP all live in registers.
+  static constexpr uint32_t LoadRegisterRequirement = 24;
+  static constexpr uint32_t MmaRegisterRequirement = 240;
+
+  // Kernel level shared memory storage
+  struct SharedStorage {
+    struct PipelineStorage : cute::aligned_struct<16, _1> {
+      using MainloopPipelineStorage = typename CollectiveMainloop::PipelineStorage;
+
+      alignas(16) MainloopPipelineStorage mainloop;
+    } pipelines;
+
+    struct TensorStorage : cute::aligned_struct<128, _1> {
+      using MainloopTensorStorage = typename CollectiveMainloop::TensorStorage;
+
+      // The epilogue stages dK and dV in the K and V buffers of the mainloop
+      MainloopTensorStorage mainloop;
+    } tensors;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  // Device side arguments
+  struct Arguments {
+    ProblemShape problem_shape{};
+    MainloopArguments mainloop{};
+    EpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+    TileSchedulerArguments scheduler{};
+    VariableSeqlen varlen{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    ProblemShape problem_shape{};
+    MainloopParams mainloop{};
+    EpilogueParams epilogue{};
+    TileSchedulerParams scheduler{};
+    VariableSeqlen varlen{};
+  };
+
+  //
+  // Methods
+  //
+
+  /// Shape of the tensors: the total sequence lengths and a single batch if they are variable
+  static ProblemShape
+  get_tensor_shape(ProblemShape const& problem_shape, VariableSeqlen const& varlen) {
+    if (varlen.is_variable()) {
+      auto [Q, K, D, HB] = problem_shape;
+      return ProblemShape{Q, K, D, make_shape(get<0>(HB), 1)};
+    }
+    return problem_shape;
+  }
+
+  /// Shape the grid is laid out over: the longest sequences if they are variable
+  static ProblemShape
+  get_grid_problem_shape(ProblemShape const& problem_shape, VariableSeqlen const& varlen) {
+    if (varlen.is_variable()) {
+      auto [Q, K, D, HB] = problem_shape;
+      return ProblemShape{varlen.max_seqlen_q, varlen.max_seqlen_kv, D, HB};
+    }
+    return problem_shape;
+  }
+
+  static
+  Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    CUTLASS_TRACE_HOST("to_underlying_arguments():");
+
+    auto tensor_shape = get_tensor_shape(args.problem_shape, args.varlen);
+    return {
+      args.problem_shape,
+      CollectiveMainloop::to_underlying_arguments(tensor_shape, args.mainloop, workspace),
+      CollectiveEpilogue::to_underlying_arguments(tensor_shape, args.epilogue, workspace),
+      TileScheduler::to_underlying_arguments(
+        get_grid_problem_shape(args.problem_shape, args.varlen), args.hw_info, TileShape{}, args.scheduler),
+      args.varlen
+    };
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    auto tensor_shape = get_tensor_shape(args.problem_shape, args.varlen);
+    bool implementable = CollectiveMainloop::can_implement(tensor_shape, args.mainloop);
+    implementable &= CollectiveEpilogue::can_implement(tensor_shape, args.epilogue);
+    if (args.varlen.is_variable()) {
+      // Sequences of any length are split into tiles, which requires a residual mask
+      implementable &= !cute::is_same_v<typename CollectiveMainloop::Mask, cutlass::fmha::collective::NoMask>;
+      implementable &= args.varlen.cumulative_seqlen_kv != nullptr;
+    }
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
+    }
+    return implementable;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return TileScheduler::get_grid_shape(params.scheduler);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+
+#if defined(__CUDA_ARCH_FEAT_SM90_ALL)
+#  define ENABLE_SM90_KERNEL_LEVEL 1
+#endif
+// Any Tensor Op MMA Atom in the WGMMA ISA is arch conditional to sm90a.
+#if ! defined(ENABLE_SM90_KERNEL_LEVEL)
+    printf("ERROR : Arch conditional MMA instruction used without targeting appropriate compute capability. Aborting.\n");
+#else
+
+    enum class WarpGroupRole {
+      Producer = 0,
+      Consumer0 = 1,
+      Consumer1 = 2
+    };
+    enum class ProducerWarpRole {
+      Mainloop = 0,
+      Warp1 = 1,
+      Warp2 = 2,
+      Warp3 = 3
+    };
+
+    // Kernel level shared memory storage
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    int thread_idx = int(threadIdx.x);
+    int warp_idx = canonical_warp_idx_sync();
+    int warp_idx_in_warp_group = warp_idx % NumWarpsPerWarpGroup;
+    int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
+    auto warp_group_role = WarpGroupRole(canonical_warp_group_idx());
+    auto producer_warp_role = ProducerWarpRole(warp_idx_in_warp_group);
+    int lane_predicate = cute::elect_one_sync();
+
+    // Issue Tma Descriptor Prefetch from a single thread
+    if ((warp_idx == 0) && lane_predicate) {
+      CollectiveMainloop::prefetch_tma_descriptors(params.mainloop);
+      CollectiveEpilogue::prefetch_tma_descriptors(params.epilogue);
+    }
+
+    // Mainloop Load pipelines: K and V once per tile, Q and dO streamed through their stages
+    using MainloopPipelineKV = typename CollectiveMainloop::MainloopPipelineKV;
+    using MainloopPipelineQdO = typename CollectiveMainloop::MainloopPipelineQdO;
+
+    typename MainloopPipelineKV::Params pipeline_kv_params;
+    typename MainloopPipelineQdO::Params pipeline_q_do_params;
+    if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::Mainloop) {
+      pipeline_kv_params.role = MainloopPipelineKV::ThreadCategory::Producer;
+      pipeline_q_do_params.role = MainloopPipelineQdO::ThreadCategory::Producer;
+    }
+    if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+      pipeline_kv_params.role = MainloopPipelineKV::ThreadCategory::Consumer;
+      pipeline_q_do_params.role = MainloopPipelineQdO::ThreadCategory::Consumer;
+    }
+    pipeline_kv_params.is_leader = warp_group_thread_idx == 0;
+    pipeline_kv_params.num_consumers = NumMmaThreads;
+    pipeline_kv_params.transaction_bytes = CollectiveMainloop::TmaTransactionBytesKV;
+    pipeline_q_do_params.is_leader = warp_group_thread_idx == 0;
+    pipeline_q_do_params.num_consumers = NumMmaThreads;
+    pipeline_q_do_params.transaction_bytes = CollectiveMainloop::TmaTransactionBytesQdO;
+
+    MainloopPipelineKV pipeline_kv(shared_storage.pipelines.mainloop.kv, pipeline_kv_params, ClusterShape{});
+    MainloopPipelineQdO pipeline_q_do(shared_storage.pipelines.mainloop.q_do, pipeline_q_do_params, ClusterShape{});
+
+    // Initialize starting pipeline states for the collectives
+    typename CollectiveMainloop::PipelineStateKV pipe_read_kv;
+    typename CollectiveMainloop::PipelineStateQdO pipe_read_q_do;
+
+    // For the DMA Load (producer) we start with an opposite phase
+    // i.e., we skip all waits since we know that the buffer is indeed empty
+    auto pipe_write_kv = cutlass::make_producer_start_state<MainloopPipelineKV>();
+    auto pipe_write_q_do = cutlass::make_producer_start_state<MainloopPipelineQdO>();
+
+    // We need this to guarantee that the Pipeline init is visible to all producers and consumers
+    __syncthreads();
+
+    CollectiveMainloop collective_mainloop;
+    CollectiveEpilogue collective_epilogue;
+    TileScheduler scheduler{params.scheduler};
+
+    auto tensor_shape = get_tensor_shape(params.problem_shape, params.varlen);
+
+    if (warp_group_role == WarpGroupRole::Producer) {
+      cutlass::arch::warpgroup_reg_dealloc<LoadRegisterRequirement>();
+
+      if (producer_warp_role == ProducerWarpRole::Mainloop) {
+        for (; scheduler.is_valid(); ++scheduler) {
+          auto blk_coord = scheduler.get_block_coord();
+          auto [batch_problem_shape, seq_offset, hb_coord] = cutlass::fmha::collective::get_batch_problem(
+            params.problem_shape, params.varlen, get<2>(blk_coord));
+          if (int(get<1>(blk_coord)) * int(get<1>(TileShape{})) >= int(get<1>(batch_problem_shape))) {
+            continue;
+          }
+          auto tile_coord = make_coord(get<0>(blk_coord), get<1>(blk_coord), hb_coord);
+
+          collective_mainloop.load(
+            tile_coord,
+            batch_problem_shape,
+            tensor_shape,
+            seq_offset,
+            params.mainloop,
+            pipeline_kv, pipe_write_kv,
+            pipeline_q_do, pipe_write_q_do,
+            shared_storage.tensors.mainloop
+          );
+        }
+
+        // Make sure all the loads retire before the CTA exits
+        collective_mainloop.load_tail(pipeline_kv, pipe_write_kv, pipeline_q_do, pipe_write_q_do);
+      }
+    }
+    else if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+      cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
+
+      // Index of the thread among the math warp groups
+      int mma_thread_idx = thread_idx - NumThreadsPerWarpGroup;
+      typename CollectiveMainloop::TiledMmadKV tiled_mma_dkv;
+
+      for (; scheduler.is_valid(); ++scheduler) {
+        auto blk_coord = scheduler.get_block_coord();
+        auto [batch_problem_shape, seq_offset, hb_coord] = cutlass::fmha::collective::get_batch_problem(
+          params.problem_shape, params.varlen, get<2>(blk_coord));
+        // Tiles past the end of a shorter sequence have nothing to do
+        if (int(get<1>(blk_coord)) * int(get<1>(TileShape{})) >= int(get<1>(batch_problem_shape))) {
+          continue;
+        }
+        auto tile_coord = make_coord(get<0>(blk_coord), get<1>(blk_coord), hb_coord);
+
+        auto [tdKrdK, tdVrdV] = collective_mainloop.mma(
+          tile_coord,
+          batch_problem_shape,
+          tensor_shape,
+          seq_offset,
+          params.mainloop,
+          pipeline_kv, pipe_read_kv,
+          pipeline_q_do, pipe_read_q_do,
+          mma_thread_idx,
+          shared_storage.tensors.mainloop
+        );
+
+        collective_epilogue.store(
+          tile_coord,
+          batch_problem_shape,
+          tensor_shape,
+          seq_offset,
+          params.epilogue,
+          tdKrdK,
+          tdVrdV,
+          tiled_mma_dkv,
+          mma_thread_idx,
+          shared_storage.tensors.mainloop.smem_k.data(),
+          shared_storage.tensors.mainloop.smem_v.data()
+        );
+
+        collective_mainloop.mma_tail(tile_coord, batch_problem_shape, pipeline_kv, pipe_read_kv);
+      }
+    }
+#endif
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::kernel
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
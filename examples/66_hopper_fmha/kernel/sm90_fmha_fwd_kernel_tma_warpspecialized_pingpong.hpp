@@ -0,0 +1,349 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Warp-specialized FMHA forward kernel for Hopper.
+
+    One producer warp group issues the TMA loads of Q/K/V, two math warp groups each compute 64
+    rows of the Q tile. The math warp groups issue their GMMAs in turns, ordered by an
+    OrderedSequenceBarrier as in the ping-pong GEMM kernel, so that the softmax of one warp group
+    runs while the tensor cores are busy with the GEMMs of the other.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/arch/reg_reconfig.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+#include "fmha_tile_scheduler.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::kernel {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class ProblemShape_,          // (SeqQ, SeqKV, HeadDim, (NumHeads, Batch))
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_,
+  class TileScheduler_ = IndividualTileScheduler
+>
+class Sm90FmhaFwdKernelTmaWarpspecializedPingpong {
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+  static_assert(rank(ProblemShape{}) == 4, "ProblemShape{} should be <SeqQ, SeqKV, HeadDim, (NumHeads, Batch)>");
+
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using TileShape = typename CollectiveMainloop::TileShape;
+  using ArchTag = typename CollectiveMainloop::ArchTag;
+  using ClusterShape = typename CollectiveMainloop::ClusterShape;
+  using MainloopArguments = typename CollectiveMainloop::Arguments;
+  using MainloopParams = typename CollectiveMainloop::Params;
+  static_assert(ArchTag::kMinComputeCapability >= 90);
+
+  // Epilogue derived types
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using EpilogueArguments = typename CollectiveEpilogue::Arguments;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+
+  using TileScheduler = TileScheduler_;
+  using TileSchedulerArguments = typename TileScheduler::Arguments;
+  using TileSchedulerParams = typename TileScheduler::Params;
+
+  // Warp specialization thread count per threadblock
+  static constexpr uint32_t NumLoadWarpGroups = 1;
+  static constexpr uint32_t NumMmaWarpGroups = CollectiveMainloop::NumMmaWarpGroups;
+  static constexpr uint32_t NumMmaThreads = CollectiveMainloop::NumMmaThreads;
+  static constexpr uint32_t MaxThreadsPerBlock = NumMmaThreads + (NumLoadWarpGroups * NumThreadsPerWarpGroup);
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  static_assert(NumMmaWarpGroups == 2, "Pingpong FMHA kernel must have 2 math warp groups.");
+  static_assert(CollectiveEpilogue::NumMmaThreads == NumMmaThreads,
+    "The epilogue must be shared by all the math threads.");
+
+  /// Register requirement for Load and Math WGs
+  static constexpr uint32_t LoadRegisterRequirement = 40;
+  static constexpr uint32_t MmaRegisterRequirement = 232;
+
+  // Math warp groups take turns issuing their GMMAs, one stage per turn
+  using MathWarpGroupOrderBarrier = cutlass::OrderedSequenceBarrier<1, NumMmaWarpGroups>;
+
+  // Kernel level shared memory storage
+  struct SharedStorage {
+    struct PipelineStorage : cute::aligned_struct<16, _1> {
+      using MainloopPipelineStorage = typename CollectiveMainloop::PipelineStorage;
+
+      alignas(16) MainloopPipelineStorage mainloop;
+      alignas(16) typename MathWarpGroupOrderBarrier::SharedStorage math_wg_order;
+    } pipelines;
+
+    struct TensorStorage : cute::aligned_struct<128, _1> {
+      using MainloopTensorStorage = typename CollectiveMainloop::TensorStorage;
+
+      // The epilogue stages O in the Q buffer of the mainloop
+      MainloopTensorStorage mainloop;
+    } tensors;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  // Device side arguments
+  struct Arguments {
+    ProblemShape problem_shape{};
+    MainloopArguments mainloop{};
+    EpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+    TileSchedulerArguments scheduler{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    ProblemShape problem_shape{};
+    MainloopParams mainloop{};
+    EpilogueParams epilogue{};
+    TileSchedulerParams scheduler{};
+  };
+
+  //
+  // Methods
+  //
+
+  static
+  Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    CUTLASS_TRACE_HOST("to_underlying_arguments():");
+
+    return {
+      args.problem_shape,
+      CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
+      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace),
+      TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, TileShape{}, args.scheduler)
+    };
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    bool implementable = CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
+    implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
+    }
+    return implementable;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return TileScheduler::get_grid_shape(params.scheduler);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+
+#if defined(__CUDA_ARCH_FEAT_SM90_ALL)
+#  define ENABLE_SM90_KERNEL_LEVEL 1
+#endif
+// Any Tensor Op MMA Atom in the WGMMA ISA is arch conditional to sm90a.
+#if ! defined(ENABLE_SM90_KERNEL_LEVEL)
+    printf("ERROR : Arch conditional MMA instruction used without targeting appropriate compute capability. Aborting.\n");
+#else
+
+    enum class WarpGroupRole {
+      Producer = 0,
+      Consumer0 = 1,
+      Consumer1 = 2
+    };
+    enum class ProducerWarpRole {
+      Mainloop = 0,
+      Warp1 = 1,
+      Warp2 = 2,
+      Warp3 = 3
+    };
+
+    // Kernel level shared memory storage
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    int thread_idx = int(threadIdx.x);
+    int warp_idx = canonical_warp_idx_sync();
+    int warp_idx_in_warp_group = warp_idx % NumWarpsPerWarpGroup;
+    int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
+    auto warp_group_role = WarpGroupRole(canonical_warp_group_idx());
+    auto producer_warp_role = ProducerWarpRole(warp_idx_in_warp_group);
+    int lane_predicate = cute::elect_one_sync();
+
+    // Issue Tma Descriptor Prefetch from a single thread
+    if ((warp_idx == 0) && lane_predicate) {
+      CollectiveMainloop::prefetch_tma_descriptors(params.mainloop);
+      CollectiveEpilogue::prefetch_tma_descriptors(params.epilogue);
+    }
+
+    // Mainloop Load pipelines: Q once per tile, K and V streamed through their stages
+    using MainloopPipelineQ = typename CollectiveMainloop::MainloopPipelineQ;
+    using MainloopPipelineKV = typename CollectiveMainloop::MainloopPipelineKV;
+
+    typename MainloopPipelineQ::Params pipeline_q_params;
+    typename MainloopPipelineKV::Params pipeline_k_params;
+    if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::Mainloop) {
+      pipeline_q_params.role = MainloopPipelineQ::ThreadCategory::Producer;
+      pipeline_k_params.role = MainloopPipelineKV::ThreadCategory::Producer;
+    }
+    if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+      pipeline_q_params.role = MainloopPipelineQ::ThreadCategory::Consumer;
+      pipeline_k_params.role = MainloopPipelineKV::ThreadCategory::Consumer;
+    }
+    pipeline_q_params.is_leader = warp_group_thread_idx == 0;
+    pipeline_q_params.num_consumers = NumMmaThreads;
+    pipeline_q_params.transaction_bytes = CollectiveMainloop::TmaTransactionBytesQ;
+    pipeline_k_params.is_leader = warp_group_thread_idx == 0;
+    pipeline_k_params.num_consumers = NumMmaThreads;
+    pipeline_k_params.transaction_bytes = CollectiveMainloop::TmaTransactionBytesK;
+    auto pipeline_v_params = pipeline_k_params;
+    pipeline_v_params.transaction_bytes = CollectiveMainloop::TmaTransactionBytesV;
+
+    MainloopPipelineQ pipeline_q(shared_storage.pipelines.mainloop.q, pipeline_q_params, ClusterShape{});
+    MainloopPipelineKV pipeline_k(shared_storage.pipelines.mainloop.k, pipeline_k_params, ClusterShape{});
+    MainloopPipelineKV pipeline_v(shared_storage.pipelines.mainloop.v, pipeline_v_params, ClusterShape{});
+
+    typename MathWarpGroupOrderBarrier::Params params_math_wg_order_barrier;
+    // DMA Load WG will not participate in these Ordered Barrier syncs
+    params_math_wg_order_barrier.group_id = canonical_warp_group_idx() - static_cast<int>(WarpGroupRole::Consumer0);
+    params_math_wg_order_barrier.group_size = NumThreadsPerWarpGroup; // Number of threads / participants in a group
+    MathWarpGroupOrderBarrier math_wg_order_barrier(shared_storage.pipelines.math_wg_order, params_math_wg_order_barrier);
+
+    // Initialize starting pipeline states for the collectives
+    typename CollectiveMainloop::PipelineStateQ pipe_read_q;
+    typename CollectiveMainloop::PipelineStateKV pipe_read_k;
+    typename CollectiveMainloop::PipelineStateKV pipe_read_v;
+
+    // For the DMA Load (producer) we start with an opposite phase
+    // i.e., we skip all waits since we know that the buffer is indeed empty
+    auto pipe_write_q = cutlass::make_producer_start_state<MainloopPipelineQ>();
+    auto pipe_write_k = cutlass::make_producer_start_state<MainloopPipelineKV>();
+    auto pipe_write_v = cutlass::make_producer_start_state<MainloopPipelineKV>();
+
+    // We need this to guarantee that the Pipeline init is visible to all producers and consumers
+    __syncthreads();
+
+    CollectiveMainloop collective_mainloop;
+    CollectiveEpilogue collective_epilogue;
+    TileScheduler scheduler{params.scheduler};
+
+    if (warp_group_role == WarpGroupRole::Producer) {
+      cutlass::arch::warpgroup_reg_dealloc<LoadRegisterRequirement>();
+
+      if (producer_warp_role == ProducerWarpRole::Mainloop) {
+        for (; scheduler.is_valid(); ++scheduler) {
+          auto blk_coord = scheduler.get_block_coord();
+          collective_mainloop.load(
+            blk_coord,
+            params.problem_shape,
+            params.mainloop,
+            pipeline_q, pipe_write_q,
+            pipeline_k, pipe_write_k,
+            pipeline_v, pipe_write_v,
+            shared_storage.tensors.mainloop
+          );
+        }
+
+        // Make sure all the loads retire before the CTA exits
+        collective_mainloop.load_tail(pipeline_k, pipe_write_k, pipeline_v, pipe_write_v);
+      }
+    }
+    else if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+      cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
+
+      // Index of the thread among the math warp groups
+      int mma_thread_idx = thread_idx - NumThreadsPerWarpGroup;
+      typename CollectiveMainloop::TiledMmaPV tiled_mma_pv;
+
+      for (; scheduler.is_valid(); ++scheduler) {
+        auto blk_coord = scheduler.get_block_coord();
+        auto [tOrO, lse] = collective_mainloop.mma(
+          blk_coord,
+          params.problem_shape,
+          params.mainloop,
+          pipeline_q, pipe_read_q,
+          pipeline_k, pipe_read_k,
+          pipeline_v, pipe_read_v,
+          math_wg_order_barrier,
+          mma_thread_idx,
+          shared_storage.tensors.mainloop
+        );
+
+        collective_epilogue.store(
+          blk_coord,
+          params.problem_shape,
+          params.epilogue,
+          tOrO,
+          lse,
+          tiled_mma_pv,
+          mma_thread_idx,
+          shared_storage.tensors.mainloop.smem_q.data()
+        );
+      }
+    }
+#endif
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::kernel
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
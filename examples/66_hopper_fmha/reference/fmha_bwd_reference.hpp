@@ -0,0 +1,258 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Naive FMHA backward used to verify the Hopper kernels: one CTA per (query, head, batch)
+    computes dQ, one CTA per (key, head, batch) computes dK and dV, from the output and the
+    logsumexp of the forward pass.
+*/
+
+#pragma once
+
+#include <cmath>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/platform/platform.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::reference {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Probability and score gradient of (q, k): P = exp(scale * q.k - LSE), dS = P * (dO.v - dO.o)
+template <class TensorQKVO, class TensorLSE, class HBCoord>
+CUTLASS_DEVICE void
+fmha_bwd_reference_score(
+    TensorQKVO const& mQ, TensorQKVO const& mK, TensorQKVO const& mV,
+    TensorQKVO const& mO, TensorQKVO const& mdO, TensorLSE const& mLSE,
+    int q, int k, HBCoord const& hb, float dpsum, float scale_softmax, bool causal,
+    float& p, float& ds) {
+  float lse = mLSE(q, hb);
+  if ((causal && k > q) || lse == -cutlass::platform::numeric_limits<float>::infinity()) {
+    p = 0.f;
+    ds = 0.f;
+    return;
+  }
+  int D = size<1>(mQ);
+  float s = 0, dp = 0;
+  for (int d = 0; d < D; ++d) {
+    s += float(mQ(q, d, hb)) * float(mK(k, d, hb));
+    dp += float(mdO(q, d, hb)) * float(mV(k, d, hb));
+  }
+  p = expf(s * scale_softmax - lse);
+  ds = p * (dp - dpsum);
+}
+
+/// rowsum(dO o O) of query q
+template <class TensorQKVO, class HBCoord>
+CUTLASS_DEVICE float
+fmha_bwd_reference_dpsum(TensorQKVO const& mO, TensorQKVO const& mdO, int q, HBCoord const& hb) {
+  float acc = 0;
+  for (int d = 0; d < size<1>(mO); ++d) {
+    acc += float(mO(q, d, hb)) * float(mdO(q, d, hb));
+  }
+  return acc;
+}
+
+template <
+  class ProblemShape,
+  class Element,
+  class StrideQKVO,
+  class ElementLSE,
+  class StrideLSE
+>
+__global__ void
+fmha_bwd_reference_dq_kernel(
+    ProblemShape problem_shape,
+    Element const* ptr_Q, StrideQKVO dQ,
+    Element const* ptr_K, StrideQKVO dK,
+    Element const* ptr_V, StrideQKVO dV,
+    Element const* ptr_O, StrideQKVO dO,
+    ElementLSE const* ptr_LSE, StrideLSE dLSE,
+    Element const* ptr_dO, StrideQKVO ddO,
+    Element* ptr_dQ, StrideQKVO ddQ,
+    float scale_softmax,
+    bool causal) {
+
+  extern __shared__ float reference_ds[];
+
+  auto [Q, K, D, HB] = problem_shape;
+
+  Tensor mQ = make_tensor(make_gmem_ptr(ptr_Q), make_layout(make_shape(Q, D, HB), dQ));
+  Tensor mK = make_tensor(make_gmem_ptr(ptr_K), make_layout(make_shape(K, D, HB), dK));
+  Tensor mV = make_tensor(make_gmem_ptr(ptr_V), make_layout(make_shape(K, D, HB), dV));
+  Tensor mO = make_tensor(make_gmem_ptr(ptr_O), make_layout(make_shape(Q, D, HB), dO));
+  Tensor mLSE = make_tensor(make_gmem_ptr(ptr_LSE), make_layout(make_shape(Q, HB), dLSE));
+  Tensor mdO = make_tensor(make_gmem_ptr(ptr_dO), make_layout(make_shape(Q, D, HB), ddO));
+  Tensor mdQ = make_tensor(make_gmem_ptr(ptr_dQ), make_layout(make_shape(Q, D, HB), ddQ));
+
+  int q = blockIdx.x;
+  auto hb = make_coord(int(blockIdx.y), int(blockIdx.z));
+
+  float dpsum = fmha_bwd_reference_dpsum(mO, mdO, q, hb);
+
+  // dS of the whole row
+  for (int k = threadIdx.x; k < K; k += blockDim.x) {
+    float p, ds;
+    fmha_bwd_reference_score(mQ, mK, mV, mO, mdO, mLSE, q, k, hb, dpsum, scale_softmax, causal, p, ds);
+    reference_ds[k] = ds;
+  }
+  __syncthreads();
+
+  // dQ = scale * dS * K
+  for (int d = threadIdx.x; d < D; d += blockDim.x) {
+    float acc = 0;
+    for (int k = 0; k < K; ++k) {
+      acc += reference_ds[k] * float(mK(k, d, hb));
+    }
+    mdQ(q, d, hb) = Element(acc * scale_softmax);
+  }
+}
+
+template <
+  class ProblemShape,
+  class Element,
+  class StrideQKVO,
+  class ElementLSE,
+  class StrideLSE
+>
+__global__ void
+fmha_bwd_reference_dkdv_kernel(
+    ProblemShape problem_shape,
+    Element const* ptr_Q, StrideQKVO dQ,
+    Element const* ptr_K, StrideQKVO dK,
+    Element const* ptr_V, StrideQKVO dV,
+    Element const* ptr_O, StrideQKVO dO,
+    ElementLSE const* ptr_LSE, StrideLSE dLSE,
+    Element const* ptr_dO, StrideQKVO ddO,
+    Element* ptr_dK, StrideQKVO ddK,
+    Element* ptr_dV, StrideQKVO ddV,
+    float scale_softmax,
+    bool causal) {
+
+  extern __shared__ float reference_p_ds[];
+
+  auto [Q, K, D, HB] = problem_shape;
+
+  Tensor mQ = make_tensor(make_gmem_ptr(ptr_Q), make_layout(make_shape(Q, D, HB), dQ));
+  Tensor mK = make_tensor(make_gmem_ptr(ptr_K), make_layout(make_shape(K, D, HB), dK));
+  Tensor mV = make_tensor(make_gmem_ptr(ptr_V), make_layout(make_shape(K, D, HB), dV));
+  Tensor mO = make_tensor(make_gmem_ptr(ptr_O), make_layout(make_shape(Q, D, HB), dO));
+  Tensor mLSE = make_tensor(make_gmem_ptr(ptr_LSE), make_layout(make_shape(Q, HB), dLSE));
+  Tensor mdO = make_tensor(make_gmem_ptr(ptr_dO), make_layout(make_shape(Q, D, HB), ddO));
+  Tensor mdK = make_tensor(make_gmem_ptr(ptr_dK), make_layout(make_shape(K, D, HB), ddK));
+  Tensor mdV = make_tensor(make_gmem_ptr(ptr_dV), make_layout(make_shape(K, D, HB), ddV));
+
+  int k = blockIdx.x;
+  auto hb = make_coord(int(blockIdx.y), int(blockIdx.z));
+  float* reference_p = reference_p_ds;
+  float* reference_ds = reference_p_ds + int(Q);
+
+  // P and dS of the whole column
+  for (int q = threadIdx.x; q < Q; q += blockDim.x) {
+    float dpsum = fmha_bwd_reference_dpsum(mO, mdO, q, hb);
+    fmha_bwd_reference_score(mQ, mK, mV, mO, mdO, mLSE, q, k, hb, dpsum, scale_softmax, causal,
+                             reference_p[q], reference_ds[q]);
+  }
+  __syncthreads();
+
+  // dV = P^T * dO, dK = scale * dS^T * Q
+  for (int d = threadIdx.x; d < D; d += blockDim.x) {
+    float acc_dv = 0, acc_dk = 0;
+    for (int q = 0; q < Q; ++q) {
+      acc_dv += reference_p[q] * float(mdO(q, d, hb));
+      acc_dk += reference_ds[q] * float(mQ(q, d, hb));
+    }
+    mdV(k, d, hb) = Element(acc_dv);
+    mdK(k, d, hb) = Element(acc_dk * scale_softmax);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Computes the gradients dQ, dK and dV of O = softmax(scale_softmax * Q * K^T) * V given dO, the
+/// output O and the logsumexp LSE of the forward pass (see fmha_fwd_reference).
+template <
+  class ProblemShape,
+  class Element,
+  class StrideQKVO,
+  class ElementLSE,
+  class StrideLSE
+>
+void fmha_bwd_reference(
+    ProblemShape problem_shape,
+    Element const* ptr_Q, StrideQKVO dQ,
+    Element const* ptr_K, StrideQKVO dK,
+    Element const* ptr_V, StrideQKVO dV,
+    Element const* ptr_O, StrideQKVO dO,
+    ElementLSE const* ptr_LSE, StrideLSE dLSE,
+    Element const* ptr_dO, StrideQKVO ddO,
+    Element* ptr_dQ, StrideQKVO ddQ,
+    Element* ptr_dK, StrideQKVO ddK,
+    Element* ptr_dV, StrideQKVO ddV,
+    float scale_softmax,
+    bool causal,
+    cudaStream_t stream = nullptr) {
+
+  dim3 block(128);
+  int H = int(get<3,0>(problem_shape));
+  int B = int(get<3,1>(problem_shape));
+
+  auto dq_kernel = fmha_bwd_reference_dq_kernel<ProblemShape, Element, StrideQKVO, ElementLSE, StrideLSE>;
+  int dq_smem_size = int(get<1>(problem_shape)) * int(sizeof(float));
+  if (dq_smem_size >= (48 << 10)) {
+    cudaFuncSetAttribute(dq_kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, dq_smem_size);
+  }
+  dq_kernel<<<dim3(int(get<0>(problem_shape)), H, B), block, dq_smem_size, stream>>>(
+    problem_shape,
+    ptr_Q, dQ, ptr_K, dK, ptr_V, dV, ptr_O, dO, ptr_LSE, dLSE, ptr_dO, ddO, ptr_dQ, ddQ,
+    scale_softmax, causal);
+
+  auto dkdv_kernel = fmha_bwd_reference_dkdv_kernel<ProblemShape, Element, StrideQKVO, ElementLSE, StrideLSE>;
+  int dkdv_smem_size = 2 * int(get<0>(problem_shape)) * int(sizeof(float));
+  if (dkdv_smem_size >= (48 << 10)) {
+    cudaFuncSetAttribute(dkdv_kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, dkdv_smem_size);
+  }
+  dkdv_kernel<<<dim3(int(get<1>(problem_shape)), H, B), block, dkdv_smem_size, stream>>>(
+    problem_shape,
+    ptr_Q, dQ, ptr_K, dK, ptr_V, dV, ptr_O, dO, ptr_LSE, dLSE, ptr_dO, ddO, ptr_dK, ddK, ptr_dV, ddV,
+    scale_softmax, causal);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::reference
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
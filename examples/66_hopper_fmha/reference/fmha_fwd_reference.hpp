@@ -0,0 +1,170 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Naive FMHA forward used to verify the Hopper kernels: one CTA per (query, head, batch),
+    scores of the whole row are kept in shared memory.
+*/
+
+#pragma once
+
+#include <cmath>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/platform/platform.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::reference {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class ProblemShape,
+  class Element,
+  class StrideQKVO,
+  class ElementLSE,
+  class StrideLSE
+>
+__global__ void
+fmha_fwd_reference_kernel(
+    ProblemShape problem_shape,
+    Element const* ptr_Q, StrideQKVO dQ,
+    Element const* ptr_K, StrideQKVO dK,
+    Element const* ptr_V, StrideQKVO dV,
+    Element* ptr_O, StrideQKVO dO,
+    ElementLSE* ptr_LSE, StrideLSE dLSE,
+    float scale_softmax,
+    bool causal) {
+
+  extern __shared__ float reference_scores[];
+
+  auto [Q, K, D, HB] = problem_shape;
+
+  Tensor mQ = make_tensor(make_gmem_ptr(ptr_Q), make_layout(make_shape(Q, D, HB), dQ));
+  Tensor mK = make_tensor(make_gmem_ptr(ptr_K), make_layout(make_shape(K, D, HB), dK));
+  Tensor mV = make_tensor(make_gmem_ptr(ptr_V), make_layout(make_shape(K, D, HB), dV));
+  Tensor mO = make_tensor(make_gmem_ptr(ptr_O), make_layout(make_shape(Q, D, HB), dO));
+  Tensor mLSE = make_tensor(make_gmem_ptr(ptr_LSE), make_layout(make_shape(Q, HB), dLSE));
+
+  int q = blockIdx.x;
+  auto hb = make_coord(int(blockIdx.y), int(blockIdx.z));
+
+  // S = Q * K^T, masked
+  for (int k = threadIdx.x; k < K; k += blockDim.x) {
+    float acc = 0;
+    for (int d = 0; d < D; ++d) {
+      acc += float(mQ(q, d, hb)) * float(mK(k, d, hb));
+    }
+    reference_scores[k] = (causal && k > q) ? -cutlass::platform::numeric_limits<float>::infinity() : acc * scale_softmax;
+  }
+  __syncthreads();
+
+  // A single thread computes the row statistics, this is not meant to be fast
+  __shared__ float row_max, row_sum;
+  if (threadIdx.x == 0) {
+    float max_val = -cutlass::platform::numeric_limits<float>::infinity();
+    for (int k = 0; k < K; ++k) {
+      max_val = fmaxf(max_val, reference_scores[k]);
+    }
+    float sum = 0;
+    for (int k = 0; k < K; ++k) {
+      sum += max_val == -cutlass::platform::numeric_limits<float>::infinity() ? 0.f : expf(reference_scores[k] - max_val);
+    }
+    row_max = max_val;
+    row_sum = sum;
+  }
+  __syncthreads();
+
+  // O = softmax(S) * V
+  for (int d = threadIdx.x; d < D; d += blockDim.x) {
+    float acc = 0;
+    if (row_sum > 0) {
+      for (int k = 0; k < K; ++k) {
+        acc += expf(reference_scores[k] - row_max) * float(mV(k, d, hb));
+      }
+      acc /= row_sum;
+    }
+    mO(q, d, hb) = Element(acc);
+  }
+
+  if (threadIdx.x == 0 && ptr_LSE != nullptr) {
+    mLSE(q, hb) = row_sum > 0 ? row_max + logf(row_sum) : -cutlass::platform::numeric_limits<float>::infinity();
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Computes O = softmax(scale_softmax * Q * K^T) * V and the logsumexp of each row of the scaled
+/// scores. The causal mask is aligned to the top-left corner, as in CausalMask.
+template <
+  class ProblemShape,
+  class Element,
+  class StrideQKVO,
+  class ElementLSE,
+  class StrideLSE
+>
+void fmha_fwd_reference(
+    ProblemShape problem_shape,
+    Element const* ptr_Q, StrideQKVO dQ,
+    Element const* ptr_K, StrideQKVO dK,
+    Element const* ptr_V, StrideQKVO dV,
+    Element* ptr_O, StrideQKVO dO,
+    ElementLSE* ptr_LSE, StrideLSE dLSE,
+    float scale_softmax,
+    bool causal,
+    cudaStream_t stream = nullptr) {
+
+  dim3 grid(int(get<0>(problem_shape)), int(get<3,0>(problem_shape)), int(get<3,1>(problem_shape)));
+  dim3 block(128);
+  int smem_size = int(get<1>(problem_shape)) * int(sizeof(float));
+
+  if (smem_size >= (48 << 10)) {
+    cudaFuncSetAttribute(
+      fmha_fwd_reference_kernel<ProblemShape, Element, StrideQKVO, ElementLSE, StrideLSE>,
+      cudaFuncAttributeMaxDynamicSharedMemorySize,
+      smem_size);
+  }
+
+  fmha_fwd_reference_kernel<<<grid, block, smem_size, stream>>>(
+    problem_shape,
+    ptr_Q, dQ, ptr_K, dK, ptr_V, dV, ptr_O, dO, ptr_LSE, dLSE,
+    scale_softmax, causal);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::reference
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,587 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Hopper skinny GEMM (GEMV) example for small-batch decode using CUTLASS 3.x APIs.
+
+    This example computes D = alpha * X @ W + beta * C where X holds M <= 16 activation rows (the
+    tokens of a decode step) and W is a large N x K weight matrix stored either as FP8 or as INT4
+    with group-wise FP8 scales.
+
+    The weight read dominates the runtime of such a GEMM, so the kernel must stream W at full HBM
+    bandwidth while wasting as little of the tensor cores as possible. The M extent of a GMMA is fixed
+    at 64 rows per warp group, whereas its N extent can be as small as 8. This example therefore swaps
+    the operands and computes D^T = W^T @ X^T: the weights become the "A" operand and run over the
+    128-row GMMA M extent, while the activations become the "B" operand with the small CTA tile N
+    of 16. The transposed output is written with a TMA epilogue by transposing the layout of D.
+
+    The weights are loaded by TMA with a deep pipeline (a 128x16 tile leaves room for many stages).
+    A decode GEMM is usually too small to cover all SMs with output tiles, so the kernel uses the
+    stream-K tile scheduler. By default it picks between data-parallel, split-K and stream-K
+    decompositions heuristically; --splits forces a split-K decomposition with the given factor.
+
+    INT4 weights use the lookup-table path of the mixed-input collective (see example
+    55_hopper_int4_fp8_gemm for the encoding requirements), and are reordered offline so that each
+    thread reads its weights with wide shared memory loads.
+
+    Limitations:
+      1) M must not exceed the CTA tile N (16). Larger batches should use the regular GEMM tiles.
+      2) INT4 weights only support the scale-only mode with per-column or group-wise scales.
+
+    Examples:
+
+      Runs a decode step of 8 tokens against FP8 weights
+      $ ./examples/68_hopper_skinny_gemm/68_hopper_skinny_gemm --m=8 --n=4096 --k=4096 --weights=fp8
+
+      Runs a single token against INT4 weights with group size 128, splitting K four ways
+      $ ./examples/68_hopper_skinny_gemm/68_hopper_skinny_gemm --m=1 --n=4096 --k=8192 --g=128 --weights=int4 --splits=4
+*/
+
+#include <iostream>
+#include <string>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/epilogue/collective/default_epilogue.hpp"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/distribution.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/mixed_dtype_reorder.hpp"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/tensor_view_io.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+
+#include "helper.h"
+#include "../55_hopper_mixed_dtype_gemm/mixed_dtype_utils.hpp"
+#include "../55_hopper_mixed_dtype_gemm/packed_scale.hpp"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+using MmaType = cutlass::float_e4m3_t;
+using QuantType = cutlass::int4b_t;
+constexpr int TileShapeK = 128 * 8 / sizeof_bits<MmaType>::value;
+
+// A matrix configuration (activations)
+using         ElementA    = MmaType;                                        // Element type for A matrix operand
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for A matrix operand
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Memory access granularity/alignment of A matrix in units of elements (up to 16 bytes)
+
+// B matrix configuration (weights)
+using         ElementB    = MmaType;                                        // Element type for FP8 weights
+using         ElementQ    = QuantType;                                      // Element type for INT4 weights
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B matrix operand
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Memory access granularity/alignment of FP8 weights in units of elements (up to 16 bytes)
+constexpr int AlignmentQ  = 128 / cutlass::sizeof_bits<ElementQ>::value;    // Memory access granularity/alignment of INT4 weights in units of elements (up to 16 bytes)
+
+// This example swaps and transposes the operands, so keep transpose of input layouts
+using LayoutA_Transpose = typename cutlass::layout::LayoutTranspose<LayoutA>::type;
+using LayoutB_Transpose = typename cutlass::layout::LayoutTranspose<LayoutB>::type;
+
+using StrideA = cutlass::detail::TagToStrideA_t<LayoutA>;
+using StrideB = cutlass::detail::TagToStrideB_t<LayoutB>;
+
+// INT4 weights are reordered offline so that values read by the same thread are contiguous
+using LayoutQ_Reordered = cutlass::ReorderedLayout<MmaType, StrideB>;
+
+using ElementScale = MmaType;
+using ElementZero = ElementScale; // only for verify
+using LayoutScale = cutlass::layout::RowMajor;
+
+// C/D matrix configuration
+using         ElementC    = cutlass::half_t;                                // Element type for C and D matrix operands
+using         LayoutC     = cutlass::layout::RowMajor;                      // Layout type for C and D matrix operands
+constexpr int AlignmentC  = 128 / cutlass::sizeof_bits<ElementC>::value;    // Memory access granularity/alignment of C matrix in units of elements (up to 16 bytes)
+
+// D matrix configuration
+using         ElementD    = ElementC;
+using         LayoutD     = LayoutC;
+constexpr int AlignmentD  = 128 / cutlass::sizeof_bits<ElementD>::value;
+
+// Core kernel configurations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ElementCompute      = float;                                          // Element type for epilogue computation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+// Weights run over the 128-row GMMA M extent, the (at most 16) activation rows over the small N extent
+using TileShape           = Shape<_128,_16,cute::Int<TileShapeK>>;          // Threadblock-level tile size
+using ClusterShape        = Shape<_1,_1,_1>;                                // Shape of the threadblocks in a cluster
+using KernelScheduleFP8   = cutlass::gemm::KernelTmaWarpSpecializedCooperativeFP8FastAccum;
+using KernelScheduleInt4  = cutlass::gemm::KernelTmaWarpSpecializedCooperative;
+using EpilogueSchedule    = cutlass::epilogue::TmaWarpSpecializedCooperative;
+using EpilogueTileType    = cutlass::epilogue::collective::EpilogueTileAuto;
+using TileScheduler       = cutlass::gemm::StreamKScheduler;                // Splits K across CTAs when there are too few output tiles
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    TileShape, ClusterShape,
+    EpilogueTileType,
+    ElementAccumulator, ElementAccumulator,
+    // Transpose layout of D here since we use explicit swap + transpose
+    ElementC, typename cutlass::layout::LayoutTranspose<LayoutC>::type, AlignmentC,
+    ElementD, typename cutlass::layout::LayoutTranspose<LayoutD>::type, AlignmentD,
+    EpilogueSchedule
+  >::CollectiveOp;
+
+// =========================================================== FP8 WEIGHTS ===========================================================================
+using CollectiveMainloopFP8 = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementB, LayoutB_Transpose, AlignmentB,
+    ElementA, LayoutA_Transpose, AlignmentA,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))
+    >,
+    KernelScheduleFP8
+  >::CollectiveOp;
+
+using GemmKernelFP8 = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>, // Indicates ProblemShape
+    CollectiveMainloopFP8,
+    CollectiveEpilogue,
+    TileScheduler
+>;
+
+// =========================================================== INT4 WEIGHTS WITH SCALES ======================================================================
+// The scale lookup table is paired with the weights, which are the operand that gets scaled.
+using CollectiveMainloopInt4 = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    cute::tuple<ElementQ, cutlass::Array<ElementScale, 8>>, LayoutQ_Reordered, AlignmentQ,
+    ElementA, LayoutA_Transpose, AlignmentA,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))
+    >,
+    KernelScheduleInt4
+  >::CollectiveOp;
+
+using GemmKernelInt4 = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>, // Indicates ProblemShape
+    CollectiveMainloopInt4,
+    CollectiveEpilogue,
+    TileScheduler
+>;
+
+using GemmFP8  = cutlass::gemm::device::GemmUniversalAdapter<GemmKernelFP8>;
+using GemmInt4 = cutlass::gemm::device::GemmUniversalAdapter<GemmKernelInt4>;
+
+using StrideC = typename GemmKernelFP8::StrideC;
+using StrideD = typename GemmKernelFP8::StrideD;
+
+using StrideC_ref = cutlass::detail::TagToStrideC_t<LayoutC>;
+using StrideD_ref = cutlass::detail::TagToStrideC_t<LayoutD>;
+
+using DecompositionMode = cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90StreamKParams::DecompositionMode;
+
+//
+// Data members
+//
+
+/// Initialization
+StrideA stride_A;
+StrideB stride_B;
+StrideC stride_C;
+StrideC_ref stride_C_ref;
+StrideD stride_D;
+StrideD_ref stride_D_ref;
+uint64_t seed;
+
+LayoutQ_Reordered layout_Q_reordered;
+
+using StrideS = typename CollectiveMainloopInt4::StrideScale;
+using StrideS_ref = cutlass::detail::TagToStrideB_t<LayoutScale>;
+StrideS stride_S;
+StrideS_ref stride_S_ref;
+
+cutlass::DeviceAllocation<ElementA> block_A;
+cutlass::DeviceAllocation<ElementQ> block_Q;
+cutlass::DeviceAllocation<ElementQ> block_Q_modified;
+// FP8 weights, or the dequantized INT4 weights used by the reference GEMM
+cutlass::DeviceAllocation<ElementB> block_B;
+cutlass::DeviceAllocation<ElementScale> block_scale;
+cutlass::DeviceAllocation<cutlass::Array<ElementScale, 8>> block_scale_packed;
+cutlass::DeviceAllocation<ElementZero> block_zero;
+cutlass::DeviceAllocation<ElementC> block_C;
+cutlass::DeviceAllocation<typename GemmFP8::EpilogueOutputOp::ElementOutput> block_D;
+cutlass::DeviceAllocation<typename GemmFP8::EpilogueOutputOp::ElementOutput> block_ref_D;
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options : MixedDtypeOptions {
+  std::string weights = "int4";
+  int splits = 1;
+
+  Options() {
+    m = 8;
+    n = 4096;
+    k = 4096;
+  }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+    cmd.get_cmd_line_argument("weights", weights);
+    cmd.get_cmd_line_argument("splits", splits);
+
+    this->MixedDtypeOptions::parse(argc, args);
+
+    mode = 1; // override the mode value to always be scale only mode
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "68_hopper_skinny_gemm\n\n"
+      << "  Hopper skinny GEMM for small-batch decode using a swapped-operand Warp Specialized kernel.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM (number of tokens, at most 16)\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM\n"
+      << "  --k=<int>                   Sets the K extent of the GEMM\n"
+      << "  --l=<int>                   The number of independent gemm problems with mnk shape\n"
+      << "  --g=<int>                   The size of each group for the INT4 scales. To broadcast a vector of scales, set the group size to K.\n"
+      << "  --weights=<fp8|int4>        The data type of the weights\n"
+      << "  --splits=<int>              Forces a split-K decomposition with the given number of splits. 1 selects the decomposition heuristically.\n"
+      << "  --alpha=<f32>               Epilogue scalar alpha\n"
+      << "  --beta=<f32>                Epilogue scalar beta\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n"
+      << "  --warmup=<int>              Number of warmup iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "68_hopper_skinny_gemm" << " --m=4 --n=8192 --k=8192 --g=128 --weights=int4 --splits=2 \n\n";
+
+    return out;
+  }
+
+  /// Compute effective weight bandwidth in GB/s, which is the figure of merit of a decode GEMM
+  double gbytes_per_sec(double runtime_s) const
+  {
+    int const weight_bits = weights == "fp8" ? cutlass::sizeof_bits<cutlass::float_e4m3_t>::value
+                                             : cutlass::sizeof_bits<cutlass::int4b_t>::value;
+    double bytes = double(n) * k * l * weight_bits / 8;
+    return bytes / double(1.0e9) / runtime_s;
+  }
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Initialize operands to be used in the GEMM and reference GEMM
+void initialize(Options const& options) {
+
+  auto shape_B = cute::make_shape(options.n, options.k, options.l);
+  int const scale_k = (options.k + options.g - 1) / options.g;
+  stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(options.m, options.k, options.l));
+  stride_B = cutlass::make_cute_packed_stride(StrideB{}, shape_B);
+  // Reverse stride here due to swap and transpose
+  stride_C = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(options.n, options.m, options.l));
+  stride_C_ref = cutlass::make_cute_packed_stride(StrideC_ref{}, cute::make_shape(options.m, options.n, options.l));
+  // Reverse stride here due to swap and transpose
+  stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(options.n, options.m, options.l));
+  stride_D_ref = cutlass::make_cute_packed_stride(StrideD_ref{}, cute::make_shape(options.m, options.n, options.l));
+
+  auto layout_B = make_layout(shape_B, stride_B);
+
+  auto a_coord = cutlass::make_Coord(options.m * options.l, options.k);
+  auto b_coord = cutlass::make_Coord(options.k, options.n * options.l);
+  auto c_coord = cutlass::make_Coord(options.m * options.l, options.n);
+
+  block_A.reset(a_coord.product());
+  block_B.reset(b_coord.product());
+  block_C.reset(c_coord.product());
+  block_D.reset(c_coord.product());
+  block_ref_D.reset(c_coord.product());
+
+  initialize_tensor(block_A, seed + 2022);
+  initialize_tensor(block_C, seed + 2020);
+
+  if (options.weights == "fp8") {
+    initialize_tensor(block_B, seed + 2021);
+    return;
+  }
+
+  block_Q.reset(b_coord.product());
+  block_Q_modified.reset(b_coord.product());
+  block_scale.reset(scale_k * options.l * options.n);
+  block_scale_packed.reset(scale_k * options.l * options.n);
+  block_zero.reset(scale_k * options.l * options.n);
+
+  initialize_quant_tensor(block_Q, seed + 2021);
+  unify_quant_encoding(block_Q, block_Q_modified);
+  initialize_scale(block_scale, options);
+  initialize_packed_scale(block_scale, block_scale_packed);
+  initialize_zero(block_zero, options);
+
+  auto shape_scale_zero = cute::make_shape(options.n, scale_k, options.l);
+  stride_S = cutlass::make_cute_packed_stride(StrideS{}, cute::make_shape(options.n, scale_k, options.l));
+  stride_S_ref = cutlass::make_cute_packed_stride(StrideS_ref{}, cute::make_shape(options.n, scale_k, options.l));
+  auto layout_scale_zero = make_layout(shape_scale_zero, stride_S_ref);
+
+  dequantize_weight(block_B.get(), block_Q.get(), layout_B, block_scale.get(), block_zero.get(), layout_scale_zero, options.g);
+
+  // Decode weights are static, so they are always reordered ahead of time
+  layout_Q_reordered = cutlass::make_reordered_layout<MmaType>(shape_B);
+  cutlass::reorder_tensor(block_Q_modified.get(), layout_B, layout_Q_reordered);
+}
+
+/// Populates a Gemm::Arguments structure from the given commandline options
+/// Swap the A and B tensors, as well as problem shapes here.
+template <typename Gemm>
+typename Gemm::Arguments args_from_options(Options const& options)
+{
+  using Args = typename Gemm::Arguments;
+  auto&& mainloop = [&]() {
+    if constexpr (cute::is_same_v<Gemm, GemmInt4>) {
+      return typename Gemm::CollectiveMainloop::Arguments{
+        block_Q_modified.get(), layout_Q_reordered, block_A.get(), stride_A, block_scale_packed.get(), stride_S, options.g};
+    }
+    else {
+      return typename Gemm::CollectiveMainloop::Arguments{block_B.get(), stride_B, block_A.get(), stride_A};
+    }
+  }();
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  Args arguments {
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {options.n, options.m, options.k, options.l},
+    mainloop,
+    {{options.alpha, options.beta}, block_C.get(), stride_C, block_D.get(), stride_D},
+    hw_info
+  };
+
+  if (options.splits > 1) {
+    arguments.scheduler.splits = options.splits;
+    arguments.scheduler.decomposition_mode = DecompositionMode::SplitK;
+  }
+
+  return arguments;
+}
+
+bool verify(Options const& options) {
+  //
+  // Compute reference output
+  //
+
+  // In this example, we use the GPU default kernels as a reference (unfused scale).
+  // The reference uses the regular (unswapped) tiles and fast accumulation like the kernel under test.
+  using CollectiveMainloopRef = typename cutlass::gemm::collective::CollectiveBuilder<
+      ArchTag, OperatorClass,
+      MmaType, LayoutA, AlignmentA,
+      MmaType, LayoutB, AlignmentB,
+      ElementAccumulator,
+      Shape<_128,_128,cute::Int<TileShapeK>>, ClusterShape,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperativeFP8FastAccum
+    >::CollectiveOp;
+
+  using CollectiveEpilogueRef = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      Shape<_128,_128,cute::Int<TileShapeK>>, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAccumulator, ElementAccumulator,
+      ElementC, LayoutC, AlignmentC,
+      ElementD, LayoutD, AlignmentD,
+      cutlass::epilogue::NoSmemWarpSpecialized
+    >::CollectiveOp;
+
+  using GemmKernelRef = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>, // Indicates ProblemShape
+      CollectiveMainloopRef,
+      CollectiveEpilogueRef
+  >;
+
+  using GemmRef = cutlass::gemm::device::GemmUniversalAdapter<GemmKernelRef>;
+
+  typename GemmRef::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {options.m, options.n, options.k, options.l},
+    {block_A.get(), stride_A, block_B.get(), stride_B},
+    {{options.alpha, options.beta}, block_C.get(), stride_C_ref, block_ref_D.get(), stride_D_ref}
+  };
+
+  // Run the gemm where the scaling is performed outside of the kernel.
+  GemmRef gemm_ref;
+  size_t workspace_size = GemmRef::get_workspace_size(arguments);
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+  CUTLASS_CHECK(gemm_ref.can_implement(arguments));
+  CUTLASS_CHECK(gemm_ref.initialize(arguments, workspace.get()));
+  CUTLASS_CHECK(gemm_ref.run());
+
+  // compare_reference
+  ElementD const epsilon(1e-2f);
+  ElementD const non_zero_floor(1e-4f);
+  bool passed = cutlass::reference::device::BlockCompareRelativelyEqual(block_ref_D.get(), block_D.get(), block_D.size(), epsilon, non_zero_floor);
+
+  return passed;
+}
+
+/// Execute a given example GEMM computation
+template <typename Gemm>
+int run(Options &options)
+{
+  initialize(options);
+
+  // Instantiate CUTLASS kernel depending on templates
+  Gemm gemm;
+
+  // Create a structure of gemm kernel arguments suitable for invoking an instance of Gemm
+  auto arguments = args_from_options<Gemm>(options);
+
+  // Using the arguments, query for extra workspace required for matrix multiplication computation
+  // (the stream-K scheduler keeps its partial accumulators here)
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+
+  // Allocate workspace memory
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(gemm.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  MixedDtypeResult result;
+  result.passed = verify(options);
+  mixed_dtype_profiling(gemm, options, result);
+  if (options.iterations > 0) {
+    std::cout << "  Weight bandwidth: " << options.gbytes_per_sec(result.avg_runtime_ms / 1000.0) << " GB/s" << std::endl;
+  }
+  std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+  if (!result.passed) {
+    exit(-1);
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major < 9) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture or "
+      << "later (compute capability 90 or greater).\n";
+    return 0;
+  }
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.m > 16) {
+    std::cerr << "This example targets decode batches of at most 16 tokens (got --m=" << options.m << ").\n";
+    return -1;
+  }
+
+  if (options.weights != "fp8" && options.weights != "int4") {
+    std::cerr << "Unsupported weight type '" << options.weights << "', expected fp8 or int4.\n";
+    return -1;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  if (options.weights == "fp8") {
+    std::cout << "Running with FP8 weights." << std::endl;
+    run<GemmFP8>(options);
+  }
+  else {
+    if (options.g == options.k) {
+      std::cout << "Running with INT4 weights in per-column scale mode." << std::endl;
+    } else {
+      std::cout << "Running with INT4 weights in group scale mode." << std::endl;
+    }
+    run<GemmInt4>(options);
+  }
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
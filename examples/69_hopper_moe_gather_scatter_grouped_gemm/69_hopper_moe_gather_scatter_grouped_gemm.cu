@@ -0,0 +1,615 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Hopper Grouped GEMM for a MoE expert layer that reads its tokens in router order.
+
+    A MoE layer routes every token to `topk` experts. Each expert multiplies the tokens routed to it
+    with its own weights, which is a Grouped GEMM with one group per expert. Usually the activations are
+    first permuted so that the tokens of an expert are contiguous, and the expert outputs are permuted
+    back afterwards. This example fuses both permutations into the Grouped GEMM:
+
+      * The mainloop, MainloopSm90ArrayTmaGmmaWarpSpecializedGatherA, reads row m of the A tile of expert g
+        from row gather[g][m] of the activations X. Since Hopper TMA cannot gather rows, every row of a
+        tile is fetched with its own TMA box, issued by the lanes of the producer warp.
+
+      * The epilogue, DefaultEpilogueArray with PtrArrayNoSmemWarpSpecialized, writes row m of expert g
+        to row scatter[g][m] of the output Y and reads the source C from the same row.
+
+    Here row a of Y holds the output of the a-th (token, expert) assignment, token a / topk, so that Y is
+    laid out in router order and can be reduced over the topk experts of each token directly.
+
+    To run this example:
+
+      $ ./examples/69_hopper_moe_gather_scatter_grouped_gemm/69_hopper_moe_gather_scatter_grouped_gemm --tokens=4096 --experts=8 --topk=2
+
+    The result is checked against a reference that permutes the activations on the host and runs a
+    regular GEMM for each expert.
+*/
+
+#include <iostream>
+#include <vector>
+#include <numeric>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/epilogue/collective/default_epilogue_array.hpp"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/distribution.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+using namespace cute;
+using ProblemShape = cutlass::gemm::GroupProblemShape<Shape<int,int,int>>; // <M,N,K> per group
+using ElementA = cutlass::half_t;                                          // Element type for the activations
+using ElementB = cutlass::half_t;                                          // Element type for the expert weights
+using ElementC = cutlass::half_t;                                          // Element type for C and D matrix operands
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A matrix configuration, rows are gathered so A must be K-major
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for A matrix operand
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Alignment of A matrix in units of elements (up to 16 bytes)
+
+// B matrix configuration
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B matrix operand
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Alignment of B matrix in units of elements (up to 16 bytes)
+
+// C/D matrix configuration, rows are scattered
+using         LayoutC     = cutlass::layout::RowMajor;                      // Layout type for C and D matrix operands
+constexpr int AlignmentC  = 128 / cutlass::sizeof_bits<ElementC>::value;    // Alignment of C matrix in units of elements (up to 16 bytes)
+
+// Core kernel configurations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+using TileShape           = Shape<_128,_128,_64>;                           // Threadblock-level tile size
+using ClusterShape        = Shape<_1,_1,_1>;                                // Gathered A tiles are not multicast
+using KernelSchedule      = cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative;
+using EpilogueSchedule    = cutlass::epilogue::PtrArrayNoSmemWarpSpecialized;
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    TileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    ElementC, LayoutC *, AlignmentC,
+    ElementC, LayoutC *, AlignmentC,
+    EpilogueSchedule,
+    cutlass::epilogue::fusion::LinearCombination<ElementC, ElementAccumulator>
+  >::CollectiveOp;
+
+// The builder picks the tiled MMA, smem layouts and stage count of the regular Ptr-Array mainloop,
+// which the gather mainloop then reuses as is.
+using CollectiveMainloopNoGather = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementA, LayoutA *, AlignmentA,
+    ElementB, LayoutB *, AlignmentB,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    KernelSchedule
+  >::CollectiveOp;
+
+using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+    cutlass::gemm::MainloopSm90ArrayTmaGmmaWarpSpecializedGatherA<
+      CollectiveMainloopNoGather::DispatchPolicy::Stages, ClusterShape, KernelSchedule>,
+    TileShape,
+    ElementA, typename CollectiveMainloopNoGather::StrideA,
+    ElementB, typename CollectiveMainloopNoGather::StrideB,
+    typename CollectiveMainloopNoGather::TiledMma,
+    typename CollectiveMainloopNoGather::GmemTiledCopyA,
+    typename CollectiveMainloopNoGather::SmemLayoutAtomA,
+    typename CollectiveMainloopNoGather::SmemCopyAtomA,
+    typename CollectiveMainloopNoGather::TransformA,
+    typename CollectiveMainloopNoGather::GmemTiledCopyB,
+    typename CollectiveMainloopNoGather::SmemLayoutAtomB,
+    typename CollectiveMainloopNoGather::SmemCopyAtomB,
+    typename CollectiveMainloopNoGather::TransformB>;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    ProblemShape,
+    CollectiveMainloop,
+    CollectiveEpilogue
+>;
+
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+// Reference device GEMM implementation type
+using DeviceGemmReference = cutlass::reference::device::Gemm<
+  ElementA,
+  LayoutA,
+  ElementB,
+  LayoutB,
+  ElementC,
+  LayoutC,
+  ElementAccumulator,
+  ElementAccumulator>;
+
+using StrideA = typename Gemm::GemmKernel::InternalStrideA;
+using StrideB = typename Gemm::GemmKernel::InternalStrideB;
+using StrideC = typename Gemm::GemmKernel::InternalStrideC;
+using StrideD = typename Gemm::GemmKernel::InternalStrideD;
+
+// Host-side routing, one entry per non-empty expert
+std::vector<int> expert_host;                           // Expert of each group
+std::vector<int64_t> offset_rows;                       // Offset of the group in the gather and scatter index arrays
+std::vector<int32_t> gather_host;                       // Token of each (token, expert) assignment, grouped by expert
+std::vector<int32_t> scatter_host;                      // Output row of each (token, expert) assignment, grouped by expert
+std::vector<typename ProblemShape::UnderlyingProblemShape> problem_sizes_host;
+
+// Device-side allocations
+cutlass::DeviceAllocation<typename ProblemShape::UnderlyingProblemShape> problem_sizes;
+
+cutlass::DeviceAllocation<ElementA> block_X;            // Activations, tokens x k
+cutlass::DeviceAllocation<ElementB> block_W;            // Expert weights, experts x n x k
+cutlass::DeviceAllocation<ElementC> block_C;            // Source, (tokens * topk) x n in router order
+cutlass::DeviceAllocation<ElementC> block_Y;            // Output, (tokens * topk) x n in router order
+cutlass::DeviceAllocation<int32_t> block_gather;
+cutlass::DeviceAllocation<int32_t> block_scatter;
+
+cutlass::DeviceAllocation<const ElementA *> ptr_A;
+cutlass::DeviceAllocation<const ElementB *> ptr_B;
+cutlass::DeviceAllocation<const ElementC *> ptr_C;
+cutlass::DeviceAllocation<ElementC *> ptr_D;
+cutlass::DeviceAllocation<const int32_t *> ptr_gather;
+cutlass::DeviceAllocation<const int32_t *> ptr_scatter;
+
+cutlass::DeviceAllocation<StrideA> stride_A;
+cutlass::DeviceAllocation<StrideB> stride_B;
+cutlass::DeviceAllocation<StrideC> stride_C;
+cutlass::DeviceAllocation<StrideD> stride_D;
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  float alpha = 1.0f;
+  float beta  = 0.0f;
+  int iterations = 10;
+  int tokens = 4096, experts = 8, topk = 2, n = 2048, k = 1024;
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("tokens", tokens);
+    cmd.get_cmd_line_argument("experts", experts);
+    cmd.get_cmd_line_argument("topk", topk);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("alpha", alpha, 1.0f);
+    cmd.get_cmd_line_argument("beta",  beta,  0.0f);
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "69_hopper_moe_gather_scatter_grouped_gemm\n\n"
+      << "  Hopper Grouped GEMM for MoE experts with fused token gather and output scatter.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --tokens=<int>              Number of tokens, rows of the activations\n"
+      << "  --experts=<int>             Number of experts, one group each\n"
+      << "  --topk=<int>                Number of experts each token is routed to\n"
+      << "  --n=<int>                   Sets the N extent of the expert weights\n"
+      << "  --k=<int>                   Sets the K extent of the activations and expert weights\n"
+      << "  --alpha=<f32>               Epilogue scalar alpha\n"
+      << "  --beta=<f32>                Epilogue scalar beta\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "69_hopper_moe_gather_scatter_grouped_gemm" << " --tokens=4096 --experts=8 --topk=2 --n=2048 --k=1024\n\n";
+
+    return out;
+  }
+
+  /// Compute performance in GFLOP/s
+  double gflops(double runtime_s) const
+  {
+    // Two flops per multiply-add
+    uint64_t flop = uint64_t(2) * uint64_t(tokens) * uint64_t(topk) * uint64_t(n) * uint64_t(k);
+    double gflop = double(flop) / double(1.0e9);
+    return gflop / runtime_s;
+  }
+};
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms = 0.0;
+  double gflops = 0.0;
+  cutlass::Status status = cutlass::Status::kSuccess;
+  cudaError_t error = cudaSuccess;
+  bool passed = false;
+};
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Helper to initialize a block of device data with small integers, so that the result is exact
+template <class Element>
+bool initialize_block(
+  cutlass::DeviceAllocation<Element>& block,
+  uint64_t seed=2023) {
+
+  Element scope_max = static_cast<Element>(2);
+  Element scope_min = static_cast<Element>(-2);
+
+  cutlass::reference::device::BlockFillRandomUniform(
+    block.get(), block.size(), seed, scope_max, scope_min, 0);
+
+  return true;
+}
+
+/// Routes every token to topk experts and builds the per expert gather and scatter indices
+void route(const Options &options) {
+  int assignments = options.tokens * options.topk;
+  std::vector<int> expert_of(assignments);
+  for (int a = 0; a < assignments; ++a) {
+    expert_of.at(a) = rand() % options.experts;
+  }
+
+  for (int e = 0; e < options.experts; ++e) {
+    int64_t offset = static_cast<int64_t>(gather_host.size());
+    for (int a = 0; a < assignments; ++a) {
+      if (expert_of.at(a) == e) {
+        gather_host.push_back(a / options.topk);
+        scatter_host.push_back(a);
+      }
+    }
+    int rows = static_cast<int>(gather_host.size() - offset);
+    // Experts without tokens are left out of the grouped problem
+    if (rows > 0) {
+      expert_host.push_back(e);
+      offset_rows.push_back(offset);
+      problem_sizes_host.push_back({rows, options.n, options.k});
+    }
+  }
+}
+
+/// Allocates and initializes the operands used in the GEMM and reference GEMM
+void initialize(const Options &options) {
+
+  uint64_t seed = 2020;
+  int groups = static_cast<int>(problem_sizes_host.size());
+  int64_t assignments = static_cast<int64_t>(options.tokens) * options.topk;
+
+  block_X.reset(static_cast<int64_t>(options.tokens) * options.k);
+  block_W.reset(static_cast<int64_t>(options.experts) * options.n * options.k);
+  block_C.reset(assignments * options.n);
+  block_Y.reset(assignments * options.n);
+  block_gather.reset(assignments);
+  block_gather.copy_from_host(gather_host.data());
+  block_scatter.reset(assignments);
+  block_scatter.copy_from_host(scatter_host.data());
+
+  problem_sizes.reset(groups);
+  problem_sizes.copy_from_host(problem_sizes_host.data());
+
+  //
+  // Assign pointers. All experts gather from the same activations and scatter to the same output.
+  //
+
+  std::vector<const ElementA *> ptr_A_host(groups);
+  std::vector<const ElementB *> ptr_B_host(groups);
+  std::vector<const ElementC *> ptr_C_host(groups);
+  std::vector<ElementC *> ptr_D_host(groups);
+  std::vector<const int32_t *> ptr_gather_host(groups);
+  std::vector<const int32_t *> ptr_scatter_host(groups);
+  std::vector<StrideA> stride_A_host;
+  std::vector<StrideB> stride_B_host;
+  std::vector<StrideC> stride_C_host;
+  std::vector<StrideD> stride_D_host;
+
+  for (int32_t i = 0; i < groups; ++i) {
+    ptr_A_host.at(i) = block_X.get();
+    ptr_B_host.at(i) = block_W.get() + static_cast<int64_t>(expert_host.at(i)) * options.n * options.k;
+    ptr_C_host.at(i) = block_C.get();
+    ptr_D_host.at(i) = block_Y.get();
+    ptr_gather_host.at(i) = block_gather.get() + offset_rows.at(i);
+    ptr_scatter_host.at(i) = block_scatter.get() + offset_rows.at(i);
+
+    stride_A_host.push_back(cutlass::make_cute_packed_stride(StrideA{}, {options.tokens, options.k, 1}));
+    stride_B_host.push_back(cutlass::make_cute_packed_stride(StrideB{}, {options.n, options.k, 1}));
+    stride_C_host.push_back(cutlass::make_cute_packed_stride(StrideC{}, {static_cast<int>(assignments), options.n, 1}));
+    stride_D_host.push_back(cutlass::make_cute_packed_stride(StrideD{}, {static_cast<int>(assignments), options.n, 1}));
+  }
+
+  ptr_A.reset(groups);
+  ptr_A.copy_from_host(ptr_A_host.data());
+
+  ptr_B.reset(groups);
+  ptr_B.copy_from_host(ptr_B_host.data());
+
+  ptr_C.reset(groups);
+  ptr_C.copy_from_host(ptr_C_host.data());
+
+  ptr_D.reset(groups);
+  ptr_D.copy_from_host(ptr_D_host.data());
+
+  ptr_gather.reset(groups);
+  ptr_gather.copy_from_host(ptr_gather_host.data());
+
+  ptr_scatter.reset(groups);
+  ptr_scatter.copy_from_host(ptr_scatter_host.data());
+
+  stride_A.reset(groups);
+  stride_A.copy_from_host(stride_A_host.data());
+
+  stride_B.reset(groups);
+  stride_B.copy_from_host(stride_B_host.data());
+
+  stride_C.reset(groups);
+  stride_C.copy_from_host(stride_C_host.data());
+
+  stride_D.reset(groups);
+  stride_D.copy_from_host(stride_D_host.data());
+
+  initialize_block(block_X, seed + 2023);
+  initialize_block(block_W, seed + 2022);
+  initialize_block(block_C, seed + 2021);
+}
+
+/// Populates a Gemm::Arguments structure from the given commandline options
+typename Gemm::Arguments args_from_options(const Options &options)
+{
+  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
+  // to use a GPU other than that with device ID 0.
+  int device_id = 0;
+  cutlass::KernelHardwareInfo kernel_hw_info = cutlass::KernelHardwareInfo::make_kernel_hardware_info<Gemm::GemmKernel>(device_id);
+
+  int groups = static_cast<int>(problem_sizes_host.size());
+
+  typename Gemm::Arguments arguments {
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {groups, problem_sizes.get(), problem_sizes_host.data()},
+    {ptr_A.get(), stride_A.get(), ptr_B.get(), stride_B.get(), ptr_gather.get()},
+    {{options.alpha, options.beta}, ptr_C.get(), stride_C.get(), ptr_D.get(), stride_D.get(), ptr_scatter.get()},
+    kernel_hw_info
+  };
+
+  return arguments;
+}
+
+/// Permutes rows on the host: dst row i is src row index[i]
+template <class Element>
+std::vector<Element> gather_rows(std::vector<Element> const& src, std::vector<int32_t> const& index, int columns) {
+  std::vector<Element> dst(index.size() * columns);
+  for (size_t i = 0; i < index.size(); ++i) {
+    std::copy_n(src.begin() + static_cast<int64_t>(index.at(i)) * columns, columns, dst.begin() + static_cast<int64_t>(i) * columns);
+  }
+  return dst;
+}
+
+bool verify(const Options &options) {
+  int64_t assignments = static_cast<int64_t>(options.tokens) * options.topk;
+
+  // Build the expert-contiguous operands a separate permute kernel would produce
+  std::vector<ElementA> X_host(block_X.size());
+  std::vector<ElementC> C_host(block_C.size());
+  std::vector<ElementC> Y_host(block_Y.size());
+  block_X.copy_to_host(X_host.data());
+  block_C.copy_to_host(C_host.data());
+  block_Y.copy_to_host(Y_host.data());
+
+  cutlass::DeviceAllocation<ElementA> block_X_perm(assignments * options.k);
+  cutlass::DeviceAllocation<ElementC> block_C_perm(assignments * options.n);
+  cutlass::DeviceAllocation<ElementC> block_D_perm(assignments * options.n);
+  block_X_perm.copy_from_host(gather_rows(X_host, gather_host, options.k).data());
+  block_C_perm.copy_from_host(gather_rows(C_host, scatter_host, options.n).data());
+
+  for (size_t i = 0; i < problem_sizes_host.size(); ++i) {
+    auto problem = problem_sizes_host.at(i);
+    auto M = get<0>(problem);
+    auto N = get<1>(problem);
+    auto K = get<2>(problem);
+    cutlass::TensorRef ref_A(block_X_perm.get() + offset_rows.at(i) * K, Gemm::LayoutA::packed({M, K}));
+    cutlass::TensorRef ref_B(block_W.get() + static_cast<int64_t>(expert_host.at(i)) * N * K, Gemm::LayoutB::packed({K, N}));
+    cutlass::TensorRef ref_C(block_C_perm.get() + offset_rows.at(i) * N, Gemm::LayoutC::packed({M, N}));
+    cutlass::TensorRef ref_D(block_D_perm.get() + offset_rows.at(i) * N, Gemm::LayoutD::packed({M, N}));
+
+    // Create instantiation for device reference gemm kernel
+    DeviceGemmReference gemm_reference;
+
+    // Launch device reference gemm kernel
+    gemm_reference(
+      {M, N, K},
+      ElementAccumulator(options.alpha),
+      ref_A,
+      ref_B,
+      ElementAccumulator(options.beta),
+      ref_C,
+      ref_D);
+  }
+
+  // Wait for kernels to finish
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Undo the permutation a separate unpermute kernel would perform, then compare
+  std::vector<ElementC> D_perm_host(block_D_perm.size());
+  block_D_perm.copy_to_host(D_perm_host.data());
+  std::vector<ElementC> ref_Y_host(Y_host.size());
+  for (size_t i = 0; i < scatter_host.size(); ++i) {
+    std::copy_n(D_perm_host.begin() + static_cast<int64_t>(i) * options.n, options.n,
+                ref_Y_host.begin() + static_cast<int64_t>(scatter_host.at(i)) * options.n);
+  }
+
+  return ref_Y_host == Y_host;
+}
+
+/// Execute the MoE expert GEMM
+int run(Options &options)
+{
+  route(options);
+  initialize(options);
+
+  // Instantiate CUTLASS kernel depending on templates
+  Gemm gemm;
+
+  // Create a structure of gemm kernel arguments suitable for invoking an instance of Gemm
+  auto arguments = args_from_options(options);
+
+  // Using the arguments, query for extra workspace required for matrix multiplication computation
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+
+  // Allocate workspace memory
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(gemm.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  Result result;
+  result.passed = verify(options);
+
+  std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+  if (!result.passed) {
+    exit(-1);
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0)
+  {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+      CUTLASS_CHECK(gemm.run());
+    }
+    timer.stop();
+
+    // Compute average setup and runtime and GFLOPs.
+    float elapsed_ms       = timer.elapsed_millis();
+    result.avg_runtime_ms  = double(elapsed_ms) / double(options.iterations);
+    result.gflops          = options.gflops(result.avg_runtime_ms / 1000.0);
+
+    std::cout << "  Tokens x TopK: " << options.tokens << " x " << options.topk << std::endl;
+    std::cout << "  Experts      : " << options.experts << " (" << problem_sizes_host.size() << " with tokens)" << std::endl;
+    std::cout << "  N x K        : " << options.n << " x " << options.k << std::endl;
+    std::cout << "  Avg runtime  : " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  GFLOPS       : " << result.gflops << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.3 Toolkit to run this example
+  if (__CUDACC_VER_MAJOR__ < 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ < 3)) {
+    std::cerr << "This example requires CUDA 12.3 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major < 9) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture or "
+      << "later (compute capability 90 or greater).\n";
+    return 0;
+  }
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+  run(options);
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
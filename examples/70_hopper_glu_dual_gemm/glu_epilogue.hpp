@@ -0,0 +1,274 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Epilogue for a gated (GLU) dual GEMM whose gate and up accumulators share one CTA tile.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/detail.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+
+#include "cute/tensor.hpp"
+#include "cute/numeric/numeric_types.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::thread {
+
+/// Applies a gated activation to a pair of accumulators.
+///
+/// D = activation(gate) * up
+///
+template <
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementAccumulator_ = float,
+  class ElementCompute_ = float,
+  FloatRoundStyle Round = FloatRoundStyle::round_to_nearest
+>
+class GatedActivation {
+public:
+
+  using ElementOutput = ElementOutput_;
+  using ElementD = ElementOutput_;
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementCompute = ElementCompute_;
+  using ActivationFn = ActivationFn_<ElementCompute>;
+
+  static int const kCount = 1;
+  static FloatRoundStyle const kRound = Round;
+
+  struct Params{};
+
+  CUTLASS_HOST_DEVICE
+  GatedActivation(Params const &/*params*/ = {}) {}
+
+  CUTLASS_HOST_DEVICE
+  ElementOutput operator()(ElementAccumulator const& gate, ElementAccumulator const& up) const {
+    NumericConverter<ElementCompute, ElementAccumulator, Round> accumulator_to_compute;
+    NumericConverter<ElementOutput, ElementCompute, Round> compute_to_output;
+    ActivationFn activation;
+    cutlass::multiplies<ElementCompute> mul;
+    return compute_to_output(mul(activation(accumulator_to_compute(gate)), accumulator_to_compute(up)));
+  }
+};
+
+} // namespace cutlass::epilogue::thread
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::collective {
+
+/// Stores D = activation(gate) * up for a dual GEMM that computes the gate and up projections
+/// of the same A tile in a single CTA tile.
+///
+/// The mainloop runs over weights that interleave the gate and up projections per CTA tile:
+/// rows [t * BLK_N, t * BLK_N + BLK_N / 2) of B hold gate rows [t * BLK_N / 2, (t + 1) * BLK_N / 2),
+/// and the following BLK_N / 2 rows hold the same up rows. Its tiled MMA uses an atom of N extent
+/// BLK_N / 2, so that mode 2 of the accumulators selects the gate (0) or up (1) projection and both
+/// halves are partitioned identically.
+///
+/// The GEMM problem shape therefore has N = 2 * (output columns), and D has N / 2 columns.
+template <
+  class CtaTileShapeMNK_,
+  class StrideD_,
+  class ThreadEpilogueOp_,
+  class EpilogueSchedule_
+>
+class EpilogueGatedDualGemm {
+public:
+  //
+  // Type Aliases
+  //
+  using EpilogueSchedule = EpilogueSchedule_;
+  using DispatchPolicy = EpilogueSchedule_;
+  using CtaTileShapeMNK = CtaTileShapeMNK_;
+
+  // derived types of output thread level operator
+  using ThreadEpilogueOp = ThreadEpilogueOp_;
+  using ElementOutput = typename ThreadEpilogueOp::ElementOutput;
+  using ElementAccumulator = typename ThreadEpilogueOp::ElementAccumulator;
+  using ElementCompute = typename ThreadEpilogueOp::ElementCompute;
+  using ElementScalar = ElementCompute;
+  using ElementD = typename ThreadEpilogueOp::ElementD;
+  using StrideD = StrideD_;
+  // There is no source operand, C only mirrors D for the kernel interface
+  using ElementC = ElementD;
+  using StrideC = StrideD;
+
+  using GmemTiledCopyC = void;
+  using GmemTiledCopyD = void;
+
+  static constexpr int HalfTileN = cute::size<1>(CtaTileShapeMNK{}) / 2;
+
+  static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]");
+  static_assert(cute::size<1>(CtaTileShapeMNK{}) % 2 == 0, "CTA tile N must hold whole gate and up halves");
+
+  struct SharedStorage { };
+
+  using TensorStorage = SharedStorage;
+
+  // Host side epilogue arguments
+  struct Arguments {
+    typename ThreadEpilogueOp::Params thread{};
+    ElementD* ptr_D = nullptr;
+    StrideD dD{};
+  };
+
+  // Device side epilogue params
+  using Params = Arguments;
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(
+      [[maybe_unused]] ProblemShape const& _,
+      Arguments const& args,
+      [[maybe_unused]] void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      [[maybe_unused]] Arguments const& args) {
+    // Each CTA tile must hold matching gate and up halves
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return cute::get<1>(problem_shape_MNKL) % cute::size<1>(CtaTileShapeMNK{}) == 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  EpilogueGatedDualGemm(Params const& params_, SharedStorage const& shared_storage = SharedStorage())
+      : params(params_), epilogue_op(params_.thread) { }
+
+  CUTLASS_DEVICE
+  bool
+  is_source_needed() {
+    return false;
+  }
+
+  template<
+    class ProblemShapeMNKL,
+    class BlockShapeMNK,
+    class BlockCoordMNKL,
+    class FrgEngine, class FrgLayout,
+    class TiledMma,
+    class ResidueMNK
+  >
+  CUTLASS_HOST_DEVICE void
+  operator()(
+      ProblemShapeMNKL problem_shape_mnkl,
+      BlockShapeMNK blk_shape_MNK,
+      BlockCoordMNKL blk_coord_mnkl,
+      cute::Tensor<FrgEngine, FrgLayout> const& accumulators,
+      TiledMma tiled_mma,
+      ResidueMNK residue_mnk,
+      int thread_idx,
+      [[maybe_unused]] char* smem_buf)
+  {
+    using namespace cute;
+    using X = Underscore;
+
+    static_assert(cute::rank(ProblemShapeMNKL{}) == 4, "ProblemShapeMNKL must be rank 4");
+    static_assert(is_static<BlockShapeMNK>::value, "ThreadBlock tile shape must be static");
+    static_assert(cute::rank(BlockShapeMNK{}) == 3, "BlockShapeMNK must be rank 3");
+    static_assert(cute::rank(BlockCoordMNKL{}) == 4, "BlockCoordMNKL must be rank 3");
+    static_assert(is_static<FrgLayout>::value, "Accumulator layout must be static");
+    CUTE_STATIC_ASSERT_V(size<2>(accumulators) == Int<2>{},
+        "Tiled MMA must split the CTA tile N into a gate and an up half.");
+
+    // Separate out problem shape for convenience, D has half the columns of the GEMM
+    auto M = get<0>(problem_shape_mnkl);
+    auto N = get<1>(problem_shape_mnkl) / 2;
+    auto L = get<3>(problem_shape_mnkl);
+
+    auto stride_d = detail::get_epilogue_stride<EpilogueSchedule>(params.dD);
+
+    // Represent the full output tensor, tiled by the output half of the CTA tile
+    auto blk_shape_D = make_shape(get<0>(blk_shape_MNK), Int<HalfTileN>{}, get<2>(blk_shape_MNK));
+    Tensor mD_mnl = make_tensor(make_gmem_ptr(params.ptr_D), make_shape(M,N,L), stride_d);              // (m,n,l)
+    Tensor gD_mnl = local_tile(mD_mnl, blk_shape_D, make_coord(_,_,_), Step<_1,_1, X>{}); // (BLK_M,BLK_N/2,m,n,l)
+
+    // Slice to get the tile this CTA is responsible for
+    auto [m_coord, n_coord, k_coord, l_coord] = blk_coord_mnkl;
+    Tensor gD = gD_mnl(_,_,m_coord,n_coord,l_coord);                                               // (BLK_M,BLK_N/2)
+
+    // Partition the destination tile like one half of the accumulators
+    auto thr_mma = tiled_mma.get_thread_slice(thread_idx);
+    Tensor tCgD = thr_mma.partition_C(gD)(_,_,0);                                           // (VEC,THR_M)
+    Tensor tCrGate = accumulators(_,_,0);                                                   // (VEC,THR_M)
+    Tensor tCrUp = accumulators(_,_,1);                                                     // (VEC,THR_M)
+
+    CUTE_STATIC_ASSERT_V(size(tCgD) == size(tCrGate),
+        "Accumulator half count must have the same destination element count.");
+
+    // Make an identity coordinate tensor for predicating our output MN tile
+    auto cD = make_identity_tensor(make_shape(unwrap(shape<0>(gD)), unwrap(shape<1>(gD))));
+    Tensor tCcD = thr_mma.partition_C(cD)(_,_,0);
+    auto residue_D = make_coord(get<0>(residue_mnk), N - n_coord * HalfTileN);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(tCrGate); ++i) {
+      if (elem_less(tCcD(i), residue_D)) {
+        tCgD(i) = epilogue_op(tCrGate(i), tCrUp(i));
+      }
+    }
+  }
+
+private:
+  Params params;
+  ThreadEpilogueOp epilogue_op;
+};
+
+} // namespace cutlass::epilogue::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
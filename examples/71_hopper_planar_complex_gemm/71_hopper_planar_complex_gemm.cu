@@ -0,0 +1,477 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Hopper planar complex GEMM using the CUTLASS 3.x warp-specialized kernels.
+
+    Complex GEMMs on Hopper cannot use GMMA directly, since GMMA only multiplies real operands.
+    This example computes a planar complex GEMM (CGEMM with TF32 tensor cores)
+
+      D = alpha * conj(A) * B + beta * C
+
+    by running an ordinary real GMMA mainloop over a real-expanded tile: the real and imaginary
+    planes of A are stacked along M and those of B along N in shared memory, so each CTA computes
+    the four real partial products Ar*Br, Ar*Bi, Ai*Br and Ai*Bi of its complex tile at once. The
+    planar complex epilogue then recombines them, applies the conjugation of A, and scales by the
+    complex alpha and beta.
+
+    Consequently the kernel is given the real-expanded problem shape (2*M, 2*N, K, L), and the
+    collective builder is given the complex tile shape. A and B must be planar (separate real and
+    imaginary planes with a common stride) since TMA reads unit-stride rows; C and D may be planar
+    or interleaved.
+
+    Examples:
+
+      $ ./examples/71_hopper_planar_complex_gemm/71_hopper_planar_complex_gemm --m=2048 --n=2048 --k=2048
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/complex.h"
+#include "cutlass/tensor_ref_planar_complex.h"
+#include "cutlass/epilogue/collective/collective_epilogue.hpp"
+#include "cutlass/epilogue/thread/linear_combination_planar_complex.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm_planar_complex.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A matrix configuration
+using         ElementA    = float;                                          // Element type of the real and imaginary planes of A
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for A matrix operand
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Memory access granularity/alignment of A matrix in units of elements (up to 16 bytes)
+constexpr cutlass::ComplexTransform TransformA = cutlass::ComplexTransform::kConjugate;
+
+// B matrix configuration
+using         ElementB    = float;                                          // Element type of the real and imaginary planes of B
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B matrix operand
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Memory access granularity/alignment of B matrix in units of elements (up to 16 bytes)
+constexpr cutlass::ComplexTransform TransformB = cutlass::ComplexTransform::kNone;
+
+// C/D matrix configuration
+using         ElementC    = float;                                          // Element type of the real and imaginary planes of C and D
+using         LayoutC     = cutlass::layout::ColumnMajor;                   // Layout type for C and D matrix operands
+
+// Core kernel configurations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+using TileShape           = Shape<_128,_64,_32>;                            // Complex tile size, the CTA computes a 256x128 real tile
+using ClusterShape        = Shape<_1,_2,_1>;                                // Shape of the threadblocks in a cluster
+using KernelSchedule      = cutlass::gemm::KernelTmaWarpSpecializedCooperativePlanarComplex;
+
+using StrideC = cutlass::detail::TagToStrideC_t<LayoutC>;
+
+using CollectiveEpilogue = cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+    cutlass::epilogue::collective::DefaultEpiloguePlanarComplex<
+      ElementC,
+      StrideC,
+      StrideC,
+      cutlass::epilogue::thread::LinearCombinationPlanarComplex<ElementC, 1, ElementAccumulator, ElementAccumulator>,
+      cutlass::gemm::EpilogueDefault,
+      TransformA,
+      TransformB>>;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementA, LayoutA, AlignmentA,
+    ElementB, LayoutB, AlignmentB,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAuto,
+    KernelSchedule
+  >::CollectiveOp;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>, // Indicates ProblemShape, real-expanded (2*M, 2*N, K, L)
+    CollectiveMainloop,
+    CollectiveEpilogue
+>;
+
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+using StrideA = typename Gemm::GemmKernel::StrideA;
+using StrideB = typename Gemm::GemmKernel::StrideB;
+using StrideD = typename Gemm::GemmKernel::StrideD;
+
+//
+// Data members
+//
+
+/// Initialization
+StrideA stride_A;
+StrideB stride_B;
+StrideC stride_C;
+StrideD stride_D;
+uint64_t seed = 2024;
+
+// Each block holds the real plane followed by the imaginary plane of every batch
+cutlass::DeviceAllocation<ElementA> block_A;
+cutlass::DeviceAllocation<ElementB> block_B;
+cutlass::DeviceAllocation<ElementC> block_C;
+cutlass::DeviceAllocation<ElementC> block_D;
+cutlass::DeviceAllocation<ElementC> block_ref_D;
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+
+  cutlass::complex<float> alpha, beta;
+  int iterations;
+  int m, n, k, l;
+
+  Options():
+    help(false),
+    m(4096), n(4096), k(4096), l(1),
+    alpha(1.f), beta(0.f),
+    iterations(1000)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("l", l);
+
+    float alpha_r, alpha_i, beta_r, beta_i;
+    cmd.get_cmd_line_argument("alpha", alpha_r, 1.f);
+    cmd.get_cmd_line_argument("alpha_i", alpha_i, 0.f);
+    cmd.get_cmd_line_argument("beta", beta_r, 0.f);
+    cmd.get_cmd_line_argument("beta_i", beta_i, 0.f);
+    alpha = {alpha_r, alpha_i};
+    beta = {beta_r, beta_i};
+
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "71_hopper_planar_complex_gemm\n\n"
+      << "  Hopper planar complex TF32 GEMM (D = alpha * conj(A) * B + beta * C) using a Warp Specialized kernel.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM\n"
+      << "  --k=<int>                   Sets the K extent of the GEMM\n"
+      << "  --l=<int>                   Sets the batch count of the GEMM\n"
+      << "  --alpha=<f32>               Real part of the epilogue scalar alpha\n"
+      << "  --alpha_i=<f32>             Imaginary part of the epilogue scalar alpha\n"
+      << "  --beta=<f32>                Real part of the epilogue scalar beta\n"
+      << "  --beta_i=<f32>              Imaginary part of the epilogue scalar beta\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "71_hopper_planar_complex_gemm" << " --m=1024 --n=512 --k=1024 --alpha=2 --beta=0.707 --beta_i=0.707 \n\n";
+
+    return out;
+  }
+
+  /// Compute performance in GFLOP/s
+  double gflops(double runtime_s) const
+  {
+    // Eight real flops per complex multiply-add
+    uint64_t flop = uint64_t(8) * m * n * k * l;
+    double gflop = double(flop) / double(1.0e9);
+    return gflop / runtime_s;
+  }
+};
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms;
+  double gflops;
+  cutlass::Status status;
+  cudaError_t error;
+  bool passed;
+
+  Result(
+    double avg_runtime_ms = 0,
+    double gflops = 0,
+    cutlass::Status status = cutlass::Status::kSuccess,
+    cudaError_t error = cudaSuccess)
+  :
+    avg_runtime_ms(avg_runtime_ms), gflops(gflops), status(status), error(error), passed(false)
+  {}
+
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Helper to initialize a block of device data with small integers, which are exact in TF32
+template <class Element>
+bool initialize_block(
+  cutlass::DeviceAllocation<Element>& block,
+  uint64_t seed=2023) {
+
+  cutlass::reference::device::BlockFillRandomUniform(
+    block.get(), block.size(), seed, Element(4), Element(-4), 0);
+
+  return true;
+}
+
+/// Initialize operands to be used in the GEMM and reference GEMM
+void initialize(const Options &options) {
+
+  stride_A = cutlass::make_cute_packed_stride(StrideA{}, {options.m, options.k, options.l});
+  stride_B = cutlass::make_cute_packed_stride(StrideB{}, {options.n, options.k, options.l});
+  stride_C = cutlass::make_cute_packed_stride(StrideC{}, {options.m, options.n, options.l});
+  stride_D = cutlass::make_cute_packed_stride(StrideD{}, {options.m, options.n, options.l});
+
+  block_A.reset(size_t(2) * options.m * options.k * options.l);
+  block_B.reset(size_t(2) * options.k * options.n * options.l);
+  block_C.reset(size_t(2) * options.m * options.n * options.l);
+  block_D.reset(size_t(2) * options.m * options.n * options.l);
+  block_ref_D.reset(size_t(2) * options.m * options.n * options.l);
+
+  initialize_block(block_A, seed + 2023);
+  initialize_block(block_B, seed + 2022);
+  initialize_block(block_C, seed + 2021);
+}
+
+/// Populates a Gemm::Arguments structure from the given commandline options
+typename Gemm::Arguments args_from_options(const Options &options)
+{
+  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
+  // to use a GPU other than that with device ID 0.
+  int device_id = 0;
+  cutlass::KernelHardwareInfo kernel_hw_info = cutlass::KernelHardwareInfo::make_kernel_hardware_info<Gemm::GemmKernel>(device_id);
+
+  // The imaginary plane of each operand follows its real plane
+  size_t plane_A = size_t(options.m) * options.k * options.l;
+  size_t plane_B = size_t(options.n) * options.k * options.l;
+  size_t plane_C = size_t(options.m) * options.n * options.l;
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {2 * options.m, 2 * options.n, options.k, options.l},
+    {block_A.get(), block_A.get() + plane_A, stride_A,
+     block_B.get(), block_B.get() + plane_B, stride_B},
+    {{options.alpha, options.beta},
+     block_C.get(), block_C.get() + plane_C, stride_C,
+     block_D.get(), block_D.get() + plane_C, stride_D},
+    kernel_hw_info
+  };
+
+  return arguments;
+}
+
+bool verify(const Options &options) {
+  size_t plane_A = size_t(options.m) * options.k * options.l;
+  size_t plane_B = size_t(options.n) * options.k * options.l;
+  size_t plane_C = size_t(options.m) * options.n * options.l;
+
+  int64_t batch_stride_A = int64_t(options.m) * options.k;
+  int64_t batch_stride_B = int64_t(options.n) * options.k;
+  int64_t batch_stride_C = int64_t(options.m) * options.n;
+
+  //
+  // Compute reference output
+  //
+
+  for (int batch = 0; batch < options.l; ++batch) {
+    cutlass::reference::device::GemmPlanarComplex<
+      ElementA, LayoutA,
+      ElementB, LayoutB,
+      ElementC, LayoutC,
+      ElementAccumulator
+    >(
+      {options.m, options.n, options.k},
+      options.alpha,
+      {block_A.get() + batch * batch_stride_A, LayoutA::packed({options.m, options.k}), int64_t(plane_A)},
+      TransformA,
+      {block_B.get() + batch * batch_stride_B, LayoutB::packed({options.k, options.n}), int64_t(plane_B)},
+      TransformB,
+      options.beta,
+      {block_C.get() + batch * batch_stride_C, LayoutC::packed({options.m, options.n}), int64_t(plane_C)},
+      {block_ref_D.get() + batch * batch_stride_C, LayoutC::packed({options.m, options.n}), int64_t(plane_C)}
+    );
+  }
+
+  // Wait for kernel to finish
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Integer inputs make the TF32 products exact, so both planes must match exactly
+  bool passed = cutlass::reference::device::BlockCompareEqual(block_ref_D.get(), block_D.get(), block_D.size());
+
+  return passed;
+}
+
+/// Execute a given example GEMM computation
+template <typename Gemm>
+int run(Options &options)
+{
+  initialize(options);
+
+  // Instantiate CUTLASS kernel depending on templates
+  Gemm gemm;
+
+  // Create a structure of gemm kernel arguments suitable for invoking an instance of Gemm
+  auto arguments = args_from_options(options);
+
+  // Using the arguments, query for extra workspace required for matrix multiplication computation
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+
+  // Allocate workspace memory
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(gemm.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  Result result;
+  result.passed = verify(options);
+
+  std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+  if (!result.passed) {
+    exit(-1);
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0)
+  {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(gemm.run());
+    }
+    timer.stop();
+
+    // Compute average runtime and GFLOPs.
+    float elapsed_ms = timer.elapsed_millis();
+    result.avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+    result.gflops = options.gflops(result.avg_runtime_ms / 1000.0);
+
+    std::cout << "  Problem Size: " << options.m << 'x' << options.n << 'x' << options.k << 'x' << options.l << std::endl;
+    std::cout << "  Avg runtime: " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  GFLOPS: " << result.gflops << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major < 9) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture or "
+      << "later (compute capability 90 or greater).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  run<Gemm>(options);
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,648 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief FP64 GEMM emulated on INT8 tensor cores with the Ozaki scheme.
+
+    INT8 tensor cores have many times the throughput of the FP64 tensor cores, and integer
+    products accumulated in INT32 are exact. This example computes the double precision GEMM
+
+      D = alpha * A * B + beta * C
+
+    by splitting each operand into INT8 slices and recombining exact integer partial products:
+
+      1. Split. Every row of A (and column of B) is scaled by a power of two 2^-e so that its
+         largest magnitude is below one, then cut into S signed 7-bit digits:
+
+           A[i,k] = 2^e_i * sum_p A_p[i,k] * 2^-7(p+1)      (truncated after S slices)
+
+         Scaling by powers of two and peeling off integer parts are exact in FP64.
+
+      2. Multiply. The products A_p * B_q with p + q < S are the only ones that contribute above
+         the truncation error. They are computed by one grouped INT8 GEMM with INT32 accumulation:
+         group p multiplies A_p by the slices B_0 .. B_{S-1-p}, which are stored side by side so
+         that each group is a single GEMM of extent M x (S-p)*N x K.
+
+      3. Recombine. A fused epilogue kernel sums the products of each anti-diagonal p + q = d
+         exactly in INT64, scales the diagonals by 2^-7(d+2) from the smallest upwards, undoes the
+         row and column scaling and applies alpha and beta.
+
+    The INT32 accumulators are exact as long as K * 127^2 < 2^31, i.e. K <= 133143. Seven slices
+    carry 49 mantissa bits per operand; eight slices exceed the 53 bits of FP64.
+
+    The example verifies the result against a reference FP64 GEMM and, for comparison, times a
+    CUTLASS FP64 tensor core GEMM on the same problem.
+
+    Examples:
+
+      $ ./examples/72_ampere_ozaki_fp64_gemm/72_ampere_ozaki_fp64_gemm --m=4096 --n=4096 --k=4096 --slices=7
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/device/gemm.h"
+#include "cutlass/gemm/device/gemm_grouped.h"
+#include "cutlass/gemm/kernel/default_gemm_grouped.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// INT8 grouped GEMM computing the slice products
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Slices of A are row-major and slices of B column-major so both are K-major for the INT8 MMA.
+using ElementSlice = int8_t;
+using ElementProduct = int32_t;
+using LayoutSliceA = cutlass::layout::RowMajor;
+using LayoutSliceB = cutlass::layout::ColumnMajor;
+using LayoutProduct = cutlass::layout::RowMajor;
+
+constexpr int kAlignmentSlice = 128 / cutlass::sizeof_bits<ElementSlice>::value;          // 16
+constexpr int kAlignmentProduct = 128 / cutlass::sizeof_bits<ElementProduct>::value;      // 4
+
+using SliceGemmKernel = typename cutlass::gemm::kernel::DefaultGemmGrouped<
+  ElementSlice, LayoutSliceA, cutlass::ComplexTransform::kNone, kAlignmentSlice,
+  ElementSlice, LayoutSliceB, cutlass::ComplexTransform::kNone, kAlignmentSlice,
+  ElementProduct, LayoutProduct,
+  ElementProduct,
+  cutlass::arch::OpClassTensorOp,
+  cutlass::arch::Sm80,
+  cutlass::gemm::GemmShape<128, 128, 64>,
+  cutlass::gemm::GemmShape<64, 64, 64>,
+  cutlass::gemm::GemmShape<16, 8, 32>,
+  cutlass::epilogue::thread::LinearCombination<
+    ElementProduct, kAlignmentProduct, ElementProduct, ElementProduct>,
+  // Threadblock swizzling is not used by the grouped kernels
+  cutlass::gemm::threadblock::GemmBatchedIdentityThreadblockSwizzle,
+  3>::GemmKernel;
+
+using SliceGemm = cutlass::gemm::device::GemmGrouped<SliceGemmKernel>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// FP64 tensor core GEMM used as the performance baseline
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using LayoutA = cutlass::layout::RowMajor;
+using LayoutB = cutlass::layout::ColumnMajor;
+using LayoutC = cutlass::layout::RowMajor;
+
+using DgemmBaseline = cutlass::gemm::device::Gemm<
+  double, LayoutA,
+  double, LayoutB,
+  double, LayoutC,
+  double,
+  cutlass::arch::OpClassTensorOp,
+  cutlass::arch::Sm80,
+  cutlass::gemm::GemmShape<64, 64, 16>,
+  cutlass::gemm::GemmShape<32, 32, 16>,
+  cutlass::gemm::GemmShape<8, 8, 4>,
+  cutlass::epilogue::thread::LinearCombination<double, 1, double, double>,
+  cutlass::gemm::threadblock::GemmIdentityThreadblockSwizzle<>,
+  4>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Split and recombination kernels
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Number of bits carried by one signed INT8 slice
+constexpr int kSliceBits = 7;
+
+// Largest K for which K * 127^2 fits the INT32 accumulator
+constexpr int kMaxExactK = 133143;
+
+/// Splits each of `rows` contiguous vectors of length k into INT8 slices. Slice p of vector r is
+/// written to slices[p * slice_stride + r * k_pad + kk]; exponents[r] receives the vector's scale.
+template <int kThreads>
+__global__ void ozaki_split(
+  double const *src,
+  int rows,
+  int k,
+  int64_t ld,
+  int num_slices,
+  ElementSlice *slices,
+  int64_t slice_stride,
+  int k_pad,
+  int *exponents) {
+
+  __shared__ double smem_max[kThreads];
+
+  int row = blockIdx.x;
+  if (row >= rows) {
+    return;
+  }
+
+  double const *vec = src + row * ld;
+
+  double local_max = 0;
+  for (int kk = threadIdx.x; kk < k; kk += kThreads) {
+    local_max = fmax(local_max, fabs(vec[kk]));
+  }
+  smem_max[threadIdx.x] = local_max;
+  __syncthreads();
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int offset = kThreads / 2; offset > 0; offset /= 2) {
+    if (threadIdx.x < offset) {
+      smem_max[threadIdx.x] = fmax(smem_max[threadIdx.x], smem_max[threadIdx.x + offset]);
+    }
+    __syncthreads();
+  }
+
+  // max = f * 2^e with f in [0.5, 1), so every scaled element lies in (-1, 1)
+  int e;
+  frexp(smem_max[0], &e);
+  if (threadIdx.x == 0) {
+    exponents[row] = e;
+  }
+
+  ElementSlice *dst = slices + int64_t(row) * k_pad;
+  for (int kk = threadIdx.x; kk < k; kk += kThreads) {
+    double r = ldexp(vec[kk], -e);
+    for (int p = 0; p < num_slices; ++p) {
+      r = ldexp(r, kSliceBits);
+      double digit = trunc(r);
+      r -= digit;
+      dst[p * slice_stride + kk] = static_cast<ElementSlice>(digit);
+    }
+  }
+}
+
+/// Recombines the INT32 slice products into D = alpha * A * B + beta * C.
+/// Group p of the products holds A_p * [B_0 .. B_{S-1-p}] as an M x (S*n_pad) row-major matrix.
+__global__ void ozaki_recombine(
+  ElementProduct const *products,
+  int const *exponents_a,
+  int const *exponents_b,
+  int num_slices,
+  int m,
+  int n,
+  int n_pad,
+  double alpha,
+  double const *C,
+  double beta,
+  double *D) {
+
+  int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx >= int64_t(m) * n) {
+    return;
+  }
+  int i = int(idx / n);
+  int j = int(idx % n);
+
+  int64_t ld_products = int64_t(num_slices) * n_pad;
+  int64_t group_stride = int64_t(m) * ld_products;
+  ElementProduct const *row = products + i * ld_products + j;
+
+  // Anti-diagonals from the smallest weight upwards. Each diagonal sum is exact in INT64 and
+  // below 2^53, so it converts to FP64 exactly and the only rounding is across diagonals.
+  double acc = 0;
+  for (int d = num_slices - 1; d >= 0; --d) {
+    int64_t diagonal = 0;
+    for (int p = 0; p <= d; ++p) {
+      int q = d - p;
+      diagonal += row[p * group_stride + q * n_pad];
+    }
+    acc += ldexp(double(diagonal), -kSliceBits * (d + 2));
+  }
+  acc = ldexp(acc, exponents_a[i] + exponents_b[j]);
+
+  D[idx] = (beta == 0) ? alpha * acc : alpha * acc + beta * C[idx];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Ozaki FP64 GEMM
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Owns the slice buffers and the grouped GEMM of one problem size
+class OzakiGemm {
+public:
+
+  struct Arguments {
+    cutlass::gemm::GemmCoord problem_size;
+    int num_slices;
+    double alpha;
+    double const *ptr_A;      // M x K row-major
+    double const *ptr_B;      // K x N column-major
+    double beta;
+    double const *ptr_C;      // M x N row-major
+    double *ptr_D;            // M x N row-major
+  };
+
+private:
+
+  Arguments args_;
+  int k_pad_ = 0;
+  int n_pad_ = 0;
+
+  cutlass::DeviceAllocation<ElementSlice> slices_A_;
+  cutlass::DeviceAllocation<ElementSlice> slices_B_;
+  cutlass::DeviceAllocation<ElementProduct> products_;
+  cutlass::DeviceAllocation<int> exponents_A_;
+  cutlass::DeviceAllocation<int> exponents_B_;
+
+  std::vector<cutlass::gemm::GemmCoord> problem_sizes_host_;
+  cutlass::DeviceAllocation<cutlass::gemm::GemmCoord> problem_sizes_;
+  cutlass::DeviceAllocation<ElementSlice *> ptr_slice_A_;
+  cutlass::DeviceAllocation<ElementSlice *> ptr_slice_B_;
+  cutlass::DeviceAllocation<ElementProduct *> ptr_products_;
+  cutlass::DeviceAllocation<int64_t> ld_slice_;
+  cutlass::DeviceAllocation<int64_t> ld_products_;
+
+  SliceGemm slice_gemm_;
+  cutlass::DeviceAllocation<uint8_t> workspace_;
+
+public:
+
+  static cutlass::Status can_implement(Arguments const &args) {
+    if (args.num_slices < 1 || args.num_slices > 8) {
+      return cutlass::Status::kErrorInvalidProblem;
+    }
+    if (args.problem_size.k() > kMaxExactK) {
+      return cutlass::Status::kErrorInvalidProblem;
+    }
+    return cutlass::Status::kSuccess;
+  }
+
+  cutlass::Status initialize(Arguments const &args) {
+    cutlass::Status status = can_implement(args);
+    if (status != cutlass::Status::kSuccess) {
+      return status;
+    }
+
+    args_ = args;
+    int m = args.problem_size.m();
+    int n = args.problem_size.n();
+    int k = args.problem_size.k();
+    int s = args.num_slices;
+
+    // Pad K and N so every slice and product row meets the 128b alignment of the INT8 GEMM.
+    // The padding is zero-filled once and never written by the split kernel.
+    k_pad_ = cutlass::round_up(k, kAlignmentSlice);
+    n_pad_ = cutlass::round_up(n, kAlignmentProduct);
+
+    slices_A_.reset(size_t(s) * m * k_pad_);
+    slices_B_.reset(size_t(s) * n_pad_ * k_pad_);
+    products_.reset(size_t(s) * m * s * n_pad_);
+    exponents_A_.reset(m);
+    exponents_B_.reset(n);
+    CUDA_CHECK(cudaMemset(slices_A_.get(), 0, slices_A_.bytes()));
+    CUDA_CHECK(cudaMemset(slices_B_.get(), 0, slices_B_.bytes()));
+
+    // Group p: A_p (M x K) times the stacked slices B_0 .. B_{S-1-p} (K x (S-p)*N)
+    problem_sizes_host_.clear();
+    std::vector<ElementSlice *> ptr_slice_A_host;
+    std::vector<ElementSlice *> ptr_slice_B_host;
+    std::vector<ElementProduct *> ptr_products_host;
+    for (int p = 0; p < s; ++p) {
+      problem_sizes_host_.push_back({m, (s - p) * n_pad_, k_pad_});
+      ptr_slice_A_host.push_back(slices_A_.get() + size_t(p) * m * k_pad_);
+      ptr_slice_B_host.push_back(slices_B_.get());
+      ptr_products_host.push_back(products_.get() + size_t(p) * m * s * n_pad_);
+    }
+    std::vector<int64_t> ld_slice_host(s, k_pad_);
+    std::vector<int64_t> ld_products_host(s, int64_t(s) * n_pad_);
+
+    problem_sizes_.reset(s);
+    problem_sizes_.copy_from_host(problem_sizes_host_.data());
+    ptr_slice_A_.reset(s);
+    ptr_slice_A_.copy_from_host(ptr_slice_A_host.data());
+    ptr_slice_B_.reset(s);
+    ptr_slice_B_.copy_from_host(ptr_slice_B_host.data());
+    ptr_products_.reset(s);
+    ptr_products_.copy_from_host(ptr_products_host.data());
+    ld_slice_.reset(s);
+    ld_slice_.copy_from_host(ld_slice_host.data());
+    ld_products_.reset(s);
+    ld_products_.copy_from_host(ld_products_host.data());
+
+    int threadblock_count = SliceGemm::sufficient(problem_sizes_host_.data(), s);
+    if (!threadblock_count) {
+      return cutlass::Status::kErrorInternal;
+    }
+
+    typename SliceGemm::Arguments gemm_args(
+      problem_sizes_.get(),
+      s,
+      threadblock_count,
+      {ElementProduct(1), ElementProduct(0)},
+      ptr_slice_A_.get(),
+      ptr_slice_B_.get(),
+      ptr_products_.get(),
+      ptr_products_.get(),
+      ld_slice_.get(),
+      ld_slice_.get(),
+      ld_products_.get(),
+      ld_products_.get(),
+      problem_sizes_host_.data());
+
+    workspace_.reset(slice_gemm_.get_workspace_size(gemm_args));
+    return slice_gemm_.initialize(gemm_args, workspace_.get());
+  }
+
+  cutlass::Status run(cudaStream_t stream = nullptr) {
+    int m = args_.problem_size.m();
+    int n = args_.problem_size.n();
+    int k = args_.problem_size.k();
+    int s = args_.num_slices;
+
+    constexpr int kSplitThreads = 128;
+    ozaki_split<kSplitThreads><<<m, kSplitThreads, 0, stream>>>(
+      args_.ptr_A, m, k, k, s, slices_A_.get(), int64_t(m) * k_pad_, k_pad_, exponents_A_.get());
+    ozaki_split<kSplitThreads><<<n, kSplitThreads, 0, stream>>>(
+      args_.ptr_B, n, k, k, s, slices_B_.get(), int64_t(n_pad_) * k_pad_, k_pad_, exponents_B_.get());
+
+    cutlass::Status status = slice_gemm_.run(stream);
+    if (status != cutlass::Status::kSuccess) {
+      return status;
+    }
+
+    constexpr int kRecombineThreads = 256;
+    int64_t elements = int64_t(m) * n;
+    int blocks = int((elements + kRecombineThreads - 1) / kRecombineThreads);
+    ozaki_recombine<<<blocks, kRecombineThreads, 0, stream>>>(
+      products_.get(), exponents_A_.get(), exponents_B_.get(), s, m, n, n_pad_,
+      args_.alpha, args_.ptr_C, args_.beta, args_.ptr_D);
+
+    return cudaGetLastError() == cudaSuccess ? cutlass::Status::kSuccess : cutlass::Status::kErrorInternal;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+
+  int m, n, k;
+  int slices;
+  double alpha, beta;
+  double tolerance;
+  int iterations;
+
+  Options():
+    help(false),
+    m(4096), n(4096), k(4096),
+    slices(7),
+    alpha(1), beta(0),
+    tolerance(1e-12),
+    iterations(10)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("slices", slices);
+    cmd.get_cmd_line_argument("alpha", alpha);
+    cmd.get_cmd_line_argument("beta", beta);
+    cmd.get_cmd_line_argument("tolerance", tolerance);
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "72_ampere_ozaki_fp64_gemm\n\n"
+      << "  FP64 GEMM (D = alpha * A * B + beta * C) emulated with INT8 tensor cores (Ozaki scheme).\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM\n"
+      << "  --k=<int>                   Sets the K extent of the GEMM (at most " << kMaxExactK << ")\n"
+      << "  --slices=<int>              Number of INT8 slices per operand, 1 to 8\n"
+      << "  --alpha=<f64>               Epilogue scalar alpha\n"
+      << "  --beta=<f64>                Epilogue scalar beta\n"
+      << "  --tolerance=<f64>           Largest accepted error relative to max |D|\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "72_ampere_ozaki_fp64_gemm" << " --m=1024 --n=512 --k=1024 --slices=6 --tolerance=1e-9 \n\n";
+
+    return out;
+  }
+
+  /// Compute FP64-equivalent performance in GFLOP/s
+  double gflops(double runtime_s) const
+  {
+    uint64_t flop = uint64_t(2) * m * n * k;
+    double gflop = double(flop) / double(1.0e9);
+    return gflop / runtime_s;
+  }
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+/// Largest |x - y| relative to the largest |y|
+double normwise_error(cutlass::DeviceAllocation<double> const &x, cutlass::DeviceAllocation<double> const &y) {
+  std::vector<double> host_x(x.size());
+  std::vector<double> host_y(y.size());
+  x.copy_to_host(host_x.data());
+  y.copy_to_host(host_y.data());
+
+  double max_diff = 0;
+  double max_ref = 0;
+  for (size_t i = 0; i < host_x.size(); ++i) {
+    max_diff = std::max(max_diff, std::abs(host_x[i] - host_y[i]));
+    max_ref = std::max(max_ref, std::abs(host_y[i]));
+  }
+  return max_ref > 0 ? max_diff / max_ref : max_diff;
+}
+
+/// Times `iterations` calls of `op`, returning the average runtime in ms
+template <class Op>
+double profile(Options const &options, Op &&op) {
+  GpuTimer timer;
+  timer.start();
+  for (int iter = 0; iter < options.iterations; ++iter) {
+    CUTLASS_CHECK(op());
+  }
+  timer.stop();
+  return double(timer.elapsed_millis()) / double(options.iterations);
+}
+
+int run(Options const &options) {
+  int m = options.m, n = options.n, k = options.k;
+
+  cutlass::DeviceAllocation<double> block_A(size_t(m) * k);
+  cutlass::DeviceAllocation<double> block_B(size_t(k) * n);
+  cutlass::DeviceAllocation<double> block_C(size_t(m) * n);
+  cutlass::DeviceAllocation<double> block_D(size_t(m) * n);
+  cutlass::DeviceAllocation<double> block_D_baseline(size_t(m) * n);
+  cutlass::DeviceAllocation<double> block_ref_D(size_t(m) * n);
+
+  // Full-precision random inputs, so the low mantissa bits matter
+  cutlass::reference::device::BlockFillRandomUniform(block_A.get(), block_A.size(), 2023, 1.0, -1.0);
+  cutlass::reference::device::BlockFillRandomUniform(block_B.get(), block_B.size(), 2022, 1.0, -1.0);
+  cutlass::reference::device::BlockFillRandomUniform(block_C.get(), block_C.size(), 2021, 1.0, -1.0);
+
+  cutlass::TensorRef<double, LayoutA> ref_A(block_A.get(), LayoutA::packed({m, k}));
+  cutlass::TensorRef<double, LayoutB> ref_B(block_B.get(), LayoutB::packed({k, n}));
+  cutlass::TensorRef<double, LayoutC> ref_C(block_C.get(), LayoutC::packed({m, n}));
+
+  //
+  // Ozaki GEMM
+  //
+
+  OzakiGemm ozaki;
+  OzakiGemm::Arguments ozaki_args{
+    {m, n, k}, options.slices,
+    options.alpha, block_A.get(), block_B.get(),
+    options.beta, block_C.get(), block_D.get()
+  };
+  CUTLASS_CHECK(OzakiGemm::can_implement(ozaki_args));
+  CUTLASS_CHECK(ozaki.initialize(ozaki_args));
+  CUTLASS_CHECK(ozaki.run());
+
+  //
+  // FP64 tensor core baseline
+  //
+
+  DgemmBaseline dgemm;
+  typename DgemmBaseline::Arguments dgemm_args{
+    {m, n, k}, ref_A, ref_B, ref_C,
+    {block_D_baseline.get(), LayoutC::packed({m, n})},
+    {options.alpha, options.beta}
+  };
+  CUTLASS_CHECK(dgemm.can_implement(dgemm_args));
+  CUTLASS_CHECK(dgemm.initialize(dgemm_args));
+  CUTLASS_CHECK(dgemm.run());
+
+  //
+  // Verify
+  //
+
+  cutlass::reference::device::Gemm<
+    double, LayoutA, double, LayoutB, double, LayoutC, double, double> reference_gemm;
+  reference_gemm(
+    {m, n, k}, options.alpha, ref_A, ref_B, options.beta, ref_C,
+    {block_ref_D.get(), LayoutC::packed({m, n})}, 0.0);
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  double ozaki_error = normwise_error(block_D, block_ref_D);
+  double baseline_error = normwise_error(block_D_baseline, block_ref_D);
+  bool passed = ozaki_error <= options.tolerance;
+
+  std::cout << "  Problem Size: " << m << 'x' << n << 'x' << k << ", " << options.slices << " slices" << std::endl;
+  std::cout << "  Ozaki error: " << ozaki_error << " (FP64 tensor core: " << baseline_error << ")" << std::endl;
+  std::cout << "  Disposition: " << (passed ? "Passed" : "Failed") << std::endl;
+
+  if (!passed) {
+    exit(-1);
+  }
+
+  //
+  // Profile
+  //
+
+  if (options.iterations > 0) {
+    double ozaki_ms = profile(options, [&]() { return ozaki.run(); });
+    double dgemm_ms = profile(options, [&]() { return dgemm.run(); });
+
+    std::cout << "  Ozaki avg runtime: " << ozaki_ms << " ms, "
+              << options.gflops(ozaki_ms / 1000.0) << " FP64 GFLOPS" << std::endl;
+    std::cout << "  DGEMM avg runtime: " << dgemm_ms << " ms, "
+              << options.gflops(dgemm_ms / 1000.0) << " GFLOPS" << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 11.0 Toolkit to run this example
+  // and must have compute capability at least 80.
+  if (__CUDACC_VER_MAJOR__ < 11) {
+    std::cerr << "This example requires CUDA 11 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major < 8) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Ampere Architecture or "
+      << "later (compute capability 80 or greater).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+  return run(options);
+#else
+  return 0;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,500 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Hopper GEMM with a Blocked-ELL sparse A operand.
+
+    This is the Hopper counterpart of example 43_ell_block_sparse_gemm. A is stored in the
+    Blocked-ELL format (see that example and the cuSPARSE documentation): the ellValue matrix packs
+    the non-zero blocks of each block row side by side, and the ellColInd matrix lists their block
+    column indices, -1 marking an empty block.
+
+    The warp-specialized kernel runs its K loop over the packed ELL columns only, so the problem
+    shape given to the kernel is (M, N, ell_ncol, 1) and the work per CTA is proportional to the
+    density of its block row. For every k-tile the producer warp looks up the block column in
+    ellColInd and issues the TMA load of B at that K coordinate; empty blocks load a zero tile.
+
+    The ELL block size must be a multiple of the CTA tile's M and K extents. This example uses
+    64x64 blocks with a 64x128x64 Pingpong tile and also times the dense GEMM of the same problem.
+
+    Examples:
+
+      $ ./examples/73_hopper_blocked_ell_gemm/73_hopper_blocked_ell_gemm --m=4096 --n=4096 --k=4096 --density=0.25
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A matrix configuration
+using         ElementA    = cutlass::half_t;                                // Element type for A matrix operand
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for the ellValue matrix
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Memory access granularity/alignment of A matrix in units of elements (up to 16 bytes)
+
+// B matrix configuration
+using         ElementB    = cutlass::half_t;                                // Element type for B matrix operand
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B matrix operand
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Memory access granularity/alignment of B matrix in units of elements (up to 16 bytes)
+
+// C/D matrix configuration
+using         ElementC    = float;                                          // Element type for C and D matrix operands
+using         LayoutC     = cutlass::layout::ColumnMajor;                   // Layout type for C and D matrix operands
+constexpr int AlignmentC  = 128 / cutlass::sizeof_bits<ElementC>::value;    // Memory access granularity/alignment of C matrix in units of elements (up to 16 bytes)
+
+// Core kernel configurations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+using TileShape           = Shape<_64,_128,_64>;                            // Threadblock-level tile size, fits one 64x64 ELL block in M and K
+using ClusterShape        = Shape<_1,_2,_1>;                                // Shape of the threadblocks in a cluster, must be 1 along M
+
+constexpr int EllBlockSize = 64;
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    TileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    ElementC, LayoutC, AlignmentC,
+    ElementC, LayoutC, AlignmentC,
+    cutlass::epilogue::TmaWarpSpecialized
+  >::CollectiveOp;
+
+template <class KernelSchedule>
+using Mainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementA, LayoutA, AlignmentA,
+    ElementB, LayoutB, AlignmentB,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    KernelSchedule
+  >::CollectiveOp;
+
+template <class CollectiveMainloop>
+using GemmOf = cutlass::gemm::device::GemmUniversalAdapter<
+    cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>>;
+
+// Sparse GEMM over the packed ELL columns, and the dense GEMM it is compared against
+using Gemm = GemmOf<Mainloop<cutlass::gemm::KernelTmaWarpSpecializedPingpongBlockedEll>>;
+using DenseGemm = GemmOf<Mainloop<cutlass::gemm::KernelTmaWarpSpecializedPingpong>>;
+
+using StrideA = typename Gemm::GemmKernel::StrideA;
+using StrideB = typename Gemm::GemmKernel::StrideB;
+using StrideC = typename Gemm::GemmKernel::StrideC;
+using StrideD = typename Gemm::GemmKernel::StrideD;
+
+//
+// Data members
+//
+
+uint64_t seed = 2024;
+
+cutlass::DeviceAllocation<ElementA> block_A_ell;    // ellValue, M x ell_ncol
+cutlass::DeviceAllocation<int> block_ell_idx;       // ellColInd, (M / EllBlockSize) x (ell_ncol / EllBlockSize)
+cutlass::DeviceAllocation<ElementA> block_A_dense;  // A expanded to M x K
+cutlass::DeviceAllocation<ElementB> block_B;
+cutlass::DeviceAllocation<ElementC> block_C;
+cutlass::DeviceAllocation<ElementC> block_D;
+cutlass::DeviceAllocation<ElementC> block_ref_D;
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+
+  float alpha, beta;
+  float density;
+  int iterations;
+  int m, n, k;
+
+  Options():
+    help(false),
+    m(4096), n(4096), k(4096),
+    alpha(1.f), beta(0.f),
+    density(0.25f),
+    iterations(1000)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("alpha", alpha, 1.f);
+    cmd.get_cmd_line_argument("beta", beta, 0.f);
+    cmd.get_cmd_line_argument("density", density, 0.25f);
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "73_hopper_blocked_ell_gemm\n\n"
+      << "  Hopper GEMM with a Blocked-ELL sparse A operand (64x64 blocks) using a Warp Specialized kernel.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM, a multiple of 64\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM\n"
+      << "  --k=<int>                   Sets the K extent of the dense A, a multiple of 64\n"
+      << "  --density=<f32>             Fraction of non-zero blocks per block row\n"
+      << "  --alpha=<f32>               Epilogue scalar alpha\n"
+      << "  --beta=<f32>                Epilogue scalar beta\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "73_hopper_blocked_ell_gemm" << " --m=1024 --n=512 --k=2048 --density=0.125 --alpha=2 --beta=0.707 \n\n";
+
+    return out;
+  }
+
+  /// Number of ELL blocks stored per block row
+  int ell_blocks_per_row() const {
+    int k_blocks = k / 64;
+    return std::min(k_blocks, std::max(1, int(density * k_blocks + 0.5f)));
+  }
+
+  /// Compute performance in GFLOP/s for the given K extent
+  double gflops(double runtime_s, int k_extent) const
+  {
+    uint64_t flop = uint64_t(2) * m * n * k_extent;
+    double gflop = double(flop) / double(1.0e9);
+    return gflop / runtime_s;
+  }
+};
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms;
+  double gflops;
+  cutlass::Status status;
+  cudaError_t error;
+  bool passed;
+
+  Result(
+    double avg_runtime_ms = 0,
+    double gflops = 0,
+    cutlass::Status status = cutlass::Status::kSuccess,
+    cudaError_t error = cudaSuccess)
+  :
+    avg_runtime_ms(avg_runtime_ms), gflops(gflops), status(status), error(error), passed(false)
+  {}
+
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Builds a random Blocked-ELL A and its dense expansion. The last stored block of every other
+/// block row is left empty (-1) to exercise the zero-fill path.
+void initialize(const Options &options) {
+  int m_blocks = options.m / EllBlockSize;
+  int k_blocks = options.k / EllBlockSize;
+  int blocks_per_row = options.ell_blocks_per_row();
+  int ell_ncol = blocks_per_row * EllBlockSize;
+
+  std::mt19937 rng(static_cast<unsigned>(seed));
+  std::uniform_int_distribution<int> value_dist(-2, 2);
+
+  std::vector<int> ell_idx(size_t(m_blocks) * blocks_per_row);
+  std::vector<ElementA> a_ell(size_t(options.m) * ell_ncol);
+  std::vector<ElementA> a_dense(size_t(options.m) * options.k, ElementA(0));
+
+  std::vector<int> columns(k_blocks);
+  for (int mb = 0; mb < m_blocks; ++mb) {
+    std::iota(columns.begin(), columns.end(), 0);
+    std::shuffle(columns.begin(), columns.end(), rng);
+    std::sort(columns.begin(), columns.begin() + blocks_per_row);
+    for (int b = 0; b < blocks_per_row; ++b) {
+      bool empty = (mb % 2 == 1) && (b == blocks_per_row - 1) && blocks_per_row > 1;
+      ell_idx[size_t(mb) * blocks_per_row + b] = empty ? -1 : columns[b];
+    }
+
+    for (int r = mb * EllBlockSize; r < (mb + 1) * EllBlockSize; ++r) {
+      for (int c = 0; c < ell_ncol; ++c) {
+        ElementA value = ElementA(value_dist(rng));
+        a_ell[size_t(r) * ell_ncol + c] = value;
+        int col_block = ell_idx[size_t(mb) * blocks_per_row + c / EllBlockSize];
+        if (col_block >= 0) {
+          a_dense[size_t(r) * options.k + col_block * EllBlockSize + c % EllBlockSize] = value;
+        }
+      }
+    }
+  }
+
+  block_A_ell.reset(a_ell.size());
+  block_A_ell.copy_from_host(a_ell.data());
+  block_ell_idx.reset(ell_idx.size());
+  block_ell_idx.copy_from_host(ell_idx.data());
+  block_A_dense.reset(a_dense.size());
+  block_A_dense.copy_from_host(a_dense.data());
+
+  block_B.reset(size_t(options.k) * options.n);
+  block_C.reset(size_t(options.m) * options.n);
+  block_D.reset(size_t(options.m) * options.n);
+  block_ref_D.reset(size_t(options.m) * options.n);
+
+  cutlass::reference::device::BlockFillRandomUniform(
+    block_B.get(), block_B.size(), seed + 2022, ElementB(2), ElementB(-2), 0);
+  cutlass::reference::device::BlockFillRandomUniform(
+    block_C.get(), block_C.size(), seed + 2021, ElementC(2), ElementC(-2), 0);
+}
+
+/// Populates the sparse Gemm::Arguments structure from the given commandline options
+typename Gemm::Arguments args_from_options(const Options &options)
+{
+  int ell_ncol = options.ell_blocks_per_row() * EllBlockSize;
+
+  auto stride_A = cutlass::make_cute_packed_stride(StrideA{}, {options.m, ell_ncol, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(StrideB{}, {options.n, options.k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(StrideC{}, {options.m, options.n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(StrideD{}, {options.m, options.n, 1});
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {options.m, options.n, ell_ncol, 1},        // K runs over the packed ELL columns
+    {block_A_ell.get(), stride_A, block_B.get(), stride_B,
+     block_ell_idx.get(), EllBlockSize, options.k},
+    {{options.alpha, options.beta}, block_C.get(), stride_C, block_D.get(), stride_D}
+  };
+
+  return arguments;
+}
+
+/// Populates the dense Gemm::Arguments structure for the expanded A
+typename DenseGemm::Arguments dense_args_from_options(const Options &options)
+{
+  auto stride_A = cutlass::make_cute_packed_stride(StrideA{}, {options.m, options.k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(StrideB{}, {options.n, options.k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(StrideC{}, {options.m, options.n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(StrideD{}, {options.m, options.n, 1});
+
+  typename DenseGemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {options.m, options.n, options.k, 1},
+    {block_A_dense.get(), stride_A, block_B.get(), stride_B},
+    {{options.alpha, options.beta}, block_C.get(), stride_C, block_ref_D.get(), stride_D}
+  };
+
+  return arguments;
+}
+
+bool verify(const Options &options) {
+  cutlass::reference::device::Gemm<
+    ElementA, LayoutA,
+    ElementB, LayoutB,
+    ElementC, LayoutC,
+    ElementAccumulator, ElementAccumulator> reference_gemm;
+
+  reference_gemm(
+    {options.m, options.n, options.k},
+    options.alpha,
+    {block_A_dense.get(), LayoutA::packed({options.m, options.k})},
+    {block_B.get(), LayoutB::packed({options.k, options.n})},
+    options.beta,
+    {block_C.get(), LayoutC::packed({options.m, options.n})},
+    {block_ref_D.get(), LayoutC::packed({options.m, options.n})},
+    ElementAccumulator(0));
+
+  // Wait for kernel to finish
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Small integer inputs make every product and partial sum exact
+  return cutlass::reference::device::BlockCompareEqual(block_ref_D.get(), block_D.get(), block_D.size());
+}
+
+/// Runs `gemm` for the profiling iterations and returns the average runtime in ms
+template <class GemmT>
+double profile(const Options &options, GemmT &gemm) {
+  GpuTimer timer;
+  timer.start();
+  for (int iter = 0; iter < options.iterations; ++iter) {
+    CUTLASS_CHECK(gemm.run());
+  }
+  timer.stop();
+  return double(timer.elapsed_millis()) / double(options.iterations);
+}
+
+/// Execute the example GEMM computation
+int run(Options &options)
+{
+  if (options.m % EllBlockSize != 0 || options.k % EllBlockSize != 0) {
+    std::cerr << "M and K must be multiples of the ELL block size " << EllBlockSize << ".\n";
+    return -1;
+  }
+
+  initialize(options);
+
+  Gemm gemm;
+  auto arguments = args_from_options(options);
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(gemm.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  Result result;
+  result.passed = verify(options);
+
+  std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+  if (!result.passed) {
+    exit(-1);
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0)
+  {
+    DenseGemm dense_gemm;
+    auto dense_arguments = dense_args_from_options(options);
+    cutlass::device_memory::allocation<uint8_t> dense_workspace(DenseGemm::get_workspace_size(dense_arguments));
+    CUTLASS_CHECK(dense_gemm.can_implement(dense_arguments));
+    CUTLASS_CHECK(dense_gemm.initialize(dense_arguments, dense_workspace.get()));
+
+    int ell_ncol = options.ell_blocks_per_row() * EllBlockSize;
+    result.avg_runtime_ms = profile(options, gemm);
+    result.gflops = options.gflops(result.avg_runtime_ms / 1000.0, ell_ncol);
+    double dense_runtime_ms = profile(options, dense_gemm);
+
+    std::cout << "  Problem Size: " << options.m << 'x' << options.n << 'x' << options.k
+              << ", " << options.ell_blocks_per_row() << " of " << options.k / EllBlockSize << " blocks per row" << std::endl;
+    std::cout << "  Avg runtime: " << result.avg_runtime_ms << " ms (dense: " << dense_runtime_ms << " ms)" << std::endl;
+    std::cout << "  GFLOPS (stored blocks): " << result.gflops << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major < 9) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture or "
+      << "later (compute capability 90 or greater).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  return run(options);
+#else
+  return 0;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,273 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Microbenchmark for the throughput of cutlass::NumericArrayConverter.
+
+    Mixed-input mainloops and quantizing epilogues spend a large part of their issue slots in
+    register-to-register type conversion. This example times each converter in isolation so
+    that changes to the packed conversion paths in cutlass/numeric_conversion.h can be compared
+    directly.
+
+    Every thread loads one 128-bit vector of source elements and converts it --inner times.
+    The source is perturbed between iterations and the results are folded into a checksum so
+    that the conversions cannot be hoisted or removed. The reported rate is converted elements
+    per second over the whole device.
+
+    Examples:
+
+      $ ./examples/74_hopper_numeric_conversion_throughput/74_hopper_numeric_conversion_throughput --inner=1024
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+
+#include "helper.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Converts one 128-bit source vector per thread `inner` times
+template <class Dst, class Src>
+__global__ void conversion_kernel(uint32_t const* input, uint32_t* checksum, int inner) {
+  static constexpr int N = 128 / cutlass::sizeof_bits<Src>::value;
+  using SrcArray = cutlass::Array<Src, N>;
+  using DstArray = cutlass::Array<Dst, N>;
+  static constexpr int kSrcWords = int(sizeof(SrcArray) / sizeof(uint32_t));
+  static constexpr int kDstWords = int(sizeof(DstArray) / sizeof(uint32_t));
+
+  int thread_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+  SrcArray src;
+  uint32_t* src_words = reinterpret_cast<uint32_t*>(&src);
+  CUTLASS_PRAGMA_UNROLL
+  for (int w = 0; w < kSrcWords; ++w) {
+    src_words[w] = input[thread_idx * kSrcWords + w];
+  }
+
+  cutlass::NumericArrayConverter<Dst, Src, N> converter;
+  uint32_t acc = 0;
+
+  for (int i = 0; i < inner; ++i) {
+    DstArray dst = converter(src);
+    uint32_t const* dst_words = reinterpret_cast<uint32_t const*>(&dst);
+    CUTLASS_PRAGMA_UNROLL
+    for (int w = 0; w < kDstWords; ++w) {
+      acc ^= dst_words[w];
+    }
+    // Flip a low bit per word so each iteration converts different data
+    src_words[i % kSrcWords] ^= (acc & 0x01010101u);
+  }
+
+  checksum[thread_idx] = acc;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+
+  bool help;
+
+  int threads;
+  int inner;
+  int iterations;
+
+  Options():
+    help(false),
+    threads(1 << 20),
+    inner(256),
+    iterations(10)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("threads", threads);
+    cmd.get_cmd_line_argument("inner", inner);
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "74_hopper_numeric_conversion_throughput\n\n"
+      << "  Measures the throughput of cutlass::NumericArrayConverter for the conversions used by\n"
+      << "  mixed-input GEMM mainloops and FP8 epilogues.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --threads=<int>             Number of threads, each converting one 128-bit source vector\n"
+      << "  --inner=<int>               Conversions per thread and launch\n"
+      << "  --iterations=<int>          Number of timed launches per converter\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "74_hopper_numeric_conversion_throughput" << " --threads=2097152 --inner=1024 \n\n";
+
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Times one converter and prints its throughput
+template <class Dst, class Src>
+void profile(char const* name, Options const& options, cutlass::DeviceAllocation<uint32_t>& input) {
+  static constexpr int N = 128 / cutlass::sizeof_bits<Src>::value;
+
+  int const threads_per_block = 256;
+  int const blocks = (options.threads + threads_per_block - 1) / threads_per_block;
+  int const threads = blocks * threads_per_block;
+
+  cutlass::DeviceAllocation<uint32_t> checksum(threads);
+
+  // Warmup
+  conversion_kernel<Dst, Src><<<blocks, threads_per_block>>>(input.get(), checksum.get(), options.inner);
+  CUDA_CHECK(cudaGetLastError());
+
+  GpuTimer timer;
+  timer.start();
+  for (int iter = 0; iter < options.iterations; ++iter) {
+    conversion_kernel<Dst, Src><<<blocks, threads_per_block>>>(input.get(), checksum.get(), options.inner);
+  }
+  timer.stop();
+  CUDA_CHECK(cudaGetLastError());
+
+  double elapsed_s = double(timer.elapsed_millis()) / 1000.0;
+  double elements = double(threads) * double(options.inner) * double(N) * double(options.iterations);
+
+  std::cout << "  " << std::left << std::setw(28) << name
+            << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+            << elements / elapsed_s / 1.0e9 << " Gelem/s\n";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int run(Options const& options) {
+  // Enough random words for the widest source vector (four 32-bit words per thread)
+  int const threads_per_block = 256;
+  size_t words = size_t((options.threads + threads_per_block - 1) / threads_per_block) * threads_per_block * 4;
+
+  std::vector<uint32_t> host_input(words);
+  uint32_t state = 0x12345678u;
+  for (auto& w : host_input) {
+    state = state * 1664525u + 1013904223u;
+    w = state;
+  }
+  cutlass::DeviceAllocation<uint32_t> input(words);
+  input.copy_from_host(host_input.data());
+
+  std::cout << "Conversion throughput (" << options.threads << " threads, "
+            << options.inner << " conversions per thread):\n\n";
+
+  using cutlass::bfloat16_t;
+  using cutlass::half_t;
+  using cutlass::float_e4m3_t;
+  using cutlass::float_e5m2_t;
+  using cutlass::float_e2m1_t;
+  using cutlass::int4b_t;
+
+  // Upcasts used by mixed-input mainloops
+  profile<bfloat16_t, float_e4m3_t>("bf16 <= e4m3", options, input);
+  profile<half_t, float_e4m3_t>("f16 <= e4m3", options, input);
+  profile<bfloat16_t, float_e5m2_t>("bf16 <= e5m2", options, input);
+  profile<half_t, float_e5m2_t>("f16 <= e5m2", options, input);
+  profile<bfloat16_t, int8_t>("bf16 <= s8", options, input);
+  profile<half_t, int8_t>("f16 <= s8", options, input);
+  profile<bfloat16_t, int4b_t>("bf16 <= s4", options, input);
+  profile<half_t, int4b_t>("f16 <= s4", options, input);
+  profile<float_e4m3_t, int4b_t>("e4m3 <= s4", options, input);
+  profile<bfloat16_t, float_e2m1_t>("bf16 <= e2m1", options, input);
+  profile<half_t, float_e2m1_t>("f16 <= e2m1", options, input);
+  profile<float_e4m3_t, float_e2m1_t>("e4m3 <= e2m1", options, input);
+
+  // Downcasts used by quantizing epilogues
+  profile<float_e4m3_t, float>("e4m3 <= f32", options, input);
+  profile<float_e4m3_t, bfloat16_t>("e4m3 <= bf16", options, input);
+  profile<float_e4m3_t, half_t>("e4m3 <= f16", options, input);
+  profile<float_e5m2_t, bfloat16_t>("e5m2 <= bf16", options, input);
+  profile<bfloat16_t, float>("bf16 <= f32", options, input);
+  profile<half_t, float>("f16 <= f32", options, input);
+
+  std::cout << std::endl;
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // FP8 conversion instructions require CUDA 12 and compute capability 89 or greater.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major < 9) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture or "
+      << "later (compute capability 90 or greater).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  return run(options);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
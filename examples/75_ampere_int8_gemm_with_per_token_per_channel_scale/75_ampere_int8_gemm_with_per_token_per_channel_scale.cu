@@ -0,0 +1,495 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief INT8 GEMM with a per-token (row) and per-channel (column) dequantization epilogue.
+
+    Weight-and-activation int8 quantization (W8A8) stores a float scale per token for the
+    activations A and a float scale per output channel for the weights B. Dequantizing the
+    int32 accumulators therefore needs an outer-product scale
+
+      D[m, n] = ElementOutput( float(A * B)[m, n] * scale_token[m] * scale_channel[n] )
+
+    which the scalar alpha/beta epilogue of the int8 kernels cannot express. The usual
+    workaround is an int32 output followed by a separate dequantization kernel, which writes
+    and re-reads four bytes per output element.
+
+    This example fuses the scaling into the GEMM with the 2.x epilogue visitor tree (EVT):
+    the per-token scale is a column broadcast (one value per row of D), the per-channel scale
+    is a row broadcast (one value per column of D), and D is stored directly as FP16 or BF16.
+    Both variants run on SM80 and SM89 (A100, A10, L4, L40S) through the int8 mma.sync path.
+
+    Examples:
+
+      $ ./examples/75_ampere_int8_gemm_with_per_token_per_channel_scale/75_ampere_int8_gemm_with_per_token_per_channel_scale
+
+      $ ./examples/75_ampere_int8_gemm_with_per_token_per_channel_scale/75_ampere_int8_gemm_with_per_token_per_channel_scale \
+          --m=16 --n=4096 --k=4096 --iterations=100
+*/
+
+#include <iostream>
+#include <string>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/epilogue/threadblock/fusion/visitors.hpp"
+#include "cutlass/gemm/kernel/default_gemm_universal_with_visitor.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+#include "helper.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using namespace cute;
+
+// A matrix configuration (activations, M tokens x K)
+using         ElementA         = int8_t;
+using         LayoutA          = cutlass::layout::RowMajor;
+constexpr int AlignmentA       = 128 / cutlass::sizeof_bits<ElementA>::value;
+
+// B matrix configuration (weights, K x N output channels)
+using         ElementB         = int8_t;
+using         LayoutB          = cutlass::layout::ColumnMajor;
+constexpr int AlignmentB       = 128 / cutlass::sizeof_bits<ElementB>::value;
+
+// Scale vectors
+using         ElementScale     = float;
+
+// Multiply-accumulate blocking/pipelining details
+using ElementAccumulator  = int32_t;                                  // Exact int8 products accumulate in int32
+using ElementCompute      = float;                                    // Dequantization is carried out in float
+using ArchTag             = cutlass::arch::Sm80;
+using OperatorClass       = cutlass::arch::OpClassTensorOp;
+using ThreadblockShape    = cutlass::gemm::GemmShape<128, 128, 64>;
+using WarpShape           = cutlass::gemm::GemmShape<64, 64, 64>;
+using InstructionShape    = cutlass::gemm::GemmShape<16, 8, 32>;
+constexpr int NumStages   = 4;
+constexpr int EVTEpilogueStages = 1;
+
+/// Int8 GEMM whose EVT epilogue computes D = acc * scale_token[m] * scale_channel[n]
+template <typename ElementOutput_>
+struct Int8GemmWithTokenChannelScale {
+
+  using ElementOutput = ElementOutput_;
+  using LayoutOutput  = cutlass::layout::RowMajor;
+  static constexpr int AlignmentOutput = 128 / cutlass::sizeof_bits<ElementOutput>::value;
+
+  using OutputTileThreadMap = cutlass::epilogue::threadblock::OutputTileThreadLayout<
+    ThreadblockShape,
+    WarpShape,
+    ElementOutput,
+    AlignmentOutput,
+    EVTEpilogueStages
+  >;
+
+  using Accum = cutlass::epilogue::threadblock::VisitorAccFetch;
+
+  // One scale per row of D (token)
+  using TokenScale = cutlass::epilogue::threadblock::VisitorColBroadcast<
+    OutputTileThreadMap, ElementScale,
+    cute::Stride<_1, _0, int32_t>  // StrideMNL
+  >;
+
+  // One scale per column of D (output channel)
+  using ChannelScale = cutlass::epilogue::threadblock::VisitorRowBroadcast<
+    OutputTileThreadMap, ElementScale,
+    cute::Stride<_0, _1, int32_t>  // StrideMNL
+  >;
+
+  using Compute0 = cutlass::epilogue::threadblock::VisitorCompute<
+    cutlass::multiplies, ElementCompute, ElementCompute,
+    cutlass::FloatRoundStyle::round_to_nearest
+  >;
+
+  using EVTCompute0 = cutlass::epilogue::threadblock::Sm80EVT<
+    Compute0,
+    Accum,
+    TokenScale>;
+
+  using Compute1 = cutlass::epilogue::threadblock::VisitorCompute<
+    cutlass::multiplies, ElementOutput, ElementCompute,
+    cutlass::FloatRoundStyle::round_to_nearest
+  >;
+
+  using EVTCompute1 = cutlass::epilogue::threadblock::Sm80EVT<
+    Compute1,
+    EVTCompute0,
+    ChannelScale>;
+
+  using D = cutlass::epilogue::threadblock::VisitorAuxStore<
+    OutputTileThreadMap, ElementOutput, cutlass::FloatRoundStyle::round_to_nearest,
+    cute::Stride<int64_t, _1, int64_t> // StrideMNL
+  >;
+
+  using EVTD = cutlass::epilogue::threadblock::Sm80EVT<
+    D,
+    EVTCompute1>;
+
+  using GemmKernel =
+      typename cutlass::gemm::kernel::DefaultGemmWithVisitor<
+      ElementA, LayoutA, cutlass::ComplexTransform::kNone, AlignmentA,
+      ElementB, LayoutB, cutlass::ComplexTransform::kNone, AlignmentB,
+      ElementOutput, LayoutOutput, AlignmentOutput,
+      ElementAccumulator,
+      ElementCompute,
+      OperatorClass,
+      ArchTag,
+      ThreadblockShape,
+      WarpShape,
+      InstructionShape,
+      EVTD,
+      cutlass::gemm::threadblock::GemmIdentityThreadblockSwizzle<>,
+      NumStages,
+      cutlass::arch::OpMultiplyAddSaturate,
+      EVTEpilogueStages
+  >::GemmKernel;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+// Reference int8 GEMM producing the raw int32 accumulators
+using DeviceGemmReference = cutlass::reference::device::Gemm<
+  ElementA,
+  LayoutA,
+  ElementB,
+  LayoutB,
+  ElementAccumulator,
+  cutlass::layout::RowMajor,
+  ElementAccumulator,
+  ElementAccumulator>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms;
+  double gflops;
+  bool passed;
+
+  Result(double avg_runtime_ms = 0, double gflops = 0)
+  :
+    avg_runtime_ms(avg_runtime_ms), gflops(gflops), passed(true)
+  {}
+};
+
+/// Command line options parsing
+struct Options
+{
+  std::string               command_name;
+  bool                      help;
+  cutlass::gemm::GemmCoord  problem_size;
+  int                       iterations;
+
+  cutlass::HostTensor<ElementA, LayoutA> tensor_a;
+  cutlass::HostTensor<ElementB, LayoutB> tensor_b;
+  cutlass::HostTensor<ElementScale, cutlass::layout::RowMajor> tensor_scale_token;
+  cutlass::HostTensor<ElementScale, cutlass::layout::RowMajor> tensor_scale_channel;
+  cutlass::HostTensor<ElementAccumulator, cutlass::layout::RowMajor> tensor_ref_acc;
+
+  Options(std::string command_name) :
+    command_name(command_name),
+    help(false),
+    problem_size({4096, 4096, 4096}),
+    iterations(100)
+  {}
+
+  bool valid() const
+  {
+    // A and B are K-major and D is N-major, each accessed with 128-bit vectors
+    return problem_size.k() % AlignmentA == 0 &&
+           problem_size.k() % AlignmentB == 0 &&
+           problem_size.n() % 8 == 0;
+  }
+
+  void parse(int argc, char const **args)
+  {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+    }
+
+    cmd.get_cmd_line_argument("m", problem_size.m());
+    cmd.get_cmd_line_argument("n", problem_size.n());
+    cmd.get_cmd_line_argument("k", problem_size.k());
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const
+  {
+    out
+      << "Performs an int8 GEMM with per-token and per-channel dequantization to FP16 and BF16.\n"
+      << "\n"
+      << "Options:\n"
+      << "\n"
+      << "  --help                      If specified, displays this usage statement.\n\n"
+      << "  --m=<int>                   GEMM M dimension (tokens)\n"
+      << "  --n=<int>                   GEMM N dimension (output channels, multiple of 8)\n"
+      << "  --k=<int>                   GEMM K dimension (multiple of 16)\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << command_name << " --m=16 --n=4096 --k=4096 --iterations=100\n\n";
+
+    return out;
+  }
+
+  /// Compute performance in GOP/s
+  double gflops(double runtime_s) const
+  {
+    // Two ops per multiply-add
+    return 2.0 * double(problem_size.product()) / double(1.0e9) / runtime_s;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Populates the kernel arguments from the given commandline options
+template <typename Config>
+typename Config::Gemm::Arguments args_from_options(
+    Options &options,
+    cutlass::HostTensor<typename Config::ElementOutput, typename Config::LayoutOutput> &tensor_d)
+{
+  int m = options.problem_size.m();
+  int n = options.problem_size.n();
+
+  typename Config::EVTD::Arguments callback_args{
+    {
+      {
+        {},                                                                         // Accum
+        {options.tensor_scale_token.device_data(), ElementScale(0), {_1{}, _0{}, m}},   // TokenScale
+        {}                                                                          // Compute0
+      },                                                                            // EVTCompute0
+      {options.tensor_scale_channel.device_data(), ElementScale(0), {_0{}, _1{}, n}},   // ChannelScale
+      {}                                                                            // Compute1
+    },                                                                              // EVTCompute1
+    {tensor_d.device_data(), {int64_t(n), _1{}, int64_t(m) * n}}                    // D
+  };                                                                                // EVTD
+
+  return typename Config::Gemm::Arguments(
+    cutlass::gemm::GemmUniversalMode::kGemm,  // universal mode
+    options.problem_size,                     // problem_size
+    1,                                        // batch count / splitk slices
+    callback_args,                            // argument of EVT callbacks
+    options.tensor_a.device_data(),           // ptr_A
+    options.tensor_b.device_data(),           // ptr_B
+    nullptr,                                  // ptr_C (unused)
+    nullptr,                                  // ptr_D (unused)
+    options.problem_size.mk().product(),      // batch_stride_A
+    options.problem_size.nk().product(),      // batch_stride_B
+    0,                                        // batch_stride_C (unused)
+    0,                                        // batch_stride_D (unused)
+    options.tensor_a.layout().stride(0),      // stride_a
+    options.tensor_b.layout().stride(0),      // stride_b
+    0,                                        // stride_c (unused)
+    0);                                       // stride_d (unused)
+}
+
+/// Execute the GEMM for one output type and compare against the scaled reference accumulators
+template <typename Config>
+Result run(std::string description, Options &options)
+{
+  using ElementOutput = typename Config::ElementOutput;
+  using Gemm = typename Config::Gemm;
+
+  std::cout << std::endl << description << std::endl;
+
+  cutlass::HostTensor<ElementOutput, typename Config::LayoutOutput> tensor_d(options.problem_size.mn());
+  cutlass::HostTensor<ElementOutput, typename Config::LayoutOutput> tensor_ref_d(options.problem_size.mn());
+
+  cutlass::reference::host::TensorFill(tensor_d.host_view());
+  tensor_d.sync_device();
+
+  // Dequantize the reference accumulators on the host in the same order as the epilogue
+  for (int i = 0; i < options.problem_size.m(); ++i) {
+    for (int j = 0; j < options.problem_size.n(); ++j) {
+      ElementCompute acc = ElementCompute(options.tensor_ref_acc.host_ref().at({i, j}));
+      acc = acc * options.tensor_scale_token.host_data(i);
+      acc = acc * options.tensor_scale_channel.host_data(j);
+      tensor_ref_d.host_ref().at({i, j}) = ElementOutput(acc);
+    }
+  }
+
+  Gemm device_gemm;
+  auto arguments = args_from_options<Config>(options, tensor_d);
+
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  CUTLASS_CHECK(device_gemm.can_implement(arguments));
+  CUTLASS_CHECK(device_gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(device_gemm());
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  tensor_d.sync_host();
+
+  Result result;
+  result.passed = cutlass::reference::host::TensorEquals(tensor_d.host_view(), tensor_ref_d.host_view());
+
+  std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+  if (options.iterations > 0)
+  {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(device_gemm());
+    }
+    timer.stop();
+
+    float elapsed_ms = timer.elapsed_millis();
+    result.avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+    result.gflops = options.gflops(result.avg_runtime_ms / 1000.0);
+
+    std::cout << "  Avg runtime: " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  GOPs: " << result.gflops << std::endl;
+  }
+
+  return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, const char **argv)
+{
+  // CUTLASS must be compiled with CUDA 11.0 Toolkit to run these examples.
+  if (!(__CUDACC_VER_MAJOR__ >= 11)) {
+    std::cerr << "Ampere Tensor Core operations must be compiled with CUDA 11.0 Toolkit or later." << std::endl;
+
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (!((props.major * 10 + props.minor) >= 80))
+  {
+    std::cerr << "Ampere Tensor Core operations must be run on a machine with compute capability at least 80."
+              << std::endl;
+
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  Options options("75_ampere_int8_gemm_with_per_token_per_channel_scale");
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (!options.valid()) {
+    std::cerr << "Invalid problem." << std::endl;
+    return -1;
+  }
+
+  std::cout <<
+    options.iterations << " timing iterations of " <<
+    options.problem_size.m() << " x " <<
+    options.problem_size.n() << " x " <<
+    options.problem_size.k() << " int8 matrix-matrix multiply" << std::endl;
+
+  //
+  // Initialize GEMM datasets
+  //
+
+  options.tensor_a.resize(options.problem_size.mk());
+  options.tensor_b.resize(options.problem_size.kn());
+  options.tensor_scale_token.resize({1, options.problem_size.m()});
+  options.tensor_scale_channel.resize({1, options.problem_size.n()});
+  options.tensor_ref_acc.resize(options.problem_size.mn());
+
+  cutlass::reference::host::TensorFillRandomUniform(
+      options.tensor_a.host_view(), 1, ElementA(4), ElementA(-4), 0);
+  cutlass::reference::host::TensorFillRandomUniform(
+      options.tensor_b.host_view(), 2, ElementB(4), ElementB(-4), 0);
+
+  // Scales of the magnitude produced by symmetric absmax quantization
+  cutlass::reference::host::TensorFillRandomUniform(
+      options.tensor_scale_token.host_view(), 3, ElementScale(1.0f / 32), ElementScale(1.0f / 512), -1);
+  cutlass::reference::host::TensorFillRandomUniform(
+      options.tensor_scale_channel.host_view(), 4, ElementScale(1.0f / 32), ElementScale(1.0f / 512), -1);
+
+  options.tensor_a.sync_device();
+  options.tensor_b.sync_device();
+  options.tensor_scale_token.sync_device();
+  options.tensor_scale_channel.sync_device();
+
+  //
+  // Compute reference accumulators
+  //
+
+  DeviceGemmReference gemm_reference;
+  gemm_reference(
+    options.problem_size,
+    ElementAccumulator(1),
+    options.tensor_a.device_ref(),
+    options.tensor_b.device_ref(),
+    ElementAccumulator(0),
+    options.tensor_ref_acc.device_ref(),
+    options.tensor_ref_acc.device_ref());
+
+  CUDA_CHECK(cudaDeviceSynchronize());
+  options.tensor_ref_acc.sync_host();
+
+  //
+  // Evaluate the fused kernels
+  //
+
+  Result fp16 = run<Int8GemmWithTokenChannelScale<cutlass::half_t>>(
+      "S8 x S8 -> S32 accumulate, per-token/per-channel scale -> F16", options);
+  Result bf16 = run<Int8GemmWithTokenChannelScale<cutlass::bfloat16_t>>(
+      "S8 x S8 -> S32 accumulate, per-token/per-channel scale -> BF16", options);
+
+  return (fp16.passed && bf16.passed) ? 0 : -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,498 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Hopper GEMM-softmax-GEMM for long-N softmax heads using CUTLASS 3.x APIs.
+
+    This example computes
+
+      P = softmax(alpha0 * A @ B0^T + bias0)      (softmax along the N0 mode)
+      D = alpha1 * P @ B1^T + bias1
+
+    in a single warp-specialized kernel, without ever writing the M x N0 logits to global memory.
+    It covers routing and classifier heads followed by a projection, as well as the softmax
+    attention variants where the key and value widths differ (K0 != N1), which do not fit the
+    head dimension constraints of examples/66_hopper_fmha.
+
+    The kernel is the one of 76_hopper_b2b_gemm with a different mainloop. Each CTA owns a
+    128-row block of A and loops over the N0 tiles of the logits. For each of them, A and B0 are
+    streamed along K0 through TMA, the logits are accumulated with shared memory sourced GMMAs,
+    and an online softmax updates the running row max and row sum. The un-normalized probabilities
+    are converted to 16b in place, and feed register sourced GMMAs accumulating P @ B1^T, which is
+    rescaled as the row max grows. The GMMAs of P @ B1^T for an N0 tile are issued ahead of the
+    logits of the next one, so the softmax is the only part of the loop not overlapped with
+    tensor core work. The output is normalized once, at the end.
+
+    Compared to a GEMM writing the logits, a softmax kernel and a second GEMM, this saves the
+    write and the two reads of an M x N0 matrix, which dominate when N0 is large.
+
+    Limitations:
+      1) N1 (the output width) must not exceed the N1 extent of the CTA tile (128), the whole
+         128 x N1 block of D is held in registers.
+      2) alpha0 must be positive.
+      3) A is reloaded for every N0 tile, from L2 for all but the first.
+
+    Examples:
+
+      $ ./examples/76_hopper_b2b_gemm/76_hopper_gemm_softmax_gemm --m=2048 --k0=1024 --n0=16384 --n1=128
+
+      $ ./examples/76_hopper_b2b_gemm/76_hopper_gemm_softmax_gemm --m=1000 --k0=200 --n0=3000 --n1=72 --l=2
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/gemm/gemm.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/distribution.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+#include "collective/sm90_gemm_softmax_gemm_mainloop_tma_warpspecialized.hpp"
+#include "collective/sm90_b2b_gemm_epilogue_tma.hpp"
+#include "kernel/sm90_b2b_gemm_tma_warpspecialized.hpp"
+#include "device/b2b_gemm_adapter.hpp"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Element             = cutlass::half_t;                                // Element type of A, B0, B1, the probabilities and D
+using ElementAccumulator  = float;                                          // Element type for internal accumulation and the softmax
+
+// A is (M, K0, L) and row-major, B0 is (N0, K0, L) and B1 is (N1, N0, L), both K-major like
+// the weights of a linear layer, and D is (M, N1, L) and row-major
+using StrideA             = cutlass::gemm::TagToStrideA_t<cutlass::layout::RowMajor>;
+using StrideB             = cutlass::gemm::TagToStrideB_t<cutlass::layout::ColumnMajor>;
+using StrideD             = cutlass::gemm::TagToStrideC_t<cutlass::layout::RowMajor>;
+
+using TileShape           = Shape<_128,_128,_64,_128>;                      // (BlkM, BlkN0, BlkK0, BlkN1)
+constexpr int Stages0     = 3;                                              // Stages of A/B0 along K0
+constexpr int Stages1     = 2;                                              // Stages of B1 along N0
+
+using CollectiveMainloop = cutlass::gemm::collective::Sm90GemmSoftmaxGemmMainloopTmaWarpspecialized<
+    Element, ElementAccumulator, TileShape, StrideA, StrideB, StrideB, Stages0, Stages1>;
+
+using CollectiveEpilogue = cutlass::gemm::collective::Sm90B2bGemmEpilogueTma<
+    Element, ElementAccumulator, TileShape, StrideD,
+    cutlass::epilogue::thread::Identity, CollectiveMainloop::NumMmaThreads>;
+
+using GemmKernel = cutlass::gemm::kernel::Sm90B2bGemmTmaWarpspecialized<
+    cute::tuple<int,int,int,int,int>,     // (M, N0, K0, N1, L)
+    CollectiveMainloop,
+    CollectiveEpilogue>;
+
+using GemmSoftmaxGemm = cutlass::gemm::device::B2bGemmAdapter<GemmKernel>;
+
+// Reference device GEMM implementation type, computes each GEMM of the chain in FP32
+using DeviceGemmReference = cutlass::reference::device::Gemm<
+  Element,
+  cutlass::layout::RowMajor,
+  Element,
+  cutlass::layout::ColumnMajor,
+  ElementAccumulator,
+  cutlass::layout::RowMajor,
+  ElementAccumulator,
+  ElementAccumulator>;
+
+//
+// Data members
+//
+
+/// Initialization
+StrideA stride_A;
+StrideB stride_B0;
+StrideB stride_B1;
+StrideD stride_D;
+uint64_t seed;
+
+cutlass::DeviceAllocation<Element> block_A;
+cutlass::DeviceAllocation<Element> block_B0;
+cutlass::DeviceAllocation<Element> block_B1;
+cutlass::DeviceAllocation<Element> block_bias0;
+cutlass::DeviceAllocation<Element> block_bias1;
+cutlass::DeviceAllocation<Element> block_D;
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  int iterations = 10;
+  int m = 2048, k0 = 1024, n0 = 16384, n1 = 128, l = 1;
+  float alpha0 = 0.f, alpha1 = 1.f;
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("k0", k0);
+    cmd.get_cmd_line_argument("n0", n0);
+    cmd.get_cmd_line_argument("n1", n1);
+    cmd.get_cmd_line_argument("l", l);
+    cmd.get_cmd_line_argument("alpha0", alpha0);
+    cmd.get_cmd_line_argument("alpha1", alpha1);
+    cmd.get_cmd_line_argument("iterations", iterations);
+
+    // Same default as the softmax scale of attention, keeps the logits in a reasonable range
+    if (alpha0 == 0.f) {
+      alpha0 = 1.f / std::sqrt(static_cast<float>(k0));
+    }
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "76_hopper_gemm_softmax_gemm\n\n"
+      << "  Hopper fused GEMM-softmax-GEMM computing alpha1 * softmax(alpha0 * A @ B0^T + bias0) @ B1^T + bias1 in one kernel.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of both GEMMs (number of rows)\n"
+      << "  --k0=<int>                  Sets the K extent of the first GEMM\n"
+      << "  --n0=<int>                  Sets the N extent of the first GEMM, along which the softmax is taken\n"
+      << "  --n1=<int>                  Sets the N extent of the second GEMM (output width), at most 128\n"
+      << "  --l=<int>                   The number of independent problems\n"
+      << "  --alpha0=<f32>              Scale of the logits, defaults to 1/sqrt(k0)\n"
+      << "  --alpha1=<f32>              Scale of the second GEMM\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "76_hopper_gemm_softmax_gemm" << " --m=2048 --k0=1024 --n0=16384 --n1=128\n\n";
+
+    return out;
+  }
+
+  /// Compute performance in GFLOP/s
+  double gflops(double runtime_s) const
+  {
+    // Two flops per multiply-add, for both GEMMs of the chain
+    uint64_t flop = uint64_t(2) * uint64_t(m) * (uint64_t(n0) * uint64_t(k0) + uint64_t(n1) * uint64_t(n0)) * uint64_t(l);
+    double gflop = double(flop) / double(1.0e9);
+    return gflop / runtime_s;
+  }
+};
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms = 0.0;
+  double gflops = 0.0;
+  cutlass::Status status = cutlass::Status::kSuccess;
+  cudaError_t error = cudaSuccess;
+  bool passed = false;
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Helper to initialize a block of device data
+template <class Element>
+bool initialize_block(
+  cutlass::DeviceAllocation<Element>& block,
+  uint64_t seed=2023) {
+
+  Element scope_max = static_cast<Element>(2);
+  Element scope_min = static_cast<Element>(-2);
+
+  cutlass::reference::device::BlockFillRandomUniform(
+    block.get(), block.size(), seed, scope_max, scope_min, 0);
+
+  return true;
+}
+
+/// Initialize operands to be used in the GEMM and reference GEMM
+void initialize(Options const& options) {
+
+  stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(options.m, options.k0, options.l));
+  stride_B0 = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(options.n0, options.k0, options.l));
+  stride_B1 = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(options.n1, options.n0, options.l));
+  stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(options.m, options.n1, options.l));
+
+  block_A.reset(static_cast<int64_t>(options.m) * options.k0 * options.l);
+  block_B0.reset(static_cast<int64_t>(options.n0) * options.k0 * options.l);
+  block_B1.reset(static_cast<int64_t>(options.n1) * options.n0 * options.l);
+  block_bias0.reset(options.n0);
+  block_bias1.reset(options.n1);
+  block_D.reset(static_cast<int64_t>(options.m) * options.n1 * options.l);
+
+  initialize_block(block_A, seed + 2023);
+  initialize_block(block_B0, seed + 2022);
+  initialize_block(block_B1, seed + 2021);
+  initialize_block(block_bias0, seed + 2020);
+  initialize_block(block_bias1, seed + 2019);
+}
+
+/// Populates a GemmSoftmaxGemm::Arguments structure from the given commandline options
+typename GemmSoftmaxGemm::Arguments args_from_options(Options const& options)
+{
+  typename GemmSoftmaxGemm::Arguments arguments {
+    {options.m, options.n0, options.k0, options.n1, options.l},
+    {
+      block_A.get(), stride_A,
+      block_B0.get(), stride_B0,
+      block_B1.get(), stride_B1,
+      options.alpha0, block_bias0.get()
+    },
+    {block_D.get(), stride_D, options.alpha1, block_bias1.get()}
+  };
+
+  return arguments;
+}
+
+bool verify(Options const& options) {
+  int64_t const size_MK0 = static_cast<int64_t>(options.m) * options.k0;
+  int64_t const size_N0K0 = static_cast<int64_t>(options.n0) * options.k0;
+  int64_t const size_MN0 = static_cast<int64_t>(options.m) * options.n0;
+  int64_t const size_N1N0 = static_cast<int64_t>(options.n1) * options.n0;
+  int64_t const size_MN1 = static_cast<int64_t>(options.m) * options.n1;
+
+  std::vector<Element> bias0_host(block_bias0.size());
+  std::vector<Element> bias1_host(block_bias1.size());
+  block_bias0.copy_to_host(bias0_host.data());
+  block_bias1.copy_to_host(bias1_host.data());
+
+  // The unfused chain: logits, softmax on the host, then the second GEMM
+  cutlass::DeviceAllocation<ElementAccumulator> block_ref_logits(size_MN0 * options.l);
+  for (int l = 0; l < options.l; ++l) {
+    cutlass::TensorRef ref_A(block_A.get() + l * size_MK0, cutlass::layout::RowMajor::packed({options.m, options.k0}));
+    cutlass::TensorRef ref_B0(block_B0.get() + l * size_N0K0, cutlass::layout::ColumnMajor::packed({options.k0, options.n0}));
+    cutlass::TensorRef ref_logits(block_ref_logits.get() + l * size_MN0, cutlass::layout::RowMajor::packed({options.m, options.n0}));
+
+    DeviceGemmReference gemm_reference;
+    gemm_reference({options.m, options.n0, options.k0}, options.alpha0, ref_A, ref_B0, ElementAccumulator(0), ref_logits, ref_logits);
+  }
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  std::vector<ElementAccumulator> logits_host(block_ref_logits.size());
+  block_ref_logits.copy_to_host(logits_host.data());
+
+  std::vector<Element> P_host(logits_host.size());
+  for (int64_t row = 0; row < static_cast<int64_t>(options.m) * options.l; ++row) {
+    ElementAccumulator* logits = logits_host.data() + row * options.n0;
+    ElementAccumulator row_max = -std::numeric_limits<ElementAccumulator>::infinity();
+    for (int n0 = 0; n0 < options.n0; ++n0) {
+      logits[n0] += static_cast<ElementAccumulator>(bias0_host.at(n0));
+      row_max = std::max(row_max, logits[n0]);
+    }
+    ElementAccumulator row_sum = 0;
+    for (int n0 = 0; n0 < options.n0; ++n0) {
+      logits[n0] = std::exp(logits[n0] - row_max);
+      row_sum += logits[n0];
+    }
+    for (int n0 = 0; n0 < options.n0; ++n0) {
+      P_host.at(row * options.n0 + n0) = static_cast<Element>(logits[n0] / row_sum);
+    }
+  }
+
+  cutlass::DeviceAllocation<Element> block_ref_P(P_host.size());
+  block_ref_P.copy_from_host(P_host.data());
+
+  cutlass::DeviceAllocation<ElementAccumulator> block_ref_acc1(size_MN1 * options.l);
+  for (int l = 0; l < options.l; ++l) {
+    cutlass::TensorRef ref_P(block_ref_P.get() + l * size_MN0, cutlass::layout::RowMajor::packed({options.m, options.n0}));
+    cutlass::TensorRef ref_B1(block_B1.get() + l * size_N1N0, cutlass::layout::ColumnMajor::packed({options.n0, options.n1}));
+    cutlass::TensorRef ref_acc1(block_ref_acc1.get() + l * size_MN1, cutlass::layout::RowMajor::packed({options.m, options.n1}));
+
+    DeviceGemmReference gemm_reference;
+    gemm_reference({options.m, options.n1, options.n0}, options.alpha1, ref_P, ref_B1, ElementAccumulator(0), ref_acc1, ref_acc1);
+  }
+
+  // Wait for kernels to finish
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  std::vector<ElementAccumulator> acc1_host(block_ref_acc1.size());
+  std::vector<Element> D_host(block_D.size());
+  block_ref_acc1.copy_to_host(acc1_host.data());
+  block_D.copy_to_host(D_host.data());
+
+  // The fused kernel rounds the un-normalized probabilities to 16b and the reference the
+  // normalized ones, compare with a relative tolerance
+  float const epsilon = 1e-2f;
+  float const non_zero_floor = 1e-2f;
+  for (size_t i = 0; i < D_host.size(); ++i) {
+    int n1 = static_cast<int>(i % options.n1);
+    float expected = static_cast<float>(static_cast<Element>(acc1_host.at(i) + static_cast<float>(bias1_host.at(n1))));
+    float got = static_cast<float>(D_host.at(i));
+    float diff = std::abs(expected - got);
+    if (diff > non_zero_floor && diff > epsilon * std::abs(expected)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/// Execute the fused GEMM-softmax-GEMM
+int run(Options &options)
+{
+  initialize(options);
+
+  // Instantiate CUTLASS kernel depending on templates
+  GemmSoftmaxGemm gemm;
+
+  // Create a structure of kernel arguments suitable for invoking an instance of GemmSoftmaxGemm
+  auto arguments = args_from_options(options);
+
+  // Using the arguments, query for extra workspace required by the kernel
+  size_t workspace_size = GemmSoftmaxGemm::get_workspace_size(arguments);
+
+  // Allocate workspace memory
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(gemm.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  Result result;
+  result.passed = verify(options);
+
+  std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+  if (!result.passed) {
+    exit(-1);
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0)
+  {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(gemm.run());
+    }
+    timer.stop();
+
+    // Compute average runtime and GFLOPs.
+    float elapsed_ms       = timer.elapsed_millis();
+    result.avg_runtime_ms  = double(elapsed_ms) / double(options.iterations);
+    result.gflops          = options.gflops(result.avg_runtime_ms / 1000.0);
+
+    std::cout << "  Problem Size: " << options.m << 'x' << options.k0 << " -> softmax(" << options.n0 << ") -> " << options.n1
+              << " x " << options.l << std::endl;
+    std::cout << "  Avg runtime : " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  GFLOPS      : " << result.gflops << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major < 9) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture or "
+      << "later (compute capability 90 or greater).\n";
+    return 0;
+  }
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  if (options.n1 > size<3>(TileShape{})) {
+    std::cerr << "N1 must not exceed the N1 extent of the CTA tile (got --n1=" << options.n1 << ").\n";
+    return -1;
+  }
+
+  run(options);
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,127 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Helpers shared by the Hopper back-to-back GEMM collectives: a GMMA issue wrapper and
+    conversions of the accumulator layout of a GMMA into the (row, col) view used by row-wise
+    reductions and into the layout of a register sourced A operand.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/arch/mma_sm90_desc.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Issues a batch of GMMAs for C = A * B (or C += A * B if ZeroInit is false) over all K blocks
+/// of the fragments, and commits it. Callers are responsible for waiting on the batch.
+template <bool ZeroInit, class TiledMma, class FrgTensorA, class FrgTensorB, class FrgTensorC>
+CUTLASS_DEVICE void
+b2b_gemm_and_commit(TiledMma& tiled_mma, FrgTensorA const& tCrA, FrgTensorB const& tCrB, FrgTensorC& tCrC) {
+  constexpr bool IsRegisterSourcedA =
+    not cute::is_base_of<GMMA::DescriptorIterator, typename TiledMma::FrgTypeA>::value;
+  if constexpr (IsRegisterSourcedA) {
+    warpgroup_fence_operand(const_cast<FrgTensorA&>(tCrA));
+  }
+  warpgroup_fence_operand(tCrC);
+  warpgroup_arrive();
+  if constexpr (ZeroInit) {
+    tiled_mma.accumulate_ = GMMA::ScaleOut::Zero;
+  }
+  CUTLASS_PRAGMA_UNROLL
+  for (int k_block = 0; k_block < size<2>(tCrA); ++k_block) {
+    // (V,M,K) x (V,N,K) => (V,M,N)
+    cute::gemm(tiled_mma, tCrA(_,_,k_block), tCrB(_,_,k_block), tCrC);
+    tiled_mma.accumulate_ = GMMA::ScaleOut::One;
+  }
+  warpgroup_commit_batch();
+  warpgroup_fence_operand(tCrC);
+  if constexpr (IsRegisterSourcedA) {
+    warpgroup_fence_operand(const_cast<FrgTensorA&>(tCrA));
+  }
+}
+
+/// Views a GMMA accumulator layout ((2,2,N/8),MMA_M,MMA_N) as the layout ((2,2,2),MMA_M,MMA_K)
+/// of a register sourced 16b A operand, so that the accumulator of the first GEMM feeds the A
+/// operand of the second without any data movement
+template <class Layout>
+CUTE_HOST_DEVICE constexpr auto
+b2b_convert_c_layout_to_a_layout(Layout const& acc_layout) {
+  static_assert(decltype(rank(acc_layout))::value == 3, "Expected a (MMA,MMA_M,MMA_N) accumulator");
+  static_assert(decltype(size<0,0>(acc_layout))::value == 2, "Expected a GMMA accumulator");
+  static_assert(decltype(size<0,1>(acc_layout))::value == 2, "Expected a GMMA accumulator");
+  // (2,2,(2,N/16))
+  auto l = logical_divide(get<0>(acc_layout), Shape<Underscore,Underscore,_2>{});
+  return make_layout(
+    make_layout(get<0>(l), get<1>(l), get<2,0>(l)),
+    get<1>(acc_layout),
+    make_layout(get<2,1>(l), get<2>(acc_layout)));
+}
+
+/// Views a GMMA accumulator layout ((2,2,N/8),MMA_M,MMA_N) as ((2,MMA_M),(2,N/8,MMA_N)), i.e.
+/// (row, col) of the values held by a thread
+template <class Layout>
+CUTE_HOST_DEVICE constexpr auto
+b2b_convert_c_layout_to_rowcol(Layout const& acc_layout) {
+  static_assert(decltype(rank(acc_layout))::value == 3, "Expected a (MMA,MMA_M,MMA_N) accumulator");
+  static_assert(decltype(rank<0>(acc_layout))::value == 3, "Expected a GMMA accumulator");
+  return make_layout(
+    make_layout(get<0,1>(acc_layout), get<1>(acc_layout)),
+    make_layout(get<0,0>(acc_layout), get<0,2>(acc_layout), get<2>(acc_layout)));
+}
+
+/// Reduces a value across the 4 threads of a quad, which hold the same rows of a GMMA accumulator
+template <class T, class ReductionOp>
+CUTLASS_DEVICE T
+b2b_quad_allreduce(T value, ReductionOp const& op) {
+  value = op(value, __shfl_xor_sync(0xffffffff, value, 1));
+  value = op(value, __shfl_xor_sync(0xffffffff, value, 2));
+  return value;
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
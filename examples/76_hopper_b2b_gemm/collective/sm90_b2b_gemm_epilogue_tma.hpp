@@ -0,0 +1,220 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Epilogue of the Hopper back-to-back GEMM: each (BlkM, BlkN1) tile of
+    D = act1(alpha1 * D0 * B1^T + bias1) is staged in shared memory and written with a TMA store.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/trace.h"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/gemm/collective/builders/sm90_common.inl"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/copy_traits_sm90_tma.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class Element_,
+  class ElementAccumulator_,
+  class TileShape_,             // (BlkM, BlkN0, BlkK0, BlkN1)
+  class StrideD_,               // (M, N1, L)
+  template <class> class Activation1_ = cutlass::epilogue::thread::Identity,
+  int NumMmaThreads_ = 256
+>
+struct Sm90B2bGemmEpilogueTma {
+  //
+  // Type Aliases
+  //
+  using Element = Element_;
+  using ElementAccumulator = ElementAccumulator_;
+  using TileShape = TileShape_;
+  using StrideD = StrideD_;
+  using Activation1 = Activation1_<ElementAccumulator>;
+  static constexpr int NumMmaThreads = NumMmaThreads_;
+
+  // D tile : (BlkM, BlkN1), N1 is the contiguous mode
+  using TileShapeD = decltype(select<0,3>(TileShape{}));
+
+  using SmemLayoutAtomD = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, decltype(get<0>(TileShapeD{})), decltype(get<1>(TileShapeD{}))>());
+  using SmemLayoutD = decltype(tile_to_shape(SmemLayoutAtomD{}, TileShapeD{}));
+
+  struct TensorStorage : cute::aligned_struct<128, _0> {
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutD>> smem_d;
+  };
+
+  // Host side epilogue arguments
+  struct Arguments {
+    Element* ptr_D;
+    StrideD dD;
+    // D = act1(alpha1 * D0 * B1^T + bias1), the bias is a vector of N1 elements and is optional
+    ElementAccumulator alpha1 = ElementAccumulator(1);
+    Element const* ptr_bias1 = nullptr;
+  };
+
+  // Device side epilogue params
+  struct Params {
+    using TMA_D = decltype(make_tma_copy(
+        SM90_TMA_STORE{},
+        make_tensor(make_gmem_ptr(static_cast<Element*>(nullptr)), repeat_like(StrideD{}, int32_t(0)), StrideD{}),
+        SmemLayoutD{},
+        TileShapeD{},
+        _1{}));
+
+    TMA_D tma_store_d;
+    ElementAccumulator alpha1;
+    Element const* ptr_bias1;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+    auto [M, N0, K0, N1, L] = problem_shape;
+
+    Tensor mD = make_tensor(make_gmem_ptr(args.ptr_D), make_layout(make_shape(M, N1, L), args.dD));
+    auto tma_store_d = make_tma_copy(SM90_TMA_STORE{}, mD, SmemLayoutD{}, TileShapeD{}, _1{});
+
+    return {
+      tma_store_d,
+      args.alpha1,
+      args.ptr_bias1
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    constexpr int min_tma_aligned_elements = tma_alignment_bits / cutlass::sizeof_bits<Element>::value;
+
+    bool implementable =
+      get<0>(args.dD) % min_tma_aligned_elements == 0 &&
+      get<2>(args.dD) % min_tma_aligned_elements == 0;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+    }
+    return implementable;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& params) {
+    cute::prefetch_tma_descriptor(params.tma_store_d.get_tma_descriptor());
+  }
+
+  /// Writes the D tile at blk_coord = (m_tile, n1_tile, l). Must be called by all the
+  /// NumMmaThreads math threads, thread_idx being the index among them.
+  template <class BlkCoord, class ProblemShape, class FrgD, class TiledMma>
+  CUTLASS_DEVICE void
+  store(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      Params const& params,
+      FrgD const& tCrD,
+      TiledMma const& tiled_mma,
+      int thread_idx,
+      Element* smem_d) {
+    auto [M, N0, K0, N1, L] = problem_shape;
+    auto [m_coord, n1_coord, l_coord] = blk_coord;
+
+    Tensor sD = make_tensor(make_smem_ptr(smem_d), SmemLayoutD{});                             // (BLK_M,BLK_N1)
+    auto thread_mma = tiled_mma.get_thread_slice(thread_idx);
+    Tensor tCsD = thread_mma.partition_C(sD);                                                  // (MMA,MMA_M,MMA_N1)
+
+    Tensor cD = make_identity_tensor(TileShapeD{});                                            // (BLK_M,BLK_N1)
+    Tensor tCcD = thread_mma.partition_C(cD);                                                  // (MMA,MMA_M,MMA_N1)
+
+    // The staging buffer may still be read by the TMA store of the previous tile
+    if (thread_idx == 0) {
+      tma_store_wait<0>();
+    }
+    cutlass::arch::NamedBarrier::sync(NumMmaThreads, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier);
+
+    Activation1 activation1;
+    cutlass::NumericConverter<Element, ElementAccumulator, FloatRoundStyle::round_to_nearest> convert;
+    int n1_offset = int(n1_coord) * int(get<1>(TileShapeD{}));
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(tCrD); ++i) {
+      ElementAccumulator value = params.alpha1 * tCrD(i);
+      int n1 = n1_offset + get<1>(tCcD(i));
+      if (params.ptr_bias1 != nullptr && n1 < N1) {
+        value += static_cast<ElementAccumulator>(params.ptr_bias1[n1]);
+      }
+      tCsD(i) = convert(activation1(value));
+    }
+
+    // Make the smem writes visible to the TMA unit before the store is issued
+    cutlass::arch::fence_view_async_shared();
+    cutlass::arch::NamedBarrier::sync(NumMmaThreads, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier);
+
+    if (thread_idx == 0) {
+      Tensor mD = params.tma_store_d.get_tma_tensor(make_shape(M, N1, L));                     // (m,n1,l)
+      Tensor gD = local_tile(mD(_,_,l_coord), TileShapeD{}, make_coord(m_coord, n1_coord));    // (BLK_M,BLK_N1)
+
+      auto cta_tma_d = params.tma_store_d.get_slice(_0{});
+      // Out of bounds rows and columns of the residue tiles are clipped by the TMA unit
+      copy(params.tma_store_d, cta_tma_d.partition_S(sD), cta_tma_d.partition_D(gD));
+      tma_store_arrive();
+    }
+  }
+
+  /// Waits for the last TMA store to read the staging buffer before the CTA exits
+  CUTLASS_DEVICE void
+  store_tail(int thread_idx) {
+    if (thread_idx == 0) {
+      tma_store_wait<0>();
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
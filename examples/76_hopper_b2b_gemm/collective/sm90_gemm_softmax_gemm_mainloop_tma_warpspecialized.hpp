@@ -0,0 +1,576 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Mainloop of the Hopper GEMM-softmax-GEMM: P = softmax(alpha0 * A * B0^T + bias0) along
+    N0 is computed one N0 tile at a time with an online softmax, and each tile of P is kept in
+    registers as the A operand of the register sourced GMMAs accumulating P * B1^T. No tile of
+    the logits ever leaves the SM.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/trace.h"
+#include "cutlass/gemm/collective/builders/sm90_common.inl"
+
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/atom/copy_traits_sm90_tma.hpp"
+
+#include "b2b_gemm_common.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class Element_,
+  class ElementAccumulator_,
+  class TileShape_,             // (BlkM, BlkN0, BlkK0, BlkN1)
+  class StrideA_,               // (M, K0, L)
+  class StrideB0_,              // (N0, K0, L)
+  class StrideB1_,              // (N1, N0, L)
+  int Stages0_ = 3,
+  int Stages1_ = 2
+>
+struct Sm90GemmSoftmaxGemmMainloopTmaWarpspecialized {
+  //
+  // Type Aliases
+  //
+  using Element = Element_;
+  using ElementAccumulator = ElementAccumulator_;
+  using TileShape = TileShape_;
+  using StrideA = StrideA_;
+  using StrideB0 = StrideB0_;
+  using StrideB1 = StrideB1_;
+  using ArchTag = cutlass::arch::Sm90;
+  using ClusterShape = Shape<_1,_1,_1>;
+  static constexpr int Stages0 = Stages0_;
+  static constexpr int Stages1 = Stages1_;
+
+  static constexpr int NumMmaWarpGroups = size<0>(TileShape{}) / 64;
+  static constexpr int NumMmaThreads = NumMmaWarpGroups * NumThreadsPerWarpGroup;
+
+  static_assert(rank(TileShape{}) == 4, "TileShape must be (BlkM, BlkN0, BlkK0, BlkN1)");
+  static_assert(size<0>(TileShape{}) % 64 == 0, "Each math warp group computes 64 rows of the tile.");
+  static_assert(sizeof_bits_v<Element> == 16, "P is sourced from registers by GMMA, which requires 16b inputs.");
+  static_assert(Stages0 >= 2, "Specialization requires Stages0 set to value 2 or more.");
+  static_assert(Stages1 >= 1, "Specialization requires Stages1 set to value 1 or more.");
+
+  // S = A * B0^T : (BlkM, BlkN0, BlkK0)
+  using TileShape0 = decltype(select<0,1,2>(TileShape{}));
+  // D = P * B1^T : (BlkM, BlkN1, BlkN0)
+  using TileShape1 = decltype(select<0,3,1>(TileShape{}));
+
+  using AtomLayoutMNK = Layout<Shape<Int<NumMmaWarpGroups>,_1,_1>>;
+  using TiledMma0 = decltype(cute::make_tiled_mma(
+      cute::GMMA::ss_op_selector<Element, Element, ElementAccumulator, TileShape0>(),
+      AtomLayoutMNK{}));
+  // P is sourced from registers, B1 is K-major
+  using TiledMma1 = decltype(cute::make_tiled_mma(
+      cute::GMMA::rs_op_selector<Element, Element, ElementAccumulator, TileShape1>(),
+      AtomLayoutMNK{}));
+
+  using SmemLayoutAtomA = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, decltype(get<0>(TileShape0{})), decltype(get<2>(TileShape0{}))>());
+  using SmemLayoutAtomB0 = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, decltype(get<1>(TileShape0{})), decltype(get<2>(TileShape0{}))>());
+  using SmemLayoutAtomB1 = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, Element, decltype(get<1>(TileShape1{})), decltype(get<2>(TileShape1{}))>());
+
+  using SmemLayoutA = decltype(tile_to_shape(
+      SmemLayoutAtomA{},
+      make_shape(get<0>(TileShape0{}), get<2>(TileShape0{}), Int<Stages0>{})));
+  using SmemLayoutB0 = decltype(tile_to_shape(
+      SmemLayoutAtomB0{},
+      make_shape(get<1>(TileShape0{}), get<2>(TileShape0{}), Int<Stages0>{})));
+  using SmemLayoutB1 = decltype(tile_to_shape(
+      SmemLayoutAtomB1{},
+      make_shape(get<1>(TileShape1{}), get<2>(TileShape1{}), Int<Stages1>{})));
+
+  // A and B0 are streamed along K0 for each N0 tile, B1 is streamed along N0 through its own stages
+  using MainloopPipeline0 = cutlass::PipelineTmaAsync<Stages0>;
+  using MainloopPipeline1 = cutlass::PipelineTmaAsync<Stages1>;
+  using PipelineState0 = cutlass::PipelineState<Stages0>;
+  using PipelineState1 = cutlass::PipelineState<Stages1>;
+
+  struct TensorStorage : cute::aligned_struct<128, _0> {
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutA>> smem_a;
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutB0>> smem_b0;
+    cute::array_aligned<Element, cute::cosize_v<SmemLayoutB1>> smem_b1;
+  };
+
+  struct PipelineStorage {
+    alignas(16) typename MainloopPipeline0::SharedStorage ab0;
+    alignas(16) typename MainloopPipeline1::SharedStorage b1;
+  };
+
+  static constexpr uint32_t TmaTransactionBytes0 =
+      cutlass::bits_to_bytes(size<0>(SmemLayoutA{}) * size<1>(SmemLayoutA{}) * static_cast<uint32_t>(sizeof_bits<Element>::value)) +
+      cutlass::bits_to_bytes(size<0>(SmemLayoutB0{}) * size<1>(SmemLayoutB0{}) * static_cast<uint32_t>(sizeof_bits<Element>::value));
+  static constexpr uint32_t TmaTransactionBytes1 =
+      cutlass::bits_to_bytes(size<0>(SmemLayoutB1{}) * size<1>(SmemLayoutB1{}) * static_cast<uint32_t>(sizeof_bits<Element>::value));
+
+  // Host side kernel arguments
+  struct Arguments {
+    Element const* ptr_A;
+    StrideA dA;
+    Element const* ptr_B0;
+    StrideB0 dB0;
+    Element const* ptr_B1;
+    StrideB1 dB1;
+    // P = softmax(alpha0 * A * B0^T + bias0) along N0, the bias is a vector of N0 elements and
+    // is optional. alpha0 is the inverse temperature of the softmax and must be positive.
+    ElementAccumulator alpha0 = ElementAccumulator(1);
+    Element const* ptr_bias0 = nullptr;
+  };
+
+  // Device side kernel params
+  struct Params {
+    using TMA_A = decltype(make_tma_copy(
+        SM90_TMA_LOAD{},
+        make_tensor(make_gmem_ptr(static_cast<Element const*>(nullptr)), repeat_like(StrideA{}, int32_t(0)), StrideA{}),
+        SmemLayoutA{}(_,_,_0{}),
+        select<0,2>(TileShape0{}),
+        _1{}));
+    using TMA_B0 = decltype(make_tma_copy(
+        SM90_TMA_LOAD{},
+        make_tensor(make_gmem_ptr(static_cast<Element const*>(nullptr)), repeat_like(StrideB0{}, int32_t(0)), StrideB0{}),
+        SmemLayoutB0{}(_,_,_0{}),
+        select<1,2>(TileShape0{}),
+        _1{}));
+    using TMA_B1 = decltype(make_tma_copy(
+        SM90_TMA_LOAD{},
+        make_tensor(make_gmem_ptr(static_cast<Element const*>(nullptr)), repeat_like(StrideB1{}, int32_t(0)), StrideB1{}),
+        SmemLayoutB1{}(_,_,_0{}),
+        select<1,2>(TileShape1{}),
+        _1{}));
+
+    TMA_A tma_load_a;
+    TMA_B0 tma_load_b0;
+    TMA_B1 tma_load_b1;
+    ElementAccumulator alpha0;
+    Element const* ptr_bias0;
+    // alpha0 * log2(e), the softmax is evaluated with exp2
+    ElementAccumulator alpha0_log2;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+    auto [M, N0, K0, N1, L] = problem_shape;
+
+    Tensor mA = make_tensor(make_gmem_ptr(args.ptr_A), make_layout(make_shape(M, K0, L), args.dA));
+    Tensor mB0 = make_tensor(make_gmem_ptr(args.ptr_B0), make_layout(make_shape(N0, K0, L), args.dB0));
+    Tensor mB1 = make_tensor(make_gmem_ptr(args.ptr_B1), make_layout(make_shape(N1, N0, L), args.dB1));
+
+    auto tma_load_a = make_tma_copy(SM90_TMA_LOAD{}, mA, SmemLayoutA{}(_,_,_0{}), select<0,2>(TileShape0{}), _1{});
+    auto tma_load_b0 = make_tma_copy(SM90_TMA_LOAD{}, mB0, SmemLayoutB0{}(_,_,_0{}), select<1,2>(TileShape0{}), _1{});
+    auto tma_load_b1 = make_tma_copy(SM90_TMA_LOAD{}, mB1, SmemLayoutB1{}(_,_,_0{}), select<1,2>(TileShape1{}), _1{});
+
+    return {
+      tma_load_a,
+      tma_load_b0,
+      tma_load_b1,
+      args.alpha0,
+      args.ptr_bias0,
+      args.alpha0 * static_cast<ElementAccumulator>(M_LOG2E)
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    constexpr int min_tma_aligned_elements = tma_alignment_bits / cutlass::sizeof_bits<Element>::value;
+    auto [M, N0, K0, N1, L] = problem_shape;
+
+    // The output accumulators of a row block are held in registers across all the N0 tiles
+    bool implementable = N1 > 0 && N1 <= size<3>(TileShape{}) && N0 > 0 && K0 > 0;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: N1 must not exceed the N1 extent of the tile shape.\n");
+      return implementable;
+    }
+
+    // The row max of the online softmax is taken over the unscaled logits
+    implementable = args.alpha0 > ElementAccumulator(0);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: The softmax scale alpha0 must be positive.\n");
+      return implementable;
+    }
+
+    auto is_aligned = [&](auto const& stride) {
+      return get<0>(stride) % min_tma_aligned_elements == 0 &&
+             get<2>(stride) % min_tma_aligned_elements == 0;
+    };
+    implementable = is_aligned(args.dA) && is_aligned(args.dB0) && is_aligned(args.dB1);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+    }
+    return implementable;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& params) {
+    cute::prefetch_tma_descriptor(params.tma_load_a.get_tma_descriptor());
+    cute::prefetch_tma_descriptor(params.tma_load_b0.get_tma_descriptor());
+    cute::prefetch_tma_descriptor(params.tma_load_b1.get_tma_descriptor());
+  }
+
+  /// For each N0 tile, streams A/B0 along K0 and then the matching tile of B1, for the tile at
+  /// blk_coord = (m_tile, _, l)
+  /// Producer Perspective
+  template <class BlkCoord, class ProblemShape>
+  CUTLASS_DEVICE void
+  load(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      Params const& params,
+      MainloopPipeline0& pipeline0,
+      PipelineState0& smem_pipe_write0,
+      MainloopPipeline1& pipeline1,
+      PipelineState1& smem_pipe_write1,
+      TensorStorage& shared_tensors) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      auto [M, N0, K0, N1, L] = problem_shape;
+      auto m_coord = get<0>(blk_coord);
+      auto l_coord = get<2>(blk_coord);
+
+      Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_a.data()), SmemLayoutA{});     // (BLK_M,BLK_K0,PIPE)
+      Tensor sB0 = make_tensor(make_smem_ptr(shared_tensors.smem_b0.data()), SmemLayoutB0{});  // (BLK_N0,BLK_K0,PIPE)
+      Tensor sB1 = make_tensor(make_smem_ptr(shared_tensors.smem_b1.data()), SmemLayoutB1{});  // (BLK_N1,BLK_N0,PIPE)
+
+      // TMA requires special handling of strides to deal with coord codomain mapping
+      // Represent the full tensors -- get these from TMA
+      Tensor mA = params.tma_load_a.get_tma_tensor(make_shape(M, K0, L));                      // (m,k0,l)
+      Tensor mB0 = params.tma_load_b0.get_tma_tensor(make_shape(N0, K0, L));                   // (n0,k0,l)
+      Tensor mB1 = params.tma_load_b1.get_tma_tensor(make_shape(N1, N0, L));                   // (n1,n0,l)
+
+      Tensor gA = local_tile(mA(_,_,l_coord), select<0,2>(TileShape0{}), make_coord(m_coord, _));  // (BLK_M,BLK_K0,k0)
+      Tensor gB0 = local_tile(mB0(_,_,l_coord), select<1,2>(TileShape0{}), make_coord(_, _));      // (BLK_N0,BLK_K0,n0,k0)
+      Tensor gB1 = local_tile(mB1(_,_,l_coord), select<1,2>(TileShape1{}), make_coord(_0{}, _));   // (BLK_N1,BLK_N0,n0)
+
+      auto cta_tma_a = params.tma_load_a.get_slice(_0{});
+      auto cta_tma_b0 = params.tma_load_b0.get_slice(_0{});
+      auto cta_tma_b1 = params.tma_load_b1.get_slice(_0{});
+
+      Tensor tAgA = cta_tma_a.partition_S(gA);                                                 // (TMA,TMA_M,TMA_K0,k0)
+      Tensor tAsA = cta_tma_a.partition_D(sA);                                                 // (TMA,TMA_M,TMA_K0,PIPE)
+      Tensor tBgB0 = cta_tma_b0.partition_S(gB0);                                              // (TMA,TMA_N0,TMA_K0,n0,k0)
+      Tensor tBsB0 = cta_tma_b0.partition_D(sB0);                                              // (TMA,TMA_N0,TMA_K0,PIPE)
+      Tensor tBgB1 = cta_tma_b1.partition_S(gB1);                                              // (TMA,TMA_N1,TMA_N0,n0)
+      Tensor tBsB1 = cta_tma_b1.partition_D(sB1);                                              // (TMA,TMA_N1,TMA_N0,PIPE)
+
+      // Loads follow the order in which the math warp groups consume tiles. The tile of B1 of an
+      // N0 tile is consumed while the logits of the next N0 tile are computed.
+      int k_tile_count = size<3>(tAgA);
+      int n0_tile_count = size<3>(tBgB1);
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int n0_tile = 0; n0_tile < n0_tile_count; ++n0_tile) {
+        CUTLASS_PRAGMA_NO_UNROLL
+        for (int k_tile = 0; k_tile < k_tile_count; ++k_tile) {
+          pipeline0.producer_acquire(smem_pipe_write0);
+          auto* tma_barrier = pipeline0.producer_get_barrier(smem_pipe_write0);
+          int write_stage = smem_pipe_write0.index();
+          copy(params.tma_load_a.with(*tma_barrier), tAgA(_,_,_,k_tile), tAsA(_,_,_,write_stage));
+          copy(params.tma_load_b0.with(*tma_barrier), tBgB0(_,_,_,n0_tile,k_tile), tBsB0(_,_,_,write_stage));
+          ++smem_pipe_write0;
+        }
+
+        pipeline1.producer_acquire(smem_pipe_write1);
+        auto* tma_barrier = pipeline1.producer_get_barrier(smem_pipe_write1);
+        copy(params.tma_load_b1.with(*tma_barrier), tBgB1(_,_,_,n0_tile), tBsB1(_,_,_,smem_pipe_write1.index()));
+        ++smem_pipe_write1;
+      }
+    }
+  }
+
+  /// Perform a Producer Epilogue to prevent early exit of blocks in a Cluster
+  CUTLASS_DEVICE void
+  load_tail(
+      MainloopPipeline0& pipeline0,
+      PipelineState0& smem_pipe_write0,
+      MainloopPipeline1& pipeline1,
+      PipelineState1& smem_pipe_write1) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      pipeline0.producer_tail(smem_pipe_write0);
+      pipeline1.producer_tail(smem_pipe_write1);
+    }
+  }
+
+  /// Updates the running row max and row sum of the online softmax with the logits of an N0 tile.
+  /// The logits are replaced by their un-normalized probabilities, and scores_scale is set to
+  /// the factor by which the previous partial results must be rescaled.
+  template <bool IsFirstTile, class TensorS, class TensorRow>
+  CUTLASS_DEVICE static void
+  online_softmax(
+      TensorS& tCrS_rc,
+      TensorRow& row_max,
+      TensorRow& row_sum,
+      TensorRow& scores_scale,
+      ElementAccumulator alpha0_log2) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = 0; row < size<0>(tCrS_rc); ++row) {
+      ElementAccumulator max_prev = row_max(row);
+      ElementAccumulator max_cur = max_prev;
+      CUTLASS_PRAGMA_UNROLL
+      for (int col = 0; col < size<1>(tCrS_rc); ++col) {
+        max_cur = cutlass::maximum<ElementAccumulator>{}(max_cur, tCrS_rc(row, col));
+      }
+      max_cur = detail::b2b_quad_allreduce(max_cur, cutlass::maximum<ElementAccumulator>{});
+      row_max(row) = max_cur;
+
+      ElementAccumulator max_scaled = max_cur * alpha0_log2;
+      scores_scale(row) = IsFirstTile ? ElementAccumulator(1) : exp2f(max_prev * alpha0_log2 - max_scaled);
+
+      ElementAccumulator sum = 0;
+      CUTLASS_PRAGMA_UNROLL
+      for (int col = 0; col < size<1>(tCrS_rc); ++col) {
+        tCrS_rc(row, col) = exp2f(tCrS_rc(row, col) * alpha0_log2 - max_scaled);
+        sum += tCrS_rc(row, col);
+      }
+      row_sum(row) = IsFirstTile ? sum : row_sum(row) * scores_scale(row) + sum;
+    }
+  }
+
+  /// Computes softmax(alpha0 * A * B0^T + bias0) * B1^T for the tile at blk_coord, one N0 tile
+  /// at a time, and hands the normalized accumulators to epilogue.store().
+  /// Consumer Perspective
+  template <class BlkCoord, class ProblemShape, class CollectiveEpilogue, class EpilogueParams>
+  CUTLASS_DEVICE void
+  mma(
+      BlkCoord const& blk_coord,
+      ProblemShape const& problem_shape,
+      Params const& params,
+      MainloopPipeline0& pipeline0,
+      PipelineState0& smem_pipe_read0,
+      MainloopPipeline1& pipeline1,
+      PipelineState1& smem_pipe_read1,
+      CollectiveEpilogue& epilogue,
+      EpilogueParams const& epilogue_params,
+      int thread_idx,
+      TensorStorage& shared_tensors,
+      Element* smem_d) {
+    auto [M, N0, K0, N1, L] = problem_shape;
+
+    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_a.data()), SmemLayoutA{});       // (BLK_M,BLK_K0,PIPE)
+    Tensor sB0 = make_tensor(make_smem_ptr(shared_tensors.smem_b0.data()), SmemLayoutB0{});    // (BLK_N0,BLK_K0,PIPE)
+    Tensor sB1 = make_tensor(make_smem_ptr(shared_tensors.smem_b1.data()), SmemLayoutB1{});    // (BLK_N1,BLK_N0,PIPE)
+
+    //
+    // Define C accumulators and A/B partitioning
+    //
+
+    TiledMma0 tiled_mma0;
+    TiledMma1 tiled_mma1;
+    auto thread_mma0 = tiled_mma0.get_thread_slice(thread_idx);
+    auto thread_mma1 = tiled_mma1.get_thread_slice(thread_idx);
+
+    // Allocate "fragments/descriptors"
+    Tensor tCrA = thread_mma0.make_fragment_A(thread_mma0.partition_A(sA));                   // (MMA,MMA_M,MMA_K0,PIPE)
+    Tensor tCrB0 = thread_mma0.make_fragment_B(thread_mma0.partition_B(sB0));                 // (MMA,MMA_N0,MMA_K0,PIPE)
+    Tensor tCrB1 = thread_mma1.make_fragment_B(thread_mma1.partition_B(sB1));                 // (MMA,MMA_N1,MMA_N0,PIPE)
+
+    Tensor tCrS = partition_fragment_C(tiled_mma0, select<0,1>(TileShape0{}));               // (MMA,MMA_M,MMA_N0)
+    Tensor tCrD = partition_fragment_C(tiled_mma1, select<0,1>(TileShape1{}));               // (MMA,MMA_M,MMA_N1)
+    // P stays in registers as the A operand of P * B1^T
+    Tensor tCrP = make_tensor<Element>(detail::b2b_convert_c_layout_to_a_layout(tCrS.layout()));  // (MMA,MMA_M,MMA_N0)
+    Tensor tCrP_acc = make_tensor(tCrP.data(), tCrS.layout());                               // (MMA,MMA_M,MMA_N0)
+
+    // (row, col) views for the softmax
+    Tensor tCrS_rc = make_tensor(tCrS.data(), detail::b2b_convert_c_layout_to_rowcol(tCrS.layout()));  // (ROW,COL)
+    Tensor tCrD_rc = make_tensor(tCrD.data(), detail::b2b_convert_c_layout_to_rowcol(tCrD.layout()));  // (ROW,COL)
+    CUTE_STATIC_ASSERT_V(size<0>(tCrS_rc) == size<0>(tCrD_rc));
+
+    using RowShape = decltype(make_shape(size<0>(tCrS_rc)));
+    Tensor row_max = make_tensor<ElementAccumulator>(RowShape{});
+    Tensor row_sum = make_tensor<ElementAccumulator>(RowShape{});
+    Tensor scores_scale = make_tensor<ElementAccumulator>(RowShape{});
+    fill(row_max, -cutlass::platform::numeric_limits<ElementAccumulator>::infinity());
+    clear(tCrD);
+
+    // Column coordinates of the logits held by this thread, for the bias and the last N0 tile
+    Tensor cS = make_identity_tensor(select<0,1>(TileShape0{}));                              // (BLK_M,BLK_N0)
+    Tensor tCcS = thread_mma0.partition_C(cS);                                                // (MMA,MMA_M,MMA_N0)
+
+    int k_tile_count = ceil_div(K0, size<2>(TileShape0{}));
+    int n0_tile_count = ceil_div(N0, size<1>(TileShape0{}));
+
+    // S = A * B0^T for one N0 tile, pipelined along K0. The first wait also retires any batch of
+    // GMMAs committed before, which thus overlaps with the first K0 tile of S.
+    auto gemm_logits = [&]() {
+      PipelineState0 smem_pipe_release0 = smem_pipe_read0;
+
+      pipeline0.consumer_wait(smem_pipe_read0);
+      detail::b2b_gemm_and_commit</*ZeroInit=*/true>(
+          tiled_mma0, tCrA(_,_,_,smem_pipe_read0.index()), tCrB0(_,_,_,smem_pipe_read0.index()), tCrS);
+      ++smem_pipe_read0;
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int k_tile = 1; k_tile < k_tile_count; ++k_tile) {
+        pipeline0.consumer_wait(smem_pipe_read0);
+        detail::b2b_gemm_and_commit</*ZeroInit=*/false>(
+            tiled_mma0, tCrA(_,_,_,smem_pipe_read0.index()), tCrB0(_,_,_,smem_pipe_read0.index()), tCrS);
+        ++smem_pipe_read0;
+
+        warpgroup_wait<1>();
+        pipeline0.consumer_release(smem_pipe_release0);
+        ++smem_pipe_release0;
+      }
+
+      warpgroup_wait<0>();
+      pipeline0.consumer_release(smem_pipe_release0);
+    };
+
+    // The bias is folded in as bias0 / alpha0, as the softmax scales the logits by alpha0.
+    // Columns beyond N0 get a logit of -inf, hence a probability of 0.
+    auto apply_bias_and_mask = [&](int n0_tile) {
+      int n0_offset = n0_tile * int(size<1>(TileShape0{}));
+      bool is_residue = n0_offset + int(size<1>(TileShape0{})) > N0;
+      if (params.ptr_bias0 == nullptr && !is_residue) {
+        return;
+      }
+      ElementAccumulator inv_alpha0 = ElementAccumulator(1) / params.alpha0;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tCrS); ++i) {
+        int n0 = n0_offset + get<1>(tCcS(i));
+        if (n0 >= N0) {
+          tCrS(i) = -cutlass::platform::numeric_limits<ElementAccumulator>::infinity();
+        }
+        else if (params.ptr_bias0 != nullptr) {
+          tCrS(i) += static_cast<ElementAccumulator>(params.ptr_bias0[n0]) * inv_alpha0;
+        }
+      }
+    };
+
+    auto convert_p = [&]() {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tCrS); ++i) {
+        tCrP_acc(i) = static_cast<Element>(tCrS(i));
+      }
+    };
+
+    // Brings D to the running max of the softmax
+    auto rescale_d = [&]() {
+      CUTLASS_PRAGMA_UNROLL
+      for (int row = 0; row < size<0>(tCrD_rc); ++row) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int col = 0; col < size<1>(tCrD_rc); ++col) {
+          tCrD_rc(row, col) *= scores_scale(row);
+        }
+      }
+    };
+
+    //
+    // Prologue: P_0 = softmax(S_0)
+    //
+
+    gemm_logits();
+    apply_bias_and_mask(0);
+    online_softmax</*IsFirstTile=*/true>(tCrS_rc, row_max, row_sum, scores_scale, params.alpha0_log2);
+    convert_p();
+
+    //
+    // Mainloop: D += P_j-1 * B1_j-1^T is issued ahead of S_j
+    //
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int n0_tile = 1; n0_tile < n0_tile_count; ++n0_tile) {
+      rescale_d();
+
+      pipeline1.consumer_wait(smem_pipe_read1);
+      detail::b2b_gemm_and_commit</*ZeroInit=*/false>(tiled_mma1, tCrP, tCrB1(_,_,_,smem_pipe_read1.index()), tCrD);
+
+      // P_j-1 and B1_j-1 are read until gemm_logits() retires the GMMAs above
+      gemm_logits();
+      pipeline1.consumer_release(smem_pipe_read1);
+      ++smem_pipe_read1;
+
+      apply_bias_and_mask(n0_tile);
+      online_softmax</*IsFirstTile=*/false>(tCrS_rc, row_max, row_sum, scores_scale, params.alpha0_log2);
+      convert_p();
+    }
+
+    //
+    // Epilogue: D += P_last * B1_last^T, then D /= row_sum
+    //
+
+    rescale_d();
+
+    pipeline1.consumer_wait(smem_pipe_read1);
+    detail::b2b_gemm_and_commit</*ZeroInit=*/false>(tiled_mma1, tCrP, tCrB1(_,_,_,smem_pipe_read1.index()), tCrD);
+    warpgroup_wait<0>();
+    pipeline1.consumer_release(smem_pipe_read1);
+    ++smem_pipe_read1;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = 0; row < size<0>(tCrD_rc); ++row) {
+      ElementAccumulator sum = detail::b2b_quad_allreduce(row_sum(row), cutlass::plus<ElementAccumulator>{});
+      ElementAccumulator scale = ElementAccumulator(1) / sum;
+      CUTLASS_PRAGMA_UNROLL
+      for (int col = 0; col < size<1>(tCrD_rc); ++col) {
+        tCrD_rc(row, col) *= scale;
+      }
+    }
+
+    epilogue.store(
+      make_coord(get<0>(blk_coord), _0{}, get<2>(blk_coord)),
+      problem_shape,
+      epilogue_params,
+      tCrD,
+      tiled_mma1,
+      thread_idx,
+      smem_d);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
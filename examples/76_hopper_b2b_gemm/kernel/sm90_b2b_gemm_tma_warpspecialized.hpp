@@ -0,0 +1,312 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Warp-specialized back-to-back GEMM kernel for Hopper.
+
+    One producer warp group issues the TMA loads of A/B0 and B1, the math warp groups each own
+    64 rows of the M tile. The mainloop decides how the two GEMMs are chained and calls the
+    epilogue for each output tile:
+      - Sm90B2bGemmMainloopTmaWarpspecialized computes D0 = act0(alpha0 * A * B0^T + bias0) for
+        the rows, keeps it in registers, and then loops over the N1 tiles of D0 * B1^T.
+      - Sm90GemmSoftmaxGemmMainloopTmaWarpspecialized loops over the N0 tiles of
+        softmax(alpha0 * A * B0^T + bias0) with an online softmax, accumulating P * B1^T.
+    Each CTA computes one M tile of one batch, the intermediate never leaves the SM.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/reg_reconfig.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class ProblemShape_,          // (M, N0, K0, N1, L)
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_
+>
+class Sm90B2bGemmTmaWarpspecialized {
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+  static_assert(rank(ProblemShape{}) == 5, "ProblemShape{} should be <M, N0, K0, N1, L>");
+
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using TileShape = typename CollectiveMainloop::TileShape;
+  using ArchTag = typename CollectiveMainloop::ArchTag;
+  using ClusterShape = typename CollectiveMainloop::ClusterShape;
+  using MainloopArguments = typename CollectiveMainloop::Arguments;
+  using MainloopParams = typename CollectiveMainloop::Params;
+  static_assert(ArchTag::kMinComputeCapability >= 90);
+
+  // Epilogue derived types
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using EpilogueArguments = typename CollectiveEpilogue::Arguments;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+
+  // Warp specialization thread count per threadblock
+  static constexpr uint32_t NumLoadWarpGroups = 1;
+  static constexpr uint32_t NumMmaWarpGroups = CollectiveMainloop::NumMmaWarpGroups;
+  static constexpr uint32_t NumMmaThreads = CollectiveMainloop::NumMmaThreads;
+  static constexpr uint32_t MaxThreadsPerBlock = NumMmaThreads + (NumLoadWarpGroups * NumThreadsPerWarpGroup);
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  static_assert(CollectiveEpilogue::NumMmaThreads == NumMmaThreads,
+    "The epilogue must be shared by all the math threads.");
+
+  /// Register requirement for Load and Math WGs
+  static constexpr uint32_t LoadRegisterRequirement = 40;
+  static constexpr uint32_t MmaRegisterRequirement = 232;
+
+  // Kernel level shared memory storage
+  struct SharedStorage {
+    struct PipelineStorage : cute::aligned_struct<16, _1> {
+      using MainloopPipelineStorage = typename CollectiveMainloop::PipelineStorage;
+
+      alignas(16) MainloopPipelineStorage mainloop;
+    } pipelines;
+
+    struct TensorStorage : cute::aligned_struct<128, _1> {
+      using MainloopTensorStorage = typename CollectiveMainloop::TensorStorage;
+      using EpilogueTensorStorage = typename CollectiveEpilogue::TensorStorage;
+
+      MainloopTensorStorage mainloop;
+      EpilogueTensorStorage epilogue;
+    } tensors;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  // Device side arguments
+  struct Arguments {
+    ProblemShape problem_shape{};
+    MainloopArguments mainloop{};
+    EpilogueArguments epilogue{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    ProblemShape problem_shape{};
+    MainloopParams mainloop{};
+    EpilogueParams epilogue{};
+  };
+
+  //
+  // Methods
+  //
+
+  static
+  Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    CUTLASS_TRACE_HOST("to_underlying_arguments():");
+
+    return {
+      args.problem_shape,
+      CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
+      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace)
+    };
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    bool implementable = CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
+    implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
+    }
+    return implementable;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    auto [M, N0, K0, N1, L] = params.problem_shape;
+    return dim3(ceil_div(M, size<0>(TileShape{})), 1, L);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+
+#if defined(__CUDA_ARCH_FEAT_SM90_ALL)
+#  define ENABLE_SM90_KERNEL_LEVEL 1
+#endif
+// Any Tensor Op MMA Atom in the WGMMA ISA is arch conditional to sm90a.
+#if ! defined(ENABLE_SM90_KERNEL_LEVEL)
+    printf("ERROR : Arch conditional MMA instruction used without targeting appropriate compute capability. Aborting.\n");
+#else
+
+    enum class WarpGroupRole {
+      Producer = 0,
+      Consumer0 = 1,
+      Consumer1 = 2
+    };
+    enum class ProducerWarpRole {
+      Mainloop = 0,
+      Warp1 = 1,
+      Warp2 = 2,
+      Warp3 = 3
+    };
+
+    // Kernel level shared memory storage
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    int thread_idx = int(threadIdx.x);
+    int warp_idx = canonical_warp_idx_sync();
+    int warp_idx_in_warp_group = warp_idx % NumWarpsPerWarpGroup;
+    int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
+    auto warp_group_role = WarpGroupRole(canonical_warp_group_idx());
+    auto producer_warp_role = ProducerWarpRole(warp_idx_in_warp_group);
+    int lane_predicate = cute::elect_one_sync();
+
+    // Issue Tma Descriptor Prefetch from a single thread
+    if ((warp_idx == 0) && lane_predicate) {
+      CollectiveMainloop::prefetch_tma_descriptors(params.mainloop);
+      CollectiveEpilogue::prefetch_tma_descriptors(params.epilogue);
+    }
+
+    // Mainloop Load pipelines: A/B0 streamed along K0, B1 streamed along N1
+    using MainloopPipeline0 = typename CollectiveMainloop::MainloopPipeline0;
+    using MainloopPipeline1 = typename CollectiveMainloop::MainloopPipeline1;
+
+    typename MainloopPipeline0::Params pipeline0_params;
+    typename MainloopPipeline1::Params pipeline1_params;
+    if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::Mainloop) {
+      pipeline0_params.role = MainloopPipeline0::ThreadCategory::Producer;
+      pipeline1_params.role = MainloopPipeline1::ThreadCategory::Producer;
+    }
+    if (warp_group_role != WarpGroupRole::Producer) {
+      pipeline0_params.role = MainloopPipeline0::ThreadCategory::Consumer;
+      pipeline1_params.role = MainloopPipeline1::ThreadCategory::Consumer;
+    }
+    pipeline0_params.is_leader = warp_group_thread_idx == 0;
+    pipeline0_params.num_consumers = NumMmaThreads;
+    pipeline0_params.transaction_bytes = CollectiveMainloop::TmaTransactionBytes0;
+    pipeline1_params.is_leader = warp_group_thread_idx == 0;
+    pipeline1_params.num_consumers = NumMmaThreads;
+    pipeline1_params.transaction_bytes = CollectiveMainloop::TmaTransactionBytes1;
+
+    MainloopPipeline0 pipeline0(shared_storage.pipelines.mainloop.ab0, pipeline0_params, ClusterShape{});
+    MainloopPipeline1 pipeline1(shared_storage.pipelines.mainloop.b1, pipeline1_params, ClusterShape{});
+
+    // Initialize starting pipeline states for the collectives
+    typename CollectiveMainloop::PipelineState0 pipe_read0;
+    typename CollectiveMainloop::PipelineState1 pipe_read1;
+
+    // For the DMA Load (producer) we start with an opposite phase
+    // i.e., we skip all waits since we know that the buffer is indeed empty
+    auto pipe_write0 = cutlass::make_producer_start_state<MainloopPipeline0>();
+    auto pipe_write1 = cutlass::make_producer_start_state<MainloopPipeline1>();
+
+    // We need this to guarantee that the Pipeline init is visible to all producers and consumers
+    __syncthreads();
+
+    CollectiveMainloop collective_mainloop;
+    CollectiveEpilogue collective_epilogue;
+
+    auto blk_coord = make_coord(int(blockIdx.x), _0{}, int(blockIdx.z));
+
+    if (warp_group_role == WarpGroupRole::Producer) {
+      cutlass::arch::warpgroup_reg_dealloc<LoadRegisterRequirement>();
+
+      if (producer_warp_role == ProducerWarpRole::Mainloop) {
+        collective_mainloop.load(
+          blk_coord,
+          params.problem_shape,
+          params.mainloop,
+          pipeline0, pipe_write0,
+          pipeline1, pipe_write1,
+          shared_storage.tensors.mainloop
+        );
+
+        // Make sure all the loads retire before the CTA exits
+        collective_mainloop.load_tail(pipeline0, pipe_write0, pipeline1, pipe_write1);
+      }
+    }
+    else {
+      cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
+
+      // Index of the thread among the math warp groups
+      int mma_thread_idx = thread_idx - NumThreadsPerWarpGroup;
+
+      collective_mainloop.mma(
+        blk_coord,
+        params.problem_shape,
+        params.mainloop,
+        pipeline0, pipe_read0,
+        pipeline1, pipe_read1,
+        collective_epilogue,
+        params.epilogue,
+        mma_thread_idx,
+        shared_storage.tensors.mainloop,
+        shared_storage.tensors.epilogue.smem_d.data()
+      );
+
+      collective_epilogue.store_tail(mma_thread_idx);
+    }
+#endif
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include <cute/config.hpp>
+
+#include <cute/tensor_impl.hpp>
+#include <cute/algorithm/functional.hpp>
+#include <cute/arch/cluster_sm90.hpp>
+#include <cute/arch/copy_sm90_desc.hpp>
+#include <cute/arch/util.hpp>
+
+/** Cluster-scope reduction and broadcast of register fragments over distributed shared memory (SM90).
+ *
+ *  cluster_reduce<NumThreads>(frg, root, tid, buffer, mbar, phase, op)
+ *      Every CTA of the cluster holds a partial frg. Non-root CTAs push their partials into the exchange
+ *      buffer of CTA root with st.async, completing bytes on root's mbarrier. On return, frg of root holds
+ *      op folded over all partials in cluster rank order; frg of the other CTAs is unchanged.
+ *  cluster_broadcast<NumThreads>(frg, root, tid, buffer, mbar, phase)
+ *      CTA root pushes frg into the exchange buffer of every other CTA. On return, all CTAs hold root's frg.
+ *  cluster_allreduce<NumThreads>(frg, root, tid, buffer, mbar, phase, op)
+ *      cluster_reduce followed by cluster_broadcast. Every CTA's mbarrier completes exactly one phase per call.
+ *
+ *  NumThreads threads with tid in [0, NumThreads) participate in every CTA and hold fragments of the same
+ *  static shape, with elements whose size is a multiple of 4 bytes. Element tid of partial r is combined with
+ *  element tid of partial r', so the data layout of frg must match across CTAs.
+ *
+ *  buffer is a 16B aligned smem array of cluster_exchange_bytes<NumThreads>(frg, cluster_size) bytes at the
+ *  same offset in every CTA. mbar is an smem mbarrier at the same offset in every CTA, initialized with an
+ *  arrival count of 1 and made visible to the cluster (fence_barrier_init + cluster_sync) before first use.
+ *  phase is the parity of the mbar phase being waited on; flip it after every call that waits on mbar.
+ *
+ *  cluster_allreduce is self-synchronizing: root consumes its buffer before broadcasting, and peers only push
+ *  again after receiving the broadcast. Back-to-back cluster_reduce or cluster_broadcast calls are not: the
+ *  receiving CTAs must have consumed their buffer (e.g. cluster_arrive_relaxed/cluster_wait) before it is reused.
+ */
+
+namespace cute
+{
+
+namespace detail {
+
+template <class Engine, class Layout>
+CUTE_HOST_DEVICE constexpr
+int
+cluster_exchange_words()
+{
+  using T = typename Engine::value_type;
+  static_assert(is_static<Layout>::value, "Cluster exchange requires a static fragment layout.");
+  static_assert(sizeof(T) % sizeof(uint32_t) == 0, "Cluster exchange requires elements of 4B multiples.");
+  return int(size(Layout{})) * int(sizeof(T) / sizeof(uint32_t));
+}
+
+// Word offset of word w of thread tid in exchange slot slot.
+// Fragments of 4-word multiples are exchanged as thread-interleaved 16B vectors, others as interleaved words.
+template <uint32_t NumThreads, int NumWords>
+CUTE_DEVICE
+uint32_t
+cluster_exchange_offset(uint32_t slot, uint32_t tid, int w)
+{
+  if constexpr (NumWords % 4 == 0) {
+    return ((slot * (NumWords / 4) + w / 4) * NumThreads + tid) * 4 + w % 4;
+  } else {
+    return (slot * NumWords + w) * NumThreads + tid;
+  }
+}
+
+template <class Engine, class Layout, int NumWords>
+CUTE_DEVICE
+void
+cluster_pack(Tensor<Engine,Layout> const& frg, uint32_t (&words)[NumWords])
+{
+  using T = typename Engine::value_type;
+  constexpr int WordsPerElem = int(sizeof(T) / sizeof(uint32_t));
+  CUTE_UNROLL
+  for (int i = 0; i < size(frg); ++i) {
+    T value = frg(i);
+    memcpy(&words[i * WordsPerElem], &value, sizeof(T));
+  }
+}
+
+// Read thread tid's fragment from slot of the local exchange buffer
+template <uint32_t NumThreads, class Engine, class Layout>
+CUTE_DEVICE
+void
+cluster_unpack(uint32_t const* buffer, uint32_t slot, uint32_t tid, Tensor<Engine,Layout>& frg)
+{
+  using T = typename Engine::value_type;
+  constexpr int NumWords     = cluster_exchange_words<Engine,Layout>();
+  constexpr int WordsPerElem = int(sizeof(T) / sizeof(uint32_t));
+  CUTE_UNROLL
+  for (int i = 0; i < size(frg); ++i) {
+    uint32_t words[WordsPerElem];
+    CUTE_UNROLL
+    for (int w = 0; w < WordsPerElem; ++w) {
+      words[w] = buffer[cluster_exchange_offset<NumThreads, NumWords>(slot, tid, i * WordsPerElem + w)];
+    }
+    T value;
+    memcpy(&value, words, sizeof(T));
+    frg(i) = value;
+  }
+}
+
+// Push thread tid's fragment into slot of dst_rank's exchange buffer, completing bytes on dst_rank's mbar
+template <uint32_t NumThreads, int NumWords>
+CUTE_DEVICE
+void
+cluster_push(uint32_t const (&words)[NumWords], uint32_t* buffer, uint32_t slot, uint32_t tid,
+             uint64_t* mbar, uint32_t dst_rank)
+{
+  uint32_t buffer_addr = cast_smem_ptr_to_uint(buffer);
+  uint32_t mbar_addr   = cast_smem_ptr_to_uint(mbar);
+  if constexpr (NumWords % 4 == 0) {
+    CUTE_UNROLL
+    for (int w = 0; w < NumWords; w += 4) {
+      uint32_t addr = buffer_addr + sizeof(uint32_t) * cluster_exchange_offset<NumThreads, NumWords>(slot, tid, w);
+      store_shared_remote(words[w], words[w+1], words[w+2], words[w+3], addr, mbar_addr, dst_rank);
+    }
+  } else {
+    CUTE_UNROLL
+    for (int w = 0; w < NumWords; ++w) {
+      uint32_t addr = buffer_addr + sizeof(uint32_t) * cluster_exchange_offset<NumThreads, NumWords>(slot, tid, w);
+      store_shared_remote(words[w], addr, mbar_addr, dst_rank);
+    }
+  }
+}
+
+CUTE_DEVICE
+uint32_t
+cluster_size()
+{
+  dim3 shape = cluster_shape();
+  return shape.x * shape.y * shape.z;
+}
+
+} // end namespace detail
+
+// Bytes of smem exchange buffer needed per CTA by the cluster collectives for fragment frg
+template <uint32_t NumThreads, class Engine, class Layout>
+CUTE_HOST_DEVICE constexpr
+uint32_t
+cluster_exchange_bytes(Tensor<Engine,Layout> const&, uint32_t cluster_size)
+{
+  uint32_t slots = cluster_size > 2 ? cluster_size - 1 : 1;
+  return slots * NumThreads * uint32_t(detail::cluster_exchange_words<Engine,Layout>()) * uint32_t(sizeof(uint32_t));
+}
+
+template <uint32_t NumThreads, class Engine, class Layout, class BinaryOp = plus>
+CUTE_DEVICE
+void
+cluster_reduce(Tensor<Engine,Layout>& frg, uint32_t root, uint32_t tid,
+               uint32_t* buffer, uint64_t* mbar, uint32_t phase, BinaryOp op = {})
+{
+  constexpr int NumWords = detail::cluster_exchange_words<Engine,Layout>();
+  uint32_t num_ctas = detail::cluster_size();
+  uint32_t rank     = block_rank_in_cluster();
+  if (num_ctas == 1) {
+    return;
+  }
+
+  if (rank != root) {
+    // Partials of ranks above root shift down one slot, root has none
+    uint32_t slot = rank < root ? rank : rank - 1;
+    uint32_t words[NumWords];
+    detail::cluster_pack(frg, words);
+    detail::cluster_push<NumThreads>(words, buffer, slot, tid, mbar, root);
+    return;
+  }
+
+  if (tid == 0) {
+    set_barrier_transaction_bytes(*mbar, (num_ctas - 1) * NumThreads * NumWords * uint32_t(sizeof(uint32_t)));
+  }
+  wait_barrier(*mbar, phase);
+
+  // Fold in rank order so the result does not depend on arrival order
+  auto partial = make_fragment_like(frg);
+  auto result  = make_fragment_like(frg);
+  bool first   = true;
+  for (uint32_t r = 0; r < num_ctas; ++r) {
+    if (r == root) {
+      copy(frg, partial);
+    } else {
+      detail::cluster_unpack<NumThreads>(buffer, r < root ? r : r - 1, tid, partial);
+    }
+    if (first) {
+      copy(partial, result);
+      first = false;
+    } else {
+      CUTE_UNROLL
+      for (int i = 0; i < size(frg); ++i) {
+        result(i) = op(result(i), partial(i));
+      }
+    }
+  }
+  copy(result, frg);
+}
+
+template <uint32_t NumThreads, class Engine, class Layout>
+CUTE_DEVICE
+void
+cluster_broadcast(Tensor<Engine,Layout>& frg, uint32_t root, uint32_t tid,
+                  uint32_t* buffer, uint64_t* mbar, uint32_t phase)
+{
+  constexpr int NumWords = detail::cluster_exchange_words<Engine,Layout>();
+  uint32_t num_ctas = detail::cluster_size();
+  uint32_t rank     = block_rank_in_cluster();
+  if (num_ctas == 1) {
+    return;
+  }
+
+  if (rank == root) {
+    uint32_t words[NumWords];
+    detail::cluster_pack(frg, words);
+    for (uint32_t r = 0; r < num_ctas; ++r) {
+      if (r != root) {
+        detail::cluster_push<NumThreads>(words, buffer, 0, tid, mbar, r);
+      }
+    }
+    return;
+  }
+
+  if (tid == 0) {
+    set_barrier_transaction_bytes(*mbar, NumThreads * NumWords * uint32_t(sizeof(uint32_t)));
+  }
+  wait_barrier(*mbar, phase);
+  detail::cluster_unpack<NumThreads>(buffer, 0, tid, frg);
+}
+
+template <uint32_t NumThreads, class Engine, class Layout, class BinaryOp = plus>
+CUTE_DEVICE
+void
+cluster_allreduce(Tensor<Engine,Layout>& frg, uint32_t root, uint32_t tid,
+                  uint32_t* buffer, uint64_t* mbar, uint32_t phase, BinaryOp op = {})
+{
+  cluster_reduce<NumThreads>(frg, root, tid, buffer, mbar, phase, op);
+  cluster_broadcast<NumThreads>(frg, root, tid, buffer, mbar, phase);
+}
+
+} // end namespace cute
@@ -39,6 +39,8 @@
 #include <cute/tensor_predicate.hpp>
 #include <cute/algorithm/copy.hpp>
 #include <cute/atom/copy_atom.hpp>
+#include <cute/arch/copy_sm90_desc.hpp> // cute::set_barrier_transaction_bytes
+#include <cute/arch/copy_sm90_tma.hpp>  // cute::SM90_BULK_COPY_G2S, cute::SM90_BULK_COPY_S2G
 
 namespace cute
 {
@@ -336,4 +338,122 @@ cooperative_copy(uint32_t                     const& tid,
   return cooperative_copy<NumThreads, MaxVecBits>(tid, src, dst, cpy);
 }
 
+//
+// Hopper bulk-copy fast path
+//
+
+// Whether src -> dst is a single contiguous gmem<->smem transfer that one cp.async.bulk can perform:
+// static layouts, same value type, identical element order, contiguous in both tensors and a
+// multiple of 16B in size.
+template <class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+is_bulk_copyable(Tensor<SrcEngine, SrcLayout> const&,
+                 Tensor<DstEngine, DstLayout> const&)
+{
+  using SrcType = typename SrcEngine::value_type;
+  using DstType = typename DstEngine::value_type;
+  if constexpr (is_static<SrcLayout>::value && is_static<DstLayout>::value &&
+                is_same<remove_cv_t<SrcType>, remove_cv_t<DstType>>::value &&
+                ((is_gmem<SrcEngine>::value && is_smem<DstEngine>::value) ||
+                 (is_smem<SrcEngine>::value && is_gmem<DstEngine>::value))) {
+    constexpr int total_elem   = size(SrcLayout{});
+    constexpr int common_elem  = decltype(max_common_vector(SrcLayout{}, DstLayout{}))::value;
+    constexpr int total_bits   = total_elem * sizeof_bits_v<SrcType>;
+    return bool_constant<common_elem == total_elem && total_bits % 128 == 0>{};
+  } else {
+    return false_type{};
+  }
+}
+
+// cooperative_bulk_copy<NumThreads>(tid, gmem_src, smem_dst, smem_mbar)
+// Copy gmem Tensor src to smem Tensor dst with a single SM90_BULK_COPY_G2S issued by thread 0 of the team.
+// Thread 0 also arrives on the mbarrier with the expected transaction bytes, so the team waits for
+// completion with cute::wait_barrier(smem_mbar, phase).
+// @pre is_bulk_copyable(src, dst)
+// @pre @a smem_mbar was initialized with an arrival count of 1
+// @pre src and dst are 16B aligned
+template <uint32_t NumThreads,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_bulk_copy(uint32_t                     const& tid,
+                      Tensor<SrcEngine, SrcLayout> const& src,
+                      Tensor<DstEngine, DstLayout>      & dst,
+                      uint64_t                          & smem_mbar)
+{
+  static_assert(is_gmem<SrcEngine>::value && is_smem<DstEngine>::value,
+                "cooperative_bulk_copy with an mbarrier expects a gmem source and smem destination.");
+  static_assert(decltype(is_bulk_copyable(src, dst))::value,
+                "Tensors are not eligible for a single bulk copy; use cooperative_copy instead.");
+  assert(tid < NumThreads);
+  assert(is_byte_aligned<16>(raw_pointer_cast(src.data())));
+  assert(is_byte_aligned<16>(raw_pointer_cast(dst.data())));
+
+  constexpr uint32_t bytes = size(SrcLayout{}) * sizeof_bits_v<typename SrcEngine::value_type> / 8;
+  if (tid == 0) {
+    set_barrier_transaction_bytes(smem_mbar, bytes);
+    SM90_BULK_COPY_G2S::copy(raw_pointer_cast(src.data()), &smem_mbar,
+                             raw_pointer_cast(dst.data()), bytes);
+  }
+}
+
+// cooperative_bulk_copy<NumThreads>(tid, smem_src, gmem_dst)
+// Copy smem Tensor src to gmem Tensor dst with a single SM90_BULK_COPY_S2G issued by thread 0 of the team.
+// Thread 0 commits the bulk group; it must call cute::tma_store_wait<0>() before src is overwritten.
+// @pre is_bulk_copyable(src, dst)
+// @pre All writes to src were followed by cute::tma_store_fence() and a synchronization of the team
+// @pre src and dst are 16B aligned
+template <uint32_t NumThreads,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_bulk_copy(uint32_t                     const& tid,
+                      Tensor<SrcEngine, SrcLayout> const& src,
+                      Tensor<DstEngine, DstLayout>      & dst)
+{
+  static_assert(is_smem<SrcEngine>::value && is_gmem<DstEngine>::value,
+                "cooperative_bulk_copy without an mbarrier expects a smem source and gmem destination.");
+  static_assert(decltype(is_bulk_copyable(src, dst))::value,
+                "Tensors are not eligible for a single bulk copy; use cooperative_copy instead.");
+  assert(tid < NumThreads);
+  assert(is_byte_aligned<16>(raw_pointer_cast(src.data())));
+  assert(is_byte_aligned<16>(raw_pointer_cast(dst.data())));
+
+  constexpr uint32_t bytes = size(SrcLayout{}) * sizeof_bits_v<typename SrcEngine::value_type> / 8;
+  if (tid == 0) {
+    SM90_BULK_COPY_S2G::copy(raw_pointer_cast(src.data()), raw_pointer_cast(dst.data()), bytes);
+    tma_store_arrive();
+  }
+}
+
+// Accept mutable temporaries
+template <uint32_t NumThreads,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_bulk_copy(uint32_t                     const& tid,
+                      Tensor<SrcEngine, SrcLayout> const& src,
+                      Tensor<DstEngine, DstLayout>     && dst,
+                      uint64_t                          & smem_mbar)
+{
+  return cooperative_bulk_copy<NumThreads>(tid, src, dst, smem_mbar);
+}
+
+template <uint32_t NumThreads,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_bulk_copy(uint32_t                     const& tid,
+                      Tensor<SrcEngine, SrcLayout> const& src,
+                      Tensor<DstEngine, DstLayout>     && dst)
+{
+  return cooperative_bulk_copy<NumThreads>(tid, src, dst);
+}
+
 } // end namespace cute
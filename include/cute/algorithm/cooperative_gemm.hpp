@@ -381,6 +381,65 @@ cooperative_gemm_no_predication(uint32_t                   thread_idx,
   }
 }
 
+// Whether the TiledMMA consumes both A and B straight from shared memory through GMMA descriptors
+template <class TiledMma>
+static constexpr bool is_gmma_ss_v =
+  cute::is_base_of_v<GMMA::DescriptorIterator, typename TiledMma::FrgTypeA> &&
+  cute::is_base_of_v<GMMA::DescriptorIterator, typename TiledMma::FrgTypeB>;
+
+// Warpgroup-wide GEMM on SM90: GMMA reads sA and sB directly from shared memory, so no smem->rmem
+// copies are issued. All threads of the TiledMMA (a multiple of 128) must participate, sA and sB
+// must use GMMA-canonical (swizzled) smem layouts, and the problem must evenly tile the TiledMMA.
+// tCrC is accumulated into.
+template <class... Args,
+          class TA, class ALayout, class TB, class BLayout,
+          class TC, class CLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_gemm_gmma(uint32_t                   thread_idx,
+                      TiledMMA<Args...>          tiled_mma,
+                      Tensor<TA, ALayout> const& sA,
+                      Tensor<TB, BLayout> const& sB,
+                      Tensor<TC, CLayout>      & tCrC)
+{
+  static_assert(size(TiledMMA<Args...>{}) % 128 == 0, "GMMA cooperative_gemm requires whole warpgroups.");
+
+  auto thr_mma = tiled_mma.get_thread_slice(thread_idx);
+  Tensor tCrA = thr_mma.make_fragment_A(thr_mma.partition_A(sA));    // (MMA,MMA_M,MMA_K) :: smem descriptors
+  Tensor tCrB = thr_mma.make_fragment_B(thr_mma.partition_B(sB));    // (MMA,MMA_N,MMA_K) :: smem descriptors
+
+  tiled_mma.accumulate_ = GMMA::ScaleOut::One;
+
+  warpgroup_fence_operand(tCrC);
+  warpgroup_arrive();
+  CUTE_UNROLL
+  for (int k_block = 0; k_block < size<2>(tCrA); ++k_block) {
+    cute::gemm(tiled_mma, tCrA(_,_,k_block), tCrB(_,_,k_block), tCrC);
+  }
+  warpgroup_commit_batch();
+  warpgroup_wait<0>();
+  warpgroup_fence_operand(tCrC);
+}
+
+template <class... Args,
+          class TA, class ALayout, class TB, class BLayout, class TC, class CLayout,
+          class ALoadTransformOp, class BLoadTransformOp>
+CUTE_HOST_DEVICE constexpr
+void
+static_assert_gmma_compatible(TiledMMA<Args...>   const&,
+                              Tensor<TA, ALayout> const& sA,
+                              Tensor<TB, BLayout> const& sB,
+                              Tensor<TC, CLayout> const&,
+                              ALoadTransformOp    const&,
+                              BLoadTransformOp    const&)
+{
+  static_assert(is_same_v<ALoadTransformOp, cute::identity> && is_same_v<BLoadTransformOp, cute::identity>,
+                "GMMA cooperative_gemm reads A and B from shared memory and cannot apply load transforms.");
+  CUTE_STATIC_ASSERT_V(evenly_divides(make_shape(size<0>(sA), size<0>(sB), size<1>(sA)),
+                                      tile_shape(TiledMMA<Args...>{})),
+                       "GMMA cooperative_gemm requires the problem to evenly tile the TiledMMA.");
+}
+
 } // end namespace detail
 
 // C passed as a shared memory tensor
@@ -442,7 +501,13 @@ cooperative_gemm(uint32_t                   thread_idx,
   }
 #endif
 
-  if constexpr (is_constant<true, decltype(compat)>::value) {
+  if constexpr (detail::is_gmma_ss_v<TiledMMA<Args...>>) {
+    detail::static_assert_gmma_compatible(tiled_mma, sA, sB, tCrC, sA_load_op, sB_load_op);
+    detail::cooperative_gemm_gmma(thread_idx, tiled_mma, sA, sB, tCrC);
+    detail::epilogue_no_predication(
+        alpha, tCrC, beta, tCsC, sC_load_op, sC_store_op, sC_copy_op
+    );
+  } else if constexpr (is_constant<true, decltype(compat)>::value) {
     detail::cooperative_gemm_no_predication(
         thread_idx, thr_mma, sA, sB, tCrC, sA_load_op, sB_load_op, sA_copy_op, sB_copy_op
     );
@@ -501,7 +566,10 @@ cooperative_gemm(uint32_t                   thread_idx,
   // ThrMMA
   auto thr_mma = tiled_mma.get_thread_slice(thread_idx);
 
-  if constexpr (is_constant<true, decltype(compat)>::value) {
+  if constexpr (detail::is_gmma_ss_v<TiledMMA<Args...>>) {
+    detail::static_assert_gmma_compatible(tiled_mma, sA, sB, tCrC, sA_load_op, sB_load_op);
+    detail::cooperative_gemm_gmma(thread_idx, tiled_mma, sA, sB, tCrC);
+  } else if constexpr (is_constant<true, decltype(compat)>::value) {
     detail::cooperative_gemm_no_predication(
         thread_idx, thr_mma, sA, sB, tCrC, sA_load_op, sB_load_op, sA_copy_op, sB_copy_op
     );
@@ -0,0 +1,377 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include <cute/config.hpp>
+
+#include <cute/tensor_impl.hpp>
+#include <cute/algorithm/functional.hpp>
+
+/** Reductions and scans over Tensors and registers at thread, warp and cooperative (warpgroup/CTA) scope.
+ *
+ *  Thread scope:       reduce(tensor, init, op), inclusive_scan(in, out, op), exclusive_scan(in, out, init, op)
+ *  Warp scope:         warp_reduce<Width>(value, op), warp_inclusive_scan<Width>(value, op)
+ *                      All lanes of the warp must participate. Width must be a power of two <= 32;
+ *                      each aligned group of Width lanes reduces/scans independently.
+ *  Cooperative scope:  cooperative_reduce<NumThreads>(tid, value, op, smem, barrier_id)
+ *                      cooperative_inclusive_scan<NumThreads>(tid, value, op, smem, barrier_id)
+ *                      NumThreads is a multiple of 32, e.g. 128 for a warpgroup or the CTA size. smem holds one
+ *                      element per participating warp. The threads synchronize on named barrier barrier_id
+ *                      (0 is __syncthreads() when NumThreads is the CTA size). Synchronize again before reusing smem.
+ *
+ *  32-bit integer plus/min/max/and/or/xor warp reductions use redux.sync on SM80 and newer.
+ */
+
+namespace cute
+{
+
+//
+// Thread scope
+//
+
+template <class Engine, class Layout, class T, class BinaryOp = plus>
+CUTE_HOST_DEVICE constexpr
+T
+reduce(Tensor<Engine,Layout> const& tensor, T init, BinaryOp op = {})
+{
+  CUTE_UNROLL
+  for (int i = 0; i < size(tensor); ++i) {
+    init = op(init, tensor(i));
+  }
+  return init;
+}
+
+template <class EngineIn, class LayoutIn,
+          class EngineOut, class LayoutOut,
+          class BinaryOp = plus>
+CUTE_HOST_DEVICE constexpr
+void
+inclusive_scan(Tensor<EngineIn, LayoutIn > const& tensor_in,
+               Tensor<EngineOut,LayoutOut>      & tensor_out,
+               BinaryOp op = {})
+{
+  if (size(tensor_in) > 0) {
+    auto acc = tensor_in(0);
+    tensor_out(0) = acc;
+    CUTE_UNROLL
+    for (int i = 1; i < size(tensor_in); ++i) {
+      acc = op(acc, tensor_in(i));
+      tensor_out(i) = acc;
+    }
+  }
+}
+
+// Accept mutable temporaries
+template <class EngineIn, class LayoutIn,
+          class EngineOut, class LayoutOut,
+          class BinaryOp = plus>
+CUTE_HOST_DEVICE constexpr
+void
+inclusive_scan(Tensor<EngineIn, LayoutIn > const& tensor_in,
+               Tensor<EngineOut,LayoutOut>     && tensor_out,
+               BinaryOp op = {})
+{
+  return inclusive_scan(tensor_in, tensor_out, op);
+}
+
+template <class EngineIn, class LayoutIn,
+          class EngineOut, class LayoutOut,
+          class T, class BinaryOp = plus>
+CUTE_HOST_DEVICE constexpr
+void
+exclusive_scan(Tensor<EngineIn, LayoutIn > const& tensor_in,
+               Tensor<EngineOut,LayoutOut>      & tensor_out,
+               T init,
+               BinaryOp op = {})
+{
+  CUTE_UNROLL
+  for (int i = 0; i < size(tensor_in); ++i) {
+    auto next = op(init, tensor_in(i));   // Read before write to allow in-place scans
+    tensor_out(i) = init;
+    init = next;
+  }
+}
+
+// Accept mutable temporaries
+template <class EngineIn, class LayoutIn,
+          class EngineOut, class LayoutOut,
+          class T, class BinaryOp = plus>
+CUTE_HOST_DEVICE constexpr
+void
+exclusive_scan(Tensor<EngineIn, LayoutIn > const& tensor_in,
+               Tensor<EngineOut,LayoutOut>     && tensor_out,
+               T init,
+               BinaryOp op = {})
+{
+  return exclusive_scan(tensor_in, tensor_out, init, op);
+}
+
+//
+// Warp scope
+//
+
+namespace detail {
+
+CUTE_DEVICE
+uint32_t
+lane_idx()
+{
+#if defined(__CUDA_ARCH__)
+  uint32_t lane;
+  asm volatile("mov.u32 %0, %%laneid;\n" : "=r"(lane));
+  return lane;
+#else
+  return 0;
+#endif
+}
+
+// Shuffle any trivially copyable value as a sequence of 32-bit words
+template <class T>
+CUTE_DEVICE
+T
+shfl_xor(T const& value, int lane_mask, int width)
+{
+#if defined(__CUDA_ARCH__)
+  constexpr int NumWords = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+  uint32_t words[NumWords] = {};
+  memcpy(words, &value, sizeof(T));
+  CUTE_UNROLL
+  for (int i = 0; i < NumWords; ++i) {
+    words[i] = __shfl_xor_sync(0xFFFFFFFF, words[i], lane_mask, width);
+  }
+  T result;
+  memcpy(&result, words, sizeof(T));
+  return result;
+#else
+  CUTE_INVALID_CONTROL_PATH("Warp shuffles require device compilation.");
+  return value;
+#endif
+}
+
+template <class T>
+CUTE_DEVICE
+T
+shfl_up(T const& value, int delta, int width)
+{
+#if defined(__CUDA_ARCH__)
+  constexpr int NumWords = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+  uint32_t words[NumWords] = {};
+  memcpy(words, &value, sizeof(T));
+  CUTE_UNROLL
+  for (int i = 0; i < NumWords; ++i) {
+    words[i] = __shfl_up_sync(0xFFFFFFFF, words[i], delta, width);
+  }
+  T result;
+  memcpy(&result, words, sizeof(T));
+  return result;
+#else
+  CUTE_INVALID_CONTROL_PATH("Warp shuffles require device compilation.");
+  return value;
+#endif
+}
+
+template <class T, class BinaryOp>
+static constexpr bool is_redux_sync_compatible_v =
+  (is_same_v<T, int32_t> || is_same_v<T, uint32_t>) &&
+  (is_same_v<BinaryOp, plus>    || is_same_v<BinaryOp, min_fn> || is_same_v<BinaryOp, max_fn> ||
+   is_same_v<BinaryOp, bit_and> || is_same_v<BinaryOp, bit_or> || is_same_v<BinaryOp, bit_xor>);
+
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+template <class T, class BinaryOp>
+CUTE_DEVICE
+T
+redux_sync(T value, BinaryOp)
+{
+  if constexpr (is_same_v<BinaryOp, plus>) {
+    return static_cast<T>(__reduce_add_sync(0xFFFFFFFF, value));
+  } else if constexpr (is_same_v<BinaryOp, min_fn>) {
+    return __reduce_min_sync(0xFFFFFFFF, value);
+  } else if constexpr (is_same_v<BinaryOp, max_fn>) {
+    return __reduce_max_sync(0xFFFFFFFF, value);
+  } else if constexpr (is_same_v<BinaryOp, bit_and>) {
+    return static_cast<T>(__reduce_and_sync(0xFFFFFFFF, static_cast<uint32_t>(value)));
+  } else if constexpr (is_same_v<BinaryOp, bit_or>) {
+    return static_cast<T>(__reduce_or_sync(0xFFFFFFFF, static_cast<uint32_t>(value)));
+  } else {
+    return static_cast<T>(__reduce_xor_sync(0xFFFFFFFF, static_cast<uint32_t>(value)));
+  }
+}
+#endif
+
+} // end namespace detail
+
+// Reduce value across each aligned group of Width lanes; every lane of the group receives the result
+template <int Width = 32, class T, class BinaryOp = plus>
+CUTE_DEVICE
+T
+warp_reduce(T value, BinaryOp op = {})
+{
+  static_assert(Width > 0 && Width <= 32 && (Width & (Width - 1)) == 0, "Width must be a power of two <= 32.");
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+  if constexpr (Width == 32 && detail::is_redux_sync_compatible_v<T, BinaryOp>) {
+    return detail::redux_sync(value, op);
+  } else
+#endif
+  {
+    CUTE_UNROLL
+    for (int lane_mask = Width / 2; lane_mask > 0; lane_mask /= 2) {
+      value = op(value, detail::shfl_xor(value, lane_mask, Width));
+    }
+    return value;
+  }
+}
+
+// Reduce every element of a register tensor across each aligned group of Width lanes, in place
+template <int Width = 32, class Engine, class Layout, class BinaryOp = plus>
+CUTE_DEVICE
+void
+warp_reduce(Tensor<Engine,Layout>& tensor, BinaryOp op = {})
+{
+  CUTE_UNROLL
+  for (int i = 0; i < size(tensor); ++i) {
+    tensor(i) = warp_reduce<Width>(tensor(i), op);
+  }
+}
+
+// Accept mutable temporaries
+template <int Width = 32, class Engine, class Layout, class BinaryOp = plus>
+CUTE_DEVICE
+void
+warp_reduce(Tensor<Engine,Layout>&& tensor, BinaryOp op = {})
+{
+  return warp_reduce<Width>(tensor, op);
+}
+
+// Inclusive scan of value across each aligned group of Width lanes, in lane order
+template <int Width = 32, class T, class BinaryOp = plus>
+CUTE_DEVICE
+T
+warp_inclusive_scan(T value, BinaryOp op = {})
+{
+  static_assert(Width > 0 && Width <= 32 && (Width & (Width - 1)) == 0, "Width must be a power of two <= 32.");
+  int lane = static_cast<int>(detail::lane_idx() % Width);
+  CUTE_UNROLL
+  for (int delta = 1; delta < Width; delta *= 2) {
+    T other = detail::shfl_up(value, delta, Width);
+    if (lane >= delta) {
+      value = op(other, value);
+    }
+  }
+  return value;
+}
+
+//
+// Cooperative scope
+//
+
+namespace detail {
+
+template <uint32_t NumThreads>
+CUTE_DEVICE
+void
+cooperative_barrier_sync(uint32_t barrier_id)
+{
+#if defined(__CUDA_ARCH__)
+  asm volatile("bar.sync %0, %1;\n" : : "r"(barrier_id), "n"(NumThreads) : "memory");
+#endif
+}
+
+} // end namespace detail
+
+// Reduce value across NumThreads threads (tid in [0, NumThreads)); every thread receives the result
+template <uint32_t NumThreads, class T, class BinaryOp = plus>
+CUTE_DEVICE
+T
+cooperative_reduce(uint32_t tid, T value, BinaryOp op, T* smem_buffer, uint32_t barrier_id = 0)
+{
+  static_assert(NumThreads % 32 == 0 && NumThreads <= 1024, "NumThreads must be a multiple of 32 and at most 1024.");
+  constexpr uint32_t NumWarps = NumThreads / 32;
+
+  value = warp_reduce(value, op);
+  if constexpr (NumWarps > 1) {
+    if (tid % 32 == 0) {
+      smem_buffer[tid / 32] = value;
+    }
+    detail::cooperative_barrier_sync<NumThreads>(barrier_id);
+    // Every thread folds the per-warp partials in warp order, so all threads agree bitwise
+    value = smem_buffer[0];
+    CUTE_UNROLL
+    for (uint32_t w = 1; w < NumWarps; ++w) {
+      value = op(value, smem_buffer[w]);
+    }
+  }
+  return value;
+}
+
+// Reduce a register tensor per thread, then across NumThreads threads
+template <uint32_t NumThreads, class Engine, class Layout, class T, class BinaryOp = plus>
+CUTE_DEVICE
+T
+cooperative_reduce(uint32_t tid, Tensor<Engine,Layout> const& tensor, T init, BinaryOp op,
+                   T* smem_buffer, uint32_t barrier_id = 0)
+{
+  // Fold the (non-empty) thread partial without init so that init is applied exactly once
+  T partial = tensor(0);
+  CUTE_UNROLL
+  for (int i = 1; i < size(tensor); ++i) {
+    partial = op(partial, tensor(i));
+  }
+  return op(init, cooperative_reduce<NumThreads>(tid, partial, op, smem_buffer, barrier_id));
+}
+
+// Inclusive scan of value across NumThreads threads in tid order
+template <uint32_t NumThreads, class T, class BinaryOp = plus>
+CUTE_DEVICE
+T
+cooperative_inclusive_scan(uint32_t tid, T value, BinaryOp op, T* smem_buffer, uint32_t barrier_id = 0)
+{
+  static_assert(NumThreads % 32 == 0 && NumThreads <= 1024, "NumThreads must be a multiple of 32 and at most 1024.");
+  constexpr uint32_t NumWarps = NumThreads / 32;
+
+  value = warp_inclusive_scan(value, op);
+  if constexpr (NumWarps > 1) {
+    uint32_t warp = tid / 32;
+    if (tid % 32 == 31) {
+      smem_buffer[warp] = value;
+    }
+    detail::cooperative_barrier_sync<NumThreads>(barrier_id);
+    if (warp > 0) {
+      T prefix = smem_buffer[0];
+      for (uint32_t w = 1; w < warp; ++w) {
+        prefix = op(prefix, smem_buffer[w]);
+      }
+      value = op(prefix, value);
+    }
+  }
+  return value;
+}
+
+} // end namespace cute
@@ -242,4 +242,34 @@ store_shared_remote(uint32_t value, uint32_t smem_addr, uint32_t mbarrier_addr,
 #endif
 }
 
+// Store four values to remote shared memory in the cluster. smem_addr must be 16B aligned.
+CUTE_DEVICE
+void
+store_shared_remote(uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3,
+                    uint32_t smem_addr, uint32_t mbarrier_addr, uint32_t dst_cta_rank)
+{
+#if defined(CUTE_ARCH_CLUSTER_SM90_ENABLED)
+  uint32_t dsmem_addr = set_block_rank(smem_addr, dst_cta_rank);
+  uint32_t remote_barrier_addr = set_block_rank(mbarrier_addr, dst_cta_rank);
+  asm volatile("st.async.shared::cluster.mbarrier::complete_tx::bytes.v4.u32 [%0], {%1, %2, %3, %4}, [%5];"
+               : : "r"(dsmem_addr), "r"(v0), "r"(v1), "r"(v2), "r"(v3), "r"(remote_barrier_addr));
+#endif
+}
+
+// Load value from remote shared memory in the cluster
+CUTE_DEVICE
+uint32_t
+load_shared_remote(uint32_t smem_addr, uint32_t src_cta_rank)
+{
+#if defined(CUTE_ARCH_CLUSTER_SM90_ENABLED)
+  uint32_t dsmem_addr = set_block_rank(smem_addr, src_cta_rank);
+  uint32_t value;
+  asm volatile("ld.shared::cluster.u32 %0, [%1];"
+               : "=r"(value) : "r"(dsmem_addr) : "memory");
+  return value;
+#else
+  return 0;
+#endif
+}
+
 } // end namespace cute
@@ -821,14 +821,16 @@ make_im2col_tma_copy(CopyOp                   const& copy_op,
                      UpperPaddingStride       const& upper_padding_whd,
                      TraversalStride          const& stride_whd,
                      LowerSRTStride           const& lower_srt,
-                     DilationStride           const& stride_srt)
+                     DilationStride           const& stride_srt,
+                     TMA::DescriptorAuxParams const& aux_params = {})
 {
   auto cta_v_tile = make_identity_layout(product_each(shape(tensor_cwhdn))).compose(cta_tiler);
   auto cta_t_tile = make_layout(multicast_size);
 
   return detail::make_tma_copy_im2col(copy_op, tensor_cwhdn,
                                       slayout, cta_t_tile, cta_v_tile,
-                                      lower_corner_whd, upper_corner_whd, lower_padding_whd, upper_padding_whd, stride_whd, lower_srt, stride_srt);
+                                      lower_corner_whd, upper_corner_whd, lower_padding_whd, upper_padding_whd, stride_whd, lower_srt, stride_srt,
+                                      aux_params);
 }
 
 // Explicit default for multicast_size
@@ -35,6 +35,7 @@
 #endif
 
 #include <cute/atom/copy_traits_sm90_tma_swizzle.hpp>
+#include <cute/atom/copy_traits_sm90_tma_desc_cache.hpp>
 #include <cute/atom/copy_traits.hpp>
 #include <cute/atom/copy_atom.hpp>
 
@@ -319,6 +320,7 @@ struct Copy_Traits<SM90_TMA_LOAD_MULTICAST_OP, NumBitsPerTMA>
 //////////////////////////////////////////////////////////////////////////////
 
 struct SM90_TMA_STORE_PTR : SM90_TMA_STORE {};
+struct SM90_TMA_STORE_OP : SM90_TMA_STORE {};
 
 // The executable SM90_TMA_STORE with tma_desc
 template <class NumBitsPerTMA, class AuxParams_>
@@ -360,6 +362,13 @@ struct Copy_Traits<SM90_TMA_STORE, NumBitsPerTMA, AuxParams_>
     return {new_tma_desc};
   }
 
+  // Construct an executable SM90_TMA_STORE with an L2 cache eviction policy
+  CUTE_HOST_DEVICE constexpr
+  Copy_Traits<SM90_TMA_STORE_OP, NumBitsPerTMA>
+  with(TMA::CacheHintSm90 const& cache_hint) const {
+    return {&tma_desc_, static_cast<uint64_t>(cache_hint)};
+  }
+
   template <class TS, class SLayout,
             class TD, class DLayout>
   CUTE_HOST_DEVICE friend constexpr void
@@ -386,6 +395,40 @@ struct Copy_Traits<SM90_TMA_STORE, NumBitsPerTMA, AuxParams_>
   }
 };
 
+// The executable SM90_TMA_STORE with tma_desc and an L2 cache eviction policy
+template <class NumBitsPerTMA>
+struct Copy_Traits<SM90_TMA_STORE_OP, NumBitsPerTMA>
+{
+  using ThrID     = Layout<_1>;
+  // Map from (src-thr,src-val) to bit
+  using SrcLayout = Layout<Shape<_1,NumBitsPerTMA>>;
+  // Map from (dst-thr,dst-val) to bit
+  using DstLayout = Layout<Shape<_1,NumBitsPerTMA>>;
+  // Reference map from (thr,val) to bit
+  using RefLayout = SrcLayout;
+
+  // SM90_TMA_STORE arguments
+  TmaDescriptor const* tma_desc_;
+  uint64_t cache_hint_;
+
+  template <class TS, class SLayout,
+            class TD, class DLayout>
+  CUTE_HOST_DEVICE friend constexpr void
+  copy_unpack(Copy_Traits        const& traits,
+              Tensor<TS,SLayout> const& src,
+              Tensor<TD,DLayout>      & dst)
+  {
+    static_assert(is_smem<TS>::value, "Expected smem src for SM90_TMA_STORE");
+
+    void const* const desc_ptr = traits.tma_desc_;
+    void const* const src_ptr  = cute::raw_pointer_cast(src.data());
+    auto dst_coord = dst.data().coord_;
+    return detail::explode_tuple(detail::CallCOPY<SM90_TMA_STORE_OP>{},
+                                 make_tuple(desc_ptr, traits.cache_hint_, src_ptr), seq<0,1,2>{},
+                                 dst_coord, tuple_seq<decltype(dst_coord)>{});
+  }
+};
+
 // Same as SM90_TMA_STORE, but with an unsafe TMA Desc PTR instead
 template <class NumBitsPerTMA>
 struct Copy_Traits<SM90_TMA_STORE_PTR, NumBitsPerTMA>
@@ -597,6 +640,93 @@ struct Copy_Traits<SM90_BULK_COPY_S2G, NumBitsPerTMA>
   }
 };
 
+//
+// Bulk gather: one SM90_BULK_COPY_G2S per gathered row
+//
+
+// The non-executable SM90_BULK_GATHER_G2S with the gmem row base and row stride
+// Use .with(bulk_mbar, row_indices) to construct an executable version
+struct SM90_BULK_GATHER_G2S : SM90_BULK_COPY_G2S {};
+struct SM90_BULK_GATHER_G2S_OP : SM90_BULK_GATHER_G2S {};
+
+template <class NumBitsPerRow, class... OpArgs>
+struct Copy_Traits<SM90_BULK_GATHER_G2S, NumBitsPerRow, OpArgs...>
+{
+  static_assert(int32_t(NumBitsPerRow::value / 8) % 16 == 0,
+                "Bulk Copy requires copy vector size align to 16B.");
+
+  using ThrID = Layout<_1>;
+  // Map from (src-thr,src-val) to bit
+  using SrcLayout = Layout<Shape<_1,NumBitsPerRow>>;
+  // Map from (dst-thr,dst-val) to bit
+  using DstLayout = Layout<Shape<_1,NumBitsPerRow>>;
+  // Reference map from (thr,val) to bit
+  using RefLayout = SrcLayout;
+
+  // SM90_BULK_GATHER_G2S arguments
+  void const* gmem_base_ = nullptr;
+  int64_t row_stride_bytes_ = 0;
+
+  // Construct an executable SM90_BULK_GATHER_G2S with the mbarrier and the gmem row of each gathered row
+  template <class Index>
+  CUTE_HOST_DEVICE constexpr
+  Copy_Traits<SM90_BULK_GATHER_G2S_OP, NumBitsPerRow, Index>
+  with(uint64_t& bulk_mbar, Index const* row_indices) const {
+    return {gmem_base_, row_stride_bytes_, &bulk_mbar, row_indices};
+  }
+
+  // Generate the (gathered_row, col) coord tensor to partition as the copy source
+  template <class GShape>
+  CUTE_HOST_DEVICE constexpr
+  auto
+  get_gather_tensor(GShape const& g_shape) const {
+    return make_identity_tensor(g_shape);
+  }
+
+  // Don't try to execute a copy with SM90_BULK_GATHER_G2S before calling .with()
+  template <class TS, class SLayout,
+            class TD, class DLayout>
+  CUTE_HOST_DEVICE friend constexpr void
+  copy_unpack(Copy_Traits        const& traits,
+              Tensor<TS,SLayout> const& src,
+              Tensor<TD,DLayout>      & dst) = delete;
+};
+
+// The executable SM90_BULK_GATHER_G2S. Every row completes on the same mbarrier, whose expected
+// transaction bytes must cover all gathered rows, e.g. set_barrier_transaction_bytes(mbar, rows * row_bytes).
+template <class NumBitsPerRow, class Index>
+struct Copy_Traits<SM90_BULK_GATHER_G2S_OP, NumBitsPerRow, Index>
+{
+  using ThrID = Layout<_1>;
+  // Map from (src-thr,src-val) to bit
+  using SrcLayout = Layout<Shape<_1,NumBitsPerRow>>;
+  // Map from (dst-thr,dst-val) to bit
+  using DstLayout = Layout<Shape<_1,NumBitsPerRow>>;
+  // Reference map from (thr,val) to bit
+  using RefLayout = SrcLayout;
+
+  void const* gmem_base_;
+  int64_t row_stride_bytes_;
+  uint64_t* bulk_mbar_;
+  Index const* row_indices_;
+
+  template <class TS, class SLayout,
+            class TD, class DLayout>
+  CUTE_HOST_DEVICE friend constexpr
+  void
+  copy_unpack(Copy_Traits        const& traits,
+              Tensor<TS,SLayout> const& src,
+              Tensor<TD,DLayout>      & dst)
+  {
+    static_assert(is_smem<TD>::value, "Expected smem dst for SM90_BULK_GATHER_G2S");
+    // The source is the (gathered_row, col) coord tensor, one full row per instruction
+    int64_t row = static_cast<int64_t>(traits.row_indices_[get<0>(src.data().coord_)]);
+    char const* gmem_row = static_cast<char const*>(traits.gmem_base_) + row * traits.row_stride_bytes_;
+    SM90_BULK_COPY_G2S::copy(gmem_row, traits.bulk_mbar_,
+                             raw_pointer_cast(dst.data()), int32_t(NumBitsPerRow::value / 8));
+  }
+};
+
 //
 // Placeholder for the bulk copy algorithm's default, auto-vectorizing behavior
 //
@@ -1005,7 +1135,11 @@ make_tma_copy_desc(Tensor<GEngine,GLayout> const& gtensor,         // The origin
     TMA::SmemSwizzleBits swizzle_bits = get_tma_swizzle_bits(swizzle);
     TMA::SmemSwizzleBase swizzle_base = get_tma_swizzle_base(swizzle);
     CUtensorMapSwizzle smem_swizzle = TMA::to_CUtensorMapSwizzle(swizzle_bits, swizzle_base);
+  #if defined(CUTE_ENABLE_TMA_DESCRIPTOR_CACHE)
+    CUresult result = TmaDescriptorCache::get().encode_tiled(
+  #else
     CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+  #endif
         &tma_desc,
         tma_format,
         tma_dim,
@@ -1557,4 +1691,45 @@ make_tma_copy_C_sm90(CopyOp                  const& copy_op,
     return tma_copy;
   }
 }
+
+//
+// MAKE_BULK_GATHER_COPY
+//
+
+/** Make a TiledCopy that gathers whole rows of a row-major (rows, row_elems) gmem tensor into smem,
+ *    one SM90_BULK_COPY_G2S per gathered row. Every row completes on the same mbarrier.
+ *
+ *  Usage:
+ *    auto gather = make_bulk_gather_copy(mA);                              // (rows,K):(ldA,_1) with static K
+ *    Tensor cG   = gather.get_gather_tensor(make_shape(n_gathered, K));   // (n_gathered,K) coords
+ *    Tensor sG   = make_tensor(make_smem_ptr(smem), make_layout(make_shape(n_gathered, K), LayoutRight{}));
+ *    auto thr_gather = gather.get_slice(0);
+ *    if (thread_idx == 0) {
+ *      set_barrier_transaction_bytes(mbar, n_gathered * K * sizeof_bits_v<T> / 8);
+ *      copy(gather.with(mbar, row_indices), thr_gather.partition_S(cG), thr_gather.partition_D(sG));
+ *    }
+ *    wait_barrier(mbar, phase);
+ */
+template <class GEngine, class GLayout>
+CUTE_HOST_RTC
+auto
+make_bulk_gather_copy(Tensor<GEngine,GLayout> const& gtensor)
+{
+  static_assert(is_gmem<GEngine>::value, "Bulk gather source must be global memory.");
+  static_assert(rank(GLayout{}) == 2, "Bulk gather expects a (rows, row_elems) tensor.");
+  static_assert(is_static<decltype(shape<1>(gtensor))>::value, "Bulk gather requires a static row length.");
+  static_assert(is_constant<1, decltype(stride<1>(gtensor))>::value, "Bulk gather requires contiguous rows.");
+
+  using T = typename GEngine::value_type;
+  constexpr int RowElems = size<1>(GLayout{});
+  using NumBitsPerRow = Int<RowElems * sizeof_bits_v<T>>;
+
+  using Traits = Copy_Traits<SM90_BULK_GATHER_G2S, NumBitsPerRow>;
+  Traits traits{raw_pointer_cast(gtensor.data()),
+                int64_t(stride<0>(gtensor)) * sizeof_bits_v<T> / 8};
+  using Atom = Copy_Atom<Traits, T>;
+
+  // One thread per gathered row, the whole row per thread
+  return TiledCopy<Atom, Layout<Shape<_1,Int<RowElems>>>, Shape<_1,Int<RowElems>>>{Atom{traits}};
+}
 } // end namespace cute
@@ -0,0 +1,181 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/// @file copy_traits_sm90_tma_desc_cache.hpp
+/// @brief Host-side cache of encoded TMA descriptors.
+///
+/// Encoding a tiled TMA descriptor goes through the driver on every make_tma_copy() call, which
+/// dominates host launch overhead when the same problem is launched repeatedly with rotating
+/// buffers. When CUTE_ENABLE_TMA_DESCRIPTOR_CACHE is defined, make_tma_copy() encodes each distinct
+/// (dtype, shape, stride, box, swizzle, ...) combination once per host thread and serves later
+/// requests from the cache, patching only the global address with cuTensorMapReplaceAddress.
+
+#if !defined(__CUDACC_RTC__)
+#include <cuda.h>
+
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#endif
+
+#include <cute/arch/copy_sm90_desc.hpp>
+#include <cutlass/cuda_host_adapter.hpp>
+
+namespace cute::detail {
+
+#if (__CUDACC_VER_MAJOR__ >= 12) && !defined(__CUDACC_RTC__)
+
+/// Every argument of cuTensorMapEncodeTiled except the global address. Fields are ordered so that
+/// the struct has no padding, which lets keys be compared and hashed bytewise.
+struct TmaDescriptorKey {
+  CUtensorMapDataType     format;
+  uint32_t                rank;
+  uint64_t                shape[5];
+  uint64_t                stride[4];
+  uint32_t                box_shape[5];
+  uint32_t                box_stride[5];
+  CUtensorMapInterleave   interleave;
+  CUtensorMapSwizzle      swizzle;
+  CUtensorMapL2promotion  l2_promotion;
+  CUtensorMapFloatOOBfill oob_fill;
+
+  bool operator==(TmaDescriptorKey const& rhs) const {
+    return std::memcmp(this, &rhs, sizeof(TmaDescriptorKey)) == 0;
+  }
+};
+
+static_assert(sizeof(TmaDescriptorKey) == 136, "TmaDescriptorKey must not contain padding.");
+
+struct TmaDescriptorKeyHash {
+  size_t operator()(TmaDescriptorKey const& key) const {
+    // FNV-1a over the key bytes
+    unsigned char const* bytes = reinterpret_cast<unsigned char const*>(&key);
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < sizeof(TmaDescriptorKey); ++i) {
+      hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+  }
+};
+
+/// Per-thread cache of tiled TMA descriptors. Each host thread owns its own instance, so lookups
+/// do not synchronize. The cache is cleared wholesale once it reaches kMaxEntries.
+class TmaDescriptorCache {
+public:
+
+  static constexpr size_t kMaxEntries = 4096;
+
+  /// Returns the calling thread's cache
+  static TmaDescriptorCache& get() {
+    static thread_local TmaDescriptorCache cache;
+    return cache;
+  }
+
+  /// Drop-in replacement for cuTensorMapEncodeTiled. `global_strides` holds rank-1 entries.
+  CUresult encode_tiled(
+      TmaDescriptor*          desc,
+      CUtensorMapDataType     format,
+      uint32_t                rank,
+      void*                   global_address,
+      uint64_t const*         global_shape,
+      uint64_t const*         global_strides,
+      uint32_t const*         box_shape,
+      uint32_t const*         box_strides,
+      CUtensorMapInterleave   interleave,
+      CUtensorMapSwizzle      swizzle,
+      CUtensorMapL2promotion  l2_promotion,
+      CUtensorMapFloatOOBfill oob_fill) {
+
+    if (rank == 0 || rank > 5) {
+      return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+          desc, format, rank, global_address, global_shape, global_strides,
+          box_shape, box_strides, interleave, swizzle, l2_promotion, oob_fill);
+    }
+
+    TmaDescriptorKey key;
+    std::memset(&key, 0, sizeof(key));
+    key.format = format;
+    key.rank = rank;
+    for (uint32_t i = 0; i < rank; ++i) {
+      key.shape[i] = global_shape[i];
+      key.box_shape[i] = box_shape[i];
+      key.box_stride[i] = box_strides[i];
+    }
+    for (uint32_t i = 0; i + 1 < rank; ++i) {
+      key.stride[i] = global_strides[i];
+    }
+    key.interleave = interleave;
+    key.swizzle = swizzle;
+    key.l2_promotion = l2_promotion;
+    key.oob_fill = oob_fill;
+
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      *desc = it->second;
+      CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapReplaceAddress)(desc, global_address);
+      if (result == CUDA_SUCCESS) {
+        return result;
+      }
+      // Fall back to a full encode, which reports the error with the complete argument list
+    }
+
+    CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+        desc, format, rank, global_address, global_shape, global_strides,
+        box_shape, box_strides, interleave, swizzle, l2_promotion, oob_fill);
+
+    if (result == CUDA_SUCCESS) {
+      if (entries_.size() >= kMaxEntries) {
+        entries_.clear();
+      }
+      entries_[key] = *desc;
+    }
+    return result;
+  }
+
+  /// Number of cached descriptors
+  size_t size() const {
+    return entries_.size();
+  }
+
+  /// Discards all cached descriptors
+  void clear() {
+    entries_.clear();
+  }
+
+private:
+
+  std::unordered_map<TmaDescriptorKey, TmaDescriptor, TmaDescriptorKeyHash> entries_;
+};
+
+#endif // (__CUDACC_VER_MAJOR__ >= 12) && !defined(__CUDACC_RTC__)
+
+} // end namespace cute::detail
@@ -64,6 +64,10 @@ using cutlass::tfloat32_t;
 using cutlass::type_erased_dynamic_float8_t;
 using cutlass::float_e4m3_t;
 using cutlass::float_e5m2_t;
+using cutlass::float_e2m1_t;
+using cutlass::float_e3m2_t;
+using cutlass::float_e2m3_t;
+using cutlass::float_ue8m0_t;
 
 using cutlass::uint1b_t;
 using cutlass::int2b_t;
@@ -108,6 +112,19 @@ print(float_e5m2_t a) {
   printf("%f", static_cast<float>(a));
 }
 
+template <int E, int M>
+CUTE_HOST_DEVICE
+void
+print(cutlass::float_subbyte<E, M> a) {
+  printf("%f", static_cast<float>(a));
+}
+
+CUTE_HOST_DEVICE
+void
+print(float_ue8m0_t a) {
+  printf("%f", static_cast<float>(a));
+}
+
 CUTE_HOST_DEVICE void
 pretty_print(bfloat16_t v) {
   printf("%*.2f", 8, float(v));
@@ -133,4 +150,15 @@ pretty_print(float_e5m2_t t) {
   printf("%*.2f", 8, static_cast<float>(t));
 }
 
+template <int E, int M>
+CUTE_HOST_DEVICE void
+pretty_print(cutlass::float_subbyte<E, M> t) {
+  printf("%*.2f", 8, static_cast<float>(t));
+}
+
+CUTE_HOST_DEVICE void
+pretty_print(float_ue8m0_t t) {
+  printf("%*.2e", 10, static_cast<float>(t));
+}
+
 } // namespace cute
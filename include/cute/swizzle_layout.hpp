@@ -581,4 +581,111 @@ logical_product(Layout<Shape,Stride>                          const& layout,
   return composition(make_swizzle<new_active_Y,new_active_Z>(), new_layout);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Shared memory bank conflict analysis
+///////////////////////////////////////////////////////////////////////////////
+
+// Returns the worst-case number of shared memory wavefronts per access phase (1 == conflict-free)
+// when each thread of the TV layout (thr,val) -> idx accesses AccessBits contiguous bits starting at
+// smem_layout(idx). One access is made per AccessBits/ElemBits values. Shared memory serves 128B per
+// wavefront, so 128b accesses are evaluated per quarter-warp, 64b per half-warp and others per warp.
+//
+// The TV layout is typically obtained from the partitioner that touches the smem tile, e.g.
+//   bank_conflict_ways<16>(sA_layout, tiled_copy.get_layoutD_TV())
+//   bank_conflict_ways<16, 32>(sC_layout, tiled_mma.get_layoutC_TV())
+template <int ElemBits, int AccessBits = 128, class SmemLayout, class TVLayout>
+CUTE_HOST_DEVICE constexpr
+int
+bank_conflict_ways(SmemLayout const& smem_layout, TVLayout const& tv_layout)
+{
+  static_assert(AccessBits % ElemBits == 0 && AccessBits <= 128, "Unsupported shared memory access width.");
+
+  constexpr int num_banks        = 32;
+  constexpr int vec_elems        = AccessBits / ElemBits;
+  constexpr int words_per_access = AccessBits >= 32 ? AccessBits / 32 : 1;
+  constexpr int thrs_per_phase   = num_banks / words_per_access;
+
+  int const num_thrs = int(size<0>(tv_layout));
+  int const num_vecs = int(size<1>(tv_layout)) / vec_elems;
+
+  int max_ways = 1;
+  for (int vec = 0; vec < num_vecs; ++vec) {
+    for (int thr0 = 0; thr0 < num_thrs; thr0 += thrs_per_phase) {
+      // Distinct 32b words touched by this phase; repeated words are broadcast
+      int words[num_banks] = {};
+      int num_words = 0;
+      for (int thr = thr0; thr < thr0 + thrs_per_phase && thr < num_thrs; ++thr) {
+        int word = int(smem_layout(tv_layout(thr, vec * vec_elems))) * ElemBits / 32;
+        for (int w = word; w < word + words_per_access; ++w) {
+          bool is_new = true;
+          for (int i = 0; i < num_words; ++i) {
+            is_new &= words[i] != w;
+          }
+          if (is_new && num_words < num_banks) {
+            words[num_words++] = w;
+          }
+        }
+      }
+      int ways[num_banks] = {};
+      for (int i = 0; i < num_words; ++i) {
+        int bank_ways = ++ways[words[i] % num_banks];
+        max_ways = bank_ways > max_ways ? bank_ways : max_ways;
+      }
+    }
+  }
+  return max_ways;
+}
+
+namespace detail {
+
+// Conflict degree of smem_layout under Swizzle<B,M,3>, or a large sentinel if the swizzle does not tile it
+template <int B, int M, int ElemBits, int AccessBits, class Shape, class Stride, class TVLayout>
+CUTE_HOST_DEVICE constexpr
+int
+swizzled_bank_conflict_ways(Layout<Shape,Stride> const& smem_layout, TVLayout const& tv_layout)
+{
+  if (int(cosize(smem_layout)) % (1 << (M + B)) != 0) {
+    return 1 << 30;
+  }
+  return bank_conflict_ways<ElemBits, AccessBits>(composition(Swizzle<B,M,3>{}, smem_layout), tv_layout);
+}
+
+// Index of the first minimum, so that the narrowest of equally good swizzles is preferred
+template <int N>
+CUTE_HOST_DEVICE constexpr
+int
+first_min_index(int const (&ways)[N])
+{
+  int best = 0;
+  for (int i = 1; i < N; ++i) {
+    best = ways[i] < ways[best] ? i : best;
+  }
+  return best;
+}
+
+} // end namespace detail
+
+// Returns smem_layout composed with the narrowest Swizzle<B,M,3> (B in [0,3], M such that 16B chunks
+// stay contiguous) that minimizes bank_conflict_ways for the given access pattern. This generalizes the
+// GMMA-canonical swizzle atoms to arbitrary static smem layouts and TiledCopy/TiledMma partitionings.
+//   auto sD_layout = make_conflict_free_smem_layout<16>(sD_layout_rowmajor, tiled_r2s.get_layoutD_TV());
+template <int ElemBits, int AccessBits = 128, class Shape, class Stride, class TVLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+make_conflict_free_smem_layout(Layout<Shape,Stride> const& smem_layout, TVLayout const& tv_layout)
+{
+  static_assert(is_static<Layout<Shape,Stride>>::value && is_static<TVLayout>::value,
+                "Swizzle selection requires static smem and TV layouts.");
+  using SmemLayout = Layout<Shape,Stride>;
+  constexpr int M = ElemBits < 128 ? log_2(static_cast<unsigned int>(128 / ElemBits)) : 0;
+  constexpr int ways[4] = {
+    detail::swizzled_bank_conflict_ways<0, M, ElemBits, AccessBits>(SmemLayout{}, TVLayout{}),
+    detail::swizzled_bank_conflict_ways<1, M, ElemBits, AccessBits>(SmemLayout{}, TVLayout{}),
+    detail::swizzled_bank_conflict_ways<2, M, ElemBits, AccessBits>(SmemLayout{}, TVLayout{}),
+    detail::swizzled_bank_conflict_ways<3, M, ElemBits, AccessBits>(SmemLayout{}, TVLayout{})
+  };
+  constexpr int B = detail::first_min_index(ways);
+  return composition(Swizzle<B,M,3>{}, smem_layout);
+}
+
 } // end namespace cute
@@ -147,8 +147,9 @@ enum class ReservedNamedBarriers {
   TransposeBarrier = 2,
   TransformBarrier = 3,
   StreamkBarrier0 = 4,
-  StreamkBarrier1 = 5
-  , FirstUserBarrier = StreamkBarrier1 + 1
+  StreamkBarrier1 = 5,
+  EpilogueSmemReuseBarrier = 6
+  , FirstUserBarrier = EpilogueSmemReuseBarrier + 1
 };
 
 
@@ -0,0 +1,279 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Per-launch kernel timing from %globaltimer stamps taken inside the kernel.
+
+    cudaEvent pairs measure stream time, which includes queueing behind and overlap with work on
+    other streams. When CUTLASS_ENABLE_KERNEL_TIMER is defined, cutlass::device_kernel stamps
+    %globaltimer in the prologue and epilogue of every CTA and appends one record per CTA to a
+    device buffer, tagged with the launch's %gridid and the SM it ran on. The host groups the
+    records by launch, giving the start and end of each kernel's execution and the SMs it occupied,
+    independent of what else the device was running.
+
+    Host usage:
+      cutlass::arch::kernel_timer_setup();                   // before the launches
+      ...launches, on any number of streams...
+      auto launches = cutlass::arch::kernel_timer_collect(); // one entry per launch, in launch order
+
+    The epilogue stamp is taken after a CTA-wide barrier, so enabling the timer adds one
+    __syncthreads() per CTA. %globaltimer has a resolution of about a microsecond on some parts,
+    so it is best suited to kernels running for tens of microseconds or more.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#if defined(__CUDACC_RTC__)
+#include <cuda/std/cstdint>
+#else
+#include <cstdint>
+#endif
+
+#if !defined(__CUDACC_RTC__)
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <map>
+#include <utility>
+#include <vector>
+#endif
+
+namespace cutlass {
+namespace arch {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ENABLE_KERNEL_TIMER)
+
+// Records beyond this count are dropped rather than overwriting earlier launches
+constexpr uint32_t kernel_timer_max_records = 1 << 20;
+
+struct KernelTimerRecord {
+  uint64_t grid_id;
+  uint64_t start;
+  uint64_t end;
+  uint32_t block;
+  uint32_t smid;
+};
+
+#if !defined(__CUDACC_RTC__)
+inline KernelTimerRecord* kernel_timer_host_records = nullptr;
+inline uint32_t* kernel_timer_host_head = nullptr;
+#endif
+
+#if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+CUTLASS_DEVICE KernelTimerRecord* kernel_timer_records;
+CUTLASS_DEVICE uint32_t* kernel_timer_head;
+#endif
+
+#endif // defined(CUTLASS_ENABLE_KERNEL_TIMER)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Returns the prologue timestamp of the calling CTA. Must be called by all threads of the CTA.
+CUTLASS_DEVICE
+uint64_t kernel_timer_begin() {
+  #if defined(CUTLASS_ENABLE_KERNEL_TIMER) && (defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__)))
+  uint64_t time = 0;
+  if (threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0) {
+    asm volatile ("mov.u64 %0, %%globaltimer;\n" : "=l"(time) :);
+  }
+  return time;
+  #else
+  return 0;
+  #endif
+}
+
+// Waits for all threads of the CTA and appends its record. Must be called by all threads of the
+// CTA with the value returned by kernel_timer_begin().
+CUTLASS_DEVICE
+void kernel_timer_end(uint64_t start) {
+  #if defined(CUTLASS_ENABLE_KERNEL_TIMER) && (defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__)))
+  __syncthreads();
+  if (threadIdx.x != 0 || threadIdx.y != 0 || threadIdx.z != 0 || kernel_timer_records == nullptr) {
+    return;
+  }
+
+  uint64_t time;
+  uint64_t grid_id;
+  uint32_t smid;
+  asm volatile ("mov.u64 %0, %%globaltimer;\n" : "=l"(time) :);
+  asm volatile ("mov.u64 %0, %%gridid;\n" : "=l"(grid_id) :);
+  asm volatile ("mov.u32 %0, %%smid;\n" : "=r"(smid) :);
+
+  uint32_t slot = atomicAdd(kernel_timer_head, 1u);
+  if (slot >= kernel_timer_max_records) {
+    return;
+  }
+
+  KernelTimerRecord& record = kernel_timer_records[slot];
+  record.grid_id = grid_id;
+  record.start = start;
+  record.end = time;
+  record.block = blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+  record.smid = smid;
+  #else
+  CUTLASS_UNUSED(start);
+  #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__CUDACC_RTC__)
+
+/// Time spent by one launch on one SM
+struct KernelSmResidency {
+  uint32_t sm = 0;
+  uint32_t cta_count = 0;
+  uint64_t first_start_ns = 0;   ///< globaltimer at the first CTA prologue on this SM
+  uint64_t last_end_ns = 0;      ///< globaltimer at the last CTA epilogue on this SM
+  uint64_t busy_ns = 0;          ///< length of the union of this launch's CTA intervals on this SM
+};
+
+/// Execution interval of one kernel launch
+struct KernelLaunchTiming {
+  uint64_t grid_id = 0;          ///< %gridid of the launch; increases with launch order
+  uint64_t start_ns = 0;         ///< globaltimer at the earliest CTA prologue
+  uint64_t end_ns = 0;           ///< globaltimer at the latest CTA epilogue
+  uint32_t cta_count = 0;
+  std::vector<KernelSmResidency> sms;
+
+  double milliseconds() const {
+    return double(end_ns - start_ns) * 1e-6;
+  }
+};
+
+// Allocates (on first use) and clears the record buffer of the current device.
+inline void kernel_timer_setup() {
+  #if defined(CUTLASS_ENABLE_KERNEL_TIMER)
+  #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+  auto fail = [] () {
+    fprintf(stderr, "kernel_timer_setup() failed\n");
+    std::terminate();
+  };
+  if (kernel_timer_host_records == nullptr) {
+    if (cudaMalloc(&kernel_timer_host_records, size_t(kernel_timer_max_records) * sizeof(KernelTimerRecord)) != cudaSuccess ||
+      cudaMalloc(&kernel_timer_host_head, sizeof(uint32_t)) != cudaSuccess) {
+      fail();
+    }
+  }
+  if (cudaMemset(kernel_timer_host_head, 0, sizeof(uint32_t)) != cudaSuccess ||
+    cudaMemcpyToSymbol(kernel_timer_records, &kernel_timer_host_records, sizeof(kernel_timer_host_records)) != cudaSuccess ||
+    cudaMemcpyToSymbol(kernel_timer_head, &kernel_timer_host_head, sizeof(kernel_timer_host_head)) != cudaSuccess) {
+    fail();
+  }
+  #endif
+  #endif // defined(CUTLASS_ENABLE_KERNEL_TIMER)
+}
+
+// Synchronizes the device and returns the launches recorded since kernel_timer_setup(), ordered
+// by grid id. If the record buffer overflowed, the number of dropped CTA records is written to
+// dropped_records and the affected launches are incomplete.
+inline std::vector<KernelLaunchTiming> kernel_timer_collect(uint32_t* dropped_records = nullptr) {
+  std::vector<KernelLaunchTiming> launches;
+  if (dropped_records) {
+    *dropped_records = 0;
+  }
+  #if defined(CUTLASS_ENABLE_KERNEL_TIMER)
+  #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+  auto fail = [] () {
+    fprintf(stderr, "kernel_timer_collect() failed\n");
+    std::terminate();
+  };
+  if (kernel_timer_host_records == nullptr) {
+    fail();
+  }
+
+  uint32_t head = 0;
+  if (cudaDeviceSynchronize() != cudaSuccess ||
+    cudaMemcpy(&head, kernel_timer_host_head, sizeof(head), cudaMemcpyDeviceToHost) != cudaSuccess) {
+    fail();
+  }
+  uint32_t count = std::min(head, kernel_timer_max_records);
+  std::vector<KernelTimerRecord> records(count);
+  if (count && cudaMemcpy(records.data(), kernel_timer_host_records, count * sizeof(KernelTimerRecord), cudaMemcpyDeviceToHost) != cudaSuccess) {
+    fail();
+  }
+  if (dropped_records) {
+    *dropped_records = head - count;
+  }
+
+  // CTA intervals of each (launch, SM) pair
+  std::map<std::pair<uint64_t, uint32_t>, std::vector<std::pair<uint64_t, uint64_t>>> intervals;
+  for (KernelTimerRecord const& record : records) {
+    intervals[{record.grid_id, record.smid}].push_back({record.start, record.end});
+  }
+
+  for (auto& [key, sm_intervals] : intervals) {
+    if (launches.empty() || launches.back().grid_id != key.first) {
+      KernelLaunchTiming launch;
+      launch.grid_id = key.first;
+      launch.start_ns = UINT64_MAX;
+      launches.push_back(launch);
+    }
+    KernelLaunchTiming& launch = launches.back();
+
+    std::sort(sm_intervals.begin(), sm_intervals.end());
+    KernelSmResidency residency;
+    residency.sm = key.second;
+    residency.cta_count = uint32_t(sm_intervals.size());
+    residency.first_start_ns = sm_intervals.front().first;
+
+    // Co-resident CTAs overlap, so busy time is the length of the union of their intervals
+    uint64_t open_start = sm_intervals.front().first;
+    uint64_t open_end = sm_intervals.front().second;
+    for (auto const& [start, end] : sm_intervals) {
+      if (start > open_end) {
+        residency.busy_ns += open_end - open_start;
+        open_start = start;
+      }
+      open_end = std::max(open_end, end);
+    }
+    residency.busy_ns += open_end - open_start;
+    residency.last_end_ns = open_end;
+
+    launch.start_ns = std::min(launch.start_ns, residency.first_start_ns);
+    launch.end_ns = std::max(launch.end_ns, residency.last_end_ns);
+    launch.cta_count += residency.cta_count;
+    launch.sms.push_back(residency);
+  }
+  #endif
+  #endif // defined(CUTLASS_ENABLE_KERNEL_TIMER)
+  return launches;
+}
+
+#endif // !defined(__CUDACC_RTC__)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace arch
+} // namespace cutlass
@@ -72,6 +72,10 @@ struct OpMultiplyAddFastF16 {};
 /// upcasted to the wider type
 struct OpMultiplyAddMixedInputUpcast {};
 
+/// Tag indicating the input data types are mixed, the narrower type is upcasted to the wider
+/// type and then dequantized with group-wise (along K) scales and zero-points
+struct OpMultiplyAddMixedInputUpcastGroupwise {};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 /// Tag indicating the input is converted to 2 (big and small) TF32 or FP16 components
 //  Perform 3xTF32 or 4xTF32 for every F32 output element on Ampere
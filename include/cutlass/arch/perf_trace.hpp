@@ -0,0 +1,288 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Low-overhead pipeline event tracing for performance analysis.
+
+    When CUTLASS_ENABLE_PERF_TRACE is defined, the SM90 pipeline classes stamp %globaltimer around
+    their producer/consumer waits and releases. One record is written per warp and event into a
+    per-SM ring buffer in global memory. Unlike synclog, no CUDA builtins are redefined and events
+    are recorded for every CTA, so the trace reflects the steady state of the whole kernel.
+
+    Host usage:
+      cutlass::arch::perf_trace_setup();            // before the kernel launch
+      ...launch...
+      cutlass::arch::perf_trace_write_chrome_json(ofs); // loadable in chrome://tracing or Perfetto
+
+    In the emitted trace, pid is the SM id and tid is the warp index within the CTA, so producer
+    (TMA), MMA and epilogue warps of a warp-specialized kernel show up as separate rows.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#if defined(__CUDACC_RTC__)
+#include <cuda/std/cstdint>
+#else
+#include <cstdint>
+#endif
+
+#if !defined(__CUDACC_RTC__)
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+#endif
+
+namespace cutlass {
+namespace arch {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Pipelines that emit events. Stored in bits [7:4] of the event id.
+constexpr uint32_t perf_trace_pipeline_tma_async = 0;
+constexpr uint32_t perf_trace_pipeline_transaction_async = 1;
+constexpr uint32_t perf_trace_pipeline_tma_store = 2;
+
+// Operations. Stored in bits [3:0] of the event id.
+constexpr uint32_t perf_trace_op_producer_acquire_begin = 1;
+constexpr uint32_t perf_trace_op_producer_acquire_end = 2;
+constexpr uint32_t perf_trace_op_consumer_wait_begin = 3;
+constexpr uint32_t perf_trace_op_consumer_wait_end = 4;
+constexpr uint32_t perf_trace_op_consumer_release = 5;
+constexpr uint32_t perf_trace_op_producer_commit = 6;
+
+#if defined(CUTLASS_ENABLE_PERF_TRACE)
+
+// Must be powers of two
+constexpr uint32_t perf_trace_max_sms = 256;
+constexpr uint32_t perf_trace_ring_cap = 1 << 16;
+
+struct PerfTraceRecord {
+  uint64_t time;
+  // [7:0] event id, [15:8] warp index in CTA, [31:16] pipeline stage
+  uint32_t event;
+  uint32_t block;
+};
+
+#if !defined(__CUDACC_RTC__)
+inline PerfTraceRecord* perf_trace_host_records = nullptr;
+inline uint32_t* perf_trace_host_heads = nullptr;
+#endif
+
+#if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+CUTLASS_DEVICE PerfTraceRecord* perf_trace_records;
+CUTLASS_DEVICE uint32_t* perf_trace_heads;
+#endif
+
+#endif // defined(CUTLASS_ENABLE_PERF_TRACE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Records one event for the calling warp. Only the lowest active lane writes, so the call may be
+// made from a single elected thread or from all threads of a warp.
+CUTLASS_DEVICE
+void perf_trace_emit(uint32_t pipeline, uint32_t op, uint32_t stage) {
+  #if defined(CUTLASS_ENABLE_PERF_TRACE) && (defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__)))
+  if (perf_trace_records == nullptr) {
+    return;
+  }
+  uint32_t lane = threadIdx.x % NumThreadsPerWarp;
+  if (lane != static_cast<uint32_t>(__ffs(__activemask()) - 1)) {
+    return;
+  }
+
+  uint64_t time;
+  uint32_t smid;
+  asm volatile ("mov.u64 %0, %%globaltimer;\n" : "=l"(time) :);
+  asm volatile ("mov.u32 %0, %%smid;\n" : "=r"(smid) :);
+  if (smid >= perf_trace_max_sms) {
+    return;
+  }
+
+  uint32_t warp = threadIdx.x / NumThreadsPerWarp;
+  uint32_t block = blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+  uint32_t slot = atomicAdd(&perf_trace_heads[smid], 1u) & (perf_trace_ring_cap - 1);
+
+  PerfTraceRecord& record = perf_trace_records[smid * perf_trace_ring_cap + slot];
+  record.time = time;
+  record.event = (pipeline << 4 | op) | (warp & 0xff) << 8 | stage << 16;
+  record.block = block;
+  #else
+  CUTLASS_UNUSED(pipeline);
+  CUTLASS_UNUSED(op);
+  CUTLASS_UNUSED(stage);
+  #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__CUDACC_RTC__)
+
+// Allocates (on first use) and clears the trace buffers of the current device.
+inline void perf_trace_setup() {
+  #if defined(CUTLASS_ENABLE_PERF_TRACE)
+  #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+  auto fail = [] () {
+    fprintf(stderr, "perf_trace_setup() failed\n");
+    std::terminate();
+  };
+  size_t records_bytes = size_t(perf_trace_max_sms) * perf_trace_ring_cap * sizeof(PerfTraceRecord);
+  size_t heads_bytes = perf_trace_max_sms * sizeof(uint32_t);
+  if (perf_trace_host_records == nullptr) {
+    if (cudaMalloc(&perf_trace_host_records, records_bytes) != cudaSuccess ||
+      cudaMalloc(&perf_trace_host_heads, heads_bytes) != cudaSuccess) {
+      fail();
+    }
+  }
+  if (cudaMemset(perf_trace_host_heads, 0, heads_bytes) != cudaSuccess ||
+    cudaMemcpyToSymbol(perf_trace_records, &perf_trace_host_records, sizeof(perf_trace_host_records)) != cudaSuccess ||
+    cudaMemcpyToSymbol(perf_trace_heads, &perf_trace_host_heads, sizeof(perf_trace_host_heads)) != cudaSuccess) {
+    fail();
+  }
+  #endif
+  #endif // defined(CUTLASS_ENABLE_PERF_TRACE)
+}
+
+// Synchronizes the device and writes all recorded events in the Chrome trace event format.
+// Waits are emitted as complete ("X") events and releases/commits as instant ("i") events.
+// Timestamps are in microseconds relative to the earliest recorded event.
+inline void perf_trace_write_chrome_json(std::ostream& os) {
+  #if defined(CUTLASS_ENABLE_PERF_TRACE)
+  #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+  auto fail = [] () {
+    fprintf(stderr, "perf_trace_write_chrome_json() failed\n");
+    std::terminate();
+  };
+  if (perf_trace_host_records == nullptr) {
+    fail();
+  }
+
+  std::vector<uint32_t> heads(perf_trace_max_sms);
+  std::vector<PerfTraceRecord> records(size_t(perf_trace_max_sms) * perf_trace_ring_cap);
+  if (cudaDeviceSynchronize() != cudaSuccess ||
+    cudaMemcpy(heads.data(), perf_trace_host_heads, heads.size() * sizeof(uint32_t), cudaMemcpyDeviceToHost) != cudaSuccess ||
+    cudaMemcpy(records.data(), perf_trace_host_records, records.size() * sizeof(PerfTraceRecord), cudaMemcpyDeviceToHost) != cudaSuccess) {
+    fail();
+  }
+
+  // Unroll each ring into chronological order; older records were overwritten on wrap-around.
+  struct Event { uint32_t sm; PerfTraceRecord record; };
+  std::vector<Event> events;
+  for (uint32_t sm = 0; sm < perf_trace_max_sms; ++sm) {
+    uint32_t count = std::min(heads[sm], perf_trace_ring_cap);
+    for (uint32_t i = heads[sm] - count; i != heads[sm]; ++i) {
+      events.push_back({sm, records[size_t(sm) * perf_trace_ring_cap + (i & (perf_trace_ring_cap - 1))]});
+    }
+  }
+  std::stable_sort(events.begin(), events.end(),
+    [] (Event const& a, Event const& b) { return a.record.time < b.record.time; });
+  uint64_t time_base = events.empty() ? 0 : events.front().record.time;
+
+  auto pipeline_name = [] (uint32_t pipeline) {
+    switch (pipeline) {
+      case perf_trace_pipeline_tma_async: return "PipelineTmaAsync";
+      case perf_trace_pipeline_transaction_async: return "PipelineTransactionAsync";
+      case perf_trace_pipeline_tma_store: return "PipelineTmaStore";
+      default: return "Pipeline";
+    }
+  };
+  auto op_name = [] (uint32_t op) {
+    switch (op) {
+      case perf_trace_op_producer_acquire_begin:
+      case perf_trace_op_producer_acquire_end: return "producer_acquire";
+      case perf_trace_op_consumer_wait_begin:
+      case perf_trace_op_consumer_wait_end: return "consumer_wait";
+      case perf_trace_op_consumer_release: return "consumer_release";
+      case perf_trace_op_producer_commit: return "producer_commit";
+      default: return "unknown";
+    }
+  };
+
+  // Begin timestamp of each open wait, keyed by (sm, block, warp, matching end event)
+  auto pending_key = [] (uint32_t sm, uint32_t block, uint32_t warp_and_event) {
+    return uint64_t(sm) << 56 | uint64_t(block) << 16 | warp_and_event;
+  };
+  std::unordered_map<uint64_t, uint64_t> pending;
+
+  char const* sep = "";
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+  for (Event const& e : events) {
+    uint32_t event = e.record.event & 0xff;
+    uint32_t warp = (e.record.event >> 8) & 0xff;
+    uint32_t stage = e.record.event >> 16;
+    uint32_t pipeline = event >> 4;
+    uint32_t op = event & 0xf;
+    double ts = double(e.record.time - time_base) * 1e-3;
+
+    if (op == perf_trace_op_producer_acquire_begin || op == perf_trace_op_consumer_wait_begin) {
+      // Each *_end op is its *_begin op plus one
+      pending[pending_key(e.sm, e.record.block, (e.record.event & 0xffff) + 1)] = e.record.time;
+      continue;
+    }
+
+    if (op == perf_trace_op_producer_acquire_end || op == perf_trace_op_consumer_wait_end) {
+      auto it = pending.find(pending_key(e.sm, e.record.block, e.record.event & 0xffff));
+      if (it == pending.end()) {
+        continue;
+      }
+      double begin = double(it->second - time_base) * 1e-3;
+      pending.erase(it);
+      os << sep << "{\"name\":\"" << pipeline_name(pipeline) << "::" << op_name(op)
+         << "\",\"ph\":\"X\",\"pid\":" << e.sm << ",\"tid\":" << warp
+         << ",\"ts\":" << begin << ",\"dur\":" << (ts - begin)
+         << ",\"args\":{\"block\":" << e.record.block << ",\"stage\":" << stage << "}}";
+    }
+    else {
+      os << sep << "{\"name\":\"" << pipeline_name(pipeline) << "::" << op_name(op)
+         << "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":" << e.sm << ",\"tid\":" << warp
+         << ",\"ts\":" << ts
+         << ",\"args\":{\"block\":" << e.record.block << ",\"stage\":" << stage << "}}";
+    }
+    sep = ",\n";
+  }
+  os << "\n]}\n";
+  #else
+  CUTLASS_UNUSED(os);
+  #endif
+  #else
+  CUTLASS_UNUSED(os);
+  #endif // defined(CUTLASS_ENABLE_PERF_TRACE)
+}
+
+#endif // !defined(__CUDACC_RTC__)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace arch
+} // namespace cutlass
@@ -2685,6 +2685,100 @@ Array<T, N> fma(Array<T, N> const &a, Array<T, N> const &b, T c) {
   return op(a, b, c);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Vector atomic reductions
+//
+// The destination of the vector forms must be aligned to the size of the whole array.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, int N>
+struct atomic_add<Array<T, N>> {
+  CUTLASS_DEVICE
+  void operator()(Array<T, N> *ptr, Array<T, N> const &data) {
+    atomic_add<T> op;
+    T *ptr_elements = reinterpret_cast<T *>(ptr);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      op(ptr_elements + i, data[i]);
+    }
+  }
+};
+
+template <>
+struct atomic_add<Array<float, 2>> {
+  CUTLASS_DEVICE
+  void operator()(Array<float, 2> *ptr, Array<float, 2> const &data) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+    // Vector atomic reductions require .target sm_90 or higher
+    asm volatile ("red.global.v2.f32.add [%0], {%1, %2};\n"
+      : : "l"(ptr), "f"(data[0]), "f"(data[1]));
+#elif defined(__CUDA_ARCH__)
+    float *ptr_elements = reinterpret_cast<float *>(ptr);
+    atomicAdd(ptr_elements, data[0]);
+    atomicAdd(ptr_elements + 1, data[1]);
+#else
+    CUTLASS_UNUSED(ptr);
+    CUTLASS_UNUSED(data);
+    CUTLASS_NOT_IMPLEMENTED();
+#endif
+  }
+};
+
+template <>
+struct atomic_add<Array<float, 4>> {
+  CUTLASS_DEVICE
+  void operator()(Array<float, 4> *ptr, Array<float, 4> const &data) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+    // Vector atomic reductions require .target sm_90 or higher
+    asm volatile ("red.global.v4.f32.add [%0], {%1, %2, %3, %4};\n"
+      : : "l"(ptr), "f"(data[0]), "f"(data[1]), "f"(data[2]), "f"(data[3]));
+#elif defined(__CUDA_ARCH__)
+    float *ptr_elements = reinterpret_cast<float *>(ptr);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < 4; ++i) {
+      atomicAdd(ptr_elements + i, data[i]);
+    }
+#else
+    CUTLASS_UNUSED(ptr);
+    CUTLASS_UNUSED(data);
+    CUTLASS_NOT_IMPLEMENTED();
+#endif
+  }
+};
+
+template <>
+struct atomic_add<Array<half_t, 2>> {
+  CUTLASS_DEVICE
+  void operator()(Array<half_t, 2> *ptr, Array<half_t, 2> const &data) {
+#if !defined(__CUDA_ARCH__) || (defined(__CUDA_ARCH__)  && (__CUDA_ARCH__ < 600))
+    CUTLASS_UNUSED(ptr);
+    CUTLASS_UNUSED(data);
+    CUTLASS_NOT_IMPLEMENTED();
+#else
+    // Vector-2 atomic reduction requires .target sm_60 or higher
+    uint32_t word = reinterpret_cast<const uint32_t&>(data);
+    asm volatile ("red.gpu.global.add.noftz.f16x2 [%0], %1;\n" : : "l"(ptr), "r"(word));
+#endif
+  }
+};
+
+template <>
+struct atomic_add<Array<bfloat16_t, 2>> {
+  CUTLASS_DEVICE
+  void operator()(Array<bfloat16_t, 2> *ptr, Array<bfloat16_t, 2> const &data) {
+#if !defined(__CUDA_ARCH__) || (defined(__CUDA_ARCH__)  && (__CUDA_ARCH__ < 900))
+    CUTLASS_UNUSED(ptr);
+    CUTLASS_UNUSED(data);
+    CUTLASS_NOT_IMPLEMENTED();
+#else
+    // Vector-2 bf16 atomic reduction requires .target sm_90 or higher
+    uint32_t word = reinterpret_cast<const uint32_t&>(data);
+    asm volatile ("red.gpu.global.add.noftz.bf16x2 [%0], %1;\n" : : "l"(ptr), "r"(word));
+#endif
+  }
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
   
 
@@ -62,12 +62,15 @@ sm90_cluster_shape_to_im2col_tma_atom(UnimodalClusterShape unimodal_cluster_shap
 template<
   class GmemTiledCopy_,
   class SmemLayout_,
-  class SmemCopyAtom_ = void
+  class SmemCopyAtom_ = void,
+  class SmemLayoutAtom_ = void
 >
 struct Sm90ImplicitGemmTileTraits {
   using GmemTiledCopy = GmemTiledCopy_;
   using SmemLayout = SmemLayout_;
   using SmemCopyAtom = SmemCopyAtom_;
+  // Atom SmemLayout is tiled from, if the collective needs it to transpose the operand in smem
+  using SmemLayoutAtom = SmemLayoutAtom_;
 };
 
 // Accepts a cutlass::layout::Tensor tag and computes the corresponding spatial dimension count
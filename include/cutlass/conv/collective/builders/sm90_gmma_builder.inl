@@ -73,6 +73,28 @@ compute_stage_count_or_override(StageCountAutoCarveout<carveout_bytes> stage_cou
   return (CapacityBytes - carveout_bytes) / stage_bytes;
 }
 
+// Stage count for mainloops that also stage a per-channel scale and bias tile of ElementA along K.
+template<int CapacityBytes, class ElementA, class ElementB, class TileShapeMNK, class StageCountType>
+constexpr int
+compute_scale_bias_stage_count_or_override(StageCountType stage_count) {
+  return compute_stage_count_or_override<CapacityBytes, ElementA, ElementB, TileShapeMNK>(stage_count);
+}
+
+template<int CapacityBytes, class ElementA, class ElementB, class TileShapeMNK, int carveout_bytes>
+constexpr int
+compute_scale_bias_stage_count_or_override(StageCountAutoCarveout<carveout_bytes> stage_count) {
+  constexpr auto mainloop_pipeline_bytes = sizeof(typename cutlass::PipelineTmaAsync<1>::SharedStorage);
+  constexpr auto a_bits = cute::sizeof_bits_v<ElementA>;
+  constexpr auto b_bits = cute::sizeof_bits_v<ElementB>;
+  constexpr int stage_bytes =
+    cutlass::bits_to_bytes(a_bits * size<0>(TileShapeMNK{}) * size<2>(TileShapeMNK{})) +
+    cutlass::bits_to_bytes(b_bits * size<1>(TileShapeMNK{}) * size<2>(TileShapeMNK{})) +
+    cutlass::bits_to_bytes(a_bits * 2 * size<2>(TileShapeMNK{})) +
+    static_cast<int>(mainloop_pipeline_bytes);
+
+  return (CapacityBytes - carveout_bytes) / stage_bytes;
+}
+
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,7 +131,10 @@ struct CollectiveBuilder<
     KernelScheduleType,
     cute::enable_if_t<cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90> ||
                       cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Cooperative> ||
-                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Pingpong>>
+                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Pingpong> ||
+                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90SingleGroup> ||
+                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90MultipleGroup> ||
+                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Depthwise>>
 > {
   static_assert(is_static<TileShape_MNK>::value);
   static_assert(is_static<ClusterShape_MNK>::value);
@@ -118,7 +143,10 @@ struct CollectiveBuilder<
 #endif
   static_assert(cutlass::gemm::collective::detail::is_aligned<ElementA, AlignmentA, ElementB, AlignmentB, cutlass::gemm::collective::detail::tma_alignment_bytes>(),
                 "Should meet TMA alignment requirement\n");
-
+  // Tiles along N read different activation channels in grouped convolutions, so A cannot be multicast along N
+  static_assert(conv::detail::sm90_schedule_group_mode<KernelScheduleType>::value == conv::GroupMode::kNone ||
+                size<1>(ClusterShape_MNK{}) == 1,
+                "Grouped convolution schedules require a cluster shape of 1 along N\n");
   // For fp32 types, map to tf32 MMA value type
   using ElementAMma = cute::conditional_t<cute::is_same_v<ElementA, float>, tfloat32_t, ElementA>;
   using ElementBMma = cute::conditional_t<cute::is_same_v<ElementB, float>, tfloat32_t, ElementB>;
@@ -131,11 +159,17 @@ struct CollectiveBuilder<
   static constexpr cute::GMMA::Major GmmaMajorB =
     (ConvOp == conv::Operator::kFprop) ? cute::GMMA::Major::K : cute::GMMA::Major::MN;
 
+  // 8-bit GMMA only reads K-major operands from smem, so MN-major 8-bit operands are transposed in smem
+  static constexpr bool TransposeA = cute::sizeof_bits_v<ElementAMma> == 8 && GmmaMajorA == cute::GMMA::Major::MN;
+  static constexpr bool TransposeB = cute::sizeof_bits_v<ElementBMma> == 8 && GmmaMajorB == cute::GMMA::Major::MN;
+  static constexpr cute::GMMA::Major GmmaMmaMajorA = TransposeA ? cute::GMMA::Major::K : GmmaMajorA;
+  static constexpr cute::GMMA::Major GmmaMmaMajorB = TransposeB ? cute::GMMA::Major::K : GmmaMajorB;
+
   using AtomLayoutMNK = cute::conditional_t<cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Cooperative>,
       Layout<Shape<_2,_1,_1>>, Layout<Shape<_1,_1,_1>>>;
 
   using TiledMma = decltype(cute::make_tiled_mma(cute::GMMA::ss_op_selector<
-      ElementAMma, ElementBMma, ElementAccumulator, TileShape_MNK, GmmaMajorA, GmmaMajorB>(), AtomLayoutMNK{}));
+      ElementAMma, ElementBMma, ElementAccumulator, TileShape_MNK, GmmaMmaMajorA, GmmaMmaMajorB>(), AtomLayoutMNK{}));
 
   // For wgrad kernel, tensor A uses tma tiled mode and tensor B uses tma im2col mode.
   using GmemTiledCopyA = cute::conditional_t<ConvOp == conv::Operator::kWgrad,
@@ -145,10 +179,10 @@ struct CollectiveBuilder<
       decltype(cutlass::conv::collective::detail::sm90_cluster_shape_to_im2col_tma_atom(cute::shape<0>(ClusterShape_MNK{}))),
       decltype(cutlass::gemm::collective::detail::sm90_cluster_shape_to_tma_atom(cute::shape<0>(ClusterShape_MNK{})))>;
 
-  using SmemLayoutAtomA = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
-      GmmaMajorA, ElementAMma, decltype(cute::get<0>(TileShape_MNK{})), decltype(cute::get<2>(TileShape_MNK{}))>());
-  using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
-      GmmaMajorB, ElementBMma, decltype(cute::get<1>(TileShape_MNK{})), decltype(cute::get<2>(TileShape_MNK{}))>());
+  using SmemLayoutAtomA = decltype(cutlass::gemm::collective::detail::ss_smem_selector_transposed<
+      TransposeA, GmmaMajorA, ElementAMma, decltype(cute::get<0>(TileShape_MNK{})), decltype(cute::get<2>(TileShape_MNK{}))>());
+  using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::ss_smem_selector_transposed<
+      TransposeB, GmmaMajorB, ElementBMma, decltype(cute::get<1>(TileShape_MNK{})), decltype(cute::get<2>(TileShape_MNK{}))>());
 
   static constexpr int PipelineStages = detail::compute_stage_count_or_override<cutlass::gemm::collective::detail::sm90_smem_capacity_bytes,
       ElementAMma, ElementBMma, TileShape_MNK>(StageCountType{});
@@ -167,6 +201,186 @@ struct CollectiveBuilder<
   using DispatchPolicy = MainloopSm90TmaGmmaWarpSpecializedImplicitGemm<
       ConvOp, PipelineStages, NumSpatialDimensions, ClusterShape_MNK, KernelScheduleType>;
 
+  using CollectiveOp = CollectiveConv<
+      DispatchPolicy,
+      TileShape_MNK,
+      ElementA,
+      ElementB,
+      TiledMma,
+      detail::Sm90ImplicitGemmTileTraits<GmemTiledCopyA, SmemLayoutA, void, SmemLayoutAtomA>,
+      detail::Sm90ImplicitGemmTileTraits<GmemTiledCopyB, SmemLayoutB, void, SmemLayoutAtomB>
+    >;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// GMMA_TMA_WS_RS_FPROP with per-channel scale, bias and activation applied to A
+template <
+  conv::Operator ConvOp,
+  class ElementA,
+  class GmemLayoutA,
+  int AlignmentA,
+  class ElementB,
+  class GmemLayoutB,
+  int AlignmentB,
+  class ElementAccumulator,
+  class TileShape_MNK,
+  class ClusterShape_MNK,
+  class StageCountType,
+  class KernelScheduleType
+>
+struct CollectiveBuilder<
+    arch::Sm90,
+    arch::OpClassTensorOp,
+    ConvOp,
+    ElementA,
+    GmemLayoutA,
+    AlignmentA,
+    ElementB,
+    GmemLayoutB,
+    AlignmentB,
+    ElementAccumulator,
+    TileShape_MNK,
+    ClusterShape_MNK,
+    StageCountType,
+    KernelScheduleType,
+    cute::enable_if_t<conv::detail::is_sm90_scale_bias_act_schedule<KernelScheduleType>::value>
+> {
+  static_assert(is_static<TileShape_MNK>::value);
+  static_assert(is_static<ClusterShape_MNK>::value);
+#ifndef CUTLASS_SM90_COLLECTIVE_BUILDER_SUPPORTED
+  static_assert(cutlass::detail::dependent_false<ElementA>, "Unsupported Toolkit for SM90 Collective Builder\n");
+#endif
+  static_assert(ConvOp == conv::Operator::kFprop,
+                "Scale, bias and activation fusion is only supported for fprop\n");
+  static_assert(cutlass::gemm::collective::detail::is_aligned<ElementA, AlignmentA, ElementB, AlignmentB, cutlass::gemm::collective::detail::tma_alignment_bytes>(),
+                "Should meet TMA alignment requirement\n");
+
+  // For fprop, majorA = K, major B = K
+  static constexpr cute::GMMA::Major GmmaMajorA = cute::GMMA::Major::K;
+  static constexpr cute::GMMA::Major GmmaMajorB = cute::GMMA::Major::K;
+
+  using TiledMma = decltype(cute::make_tiled_mma(cute::GMMA::rs_op_selector<
+      ElementA, ElementB, ElementAccumulator, TileShape_MNK, GmmaMajorA, GmmaMajorB>(), Layout<Shape<_1,_1,_1>>{}));
+
+  using GmemTiledCopyA = decltype(cutlass::conv::collective::detail::sm90_cluster_shape_to_im2col_tma_atom(cute::shape<1>(ClusterShape_MNK{})));
+  using GmemTiledCopyB = decltype(cutlass::gemm::collective::detail::sm90_cluster_shape_to_tma_atom(cute::shape<0>(ClusterShape_MNK{})));
+
+  using SmemLayoutAtomA = decltype(cutlass::gemm::collective::detail::rs_smem_selector<
+      GmmaMajorA, ElementA, decltype(cute::get<0>(TileShape_MNK{})), decltype(cute::get<2>(TileShape_MNK{}))>());
+  using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GmmaMajorB, ElementB, decltype(cute::get<1>(TileShape_MNK{})), decltype(cute::get<2>(TileShape_MNK{}))>());
+  using SmemCopyAtomA = Copy_Atom<cute::AutoVectorizingCopy, ElementA>;
+
+  static constexpr int PipelineStages = detail::compute_scale_bias_stage_count_or_override<cutlass::gemm::collective::detail::sm90_smem_capacity_bytes,
+      ElementA, ElementB, TileShape_MNK>(StageCountType{});
+
+  using SmemLayoutA = decltype(tile_to_shape(
+      SmemLayoutAtomA{},
+      make_shape(shape<0>(TileShape_MNK{}), shape<2>(TileShape_MNK{}), Int<PipelineStages>{}),
+      Step<_2,_1,_3>{}));
+  using SmemLayoutB = decltype(tile_to_shape(
+      SmemLayoutAtomB{},
+      make_shape(shape<1>(TileShape_MNK{}), shape<2>(TileShape_MNK{}), Int<PipelineStages>{}),
+      Step<_2,_1,_3>{}));
+
+  constexpr static int NumSpatialDimensions = cutlass::conv::collective::detail::gmem_layout_tags_to_spatial_dims<GmemLayoutA, GmemLayoutB>();
+
+  using DispatchPolicy = MainloopSm90TmaGmmaRmemAWarpSpecializedImplicitGemmScaleBiasAct<
+      PipelineStages, NumSpatialDimensions, ClusterShape_MNK, KernelScheduleType>;
+
+  using CollectiveOp = CollectiveConv<
+      DispatchPolicy,
+      TileShape_MNK,
+      ElementA,
+      ElementB,
+      TiledMma,
+      detail::Sm90ImplicitGemmTileTraits<GmemTiledCopyA, SmemLayoutA, SmemCopyAtomA>,
+      detail::Sm90ImplicitGemmTileTraits<GmemTiledCopyB, SmemLayoutB>
+    >;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// GMMA_TMA_WS_SS_FPROP for activations with a small, fixed channel count
+template <
+  conv::Operator ConvOp,
+  class ElementA,
+  class GmemLayoutA,
+  int AlignmentA,
+  class ElementB,
+  class GmemLayoutB,
+  int AlignmentB,
+  class ElementAccumulator,
+  class TileShape_MNK,
+  class ClusterShape_MNK,
+  class StageCountType,
+  class KernelScheduleType
+>
+struct CollectiveBuilder<
+    arch::Sm90,
+    arch::OpClassTensorOp,
+    ConvOp,
+    ElementA,
+    GmemLayoutA,
+    AlignmentA,
+    ElementB,
+    GmemLayoutB,
+    AlignmentB,
+    ElementAccumulator,
+    TileShape_MNK,
+    ClusterShape_MNK,
+    StageCountType,
+    KernelScheduleType,
+    cute::enable_if_t<conv::detail::is_sm90_fixed_channels_schedule<KernelScheduleType>::value>
+> {
+  static_assert(is_static<TileShape_MNK>::value);
+  static_assert(is_static<ClusterShape_MNK>::value);
+#ifndef CUTLASS_SM90_COLLECTIVE_BUILDER_SUPPORTED
+  static_assert(cutlass::detail::dependent_false<ElementA>, "Unsupported Toolkit for SM90 Collective Builder\n");
+#endif
+  static_assert(ConvOp == conv::Operator::kFprop,
+                "Fixed channel kernels are only supported for fprop\n");
+  static_assert(cutlass::gemm::collective::detail::is_aligned<ElementA, AlignmentA, ElementB, AlignmentB, cutlass::gemm::collective::detail::tma_alignment_bytes>(),
+                "Should meet TMA alignment requirement\n");
+
+  // For fp32 types, map to tf32 MMA value type
+  using ElementAMma = cute::conditional_t<cute::is_same_v<ElementA, float>, tfloat32_t, ElementA>;
+  using ElementBMma = cute::conditional_t<cute::is_same_v<ElementB, float>, tfloat32_t, ElementB>;
+
+  static constexpr int Channels = KernelScheduleType::Channels;
+  static_assert(Channels * cute::sizeof_bits_v<ElementAMma> == 128,
+                "Fixed channels must span exactly 16B, e.g. 8 for 16-bit activations\n");
+
+  // For fprop, majorA = K, major B = K
+  using TiledMma = decltype(cute::make_tiled_mma(cute::GMMA::ss_op_selector<
+      ElementAMma, ElementBMma, ElementAccumulator, TileShape_MNK, cute::GMMA::Major::K, cute::GMMA::Major::K>()));
+
+  using GmemTiledCopyA = decltype(cutlass::conv::collective::detail::sm90_cluster_shape_to_im2col_tma_atom(cute::shape<1>(ClusterShape_MNK{})));
+  using GmemTiledCopyB = decltype(cutlass::gemm::collective::detail::sm90_cluster_shape_to_tma_atom(cute::shape<0>(ClusterShape_MNK{})));
+
+  // A is unswizzled so that each filter position is a contiguous 16B wide column written by one TMA box
+  using SmemLayoutAtomA = cute::GMMA::Layout_K_INTER_Atom<ElementAMma>;
+  using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      cute::GMMA::Major::K, ElementBMma, decltype(cute::get<1>(TileShape_MNK{})), decltype(cute::get<2>(TileShape_MNK{}))>());
+
+  static constexpr int PipelineStages = detail::compute_stage_count_or_override<cutlass::gemm::collective::detail::sm90_smem_capacity_bytes,
+      ElementAMma, ElementBMma, TileShape_MNK>(StageCountType{});
+
+  using SmemLayoutA = decltype(tile_to_shape(
+      SmemLayoutAtomA{},
+      make_shape(shape<0>(TileShape_MNK{}), shape<2>(TileShape_MNK{}), Int<PipelineStages>{}),
+      Step<_1,_2,_3>{}));
+  using SmemLayoutB = decltype(tile_to_shape(
+      SmemLayoutAtomB{},
+      make_shape(shape<1>(TileShape_MNK{}), shape<2>(TileShape_MNK{}), Int<PipelineStages>{}),
+      Step<_2,_1,_3>{}));
+
+  constexpr static int NumSpatialDimensions = cutlass::conv::collective::detail::gmem_layout_tags_to_spatial_dims<GmemLayoutA, GmemLayoutB>();
+
+  using DispatchPolicy = MainloopSm90TmaGmmaWarpSpecializedImplicitGemmFixedChannels<
+      PipelineStages, NumSpatialDimensions, ClusterShape_MNK, KernelScheduleType>;
+
   using CollectiveOp = CollectiveConv<
       DispatchPolicy,
       TileShape_MNK,
@@ -59,4 +59,6 @@ struct CollectiveConv {
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "sm90_implicit_gemm_gmma_ss_warpspecialized.hpp"
+#include "sm90_implicit_gemm_gmma_rs_warpspecialized_scale_bias_act.hpp"
+#include "sm90_implicit_gemm_gmma_ss_warpspecialized_fixed_channels.hpp"
 /////////////////////////////////////////////////////////////////////////////////////////////////
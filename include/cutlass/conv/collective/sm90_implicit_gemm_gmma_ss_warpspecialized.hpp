@@ -46,6 +46,7 @@
 #include "cutlass/conv/dispatch_policy.hpp"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/util/packed_stride.hpp"
+#include "cutlass/transform/collective/sm90_wgmma_transpose.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -91,6 +92,8 @@ struct CollectiveConv<
   using GmemTiledCopyB = typename TileTraitsB_::GmemTiledCopy;
   using SmemLayoutA = typename TileTraitsA_::SmemLayout;
   using SmemLayoutB = typename TileTraitsB_::SmemLayout;
+  using SmemLayoutAtomA = typename TileTraitsA_::SmemLayoutAtom;
+  using SmemLayoutAtomB = typename TileTraitsB_::SmemLayoutAtom;
   using ArchTag = typename DispatchPolicy::ArchTag;
   static constexpr int NumSpatialDimensions = DispatchPolicy::NumSpatialDimensions;
   static constexpr int NumTensorDimensions = NumSpatialDimensions + 2;
@@ -103,6 +106,9 @@ struct CollectiveConv<
 
   using PipelineParams = typename MainloopPipeline::Params;
   using PipelineState  = typename cutlass::PipelineState<DispatchPolicy::Stages>;
+
+  // One thread per CTA is the producer (1 for operand tile)
+  static constexpr int NumProducerThreadEvents = 1;
   
   using ProblemShape = ConvProblemShape<ConvOp, NumSpatialDimensions>;
 
@@ -115,6 +121,12 @@ struct CollectiveConv<
   static_assert((size<1>(TileShape{}) == size<0>(SmemLayoutB{})), "SmemLayout must be compatible with the tile shape.");
   static_assert((size<2>(TileShape{}) == size<1>(SmemLayoutB{})), "SmemLayout must be compatible with the tile shape.");
 
+  // MN-major 8-bit tiles are loaded as is and transposed in smem, since 8-bit GMMA is K-major only
+  using TransposeA = cutlass::transform::collective::GmmaSmemTranspose<
+      TiledMma, typename TiledMma::ValTypeA, SmemLayoutAtomA, SmemLayoutA>;
+  using TransposeB = cutlass::transform::collective::GmmaSmemTranspose<
+      TiledMma, typename TiledMma::ValTypeB, SmemLayoutAtomB, SmemLayoutB>;
+
   static_assert(DispatchPolicy::Stages >= 2, "Specialization requires Stages set to value 1 or more.");
   static_assert(cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeA>::value &&
                 cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeB>::value,
@@ -136,6 +148,16 @@ struct CollectiveConv<
   static constexpr bool is_im2col_A = detail::is_im2col_load<GmemTiledCopyA>::value;
   static constexpr bool is_im2col_B = detail::is_im2col_load<GmemTiledCopyB>::value;
 
+  // Grouped fprop: each output channel tile reads a window of group_channels activation channels,
+  // starting at the first channel of the tile's group. Multiple-group and depthwise tiles span
+  // several groups and consume the block diagonal filter from cutlass::expand_grouped_conv_filter().
+  static constexpr conv::GroupMode GroupMode = DispatchPolicy::GroupMode;
+  static constexpr bool IsGrouped = GroupMode != conv::GroupMode::kNone;
+  static constexpr bool IsMultipleGroup = GroupMode == conv::GroupMode::kMultipleGroup ||
+                                          GroupMode == conv::GroupMode::kDepthwise;
+  static_assert(not IsGrouped || size<1>(ClusterShape{}) == 1,
+      "Grouped convolutions cannot multicast A along N: each N tile reads different channels.");
+
   // TMA converts f32 input to tf32 when copying from GMEM to SMEM
   // For all other types, cast to size equivalent uint type to avoid any rounding by TMA.
   static constexpr bool ConvertF32toTF32A = cute::is_same_v<float, ElementA>;
@@ -252,17 +274,39 @@ private:
 
 public:
 
+  // Number of groups covered by one output channel tile of a multiple-group or depthwise kernel
+  static constexpr int
+  get_groups_per_tile(ProblemShape const& problem_shape) {
+    int group_output_channels = problem_shape.groups > 0 ? problem_shape.shape_B[0] / problem_shape.groups : 0;
+    return group_output_channels > 0 ? cute::max(1, int(size<1>(TileShape{})) / group_output_channels) : 1;
+  }
+
+  // Problem shape seen by the mainloop. For multiple-group and depthwise kernels, operand B is the
+  // block diagonal filter whose channel mode holds the channels of all groups of an N tile.
+  static constexpr ProblemShape
+  get_mainloop_problem_shape(ProblemShape const& problem_shape) {
+    if constexpr (IsMultipleGroup) {
+      ProblemShape mainloop_problem_shape = problem_shape;
+      mainloop_problem_shape.shape_B[NumTensorDimensions-1] *= get_groups_per_tile(problem_shape);
+      mainloop_problem_shape.stride_B = ProblemShape::packed_stride_right_major(mainloop_problem_shape.shape_B);
+      return mainloop_problem_shape;
+    }
+    else {
+      return problem_shape;
+    }
+  }
+
   // Performs im2col transformations on the input of type ConvProblemShape
   static constexpr auto
   get_problem_shape_MNKL(ProblemShape const& problem_shape) {
 
     if constexpr (is_im2col_A || is_im2col_B) {
       // transformation + im2col linearization
-      return cutlass::conv::detail::get_linearized_problem_shape_MNKL(problem_shape);
+      return cutlass::conv::detail::get_linearized_problem_shape_MNKL(get_mainloop_problem_shape(problem_shape));
     }
     else {
       // transformation
-      return cutlass::conv::detail::get_transformed_problem_shape_MNKL(problem_shape);
+      return cutlass::conv::detail::get_transformed_problem_shape_MNKL(get_mainloop_problem_shape(problem_shape));
     }
   }
 
@@ -296,6 +340,9 @@ public:
     TMA_A tma_load_a;
     TMA_B tma_load_b;
     uint32_t tma_transaction_bytes = TmaTransactionBytes;
+    // Grouped convolutions only: activation channels read per N tile, and output channels sharing them
+    int32_t group_channels = 0;
+    int32_t group_output_channels = 0;
   };
 
   //
@@ -308,15 +355,16 @@ public:
     (void) workspace;
     // from the flat problem shape arrays of ConvProblemShape<ConvOp, N>, create a rank-3 MNK problem shape tuple
     // tma desc creation depends on the original untransformed domain.
+    auto mainloop_problem_shape = get_mainloop_problem_shape(problem_shape);
 
     // A extents.
-    auto shape_A_orig = problem_shape.get_shape_A();
+    auto shape_A_orig = mainloop_problem_shape.get_shape_A();
     // B extents.
-    auto shape_B_orig = problem_shape.get_shape_B();
+    auto shape_B_orig = mainloop_problem_shape.get_shape_B();
 
     // Fill inferred cute strides from flat stride arrays
-    auto dA = make_cute_packed_stride(StrideA{}, problem_shape.stride_A, ConvOp);
-    auto dB = make_cute_packed_stride(StrideB{}, problem_shape.stride_B, ConvOp);
+    auto dA = make_cute_packed_stride(StrideA{}, mainloop_problem_shape.stride_A, ConvOp);
+    auto dB = make_cute_packed_stride(StrideB{}, mainloop_problem_shape.stride_B, ConvOp);
 
     auto ptr_A = reinterpret_cast<InternalElementA const*>(args.ptr_A);
     auto ptr_B = reinterpret_cast<InternalElementB const*>(args.ptr_B);
@@ -324,13 +372,23 @@ public:
     Tensor tensor_a = make_tensor(make_gmem_ptr(ptr_A), make_layout(shape_A_orig, dA));
     Tensor tensor_b = make_tensor(make_gmem_ptr(ptr_B), make_layout(shape_B_orig, dB));
 
-    auto tma_load_a = get_tma_load_a_instance(tensor_a, problem_shape);
-    auto tma_load_b = get_tma_load_b_instance(tensor_b, problem_shape);
+    auto tma_load_a = get_tma_load_a_instance(tensor_a, mainloop_problem_shape);
+    auto tma_load_b = get_tma_load_b_instance(tensor_b, mainloop_problem_shape);
+
+    int32_t group_channels = 0;
+    int32_t group_output_channels = 0;
+    if constexpr (IsGrouped) {
+      int groups_per_tile = IsMultipleGroup ? get_groups_per_tile(problem_shape) : 1;
+      group_channels = mainloop_problem_shape.shape_B[NumTensorDimensions-1];
+      group_output_channels = groups_per_tile * (problem_shape.shape_B[0] / problem_shape.groups);
+    }
 
     return {
       tma_load_a,
       tma_load_b,
-      TmaTransactionBytes
+      TmaTransactionBytes,
+      group_channels,
+      group_output_channels
     };
   }
   
@@ -349,7 +407,7 @@ public:
     // A extents.
     auto shape_A_orig = problem_shape.get_shape_A();
     // B extents.
-    auto shape_B_orig = problem_shape.get_shape_B();
+    auto shape_B_orig = get_mainloop_problem_shape(problem_shape).get_shape_B();
     constexpr int min_tma_aligned_elements_A = tma_alignment_bits / cutlass::sizeof_bits<ElementA>::value;
     implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_A>(shape_A_orig, StrideA{});
     constexpr int min_tma_aligned_elements_B = tma_alignment_bits / cutlass::sizeof_bits<ElementB>::value;
@@ -478,7 +536,41 @@ public:
       return false;
     }
 
-    if (problem_shape.groups > 1) {
+    if constexpr (IsGrouped) {
+      int const groups = problem_shape.groups;
+      int const channels = problem_shape.shape_A[NumTensorDimensions-1];
+      int const group_channels = problem_shape.shape_B[NumTensorDimensions-1];
+      int const output_channels = problem_shape.shape_B[0];
+      constexpr int TileN = size<1>(TileShape{});
+      constexpr int TileK = size<2>(TileShape{});
+
+      implementable &= groups >= 1 && channels == groups * group_channels && output_channels % groups == 0;
+      if (!implementable) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Channel extents are not divisible into conv groups.\n");
+        return false;
+      }
+
+      int const group_output_channels = output_channels / groups;
+      if constexpr (IsMultipleGroup) {
+        // An N tile holds whole groups and its channel window must not straddle a K tile
+        implementable &= TileN % group_output_channels == 0;
+        implementable &= ((TileN / group_output_channels) * group_channels) % TileK == 0;
+      }
+      else {
+        // An N tile lies within one group and K tiles never cross into the next group's channels
+        implementable &= group_output_channels % TileN == 0;
+        implementable &= group_channels % TileK == 0;
+      }
+      if constexpr (GroupMode == conv::GroupMode::kDepthwise) {
+        implementable &= group_channels == 1;
+      }
+
+      if (!implementable) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Conv group extents are not supported by this group mode and tile shape.\n");
+        return false;
+      }
+    }
+    else if (problem_shape.groups > 1) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: This kernel does not support conv groups > 1.\n");
       return false;
     }
@@ -499,6 +591,7 @@ public:
   /// gA_mk - The tma tensor, A after a local tile so it has shape  (BLK_M,BLK_K,m,k)
   /// gB_nk - The tma tensor, B after a local tile so it has shape  (BLK_N,BLK_K,n,k)
   /// The rest of the tensors can be specified as needed by this collective.
+  /// Grouped kernels also return mA_mk, the untiled channel window of A, so load() can offset it per N tile.
   /// The dimensions of gA_mk and gA_nk do not contain L to maintain consistency with 
   /// StrideA and StrideB set up for TMA 
   template <class ProblemShapeMNKL>
@@ -511,20 +604,36 @@ public:
 
     // TMA requires special handling of strides to deal with coord codomain mapping
     // Represent the full tensors -- get these from TMA
-    Tensor mA_mk = mainloop_params.tma_load_a.get_tma_tensor(make_shape(M,K));                            // (m,k)
+    auto shape_MK = make_shape(M,K);
+    Tensor mA_mk = [&]() {
+      if constexpr (IsGrouped) {
+        // The im2col TMA tensor spans every activation channel; restrict its channel mode to one group window
+        Tensor mA_all = mainloop_params.tma_load_a.get_tma_tensor(shape_MK);
+        return make_tensor(mA_all.data(), composition(
+            mA_all.layout().layout_a(), mA_all.layout().offset(), make_identity_layout(shape_MK)));      // (m,k)
+      }
+      else {
+        return mainloop_params.tma_load_a.get_tma_tensor(shape_MK);                                       // (m,k)
+      }
+    }();
     Tensor mB_nk = mainloop_params.tma_load_b.get_tma_tensor(make_shape(N,K));                            // (n,k)
 
     // Make tiled views, defer the slice
     Tensor gA_mk = local_tile(mA_mk, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{});        // (BLK_M,BLK_K,m,k)
     Tensor gB_nk = local_tile(mB_nk, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{});        // (BLK_N,BLK_K,n,k)
 
-    return cute::make_tuple(gA_mk, gB_nk);
+    if constexpr (IsGrouped) {
+      return cute::make_tuple(gA_mk, gB_nk, mA_mk);
+    }
+    else {
+      return cute::make_tuple(gA_mk, gB_nk);
+    }
   }
 
   /// Perform a collective-scoped matrix multiply-accumulate
   /// Producer Perspective
   template <
-    class TensorA, class TensorB,
+    class TensorA, class TensorB, class... TensorsRest,
     class KTileIterator, class BlockCoord
   >
   CUTLASS_DEVICE void
@@ -532,7 +641,7 @@ public:
       Params const& mainloop_params,
       MainloopPipeline pipeline,
       PipelineState smem_pipe_producer_state,
-      cute::tuple<TensorA, TensorB> const& load_inputs,
+      cute::tuple<TensorA, TensorB, TensorsRest...> const& load_inputs,
       BlockCoord const& blk_coord,
       KTileIterator k_tile_iter, int k_tile_count,
       int thread_idx,
@@ -553,12 +662,27 @@ public:
       auto block_tma_a = mainloop_params.tma_load_a.get_slice(cluster_local_block_id.y);
       auto block_tma_b = mainloop_params.tma_load_b.get_slice(cluster_local_block_id.x);
 
-      auto [gA_mk, gB_nk] = load_inputs;
+      Tensor gA_mk = get<0>(load_inputs);
+      Tensor gB_nk = get<1>(load_inputs);
 
       // Partition the inputs based on the current block coordinates.
-      auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
-
-      Tensor gA = gA_mk(_,_,m_coord,_);                                                     // (BLK_M,BLK_K,k)
+      auto m_coord = get<0>(blk_coord);
+      auto n_coord = get<1>(blk_coord);
+
+      Tensor gA = [&]() {
+        if constexpr (IsGrouped) {
+          // Offset the channel window of A to the first channel of this N tile's group(s)
+          using X = Underscore;
+          int32_t channel_offset = (int32_t(n_coord) * int32_t(size<1>(TileShape{})) / mainloop_params.group_output_channels)
+                                 * mainloop_params.group_channels;
+          auto k_offset = cute::append<NumSpatialDimensions + 1>(make_coord(channel_offset), _0{});
+          Tensor mA_mk = domain_offset(make_coord(_0{}, k_offset), get<2>(load_inputs));                   // (m,k)
+          return local_tile(mA_mk, TileShape{}, make_coord(m_coord,_,_), Step<_1, X,_1>{});        // (BLK_M,BLK_K,k)
+        }
+        else {
+          return gA_mk(_,_,m_coord,_);                                                      // (BLK_M,BLK_K,k)
+        }
+      }();
       Tensor gB = gB_nk(_,_,n_coord,_);                                                     // (BLK_N,BLK_K,k)
 
       // Applies the mapping from block_tma_a
@@ -644,8 +768,13 @@ public:
       Params const& mainloop_params) {
     static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
 
-    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
-    Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+    // GMMA reads the K-major view of transposed operands
+    Tensor sA = TransposeA::make_gmma_tensor(shared_tensors.smem_A.data());                     // (BLK_M,BLK_K,PIPE)
+    Tensor sB = TransposeB::make_gmma_tensor(shared_tensors.smem_B.data());                     // (BLK_N,BLK_K,PIPE)
+
+    int warp_idx = canonical_warp_idx_sync();
+    TransposeA transpose_a(warp_idx, thread_idx % NumThreadsPerWarpGroup);
+    TransposeB transpose_b(warp_idx, thread_idx % NumThreadsPerWarpGroup);
 
     //
     // Define C accumulators and A/B partitioning
@@ -689,6 +818,8 @@ public:
       pipeline.consumer_wait(smem_pipe_consumer_state);
 
       int read_stage = smem_pipe_consumer_state.index();
+      transpose_a.transpose(shared_tensors.smem_A.data(), read_stage);
+      transpose_b.transpose(shared_tensors.smem_B.data(), read_stage);
       warpgroup_arrive();
       // Unroll the K mode manually to set scale D to 1
       CUTLASS_PRAGMA_UNROLL
@@ -717,6 +848,8 @@ public:
       //
 
       int read_stage = smem_pipe_consumer_state.index();
+      transpose_a.transpose(shared_tensors.smem_A.data(), read_stage);
+      transpose_b.transpose(shared_tensors.smem_B.data(), read_stage);
       warpgroup_fence_operand(accum);
       warpgroup_arrive();
       // Unroll the K mode manually to set scale D to 1
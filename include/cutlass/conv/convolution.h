@@ -104,7 +104,8 @@ enum class IteratorAlgorithm {
   kOptimized,     ///< optimized for R <= 32, S <= 32 and unity-stride dgrad
   kFixedChannels, ///< Analytic algorithm optimized for fixed channel count (C == AccessSize)
   kFewChannels,   ///< Analytic algorithm optimized for few channels (C divisible by AccessSize)
-  kFixedStrideDilation ///< Optimized for fixed stride and dilation
+  kFixedStrideDilation, ///< Optimized for fixed stride and dilation
+  kWinograd       ///< Winograd F(4x4, 3x3) minimal filtering for 3x3 unit-stride fprop
 };
 
 /// Distinguishes among partial specializations that accelerate certain problems where convolution
@@ -119,7 +120,8 @@ enum class StrideSupport {
 enum class SplitKMode {
   kNone,
   kSerial,
-  kParallel
+  kParallel,
+  kStreamK      ///< MAC-iterations of all output tiles split evenly across one wave of threadblocks
 };
 
 /// Identifies group mode
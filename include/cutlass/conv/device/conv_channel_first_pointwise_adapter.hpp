@@ -0,0 +1,256 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Runs pointwise fprop on channel-first (NCW, NCHW, NCDHW) activations and outputs with a
+   CUTLASS 3.x GEMM kernel, without transposing the tensors to channel-last layouts.
+
+   The SM90 implicit GEMM mainloop gathers activations with im2col TMA, which requires the channel
+   mode to be the innermost one. A pointwise convolution (1x1 filter, unit traversal stride, no
+   padding) on channel-first tensors is a batched GEMM over the images instead:
+
+     Y[n](K, DHW) = W(K, C) * X[n](C, DHW)
+
+   which maps onto a GEMM with
+     A: (M = DHW, K = C, L = N), M-major  (activations, cutlass::layout::ColumnMajor)
+     B: (N = K,   K = C, L = N), K-major  (filter, shared by all images)
+     D: (M = DHW, N = K, L = N), M-major  (output, cutlass::layout::ColumnMajor)
+
+   Both operands and the output are loaded and stored with tiled TMA in their native layouts, so the
+   epilogue writes NCHW directly.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/trace.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/convnd_problem_shape.hpp"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/util/packed_stride.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::conv::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  ConvChannelFirstPointwiseAdapter is a stateful, reusable handle that lowers a channel-first
+  pointwise fprop problem to a batched cutlass::gemm::kernel::GemmUniversal kernel.
+
+  The GEMM kernel must be built with cutlass::layout::ColumnMajor for A, B, C and D, i.e. M-major
+  activations and outputs and a K-major filter. The filter is broadcast across the batch mode.
+  Activations are [N,C,(D,)(H,)W], the filter is [K,C] and the output is [N,K,(D,)(H,)W], all packed.
+*/
+template <class GemmKernel_, int NumSpatialDimensions_>
+class ConvChannelFirstPointwiseAdapter
+{
+public:
+  using GemmKernel = GetUnderlyingKernel_t<GemmKernel_>;
+  using GemmAdapter = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  using GemmArguments = typename GemmKernel::Arguments;
+
+  static constexpr conv::Operator kConvolutionalOperator = conv::Operator::kFprop;
+  static constexpr int NumSpatialDimensions = NumSpatialDimensions_;
+  using ProblemShape = ConvProblemShape<kConvolutionalOperator, NumSpatialDimensions>;
+
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using ElementC = typename GemmKernel::ElementC;
+  using ElementD = typename GemmKernel::ElementD;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+  using EpilogueThreadArguments = decltype(typename GemmKernel::EpilogueArguments{}.thread);
+
+  static_assert(cute::rank(typename GemmKernel::ProblemShape{}) == 4,
+    "Channel-first pointwise fprop requires a GEMM kernel with a batch mode.");
+  static_assert(cutlass::detail::is_major<0, StrideA>() && cutlass::detail::is_major<1, StrideB>(),
+    "Channel-first activations are M-major and the [K,C] filter is K-major.");
+  static_assert(cutlass::detail::is_major<0, StrideD>(),
+    "Channel-first outputs are M-major.");
+
+  /// Argument structure: User API
+  struct Arguments {
+    // Extents are in the usual [n,d,h,w,c] / [k,t,r,s,c] order; the strides of the problem shape are ignored.
+    ProblemShape problem_shape{};
+    ElementA const* ptr_A = nullptr;
+    ElementB const* ptr_B = nullptr;
+    EpilogueThreadArguments thread{};
+    ElementC const* ptr_C = nullptr;
+    ElementD* ptr_D = nullptr;
+    KernelHardwareInfo hw_info{};
+  };
+
+private:
+
+  /// Underlying GEMM operator
+  GemmAdapter gemm_op_;
+
+public:
+
+  /// Lowers the channel-first conv arguments to batched GEMM arguments
+  static GemmArguments
+  to_gemm_arguments(Arguments const& args) {
+    constexpr int RankT = ProblemShape::RankT;
+    auto const& problem_shape = args.problem_shape;
+
+    int spatial = 1;
+    for (int i = 1; i < RankT - 1; ++i) {
+      spatial *= problem_shape.shape_A[i];
+    }
+    int batch = problem_shape.shape_A[0];
+    int channels = problem_shape.shape_A[RankT - 1];
+    int output_channels = problem_shape.shape_B[0];
+
+    auto dA = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(spatial, channels, batch));
+    auto dB = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(output_channels, channels, 1));
+    auto dC = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(spatial, output_channels, batch));
+    auto dD = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(spatial, output_channels, batch));
+
+    GemmArguments gemm_args{};
+    gemm_args.mode = cutlass::gemm::GemmUniversalMode::kGemm;
+    gemm_args.problem_shape = {spatial, output_channels, channels, batch};
+    gemm_args.mainloop.ptr_A = args.ptr_A;
+    gemm_args.mainloop.dA = dA;
+    gemm_args.mainloop.ptr_B = args.ptr_B;
+    gemm_args.mainloop.dB = dB;
+    gemm_args.epilogue.thread = args.thread;
+    gemm_args.epilogue.ptr_C = args.ptr_C;
+    gemm_args.epilogue.dC = dC;
+    gemm_args.epilogue.ptr_D = args.ptr_D;
+    gemm_args.epilogue.dD = dD;
+    gemm_args.hw_info = args.hw_info;
+    return gemm_args;
+  }
+
+  /// Determines whether the adapter can execute the given problem.
+  static Status
+  can_implement(Arguments const& args) {
+    auto const& problem_shape = args.problem_shape;
+
+    bool implementable = problem_shape.mode == cutlass::conv::Mode::kCrossCorrelation;
+    implementable &= problem_shape.groups == 1;
+    implementable &= problem_shape.shape_A[ProblemShape::RankT - 1] == problem_shape.shape_B[ProblemShape::RankT - 1];
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      // filter [k,t,r,s,c] spatial extents start at the second position
+      implementable &= problem_shape.shape_B[i + 1] == 1;
+      implementable &= problem_shape.traversal_stride[i] == 1;
+      implementable &= problem_shape.lower_padding[i] == 0;
+      implementable &= problem_shape.upper_padding[i] == 0;
+    }
+
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Channel-first fprop requires a dense 1x1 filter, unit stride and no padding.\n");
+      return Status::kInvalid;
+    }
+
+    return GemmAdapter::can_implement(to_gemm_arguments(args));
+  }
+
+  /// Gets the workspace size
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return GemmAdapter::get_workspace_size(to_gemm_arguments(args));
+  }
+
+  /// Computes the grid shape
+  static dim3
+  get_grid_shape(Arguments const& args, void* workspace = nullptr) {
+    return GemmAdapter::get_grid_shape(to_gemm_arguments(args), workspace);
+  }
+
+  /// Initializes the underlying GEMM from conv arguments.
+  Status
+  initialize(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+
+    CUTLASS_TRACE_HOST("ConvChannelFirstPointwiseAdapter::initialize()");
+    return gemm_op_.initialize(to_gemm_arguments(args), workspace, stream, cuda_adapter);
+  }
+
+  /// Update API is preserved in 3.0, but does not guarantee a lightweight update of params.
+  Status
+  update(Arguments const& args, void* workspace = nullptr) {
+    return gemm_op_.update(to_gemm_arguments(args), workspace);
+  }
+
+  /// Launches the kernel after first constructing Params internal state from supplied arguments.
+  Status
+  run(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+
+    Status status = initialize(args, workspace, stream, cuda_adapter);
+    if (Status::kSuccess == status) {
+      status = run(stream, cuda_adapter);
+    }
+    return status;
+  }
+
+  /// Launches the kernel after first constructing Params internal state from supplied arguments.
+  Status
+  operator()(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+    return run(args, workspace, stream, cuda_adapter);
+  }
+
+  /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
+  Status
+  run(cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
+    return gemm_op_.run(stream, cuda_adapter);
+  }
+
+  /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
+  Status
+  operator()(cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
+    return run(stream, cuda_adapter);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::conv::device
+
+////////////////////////////////////////////////////////////////////////////////
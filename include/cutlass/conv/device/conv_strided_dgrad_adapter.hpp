@@ -0,0 +1,381 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Runs strided dgrad with a CUTLASS 3.x unit-stride implicit GEMM dgrad kernel by stride-phase
+   decomposition, so no MMA work is spent on the zeros a transposed convolution inserts into dy.
+
+   For traversal stride s (per spatial dimension), unit dilation and lower padding pad, the dx
+   positions h = h' * s + a of one phase a in [0, s) only receive contributions from the filter taps
+   r = r0 + j * s with r0 = (a + pad) % s, and
+
+     dx[h' * s + a] = sum_j dy[h' + (a + pad) / s - j] * w[r0 + j * s]
+
+   which is a unit-stride dgrad over a strided view of dx, a strided view of the filter and the
+   unchanged dy. Each of the prod(s) phases runs as one launch of the dgrad kernel on the same stream.
+   Phases whose filter view is empty still run with a zero filter kept in the workspace, so that
+   their dx positions receive the epilogue (e.g. beta * C) like every other position.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/trace.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/convnd_problem_shape.hpp"
+#include "cutlass/conv/device/conv_universal_adapter.hpp"
+#include "cutlass/cuda_host_adapter.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::conv::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  ConvStridedDgradAdapter is a stateful, reusable handle that runs a strided dgrad problem as one
+  unit-stride sub-problem per stride phase on a cutlass::conv::kernel::ConvUniversal dgrad kernel.
+
+  Arguments are those of the dgrad kernel for the full problem. The adapter remaps the problem shape,
+  the filter pointer and the C and D pointers and strides of every phase. Epilogue fusions that read
+  or write other tensors indexed by output position are not remapped. Dilation must be 1.
+*/
+template <class ConvKernel_>
+class ConvStridedDgradAdapter
+{
+public:
+  using ConvKernel = GetUnderlyingKernel_t<ConvKernel_>;
+  using ConvAdapter = ConvUniversalAdapter<ConvKernel>;
+  using Arguments = typename ConvKernel::Arguments;
+  using Params = typename ConvKernel::Params;
+  using ProblemShape = typename ConvKernel::ProblemShape;
+  using ElementB = typename ConvKernel::ElementB;
+  using ElementC = typename ConvKernel::ElementC;
+  using ElementD = typename ConvKernel::ElementD;
+
+  static constexpr conv::Operator kConvolutionalOperator = ConvAdapter::kConvolutionalOperator;
+  static constexpr int NumSpatialDimensions = ConvAdapter::NumSpatialDimensions;
+
+  static_assert(kConvolutionalOperator == conv::Operator::kDgrad,
+    "Stride-phase decomposition only applies to dgrad kernels.");
+
+  /// Decomposition of one stride phase, in the [d,h,w] order of the problem shape arrays
+  struct PhaseShape {
+    cute::array<int, NumSpatialDimensions> offset{};     // first dx position of the phase
+    cute::array<int, NumSpatialDimensions> extent{};     // dx positions of the phase
+    cute::array<int, NumSpatialDimensions> first_tap{};  // first filter tap of the phase
+    cute::array<int, NumSpatialDimensions> taps{};       // filter taps of the phase
+    cute::array<int, NumSpatialDimensions> padding{};    // lower padding of the unit-stride sub-problem
+
+    bool has_outputs() const {
+      bool result = true;
+      for (int i = 0; i < NumSpatialDimensions; ++i) {
+        result &= extent[i] > 0;
+      }
+      return result;
+    }
+
+    bool has_taps() const {
+      bool result = true;
+      for (int i = 0; i < NumSpatialDimensions; ++i) {
+        result &= taps[i] > 0;
+      }
+      return result;
+    }
+  };
+
+private:
+
+  /// Kernel params of each phase that has outputs, in launch order
+  std::vector<Params> params_;
+
+  /// Bytes of workspace holding the zero filter of phases without taps
+  static size_t
+  get_zero_filter_size(ProblemShape const& problem_shape) {
+    size_t elements = size_t(problem_shape.shape_B[0]) * problem_shape.shape_B[ProblemShape::RankT - 1];
+    return round_nearest(cutlass::bits_to_bytes(elements * cute::sizeof_bits_v<ElementB>), size_t(128));
+  }
+
+public:
+
+  /// Number of stride phases of the problem, including those without outputs
+  static int
+  get_num_phases(ProblemShape const& problem_shape) {
+    int num_phases = 1;
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      num_phases *= problem_shape.traversal_stride[i];
+    }
+    return num_phases;
+  }
+
+  /// Decomposes phase index `phase` (w fastest) of the problem
+  static PhaseShape
+  get_phase_shape(ProblemShape const& problem_shape, int phase) {
+    PhaseShape phase_shape{};
+    for (int i = NumSpatialDimensions - 1; i >= 0; --i) {
+      int stride = problem_shape.traversal_stride[i];
+      int offset = phase % stride;
+      phase /= stride;
+
+      // shape_C is dx [n,d,h,w,c] and shape_B is the filter [k,t,r,s,c]
+      int extent = problem_shape.shape_C[i + 1];
+      int filter_extent = problem_shape.shape_B[i + 1];
+      int pad = problem_shape.lower_padding[i];
+
+      phase_shape.offset[i] = offset;
+      phase_shape.extent[i] = extent > offset ? ceil_div(extent - offset, stride) : 0;
+      phase_shape.first_tap[i] = (offset + pad) % stride;
+      phase_shape.taps[i] = phase_shape.first_tap[i] < filter_extent ?
+        ceil_div(filter_extent - phase_shape.first_tap[i], stride) : 0;
+      phase_shape.padding[i] = (offset + pad) / stride;
+    }
+    return phase_shape;
+  }
+
+  /// Lowers the strided dgrad arguments to the unit-stride arguments of one phase.
+  /// zero_filter is used as the filter of phases without taps.
+  static Arguments
+  to_phase_arguments(Arguments const& args, int phase, ElementB const* zero_filter = nullptr) {
+    constexpr int RankT = ProblemShape::RankT;
+    using TensorExtent = typename ProblemShape::TensorExtent;
+    using TensorStride = typename ProblemShape::TensorStride;
+    using SpatialExtent = typename ProblemShape::SpatialExtent;
+
+    auto const& problem_shape = args.problem_shape;
+    PhaseShape phase_shape = get_phase_shape(problem_shape, phase);
+    bool has_taps = phase_shape.has_taps();
+
+    TensorExtent shape_dx = problem_shape.shape_C;
+    TensorStride stride_dx = problem_shape.stride_C;
+    TensorExtent shape_flt = problem_shape.shape_B;
+    TensorStride stride_flt = problem_shape.stride_B;
+    SpatialExtent lower_padding{};
+    SpatialExtent upper_padding{};
+    SpatialExtent unit{};
+    ElementB const* ptr_B = args.mainloop.ptr_B;
+
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      int stride = problem_shape.traversal_stride[i];
+      unit[i] = 1;
+      shape_dx[i + 1] = phase_shape.extent[i];
+      stride_dx[i + 1] *= stride;
+      if (has_taps) {
+        shape_flt[i + 1] = phase_shape.taps[i];
+        stride_flt[i + 1] *= stride;
+        lower_padding[i] = phase_shape.padding[i];
+        ptr_B += phase_shape.first_tap[i] * problem_shape.stride_B[i + 1];
+      }
+      else {
+        shape_flt[i + 1] = 1;
+      }
+      // dy keeps its extents below, so this only has to keep the sub-problem well-formed. Trailing dx
+      // positions no filter window reaches would need negative padding and read dy out of bounds instead.
+      upper_padding[i] = cute::max(0,
+        problem_shape.shape_A[i + 1] - phase_shape.extent[i] - lower_padding[i] + shape_flt[i + 1] - 1);
+    }
+    if (not has_taps) {
+      stride_flt = ProblemShape::packed_stride_right_major(shape_flt);
+      ptr_B = zero_filter;
+    }
+
+    ProblemShape phase_problem_shape(
+      problem_shape.mode,
+      shape_dx, stride_dx,
+      shape_flt, stride_flt,
+      lower_padding, upper_padding,
+      unit, unit,
+      problem_shape.groups);
+    // dy is read in place, with out of bounds positions zero-filled by TMA
+    phase_problem_shape.shape_A = problem_shape.shape_A;
+    phase_problem_shape.stride_A = problem_shape.stride_A;
+
+    Arguments phase_args = args;
+    phase_args.problem_shape = phase_problem_shape;
+    phase_args.mainloop.ptr_B = ptr_B;
+
+    // C and D are ((w,h,d,n),c) strided views of dx
+    auto& epilogue = phase_args.epilogue;
+    int64_t offset_C = 0;
+    int64_t offset_D = 0;
+    cute::for_each(cute::make_seq<NumSpatialDimensions>{}, [&](auto j) {
+      int i = NumSpatialDimensions - 1 - int(j);
+      int stride = problem_shape.traversal_stride[i];
+      offset_C += phase_shape.offset[i] * static_cast<int64_t>(cute::get<0,j>(epilogue.dC));
+      offset_D += phase_shape.offset[i] * static_cast<int64_t>(cute::get<0,j>(epilogue.dD));
+      cute::get<0,j>(epilogue.dC) *= stride;
+      cute::get<0,j>(epilogue.dD) *= stride;
+    });
+    if constexpr (not cute::is_void_v<ElementC>) {
+      if (epilogue.ptr_C != nullptr) {
+        epilogue.ptr_C += offset_C;
+      }
+    }
+    if constexpr (not cute::is_void_v<ElementD>) {
+      if (epilogue.ptr_D != nullptr) {
+        epilogue.ptr_D += offset_D;
+      }
+    }
+
+    return phase_args;
+  }
+
+  /// Determines whether the adapter can execute the given problem.
+  static Status
+  can_implement(Arguments const& args) {
+    auto const& problem_shape = args.problem_shape;
+
+    bool implementable = true;
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      implementable &= problem_shape.traversal_stride[i] >= 1;
+      implementable &= problem_shape.dilation[i] == 1;
+    }
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Stride-phase dgrad requires positive strides and unit dilation.\n");
+      return Status::kInvalid;
+    }
+
+    for (int phase = 0; phase < get_num_phases(problem_shape); ++phase) {
+      if (not get_phase_shape(problem_shape, phase).has_outputs()) {
+        continue;
+      }
+      Status status = ConvAdapter::can_implement(to_phase_arguments(args, phase));
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    return Status::kSuccess;
+  }
+
+  /// Gets the workspace size: the zero filter followed by the kernel workspace of every phase
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    size_t workspace_bytes = get_zero_filter_size(args.problem_shape);
+    for (int phase = 0; phase < get_num_phases(args.problem_shape); ++phase) {
+      if (get_phase_shape(args.problem_shape, phase).has_outputs()) {
+        workspace_bytes += round_nearest(ConvAdapter::get_workspace_size(to_phase_arguments(args, phase)), size_t(128));
+      }
+    }
+    return workspace_bytes;
+  }
+
+  /// Initializes the kernel params of every phase from arguments.
+  Status
+  initialize(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+
+    CUTLASS_TRACE_HOST("ConvStridedDgradAdapter::initialize() - workspace "
+      << workspace << ", stream: " << (stream ? "non-null" : "null"));
+
+    if (workspace == nullptr) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    size_t zero_filter_bytes = get_zero_filter_size(args.problem_shape);
+    cudaError_t result = cudaMemsetAsync(workspace, 0, zero_filter_bytes, stream);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaMemsetAsync() returned error: " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+
+    auto zero_filter = static_cast<ElementB const*>(workspace);
+    uint8_t* phase_workspace = static_cast<uint8_t*>(workspace) + zero_filter_bytes;
+
+    params_.clear();
+    for (int phase = 0; phase < get_num_phases(args.problem_shape); ++phase) {
+      if (not get_phase_shape(args.problem_shape, phase).has_outputs()) {
+        continue;
+      }
+      Arguments phase_args = to_phase_arguments(args, phase, zero_filter);
+      ConvAdapter op;
+      Status status = op.initialize(phase_args, phase_workspace, stream, cuda_adapter);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+      params_.push_back(op.params());
+      phase_workspace += round_nearest(ConvAdapter::get_workspace_size(phase_args), size_t(128));
+    }
+    return Status::kSuccess;
+  }
+
+  /// Launches the phases after first constructing their params from supplied arguments.
+  Status
+  run(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+
+    Status status = initialize(args, workspace, stream, cuda_adapter);
+    if (Status::kSuccess == status) {
+      status = run(stream, cuda_adapter);
+    }
+    return status;
+  }
+
+  /// Launches the phases after first constructing their params from supplied arguments.
+  Status
+  operator()(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+    return run(args, workspace, stream, cuda_adapter);
+  }
+
+  /// Overload that allows a user to re-launch the phases without updating their params.
+  Status
+  run(cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
+    for (Params& params : params_) {
+      Status status = ConvAdapter::run(params, stream, cuda_adapter);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    return Status::kSuccess;
+  }
+
+  /// Overload that allows a user to re-launch the phases without updating their params.
+  Status
+  operator()(cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
+    return run(stream, cuda_adapter);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::conv::device
+
+////////////////////////////////////////////////////////////////////////////////
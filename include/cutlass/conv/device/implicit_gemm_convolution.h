@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 
 #include "cutlass/cutlass.h"
@@ -49,6 +50,20 @@ namespace device {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+// Whether an implicit GEMM kernel implements SplitKMode::kStreamK
+template <typename Kernel, typename Enable = void>
+struct SupportsStreamK : platform::false_type {};
+
+template <typename Kernel>
+struct SupportsStreamK<Kernel, platform::void_t<decltype(&Kernel::get_stream_k_workspace_size)>>
+  : platform::true_type {};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename ImplicitGemmKernel_>
 class ImplicitGemmConvolution {
 public:
@@ -83,6 +98,9 @@ public:
 
   static bool const kEnableCudaHostAdapter = CUTLASS_ENABLE_CUDA_HOST_ADAPTER;
 
+  static bool const kSupportsStreamK =
+    detail::SupportsStreamK<UnderlyingKernel>::value && kGroupMode == conv::GroupMode::kNone;
+
   static int const kWarpCount = 
     (ThreadblockShape::kM / WarpShape::kM) * 
     (ThreadblockShape::kN / WarpShape::kN) *
@@ -96,6 +114,9 @@ private:
   /// Kernel parameters object
   typename UnderlyingKernel::Params params_;
 
+  /// Threadblocks launched under SplitKMode::kStreamK
+  int stream_k_blocks_ = 0;
+
 public:
 
   /// Constructs Implicit GEMM
@@ -148,6 +169,13 @@ public:
       }
     }
 
+    // stream-K splits the k-dimension itself
+    if (args.split_k_mode == SplitKMode::kStreamK) {
+      if (!kSupportsStreamK || args.problem_size.split_k_slices != 1) {
+        return Status::kErrorNotSupported;
+      }
+    }
+
     static int const kAlignmentC = UnderlyingKernel::Epilogue::OutputTileIterator::kElementsPerAccess;
     if (kConvolutionalOperator == conv::Operator::kFprop) {
       if (args.problem_size.K % kAlignmentC)
@@ -217,6 +245,15 @@ public:
         size_t(grid_tiled_shape.k());
     }
 
+    else if(args.split_k_mode == SplitKMode::kStreamK) {
+
+      // Stream-K: threadblocks splitting an output tile share partial accumulators through
+      // the workspace, guarded by one flag per threadblock
+      if constexpr (kSupportsStreamK) {
+        workspace_bytes = UnderlyingKernel::get_stream_k_workspace_size(get_stream_k_block_count(args));
+      }
+    }
+
     else if(args.split_k_mode == SplitKMode::kSerial && args.problem_size.split_k_slices > 1) {
 
       // Split-K serial: The user workspace is used to store semaphore and serialize writing the 
@@ -227,6 +264,68 @@ public:
     return workspace_bytes;
   }
 
+  /// Gets the number of threadblocks launched under SplitKMode::kStreamK: one full wave, or
+  /// one per MAC-iteration if the problem has fewer.
+  static int get_stream_k_block_count(Arguments const &args) {
+
+    int device_idx = 0;
+    cudaError_t result = cudaGetDevice(&device_idx);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaGetDevice() returned error " << cudaGetErrorString(result));
+      return 0;
+    }
+
+    int sm_count = 0;
+    result = cudaDeviceGetAttribute(&sm_count, cudaDevAttrMultiProcessorCount, device_idx);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaDeviceGetAttribute() returned error " << cudaGetErrorString(result));
+      return 0;
+    }
+
+    int smem_size = int(sizeof(typename UnderlyingKernel::SharedStorage));
+    if (smem_size >= (48 << 10)) {
+      result = cudaFuncSetAttribute(cutlass::Kernel<UnderlyingKernel>,
+                                    cudaFuncAttributeMaxDynamicSharedMemorySize,
+                                    smem_size);
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error " << cudaGetErrorString(result));
+        return 0;
+      }
+    }
+
+    int sm_occupancy = 0;
+    result = cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &sm_occupancy,
+      cutlass::Kernel<UnderlyingKernel>,
+      32 * kWarpCount,
+      smem_size);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaOccupancyMaxActiveBlocksPerMultiprocessor() returned error "
+        << cudaGetErrorString(result));
+      return 0;
+    }
+
+    ThreadblockSwizzle threadblock_swizzle;
+
+    cutlass::gemm::GemmCoord grid_tiled_shape = threadblock_swizzle.get_tiled_shape(
+        kConvolutionalOperator,
+        args.problem_size,
+        {ThreadblockShape::kM, ThreadblockShape::kN, ThreadblockShape::kK},
+        1);
+
+    int gemm_k_iterations = implicit_gemm_k_iterations(
+      kConvolutionalOperator,
+      ThreadblockShape::kK,
+      args.problem_size,
+      kIteratorAlgorithm,
+      kGroupMode,
+      ThreadblockShape::kN);
+
+    int64_t total_iters = int64_t(grid_tiled_shape.m()) * grid_tiled_shape.n() * gemm_k_iterations;
+
+    return int(std::max<int64_t>(1, std::min<int64_t>(int64_t(sm_count) * sm_occupancy, total_iters)));
+  }
+
   /// Initializes GEMM state from arguments.
   Status initialize(
     Arguments const &args, 
@@ -247,6 +346,38 @@ public:
       }
     }
 
+    if (args.split_k_mode == SplitKMode::kStreamK) {
+
+      if constexpr (kSupportsStreamK) {
+        if (args.problem_size.split_k_slices != 1) {
+          return Status::kErrorNotSupported;
+        }
+
+        stream_k_blocks_ = get_stream_k_block_count(args);
+        if (!stream_k_blocks_) {
+          return Status::kErrorInternal;
+        }
+
+        if (!workspace) {
+          return Status::kErrorWorkspaceNull;
+        }
+
+        // Only the flags need clearing. The threadblock finishing a tile resets its flag.
+        cudaError_t status = cudaMemsetAsync(
+          workspace,
+          0,
+          UnderlyingKernel::get_stream_k_barrier_workspace_size(stream_k_blocks_),
+          stream);
+
+        if (status != cudaSuccess) {
+          return Status::kErrorInternal;
+        }
+      }
+      else {
+        return Status::kErrorNotSupported;
+      }
+    }
+
     // initialize the params structure from the arguments
     params_ = typename UnderlyingKernel::Params(
     	args,
@@ -295,6 +426,9 @@ public:
     ThreadblockSwizzle threadblock_swizzle;
 
     dim3 grid = threadblock_swizzle.get_grid_shape(params_.grid_tiled_shape);
+    if (params_.split_k_mode == SplitKMode::kStreamK) {
+      grid = dim3(stream_k_blocks_, 1, 1);
+    }
     dim3 block(32 * kWarpCount, 1, 1);
 
     int smem_size = int(sizeof(typename UnderlyingKernel::SharedStorage));
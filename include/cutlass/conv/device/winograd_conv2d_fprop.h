@@ -0,0 +1,300 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device-level Winograd F(4x4, 3x3) forward convolution.
+
+    Launches the input transform, filter transform, batched Winograd-domain GEMM and the output
+    transform fused with the epilogue. The interface matches device::ImplicitGemmConvolution so the
+    operator can be registered with the CUTLASS library and profiler.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/kernel/winograd_conv2d_fprop.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace conv {
+namespace device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename WinogradKernel_>
+class WinogradConv2dFprop {
+public:
+
+  using UnderlyingKernel = WinogradKernel_;
+
+  using ElementA = typename UnderlyingKernel::ElementA;
+  using LayoutA = typename UnderlyingKernel::LayoutA;
+  using ElementB = typename UnderlyingKernel::ElementB;
+  using LayoutB = typename UnderlyingKernel::LayoutB;
+  using ElementC = typename UnderlyingKernel::ElementC;
+  using LayoutC = typename UnderlyingKernel::LayoutC;
+  using ElementAccumulator = typename UnderlyingKernel::ElementAccumulator;
+  using ElementCompute = typename UnderlyingKernel::ElementCompute;
+  using OperatorClass = typename UnderlyingKernel::OperatorClass;
+  using ArchTag = typename UnderlyingKernel::ArchTag;
+  using ThreadblockShape = typename UnderlyingKernel::ThreadblockShape;
+  using WarpShape = typename UnderlyingKernel::WarpShape;
+  using InstructionShape = typename UnderlyingKernel::InstructionShape;
+  using EpilogueOutputOp = typename UnderlyingKernel::EpilogueOutputOp;
+  using MathOperator = typename UnderlyingKernel::MathOperator;
+  static int const kStages = UnderlyingKernel::kStages;
+  static int const kConvDim = UnderlyingKernel::kConvDim;
+
+  static cutlass::conv::Operator const kConvolutionalOperator = UnderlyingKernel::kConvolutionalOperator;
+  static cutlass::conv::IteratorAlgorithm const kIteratorAlgorithm = UnderlyingKernel::kIteratorAlgorithm;
+  static cutlass::conv::StrideSupport const kStrideSupport = UnderlyingKernel::kStrideSupport;
+  static cutlass::conv::GroupMode const kGroupMode = UnderlyingKernel::kGroupMode;
+
+  using Transform = typename UnderlyingKernel::Transform;
+  using ElementV = typename UnderlyingKernel::ElementV;
+  using ElementU = typename UnderlyingKernel::ElementU;
+  using ElementM = typename UnderlyingKernel::ElementM;
+  using Gemm = typename UnderlyingKernel::Gemm;
+
+  /// Argument structure
+  using Arguments = typename UnderlyingKernel::Arguments;
+
+  /// Threads per CTA of the transform kernels
+  static int const kTransformThreadCount = 128;
+
+private:
+
+  /// Workspace partitions are aligned to this many bytes
+  static size_t const kWorkspaceAlignment = 128;
+
+  Arguments args_;
+  ElementV *ptr_V_;
+  ElementU *ptr_U_;
+  ElementM *ptr_M_;
+  Gemm gemm_op_;
+
+public:
+
+  /// Constructs the Winograd convolution
+  WinogradConv2dFprop(): ptr_V_(nullptr), ptr_U_(nullptr), ptr_M_(nullptr) { }
+
+  /// Determines whether the Winograd convolution can execute the given problem.
+  static Status can_implement(Arguments const &args) {
+
+    Conv2dProblemSize const &problem_size = args.problem_size;
+
+    if (problem_size.R != Transform::kFilterSize || problem_size.S != Transform::kFilterSize) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (problem_size.stride_h != 1 || problem_size.stride_w != 1 ||
+        problem_size.dilation_h != 1 || problem_size.dilation_w != 1) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (problem_size.groups != 1 || problem_size.split_k_slices != 1) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (problem_size.P != problem_size.H + 2 * problem_size.pad_h - Transform::kFilterSize + 1 ||
+        problem_size.Q != problem_size.W + 2 * problem_size.pad_w - Transform::kFilterSize + 1) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    // Winograd-domain GEMM operands are packed with leading dimensions C and K
+    if (problem_size.C % UnderlyingKernel::kAlignmentA ||
+        problem_size.C % UnderlyingKernel::kAlignmentB ||
+        problem_size.K % Gemm::kAlignmentC ||
+        problem_size.K % EpilogueOutputOp::kCount) {
+      return Status::kErrorMisalignedOperand;
+    }
+
+    return Status::kSuccess;
+  }
+
+  /// Gets the workspace size
+  static size_t get_workspace_size(Arguments const &args) {
+    return size_V(args.problem_size) + size_U(args.problem_size) + size_M(args.problem_size);
+  }
+
+  /// Initializes Winograd state from arguments.
+  Status initialize(
+    Arguments const &args,
+    void *workspace = nullptr,
+    cudaStream_t stream = nullptr) {
+
+    if (!workspace) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    args_ = args;
+    partition_workspace(workspace);
+
+    return gemm_op_.initialize(gemm_arguments(), nullptr, stream);
+  }
+
+  /// Lightweight update given a subset of arguments
+  Status update(Arguments const &args, void *workspace = nullptr) {
+
+    if (!workspace) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    args_.ref_A = args.ref_A;
+    args_.ref_B = args.ref_B;
+    args_.ref_C = args.ref_C;
+    args_.ref_D = args.ref_D;
+    args_.output_op = args.output_op;
+    partition_workspace(workspace);
+
+    return gemm_op_.update(gemm_arguments(), nullptr);
+  }
+
+  /// Runs the kernels using initialized state.
+  Status run(cudaStream_t stream = nullptr) {
+
+    Conv2dProblemSize const &problem_size = args_.problem_size;
+    int64_t tile_count = kernel::winograd_f4x3_tile_count(problem_size);
+
+    dim3 block(kTransformThreadCount, 1, 1);
+
+    kernel::winograd_f4x3_input_transform<ElementA, ElementV>
+      <<<grid_size(tile_count * problem_size.C), block, 0, stream>>>(
+        problem_size, args_.ref_A.data(), ptr_V_);
+
+    kernel::winograd_f4x3_filter_transform<ElementB, ElementU>
+      <<<grid_size(int64_t(problem_size.K) * problem_size.C), block, 0, stream>>>(
+        problem_size, args_.ref_B.data(), ptr_U_);
+
+    cudaError_t result = cudaGetLastError();
+    if (result != cudaSuccess) {
+      return Status::kErrorInternal;
+    }
+
+    Status status = gemm_op_.run(stream);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    kernel::winograd_f4x3_output_transform<EpilogueOutputOp, ElementM, ElementC>
+      <<<grid_size(tile_count * (problem_size.K / EpilogueOutputOp::kCount)), block, 0, stream>>>(
+        problem_size, ptr_M_, args_.ref_C.data(), args_.ref_D.data(), args_.output_op);
+
+    result = cudaGetLastError();
+
+    return result == cudaSuccess ? Status::kSuccess : Status::kErrorInternal;
+  }
+
+  /// Runs the kernels using initialized state.
+  Status operator()(cudaStream_t stream = nullptr) {
+    return run(stream);
+  }
+
+  /// Initializes and runs the kernels.
+  Status operator()(
+    Arguments const &args,
+    void *workspace = nullptr,
+    cudaStream_t stream = nullptr) {
+
+    Status status = initialize(args, workspace, stream);
+
+    if (status == Status::kSuccess) {
+      status = run(stream);
+    }
+
+    return status;
+  }
+
+private:
+
+  static size_t aligned_size(size_t bytes) {
+    return (bytes + kWorkspaceAlignment - 1) / kWorkspaceAlignment * kWorkspaceAlignment;
+  }
+
+  static size_t size_V(Conv2dProblemSize const &problem_size) {
+    return aligned_size(sizeof(ElementV) * Transform::kPositions *
+      size_t(kernel::winograd_f4x3_tile_count(problem_size)) * problem_size.C);
+  }
+
+  static size_t size_U(Conv2dProblemSize const &problem_size) {
+    return aligned_size(sizeof(ElementU) * Transform::kPositions *
+      size_t(problem_size.K) * problem_size.C);
+  }
+
+  static size_t size_M(Conv2dProblemSize const &problem_size) {
+    return aligned_size(sizeof(ElementM) * Transform::kPositions *
+      size_t(kernel::winograd_f4x3_tile_count(problem_size)) * problem_size.K);
+  }
+
+  static dim3 grid_size(int64_t thread_count) {
+    return dim3(unsigned((thread_count + kTransformThreadCount - 1) / kTransformThreadCount), 1, 1);
+  }
+
+  void partition_workspace(void *workspace) {
+    uint8_t *ptr = static_cast<uint8_t *>(workspace);
+    ptr_V_ = reinterpret_cast<ElementV *>(ptr);
+    ptr += size_V(args_.problem_size);
+    ptr_U_ = reinterpret_cast<ElementU *>(ptr);
+    ptr += size_U(args_.problem_size);
+    ptr_M_ = reinterpret_cast<ElementM *>(ptr);
+  }
+
+  /// Batched GEMM over the 36 Winograd positions: M[xi] (T x K) = V[xi] (T x C) * U[xi] (C x K)
+  typename Gemm::Arguments gemm_arguments() const {
+
+    Conv2dProblemSize const &problem_size = args_.problem_size;
+    int64_t tile_count = kernel::winograd_f4x3_tile_count(problem_size);
+
+    return typename Gemm::Arguments(
+      {int(tile_count), problem_size.K, problem_size.C},
+      {ptr_V_, problem_size.C},
+      tile_count * problem_size.C,
+      {ptr_U_, problem_size.C},
+      int64_t(problem_size.K) * problem_size.C,
+      {ptr_M_, problem_size.K},
+      tile_count * problem_size.K,
+      {ptr_M_, problem_size.K},
+      tile_count * problem_size.K,
+      {ElementAccumulator(1), ElementAccumulator(0)},
+      Transform::kPositions
+    );
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace device
+} // namespace conv
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 #include "cute/layout.hpp"
 #include "cute/numeric/integral_constant.hpp"
 
+#include "cutlass/conv/convolution.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -51,9 +52,74 @@ namespace cutlass::conv {
 // Policies for categorical dispatch of mainloop against kernel grid schedules
 //
 struct KernelImplicitTmaWarpSpecializedSm90 : cutlass::gemm::KernelTmaWarpSpecialized { };
-struct KernelImplicitTmaWarpSpecializedSm90Cooperative { };
+// Persistent cooperative schedule, required for the stream-K and split-K tile schedulers
+struct KernelImplicitTmaWarpSpecializedSm90Cooperative : cutlass::gemm::KernelTmaWarpSpecializedCooperative { };
 struct KernelImplicitTmaWarpSpecializedSm90Pingpong { };
 
+// Grouped fprop. Each output channel tile reads the activation channels of its own group(s)
+// through the same im2col TMA descriptor, offset by the group's first channel.
+//   kSingleGroup:   a tile covers (part of) one group, requires (K / groups) % TileN == 0
+//   kMultipleGroup: a tile covers TileN / (K / groups) whole groups, operand B is the block
+//                   diagonal filter produced by cutlass::expand_grouped_conv_filter()
+//   kDepthwise:     kMultipleGroup with one input channel per group (C == groups)
+template <conv::GroupMode GroupMode_>
+struct KernelImplicitTmaWarpSpecializedSm90Grouped : KernelImplicitTmaWarpSpecializedSm90 {
+  static constexpr conv::GroupMode GroupMode = GroupMode_;
+  static_assert(GroupMode != conv::GroupMode::kNone, "Use KernelImplicitTmaWarpSpecializedSm90 for dense convolutions.");
+};
+
+using KernelImplicitTmaWarpSpecializedSm90SingleGroup =
+    KernelImplicitTmaWarpSpecializedSm90Grouped<conv::GroupMode::kSingleGroup>;
+using KernelImplicitTmaWarpSpecializedSm90MultipleGroup =
+    KernelImplicitTmaWarpSpecializedSm90Grouped<conv::GroupMode::kMultipleGroup>;
+using KernelImplicitTmaWarpSpecializedSm90Depthwise =
+    KernelImplicitTmaWarpSpecializedSm90Grouped<conv::GroupMode::kDepthwise>;
+
+// Fprop that applies a per-channel scale, bias and activation to the activation operand (A) after
+// its TMA load and before the MMA, i.e. fuses the BN-apply + ReLU of the previous layer:
+//   A'[..., c] = ActivationFn(A[..., c] * scale[c] + bias[c])
+// Elements in the convolution padding stay zero.
+template <class ActivationFn_ = cutlass::epilogue::thread::ReLu<float>>
+struct KernelImplicitTmaWarpSpecializedSm90ScaleBiasAct : KernelImplicitTmaWarpSpecializedSm90 {
+  using ActivationFn = ActivationFn_;
+};
+
+// Fprop for activations with few channels (e.g. the RGB input of a network's first layer). Each k-tile
+// packs TileK / Channels filter positions of Channels channels each into the K dimension instead of
+// zero filling a TileK wide channel tile. Channels must span exactly 16B so every filter position is
+// one im2col TMA box, e.g. 8 for 16-bit, 4 for tf32 and 16 for 8-bit activations.
+template <int Channels_>
+struct KernelImplicitTmaWarpSpecializedSm90FixedChannels : KernelImplicitTmaWarpSpecializedSm90 {
+  static constexpr int Channels = Channels_;
+};
+
+namespace detail {
+
+// Group mode of a conv kernel schedule, kNone for dense schedules
+template <class KernelSchedule, class = void>
+struct sm90_schedule_group_mode {
+  static constexpr conv::GroupMode value = conv::GroupMode::kNone;
+};
+
+template <class KernelSchedule>
+struct sm90_schedule_group_mode<KernelSchedule, cute::void_t<decltype(KernelSchedule::GroupMode)>> {
+  static constexpr conv::GroupMode value = KernelSchedule::GroupMode;
+};
+
+template <class KernelSchedule>
+struct is_sm90_scale_bias_act_schedule : cute::false_type {};
+
+template <class ActivationFn>
+struct is_sm90_scale_bias_act_schedule<KernelImplicitTmaWarpSpecializedSm90ScaleBiasAct<ActivationFn>> : cute::true_type {};
+
+template <class KernelSchedule>
+struct is_sm90_fixed_channels_schedule : cute::false_type {};
+
+template <int Channels>
+struct is_sm90_fixed_channels_schedule<KernelImplicitTmaWarpSpecializedSm90FixedChannels<Channels>> : cute::true_type {};
+
+} // namespace detail
+
 //
 // Collective Mainloop Policies
 //
@@ -76,11 +142,64 @@ struct MainloopSm90TmaGmmaWarpSpecializedImplicitGemm {
   using ClusterShape = ClusterShape_;
   using ArchTag = arch::Sm90;
   using Schedule = KernelSchedule;
+  static constexpr conv::GroupMode GroupMode = detail::sm90_schedule_group_mode<KernelSchedule>::value;
+
+  static_assert(NumSpatialDimensions >= 1);
+  static_assert(GroupMode == conv::GroupMode::kNone || ConvOp == conv::Operator::kFprop,
+    "Grouped SM90 implicit GEMM schedules only support fprop.");
+  static_assert(! cute::is_same_v<KernelSchedule,KernelImplicitTmaWarpSpecializedSm90Pingpong>,
+    "Pingpong schedule not supported for conv yet.");
+};
+
+// n-buffer in smem (Hopper TMA), A operand copied to registers (GMMA RS) where the per-channel
+// scale, bias and activation of KernelImplicitTmaWarpSpecializedSm90ScaleBiasAct are applied.
+// The scale and bias of the k-tile's channels are bulk copied alongside A into each stage.
+// fprop only
+template<
+  int Stages_,
+  int NumSpatialDimensions_,
+  class ClusterShape_ = cute::Shape<cute::C<1>,cute::C<1>,cute::C<1>>,
+  class KernelSchedule = KernelImplicitTmaWarpSpecializedSm90ScaleBiasAct<>
+>
+struct MainloopSm90TmaGmmaRmemAWarpSpecializedImplicitGemmScaleBiasAct {
+  static constexpr int Stages = Stages_;
+  static constexpr int NumSpatialDimensions = NumSpatialDimensions_;
+  static constexpr Operator ConvOp = conv::Operator::kFprop;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+  using ActivationFn = typename KernelSchedule::ActivationFn;
+  static constexpr conv::GroupMode GroupMode = conv::GroupMode::kNone;
+
+  static_assert(NumSpatialDimensions >= 1);
+  static_assert(detail::is_sm90_scale_bias_act_schedule<KernelSchedule>::value,
+    "KernelSchedule must be a KernelImplicitTmaWarpSpecializedSm90ScaleBiasAct.");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, static schedule between TMA and GMMA
+// Each stage of A holds TileK / Channels filter positions loaded by separate im2col TMA boxes.
+// fprop only
+template<
+  int Stages_,
+  int NumSpatialDimensions_,
+  class ClusterShape_ = cute::Shape<cute::C<1>,cute::C<1>,cute::C<1>>,
+  class KernelSchedule = KernelImplicitTmaWarpSpecializedSm90FixedChannels<8>,
+  int PipelineAsyncMmaStages_ = 1
+>
+struct MainloopSm90TmaGmmaWarpSpecializedImplicitGemmFixedChannels {
+  static constexpr int Stages = Stages_;
+  static constexpr int NumSpatialDimensions = NumSpatialDimensions_;
+  static constexpr Operator ConvOp = conv::Operator::kFprop;
+  static constexpr int PipelineAsyncMmaStages = PipelineAsyncMmaStages_;
+  static constexpr int Channels = KernelSchedule::Channels;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+  static constexpr conv::GroupMode GroupMode = conv::GroupMode::kNone;
 
   static_assert(NumSpatialDimensions >= 1);
-  static_assert(! (cute::is_same_v<KernelSchedule,KernelImplicitTmaWarpSpecializedSm90Cooperative> ||
-                   cute::is_same_v<KernelSchedule,KernelImplicitTmaWarpSpecializedSm90Pingpong>),
-    "Persistent schedules not support for conv yet.");
+  static_assert(detail::is_sm90_fixed_channels_schedule<KernelSchedule>::value,
+    "KernelSchedule must be a KernelImplicitTmaWarpSpecializedSm90FixedChannels.");
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,9 @@
 
 #include "cutlass/aligned_buffer.h"
 #include "cutlass/array.h"
+#include "cutlass/barrier.h"
+#include "cutlass/block_striped.h"
+#include "cutlass/fast_math.h"
 #include "cutlass/numeric_types.h"
 #include "cutlass/matrix_shape.h"
 #include "cutlass/semaphore.h"
@@ -105,6 +108,15 @@ struct ImplicitGemmConvolution {
   using WarpCount = typename Mma::WarpCount;
   static int const kThreadCount = 32 * WarpCount::kCount;
 
+  /// The per-thread tile of raw accumulators
+  using AccumulatorTile = typename Mma::FragmentC;
+
+  /// Bytes of partial accumulators each threadblock may share under SplitKMode::kStreamK
+  static size_t const kWorkspaceBytesPerBlock = kThreadCount * sizeof(AccumulatorTile);
+
+  /// Block-striped reduction utility
+  using BlockStripedReduceT = BlockStripedReduce<kThreadCount, AccumulatorTile>;
+
   using TensorRefA = typename Mma::IteratorA::TensorRef;
   using TensorRefB = typename Mma::IteratorB::TensorRef;
   using TensorRefC = cutlass::TensorRef<ElementC, LayoutC>;
@@ -276,10 +288,27 @@ struct ImplicitGemmConvolution {
   CUTLASS_HOST_DEVICE
   ImplicitGemmConvolution() { } 
 
+  /// Bytes of stream-K flags preceding the partial accumulators in the workspace
+  CUTLASS_HOST_DEVICE
+  static size_t get_stream_k_barrier_workspace_size(int block_count) {
+    return (sizeof(typename Barrier::T) * block_count + 127) / 128 * 128;
+  }
+
+  /// Bytes of workspace needed by SplitKMode::kStreamK for the given number of threadblocks
+  CUTLASS_HOST_DEVICE
+  static size_t get_stream_k_workspace_size(int block_count) {
+    return get_stream_k_barrier_workspace_size(block_count) + kWorkspaceBytesPerBlock * block_count;
+  }
+
   /// Executes one ImplicitGEMM
   CUTLASS_DEVICE
   void operator()(Params const &params, SharedStorage &shared_storage) {
 
+    if (kGroupMode == GroupMode::kNone && params.split_k_mode == SplitKMode::kStreamK) {
+      stream_k(params, shared_storage);
+      return;
+    }
+
     // Compute threadblock location
     ThreadblockSwizzle threadblock_swizzle;
 
@@ -444,6 +473,181 @@ struct ImplicitGemmConvolution {
       semaphore.release(lock);
     }
   } 
+
+protected:
+
+  /// Executes one ImplicitGEMM with stream-K: the MAC-iterations of all output tiles are split
+  /// evenly across the grid, and each threadblock visits the tiles its range overlaps from last
+  /// to first. Threadblocks that do not accumulate the last iteration of a tile share their
+  /// partial sums through the workspace with the one that does, which runs the epilogue.
+  CUTLASS_DEVICE
+  void stream_k(Params const &params, SharedStorage &shared_storage) {
+
+    int thread_idx = threadIdx.x;
+    int warp_idx = canonical_warp_idx_sync();
+    int lane_idx = threadIdx.x % 32;
+
+    int block_idx = blockIdx.x;
+    int block_count = gridDim.x;
+
+    int tiles_m = params.grid_tiled_shape.m();
+    int iters_per_tile = params.gemm_k_iterations;
+    int total_iters = tiles_m * params.grid_tiled_shape.n() * iters_per_tile;
+
+    // Every block is assigned block_iters iterations, and the first block_iters_remainder one more
+    int block_iters = total_iters / block_count;
+    int block_iters_remainder = total_iters % block_count;
+    int long_block_iters = block_iters_remainder * (block_iters + 1);
+
+    int block_iter_begin = block_idx * block_iters + fast_min(block_idx, block_iters_remainder);
+    int block_iter_end = block_iter_begin + block_iters + (block_idx < block_iters_remainder ? 1 : 0);
+
+    // Flags are followed by the partial accumulators, both indexed by the block starting a tile
+    void *barrier_workspace = params.semaphore;
+    AccumulatorTile *partials_workspace = reinterpret_cast<AccumulatorTile *>(
+      reinterpret_cast<uint8_t *>(params.semaphore) + get_stream_k_barrier_workspace_size(block_count));
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    while (block_iter_end > block_iter_begin) {
+
+      int tile_idx = (block_iter_end - 1) / iters_per_tile;
+      int tile_iter_begin = tile_idx * iters_per_tile;
+      int k_iter_begin = fast_max(block_iter_begin, tile_iter_begin) - tile_iter_begin;
+      int k_iter_end = block_iter_end - tile_iter_begin;
+
+      int first_block_idx = (tile_iter_begin < long_block_iters) ?
+        tile_iter_begin / (block_iters + 1) :
+        block_iters_remainder + (tile_iter_begin - long_block_iters) / block_iters;
+
+      // Tiles are rasterized along M
+      cutlass::gemm::GemmCoord threadblock_tile_idx(tile_idx % tiles_m, tile_idx / tiles_m, 0);
+
+      typename Mma::IteratorA iterator_A(
+        params.iterator_A,
+        params.problem_size,
+        params.ptr_A,
+        thread_idx,
+        MatrixCoord(
+          threadblock_tile_idx.m() * Mma::Shape::kM,
+          0
+        )
+      );
+
+      typename Mma::IteratorB iterator_B(
+        params.iterator_B,
+        params.problem_size,
+        params.ptr_B,
+        thread_idx,
+        MatrixCoord(
+          0,
+          threadblock_tile_idx.n() * Mma::Shape::kN
+        )
+      );
+
+      // Implicit GEMM iterators walk the filter positions and channels in sequence, so they are
+      // stepped to this block's first iteration of the tile
+      for (int k_iter = 0; k_iter < k_iter_begin; ++k_iter) {
+        iterator_A.advance();
+        iterator_B.advance();
+      }
+
+      Mma mma(shared_storage.main_loop, thread_idx, warp_idx, lane_idx);
+
+      AccumulatorTile accumulators;
+
+      accumulators.clear();
+
+      // Wait for all threads to finish their epilogue phases from the previous tile.
+      __syncthreads();
+
+      mma(k_iter_end - k_iter_begin, accumulators, iterator_A, iterator_B, accumulators, params.gemm_k_iterations_per_channel);
+
+      if (k_iter_end != iters_per_tile) {
+        share_accumulators(accumulators, barrier_workspace, partials_workspace, block_idx, first_block_idx, thread_idx);
+      }
+      else {
+        if (k_iter_begin != 0) {
+          acquire_accumulators(accumulators, barrier_workspace, partials_workspace, block_idx, first_block_idx, thread_idx);
+        }
+
+        EpilogueOutputOp output_op(params.output_op);
+
+        MatrixCoord threadblock_offset(
+          threadblock_tile_idx.m() * Mma::Shape::kM,
+          threadblock_tile_idx.n() * Mma::Shape::kN
+        );
+
+        // Tile iterator writing to destination tensor
+        typename Epilogue::OutputTileIterator iterator_D(
+          params.iterator_D,
+          params.ptr_D,
+          ConvOutputIteratorParameter::extent(params.problem_size),
+          thread_idx,
+          threadblock_offset
+        );
+
+        // Tile iterator reading from source accumulator tensor
+        typename Epilogue::OutputTileIterator iterator_C(
+          params.iterator_C,
+          params.ptr_C,
+          ConvOutputIteratorParameter::extent(params.problem_size),
+          thread_idx,
+          threadblock_offset
+        );
+
+        Epilogue epilogue(
+          shared_storage.epilogue,
+          thread_idx,
+          warp_idx,
+          lane_idx);
+
+        epilogue(output_op, iterator_D, accumulators, iterator_C);
+      }
+
+      block_iter_end = tile_iter_begin + k_iter_begin;
+    }
+  }
+
+  /// Shares the partial sums of a tile this block does not finish. Peers accumulate into the
+  /// workspace in block order so that the result does not depend on their timing.
+  CUTLASS_DEVICE
+  static void share_accumulators(
+    AccumulatorTile const &accumulator_tile,
+    void *barrier_workspace,
+    AccumulatorTile *partials_workspace,
+    int block_idx,
+    int first_block_idx,
+    int thread_idx) {
+
+    AccumulatorTile *accum_tile_workspace = partials_workspace + first_block_idx * kThreadCount;
+
+    if (block_idx == first_block_idx) {
+      BlockStripedReduceT::store(accum_tile_workspace, accumulator_tile, thread_idx);
+    }
+    else {
+      Barrier::wait_eq(barrier_workspace, thread_idx, first_block_idx, block_idx - first_block_idx);
+      BlockStripedReduceT::reduce(accum_tile_workspace, accumulator_tile, thread_idx);
+    }
+
+    Barrier::arrive_inc(barrier_workspace, thread_idx, first_block_idx);
+  }
+
+  /// Adds the partial sums shared by the peers of a tile this block finishes, and resets the
+  /// tile's flag for the next launch
+  CUTLASS_DEVICE
+  static void acquire_accumulators(
+    AccumulatorTile &accumulator_tile,
+    void *barrier_workspace,
+    AccumulatorTile *partials_workspace,
+    int block_idx,
+    int first_block_idx,
+    int thread_idx) {
+
+    AccumulatorTile *accum_tile_workspace = partials_workspace + first_block_idx * kThreadCount;
+
+    Barrier::wait_eq_reset(barrier_workspace, thread_idx, first_block_idx, block_idx - first_block_idx);
+    BlockStripedReduceT::load_add(accumulator_tile, accum_tile_workspace, thread_idx);
+  }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,7 +62,8 @@ class ConvUniversal<
   CollectiveMainloop_,
   CollectiveEpilogue_,
   TileScheduler_,
-  cute::enable_if_t<cute::is_base_of_v<KernelImplicitTmaWarpSpecializedSm90, typename CollectiveMainloop_::DispatchPolicy::Schedule>>
+  cute::enable_if_t<cute::is_base_of_v<KernelImplicitTmaWarpSpecializedSm90, typename CollectiveMainloop_::DispatchPolicy::Schedule> ||
+                    cute::is_base_of_v<KernelImplicitTmaWarpSpecializedSm90Cooperative, typename CollectiveMainloop_::DispatchPolicy::Schedule>>
 > : public cutlass::gemm::kernel::GemmUniversal< 
   ProblemShape_, 
   CollectiveMainloop_, 
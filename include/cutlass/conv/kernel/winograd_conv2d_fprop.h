@@ -0,0 +1,545 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Winograd F(4x4, 3x3) forward convolution for 3x3, unit-stride, unit-dilation filters.
+
+    The convolution is computed as 36 independent GEMMs in the Winograd domain:
+
+      V[xi][t][c] = (B^T d B)[xi]   for every 6x6 input tile t and channel c
+      U[xi][k][c] = (G g G^T)[xi]   for every filter k and channel c
+      M[xi][t][k] = sum_c V[xi][t][c] * U[xi][k][c]
+      Y[t][k]     = A^T M A         (4x4 output tile)
+
+    The input and filter transforms are streaming kernels writing V and U to workspace. The batched
+    GEMM runs on tensor cores through gemm::device::GemmBatched, and the output transform is fused
+    with the epilogue output operator.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/gemm/device/gemm_batched.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace conv {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Transform matrices of the F(4x4, 3x3) Winograd algorithm
+struct WinogradF4x3 {
+
+  static int const kOutputTile = 4;
+  static int const kFilterSize = 3;
+  static int const kInputTile = kOutputTile + kFilterSize - 1;
+  static int const kPositions = kInputTile * kInputTile;
+
+  /// Computes B^T d B of a 6x6 input tile in place
+  CUTLASS_DEVICE
+  static void input_transform(float (&d)[kInputTile][kInputTile]) {
+    float t[kInputTile][kInputTile];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < kInputTile; ++j) {
+      transform_input_1d(d[0][j], d[1][j], d[2][j], d[3][j], d[4][j], d[5][j],
+                         t[0][j], t[1][j], t[2][j], t[3][j], t[4][j], t[5][j]);
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kInputTile; ++i) {
+      transform_input_1d(t[i][0], t[i][1], t[i][2], t[i][3], t[i][4], t[i][5],
+                         d[i][0], d[i][1], d[i][2], d[i][3], d[i][4], d[i][5]);
+    }
+  }
+
+  /// Computes G g G^T of a 3x3 filter
+  CUTLASS_DEVICE
+  static void filter_transform(
+    float const (&g)[kFilterSize][kFilterSize],
+    float (&u)[kInputTile][kInputTile]) {
+
+    float t[kInputTile][kFilterSize];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < kFilterSize; ++j) {
+      transform_filter_1d(g[0][j], g[1][j], g[2][j],
+                          t[0][j], t[1][j], t[2][j], t[3][j], t[4][j], t[5][j]);
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kInputTile; ++i) {
+      transform_filter_1d(t[i][0], t[i][1], t[i][2],
+                          u[i][0], u[i][1], u[i][2], u[i][3], u[i][4], u[i][5]);
+    }
+  }
+
+  /// Computes A^T m A of a 6x6 Winograd-domain tile
+  CUTLASS_DEVICE
+  static void output_transform(
+    float const (&m)[kInputTile][kInputTile],
+    float (&y)[kOutputTile][kOutputTile]) {
+
+    float t[kOutputTile][kInputTile];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < kInputTile; ++j) {
+      transform_output_1d(m[0][j], m[1][j], m[2][j], m[3][j], m[4][j], m[5][j],
+                          t[0][j], t[1][j], t[2][j], t[3][j]);
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kOutputTile; ++i) {
+      transform_output_1d(t[i][0], t[i][1], t[i][2], t[i][3], t[i][4], t[i][5],
+                          y[i][0], y[i][1], y[i][2], y[i][3]);
+    }
+  }
+
+private:
+
+  CUTLASS_DEVICE
+  static void transform_input_1d(
+    float d0, float d1, float d2, float d3, float d4, float d5,
+    float &v0, float &v1, float &v2, float &v3, float &v4, float &v5) {
+
+    v0 = 4.f * d0 - 5.f * d2 + d4;
+    v1 = -4.f * (d1 + d2) + d3 + d4;
+    v2 = 4.f * (d1 - d2) - d3 + d4;
+    v3 = -2.f * (d1 - d3) - d2 + d4;
+    v4 = 2.f * (d1 - d3) - d2 + d4;
+    v5 = 4.f * d1 - 5.f * d3 + d5;
+  }
+
+  CUTLASS_DEVICE
+  static void transform_filter_1d(
+    float g0, float g1, float g2,
+    float &u0, float &u1, float &u2, float &u3, float &u4, float &u5) {
+
+    u0 = 0.25f * g0;
+    u1 = -(g0 + g1 + g2) * (1.f / 6.f);
+    u2 = -(g0 - g1 + g2) * (1.f / 6.f);
+    u3 = g0 * (1.f / 24.f) + g1 * (1.f / 12.f) + g2 * (1.f / 6.f);
+    u4 = g0 * (1.f / 24.f) - g1 * (1.f / 12.f) + g2 * (1.f / 6.f);
+    u5 = g2;
+  }
+
+  CUTLASS_DEVICE
+  static void transform_output_1d(
+    float m0, float m1, float m2, float m3, float m4, float m5,
+    float &y0, float &y1, float &y2, float &y3) {
+
+    y0 = m0 + m1 + m2 + m3 + m4;
+    y1 = m1 - m2 + 2.f * (m3 - m4);
+    y2 = m1 + m2 + 4.f * (m3 + m4);
+    y3 = m1 - m2 + 8.f * (m3 - m4) + m5;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Number of 4x4 output tiles covered by a problem
+CUTLASS_HOST_DEVICE
+int64_t winograd_f4x3_tile_count(Conv2dProblemSize const &problem_size) {
+  int tiles_p = (problem_size.P + WinogradF4x3::kOutputTile - 1) / WinogradF4x3::kOutputTile;
+  int tiles_q = (problem_size.Q + WinogradF4x3::kOutputTile - 1) / WinogradF4x3::kOutputTile;
+  return int64_t(problem_size.N) * tiles_p * tiles_q;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Scatters the transformed 6x6 input tiles of an NHWC activation into V[36][T][C].
+/// One thread computes one (tile, channel) pair so that consecutive threads access consecutive
+/// channels of both the activation and the workspace.
+template <typename ElementA, typename ElementV>
+__global__ void winograd_f4x3_input_transform(
+  Conv2dProblemSize problem_size,
+  ElementA const *ptr_A,
+  ElementV *ptr_V) {
+
+  using Transform = WinogradF4x3;
+
+  int64_t tile_count = winograd_f4x3_tile_count(problem_size);
+  int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+
+  if (idx >= tile_count * problem_size.C) {
+    return;
+  }
+
+  int c = int(idx % problem_size.C);
+  int64_t tile = idx / problem_size.C;
+
+  int tiles_q = (problem_size.Q + Transform::kOutputTile - 1) / Transform::kOutputTile;
+  int tiles_p = (problem_size.P + Transform::kOutputTile - 1) / Transform::kOutputTile;
+
+  int tq = int(tile % tiles_q);
+  int tp = int((tile / tiles_q) % tiles_p);
+  int n = int(tile / (int64_t(tiles_q) * tiles_p));
+
+  int h_base = tp * Transform::kOutputTile - problem_size.pad_h;
+  int w_base = tq * Transform::kOutputTile - problem_size.pad_w;
+
+  NumericConverter<float, ElementA> to_float;
+  NumericConverter<ElementV, float> from_float;
+
+  float d[Transform::kInputTile][Transform::kInputTile];
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < Transform::kInputTile; ++i) {
+    int h = h_base + i;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < Transform::kInputTile; ++j) {
+      int w = w_base + j;
+      bool guard = (h >= 0 && h < problem_size.H && w >= 0 && w < problem_size.W);
+
+      d[i][j] = guard ?
+        to_float(ptr_A[((int64_t(n) * problem_size.H + h) * problem_size.W + w) * problem_size.C + c]) :
+        0.f;
+    }
+  }
+
+  Transform::input_transform(d);
+
+  int64_t position_stride = tile_count * problem_size.C;
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < Transform::kInputTile; ++i) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < Transform::kInputTile; ++j) {
+      ptr_V[(i * Transform::kInputTile + j) * position_stride + idx] = from_float(d[i][j]);
+    }
+  }
+}
+
+/// Transforms a KRSC 3x3 filter into U[36][K][C]. One thread computes one (k, c) pair.
+template <typename ElementB, typename ElementU>
+__global__ void winograd_f4x3_filter_transform(
+  Conv2dProblemSize problem_size,
+  ElementB const *ptr_B,
+  ElementU *ptr_U) {
+
+  using Transform = WinogradF4x3;
+
+  int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+  int64_t filter_count = int64_t(problem_size.K) * problem_size.C;
+
+  if (idx >= filter_count) {
+    return;
+  }
+
+  int c = int(idx % problem_size.C);
+  int k = int(idx / problem_size.C);
+
+  NumericConverter<float, ElementB> to_float;
+  NumericConverter<ElementU, float> from_float;
+
+  bool flip = (problem_size.mode == Mode::kConvolution);
+
+  float g[Transform::kFilterSize][Transform::kFilterSize];
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int r = 0; r < Transform::kFilterSize; ++r) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int s = 0; s < Transform::kFilterSize; ++s) {
+      int rr = flip ? Transform::kFilterSize - 1 - r : r;
+      int ss = flip ? Transform::kFilterSize - 1 - s : s;
+      g[r][s] = to_float(ptr_B[((int64_t(k) * Transform::kFilterSize + rr) * Transform::kFilterSize + ss) * problem_size.C + c]);
+    }
+  }
+
+  float u[Transform::kInputTile][Transform::kInputTile];
+  Transform::filter_transform(g, u);
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < Transform::kInputTile; ++i) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < Transform::kInputTile; ++j) {
+      ptr_U[(i * Transform::kInputTile + j) * filter_count + idx] = from_float(u[i][j]);
+    }
+  }
+}
+
+/// Gathers M[36][T][K], applies A^T M A and the epilogue output operator, and writes the 4x4
+/// output tile to the NHWC tensor D. One thread computes EpilogueOutputOp::kCount consecutive
+/// output channels of one tile.
+template <typename EpilogueOutputOp, typename ElementM, typename ElementC>
+__global__ void winograd_f4x3_output_transform(
+  Conv2dProblemSize problem_size,
+  ElementM const *ptr_M,
+  ElementC const *ptr_C,
+  ElementC *ptr_D,
+  typename EpilogueOutputOp::Params output_op_params) {
+
+  using Transform = WinogradF4x3;
+
+  static int const kCount = EpilogueOutputOp::kCount;
+
+  using FragmentAccumulator = typename EpilogueOutputOp::FragmentAccumulator;
+  using FragmentOutput = typename EpilogueOutputOp::FragmentOutput;
+
+  int64_t tile_count = winograd_f4x3_tile_count(problem_size);
+  int vectors_k = problem_size.K / kCount;
+
+  int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+
+  if (idx >= tile_count * vectors_k) {
+    return;
+  }
+
+  int k = int(idx % vectors_k) * kCount;
+  int64_t tile = idx / vectors_k;
+
+  int tiles_q = (problem_size.Q + Transform::kOutputTile - 1) / Transform::kOutputTile;
+  int tiles_p = (problem_size.P + Transform::kOutputTile - 1) / Transform::kOutputTile;
+
+  int tq = int(tile % tiles_q);
+  int tp = int((tile / tiles_q) % tiles_p);
+  int n = int(tile / (int64_t(tiles_q) * tiles_p));
+
+  EpilogueOutputOp output_op(output_op_params);
+
+  int64_t position_stride = tile_count * problem_size.K;
+  int64_t offset_M = tile * problem_size.K + k;
+
+  float y[kCount][Transform::kOutputTile][Transform::kOutputTile];
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int v = 0; v < kCount; ++v) {
+    float m[Transform::kInputTile][Transform::kInputTile];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < Transform::kInputTile; ++i) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < Transform::kInputTile; ++j) {
+        m[i][j] = float(ptr_M[(i * Transform::kInputTile + j) * position_stride + offset_M + v]);
+      }
+    }
+
+    Transform::output_transform(m, y[v]);
+  }
+
+  NumericConverter<typename FragmentAccumulator::Element, float> to_accumulator;
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < Transform::kOutputTile; ++i) {
+    int p = tp * Transform::kOutputTile + i;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < Transform::kOutputTile; ++j) {
+      int q = tq * Transform::kOutputTile + j;
+
+      if (p >= problem_size.P || q >= problem_size.Q) {
+        continue;
+      }
+
+      FragmentAccumulator accum;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int v = 0; v < kCount; ++v) {
+        accum[v] = to_accumulator(y[v][i][j]);
+      }
+
+      int64_t offset = ((int64_t(n) * problem_size.P + p) * problem_size.Q + q) * problem_size.K + k;
+
+      FragmentOutput output;
+
+      if (output_op.is_source_needed()) {
+        FragmentOutput source = *reinterpret_cast<FragmentOutput const *>(ptr_C + offset);
+        output = output_op(accum, source);
+      }
+      else {
+        output = output_op(accum);
+      }
+
+      *reinterpret_cast<FragmentOutput *>(ptr_D + offset) = output;
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel-level description of a Winograd F(4x4, 3x3) forward convolution. The Winograd-domain
+/// products are computed by a batched tensor core GEMM whose tile configuration mirrors the
+/// implicit GEMM convolution kernels.
+template <
+  typename ElementA_,
+  typename LayoutA_,
+  typename ElementB_,
+  typename LayoutB_,
+  typename ElementC_,
+  typename LayoutC_,
+  typename ElementAccumulator_,
+  typename OperatorClass_,
+  typename ArchTag_,
+  typename ThreadblockShape_,
+  typename WarpShape_,
+  typename InstructionShape_,
+  typename EpilogueOutputOp_,
+  int Stages_,
+  typename MathOperator_,
+  int AlignmentA_,
+  int AlignmentB_
+>
+struct WinogradConv2dFprop {
+
+  using ElementA = ElementA_;
+  using LayoutA = LayoutA_;
+  using ElementB = ElementB_;
+  using LayoutB = LayoutB_;
+  using ElementC = ElementC_;
+  using LayoutC = LayoutC_;
+  using ElementAccumulator = ElementAccumulator_;
+  using EpilogueOutputOp = EpilogueOutputOp_;
+  using ElementCompute = typename EpilogueOutputOp::ElementCompute;
+  using OperatorClass = OperatorClass_;
+  using ArchTag = ArchTag_;
+  using ThreadblockShape = ThreadblockShape_;
+  using WarpShape = WarpShape_;
+  using InstructionShape = InstructionShape_;
+  using MathOperator = MathOperator_;
+
+  static int const kStages = Stages_;
+  static int const kConvDim = 2;
+  static int const kAlignmentA = AlignmentA_;
+  static int const kAlignmentB = AlignmentB_;
+
+  static Operator const kConvolutionalOperator = conv::Operator::kFprop;
+  static IteratorAlgorithm const kIteratorAlgorithm = IteratorAlgorithm::kWinograd;
+  static StrideSupport const kStrideSupport = StrideSupport::kUnity;
+  static GroupMode const kGroupMode = GroupMode::kNone;
+
+  using Transform = WinogradF4x3;
+
+  /// Winograd-domain operands are stored in the element types of the convolution operands
+  using ElementV = ElementA;
+  using ElementU = ElementB;
+  using ElementM = ElementAccumulator;
+
+  /// M[xi] = V[xi] * U[xi]^T for each of the 36 Winograd positions
+  using Gemm = cutlass::gemm::device::GemmBatched<
+    ElementV,
+    cutlass::layout::RowMajor,
+    ElementU,
+    cutlass::layout::ColumnMajor,
+    ElementM,
+    cutlass::layout::RowMajor,
+    ElementAccumulator,
+    OperatorClass,
+    ArchTag,
+    ThreadblockShape,
+    WarpShape,
+    InstructionShape,
+    cutlass::epilogue::thread::LinearCombination<
+      ElementM,
+      128 / cutlass::sizeof_bits<ElementM>::value,
+      ElementAccumulator,
+      ElementAccumulator
+    >,
+    cutlass::gemm::threadblock::GemmBatchedIdentityThreadblockSwizzle,
+    kStages,
+    kAlignmentA,
+    kAlignmentB,
+    MathOperator
+  >;
+
+  using GemmKernel = typename Gemm::GemmKernel;
+  using WarpCount = typename GemmKernel::WarpCount;
+
+  using TensorRefA = TensorRef<ElementA, LayoutA>;
+  using TensorRefB = TensorRef<ElementB, LayoutB>;
+  using TensorRefC = TensorRef<ElementC, LayoutC>;
+
+  /// Argument structure
+  struct Arguments {
+
+    //
+    // Data members
+    //
+
+    Conv2dProblemSize problem_size;
+    TensorRefA ref_A;
+    TensorRefB ref_B;
+    TensorRefC ref_C;
+    TensorRefC ref_D;
+    typename EpilogueOutputOp::Params output_op;
+    SplitKMode split_k_mode;
+
+    //
+    // Methods
+    //
+
+    /// Default ctor
+    CUTLASS_HOST_DEVICE
+    Arguments() { }
+
+    CUTLASS_HOST_DEVICE
+    Arguments(
+      Conv2dProblemSize const & problem_size
+    ):
+      problem_size(problem_size) { }
+
+    CUTLASS_HOST_DEVICE
+    Arguments(
+      Conv2dProblemSize const & problem_size,
+      TensorRefA const & ref_A,
+      TensorRefB const & ref_B,
+      TensorRefC const & ref_C,
+      TensorRefC const & ref_D,
+      typename EpilogueOutputOp::Params const & output_op,
+      SplitKMode const & split_k_mode = SplitKMode::kSerial
+    ):
+      problem_size(problem_size),
+      ref_A(ref_A),
+      ref_B(ref_B),
+      ref_C(ref_C),
+      ref_D(ref_D),
+      output_op(output_op),
+      split_k_mode(split_k_mode) { }
+  };
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace conv
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
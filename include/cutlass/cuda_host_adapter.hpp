@@ -150,6 +150,18 @@ namespace cutlass {
 #if (__CUDACC_VER_MAJOR__ >= 12)
 CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuTensorMapEncodeTiled, 12000);
 CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuTensorMapEncodeIm2col, 12000);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuTensorMapReplaceAddress, 12000);
+#endif
+
+// Green contexts, used to partition the SMs of a device (see cutlass/sm_partition.hpp)
+#if ((__CUDACC_VER_MAJOR__ >= 13) || ((__CUDACC_VER_MAJOR__ == 12) && (__CUDACC_VER_MINOR__ >= 5)))
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuDeviceGet, 2000);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuDeviceGetDevResource, 12040);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuDevSmResourceSplitByCount, 12040);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuDevResourceGenerateDesc, 12040);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuGreenCtxCreate, 12040);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuGreenCtxDestroy, 12040);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuGreenCtxStreamCreate, 12050);
 #endif
 
 #undef CUTLASS_CUDA_DRIVER_STRINGIFY
@@ -785,8 +785,15 @@ public:
       static_assert(sizeof_bits_v<ElementScale> == 64, "Lookup table only supports 8 8bit scale values now.");
       static_assert(num_elements % 4 == 0 && num_elements >= 4, "Lookup table requires a vector size of 4x when converting.");
 
+      // ConvertAndScale: the scale holds the 8 negative candidates, the positive ones are derived in flight.
+      // ConvertAndScaleWithZero: the zero point is folded into two tables on the host. The scale holds the
+      // candidates for the codes [-8, -1] and the zero holds the candidates for the codes [0, 7].
+      constexpr bool DerivePositiveTable = KernelConversionMode == ConversionMode::ConvertAndScale;
+      static_assert(DerivePositiveTable || is_same_v<ElementScale, ElementZero>,
+                    "Lookup table with zero point requires ElementScale and ElementZero to be the same.");
+
       Tensor tCrS_neg = cute::get<1>(partitioned_extra_info);
-      auto&& tCrS_pos = cute::get<2>(partitioned_extra_info); // modification to its value is needed
+      auto&& tCrS_pos = cute::get<DerivePositiveTable ? 2 : 3>(partitioned_extra_info); // modification to its value is needed
       Tensor scales_neg = tCrS_neg(_, _, k_block);
       Tensor scales_pos = tCrS_pos(_, _, k_block);
       CUTE_STATIC_ASSERT_V(cute::size(src) == cute::size(scales_neg));
@@ -796,7 +803,7 @@ public:
       Tensor scales_neg_vm = cute::group_modes<1,-1>(cute::zipped_divide(scales_neg, Int<NumValPerSrcReg>{}));
       Tensor scales_pos_vm = cute::group_modes<1,-1>(cute::zipped_divide(scales_pos, Int<NumValPerSrcReg>{}));
 
-      if (k_block == 0) {
+      if (DerivePositiveTable && k_block == 0) {
         Tensor scales_neg_vm_ = filter(scales_neg_vm);
         Tensor scales_pos_vm_ = filter(scales_pos_vm);
         CUTLASS_PRAGMA_UNROLL
@@ -834,6 +841,20 @@ public:
           }
         }
       }
+      else if constexpr (cute::is_same_v<ElementScale, cutlass::float_ue8m0_t>) {
+        // Exponent-only (MX) scales cannot hold the product, so convert both operands to the MMA type.
+        // Multiplying by a power of two is exact unless the result leaves the range of DstType.
+        auto scale_stage = make_tensor_like<DstType>(src_vm(_, 0));
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size<1>(dst_vm); ++i) {
+          LayoutAwareConvert(src_vm(_, i), dst_vm(_, i));
+          LayoutAwareConvert(scales_vm(_, i), scale_stage);
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < size<0>(dst_vm); ++j) {
+            dst_vm(j, i) *= scale_stage(j);
+          }
+        }
+      }
       else {
         auto stage = make_tensor_like<ElementScale>(src_vm(_, 0));
         CUTLASS_PRAGMA_UNROLL
@@ -946,7 +967,7 @@ public:
       // nothing to do
       return cute::make_tuple();
     }
-    else if constexpr (UseScaleLookupTable) {
+    else if constexpr (UseScaleLookupTable && KernelConversionMode == ConversionMode::ConvertAndScale) {
       Tensor sS = make_tensor(make_smem_ptr(shared_tensors.smem_scale.begin()), SmemLayoutScale{});// (BLK_M,BLK_SCALE_K,PIPE)
       Tensor tCsS = mma_thread_slice.partition_A(sS);
       Tensor tCrS_neg = make_tensor<ElementScale>(mma_thread_slice.partition_fragment_A(sS(_,_,Int<0>{})).layout()); 
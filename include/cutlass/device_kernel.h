@@ -36,6 +36,7 @@
 
 #include <cutlass/detail/helper_macros.hpp> // CUTLASS_HOST_DEVICE
 #include <cutlass/platform/platform.h> // uint64_t
+#include <cutlass/arch/kernel_timer.hpp>
 
 // __grid_constant__ was introduced in CUDA 11.7.
 #if ((__CUDACC_VER_MAJOR__ >= 12) || ((__CUDACC_VER_MAJOR__ == 11) && (__CUDACC_VER_MINOR__ >= 7))) && !CUTLASS_CLANG_CUDA
@@ -78,9 +79,12 @@ void Kernel(typename Operator::Params params) {
   typename Operator::SharedStorage *shared_storage =
       reinterpret_cast<typename Operator::SharedStorage *>(SharedStorageBase);
 
+  uint64_t kernel_timer_start = cutlass::arch::kernel_timer_begin();
+
   Operator op;
 
   op(params, *shared_storage);
+  cutlass::arch::kernel_timer_end(kernel_timer_start);
   cutlass::arch::synclog_print();
 }
 
@@ -95,7 +99,10 @@ void Kernel2(typename Operator::Params params) {
   typename Operator::SharedStorage *shared_storage =
       reinterpret_cast<typename Operator::SharedStorage *>(SharedStorageBase);
 
+  uint64_t kernel_timer_start = cutlass::arch::kernel_timer_begin();
+
   Operator::invoke(params, *shared_storage);
+  cutlass::arch::kernel_timer_end(kernel_timer_start);
   cutlass::arch::synclog_print();
 
 }
@@ -118,8 +125,10 @@ void device_kernel(CUTLASS_GRID_CONSTANT typename Operator::Params const params)
 {
   // Dynamic shared memory base pointer
   extern __shared__ char smem[];
+  uint64_t kernel_timer_start = cutlass::arch::kernel_timer_begin();
   Operator op;
   op(params, smem);
+  cutlass::arch::kernel_timer_end(kernel_timer_start);
   cutlass::arch::synclog_print();
 
 }
@@ -245,7 +245,8 @@ template <
   class GmemLayoutTagD,
   int AlignmentD,
   class FusionOpOrCallbacks,
-  class DispatchPolicy
+  class DispatchPolicy,
+  bool ReduceAddD = false
 >
 struct Sm90TmaBuilderImpl {
   // Passing void D disables destination store + smem allocation
@@ -264,8 +265,9 @@ struct Sm90TmaBuilderImpl {
 
   using CopyOpS2G = cute::conditional_t<detail::is_im2col_mode<GmemLayoutTagD>,
       SM90_TMA_STORE_IM2COL,
-      SM90_TMA_STORE
+      cute::conditional_t<ReduceAddD, SM90_TMA_REDUCE_ADD, SM90_TMA_STORE>
     >;
+  static_assert(not (ReduceAddD && detail::is_im2col_mode<GmemLayoutTagD>), "Reduce-add epilogues do not support im2col D.");
   using CopyOpG2S = cute::conditional_t<detail::is_im2col_mode<GmemLayoutTagC>,
       SM90_TMA_LOAD_IM2COL,
       SM90_TMA_LOAD
@@ -493,6 +495,8 @@ struct CollectiveBuilder<
     FusionOperation,
     cute::enable_if_t<cute::is_same_v<Schedule, TmaWarpSpecialized> ||
                       cute::is_same_v<Schedule, TmaWarpSpecializedCooperative> ||
+                      cute::is_same_v<Schedule, TmaWarpSpecializedReduceAdd> ||
+                      cute::is_same_v<Schedule, TmaWarpSpecializedCooperativeReduceAdd> ||
                       detail::sm90_is_ptr_array_tma_v<Schedule>>> {
 private:
   using ElementD = cute::conditional_t<cute::is_void_v<ElementD_>,
@@ -516,7 +520,9 @@ public:
       GmemLayoutTagD,
       AlignmentD,
       FusionOperation,
-      DispatchPolicy
+      DispatchPolicy,
+      cute::is_same_v<Schedule, TmaWarpSpecializedReduceAdd> ||
+      cute::is_same_v<Schedule, TmaWarpSpecializedCooperativeReduceAdd>
     >::CollectiveOp;
 };
 
@@ -59,6 +59,8 @@ class CollectiveEpilogue {
 //
 #include "default_epilogue.hpp"
 #include "default_epilogue_array.hpp"
+#include "default_epilogue_triangular.hpp"
+#include "default_epilogue_planar_complex.hpp"
 #include "epilogue_tensor_broadcast.hpp"
 #include "sm70_epilogue_vectorized.hpp"
 #include "sm70_epilogue_vectorized_array.hpp"
@@ -210,12 +210,16 @@ public:
     // Make an identity coordinate tensor for predicating our output MN tile
     auto cD = make_identity_tensor(make_shape(unwrap(shape<0>(gD)), unwrap(shape<1>(gD))));
     Tensor tCcD = thr_mma.partition_C(cD);
+    // Residues that are statically known to be full tiles (static problem extents) need no predication
+    constexpr bool IsFullTileMN =
+        cutlass::gemm::detail::is_full_tile_residue<decltype(get<0>(residue_mnk)), decltype(size<0>(gD))>() &&
+        cutlass::gemm::detail::is_full_tile_residue<decltype(get<1>(residue_mnk)), decltype(size<1>(gD))>();
 
     // source is needed
     if (epilogue_op.is_source_needed()) {
       CUTLASS_PRAGMA_UNROLL
       for (int i = 0; i < size(accumulators); ++i) {
-        if (elem_less(tCcD(i), make_coord(get<0>(residue_mnk), get<1>(residue_mnk)))) {
+        if (IsFullTileMN || elem_less(tCcD(i), make_coord(get<0>(residue_mnk), get<1>(residue_mnk)))) {
           tCgD(i) = epilogue_op(accumulators(i), tCgC(i));
         }
       }
@@ -224,7 +228,7 @@ public:
     else {
       CUTLASS_PRAGMA_UNROLL
       for (int i = 0; i < size(accumulators); ++i) {
-        if (elem_less(tCcD(i), make_coord(get<0>(residue_mnk), get<1>(residue_mnk)))) {
+        if (IsFullTileMN || elem_less(tCcD(i), make_coord(get<0>(residue_mnk), get<1>(residue_mnk)))) {
           tCgD(i) = epilogue_op(accumulators(i));
         }
       }
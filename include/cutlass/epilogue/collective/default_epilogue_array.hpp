@@ -104,6 +104,9 @@ public:
     StrideC dC{};
     ElementD** ptr_D = nullptr;
     StrideD dD{};
+    // Optional per group row indices. Row m of group g is written to row ptr_scatter_D[g][m] of
+    // ptr_D[g] and reads its source from the same row of ptr_C[g].
+    int32_t const** ptr_scatter_D = nullptr;
   };
 
   // Device side epilogue params
@@ -253,6 +256,26 @@ public:
     auto cD = make_identity_tensor(make_shape(unwrap(shape<0>(gD)), unwrap(shape<1>(gD))));
     Tensor tCcD = thr_mma.partition_C(cD);
 
+    if (params.ptr_scatter_D != nullptr) {
+      // Scattered rows can lie outside of the (M,N) extent of the group, mC_mnl and mD_mnl only supply the strides
+      int32_t const* scatter_rows = params.ptr_scatter_D[l_coord];
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(accumulators); ++i) {
+        if (elem_less(tCcD(i), make_coord(get<0>(residue_mnk), get<1>(residue_mnk)))) {
+          int m = m_coord * size<0>(blk_shape_MNK) + get<0>(tCcD(i));
+          int n = n_coord * size<1>(blk_shape_MNK) + get<1>(tCcD(i));
+          int row = scatter_rows[m];
+          if (epilogue_op.is_source_needed()) {
+            mD_mnl(row,n,mock_l_coord) = epilogue_op(accumulators(i), mC_mnl(row,n,mock_l_coord));
+          }
+          else {
+            mD_mnl(row,n,mock_l_coord) = epilogue_op(accumulators(i));
+          }
+        }
+      }
+      return;
+    }
+
     // source is needed
     if (epilogue_op.is_source_needed()) {
       CUTLASS_PRAGMA_UNROLL
@@ -0,0 +1,305 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/*! \file
+  \brief Epilogue for planar complex GEMMs computed as real-expanded GEMMs.
+
+  The accumulator tile holds the four real partial products of a complex tile stacked as
+  [ Ar*Br  Ar*Bi ; Ai*Br  Ai*Bi ] (see sm90_mma_tma_gmma_ss_warpspecialized_planar_complex.hpp).
+  Each thread owns all four products of the same output elements, so the recombination into the
+  real and imaginary parts, including conjugation of A or B, happens in registers.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/complex.h"
+#include "cutlass/array_planar_complex.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/detail.hpp"
+
+#include "cute/tensor.hpp"
+#include "cute/numeric/numeric_types.hpp"
+#include "cutlass/cuda_host_adapter.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace epilogue {
+namespace collective {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Recombines the stacked partial products into complex results, applies a planar complex
+/// thread level operator (e.g. LinearCombinationPlanarComplex with Count = 1) and writes them
+/// out to destination storage.
+///
+/// C and D are each addressed by a real and an imaginary pointer sharing one stride, which
+/// covers both planar storage and interleaved cutlass::complex<T> storage (imaginary pointer
+/// one element past the real pointer, strides doubled).
+template <
+  class ElementC_,
+  class StrideC_,
+  class StrideD_,
+  class ThreadEpilogueOp_,
+  class EpilogueSchedule_,
+  ComplexTransform TransformA = ComplexTransform::kNone,
+  ComplexTransform TransformB = ComplexTransform::kNone
+>
+class DefaultEpiloguePlanarComplex {
+public:
+  //
+  // Type Aliases
+  //
+  using EpilogueSchedule = EpilogueSchedule_;
+  using DispatchPolicy = EpilogueSchedule_;
+
+  // derived types of output thread level operator
+  using ThreadEpilogueOp = ThreadEpilogueOp_;
+  using ElementOutput = typename ThreadEpilogueOp::ElementOutput;
+  using ElementAccumulator = typename ThreadEpilogueOp::ElementAccumulator;
+  using ElementCompute = typename ThreadEpilogueOp::ElementCompute;
+  using ElementScalar = typename ThreadEpilogueOp::ElementScalar;
+  using ElementC = ElementC_;
+  using StrideC = StrideC_;
+  using ElementD = ElementOutput;
+  using StrideD = StrideD_;
+
+  using GmemElementC = cute::conditional_t<cute::is_void_v<ElementC>, ElementD, ElementC>; // prevents void ref breakages
+
+  using GmemTiledCopyC = void;
+  using GmemTiledCopyD = void;
+
+  static const int kOutputAlignment = ThreadEpilogueOp::kCount;
+  static_assert(kOutputAlignment == 1, "DefaultEpiloguePlanarComplex computes one complex element per operation.");
+
+  static constexpr ComplexTransform kTransformA = TransformA;
+  static constexpr ComplexTransform kTransformB = TransformB;
+
+  static_assert(cute::rank(StrideC{}) == 3, "StrideCD must be rank-3: [M, N, L]");
+  static_assert(cute::rank(StrideD{}) == 3, "StrideCD must be rank-3: [M, N, L]");
+
+  struct SharedStorage { };
+
+  using TensorStorage = SharedStorage;
+
+  // Host side epilogue arguments
+  struct Arguments {
+    typename ThreadEpilogueOp::Params thread{};
+    GmemElementC const* ptr_C_real = nullptr;
+    GmemElementC const* ptr_C_imag = nullptr;
+    StrideC dC{};
+    ElementD* ptr_D_real = nullptr;
+    ElementD* ptr_D_imag = nullptr;
+    StrideD dD{};
+  };
+
+  // Device side epilogue params
+  using Params = Arguments;
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(
+      [[maybe_unused]] ProblemShape const& _,
+      Arguments const& args,
+      [[maybe_unused]] void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      [[maybe_unused]] Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return get<0>(problem_shape_MNKL) % 2 == 0 && get<1>(problem_shape_MNKL) % 2 == 0;
+  }
+
+  // Note: SharedStorage is unused for DefaultEpiloguePlanarComplex
+  CUTLASS_HOST_DEVICE
+  DefaultEpiloguePlanarComplex(Params const& params_, SharedStorage const& shared_storage = SharedStorage())
+      : params(params_), epilogue_op(params_.thread) { }
+
+  CUTLASS_DEVICE
+  bool
+  is_source_needed() {
+    return epilogue_op.is_source_needed();
+  }
+
+  template<
+    class ProblemShapeMNKL,
+    class BlockShapeMNK,
+    class BlockCoordMNKL,
+    class FrgEngine, class FrgLayout,
+    class TiledMma,
+    class ResidueMNK
+  >
+  CUTLASS_HOST_DEVICE void
+  operator()(
+      ProblemShapeMNKL problem_shape_mnkl,
+      BlockShapeMNK blk_shape_MNK,
+      BlockCoordMNKL blk_coord_mnkl,
+      cute::Tensor<FrgEngine, FrgLayout> const& accumulators,
+      TiledMma tiled_mma,
+      [[maybe_unused]] ResidueMNK residue_mnk,
+      int thread_idx,
+      [[maybe_unused]] char* smem_buf)
+  {
+    using namespace cute;
+    using X = Underscore;
+
+    static_assert(cute::rank(ProblemShapeMNKL{}) == 4, "ProblemShapeMNKL must be rank 4");
+    static_assert(is_static<BlockShapeMNK>::value, "ThreadBlock tile shape must be static");
+    static_assert(cute::rank(BlockShapeMNK{}) == 3, "BlockShapeMNK must be rank 3");
+    static_assert(cute::rank(BlockCoordMNKL{}) == 4, "BlockCoordMNKL must be rank 3");
+    static_assert(is_static<FrgLayout>::value, "Accumulator layout must be static");
+
+    // The real and imaginary halves of the stacked tile are the two halves of the MMA_M and MMA_N iterations
+    constexpr int HalfMmaM = size<1>(FrgLayout{}) / 2;
+    constexpr int HalfMmaN = size<2>(FrgLayout{}) / 2;
+    static_assert(size<1>(FrgLayout{}) % 2 == 0 && size<2>(FrgLayout{}) % 2 == 0,
+        "Accumulator must hold the stacked real and imaginary halves along MMA_M and MMA_N.");
+
+    // Separate out the complex problem shape
+    auto M = get<0>(problem_shape_mnkl) / 2;
+    auto N = get<1>(problem_shape_mnkl) / 2;
+    auto L = get<3>(problem_shape_mnkl);
+
+    auto plane_shape_MN = make_shape(size<0>(blk_shape_MNK) / _2{}, size<1>(blk_shape_MNK) / _2{});
+
+    auto stride_c = detail::get_epilogue_stride<EpilogueSchedule>(params.dC);
+    auto stride_d = detail::get_epilogue_stride<EpilogueSchedule>(params.dD);
+
+    // Represent the planes of the output tensors
+    auto tile_plane = [&](auto ptr, auto stride) {
+      Tensor m_mnl = make_tensor(make_gmem_ptr(ptr), make_shape(M,N,L), stride);                       // (m,n,l)
+      Tensor g_mnl = local_tile(m_mnl, plane_shape_MN, make_coord(_,_,_));                 // (BLK_M/2,BLK_N/2,m,n,l)
+      auto [m_coord, n_coord, k_coord, l_coord] = blk_coord_mnkl;
+      return g_mnl(_,_,m_coord,n_coord,l_coord);                                                // (BLK_M/2,BLK_N/2)
+    };
+    Tensor gC_real = tile_plane(params.ptr_C_real, stride_c);
+    Tensor gC_imag = tile_plane(params.ptr_C_imag, stride_c);
+    Tensor gD_real = tile_plane(params.ptr_D_real, stride_d);
+    Tensor gD_imag = tile_plane(params.ptr_D_imag, stride_d);
+
+    // Residue of the complex tile
+    auto [m_coord, n_coord, k_coord, l_coord] = blk_coord_mnkl;
+    auto residue_mn = make_coord(M - size<0>(plane_shape_MN) * m_coord, N - size<1>(plane_shape_MN) * n_coord);
+
+    // Coordinates of the accumulators within the stacked tile; those of the Ar*Br quadrant are
+    // also the coordinates of the complex output within the plane tile
+    auto thr_mma = tiled_mma.get_thread_slice(thread_idx);
+    Tensor cD = make_identity_tensor(make_shape(size<0>(blk_shape_MNK), size<1>(blk_shape_MNK)));
+    Tensor tCcD = thr_mma.partition_C(cD);                                                    // (VEC,THR_M,THR_N)
+
+    CUTE_STATIC_ASSERT_V(size(tCcD) == size(accumulators),
+        "Accumulator count must have the same destination element count.");
+
+    bool source_needed = epilogue_op.is_source_needed();
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int mi = 0; mi < HalfMmaM; ++mi) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int ni = 0; ni < HalfMmaN; ++ni) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < size<0>(accumulators); ++v) {
+          auto coord = tCcD(v, mi, ni);
+          if (!elem_less(coord, residue_mn)) {
+            continue;
+          }
+
+          ElementAccumulator rr = accumulators(v, mi, ni);
+          ElementAccumulator ri = accumulators(v, mi, ni + HalfMmaN);
+          ElementAccumulator ir = accumulators(v, mi + HalfMmaM, ni);
+          ElementAccumulator ii = accumulators(v, mi + HalfMmaM, ni + HalfMmaN);
+
+          // (Ar + i*sa*Ai) * (Br + i*sb*Bi) = (Ar*Br - sa*sb*Ai*Bi) + i*(sb*Ar*Bi + sa*Ai*Br)
+          typename ThreadEpilogueOp::FragmentAccumulator accum;
+          if constexpr ((TransformA == ComplexTransform::kConjugate) != (TransformB == ComplexTransform::kConjugate)) {
+            accum.real[0] = rr + ii;
+          }
+          else {
+            accum.real[0] = rr - ii;
+          }
+          ElementAccumulator imag_b = (TransformB == ComplexTransform::kConjugate) ? -ri : ri;
+          ElementAccumulator imag_a = (TransformA == ComplexTransform::kConjugate) ? -ir : ir;
+          accum.imag[0] = imag_b + imag_a;
+
+          int m = get<0>(coord);
+          int n = get<1>(coord);
+
+          typename ThreadEpilogueOp::FragmentOutput output;
+          if (source_needed) {
+            typename ThreadEpilogueOp::FragmentOutput source;
+            source.real[0] = gC_real(m, n);
+            source.imag[0] = gC_imag(m, n);
+            output = epilogue_op(accum, source);
+          }
+          else {
+            output = epilogue_op(accum);
+          }
+
+          gD_real(m, n) = output.real[0];
+          gD_imag(m, n) = output.imag[0];
+        }
+      }
+    }
+  }
+
+private:
+  Params params;
+  ThreadEpilogueOp epilogue_op;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace collective
+} // namespace epilogue
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
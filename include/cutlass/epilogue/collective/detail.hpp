@@ -356,12 +356,12 @@ public:
   {
     constexpr int BLK_M_RANK = cute::rank<0>(cta_tile_mnk);
     auto m_max_coord = unwrap(cute::transform(make_seq<BLK_M_RANK>{}, [&](auto i) {
-        return get<0,i>(problem_shape_mnkl) - get<0,i>(cta_tile_mnk) * get<0,i>(cta_coord_mnkl);
+        return cutlass::gemm::detail::tile_residue(get<0,i>(problem_shape_mnkl), get<0,i>(cta_tile_mnk), get<0,i>(cta_coord_mnkl));
       }));
 
     constexpr int BLK_N_RANK = cute::rank<1>(cta_tile_mnk);
     auto n_max_coord = unwrap(cute::transform(make_seq<BLK_N_RANK>{}, [&](auto i) {
-        return get<1,i>(problem_shape_mnkl) - get<1,i>(cta_tile_mnk) * get<1,i>(cta_coord_mnkl);
+        return cutlass::gemm::detail::tile_residue(get<1,i>(problem_shape_mnkl), get<1,i>(cta_tile_mnk), get<1,i>(cta_coord_mnkl));
       }));
 
     auto residue_mnk = make_tuple(m_max_coord, n_max_coord, Int<0>{});
@@ -405,12 +405,12 @@ public:
   {
     constexpr int BLK_M_RANK = cute::rank<0>(tile_shape_MNK);
     auto m_max_coord = unwrap(cute::transform(make_seq<BLK_M_RANK>{}, [&](auto i) {
-        return get<0,i>(problem_shape_mnkl) - get<0,i>(tile_shape_MNK) * get<0,i>(tile_coord_mnkl);
+        return cutlass::gemm::detail::tile_residue(get<0,i>(problem_shape_mnkl), get<0,i>(tile_shape_MNK), get<0,i>(tile_coord_mnkl));
       }));
 
     constexpr int BLK_N_RANK = cute::rank<1>(tile_shape_MNK);
     auto n_max_coord = unwrap(cute::transform(make_seq<BLK_N_RANK>{}, [&](auto i) {
-        return get<1,i>(problem_shape_mnkl) - get<1,i>(tile_shape_MNK) * get<1,i>(tile_coord_mnkl);
+        return cutlass::gemm::detail::tile_residue(get<1,i>(problem_shape_mnkl), get<1,i>(tile_shape_MNK), get<1,i>(tile_coord_mnkl));
       }));
 
     auto residue_mnk = make_tuple(m_max_coord, n_max_coord, Int<0>{});
@@ -35,6 +35,7 @@
 #pragma once
 
 #include "cutlass/cutlass.h"
+#include "cutlass/gemm/gemm.h"
 
 #include "cute/tensor.hpp"
 
@@ -353,6 +354,11 @@ public:
     Tensor cDt  = flat_divide(cD, tile);                                 //                (SMEM_M,SMEM_N,TILE_M,TILE_N)
     Tensor tSR_cD = thread_s2r.partition_D(cDt);                         // ((Atom,AtomNum),ATOM_M,ATOM_N,TILE_M,TILE_N)
 
+    // Residues that are statically known to be full tiles (static problem extents) need no predication
+    constexpr bool IsFullTileMN =
+        cutlass::gemm::detail::is_full_tile_residue<decltype(get<0>(residue_mnk)), decltype(size<0>(gD))>() &&
+        cutlass::gemm::detail::is_full_tile_residue<decltype(get<1>(residue_mnk)), decltype(size<1>(gD))>();
+
     CUTE_STATIC_ASSERT(size<1>(tRS_rAcc) % size<3>(tSR_gC) == 0);  // TILE_M divides MMA_M
     CUTE_STATIC_ASSERT(size<2>(tRS_rAcc) % size<4>(tSR_gC) == 0);  // TILE_N divides MMA_N
 
@@ -391,7 +397,7 @@ public:
         Tensor tSR_cD_flt = filter_zeros(tSR_cD, tSR_gBias.stride());
 
         // Step 0. Copy Bias from GMEM to fragment
-        auto pred_fn = [&] (auto const&... coords) { return elem_less(tSR_cD_flt(coords...), take<0, 2>(residue_mnk)); };
+        auto pred_fn = [&] (auto const&... coords) { return IsFullTileMN || elem_less(tSR_cD_flt(coords...), take<0, 2>(residue_mnk)); };
         copy_if(pred_fn, tSR_gBias_flt, tSR_rBias_flt);    
       }
     }
@@ -438,7 +444,7 @@ public:
               CUTLASS_PRAGMA_UNROLL
               for (int n = 0; n < size<2>(tSR_gDmn); ++n) {
                 // Predication
-                if (elem_less(tSR_cDmn(0,m,n), take<0,2>(residue_mnk))) {
+                if (IsFullTileMN || elem_less(tSR_cDmn(0,m,n), take<0,2>(residue_mnk))) {
                   CUTLASS_PRAGMA_UNROLL
                   for (int i = 0; i < size<0>(tSR_rAcc); ++i) {
                     tSR_rC(i,m,n) = tSR_gCmn(i,m,n);
@@ -476,7 +482,7 @@ public:
             CUTLASS_PRAGMA_UNROLL
             for (int n = 0; n < size<2>(tSR_gDmn); ++n) {
               // Predication
-              if (elem_less(tSR_cDmn(0,m,n), take<0,2>(residue_mnk))) {
+              if (IsFullTileMN || elem_less(tSR_cDmn(0,m,n), take<0,2>(residue_mnk))) {
                 // The Last Step. Copy to GMEM
                 copy(CopyAtomR2G{}, tSR_rD(_,m,n), tSR_gDmn(_,m,n));
               }
@@ -493,7 +499,7 @@ public:
               CUTLASS_PRAGMA_UNROLL
               for (int n = 0; n < size<2>(tSR_gDmn); ++n) {
                 // Predication
-                if (elem_less(tSR_cDmn(0,m,n), take<0,2>(residue_mnk))) {
+                if (IsFullTileMN || elem_less(tSR_cDmn(0,m,n), take<0,2>(residue_mnk))) {
                   CUTLASS_PRAGMA_UNROLL
                   for (int i = 0; i < size<0>(tSR_rAcc); ++i) {
                     tSR_rC(i,m,n) = tSR_gCmn(i,m,n);
@@ -523,7 +529,7 @@ public:
             CUTLASS_PRAGMA_UNROLL
             for (int n = 0; n < size<2>(tSR_gDmn); ++n) {
               // Predication
-              if (elem_less(tSR_cDmn(0,m,n), take<0,2>(residue_mnk))) {
+              if (IsFullTileMN || elem_less(tSR_cDmn(0,m,n), take<0,2>(residue_mnk))) {
                 // The Last Step. Copy to GMEM
                 copy(CopyAtomR2G{}, tSR_rD(_,m,n), tSR_gDmn(_,m,n));
               }
@@ -237,6 +237,10 @@ public:
     StrideC dC;
     ElementD const* ptr_D;
     StrideD dD;
+    // L2 eviction policies of the TMA load of C and the TMA store of D, e.g., EVICT_FIRST for a D
+    // that is not read again soon. The D policy applies to plain (non-im2col, non-reduce) TMA stores.
+    cute::TMA::CacheHintSm90 cache_hint_C = cute::TMA::CacheHintSm90::EVICT_NORMAL;
+    cute::TMA::CacheHintSm90 cache_hint_D = cute::TMA::CacheHintSm90::EVICT_NORMAL;
   };
 
   // Device side epilogue params
@@ -260,6 +264,8 @@ public:
     TMA_C tma_load_c;
     TMA_D tma_store_d;
     uint32_t tma_transaction_bytes = TmaTransactionBytes;
+    cute::TMA::CacheHintSm90 cache_hint_C = cute::TMA::CacheHintSm90::EVICT_NORMAL;
+    cute::TMA::CacheHintSm90 cache_hint_D = cute::TMA::CacheHintSm90::EVICT_NORMAL;
   };
 
   //
@@ -301,7 +307,9 @@ public:
       FusionCallbacks::to_underlying_arguments(problem_shape, args.thread, workspace),
       tma_load_c,
       tma_store_d,
-      transaction_bytes
+      transaction_bytes,
+      args.cache_hint_C,
+      args.cache_hint_D
     };
   }
 
@@ -494,8 +502,14 @@ public:
 
         // Execute the TMA load for C if needed
         if (issue_tma_load && is_C_load_needed) {
-          copy(params.tma_load_c.with(*tma_barrier, mcast_mask),
-              bGS_gC(_,_,_,epi_m,epi_n), bGS_sC(_,_,_,load_pipe_producer_state.index()));
+          if constexpr (cute::is_same_v<CopyOpG2S, SM90_TMA_LOAD>) {
+            copy(params.tma_load_c.with(*tma_barrier, mcast_mask, params.cache_hint_C),
+                bGS_gC(_,_,_,epi_m,epi_n), bGS_sC(_,_,_,load_pipe_producer_state.index()));
+          }
+          else {
+            copy(params.tma_load_c.with(*tma_barrier, mcast_mask),
+                bGS_gC(_,_,_,epi_m,epi_n), bGS_sC(_,_,_,load_pipe_producer_state.index()));
+          }
           load_pipeline.producer_expect_transaction(load_pipe_producer_state);
         }
 
@@ -729,7 +743,17 @@ public:
       synchronize(); // ensure all threads have issued their async fence
       if constexpr (is_destination_supported) {
         if (issue_tma_store) {
-          copy(params.tma_store_d, bSG_sD(_,_,_,store_pipe_producer_state.index()), bSG_gD(_,_,_,epi_m,epi_n));
+          if constexpr (cute::is_same_v<CopyOpS2G, SM90_TMA_STORE>) {
+            if (params.cache_hint_D != cute::TMA::CacheHintSm90::EVICT_NORMAL) {
+              copy(params.tma_store_d.with(params.cache_hint_D), bSG_sD(_,_,_,store_pipe_producer_state.index()), bSG_gD(_,_,_,epi_m,epi_n));
+            }
+            else {
+              copy(params.tma_store_d, bSG_sD(_,_,_,store_pipe_producer_state.index()), bSG_gD(_,_,_,epi_m,epi_n));
+            }
+          }
+          else {
+            copy(params.tma_store_d, bSG_sD(_,_,_,store_pipe_producer_state.index()), bSG_gD(_,_,_,epi_m,epi_n));
+          }
         }
       }
 
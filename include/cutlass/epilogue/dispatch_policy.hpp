@@ -54,6 +54,10 @@ struct PtrArrayNoSmemWarpSpecializedTransposed {};
 struct PtrArrayPlanarComplexNoSmemWarpSpecialized {};
 struct TmaWarpSpecialized {};
 struct TmaWarpSpecializedCooperative {};
+// TMA epilogues accumulating into D with TMA reduce-add stores instead of overwriting it,
+// e.g., for in-place stream-K and split-K reductions (ReductionMode::InPlace)
+struct TmaWarpSpecializedReduceAdd : TmaWarpSpecialized {};
+struct TmaWarpSpecializedCooperativeReduceAdd : TmaWarpSpecializedCooperative {};
 struct PtrArrayTmaWarpSpecializedCooperative {
   static constexpr int NumEpilogueWarpGroups = 2;
 };
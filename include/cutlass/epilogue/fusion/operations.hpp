@@ -141,6 +141,194 @@ struct LinCombTopKSoftmaxCol
     : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
 };
 
+// D = alpha * acc + beta * C
+// topk_values, topk_indices = top_k(D) over all of N, written as (M, TopK, L)
+template<
+  int TopK_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementTopK_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombTopKColReduction
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementTopK = ElementTopK_;
+  static constexpr int TopK = TopK_;
+};
+
+// Z = alpha * acc + beta * C
+// D = Z / scale, scale = max(abs(Z over a 1xQuantBlockN row block)) / max(ElementOutput)
+// QuantBlockN == 0 computes a single scale per row (per token)
+template<
+  int QuantBlockN_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementScaleFactor_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombRowBlockScaleQuant
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementScaleFactor = ElementScaleFactor_;
+  static constexpr int QuantBlockN = QuantBlockN_;
+};
+
+
+// D = alpha * acc + beta * C, where C is typically the residual stream
+// sum_squares = per-row sum over N of D^2, e.g. for a following RMSNorm
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSumSquares_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombPerRowSumSquares
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementSumSquares = ElementSumSquares_;
+};
+
+// D = alpha * acc + beta * C
+// sum, sum_squares = per-column sums over M of D and D^2, e.g. the per-channel batch-norm statistics
+// of a conv fprop output, reduced deterministically across CTA tiles
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementStats_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombPerColBatchNormStats
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementStats = ElementStats_;
+};
+
+// Z = alpha * acc + beta * C of a fused QKV projection
+// Q, K = rotary position embedding of the Q and K heads of Z
+// Q, K, V = heads of Z scattered into three separately strided (optionally paged) outputs
+// The regular D store is normally disabled with a void ElementD, ElementAux then sizes the epilogue
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementTable_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombRotaryQKVSplit
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAux = ElementOutput_;
+  using ElementTable = ElementTable_;
+};
+
+// D = alpha * acc + beta * C of a K (or fused KV) projection
+// K, V pages = heads of D divided by per-head scales, converted to ElementCache and written through a block table
+// A void ElementD writes the cache only, ElementAux then sizes the epilogue
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementCache_ = cutlass::float_e4m3_t,
+  class ElementScale_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombPagedKVCacheStore
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAux = ElementOutput_;
+  using ElementCache = ElementCache_;
+  using ElementScale = ElementScale_;
+};
+
+// Z = activation(alpha * acc + beta * C)
+// Values of a CSR/BSR output pattern = Z at the non-zeros of the pattern (SDDMM), elsewhere dropped
+// A void ElementD writes the sparse output only, ElementAux then sizes the epilogue
+template<
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSparse_ = ElementOutput_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombEltActSparseOutput
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ActivationFn = ActivationFn_<ElementCompute_>;
+  using ElementAux = ElementOutput_;
+  using ElementSparse = ElementSparse_;
+  static constexpr bool IsEltActSupported = true;
+};
+
+// D = alpha * acc + beta * C where m < valid_m(l) and n < valid_n(l), 0 elsewhere
+// Masks the padding of a batched GEMM over variable-length sequences with per-batch valid extents
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombValidLength
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> { };
+
+// D = alpha * acc + beta * C + scale(i) * T(m,:) * B_i, i = adapter_idx(m)
+// The multi-LoRA expand of the rank <= MaxRank intermediate T = X * A_i, selected per row (token)
+template<
+  int MaxRank_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementLoRA_ = cutlass::half_t,
+  class ElementScale_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombMultiLoRA
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  static constexpr int MaxRank = MaxRank_;
+  using ElementLoRA = ElementLoRA_;
+  using ElementScale = ElementScale_;
+};
+
+// D = alpha * acc + beta * C
+// db(k) = sum_m A(m,k), the bias gradient of a linear layer reduced from the dY operand of dX = dY * W^T
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementOperand_ = ElementOutput_,
+  class ElementBiasGrad_ = ElementOutput_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombBiasGrad
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementOperand = ElementOperand_;
+  using ElementBiasGrad = ElementBiasGrad_;
+};
+
+// Z = alpha * acc + beta * C
+// out(dst_row(m), n) += weight(m) * Z(m,n), e.g. the un-permute and top-k combine of a MoE layer
+// The regular D store is normally disabled with a void ElementD, ElementAux then sizes the epilogue
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementWeight_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombRowScatterReduce
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAux = ElementOutput_;
+  using ElementWeight = ElementWeight_;
+};
 
 // D = alpha * acc + beta * C + per-row bias
 template<
@@ -274,6 +462,52 @@ struct LinCombPerColBiasEltActAux
   static constexpr bool IsAuxOutSupported = true;
 };
 
+// D = dropout(alpha * acc + beta * C), with an optional packed keep mask
+// The keep decisions are drawn from a counter-based Philox RNG and are reproducible from (seed, offset)
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombDropout
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+};
+
+// D = stochastic_round(alpha * acc + beta * C)
+// ElementOutput is half_t, bfloat16_t, float_e4m3_t or float_e5m2_t
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_
+>
+struct LinCombStochasticRound
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, FloatRoundStyle::round_indeterminate> {
+};
+
+// D = alpha * acc + beta * C
+// Aux = D, stored a second time in the GmemLayoutTagAux layout, e.g. the transpose of D
+// consumed as a K-major operand by the wgrad GEMM
+template<
+  class GmemLayoutTagAux_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAux_ = ElementOutput_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  int AlignmentAux_ = 128 / cute::sizeof_bits_v<ElementAux_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombDualLayoutStore
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAux = ElementAux_;
+  using GmemLayoutTagAux = GmemLayoutTagAux_;
+  static constexpr int AlignmentAux = AlignmentAux_;
+  static constexpr bool IsAuxOutSupported = true;
+};
+
 // D = activation(per-row alpha * acc + per-row beta * C + per-row bias)
 template<
   template <class> class ActivationFn_,
@@ -428,6 +662,30 @@ struct ScaledLinCombPerColBiasEltActAmaxAux
   static constexpr bool IsAuxOutSupported = true;
 };
 
+// Z = scale_a * scale_b * alpha * acc + scale_c * beta * C
+// if D is fp8
+//   amax_d = max(abs(elements in activation(Z)))
+//   D = scale_d * activation(Z)
+// else
+//   D = activation(Z)
+// The scales and amax_d may be indexed by the batch or group of a ptr-array GEMM
+template<
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct ScaledLinCombEltActAmax
+    : LinCombEltAct<ActivationFn_, ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  static constexpr bool IsScaleFactorSupported = true;
+
+  using ElementAmax = ElementAmax_;
+  static constexpr bool IsAbsMaxSupported = true;
+};
+
 // Z = Aux
 // dY = alpha * acc + beta * C
 // D = d_activation(dY, Z)
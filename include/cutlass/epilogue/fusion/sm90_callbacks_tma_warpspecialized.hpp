@@ -47,6 +47,16 @@
 #include "cutlass/epilogue/fusion/sm90_visitor_compute_tma_warpspecialized.hpp"
 
 #include "cutlass/epilogue/fusion/sm90_visitor_topk_softmax.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_row_block_quant.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_rotary_embedding.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_paged_kv_store.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_sparse_output.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_valid_length.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_lora.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_bias_grad.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_philox.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_scatter_reduce.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_conv_pooling.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -930,6 +940,109 @@ struct FusionCallbacks<
   using Impl::Impl;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C
+// Aux = D, in the layout of StrideAux
+template<
+  class EpilogueTile,
+  int Stages,
+  class StrideAux,
+  class SmemLayoutAtom,
+  class CopyOpR2S,
+  class ElementCompute,
+  class ElementAux,
+  class ElementSource = ElementCompute,
+  class ElementScalar = ElementCompute,
+  int AlignmentAux = 128 / sizeof_bits_v<ElementAux>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombDualLayoutStore =
+  Sm90EVT<Sm90AuxStore<Stages, EpilogueTile, ElementAux, RoundStyle, StrideAux, SmemLayoutAtom, CopyOpR2S, AlignmentAux>,
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class GmemLayoutTagAux,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAux,
+  class ElementSource,
+  class ElementScalar,
+  int AlignmentAux,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class SmemLayoutAtom,
+  class CopyOpR2S
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombDualLayoutStore<
+      GmemLayoutTagAux, ElementOutput, ElementCompute, ElementAux, ElementSource, ElementScalar, AlignmentAux, RoundStyle
+    >,
+    CtaTileShapeMNK,
+    EpilogueTile,
+    SmemLayoutAtom,
+    CopyOpR2S
+> : Sm90LinCombDualLayoutStore<
+      EpilogueTile, StagesD, cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>, SmemLayoutAtom, CopyOpR2S,
+      ElementCompute, ElementAux, ElementSource, ElementScalar, AlignmentAux, RoundStyle
+    > {
+
+  using Impl =
+    Sm90LinCombDualLayoutStore<
+      EpilogueTile, StagesD, cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>, SmemLayoutAtom, CopyOpR2S,
+      ElementCompute, ElementAux, ElementSource, ElementScalar, AlignmentAux, RoundStyle
+    >;
+  using Operation =
+    fusion::LinCombDualLayoutStore<
+      GmemLayoutTagAux, ElementOutput, ElementCompute, ElementAux, ElementSource, ElementScalar, AlignmentAux, RoundStyle
+    >;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    // Second copy of D, typically in the transposed layout
+    using StrideAux = cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>;
+    ElementAux* aux_ptr = nullptr;
+    StrideAux dAux = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : store(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {aux_ptr, dAux} // unary args : store
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 // D = activation(alpha * acc + beta * C + per_col bias)
 // Aux = alpha * acc + beta * C + per_col bias)
@@ -2260,6 +2373,163 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Z = scale_a * scale_b * alpha * acc + scale_c * beta * C
+// if D is fp8
+//   amax_d = max(abs(elements in activation(Z)))
+//   D = scale_d * activation(Z)
+// else
+//   D = activation(Z)
+// where the scales and amax_d can be vectors for each batch or group
+template<
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax = ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90ScaledLinCombEltActAmaxPtrArray =
+  Sm90EVT<Sm90Compute<detail::ScaleOutOp<ElementOutput>::template Op, ElementOutput, ElementCompute, RoundStyle>, // activation(Z) * scale_d
+    Sm90EVT<Sm90ScalarReduction<detail::amax, atomic_maximum, ElementAmax, ElementCompute, RoundStyle, Stride<_0,_0,int64_t>>, // amax_d
+      Sm90EVT<Sm90Compute<ActivationFn, ElementCompute, ElementCompute, RoundStyle>, // activation(Z)
+        // Z = (scale_c * beta) * C + (scale_a * scale_b * alpha) * acc
+        Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementCompute, ElementCompute, RoundStyle>, // (scale_c * beta) * C + (scale_a * scale_b * alpha) * acc
+          Sm90ScalarBroadcastPtrArray<ElementScalar, Stride<_0,_0,int64_t>, 2>, // scale_c * beta
+          Sm90SrcFetch<ElementSource>, // C
+          Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // (scale_a * scale_b * alpha) * acc
+            Sm90ScalarBroadcastPtrArray<ElementScalar, Stride<_0,_0,int64_t>, 3>, // scale_a * scale_b * alpha
+            Sm90AccFetch // acc
+          >
+        >
+      >
+    >,
+    Sm90ScalarBroadcastPtrArray<ElementScalar, Stride<_0,_0,int64_t>> // scale_d
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  int NumEpilogueWarpGroups,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90PtrArrayTmaWarpSpecialized<StagesC,
+                                             StagesD,
+                                             FragmentSize,
+                                             ReuseSmemC,
+                                             DelayTmaStore,
+                                             NumEpilogueWarpGroups
+                                            >,
+    fusion::ScaledLinCombEltActAmax<ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90ScaledLinCombEltActAmaxPtrArray<ActivationFn, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90ScaledLinCombEltActAmaxPtrArray<ActivationFn, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::ScaledLinCombEltActAmax<ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle>;
+
+  // A scalar is taken per batch or group when its L-stride is non-zero, from the pointer array
+  // if one is given and else from the vector. Set dAmaxD to {_0{}, _0{}, 1} to reduce one amax
+  // per batch or group, e.g. for the amax history of each expert of a MoE layer.
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+    ElementScalar const* const* alpha_ptr_array = nullptr;
+    ElementScalar const* const* beta_ptr_array = nullptr;
+
+    ElementScalar scale_a = ElementScalar(1);
+    ElementScalar scale_b = ElementScalar(1);
+    ElementScalar scale_c = ElementScalar(1);
+    ElementScalar scale_d = ElementScalar(1);
+    ElementScalar const* scale_a_ptr = nullptr;
+    ElementScalar const* scale_b_ptr = nullptr;
+    ElementScalar const* scale_c_ptr = nullptr;
+    ElementScalar const* scale_d_ptr = nullptr;
+    ElementScalar const* const* scale_a_ptr_array = nullptr;
+    ElementScalar const* const* scale_b_ptr_array = nullptr;
+    ElementScalar const* const* scale_c_ptr_array = nullptr;
+    ElementScalar const* const* scale_d_ptr_array = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    using StrideScale = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha  = {_0{}, _0{}, 0};
+    StrideBeta  dBeta   = {_0{}, _0{}, 0};
+    StrideScale dScaleA = {_0{}, _0{}, 0};
+    StrideScale dScaleB = {_0{}, _0{}, 0};
+    StrideScale dScaleC = {_0{}, _0{}, 0};
+    StrideScale dScaleD = {_0{}, _0{}, 0};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    using StrideAmax = Stride<_0,_0,int64_t>;
+    ElementAmax* amax_D_ptr = nullptr;
+    StrideAmax dAmaxD = {_0{}, _0{}, 0};
+
+    operator typename Impl::Arguments() const {
+      // Only compute amax_d if D is fp8
+      ElementAmax* amax_D_ptr_ = nullptr;
+      if constexpr (detail::is_fp8_v<ElementOutput>) {
+        amax_D_ptr_ = amax_D_ptr;
+      }
+
+      return
+        {    // binary op : activation(Z) * scale_d or activation(Z)
+          {    // unary op : reduce(activation(Z))
+            {    // unary op : activation(Z)
+              {    // ternary op : (scale_c * beta) * C + (scale_a * scale_b * alpha) * acc
+                {{beta, scale_c},
+                 {beta_ptr, scale_c_ptr},
+                 {beta_ptr_array, scale_c_ptr_array},
+                 {dBeta, dScaleC}
+                },                    // leaf args : (scale_c * beta)
+                {},                   // leaf args : C
+                {                     // binary op : (scale_a * scale_b * alpha) * acc
+                  {{alpha, scale_a, scale_b},
+                   {alpha_ptr, scale_a_ptr, scale_b_ptr},
+                   {alpha_ptr_array, scale_a_ptr_array, scale_b_ptr_array},
+                   {dAlpha, dScaleA, dScaleB}
+                  },                  // leaf args : (scale_a * scale_b * alpha)
+                  {},                 // leaf args : acc
+                  {}                  // binary args : multiplies
+                },                    // end binary op
+                {} // ternary args : multiply_add
+              },   // end ternary op
+              activation // unary args : activation
+            },   // end unary op
+            {amax_D_ptr_, ElementCompute(0), dAmaxD} // unary args : reduce
+          },   // end unary op
+          {{scale_d},
+           {scale_d_ptr},
+           {scale_d_ptr_array},
+           {dScaleD}
+          },   // leaf args : scale_d
+          {} // binary args : multiplies or first
+        };   // end binary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 template<
   class CtaTileShapeMNK,
   class EpilogueTile,
@@ -2571,6 +2841,1117 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// D = alpha * acc + beta * C, topk_values, topk_indices = top_k(D) across all N tiles
+template<
+  int TopK,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementTopK = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombTopKColReduction =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // Identity for final conversion
+    Sm90EVT<Sm90TopKColReduction<TopK, CtaTileShapeMNK, ElementTopK, ElementCompute, RoundStyle>, // top_k(Z) over N
+      Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+    >
+  >;
+
+template <
+  int TopK,
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementTopK,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombTopKColReduction<TopK, ElementOutput, ElementCompute, ElementTopK, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombTopKColReduction<TopK, CtaTileShapeMNK, ElementOutput, ElementCompute, ElementTopK, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombTopKColReduction<TopK, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementTopK, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombTopKColReduction<TopK, ElementOutput, ElementCompute, ElementTopK, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Merged across CTA tiles through the kernel workspace, final values and indices are written as (M, TopK, L)
+    using StrideTopK = Stride<Int<TopK>,_1,int64_t>;
+    ElementTopK* topk_values_ptr = nullptr;
+    int32_t* topk_indices_ptr = nullptr;
+    StrideTopK dTopK = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : identity/convert
+          {    // unary op : top_k(beta * C + (alpha * acc))
+            {    // ternary op : beta * C + (alpha * acc)
+              {{beta}, {beta_ptr}}, // leaf args : beta
+              {},                   // leaf args : C
+              {                     // binary op : alpha * acc
+                {{alpha}, {alpha_ptr}}, // leaf args : alpha
+                {},                     // leaf args : acc
+                {}                  // binary args : multiplies
+              },                    // end binary op
+              {} // ternary args : multiply_add
+            },   // end ternary op
+            {topk_values_ptr, topk_indices_ptr, dTopK} // unary args : top_k
+          },   // end unary op
+          {} // unary args : identity/convert
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = (alpha * acc + beta * C) / scale, scale = amax(1xQuantBlockN row block) / max(ElementOutput)
+template<
+  int QuantBlockN,
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScaleFactor = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombRowBlockScaleQuant =
+  Sm90EVT<Sm90RowBlockScaleQuantization<QuantBlockN, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementScaleFactor, Stride<_1,int64_t,int64_t>, RoundStyle>, // quantize(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int QuantBlockN,
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScaleFactor,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombRowBlockScaleQuant<QuantBlockN, ElementOutput, ElementCompute, ElementScaleFactor, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombRowBlockScaleQuant<QuantBlockN, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementScaleFactor, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombRowBlockScaleQuant<QuantBlockN, FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementScaleFactor, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombRowBlockScaleQuant<QuantBlockN, ElementOutput, ElementCompute, ElementScaleFactor, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Scale factors, (M, ceil_div(N, QuantBlockN), L) or (M, 1, L) for QuantBlockN == 0
+    using StrideScale = Stride<_1,int64_t,int64_t>;
+    ElementScaleFactor* scale_ptr = nullptr;
+    StrideScale dScale = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: quantize(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {scale_ptr, dScale} // unary args: quantize
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C, sum_squares = per-row sum of D^2 across all N tiles
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSumSquares = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombPerRowSumSquares =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // Identity for final conversion
+    Sm90EVT<Sm90ColReduction<square_and_plus, plus, plus, 0, CtaTileShapeMNK,
+                             ElementSumSquares, ElementCompute, RoundStyle, Stride<_1,_0,int64_t>>, // sum(Z^2) over N
+      Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSumSquares,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombPerRowSumSquares<ElementOutput, ElementCompute, ElementSumSquares, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombPerRowSumSquares<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSumSquares, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombPerRowSumSquares<CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSumSquares, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombPerRowSumSquares<ElementOutput, ElementCompute, ElementSumSquares, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Reduced across CTA tiles through the kernel workspace, final values are written as (M, L)
+    using StrideSumSquares = Stride<_1,_0,int64_t>;
+    ElementSumSquares* sum_squares_ptr = nullptr;
+    StrideSumSquares dSumSquares = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : identity/convert
+          {    // unary op : reduce(beta * C + (alpha * acc))
+            {    // ternary op : beta * C + (alpha * acc)
+              {{beta}, {beta_ptr}}, // leaf args : beta
+              {},                   // leaf args : C
+              {                     // binary op : alpha * acc
+                {{alpha}, {alpha_ptr}}, // leaf args : alpha
+                {},                     // leaf args : acc
+                {}                  // binary args : multiplies
+              },                    // end binary op
+              {} // ternary args : multiply_add
+            },   // end ternary op
+            {sum_squares_ptr, ElementCompute(0), dSumSquares} // unary args : reduce
+          },   // end unary op
+          {} // unary args : identity/convert
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C, sum and sum_squares = per-column sums of D and D^2 across all M tiles.
+// Both are reduced through the kernel workspace, where the last CTA to finish a column of tiles adds
+// the partials of all M tiles in order, so the statistics do not depend on the CTA schedule.
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementStats = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombPerColBatchNormStats =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // Identity for final conversion
+    Sm90EVT<Sm90RowReduction<square_and_plus, plus, plus, 0, CtaTileShapeMNK,
+                             ElementStats, ElementCompute, RoundStyle, Stride<_0,_1,int64_t>>, // sum(Z^2) over M
+      Sm90EVT<Sm90RowReduction<plus, plus, plus, 0, CtaTileShapeMNK,
+                               ElementStats, ElementCompute, RoundStyle, Stride<_0,_1,int64_t>>, // sum(Z) over M
+        Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+      >
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementStats,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombPerColBatchNormStats<ElementOutput, ElementCompute, ElementStats, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombPerColBatchNormStats<CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementStats, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombPerColBatchNormStats<CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementStats, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombPerColBatchNormStats<ElementOutput, ElementCompute, ElementStats, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Final values are written as (N, L), i.e. one entry per output channel of a conv fprop.
+    // A nullptr skips the corresponding statistic.
+    using StrideStats = Stride<_0,_1,int64_t>;
+    ElementStats* sum_ptr = nullptr;
+    StrideStats dSum = {};
+    ElementStats* sum_squares_ptr = nullptr;
+    StrideStats dSumSquares = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : identity/convert
+          {    // unary op : reduce sum of squares
+            {    // unary op : reduce sum
+              {    // ternary op : beta * C + (alpha * acc)
+                {{beta}, {beta_ptr}}, // leaf args : beta
+                {},                   // leaf args : C
+                {                     // binary op : alpha * acc
+                  {{alpha}, {alpha_ptr}}, // leaf args : alpha
+                  {},                     // leaf args : acc
+                  {}                  // binary args : multiplies
+                },                    // end binary op
+                {} // ternary args : multiply_add
+              },   // end ternary op
+              {sum_ptr, ElementCompute(0), dSum} // unary args : reduce sum
+            },   // end unary op
+            {sum_squares_ptr, ElementCompute(0), dSumSquares} // unary args : reduce sum of squares
+          },   // end unary op
+          {} // unary args : identity/convert
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementTable = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombRotaryQKVSplit =
+  Sm90EVT<Sm90QKVSplitStore<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>, // scatter Q, K, V
+    Sm90EVT<Sm90RotaryEmbedding<FragmentSize, CtaTileShapeMNK, ElementCompute, ElementTable, RoundStyle>, // rope(Z)
+      Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementTable,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombRotaryQKVSplit<ElementOutput, ElementCompute, ElementTable, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombRotaryQKVSplit<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute, ElementTable, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombRotaryQKVSplit<FragmentSize, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementTable, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombRotaryQKVSplit<ElementOutput, ElementCompute, ElementTable, ElementSource, ElementScalar, RoundStyle>;
+
+  using RotaryArguments = typename Sm90RotaryEmbedding<FragmentSize, CtaTileShapeMNK, ElementCompute, ElementTable, RoundStyle>::Arguments;
+  using QKVArguments = typename Sm90QKVSplitStore<FragmentSize, CtaTileShapeMNK,
+      typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, RoundStyle>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Position ids, cos / sin tables and the rotated head range
+    RotaryArguments rotary = {};
+    // Destinations of the Q, K and V heads
+    QKVArguments qkv = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : scatter Q, K, V
+          {    // unary op : rope(beta * C + (alpha * acc))
+            {    // ternary op : beta * C + (alpha * acc)
+              {{beta}, {beta_ptr}}, // leaf args : beta
+              {},                   // leaf args : C
+              {                     // binary op : alpha * acc
+                {{alpha}, {alpha_ptr}}, // leaf args : alpha
+                {},                     // leaf args : acc
+                {}                  // binary args : multiplies
+              },                    // end binary op
+              {} // ternary args : multiply_add
+            },   // end ternary op
+            rotary // unary args : rope
+          },   // end unary op
+          qkv // unary args : scatter
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementCompute,
+  class ElementCache = cutlass::float_e4m3_t,
+  class ElementScale = float,
+  class ElementSource = ElementCompute,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombPagedKVCacheStore =
+  Sm90EVT<Sm90PagedKVCacheStore<FragmentSize, CtaTileShapeMNK, ElementCache, ElementCompute, ElementScale, RoundStyle>, // K, V pages = Z / scale
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementCache,
+  class ElementScale,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombPagedKVCacheStore<ElementOutput, ElementCompute, ElementCache, ElementScale, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombPagedKVCacheStore<FragmentSize, CtaTileShapeMNK, ElementCompute, ElementCache, ElementScale, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombPagedKVCacheStore<FragmentSize, CtaTileShapeMNK, ElementCompute, ElementCache, ElementScale, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombPagedKVCacheStore<ElementOutput, ElementCompute, ElementCache, ElementScale, ElementSource, ElementScalar, RoundStyle>;
+
+  using CacheArguments = typename Sm90PagedKVCacheStore<FragmentSize, CtaTileShapeMNK,
+      ElementCache, ElementCompute, ElementScale, RoundStyle>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Cache pages, block table, token positions and per-head scales
+    CacheArguments cache = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : paged store(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          cache // unary args : paged store
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  template <class> class ActivationFn,
+  class ElementCompute,
+  class ElementSparse,
+  class ElementSource = ElementCompute,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombEltActSparseOutput =
+  Sm90EVT<Sm90SparseOutputStore<FragmentSize, CtaTileShapeMNK, ElementSparse, ElementCompute, RoundStyle>, // values = Z at the non-zeros
+    Sm90EVT<Sm90Compute<ActivationFn, ElementCompute, ElementCompute, RoundStyle>, // Z = activation(beta * C + (alpha * acc))
+      Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSparse,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombEltActSparseOutput<ActivationFn, ElementOutput, ElementCompute, ElementSparse, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombEltActSparseOutput<FragmentSize, CtaTileShapeMNK, ActivationFn, ElementCompute, ElementSparse, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombEltActSparseOutput<FragmentSize, CtaTileShapeMNK, ActivationFn, ElementCompute, ElementSparse, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombEltActSparseOutput<ActivationFn, ElementOutput, ElementCompute, ElementSparse, ElementSource, ElementScalar, RoundStyle>;
+
+  using SparseArguments = typename Sm90SparseOutputStore<FragmentSize, CtaTileShapeMNK,
+      ElementSparse, ElementCompute, RoundStyle>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementCompute, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    // Values array and block row offsets / column indices of the output pattern
+    SparseArguments sparse = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : sparse store(activation(beta * C + (alpha * acc)))
+          {    // unary op : activation(beta * C + (alpha * acc))
+            {    // ternary op : beta * C + (alpha * acc)
+              {{beta}, {beta_ptr}}, // leaf args : beta
+              {},                   // leaf args : C
+              {                     // binary op : alpha * acc
+                {{alpha}, {alpha_ptr}}, // leaf args : alpha
+                {},                     // leaf args : acc
+                {}                  // binary args : multiplies
+              },                    // end binary op
+              {} // ternary args : multiply_add
+            },   // end ternary op
+            activation // unary args : activation
+          },   // end unary op
+          sparse // unary args : sparse store
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombValidLength =
+  Sm90EVT<Sm90ValidLengthMask<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>, // Z where valid, 0 elsewhere
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombValidLength<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombValidLength<FragmentSize, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombValidLength<FragmentSize, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombValidLength<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Valid M and N extents of each batch, nullptr leaves that mode unmasked
+    int32_t const* valid_m = nullptr;
+    int32_t const* valid_n = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : mask(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {valid_m, valid_n} // unary args : valid length mask
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  int MaxRank,
+  class ElementCompute,
+  class ElementLoRA = cutlass::half_t,
+  class ElementScale = float,
+  class ElementSource = ElementCompute,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombMultiLoRA =
+  Sm90EVT<Sm90MultiLoRAExpand<FragmentSize, CtaTileShapeMNK, MaxRank, ElementLoRA, ElementCompute, ElementScale, RoundStyle>, // Z + scale * T * B_i
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  int MaxRank,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementLoRA,
+  class ElementScale,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombMultiLoRA<MaxRank, ElementOutput, ElementCompute, ElementLoRA, ElementScale, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombMultiLoRA<FragmentSize, CtaTileShapeMNK, MaxRank, ElementCompute, ElementLoRA, ElementScale, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombMultiLoRA<FragmentSize, CtaTileShapeMNK, MaxRank, ElementCompute, ElementLoRA, ElementScale, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombMultiLoRA<MaxRank, ElementOutput, ElementCompute, ElementLoRA, ElementScale, ElementSource, ElementScalar, RoundStyle>;
+
+  using LoRAArguments = typename Sm90MultiLoRAExpand<FragmentSize, CtaTileShapeMNK, MaxRank,
+      ElementLoRA, ElementCompute, ElementScale, RoundStyle>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Shrunk intermediate, per-row adapter indices, expand weights and adapter scales
+    LoRAArguments lora = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : lora expand(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          lora // unary args : lora expand
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  class CtaTileShapeMNK,
+  class ElementCompute,
+  class ElementOperand,
+  class ElementBiasGrad,
+  class ElementSource = ElementCompute,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombBiasGrad =
+  Sm90EVT<Sm90OperandColReduction<CtaTileShapeMNK, ElementOperand, ElementBiasGrad, float, RoundStyle>, // db = colsum(A)
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementOperand,
+  class ElementBiasGrad,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombBiasGrad<ElementOutput, ElementCompute, ElementOperand, ElementBiasGrad, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombBiasGrad<CtaTileShapeMNK, ElementCompute, ElementOperand, ElementBiasGrad, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombBiasGrad<CtaTileShapeMNK, ElementCompute, ElementOperand, ElementBiasGrad, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombBiasGrad<ElementOutput, ElementCompute, ElementOperand, ElementBiasGrad, ElementSource, ElementScalar, RoundStyle>;
+
+  using BiasGradArguments = typename Sm90OperandColReduction<CtaTileShapeMNK, ElementOperand, ElementBiasGrad, float, RoundStyle>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // dY operand and bias gradient output
+    BiasGradArguments bias_grad = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : bias grad(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          bias_grad // unary args : bias grad
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementCompute,
+  class ElementSource = ElementCompute,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombDropout =
+  Sm90EVT<Sm90Dropout<FragmentSize, CtaTileShapeMNK, ElementCompute>, // dropout(Z)
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombDropout<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombDropout<FragmentSize, CtaTileShapeMNK, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombDropout<FragmentSize, CtaTileShapeMNK, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombDropout<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  using DropoutArguments = typename Sm90Dropout<FragmentSize, CtaTileShapeMNK, ElementCompute>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // RNG seed and offset, dropout probability and optional keep mask
+    DropoutArguments dropout = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : dropout(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          dropout // unary args : dropout
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementCompute,
+  class ElementScalar = ElementCompute
+>
+using Sm90LinCombStochasticRound =
+  Sm90EVT<Sm90StochasticRound<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute>, // stochastic_round(Z)
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombStochasticRound<ElementOutput, ElementCompute, ElementSource, ElementScalar>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombStochasticRound<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar> {
+
+  using Impl = Sm90LinCombStochasticRound<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar>;
+  using Operation = fusion::LinCombStochasticRound<ElementOutput, ElementCompute, ElementSource, ElementScalar>;
+
+  using StochasticRoundArguments = typename Sm90StochasticRound<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // RNG seed and offset
+    StochasticRoundArguments rounding = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : stochastic_round(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          rounding // unary args : stochastic round
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementWeight = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombRowScatterReduce =
+  Sm90EVT<Sm90RowScatterReduce<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute, ElementWeight, RoundStyle>, // out[dst_row] += weight * Z
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementWeight,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombRowScatterReduce<ElementOutput, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombRowScatterReduce<FragmentSize, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombRowScatterReduce<FragmentSize, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombRowScatterReduce<ElementOutput, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>;
+
+  using ScatterArguments = typename Sm90RowScatterReduce<FragmentSize, CtaTileShapeMNK,
+      typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementWeight, RoundStyle>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    // Output, destination rows and weights of the scatter-reduce
+    ScatterArguments scatter = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : scatter-reduce(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          scatter // unary args : scatter-reduce
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Grouped variant, the weights and destinations of each group are passed through the per-group arrays
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementWeight = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombRowScatterReducePtrArray =
+  Sm90EVT<Sm90RowScatterReduce<FragmentSize, CtaTileShapeMNK, ElementOutput, ElementCompute, ElementWeight, RoundStyle>, // out[dst_row] += weight * Z
+    Sm90LinearCombinationPtrArray<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  int NumEpilogueWarpGroups,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementWeight,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90PtrArrayTmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore, NumEpilogueWarpGroups>,
+    fusion::LinCombRowScatterReduce<ElementOutput, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombRowScatterReducePtrArray<FragmentSize, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombRowScatterReducePtrArray<FragmentSize, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombRowScatterReduce<ElementOutput, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>;
+
+  using ScatterArguments = typename Sm90RowScatterReduce<FragmentSize, CtaTileShapeMNK,
+      typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementWeight, RoundStyle>::Arguments;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+    ElementScalar const* const* alpha_ptr_array = nullptr;
+    ElementScalar const* const* beta_ptr_array = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    // Output, destination rows and weights of the scatter-reduce
+    ScatterArguments scatter = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : scatter-reduce(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {beta_ptr_array}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {alpha_ptr_array}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          scatter // unary args : scatter-reduce
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 // Grouped Wgrad Conv
 template<
   class GroupsPerTile,
@@ -0,0 +1,316 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+/*! \file
+  \brief Visitor tree bias-gradient column reduction for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Bias-gradient column reduction over the A operand
+// For the backward GEMM dX = dY * W^T of a linear layer, A = dY is (M, K) and the bias gradient is
+//
+//   db(k) = sum_m dY(m,k)
+//
+// The reduction is carried by the epilogue of the same GEMM, reading dY back from gmem while it is
+// still resident in L2. The K columns are split into ceil(N / CTA_N) contiguous chunks, and CTA tile
+// (m,n) sums the CTA_M rows of row block m over column chunk n. Each CTA writes its partial sums to
+// the workspace, and the last CTA to arrive on a chunk adds the partials of all row blocks in
+// ascending order, so db is bitwise reproducible from run to run. The visited values pass through.
+//
+// Requires the epilogue of each output tile to run once per GEMM, and a K-major (row-major) dY.
+//
+template <
+  class CtaTileShapeMNK,
+  class ElementOperand,
+  class ElementOutput,
+  class ElementCompute = float,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90OperandColReduction {
+private:
+  static constexpr int CtaTileM = size<0>(CtaTileShapeMNK{});
+  static constexpr int CtaTileN = size<1>(CtaTileShapeMNK{});
+
+  // Columns of K reduced by each column of CTA tiles, rounded up to whole warps for coalescing
+  template <class ProblemShapeMNKL>
+  CUTLASS_HOST_DEVICE static int
+  get_chunk_size(ProblemShapeMNKL const& problem_shape_mnkl) {
+    auto [M, N, K, L] = problem_shape_mnkl;
+    int tiles_n = ceil_div(static_cast<int>(N), CtaTileN);
+    return round_up(ceil_div(static_cast<int>(K), tiles_n), NumThreadsPerWarp);
+  }
+
+  // Workspace holds the (K) partial sums of every (m,l) row block, then one tile counter per (n,l) chunk.
+  // Returns the byte offset of the counters and the total size.
+  template <class ProblemShape>
+  static auto
+  get_workspace_offsets(ProblemShape const& problem_shape) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    size_t num_partials = size_t(ceil_div(M, CtaTileM)) * L * K;
+
+    size_t tile_counters_offset = round_nearest(num_partials * sizeof(ElementCompute), MinWorkspaceAlignment);
+    size_t workspace_size = tile_counters_offset + size_t(ceil_div(N, CtaTileN)) * L * sizeof(int);
+    return cute::make_tuple(tile_counters_offset, workspace_size);
+  }
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOperand const* ptr_operand = nullptr;  // (M, K, L) dY, the A operand of the GEMM
+    int64_t stride_operand = 0;                   // row stride of dY
+    int64_t batch_stride_operand = 0;
+    ElementOutput* ptr_bias_grad = nullptr;       // (K, L), nullptr disables the reduction
+    int64_t batch_stride_bias_grad = 0;
+  };
+
+  struct Params {
+    ElementOperand const* ptr_operand = nullptr;
+    int64_t stride_operand = 0;
+    int64_t batch_stride_operand = 0;
+    ElementOutput* ptr_bias_grad = nullptr;
+    int64_t batch_stride_bias_grad = 0;
+    ElementCompute* partial_buffer = nullptr;
+    int* tile_counters = nullptr;
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    auto [tile_counters_offset, workspace_size] = get_workspace_offsets(problem_shape);
+    uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+
+    return {
+      args.ptr_operand,
+      args.stride_operand,
+      args.batch_stride_operand,
+      args.ptr_bias_grad,
+      args.batch_stride_bias_grad,
+      reinterpret_cast<ElementCompute*>(workspace_ptr),
+      reinterpret_cast<int*>(workspace_ptr + tile_counters_offset)
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.ptr_bias_grad == nullptr || args.ptr_operand != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    if (args.ptr_bias_grad == nullptr) {
+      return 0;
+    }
+    return get<1>(get_workspace_offsets(problem_shape));
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    if (args.ptr_bias_grad == nullptr) {
+      return Status::kSuccess;
+    }
+    auto [tile_counters_offset, workspace_size] = get_workspace_offsets(problem_shape);
+    int* tile_counters = reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(workspace) + tile_counters_offset);
+    return zero_workspace(tile_counters, workspace_size - tile_counters_offset, stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90OperandColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90OperandColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+    bool do_final_reduction = false;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementInput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (params.ptr_bias_grad == nullptr || not is_last_iteration) {
+        return;
+      }
+
+      auto& [problem_shape_mnkl, tile_coord_mnkl, thread_idx, thread_count] = args_tuple;
+      auto [M, N, K, L] = problem_shape_mnkl;
+      auto [m, n, k, l] = tile_coord_mnkl;
+      int tiles_m = ceil_div(static_cast<int>(M), CtaTileM);
+      int tiles_n = ceil_div(static_cast<int>(N), CtaTileN);
+
+      // fully OOB CTA in partially OOB cluster
+      if (m >= tiles_m || n >= tiles_n) {
+        return;
+      }
+
+      //
+      // 1. Sum the rows of this row block over the column chunk, in ascending row order
+      //
+      int chunk = get_chunk_size(problem_shape_mnkl);
+      int col_begin = n * chunk;
+      int col_end = cute::min(col_begin + chunk, static_cast<int>(K));
+      int row_begin = m * CtaTileM;
+      int row_end = cute::min(row_begin + CtaTileM, static_cast<int>(M));
+
+      NumericConverter<ElementCompute, ElementOperand, RoundStyle> convert_operand{};
+      ElementOperand const* ptr_operand = params.ptr_operand + l * params.batch_stride_operand;
+      ElementCompute* ptr_partial = params.partial_buffer + (int64_t(l) * tiles_m + m) * K;
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int col = col_begin + thread_idx; col < col_end; col += thread_count) {
+        ElementCompute sum = ElementCompute(0);
+        CUTLASS_PRAGMA_NO_UNROLL
+        for (int row = row_begin; row < row_end; ++row) {
+          sum += convert_operand(ptr_operand[row * params.stride_operand + col]);
+        }
+        ptr_partial[col] = sum;
+      }
+
+      //
+      // 2. Increment atomic counters to signal final gmem reduction
+      //
+      // Ensure gmem writes are visible to other threads before incrementing counter
+      __threadfence();
+      sync_fn();
+      // Collective thread 0 increments atomic tile counter and copies value to smem
+      int* prev_tile_count = reinterpret_cast<int*>(raw_pointer_cast(smem_buffer.data()));
+      if (thread_idx == 0) {
+        *prev_tile_count = atomicAdd(params.tile_counters + l * tiles_n + n, 1);
+      }
+      sync_fn();
+      // Broadcast tile count to other threads in CTA and determine final reduction status
+      do_final_reduction = *prev_tile_count == tiles_m - 1;
+      sync_fn();
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      //
+      // 3. Add the partial sums of all row blocks if this was the last CTA of the column chunk
+      //
+      if (not do_final_reduction) {
+        return;
+      }
+
+      auto& [problem_shape_mnkl, tile_coord_mnkl, thread_idx, thread_count] = args_tuple;
+      auto [M, N, K, L] = problem_shape_mnkl;
+      auto [m, n, k, l] = tile_coord_mnkl;
+      int tiles_m = ceil_div(static_cast<int>(M), CtaTileM);
+
+      int chunk = get_chunk_size(problem_shape_mnkl);
+      int col_begin = n * chunk;
+      int col_end = cute::min(col_begin + chunk, static_cast<int>(K));
+
+      NumericConverter<ElementOutput, ElementCompute, RoundStyle> convert_output{};
+      ElementCompute const* ptr_partial = params.partial_buffer + int64_t(l) * tiles_m * K;
+      ElementOutput* ptr_bias_grad = params.ptr_bias_grad + l * params.batch_stride_bias_grad;
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int col = col_begin + thread_idx; col < col_end; col += thread_count) {
+        ElementCompute sum = ElementCompute(0);
+        CUTLASS_PRAGMA_NO_UNROLL
+        for (int m_tile = 0; m_tile < tiles_m; ++m_tile) {
+          sum += ptr_partial[int64_t(m_tile) * K + col];
+        }
+        ptr_bias_grad[col] = convert_output(sum);
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    int thread_count = static_cast<int>(size(args.tiled_copy));
+    auto args_tuple = make_tuple(args.problem_shape_mnkl, args.tile_coord_mnkl, args.thread_idx, thread_count);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
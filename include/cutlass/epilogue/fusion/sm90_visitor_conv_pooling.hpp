@@ -0,0 +1,268 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+/*! \file
+  \brief Visitor tree fused output pooling for sm90 TMA warp-specialized conv epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Fused NHWC max or average pooling of a conv fprop output
+// The implicit GEMM output is Z(m,k) with m linearizing the (W,H,N) output pixels, w fastest.
+// Every visited element is reduced into each pooling window that covers it:
+//
+//   out(n,ho,wo,k) = max/avg { Z(n,h,w,k) : h in [ho*stride_h - pad_h, ho*stride_h - pad_h + window_h),
+//                                           w in [wo*stride_w - pad_w, wo*stride_w - pad_w + window_w) }
+//
+// with the same semantics as cutlass::pooling_nhwc, i.e. the average always divides by window_h * window_w.
+// Windows that straddle CTA tiles are completed by atomic reductions from each contributing CTA rather
+// than by recomputing overlapping halos, so the output must be cleared to zeros (average) or -inf (max)
+// before the kernel runs. The visited values pass through, so the regular D store is normally disabled
+// by a void ElementD when only the pooled tensor is needed.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  bool IsAvgPooling,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90ConvPooling {
+  static_assert(cute::is_same_v<ElementOutput, float>,
+      "Fused pooling reduces atomically and requires a float output.");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    float* ptr_out = nullptr;                               // (N,Ho,Wo,K) packed, reduced into
+    int batch = 1;                                          // N
+    int height = 1;                                         // H of the conv output
+    int width = 1;                                          // W of the conv output
+    int window_h = 2;
+    int window_w = 2;
+    int stride_h = 2;
+    int stride_w = 2;
+    int pad_h = 0;
+    int pad_w = 0;
+  };
+
+  struct Params {
+    float* ptr_out = nullptr;
+    FastDivmod divmod_w;
+    FastDivmod divmod_h;
+    int out_h = 0;
+    int out_w = 0;
+    int window_h = 0;
+    int window_w = 0;
+    int stride_h = 1;
+    int stride_w = 1;
+    int pad_h = 0;
+    int pad_w = 0;
+    float scale = 1.f;                                      // 1 / window area for average pooling
+  };
+
+  static CUTLASS_HOST_DEVICE int
+  get_pooled_extent(int extent, int window, int stride, int pad) {
+    return (extent + 2 * pad - window) / stride + 1;
+  }
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return {
+      args.ptr_out,
+      FastDivmod(args.width),
+      FastDivmod(args.height),
+      get_pooled_extent(args.height, args.window_h, args.stride_h, args.pad_h),
+      get_pooled_extent(args.width, args.window_w, args.stride_w, args.pad_w),
+      args.window_h,
+      args.window_w,
+      args.stride_h,
+      args.stride_w,
+      args.pad_h,
+      args.pad_w,
+      IsAvgPooling ? 1.f / float(args.window_h * args.window_w) : 1.f
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    // Conv problem shapes carry M as the hierarchical (Q,P,Z,N) output extent
+    bool implementable = args.ptr_out != nullptr &&
+      static_cast<int64_t>(size<0>(problem_shape_mnkl)) ==
+        static_cast<int64_t>(args.batch) * args.height * args.width;
+    implementable &= args.window_h > 0 && args.window_w > 0 && args.stride_h > 0 && args.stride_w > 0;
+    implementable &= args.pad_h >= 0 && args.pad_w >= 0 && args.pad_h < args.window_h && args.pad_w < args.window_w;
+    implementable &= get_pooled_extent(args.height, args.window_h, args.stride_h, args.pad_h) > 0 &&
+                     get_pooled_extent(args.width, args.window_w, args.stride_w, args.pad_w) > 0;
+    return implementable;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ConvPooling() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ConvPooling(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCcD, tile_coord_mnkl, residue_tCcD, problem_N] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+
+      using ConvertInput = NumericArrayConverter<float, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Array frg_I = convert_input(frg_input);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto crd = tCcD_mn(epi_v * FragmentSize + i);
+        if (not elem_less(crd, residue_tCcD)) {
+          continue;
+        }
+
+        int row = get<0>(crd) + m * tile_M;
+        int col = get<1>(crd) + n * tile_N;
+        int nh, w, batch_idx, h;
+        params.divmod_w(nh, w, row);
+        params.divmod_h(batch_idx, h, nh);
+
+        // Range of pooled rows and columns whose window covers (h,w)
+        int ho_begin = cute::max(0, (h + params.pad_h - params.window_h + params.stride_h) / params.stride_h);
+        int ho_end = cute::min(params.out_h, (h + params.pad_h) / params.stride_h + 1);
+        int wo_begin = cute::max(0, (w + params.pad_w - params.window_w + params.stride_w) / params.stride_w);
+        int wo_end = cute::min(params.out_w, (w + params.pad_w) / params.stride_w + 1);
+
+        float value = frg_I[i] * params.scale;
+        for (int ho = ho_begin; ho < ho_end; ++ho) {
+          for (int wo = wo_begin; wo < wo_end; ++wo) {
+            int64_t pooled_idx = (static_cast<int64_t>(batch_idx) * params.out_h + ho) * params.out_w + wo;
+            float* ptr = params.ptr_out + pooled_idx * problem_N + col;
+            if constexpr (IsAvgPooling) {
+              atomic_add<float>{}(ptr, value);
+            }
+            else {
+              atomic_maximum<float>{}(ptr, value);
+            }
+          }
+        }
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    int problem_N = static_cast<int>(N);
+
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl, args.residue_cD, problem_N);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -864,7 +864,7 @@ struct Sm90ScalarBroadcastPtrArray {
   Sm90ScalarBroadcastPtrArray(Params const& params, SharedStorage const& shared_storage)
       : params_ptr(&params) {
     // Get the scalar for non-batched broadcast
-    if (size<2>(params_ptr->dScalar[0]) == 0) {
+    if (!is_batched()) {
       update_scalar();
     }
   }
@@ -876,7 +876,7 @@ struct Sm90ScalarBroadcastPtrArray {
   CUTLASS_DEVICE auto
   get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
     // Get the scalar for batched broadcast
-    if (size<2>(params_ptr->dScalar[0]) != 0) {
+    if (is_batched()) {
       auto [m_coord, n_coord, k_coord, l_coord] = args.tile_coord_mnkl;
       update_scalar(l_coord);
     }
@@ -910,7 +910,7 @@ struct Sm90ScalarBroadcastPtrArray {
   get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
 
     // Get the scalar for batched broadcast
-    if (get<2>(params_ptr->dScalar[0]) != 0) {
+    if (is_batched()) {
       auto [m_coord, n_coord, k_coord, l_coord] = args.tile_coord_mnkl;
       update_scalar(l_coord);
     }
@@ -919,6 +919,18 @@ struct Sm90ScalarBroadcastPtrArray {
   }
 
 private:
+  // Any of the reduced broadcasts, e.g. a per-group scaling factor, may vary along L
+  CUTLASS_HOST_DEVICE bool
+  is_batched() const {
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < BroadcastCount; ++i) {
+      if (size<2>(params_ptr->dScalar[i]) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   CUTLASS_DEVICE void
   update_scalar(int l_coord = 0) {
     int l_offset = l_coord * size<2>(params_ptr->dScalar[0]);
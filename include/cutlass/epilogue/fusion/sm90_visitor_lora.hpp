@@ -0,0 +1,253 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree multi-LoRA expand fusion operation for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Multi-LoRA expand
+// Adds the low-rank update of the adapter selected by each row (token) to the visited values:
+//
+//   Z(m,n) + scale(i) * sum_r T(m,r) * B_i(r,n),  i = adapter_idx(m)
+//
+// where T = X * A_i is the (M, rank) shrunk intermediate, and B_i is the (rank, N) row-major expand
+// weight of adapter i at ptr_B + i * stride_adapter. Rows with a negative adapter index pass through.
+// The T rows and adapter indices of the CTA tile are staged in shared memory once per tile; the
+// B_i rows are read through L1, since every row of a tile may select a different adapter.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  int MaxRank,
+  class ElementLoRA,
+  class ElementCompute,
+  class ElementScale = float,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90MultiLoRAExpand {
+  static constexpr int CtaTileM = size<0>(CtaTileShapeMNK{});
+
+  struct SharedStorage {
+    array_aligned<ElementLoRA, CtaTileM * MaxRank> smem_T;
+    array_aligned<int32_t, CtaTileM> smem_adapter_idx;
+  };
+
+  struct Arguments {
+    ElementLoRA const* ptr_T = nullptr;             // (M, rank), nullptr disables the update
+    int64_t stride_T = MaxRank;                     // row stride of T
+    int32_t const* ptr_adapter_idx = nullptr;       // (M)
+    ElementLoRA const* ptr_B = nullptr;             // (num_adapters, rank, N)
+    int64_t stride_adapter = 0;
+    int64_t stride_B = 0;                           // row stride of each B_i
+    ElementScale const* ptr_scales = nullptr;       // (num_adapters), nullptr for a unit scale
+    int rank = MaxRank;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    return args.rank > 0 && args.rank <= MaxRank && L == 1 &&
+           (args.ptr_T == nullptr || (args.ptr_adapter_idx != nullptr && args.ptr_B != nullptr));
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90MultiLoRAExpand() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90MultiLoRAExpand(Params const& params, SharedStorage const& shared_storage)
+      : params(params),
+        smem_T(const_cast<ElementLoRA*>(shared_storage.smem_T.data())),
+        smem_adapter_idx(const_cast<int32_t*>(shared_storage.smem_adapter_idx.data())) { }
+
+  Params params;
+  ElementLoRA* smem_T = nullptr;
+  int32_t* smem_adapter_idx = nullptr;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params,
+                           ElementLoRA* smem_T, int32_t* smem_adapter_idx)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params),
+        smem_T(smem_T),
+        smem_adapter_idx(smem_adapter_idx) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+    ElementLoRA* smem_T;
+    int32_t* smem_adapter_idx;
+
+    CUTLASS_DEVICE void
+    begin() {
+      if (params.ptr_T == nullptr) {
+        return;
+      }
+      auto& [tCcD, tile_coord_mnkl, residue_cD, thread_idx, thread_count] = args_tuple;
+      int m_base = get<0>(tile_coord_mnkl) * CtaTileM;
+      int rows = cute::min(CtaTileM, static_cast<int>(get<0>(residue_cD)));
+
+      // Rows of the tile past the problem select no adapter
+      for (int row = thread_idx; row < CtaTileM; row += thread_count) {
+        smem_adapter_idx[row] = row < rows ? params.ptr_adapter_idx[m_base + row] : -1;
+      }
+      for (int i = thread_idx; i < rows * params.rank; i += thread_count) {
+        int row = i / params.rank;
+        int r = i - row * params.rank;
+        smem_T[row * MaxRank + r] = params.ptr_T[(m_base + row) * params.stride_T + r];
+      }
+    }
+
+    CUTLASS_DEVICE bool
+    begin_sync_needed() const {
+      return params.ptr_T != nullptr; // Ensure visibility of the staged T rows and adapter indices
+    }
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE Array<ElementCompute, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      Array<ElementCompute, FragmentSize> frg_output = convert_input(frg_input);
+      if (params.ptr_T == nullptr) {
+        return frg_output;
+      }
+
+      auto& [tCcD, tile_coord_mnkl, residue_cD, thread_idx, thread_count] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      int n_base = get<1>(tile_coord_mnkl) * size<1>(CtaTileShapeMNK{});
+
+      NumericConverter<ElementCompute, ElementLoRA> convert_lora{};
+      NumericConverter<ElementCompute, ElementScale> convert_scale{};
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+        if (not elem_less(thread_crd, residue_cD)) {
+          continue;
+        }
+        int row = get<0>(thread_crd);
+        int32_t adapter = smem_adapter_idx[row];
+        if (adapter < 0) {
+          continue;
+        }
+
+        ElementLoRA const* ptr_B = params.ptr_B + adapter * params.stride_adapter + n_base + get<1>(thread_crd);
+        ElementLoRA const* row_T = smem_T + row * MaxRank;
+        ElementCompute update = ElementCompute(0);
+        for (int r = 0; r < params.rank; ++r) {
+          update += convert_lora(row_T[r]) * convert_lora(ptr_B[r * params.stride_B]);
+        }
+        if (params.ptr_scales != nullptr) {
+          update *= convert_scale(params.ptr_scales[adapter]);
+        }
+        frg_output[i] += update;
+      }
+
+      return frg_output;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    int thread_count = static_cast<int>(size(args.tiled_copy));
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl, args.residue_cD, args.thread_idx, thread_count);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params, smem_T, smem_adapter_idx);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
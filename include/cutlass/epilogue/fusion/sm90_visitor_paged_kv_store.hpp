@@ -0,0 +1,236 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree paged FP8 KV-cache store for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Paged KV-cache store of a K (or fused KV) projection
+// Rows are tokens and columns are num_kv_heads heads of head_dim elements each, followed by
+// another num_kv_heads V heads when ptr_v_cache is given. Token m of sequence seq_idx(m) at
+// position pos(m) is written through the block table to
+//
+//   page = block_table[seq_idx(m) * stride_block_table + pos(m) / page_size]
+//   ptr  + page * stride_page + (pos(m) % page_size) * stride_slot + h * stride_head + d
+//
+// after dividing by the per-head scale (1 when the scale pointer is null) and converting to
+// ElementCache, e.g. float_e4m3_t. K and V pages share the block table, the page shape and the strides.
+// Rows with a negative sequence index (padding tokens) are not written. The visited values
+// pass through, so a non-void ElementD also writes the unquantized projection with the regular
+// D store, and a void ElementD writes the cache only.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementCache,
+  class ElementCompute,
+  class ElementScale = float,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90PagedKVCacheStore {
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementCache* ptr_k_cache = nullptr;
+    ElementCache* ptr_v_cache = nullptr;      // nullptr for a K-only (or V-only) projection
+    ElementScale const* ptr_k_scale = nullptr; // (num_kv_heads), nullptr for a unit scale
+    ElementScale const* ptr_v_scale = nullptr; // (num_kv_heads), nullptr for a unit scale
+    int32_t const* ptr_seq_idx = nullptr;     // (M) sequence of each token
+    int32_t const* ptr_positions = nullptr;   // (M) position of each token in its sequence
+    int32_t const* ptr_block_table = nullptr; // (num_seqs, max_pages_per_seq)
+    int64_t stride_block_table = 0;
+    int64_t stride_page = 0;
+    int64_t stride_slot = 0;
+    int64_t stride_head = 0;
+    int page_size = 16;
+    int head_dim = 128;
+    int num_kv_heads = 0;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    int num_heads = args.ptr_v_cache != nullptr ? 2 * args.num_kv_heads : args.num_kv_heads;
+    return N == num_heads * args.head_dim && L == 1 && args.page_size > 0 &&
+           args.ptr_k_cache != nullptr && args.ptr_seq_idx != nullptr &&
+           args.ptr_positions != nullptr && args.ptr_block_table != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90PagedKVCacheStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90PagedKVCacheStore(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCcD, tile_coord_mnkl, residue_tCcD] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+
+      NumericConverter<ElementCompute, ElementInput> convert_input{};
+      NumericConverter<ElementCompute, ElementScale> convert_scale{};
+      NumericConverter<ElementCache, ElementCompute, RoundStyle> convert_output{};
+
+      int const k_columns = params.num_kv_heads * params.head_dim;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+        if (not elem_less(thread_crd, residue_tCcD)) {
+          continue;
+        }
+        int row = get<0>(thread_crd) + m * tile_M;
+        int col = get<1>(thread_crd) + n * tile_N;
+
+        int32_t seq = params.ptr_seq_idx[row];
+        if (seq < 0) {
+          continue;
+        }
+        int32_t pos = params.ptr_positions[row];
+        int32_t page = params.ptr_block_table[seq * params.stride_block_table + pos / params.page_size];
+        int32_t slot = pos % params.page_size;
+
+        ElementCache* ptr_cache = params.ptr_k_cache;
+        ElementScale const* ptr_scale = params.ptr_k_scale;
+        if (col >= k_columns) {
+          ptr_cache = params.ptr_v_cache;
+          ptr_scale = params.ptr_v_scale;
+          col -= k_columns;
+        }
+
+        int head = col / params.head_dim;
+        int head_col = col - head * params.head_dim;
+        ElementCompute value = convert_input(frg_input[i]);
+        if (ptr_scale != nullptr) {
+          value = value / convert_scale(ptr_scale[head]);
+        }
+
+        int64_t offset = static_cast<int64_t>(page) * params.stride_page
+                       + static_cast<int64_t>(slot) * params.stride_slot
+                       + static_cast<int64_t>(head) * params.stride_head + head_col;
+        ptr_cache[offset] = convert_output(value);
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl, args.residue_cD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
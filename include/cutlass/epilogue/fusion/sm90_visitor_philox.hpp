@@ -0,0 +1,489 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+/*! \file
+  \brief Visitor tree dropout and stochastic rounding operations driven by a counter-based Philox RNG
+         for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Philox4x32-10 counter-based RNG (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3")
+// Returns the four 32b random words of the given 128b counter under the given 64b key.
+CUTLASS_HOST_DEVICE
+uint4
+philox4x32_10(uint4 ctr, uint2 key) {
+  constexpr uint32_t M0 = 0xD2511F53u;
+  constexpr uint32_t M1 = 0xCD9E8D57u;
+  constexpr uint32_t W0 = 0x9E3779B9u;
+  constexpr uint32_t W1 = 0xBB67AE85u;
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int round = 0; round < 10; ++round) {
+#if defined(__CUDA_ARCH__)
+    uint32_t hi0 = __umulhi(M0, ctr.x);
+    uint32_t hi1 = __umulhi(M1, ctr.z);
+#else
+    uint32_t hi0 = static_cast<uint32_t>((uint64_t(M0) * ctr.x) >> 32);
+    uint32_t hi1 = static_cast<uint32_t>((uint64_t(M1) * ctr.z) >> 32);
+#endif
+    uint32_t lo0 = M0 * ctr.x;
+    uint32_t lo1 = M1 * ctr.z;
+    ctr = make_uint4(hi1 ^ ctr.y ^ key.x, lo1, hi0 ^ ctr.w ^ key.y, lo0);
+    key.x += W0;
+    key.y += W1;
+  }
+  return ctr;
+}
+
+// Random word of element (m,n,l) in the given subsequence.
+// Consecutive groups of 4 columns share one Philox block, the last group is cached by the caller.
+struct PhiloxElementRng {
+  uint2 key;
+  uint32_t offset;
+  uint32_t subsequence;
+
+  int64_t cached_group = -1;
+  int cached_m = -1;
+  int cached_l = -1;
+  uint4 cached_block;
+
+  CUTLASS_HOST_DEVICE
+  uint32_t operator()(int m, int n, int l) {
+    int64_t group = n >> 2;
+    if (group != cached_group || m != cached_m || l != cached_l) {
+      uint4 ctr = make_uint4(static_cast<uint32_t>(group), static_cast<uint32_t>(m),
+                             (static_cast<uint32_t>(l) << 1) | subsequence, offset);
+      cached_block = philox4x32_10(ctr, key);
+      cached_group = group;
+      cached_m = m;
+      cached_l = l;
+    }
+    switch (n & 3) {
+      case 0:  return cached_block.x;
+      case 1:  return cached_block.y;
+      case 2:  return cached_block.z;
+      default: return cached_block.w;
+    }
+  }
+};
+
+// Rounds x to one of the two values of T bracketing it, rounding away from the nearest
+// with probability equal to the distance to it in units of the bracket width.
+// Applies to the sign-magnitude float types: half_t, bfloat16_t, float_e4m3_t and float_e5m2_t.
+template <class T>
+CUTLASS_HOST_DEVICE
+T
+stochastic_round(float x, uint32_t rand) {
+  using Storage = cute::uint_bit_t<sizeof_bits_v<T>>;
+  constexpr Storage SignMask = Storage(1) << (sizeof_bits_v<T> - 1);
+
+  auto is_finite = [](float f) {
+#if defined(__CUDA_ARCH__)
+    return ::isfinite(f);
+#else
+    return std::isfinite(f);
+#endif
+  };
+
+  T nearest = NumericConverter<T, float, FloatRoundStyle::round_to_nearest>::convert(x);
+  float nearest_f = float(nearest);
+  float error = x - nearest_f;
+  if (error == 0.f || not is_finite(nearest_f)) {
+    return nearest;
+  }
+
+  // Step the magnitude toward x, zero steps to the smallest denorm of the sign of x
+  Storage bits = nearest.raw();
+  Storage neighbor_bits;
+  if ((bits & ~SignMask) == 0) {
+    neighbor_bits = Storage((x < 0.f ? SignMask : 0) | 1);
+  }
+  else {
+    bool away_from_zero = (error > 0.f) == (nearest_f > 0.f);
+    neighbor_bits = away_from_zero ? Storage(bits + 1) : Storage(bits - 1);
+  }
+  T neighbor = T::bitcast(neighbor_bits);
+  float neighbor_f = float(neighbor);
+  if (not is_finite(neighbor_f)) {
+    return nearest;
+  }
+
+  // 24b uniform in [0,1)
+  float u = float(rand >> 8) * (1.f / 16777216.f);
+  return u * fabsf(neighbor_f - nearest_f) < fabsf(error) ? neighbor : nearest;
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Dropout
+// Zeroes each visited value with probability p and scales the kept ones by 1 / (1 - p).
+// The keep decision of element (m,n,l) is drawn from Philox(seed) at counter (n/4, m, 2l, offset),
+// so it is reproducible from (seed, offset) alone, e.g. to regenerate it in the backward pass.
+// Optionally stores the keep mask packed as 32 columns per word, (M, ceil(N/32), L) row-major.
+// The mask is zeroed by initialize_workspace and filled with atomicOr, so reruns are idempotent.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementCompute
+>
+struct Sm90Dropout {
+  struct SharedStorage { };
+
+  struct Arguments {
+    uint64_t seed = 0;
+    uint32_t offset = 0;                // e.g. the training step, advanced by the user
+    float dropout_probability = 0.f;    // 0 disables dropout
+    uint32_t* ptr_mask = nullptr;       // optional packed keep mask
+    int64_t ld_mask = 0;                // words per row, at least ceil(N/32)
+    int64_t batch_stride_mask = 0;      // words per batch
+  };
+
+  struct Params {
+    uint2 key = {0, 0};
+    uint32_t offset = 0;
+    uint32_t threshold = 0;             // drop if rand < threshold
+    float scale = 1.f;
+    uint32_t* ptr_mask = nullptr;
+    int64_t ld_mask = 0;
+    int64_t batch_stride_mask = 0;
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    double p = static_cast<double>(args.dropout_probability);
+    uint32_t threshold = static_cast<uint32_t>(cute::min(p * 4294967296.0, 4294967295.0));
+    return {
+      make_uint2(static_cast<uint32_t>(args.seed), static_cast<uint32_t>(args.seed >> 32)),
+      args.offset,
+      threshold,
+      p < 1.0 ? static_cast<float>(1.0 / (1.0 - p)) : 0.f,
+      args.ptr_mask,
+      args.ld_mask,
+      args.batch_stride_mask
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    bool mask_ok = args.ptr_mask == nullptr ||
+      (args.ld_mask >= ceil_div(int64_t(N), int64_t(32)) && (L == 1 || args.batch_stride_mask >= M * args.ld_mask));
+    return args.dropout_probability >= 0.f && args.dropout_probability <= 1.f && mask_ok;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    if (args.ptr_mask == nullptr) {
+      return Status::kSuccess;
+    }
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    size_t mask_words = size_t(L - 1) * args.batch_stride_mask + size_t(M) * args.ld_mask;
+    return zero_workspace(args.ptr_mask, mask_words * sizeof(uint32_t), stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90Dropout() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90Dropout(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE Array<ElementCompute, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize>;
+      ConvertInput convert_input{};
+      Array<ElementCompute, FragmentSize> frg_output = convert_input(frg_input);
+      if (params.threshold == 0 && params.ptr_mask == nullptr) {
+        return frg_output;
+      }
+
+      auto& [tCcD, tile_coord_mnkl, residue_cD] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      auto [m, n, k, l] = tile_coord_mnkl;
+      int m_base = m * size<0>(CtaTileShapeMNK{});
+      int n_base = n * size<1>(CtaTileShapeMNK{});
+
+      detail::PhiloxElementRng rng{params.key, params.offset, 0};
+      int64_t mask_word = -1;
+      uint32_t mask_bits = 0;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+        int row = m_base + get<0>(thread_crd);
+        int col = n_base + get<1>(thread_crd);
+        bool keep = rng(row, col, static_cast<int>(l)) >= params.threshold;
+        frg_output[i] = keep ? frg_output[i] * params.scale : ElementCompute(0);
+
+        // Gather the keep bits of each mask word before flushing them with a single atomic
+        if (params.ptr_mask != nullptr && elem_less(thread_crd, residue_cD)) {
+          int64_t word = l * params.batch_stride_mask + row * params.ld_mask + (col >> 5);
+          if (word != mask_word) {
+            if (mask_bits != 0) {
+              atomicOr(params.ptr_mask + mask_word, mask_bits);
+            }
+            mask_word = word;
+            mask_bits = 0;
+          }
+          mask_bits |= uint32_t(keep) << (col & 31);
+        }
+      }
+      if (mask_bits != 0) {
+        atomicOr(params.ptr_mask + mask_word, mask_bits);
+      }
+
+      return frg_output;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl, args.residue_cD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Stochastic rounding
+// Converts the visited values to ElementOutput, rounding each to one of the two bracketing values
+// with probability proportional to its proximity, which keeps small updates unbiased in expectation.
+// Element (m,n,l) draws from Philox(seed) at counter (n/4, m, 2l+1, offset), a subsequence disjoint
+// from that of Sm90Dropout, so both may share one seed. ElementOutput is a 16b or 8b float type.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute
+>
+struct Sm90StochasticRound {
+  static_assert(cute::is_same_v<ElementOutput, cutlass::half_t> || cute::is_same_v<ElementOutput, cutlass::bfloat16_t> ||
+                cute::is_same_v<ElementOutput, cutlass::float_e4m3_t> || cute::is_same_v<ElementOutput, cutlass::float_e5m2_t>,
+                "Stochastic rounding requires a half, bfloat16, e4m3 or e5m2 output.");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    uint64_t seed = 0;
+    uint32_t offset = 0;
+    bool enable = true;                 // false rounds to nearest
+  };
+
+  struct Params {
+    uint2 key = {0, 0};
+    uint32_t offset = 0;
+    bool enable = true;
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return {
+      make_uint2(static_cast<uint32_t>(args.seed), static_cast<uint32_t>(args.seed >> 32)),
+      args.offset,
+      args.enable
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90StochasticRound() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90StochasticRound(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE Array<ElementOutput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      using ConvertInput = NumericArrayConverter<float, ElementInput, FragmentSize>;
+      ConvertInput convert_input{};
+      Array<float, FragmentSize> frg_f32 = convert_input(frg_input);
+      if (not params.enable) {
+        NumericArrayConverter<ElementOutput, float, FragmentSize> convert_output{};
+        return convert_output(frg_f32);
+      }
+
+      auto& [tCcD, tile_coord_mnkl] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      auto [m, n, k, l] = tile_coord_mnkl;
+      int m_base = m * size<0>(CtaTileShapeMNK{});
+      int n_base = n * size<1>(CtaTileShapeMNK{});
+
+      detail::PhiloxElementRng rng{params.key, params.offset, 1};
+      Array<ElementOutput, FragmentSize> frg_output;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+        uint32_t rand = rng(m_base + get<0>(thread_crd), n_base + get<1>(thread_crd), static_cast<int>(l));
+        frg_output[i] = detail::stochastic_round<ElementOutput>(frg_f32[i], rand);
+      }
+
+      return frg_output;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
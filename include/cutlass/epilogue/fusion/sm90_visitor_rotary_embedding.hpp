@@ -0,0 +1,391 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree rotary position embedding and QKV split fusion operations for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Rotary position embedding (RoPE) of a fused QKV projection
+// Rotates the pairs of adjacent columns (x[2i], x[2i+1]) of the first rotary_dim columns of every
+// head in the leading num_rotary_heads heads (the Q and K heads):
+//
+//   y[2i]   = x[2i] * cos(pos, i) - x[2i+1] * sin(pos, i)
+//   y[2i+1] = x[2i] * sin(pos, i) + x[2i+1] * cos(pos, i)
+//
+// where pos is the position id of the row (token) and cos / sin are (max_position, rotary_dim / 2)
+// tables. Models that rotate the two halves of a head instead (GPT-NeoX style) use this node after
+// permuting the rows of their Q and K projection weights so that each rotated pair is adjacent.
+//
+//   Assumptions:
+//     1. Each pair of adjacent columns is held by consecutive elements of the same fragment, which
+//        holds for GMMA accumulators.
+//     2. head_dim and rotary_dim are even.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementCompute,
+  class ElementTable = float,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90RotaryEmbedding {
+  static_assert(FragmentSize % 2 == 0, "Rotated column pairs must not straddle fragments.");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    int32_t const* ptr_position_ids = nullptr;  // (M), nullptr uses the row index as position
+    ElementTable const* ptr_cos = nullptr;      // (max_position, rotary_dim / 2)
+    ElementTable const* ptr_sin = nullptr;      // (max_position, rotary_dim / 2)
+    int64_t table_stride = 0;                   // Row stride of the tables, 0 selects rotary_dim / 2
+    int head_dim = 128;
+    int rotary_dim = 128;
+    int num_rotary_heads = 0;                   // Number of leading heads to rotate (Q + K heads)
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    Params params = args;
+    if (params.table_stride == 0) {
+      params.table_stride = args.rotary_dim / 2;
+    }
+    return params;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.head_dim % 2 == 0 && args.rotary_dim % 2 == 0 && args.rotary_dim <= args.head_dim;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90RotaryEmbedding() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90RotaryEmbedding(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCcD, tile_coord_mnkl, residue_tCcD] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Array frg_I = convert_input(frg_input);
+      int const rotary_columns = params.num_rotary_heads * params.head_dim;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; i += 2) {
+        auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+        int col = get<1>(thread_crd) + n * tile_N;
+        int head_col = col % params.head_dim;
+        if (elem_less(thread_crd, residue_tCcD) && col < rotary_columns && head_col < params.rotary_dim) {
+          int row = get<0>(thread_crd) + m * tile_M;
+          int64_t pos = params.ptr_position_ids != nullptr ? params.ptr_position_ids[row] : row;
+          int64_t table_idx = pos * params.table_stride + head_col / 2;
+          ElementCompute cos_v = static_cast<ElementCompute>(params.ptr_cos[table_idx]);
+          ElementCompute sin_v = static_cast<ElementCompute>(params.ptr_sin[table_idx]);
+          ElementCompute x0 = frg_I[i];
+          ElementCompute x1 = frg_I[i + 1];
+          frg_I[i]     = x0 * cos_v - x1 * sin_v;
+          frg_I[i + 1] = x0 * sin_v + x1 * cos_v;
+        }
+      }
+
+      return frg_I;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl, args.residue_cD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// QKV split store
+// Scatters the columns of a fused QKV projection into three separately strided head-major outputs.
+// Column n belongs to Q for n < num_q_heads * head_dim, then to K and V with num_kv_heads heads each.
+// Element d of head h of row m is written to
+//
+//   ptr + m * stride_token + h * stride_head + d
+//
+// or, when slot_mapping is given (e.g. for a paged KV cache), with slot = slot_mapping[m] to
+//
+//   ptr + (slot / block_size) * stride_block + (slot % block_size) * stride_token + h * stride_head + d
+//
+// Rows with a negative slot (padding tokens) are not written. The visited values pass through,
+// so the regular D store is normally disabled by a void ElementD.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90QKVSplitStore {
+
+  struct SharedStorage { };
+
+  struct OutputArguments {
+    ElementOutput* ptr = nullptr;
+    int64_t stride_token = 0;
+    int64_t stride_head = 0;
+    int64_t stride_block = 0;               // Paged output only
+    int32_t const* slot_mapping = nullptr;  // (M), nullptr writes row m to token m
+    int block_size = 1;                     // Paged output only
+  };
+
+  struct Arguments {
+    OutputArguments q;
+    OutputArguments k;
+    OutputArguments v;
+    int head_dim = 128;
+    int num_q_heads = 0;
+    int num_kv_heads = 0;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    return N == (args.num_q_heads + 2 * args.num_kv_heads) * args.head_dim && L == 1;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90QKVSplitStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90QKVSplitStore(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCcD, tile_coord_mnkl, residue_tCcD] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+
+      using ConvertInput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Array frg_O = convert_input(frg_input);
+      int const q_columns = params.num_q_heads * params.head_dim;
+      int const kv_columns = params.num_kv_heads * params.head_dim;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+        if (not elem_less(thread_crd, residue_tCcD)) {
+          continue;
+        }
+        int row = get<0>(thread_crd) + m * tile_M;
+        int col = get<1>(thread_crd) + n * tile_N;
+
+        OutputArguments const* output = &params.q;
+        if (col >= q_columns + kv_columns) {
+          output = &params.v;
+          col -= q_columns + kv_columns;
+        }
+        else if (col >= q_columns) {
+          output = &params.k;
+          col -= q_columns;
+        }
+        if (output->ptr == nullptr) {
+          continue;
+        }
+
+        int head = col / params.head_dim;
+        int head_col = col - head * params.head_dim;
+        int64_t offset = static_cast<int64_t>(head) * output->stride_head + head_col;
+        if (output->slot_mapping != nullptr) {
+          int32_t slot = output->slot_mapping[row];
+          if (slot < 0) {
+            continue;
+          }
+          offset += static_cast<int64_t>(slot / output->block_size) * output->stride_block
+                  + static_cast<int64_t>(slot % output->block_size) * output->stride_token;
+        }
+        else {
+          offset += static_cast<int64_t>(row) * output->stride_token;
+        }
+        output->ptr[offset] = frg_O[i];
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl, args.residue_cD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,341 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree per-row / 1xN-block dynamic quantization fusion operation for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Per-row (per-token) or 1xN-block dynamic quantization
+// Computes the absolute maximum of every row segment of QuantBlockN columns, writes the scale
+// factor amax / max(ElementOutput) for each segment and divides the segment by it, so that the
+// output can be converted to a narrow type (e.g. FP8) without a separate amax + quantize pass.
+//
+//   Scale factor tensor: (M, ceil_div(N, QuantBlockN), L), strided by StrideScale.
+//
+//   Assumptions:
+//     1. QuantBlockN divides EPI_N (a block is fully visited within one epilogue tile, because
+//        we can reduce and revisit one epilogue tile at a time.)
+//     2. QuantBlockN == 0 selects one scale factor per row, which requires
+//        CTA_N >= N and EPI_N >= N (single tile across N).
+//     3. All lanes of a warp that hold part of a row hold the same QuantBlockN-aligned block
+//        of it, which holds for GMMA accumulators whenever QuantBlockN is a multiple of 8.
+//
+template <
+  int QuantBlockN,
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScale = float,
+  class StrideScale = Stride<_1,int64_t,int64_t>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90RowBlockScaleQuantization {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Fused row/block quantization requires FP32 compute.");
+  static_assert(QuantBlockN >= 0 && QuantBlockN % 8 == 0, "QuantBlockN must be 0 or a multiple of 8.");
+
+  static constexpr int EpiN = size<1>(EpilogueTile{});
+  static constexpr int BlockN = QuantBlockN == 0 ? EpiN : QuantBlockN;
+  static constexpr int BlocksPerEpiN = EpiN / BlockN;
+  static_assert(EpiN % BlockN == 0, "QuantBlockN must divide the epilogue tile N.");
+
+  // Running absolute maximum of each block of a row held by this thread in the current epilogue tile
+  using BlockAmax = Array<ElementCompute, BlocksPerEpiN>;
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementScale* ptr_scale = nullptr;
+    StrideScale dScale = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if constexpr (QuantBlockN == 0) {
+      auto [M, N, K, L] = problem_shape;
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+      // Cross CTA reduction is not possible because there is no guarantee that all CTAs run
+      // concurrently, and the scale must be final before the epilogue tile is stored.
+      return N <= tile_N && N <= EpiN;
+    }
+    else {
+      return true;
+    }
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90RowBlockScaleQuantization() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90RowBlockScaleQuantization(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCrAmax, mScale, tCcD, cD, lane_layout_MN,
+              tile_coord_mnkl, residue_cD] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      maximum_absolute_value_reduction<ElementCompute, true> amax_op{};
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+        if (elem_less(thread_crd, residue_cD)) {
+          int block = (get<1>(thread_crd) / BlockN) % BlocksPerEpiN;
+          BlockAmax& tCrAmax_vmn = tCrAmax(epi_v * FragmentSize + i);
+          tCrAmax_vmn[block] = amax_op(tCrAmax_vmn[block], frg_I[i]);
+        }
+      }
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+
+      auto& [tCrAmax, mScale, tCcD, cD, lane_layout_MN,
+              tile_coord_mnkl, residue_cD] = args_tuple;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cD(_0{},_0{}), residue_cD)) {
+        return;
+      }
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+
+      // `tCrAmax` has 0-strides along modes that correspond to N, so that all fragment elements
+      // of a row map to the same per-block maxima. Reduce over its co-domain.
+      auto tCrAmax_f = filter(tCrAmax);
+
+      //
+      // 1. Butterfly reduction of the block maxima across the lanes sharing a row
+      //
+      maximum<ElementCompute, true> max_op{};
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 1; j < size<1>(lane_layout_MN); j *= 2) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrAmax_f); ++i) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int b = 0; b < BlocksPerEpiN; ++b) {
+            ElementCompute synced = __shfl_xor_sync(0xFFFFFFFF, tCrAmax_f(i)[b], lane_layout_MN(_0{},j));
+            tCrAmax_f(i)[b] = max_op(tCrAmax_f(i)[b], synced);
+          }
+        }
+      }
+
+      //
+      // 2. Emit scale factors and quantize the visited results
+      //
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+      ElementCompute const QuantMax = static_cast<ElementCompute>(
+          cutlass::platform::numeric_limits<ElementOutput>::max());
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
+        auto& visit_frag = visit_results(epi_v);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+          int block = (get<1>(thread_crd) / BlockN) % BlocksPerEpiN;
+          ElementCompute amax = tCrAmax(epi_v * FragmentSize + i)[block];
+          ElementCompute scale = amax / QuantMax;
+          ElementCompute inv_scale = amax > ElementCompute(0) ? QuantMax / amax : ElementCompute(1);
+
+          // The owner of the first column of each block writes its scale factor
+          if (params.ptr_scale != nullptr &&
+              get<1>(thread_crd) % BlockN == 0 && elem_less(thread_crd, residue_cD)) {
+            int row = get<0>(thread_crd) + m * tile_M;
+            int col = get<1>(thread_crd) + n * tile_N;
+            mScale(row, col / BlockN, l) = static_cast<ElementScale>(scale);
+          }
+
+          visit_frag[i] = cutlass::platform::min(QuantMax,
+              cutlass::platform::max(-QuantMax, visit_frag[i] * inv_scale));
+        }
+      }
+    }
+
+    CUTLASS_DEVICE void
+    end_loop(int epi_m, int epi_n) {
+      auto& [tCrAmax, mScale, tCcD, cD, lane_layout_MN,
+              tile_coord_mnkl, residue_cD] = args_tuple;
+
+      // Reset block maxima for the next epilogue tile
+      BlockAmax zero;
+      zero.fill(ElementCompute(0));
+      fill(tCrAmax, zero);
+    }
+
+    CUTLASS_DEVICE void
+    end() { }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      if constexpr (ReferenceSrc) { return get<0>(args.tiled_copy.get_layoutS_MN()); }
+      else                        { return get<0>(args.tiled_copy.get_layoutD_MN()); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+
+    // Get the MN layout of warps to determine smem reduction iterations
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+
+    // Make sure there's only one warp across N so we can use warp shuffle intrinsics for reduction.
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1);
+
+    // Reduction layout
+    //   Same column broadcast as Sm90TopKSoftmaxColReduction: N modes of the R2S accumulator
+    //   layout get 0-strides, so that every fragment element of a row maps to the same
+    //   per-thread block maxima. The block within the epilogue tile is picked from coordinates.
+    auto [M, N, K] = args.tile_shape_mnk;
+    auto thr_mma = args.tiled_mma.get_thread_slice(args.thread_idx);
+    auto gColReduce = make_tensor<ElementCompute>(
+        make_layout(make_shape(M, N), make_stride(_1{}, 0_c)));                                                // (M,N)
+    auto tCrColReduce = make_tensor_like<ElementCompute>(                                       // (FrgV, MMA_M, MMA_N)
+        thr_mma.partition_C(gColReduce).layout());
+
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor tRS_rColReduce = thread_r2s.retile_S(tCrColReduce);                             // ((R2S,R2S_V),MMA_M,MMA_N)
+    auto tCrC_layout = args.tCrC.layout();                                                         // (R2S,R2S_M,R2S_N)
+    auto tCrAmax_layout = take<0, 3>(tRS_rColReduce.layout()).compose(tCrC_layout);  // (R2S,R2S_V) o (R2S,R2S_M,R2S_N)
+
+    Tensor tCrAmax = make_tensor<BlockAmax>(tCrAmax_layout);                                       // (R2S,R2S_M,R2S_N)
+    BlockAmax zero;
+    zero.fill(ElementCompute(0));
+    fill(tCrAmax, zero);
+
+    // Scale factor tensor
+    auto [problem_M, problem_N, problem_K, problem_L] = args.problem_shape_mnkl;
+    Tensor mScale = make_tensor(make_gmem_ptr(params.ptr_scale),
+        make_shape(problem_M, ceil_div(problem_N, BlockN), problem_L), params.dScale);       // (M,ceil(N/BlockN),L)
+
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(
+        cute::move(tCrAmax), mScale, tC_cD, args.cD, lane_layout_MN,
+        args.tile_coord_mnkl, args.residue_cD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,281 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree weighted row scatter-reduce store for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Weighted row scatter-reduce store, e.g. the un-permute and top-k combine of a MoE layer
+// Row m of batch (or group) l is scaled by weight(m,l) and atomically added to row dst_row(m,l) of
+// a (num_rows, N) row-major output:
+//
+//   out(dst_row(m,l), n) += weight(m,l) * Z(m,n,l)
+//
+// Rows with a negative destination (padding tokens) are not written. The output is not cleared,
+// so it must hold zeros (or a residual to accumulate into) before the kernel runs. Adjacent
+// column pairs held by one thread are reduced with a single vector red.global.add, the rest are
+// reduced element-wise. The visited values pass through, so the regular D store is normally
+// disabled by a void ElementD.
+//
+// Grouped GEMMs pass per-group index and weight arrays through ptr_dst_rows_array and
+// ptr_weights_array, otherwise ptr_dst_rows and ptr_weights are indexed with (m,l) strides (_1,batch_stride).
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementWeight = float,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90RowScatterReduce {
+  static_assert(cute::is_same_v<ElementOutput, float> ||
+                cute::is_same_v<ElementOutput, half_t> ||
+                cute::is_same_v<ElementOutput, bfloat16_t>,
+      "Scatter-reduce requires a float, half_t or bfloat16_t output.");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_out = nullptr;                       // (num_rows, N), accumulated into
+    int64_t stride_out = 0;                                 // Row stride of the output
+    int32_t const* ptr_dst_rows = nullptr;                  // (M,L)
+    ElementWeight const* ptr_weights = nullptr;             // (M,L), nullptr uses unit weights
+    int64_t batch_stride = 0;                               // L stride of ptr_dst_rows and ptr_weights
+    int32_t const* const* ptr_dst_rows_array = nullptr;     // Per-group (M), overrides ptr_dst_rows
+    ElementWeight const* const* ptr_weights_array = nullptr;// Per-group (M), overrides ptr_weights
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    // Vector reductions require every even column to start a pair aligned to its size
+    return args.ptr_out != nullptr && args.stride_out % 2 == 0 &&
+           (args.ptr_dst_rows != nullptr || args.ptr_dst_rows_array != nullptr);
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90RowScatterReduce() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90RowScatterReduce(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCcD, tile_coord_mnkl, residue_tCcD, dst_rows, weights] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementCompute, 2, RoundStyle>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+
+      Array frg_I = convert_input(frg_input);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; i += 2) {
+        auto crd0 = tCcD_mn(epi_v * FragmentSize + i);
+        bool pred0 = elem_less(crd0, residue_tCcD);
+        bool pred1 = false;
+        bool is_pair = false;
+        if (i + 1 < FragmentSize) {
+          auto crd1 = tCcD_mn(epi_v * FragmentSize + i + 1);
+          pred1 = elem_less(crd1, residue_tCcD);
+          is_pair = get<0>(crd1) == get<0>(crd0) && get<1>(crd1) == get<1>(crd0) + 1 && get<1>(crd0) % 2 == 0;
+        }
+        if (not pred0 && not pred1) {
+          continue;
+        }
+
+        Array<ElementCompute, 2> values;
+        values[0] = frg_I[i];
+        values[1] = i + 1 < FragmentSize ? frg_I[i + 1] : ElementCompute(0);
+
+        if (is_pair && pred0 && pred1) {
+          int row = get<0>(crd0) + m * tile_M;
+          int32_t dst_row = dst_rows[row];
+          if (dst_row < 0) {
+            continue;
+          }
+          if (weights != nullptr) {
+            ElementCompute weight = static_cast<ElementCompute>(weights[row]);
+            values[0] = weight * values[0];
+            values[1] = weight * values[1];
+          }
+          int col = get<1>(crd0) + n * tile_N;
+          auto* ptr = reinterpret_cast<Array<ElementOutput, 2>*>(
+            params.ptr_out + static_cast<int64_t>(dst_row) * params.stride_out + col);
+          atomic_add<Array<ElementOutput, 2>>{}(ptr, convert_output(values));
+        }
+        else {
+          // Unpaired elements are reduced one at a time
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < 2; ++j) {
+            if (i + j >= FragmentSize) {
+              continue;
+            }
+            auto crd = tCcD_mn(epi_v * FragmentSize + i + j);
+            if (not elem_less(crd, residue_tCcD)) {
+              continue;
+            }
+            int row = get<0>(crd) + m * tile_M;
+            int32_t dst_row = dst_rows[row];
+            if (dst_row < 0) {
+              continue;
+            }
+            ElementCompute value = values[j];
+            if (weights != nullptr) {
+              value = static_cast<ElementCompute>(weights[row]) * value;
+            }
+            int col = get<1>(crd) + n * tile_N;
+            reduce_element(params.ptr_out + static_cast<int64_t>(dst_row) * params.stride_out + col, value);
+          }
+        }
+      }
+
+      return frg_input;
+    }
+
+  private:
+    // 16b types have no scalar red.global.add, so they are reduced as a pair with a zero neighbour
+    CUTLASS_DEVICE void
+    reduce_element(ElementOutput* ptr, ElementCompute value) {
+      if constexpr (cute::is_same_v<ElementOutput, float>) {
+        atomic_add<float>{}(ptr, static_cast<float>(value));
+      }
+      else {
+        bool is_odd = (reinterpret_cast<uintptr_t>(ptr) / sizeof(ElementOutput)) % 2;
+        Array<ElementCompute, 2> values;
+        values[0] = is_odd ? ElementCompute(0) : value;
+        values[1] = is_odd ? value : ElementCompute(0);
+        NumericArrayConverter<ElementOutput, ElementCompute, 2, RoundStyle> convert_output{};
+        atomic_add<Array<ElementOutput, 2>>{}(reinterpret_cast<Array<ElementOutput, 2>*>(ptr - is_odd), convert_output(values));
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    int32_t const* dst_rows = params.ptr_dst_rows_array != nullptr
+      ? params.ptr_dst_rows_array[l]
+      : params.ptr_dst_rows + l * params.batch_stride;
+    ElementWeight const* weights = params.ptr_weights_array != nullptr
+      ? params.ptr_weights_array[l]
+      : (params.ptr_weights != nullptr ? params.ptr_weights + l * params.batch_stride : nullptr);
+
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl, args.residue_cD, dst_rows, weights);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,233 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree sparse output (SDDMM) store for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Sparse output store of a sampled dense-dense matmul (SDDMM)
+// Writes the visited values at the non-zeros of a BSR pattern with block_m x block_n blocks to the
+// compact values array of the pattern, and drops all other elements:
+//
+//   j = position of block column n / block_n in block row m / block_m, i.e. in the sorted
+//       ptr_block_col_indices[ptr_block_row_offsets[m / block_m] .. ptr_block_row_offsets[m / block_m + 1])
+//   ptr_values[l * batch_stride_values + j * block_m * block_n + (m % block_m) * block_n + n % block_n]
+//
+// Blocks are stored row-major. A CSR pattern is the BSR pattern with 1x1 blocks, whose values array
+// is the CSR values array. The visited values pass through, so the node can sit on top of any fused
+// computation (scaling, exponentiation, ...), and a void ElementD writes the sparse output only.
+// Pair with the SparseOutputScheduler to skip the output tiles without non-zeros.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90SparseOutputStore {
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_values = nullptr;              // (nnz_blocks * block_m * block_n, L)
+    int32_t const* ptr_block_row_offsets = nullptr;   // (ceil(M / block_m) + 1)
+    int32_t const* ptr_block_col_indices = nullptr;   // (nnz_blocks), sorted within each block row
+    int block_m = 1;
+    int block_n = 1;
+    int64_t batch_stride_values = 0;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.block_m > 0 && args.block_n > 0 && args.ptr_values != nullptr &&
+           args.ptr_block_row_offsets != nullptr && args.ptr_block_col_indices != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90SparseOutputStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90SparseOutputStore(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    // Position of block column block_col within block row block_row, -1 if the block is empty
+    CUTLASS_DEVICE int32_t
+    find_block(int block_row, int block_col) const {
+      int32_t lo = params.ptr_block_row_offsets[block_row];
+      int32_t hi = params.ptr_block_row_offsets[block_row + 1];
+      while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        int32_t col = params.ptr_block_col_indices[mid];
+        if (col == block_col) {
+          return mid;
+        }
+        if (col < block_col) {
+          lo = mid + 1;
+        }
+        else {
+          hi = mid;
+        }
+      }
+      return -1;
+    }
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCcD, tile_coord_mnkl, residue_tCcD] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+
+      NumericConverter<ElementOutput, ElementInput, RoundStyle> convert_output{};
+      ElementOutput* ptr_values = params.ptr_values + l * params.batch_stride_values;
+      int64_t block_size = static_cast<int64_t>(params.block_m) * params.block_n;
+
+      // Neighbouring elements of a fragment mostly fall in the same block, so the last lookup is reused
+      int cached_block_row = -1;
+      int cached_block_col = -1;
+      int32_t cached_block = -1;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcD_mn(epi_v * FragmentSize + i);
+        if (not elem_less(thread_crd, residue_tCcD)) {
+          continue;
+        }
+        int row = get<0>(thread_crd) + m * tile_M;
+        int col = get<1>(thread_crd) + n * tile_N;
+        int block_row = row / params.block_m;
+        int block_col = col / params.block_n;
+        if (block_row != cached_block_row || block_col != cached_block_col) {
+          cached_block_row = block_row;
+          cached_block_col = block_col;
+          cached_block = find_block(block_row, block_col);
+        }
+        if (cached_block < 0) {
+          continue;
+        }
+
+        int64_t offset = cached_block * block_size
+                       + static_cast<int64_t>(row - block_row * params.block_m) * params.block_n
+                       + (col - block_col * params.block_n);
+        ptr_values[offset] = convert_output(frg_input[i]);
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(tC_cD, args.tile_coord_mnkl, args.residue_cD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -471,7 +471,22 @@ struct Sm90AuxStore<
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+// Grouped and ptr-array problem shapes wrap the problem shape of each group or batch
+template <class ProblemShape, class = void>
+struct is_ptr_array_problem_shape : cute::false_type {};
+
+template <class ProblemShape>
+struct is_ptr_array_problem_shape<ProblemShape, cute::void_t<typename ProblemShape::UnderlyingProblemShape>>
+    : cute::true_type {};
+
+} // namespace detail
+
 // Scalar reduction
+//
+// The L-mode of the scalar stride indexes the batch, or the group of a grouped GEMM, so that
+// e.g. a ptr-array epilogue may reduce one amax per group.
 template <
   template <class> class RegReduceFn,
   template <class> class GmemReduceFn,
@@ -523,9 +538,21 @@ public:
     CudaHostAdapter* cuda_adapter = nullptr) {
   #if !defined(CUTLASS_SKIP_REDUCTION_INIT)
     if constexpr (IsAtomic) {
-      auto problem_shape_mnkl = append<4>(problem_shape, 1);
-      auto [M, N, K, L] = problem_shape_mnkl;
-      Layout mScalar_layout = make_layout(make_shape(M,N,L), args.dScalar);
+      int L = 1;
+      if constexpr (detail::is_ptr_array_problem_shape<ProblemShape>::value) {
+        // One scalar per group, or per batch of a ptr-array GEMM. The underlying shape only
+        // contributes its batch count, so device-resident group shapes are not read.
+        auto group_shape_mnkl = append<4>(typename ProblemShape::UnderlyingProblemShape{}, 1);
+        if (problem_shape.groups() == 1) {
+          group_shape_mnkl = append<4>(problem_shape.get_host_problem_shape(0), 1);
+        }
+        L = problem_shape.groups() * int(get<3>(group_shape_mnkl));
+      }
+      else {
+        auto problem_shape_mnkl = append<4>(problem_shape, 1);
+        L = int(get<3>(problem_shape_mnkl));
+      }
+      Layout mScalar_layout = make_layout(make_shape(1,1,L), args.dScalar);
       if (args.ptr_scalar != nullptr) {
         return fill_workspace(args.ptr_scalar, ElementOutput(args.reduction_identity), cosize(mScalar_layout), stream, cuda_adapter);
       }
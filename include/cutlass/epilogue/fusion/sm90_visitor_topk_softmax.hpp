@@ -30,7 +30,7 @@
  **************************************************************************************************/
 
 /*! \file
-  \brief Visitor tree Top-K + Softmax fusion operation for sm90 TMA warp-specialized epilogue
+  \brief Visitor tree Top-K + Softmax and Top-K reduction fusion operations for sm90 TMA warp-specialized epilogue
 */
 
 #pragma once
@@ -754,6 +754,414 @@ public:
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Top-K reduction across columns, spanning any number of CTA tiles along N
+// Keeps a running top-K (values and column indices) per row across every N tile of the problem
+// and writes out only the (M,K,L) values and indices, so that wide rows such as language model
+// logits over a full vocabulary never have to be materialized in gmem.
+//
+//   Each CTA reduces its tile with warp shuffles, dumps its partial top-K to the workspace and
+//   increments a tile counter for its (m,l) row block. The last CTA to arrive merges the partial
+//   results of all N tiles in `end()`, the same way Sm90ColReduction does its final reduction.
+//
+//   Assumptions:
+//     1. Only one warp spans N in the epilogue tiled copy.
+//     2. Ties are broken towards the smaller column index, so results do not depend on the order
+//        in which CTAs arrive. Rows with fewer than K columns are padded with -inf and index -1.
+//     3. Visited values are passed through unchanged. Use a void ElementD to skip storing D.
+//
+
+namespace detail {
+
+// Descending order on (value, index) pairs, ties go to the smaller index.
+// Empty slots carry index -1, which compares as the largest unsigned index and always loses.
+template <typename Element>
+CUTLASS_DEVICE
+bool topk_indexed_greater(Element a, int32_t a_idx, Element b, int32_t b_idx) {
+  return a > b || (a == b && static_cast<uint32_t>(a_idx) < static_cast<uint32_t>(b_idx));
+}
+
+// Assumption: array elements are sorted in descending order
+// (a[0] is the largest element in a[].)
+template <typename Element, int N>
+CUTLASS_DEVICE
+void add_indexed_element_to_desc_sorted_array(
+    cutlass::Array<Element, N>& a, cutlass::Array<int32_t, N>& a_idx, Element b, int32_t b_idx) {
+  // Most elements of a wide row never make it into the top-K, so reject against the tail first
+  if (topk_indexed_greater(b, b_idx, a[N - 1], a_idx[N - 1])) {
+    a[N - 1] = b;
+    a_idx[N - 1] = b_idx;
+    CUTLASS_PRAGMA_UNROLL
+    for (int k = N - 1; k > 0; --k) {
+      if (topk_indexed_greater(a[k], a_idx[k], a[k - 1], a_idx[k - 1])) {
+        cutlass::swap(a[k], a[k - 1]);
+        cutlass::swap(a_idx[k], a_idx[k - 1]);
+      }
+    }
+  }
+}
+
+} // namespace detail
+
+template <
+  int TopK,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMKL = Stride<Int<TopK>,_1,int64_t> // (M,K,L) layout shared by the values and indices
+>
+struct Sm90TopKColReduction {
+private:
+  static_assert(TopK > 0, "Top-K reduction requires K > 0.");
+  static_assert(is_static_v<decltype(take<0,2>(StrideMKL{}))>); // batch stride can be dynamic or static
+
+  struct TopKResult {
+    Array<ElementCompute, TopK> top_k_;
+    Array<int32_t, TopK> indices_;
+
+    CUTLASS_DEVICE
+    TopKResult() {
+      top_k_.fill(-cutlass::platform::numeric_limits<ElementCompute>::infinity());
+      indices_.fill(-1);
+    }
+
+    CUTLASS_DEVICE
+    void add(ElementCompute value, int32_t index) {
+      detail::add_indexed_element_to_desc_sorted_array(top_k_, indices_, value, index);
+    }
+
+    CUTLASS_DEVICE
+    void merge(TopKResult const& other) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < TopK; ++i) {
+        add(other.top_k_[i], other.indices_[i]);
+      }
+    }
+
+    // Warp shuffle reduction
+    CUTLASS_DEVICE
+    void shuffle_down_sync(uint32_t delta) {
+      TopKResult synced_v;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < TopK; ++i) {
+        synced_v.top_k_[i] = __shfl_down_sync(0xFFFFFFFF, top_k_[i], delta);
+        synced_v.indices_[i] = __shfl_down_sync(0xFFFFFFFF, indices_[i], delta);
+      }
+      merge(synced_v);
+    }
+  };
+
+  // Workspace holds the partial top-K values of every CTA tile, then their indices,
+  // then one tile counter per (m,l) row block.
+  // Returns the byte offsets of the indices and the counters, and the total size.
+  template <class ProblemShape>
+  static auto
+  get_workspace_offsets(ProblemShape const& problem_shape) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    size_t num_partials = size_t(product(ceil_div(make_shape(M,N,L), make_shape(tile_M, tile_N)))) * tile_M * TopK;
+
+    size_t indices_offset = round_nearest(num_partials * sizeof(ElementCompute), MinWorkspaceAlignment);
+    size_t tile_counters_offset = round_nearest(indices_offset + num_partials * sizeof(int32_t), MinWorkspaceAlignment);
+    size_t workspace_size = tile_counters_offset + size_t(ceil_div(M, tile_M)) * L * sizeof(int);
+    return cute::make_tuple(indices_offset, tile_counters_offset, workspace_size);
+  }
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_values = nullptr;
+    int32_t* ptr_indices = nullptr;
+    StrideMKL dTopK = {};
+  };
+
+  struct Params {
+    ElementOutput* ptr_values = nullptr;
+    int32_t* ptr_indices = nullptr;
+    StrideMKL dTopK = {};
+    ElementCompute* value_buffer = nullptr;
+    int32_t* index_buffer = nullptr;
+    int* tile_counters = nullptr;
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    auto [indices_offset, tile_counters_offset, workspace_size] = get_workspace_offsets(problem_shape);
+    uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+
+    return {
+      args.ptr_values,
+      args.ptr_indices,
+      args.dTopK,
+      reinterpret_cast<ElementCompute*>(workspace_ptr),
+      reinterpret_cast<int32_t*>(workspace_ptr + indices_offset),
+      reinterpret_cast<int*>(workspace_ptr + tile_counters_offset)
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.ptr_values != nullptr || args.ptr_indices != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return get<2>(get_workspace_offsets(problem_shape));
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    auto [indices_offset, tile_counters_offset, workspace_size] = get_workspace_offsets(problem_shape);
+    int* tile_counters = reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(workspace) + tile_counters_offset);
+    return zero_workspace(tile_counters, workspace_size - tile_counters_offset, stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90TopKColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90TopKColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+    bool do_final_reduction = false;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCrTopK, tCcCol, cCol, gValues, gIndices, gBufValues_n, gBufIndices_n, tile_counter,
+              lane_layout_MN, lane_mn, tile_coord_mnkl, residue_cCol, tiled_copy, thread_idx] = args_tuple;
+      Tensor tCrTopK_mn = tCrTopK(_,_,_,epi_m,epi_n);
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+      int col_offset = get<1>(tile_coord_mnkl) * size<1>(CtaTileShapeMNK{});
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcCol_mn(epi_v * FragmentSize + i);
+        // Always predicate, OOB columns are not the reduction identity
+        if (elem_less(thread_crd, residue_cCol)) {
+          tCrTopK_mn(epi_v * FragmentSize + i).add(frg_I[i], col_offset + get<1>(thread_crd));
+        }
+      }
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (not is_last_iteration) {
+        return;
+      }
+
+      auto& [tCrTopK, tCcCol, cCol, gValues, gIndices, gBufValues_n, gBufIndices_n, tile_counter,
+              lane_layout_MN, lane_mn, tile_coord_mnkl, residue_cCol, tiled_copy, thread_idx] = args_tuple;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
+        return;
+      }
+
+      //
+      // 1. Warp shuffle reduction
+      //
+      // `tCrTopK` has 0-strides along the N modes, reduce over its co-domain
+      Tensor tCrTopK_f = filter(tCrTopK);
+      CUTLASS_PRAGMA_UNROLL
+      for (int reduction_cols = size<1>(lane_layout_MN) / 2; reduction_cols > 0; reduction_cols /= 2) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrTopK_f); ++i) {
+          tCrTopK_f(i).shuffle_down_sync(lane_layout_MN(_0{},reduction_cols));
+        }
+      }
+      bool is_reduced_lane = get<1>(lane_mn) == 0;
+
+      //
+      // 2. One warp in N, dump the warp reduction of this CTA tile to the gmem workspace
+      //
+      // Filter so we don't issue redundant copies over stride-0 modes
+      Tensor tCrTopK_flt = filter_zeros(tCrTopK);
+      Tensor tCcCol_flt = make_tensor(tCcCol.data(), make_layout(tCrTopK_flt.shape(), tCcCol.stride()));
+      if (is_reduced_lane) {
+        int n = get<1>(tile_coord_mnkl);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrTopK_flt); ++i) {
+          int row = get<0>(tCcCol_flt(i));
+          CUTLASS_PRAGMA_UNROLL
+          for (int k = 0; k < TopK; ++k) {
+            gBufValues_n(k,row,n) = tCrTopK_flt(i).top_k_[k];
+            gBufIndices_n(k,row,n) = tCrTopK_flt(i).indices_[k];
+          }
+        }
+      }
+
+      //
+      // 3. Increment atomic counters to signal final gmem reduction
+      //
+      // Ensure gmem writes are visible to other threads before incrementing counter
+      __threadfence();
+      sync_fn();
+      // Collective thread 0 increments atomic tile counter and copies value to smem
+      int* prev_tile_count = reinterpret_cast<int*>(raw_pointer_cast(smem_buffer.data()));
+      if (thread_idx == 0) {
+        *prev_tile_count = atomicAdd(tile_counter, 1);
+      }
+      sync_fn();
+      // Broadcast tile count to other threads in CTA and determine final reduction status
+      do_final_reduction = *prev_tile_count == size<2>(gBufValues_n) - 1;
+      sync_fn();
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      //
+      // 4. Merge the partial top-K of all N tiles if this was the last CTA of the row block
+      //
+      if (not do_final_reduction) {
+        return;
+      }
+
+      auto& [tCrTopK, tCcCol, cCol, gValues, gIndices, gBufValues_n, gBufIndices_n, tile_counter,
+              lane_layout_MN, lane_mn, tile_coord_mnkl, residue_cCol, tiled_copy, thread_idx] = args_tuple;
+
+      using ConvertOutput = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+      ConvertOutput convert_output{};
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int m = thread_idx; m < size<1>(gBufValues_n); m += size(tiled_copy)) {
+        if (not elem_less(cCol(m,_0{}), residue_cCol)) {
+          continue;
+        }
+
+        TopKResult top_k;
+        CUTLASS_PRAGMA_NO_UNROLL
+        for (int n = 0; n < size<2>(gBufValues_n); ++n) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int k = 0; k < TopK; ++k) {
+            top_k.add(gBufValues_n(k,m,n), gBufIndices_n(k,m,n));
+          }
+        }
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int k = 0; k < TopK; ++k) {
+          if (params.ptr_values != nullptr) {
+            gValues(m,k) = convert_output(top_k.top_k_[k]);
+          }
+          if (params.ptr_indices != nullptr) {
+            gIndices(m,k) = top_k.indices_[k];
+          }
+        }
+      }
+    }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      if constexpr (ReferenceSrc) { return get<0>(args.tiled_copy.get_layoutS_MN()); }
+      else                        { return get<0>(args.tiled_copy.get_layoutD_MN()); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout + coord of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+    Layout inv_lane_layout_MN = right_inverse(lane_layout_MN);                                  // lane_idx -> lane_mn
+    int lane_idx = canonical_lane_idx();
+    auto lane_mn = idx2crd(inv_lane_layout_MN(lane_idx), shape(lane_layout_MN));
+
+    // Get the MN layout of warps
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+
+    // Make sure there's only one warp across N so we can use warp shuffle intrinsics for reduction.
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1);
+
+    auto [tile_M, tile_N, tile_K] = args.tile_shape_mnk;
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // Running top-K per row, broadcast along N so that every epilogue tile of the CTA
+    // accumulates into the same entry
+    Tensor gCol = make_tensor(make_gmem_ptr<ElementCompute>(nullptr),
+                    make_layout(take<0,2>(args.tile_shape_mnk), make_stride(_1{}, _0{})));        // (CTA_M,CTA_N)
+    Tensor tCgCol = sm90_partition_for_epilogue<ReferenceSrc>(                         // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                      gCol, args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCrTopK = make_tensor_like<TopKResult>(tCgCol);                             // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    fill(tCrTopK, TopKResult());
+
+    // Final (M,K,L) outputs of this row block
+    Tensor mValues = make_tensor(make_gmem_ptr(params.ptr_values), make_shape(M,Int<TopK>{},L), params.dTopK);
+    Tensor mIndices = make_tensor(make_gmem_ptr(params.ptr_indices), make_shape(M,Int<TopK>{},L), params.dTopK);
+    Tensor gValues = local_tile(mValues, make_shape(tile_M,Int<TopK>{}), make_coord(m,_0{},l));          // (CTA_M,K)
+    Tensor gIndices = local_tile(mIndices, make_shape(tile_M,Int<TopK>{}), make_coord(m,_0{},l));        // (CTA_M,K)
+
+    // Partial top-K of every N tile of this row block in the workspace
+    auto tiles_mnl = ceil_div(make_shape(M,N,L), make_shape(tile_M, tile_N));
+    Layout mBuf_layout = make_layout(make_shape(Int<TopK>{},tile_M,get<1>(tiles_mnl),get<0>(tiles_mnl),L)); // (K,CTA_M,REST_N,REST_M,L)
+    Tensor mBufValues = make_tensor(make_gmem_ptr(reinterpret_cast<ElementCompute volatile*>(params.value_buffer)), mBuf_layout);
+    Tensor mBufIndices = make_tensor(make_gmem_ptr(reinterpret_cast<int32_t volatile*>(params.index_buffer)), mBuf_layout);
+    Tensor gBufValues_n = mBufValues(_,_,_,m,l);                                                        // (K,CTA_M,REST_N)
+    Tensor gBufIndices_n = mBufIndices(_,_,_,m,l);                                                      // (K,CTA_M,REST_N)
+    int* tile_counter = params.tile_counters + l * get<0>(tiles_mnl) + m;
+
+    Tensor tC_cD = sm90_partition_for_epilogue<ReferenceSrc>(                           // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      args.cD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    auto args_tuple = make_tuple(
+        cute::move(tCrTopK), tC_cD, args.cD, gValues, gIndices, gBufValues_n, gBufIndices_n, tile_counter,
+        lane_layout_MN, lane_mn, args.tile_coord_mnkl, args.residue_cD, args.tiled_copy, args.thread_idx);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace cutlass::epilogue::fusion
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device layer interface for Distributed GEMM block quantization kernels.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/kernel/block_quantization.hpp"
+
+namespace cutlass::distributed::device {
+
+static constexpr int BlockQuantizationThreads = 256;
+// Dequantization is grid-strided over at most this many CTAs
+static constexpr int64_t BlockDequantizationMaxCtas = 65536;
+
+template <typename ElementSrc, typename ElementQuant, int BlockSize>
+void launch_block_quantize(
+    ElementSrc const* src,
+    ElementQuant* dst,
+    float* scales,
+    int64_t num_elements,
+    cudaStream_t stream) {
+
+#if ((__CUDACC_VER_MAJOR__ >= 12) && (__CUDACC_VER_MINOR__ >= 4))
+  constexpr int BlocksPerCta = BlockQuantizationThreads / NumThreadsPerWarp;
+  int64_t num_blocks = (num_elements + BlockSize - 1) / BlockSize;
+
+  cudaLaunchConfig_t launch_config;
+  launch_config.gridDim = static_cast<unsigned int>((num_blocks + BlocksPerCta - 1) / BlocksPerCta);
+  launch_config.blockDim = BlockQuantizationThreads;
+  launch_config.dynamicSmemBytes = 0;
+  launch_config.stream = stream;
+  launch_config.attrs = nullptr;
+  launch_config.numAttrs = 0;
+
+  cudaLaunchKernelEx(
+      &launch_config,
+      cutlass::distributed::kernel::block_quantize_kernel<ElementSrc, ElementQuant, BlockSize>,
+      src,
+      dst,
+      scales,
+      num_elements);
+#endif
+}
+
+template <typename ElementQuant, typename ElementDst, int BlockSize>
+void launch_block_dequantize(
+    ElementQuant const* src,
+    float const* scales,
+    ElementDst* dst,
+    int64_t num_elements,
+    cudaStream_t stream) {
+
+#if ((__CUDACC_VER_MAJOR__ >= 12) && (__CUDACC_VER_MINOR__ >= 4))
+  int64_t num_ctas = (num_elements + BlockQuantizationThreads - 1) / BlockQuantizationThreads;
+  num_ctas = num_ctas < BlockDequantizationMaxCtas ? num_ctas : BlockDequantizationMaxCtas;
+
+  cudaLaunchConfig_t launch_config;
+  launch_config.gridDim = static_cast<unsigned int>(num_ctas);
+  launch_config.blockDim = BlockQuantizationThreads;
+  launch_config.dynamicSmemBytes = 0;
+  launch_config.stream = stream;
+  launch_config.attrs = nullptr;
+  launch_config.numAttrs = 0;
+
+  cudaLaunchKernelEx(
+      &launch_config,
+      cutlass::distributed::kernel::block_dequantize_kernel<ElementQuant, ElementDst, BlockSize>,
+      src,
+      scales,
+      dst,
+      num_elements);
+#endif
+}
+
+} // namespace cutlass::distributed::device
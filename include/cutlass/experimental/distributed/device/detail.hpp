@@ -37,6 +37,7 @@
 #include "cute/layout.hpp"
 #include "cute/tensor.hpp"
 #include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -73,6 +74,12 @@ struct DistGemmBufferHelper {
   static constexpr int NumBuffersC = Tiler::NumBuffersC;
   static constexpr int NumBuffersD = Tiler::NumBuffersD;
 
+  static constexpr bool QuantizedTransferA = Tiler::QuantizedTransfer && Tiler::MemcpyA;
+  static constexpr bool QuantizedTransferB = Tiler::QuantizedTransfer && Tiler::MemcpyB;
+  using ElementTransfer = typename Tiler::ElementTransfer;
+
+  static constexpr size_t QuantizedAlignment = 128;
+
   template <typename ProblemShape>
   static auto
   get_buffer_size_a(ProblemShape problem_shape) {
@@ -104,7 +111,7 @@ struct DistGemmBufferHelper {
   static auto
   get_buffer_size_d(ProblemShape problem_shape) {
     auto d_buffer_layout = cute::make_layout(
-        cute::make_shape(NumBuffersD, Tiler::get_local_d_shape(problem_shape), sizeof(ElementD))
+        cute::make_shape(NumBuffersD, Tiler::get_d_buffer_shape(problem_shape), sizeof(ElementD))
     );
     return size(d_buffer_layout);
   }
@@ -126,6 +133,9 @@ struct DistGemmBufferHelper {
     if constexpr (NumBuffersD > 0) {
       buffer_size += get_buffer_size_d(problem_shape);
     }
+    if constexpr (QuantizedTransferA || QuantizedTransferB) {
+      buffer_size = get_buffer_offset_quantized_B(problem_shape) + get_quantized_buffer_size_b(problem_shape);
+    }
 
     return buffer_size;
   }
@@ -155,6 +165,69 @@ struct DistGemmBufferHelper {
   get_buffer_offset_D(ProblemShape problem_shape) {
     return get_buffer_size_a(problem_shape) + get_buffer_size_b(problem_shape) + get_buffer_size_c(problem_shape);
   }
+
+  // Quantized transfers: a slot holds a quantized slice followed by its per-block scales
+  static size_t
+  get_quantized_scale_offset(size_t num_elements) {
+    return round_nearest(num_elements * sizeof(ElementTransfer), QuantizedAlignment);
+  }
+
+  static size_t
+  get_quantized_slot_size(size_t num_elements) {
+    size_t num_blocks = (num_elements + Tiler::TransferBlockSize - 1) / Tiler::TransferBlockSize;
+    return get_quantized_scale_offset(num_elements) + round_nearest(num_blocks * sizeof(float), QuantizedAlignment);
+  }
+
+  template <typename ProblemShape>
+  static size_t
+  get_quantized_buffer_size_a(ProblemShape problem_shape) {
+    if constexpr (QuantizedTransferA) {
+      return (NumBuffersA + 1) * get_quantized_slot_size(size(Tiler::get_local_a_shape(problem_shape)));
+    } else {
+      return 0;
+    }
+  }
+
+  template <typename ProblemShape>
+  static size_t
+  get_quantized_buffer_size_b(ProblemShape problem_shape) {
+    if constexpr (QuantizedTransferB) {
+      return (NumBuffersB + 1) * get_quantized_slot_size(size(Tiler::get_local_b_shape(problem_shape)));
+    } else {
+      return 0;
+    }
+  }
+
+  // Quantized buffers follow buffer_D: |  quantized_A  |  quantized_B  |
+  // And quantized_{A,B}: |  local slice  |  iter 1  |  iter 2  | ... |  iter TP - 1 |
+  template <typename ProblemShape>
+  static size_t
+  get_buffer_offset_quantized_A(ProblemShape problem_shape) {
+    return round_nearest(
+        get_buffer_offset_D(problem_shape) + get_buffer_size_d(problem_shape), QuantizedAlignment);
+  }
+
+  template <typename ProblemShape>
+  static size_t
+  get_buffer_offset_quantized_B(ProblemShape problem_shape) {
+    return get_buffer_offset_quantized_A(problem_shape) + get_quantized_buffer_size_a(problem_shape);
+  }
+
+  // Offset of the slot holding a device's own slice (slot 0), or the slice it receives in
+  // stage/iteration `slot`
+  template <typename ProblemShape>
+  static size_t
+  get_quantized_slot_offset_A(ProblemShape problem_shape, int slot) {
+    return get_buffer_offset_quantized_A(problem_shape) +
+      slot * get_quantized_slot_size(size(Tiler::get_local_a_shape(problem_shape)));
+  }
+
+  template <typename ProblemShape>
+  static size_t
+  get_quantized_slot_offset_B(ProblemShape problem_shape, int slot) {
+    return get_buffer_offset_quantized_B(problem_shape) +
+      slot * get_quantized_slot_size(size(Tiler::get_local_b_shape(problem_shape)));
+  }
 };
 
 } // namespace cutlass::distributed::device::detail
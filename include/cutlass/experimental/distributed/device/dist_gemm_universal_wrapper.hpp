@@ -32,7 +32,8 @@
   \file Distributed GEMM Device Adapter
 
   Sets up local GEMM stages, the cuda graph, manages buffer and barrier spaces,
-  and maps arguments to per-stage arguments.
+  and maps arguments to per-stage arguments. Communication between devices goes through a
+  transport (see transport.hpp).
 */
 
 #pragma once
@@ -42,18 +43,20 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 
-#include "cutlass/experimental/distributed/device/full_barrier.hpp"
+#include "cutlass/experimental/distributed/device/block_quantization.hpp"
+#include "cutlass/experimental/distributed/device/transport.hpp"
 #include "cutlass/experimental/distributed/device/detail.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::distributed::device {
 
-template <class GemmKernel_>
+template <class GemmKernel_, class Transport_ = PeerAccessTransport>
 class DistributedGemmUniversalAdapter {
 public:
   using DeviceGemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel_>;
   using GemmKernel = GemmKernel_;
+  using Transport = Transport_;
   using TileShape = typename GemmKernel::TileShape;
   using ElementA = typename GemmKernel::ElementA;
   using ElementB = typename GemmKernel::ElementB;
@@ -111,8 +114,24 @@ public:
   // Distributed GEMM types and defs
   using DistSchedule = typename GemmKernel::DistSchedule;
   static constexpr bool HasMemcpy = DistSchedule::HasMemcpy;
+  static constexpr bool GatherOutput = DistSchedule::GatherOutput;
+  static constexpr bool QuantizedTransfer = DistSchedule::QuantizedTransfer;
   using TP = typename DistSchedule::TP;
   static constexpr int TP_ = TP{};
+  static constexpr int Iterations = DistSchedule::NumIterations;
+
+  static_assert(Transport::KernelPeerAccess || not (DistSchedule::RemoteC || DistSchedule::KernelWritesArrivalFlag ||
+                                                     DistSchedule::DirectPeerA || DistSchedule::DirectPeerB),
+      "Selected TP accesses peer memory from within the GEMM kernels, which the transport does not support.");
+
+  // Number of tensors memcpied in each stage/iteration
+  static constexpr int NumMemcpies = int(DistSchedule::MemcpyA) + int(DistSchedule::MemcpyB);
+
+  // One arrival flag per stage/iteration, followed by one per gathered slice of D when the output
+  // is gathered, and one per peer's quantized slices when transfers are quantized.
+  static constexpr int NumGatherFlags = GatherOutput ? TP_ : 0;
+  static constexpr int NumStagedFlags = QuantizedTransfer ? TP_ : 0;
+  static constexpr int NumFlags = Iterations + NumGatherFlags + NumStagedFlags;
   using ElementFlag = typename GemmKernel::ElementFlag;
   using ElementBarrier = uint32_t;
 
@@ -134,7 +153,7 @@ public:
   struct DistributedGemmState {
     int device_idx;
 
-    Params params_array[TP_];
+    Params params_array[Iterations];
 
     cudaGraph_t graph;
     cudaGraphExec_t graph_executable;
@@ -142,21 +161,51 @@ public:
     bool graph_created = false;
     bool graph_instantiated = false;
 
-    void * memcpy_source_ptr_array[TP_];
-    void const * memcpy_remote_ptr_array[TP_];
-    size_t memcpy_bytes[TP_];
+    void * memcpy_source_ptr_array[Iterations][cute::max(NumMemcpies, 1)];
+    void const * memcpy_remote_ptr_array[Iterations][cute::max(NumMemcpies, 1)];
+    size_t memcpy_bytes[Iterations][cute::max(NumMemcpies, 1)];
+    int memcpy_peer_idx[Iterations][cute::max(NumMemcpies, 1)];
 
     cutlass::Array<ElementBarrier*, TP_> device_barrier_ptrs;
 
+    // Gathered output: slices of D copied from their owning peers, and the flags gating them
+    void * gather_local_ptr_array[TP_];
+    void const * gather_remote_ptr_array[TP_];
+    size_t gather_bytes[TP_];
+
+    cutlass::Array<ElementFlag*, TP_> gather_self_flag_ptrs;
+    cutlass::Array<ElementFlag*, TP_> gather_peer_flag_ptrs;
+
+    // Quantized transfers: this device's slices of the memcpied operands and the slots they are
+    // quantized into, and for each stage/iteration the scales copied along with the quantized
+    // slice and the buffer it is dequantized into
+    void const * quantize_source_ptr_array[cute::max(NumMemcpies, 1)];
+    void * quantize_slot_ptr_array[cute::max(NumMemcpies, 1)];
+    int64_t quantize_elements[cute::max(NumMemcpies, 1)];
+
+    void * memcpy_scale_local_ptr_array[Iterations][cute::max(NumMemcpies, 1)];
+    void const * memcpy_scale_remote_ptr_array[Iterations][cute::max(NumMemcpies, 1)];
+    size_t memcpy_scale_bytes[Iterations][cute::max(NumMemcpies, 1)];
+    void * dequantize_dest_ptr_array[Iterations][cute::max(NumMemcpies, 1)];
+
+    // Flags raised by peers once their slices are quantized
+    cutlass::Array<ElementFlag*, TP_> staged_self_flag_ptrs;
+    cutlass::Array<ElementFlag*, TP_> staged_peer_flag_ptrs;
+
     bool is_initialized = false;
   };
 
 private:
 
   DistributedGemmState state_;
+  Transport transport_;
 
 public:
 
+  DistributedGemmUniversalAdapter() = default;
+
+  explicit DistributedGemmUniversalAdapter(Transport const& transport) : transport_(transport) { }
+
   bool is_initialized() {
     return state_.is_initialized && state_.graph_created && state_.graph_instantiated;
   }
@@ -176,9 +225,21 @@ public:
       return Status::kInvalid;
     }
 
+    if constexpr (GatherOutput) {
+      auto tensor_D = make_tensor(args.epilogue.ptr_D, make_layout(
+            DistSchedule::get_local_d_shape(args.problem_shape),
+            args.epilogue.dD));
+      auto slice_D = DistSchedule::get_gathered_slice_D(tensor_D, 0);
+      if (cute::cosize(slice_D.layout()) != cute::size(slice_D.layout())) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Selected TP gathers slices of D with a single copy " <<
+            "each, which requires slices of D to be contiguous.\n");
+        return Status::kInvalid;
+      }
+    }
+
     Arguments args_copy = args;
     args_copy.problem_shape = DistSchedule::get_local_gemm_shape(args.problem_shape);
-    for (int iteration = 0; iteration < TP_; ++iteration) {
+    for (int iteration = 0; iteration < Iterations; ++iteration) {
       if (not GemmKernel::can_implement(args_copy)) {
         return Status::kInvalid;
       }
@@ -199,6 +260,14 @@ public:
 
   static auto
   get_tensor_A_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
+    // Stages/iterations > 0 of direct peer schedules read the peer's own slice in place
+    if constexpr (DistSchedule::DirectPeerA) {
+      if (iteration > 0) {
+        device_idx = DistSchedule::get_remote_peer_id_a(device_idx, iteration);
+        iteration = 0;
+      }
+    }
+
     auto args = args_array[device_idx];
     auto tensor_A = make_tensor(args.mainloop.ptr_A, make_layout(
           DistSchedule::get_local_a_shape(args.problem_shape),
@@ -212,6 +281,14 @@ public:
 
   static auto
   get_tensor_B_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
+    // Stages/iterations > 0 of direct peer schedules read the peer's own slice in place
+    if constexpr (DistSchedule::DirectPeerB) {
+      if (iteration > 0) {
+        device_idx = DistSchedule::get_remote_peer_id_b(device_idx, iteration);
+        iteration = 0;
+      }
+    }
+
     auto args = args_array[device_idx];
     auto tensor_B = make_tensor(args.mainloop.ptr_B, make_layout(
           DistSchedule::get_local_b_shape(args.problem_shape),
@@ -223,6 +300,20 @@ public:
     return DistSchedule::get_tensor_B(tensor_B, tensor_buffer, device_idx, iteration);
   }
 
+  // Slot of a device's quantized transfer buffer holding its own slice (slot 0), or the slice it
+  // receives in stage/iteration `slot` (quantized transfers only)
+  static uint8_t*
+  get_quantized_slot_A(Arguments const* args_array, void** buffer_space, int device_idx, int slot) {
+    return reinterpret_cast<uint8_t*>(buffer_space[device_idx]) +
+      BufferHelper::get_quantized_slot_offset_A(args_array[device_idx].problem_shape, slot);
+  }
+
+  static uint8_t*
+  get_quantized_slot_B(Arguments const* args_array, void** buffer_space, int device_idx, int slot) {
+    return reinterpret_cast<uint8_t*>(buffer_space[device_idx]) +
+      BufferHelper::get_quantized_slot_offset_B(args_array[device_idx].problem_shape, slot);
+  }
+
   static auto
   get_tensor_C_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
     auto args = args_array[device_idx];
@@ -253,13 +344,25 @@ public:
     return DistSchedule::get_tensor_D(tensor_D, tensor_buffer, device_idx, iteration);
   }
 
+  // Slice of a device's D that is fully reduced by the owner device (gathered outputs only)
+  static auto
+  get_gathered_slice_D_for_device(Arguments const* args_array, int device_idx, int owner_device_idx) {
+    static_assert(GatherOutput, "Only schedules with gathered outputs have gathered slices.");
+    auto args = args_array[device_idx];
+    auto tensor_D = make_tensor(args.epilogue.ptr_D, make_layout(
+          DistSchedule::get_local_d_shape(args.problem_shape),
+          args.epilogue.dD));
+
+    return DistSchedule::get_gathered_slice_D(tensor_D, owner_device_idx);
+  }
+
   static size_t
   get_workspace_size(Arguments const& args) {
     size_t workspace_bytes = 0;
 
     workspace_bytes = get_buffer_space_size(args);
 
-    for (int iteration = 0; iteration < TP_; ++iteration) {
+    for (int iteration = 0; iteration < Iterations; ++iteration) {
       // NOTE: assumes underlying kernels align up to alignment requirements on their own,
       // and that the alignment requirements of the individual kernels match.
       workspace_bytes += GemmKernel::get_workspace_size(args);
@@ -275,7 +378,7 @@ public:
 
   static size_t
   get_flag_bytes() {
-    return round_nearest(sizeof(ElementFlag) * TP_, 32);
+    return round_nearest(sizeof(ElementFlag) * NumFlags, 32);
   }
 
   static void *
@@ -286,6 +389,19 @@ public:
         (sizeof(ElementFlag) * iteration));
   }
 
+  // Flag raised by the owner device once its slice of D is fully reduced (gathered outputs only)
+  static void *
+  exclusive_workspace_ptr_to_gather_flag_ptr(void * exclusive_workspace_ptr, int owner_device_idx) {
+    return exclusive_workspace_ptr_to_flag_ptr(exclusive_workspace_ptr, Iterations + owner_device_idx);
+  }
+
+  // Flag raised by the owner device once its slices are quantized (quantized transfers only)
+  static void *
+  exclusive_workspace_ptr_to_staged_flag_ptr(void * exclusive_workspace_ptr, int owner_device_idx) {
+    return exclusive_workspace_ptr_to_flag_ptr(
+        exclusive_workspace_ptr, Iterations + NumGatherFlags + owner_device_idx);
+  }
+
   static size_t
   get_exclusive_workspace_size() {
     return get_barrier_bytes() + get_flag_bytes();
@@ -312,7 +428,7 @@ public:
     // Zero out exclusive workspace
     zero_workspace(exclusive_workspace_ptrs[device_idx], get_exclusive_workspace_size(), stream, nullptr);
 
-    for (int iteration = 0; iteration < TP_; ++iteration) {
+    for (int iteration = 0; iteration < Iterations; ++iteration) {
 
       size_t workspace_iteration_offset = GemmKernel::get_workspace_size(args[device_idx]);
       uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace_ptrs[device_idx]) + 
@@ -353,6 +469,18 @@ public:
         }
       }
 
+      // Accumulate into the local D in stages/iterations > 0; the first stage/iteration applies the
+      // user-provided C and beta.
+      if constexpr (DistSchedule::AccumulateD) {
+        static_assert(cute::is_same_v<ElementC, ElementD> && cute::is_same_v<StrideC, StrideD>,
+            "Schedules accumulating into D require C and D to share element type and stride.");
+        if (iteration > 0) {
+          base_args.epilogue.ptr_C = reinterpret_cast<const ElementC*>(tensor_d_iter.data());
+          base_args.epilogue.dC = tensor_d_iter.stride();
+          base_args.epilogue.thread.beta = 1.0;
+        }
+      }
+
       auto [left_peer_idx, right_peer_idx] = DistSchedule::get_peers_for_device(device_idx);
       auto flag_peer_idx = DistSchedule::KernelWritesArrivalFlag ? right_peer_idx : device_idx;
 
@@ -378,40 +506,139 @@ public:
 
       // Set up peer buffer ptrs
       if (iteration > 0 && HasMemcpy) {
-        auto peer_idx_iter = DistSchedule::get_remote_peer_id(device_idx, iteration);
-
-        void * local_ptr_itr = nullptr;
-        void const * remote_ptr_itr = nullptr;
-        size_t local_size = 0;
-        size_t remote_size = 0;
+        int memcpy_idx = 0;
 
         static_assert(not DistSchedule::HasMemcpy || (
               DistSchedule::MemcpyA || DistSchedule::MemcpyB),
             "Expected to either memcpy A or B when scheduler requires memcpy.");
         if constexpr (DistSchedule::MemcpyA) {
-          local_size = cute::cosize(tensor_a_iter.layout()) * sizeof(ElementA);
-          local_ptr_itr = reinterpret_cast<void*>(tensor_a_iter.data());
+          auto peer_idx_iter = DistSchedule::get_remote_peer_id_a(device_idx, iteration);
+
+          size_t local_size = cute::cosize(tensor_a_iter.layout()) * sizeof(ElementA);
+          void * local_ptr_itr = reinterpret_cast<void*>(tensor_a_iter.data());
 
           // Copy peer's slice in the first iteration (direct access memcpy instead of logical ring)
           auto remote_tensor_iter = get_tensor_A_for_iter(args, buffer_space, peer_idx_iter, 0);
-          remote_ptr_itr = reinterpret_cast<void const*>(remote_tensor_iter.data());
-          remote_size = cute::cosize(remote_tensor_iter.layout()) * sizeof(ElementA);
+          void const * remote_ptr_itr = reinterpret_cast<void const*>(remote_tensor_iter.data());
+          size_t remote_size = cute::cosize(remote_tensor_iter.layout()) * sizeof(ElementA);
+
+          assert(local_size == remote_size && local_size > 0);
+
+          if constexpr (QuantizedTransfer) {
+            // Copy the peer's quantized slice and its scales, and dequantize into the local buffer
+            size_t num_elements = local_size / sizeof(ElementA);
+            size_t scale_offset = BufferHelper::get_quantized_scale_offset(num_elements);
+            size_t num_blocks = (num_elements + DistSchedule::TransferBlockSize - 1) / DistSchedule::TransferBlockSize;
+            uint8_t* local_slot = get_quantized_slot_A(args, buffer_space, device_idx, iteration);
+            uint8_t const* remote_slot = get_quantized_slot_A(args, buffer_space, peer_idx_iter, 0);
+
+            state_.memcpy_source_ptr_array[iteration][memcpy_idx] = local_slot;
+            state_.memcpy_remote_ptr_array[iteration][memcpy_idx] = remote_slot;
+            state_.memcpy_bytes[iteration][memcpy_idx] = num_elements * sizeof(typename DistSchedule::ElementTransfer);
+            state_.memcpy_scale_local_ptr_array[iteration][memcpy_idx] = local_slot + scale_offset;
+            state_.memcpy_scale_remote_ptr_array[iteration][memcpy_idx] = remote_slot + scale_offset;
+            state_.memcpy_scale_bytes[iteration][memcpy_idx] = num_blocks * sizeof(float);
+            state_.dequantize_dest_ptr_array[iteration][memcpy_idx] = local_ptr_itr;
+          }
+          else {
+            state_.memcpy_source_ptr_array[iteration][memcpy_idx] = local_ptr_itr;
+            state_.memcpy_remote_ptr_array[iteration][memcpy_idx] = remote_ptr_itr;
+            state_.memcpy_bytes[iteration][memcpy_idx] = local_size;
+          }
+          state_.memcpy_peer_idx[iteration][memcpy_idx] = peer_idx_iter;
+          ++memcpy_idx;
         }
-        else if constexpr (DistSchedule::MemcpyB) {
-          local_size = cute::cosize(tensor_b_iter.layout()) * sizeof(ElementB);
-          local_ptr_itr = reinterpret_cast<void*>(tensor_b_iter.data());
+        if constexpr (DistSchedule::MemcpyB) {
+          auto peer_idx_iter = DistSchedule::get_remote_peer_id_b(device_idx, iteration);
+
+          size_t local_size = cute::cosize(tensor_b_iter.layout()) * sizeof(ElementB);
+          void * local_ptr_itr = reinterpret_cast<void*>(tensor_b_iter.data());
 
           // Copy peer's slice in the first iteration (direct access memcpy instead of logical ring)
           auto remote_tensor_iter = get_tensor_B_for_iter(args, buffer_space, peer_idx_iter, 0);
-          remote_ptr_itr = reinterpret_cast<void const*>(remote_tensor_iter.data());
-          remote_size = cute::cosize(remote_tensor_iter.layout()) * sizeof(ElementB);
+          void const * remote_ptr_itr = reinterpret_cast<void const*>(remote_tensor_iter.data());
+          size_t remote_size = cute::cosize(remote_tensor_iter.layout()) * sizeof(ElementB);
+
+          assert(local_size == remote_size && local_size > 0);
+
+          if constexpr (QuantizedTransfer) {
+            // Copy the peer's quantized slice and its scales, and dequantize into the local buffer
+            size_t num_elements = local_size / sizeof(ElementB);
+            size_t scale_offset = BufferHelper::get_quantized_scale_offset(num_elements);
+            size_t num_blocks = (num_elements + DistSchedule::TransferBlockSize - 1) / DistSchedule::TransferBlockSize;
+            uint8_t* local_slot = get_quantized_slot_B(args, buffer_space, device_idx, iteration);
+            uint8_t const* remote_slot = get_quantized_slot_B(args, buffer_space, peer_idx_iter, 0);
+
+            state_.memcpy_source_ptr_array[iteration][memcpy_idx] = local_slot;
+            state_.memcpy_remote_ptr_array[iteration][memcpy_idx] = remote_slot;
+            state_.memcpy_bytes[iteration][memcpy_idx] = num_elements * sizeof(typename DistSchedule::ElementTransfer);
+            state_.memcpy_scale_local_ptr_array[iteration][memcpy_idx] = local_slot + scale_offset;
+            state_.memcpy_scale_remote_ptr_array[iteration][memcpy_idx] = remote_slot + scale_offset;
+            state_.memcpy_scale_bytes[iteration][memcpy_idx] = num_blocks * sizeof(float);
+            state_.dequantize_dest_ptr_array[iteration][memcpy_idx] = local_ptr_itr;
+          }
+          else {
+            state_.memcpy_source_ptr_array[iteration][memcpy_idx] = local_ptr_itr;
+            state_.memcpy_remote_ptr_array[iteration][memcpy_idx] = remote_ptr_itr;
+            state_.memcpy_bytes[iteration][memcpy_idx] = local_size;
+          }
+          state_.memcpy_peer_idx[iteration][memcpy_idx] = peer_idx_iter;
+          ++memcpy_idx;
+        }
+      }
+    }
+
+    // Set up gathered slices of D
+    if constexpr (GatherOutput) {
+      for (int peer_idx = 0; peer_idx < TP_; ++peer_idx) {
+        state_.gather_self_flag_ptrs[peer_idx] = reinterpret_cast<ElementFlag*>(
+            exclusive_workspace_ptr_to_gather_flag_ptr(exclusive_workspace_ptrs[device_idx], peer_idx));
+        state_.gather_peer_flag_ptrs[peer_idx] = reinterpret_cast<ElementFlag*>(
+            exclusive_workspace_ptr_to_gather_flag_ptr(exclusive_workspace_ptrs[peer_idx], device_idx));
+
+        if (peer_idx == device_idx) {
+          state_.gather_local_ptr_array[peer_idx] = nullptr;
+          state_.gather_remote_ptr_array[peer_idx] = nullptr;
+          state_.gather_bytes[peer_idx] = 0;
+          continue;
         }
 
+        auto local_slice = get_gathered_slice_D_for_device(args, device_idx, peer_idx);
+        auto remote_slice = get_gathered_slice_D_for_device(args, peer_idx, peer_idx);
+
+        size_t local_size = cute::cosize(local_slice.layout()) * sizeof(ElementD);
+        size_t remote_size = cute::cosize(remote_slice.layout()) * sizeof(ElementD);
         assert(local_size == remote_size && local_size > 0);
 
-        state_.memcpy_source_ptr_array[iteration] = local_ptr_itr;
-        state_.memcpy_remote_ptr_array[iteration] = remote_ptr_itr;
-        state_.memcpy_bytes[iteration] = local_size;
+        state_.gather_local_ptr_array[peer_idx] = reinterpret_cast<void*>(local_slice.data());
+        state_.gather_remote_ptr_array[peer_idx] = reinterpret_cast<void const*>(remote_slice.data());
+        state_.gather_bytes[peer_idx] = local_size;
+      }
+    }
+
+    // Set up this device's quantized slices
+    if constexpr (QuantizedTransfer) {
+      int memcpy_idx = 0;
+      if constexpr (DistSchedule::MemcpyA) {
+        auto tensor_a = get_tensor_A_for_iter(args, workspace_ptrs, device_idx, 0);
+        state_.quantize_source_ptr_array[memcpy_idx] = reinterpret_cast<void const*>(tensor_a.data());
+        state_.quantize_slot_ptr_array[memcpy_idx] = get_quantized_slot_A(args, workspace_ptrs, device_idx, 0);
+        state_.quantize_elements[memcpy_idx] = cute::cosize(tensor_a.layout());
+        ++memcpy_idx;
+      }
+      if constexpr (DistSchedule::MemcpyB) {
+        auto tensor_b = get_tensor_B_for_iter(args, workspace_ptrs, device_idx, 0);
+        state_.quantize_source_ptr_array[memcpy_idx] = reinterpret_cast<void const*>(tensor_b.data());
+        state_.quantize_slot_ptr_array[memcpy_idx] = get_quantized_slot_B(args, workspace_ptrs, device_idx, 0);
+        state_.quantize_elements[memcpy_idx] = cute::cosize(tensor_b.layout());
+        ++memcpy_idx;
+      }
+
+      for (int peer_idx = 0; peer_idx < TP_; ++peer_idx) {
+        state_.staged_self_flag_ptrs[peer_idx] = reinterpret_cast<ElementFlag*>(
+            exclusive_workspace_ptr_to_staged_flag_ptr(exclusive_workspace_ptrs[device_idx], peer_idx));
+        state_.staged_peer_flag_ptrs[peer_idx] = reinterpret_cast<ElementFlag*>(
+            exclusive_workspace_ptr_to_staged_flag_ptr(exclusive_workspace_ptrs[peer_idx], device_idx));
       }
     }
 
@@ -444,6 +671,54 @@ public:
     return Status::kSuccess;
   }
 
+  // Quantizes this device's slice of the operand memcpied at memcpy_idx (quantized transfers only)
+  Status
+  quantize_slice(int memcpy_idx, cudaStream_t stream) {
+    using ElementTransfer = typename DistSchedule::ElementTransfer;
+    constexpr int BlockSize = DistSchedule::TransferBlockSize;
+
+    int64_t num_elements = state_.quantize_elements[memcpy_idx];
+    uint8_t* slot = reinterpret_cast<uint8_t*>(state_.quantize_slot_ptr_array[memcpy_idx]);
+    auto* dst = reinterpret_cast<ElementTransfer*>(slot);
+    auto* scales = reinterpret_cast<float*>(slot + BufferHelper::get_quantized_scale_offset(num_elements));
+
+    if (DistSchedule::MemcpyA && memcpy_idx == 0) {
+      launch_block_quantize<ElementA, ElementTransfer, BlockSize>(
+          reinterpret_cast<ElementA const*>(state_.quantize_source_ptr_array[memcpy_idx]),
+          dst, scales, num_elements, stream);
+    }
+    else {
+      launch_block_quantize<ElementB, ElementTransfer, BlockSize>(
+          reinterpret_cast<ElementB const*>(state_.quantize_source_ptr_array[memcpy_idx]),
+          dst, scales, num_elements, stream);
+    }
+    return detail::check_cuda_status(cudaGetLastError());
+  }
+
+  // Dequantizes the slice of the operand memcpied at memcpy_idx received in a stage/iteration
+  // (quantized transfers only)
+  Status
+  dequantize_slice(int iteration, int memcpy_idx, cudaStream_t stream) {
+    using ElementTransfer = typename DistSchedule::ElementTransfer;
+    constexpr int BlockSize = DistSchedule::TransferBlockSize;
+
+    int64_t num_elements = state_.memcpy_bytes[iteration][memcpy_idx] / sizeof(ElementTransfer);
+    auto const* src = reinterpret_cast<ElementTransfer const*>(state_.memcpy_source_ptr_array[iteration][memcpy_idx]);
+    auto const* scales = reinterpret_cast<float const*>(state_.memcpy_scale_local_ptr_array[iteration][memcpy_idx]);
+
+    if (DistSchedule::MemcpyA && memcpy_idx == 0) {
+      launch_block_dequantize<ElementTransfer, ElementA, BlockSize>(
+          src, scales, reinterpret_cast<ElementA*>(state_.dequantize_dest_ptr_array[iteration][memcpy_idx]),
+          num_elements, stream);
+    }
+    else {
+      launch_block_dequantize<ElementTransfer, ElementB, BlockSize>(
+          src, scales, reinterpret_cast<ElementB*>(state_.dequantize_dest_ptr_array[iteration][memcpy_idx]),
+          num_elements, stream);
+    }
+    return detail::check_cuda_status(cudaGetLastError());
+  }
+
   Status
   construct_graph(bool launch_with_pdl) {
 #if ((__CUDACC_VER_MAJOR__ >= 12) && (__CUDACC_VER_MINOR__ >= 4))
@@ -484,13 +759,26 @@ public:
       return status;
     }
 
-    cutlass::Array<ElementFlag*, TP_> self_flag_ptrs;
-    for (int iteration = 0; iteration < TP_; ++iteration) {
+    cutlass::Array<ElementFlag*, NumFlags> self_flag_ptrs;
+    for (int iteration = 0; iteration < Iterations; ++iteration) {
       self_flag_ptrs[iteration] = state_.params_array[iteration].distributed.self_flag_ptr_;
     }
+    if constexpr (GatherOutput) {
+      for (int peer_idx = 0; peer_idx < TP_; ++peer_idx) {
+        self_flag_ptrs[Iterations + peer_idx] = state_.gather_self_flag_ptrs[peer_idx];
+      }
+    }
+    if constexpr (QuantizedTransfer) {
+      for (int peer_idx = 0; peer_idx < TP_; ++peer_idx) {
+        self_flag_ptrs[Iterations + NumGatherFlags + peer_idx] = state_.staged_self_flag_ptrs[peer_idx];
+      }
+    }
 
-    launch_full_barrier<TP_, ElementBarrier, TP_, ElementFlag>(
-        state_.device_barrier_ptrs, self_flag_ptrs, state_.device_idx, stream, launch_with_pdl);
+    status = detail::check_cuda_status(transport_.template barrier<TP_, ElementBarrier, NumFlags, ElementFlag>(
+          state_.device_barrier_ptrs, self_flag_ptrs, state_.device_idx, stream, launch_with_pdl));
+    if (status != Status::kSuccess) {
+      return status;
+    }
 
     status = detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
     if (status != Status::kSuccess) {
@@ -529,18 +817,59 @@ public:
         return status;
       }
 
-      // No copies for first iter; we assume the data is already there.
-      for (int iteration = 1; iteration < TP_; ++iteration) {
-
-        status = detail::check_cuda_status(cudaMemcpyAsync(
-              state_.memcpy_source_ptr_array[iteration],
-              state_.memcpy_remote_ptr_array[iteration],
-              state_.memcpy_bytes[iteration],
-              cudaMemcpyDeviceToDevice, stream));
+      // Quantize this device's slices, and signal peers that they can be copied
+      if constexpr (QuantizedTransfer) {
+        for (int memcpy_idx = 0; memcpy_idx < NumMemcpies; ++memcpy_idx) {
+          status = quantize_slice(memcpy_idx, stream);
+          if (status != Status::kSuccess) {
+            return status;
+          }
+        }
 
+        status = detail::check_cuda_status(transport_.template signal<TP_, ElementFlag>(
+              state_.staged_peer_flag_ptrs, state_.device_idx, stream));
         if (status != Status::kSuccess) {
           return status;
         }
+      }
+
+      // No copies for first iter; we assume the data is already there.
+      for (int iteration = 1; iteration < Iterations; ++iteration) {
+
+        for (int memcpy_idx = 0; memcpy_idx < NumMemcpies; ++memcpy_idx) {
+          if constexpr (QuantizedTransfer) {
+            launch_wait_arrival<ElementFlag>(
+                state_.staged_self_flag_ptrs[state_.memcpy_peer_idx[iteration][memcpy_idx]], stream);
+          }
+
+          status = detail::check_cuda_status(transport_.get(
+                state_.memcpy_source_ptr_array[iteration][memcpy_idx],
+                state_.memcpy_remote_ptr_array[iteration][memcpy_idx],
+                state_.memcpy_bytes[iteration][memcpy_idx],
+                state_.memcpy_peer_idx[iteration][memcpy_idx],
+                stream));
+
+          if (status != Status::kSuccess) {
+            return status;
+          }
+
+          if constexpr (QuantizedTransfer) {
+            status = detail::check_cuda_status(transport_.get(
+                  state_.memcpy_scale_local_ptr_array[iteration][memcpy_idx],
+                  state_.memcpy_scale_remote_ptr_array[iteration][memcpy_idx],
+                  state_.memcpy_scale_bytes[iteration][memcpy_idx],
+                  state_.memcpy_peer_idx[iteration][memcpy_idx],
+                  stream));
+            if (status != Status::kSuccess) {
+              return status;
+            }
+
+            status = dequantize_slice(iteration, memcpy_idx, stream);
+            if (status != Status::kSuccess) {
+              return status;
+            }
+          }
+        }
 
         // Set flag to non zero
         status = detail::check_cuda_status(cudaMemsetAsync(
@@ -577,7 +906,7 @@ public:
       return status;
     }
 
-    for (int iteration = 0; iteration < TP_; ++iteration) {
+    for (int iteration = 0; iteration < Iterations; ++iteration) {
       status = DeviceGemm::run(
             state_.params_array[iteration],
             stream,
@@ -589,19 +918,70 @@ public:
       }
     }
 
+    // 3.2. Signal peers that this device's slice of D is ready to be gathered. The last GEMM
+    // stage can't signal on its own, since its stores are only guaranteed to be visible once it
+    // completes.
+    if constexpr (GatherOutput) {
+      status = detail::check_cuda_status(transport_.template signal<TP_, ElementFlag>(
+            state_.gather_peer_flag_ptrs, state_.device_idx, stream));
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
     status = detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
     if (status != Status::kSuccess) {
       return status;
     }
 
-    // 4. Cleanup.
+    // 4. Optional all-gather branch
+    // Runs concurrently with local GEMMs, and copies each peer's slice of D as soon as that peer
+    // raises its flag, starting with the left peer.
+    if constexpr (GatherOutput) {
+
+      status = detail::check_cuda_status(cudaStreamBeginCaptureToGraph(
+            stream,
+            state_.graph,
+            &full_barrier_node,
+            /* dependencyData = */ nullptr,
+            1,
+            cudaStreamCaptureModeRelaxed));
+
+      if (status != Status::kSuccess) {
+        return status;
+      }
+
+      for (int step = 1; step < TP_; ++step) {
+        int peer_idx = (state_.device_idx - step + TP_) % TP_;
+
+        launch_wait_arrival<ElementFlag>(state_.gather_self_flag_ptrs[peer_idx], stream);
+
+        status = detail::check_cuda_status(transport_.get(
+              state_.gather_local_ptr_array[peer_idx],
+              state_.gather_remote_ptr_array[peer_idx],
+              state_.gather_bytes[peer_idx],
+              peer_idx,
+              stream));
+
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+
+      status = detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    // 5. Cleanup.
     //// Destroy dummy stream
     status = detail::check_cuda_status(cudaStreamDestroy(stream));
     if (status != Status::kSuccess) {
       return status;
     }
 
-    // 5. Instantiate graph
+    // 6. Instantiate graph
     status = detail::check_cuda_status(cudaGraphInstantiate(
           &state_.graph_executable,
           state_.graph,
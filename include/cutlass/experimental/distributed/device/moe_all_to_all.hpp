@@ -0,0 +1,105 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device layer interface for expert-parallel all-to-all kernels.
+
+    A run of an expert-parallel MoE layer (see schedules/dist_moe_schedules.hpp) on each device:
+
+      1. launch_moe_dispatch on a communication stream. It only needs a few SMs, which the grouped
+         GEMM must leave free (KernelHardwareInfo::sm_count).
+      2. The grouped GEMM with GroupArrivalScheduler, concurrently on the compute stream, with the
+         local group arrival flags and the same epoch.
+      3. launch_moe_signal on the compute stream, after the grouped GEMM.
+      4. launch_moe_combine on the compute stream.
+
+    The epoch must increase with every run; flags are zeroed once before the first run. A device
+    must not start dispatching the next run before its peers' combine kernels of the current run
+    have consumed their return buffers.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/trace.h"
+#include "cutlass/experimental/distributed/kernel/moe_all_to_all.hpp"
+
+namespace cutlass::distributed::device {
+
+template <class Schedule, class Element>
+cudaError_t launch_moe_dispatch(
+    cutlass::distributed::kernel::MoeDispatchParams<Schedule, Element> const& params,
+    cudaStream_t stream,
+    int threads_per_block = 256) {
+
+  if ((params.hidden * sizeof(Element)) % sizeof(uint4) != 0) {
+    CUTLASS_TRACE_HOST("  launch_moe_dispatch(): token rows must be a multiple of 16B.");
+    return cudaErrorInvalidValue;
+  }
+
+  cutlass::distributed::kernel::moe_dispatch_kernel<Schedule, Element>
+    <<<Schedule::NumChunks, threads_per_block, 0, stream>>>(params);
+  return cudaGetLastError();
+}
+
+template <int NP>
+cudaError_t launch_moe_signal(
+    cutlass::Array<uint32_t*, NP> peer_combine_flag_ptrs,
+    int device_idx,
+    uint32_t epoch,
+    cudaStream_t stream) {
+
+  cutlass::distributed::kernel::moe_signal_kernel<NP><<<1, 1, 0, stream>>>(
+      peer_combine_flag_ptrs, device_idx, epoch);
+  return cudaGetLastError();
+}
+
+template <class Schedule, class Element, class ElementOutput>
+cudaError_t launch_moe_combine(
+    cutlass::distributed::kernel::MoeCombineParams<Schedule, Element, ElementOutput> const& params,
+    int sm_count,
+    cudaStream_t stream,
+    int threads_per_block = 256) {
+
+  size_t elements = static_cast<size_t>(params.num_tokens) * params.hidden;
+  size_t blocks = (elements + threads_per_block - 1) / threads_per_block;
+  size_t max_blocks = static_cast<size_t>(sm_count > 0 ? sm_count : 1) * 4;
+  int grid = static_cast<int>(blocks < max_blocks ? blocks : max_blocks);
+  if (grid == 0) {
+    return cudaSuccess;
+  }
+
+  cutlass::distributed::kernel::moe_combine_kernel<Schedule, Element, ElementOutput>
+    <<<grid, threads_per_block, 0, stream>>>(params);
+  return cudaGetLastError();
+}
+
+} // namespace cutlass::distributed::device
+
@@ -0,0 +1,141 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM transport over NVSHMEM.
+
+    Lets Distributed GEMM span devices that are not peer-accessible, e.g. two nodes connected over
+    InfiniBand with GPUDirect RDMA. Peers are the PEs of an NVSHMEM team, with device_idx being the
+    index of a PE within the team.
+
+    Requirements:
+      * NVSHMEM is initialized before the adapter, and CUTLASS_ENABLE_NVSHMEM is defined.
+      * Operands, workspaces and exclusive workspaces are allocated from the symmetric heap
+        (nvshmem_malloc), and the arguments passed for every peer hold the same symmetric addresses
+        as the local ones.
+      * Device code is relocatable and linked against the NVSHMEM device library.
+
+    Only schedules in which peers exchange data through the adapter (memcpied A/B and gathered
+    outputs) are supported; the GEMM kernels of RemoteC and KernelWritesArrivalFlag schedules
+    dereference peer pointers directly, which NVSHMEM can not offer across nodes.
+*/
+
+#pragma once
+
+#if defined(CUTLASS_ENABLE_NVSHMEM)
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/kernel/nvshmem_transport.hpp"
+
+namespace cutlass::distributed::device {
+
+struct NvshmemTransport {
+
+  static constexpr bool KernelPeerAccess = false;
+
+  nvshmem_team_t team = NVSHMEM_TEAM_WORLD;
+
+  // Global PE of a device within the team, which is what RMA operations are addressed by
+  int
+  get_pe(int peer_idx) const {
+    return nvshmem_team_translate_pe(team, peer_idx, NVSHMEM_TEAM_WORLD);
+  }
+
+  // Barrier pointers are unused; the team barrier replaces the peer arrival counters.
+  template <int NP, typename BarrierType, int NumFlags, typename FlagType>
+  cudaError_t
+  barrier(
+      [[maybe_unused]] cutlass::Array<BarrierType*, NP> device_barrier_ptrs,
+      cutlass::Array<FlagType*, NumFlags> self_flag_ptrs,
+      [[maybe_unused]] int device_idx,
+      cudaStream_t stream,
+      bool launch_with_pdl) const {
+#if ((__CUDACC_VER_MAJOR__ >= 12) && (__CUDACC_VER_MINOR__ >= 4))
+    cudaLaunchAttribute attributes[1];
+    attributes[0].id = cudaLaunchAttributeProgrammaticStreamSerialization;
+    attributes[0].val.programmaticStreamSerializationAllowed = 1;
+
+    cudaLaunchConfig_t launch_config;
+    launch_config.gridDim = 1;
+    launch_config.blockDim = 1;
+    launch_config.dynamicSmemBytes = 0;
+    launch_config.stream = stream;
+    launch_config.attrs = attributes;
+    launch_config.numAttrs = launch_with_pdl ? 1 : 0;
+
+    return cudaLaunchKernelEx(
+        &launch_config,
+        cutlass::distributed::kernel::nvshmem_full_barrier_kernel<NumFlags, FlagType>,
+        self_flag_ptrs,
+        team);
+#else
+    return cudaErrorNotSupported;
+#endif
+  }
+
+  cudaError_t
+  get(void* local_ptr, void const* remote_ptr, size_t bytes, int peer_idx, cudaStream_t stream) const {
+    nvshmemx_getmem_on_stream(local_ptr, remote_ptr, bytes, get_pe(peer_idx), stream);
+    return cudaGetLastError();
+  }
+
+  template <int NP, typename FlagType>
+  cudaError_t
+  signal(cutlass::Array<FlagType*, NP> peer_flag_ptrs, int device_idx, cudaStream_t stream) const {
+#if ((__CUDACC_VER_MAJOR__ >= 12) && (__CUDACC_VER_MINOR__ >= 4))
+    cutlass::Array<int, NP> peer_pes;
+    for (int d = 0; d < NP; ++d) {
+      peer_pes[d] = get_pe(d);
+    }
+
+    cudaLaunchConfig_t launch_config;
+    launch_config.gridDim = 1;
+    launch_config.blockDim = 1;
+    launch_config.dynamicSmemBytes = 0;
+    launch_config.stream = stream;
+    launch_config.attrs = nullptr;
+    launch_config.numAttrs = 0;
+
+    return cudaLaunchKernelEx(
+        &launch_config,
+        cutlass::distributed::kernel::nvshmem_signal_arrival_kernel<NP, FlagType>,
+        peer_flag_ptrs,
+        peer_pes,
+        device_idx);
+#else
+    return cudaErrorNotSupported;
+#endif
+  }
+};
+
+} // namespace cutlass::distributed::device
+
+#endif // defined(CUTLASS_ENABLE_NVSHMEM)
@@ -0,0 +1,89 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM transports.
+
+    A transport performs the communication that the Distributed GEMM adapter schedules around the
+    local GEMM stages: the full barrier that starts a run, pulling slices of operands and outputs
+    from peers, and signaling peers. It is captured into the adapter's CUDA graph, so every call
+    must be stream-ordered and capturable.
+
+    PeerAccessTransport requires all devices to be peer-accessible (a single NVLink domain), and
+    is the only transport that supports schedules in which the GEMM kernels themselves access peer
+    memory (RemoteC and KernelWritesArrivalFlag). See nvshmem_transport.hpp for a transport that
+    spans nodes.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/device/arrival_flags.hpp"
+#include "cutlass/experimental/distributed/device/full_barrier.hpp"
+
+namespace cutlass::distributed::device {
+
+struct PeerAccessTransport {
+
+  // GEMM kernels may dereference peer pointers
+  static constexpr bool KernelPeerAccess = true;
+
+  // Clears this device's flags and waits for all peers to arrive
+  template <int NP, typename BarrierType, int NumFlags, typename FlagType>
+  cudaError_t
+  barrier(
+      cutlass::Array<BarrierType*, NP> device_barrier_ptrs,
+      cutlass::Array<FlagType*, NumFlags> self_flag_ptrs,
+      int device_idx,
+      cudaStream_t stream,
+      bool launch_with_pdl) const {
+    launch_full_barrier<NP, BarrierType, NumFlags, FlagType>(
+        device_barrier_ptrs, self_flag_ptrs, static_cast<BarrierType>(device_idx), stream, launch_with_pdl);
+    return cudaGetLastError();
+  }
+
+  // Copies bytes from peer memory at remote_ptr to local memory at local_ptr
+  cudaError_t
+  get(void* local_ptr, void const* remote_ptr, size_t bytes, [[maybe_unused]] int peer_idx, cudaStream_t stream) const {
+    return cudaMemcpyAsync(local_ptr, remote_ptr, bytes, cudaMemcpyDeviceToDevice, stream);
+  }
+
+  // Raises the flag of every peer once all prior work in the stream has completed
+  template <int NP, typename FlagType>
+  cudaError_t
+  signal(cutlass::Array<FlagType*, NP> peer_flag_ptrs, int device_idx, cudaStream_t stream) const {
+    launch_signal_arrival<NP, FlagType>(peer_flag_ptrs, device_idx, stream);
+    return cudaGetLastError();
+  }
+};
+
+} // namespace cutlass::distributed::device
+
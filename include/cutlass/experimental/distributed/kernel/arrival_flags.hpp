@@ -0,0 +1,75 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM arrival flag kernels.
+
+    Single-thread kernels that signal arrival flags in peers' exclusive workspaces, and spin-wait
+    on local ones. They order work that is not performed by a GEMM kernel, such as copies of
+    gathered outputs, with respect to GEMM stages on other devices.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/kernel/detail.hpp"
+
+namespace cutlass::distributed::kernel {
+
+template <int NP, typename FlagType>
+__global__ void signal_arrival_kernel(
+    cutlass::Array<FlagType*, NP> peer_flag_ptrs,
+    int device_idx) {
+
+  // Make all prior writes visible to peers before signaling
+  __threadfence_system();
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int d = 0; d < NP; ++d) {
+    if (d != device_idx) {
+      *reinterpret_cast<FlagType volatile*>(peer_flag_ptrs[d]) = static_cast<FlagType>(1);
+    }
+  }
+}
+
+template <typename FlagType>
+__global__ void wait_arrival_kernel(FlagType* flag_ptr) {
+
+  FlagType val = 0;
+  detail::ld_without_cache(val, flag_ptr);
+  while (val == 0) {
+    __nanosleep(40);
+    detail::ld_without_cache(val, flag_ptr);
+  }
+}
+
+} // namespace cutlass::distributed::kernel
+
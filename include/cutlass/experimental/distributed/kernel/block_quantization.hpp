@@ -0,0 +1,119 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM block quantization kernels.
+
+    Quantize slices of GEMM operands to a narrow transfer type (e.g. FP8) with one float scale per
+    block of contiguous elements before they are copied to peers, and dequantize received slices
+    back to the operand type. See QuantizedTransferSchedule.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+
+namespace cutlass::distributed::kernel {
+
+// One warp per block of BlockSize contiguous elements. Each block is scaled so that its largest
+// magnitude maps to the largest finite ElementQuant, which bounds the error of every element by the
+// rounding error of ElementQuant at the block's largest magnitude.
+template <typename ElementSrc, typename ElementQuant, int BlockSize>
+__global__ void block_quantize_kernel(
+    ElementSrc const* src,
+    ElementQuant* dst,
+    float* scales,
+    int64_t num_elements) {
+
+  static_assert(BlockSize % NumThreadsPerWarp == 0, "Quantization blocks must be a multiple of the warp size.");
+  constexpr int ElementsPerThread = BlockSize / NumThreadsPerWarp;
+
+  int lane_idx = threadIdx.x % NumThreadsPerWarp;
+  int64_t block_idx = (int64_t(blockIdx.x) * blockDim.x + threadIdx.x) / NumThreadsPerWarp;
+  int64_t block_offset = block_idx * BlockSize;
+  if (block_offset >= num_elements) {
+    return;
+  }
+
+  NumericConverter<float, ElementSrc> convert_src{};
+  NumericConverter<ElementQuant, float, FloatRoundStyle::round_to_nearest_satfinite> convert_quant{};
+
+  float values[ElementsPerThread];
+  float amax = 0.f;
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < ElementsPerThread; ++i) {
+    int64_t idx = block_offset + i * NumThreadsPerWarp + lane_idx;
+    values[i] = idx < num_elements ? convert_src(src[idx]) : 0.f;
+    amax = fmaxf(amax, fabsf(values[i]));
+  }
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int offset = NumThreadsPerWarp / 2; offset > 0; offset /= 2) {
+    amax = fmaxf(amax, __shfl_xor_sync(0xffffffff, amax, offset));
+  }
+
+  float quant_max = static_cast<float>(platform::numeric_limits<ElementQuant>::max());
+  float scale = amax > 0.f ? amax / quant_max : 1.f;
+  float scale_inv = amax > 0.f ? quant_max / amax : 1.f;
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < ElementsPerThread; ++i) {
+    int64_t idx = block_offset + i * NumThreadsPerWarp + lane_idx;
+    if (idx < num_elements) {
+      dst[idx] = convert_quant(values[i] * scale_inv);
+    }
+  }
+
+  if (lane_idx == 0) {
+    scales[block_idx] = scale;
+  }
+}
+
+template <typename ElementQuant, typename ElementDst, int BlockSize>
+__global__ void block_dequantize_kernel(
+    ElementQuant const* src,
+    float const* scales,
+    ElementDst* dst,
+    int64_t num_elements) {
+
+  NumericConverter<float, ElementQuant> convert_quant{};
+  NumericConverter<ElementDst, float> convert_dst{};
+
+  for (int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+       idx < num_elements;
+       idx += int64_t(gridDim.x) * blockDim.x) {
+    dst[idx] = convert_dst(convert_quant(src[idx]) * scales[idx / BlockSize]);
+  }
+}
+
+} // namespace cutlass::distributed::kernel
@@ -78,6 +78,9 @@ struct DistributedGemmKernelWrapper<
 
   static constexpr bool KernelWritesArrivalFlag = DistSchedule::KernelWritesArrivalFlag;
 
+  // Schedules that only read peers' inputs in place have nothing to wait on beyond the full barrier
+  static constexpr bool WaitsOnArrivalFlag = DistSchedule::HasMemcpy || KernelWritesArrivalFlag;
+
   using BaseKernel = GemmKernel_;
   using BaseArguments = typename BaseKernel::Arguments;
   using BaseParams = typename BaseKernel::Params;
@@ -181,7 +184,7 @@ struct DistributedGemmKernelWrapper<
   CUTLASS_DEVICE
   void
   barrier_buffer(PackedParams const& params) {
-    if (params.distributed.iteration > 0) {
+    if (WaitsOnArrivalFlag && params.distributed.iteration > 0) {
 
       ElementFlag comm_iter = 0;
       detail::ld_without_cache(comm_iter, params.distributed.self_flag_ptr_);
@@ -0,0 +1,189 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Expert-parallel all-to-all kernels surrounding a grouped expert GEMM.
+
+    See schedules/dist_moe_schedules.hpp for how they overlap with the grouped GEMM.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cutlass/experimental/distributed/kernel/detail.hpp"
+
+namespace cutlass::distributed::kernel {
+
+namespace detail {
+
+CUTLASS_DEVICE
+void st_release_sys(uint32_t* ptr, uint32_t val) {
+  asm volatile ("st.release.sys.global.u32 [%0], %1;\n" :: "l"(ptr), "r"(val) : "memory");
+}
+
+CUTLASS_DEVICE
+uint32_t ld_acquire_sys(uint32_t const* ptr) {
+  uint32_t val;
+  asm volatile ("ld.acquire.sys.global.u32 %0, [%1];\n" : "=r"(val) : "l"(ptr) : "memory");
+  return val;
+}
+
+} // namespace detail
+
+template <class Schedule, class Element>
+struct MoeDispatchParams {
+  static constexpr int TP = typename Schedule::TP{};
+
+  // Local tokens, [rows, hidden], sorted by chunk (destination peer, expert)
+  Element const* send_tokens = nullptr;
+  // First row and number of rows of each chunk in send_tokens, [Schedule::NumChunks]
+  int const* chunk_offsets = nullptr;
+  int const* chunk_counts = nullptr;
+
+  // Receive buffers and group arrival flags of all devices
+  cutlass::Array<Element*, TP> peer_recv_tokens;
+  cutlass::Array<uint32_t*, TP> peer_arrival_flags;
+
+  int hidden = 0;
+  int capacity = 0;
+  int device_idx = 0;
+  uint32_t epoch = 1;
+};
+
+// One CTA per chunk. Copies the chunk's tokens into its group at the destination, then publishes
+// the group. Requires rows of 16B multiples.
+template <class Schedule, class Element>
+__global__ void moe_dispatch_kernel(MoeDispatchParams<Schedule, Element> params) {
+
+  int chunk_idx = Schedule::get_dispatch_chunk_idx(params.device_idx, blockIdx.x);
+  int dest_peer = chunk_idx / Schedule::NumLocalExperts;
+  int local_expert = chunk_idx % Schedule::NumLocalExperts;
+  int group_idx = Schedule::get_group_idx(dest_peer, params.device_idx, local_expert);
+
+  int rows = params.chunk_counts[chunk_idx];
+  Element const* src = params.send_tokens + static_cast<size_t>(params.chunk_offsets[chunk_idx]) * params.hidden;
+  Element* dst = params.peer_recv_tokens[dest_peer] +
+    Schedule::get_recv_offset(group_idx, params.capacity, params.hidden);
+
+  size_t vectors = static_cast<size_t>(rows) * params.hidden * sizeof(Element) / sizeof(uint4);
+  uint4 const* src_vec = reinterpret_cast<uint4 const*>(src);
+  uint4* dst_vec = reinterpret_cast<uint4*>(dst);
+  for (size_t i = threadIdx.x; i < vectors; i += blockDim.x) {
+    dst_vec[i] = src_vec[i];
+  }
+
+  // Make all of the CTA's writes visible to the destination before publishing the group
+  __threadfence_system();
+  __syncthreads();
+
+  if (threadIdx.x == 0) {
+    detail::st_release_sys(params.peer_arrival_flags[dest_peer] + group_idx, params.epoch);
+  }
+}
+
+// Raises this device's flag at every device once all prior work in the stream has completed.
+// Launched after the grouped GEMM, whose epilogues store into peers' return buffers.
+template <int NP>
+__global__ void moe_signal_kernel(
+    cutlass::Array<uint32_t*, NP> peer_flag_ptrs,
+    int device_idx,
+    uint32_t epoch) {
+
+  __threadfence_system();
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int d = 0; d < NP; ++d) {
+    detail::st_release_sys(peer_flag_ptrs[d] + device_idx, epoch);
+  }
+}
+
+template <class Schedule, class Element, class ElementOutput>
+struct MoeCombineParams {
+  static constexpr int TP = typename Schedule::TP{};
+
+  // Local return buffer, [Schedule::NumChunks, capacity, hidden]
+  Element const* returned = nullptr;
+  // Row of each (token, k) in the return buffer, and its router weight, [num_tokens, topk].
+  // Rows are chunk_idx * capacity + row of the token within the chunk; negative rows are skipped.
+  int const* token_rows = nullptr;
+  float const* token_weights = nullptr;
+
+  // Combined output, [num_tokens, hidden]
+  ElementOutput* output = nullptr;
+
+  // Raised by each expert device once its outputs for this device are in place, [TP]
+  uint32_t const* combine_flags = nullptr;
+
+  int num_tokens = 0;
+  int topk = 0;
+  int hidden = 0;
+  uint32_t epoch = 1;
+};
+
+template <class Schedule, class Element, class ElementOutput>
+__global__ void moe_combine_kernel(MoeCombineParams<Schedule, Element, ElementOutput> params) {
+
+  using Params = MoeCombineParams<Schedule, Element, ElementOutput>;
+
+  if (threadIdx.x == 0) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int d = 0; d < Params::TP; ++d) {
+      while (static_cast<int32_t>(detail::ld_acquire_sys(params.combine_flags + d) - params.epoch) < 0) {
+        __nanosleep(40);
+      }
+    }
+  }
+  __syncthreads();
+
+  NumericConverter<float, Element> to_float;
+  NumericConverter<ElementOutput, float> to_output;
+
+  size_t elements = static_cast<size_t>(params.num_tokens) * params.hidden;
+  for (size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x; i < elements; i += gridDim.x * size_t(blockDim.x)) {
+    size_t token = i / params.hidden;
+    size_t col = i - token * params.hidden;
+
+    float acc = 0.f;
+    for (int k = 0; k < params.topk; ++k) {
+      int row = params.token_rows[token * params.topk + k];
+      if (row >= 0) {
+        acc += params.token_weights[token * params.topk + k] *
+               to_float(params.returned[static_cast<size_t>(row) * params.hidden + col]);
+      }
+    }
+    params.output[i] = to_output(acc);
+  }
+}
+
+} // namespace cutlass::distributed::kernel
+
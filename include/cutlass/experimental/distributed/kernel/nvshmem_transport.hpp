@@ -0,0 +1,91 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM kernels for the NVSHMEM transport.
+
+    Counterparts of the full barrier and arrival flag kernels for peers that are not directly
+    addressable, e.g. devices on another node. Require NVSHMEM device code to be linked in, which
+    in turn requires relocatable device code.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/grid_dependency_control.h"
+
+#include <nvshmem.h>
+#include <nvshmemx.h>
+
+namespace cutlass::distributed::kernel {
+
+template <int Iterations, typename FlagType>
+__global__ void nvshmem_full_barrier_kernel(
+    cutlass::Array<FlagType*, Iterations> iteration_flag_ptrs,
+    nvshmem_team_t team) {
+
+  arch::launch_dependent_grids();
+  arch::wait_on_dependent_grids();
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < Iterations; ++i) {
+    iteration_flag_ptrs[i][0] = static_cast<FlagType>(0);
+  }
+
+  // Flags must be cleared before any peer can raise them again
+  __threadfence_system();
+  nvshmem_barrier(team);
+}
+
+template <int NP, typename FlagType>
+__global__ void nvshmem_signal_arrival_kernel(
+    cutlass::Array<FlagType*, NP> peer_flag_ptrs,
+    cutlass::Array<int, NP> peer_pes,
+    int device_idx) {
+
+  static_assert(sizeof(FlagType) == sizeof(uint32_t), "NVSHMEM arrival flags are 32-bit.");
+
+  // Make all prior writes visible to peers before signaling
+  __threadfence_system();
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int d = 0; d < NP; ++d) {
+    if (d != device_idx) {
+      nvshmem_uint32_atomic_set(
+          reinterpret_cast<uint32_t*>(peer_flag_ptrs[d]),
+          1u,
+          peer_pes[d]);
+    }
+  }
+  nvshmem_quiet();
+}
+
+} // namespace cutlass::distributed::kernel
+
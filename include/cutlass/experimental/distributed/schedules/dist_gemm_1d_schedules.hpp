@@ -185,6 +185,46 @@ struct ReduceScatter1D_TilingB_RotatingC: BaseSchedule<
     /* NumBuffersD_  = */ TP_{} - 1> {};
 
 
+// GEMM + All Reduce
+// All-reduce is implemented as the reduce-scatter schedule above followed by an all-gather of the
+// reduced slices. Tiling, iteration mappings and buffers are identical to
+// ReduceScatter1D_TilingA_RotatingC, but every GPU holds the full [M, N] tensor D.
+//
+// In its last iteration, each GPU writes its fully reduced [M / TP, N] slice directly into its own
+// D, at the row of tiles it owns. Each remaining slice is then copied from the D of the GPU owning
+// it as soon as that GPU's last iteration completes:
+//
+//              Tensor D                            Tensor D               
+//         (after reduce-scatter)                (after all-gather)       
+//                                                                        
+//      |-----------------------|           |-----------------------|     
+//      |                       |           |                       |     
+//      |         GPU0          |           |      GPU0 (local)     |     
+//      |_______________________|           |_______________________|     
+//      |                       |           |                       |     
+//      |         GPU1          |           |     copy from GPU1    |     
+//      |_______________________|           |_______________________|     
+//      |                       |           |                       |     
+//      |         GPU2          |           |     copy from GPU2    |     
+//      |_______________________|           |_______________________|     
+//      |                       |           |                       |     
+//      |         GPU3          |           |     copy from GPU3    |     
+//      |_______________________|           |_______________________|     
+//                                                                        
+//              (GPU0's view)  M x N                (GPU0's view)  M x N
+//
+//  Because gathered slices are copied with a single memcpy each, slices of D along M must be
+//  contiguous, which means D must be row-major.
+//
+template <class TP_>
+struct AllReduce1D_TilingA_RotatingC: GatheredOutputSchedule<ReduceScatter1D_TilingA_RotatingC<TP_>> {};
+
+// This schedule is similar to AllReduce1D_TilingA_RotatingC, but with the second tiling
+// done along N instead of M, which means D must be column-major. All other details remain unchanged.
+template <class TP_>
+struct AllReduce1D_TilingB_RotatingC: GatheredOutputSchedule<ReduceScatter1D_TilingB_RotatingC<TP_>> {};
+
+
 // AllGather + GEMM
 // A and B are tiled along the N mode, which means each GPU allgathers A,
 // and operates with an [N / TP, K] slice of B.
@@ -317,6 +357,24 @@ struct AllGather1D_TilingCD_RotatingB: BaseSchedule<
     /* NumBuffersC_ = */ 0,
     /* NumBuffersD_ = */ 0>{};
 
+// Variants of the all-gather schedules above in which each stage/iteration's GEMM loads the
+// peer's slice of A (B) directly over NVLink, instead of waiting on a memcpy into a local buffer
+// issued during the previous stage/iteration. See DirectPeerSchedule.
+template <class TP_>
+struct AllGather1D_TilingCD_DirectA: DirectPeerSchedule<AllGather1D_TilingCD_RotatingA<TP_>> {};
+
+template <class TP_>
+struct AllGather1D_TilingCD_DirectB: DirectPeerSchedule<AllGather1D_TilingCD_RotatingB<TP_>> {};
+
+// Variants of the all-gather schedules above in which the slices of A (B) copied from peers are
+// quantized to FP8 with per-block scales, and dequantized into the local buffer before the
+// stage/iteration that reads them. See QuantizedTransferSchedule.
+template <class TP_, class ElementTransfer_ = cutlass::float_e4m3_t>
+struct AllGather1D_TilingCD_QuantizedA: QuantizedTransferSchedule<AllGather1D_TilingCD_RotatingA<TP_>, ElementTransfer_> {};
+
+template <class TP_, class ElementTransfer_ = cutlass::float_e4m3_t>
+struct AllGather1D_TilingCD_QuantizedB: QuantizedTransferSchedule<AllGather1D_TilingCD_RotatingB<TP_>, ElementTransfer_> {};
+
 
 } // namespace cutlass::distributed::schedules
 
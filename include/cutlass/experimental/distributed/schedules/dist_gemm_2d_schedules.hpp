@@ -0,0 +1,200 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file 2-D Distributed GEMM Schedules
+
+  NOTE: This API is __experimental__ and will change heavily over time.
+  Please proceed with caution when modifying these schedules or defining new ones.
+
+  2-D schedules arrange TP GPUs in a square mesh of Mesh x Mesh GPUs, where Mesh = sqrt(TP).
+  GPU (row, col) has device index row + Mesh * col, and owns tile (row, col) of C and D.
+
+  Unlike 1-D schedules, operands are communicated along both rows and columns of the mesh, and the
+  number of stages/iterations is Mesh instead of TP. Each GPU therefore exchanges
+  O(TP / sqrt(TP)) = O(sqrt(TP)) slices of A and B instead of O(TP) slices of A or B.
+
+  Peer mappings require modular arithmetic along each mode of the mesh, which can't be expressed
+  with the linear CuTe layouts used by 1-D schedules. They are instead implemented directly by
+  overriding the respective BaseSchedule methods.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/schedules/dist_gemm_base_schedule.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::schedules {
+
+namespace detail {
+
+// Returns floor(sqrt(tp))
+constexpr int
+square_mesh_size(int tp) {
+  int mesh = 1;
+  while ((mesh + 1) * (mesh + 1) <= tp) {
+    ++mesh;
+  }
+  return mesh;
+}
+
+template <class TP_, class Mesh_ = cute::Int<square_mesh_size(TP_{})>>
+using AllGather2DBaseSchedule = BaseSchedule<
+    TP_,
+    /* ProcessorTiler_ = */ cute::Shape<Mesh_, Mesh_, Mesh_, _1>,
+    /* IterationTiler_ = */ cute::Shape<_1, _1, _1, _1>,
+    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, Mesh_>, cute::Stride<_0, _0>>,                           // unused, see get_remote_peer_id_{a,b}
+    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, Mesh_>, cute::Stride<_0, _0>>,                           // (IterationTiler::M == 1) = 0
+    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, Mesh_>, cute::Stride<_0, _0>>,                           // (IterationTiler::N == 1) = 0
+    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, Mesh_>, cute::Stride<_0, _0>>,                           // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, Mesh_>, cute::Stride<_0, _0>>,                           // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ _0,
+    /* MemcpyA_ = */ true,
+    /* MemcpyB_ = */ true,
+    /* KernelWritesArrivalFlag_ = */ false,
+    /* NumBuffersA_ = */ Mesh_{} - 1,
+    /* NumBuffersB_ = */ Mesh_{} - 1,
+    /* NumBuffersC_ = */ 0,
+    /* NumBuffersD_ = */ 0>;
+
+} // namespace detail
+
+// AllGather + GEMM over a 2-D mesh (SUMMA with Cannon's initial skew)
+// A is tiled along M and K, B is tiled along N and K, and C/D are tiled along M and N, each
+// into Mesh tiles per mode. GPU (row, col) owns A tile (row, k0), B tile (col, k0) and C/D tile
+// (row, col), where k0 = (row + col) % Mesh is skewed so that every K tile of A is owned by
+// exactly one GPU in each mesh row, and every K tile of B by exactly one GPU in each mesh column.
+//
+// Each stage/iteration computes a GEMM of shape [M / Mesh, N / Mesh, K / Mesh] over K tile
+//   k = (row + col + iter) % Mesh
+// and accumulates it into the local D, while the next A tile is copied from the GPU owning it in
+// the same mesh row, and the next B tile from the GPU owning it in the same mesh column:
+//   A peer = (row, (col + iter) % Mesh)
+//   B peer = ((row + iter) % Mesh, col)
+//
+// Below is an illustration of the K tiles accessed by each GPU in the TP=4 (2 x 2 mesh) case:
+//
+//                  iter 0                           iter 1               
+//                                                                        
+//             col 0       col 1                col 0       col 1         
+//          |-----------|-----------|        |-----------|-----------|    
+//          |           |           |        |           |           |    
+//   row 0  |   k = 0   |   k = 1   |        |   k = 1   |   k = 0   |    
+//          |  (local)  |  (local)  |        | A from 2, | A from 0, |    
+//          |           |           |        | B from 1  | B from 3  |    
+//          |___________|___________|        |___________|___________|    
+//          |           |           |        |           |           |    
+//   row 1  |   k = 1   |   k = 0   |        |   k = 0   |   k = 1   |    
+//          |  (local)  |  (local)  |        | A from 3, | A from 1, |    
+//          |           |           |        | B from 0  | B from 2  |    
+//          |___________|___________|        |___________|___________|    
+//                                                                        
+//  Device indices: (row 0, col 0) = 0, (row 1, col 0) = 1, (row 0, col 1) = 2, (row 1, col 1) = 3
+//
+//  Note: D is accumulated locally, so the epilogue of iterations > 0 reads its C tensor from the
+//  local D tensor with beta = 1. This requires C and D to share the same element type and stride.
+//
+template <class TP_>
+struct AllGather2D_TilingCD_RotatingAB: detail::AllGather2DBaseSchedule<TP_> {
+
+  using Base = detail::AllGather2DBaseSchedule<TP_>;
+  using TP = typename Base::TP;
+  using ProcessorTiler = typename Base::ProcessorTiler;
+
+  static constexpr int Mesh = detail::square_mesh_size(TP{});
+  static_assert(Mesh * Mesh == TP{}, "2-D schedules require TP to be a perfect square.");
+  static_assert(Mesh > 1, "2-D schedules require at least a 2 x 2 mesh.");
+
+  static constexpr int NumIterations = Mesh;
+  static constexpr bool AccumulateD = true;
+
+  // Mesh coordinates of a device
+  static int
+  get_mesh_row(int device_idx) {
+    return device_idx % Mesh;
+  }
+
+  static int
+  get_mesh_col(int device_idx) {
+    return device_idx / Mesh;
+  }
+
+  static int
+  get_mesh_device_idx(int row, int col) {
+    return row + Mesh * col;
+  }
+
+  // K tile multiplied by a device in a given iteration
+  static int
+  get_k_tile_idx(int device_idx, int iteration) {
+    return (get_mesh_row(device_idx) + get_mesh_col(device_idx) + iteration) % Mesh;
+  }
+
+  // A tiles rotate along mesh rows
+  static int
+  get_remote_peer_id_a(int device_idx, int iteration) {
+    return get_mesh_device_idx(
+        get_mesh_row(device_idx),
+        (get_mesh_col(device_idx) + iteration) % Mesh);
+  }
+
+  // B tiles rotate along mesh columns
+  static int
+  get_remote_peer_id_b(int device_idx, int iteration) {
+    return get_mesh_device_idx(
+        (get_mesh_row(device_idx) + iteration) % Mesh,
+        get_mesh_col(device_idx));
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_A(Tensor tensor, int device_idx) {
+    auto tiler = shape_div(tensor.shape(), select<0,2,3>(ProcessorTiler{}));
+    auto idx = make_coord(get_mesh_row(device_idx), get_k_tile_idx(device_idx, 0), 0);
+    return inner_partition(tensor, tiler, idx);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_B(Tensor tensor, int device_idx) {
+    auto tiler = shape_div(tensor.shape(), select<1,2,3>(ProcessorTiler{}));
+    auto idx = make_coord(get_mesh_col(device_idx), get_k_tile_idx(device_idx, 0), 0);
+    return inner_partition(tensor, tiler, idx);
+  }
+};
+
+} // namespace cutlass::distributed::schedules
+
+///////////////////////////////////////////////////////////////////////////////
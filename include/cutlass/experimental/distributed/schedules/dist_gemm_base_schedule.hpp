@@ -45,6 +45,7 @@
 #include "cute/layout.hpp"
 #include "cute/tensor.hpp"
 #include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -121,11 +122,13 @@ struct BaseSchedule {
   static constexpr int NumBuffersC = NumBuffersC_;
   static constexpr int NumBuffersD = NumBuffersD_;
 
+  // Only exception: A and B can be buffered together, since they are both memcpied.
   static_assert(
-      NumBuffersA > 0 ^ 
+      (NumBuffersA > 0 && NumBuffersB > 0 && NumBuffersC == 0 && NumBuffersD == 0) ||
+      (NumBuffersA > 0 ^ 
       NumBuffersB > 0 ^ 
       NumBuffersC > 0 ^ 
-      NumBuffersD > 0,
+      NumBuffersD > 0),
       "Only one of the ABCD tensors can be buffered!");
 
   static constexpr bool BufferedOutput = NumBuffersC > 0 || NumBuffersD > 0;
@@ -134,6 +137,26 @@ struct BaseSchedule {
 
   static_assert(not RemoteD, "Remote D is not supported yet.");
 
+  // Whether the output is all-gathered after the last stage/iteration (see GatheredOutputSchedule.)
+  static constexpr bool GatherOutput = false;
+
+  // Whether stages/iterations > 0 read A or B directly from a peer's tensor (see DirectPeerSchedule.)
+  static constexpr bool DirectPeerA = false;
+  static constexpr bool DirectPeerB = false;
+
+  // Whether slices of memcpied operands are quantized to ElementTransfer, with one scale per
+  // TransferBlockSize elements, for the copy between devices (see QuantizedTransferSchedule.)
+  static constexpr bool QuantizedTransfer = false;
+  using ElementTransfer = void;
+  static constexpr int TransferBlockSize = 0;
+
+  // Number of stages/iterations. Schedules in which it differs from TP must override it.
+  static constexpr int NumIterations = TP{};
+
+  // Whether stages/iterations > 0 accumulate into the local D tensor (C = D, beta = 1) instead of
+  // writing a new tile of D.
+  static constexpr bool AccumulateD = false;
+
   // Host-side API: can_implement based on the GLOBAL problem shape
   template <typename ProblemShape>
   static bool
@@ -183,6 +206,18 @@ struct BaseSchedule {
     return peer_idx;
   }
 
+  // Determines the peers from which A and B are memcpied, given device index and iteration.
+  // Schedules that memcpy both A and B from different peers must override these.
+  static int
+  get_remote_peer_id_a(int device_idx, int iteration) {
+    return get_remote_peer_id(device_idx, iteration);
+  }
+
+  static int
+  get_remote_peer_id_b(int device_idx, int iteration) {
+    return get_remote_peer_id(device_idx, iteration);
+  }
+
   // Construct tilers and index mappers for sharding across processors
   template <typename Tensor>
   CUTLASS_HOST_DEVICE
@@ -497,6 +532,14 @@ struct BaseSchedule {
     }
   }
 
+  // Shape of each buffer for tensor D; the local shape of D when D is not gathered.
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_d_buffer_shape(ProblemShape problem_shape) {
+    return get_local_d_shape(problem_shape);
+  }
+
   // Host-side APIs: get_device_slice_{A,B,C,D}
   // Slice off a view of the GLOBAL tensor that corresponds to the shard that 
   // is going to be owned by a specific device. This helps with the initial 
@@ -530,7 +573,138 @@ struct BaseSchedule {
   }
 };
 
+/*
+ * GatheredOutputSchedule extends a reduce-scatter schedule into an all-reduce.
+ *
+ * Stages/iterations are unchanged, but every device holds the full, replicated D tensor instead of
+ * its shard. The last stage/iteration writes the device's fully reduced slice of D in place, and
+ * the device adapter then gathers the remaining slices directly from peers' D tensors. Each slice
+ * is gated on its own arrival flag, which the owning device raises as soon as its last stage
+ * completes, so slices are copied as they become available instead of after a full barrier.
+ */
+template <class ReduceScatterSchedule_>
+struct GatheredOutputSchedule: ReduceScatterSchedule_ {
+
+  using Base = ReduceScatterSchedule_;
+  using TP = typename Base::TP;
+  using ProcessorTiler = typename Base::ProcessorTiler;
+  using IterationTiler = typename Base::IterationTiler;
+
+  static_assert(Base::RemoteC, "Only reduce-scatter schedules (remote C) can gather their output.");
+  static_assert(cute::size(cute::select<0,1,3>(ProcessorTiler{})) == 1,
+      "Gathered outputs must not be sharded across processors.");
+
+  static constexpr bool GatherOutput = true;
+
+  // D is replicated: each device holds the full output tensor
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_local_d_shape(ProblemShape problem_shape) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return shape_div(
+          select<0,1,3>(problem_shape_MNKL),
+          select<0,1,3>(ProcessorTiler{}));
+  }
+
+  // Buffers only hold partial results for a single slice of D
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_d_buffer_shape(ProblemShape problem_shape) {
+    return Base::get_local_d_shape(problem_shape);
+  }
 
+  // Slice of the full D tensor that is fully reduced by a given device in the last iteration
+  template <typename Tensor>
+  static auto
+  get_gathered_slice_D(Tensor tensor, int owner_device_idx) {
+    auto tiler = shape_div(tensor.shape(), select<0,1,3>(IterationTiler{}));
+    auto idx = Base::get_device_tile_idx_d(owner_device_idx, TP{} - 1);
+    return inner_partition(tensor, tiler, idx);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_tensor_D(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    auto tensor = get_gathered_slice_D(original_tensor, device_idx);
+    return Base::get_tensor_D(tensor, tensor_buffer_ptr, device_idx, iteration);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_D(Tensor tensor, int device_idx) {
+    return tensor;
+  }
+};
+
+/*
+ * DirectPeerSchedule turns an all-gather schedule, which memcpies slices of A and/or B from peers
+ * into local buffers, into one whose GEMM kernels load those slices straight from the peers'
+ * tensors.
+ *
+ * Stages/iterations and peer mappings are unchanged, but there are no copies, no buffers for the
+ * rotated operands, and no arrival flags: peers' A and B are only read, and are ready as soon as
+ * the full barrier that starts the run completes. TMA loads then stream each slice over NVLink
+ * tile by tile, overlapping communication with the MMAs of the same stage instead of the previous
+ * one. Requires all devices to be peer-accessible.
+ */
+template <class AllGatherSchedule_>
+struct DirectPeerSchedule: AllGatherSchedule_ {
+
+  using Base = AllGatherSchedule_;
+
+  static_assert(Base::HasMemcpy && not Base::KernelWritesArrivalFlag && not Base::BufferedOutput,
+      "Only all-gather schedules (memcpied A and/or B) can access peers directly.");
+
+  // Operands read from peers' tensors in stages/iterations > 0
+  static constexpr bool DirectPeerA = Base::MemcpyA;
+  static constexpr bool DirectPeerB = Base::MemcpyB;
+
+  static constexpr bool MemcpyA = false;
+  static constexpr bool MemcpyB = false;
+  static constexpr bool HasMemcpy = false;
+
+  // Peer slices are not staged locally. The tensor shapes still follow the base schedule.
+  static constexpr int NumBuffersA = 0;
+  static constexpr int NumBuffersB = 0;
+};
+
+/*
+ * QuantizedTransferSchedule compresses the slices of A and/or B that an all-gather schedule copies
+ * between devices.
+ *
+ * Stages/iterations, peer mappings and buffers are unchanged. After the full barrier that starts a
+ * run, each device quantizes its own slices to ElementTransfer (FP8 by default) with one float
+ * scale per TransferBlockSize contiguous elements, and signals its peers. Each stage/iteration > 0
+ * then copies the quantized slice and its scales from the peer, and dequantizes them into the local
+ * buffer read by the stage's GEMM before raising the stage's arrival flag. For 16-bit operands
+ * this roughly halves the bytes moved between devices.
+ *
+ * Each block is scaled so that its largest magnitude maps to the largest finite ElementTransfer,
+ * which bounds the error of every element by the rounding error of ElementTransfer at that
+ * magnitude. Only peers' slices are affected; the first stage/iteration reads the local slice at
+ * full precision.
+ */
+template <
+  class AllGatherSchedule_,
+  class ElementTransfer_ = cutlass::float_e4m3_t,
+  int TransferBlockSize_ = 128>
+struct QuantizedTransferSchedule: AllGatherSchedule_ {
+
+  using Base = AllGatherSchedule_;
+
+  static_assert(Base::HasMemcpy && not Base::KernelWritesArrivalFlag && not Base::BufferedOutput,
+      "Only all-gather schedules (memcpied A and/or B) can quantize their transfers.");
+  static_assert(TransferBlockSize_ > 0 && TransferBlockSize_ % 32 == 0,
+      "Quantization blocks must be a multiple of 32 elements.");
+
+  static constexpr bool QuantizedTransfer = true;
+  using ElementTransfer = ElementTransfer_;
+  static constexpr int TransferBlockSize = TransferBlockSize_;
+};
 
 } // namespace cutlass::gemm::distributed
 
@@ -0,0 +1,157 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file Expert-parallel Distributed GEMM Schedules
+
+  NOTE: This API is __experimental__ and will change heavily over time.
+
+  In expert-parallel Mixture-of-Experts layers, each of the TP GPUs owns NumLocalExperts experts.
+  Tokens are dispatched to the GPUs owning their experts (all-to-all), multiplied by the expert
+  weights with a grouped GEMM, and returned to the GPUs they came from, where the top-k expert
+  outputs of each token are combined with the router weights.
+
+  ExpertParallelAllToAll overlaps all three phases:
+
+    * Dispatch (kernel/moe_all_to_all.hpp) pushes each (destination GPU, expert) chunk of tokens
+      straight into the destination's receive buffer, and raises the arrival flag of the group it
+      feeds there.
+
+    * The grouped GEMM uses GroupArrivalScheduler with those flags, so that the tiles of a group
+      start as soon as its tokens have arrived. A GPU's own tokens form its first groups, followed by
+      those of its peers in ring order, which is the order dispatch sends them in.
+
+    * The epilogue of each group stores D straight into the return buffer of the GPU the tokens came
+      from. Once its grouped GEMM has completed, a GPU signals all peers, and the combine kernel
+      reduces the returned rows of each token.
+
+  Grouped GEMM layout on every GPU: group g multiplies the tokens of source peer get_source_peer(g)
+  for local expert get_local_expert(g). Its A starts at get_recv_offset(g) elements into the receive
+  buffer, and its D at get_return_offset(device_idx, expert) elements into the source peer's return
+  buffer. Each (peer, expert) chunk holds at most `capacity` tokens.
+
+  Token counts per chunk must be exchanged before the grouped GEMM is launched, since problem shapes
+  are final at launch. Receive buffers, return buffers and flags must be peer-accessible.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cutlass/cutlass.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::schedules {
+
+template <class TP_, int NumLocalExperts_>
+struct ExpertParallelAllToAll {
+
+  using TP = TP_;
+
+  static_assert(
+      cute::is_static<TP>::value && cute::is_integral<TP>::value && cute::rank(TP{}) == 1 && cute::depth(TP{}) == 0,
+      "Only integers allowed for TP at this time.");
+  static_assert(NumLocalExperts_ > 0, "At least one expert per device is required.");
+
+  static constexpr int NumLocalExperts = NumLocalExperts_;
+
+  // Groups of the local grouped GEMM: one per (source peer, local expert)
+  static constexpr int NumGroups = TP{} * NumLocalExperts;
+
+  // Chunks of tokens sent by each device: one per (destination peer, expert of the destination)
+  static constexpr int NumChunks = TP{} * NumLocalExperts;
+
+  // Peers' tokens are processed in ring order, starting with the device's own tokens
+  CUTLASS_HOST_DEVICE
+  static int
+  get_source_peer(int device_idx, int group_idx) {
+    int step = group_idx / NumLocalExperts;
+    return (device_idx - step + TP{}) % TP{};
+  }
+
+  CUTLASS_HOST_DEVICE
+  static int
+  get_local_expert(int group_idx) {
+    return group_idx % NumLocalExperts;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static int
+  get_group_idx(int device_idx, int source_peer, int local_expert) {
+    int step = (device_idx - source_peer + TP{}) % TP{};
+    return step * NumLocalExperts + local_expert;
+  }
+
+  // Chunks are ordered by destination peer, then by expert
+  CUTLASS_HOST_DEVICE
+  static int
+  get_chunk_idx(int dest_peer, int local_expert) {
+    return dest_peer * NumLocalExperts + local_expert;
+  }
+
+  // Chunk sent in a given step of the dispatch. Each step sends to the peer whose groups for this
+  // device come after the same number of other peers' groups.
+  CUTLASS_HOST_DEVICE
+  static int
+  get_dispatch_chunk_idx(int device_idx, int dispatch_idx) {
+    int step = dispatch_idx / NumLocalExperts;
+    int dest_peer = (device_idx + step) % TP{};
+    return get_chunk_idx(dest_peer, dispatch_idx % NumLocalExperts);
+  }
+
+  // Offset of a group's tokens in the receive buffer, [NumGroups, capacity, hidden]
+  CUTLASS_HOST_DEVICE
+  static size_t
+  get_recv_offset(int group_idx, int capacity, int hidden) {
+    return static_cast<size_t>(group_idx) * capacity * hidden;
+  }
+
+  // Offset of a chunk's outputs in the return buffer of the device that sent it,
+  // [NumChunks, capacity, output_hidden]
+  CUTLASS_HOST_DEVICE
+  static size_t
+  get_return_offset(int expert_device_idx, int local_expert, int capacity, int output_hidden) {
+    return static_cast<size_t>(get_chunk_idx(expert_device_idx, local_expert)) * capacity * output_hidden;
+  }
+
+  static size_t
+  get_recv_buffer_size(int capacity, int hidden) {
+    return static_cast<size_t>(NumGroups) * capacity * hidden;
+  }
+
+  static size_t
+  get_return_buffer_size(int capacity, int output_hidden) {
+    return static_cast<size_t>(NumChunks) * capacity * output_hidden;
+  }
+};
+
+} // namespace cutlass::distributed::schedules
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,733 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+    \file
+    \brief Defines FP4 and FP6 storage types (E2M1, E3M2, E2M3) and the E8M0 shared-scale type
+      used by microscaling (MX) formats.
+
+    These are storage formats: arithmetic is performed by converting to float. None of the
+    narrow types encode infinity or NaN, so conversions from float saturate to the largest
+    finite magnitude. FP4 values pack two per byte; FP6 values occupy one byte each with the
+    two most significant bits unused.
+*/
+
+#pragma once
+
+#ifdef __GNUC__
+// Ignore checks on reinterpret-casts that are being used for bitcasts.
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__CUDACC_RTC__)
+
+#include "cutlass/floating_point_nvrtc.h"
+
+#else
+//
+// Standard Library headers belong here to avoid conflicts with NVRTC.
+//
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#endif
+
+#include <cuda_fp16.h>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_size.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Sub-byte floating point encodings (sign | exponent | mantissa), no infinity or NaN:
+//
+//  E2M1 : 3  |  2 1  |  0
+//  E3M2 : 5  |  4 3 2  |  1 0
+//  E2M3 : 5  |  4 3  |  2 1 0
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <int ExponentBits, int MantissaBits>
+struct alignas(1) float_subbyte {
+
+  static_assert(ExponentBits >= 1 && MantissaBits >= 1 && 1 + ExponentBits + MantissaBits <= 8,
+    "float_subbyte encodes at most 8 bits.");
+
+  static constexpr int NUM_BITS = 1 + ExponentBits + MantissaBits;
+  static constexpr int NUM_EXPONENT_BITS = ExponentBits;
+  static constexpr int NUM_MANTISSA_BITS = MantissaBits;
+  static constexpr int EXPONENT_BIAS = (1 << (ExponentBits - 1)) - 1;
+
+  static constexpr uint8_t EXPONENT_MASK = (1 << ExponentBits) - 1;
+  static constexpr uint8_t MANTISSA_MASK = (1 << MantissaBits) - 1;
+  static constexpr uint8_t SIGN_MASK = uint8_t(1 << (ExponentBits + MantissaBits));
+
+  /// Largest finite magnitude: all exponent and mantissa bits set
+  static constexpr uint8_t MAX_FLT = uint8_t(SIGN_MASK - 1);
+
+  static constexpr int FP32_NUM_MANTISSA_BITS = 23;
+  static constexpr int FP32_EXPONENT_BIAS = 127;
+
+  /// Largest finite magnitude encoded as float bits
+  static constexpr uint32_t MAX_FLT_FP32 =
+    (uint32_t(EXPONENT_MASK - EXPONENT_BIAS + FP32_EXPONENT_BIAS) << FP32_NUM_MANTISSA_BITS) |
+    (uint32_t(MANTISSA_MASK) << (FP32_NUM_MANTISSA_BITS - MantissaBits));
+
+  /// Smallest normal magnitude encoded as float bits
+  static constexpr uint32_t MIN_NORMAL_FP32 =
+    uint32_t(1 - EXPONENT_BIAS + FP32_EXPONENT_BIAS) << FP32_NUM_MANTISSA_BITS;
+
+  //
+  // Data members
+  //
+
+  /// Data container
+  uint8_t storage;
+
+  //
+  // Static conversion operators
+  //
+
+  /// Constructs from an uint8_t
+  CUTLASS_HOST_DEVICE
+  static float_subbyte bitcast(uint8_t x) {
+    float_subbyte f;
+    f.storage = x;
+    return f;
+  }
+
+  /// Converts a float to the sub-byte encoding - rounds to nearest even and saturates
+  CUTLASS_HOST_DEVICE
+  static uint8_t convert_float_to_bits(float const& flt) {
+
+  #if defined(__CUDA_ARCH__)
+    uint32_t s = reinterpret_cast<uint32_t const &>(flt);
+  #else
+    uint32_t s;
+    std::memcpy(&s, &flt, sizeof(s));
+  #endif
+
+    uint8_t sign = (s >> 31) ? SIGN_MASK : uint8_t(0);
+    uint32_t abs = s & 0x7fffffff;
+
+    // Infinity, NaN and everything beyond the largest finite value saturate
+    if (abs >= MAX_FLT_FP32) {
+      return uint8_t(sign | MAX_FLT);
+    }
+
+    if (abs >= MIN_NORMAL_FP32) {
+      // Normal: round the float mantissa to MantissaBits, then rebias the exponent
+      int constexpr kShift = FP32_NUM_MANTISSA_BITS - MantissaBits;
+      uint32_t rounded = abs + ((1u << (kShift - 1)) - 1) + ((abs >> kShift) & 1);
+      uint32_t u = (rounded >> kShift) - (uint32_t(FP32_EXPONENT_BIAS - EXPONENT_BIAS) << MantissaBits);
+      return uint8_t(sign | (u > MAX_FLT ? MAX_FLT : u));
+    }
+
+    // Subnormal: the encoding is the magnitude in units of the smallest subnormal. A result
+    // of 2^MantissaBits carries into the smallest normal, which has the same encoding.
+    uint32_t constexpr kScaleBits =
+      uint32_t(FP32_EXPONENT_BIAS + EXPONENT_BIAS + MantissaBits - 1) << FP32_NUM_MANTISSA_BITS;
+  #if defined(__CUDA_ARCH__)
+    float scaled = reinterpret_cast<float const &>(abs) * reinterpret_cast<float const &>(kScaleBits);
+    uint32_t u = uint32_t(__float2int_rn(scaled));
+  #else
+    float abs_flt, scale;
+    std::memcpy(&abs_flt, &abs, sizeof(abs_flt));
+    std::memcpy(&scale, &kScaleBits, sizeof(scale));
+    uint32_t u = uint32_t(std::nearbyint(abs_flt * scale));
+  #endif
+    return uint8_t(sign | u);
+  }
+
+  /// Converts a sub-byte value stored as a uint8_t to a float
+  CUTLASS_HOST_DEVICE
+  static float convert_bits_to_float(uint8_t const& x) {
+    uint32_t sign = (x & SIGN_MASK) ? 0x80000000u : 0u;
+    uint32_t exp = (x >> MantissaBits) & EXPONENT_MASK;
+    uint32_t mantissa = x & MANTISSA_MASK;
+
+    float flt;
+    if (exp) {
+      uint32_t f = sign |
+        ((exp + FP32_EXPONENT_BIAS - EXPONENT_BIAS) << FP32_NUM_MANTISSA_BITS) |
+        (mantissa << (FP32_NUM_MANTISSA_BITS - MantissaBits));
+    #if defined(__CUDA_ARCH__)
+      flt = reinterpret_cast<float const &>(f);
+    #else
+      std::memcpy(&flt, &f, sizeof(flt));
+    #endif
+    }
+    else {
+      // Subnormal or signed zero: mantissa * 2^(1 - bias - MantissaBits)
+      flt = float(mantissa) / float(1 << (EXPONENT_BIAS + MantissaBits - 1));
+      flt = sign ? -flt : flt;
+    }
+    return flt;
+  }
+
+  /// FP32 -> sub-byte float conversion - rounds to nearest even
+  CUTLASS_HOST_DEVICE
+  static float_subbyte from_float(float const& flt) {
+    return bitcast(convert_float_to_bits(flt));
+  }
+
+  /// Sub-byte float -> FP32 conversion
+  CUTLASS_HOST_DEVICE
+  static float to_float(float_subbyte const& x) {
+    return convert_bits_to_float(x.storage);
+  }
+
+  //
+  // Methods
+  //
+
+  /// Default constructor
+  float_subbyte() = default;
+
+  /// Floating point conversion
+  CUTLASS_HOST_DEVICE
+  explicit float_subbyte(float x) {
+    storage = convert_float_to_bits(x);
+  }
+
+  CUTLASS_HOST_DEVICE
+  explicit float_subbyte(half x): float_subbyte(__half2float(x)) {
+  }
+
+  /// Floating point conversion
+  CUTLASS_HOST_DEVICE
+  explicit float_subbyte(double x): float_subbyte(float(x)) {
+  }
+
+  /// Integer conversion
+  CUTLASS_HOST_DEVICE
+  explicit float_subbyte(int x): float_subbyte(float(x)) {
+  }
+
+  CUTLASS_HOST_DEVICE
+  explicit float_subbyte(unsigned x): float_subbyte(float(x)) {
+  }
+
+  /// Converts to float
+  CUTLASS_HOST_DEVICE
+  operator float() const {
+    return to_float(*this);
+  }
+
+  /// Converts to half
+  CUTLASS_HOST_DEVICE
+  explicit operator half() const {
+    return __float2half(to_float(*this));
+  }
+
+  /// Converts to double
+  CUTLASS_HOST_DEVICE
+  explicit operator double() const {
+    return double(to_float(*this));
+  }
+
+  /// Converts to int
+  CUTLASS_HOST_DEVICE
+  explicit operator int() const {
+    return int(to_float(*this));
+  }
+
+  /// Casts to bool
+  CUTLASS_HOST_DEVICE
+  explicit operator bool() const {
+    return (storage & MAX_FLT) != 0;
+  }
+
+  /// Accesses raw internal state
+  CUTLASS_HOST_DEVICE
+  uint8_t& raw() {
+    return storage;
+  }
+
+  /// Accesses raw internal state
+  CUTLASS_HOST_DEVICE
+  uint8_t raw() const {
+    return storage;
+  }
+
+  /// Returns the sign bit
+  CUTLASS_HOST_DEVICE
+  bool signbit() const {
+    return (storage & SIGN_MASK) != 0;
+  }
+
+  /// Returns the biased exponent
+  CUTLASS_HOST_DEVICE
+  int exponent_biased() const {
+    return int((storage >> MantissaBits) & EXPONENT_MASK);
+  }
+
+  /// Returns the unbiased exponent
+  CUTLASS_HOST_DEVICE
+  int exponent() const {
+    return exponent_biased() - EXPONENT_BIAS;
+  }
+
+  /// Returns the mantissa
+  CUTLASS_HOST_DEVICE
+  int mantissa() const {
+    return int(storage & MANTISSA_MASK);
+  }
+
+  CUTLASS_HOST_DEVICE
+  friend bool isnan(float_subbyte const&) {
+    return false;
+  }
+};
+
+/// FP4 type : E2M1, values in {0, 0.5, 1, 1.5, 2, 3, 4, 6} and their negations
+using float_e2m1_t = float_subbyte<2, 1>;
+
+/// FP6 type : E3M2, largest magnitude 28
+using float_e3m2_t = float_subbyte<3, 2>;
+
+/// FP6 type : E2M3, largest magnitude 7.5
+using float_e2m3_t = float_subbyte<2, 3>;
+
+/// FP4 values pack two per byte. FP6 values are kept one per byte, since 6-bit elements
+/// cannot be addressed by the sub-byte containers and iterators.
+template <>
+struct sizeof_bits<float_e2m1_t> {
+  static constexpr int value = 4;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Arithmetic operators
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+bool operator==(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float(lhs) == float(rhs);
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+bool operator!=(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float(lhs) != float(rhs);
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+bool operator<(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float(lhs) < float(rhs);
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+bool operator<=(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float(lhs) <= float(rhs);
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+bool operator>(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float(lhs) > float(rhs);
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+bool operator>=(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float(lhs) >= float(rhs);
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+float_subbyte<E, M> operator+(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float_subbyte<E, M>(float(lhs) + float(rhs));
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+float_subbyte<E, M> operator-(float_subbyte<E, M> const& lhs) {
+  return float_subbyte<E, M>::bitcast(uint8_t(lhs.storage ^ float_subbyte<E, M>::SIGN_MASK));
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+float_subbyte<E, M> operator-(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float_subbyte<E, M>(float(lhs) - float(rhs));
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+float_subbyte<E, M> operator*(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float_subbyte<E, M>(float(lhs) * float(rhs));
+}
+
+template <int E, int M>
+CUTLASS_HOST_DEVICE
+float_subbyte<E, M> operator/(float_subbyte<E, M> const& lhs, float_subbyte<E, M> const& rhs) {
+  return float_subbyte<E, M>(float(lhs) / float(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  E8M0 : unsigned, exponent-only scale factor with value 2^(storage - 127).
+//         0xff encodes NaN; there is no zero.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct alignas(1) float_ue8m0_t {
+
+  static constexpr int NUM_BITS = 8;
+  static constexpr int EXPONENT_BIAS = 127;
+  static constexpr uint8_t NAN_VAL = 0xff;
+  static constexpr uint8_t MAX_VAL = 0xfe;
+
+  //
+  // Data members
+  //
+
+  /// Data container
+  uint8_t storage;
+
+  //
+  // Static conversion operators
+  //
+
+  /// Constructs from an uint8_t
+  CUTLASS_HOST_DEVICE
+  static float_ue8m0_t bitcast(uint8_t x) {
+    float_ue8m0_t f;
+    f.storage = x;
+    return f;
+  }
+
+  /// FP32 -> E8M0 conversion - keeps the exponent of |x|, i.e. rounds down to a power of two.
+  /// Zero and float subnormals map to the smallest scale, infinity to the largest.
+  CUTLASS_HOST_DEVICE
+  static float_ue8m0_t from_float(float const& flt) {
+  #if defined(__CUDA_ARCH__)
+    uint32_t s = reinterpret_cast<uint32_t const &>(flt);
+  #else
+    uint32_t s;
+    std::memcpy(&s, &flt, sizeof(s));
+  #endif
+    uint32_t abs = s & 0x7fffffff;
+    if (abs > 0x7f800000) {
+      return bitcast(NAN_VAL);
+    }
+    uint32_t exp = abs >> 23;
+    return bitcast(uint8_t(exp == 0xff ? MAX_VAL : exp));
+  }
+
+  /// E8M0 -> FP32 conversion. Exact for every encoding.
+  CUTLASS_HOST_DEVICE
+  static float to_float(float_ue8m0_t const& x) {
+    // 2^-127 is a float subnormal with only the leading mantissa bit set
+    uint32_t f = x.storage == NAN_VAL ? 0x7fffffffu :
+                 x.storage == 0       ? 0x00400000u :
+                 uint32_t(x.storage) << 23;
+  #if defined(__CUDA_ARCH__)
+    return reinterpret_cast<float const &>(f);
+  #else
+    float flt;
+    std::memcpy(&flt, &f, sizeof(flt));
+    return flt;
+  #endif
+  }
+
+  //
+  // Methods
+  //
+
+  /// Default constructor
+  float_ue8m0_t() = default;
+
+  /// Floating point conversion
+  CUTLASS_HOST_DEVICE
+  explicit float_ue8m0_t(float x) {
+    storage = from_float(x).storage;
+  }
+
+  /// Floating point conversion
+  CUTLASS_HOST_DEVICE
+  explicit float_ue8m0_t(double x): float_ue8m0_t(float(x)) {
+  }
+
+  /// Integer conversion
+  CUTLASS_HOST_DEVICE
+  explicit float_ue8m0_t(int x): float_ue8m0_t(float(x)) {
+  }
+
+  CUTLASS_HOST_DEVICE
+  explicit float_ue8m0_t(unsigned x): float_ue8m0_t(float(x)) {
+  }
+
+  /// Converts to float
+  CUTLASS_HOST_DEVICE
+  operator float() const {
+    return to_float(*this);
+  }
+
+  /// Converts to double
+  CUTLASS_HOST_DEVICE
+  explicit operator double() const {
+    return double(to_float(*this));
+  }
+
+  /// Accesses raw internal state
+  CUTLASS_HOST_DEVICE
+  uint8_t& raw() {
+    return storage;
+  }
+
+  /// Accesses raw internal state
+  CUTLASS_HOST_DEVICE
+  uint8_t raw() const {
+    return storage;
+  }
+
+  /// Returns the unbiased exponent
+  CUTLASS_HOST_DEVICE
+  int exponent() const {
+    return int(storage) - EXPONENT_BIAS;
+  }
+
+  CUTLASS_HOST_DEVICE
+  friend bool isnan(float_ue8m0_t const& x) {
+    return x.storage == NAN_VAL;
+  }
+};
+
+CUTLASS_HOST_DEVICE
+bool operator==(float_ue8m0_t const& lhs, float_ue8m0_t const& rhs) {
+  return lhs.storage == rhs.storage && lhs.storage != float_ue8m0_t::NAN_VAL;
+}
+
+CUTLASS_HOST_DEVICE
+bool operator!=(float_ue8m0_t const& lhs, float_ue8m0_t const& rhs) {
+  return !(lhs == rhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Standard Library operations and definitions
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__CUDACC_RTC__)
+namespace std {
+
+/// Numeric limits common to all sub-byte float types
+template <typename T>
+struct float_subbyte_numeric_limits {
+private:
+  using FType = T;
+public:
+  static bool const is_specialized = true;
+  static bool const is_signed = true;
+  static bool const is_integer = false;
+  static bool const is_exact = false;
+  static bool const has_infinity = false;
+  static bool const has_quiet_NaN = false;
+  static bool const has_signaling_NaN = false;
+  static std::float_denorm_style const has_denorm = std::denorm_present;
+  static bool const has_denorm_loss = true;
+  static std::float_round_style const round_style = std::round_to_nearest;
+  static bool const is_iec559 = false;
+  static bool const is_bounded = true;
+  static bool const is_modulo = false;
+  static int const digits = FType::NUM_MANTISSA_BITS;
+
+  /// Least positive value
+  CUTLASS_HOST_DEVICE
+  static FType min() { return FType::bitcast(0x01); }
+
+  /// Maximum finite value
+  CUTLASS_HOST_DEVICE
+  static FType max() { return FType::bitcast(FType::MAX_FLT); }
+
+  /// Minimum finite value
+  CUTLASS_HOST_DEVICE
+  static FType lowest() { return FType::bitcast(FType::SIGN_MASK | FType::MAX_FLT); }
+
+  /// Machine epsilon, that is, the difference between 1.0 and the next representable value
+  CUTLASS_HOST_DEVICE
+  static FType epsilon() { return FType(1.0f / float(1 << FType::NUM_MANTISSA_BITS)); }
+
+  /// Returns maximum rounding error
+  CUTLASS_HOST_DEVICE
+  static FType round_error() { return FType(0.5f); }
+
+  /// Returns the largest finite value, since there is no infinity
+  CUTLASS_HOST_DEVICE
+  static FType infinity() { return max(); }
+
+  /// Returns the largest finite value, since there is no NaN
+  CUTLASS_HOST_DEVICE
+  static FType quiet_NaN() { return max(); }
+
+  /// Returns the largest finite value, since there is no NaN
+  CUTLASS_HOST_DEVICE
+  static FType signaling_NaN() { return max(); }
+
+  /// Returns smallest positive subnormal value
+  CUTLASS_HOST_DEVICE
+  static FType denorm_min() { return FType::bitcast(0x01); }
+};
+
+/// Numeric limits for sub-byte float types
+template <int E, int M>
+struct numeric_limits<cutlass::float_subbyte<E, M>> :
+    public float_subbyte_numeric_limits<cutlass::float_subbyte<E, M>> {};
+
+/// Numeric limits for float_ue8m0_t
+template <>
+struct numeric_limits<cutlass::float_ue8m0_t> {
+  static bool const is_specialized = true;
+  static bool const is_signed = false;
+  static bool const is_integer = false;
+  static bool const is_exact = false;
+  static bool const has_infinity = false;
+  static bool const has_quiet_NaN = true;
+  static bool const has_signaling_NaN = false;
+  static std::float_denorm_style const has_denorm = std::denorm_absent;
+  static bool const has_denorm_loss = false;
+  static std::float_round_style const round_style = std::round_toward_zero;
+  static bool const is_iec559 = false;
+  static bool const is_bounded = true;
+  static bool const is_modulo = false;
+  static int const digits = 0;
+
+  /// Least positive value
+  CUTLASS_HOST_DEVICE
+  static cutlass::float_ue8m0_t min() { return cutlass::float_ue8m0_t::bitcast(0x00); }
+
+  /// Maximum finite value
+  CUTLASS_HOST_DEVICE
+  static cutlass::float_ue8m0_t max() { return cutlass::float_ue8m0_t::bitcast(cutlass::float_ue8m0_t::MAX_VAL); }
+
+  /// Minimum finite value
+  CUTLASS_HOST_DEVICE
+  static cutlass::float_ue8m0_t lowest() { return min(); }
+
+  /// Returns quiet NaN value
+  CUTLASS_HOST_DEVICE
+  static cutlass::float_ue8m0_t quiet_NaN() { return cutlass::float_ue8m0_t::bitcast(cutlass::float_ue8m0_t::NAN_VAL); }
+};
+
+}  // namespace std
+#endif
+
+namespace cutlass {
+namespace platform {
+
+/// Forward Declaration
+template <class T>
+struct numeric_limits;
+
+/// Numeric limits for sub-byte float types
+template <int E, int M>
+struct numeric_limits<cutlass::float_subbyte<E, M>> {
+private:
+  using FType = cutlass::float_subbyte<E, M>;
+public:
+  static bool const is_specialized = true;
+  static bool const is_signed = true;
+  static bool const is_integer = false;
+  static bool const is_exact = false;
+  static bool const has_infinity = false;
+  static bool const has_quiet_NaN = false;
+  static bool const has_signaling_NaN = false;
+  static bool const has_denorm_loss = true;
+  static bool const is_iec559 = false;
+  static bool const is_bounded = true;
+  static bool const is_modulo = false;
+  static int const digits = FType::NUM_MANTISSA_BITS;
+
+  /// Least positive value
+  CUTLASS_HOST_DEVICE
+  static FType min() { return FType::bitcast(0x01); }
+
+  /// Maximum finite value
+  CUTLASS_HOST_DEVICE
+  static FType max() { return FType::bitcast(FType::MAX_FLT); }
+
+  /// Minimum finite value
+  CUTLASS_HOST_DEVICE
+  static FType lowest() { return FType::bitcast(FType::SIGN_MASK | FType::MAX_FLT); }
+
+  /// Returns smallest positive subnormal value
+  CUTLASS_HOST_DEVICE
+  static FType denorm_min() { return FType::bitcast(0x01); }
+};
+
+/// Numeric limits for float_ue8m0_t
+template <>
+struct numeric_limits<cutlass::float_ue8m0_t> {
+  static bool const is_specialized = true;
+  static bool const is_signed = false;
+  static bool const is_integer = false;
+  static bool const is_exact = false;
+  static bool const has_infinity = false;
+  static bool const has_quiet_NaN = true;
+  static bool const is_bounded = true;
+
+  /// Least positive value
+  CUTLASS_HOST_DEVICE
+  static cutlass::float_ue8m0_t min() { return cutlass::float_ue8m0_t::bitcast(0x00); }
+
+  /// Maximum finite value
+  CUTLASS_HOST_DEVICE
+  static cutlass::float_ue8m0_t max() { return cutlass::float_ue8m0_t::bitcast(cutlass::float_ue8m0_t::MAX_VAL); }
+
+  /// Minimum finite value
+  CUTLASS_HOST_DEVICE
+  static cutlass::float_ue8m0_t lowest() { return min(); }
+
+  /// Returns quiet NaN value
+  CUTLASS_HOST_DEVICE
+  static cutlass::float_ue8m0_t quiet_NaN() { return cutlass::float_ue8m0_t::bitcast(cutlass::float_ue8m0_t::NAN_VAL); }
+};
+
+}  // namespace platform
+}  // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -878,6 +878,40 @@ struct atomic_maximum<float> {
   }
 };
 
+template <typename T>
+struct atomic_minimum {
+  CUTLASS_DEVICE
+  T operator()(T *ptr, T value) const {
+#if defined(__CUDA_ARCH__)
+    return atomicMin(ptr, value);
+#else
+    CUTLASS_UNUSED(ptr);
+    CUTLASS_UNUSED(value);
+    CUTLASS_NOT_IMPLEMENTED();
+    return 0;
+#endif
+  }
+};
+
+template <>
+struct atomic_minimum<float> {
+  CUTLASS_DEVICE
+  float operator()(float *ptr, float value) const {
+#if defined(__CUDA_ARCH__)
+    // Mirror of atomic_maximum<float>: non-negative floats order like signed ints,
+    // negative floats order in reverse as unsigned ints.
+    return ! ::signbit(value) ?
+      __int_as_float(atomicMin((int*)ptr, __float_as_int(value))) :
+      __uint_as_float(atomicMax((unsigned int*)ptr, __float_as_uint(value)));
+#else
+    CUTLASS_UNUSED(ptr);
+    CUTLASS_UNUSED(value);
+    CUTLASS_NOT_IMPLEMENTED();
+    return 0;
+#endif
+  }
+};
+
 // is_atomic
 template <class Fn>
 struct is_atomic : platform::false_type {};
@@ -885,6 +919,8 @@ template <class T>
 struct is_atomic<atomic_add<T>> : platform::true_type {};
 template <class T>
 struct is_atomic<atomic_maximum<T>> : platform::true_type {};
+template <class T>
+struct is_atomic<atomic_minimum<T>> : platform::true_type {};
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
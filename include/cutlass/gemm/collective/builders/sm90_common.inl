@@ -318,6 +318,20 @@ ss_smem_selector()
   }
 }
 
+// Helper for SS GMMA smem selection of an operand that may be transposed in smem:
+//   a transposed operand is loaded into the MN-major atom GmmaSmemTranspose can transpose,
+//   any other operand uses the ss_smem_selector atom for major
+template <bool transpose, cute::GMMA::Major major, class ElementType, class BLK_MN, class BLK_K>
+constexpr auto
+ss_smem_selector_transposed() {
+  if constexpr (transpose) {
+    return rs_smem_selector<cute::GMMA::Major::MN, ElementType, BLK_MN, BLK_K, true>();
+  }
+  else {
+    return ss_smem_selector<major, ElementType, BLK_MN, BLK_K>();
+  }
+}
+
 // Helper for SS GMMA smem selection that considers a tensor TileShape:
 //   (BLK_MN, BLK_K)
 //   or hierarchically
@@ -84,6 +84,18 @@ private:
     }
   }
 
+  // `multiply` scale the partial accumulators by per-element scales and `add` to main accumulator (FFMA).
+  template <class EngineScale, class LayoutScale>
+  CUTLASS_DEVICE
+  void scale_core(cute::Tensor<EngineScale, LayoutScale> const& scale) {
+    static_assert(is_rmem<cute::Tensor<EngineScale, LayoutScale>>::value, "Scale tensor must be rmem resident.");
+    warpgroup_wait<0>();
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(accum_); ++i) {
+      accum_(i) += accum_temp_(i) * scale(i);
+    }
+  }
+
 public:
   CUTLASS_DEVICE
   GmmaFP8Accumulation(
@@ -159,6 +171,29 @@ public:
       scale_core(scale);
     }
   }
+
+  /// scale (multiply_add) the results from the MMA accumulators to main accumulator if needed,
+  /// with one scale per accumulator element.
+  template <class EngineScale, class LayoutScale>
+  CUTLASS_DEVICE
+  void scale_if_needed(cute::Tensor<EngineScale, LayoutScale> const& scale) {
+    mma_count_ += mma_count_per_mainloop_iteration_;
+    reset_accum_flag_ = __shfl_sync(0xffffffff, mma_count_ == accum_promotion_interval_, 0);
+    if (reset_accum_flag_) {
+      scale_core(scale);
+      mma_count_ = 0;
+    }
+  }
+
+  /// scale (multiply_add) the residue results from the MMA accumulators to main accumulator if needed,
+  /// with one scale per accumulator element.
+  template <class EngineScale, class LayoutScale>
+  CUTLASS_DEVICE
+  void scale_residue_if_needed(cute::Tensor<EngineScale, LayoutScale> const& scale) {
+    if (__shfl_sync(0xffffffff, mma_count_ > 0, 0)) {
+      scale_core(scale);
+    }
+  }
 };
 
 } // namespace cutlass::gemm::collective
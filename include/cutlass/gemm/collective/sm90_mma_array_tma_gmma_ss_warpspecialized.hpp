@@ -36,6 +36,7 @@
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/trace.h"
 #include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/transform/collective/sm90_wgmma_transpose.hpp"
 
 #include "cute/arch/cluster_sm90.hpp"
 #include "cute/arch/copy_sm90.hpp"
@@ -115,6 +116,10 @@ struct CollectiveMma<
   using PipelineState = cutlass::PipelineState<DispatchPolicy::Stages>;
 
   using PipelineParams = typename MainloopPipeline::Params;
+
+  // One threads per CTA are producers (1 for operand tile)
+  static constexpr int NumProducerThreadEvents = 1;
+
   using CtaShape_MNK = decltype(shape_div(TileShape{}, ClusterShape{}));
   static_assert(rank(SmemLayoutAtomA{}) == 2, "SmemLayoutAtom must be rank 2 (M/N, K)");
   static_assert((size<0>(TileShape{}) % size<0>(SmemLayoutAtomA{})) == 0, "SmemLayoutAtom must evenly divide tile shape.");
@@ -134,6 +139,12 @@ struct CollectiveMma<
       make_shape(shape<1>(TileShape{}), shape<2>(TileShape{}), Int<DispatchPolicy::Stages>{}),
       cute::conditional_t< ::cutlass::gemm::detail::is_major<0,StrideB>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{}));
 
+  // MN-major 8-bit and TF32 tiles are loaded as is and transposed in smem, since GMMA reads them K-major only
+  using TransposeA = cutlass::transform::collective::GmmaSmemTranspose<
+      TiledMma, typename TiledMma::ValTypeA, SmemLayoutAtomA, SmemLayoutA>;
+  using TransposeB = cutlass::transform::collective::GmmaSmemTranspose<
+      TiledMma, typename TiledMma::ValTypeB, SmemLayoutAtomB, SmemLayoutB>;
+
   static_assert(DispatchPolicy::Stages >= 2, "Specialization requires Stages set to value 2 or more.");
   static_assert(cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeA>::value &&
                 cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeB>::value,
@@ -476,8 +487,13 @@ struct CollectiveMma<
     static_assert(cute::is_void_v<SmemCopyAtomB>,
       "SM90 GMMA mainloops cannot have a non-void copy atom for smem sourced instructions.");
 
-    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
-    Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+    // GMMA reads the K-major view of transposed operands
+    Tensor sA = TransposeA::make_gmma_tensor(shared_tensors.smem_A.data());                     // (BLK_M,BLK_K,PIPE)
+    Tensor sB = TransposeB::make_gmma_tensor(shared_tensors.smem_B.data());                     // (BLK_N,BLK_K,PIPE)
+
+    int warp_idx = canonical_warp_idx_sync();
+    TransposeA transpose_a(warp_idx, thread_idx % NumThreadsPerWarpGroup);
+    TransposeB transpose_b(warp_idx, thread_idx % NumThreadsPerWarpGroup);
 
     //
     // Define C accumulators and A/B partitioning
@@ -534,6 +550,8 @@ struct CollectiveMma<
       pipeline.consumer_wait(smem_pipe_read, barrier_token);
 
       int read_stage = smem_pipe_read.index();
+      transpose_a.transpose(shared_tensors.smem_A.data(), read_stage);
+      transpose_b.transpose(shared_tensors.smem_B.data(), read_stage);
       warpgroup_arrive();
       // Unroll the K mode manually to set scale D to 1
       CUTLASS_PRAGMA_UNROLL
@@ -557,6 +575,8 @@ struct CollectiveMma<
       pipeline.consumer_wait(smem_pipe_read, barrier_token);
 
       int read_stage = smem_pipe_read.index();
+      transpose_a.transpose(shared_tensors.smem_A.data(), read_stage);
+      transpose_b.transpose(shared_tensors.smem_B.data(), read_stage);
       warpgroup_arrive();
       cute::gemm(tiled_mma, tCrA(_,_,_,read_stage), tCrB(_,_,_,read_stage), accum); // (V,M,K) x (V,N,K) => (V,M,N)
       warpgroup_commit_batch();
@@ -580,6 +600,8 @@ struct CollectiveMma<
       //
 
       int read_stage = smem_pipe_read.index();
+      transpose_a.transpose(shared_tensors.smem_A.data(), read_stage);
+      transpose_b.transpose(shared_tensors.smem_B.data(), read_stage);
       warpgroup_fence_operand(accum);
       warpgroup_arrive();
       cute::gemm(tiled_mma, tCrA(_,_,_,read_stage), tCrB(_,_,_,read_stage), accum); // (V,M,K) x (V,N,K) => (V,M,N)
@@ -656,10 +678,14 @@ struct CollectiveMma<
       Params const& mainloop_params,
       int32_t next_batch) {
     // Replacing global_address for the next batch
-    cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_A,
-                                                    mainloop_params.ptr_A[next_batch]);
-    cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_B,
-                                                    mainloop_params.ptr_B[next_batch]);
+    if (is_tensormap_A_stale_) {
+      cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_A,
+                                                      mainloop_params.ptr_A[next_batch]);
+    }
+    if (is_tensormap_B_stale_) {
+      cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_B,
+                                                      mainloop_params.ptr_B[next_batch]);
+    }
   }
 
   // Replace dim and strides for the global tensor - used only for Grouped GEMM (to be done by single thread)
@@ -700,12 +726,16 @@ struct CollectiveMma<
       stride = (stride * sizeof_bits_v<InternalElementB>) / 8;
     }
 
-    cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormaps.smem_tensormap_A,
-                                                            prob_shape_A,
-                                                            prob_stride_A);
-    cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormaps.smem_tensormap_B,
-                                                            prob_shape_B,
-                                                            prob_stride_B);
+    if (is_tensormap_A_stale_) {
+      cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormaps.smem_tensormap_A,
+                                                              prob_shape_A,
+                                                              prob_stride_A);
+    }
+    if (is_tensormap_B_stale_) {
+      cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormaps.smem_tensormap_B,
+                                                              prob_shape_B,
+                                                              prob_stride_B);
+    }
   }
 
   template <class TensorMapA, class TensorMapB, class ProblemShape_MNKL>
@@ -717,6 +747,32 @@ struct CollectiveMma<
       cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps,
       ProblemShape_MNKL problem_shape_mnkl,
       int32_t next_batch) {
+    // Every lane tracks which tensormaps change, since the release and acquire below are warp-wide
+    InternalElementA const* ptr_A = mainloop_params.ptr_A[next_batch];
+    InternalElementB const* ptr_B = mainloop_params.ptr_B[next_batch];
+    bool is_first_update = tensormap_batch_ < 0;
+    is_tensormap_A_stale_ = is_first_update || ptr_A != tensormap_ptr_A_;
+    is_tensormap_B_stale_ = is_first_update || ptr_B != tensormap_ptr_B_;
+    if constexpr (IsGroupedGemmKernel) {
+      // Groups sharing a pointer may still view it with different extents or strides
+      uint32_t const M = get<0>(problem_shape_mnkl);
+      uint32_t const N = get<1>(problem_shape_mnkl);
+      uint32_t const K = get<2>(problem_shape_mnkl);
+      if (not is_first_update) {
+        bool const is_K_changed = K != tensormap_shape_MNK_[2];
+        is_tensormap_A_stale_ |= is_K_changed || M != tensormap_shape_MNK_[0] ||
+                                 not (mainloop_params.dA[next_batch] == mainloop_params.dA[tensormap_batch_]);
+        is_tensormap_B_stale_ |= is_K_changed || N != tensormap_shape_MNK_[1] ||
+                                 not (mainloop_params.dB[next_batch] == mainloop_params.dB[tensormap_batch_]);
+      }
+      tensormap_shape_MNK_[0] = M;
+      tensormap_shape_MNK_[1] = N;
+      tensormap_shape_MNK_[2] = K;
+    }
+    tensormap_ptr_A_ = ptr_A;
+    tensormap_ptr_B_ = ptr_B;
+    tensormap_batch_ = next_batch;
+
     if (cute::elect_one_sync()) {
       // Replacing global_address for the next batch
       tensormaps_replace_global_address(shared_tensormaps, mainloop_params, next_batch);
@@ -736,8 +792,12 @@ struct CollectiveMma<
       TensorMapStorage& shared_tensormaps,
       cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps) {
     // Entire warp must do this (i.e. it's aligned)
-    tma_descriptor_cp_fence_release(get<0>(input_tensormaps), shared_tensormaps.smem_tensormap_A);
-    tma_descriptor_cp_fence_release(get<1>(input_tensormaps), shared_tensormaps.smem_tensormap_B);
+    if (is_tensormap_A_stale_) {
+      tma_descriptor_cp_fence_release(get<0>(input_tensormaps), shared_tensormaps.smem_tensormap_A);
+    }
+    if (is_tensormap_B_stale_) {
+      tma_descriptor_cp_fence_release(get<1>(input_tensormaps), shared_tensormaps.smem_tensormap_B);
+    }
   }
 
   // The entire warp must call this function collectively (that is, the instructions are aligned)
@@ -745,10 +805,24 @@ struct CollectiveMma<
   CUTLASS_DEVICE
   void
   tensormaps_fence_acquire(cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps) {
-    cute::tma_descriptor_fence_acquire(get<0>(input_tensormaps));
-    cute::tma_descriptor_fence_acquire(get<1>(input_tensormaps));
+    if (is_tensormap_A_stale_) {
+      cute::tma_descriptor_fence_acquire(get<0>(input_tensormaps));
+    }
+    if (is_tensormap_B_stale_) {
+      cute::tma_descriptor_fence_acquire(get<1>(input_tensormaps));
+    }
   }
 
+private:
+  // Operands, and for Grouped GEMM the extents, that the tensormaps were last written for. Consecutive
+  // batches reading the same A or B, e.g. weights shared by every batch of a Ptr-Array GEMM, skip
+  // rewriting, releasing and acquiring that operand's tensormap.
+  InternalElementA const* tensormap_ptr_A_ = nullptr;
+  InternalElementB const* tensormap_ptr_B_ = nullptr;
+  int32_t tensormap_batch_ = -1;
+  uint32_t tensormap_shape_MNK_[3] = {0, 0, 0};
+  bool is_tensormap_A_stale_ = true;
+  bool is_tensormap_B_stale_ = true;
 
 };
 
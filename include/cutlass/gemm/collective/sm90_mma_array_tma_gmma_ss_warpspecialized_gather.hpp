@@ -0,0 +1,463 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/sm90_mma_array_tma_gmma_ss_warpspecialized.hpp"
+#include "cutlass/numeric_types.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+#include "cutlass/cuda_host_adapter.hpp"
+
+#include "cute/arch/cluster_sm90.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/numeric/arithmetic_tuple.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// WarpSpecialized Mainloop for Ptr-Array and Grouped GEMM that gathers the rows of A.
+// Row m of the A tile of group g is row ptr_gather_A[g][m] of the matrix at ptr_A[g]. This lets a MoE
+// expert read its tokens in router order from the unpermuted activations.
+// SM90 TMA has no row gather, so each row of the A tile is brought in by its own TMA box of one
+// swizzle atom width. The boxes of a stage are spread across the lanes of the producer warp and
+// complete on the same transaction barrier as the B tile, so the consumer side is unchanged.
+// B, the MMA and the pipeline are identical to the MainloopSm90ArrayTmaGmmaWarpSpecialized collective.
+template <
+  int Stages,
+  class ClusterShape,
+  class KernelSchedule,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopSm90ArrayTmaGmmaWarpSpecializedGatherA<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopSm90ArrayTmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  //
+  // Type Aliases
+  //
+  using Base = CollectiveMma<
+    MainloopSm90ArrayTmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+  using DispatchPolicy = MainloopSm90ArrayTmaGmmaWarpSpecializedGatherA<Stages, ClusterShape, KernelSchedule>;
+  using typename Base::TileShape;
+  using typename Base::ElementA;
+  using typename Base::StrideA;
+  using typename Base::InternalStrideA;
+  using typename Base::ElementB;
+  using typename Base::StrideB;
+  using typename Base::InternalStrideB;
+  using typename Base::InternalElementA;
+  using typename Base::InternalElementB;
+  using typename Base::SmemLayoutAtomA;
+  using typename Base::SmemLayoutA;
+  using typename Base::SmemLayoutB;
+  using typename Base::MainloopPipeline;
+  using typename Base::PipelineState;
+  using typename Base::TensorStorage;
+  using typename Base::TensorMapStorage;
+  using Base::IsGroupedGemmKernel;
+
+  // Index type of the per-group row index arrays
+  using GatherIndex = int32_t;
+
+  static_assert(size<1>(ClusterShape{}) == 1, "Gathered A tiles cannot be multicast along the N mode of the cluster.");
+  static_assert(cute::is_same_v<GmemTiledCopyA_, SM90_TMA_LOAD>, "Gathered A tiles must be loaded with SM90_TMA_LOAD.");
+  static_assert(::cutlass::gemm::detail::is_k_major<StrideA>(), "Row gather requires a K-major A.");
+
+  // Each row of an A stage is loaded as AtomsPerKTile boxes of (1, AtomK), one per smem swizzle atom along K
+  static constexpr int AtomK = size<1>(SmemLayoutAtomA{});
+  static constexpr int AtomsPerKTile = size<2>(TileShape{}) / AtomK;
+  static constexpr int TileM = size<0>(TileShape{});
+  static constexpr int RowsPerLane = ceil_div(TileM, NumThreadsPerWarp);
+
+  // Row indices are only bounded by the extent of the gathered tensor, which the collective does not know
+  static constexpr uint32_t GatherRowsBound = static_cast<uint32_t>(cutlass::platform::numeric_limits<int32_t>::max());
+
+  // One row of one swizzle atom; the hardware applies the swizzle from the smem address of the row
+  using SmemLayoutRowA = decltype(composition(SmemLayoutAtomA{},
+      make_layout(make_shape(_1{}, Int<AtomK>{}), make_stride(_0{}, size<0>(SmemLayoutAtomA{})))));
+
+  using TMA_GatherA = decltype(make_tma_copy(
+      SM90_TMA_LOAD{},
+      make_tensor(static_cast<InternalElementA const*>(nullptr), repeat_like(InternalStrideA{}, int32_t(0)), InternalStrideA{}),
+      SmemLayoutRowA{},
+      make_shape(_1{}, Int<AtomK>{}),
+      _1{}));
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const** ptr_A;
+    StrideA dA;
+    ElementB const** ptr_B;
+    StrideB dB;
+    GatherIndex const** ptr_gather_A;                // Per group row indices into ptr_A, M entries each
+  };
+
+  // Device side kernel params
+  struct Params : Base::Params {
+    TMA_GatherA tma_gather_a;
+    GatherIndex const** ptr_gather_A;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(
+      ProblemShape problem_shapes,
+      Arguments const& args,
+      void* workspace) {
+    auto base_params = Base::to_underlying_arguments(
+      problem_shapes, typename Base::Arguments{args.ptr_A, args.dA, args.ptr_B, args.dB}, workspace);
+
+    // Grouped GEMM replaces the extents and strides before the first load, as in the base collective.
+    // For Ptr-Array the gathered tensor extent is only bounded by the row indices.
+    uint32_t init_rows = 1;
+    int32_t init_K = 1;
+    const uint32_t mock_L = 1;
+    InternalStrideA stride_a;
+    if constexpr (IsGroupedGemmKernel) {
+      stride_a = InternalStrideA{};
+    }
+    else {
+      init_rows = GatherRowsBound;
+      init_K = get<2>(problem_shapes.get_host_problem_shape(0));
+      stride_a = args.dA;
+    }
+    InternalElementA const* ptr_A_first_batch = reinterpret_cast<InternalElementA const*>(args.ptr_A);
+    Tensor tensor_a = make_tensor(ptr_A_first_batch, make_layout(make_shape(init_rows,init_K,mock_L), stride_a));
+    TMA_GatherA tma_gather_a = make_tma_copy(
+        SM90_TMA_LOAD{},
+        tensor_a,
+        SmemLayoutRowA{},
+        make_shape(_1{}, Int<AtomK>{}),
+        _1{});
+
+    return {
+      base_params,
+      tma_gather_a,
+      args.ptr_gather_A
+    };
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape problem_shapes,
+      Arguments const& args) {
+    bool implementable = Base::can_implement(
+      problem_shapes, typename Base::Arguments{args.ptr_A, args.dA, args.ptr_B, args.dB});
+    if (args.ptr_gather_A == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Gather mainloop requires per group row indices for A.\n");
+      implementable = false;
+    }
+    return implementable;
+  }
+
+  /// Perform a collective-scoped matrix multiply-accumulate
+  /// Producer Perspective
+  /// Must be called by the whole producer warp: the rows of A are split across its lanes.
+  template <
+    class TensorA, class TensorB,
+    class TensorMapA, class TensorMapB,
+    class KTileIterator, class BlockCoord
+  >
+  CUTLASS_DEVICE void
+  load(
+      Params const& mainloop_params,
+      MainloopPipeline pipeline,
+      PipelineState smem_pipe_write,
+      cute::tuple<TensorA, TensorB> const& load_inputs,
+      cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps,
+      BlockCoord const& blk_coord,
+      KTileIterator k_tile_iter, int k_tile_count,
+      int thread_idx,
+      uint32_t block_rank_in_cluster,
+      TensorStorage& shared_tensors) {
+    int lane_idx = thread_idx % NumThreadsPerWarp;
+    int lane_predicate = cute::elect_one_sync();
+
+    Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+
+    constexpr uint32_t cluster_shape_x = get<0>(typename DispatchPolicy::ClusterShape());
+    uint2 cluster_local_block_id = {block_rank_in_cluster % cluster_shape_x, block_rank_in_cluster / cluster_shape_x};
+
+    Tensor gA_mkl = get<0>(load_inputs);
+    Tensor gB_nkl = get<1>(load_inputs);
+
+    auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
+    Tensor gB = gB_nkl(_,_,n_coord,_,l_coord);                                                       // (BLK_N,BLK_K,k)
+
+    auto block_tma_b = mainloop_params.tma_load_b.get_slice(cluster_local_block_id.x);
+    Tensor tBgB = block_tma_b.partition_S(gB);                                                   // (TMA,TMA_N,TMA_K,k)
+    Tensor tBsB = block_tma_b.partition_D(sB);                                                // (TMA,TMA_N,TMA_K,PIPE)
+
+    // The gathered A as (row,k) coordinates of the source matrix, tiled by one row of a swizzle atom
+    Tensor mA_rows = mainloop_params.tma_gather_a.get_tma_tensor(
+      make_shape(int32_t(GatherRowsBound), size<3>(gA_mkl) * size<1>(gA_mkl), 1));                  // (rows,k,l)
+    Tensor gA_rows = local_tile(mA_rows, make_shape(_1{}, Int<AtomK>{}), make_coord(_,_,_));   // (1,ATOM_K,rows,atoms,l)
+    auto block_tma_a = mainloop_params.tma_gather_a.get_slice(0);
+    Tensor tAgA = block_tma_a.partition_S(gA_rows);                                           // (TMA,1,1,rows,atoms,l)
+
+    // Source rows of this lane. Rows past the end of the group repeat the last valid one, their
+    // results are discarded by the epilogue.
+    GatherIndex src_rows[RowsPerLane];
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < RowsPerLane; ++i) {
+      int m = m_coord * TileM + lane_idx + i * NumThreadsPerWarp;
+      src_rows[i] = curr_gather_A_[cute::min(m, curr_M_ - 1)];
+    }
+
+    uint16_t mcast_mask_b = 0;
+    if constexpr (cute::is_same_v<GmemTiledCopyB_, SM90_TMA_LOAD_MULTICAST>) {
+      auto block_layout = Layout<typename DispatchPolicy::ClusterShape>{}; // (m,n) -> block_id
+      for (int m = 0; m < size<0>(block_layout); ++m) {
+        mcast_mask_b |= (uint16_t(1) << block_layout(m,cluster_local_block_id.y,Int<0>{}));
+      }
+    }
+
+    // Mainloop
+    CUTLASS_PRAGMA_NO_UNROLL
+    for ( ; k_tile_count > 0; --k_tile_count)
+    {
+      // LOCK smem_pipe_write for _writing_, the leader also posts the transaction bytes of the stage
+      if (lane_predicate) {
+        pipeline.producer_acquire(smem_pipe_write);
+      }
+      __syncwarp();
+
+      using BarrierType = typename MainloopPipeline::ProducerBarrierType;
+      BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_write);
+
+      int write_stage = smem_pipe_write.index();
+      int k_tile = *k_tile_iter;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < RowsPerLane; ++i) {
+        int row = lane_idx + i * NumThreadsPerWarp;
+        if (row < TileM) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int atom = 0; atom < AtomsPerKTile; ++atom) {
+            // Unswizzled offset of the row within the stage
+            auto row_offset = SmemLayoutA{}.layout_b()(row, atom * AtomK, write_stage);
+            Tensor sA_row = make_tensor(make_smem_ptr(shared_tensors.smem_A.data() + row_offset),
+                                        make_layout(make_shape(_1{}, Int<AtomK>{})));           // (1,ATOM_K)
+            Tensor tAsA = block_tma_a.partition_D(sA_row);                                         // (TMA,1,1)
+            copy(mainloop_params.tma_gather_a.with(get<0>(input_tensormaps), *tma_barrier),
+                 tAgA(_,_,_,src_rows[i],k_tile * AtomsPerKTile + atom,0), tAsA);
+          }
+        }
+      }
+
+      if (lane_predicate) {
+        copy(mainloop_params.tma_load_b.with(get<1>(input_tensormaps), *tma_barrier, mcast_mask_b), tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+      }
+      ++k_tile_iter;
+
+      // Advance smem_pipe_write
+      ++smem_pipe_write;
+    }
+  }
+
+  //
+  // Methods to perform different parts of TMA/Tensormap modifications
+  //
+
+  CUTLASS_DEVICE auto
+  tensormaps_init(
+      Params const& mainloop_params,
+      TensorMapStorage& shared_tensormaps,
+      int32_t sm_count,
+      int32_t sm_idx) {
+    cute::TmaDescriptor* gmem_tensormap = reinterpret_cast<cute::TmaDescriptor*>(mainloop_params.tensormaps);
+
+    cute::TmaDescriptor* tma_desc_a = &gmem_tensormap[sm_idx];
+    cute::TmaDescriptor* tma_desc_b = &gmem_tensormap[sm_idx + sm_count];
+
+    if (cute::elect_one_sync()) {
+      // Bringing tensormaps from params to smem for modification later
+      Tensor pA_tensormap = make_tensor(mainloop_params.tma_gather_a.get_tma_descriptor(), Int<1>{}, Int<1>{});
+      Tensor sA_tensormap = make_tensor(make_smem_ptr(&shared_tensormaps.smem_tensormap_A), Int<1>{}, Int<1>{});
+      Tensor pB_tensormap = make_tensor(mainloop_params.tma_load_b.get_tma_descriptor(), Int<1>{}, Int<1>{});
+      Tensor sB_tensormap = make_tensor(make_smem_ptr(&shared_tensormaps.smem_tensormap_B), Int<1>{}, Int<1>{});
+
+      copy(recast<uint128_t>(pA_tensormap), recast<uint128_t>(sA_tensormap));
+      copy(recast<uint128_t>(pB_tensormap), recast<uint128_t>(sB_tensormap));
+    }
+    __syncwarp();
+
+    return cute::make_tuple(tma_desc_a, tma_desc_b);
+  }
+
+  // Replace dim and strides for the global tensor - used only for Grouped GEMM (to be done by single thread)
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE
+  void
+  tensormaps_replace_global_tensor_properties(
+      TensorMapStorage& shared_tensormaps,
+      Params const& mainloop_params,
+      int32_t next_group,
+      ProblemShape_MNKL problem_shape_mnkl) {
+    const uint32_t N = get<1>(problem_shape_mnkl);
+    const uint32_t K = get<2>(problem_shape_mnkl);
+    // Replace all dims for consistency
+    constexpr int MaxTensorRank = 5;
+    cute::array<uint32_t, MaxTensorRank> prob_shape_A  = {1,1,1,1,1};
+    cute::array<uint64_t, MaxTensorRank> prob_stride_A = {0,0,0,0,0};
+    cute::array<uint32_t, MaxTensorRank> prob_shape_B  = {1,1,1,1,1};
+    cute::array<uint64_t, MaxTensorRank> prob_stride_B = {0,0,0,0,0};
+
+    InternalElementA const* ptr_A = nullptr;
+    Tensor tensor_a = make_tensor(ptr_A, make_shape(GatherRowsBound,K,Int<1>{}), mainloop_params.dA[next_group]);
+
+    InternalElementB const* ptr_B = nullptr;
+    Tensor tensor_b = make_tensor(ptr_B, make_shape(N,K,Int<1>{}), mainloop_params.dB[next_group]);
+
+    cute::detail::fill_tma_gmem_shape_stride(mainloop_params.tma_gather_a, tensor_a,
+                                             prob_shape_A, prob_stride_A);
+    cute::detail::fill_tma_gmem_shape_stride(mainloop_params.tma_load_b, tensor_b,
+                                             prob_shape_B, prob_stride_B);
+
+    // Convert strides to byte strides
+    for (uint64_t& stride : prob_stride_A) {
+      stride = (stride * sizeof_bits_v<InternalElementA>) / 8;
+    }
+    for (uint64_t& stride : prob_stride_B) {
+      stride = (stride * sizeof_bits_v<InternalElementB>) / 8;
+    }
+
+    cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormaps.smem_tensormap_A,
+                                                            prob_shape_A,
+                                                            prob_stride_A);
+    cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormaps.smem_tensormap_B,
+                                                            prob_shape_B,
+                                                            prob_stride_B);
+  }
+
+  // The entire warp must call this function collectively, every lane keeps the row indices of the batch
+  template <class TensorMapA, class TensorMapB, class ProblemShape_MNKL>
+  CUTLASS_DEVICE
+  void
+  tensormaps_perform_update(
+      TensorMapStorage& shared_tensormaps,
+      Params const& mainloop_params,
+      cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps,
+      ProblemShape_MNKL problem_shape_mnkl,
+      int32_t next_batch) {
+    curr_gather_A_ = mainloop_params.ptr_gather_A[next_batch];
+    curr_M_ = get<0>(problem_shape_mnkl);
+
+    if (cute::elect_one_sync()) {
+      // Replacing global_address for the next batch
+      Base::tensormaps_replace_global_address(shared_tensormaps, mainloop_params, next_batch);
+
+      if constexpr (IsGroupedGemmKernel) {
+        // Replacing global dims and strides for the next batch
+        tensormaps_replace_global_tensor_properties(shared_tensormaps,
+          mainloop_params, next_batch, problem_shape_mnkl);
+      }
+    }
+  }
+
+private:
+  GatherIndex const* curr_gather_A_ = nullptr;
+  int curr_M_ = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
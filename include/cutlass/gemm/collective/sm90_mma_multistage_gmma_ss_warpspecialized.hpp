@@ -247,15 +247,30 @@ struct CollectiveMma<
     Tensor tAcA = gmem_thr_copy_a.partition_S(cA);                             // (ACPY,ACPY_M,ACPY_K) -> (blk_m,blk_k)
     Tensor tBcB = gmem_thr_copy_b.partition_S(cB);                             // (BCPY,BCPY_N,BCPY_K) -> (blk_n,blk_k)
 
+    // Residues that are statically known to be full tiles (static problem extents) need no predication
+    constexpr bool IsFullTileM = cutlass::gemm::detail::is_full_tile_residue<decltype(get<0>(residue_mnk)), decltype(size<0>(sA))>();
+    constexpr bool IsFullTileN = cutlass::gemm::detail::is_full_tile_residue<decltype(get<1>(residue_mnk)), decltype(size<0>(sB))>();
+    constexpr bool IsFullTileK = cutlass::gemm::detail::is_full_tile_residue<decltype(get<2>(residue_mnk)), _0>();
+
     // Set predicates for m bounds
-    CUTLASS_PRAGMA_UNROLL
-    for (int m = 0; m < size<0>(tApA); ++m) {
-      tApA(m,0) = get<0>(tAcA(0,m,0)) < get<0>(residue_mnk);  // blk_m coord < residue_m
+    if constexpr (IsFullTileM) {
+      fill(tApA, true);
+    }
+    else {
+      CUTLASS_PRAGMA_UNROLL
+      for (int m = 0; m < size<0>(tApA); ++m) {
+        tApA(m,0) = get<0>(tAcA(0,m,0)) < get<0>(residue_mnk);  // blk_m coord < residue_m
+      }
     }
     // Set predicates for n bounds
-    CUTLASS_PRAGMA_UNROLL
-    for (int n = 0; n < size<0>(tBpB); ++n) {
-      tBpB(n,0) = get<0>(tBcB(0,n,0)) < get<1>(residue_mnk);  // blk_n coord < residue_n
+    if constexpr (IsFullTileN) {
+      fill(tBpB, true);
+    }
+    else {
+      CUTLASS_PRAGMA_UNROLL
+      for (int n = 0; n < size<0>(tBpB); ++n) {
+        tBpB(n,0) = get<0>(tBcB(0,n,0)) < get<1>(residue_mnk);  // blk_n coord < residue_n
+      }
     }
 
     // 0-th stage with predication on k to account for residue
@@ -268,7 +283,7 @@ struct CollectiveMma<
       Tensor tAgAk = tAgA(_,_,_,*k_tile_iter);
       CUTLASS_PRAGMA_UNROLL
       for (int k = 0; k < size<2>(tAsA); ++k) {
-        if (get<1>(tAcA(0,0,k)) >= -get<2>(residue_mnk)) {      // blk_k coord < residue_k (gA shifted)
+        if (IsFullTileK || get<1>(tAcA(0,0,k)) >= -get<2>(residue_mnk)) {  // blk_k coord < residue_k (gA shifted)
           copy_if(gmem_tiled_copy_a, tApA(_,k), tAgAk(_,_,k), tAsA(_,_,k,write_stage));
         }
         else {
@@ -278,7 +293,7 @@ struct CollectiveMma<
       Tensor tBgBk = tBgB(_,_,_,*k_tile_iter);
       CUTLASS_PRAGMA_UNROLL
       for (int k = 0; k < size<2>(tBsB); ++k) {
-        if (get<1>(tBcB(0,0,k)) >= -get<2>(residue_mnk)) {      // blk_k coord < residue_k (gB shifted)
+        if (IsFullTileK || get<1>(tBcB(0,0,k)) >= -get<2>(residue_mnk)) {  // blk_k coord < residue_k (gB shifted)
           copy_if(gmem_tiled_copy_b, tBpB(_,k), tBgBk(_,_,k), tBsB(_,_,k,write_stage));
         }
         else {
@@ -0,0 +1,396 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/arch/cluster_sm90.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/copy_traits_sm90_tma.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// WarpSpecialized accumulator load "mainloop". Rather than computing them, the accumulators of each
+// output tile are TMA loaded from a global tensor X of shape (M,N,L) and handed to the collective epilogue.
+// This runs any SM90 warp-specialized epilogue, fusion callbacks included, as a standalone elementwise
+// kernel over X with the same numerics as when it is fused behind a GEMM mainloop.
+//
+// X takes the A operand slots (ElementA, StrideA, GmemTiledCopyA, SmemLayoutAtomA, TransformA) and the
+// B operand slots are ignored. TiledMma only defines the accumulator partitioning the epilogue expects.
+// The problem shape is (M,N,K,L) with K == 1, so that every output tile is a single k-tile.
+template <
+  int Stages,
+  class ClusterShape,
+  class KernelSchedule,
+  class TileShape_,
+  class ElementX_,
+  class StrideX_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyX_,
+  class SmemLayoutAtomX_,
+  class SmemCopyAtomX_,
+  class TransformX_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopSm90TmaAccumulatorLoadWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementX_,
+    StrideX_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyX_,
+    SmemLayoutAtomX_,
+    SmemCopyAtomX_,
+    TransformX_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopSm90TmaAccumulatorLoadWarpSpecialized<Stages, ClusterShape, KernelSchedule>;
+  using TileShape = TileShape_;
+  using ElementX = ElementX_;
+  using StrideX = StrideX_;
+  using TiledMma = TiledMma_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+  using GmemTiledCopyX = GmemTiledCopyX_;
+  using SmemLayoutAtomX = SmemLayoutAtomX_;
+  using TransformX = TransformX_;
+  using ArchTag = typename DispatchPolicy::ArchTag;
+
+  // The kernel layer and the device adapter inspect A and B operand types, which all describe X
+  using ElementA = ElementX;
+  using StrideA = StrideX;
+  using ElementB = ElementX;
+  using StrideB = StrideX;
+  using GmemTiledCopyA = GmemTiledCopyX;
+  using GmemTiledCopyB = GmemTiledCopyX;
+  using SmemLayoutAtomA = SmemLayoutAtomX;
+  using SmemLayoutAtomB = SmemLayoutAtomX;
+  using SmemCopyAtomA = void;
+  using SmemCopyAtomB = void;
+  using TransformA = TransformX;
+  using TransformB = cute::identity;
+
+  using MainloopPipeline = cutlass::PipelineTmaAsync<DispatchPolicy::Stages>;
+  using PipelineState = cutlass::PipelineState<DispatchPolicy::Stages>;
+
+  using PipelineParams = typename MainloopPipeline::Params;
+
+  // One threads per CTA are producers (1 for the X tile)
+  static constexpr int NumProducerThreadEvents = 1;
+
+  static_assert(cute::rank(SmemLayoutAtomX{}) == 2, "SmemLayoutAtom must be rank 2 (M, N)");
+  static_assert((size<0>(TileShape{}) % size<0>(SmemLayoutAtomX{})) == 0, "SmemLayoutAtom must evenly divide tile shape.");
+  static_assert((size<1>(TileShape{}) % size<1>(SmemLayoutAtomX{})) == 0, "SmemLayoutAtom must evenly divide tile shape.");
+
+  // Tile along modes in a way that maximizes the TMA box size.
+  using SmemLayoutX = decltype(tile_to_shape(
+      SmemLayoutAtomX{},
+      make_shape(shape<0>(TileShape{}), shape<1>(TileShape{}), Int<DispatchPolicy::Stages>{}),
+      cute::conditional_t< ::cutlass::gemm::detail::is_major<0,StrideX>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{}));
+
+  static_assert(DispatchPolicy::Stages >= 1, "Specialization requires Stages set to value 1 or more.");
+  static_assert(cute::is_void_v<SmemCopyAtomX_>,
+      "Accumulator load mainloop reads X from smem with the TiledMma C partitioning, SmemCopyAtom must be void.");
+  static_assert(cute::is_same_v<GmemTiledCopyX, SM90_TMA_LOAD>,
+      "GmemTiledCopy - X tiles are not shared across a cluster, use SM90_TMA_LOAD.");
+
+  // Copy X as a size equivalent uint type to avoid any rounding by TMA, f32 in particular must not become tf32
+  using InternalElementX = uint_bit_t<sizeof_bits_v<ElementX>>;
+
+  struct SharedStorage
+  {
+    struct TensorStorage : cute::aligned_struct<128, _0> {
+      cute::array_aligned<ElementX, cute::cosize_v<SmemLayoutX>> smem_X;
+    } tensors;
+
+    using PipelineStorage = typename MainloopPipeline::SharedStorage;
+    PipelineStorage pipeline;
+  };
+  using TensorStorage = typename SharedStorage::TensorStorage;
+  using PipelineStorage = typename SharedStorage::PipelineStorage;
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementX const* ptr_X;
+    StrideX dX;
+    // L2 eviction policy of the TMA load of X, e.g., EVICT_FIRST when X is not read again
+    TMA::CacheHintSm90 cache_hint_X = TMA::CacheHintSm90::EVICT_NORMAL;
+  };
+
+  // Device side kernel params
+  struct Params {
+    // Assumption: StrideX is congruent with Problem_MN
+    using TMA_X = decltype(make_tma_copy(
+        GmemTiledCopyX{},
+        make_tensor(static_cast<InternalElementX const*>(nullptr), repeat_like(StrideX{}, int32_t(0)), StrideX{}),
+        SmemLayoutX{}(_,_,cute::Int<0>{}),
+        take<0,2>(TileShape{}),
+        _1{}));
+    TMA_X tma_load_x;
+    uint32_t tma_transaction_bytes = TmaTransactionBytes;
+    TMA::CacheHintSm90 cache_hint_X = TMA::CacheHintSm90::EVICT_NORMAL;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    // Optionally append 1s until problem shape is rank-4 (MNKL), in case it is only rank-3 (MNK)
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    auto ptr_X = reinterpret_cast<InternalElementX const*>(args.ptr_X);
+    Tensor tensor_x = make_tensor(ptr_X, make_layout(make_shape(M,N,L), args.dX));
+
+    typename Params::TMA_X tma_load_x = make_tma_copy(
+        GmemTiledCopyX{},
+        tensor_x,
+        SmemLayoutX{}(_,_,cute::Int<0>{}),
+        take<0,2>(TileShape{}),
+        _1{});
+
+    return {
+      tma_load_x,
+      TmaTransactionBytes,
+      args.cache_hint_X
+    };
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      [[maybe_unused]] Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    if (K != 1) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Accumulator load mainloop requires a problem shape K of 1.\n");
+      return false;
+    }
+
+    constexpr int min_tma_aligned_elements_X = tma_alignment_bits / cutlass::sizeof_bits<ElementX>::value;
+    bool implementable = cutlass::detail::check_alignment<min_tma_aligned_elements_X>(cute::make_shape(M,N,L), StrideX{});
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+    }
+    return implementable;
+  }
+
+  static constexpr uint32_t TmaTransactionBytes =
+        cutlass::bits_to_bytes(size<0>(SmemLayoutX{}) * size<1>(SmemLayoutX{}) * static_cast<uint32_t>(sizeof_bits<ElementX>::value));
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& mainloop_params) {
+    cute::prefetch_tma_descriptor(mainloop_params.tma_load_x.get_tma_descriptor());
+  }
+
+  /// Set up the data needed by this collective for load and mma.
+  /// The kernel layer reads the m, n and l tile counts and the k-tile count off the first two tensors:
+  /// gA_mkl - X with a unit k mode, so it has shape (BLK_M,BLK_N,m,1,l)
+  /// gB_nkl - X transposed with a unit k mode, so it has shape (BLK_N,BLK_M,n,1,l)
+  /// gX_mnl - The tma tensor, X after a local tile so it has shape (BLK_M,BLK_N,m,n,l)
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE auto
+  load_init(ProblemShape_MNKL const& problem_shape_MNKL, Params const& mainloop_params) const {
+    using X = Underscore;
+    // Separate out problem shape for convenience
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    // TMA requires special handling of strides to deal with coord codomain mapping
+    // Represent the full tensor -- get it from TMA
+    Tensor mX_mnl = mainloop_params.tma_load_x.get_tma_tensor(make_shape(M,N,L));                         // (m,n,l)
+
+    // Make tiled views, defer the slice
+    Tensor gX_mnl = local_tile(mX_mnl, TileShape{}, make_coord(_,_,_), Step<_1,_1, X>{});       // (BLK_M,BLK_N,m,n,l)
+
+    auto layout_x = gX_mnl.layout();
+    Tensor gA_mkl = make_tensor(gX_mnl.data(), make_layout(layout<0>(layout_x), layout<1>(layout_x),
+        layout<2>(layout_x), Layout<_1,_0>{}, layout<4>(layout_x)));                           // (BLK_M,BLK_N,m,1,l)
+    Tensor gB_nkl = make_tensor(gX_mnl.data(), make_layout(layout<1>(layout_x), layout<0>(layout_x),
+        layout<3>(layout_x), Layout<_1,_0>{}, layout<4>(layout_x)));                           // (BLK_N,BLK_M,n,1,l)
+
+    return cute::make_tuple(gA_mkl, gB_nkl, gX_mnl);
+  }
+
+  /// Load the X tile of an output tile
+  /// Producer Perspective
+  template <
+    class TensorA, class TensorB, class TensorX,
+    class KTileIterator, class BlockCoord
+  >
+  CUTLASS_DEVICE void
+  load(
+      Params const& mainloop_params,
+      MainloopPipeline pipeline,
+      PipelineState smem_pipe_write,
+      cute::tuple<TensorA, TensorB, TensorX> const& load_inputs,
+      BlockCoord const& blk_coord,
+      [[maybe_unused]] KTileIterator k_tile_iter, int k_tile_count,
+      [[maybe_unused]] int thread_idx,
+      [[maybe_unused]] uint32_t block_rank_in_cluster,
+      TensorStorage& shared_tensors) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      Tensor sX = make_tensor(make_smem_ptr(shared_tensors.smem_X.data()), SmemLayoutX{});        // (BLK_M,BLK_N,PIPE)
+
+      // Partition the input based on the current block coordinates.
+      Tensor gX_mnl = get<2>(load_inputs);
+      auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
+      Tensor gX = gX_mnl(_,_,m_coord,n_coord,l_coord);                                                 // (BLK_M,BLK_N)
+
+      auto block_tma_x = mainloop_params.tma_load_x.get_slice(Int<0>{});
+      Tensor tXgX = block_tma_x.partition_S(gX);                                                   // (TMA,TMA_M,TMA_N)
+      Tensor tXsX = block_tma_x.partition_D(sX);                                              // (TMA,TMA_M,TMA_N,PIPE)
+
+      // One k-tile per output tile, see can_implement
+      CUTLASS_PRAGMA_NO_UNROLL
+      for ( ; k_tile_count > 0; --k_tile_count) {
+        // LOCK smem_pipe_write for _writing_
+        pipeline.producer_acquire(smem_pipe_write);
+
+        using BarrierType = typename MainloopPipeline::ProducerBarrierType;
+        BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_write);
+
+        int write_stage = smem_pipe_write.index();
+        copy(mainloop_params.tma_load_x.with(*tma_barrier, 0, mainloop_params.cache_hint_X), tXgX, tXsX(_,_,_,write_stage));
+
+        // Advance smem_pipe_write
+        ++smem_pipe_write;
+      }
+    }
+  }
+
+  /// Perform a Producer Epilogue to prevent early exit of blocks in a Cluster
+  CUTLASS_DEVICE void
+  load_tail(MainloopPipeline pipeline, PipelineState smem_pipe_write) {
+    int lane_predicate = cute::elect_one_sync();
+
+    // Issue the epilogue waits
+    if (lane_predicate) {
+      // Waits for all stages to either be released (all Consumer UNLOCKs), or if the stage was never used
+      // then would just be acquired since the phase was still inverted from make_producer_start_state
+      pipeline.producer_tail(smem_pipe_write);
+    }
+  }
+
+  /// Read the X tile into the accumulators
+  /// Consumer Perspective
+  template <
+    class FrgTensorC
+  >
+  CUTLASS_DEVICE void
+  mma(MainloopPipeline pipeline,
+      PipelineState smem_pipe_read,
+      FrgTensorC& accum,
+      int k_tile_count,
+      int thread_idx,
+      TensorStorage& shared_tensors,
+      [[maybe_unused]] Params const& mainloop_params) {
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+    static_assert(cute::rank(SmemLayoutX{}) == 3, "Smem layout must be rank 3.");
+
+    Tensor sX = make_tensor(make_smem_ptr(shared_tensors.smem_X.data()), SmemLayoutX{});          // (BLK_M,BLK_N,PIPE)
+
+    // Partition X exactly as the epilogue partitions the accumulators
+    TiledMma tiled_mma;
+    auto thread_mma = tiled_mma.get_thread_slice(thread_idx);
+    Tensor tCsX = thread_mma.partition_C(sX);                                                 // (MMA,MMA_M,MMA_N,PIPE)
+
+    CUTE_STATIC_ASSERT_V(size<1>(tCsX) == size<1>(accum));                                                         // M
+    CUTE_STATIC_ASSERT_V(size<2>(tCsX) == size<2>(accum));                                                         // N
+    CUTE_STATIC_ASSERT_V(Int<DispatchPolicy::Stages>{} == size<2>(sX));                                         // PIPE
+
+    cutlass::NumericConverter<ElementAccumulator, ElementX> convert;
+    TransformX transform;
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for ( ; k_tile_count > 0; --k_tile_count) {
+      // WAIT on smem_pipe_read until its data are available (phase bit flips from rdPhaseBit value)
+      auto barrier_token = pipeline.consumer_try_wait(smem_pipe_read);
+      pipeline.consumer_wait(smem_pipe_read, barrier_token);
+
+      Tensor tCsX_stage = tCsX(_,_,_,smem_pipe_read.index());                                      // (MMA,MMA_M,MMA_N)
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(accum); ++i) {
+        accum(i) = convert(transform(tCsX_stage(i)));
+      }
+
+      // UNLOCK smem_pipe_read, the tile is in registers
+      pipeline.consumer_release(smem_pipe_read);
+      ++smem_pipe_read;
+    }
+  }
+
+  /// Perform a Consumer Epilogue to release all buffers
+  CUTLASS_DEVICE void
+  mma_tail(MainloopPipeline, PipelineState, int) {
+    // Every stage is released by mma() as soon as it has been read
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +60,7 @@ template <
   int Stages,
   class ClusterShape,
   class KernelSchedule,
+  int PrefetchKBlocksA_,
   class TileShape_,
   class ElementA_,
   class StrideA_,
@@ -75,7 +76,7 @@ template <
   class SmemCopyAtomB_,
   class TransformB_>
 struct CollectiveMma<
-    MainloopSm90TmaGmmaRmemAWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    MainloopSm90TmaGmmaRmemAWarpSpecialized<Stages, ClusterShape, KernelSchedule, PrefetchKBlocksA_>,
     TileShape_,
     ElementA_,
     StrideA_,
@@ -94,7 +95,7 @@ struct CollectiveMma<
   //
   // Type Aliases
   //
-  using DispatchPolicy = MainloopSm90TmaGmmaRmemAWarpSpecialized<Stages, ClusterShape, KernelSchedule>;
+  using DispatchPolicy = MainloopSm90TmaGmmaRmemAWarpSpecialized<Stages, ClusterShape, KernelSchedule, PrefetchKBlocksA_>;
   using TileShape = TileShape_;
   using ElementA = ElementA_;
   using StrideA = StrideA_;
@@ -344,6 +345,8 @@ struct CollectiveMma<
   }
 
   static constexpr int K_PIPE_MAX = DispatchPolicy::Stages;
+  // The A fragment holds the whole k-tile, so a deeper prefetch costs no extra registers
+  static constexpr int PrefetchKBlocksA = DispatchPolicy::PrefetchKBlocksA;
   static constexpr uint32_t TmaTransactionBytesMK =
         cutlass::bits_to_bytes(size<0>(SmemLayoutA{}) * size<1>(SmemLayoutA{}) * static_cast<uint32_t>(sizeof_bits<InternalElementA>::value));
   static constexpr uint32_t TmaTransactionBytesNK =
@@ -580,6 +583,10 @@ struct CollectiveMma<
     CUTE_STATIC_ASSERT_V(Int<DispatchPolicy::Stages>{} == size<2>(sB));                                         // PIPE
     CUTE_STATIC_ASSERT_V(size<2>(tCrA) > _2{}, "RS loops require more than 2 MMA k-iterations for correctness.");
 
+    constexpr int K_BLOCK_MAX = size<2>(tCrA);
+    static_assert(K_BLOCK_MAX > PrefetchKBlocksA + 1,
+      "RS loops require more MMA k-iterations than PrefetchKBlocksA + 1 so prefetches never overwrite in-flight A fragments.");
+
     //
     // PIPELINED MAIN LOOP
     //
@@ -607,15 +614,20 @@ struct CollectiveMma<
       ++smem_pipe_read;
       barrier_token = pipeline.consumer_try_wait(smem_pipe_read);
 
-      // copy smem->rmem for A operand
-      copy(smem_tiled_copy_A, tCsA_copy_view(_,_,0,read_stage), tCrA_copy_view(_,_,0));
+      // copy smem->rmem for A operand, PrefetchKBlocksA k-blocks ahead of the GMMAs
+      CUTLASS_PRAGMA_UNROLL
+      for (int k_block = 0; k_block < PrefetchKBlocksA; ++k_block) {
+        copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block,read_stage), tCrA_copy_view(_,_,k_block));
+      }
       // transpose B operand in SMEM
       transpose(sB, gmma_sB, read_stage, 0);
       
       // Unroll the K mode manually to set scale D to 1
       CUTLASS_PRAGMA_UNROLL
-      for (int k_block = 0; k_block < size<2>(tCrA) - 1; ++k_block) {
-        copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block + 1,read_stage), tCrA_copy_view(_,_,k_block + 1));
+      for (int k_block = 0; k_block < K_BLOCK_MAX - 1; ++k_block) {
+        if (k_block + PrefetchKBlocksA < K_BLOCK_MAX) {
+          copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block + PrefetchKBlocksA,read_stage), tCrA_copy_view(_,_,k_block + PrefetchKBlocksA));
+        }
         transpose.synchronize(k_block);
         transpose(sB, gmma_sB, read_stage, k_block + 1);
         warpgroup_arrive();
@@ -638,7 +650,10 @@ struct CollectiveMma<
         return;
       }
       pipeline.consumer_wait(smem_pipe_read, barrier_token);
-      copy(smem_tiled_copy_A, tCsA_copy_view(_,_,0,smem_pipe_read.index()), tCrA_copy_view(_,_,0));
+      CUTLASS_PRAGMA_UNROLL
+      for (int k_block = 0; k_block < PrefetchKBlocksA; ++k_block) {
+        copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block,smem_pipe_read.index()), tCrA_copy_view(_,_,k_block));
+      }
       transpose(sB, gmma_sB, smem_pipe_read.index(), 0);
       warpgroup_wait<2>();
     }
@@ -658,18 +673,26 @@ struct CollectiveMma<
       warpgroup_fence_operand(accum);
       // Unroll the K mode manually to set scale D to 1
       CUTLASS_PRAGMA_UNROLL
-      for (int k_block = 0; k_block < size<2>(tCrA); ++k_block) {
+      for (int k_block = 0; k_block < K_BLOCK_MAX; ++k_block) {
         if (k_block == 0) {
           barrier_token = pipeline.consumer_try_wait(smem_pipe_read);
         }
-        if (k_block == size<2>(tCrA) - 1) {
+        // The last PrefetchKBlocksA k-blocks prefetch the head of the next k_tile
+        if (k_block == K_BLOCK_MAX - PrefetchKBlocksA) {
           pipeline.consumer_wait(smem_pipe_read, barrier_token);
-          copy(smem_tiled_copy_A, tCsA_copy_view(_,_,0,smem_pipe_read.index()), tCrA_copy_view(_,_,0));
+        }
+        if (k_block + PrefetchKBlocksA >= K_BLOCK_MAX) {
+          int k_block_next = k_block + PrefetchKBlocksA - K_BLOCK_MAX;
+          copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block_next,smem_pipe_read.index()), tCrA_copy_view(_,_,k_block_next));
+        }
+        else {
+          copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block + PrefetchKBlocksA,read_stage), tCrA_copy_view(_,_,k_block + PrefetchKBlocksA));
+        }
+        if (k_block == K_BLOCK_MAX - 1) {
           // transpose B operand in SMEM
           transpose(sB, gmma_sB, smem_pipe_read.index(), 0);
         } 
         else {
-          copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block + 1,read_stage), tCrA_copy_view(_,_,k_block + 1));
           // transpose B operand in SMEM
           transpose.synchronize(k_block);                                      // make transpose of k_block available
           transpose(sB, gmma_sB, read_stage, k_block + 1);
@@ -703,8 +726,10 @@ struct CollectiveMma<
       
       // Unroll the K mode manually to set scale D to 1
       CUTLASS_PRAGMA_UNROLL
-      for (int k_block = 0; k_block < size<2>(tCrA) - 1; ++k_block) {
-        copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block + 1,read_stage), tCrA_copy_view(_,_,k_block + 1));
+      for (int k_block = 0; k_block < K_BLOCK_MAX - 1; ++k_block) {
+        if (k_block + PrefetchKBlocksA < K_BLOCK_MAX) {
+          copy(smem_tiled_copy_A, tCsA_copy_view(_,_,k_block + PrefetchKBlocksA,read_stage), tCrA_copy_view(_,_,k_block + PrefetchKBlocksA));
+        }
         transpose.synchronize(k_block);                                           // make k_block transpose available
         transpose(sB, gmma_sB, read_stage, k_block + 1);
         warpgroup_arrive();
@@ -207,6 +207,7 @@ public:
   static constexpr int IsSubbyteA = cute::sizeof_bits_v<SwappedElementA> < 8;
   using TmaElementA = cute::conditional_t<IsSubbyteA, uint8_t, SwappedElementA>;
   using TmaElementScale = uint_bit_t<sizeof_bits_v<NonVoidElementScale> >; // in case we have array. translating to uint to satisfy tma descriptor's specialization
+  using TmaElementZero = uint_bit_t<sizeof_bits_v<NonVoidElementZero> >;
 
   using ArchTag = typename DispatchPolicy::ArchTag;
 
@@ -277,8 +278,13 @@ public:
   static constexpr ConversionMode KernelConversionMode = get_conversion_mode();
   static constexpr bool ModeHasScales = KernelConversionMode == ConversionMode::ConvertAndScale ||
                                         KernelConversionMode == ConversionMode::ConvertAndScaleWithZero;
-  static constexpr bool UseScaleLookupTable = KernelConversionMode == ConversionMode::ConvertAndScale &&
-                                              cutlass::detail::is_Array_v<ElementScale>;
+  // With a zero point, both the scale and the zero are lookup tables with the zero point folded in.
+  static constexpr bool UseScaleLookupTable = ModeHasScales && cutlass::detail::is_Array_v<ElementScale>;
+  static_assert(!UseScaleLookupTable || KernelConversionMode == ConversionMode::ConvertAndScale ||
+                cutlass::detail::is_Array_v<ElementZero>,
+                "Lookup table with zero point requires the zero to be a lookup table as well.");
+  static_assert(!cute::is_same_v<ElementScale, cutlass::float_ue8m0_t> || KernelConversionMode == ConversionMode::ConvertAndScale,
+                "Exponent-only (E8M0) scales are only supported without a zero point.");
   static constexpr size_t SmemAlignmentA = cutlass::detail::alignment_for_swizzle(SmemLayoutA{}); 
 
   static constexpr size_t SmemAlignmentB = cutlass::detail::alignment_for_swizzle(SmemLayoutB{});
@@ -340,7 +346,7 @@ public:
         ScaleTileShape{},
         _1{}));  // mcast along N mode for this M load, if any. Scale is ALWAYS loaded with A for RF kernel
 
-   using TMA_Zero = decltype(make_tma_copy(
+   using TMA_Zero = decltype(make_tma_copy<TmaElementZero>(
         GmemTiledCopyScale{},
         make_tensor(detail::get_logical_ptr(static_cast<NonVoidElementZero const*>(nullptr)), repeat_like(NonVoidStrideScale{}, int32_t(0)), NonVoidStrideScale{}),
         SmemLayoutScale{}(_,_,cute::Int<0>{}),
@@ -442,7 +448,7 @@ public:
       }
       else if constexpr(KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
         Tensor tensor_zero = make_tensor(detail::get_logical_ptr(args.ptr_Z), make_layout(make_shape(M,scale_k,L), dS));
-        tma_load_zero = make_tma_copy(
+        tma_load_zero = make_tma_copy<TmaElementZero>(
             GmemTiledCopyScale{},
             tensor_zero,
             SmemLayoutScale{}(_,_,cute::Int<0>{}),
@@ -117,6 +117,10 @@ struct CollectiveMma<
   // One threads per CTA are producers (1 for operand tile)
   static constexpr int NumProducerThreadEvents = 1; 
 
+  // The kernel may be launched with any cluster shape that evenly divides ClusterShape. The TMA boxes are
+  // sized for ClusterShape, so with a smaller cluster each block issues all slices owned by its multicast group.
+  static constexpr bool SupportsRuntimeClusterShape = true;
+
   static_assert(cute::rank(SmemLayoutAtomA{}) == 2, "SmemLayoutAtom must be rank 2 (M/N, K)");
   static_assert((size<0>(TileShape{}) % size<0>(SmemLayoutAtomA{})) == 0, "SmemLayoutAtom must evenly divide tile shape.");
   static_assert((size<2>(TileShape{}) % size<1>(SmemLayoutAtomA{})) == 0, "SmemLayoutAtom must evenly divide tile shape.");
@@ -171,6 +175,10 @@ struct CollectiveMma<
     ElementB const* ptr_B;
     StrideB dB;
     uint32_t mma_promotion_interval = 4;
+    // L2 eviction policies of the TMA loads, e.g., EVICT_FIRST for streamed weights
+    // and EVICT_LAST for activations reused by the next kernel
+    TMA::CacheHintSm90 cache_hint_A = TMA::CacheHintSm90::EVICT_NORMAL;
+    TMA::CacheHintSm90 cache_hint_B = TMA::CacheHintSm90::EVICT_NORMAL;
   };
 
   // Device side kernel params
@@ -194,6 +202,8 @@ struct CollectiveMma<
     uint32_t tma_transaction_bytes = TmaTransactionBytes;
     uint32_t tma_transaction_bytes_mk = TmaTransactionBytesMK;
     uint32_t tma_transaction_bytes_nk = TmaTransactionBytesNK;
+    TMA::CacheHintSm90 cache_hint_A = TMA::CacheHintSm90::EVICT_NORMAL;
+    TMA::CacheHintSm90 cache_hint_B = TMA::CacheHintSm90::EVICT_NORMAL;
   };
 
   //
@@ -236,7 +246,9 @@ struct CollectiveMma<
       tma_load_b,
       transaction_bytes,
       transaction_bytes_mk,
-      transaction_bytes_nk
+      transaction_bytes_nk,
+      args.cache_hint_A,
+      args.cache_hint_B
     };
   }
 
@@ -328,41 +340,31 @@ struct CollectiveMma<
       // Prepare the TMA loads for A and B
       //
 
-      constexpr uint32_t cluster_shape_x = get<0>(typename DispatchPolicy::ClusterShape());
-      uint2 cluster_local_block_id = {block_rank_in_cluster % cluster_shape_x, block_rank_in_cluster / cluster_shape_x};
+      // The launched cluster may be smaller than ClusterShape along either mode
+      dim3 cluster_shape = cute::cluster_shape();
+      uint2 cluster_local_block_id = {block_rank_in_cluster % cluster_shape.x, block_rank_in_cluster / cluster_shape.x};
 
       Tensor gA_mkl = get<0>(load_inputs);
       Tensor gB_nkl = get<1>(load_inputs);
 
-      auto block_tma_a = mainloop_params.tma_load_a.get_slice(cluster_local_block_id.y);
-      auto block_tma_b = mainloop_params.tma_load_b.get_slice(cluster_local_block_id.x);
-
       // Partition the inputs based on the current block coordinates.
       auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
       Tensor gA = gA_mkl(_,_,m_coord,_,l_coord);                                                     // (BLK_M,BLK_K,k)
       Tensor gB = gB_nkl(_,_,n_coord,_,l_coord);                                                     // (BLK_N,BLK_K,k)
 
-      // Applies the mapping from block_tma_a
-      Tensor tAgA = block_tma_a.partition_S(gA);                                                 // (TMA,TMA_M,TMA_K,k)
-      Tensor tAsA = block_tma_a.partition_D(sA);                                              // (TMA,TMA_M,TMA_K,PIPE)
-
-      Tensor tBgB = block_tma_b.partition_S(gB);                                                 // (TMA,TMA_N,TMA_K,k)
-      Tensor tBsB = block_tma_b.partition_D(sB);                                              // (TMA,TMA_N,TMA_K,PIPE)
-
       uint16_t mcast_mask_a = 0;
       uint16_t mcast_mask_b = 0;
 
       // Issue TmaLoads
       // Maps the tile -> block, value
+      auto block_layout = make_layout(make_shape(int(cluster_shape.x), int(cluster_shape.y), Int<1>{})); // (m,n) -> block_id
       if constexpr (cute::is_same_v<GmemTiledCopyA, SM90_TMA_LOAD_MULTICAST>) {
-        auto block_layout = Layout<typename DispatchPolicy::ClusterShape>{}; // (m,n) -> block_id
         for (int n = 0; n < size<1>(block_layout); ++n) {
           mcast_mask_a |= (uint16_t(1) << block_layout(cluster_local_block_id.x,n,Int<0>{}));
         }
       }
 
       if constexpr (cute::is_same_v<GmemTiledCopyB, SM90_TMA_LOAD_MULTICAST>) {
-        auto block_layout = Layout<typename DispatchPolicy::ClusterShape>{}; // (m,n) -> block_id
         for (int m = 0; m < size<0>(block_layout); ++m) {
           mcast_mask_b |= (uint16_t(1) << block_layout(m,cluster_local_block_id.y,Int<0>{}));
         }
@@ -382,8 +384,26 @@ struct CollectiveMma<
         BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_write);
 
         int write_stage = smem_pipe_write.index();
-        copy(mainloop_params.tma_load_a.with(*tma_barrier, mcast_mask_a), tAgA(_,_,_,*k_tile_iter), tAsA(_,_,_,write_stage));
-        copy(mainloop_params.tma_load_b.with(*tma_barrier, mcast_mask_b), tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+        // A is sliced across the N mode of ClusterShape. Each block issues every slice that maps onto it in the launched cluster.
+        CUTLASS_PRAGMA_UNROLL
+        for (int slice = 0; slice < size<1>(ClusterShape{}); ++slice) {
+          if (slice % cluster_shape.y == cluster_local_block_id.y) {
+            auto block_tma_a = mainloop_params.tma_load_a.get_slice(slice);
+            Tensor tAgA = block_tma_a.partition_S(gA);                                             // (TMA,TMA_M,TMA_K,k)
+            Tensor tAsA = block_tma_a.partition_D(sA);                                          // (TMA,TMA_M,TMA_K,PIPE)
+            copy(mainloop_params.tma_load_a.with(*tma_barrier, mcast_mask_a, mainloop_params.cache_hint_A), tAgA(_,_,_,*k_tile_iter), tAsA(_,_,_,write_stage));
+          }
+        }
+        // B is sliced across the M mode of ClusterShape
+        CUTLASS_PRAGMA_UNROLL
+        for (int slice = 0; slice < size<0>(ClusterShape{}); ++slice) {
+          if (slice % cluster_shape.x == cluster_local_block_id.x) {
+            auto block_tma_b = mainloop_params.tma_load_b.get_slice(slice);
+            Tensor tBgB = block_tma_b.partition_S(gB);                                             // (TMA,TMA_N,TMA_K,k)
+            Tensor tBsB = block_tma_b.partition_D(sB);                                          // (TMA,TMA_N,TMA_K,PIPE)
+            copy(mainloop_params.tma_load_b.with(*tma_barrier, mcast_mask_b, mainloop_params.cache_hint_B), tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+          }
+        }
         ++k_tile_iter;
 
         // Advance smem_pipe_write
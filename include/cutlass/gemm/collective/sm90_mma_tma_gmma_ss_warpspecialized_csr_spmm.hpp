@@ -0,0 +1,534 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/sm90_mma_tma_gmma_ss_warpspecialized.hpp"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/arch/cluster_sm90.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/numeric/arithmetic_tuple.hpp"
+
+#if !defined(__CUDACC_RTC__)
+#include <algorithm>
+#include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__CUDACC_RTC__)
+
+// Row-window plan of a CSR matrix for the CSR SpMM mainloop.
+// The rows of the sparse matrix are grouped into windows of window_rows (BLK_M) rows. The distinct
+// columns of a window are numbered in increasing order (the slots of the window), which condenses
+// the window into a dense (window_rows, distinct columns) block, and the slots are cut into
+// segments of segment_k columns. Every segment is one unit of work: a (BLK_M, segment_k) A tile
+// times the segment_k rows of B selected by its columns. The GEMM runs over the expanded problem
+// (units * window_rows, N, segment_k), and dst_rows maps its rows back to the rows of the sparse
+// matrix for the scatter-reduce epilogue. All units cost the same, so a power-law row length
+// distribution spreads across the SMs instead of serializing on the longest rows.
+struct CsrSpmmPlan {
+  int32_t window_rows = 0;
+  int32_t segment_k = 0;
+  int32_t units = 0;
+  std::vector<int32_t> nnz_slots;        // (nnz) slot of the column of every non-zero in its window
+  std::vector<int32_t> unit_window;      // (units) row window of every unit
+  std::vector<int32_t> unit_slot_begin;  // (units) first slot of every unit
+  std::vector<int32_t> unit_row_begin;   // (units, window_rows) first non-zero of every row in the unit
+  std::vector<int32_t> unit_cols;        // (units, segment_k) column (B row) of every slot, -1 past the window
+  std::vector<int32_t> dst_rows;         // (units * window_rows) row of the sparse matrix, -1 past M
+
+  // Rows of the expanded problem handed to the kernel
+  int64_t expanded_rows() const {
+    return static_cast<int64_t>(units) * window_rows;
+  }
+};
+
+// Builds the plan of an M-row CSR matrix with column indices sorted within each row
+inline CsrSpmmPlan
+make_csr_spmm_plan(
+    int32_t M,
+    int32_t const* row_offsets,
+    int32_t const* col_indices,
+    int32_t window_rows,
+    int32_t segment_k) {
+  CsrSpmmPlan plan;
+  plan.window_rows = window_rows;
+  plan.segment_k = segment_k;
+  plan.nnz_slots.resize(static_cast<size_t>(row_offsets[M]));
+
+  int32_t windows = (M + window_rows - 1) / window_rows;
+  std::vector<int32_t> window_cols;
+  for (int32_t window = 0; window < windows; ++window) {
+    int32_t row_begin = window * window_rows;
+    int32_t row_end = std::min(M, row_begin + window_rows);
+
+    window_cols.assign(col_indices + row_offsets[row_begin], col_indices + row_offsets[row_end]);
+    std::sort(window_cols.begin(), window_cols.end());
+    window_cols.erase(std::unique(window_cols.begin(), window_cols.end()), window_cols.end());
+    for (int32_t j = row_offsets[row_begin]; j < row_offsets[row_end]; ++j) {
+      plan.nnz_slots[j] = static_cast<int32_t>(
+        std::lower_bound(window_cols.begin(), window_cols.end(), col_indices[j]) - window_cols.begin());
+    }
+
+    int32_t slots = static_cast<int32_t>(window_cols.size());
+    for (int32_t slot_begin = 0; slot_begin < slots; slot_begin += segment_k) {
+      plan.unit_window.push_back(window);
+      plan.unit_slot_begin.push_back(slot_begin);
+      for (int32_t k = 0; k < segment_k; ++k) {
+        plan.unit_cols.push_back(slot_begin + k < slots ? window_cols[slot_begin + k] : -1);
+      }
+      for (int32_t r = 0; r < window_rows; ++r) {
+        int32_t row = row_begin + r;
+        int32_t first = 0;
+        if (row < M) {
+          // Slots increase along a row, so the row's non-zeros of the unit start at the first slot >= slot_begin
+          auto row_slots_begin = plan.nnz_slots.begin() + row_offsets[row];
+          auto row_slots_end = plan.nnz_slots.begin() + row_offsets[row + 1];
+          first = static_cast<int32_t>(std::lower_bound(row_slots_begin, row_slots_end, slot_begin) - plan.nnz_slots.begin());
+        }
+        plan.unit_row_begin.push_back(first);
+        plan.dst_rows.push_back(row < M ? row : -1);
+      }
+      ++plan.units;
+    }
+  }
+  return plan;
+}
+
+#endif // !defined(__CUDACC_RTC__)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// WarpSpecialized Mainloop for CSR sparse x dense products (SpMM), C = A_csr * B.
+//
+// The kernel runs over the expanded problem of a CsrSpmmPlan: work tile m is unit m of the plan,
+// i.e. segment_k condensed columns of one row window, and the K mode runs over the slots of the
+// segment. Per k-tile the producer warp
+//   - zeroes the A stage and scatters the CSR values of the window rows whose slots fall in the
+//     k-tile, walking a per-row cursor over the non-zeros,
+//   - gathers the B rows of the k-tile's columns with one TMA box per row and swizzle atom width,
+//     padding slots past the window are mapped past the end of B, which TMA fills with zeros.
+// The leader lane posts the B transaction bytes on acquire and a second arrival after the proxy
+// fence of the A stores, so the consumer side is the unchanged SS GMMA. Partial products of the
+// units of a window are combined by the RowScatterReduce epilogue with the plan's dst_rows, which
+// accumulates into C, so C must be cleared (or hold a residual) before the kernel runs.
+//
+// A (the CSR values) must be K-major with 16-bit or narrower elements and B MN-major, i.e. the
+// row-major (K, N) dense operand. The cluster shape must be 1x1x1 and L == 1.
+template <
+  int Stages,
+  class ClusterShape,
+  class KernelSchedule,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecializedCsrSpmm<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  //
+  // Type Aliases
+  //
+  using Base = CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+  using DispatchPolicy = MainloopSm90TmaGmmaWarpSpecializedCsrSpmm<Stages, ClusterShape, KernelSchedule>;
+  using typename Base::TileShape;
+  using typename Base::ElementA;
+  using typename Base::StrideA;
+  using typename Base::ElementB;
+  using typename Base::StrideB;
+  using typename Base::TiledMma;
+  using typename Base::InternalElementB;
+  using typename Base::SmemLayoutAtomB;
+  using typename Base::SmemLayoutA;
+  using typename Base::SmemLayoutB;
+  using typename Base::MainloopPipeline;
+  using typename Base::PipelineState;
+  using typename Base::TensorStorage;
+
+  // The leader lane arrives once with the B transaction bytes and once after the A stores of the warp
+  static constexpr int NumProducerThreadEvents = 2;
+  static constexpr bool SupportsRuntimeClusterShape = false;
+
+  static constexpr int TileM = size<0>(TileShape{});
+  static constexpr int TileK = size<2>(TileShape{});
+  static constexpr int RowsPerLane = TileM / NumThreadsPerWarp;
+  static constexpr int VecElements = 128 / sizeof_bits_v<ElementA>;
+  using VecA = cutlass::Array<ElementA, VecElements>;
+
+  // Each gathered B row of a stage is loaded as AtomsPerNTile boxes of (AtomN, 1), one per smem swizzle atom along N
+  static constexpr int AtomN = size<0>(SmemLayoutAtomB{});
+  static constexpr int AtomsPerNTile = size<1>(TileShape{}) / AtomN;
+
+  static_assert(size(ClusterShape{}) == 1, "CSR SpMM mainloop requires a 1x1x1 cluster shape.");
+  static_assert(::cutlass::gemm::detail::is_k_major<StrideA>(), "CSR SpMM requires a K-major A.");
+  static_assert(::cutlass::gemm::detail::is_mn_major<StrideB>(), "CSR SpMM gathers rows of a row-major (K, N) B.");
+  static_assert(sizeof_bits_v<ElementA> <= 16, "CSR SpMM supports 16-bit or narrower A types.");
+  static_assert(cute::is_same_v<typename TiledMma::ValTypeA, ElementA>, "Scattered A is stored to smem in its MMA type.");
+  static_assert(TileM % NumThreadsPerWarp == 0, "BLK_M must be a multiple of the producer warp size.");
+  static_assert(TileK % VecElements == 0, "BLK_K must be a multiple of the 16B vector.");
+
+  // One row of one swizzle atom; the hardware applies the swizzle from the smem address of the row
+  using SmemLayoutRowB = decltype(composition(SmemLayoutAtomB{},
+      make_layout(make_shape(Int<AtomN>{}, _1{}), make_stride(_1{}, _0{}))));
+
+  using TMA_GatherB = decltype(make_tma_copy(
+      SM90_TMA_LOAD{},
+      make_tensor(static_cast<InternalElementB const*>(nullptr), repeat_like(StrideB{}, int32_t(0)), StrideB{}),
+      SmemLayoutRowB{},
+      make_shape(Int<AtomN>{}, _1{}),
+      _1{}));
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_values;                      // (nnz) CSR values
+    int32_t const* ptr_row_offsets;                  // (M + 1) CSR row offsets
+    int32_t M;                                       // Rows of the sparse matrix
+    // Device copies of the CsrSpmmPlan arrays
+    int32_t const* ptr_nnz_slots;
+    int32_t const* ptr_unit_window;
+    int32_t const* ptr_unit_slot_begin;
+    int32_t const* ptr_unit_row_begin;
+    int32_t const* ptr_unit_cols;
+    ElementB const* ptr_B;                           // (rows_B, N) dense operand
+    StrideB dB;
+    int32_t rows_B;                                  // Columns of the sparse matrix
+  };
+
+  // Device side kernel params
+  struct Params : Base::Params {
+    TMA_GatherB tma_gather_b;
+    ElementA const* ptr_values;
+    int32_t const* ptr_row_offsets;
+    int32_t const* ptr_nnz_slots;
+    int32_t const* ptr_unit_window;
+    int32_t const* ptr_unit_slot_begin;
+    int32_t const* ptr_unit_row_begin;
+    int32_t const* ptr_unit_cols;
+    int32_t M;
+    int32_t N;
+    int32_t segment_k;
+    int32_t rows_B;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    // Neither A nor the tiled B are loaded with the descriptors of the base collective.
+    // Only the gathered B rows complete through the transaction count.
+    typename Base::Params base_params{};
+    base_params.tma_transaction_bytes = Base::TmaTransactionBytesNK;
+
+    auto ptr_B = reinterpret_cast<InternalElementB const*>(args.ptr_B);
+    Tensor tensor_b = make_tensor(ptr_B, make_layout(make_shape(int32_t(N), args.rows_B, int32_t(1)), args.dB));
+    TMA_GatherB tma_gather_b = make_tma_copy(
+        SM90_TMA_LOAD{},
+        tensor_b,
+        SmemLayoutRowB{},
+        make_shape(Int<AtomN>{}, _1{}),
+        _1{});
+
+    return {
+      base_params,
+      tma_gather_b,
+      args.ptr_values,
+      args.ptr_row_offsets,
+      args.ptr_nnz_slots,
+      args.ptr_unit_window,
+      args.ptr_unit_slot_begin,
+      args.ptr_unit_row_begin,
+      args.ptr_unit_cols,
+      args.M,
+      static_cast<int32_t>(N),
+      static_cast<int32_t>(K),
+      args.rows_B
+    };
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    constexpr int min_tma_aligned_elements_B = tma_alignment_bits / cutlass::sizeof_bits<ElementB>::value;
+    bool implementable = cutlass::detail::check_alignment<min_tma_aligned_elements_B>(
+      cute::make_shape(N, args.rows_B, 1), args.dB);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+    }
+    if (L != 1 || M % TileM != 0 || K % TileK != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: CSR SpMM requires the expanded plan problem (units * BLK_M, N, segment_k, 1) "
+                         "with segment_k a multiple of BLK_K.\n");
+      implementable = false;
+    }
+    if (args.ptr_values == nullptr || args.ptr_row_offsets == nullptr || args.ptr_nnz_slots == nullptr ||
+        args.ptr_unit_window == nullptr || args.ptr_unit_slot_begin == nullptr ||
+        args.ptr_unit_row_begin == nullptr || args.ptr_unit_cols == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: CSR SpMM requires the CSR matrix and its plan.\n");
+      implementable = false;
+    }
+    return implementable;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& mainloop_params) {
+    cute::prefetch_tma_descriptor(mainloop_params.tma_gather_b.get_tma_descriptor());
+  }
+
+  /// Set up the data needed by this collective for load and mma.
+  /// Neither operand is loaded as a tile, so the returned tensors only carry the tile counts.
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE auto
+  load_init(ProblemShape_MNKL const& problem_shape_MNKL, Params const& mainloop_params) const {
+    using X = Underscore;
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    Tensor mA_mkl = make_identity_tensor(make_shape(M,K,L));                                      // (m,k,l)
+    Tensor mB_nkl = make_identity_tensor(make_shape(N,K,L));                                      // (n,k,l)
+
+    Tensor gA_mkl = local_tile(mA_mkl, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{});        // (BLK_M,BLK_K,m,k,l)
+    Tensor gB_nkl = local_tile(mB_nkl, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{});        // (BLK_N,BLK_K,n,k,l)
+
+    return cute::make_tuple(gA_mkl, gB_nkl);
+  }
+
+  /// Perform a collective-scoped matrix multiply-accumulate
+  /// Producer Perspective
+  /// Must be called by the whole producer warp: the A rows and the B row gathers are split across its lanes.
+  template <
+    class TensorA, class TensorB,
+    class KTileIterator, class BlockCoord
+  >
+  CUTLASS_DEVICE void
+  load(
+      Params const& mainloop_params,
+      MainloopPipeline pipeline,
+      PipelineState smem_pipe_write,
+      cute::tuple<TensorA, TensorB> const& load_inputs,
+      BlockCoord const& blk_coord,
+      KTileIterator k_tile_iter, int k_tile_count,
+      int thread_idx,
+      uint32_t block_rank_in_cluster,
+      TensorStorage& shared_tensors) {
+    int lane_idx = thread_idx % NumThreadsPerWarp;
+    int lane_predicate = cute::elect_one_sync();
+
+    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
+
+    auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
+    int32_t unit = static_cast<int32_t>(m_coord);
+    int32_t window = mainloop_params.ptr_unit_window[unit];
+    int32_t slot_begin = mainloop_params.ptr_unit_slot_begin[unit];
+    int32_t const* unit_cols = mainloop_params.ptr_unit_cols + static_cast<int64_t>(unit) * mainloop_params.segment_k;
+
+    // The gathered B as (n,row) coordinates of the dense operand, tiled by one row of a swizzle atom
+    Tensor mB_rows = mainloop_params.tma_gather_b.get_tma_tensor(
+      make_shape(mainloop_params.N, mainloop_params.rows_B, 1));                                    // (n,rows,l)
+    Tensor gB_rows = local_tile(mB_rows, make_shape(Int<AtomN>{}, _1{}), make_coord(_,_,_));   // (ATOM_N,1,atoms,rows,l)
+    auto block_tma_b = mainloop_params.tma_gather_b.get_slice(0);
+    Tensor tBgB = block_tma_b.partition_S(gB_rows);                                           // (TMA,1,1,atoms,rows,l)
+
+    // Non-zero cursors of the window rows of this lane, empty for rows past M
+    int32_t cursor[RowsPerLane];
+    int32_t row_end[RowsPerLane];
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < RowsPerLane; ++i) {
+      int row = window * TileM + lane_idx + i * NumThreadsPerWarp;
+      if (row < mainloop_params.M) {
+        cursor[i] = mainloop_params.ptr_unit_row_begin[unit * TileM + lane_idx + i * NumThreadsPerWarp];
+        row_end[i] = mainloop_params.ptr_row_offsets[row + 1];
+      }
+      else {
+        cursor[i] = 0;
+        row_end[i] = 0;
+      }
+    }
+
+    // Mainloop
+    CUTLASS_PRAGMA_NO_UNROLL
+    for ( ; k_tile_count > 0; --k_tile_count) {
+      // LOCK smem_pipe_write for _writing_, the leader also posts the transaction bytes of B
+      if (lane_predicate) {
+        pipeline.producer_acquire(smem_pipe_write);
+      }
+      __syncwarp();
+
+      using BarrierType = typename MainloopPipeline::ProducerBarrierType;
+      BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_write);
+
+      int write_stage = smem_pipe_write.index();
+      int k_tile = *k_tile_iter;
+
+      // Gather the B rows of the k-tile. Padding slots read past the end of B, which TMA fills with zeros.
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int box = lane_idx; box < TileK * AtomsPerNTile; box += NumThreadsPerWarp) {
+        int k = box / AtomsPerNTile;
+        int atom = box % AtomsPerNTile;
+        int32_t src_row = unit_cols[k_tile * TileK + k];
+        src_row = src_row < 0 ? mainloop_params.rows_B : src_row;
+
+        // Unswizzled offset of the row within the stage
+        auto row_offset = SmemLayoutB{}.layout_b()(atom * AtomN, k, write_stage);
+        Tensor sB_row = make_tensor(make_smem_ptr(shared_tensors.smem_B.data() + row_offset),
+                                    make_layout(make_shape(Int<AtomN>{}, _1{})));               // (ATOM_N,1)
+        Tensor tBsB = block_tma_b.partition_D(sB_row);                                             // (TMA,1,1)
+        copy(mainloop_params.tma_gather_b.with(*tma_barrier),
+             tBgB(_,_,_,n_coord * AtomsPerNTile + atom,src_row,0), tBsB);
+      }
+
+      // Scatter the non-zeros of the k-tile into the cleared A stage
+      int32_t slot_lo = slot_begin + k_tile * TileK;
+      int32_t slot_hi = slot_lo + TileK;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < RowsPerLane; ++i) {
+        int row = lane_idx + i * NumThreadsPerWarp;
+        CUTLASS_PRAGMA_UNROLL
+        for (int col = 0; col < TileK; col += VecElements) {
+          VecA zeros;
+          zeros.clear();
+          *reinterpret_cast<VecA*>(&sA(row, col, write_stage)) = zeros;
+        }
+
+        int32_t j = cursor[i];
+        while (j < row_end[i] && mainloop_params.ptr_nnz_slots[j] < slot_lo) {
+          ++j;
+        }
+        for ( ; j < row_end[i]; ++j) {
+          int32_t slot = mainloop_params.ptr_nnz_slots[j];
+          if (slot >= slot_hi) {
+            break;
+          }
+          sA(row, slot - slot_lo, write_stage) = mainloop_params.ptr_values[j];
+        }
+        cursor[i] = j;
+      }
+
+      // Make the generic proxy stores of the warp visible to GMMA before the leader arrives
+      cutlass::arch::fence_view_async_shared();
+      __syncwarp();
+      if (lane_predicate) {
+        pipeline.producer_commit(smem_pipe_write, [](BarrierType* barrier) {
+          cutlass::arch::ClusterBarrier::arrive(barrier);
+        });
+      }
+      ++k_tile_iter;
+
+      // Advance smem_pipe_write
+      ++smem_pipe_write;
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
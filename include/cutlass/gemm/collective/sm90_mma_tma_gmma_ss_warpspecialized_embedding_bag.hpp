@@ -0,0 +1,387 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/sm90_mma_tma_gmma_ss_warpspecialized.hpp"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/arch/cluster_sm90.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/numeric/arithmetic_tuple.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// WarpSpecialized Mainloop whose A operand is an embedding bag pooled on the fly.
+//
+// Row m of A is the sum (or mean) of the embedding table rows listed by bag m:
+//
+//   A(m,k) = sum_{j in [offsets[m], offsets[m+1])} w(j) * table(indices[j], k)
+//
+// with the optional per-sample weights w (1 when absent). The offsets/indices pair is the CSR layout
+// used by torch.nn.EmbeddingBag, so the pooled (M, K) activations never round trip through global memory.
+// TMA can gather rows but not add them, so the producer warp builds each A stage itself: its lanes
+// read 16B vectors of the bag rows, accumulate them in fp32, and store the rounded result to the
+// swizzled smem stage, while the leader lane loads B with TMA as in the base collective. After a
+// proxy fence the leader posts a second arrival on the full barrier of the stage, which therefore
+// completes once both the B transaction and the A stores are done. The MMA side is unchanged.
+//
+// A must be K-major with 16-bit or narrower elements, and K a multiple of the 16B vector. The
+// kernel handles a single batch (L == 1).
+template <
+  int Stages,
+  class ClusterShape,
+  class KernelSchedule,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecializedEmbeddingBagA<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  //
+  // Type Aliases
+  //
+  using Base = CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+  using DispatchPolicy = MainloopSm90TmaGmmaWarpSpecializedEmbeddingBagA<Stages, ClusterShape, KernelSchedule>;
+  using typename Base::TileShape;
+  using typename Base::ElementA;
+  using typename Base::StrideA;
+  using typename Base::ElementB;
+  using typename Base::StrideB;
+  using typename Base::TiledMma;
+  using typename Base::SmemLayoutA;
+  using typename Base::SmemLayoutB;
+  using typename Base::MainloopPipeline;
+  using typename Base::PipelineState;
+  using typename Base::TensorStorage;
+
+  // Index type of the bag offsets and of the table row indices
+  using EmbeddingIndex = int64_t;
+
+  // The leader lane arrives once with the B transaction bytes and once after the A stores of the warp
+  static constexpr int NumProducerThreadEvents = 2;
+
+  static constexpr int TileM = size<0>(TileShape{});
+  static constexpr int TileK = size<2>(TileShape{});
+  // Each lane pools 16B vectors of one table row, which lie in a single 16B chunk of every GMMA K-major
+  // swizzle atom and can be stored unchanged
+  static constexpr int VecElements = 128 / sizeof_bits_v<ElementA>;
+  static constexpr int VecsPerRow = TileK / VecElements;
+  static constexpr int VecsPerTile = TileM * VecsPerRow;
+  using VecA = cutlass::Array<ElementA, VecElements>;
+  using VecCompute = cutlass::Array<float, VecElements>;
+
+  static_assert(::cutlass::gemm::detail::is_k_major<StrideA>(), "Embedding-bag A requires a K-major A.");
+  static_assert(sizeof_bits_v<ElementA> <= 16, "Embedding-bag A supports 16-bit or narrower A types.");
+  static_assert(cute::is_same_v<typename TiledMma::ValTypeA, ElementA>, "Pooled A is stored to smem in its MMA type.");
+  static_assert(TileK % VecElements == 0, "BLK_K must be a multiple of the 16B vector.");
+  static_assert(VecsPerTile % NumThreadsPerWarp == 0, "The vectors of an A tile must split evenly across the producer warp.");
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_table;                       // (rows, K) embedding table
+    StrideA dA;                                      // Stride of the embedding table
+    ElementB const* ptr_B;
+    StrideB dB;
+    EmbeddingIndex const* ptr_offsets;               // M + 1 bag offsets into ptr_indices
+    EmbeddingIndex const* ptr_indices;               // Table row of every bag entry
+    float const* ptr_per_sample_weights = nullptr;   // Optional weight of every bag entry
+    bool mean = false;                               // Average instead of sum the rows of a bag
+    uint32_t mma_promotion_interval = 4;
+    TMA::CacheHintSm90 cache_hint_B = TMA::CacheHintSm90::EVICT_NORMAL;
+  };
+
+  // Device side kernel params
+  struct Params : Base::Params {
+    ElementA const* ptr_table;
+    int64_t ld_table;
+    EmbeddingIndex const* ptr_offsets;
+    EmbeddingIndex const* ptr_indices;
+    float const* ptr_per_sample_weights;
+    bool mean;
+    int32_t M;
+    int32_t K;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    // The A descriptor of the base collective is built over the table but never issued
+    typename Base::Arguments base_args{args.ptr_table, args.dA, args.ptr_B, args.dB, args.mma_promotion_interval};
+    base_args.cache_hint_B = args.cache_hint_B;
+    typename Base::Params base_params = Base::to_underlying_arguments(problem_shape, base_args, workspace);
+
+    // Only the B tile completes through the transaction count
+    base_params.tma_transaction_bytes = base_params.tma_transaction_bytes_nk;
+
+    return {
+      base_params,
+      args.ptr_table,
+      static_cast<int64_t>(get<0>(args.dA)),
+      args.ptr_offsets,
+      args.ptr_indices,
+      args.ptr_per_sample_weights,
+      args.mean,
+      static_cast<int32_t>(M),
+      static_cast<int32_t>(K)
+    };
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    typename Base::Arguments base_args{args.ptr_table, args.dA, args.ptr_B, args.dB};
+    bool implementable = Base::can_implement(problem_shape, base_args);
+    if (L != 1) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Embedding-bag A supports a single batch.\n");
+      implementable = false;
+    }
+    if (K % VecElements != 0 ||
+        reinterpret_cast<uintptr_t>(args.ptr_table) % 16 != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Embedding-bag A requires K and the table aligned to 16B vectors.\n");
+      implementable = false;
+    }
+    if (args.ptr_offsets == nullptr || args.ptr_indices == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Embedding-bag A requires bag offsets and indices.\n");
+      implementable = false;
+    }
+    return implementable;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& mainloop_params) {
+    cute::prefetch_tma_descriptor(mainloop_params.tma_load_b.get_tma_descriptor());
+  }
+
+  /// Perform a collective-scoped matrix multiply-accumulate
+  /// Producer Perspective
+  /// Must be called by the whole producer warp: the vectors of the A tile are split across its lanes.
+  template <
+    class TensorA, class TensorB,
+    class KTileIterator, class BlockCoord
+  >
+  CUTLASS_DEVICE void
+  load(
+      Params const& mainloop_params,
+      MainloopPipeline pipeline,
+      PipelineState smem_pipe_write,
+      cute::tuple<TensorA, TensorB> const& load_inputs,
+      BlockCoord const& blk_coord,
+      KTileIterator k_tile_iter, int k_tile_count,
+      int thread_idx,
+      uint32_t block_rank_in_cluster,
+      TensorStorage& shared_tensors) {
+    int lane_idx = thread_idx % NumThreadsPerWarp;
+    int lane_predicate = cute::elect_one_sync();
+
+    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
+    Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+
+    // The launched cluster may be smaller than ClusterShape along either mode
+    dim3 cluster_shape = cute::cluster_shape();
+    uint2 cluster_local_block_id = {block_rank_in_cluster % cluster_shape.x, block_rank_in_cluster / cluster_shape.x};
+
+    Tensor gB_nkl = get<1>(load_inputs);
+    auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
+    Tensor gB = gB_nkl(_,_,n_coord,_,l_coord);                                                       // (BLK_N,BLK_K,k)
+
+    uint16_t mcast_mask_b = 0;
+    if constexpr (cute::is_same_v<GmemTiledCopyB_, SM90_TMA_LOAD_MULTICAST>) {
+      auto block_layout = make_layout(make_shape(int(cluster_shape.x), int(cluster_shape.y), Int<1>{})); // (m,n) -> block_id
+      for (int m = 0; m < size<0>(block_layout); ++m) {
+        mcast_mask_b |= (uint16_t(1) << block_layout(m,cluster_local_block_id.y,Int<0>{}));
+      }
+    }
+
+    NumericArrayConverter<float, ElementA, VecElements> convert_in{};
+    NumericArrayConverter<ElementA, float, VecElements> convert_out{};
+    multiply_add<VecCompute> fma_op{};
+    int m_base = m_coord * TileM;
+
+    // Mainloop
+    CUTLASS_PRAGMA_NO_UNROLL
+    for ( ; k_tile_count > 0; --k_tile_count) {
+      // LOCK smem_pipe_write for _writing_, the leader also posts the transaction bytes of B
+      if (lane_predicate) {
+        pipeline.producer_acquire(smem_pipe_write);
+      }
+      __syncwarp();
+
+      using BarrierType = typename MainloopPipeline::ProducerBarrierType;
+      BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_write);
+
+      int write_stage = smem_pipe_write.index();
+
+      // Issue B first so that its transfer overlaps the pooling of A
+      if (lane_predicate) {
+        // B is sliced across the M mode of ClusterShape
+        CUTLASS_PRAGMA_UNROLL
+        for (int slice = 0; slice < size<0>(ClusterShape{}); ++slice) {
+          if (slice % cluster_shape.x == cluster_local_block_id.x) {
+            auto block_tma_b = mainloop_params.tma_load_b.get_slice(slice);
+            Tensor tBgB = block_tma_b.partition_S(gB);                                             // (TMA,TMA_N,TMA_K,k)
+            Tensor tBsB = block_tma_b.partition_D(sB);                                          // (TMA,TMA_N,TMA_K,PIPE)
+            copy(mainloop_params.tma_load_b.with(*tma_barrier, mcast_mask_b, mainloop_params.cache_hint_B), tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+          }
+        }
+      }
+
+      // Pool the A tile. Rows past M and empty bags are zero.
+      int k_base = *k_tile_iter * TileK;
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int v = lane_idx; v < VecsPerTile; v += NumThreadsPerWarp) {
+        int row = v / VecsPerRow;
+        int col = (v % VecsPerRow) * VecElements;
+        int m = m_base + row;
+        int k = k_base + col;
+
+        VecCompute accum;
+        accum.clear();
+        if (m < mainloop_params.M && k < mainloop_params.K) {
+          EmbeddingIndex bag_begin = mainloop_params.ptr_offsets[m];
+          EmbeddingIndex bag_end = mainloop_params.ptr_offsets[m + 1];
+          for (EmbeddingIndex j = bag_begin; j < bag_end; ++j) {
+            EmbeddingIndex table_row = mainloop_params.ptr_indices[j];
+            VecA values = *reinterpret_cast<VecA const*>(mainloop_params.ptr_table + table_row * mainloop_params.ld_table + k);
+            float weight = mainloop_params.ptr_per_sample_weights != nullptr ? mainloop_params.ptr_per_sample_weights[j] : 1.0f;
+            accum = fma_op(convert_in(values), weight, accum);
+          }
+          if (mainloop_params.mean && bag_end > bag_begin) {
+            multiplies<VecCompute> mul_op{};
+            accum = mul_op(accum, 1.0f / static_cast<float>(bag_end - bag_begin));
+          }
+        }
+        *reinterpret_cast<VecA*>(&sA(row, col, write_stage)) = convert_out(accum);
+      }
+
+      // Make the generic proxy stores of the warp visible to GMMA before the leader arrives
+      cutlass::arch::fence_view_async_shared();
+      __syncwarp();
+      if (lane_predicate) {
+        pipeline.producer_commit(smem_pipe_write, [](BarrierType* barrier) {
+          cutlass::arch::ClusterBarrier::arrive(barrier);
+        });
+      }
+      ++k_tile_iter;
+
+      // Advance smem_pipe_write
+      ++smem_pipe_write;
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
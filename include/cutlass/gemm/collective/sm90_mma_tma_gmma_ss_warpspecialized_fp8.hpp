@@ -34,6 +34,7 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/collective/fp8_accumulation.hpp"
+#include "cutlass/transform/collective/sm90_wgmma_transpose.hpp"
 #include "cutlass/trace.h"
 #include "cutlass/numeric_types.h"
 
@@ -137,6 +138,12 @@ struct CollectiveMma<
       make_shape(shape<1>(TileShape{}), shape<2>(TileShape{}), Int<DispatchPolicy::Stages>{}),
       cute::conditional_t< ::cutlass::gemm::detail::is_major<0,StrideB>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{}));
 
+  // MN-major A and B tiles are loaded as is and transposed in smem, since 8-bit GMMA is K-major only
+  using TransposeA = cutlass::transform::collective::GmmaSmemTranspose<
+      TiledMma, typename TiledMma::ValTypeA, SmemLayoutAtomA, SmemLayoutA>;
+  using TransposeB = cutlass::transform::collective::GmmaSmemTranspose<
+      TiledMma, typename TiledMma::ValTypeB, SmemLayoutAtomB, SmemLayoutB>;
+
   static_assert(DispatchPolicy::Stages >= 2, "Specialization requires Stages set to value 1 or more.");
   static_assert(cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeA>::value &&
                 cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeB>::value,
@@ -431,8 +438,13 @@ struct CollectiveMma<
     static_assert(cute::is_void_v<SmemCopyAtomB>,
       "SM90 GMMA mainloops cannot have a non-void copy atom for smem sourced instructions.");
 
-    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
-    Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+    // GMMA reads the K-major view of transposed operands
+    Tensor sA = TransposeA::make_gmma_tensor(shared_tensors.smem_A.data());                     // (BLK_M,BLK_K,PIPE)
+    Tensor sB = TransposeB::make_gmma_tensor(shared_tensors.smem_B.data());                     // (BLK_N,BLK_K,PIPE)
+
+    int warp_idx = canonical_warp_idx_sync();
+    TransposeA transpose_a(warp_idx, thread_idx % NumThreadsPerWarpGroup);
+    TransposeB transpose_b(warp_idx, thread_idx % NumThreadsPerWarpGroup);
 
     //
     // Define C accumulators and A/B partitioning
@@ -497,6 +509,8 @@ struct CollectiveMma<
       }
 
       int read_stage = smem_pipe_read.index();
+      transpose_a.transpose(shared_tensors.smem_A.data(), read_stage);
+      transpose_b.transpose(shared_tensors.smem_B.data(), read_stage);
       warpgroup_arrive();
       // Unroll the K mode manually to set scale D to 1
       CUTLASS_PRAGMA_UNROLL
@@ -528,6 +542,8 @@ struct CollectiveMma<
       //
 
       int read_stage = smem_pipe_read.index();
+      transpose_a.transpose(shared_tensors.smem_A.data(), read_stage);
+      transpose_b.transpose(shared_tensors.smem_B.data(), read_stage);
 
       if (accumulation.prepare_if_needed()) {
         tiled_mma.accumulate_ = GMMA::ScaleOut::Zero;
@@ -47,6 +47,7 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/threadblock/threadblock_swizzle.h"
 #include "cutlass/gemm/kernel/gemm_universal.h"
+#include "cutlass/gemm/kernel/grouped_problem_visitor.h"
 
 #include "cutlass/gemm/kernel/default_gemm_universal.h"
 #include "cutlass/gemm/device/default_gemm_configuration.h"
@@ -143,7 +144,9 @@ private:
 
   /// Precomputes scheduling information for the grouped GEMM
   Status precompute(Arguments const &args, int32_t tile_count, void* workspace) {
-    size_t workspace_bytes = get_workspace_size(args);
+    size_t workspace_bytes = BaseKernel::ProblemVisitor::get_workspace_size(args.host_problem_sizes,
+                                                                            args.problem_count,
+                                                                            args.threadblock_count);
     std::vector<uint8_t> host_workspace(workspace_bytes);
     BaseKernel::ProblemVisitor::host_precompute(args.host_problem_sizes,
                                                 args.problem_count,
@@ -194,7 +197,19 @@ public:
   /// Gets the workspace size
   static size_t get_workspace_size(Arguments const &args) {
     if (BaseKernel::ProblemVisitor::kRequiresPrecomputation) {
-      return BaseKernel::ProblemVisitor::get_workspace_size(args.host_problem_sizes,
+      size_t workspace_bytes = BaseKernel::ProblemVisitor::get_workspace_size(args.host_problem_sizes,
+                                                                              args.problem_count,
+                                                                              args.threadblock_count);
+
+      // Partial accumulators shared by threadblocks splitting a tile follow the schedule
+      if constexpr (BaseKernel::ProblemVisitor::kSplitsTiles) {
+        workspace_bytes += BaseKernel::kWorkspaceBytesPerBlock * size_t(args.threadblock_count);
+      }
+
+      return workspace_bytes;
+    } else if (BaseKernel::ProblemVisitor::kPrecomputesOnDevice) {
+      // The schedule is sized by the problem count alone, so host problem sizes are not needed
+      return BaseKernel::ProblemVisitor::get_workspace_size(nullptr,
                                                             args.problem_count,
                                                             args.threadblock_count);
     } else {
@@ -326,6 +341,11 @@ public:
       return occupancy_based_block_count;
     }
 
+    // Splitting tiles along K balances any number of tiles across a full wave
+    if (BaseKernel::ProblemVisitor::kSplitsTiles) {
+      return occupancy_based_block_count;
+    }
+
     int total_tiles = group_tile_count(problem_sizes_ptr, problem_count);
 
     // If the group contains a single problem, launching the exact number of
@@ -433,6 +453,15 @@ public:
 
     // Launch
     cutlass::arch::synclog_setup();
+
+    // Compute the schedule from the device-side problem sizes on the same stream, so that
+    // sizes written by preceding work on the stream are observed
+    if constexpr (BaseKernel::ProblemVisitor::kPrecomputesOnDevice) {
+      using ProblemVisitor = typename BaseKernel::ProblemVisitor;
+      cutlass::gemm::kernel::GroupedProblemVisitorPrecompute<ProblemVisitor>
+        <<<1, ProblemVisitor::kPrecomputeThreadCount, 0, stream>>>(params_.problem_visitor);
+    }
+
     cutlass::Kernel<BaseKernel><<<grid, block, smem_size, stream>>>(params_);
 
     //
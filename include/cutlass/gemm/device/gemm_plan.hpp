@@ -0,0 +1,285 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file
+  \brief Reusable, graph-safe launch plan for CUTLASS 3.x GEMM kernels.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/kernel_launch.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+
+#if !defined(__CUDACC_RTC__)
+#include "cutlass/cluster_launch.hpp"
+#include "cutlass/trace.h"
+#endif // !defined(__CUDACC_RTC__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  GemmPlan captures everything needed to launch a CUTLASS 3.x GEMM kernel for one problem
+  configuration: the kernel params, grid, block and cluster dimensions, dynamic shared memory
+  size and workspace. All device queries and function attribute updates happen once, in
+  initialize(). After that the plan is immutable.
+
+  launch() issues only the kernel, plus workspace initialization for kernels that need a
+  workspace, such as stream-K. It makes no device queries and sets no function attributes,
+  so it is safe inside stream capture. The pointer-patching overload re-lowers the stored
+  arguments with new A/B/C/D pointers. Define CUTE_ENABLE_TMA_DESCRIPTOR_CACHE to turn the
+  TMA descriptor rebuild in that path into an address patch.
+
+  The plan's workspace is used by every launch. Launches that may run concurrently need
+  separate plans.
+*/
+template <class GemmKernel_>
+class GemmPlan {
+public:
+  using Adapter = GemmUniversalAdapter<GemmKernel_>;
+  using GemmKernel = typename Adapter::GemmKernel;
+  using Arguments = typename Adapter::Arguments;
+  using Params = typename Adapter::Params;
+
+  static_assert(gemm::detail::IsCutlass3GemmKernel<GemmKernel>::value,
+    "GemmPlan requires a CUTLASS 3.x GEMM kernel.");
+
+  /// Operand pointers patched into the stored arguments on launch
+  struct Pointers {
+    decltype(cute::declval<Arguments>().mainloop.ptr_A) ptr_A{};
+    decltype(cute::declval<Arguments>().mainloop.ptr_B) ptr_B{};
+    decltype(cute::declval<Arguments>().epilogue.ptr_C) ptr_C{};
+    decltype(cute::declval<Arguments>().epilogue.ptr_D) ptr_D{};
+  };
+
+private:
+
+  Arguments args_{};
+  Params params_{};
+  void* workspace_ = nullptr;
+  size_t workspace_size_ = 0;
+  dim3 grid_{1, 1, 1};
+  dim3 block_{1, 1, 1};
+  dim3 cluster_{1, 1, 1};
+  int smem_size_ = 0;
+  bool initialized_ = false;
+
+  static constexpr bool kIsStatic1x1x1 =
+    cute::is_static_v<typename GemmKernel::DispatchPolicy::ClusterShape> and
+    cute::size(typename GemmKernel::DispatchPolicy::ClusterShape{}) == 1;
+
+  static constexpr bool kClusterLaunch = GemmKernel::ArchTag::kMinComputeCapability == 90 && !kIsStatic1x1x1;
+
+public:
+
+  /// Determines whether the plan can be created for the given problem
+  static Status
+  can_implement(Arguments const& args) {
+    return Adapter::can_implement(args);
+  }
+
+  /// Gets the workspace size required by the plan
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return Adapter::get_workspace_size(args);
+  }
+
+  /// Returns true once initialize() has succeeded
+  bool is_initialized() const {
+    return initialized_;
+  }
+
+  /// Access the Params structure used by launch(stream)
+  Params const& params() const {
+    return params_;
+  }
+
+  dim3 grid_shape() const { return grid_; }
+  dim3 block_shape() const { return block_; }
+  dim3 cluster_shape() const { return cluster_; }
+
+  /// Builds the plan. Resolves the hardware info, sets the kernel's function attributes and
+  /// lowers the arguments. `workspace` must hold get_workspace_size(args) bytes and outlive the plan.
+  Status
+  initialize(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+    CUTLASS_TRACE_HOST("GemmPlan::initialize()");
+    initialized_ = false;
+
+    if constexpr (Adapter::kEnableCudaHostAdapter) {
+      CUTLASS_TRACE_HOST("  GemmPlan does not support launching through a CUDA host adapter.");
+      return Status::kErrorNotSupported;
+    }
+
+    Status status = can_implement(args);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    args_ = args;
+
+    // Resolve the hardware info once so that lowering never queries the device
+    if (args_.hw_info.sm_count <= 0) {
+      args_.hw_info.sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args_.hw_info.device_id);
+    }
+    if (args_.hw_info.max_active_clusters <= 0 && GemmKernel::ArchTag::kMinComputeCapability >= 90) {
+      args_.hw_info.max_active_clusters = KernelHardwareInfo::query_device_max_active_clusters<GemmKernel>();
+    }
+
+    workspace_size_ = get_workspace_size(args_);
+    if (workspace_size_ > 0 && workspace == nullptr) {
+      return Status::kErrorWorkspaceNull;
+    }
+    workspace_ = workspace;
+
+    status = GemmKernel::initialize_workspace(args_, workspace_, stream, nullptr);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    params_ = GemmKernel::to_underlying_arguments(args_, workspace_);
+
+    smem_size_ = GemmKernel::SharedStorageSize;
+    if (smem_size_ >= (48 << 10)) {
+      cudaError_t result = cudaFuncSetAttribute(
+          device_kernel<GemmKernel>,
+          cudaFuncAttributeMaxDynamicSharedMemorySize,
+          smem_size_);
+      if (cudaSuccess != result) {
+        result = cudaGetLastError(); // to clear the error bit
+        CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error: " << cudaGetErrorString(result));
+        return Status::kErrorInternal;
+      }
+    }
+
+    block_ = GemmKernel::get_block_shape();
+    grid_ = GemmKernel::get_grid_shape(params_);
+    cluster_ = dim3(cute::size<0>(typename GemmKernel::DispatchPolicy::ClusterShape{}),
+                    cute::size<1>(typename GemmKernel::DispatchPolicy::ClusterShape{}),
+                    cute::size<2>(typename GemmKernel::DispatchPolicy::ClusterShape{}));
+    if constexpr (cutlass::gemm::kernel::detail::Has_RuntimeClusterShape_v<GemmKernel>) {
+      cluster_ = params_.hw_info.cluster_shape;
+    }
+
+    if constexpr (kClusterLaunch) {
+      if (ClusterLauncher::check_cluster_dims(grid_, cluster_) != Status::kSuccess) {
+        return Status::kInvalid;
+      }
+      status = ClusterLauncher::init((void const*) device_kernel<GemmKernel>);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    initialized_ = true;
+    return Status::kSuccess;
+  }
+
+  /// Launches the kernel with the params captured at initialization
+  Status
+  launch(cudaStream_t stream = nullptr, bool launch_with_pdl = false) const {
+    Params params = params_;
+    return launch_(params, stream, launch_with_pdl);
+  }
+
+  /// Launches the kernel on new operand pointers. The problem shape, strides and every other
+  /// argument remain those given to initialize().
+  Status
+  launch(Pointers const& ptrs, cudaStream_t stream = nullptr, bool launch_with_pdl = false) const {
+    if (!initialized_) {
+      return Status::kErrorInternal;
+    }
+    Arguments args = args_;
+    args.mainloop.ptr_A = ptrs.ptr_A;
+    args.mainloop.ptr_B = ptrs.ptr_B;
+    args.epilogue.ptr_C = ptrs.ptr_C;
+    args.epilogue.ptr_D = ptrs.ptr_D;
+    Params params = GemmKernel::to_underlying_arguments(args, workspace_);
+    return launch_(params, stream, launch_with_pdl);
+  }
+
+private:
+
+  Status
+  launch_(Params& params, cudaStream_t stream, bool launch_with_pdl) const {
+    if (!initialized_) {
+      return Status::kErrorInternal;
+    }
+
+    // Kernels with a workspace (e.g. stream-K) expect it to be reset before every launch
+    if (workspace_size_ > 0) {
+      Status status = GemmKernel::initialize_workspace(args_, workspace_, stream, nullptr);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    Status launch_result = Status::kSuccess;
+    if constexpr (kClusterLaunch) {
+#if defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
+      // Attributes were set during initialize(), so launch directly instead of via ClusterLauncher::launch
+      void* kernel_params[] = {&params};
+      ClusterLauncher::LaunchConfig config = ClusterLauncher::make_cluster_launch_config(
+        grid_, cluster_, block_, smem_size_, stream, launch_with_pdl);
+      cudaError_t result = cudaLaunchKernelExC(
+        &config.launch_config, (void const*) device_kernel<GemmKernel>, kernel_params);
+      launch_result = (result == cudaSuccess) ? Status::kSuccess : Status::kErrorInternal;
+#else
+      CUTLASS_TRACE_HOST("GemmPlan::launch: CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED not defined! Aborting cluster launch.");
+      return Status::kInvalid;
+#endif
+    }
+    else {
+      launch_result = cutlass::kernel_launch<GemmKernel>(
+        grid_, block_, smem_size_, stream, params, launch_with_pdl);
+    }
+
+    cudaError_t result = cudaGetLastError();
+    if (cudaSuccess == result && Status::kSuccess == launch_result) {
+      return Status::kSuccess;
+    }
+    else {
+      CUTLASS_TRACE_HOST("  Kernel launch failed. Reason: " << result);
+      return Status::kErrorInternal;
+    }
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::device
+
+////////////////////////////////////////////////////////////////////////////////
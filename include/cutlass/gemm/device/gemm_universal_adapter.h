@@ -110,6 +110,14 @@ constexpr int stages_member(DispatchPolicy) {
   }
 }
 
+// Whether the kernel's tile scheduler decomposes the K extent of output tiles (the stream-K scheduler)
+template <class Arguments, class Enable = void>
+struct has_scheduler_decomposition_mode : cute::false_type {};
+
+template <class Arguments>
+struct has_scheduler_decomposition_mode<Arguments,
+    cute::void_t<decltype(cute::declval<Arguments&>().scheduler.decomposition_mode)>> : cute::true_type {};
+
 } // namespace detail
 
 template <class GemmKernel_>
@@ -231,6 +239,32 @@ public:
     }
   }
 
+  /// Constrains the arguments to a deterministic, batch-invariant reduction over K. The order in which
+  /// the K extent of each output element is reduced then depends on neither M nor the SM count, so D is
+  /// bitwise identical across batch sizes and devices for a given kernel. Stream-K and heuristic
+  /// decompositions fall back to data-parallel. A split-K decomposition with a caller-fixed split count
+  /// is kept and reduces its splits in K order.
+  static Arguments
+  make_deterministic_arguments(Arguments args) {
+    if constexpr (detail::has_scheduler_decomposition_mode<Arguments>::value) {
+      using DecompositionMode = decltype(args.scheduler.decomposition_mode);
+      using ReductionMode = decltype(args.scheduler.reduction_mode);
+
+      bool fixed_split_k = args.scheduler.splits > 1 &&
+        (args.scheduler.decomposition_mode == DecompositionMode::Heuristic ||
+         args.scheduler.decomposition_mode == DecompositionMode::SplitK);
+      if (fixed_split_k) {
+        args.scheduler.decomposition_mode = DecompositionMode::SplitK;
+      }
+      else {
+        args.scheduler.decomposition_mode = DecompositionMode::DataParallel;
+        args.scheduler.splits = 1;
+      }
+      args.scheduler.reduction_mode = ReductionMode::Deterministic;
+    }
+    return args;
+  }
+
   /// Gets the workspace size
   static size_t
   get_workspace_size(Arguments const& args) {
@@ -388,6 +422,10 @@ public:
       [[maybe_unused]] dim3 cluster(cute::size<0>(typename GemmKernel::DispatchPolicy::ClusterShape{}),
         cute::size<1>(typename GemmKernel::DispatchPolicy::ClusterShape{}),
         cute::size<2>(typename GemmKernel::DispatchPolicy::ClusterShape{}));
+      if constexpr (cutlass::gemm::kernel::detail::Has_RuntimeClusterShape_v<GemmKernel>) {
+        // Kernels that support a runtime cluster shape record the one to launch with in their params
+        cluster = params.hw_info.cluster_shape;
+      }
       [[maybe_unused]] void* kernel_params[] = {&params};
 
       if constexpr (kEnableCudaHostAdapter) {
@@ -730,3 +768,22 @@ public:
 } // namespace cutlass::gemm::device
 
 ////////////////////////////////////////////////////////////////////////////////
+
+/// Explicit instantiation helpers for device-level GEMMs.
+///
+/// Instantiate a GEMM once in a dedicated translation unit and declare it extern in every other translation
+/// unit that uses it, so that its member functions, and with them the kernel, collectives and TMA descriptor
+/// construction, are only compiled once:
+///
+///   // my_gemm.cu
+///   CUTLASS_GEMM_ADAPTER_INSTANTIATE(MyGemmKernel);
+///
+///   // any other .cu that constructs or runs GemmUniversalAdapter<MyGemmKernel>
+///   CUTLASS_GEMM_ADAPTER_EXTERN(MyGemmKernel);
+#define CUTLASS_GEMM_ADAPTER_EXTERN(...) \
+  extern template class cutlass::gemm::device::GemmUniversalAdapter<__VA_ARGS__>
+
+#define CUTLASS_GEMM_ADAPTER_INSTANTIATE(...) \
+  template class cutlass::gemm::device::GemmUniversalAdapter<__VA_ARGS__>
+
+////////////////////////////////////////////////////////////////////////////////
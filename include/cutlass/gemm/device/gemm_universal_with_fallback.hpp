@@ -0,0 +1,212 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file
+  \brief Runtime dispatch between a TMA GEMM kernel and a cp.async fallback for unaligned strides.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+
+#if !defined(__CUDACC_RTC__)
+#include "cutlass/trace.h"
+#endif // !defined(__CUDACC_RTC__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  GemmUniversalWithFallback pairs a primary CUTLASS 3.x kernel, typically an SM90 TMA
+  warp-specialized kernel, with a fallback kernel built from the same tile configuration on a
+  cp.async schedule (KernelCpAsyncWarpSpecialized*). The fallback must be built with a smaller
+  operand alignment.
+
+  TMA needs every non-unit stride of A and B to be a multiple of 16 bytes. A leading dimension
+  that breaks this, such as an odd K for row-major fp16 A, makes the descriptor impossible to
+  encode for the whole tensor. The problem can't be split into a TMA bulk plus a residue. The
+  fallback kernel reads such operands in place instead, without padding copies. Extents that
+  are not tile multiples are handled by TMA OOB fill and need no fallback.
+
+  The choice is made per initialize() from the primary kernel's can_implement(). Both kernels
+  must share the problem shape and the epilogue arguments. The cp.async kernels accept the same
+  TMA epilogues as the TMA kernels, so a single CollectiveEpilogue can serve both. An epilogue
+  whose C/D strides may be unaligned must itself be one that tolerates them, e.g.
+  NoSmemWarpSpecialized.
+*/
+template <class PrimaryKernel_, class FallbackKernel_>
+class GemmUniversalWithFallback {
+public:
+  using Primary = GemmUniversalAdapter<PrimaryKernel_>;
+  using Fallback = GemmUniversalAdapter<FallbackKernel_>;
+  using PrimaryKernel = typename Primary::GemmKernel;
+  using FallbackKernel = typename Fallback::GemmKernel;
+  using Arguments = typename Primary::Arguments;
+  using FallbackArguments = typename Fallback::Arguments;
+
+  static_assert(gemm::detail::IsCutlass3GemmKernel<PrimaryKernel>::value &&
+                gemm::detail::IsCutlass3GemmKernel<FallbackKernel>::value,
+    "GemmUniversalWithFallback requires CUTLASS 3.x GEMM kernels.");
+  static_assert(cute::is_same_v<typename PrimaryKernel::ProblemShape, typename FallbackKernel::ProblemShape>,
+    "Primary and fallback kernels must share the problem shape type.");
+  static_assert(cute::is_same_v<typename PrimaryKernel::EpilogueArguments, typename FallbackKernel::EpilogueArguments>,
+    "Primary and fallback kernels must share the epilogue arguments.");
+
+private:
+
+  Primary primary_{};
+  Fallback fallback_{};
+  bool use_fallback_ = false;
+
+public:
+
+  /// Maps primary arguments onto the fallback kernel. Only the operand pointers and strides are
+  /// taken from the mainloop arguments; the scheduler arguments carry over when their types match.
+  static FallbackArguments
+  to_fallback_arguments(Arguments const& args) {
+    FallbackArguments fallback_args{};
+    fallback_args.mode = args.mode;
+    fallback_args.problem_shape = args.problem_shape;
+    fallback_args.mainloop.ptr_A = args.mainloop.ptr_A;
+    fallback_args.mainloop.dA = args.mainloop.dA;
+    fallback_args.mainloop.ptr_B = args.mainloop.ptr_B;
+    fallback_args.mainloop.dB = args.mainloop.dB;
+    fallback_args.epilogue = args.epilogue;
+    fallback_args.hw_info = args.hw_info;
+    if constexpr (cute::is_same_v<decltype(args.scheduler), decltype(fallback_args.scheduler)>) {
+      fallback_args.scheduler = args.scheduler;
+    }
+    return fallback_args;
+  }
+
+  /// Returns true if the primary kernel cannot run the given problem and the fallback is used
+  static bool
+  requires_fallback(Arguments const& args) {
+    return Primary::can_implement(args) != Status::kSuccess;
+  }
+
+  /// Determines whether either kernel can run the given problem
+  static Status
+  can_implement(Arguments const& args) {
+    if (!requires_fallback(args)) {
+      return Status::kSuccess;
+    }
+    CUTLASS_TRACE_HOST("GemmUniversalWithFallback::can_implement() - primary kernel rejected the problem, checking fallback");
+    return Fallback::can_implement(to_fallback_arguments(args));
+  }
+
+  /// Gets the workspace size of the kernel that will run the given problem
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    if (requires_fallback(args)) {
+      return Fallback::get_workspace_size(to_fallback_arguments(args));
+    }
+    return Primary::get_workspace_size(args);
+  }
+
+  /// Returns true if the last initialize() selected the fallback kernel
+  bool uses_fallback() const {
+    return use_fallback_;
+  }
+
+  /// Selects the kernel for the given problem and initializes it
+  Status
+  initialize(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    use_fallback_ = requires_fallback(args);
+    if (use_fallback_) {
+      CUTLASS_TRACE_HOST("GemmUniversalWithFallback::initialize() - using fallback kernel");
+      FallbackArguments fallback_args = to_fallback_arguments(args);
+      Status status = Fallback::can_implement(fallback_args);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+      return fallback_.initialize(fallback_args, workspace, stream, cuda_adapter);
+    }
+    return primary_.initialize(args, workspace, stream, cuda_adapter);
+  }
+
+  /// Launches the kernel selected by the last initialize()
+  Status
+  run(
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr,
+    bool launch_with_pdl = false) {
+    if (use_fallback_) {
+      return fallback_.run(stream, cuda_adapter, launch_with_pdl);
+    }
+    return primary_.run(stream, cuda_adapter, launch_with_pdl);
+  }
+
+  /// Selects, initializes and launches the kernel for the given problem
+  Status
+  run(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr,
+    bool launch_with_pdl = false) {
+    Status status = initialize(args, workspace, stream, cuda_adapter);
+    if (status == Status::kSuccess) {
+      status = run(stream, cuda_adapter, launch_with_pdl);
+    }
+    return status;
+  }
+
+  Status
+  operator()(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr,
+    bool launch_with_pdl = false) {
+    return run(args, workspace, stream, cuda_adapter, launch_with_pdl);
+  }
+
+  Status
+  operator()(cudaStream_t stream = nullptr, CudaHostAdapter* cuda_adapter = nullptr, bool launch_with_pdl = false) {
+    return run(stream, cuda_adapter, launch_with_pdl);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::device
+
+////////////////////////////////////////////////////////////////////////////////
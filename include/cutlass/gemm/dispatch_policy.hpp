@@ -31,7 +31,9 @@
 #pragma once
 
 #include "cutlass/arch/arch.h"
+#include "cutlass/blas3_types.h"
 #include "cutlass/gemm/gemm.h"
+#include "cutlass/numeric_size.h"
 
 #include "cute/layout.hpp"
 #include "cute/numeric/integral_constant.hpp" // cute::false_type
@@ -92,6 +94,81 @@ struct Has_SwapAB <T, CUTE_STL_NAMESPACE::void_t<decltype(T::SwapAB)>>
 template <typename T>
 static constexpr bool Has_SwapAB_v = Has_SwapAB<T>::value;
 
+// Has_RuntimeClusterShape<T>::value will be true only if:
+//   class T has member SupportsRuntimeClusterShape and T::SupportsRuntimeClusterShape is true.
+// Such mainloops and kernels accept a cluster shape chosen at runtime through KernelHardwareInfo::cluster_shape.
+template <typename T, typename = void>
+struct Has_RuntimeClusterShape { static constexpr bool value = false; };
+
+template <typename T>
+struct Has_RuntimeClusterShape <T, CUTE_STL_NAMESPACE::void_t<decltype(T::SupportsRuntimeClusterShape)>>
+{ static constexpr bool value = T::SupportsRuntimeClusterShape; };
+
+template <typename T>
+static constexpr bool Has_RuntimeClusterShape_v = Has_RuntimeClusterShape<T>::value;
+
+// Has_RegisterRequirement<T>::value will be true only if:
+//   class T has members LoadRegisterRequirement and MmaRegisterRequirement.
+// Warp-specialized kernel schedules use these to pin the producer/consumer register split.
+template <typename T, typename = void>
+struct Has_RegisterRequirement { static constexpr bool value = false; };
+
+template <typename T>
+struct Has_RegisterRequirement <T, CUTE_STL_NAMESPACE::void_t<decltype(T::LoadRegisterRequirement),
+                                                              decltype(T::MmaRegisterRequirement)>>
+{ static constexpr bool value = true; };
+
+// Has_FusionSharedStorage<T>::value will be true only if:
+//   class T has member type FusionCallbacks whose SharedStorage is not empty.
+// Such epilogues (row/column broadcasts, aux tensors, reductions) keep extra per-thread state live.
+template <typename T, typename = void>
+struct Has_FusionSharedStorage { static constexpr bool value = false; };
+
+template <typename T>
+struct Has_FusionSharedStorage <T, CUTE_STL_NAMESPACE::void_t<typename T::FusionCallbacks::SharedStorage>>
+{ static constexpr bool value = not cute::is_empty_v<typename T::FusionCallbacks::SharedStorage>; };
+
+// Register split between the producer (load) warp group and each of the two consumer (MMA) warp groups
+// of the SM90 TMA warp-specialized kernels. A schedule may pin the split (see KernelScheduleRegisterSplit).
+// Otherwise consumers holding a large accumulator tile together with a fused epilogue, or a very large
+// accumulator tile, take 240 registers and leave 32 to the producer; all others use 232 and 40.
+template <
+  class KernelSchedule,
+  class TileShape,
+  class ElementAccumulator,
+  int NumAccumulatorThreads,
+  class CollectiveEpilogue
+>
+struct Sm90RegisterRequirement {
+  static constexpr int AccumulatorRegisters =
+    cute::size<0>(TileShape{}) * cute::size<1>(TileShape{}) * cutlass::sizeof_bits<ElementAccumulator>::value / 32
+    / NumAccumulatorThreads;
+  static constexpr bool PreferMmaRegisters =
+    AccumulatorRegisters >= 192 ||
+    (AccumulatorRegisters >= 128 && Has_FusionSharedStorage<CollectiveEpilogue>::value);
+
+  static constexpr uint32_t Load = [] {
+    if constexpr (Has_RegisterRequirement<KernelSchedule>::value) {
+      return static_cast<uint32_t>(KernelSchedule::LoadRegisterRequirement);
+    }
+    else {
+      return PreferMmaRegisters ? 32u : 40u;
+    }
+  }();
+  static constexpr uint32_t Mma = [] {
+    if constexpr (Has_RegisterRequirement<KernelSchedule>::value) {
+      return static_cast<uint32_t>(KernelSchedule::MmaRegisterRequirement);
+    }
+    else {
+      return PreferMmaRegisters ? 240u : 232u;
+    }
+  }();
+
+  static_assert(Load % 8 == 0 && Mma % 8 == 0, "Register requirements must be multiples of 8.");
+  static_assert(Load >= 24 && Mma <= 256, "Register requirements must lie in [24, 256].");
+  static_assert(Load + 2 * Mma <= 512, "Register split exceeds the register file for one producer and two consumer warp groups.");
+};
+
 } // namespace kernel::detail
 
 //////////////////////////////////////////////////////////////////////////////
@@ -113,14 +190,55 @@ struct KernelTmaWarpSpecializedCooperative {
 struct KernelPtrArrayTmaWarpSpecializedCooperative { };
 struct KernelPtrArrayTmaWarpSpecializedPingpong { };
 
+// Pins the producer/consumer register split of a TMA warp-specialized kernel schedule, e.g.
+//   KernelScheduleRegisterSplit<KernelTmaWarpSpecializedCooperative, 32, 240>
+// LoadRegisters go to the producer warp group, MmaRegisters to each consumer warp group.
+template <class KernelSchedule, uint32_t LoadRegisters, uint32_t MmaRegisters>
+struct KernelScheduleRegisterSplit : KernelSchedule {
+  static constexpr uint32_t LoadRegisterRequirement = LoadRegisters;
+  static constexpr uint32_t MmaRegisterRequirement = MmaRegisters;
+};
+
 // FP8 related policies (including Blocked Scaled Accumulation)
 struct KernelTmaWarpSpecializedCooperativeFP8BlockScaledAccum: KernelTmaWarpSpecializedCooperative { };
+// Ptr-Array and Grouped GEMM with Blocked Scaled Accumulation. A is scaled per (ScaleGranularityM x BLK_K) block,
+// where ScaleGranularityM == 0 selects BLK_M, and B is scaled per (BLK_N x BLK_K) block.
+template<int ScaleGranularityM_ = 0>
+struct KernelPtrArrayTmaWarpSpecializedCooperativeFP8BlockScaledAccum: KernelPtrArrayTmaWarpSpecializedCooperative {
+  static constexpr int ScaleGranularityM = ScaleGranularityM_;
+};
 
 // Policies to opt into mixed type GEMMs
 struct KernelTmaWarpSpecializedMixedInput : KernelTmaWarpSpecialized { };
 struct KernelTmaWarpSpecializedPingpongMixedInput : KernelTmaWarpSpecializedPingpong { };
 struct KernelTmaWarpSpecializedCooperativeMixedInput: KernelTmaWarpSpecializedCooperative { };
 
+// Policies to opt into planar complex GEMMs
+struct KernelTmaWarpSpecializedPingpongPlanarComplex : KernelTmaWarpSpecializedPingpong { };
+struct KernelTmaWarpSpecializedCooperativePlanarComplex : KernelTmaWarpSpecializedCooperative { };
+
+// Policies to opt into FP32 GEMMs emulated with three TF32 GMMAs (3xTF32)
+struct KernelTmaWarpSpecializedPingpongFastF32 : KernelTmaWarpSpecializedPingpong { };
+struct KernelTmaWarpSpecializedCooperativeFastF32 : KernelTmaWarpSpecializedCooperative { };
+
+// Policies to opt into GEMMs with a Blocked-ELL sparse A operand
+struct KernelTmaWarpSpecializedPingpongBlockedEll : KernelTmaWarpSpecializedPingpong { };
+struct KernelTmaWarpSpecializedCooperativeBlockedEll : KernelTmaWarpSpecializedCooperative { };
+
+// Policies to opt into rank-2k updates (SYR2K) accumulating A * B^T + B * A^T in one mainloop
+struct KernelTmaWarpSpecializedPingpongRank2K : KernelTmaWarpSpecializedPingpong { };
+struct KernelTmaWarpSpecializedCooperativeRank2K : KernelTmaWarpSpecializedCooperative { };
+
+// Policy to opt into GEMMs whose A operand is triangular (TRMM, and the two halves of SYMM). Only the
+// FillModeA triangle of A is read, with a unit or zero diagonal for DiagType::kUnit / kZero.
+template <FillMode FillModeA, DiagType DiagTypeA = DiagType::kNonUnit>
+struct KernelTmaWarpSpecializedCooperativeTriangularA : KernelTmaWarpSpecializedCooperative { };
+
+// Policy to opt into non-persistent cooperative GEMMs whose epilogue reuses the shared memory of the
+// drained mainloop stages. Each CTA computes a single output tile, so the mainloop and epilogue tensor
+// storage are unioned and the epilogue no longer needs a carveout from the stage count.
+struct KernelTmaWarpSpecializedCooperativeEpilogueSmemReuse : KernelTmaWarpSpecializedCooperative { };
+
 //////////////////////////////////////////////////////////////////////////////
 
 //
@@ -237,15 +355,33 @@ struct MainloopSm90TmaGmmaWarpSpecialized {
   using Schedule = KernelSchedule;
 };
 
+// n-buffer in smem (Hopper TMA), Warp specialized dynamic schedule, no MMA.
+// Each output tile's accumulators are TMA loaded from a global (M,N,L) tensor, so that the
+// collective epilogue and its fusion callbacks run standalone as an elementwise kernel.
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperative
+>
+struct MainloopSm90TmaAccumulatorLoadWarpSpecialized {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+};
+
 // n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
 // With GMMA's A data from registers.
+// PrefetchKBlocksA is how many k-blocks ahead of the in-flight GMMA the smem->rmem copies of A are issued.
 template<
   int Stages_,
   class ClusterShape_ = Shape<_1,_1,_1>,
-  class KernelSchedule = KernelTmaWarpSpecialized
+  class KernelSchedule = KernelTmaWarpSpecialized,
+  int PrefetchKBlocksA_ = 1
 >
 struct MainloopSm90TmaGmmaRmemAWarpSpecialized {
   constexpr static int Stages = Stages_;
+  constexpr static int PrefetchKBlocksA = PrefetchKBlocksA_;
   using ClusterShape = ClusterShape_;
   using ArchTag = arch::Sm90;
   using Schedule = KernelSchedule;
@@ -254,6 +390,39 @@ struct MainloopSm90TmaGmmaRmemAWarpSpecialized {
     cute::is_same_v<Schedule, KernelTmaWarpSpecializedPingpong> ||
     cute::is_same_v<Schedule, KernelTmaWarpSpecializedCooperative>,
     "KernelSchedule must be one of the warp specialized policies");
+  static_assert(PrefetchKBlocksA >= 1, "PrefetchKBlocksA must be at least 1");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// With GMMA's A data from registers, normalized by LayerNorm between the smem->rmem copy and the GMMA.
+// The LayerNorm vectors are loaded with cp.async next to the TMA loads, which needs the producer
+// arrival count that only the cooperative kernel forwards to the pipeline.
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperative,
+  int PrefetchKBlocksA_ = 1
+>
+struct MainloopSm90TmaGmmaRmemAWarpSpecializedLayerNorm
+  : MainloopSm90TmaGmmaRmemAWarpSpecialized<Stages_, ClusterShape_, KernelSchedule, PrefetchKBlocksA_> {
+  static_assert(cute::is_same_v<KernelSchedule, KernelTmaWarpSpecializedCooperative>,
+    "LayerNorm mainloop fusion requires the cooperative warp specialized schedule");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// With GMMA's A data from registers, loaded as 16b and quantized to FP8 by a per-token scale between
+// the smem->rmem copy and the GMMA. The scales are loaded with cp.async next to the TMA loads, which
+// needs the producer arrival count that only the cooperative kernel forwards to the pipeline.
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperative,
+  int PrefetchKBlocksA_ = 1
+>
+struct MainloopSm90TmaGmmaRmemAWarpSpecializedQuantizeA
+  : MainloopSm90TmaGmmaRmemAWarpSpecialized<Stages_, ClusterShape_, KernelSchedule, PrefetchKBlocksA_> {
+  static_assert(cute::is_same_v<KernelSchedule, KernelTmaWarpSpecializedCooperative>,
+    "A quantization mainloop fusion requires the cooperative warp specialized schedule");
 };
 
 
@@ -291,6 +460,121 @@ struct MainloopSm90TmaGmmaWarpSpecializedFP8
 };
 
 
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// For planar complex kernels: the real and imaginary planes of A and B are stacked in one smem tile
+// so that a single real GMMA produces all four partial products
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperativePlanarComplex
+>
+struct MainloopSm90TmaGmmaWarpSpecializedPlanarComplex
+  : MainloopSm90TmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+  static_assert(
+    cute::is_base_of_v<KernelTmaWarpSpecializedPingpong, KernelSchedule> ||
+    cute::is_base_of_v<KernelTmaWarpSpecializedCooperative, KernelSchedule>,
+    "KernelSchedule must be one of the Pingpong or Cooperative warp specialized policies");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// For FP32 kernels emulated with TF32 GMMAs: each operand is split into a big and a small TF32 part
+// and every k-block issues small*big, big*small and big*big GMMAs into the same accumulator
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperativeFastF32
+>
+struct MainloopSm90TmaGmmaWarpSpecializedFastF32
+  : MainloopSm90TmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+  static_assert(
+    cute::is_base_of_v<KernelTmaWarpSpecializedPingpong, KernelSchedule> ||
+    cute::is_base_of_v<KernelTmaWarpSpecializedCooperative, KernelSchedule>,
+    "KernelSchedule must be one of the Pingpong or Cooperative warp specialized policies");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// For GEMMs whose A operand is Blocked-ELL sparse: the K mode runs over the packed ELL columns and
+// B is loaded at the block column of each non-zero block
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperativeBlockedEll
+>
+struct MainloopSm90TmaGmmaWarpSpecializedBlockedEll
+  : MainloopSm90TmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+  static_assert(
+    cute::is_base_of_v<KernelTmaWarpSpecializedPingpong, KernelSchedule> ||
+    cute::is_base_of_v<KernelTmaWarpSpecializedCooperative, KernelSchedule>,
+    "KernelSchedule must be one of the Pingpong or Cooperative warp specialized policies");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// For rank-2k updates (SYR2K): the k tiles of every output tile run over A * B^T and then over
+// B * A^T, so the kernel must be scheduled with a rank-2 TriangularScheduler
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperativeRank2K
+>
+struct MainloopSm90TmaGmmaWarpSpecializedRank2K
+  : MainloopSm90TmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+  static_assert(
+    cute::is_base_of_v<KernelTmaWarpSpecializedPingpong, KernelSchedule> ||
+    cute::is_base_of_v<KernelTmaWarpSpecializedCooperative, KernelSchedule>,
+    "KernelSchedule must be one of the Pingpong or Cooperative warp specialized policies");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// For triangular A operands: the producer warp stages the diagonal offset of every A tile next to it,
+// and the math warp groups clear the elements outside FillModeA of tiles crossing the diagonal before
+// issuing GMMAs. Like the embedding-bag mainloop it needs the second producer arrival of the
+// cooperative kernel. The kernel must be scheduled with a TriangularKScheduler to skip empty k tiles.
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  FillMode FillModeA_ = FillMode::kLower,
+  DiagType DiagTypeA_ = DiagType::kNonUnit,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperativeTriangularA<FillModeA_, DiagTypeA_>
+>
+struct MainloopSm90TmaGmmaWarpSpecializedTriangularA
+  : MainloopSm90TmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+  static constexpr FillMode kFillModeA = FillModeA_;
+  static constexpr DiagType kDiagTypeA = DiagTypeA_;
+  static_assert(FillModeA_ == FillMode::kLower || FillModeA_ == FillMode::kUpper,
+    "Triangular A mainloop requires FillMode::kLower or FillMode::kUpper");
+  static_assert(cute::is_base_of_v<KernelTmaWarpSpecializedCooperative, KernelSchedule>,
+    "Triangular A mainloop requires the cooperative warp specialized schedule");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// The A tile is pooled from the rows of an embedding table by the producer warp (embedding-bag sum or
+// mean over CSR offsets/indices) and stored to smem, while B is loaded with TMA. The extra producer
+// arrival on the full barrier needs the arrival count that only the cooperative kernel forwards.
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperative
+>
+struct MainloopSm90TmaGmmaWarpSpecializedEmbeddingBagA
+  : MainloopSm90TmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+  static_assert(cute::is_same_v<KernelSchedule, KernelTmaWarpSpecializedCooperative>,
+    "Embedding-bag A mainloop requires the cooperative warp specialized schedule");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// For CSR sparse x dense products (SpMM): each work tile is a segment of a row window of the CSR
+// matrix, whose A tile the producer warp scatters to smem while the B rows are gathered with TMA
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperative
+>
+struct MainloopSm90TmaGmmaWarpSpecializedCsrSpmm
+  : MainloopSm90TmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+  static_assert(cute::is_same_v<KernelSchedule, KernelTmaWarpSpecializedCooperative>,
+    "CSR SpMM mainloop requires the cooperative warp specialized schedule");
+};
+
 // n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
 // For FP8 kernels with Block Scaling
 template<
@@ -322,6 +606,32 @@ struct MainloopSm90ArrayTmaGmmaWarpSpecialized {
     "KernelSchedule must be one of the Ptr-Array or Grouped Gemm TMA Warp Specialized Cooperative or Pingpong policies");
 };
 
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule for Ptr-Array and Grouped Gemm
+// For FP8 kernels with Block Scaling
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelPtrArrayTmaWarpSpecializedCooperativeFP8BlockScaledAccum<>
+>
+struct MainloopSm90ArrayTmaGmmaWarpSpecializedBlockScalingFP8
+  : MainloopSm90ArrayTmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+  static_assert(
+    cute::is_same_v<KernelSchedule,
+      KernelPtrArrayTmaWarpSpecializedCooperativeFP8BlockScaledAccum<KernelSchedule::ScaleGranularityM>>,
+    "KernelSchedule must be KernelPtrArrayTmaWarpSpecializedCooperativeFP8BlockScaledAccum");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule for Ptr-Array and Grouped Gemm
+// Rows of A are gathered through a per-group row index array, one TMA box per row
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelPtrArrayTmaWarpSpecializedCooperative
+>
+struct MainloopSm90ArrayTmaGmmaWarpSpecializedGatherA
+  : MainloopSm90ArrayTmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+};
+
 // n-buffer in smem (Hopper TMA), pipelined with Hopper sparse GMMA and TMA, Warp specialized dynamic schedule
 template<
   int Stages_,
@@ -335,6 +645,16 @@ struct MainloopSm90TmaGmmaWarpSpecializedSparse {
   using Schedule = KernelSchedule;
 };
 
+// n-buffer in smem (Hopper TMA), pipelined with Hopper sparse GMMA and TMA, Warp specialized dynamic schedule for Ptr-Array and Grouped Gemm
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelPtrArrayTmaWarpSpecializedCooperative
+>
+struct MainloopSm90ArrayTmaGmmaWarpSpecializedSparse
+  : MainloopSm90ArrayTmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+};
+
 // For slow-accumulation sparse FP8 kernels
 template<
   int Stages,
@@ -119,6 +119,55 @@ is_k_major_B() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Problem shapes may mix static and dynamic extents, e.g. Shape<_4096, int, _11008, _1>. Along a mode
+// whose extent is a static multiple of the CTA tile extent no tile has a residue, so predicates along
+// that mode can be dropped at compile time.
+
+/// True when the problem extent is static and a multiple of the static tile extent
+template<class ProblemExtent_, class TileExtent_>
+constexpr bool
+is_static_tile_multiple() {
+  using ProblemExtent = cute::remove_cvref_t<ProblemExtent_>;
+  using TileExtent = cute::remove_cvref_t<TileExtent_>;
+  if constexpr (cute::is_static_v<ProblemExtent> && cute::is_static_v<TileExtent> &&
+                not cute::is_tuple_v<ProblemExtent> && not cute::is_tuple_v<TileExtent>) {
+    return ProblemExtent::value % TileExtent::value == 0;
+  }
+  else {
+    return false;
+  }
+}
+
+/// In-bounds extent of the tile at tile_coord along one mode, extent - tile * tile_coord.
+/// Returns the static tile extent when the mode has no residue (see is_full_tile_residue).
+template<class ProblemExtent, class TileExtent, class TileCoord>
+CUTLASS_HOST_DEVICE constexpr auto
+tile_residue(ProblemExtent const& extent, TileExtent const& tile, TileCoord const& tile_coord) {
+  if constexpr (is_static_tile_multiple<ProblemExtent, TileExtent>()) {
+    return tile;
+  }
+  else {
+    return extent - tile * tile_coord;
+  }
+}
+
+/// True when a residue is statically known to cover a tile of the given extent
+template<class Residue_, class TileExtent_>
+constexpr bool
+is_full_tile_residue() {
+  using Residue = cute::remove_cvref_t<Residue_>;
+  using TileExtent = cute::remove_cvref_t<TileExtent_>;
+  if constexpr (cute::is_static_v<Residue> && cute::is_static_v<TileExtent> &&
+                not cute::is_tuple_v<Residue> && not cute::is_tuple_v<TileExtent>) {
+    return Residue::value >= TileExtent::value;
+  }
+  else {
+    return false;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 // The following two metafunctions are used to detect whether a `kernel::Gemm` or `kernel::GemmUniversal`
 // is implementing the CUTLASS 3.x API or not, by checking if the problem shape type is aliased within or not.
 template <class GemmKernel, class = void>
@@ -56,6 +56,10 @@ struct GroupProblemShape {
   int32_t num_groups = 1;
   UnderlyingProblemShape* problem_shapes = nullptr;
   UnderlyingProblemShape const* host_problem_shapes = nullptr;
+  // Optional device-resident number of groups, e.g. produced by a MoE router. When set, num_groups is
+  // only an upper bound used for host-side sizing, and the kernel computes the first
+  // min(*device_num_groups, num_groups) groups. Host problem shapes are ignored in this mode.
+  int32_t const* device_num_groups = nullptr;
 
   CUTLASS_HOST_DEVICE
   int32_t groups() const { return num_groups; }
@@ -75,7 +79,7 @@ struct GroupProblemShape {
   CUTLASS_HOST_DEVICE
   bool
   is_host_problem_shape_available() {
-    return host_problem_shapes != nullptr;
+    return host_problem_shapes != nullptr && device_num_groups == nullptr;
   }
 };
 
@@ -120,4 +124,92 @@ private:
   UnderlyingProblemShape problem_shape_{};
 };
 
+// Per-group arguments of a grouped GEMM packed into a single buffer as a struct of arrays.
+// The problem shapes, the A/B/C/D pointers and the A/B/C/D strides of all groups are laid out as
+// nine arrays of num_groups entries, each starting on a BufferAlignment boundary, so that loads of
+// one field by consecutive groups are coalesced. The buffer is filled on the host and uploaded with
+// a single copy, or written in place by a device kernel, and the arrays of the device view are
+// passed to the kernel in place of separately allocated ones.
+template <
+  class UnderlyingProblemShape_,
+  class ElementA_, class StrideA_,
+  class ElementB_, class StrideB_,
+  class ElementC_, class StrideC_,
+  class ElementD_, class StrideD_
+>
+struct GroupedGemmPackedArguments {
+  using UnderlyingProblemShape = UnderlyingProblemShape_;
+  using ElementA = ElementA_;
+  using StrideA = StrideA_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using ElementC = ElementC_;
+  using StrideC = StrideC_;
+  using ElementD = ElementD_;
+  using StrideD = StrideD_;
+
+  static constexpr size_t BufferAlignment = 128;
+
+  UnderlyingProblemShape* problem_shapes = nullptr;
+  ElementA const** ptr_A = nullptr;
+  ElementB const** ptr_B = nullptr;
+  ElementC const** ptr_C = nullptr;
+  ElementD** ptr_D = nullptr;
+  StrideA* dA = nullptr;
+  StrideB* dB = nullptr;
+  StrideC* dC = nullptr;
+  StrideD* dD = nullptr;
+
+  CUTLASS_HOST_DEVICE
+  static size_t
+  aligned_array_size(size_t element_size, int32_t num_groups) {
+    size_t bytes = element_size * static_cast<size_t>(num_groups);
+    return (bytes + BufferAlignment - 1) / BufferAlignment * BufferAlignment;
+  }
+
+  // Size in bytes of the buffer holding the arguments of num_groups groups
+  CUTLASS_HOST_DEVICE
+  static size_t
+  get_buffer_size(int32_t num_groups) {
+    return aligned_array_size(sizeof(UnderlyingProblemShape), num_groups)
+         + aligned_array_size(sizeof(ElementA const*), num_groups)
+         + aligned_array_size(sizeof(ElementB const*), num_groups)
+         + aligned_array_size(sizeof(ElementC const*), num_groups)
+         + aligned_array_size(sizeof(ElementD*), num_groups)
+         + aligned_array_size(sizeof(StrideA), num_groups)
+         + aligned_array_size(sizeof(StrideB), num_groups)
+         + aligned_array_size(sizeof(StrideC), num_groups)
+         + aligned_array_size(sizeof(StrideD), num_groups);
+  }
+
+  // Views the arrays of a buffer of get_buffer_size(num_groups) bytes aligned to BufferAlignment.
+  // Host and device views of two buffers built for the same num_groups share the same offsets.
+  CUTLASS_HOST_DEVICE
+  static GroupedGemmPackedArguments
+  make_view(void* buffer, int32_t num_groups) {
+    GroupedGemmPackedArguments view;
+    char* ptr = static_cast<char*>(buffer);
+
+    view.problem_shapes = reinterpret_cast<UnderlyingProblemShape*>(ptr);
+    ptr += aligned_array_size(sizeof(UnderlyingProblemShape), num_groups);
+    view.ptr_A = reinterpret_cast<ElementA const**>(ptr);
+    ptr += aligned_array_size(sizeof(ElementA const*), num_groups);
+    view.ptr_B = reinterpret_cast<ElementB const**>(ptr);
+    ptr += aligned_array_size(sizeof(ElementB const*), num_groups);
+    view.ptr_C = reinterpret_cast<ElementC const**>(ptr);
+    ptr += aligned_array_size(sizeof(ElementC const*), num_groups);
+    view.ptr_D = reinterpret_cast<ElementD**>(ptr);
+    ptr += aligned_array_size(sizeof(ElementD*), num_groups);
+    view.dA = reinterpret_cast<StrideA*>(ptr);
+    ptr += aligned_array_size(sizeof(StrideA), num_groups);
+    view.dB = reinterpret_cast<StrideB*>(ptr);
+    ptr += aligned_array_size(sizeof(StrideB), num_groups);
+    view.dC = reinterpret_cast<StrideC*>(ptr);
+    ptr += aligned_array_size(sizeof(StrideC), num_groups);
+    view.dD = reinterpret_cast<StrideD*>(ptr);
+
+    return view;
+  }
+};
+
 } // namespace cutlass::gemm 
@@ -0,0 +1,364 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Batched GEMM kernel for many tiny problems, packing several problems into each CTA.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Batched GEMM D_l = alpha * A_l * B_l + beta * C_l for problems no larger than (TILE_M, TILE_N), such as
+// per-head projections or the blocks of a block-diagonal layer. Mapping one such problem to a CTA tile
+// leaves most of the tile idle, so this kernel instead assigns ProblemsPerCta consecutive batch entries
+// to a CTA and computes each of them with its own warp-level TiledMma. K is not bounded by the tile and
+// is iterated over in TILE_K steps.
+//
+// Operands are staged in shared memory by all threads of the CTA at once, walking the packed problems
+// in the order of their contiguous mode so that batches laid out back to back are read with coalesced
+// loads across problem boundaries. Accumulators are staged through shared memory as well, so that C is
+// read and D is written in the same coalesced order.
+template <
+  class TileShape_,             // (TILE_M, TILE_N, TILE_K), TILE_M and TILE_N bound the M and N of a problem
+  int ProblemsPerCta_,
+  class TiledMma_,              // TiledMma computing one (TILE_M, TILE_N) problem, typically a single warp
+  class ElementA_,
+  class StrideA_,               // [M, K, L]
+  class ElementB_,
+  class StrideB_,               // [N, K, L]
+  class ElementC_,
+  class StrideC_,               // [M, N, L]
+  class ElementD_,
+  class StrideD_,               // [M, N, L]
+  class ElementCompute_ = float
+>
+class GemmBatchedPacked {
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = cute::Shape<int,int,int,int>;
+  using TileShape = TileShape_;
+  using TiledMma = TiledMma_;
+  using ElementA = ElementA_;
+  using StrideA = StrideA_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using ElementC = ElementC_;
+  using StrideC = StrideC_;
+  using ElementD = ElementD_;
+  using StrideD = StrideD_;
+  using ElementCompute = ElementCompute_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+
+  static constexpr int ProblemsPerCta = ProblemsPerCta_;
+  static constexpr int TileM = cute::size<0>(TileShape{});
+  static constexpr int TileN = cute::size<1>(TileShape{});
+  static constexpr int TileK = cute::size<2>(TileShape{});
+  static constexpr int ThreadsPerProblem = CUTE_STATIC_V(cute::size(TiledMma{}));
+
+  static_assert(ProblemsPerCta > 0, "At least one problem must be computed per CTA.");
+  static_assert(ThreadsPerProblem % 32 == 0, "Each problem must be computed by whole warps.");
+  static_assert(cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L].");
+  static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L].");
+  static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L].");
+  static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L].");
+  static_assert(TileM % CUTE_STATIC_V(cute::tile_size<0>(TiledMma{})) == 0, "TILE_M must be a multiple of the TiledMma M.");
+  static_assert(TileN % CUTE_STATIC_V(cute::tile_size<1>(TiledMma{})) == 0, "TILE_N must be a multiple of the TiledMma N.");
+  static_assert(TileK % CUTE_STATIC_V(cute::tile_size<2>(TiledMma{})) == 0, "TILE_K must be a multiple of the TiledMma K.");
+
+  // K-major smem tiles of all problems of the CTA. Rows are padded by 16B to spread the MMA operand reads
+  // of consecutive rows over the smem banks.
+  static constexpr int PadA = 128 / cute::sizeof_bits_v<ElementA>;
+  static constexpr int PadB = 128 / cute::sizeof_bits_v<ElementB>;
+  static constexpr int PadAcc = 128 / cute::sizeof_bits_v<ElementAccumulator>;
+
+  using SmemLayoutA = cute::Layout<
+    cute::Shape <cute::Int<TileM>, cute::Int<TileK>, cute::Int<ProblemsPerCta>>,
+    cute::Stride<cute::Int<TileK + PadA>, cute::_1, cute::Int<TileM * (TileK + PadA)>>>;    // (TILE_M,TILE_K,P)
+  using SmemLayoutB = cute::Layout<
+    cute::Shape <cute::Int<TileN>, cute::Int<TileK>, cute::Int<ProblemsPerCta>>,
+    cute::Stride<cute::Int<TileK + PadB>, cute::_1, cute::Int<TileN * (TileK + PadB)>>>;    // (TILE_N,TILE_K,P)
+  using SmemLayoutAcc = cute::Layout<
+    cute::Shape <cute::Int<TileM>, cute::Int<TileN>, cute::Int<ProblemsPerCta>>,
+    cute::Stride<cute::Int<TileN + PadAcc>, cute::_1, cute::Int<TileM * (TileN + PadAcc)>>>; // (TILE_M,TILE_N,P)
+
+  struct SharedStorage {
+    struct MainloopStorage {
+      cute::array_aligned<ElementA, cute::cosize_v<SmemLayoutA>> smem_A;
+      cute::array_aligned<ElementB, cute::cosize_v<SmemLayoutB>> smem_B;
+    };
+
+    union TensorStorage {
+      MainloopStorage mainloop;
+      cute::array_aligned<ElementAccumulator, cute::cosize_v<SmemLayoutAcc>> smem_acc;
+    } tensors;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  static constexpr uint32_t MaxThreadsPerBlock = ProblemsPerCta * ThreadsPerProblem;
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  // Device side arguments
+  struct Arguments {
+    ProblemShape problem_shape{};
+    ElementA const* ptr_A = nullptr;
+    StrideA dA{};
+    ElementB const* ptr_B = nullptr;
+    StrideB dB{};
+    ElementC const* ptr_C = nullptr;      // nullptr when C is not read
+    StrideC dC{};
+    ElementD* ptr_D = nullptr;
+    StrideD dD{};
+    ElementCompute alpha = ElementCompute(1);
+    ElementCompute beta = ElementCompute(0);
+  };
+
+  // Kernel entry point API
+  using Params = Arguments;
+
+  //
+  // Methods
+  //
+
+  static
+  Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    (void) workspace;
+    return args;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    auto [M, N, K, L] = args.problem_shape;
+    bool implementable = M > 0 && M <= TileM && N > 0 && N <= TileN && K > 0 && L > 0;
+    implementable &= args.ptr_A != nullptr && args.ptr_B != nullptr && args.ptr_D != nullptr;
+    implementable &= args.ptr_C != nullptr || args.beta == ElementCompute(0);
+    return implementable;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    int batch_count = cute::get<3>(params.problem_shape);
+    return dim3((batch_count + ProblemsPerCta - 1) / ProblemsPerCta, 1, 1);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    auto [M, N, K, L] = params.problem_shape;
+    int thread_idx = int(threadIdx.x);
+    int problem_slot = thread_idx / ThreadsPerProblem;
+    int mma_thread_idx = thread_idx % ThreadsPerProblem;
+
+    // Represent the full tensors
+    Tensor mA_mkl = make_tensor(make_gmem_ptr(params.ptr_A), make_shape(M,K,L), params.dA);                // (m,k,l)
+    Tensor mB_nkl = make_tensor(make_gmem_ptr(params.ptr_B), make_shape(N,K,L), params.dB);                // (n,k,l)
+    Tensor mC_mnl = make_tensor(make_gmem_ptr(params.ptr_C), make_shape(M,N,L), params.dC);                // (m,n,l)
+    Tensor mD_mnl = make_tensor(make_gmem_ptr(params.ptr_D), make_shape(M,N,L), params.dD);                // (m,n,l)
+
+    Tensor sA = make_tensor(make_smem_ptr(shared_storage.tensors.mainloop.smem_A.data()), SmemLayoutA{}); // (TILE_M,TILE_K,P)
+    Tensor sB = make_tensor(make_smem_ptr(shared_storage.tensors.mainloop.smem_B.data()), SmemLayoutB{}); // (TILE_N,TILE_K,P)
+    Tensor sAcc = make_tensor(make_smem_ptr(shared_storage.tensors.smem_acc.data()), SmemLayoutAcc{});    // (TILE_M,TILE_N,P)
+
+    // Partition the smem tiles of this warp's problem
+    TiledMma tiled_mma;
+    auto thr_mma = tiled_mma.get_slice(mma_thread_idx);
+    Tensor tCsA = thr_mma.partition_A(sA(_,_,problem_slot));                                      // (MMA,MMA_M,MMA_K)
+    Tensor tCsB = thr_mma.partition_B(sB(_,_,problem_slot));                                      // (MMA,MMA_N,MMA_K)
+    Tensor tCsAcc = thr_mma.partition_C(sAcc(_,_,problem_slot));                                  // (MMA,MMA_M,MMA_N)
+    Tensor tCrA = thr_mma.partition_fragment_A(sA(_,_,problem_slot));                             // (MMA,MMA_M,MMA_K)
+    Tensor tCrB = thr_mma.partition_fragment_B(sB(_,_,problem_slot));                             // (MMA,MMA_N,MMA_K)
+    Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(TileShape{}));                // (MMA,MMA_M,MMA_N)
+
+    int k_tile_count = (K + TileK - 1) / TileK;
+
+    // Each CTA handles multiple groups of problems if the grid does not cover the batch
+    for (int batch_base = int(blockIdx.x) * ProblemsPerCta; batch_base < L; batch_base += int(gridDim.x) * ProblemsPerCta) {
+      int problem_count = cute::min(ProblemsPerCta, L - batch_base);
+      bool is_active = problem_slot < problem_count;
+
+      clear(accumulators);
+
+      for (int k_tile = 0; k_tile < k_tile_count; ++k_tile) {
+        int k_base = k_tile * TileK;
+        int k_extent = cute::min(TileK, K - k_base);
+
+        // Previous readers of the smem tiles are done
+        __syncthreads();
+        load_operand(mA_mkl, sA, M, k_base, k_extent, batch_base, problem_count, thread_idx);
+        load_operand(mB_nkl, sB, N, k_base, k_extent, batch_base, problem_count, thread_idx);
+        __syncthreads();
+
+        if (is_active) {
+          copy(tCsA, tCrA);
+          copy(tCsB, tCrB);
+          cute::gemm(tiled_mma, accumulators, tCrA, tCrB, accumulators);
+        }
+      }
+
+      // Stage the accumulators of all problems, which alias the operand tiles
+      __syncthreads();
+      if (is_active) {
+        copy(accumulators, tCsAcc);
+      }
+      __syncthreads();
+
+      store_output(params, sAcc, mC_mnl, mD_mnl, M, N, batch_base, problem_count, thread_idx);
+    }
+  }
+
+private:
+
+  // Copies the (rows, k_extent) slabs of problem_count problems into the K-major smem tiles, visiting
+  // elements in the order of the contiguous gmem mode so that consecutive threads read consecutive
+  // addresses, also across problem boundaries. Tile elements outside the slab are zero filled.
+  template <class GmemTensor, class SmemTensor>
+  CUTLASS_DEVICE static void
+  load_operand(
+      GmemTensor const& mX,
+      SmemTensor& sX,
+      int rows,
+      int k_base,
+      int k_extent,
+      int batch_base,
+      int problem_count,
+      int thread_idx) {
+    using namespace cute;
+    using Element = typename SmemTensor::value_type;
+    constexpr int TileRows = decltype(size<0>(sX))::value;
+    constexpr int TileCols = decltype(size<1>(sX))::value;
+    constexpr bool IsKMajor = is_constant<1, decltype(stride<1>(mX))>::value;
+
+    int slab_size = rows * k_extent;
+    for (int idx = thread_idx; idx < slab_size * problem_count; idx += MaxThreadsPerBlock) {
+      int p = idx / slab_size;
+      int offset = idx - p * slab_size;
+      int r, c;
+      if constexpr (IsKMajor) {
+        r = offset / k_extent;
+        c = offset - r * k_extent;
+      }
+      else {
+        c = offset / rows;
+        r = offset - c * rows;
+      }
+      sX(r, c, p) = mX(r, k_base + c, batch_base + p);
+    }
+
+    if (rows < TileRows || k_extent < TileCols) {
+      for (int idx = thread_idx; idx < TileRows * TileCols * problem_count; idx += MaxThreadsPerBlock) {
+        int p = idx / (TileRows * TileCols);
+        int r = (idx / TileCols) % TileRows;
+        int c = idx % TileCols;
+        if (r >= rows || c >= k_extent) {
+          sX(r, c, p) = Element(0);
+        }
+      }
+    }
+  }
+
+  // Applies the linear combination to the staged accumulators and writes D, visiting elements in the
+  // order of the contiguous mode of D
+  template <class SmemTensor, class CTensor, class DTensor>
+  CUTLASS_DEVICE static void
+  store_output(
+      Params const& params,
+      SmemTensor const& sAcc,
+      CTensor const& mC,
+      DTensor& mD,
+      int M,
+      int N,
+      int batch_base,
+      int problem_count,
+      int thread_idx) {
+    using namespace cute;
+    constexpr bool IsNMajor = is_constant<1, decltype(stride<1>(mD))>::value;
+
+    NumericConverter<ElementCompute, ElementAccumulator> convert_accumulator;
+    NumericConverter<ElementCompute, ElementC> convert_source;
+    NumericConverter<ElementD, ElementCompute> convert_output;
+    multiply_add<ElementCompute> fma;
+
+    bool is_source_needed = params.ptr_C != nullptr && params.beta != ElementCompute(0);
+
+    int problem_size = M * N;
+    for (int idx = thread_idx; idx < problem_size * problem_count; idx += MaxThreadsPerBlock) {
+      int p = idx / problem_size;
+      int offset = idx - p * problem_size;
+      int m, n;
+      if constexpr (IsNMajor) {
+        m = offset / N;
+        n = offset - m * N;
+      }
+      else {
+        n = offset / M;
+        m = offset - n * M;
+      }
+
+      ElementCompute output = params.alpha * convert_accumulator(sAcc(m, n, p));
+      if (is_source_needed) {
+        output = fma(params.beta, convert_source(mC(m, n, batch_base + p)), output);
+      }
+      mD(m, n, batch_base + p) = convert_output(output);
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
@@ -122,6 +122,9 @@ public:
                             kThreadCount,
                             kTransposed>;
 
+  /// Bytes of partial accumulators each threadblock may share when tiles are split along K
+  static size_t const kWorkspaceBytesPerBlock = kThreadCount * sizeof(typename Mma::FragmentC);
+
   //
   // Structures
   //
@@ -329,6 +332,10 @@ public:
         int(threadblock_idx % grid_shape.n()) * Mma::Shape::kN,
         0);
 
+      // Range along K accumulated by this threadblock for the tile
+      int k_begin = problem_visitor.k_begin();
+      int k_end = problem_visitor.k_end(problem_size);
+
       // Load element pointers. Exchange pointers and strides if working on the transpose
       ElementA *ptr_A = reinterpret_cast<ElementA *>((kTransposed ? params.ptr_B[problem_idx] : params.ptr_A[problem_idx]));
       typename LayoutA::LongIndex ldm_A = (kTransposed ? params.ldb[problem_idx] : params.lda[problem_idx]);
@@ -339,11 +346,11 @@ public:
       // Compute initial location in logical coordinates
       cutlass::MatrixCoord tb_offset_A{
         threadblock_offset.m(),
-        0,
+        k_begin,
       };
 
       cutlass::MatrixCoord tb_offset_B{
-        0,
+        k_begin,
         threadblock_offset.n()
       };
 
@@ -354,14 +361,14 @@ public:
       typename Mma::IteratorA iterator_A(
         LayoutA(ldm_A),
         ptr_A,
-        {problem_size.m(), problem_size.k()},
+        {problem_size.m(), k_end},
         thread_idx,
         tb_offset_A);
 
       typename Mma::IteratorB iterator_B(
         LayoutB(ldm_B),
         ptr_B,
-        {problem_size.k(), problem_size.n()},
+        {k_end, problem_size.n()},
         thread_idx,
         tb_offset_B);
 
@@ -383,7 +390,7 @@ public:
       Mma mma(shared_storage.kernel.main_loop, thread_idx, warp_idx, lane_idx);
 
       // Compute threadblock-scoped matrix multiply-add
-      int gemm_k_iterations = (problem_size.k() + Mma::Shape::kK - 1) / Mma::Shape::kK;
+      int gemm_k_iterations = (k_end - k_begin + Mma::Shape::kK - 1) / Mma::Shape::kK;
 
       // Wait for all threads to finish their epilogue phases from the previous tile.
       __syncthreads();
@@ -396,6 +403,19 @@ public:
         iterator_B, 
         accumulators);
 
+      if constexpr (ProblemVisitor::kSplitsTiles) {
+        if (!problem_visitor.tile_finished()) {
+          // Threadblocks that do not finish the tile hand their partial sums to the one that does
+          problem_visitor.share_accumulators(accumulators, thread_idx);
+          problem_visitor.advance(gridDim.x);
+          continue;
+        }
+
+        if (!problem_visitor.tile_started()) {
+          problem_visitor.acquire_accumulators(accumulators, thread_idx);
+        }
+      }
+
       //
       // Epilogue
       //
@@ -69,6 +69,9 @@ struct GemmGroupedPerGroupScale :
   // Inherit constructors
   using Base = GemmGrouped<Mma_, Epilogue_, ThreadblockSwizzle_, GroupScheduleMode_, Transposed>;
 
+  static_assert(GroupScheduleMode_ != GroupScheduleMode::kStreamK,
+    "GemmGroupedPerGroupScale does not support GroupScheduleMode::kStreamK");
+
   // Inherit type definitions
   using typename Base::Mma;
   using typename Base::Epilogue;
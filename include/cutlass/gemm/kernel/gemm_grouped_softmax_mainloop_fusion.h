@@ -70,6 +70,8 @@ public:
   using EpilogueOutputOp = typename Epilogue::OutputOp;
   using ThreadblockSwizzle = ThreadblockSwizzle_;
   static GroupScheduleMode const kGroupScheduleMode = GroupScheduleMode_;
+  static_assert(kGroupScheduleMode != GroupScheduleMode::kStreamK,
+    "GemmGroupedSoftmaxMainloopFusion does not support GroupScheduleMode::kStreamK");
   static bool const kTransposed = Transposed;
 
   // Optional transpose
@@ -0,0 +1,483 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Universal mixed-input GEMM dequantizing the narrow operand with group-wise scales.
+
+    The kernel is GemmUniversal with additional arguments for the scale and zero-point tensors of
+    the narrow operand, which it hands to the warp-level MmaMixedInputGroupwiseTensorOp before
+    the mainloop. Scales and zero-points are indexed by (k / group_size, n) for a narrow B
+    operand and by (k / group_size, m) for a narrow A operand, so they need no change when the
+    device-level adapter exchanges A and B.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/matrix_coord.h"
+#include "cutlass/semaphore.h"
+#include "cutlass/arch/arch.h"
+
+#include "cutlass/gemm/kernel/gemm_universal.h"
+
+#include "cutlass/trace.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace gemm {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  typename Mma_,                  ///! Threadblock-scoped matrix multiply-accumulate
+  typename Epilogue_,             ///! Epilogue
+  typename ThreadblockSwizzle_    ///! Threadblock swizzling function
+>
+class GemmUniversalMixedInputGroupwise : public GemmUniversal<Mma_, Epilogue_, ThreadblockSwizzle_> {
+public:
+
+  using Base = GemmUniversal<Mma_, Epilogue_, ThreadblockSwizzle_>;
+
+  using Mma = typename Base::Mma;
+  using Epilogue = typename Base::Epilogue;
+  using EpilogueOutputOp = typename Base::EpilogueOutputOp;
+  using ThreadblockSwizzle = typename Base::ThreadblockSwizzle;
+
+  using ElementA = typename Base::ElementA;
+  using ElementB = typename Base::ElementB;
+  using ElementC = typename Base::ElementC;
+  using LayoutC = typename Base::LayoutC;
+
+  using Operator = typename Base::Operator;
+  using WarpShape = typename Base::WarpShape;
+  using InstructionShape = typename Base::InstructionShape;
+  using WarpCount = typename Base::WarpCount;
+
+  /// Data type of the scale and zero-point tensors
+  using ElementScale = typename Operator::ElementScale;
+
+  static_assert(Mma::kStages > 2,
+    "Group-wise dequantization requires the multistage mainloop");
+
+  //
+  // Structures
+  //
+
+  /// Argument structure
+  struct Arguments : Base::Arguments {
+
+    /// Scales of the narrow operand, (K / group_size) x extent with leading dimension ld_scale.
+    /// A null pointer disables dequantization.
+    void const *ptr_scale{nullptr};
+
+    /// Zero-points of the narrow operand, laid out as the scales. May be null.
+    void const *ptr_zero{nullptr};
+
+    int64_t ld_scale{0};
+    int64_t batch_stride_scale{0};
+
+    /// Number of consecutive K indices sharing a scale
+    int group_size{0};
+
+    Arguments() = default;
+
+    /// Constructs from plain mixed-input arguments, without dequantization
+    Arguments(typename Base::Arguments const &args): Base::Arguments(args) { }
+
+    Arguments(
+      typename Base::Arguments const &args,
+      void const *ptr_scale,
+      void const *ptr_zero,
+      int64_t ld_scale,
+      int group_size,
+      int64_t batch_stride_scale = 0)
+    :
+      Base::Arguments(args),
+      ptr_scale(ptr_scale), ptr_zero(ptr_zero),
+      ld_scale(ld_scale), batch_stride_scale(batch_stride_scale),
+      group_size(group_size) { }
+
+    /// Returns arguments for the transposed problem. Scales follow the narrow operand.
+    Arguments transposed_problem() const {
+      Arguments args(*this);
+      static_cast<typename Base::Arguments &>(args) = Base::Arguments::transposed_problem();
+      return args;
+    }
+  };
+
+  /// Parameters structure
+  struct Params : Base::Params {
+
+    ElementScale const *ptr_scale{nullptr};
+    ElementScale const *ptr_zero{nullptr};
+    int64_t ld_scale{0};
+    int64_t batch_stride_scale{0};
+    int group_size{1};
+
+    Params() = default;
+
+    Params(
+      Arguments const &args,
+      int device_sms,
+      int sm_occupancy)
+    :
+      Base::Params(args, device_sms, sm_occupancy),
+      ptr_scale(static_cast<ElementScale const *>(args.ptr_scale)),
+      ptr_zero(static_cast<ElementScale const *>(args.ptr_zero)),
+      ld_scale(args.ld_scale),
+      batch_stride_scale(args.batch_stride_scale),
+      group_size(args.ptr_scale ? args.group_size : 1)
+    {}
+
+    /// Lightweight update given a subset of arguments.
+    void update(Arguments const &args) {
+      Base::Params::update(args);
+
+      ptr_scale = static_cast<ElementScale const *>(args.ptr_scale);
+      ptr_zero = static_cast<ElementScale const *>(args.ptr_zero);
+      ld_scale = args.ld_scale;
+      batch_stride_scale = args.batch_stride_scale;
+      group_size = (args.ptr_scale ? args.group_size : 1);
+    }
+  };
+
+  using SharedStorage = typename Base::SharedStorage;
+
+public:
+
+  //
+  // Host dispatch API
+  //
+
+  static Status can_implement(Arguments const &args) {
+
+    CUTLASS_TRACE_HOST("GemmUniversalMixedInputGroupwise::can_implement()");
+
+    if (args.ptr_scale) {
+      if (args.group_size <= 0 || (args.group_size % InstructionShape::kK)) {
+        CUTLASS_TRACE_HOST("  group_size must be a positive multiple of " << InstructionShape::kK);
+        return Status::kErrorInvalidProblem;
+      }
+
+      if (args.mode == GemmUniversalMode::kArray) {
+        CUTLASS_TRACE_HOST("  array mode is not supported with group-wise scales");
+        return Status::kErrorNotSupported;
+      }
+    }
+
+    return Base::can_implement(args.problem_size);
+  }
+
+public:
+
+  //
+  // Device-only API
+  //
+
+  // Factory invocation
+  CUTLASS_DEVICE
+  static void invoke(
+    Params const &params,
+    SharedStorage &shared_storage)
+  {
+    GemmUniversalMixedInputGroupwise op;
+    op(params, shared_storage);
+  }
+
+  /// Executes one GEMM
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+    ThreadblockSwizzle threadblock_swizzle;
+    run_with_swizzle(params, shared_storage, threadblock_swizzle);
+  }
+
+  /// Executes one GEMM with an externally-provided swizzling function
+  CUTLASS_DEVICE
+  void run_with_swizzle(Params const &params, SharedStorage &shared_storage, ThreadblockSwizzle& threadblock_swizzle) {
+
+    cutlass::gemm::GemmCoord threadblock_tile_offset =
+        threadblock_swizzle.get_tile_offset(params.swizzle_log_tile);
+
+    // Early exit if CTA is out of range
+    if (params.grid_tiled_shape.m() <= threadblock_tile_offset.m() ||
+      params.grid_tiled_shape.n() <= threadblock_tile_offset.n()) {
+
+      return;
+    }
+
+    int offset_k = 0;
+    int problem_size_k = params.problem_size.k();
+
+    ElementA *ptr_A = static_cast<ElementA *>(params.ptr_A);
+    ElementB *ptr_B = static_cast<ElementB *>(params.ptr_B);
+    ElementScale const *ptr_scale = params.ptr_scale;
+    ElementScale const *ptr_zero = params.ptr_zero;
+
+    //
+    // Fetch pointers based on mode.
+    //
+    if (params.mode == GemmUniversalMode::kGemm ||
+      params.mode == GemmUniversalMode::kGemmSplitKParallel) {
+
+      if (threadblock_tile_offset.k() + 1 < params.grid_tiled_shape.k()) {
+
+        problem_size_k = (threadblock_tile_offset.k() + 1) * params.gemm_k_size;
+      }
+
+      offset_k = threadblock_tile_offset.k() * params.gemm_k_size;
+    }
+    else if (params.mode == GemmUniversalMode::kBatched) {
+      ptr_A += threadblock_tile_offset.k() * params.batch_stride_A;
+      ptr_B += threadblock_tile_offset.k() * params.batch_stride_B;
+
+      if (ptr_scale) {
+        ptr_scale += threadblock_tile_offset.k() * params.batch_stride_scale;
+      }
+      if (ptr_zero) {
+        ptr_zero += threadblock_tile_offset.k() * params.batch_stride_scale;
+      }
+    }
+    else if (params.mode == GemmUniversalMode::kArray) {
+      ptr_A = static_cast<ElementA * const *>(params.ptr_A)[threadblock_tile_offset.k()];
+      ptr_B = static_cast<ElementB * const *>(params.ptr_B)[threadblock_tile_offset.k()];
+    }
+
+    __syncthreads();
+
+    // Compute initial location in logical coordinates
+    cutlass::MatrixCoord tb_offset_A{
+      threadblock_tile_offset.m() * Mma::Shape::kM,
+      offset_k,
+    };
+
+    cutlass::MatrixCoord tb_offset_B{
+      offset_k,
+      threadblock_tile_offset.n() * Mma::Shape::kN
+    };
+
+    // Compute position within threadblock
+    int thread_idx = threadIdx.x;
+
+    // Construct iterators to A and B operands
+    typename Mma::IteratorA iterator_A(
+      params.params_A,
+      ptr_A,
+      {params.problem_size.m(), problem_size_k},
+      thread_idx,
+      tb_offset_A,
+      params.ptr_gather_A_indices);
+
+    typename Mma::IteratorB iterator_B(
+      params.params_B,
+      ptr_B,
+      {problem_size_k, params.problem_size.n()},
+      thread_idx,
+      tb_offset_B,
+      params.ptr_gather_B_indices);
+
+    // Broadcast the warp_id computed by lane 0 to ensure dependent code
+    // is compiled as warp-uniform.
+    int warp_idx = canonical_warp_idx_sync();
+
+    int lane_idx = threadIdx.x % 32;
+
+    //
+    // Main loop
+    //
+
+    // Construct thread-scoped matrix multiply
+    Mma mma(shared_storage.main_loop, thread_idx, warp_idx, lane_idx);
+
+    // Position of the warp tile, mapped from the warp index as the mainloop does
+    int warp_idx_mn = warp_idx % (WarpCount::kM * WarpCount::kN);
+
+    MatrixCoord warp_offset{
+      tb_offset_A.row() + (warp_idx_mn % WarpCount::kM) * WarpShape::kM,
+      tb_offset_B.column() + (warp_idx_mn / WarpCount::kM) * WarpShape::kN
+    };
+
+    mma.warp_mma().set_groupwise_scale(
+      ptr_scale,
+      ptr_zero,
+      params.ld_scale,
+      params.group_size,
+      warp_offset,
+      params.problem_size.mn(),
+      offset_k,
+      problem_size_k,
+      lane_idx);
+
+    typename Mma::FragmentC accumulators;
+
+    accumulators.clear();
+
+    // Compute threadblock-scoped matrix multiply-add
+    int gemm_k_iterations = (problem_size_k - offset_k + Mma::Shape::kK - 1) / Mma::Shape::kK;
+
+    // Compute threadblock-scoped matrix multiply-add
+    mma(
+      gemm_k_iterations,
+      accumulators,
+      iterator_A,
+      iterator_B,
+      accumulators);
+
+    //
+    // Epilogue
+    //
+
+    EpilogueOutputOp output_op(params.output_op);
+
+    //
+    // Masked tile iterators constructed from members
+    //
+
+    threadblock_tile_offset = threadblock_swizzle.get_tile_offset(params.swizzle_log_tile);
+
+    //assume identity swizzle
+    MatrixCoord threadblock_offset(
+      threadblock_tile_offset.m() * Mma::Shape::kM,
+      threadblock_tile_offset.n() * Mma::Shape::kN
+    );
+
+    int block_idx = threadblock_tile_offset.m() + threadblock_tile_offset.n() * params.grid_tiled_shape.m();
+
+    ElementC *ptr_C = static_cast<ElementC *>(params.ptr_C);
+    ElementC *ptr_D = static_cast<ElementC *>(params.ptr_D);
+
+    //
+    // Fetch pointers based on mode.
+    //
+
+    // Construct the semaphore.
+    Semaphore semaphore(params.semaphore + block_idx, thread_idx);
+
+    if (params.mode == GemmUniversalMode::kGemm) {
+
+      // If performing a reduction via split-K, fetch the initial synchronization
+      if (params.grid_tiled_shape.k() > 1) {
+
+        // Fetch the synchronization lock initially but do not block.
+        semaphore.fetch();
+
+        // Indicate which position in a serial reduction the output operator is currently updating
+        output_op.set_k_partition(threadblock_tile_offset.k(), params.grid_tiled_shape.k());
+      }
+    }
+    else if (params.mode == GemmUniversalMode::kGemmSplitKParallel) {
+      ptr_D += threadblock_tile_offset.k() * params.batch_stride_D;
+    }
+    else if (params.mode == GemmUniversalMode::kBatched) {
+      ptr_C += threadblock_tile_offset.k() * params.batch_stride_C;
+      ptr_D += threadblock_tile_offset.k() * params.batch_stride_D;
+    }
+    else if (params.mode == GemmUniversalMode::kArray) {
+      ptr_C = static_cast<ElementC * const *>(params.ptr_C)[threadblock_tile_offset.k()];
+      ptr_D = static_cast<ElementC * const *>(params.ptr_D)[threadblock_tile_offset.k()];
+    }
+
+    // Tile iterator loading from source tensor.
+    typename Epilogue::OutputTileIterator iterator_C(
+      params.params_C,
+      ptr_C,
+      params.problem_size.mn(),
+      thread_idx,
+      threadblock_offset,
+      params.ptr_scatter_D_indices
+    );
+
+    // Tile iterator writing to destination tensor.
+    typename Epilogue::OutputTileIterator iterator_D(
+      params.params_D,
+      ptr_D,
+      params.problem_size.mn(),
+      thread_idx,
+      threadblock_offset,
+      params.ptr_scatter_D_indices
+    );
+
+    Epilogue epilogue(
+      shared_storage.epilogue,
+      thread_idx,
+      warp_idx,
+      lane_idx);
+
+    // Wait on the semaphore - this latency may have been covered by iterator construction
+    if (params.mode == GemmUniversalMode::kGemm && params.grid_tiled_shape.k() > 1) {
+
+      // For subsequent threadblocks, the source matrix is held in the 'D' tensor.
+      if (threadblock_tile_offset.k()) {
+        iterator_C = iterator_D;
+      }
+
+      semaphore.wait(threadblock_tile_offset.k());
+    }
+
+    // Execute the epilogue operator to update the destination tensor.
+    epilogue(
+      output_op,
+      iterator_D,
+      accumulators,
+      iterator_C);
+
+    //
+    // Release the semaphore
+    //
+
+    if (params.mode == GemmUniversalMode::kGemm && params.grid_tiled_shape.k() > 1) {
+
+      int lock = 0;
+      if (params.grid_tiled_shape.k() == threadblock_tile_offset.k() + 1) {
+
+        // The final threadblock resets the semaphore for subsequent grids.
+        lock = 0;
+      }
+      else {
+        // Otherwise, the semaphore is incremented
+        lock = threadblock_tile_offset.k() + 1;
+      }
+
+      semaphore.release(lock);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace gemm
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,8 +36,11 @@
 #pragma once
 
 #include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/matrix_coord.h"
+#include "cutlass/barrier.h"
+#include "cutlass/block_striped.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -52,7 +55,11 @@ enum class GroupScheduleMode {
   // Perform all scheduling on device
   kDeviceOnly,
   // Precompute on the host the full sequence of problems to access
-  kHostPrecompute
+  kHostPrecompute,
+  // Split the MAC-iterations of all tiles in the group evenly across threadblocks (stream-K)
+  kStreamK,
+  // Compute per-problem tile offsets on device before the grouped kernel, then binary search them
+  kDevicePrecompute
 };
 
 /// Visitor class to abstract away the algorithm for iterating over tiles
@@ -61,6 +68,12 @@ template <typename ProblemSizeHelper,
 struct BaseGroupedProblemVisitor {
   using ThreadblockShape = ThreadblockShape_;
 
+  /// Whether a tile may be split along K across threadblocks
+  static bool const kSplitsTiles = false;
+
+  /// Whether the schedule is computed by a kernel launched ahead of the grouped kernel
+  static bool const kPrecomputesOnDevice = false;
+
   struct ProblemInfo {
     static int32_t const kNoPrefetchEntry = -1;
     int32_t problem_idx;
@@ -151,6 +164,30 @@ struct BaseGroupedProblemVisitor {
     tile_idx += grid_size;
   }
 
+  /// Gets the first index along K accumulated by this threadblock for the current tile
+  CUTLASS_HOST_DEVICE
+  int32_t k_begin() const {
+    return 0;
+  }
+
+  /// Gets one past the last index along K accumulated by this threadblock for the current tile
+  CUTLASS_HOST_DEVICE
+  int32_t k_end(cutlass::gemm::GemmCoord const &problem) const {
+    return problem.k();
+  }
+
+  /// Whether this threadblock accumulates the first K iteration of the current tile
+  CUTLASS_HOST_DEVICE
+  bool tile_started() const {
+    return true;
+  }
+
+  /// Whether this threadblock accumulates the last K iteration of the current tile
+  CUTLASS_HOST_DEVICE
+  bool tile_finished() const {
+    return true;
+  }
+
   CUTLASS_HOST_DEVICE
   static void possibly_transpose_problem(cutlass::gemm::GemmCoord& problem) {
     ProblemSizeHelper::possibly_transpose_problem(problem);
@@ -454,6 +491,450 @@ private:
   }
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// ProblemVisitor that splits the MAC-iterations of the group evenly across threadblocks
+//
+// The host precomputes the offset of each problem's first MAC-iteration in the iteration space
+// of the whole group, where a tile of a problem with extent K contributes ceil(K / kK)
+// iterations. Each threadblock is then assigned a contiguous range of that space and visits
+// the tiles its range overlaps from last to first. Threadblocks that do not accumulate the
+// last iteration of a tile share their partial sums through the workspace. The threadblock
+// that does accumulate the last iteration waits for them, adds them to its own, and runs
+// the epilogue.
+//
+// Threadblocks wait on one another, so the grid must not exceed a single full wave.
+//
+template <typename ProblemSizeHelper,
+          typename ThreadblockShape,
+          int PrefetchTileCount,
+          int ThreadCount>
+struct GroupedProblemVisitor<ProblemSizeHelper,
+                             ThreadblockShape,
+                             GroupScheduleMode::kStreamK,
+                             PrefetchTileCount,
+                             ThreadCount> : public BaseGroupedProblemVisitor<ProblemSizeHelper, ThreadblockShape> {
+  using Base = BaseGroupedProblemVisitor<ProblemSizeHelper, ThreadblockShape>;
+  using Params = typename Base::Params;
+  static bool const kRequiresPrecomputation = true;
+  static bool const kSplitsTiles = true;
+
+  static int const kThreadCount = ThreadCount;
+
+  struct SharedStorage {};
+
+  SharedStorage &shared_storage;
+
+  /// Per-problem offsets of the first MAC-iteration, followed by the total iteration count
+  int32_t const *problem_iter_offsets;
+
+  /// Flags counting the peers that have shared a partial tile, indexed by the tile's first block
+  void *barrier_workspace;
+
+  /// Partial accumulator tiles, indexed by the tile's first block
+  void *partials_workspace;
+
+  /// Iterations assigned to every block, and the number of blocks assigned one more
+  int32_t block_iters;
+  int32_t block_iters_remainder;
+
+  int32_t block_idx;
+
+  /// First MAC-iteration of this block's range
+  int32_t block_iter_begin;
+
+  /// One past the last MAC-iteration of this block not yet visited
+  int32_t block_iter_end;
+
+  /// First MAC-iteration of the current problem and its number of iterations per tile
+  int32_t problem_iter_begin;
+  int32_t iters_per_tile;
+
+  /// First MAC-iteration of the current tile, and the tile-scoped range visited by this block
+  int32_t tile_iter_begin;
+  int32_t tile_k_iter_begin;
+  int32_t tile_k_iter_end;
+
+  /// Block whose range contains the first MAC-iteration of the current tile
+  int32_t first_block_idx;
+
+  //
+  // Methods
+  //
+  CUTLASS_DEVICE
+  GroupedProblemVisitor(
+    Params const &params_,
+    SharedStorage &shared_storage_,
+    int32_t block_idx_
+  ): Base(params_, block_idx_),
+  shared_storage(shared_storage_),
+  problem_iter_offsets(reinterpret_cast<int32_t const*>(params_.workspace)),
+  block_idx(block_idx_),
+  iters_per_tile(0),
+  tile_iter_begin(0),
+  tile_k_iter_begin(0),
+  tile_k_iter_end(0),
+  first_block_idx(0)
+  {
+    uint8_t *ptr = reinterpret_cast<uint8_t*>(const_cast<void*>(params_.workspace));
+    ptr += schedule_workspace_size(params_.problem_count);
+    barrier_workspace = ptr;
+    ptr += barrier_workspace_size(gridDim.x);
+    partials_workspace = ptr;
+
+    int32_t total_iters = problem_iter_offsets[params_.problem_count];
+    block_iters = total_iters / int32_t(gridDim.x);
+    block_iters_remainder = total_iters % int32_t(gridDim.x);
+
+    block_iter_begin = block_idx * block_iters + fast_min(block_idx, block_iters_remainder);
+    block_iter_end = block_iter_begin + block_iters + (block_idx < block_iters_remainder ? 1 : 0);
+
+    problem_iter_begin = block_iter_end;
+    if (block_iter_end > block_iter_begin) {
+      // Find the last problem beginning at or before the final iteration of this block
+      int32_t lo = 0;
+      int32_t hi = params_.problem_count;
+      while (hi - lo > 1) {
+        int32_t mid = (lo + hi) / 2;
+        if (problem_iter_offsets[mid] < block_iter_end) {
+          lo = mid;
+        }
+        else {
+          hi = mid;
+        }
+      }
+      set_problem(lo);
+    }
+  }
+
+  CUTLASS_DEVICE
+  bool next_tile() {
+    if (block_iter_end <= block_iter_begin) {
+      return false;
+    }
+
+    int32_t iter = block_iter_end - 1;
+
+    // Step back over the preceding problems, including those without any tiles
+    while (iter < problem_iter_begin) {
+      set_problem(this->problem_idx - 1);
+    }
+
+    int32_t tile = (iter - problem_iter_begin) / iters_per_tile;
+    tile_iter_begin = problem_iter_begin + tile * iters_per_tile;
+    tile_k_iter_begin = fast_max(block_iter_begin, tile_iter_begin) - tile_iter_begin;
+    tile_k_iter_end = iter + 1 - tile_iter_begin;
+    first_block_idx = block_containing(tile_iter_begin);
+
+    // Tiles are indexed within the current problem
+    this->tile_idx = tile;
+    this->problem_tile_start = 0;
+
+    return true;
+  }
+
+  /// Consumes the current tile's iterations. The grid size is implied by the block ranges.
+  CUTLASS_DEVICE
+  void advance(int32_t) {
+    block_iter_end = tile_iter_begin + tile_k_iter_begin;
+  }
+
+  CUTLASS_HOST_DEVICE
+  int32_t k_begin() const {
+    return tile_k_iter_begin * ThreadblockShape::kK;
+  }
+
+  CUTLASS_HOST_DEVICE
+  int32_t k_end(cutlass::gemm::GemmCoord const &problem) const {
+    return fast_min(problem.k(), tile_k_iter_end * ThreadblockShape::kK);
+  }
+
+  CUTLASS_HOST_DEVICE
+  bool tile_started() const {
+    return tile_k_iter_begin == 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  bool tile_finished() const {
+    return tile_k_iter_end == iters_per_tile;
+  }
+
+  /// Shares the partial sums of a tile this block does not finish. Peers accumulate into the
+  /// workspace in block order so that the result does not depend on their timing.
+  template <typename AccumulatorTile>
+  CUTLASS_DEVICE
+  void share_accumulators(AccumulatorTile const &accumulator_tile, int thread_idx) {
+    using BlockStripedReduceT = BlockStripedReduce<kThreadCount, AccumulatorTile>;
+
+    AccumulatorTile *accum_tile_workspace =
+      reinterpret_cast<AccumulatorTile *>(partials_workspace) + first_block_idx * kThreadCount;
+
+    if (block_idx == first_block_idx) {
+      BlockStripedReduceT::store(accum_tile_workspace, accumulator_tile, thread_idx);
+    }
+    else {
+      Barrier::wait_eq(barrier_workspace, thread_idx, first_block_idx, block_idx - first_block_idx);
+      BlockStripedReduceT::reduce(accum_tile_workspace, accumulator_tile, thread_idx);
+    }
+
+    Barrier::arrive_inc(barrier_workspace, thread_idx, first_block_idx);
+  }
+
+  /// Adds the partial sums shared by the peers of a tile this block finishes, and resets the
+  /// tile's flag for the next launch
+  template <typename AccumulatorTile>
+  CUTLASS_DEVICE
+  void acquire_accumulators(AccumulatorTile &accumulator_tile, int thread_idx) {
+    using BlockStripedReduceT = BlockStripedReduce<kThreadCount, AccumulatorTile>;
+
+    AccumulatorTile *accum_tile_workspace =
+      reinterpret_cast<AccumulatorTile *>(partials_workspace) + first_block_idx * kThreadCount;
+
+    Barrier::wait_eq_reset(barrier_workspace, thread_idx, first_block_idx, block_idx - first_block_idx);
+    BlockStripedReduceT::load_add(accumulator_tile, accum_tile_workspace, thread_idx);
+  }
+
+  /// Bytes of precomputed schedule, excluding the partials which are sized by the kernel
+  static size_t get_workspace_size(const cutlass::gemm::GemmCoord* host_problem_sizes_ptr,
+                                   int32_t problem_count,
+                                   int32_t block_count) {
+    return schedule_workspace_size(problem_count) + barrier_workspace_size(block_count);
+  }
+
+#if !defined(__CUDACC_RTC__)
+  /// Writes the iteration offsets of each problem. The flags that follow are left zeroed.
+  static void host_precompute(const cutlass::gemm::GemmCoord* host_problem_sizes_ptr,
+                              int32_t problem_count,
+                              int32_t block_count,
+                              void* host_workspace_ptr) {
+    int32_t* host_iter_offsets = reinterpret_cast<int32_t*>(host_workspace_ptr);
+
+    int32_t iter = 0;
+    for (int32_t p_idx = 0; p_idx < problem_count; ++p_idx) {
+      auto problem = host_problem_sizes_ptr[p_idx];
+      Base::possibly_transpose_problem(problem);
+      auto grid = Base::grid_shape(problem);
+      host_iter_offsets[p_idx] = iter;
+      iter += Base::tile_count(grid) * problem_iters_per_tile(problem);
+    }
+    host_iter_offsets[problem_count] = iter;
+  }
+#endif
+
+private:
+
+  /// Pad the given allocation size up to the nearest cache line
+  CUTLASS_HOST_DEVICE
+  static size_t cacheline_align_up(size_t size) {
+    return (size + 127) / 128 * 128;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static size_t schedule_workspace_size(int32_t problem_count) {
+    return cacheline_align_up(sizeof(int32_t) * (problem_count + 1));
+  }
+
+  CUTLASS_HOST_DEVICE
+  static size_t barrier_workspace_size(int32_t block_count) {
+    return cacheline_align_up(sizeof(typename Barrier::T) * block_count);
+  }
+
+  /// Problems with an empty K still visit each tile once to run the epilogue
+  CUTLASS_HOST_DEVICE
+  static int32_t problem_iters_per_tile(cutlass::gemm::GemmCoord const &problem) {
+    return fast_max(1, (problem.k() + ThreadblockShape::kK - 1) / ThreadblockShape::kK);
+  }
+
+  CUTLASS_DEVICE
+  void set_problem(int32_t problem_idx) {
+    this->problem_idx = problem_idx;
+    problem_iter_begin = problem_iter_offsets[problem_idx];
+    iters_per_tile = problem_iters_per_tile(this->params.problem_sizes[problem_idx]);
+  }
+
+  /// Index of the block whose range contains the given MAC-iteration
+  CUTLASS_DEVICE
+  int32_t block_containing(int32_t iter) const {
+    int32_t long_block_iters = block_iters_remainder * (block_iters + 1);
+    if (iter < long_block_iters) {
+      return iter / (block_iters + 1);
+    }
+    return block_iters_remainder + (iter - long_block_iters) / block_iters;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// ProblemVisitor that looks up each tile in per-problem tile offsets computed on device
+//
+// A single-threadblock kernel launched ahead of the grouped kernel scans the problem sizes into
+// the offset of each problem's first tile, followed by the total tile count. Each threadblock
+// then locates the problem of a tile with a binary search over those offsets, starting from the
+// problem of its previous tile. Unlike `kDeviceOnly`, the cost of finding a tile does not grow
+// with the number of problems preceding it, and unlike `kHostPrecompute`, the problem sizes need
+// not be visible to the host.
+//
+template <typename ProblemSizeHelper,
+          typename ThreadblockShape,
+          int PrefetchTileCount,
+          int ThreadCount>
+struct GroupedProblemVisitor<ProblemSizeHelper,
+                             ThreadblockShape,
+                             GroupScheduleMode::kDevicePrecompute,
+                             PrefetchTileCount,
+                             ThreadCount> : public BaseGroupedProblemVisitor<ProblemSizeHelper, ThreadblockShape> {
+  using Base = BaseGroupedProblemVisitor<ProblemSizeHelper, ThreadblockShape>;
+  using Params = typename Base::Params;
+  static bool const kRequiresPrecomputation = false;
+  static bool const kPrecomputesOnDevice = true;
+
+  static int const kThreadCount = ThreadCount;
+  static int const kThreadsPerWarp = 32;
+
+  /// Threads of the kernel computing the tile offsets
+  static int const kPrecomputeThreadCount = 256;
+
+  struct SharedStorage {};
+
+  SharedStorage &shared_storage;
+
+  /// Per-problem offsets of the first tile, followed by the total tile count
+  int32_t const *problem_tile_offsets;
+
+  int32_t total_tiles;
+
+  /// One past the last tile of the current problem
+  int32_t problem_tile_end;
+
+  //
+  // Methods
+  //
+  CUTLASS_DEVICE
+  GroupedProblemVisitor(
+    Params const &params_,
+    SharedStorage &shared_storage_,
+    int32_t block_idx
+  ): Base(params_, block_idx),
+  shared_storage(shared_storage_),
+  problem_tile_offsets(reinterpret_cast<int32_t const*>(params_.workspace)),
+  problem_tile_end(0)
+  {
+    total_tiles = problem_tile_offsets[params_.problem_count];
+  }
+
+  CUTLASS_DEVICE
+  bool next_tile() {
+    if (this->tile_idx >= total_tiles) {
+      return false;
+    }
+
+    if (this->tile_idx < problem_tile_end) {
+      return true;
+    }
+
+    // Find the last problem whose first tile is at or before `tile_idx`. Tiles are visited
+    // in increasing order, so the search begins at the current problem. Problems without
+    // tiles share their offset with the next problem and are skipped.
+    int32_t lo = this->problem_idx;
+    int32_t hi = this->params.problem_count;
+    while (hi - lo > 1) {
+      int32_t mid = (lo + hi) / 2;
+      if (problem_tile_offsets[mid] <= this->tile_idx) {
+        lo = mid;
+      }
+      else {
+        hi = mid;
+      }
+    }
+
+    this->problem_idx = lo;
+    this->problem_tile_start = problem_tile_offsets[lo];
+    problem_tile_end = problem_tile_offsets[lo + 1];
+
+    return true;
+  }
+
+  /// Scans the tile counts of all problems into `params.workspace`. Launched with a single
+  /// threadblock of `kPrecomputeThreadCount` threads.
+  CUTLASS_DEVICE
+  static void device_precompute(Params const &params) {
+    __shared__ int32_t warp_tiles[kPrecomputeThreadCount / kThreadsPerWarp];
+
+    int32_t *tile_offsets = reinterpret_cast<int32_t *>(const_cast<void *>(params.workspace));
+
+    int lane_idx = threadIdx.x % kThreadsPerWarp;
+    int warp_idx = threadIdx.x / kThreadsPerWarp;
+    int32_t chunk_tile_start = 0;
+
+    for (int32_t chunk_start = 0; chunk_start < params.problem_count; chunk_start += kPrecomputeThreadCount) {
+      int32_t problem_idx = chunk_start + threadIdx.x;
+
+      int32_t tiles = 0;
+      if (problem_idx < params.problem_count) {
+        cutlass::gemm::GemmCoord problem = params.problem_sizes[problem_idx];
+        Base::possibly_transpose_problem(problem);
+        tiles = Base::tile_count(Base::grid_shape(problem));
+      }
+
+      // Inclusive prefix sum within each warp
+      int32_t tile_end = tiles;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 1; i < kThreadsPerWarp; i <<= 1) {
+        int32_t val = __shfl_up_sync(0xffffffff, tile_end, i);
+        if (lane_idx >= i) {
+          tile_end += val;
+        }
+      }
+
+      if (lane_idx == kThreadsPerWarp - 1) {
+        warp_tiles[warp_idx] = tile_end;
+      }
+      __syncthreads();
+
+      int32_t warp_tile_start = 0;
+      int32_t chunk_tiles = 0;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kPrecomputeThreadCount / kThreadsPerWarp; ++i) {
+        warp_tile_start += (i < warp_idx) ? warp_tiles[i] : 0;
+        chunk_tiles += warp_tiles[i];
+      }
+
+      if (problem_idx < params.problem_count) {
+        tile_offsets[problem_idx] = chunk_tile_start + warp_tile_start + tile_end - tiles;
+      }
+
+      chunk_tile_start += chunk_tiles;
+
+      // Ensure all threads have read the warp totals before they are overwritten
+      __syncthreads();
+    }
+
+    if (threadIdx.x == 0) {
+      tile_offsets[params.problem_count] = chunk_tile_start;
+    }
+  }
+
+  /// Bytes of per-problem tile offsets
+  static size_t get_workspace_size(const cutlass::gemm::GemmCoord* host_problem_sizes_ptr,
+                                   int32_t problem_count,
+                                   int32_t block_count) {
+    return sizeof(int32_t) * (problem_count + 1);
+  }
+
+  static void host_precompute(const cutlass::gemm::GemmCoord* host_problem_sizes_ptr,
+                              int32_t problem_count,
+                              int32_t block_count,
+                              void* host_workspace_ptr) {}
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Computes the schedule of a ProblemVisitor with `kPrecomputesOnDevice`
+template <typename ProblemVisitor>
+__global__ void
+__launch_bounds__(ProblemVisitor::kPrecomputeThreadCount, 1)
+GroupedProblemVisitorPrecompute(typename ProblemVisitor::Params params) {
+  ProblemVisitor::device_precompute(params);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace kernel
@@ -84,6 +84,8 @@ public:
   using EpilogueOutputOp = typename Epilogue::OutputOp;
   using ThreadblockSwizzle = ThreadblockSwizzle_;
   static GroupScheduleMode const kGroupScheduleMode = GroupScheduleMode_;
+  static_assert(kGroupScheduleMode != GroupScheduleMode::kStreamK,
+    "Rank2KGrouped does not support GroupScheduleMode::kStreamK");
   static bool const kTransposed = Transposed;
 
   // Public-facing type definitions related to operand element type, layout, and complex conjugate
@@ -225,8 +225,8 @@ static_assert(is_valid_tile_scheduler, "SM70 kernel does not support specializin
     Tensor gB = local_tile(mB_nk, blk_shape, take<0,3>(blk_coord_mnkl), Step< X,_1,_1>{});           // (BLK_N,BLK_K,k)
 
     // Compute tile residues for predication
-    auto m_max_coord = M - size<0>(gA) * get<0>(blk_coord_mnkl);                             // M - BLK_M * m_coord
-    auto n_max_coord = N - size<0>(gB) * get<1>(blk_coord_mnkl);                             // N - BLK_N * n_coord
+    auto m_max_coord = cutlass::gemm::detail::tile_residue(M, size<0>(gA), get<0>(blk_coord_mnkl)); // M - BLK_M * m_coord
+    auto n_max_coord = cutlass::gemm::detail::tile_residue(N, size<0>(gB), get<1>(blk_coord_mnkl)); // N - BLK_N * n_coord
     auto k_residue   = K - size<1>(gA) * size<2>(gA);                                        // K - BLK_K * k_coord_max
     auto residue_mnk = make_tuple(m_max_coord, n_max_coord, k_residue);
 
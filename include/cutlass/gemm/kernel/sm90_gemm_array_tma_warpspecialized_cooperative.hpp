@@ -48,6 +48,7 @@
 #include "cutlass/trace.h"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+#include "cutlass/arch/grid_dependency_control.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -111,30 +112,50 @@ public:
   using EpilogueParams = typename CollectiveEpilogue::Params;
 
   static_assert(ArchTag::kMinComputeCapability >= 90);
-  static_assert(cute::is_void_v<TileScheduler_>,
-    "Ptr-Array Cooperative and Grouped Gemm Cooperative kernel only supports the default scheduler.");
-
   static constexpr bool IsGroupedGemmKernel = !cute::is_same_v<InternalStrideA, StrideA>;
+  static constexpr bool IsProblemQueueScheduler = cute::is_same_v<TileScheduler_, GroupQueueScheduler>;
+  static constexpr bool IsStreamKScheduler = cute::is_same_v<TileScheduler_, StreamKScheduler>;
+  static constexpr bool IsGroupArrivalScheduler = cute::is_same_v<TileScheduler_, GroupArrivalScheduler>;
+  // Ptr-Array GEMMs whose batches share the B (or A) operand can fold their batches into the tile
+  // grid so that a cluster spans batches and multicasts the shared tile to all of them
+  static constexpr bool IsBatchBroadcastScheduler = cute::is_same_v<TileScheduler_, BatchBroadcastScheduler>;
+  // Dynamic schedulers cannot tell ahead of time which tile is the last one a CTA processes,
+  // so dependent grids are only released once the work loop has drained
+  static constexpr bool IsLastTileQueryable = not IsProblemQueueScheduler && not IsStreamKScheduler;
+
+  static_assert(cute::is_void_v<TileScheduler_> ||
+    (IsGroupedGemmKernel && (IsProblemQueueScheduler || IsStreamKScheduler || IsGroupArrivalScheduler)) ||
+    (not IsGroupedGemmKernel && IsBatchBroadcastScheduler),
+    "Ptr-Array Cooperative and Grouped Gemm Cooperative kernel only supports the default scheduler, "
+    "the batch-broadcast scheduler for Ptr-Array Gemm, "
+    "or the problem queue, stream-K and group arrival schedulers for Grouped Gemm.");
 
   using TileScheduler = cute::conditional_t<IsGroupedGemmKernel,
     typename detail::TileSchedulerSelector<
-      GroupScheduler, ArchTag,
+      cute::conditional_t<cute::is_void_v<TileScheduler_>, GroupScheduler, TileScheduler_>, ArchTag,
       TileShape, ClusterShape,
       ProblemShape>::Scheduler,
     typename detail::TileSchedulerSelector<
-    void, ArchTag, TileShape, ClusterShape>::Scheduler>;
+    TileScheduler_, ArchTag, TileShape, ClusterShape>::Scheduler>;
   using TileSchedulerArguments = typename TileScheduler::Arguments;
   using TileSchedulerParams = typename TileScheduler::Params;
 
+  // Grouped schedulers size their workspace from the problem shapes of all groups
+  using SchedulerProblemShape = cute::conditional_t<IsGroupedGemmKernel,
+    ProblemShape, typename ProblemShape::UnderlyingProblemShape>;
+
   static constexpr uint32_t NumLoadWarpGroups = 1;
   static constexpr uint32_t NumMmaThreads = CUTE_STATIC_V(size(TiledMma{}));
   static constexpr uint32_t NumMmaWarpGroups = NumMmaThreads / NumThreadsPerWarpGroup;
   static constexpr uint32_t MaxThreadsPerBlock = NumMmaThreads + (NumLoadWarpGroups * NumThreadsPerWarpGroup);
   static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+  static constexpr uint32_t NumProducerThreads = CollectiveMainloop::NumProducerThreadEvents;
 
-  /// Register requirement for Load and Math WGs
-  static constexpr uint32_t LoadRegisterRequirement = 40;
-  static constexpr uint32_t MmaRegisterRequirement = 232;
+  /// Register requirement for Load and Math WGs, chosen from the accumulator tile and epilogue unless the schedule pins it
+  using RegisterRequirement = detail::Sm90RegisterRequirement<
+    typename DispatchPolicy::Schedule, TileShape, ElementAccumulator, size(TiledMma{}), CollectiveEpilogue>;
+  static constexpr uint32_t LoadRegisterRequirement = RegisterRequirement::Load;
+  static constexpr uint32_t MmaRegisterRequirement = RegisterRequirement::Mma;
 
   // 1 stage ordered sequence between mainloop and epilogue producer load threads
   using LoadWarpOrderBarrier = cutlass::OrderedSequenceBarrier<1,2>;
@@ -237,8 +258,8 @@ public:
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* scheduler_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += TileScheduler::template get_workspace_size<typename ProblemShape::UnderlyingProblemShape, ElementAccumulator>(
-      args.scheduler, typename ProblemShape::UnderlyingProblemShape{}, args.hw_info, NumMmaWarpGroups);
+    workspace_offset += TileScheduler::template get_workspace_size<SchedulerProblemShape, ElementAccumulator>(
+      args.scheduler, get_scheduler_problem_shape(args.problem_shape), args.hw_info, NumMmaWarpGroups);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     TileSchedulerParams scheduler;
@@ -300,8 +321,8 @@ public:
     workspace_size += CollectiveMainloop::get_workspace_size(args.problem_shape, args.mainloop, sm_count);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
-    workspace_size += TileScheduler::template get_workspace_size<typename ProblemShape::UnderlyingProblemShape, ElementAccumulator>(
-      args.scheduler, typename ProblemShape::UnderlyingProblemShape{}, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
+    workspace_size += TileScheduler::template get_workspace_size<SchedulerProblemShape, ElementAccumulator>(
+      args.scheduler, get_scheduler_problem_shape(args.problem_shape), args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
     return workspace_size;
@@ -330,10 +351,10 @@ public:
       return status;
     }
 
-    status = TileScheduler::template initialize_workspace<typename ProblemShape::UnderlyingProblemShape, ElementAccumulator>(
-      args.scheduler, workspace_ptr + workspace_offset, stream, typename ProblemShape::UnderlyingProblemShape{}, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
-    workspace_offset += TileScheduler::template get_workspace_size<typename ProblemShape::UnderlyingProblemShape, ElementAccumulator>(
-      args.scheduler, typename ProblemShape::UnderlyingProblemShape{}, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
+    status = TileScheduler::template initialize_workspace<SchedulerProblemShape, ElementAccumulator>(
+      args.scheduler, workspace_ptr + workspace_offset, stream, get_scheduler_problem_shape(args.problem_shape), args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
+    workspace_offset += TileScheduler::template get_workspace_size<SchedulerProblemShape, ElementAccumulator>(
+      args.scheduler, get_scheduler_problem_shape(args.problem_shape), args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
@@ -366,6 +387,30 @@ public:
     return dim3(MaxThreadsPerBlock, 1, 1);
   }
 
+  static SchedulerProblemShape
+  get_scheduler_problem_shape(ProblemShape const& problem_shape) {
+    if constexpr (IsGroupedGemmKernel) {
+      return problem_shape;
+    }
+    else {
+      return typename ProblemShape::UnderlyingProblemShape{};
+    }
+  }
+
+  // Identifies the problem a work tile belongs to. The problem queue scheduler reuses ring buffer
+  // slots (L_idx) across problems, so its tiles are identified by their position in the queue instead.
+  template <class WorkTileInfo>
+  CUTLASS_DEVICE
+  static int64_t
+  get_problem_idx(WorkTileInfo const& work_tile_info) {
+    if constexpr (IsProblemQueueScheduler) {
+      return static_cast<int64_t>(work_tile_info.problem_idx);
+    }
+    else {
+      return static_cast<int64_t>(work_tile_info.L_idx);
+    }
+  }
+
   CUTLASS_DEVICE
   void
   operator()(Params const& params, char* smem_buf) {
@@ -434,6 +479,7 @@ public:
     }
     mainloop_pipeline_params.is_leader = warp_group_thread_idx == 0;
     mainloop_pipeline_params.num_consumers = size(TiledMma{});
+    mainloop_pipeline_params.num_producers = NumProducerThreads;
     mainloop_pipeline_params.transaction_bytes = params.mainloop.tma_transaction_bytes;
     MainloopPipeline mainloop_pipeline(shared_storage.pipelines.mainloop, mainloop_pipeline_params, ClusterShape{});
 
@@ -495,6 +541,10 @@ public:
     const auto c_tile_count = CollectiveEpilogue::get_load_pipe_increment(blk_shape);
     const auto d_tile_count = CollectiveEpilogue::get_store_pipe_increment(blk_shape);
 
+    // Problem shapes and pointer arrays may be produced by the preceding kernel, so wait on it
+    // before the scheduler and the collectives touch global memory
+    cutlass::arch::wait_on_dependent_grids();
+
     TileScheduler scheduler{params.scheduler};
 
     // In a warp specialized kernel, collectives expose data movement and compute operations separately
@@ -504,6 +554,13 @@ public:
     // Wait for all thread blocks in the Cluster
     cluster_wait_fn();
 
+    if constexpr (IsProblemQueueScheduler) {
+      // Consumers are the last readers of the problem descriptors, so they hand the slots they move past back to the producer
+      if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+        scheduler.enable_retirement(warp_group_thread_idx == 0, NumMmaWarpGroups);
+      }
+    }
+
     auto work_tile_info = scheduler.initial_work_tile_info(ClusterShape{});
     if (not work_tile_info.is_valid()) {
       // When problem shapes are only on device, the grid launched may be larger than the total number of blocks across groups
@@ -554,6 +611,7 @@ public:
           collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
         }
 
+        int64_t curr_problem_idx = get_problem_idx(work_tile_info);
         bool do_load_order_arrive = true;
         bool did_batch_change = true;
         while (work_tile_info.is_valid()) {
@@ -603,9 +661,10 @@ public:
           auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
           work_tile_info = next_work_tile_info;
           auto next_batch = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl)); // Usually just returns work_tile_info.L_idx
-          did_batch_change = next_batch != curr_batch;
+          did_batch_change = next_batch != curr_batch || get_problem_idx(work_tile_info) != curr_problem_idx;
           if (work_tile_info.is_valid() && did_batch_change) {
             curr_batch = next_batch;
+            curr_problem_idx = get_problem_idx(work_tile_info);
             if constexpr (IsGroupedGemmKernel) {
               problem_shape_MNKL = append<4>(params.problem_shape.get_problem_shape(curr_batch), 1);
             }
@@ -662,7 +721,7 @@ public:
         load_order_barrier.wait();
 
         while (work_tile_info.is_valid()) {
-          int32_t curr_batch = work_tile_info.L_idx;
+          int64_t curr_problem_idx = get_problem_idx(work_tile_info);
 
           // Get next work tile
           auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
@@ -682,7 +741,7 @@ public:
               collective_epilogue.template tensormaps_fence_acquire<IsEpiLoad>(epi_load_tensormap);
             }
 
-            bool wait = work_tile_info.is_valid() && curr_batch != next_work_tile_info.L_idx;
+            bool wait = work_tile_info.is_valid() && curr_problem_idx != get_problem_idx(next_work_tile_info);
 
             epi_load_pipe_producer_state = collective_epilogue.load(
               epi_load_pipeline,
@@ -700,7 +759,7 @@ public:
           }
 
           work_tile_info = next_work_tile_info;
-          did_batch_change = curr_batch != work_tile_info.L_idx;
+          did_batch_change = curr_problem_idx != get_problem_idx(work_tile_info);
 
           if (work_tile_info.is_valid() && did_batch_change) {
             if constexpr (IsGroupedGemmKernel) {
@@ -772,7 +831,7 @@ public:
           problem_shape_MNKL = append<4>(params.problem_shape.get_problem_shape(work_tile_info.L_idx), 1);
         }
 
-        int32_t curr_batch = work_tile_info.L_idx;
+        int64_t curr_problem_idx = get_problem_idx(work_tile_info);
 
         // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
         auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
@@ -788,6 +847,9 @@ public:
 
         static_assert(cute::is_any_of_v<TileScheduler,
             detail::PersistentTileSchedulerSm90Group<ProblemShape>,
+            detail::PersistentTileSchedulerSm90GroupQueue<ProblemShape>,
+            detail::PersistentTileSchedulerSm90GroupArrival<ProblemShape>,
+            detail::PersistentTileSchedulerSm90GroupStreamK<ProblemShape, TileShape, ClusterShape>,
             detail::PersistentTileSchedulerSm90>);
         if (TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
 
@@ -812,6 +874,17 @@ public:
           mainloop_pipe_consumer_state.advance(work_k_tile_count);
         }
 
+        #ifdef CUTLASS_ENABLE_GDC_FOR_SM90
+        if constexpr (IsLastTileQueryable) {
+          if (scheduler.is_last_tile(work_tile_info)) {
+            // Hint on an early release of global memory resources.
+            // The timing of calling this function only influences performance,
+            // not functional correctness.
+            cutlass::arch::launch_dependent_grids();
+          }
+        }
+        #endif
+
         // Perform reduction across splits, if needed
         TileScheduler::fixup(
           params.scheduler, work_tile_info, accumulators, NumMmaWarpGroups, consumer_warp_group_idx);
@@ -849,7 +922,7 @@ public:
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
         work_tile_info = next_work_tile_info;
 
-        did_batch_change = curr_batch != work_tile_info.L_idx;
+        did_batch_change = curr_problem_idx != get_problem_idx(work_tile_info);
         if (work_tile_info.is_valid() && did_batch_change) {
           if constexpr (IsGroupedGemmKernel) {
             problem_shape_MNKL = append<4>(params.problem_shape.get_problem_shape(work_tile_info.L_idx), 1);
@@ -874,6 +947,12 @@ public:
 
       } // Scheduler work fetch loop
 
+      #ifdef CUTLASS_ENABLE_GDC_FOR_SM90
+      if constexpr (not IsLastTileQueryable) {
+        cutlass::arch::launch_dependent_grids();
+      }
+      #endif
+
       // Cooperative only needs TMA to complete at the very end of the kernel
       if (do_store_tail) {
         collective_epilogue.store_tail(
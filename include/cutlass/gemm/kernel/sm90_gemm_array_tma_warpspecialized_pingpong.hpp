@@ -48,6 +48,7 @@
 #include "cutlass/trace.h"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+#include "cutlass/arch/grid_dependency_control.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -111,10 +112,13 @@ public:
   using EpilogueParams = typename CollectiveEpilogue::Params;
 
   static_assert(ArchTag::kMinComputeCapability >= 90);
-  static_assert(cute::is_void_v<TileScheduler_>,
-    "Ptr-Array Pingpong and Grouped Gemm Pingpong kernel only supports the default scheduler.");
-
   static constexpr bool IsGroupedGemmKernel = !cute::is_same_v<InternalStrideA, StrideA>;
+  // Ptr-Array GEMMs whose batches share the B (or A) operand can fold their batches into the tile
+  // grid so that a cluster spans batches and multicasts the shared tile to all of them
+  static constexpr bool IsBatchBroadcastScheduler = cute::is_same_v<TileScheduler_, BatchBroadcastScheduler>;
+  static_assert(cute::is_void_v<TileScheduler_> || (not IsGroupedGemmKernel && IsBatchBroadcastScheduler),
+    "Ptr-Array Pingpong and Grouped Gemm Pingpong kernel only supports the default scheduler, "
+    "or the batch-broadcast scheduler for Ptr-Array Gemm.");
 
   using TileScheduler = cute::conditional_t<IsGroupedGemmKernel,
     typename detail::TileSchedulerSelector<
@@ -122,7 +126,7 @@ public:
       TileShape, ClusterShape,
       ProblemShape>::Scheduler,
     typename detail::TileSchedulerSelector<
-    void, ArchTag, TileShape, ClusterShape>::Scheduler>;
+    TileScheduler_, ArchTag, TileShape, ClusterShape>::Scheduler>;
   using TileSchedulerArguments = typename TileScheduler::Arguments;
   using TileSchedulerParams = typename TileScheduler::Params;
 
@@ -131,9 +135,11 @@ public:
   static constexpr uint32_t MaxThreadsPerBlock = CUTE_STATIC_V(size(TiledMma{})) + (NumMmaWarpGroups * NumThreadsPerWarpGroup);
   static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
 
-  /// Register requirement for Load and Math WGs
-  static constexpr uint32_t LoadRegisterRequirement = 40;
-  static constexpr uint32_t MmaRegisterRequirement = 232;
+  /// Register requirement for Load and Math WGs, chosen from the accumulator tile and epilogue unless the schedule pins it
+  using RegisterRequirement = detail::Sm90RegisterRequirement<
+    typename DispatchPolicy::Schedule, TileShape, ElementAccumulator, size(TiledMma{}), CollectiveEpilogue>;
+  static constexpr uint32_t LoadRegisterRequirement = RegisterRequirement::Load;
+  static constexpr uint32_t MmaRegisterRequirement = RegisterRequirement::Mma;
 
   // 1 stage ordered sequence between mainloop and epilogue producer load threads
   using LoadWarpOrderBarrier = cutlass::OrderedSequenceBarrier<1,2>;
@@ -509,6 +515,10 @@ public:
     const auto c_tile_count = CollectiveEpilogue::get_load_pipe_increment(blk_shape);
     const auto d_tile_count = CollectiveEpilogue::get_store_pipe_increment(blk_shape);
 
+    // Problem shapes and pointer arrays may be produced by the preceding kernel, so wait on it
+    // before the scheduler and the collectives touch global memory
+    cutlass::arch::wait_on_dependent_grids();
+
     TileScheduler scheduler{params.scheduler};
 
     // In a warp specialized kernel, collectives expose data movement and compute operations separately
@@ -850,6 +860,15 @@ public:
           mainloop_pipe_consumer_state.advance(work_k_tile_count);
         }
 
+        #ifdef CUTLASS_ENABLE_GDC_FOR_SM90
+        if (scheduler.is_last_tile(work_tile_info, NumMmaWarpGroups)) {
+          // Hint on an early release of global memory resources.
+          // The timing of calling this function only influences performance,
+          // not functional correctness.
+          cutlass::arch::launch_dependent_grids();
+        }
+        #endif
+
         // Perform reduction across splits, if needed
         TileScheduler::fixup(
           params.scheduler, work_tile_info, accumulators, NumMmaWarpGroups, consumer_warp_group_idx);
@@ -41,9 +41,11 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/sm90_l2_prefetch.hpp"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cute/tensor.hpp"
 #include "cutlass/trace.h"
+#include "cutlass/conv/detail.hpp"
 #include "cutlass/gemm/kernel/gemm_universal_decl.h"
 #include "cutlass/arch/grid_dependency_control.h"
 
@@ -69,7 +71,9 @@ public:
   // Type Aliases
   //
   using ProblemShape = ProblemShape_;
-  static_assert(cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4,
+  // Implicit GEMM convolutions run on this kernel with a ConvProblemShape, linearized to MNKL by the mainloop
+  static constexpr bool IsConvProblemShape = not (cute::is_tuple_v<ProblemShape> || IsCutlass3ArrayKernel<ProblemShape>::value);
+  static_assert(IsConvProblemShape or cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4,
     "ProblemShape{} should be <M,N,K> or <M,N,K,L>");
 
   // Mainloop derived types
@@ -107,6 +111,24 @@ public:
                                           >::Scheduler;
   using TileSchedulerArguments = typename TileScheduler::Arguments;
   using TileSchedulerParams = typename TileScheduler::Params;
+
+  // Stream-K splits can reduce in place only through an epilogue storing D with TMA reduce-add
+  static constexpr bool IsStreamK = cute::is_same_v<TileSchedulerTag, StreamKScheduler>;
+  static constexpr bool IsInPlaceReductionSupported =
+    IsStreamK && cute::is_same_v<typename CollectiveEpilogue::GmemTiledCopyD, SM90_TMA_REDUCE_ADD>;
+
+  // A runtime cluster shape (KernelHardwareInfo::cluster_shape) needs a mainloop that supports it and
+  // a tile scheduler that does not require a static cluster shape
+  static constexpr bool SupportsRuntimeClusterShape =
+    detail::Has_RuntimeClusterShape_v<CollectiveMainloop> &&
+    cute::is_same_v<TileScheduler, PersistentTileSchedulerSm90>;
+
+  // The epilogue reuses the smem of the drained mainloop stages. Each CTA is launched for a single
+  // output tile, so the epilogue of its last (and only) tile never overlaps a mainloop.
+  static constexpr bool IsEpilogueSmemReuse =
+    cute::is_base_of_v<KernelTmaWarpSpecializedCooperativeEpilogueSmemReuse, typename DispatchPolicy::Schedule>;
+  static_assert(not IsEpilogueSmemReuse || cute::is_same_v<TileScheduler, PersistentTileSchedulerSm90>,
+    "Epilogue smem reuse requires the static persistent tile scheduler.");
   
   // Warp specialization thread count per threadblock
   static constexpr uint32_t NumMMAThreads          = size(TiledMma{});       // 8 warps
@@ -122,16 +144,25 @@ public:
   static constexpr uint32_t NumFixupBarriers = NumMmaWarpGroups;
   static constexpr uint32_t NumProducerThreads = CollectiveMainloop::NumProducerThreadEvents;
 
-  /// Register requirement for Load and Math WGs
-  static constexpr uint32_t LoadRegisterRequirement = 40;
-  static constexpr uint32_t MmaRegisterRequirement = 232;
+  // Split-K within a cluster: the CTAs of a 1x1xS cluster accumulate disjoint k ranges of the same output tile
+  // and reduce them into the first CTA over DSMEM, which alone runs the epilogue. No workspace is used.
+  static constexpr bool IsClusterSplitK = cute::is_same_v<TileSchedulerTag, ClusterSplitKScheduler>;
+  using ClusterSplitKReduction = detail::Sm90ClusterSplitKReduction<
+    IsClusterSplitK ? int(cute::size<2>(ClusterShape{})) : 1, NumMMAThreads, ElementAccumulator>;
+
+  /// Register requirement for Load and Math WGs, chosen from the accumulator tile and epilogue unless the schedule pins it
+  using RegisterRequirement = detail::Sm90RegisterRequirement<
+    typename DispatchPolicy::Schedule, TileShape, ElementAccumulator, size(TiledMma{}), CollectiveEpilogue>;
+  static constexpr uint32_t LoadRegisterRequirement = RegisterRequirement::Load;
+  static constexpr uint32_t MmaRegisterRequirement = RegisterRequirement::Mma;
 
   // 1 stage ordered sequence between mainloop and epilogue producer load threads
   using LoadWarpOrderBarrier = cutlass::OrderedSequenceBarrier<1,2>;
 
   // Kernel level shared memory storage
   struct SharedStorage {
-    struct PipelineStorage : cute::aligned_struct<16, _1> {
+    struct PipelineStorage : cute::aligned_struct<16, _1>, detail::TileSchedulerSharedStorage<TileScheduler>,
+                             detail::ClusterSplitKSharedStorage<IsClusterSplitK, ClusterSplitKReduction> {
       using MainloopPipelineStorage = typename CollectiveMainloop::PipelineStorage;
       using EpiLoadPipelineStorage = typename CollectiveEpilogue::PipelineStorage;
 
@@ -140,13 +171,22 @@ public:
       alignas(16) typename LoadWarpOrderBarrier::SharedStorage load_order;
     } pipelines;
 
-    struct TensorStorage : cute::aligned_struct<128, _1> {
-      using MainloopTensorStorage = typename CollectiveMainloop::TensorStorage;
-      using EpilogueTensorStorage = typename CollectiveEpilogue::TensorStorage;
+    using MainloopTensorStorage = typename CollectiveMainloop::TensorStorage;
+    using EpilogueTensorStorage = typename CollectiveEpilogue::TensorStorage;
 
+    struct SeparateTensorStorage : cute::aligned_struct<128, _1> {
       EpilogueTensorStorage epilogue;
       MainloopTensorStorage mainloop;
-    } tensors;
+    };
+
+    // Mainloop and epilogue don't use smem concurrently since each CTA computes a single tile
+    union UnionTensorStorage {
+      alignas(128) EpilogueTensorStorage epilogue;
+      alignas(128) MainloopTensorStorage mainloop;
+    };
+
+    using TensorStorage = cute::conditional_t<IsEpilogueSmemReuse, UnionTensorStorage, SeparateTensorStorage>;
+    TensorStorage tensors;
   };
 
   static constexpr int SharedStorageSize = sizeof(SharedStorage);
@@ -159,19 +199,64 @@ public:
     EpilogueArguments epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerArguments scheduler{};
+    // Optional range (e.g. the next layer's weights) prefetched into L2 during the kernel tail
+    L2PrefetchArguments l2_prefetch{};
+
+    // Default constructor
+    Arguments() = default;
+
+    // Constructor with specified mode, used for Gemm
+    Arguments(
+        GemmUniversalMode mode_,
+        ProblemShape problem_shape_,
+        MainloopArguments mainloop_,
+        EpilogueArguments epilogue_,
+        KernelHardwareInfo hw_info_ = KernelHardwareInfo(),
+        TileSchedulerArguments scheduler_ = TileSchedulerArguments())
+    : mode(mode_)
+      , problem_shape(problem_shape_)
+      , mainloop(mainloop_)
+      , epilogue(epilogue_)
+      , hw_info(hw_info_)
+      , scheduler(scheduler_) {}
+
+    // Constructor with default value for 'mode', used for Conv
+    Arguments(
+        ProblemShape problem_shape_,
+        MainloopArguments mainloop_,
+        EpilogueArguments epilogue_,
+        KernelHardwareInfo hw_info_ = KernelHardwareInfo(),
+        TileSchedulerArguments scheduler_ = TileSchedulerArguments())
+    : mode(GemmUniversalMode::kGemm)
+      , problem_shape(problem_shape_)
+      , mainloop(mainloop_)
+      , epilogue(epilogue_)
+      , hw_info(hw_info_)
+      , scheduler(scheduler_) {}
   };
 
   // Kernel entry point API
   struct Params {
+    using ProblemShapeMNKL = decltype(cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(ProblemShape{}, cute::bool_constant<IsConvProblemShape>{}));
     GemmUniversalMode mode{};
-    ProblemShape problem_shape{};
+    ProblemShapeMNKL problem_shape{};
     MainloopParams mainloop{};
     EpilogueParams epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerParams scheduler{};
     void* workspace{nullptr};
+    L2PrefetchParams l2_prefetch{};
   };
 
+  using ProblemShapeMNKL = typename Params::ProblemShapeMNKL;
+
+  // Problem shape seen by the tile scheduler, linearized by the mainloop for convolutions
+  static ProblemShapeMNKL
+  get_problem_shape_MNKL(ProblemShape const& problem_shape) {
+    return cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(
+      problem_shape, cute::bool_constant<IsConvProblemShape>{});
+  }
+
   //
   // Methods
   //
@@ -182,13 +267,14 @@ public:
   to_underlying_arguments(Arguments const& args, void* workspace) {
     CUTLASS_TRACE_HOST("to_underlying_arguments():");
 
-    auto problem_shape = args.problem_shape;
+    auto problem_shape = get_problem_shape_MNKL(args.problem_shape);
     if constexpr (detail::Has_SwapAB_v<CollectiveMainloop>) {
       // swap M/N
-      get<0>(problem_shape) = get<1>(args.problem_shape);
-      get<1>(problem_shape) = get<0>(args.problem_shape);
+      get<0>(problem_shape) = get<1>(get_problem_shape_MNKL(args.problem_shape));
+      get<1>(problem_shape) = get<0>(get_problem_shape_MNKL(args.problem_shape));
     }
     auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto epilogue_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
 
     // Get SM count if needed, otherwise use user supplied SM count
     int sm_count = args.hw_info.sm_count;
@@ -211,18 +297,28 @@ public:
     }
 
     KernelHardwareInfo hw_info{args.hw_info.device_id, sm_count, max_active_clusters};
+    if constexpr (SupportsRuntimeClusterShape) {
+      auto cluster_shape = get_cluster_shape(args.hw_info);
+      hw_info.cluster_shape = dim3(cute::size<0>(cluster_shape), cute::size<1>(cluster_shape), 1);
+      // The user supplied max cluster count is only valid for the static cluster shape
+      if (int(cute::size(cluster_shape)) != int(cute::size(ClusterShape{}))) {
+        hw_info.max_active_clusters = 0;
+      }
+      CUTLASS_TRACE_HOST("to_underlying_arguments(): Setting cluster shape to "
+        << hw_info.cluster_shape.x << "x" << hw_info.cluster_shape.y);
+    }
 
     // Calculate workspace pointers
     uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
     size_t workspace_offset = 0;
 
     void* epilogue_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(epilogue_problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* scheduler_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+    workspace_offset += TileScheduler::template get_workspace_size<ProblemShapeMNKL, ElementAccumulator>(
+      args.scheduler, get_problem_shape_MNKL(args.problem_shape), args.hw_info, NumMmaWarpGroups);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* mainloop_workspace = nullptr;
@@ -231,31 +327,61 @@ public:
     // subtile will not be used, therefore separate reduction will not be enabled.
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
     TileSchedulerParams scheduler = TileScheduler::to_underlying_arguments(
-      problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, scheduler_workspace, NumEpilogueSubTiles
+      problem_shape_MNKL, TileShape{}, get_cluster_shape(hw_info), hw_info, args.scheduler, scheduler_workspace, NumEpilogueSubTiles
       );
 
     return {
       args.mode,
       problem_shape,
       CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, mainloop_workspace),
-      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, epilogue_workspace),
+      CollectiveEpilogue::to_underlying_arguments(epilogue_problem_shape, args.epilogue, epilogue_workspace),
       hw_info,
       scheduler,
-      workspace
+      workspace,
+      detail::Sm90L2Prefetch::to_underlying_arguments(args.l2_prefetch)
     };
   }
 
   static bool
   can_implement(Arguments const& args) {
     bool implementable = (args.mode == GemmUniversalMode::kGemm) or
-        (args.mode == GemmUniversalMode::kBatched && cute::rank(ProblemShape{}) == 4);
+        (args.mode == GemmUniversalMode::kBatched && (IsConvProblemShape || cute::rank(ProblemShape{}) == 4));
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
       return implementable;
     }
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
-    implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
+    implementable &= CollectiveEpilogue::can_implement(
+      cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape), args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler);
+    implementable &= detail::Sm90L2Prefetch::can_implement(args.l2_prefetch);
+    if constexpr (IsStreamK) {
+      if (args.scheduler.reduction_mode == TileScheduler::ReductionMode::InPlace && !IsInPlaceReductionSupported) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: In-place stream-K reduction requires an epilogue storing D with SM90_TMA_REDUCE_ADD.\n");
+        return false;
+      }
+    }
+    if constexpr (IsClusterSplitK) {
+      auto problem_shape_MNKL = get_problem_shape_MNKL(args.problem_shape);
+      if (cute::size(cute::ceil_div(cute::get<2>(problem_shape_MNKL), cute::get<2>(TileShape{}))) < TileScheduler::Splits) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Cluster split-K requires at least one k tile per CTA of the cluster.\n");
+        return false;
+      }
+    }
+    if (args.hw_info.cluster_shape.x > 0) {
+      constexpr int StaticClusterM = cute::size<0>(ClusterShape{});
+      constexpr int StaticClusterN = cute::size<1>(ClusterShape{});
+      int cluster_m = args.hw_info.cluster_shape.x;
+      int cluster_n = args.hw_info.cluster_shape.y;
+      int cluster_l = args.hw_info.cluster_shape.z;
+      bool is_static_cluster_shape = cluster_m == StaticClusterM && cluster_n == StaticClusterN && cluster_l == 1;
+      bool is_valid_cluster_shape = SupportsRuntimeClusterShape && cluster_n > 0 && cluster_l == 1 &&
+                                    StaticClusterM % cluster_m == 0 && StaticClusterN % cluster_n == 0;
+      if (!is_static_cluster_shape && !is_valid_cluster_shape) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Runtime cluster shape must evenly divide the static ClusterShape.\n");
+        return false;
+      }
+    }
     return implementable;
   }
 
@@ -264,11 +390,12 @@ public:
     size_t workspace_size = 0;
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
 
-    workspace_size += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_size += CollectiveEpilogue::get_workspace_size(
+      cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape), args.epilogue);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
-    workspace_size += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
+    workspace_size += TileScheduler::template get_workspace_size<ProblemShapeMNKL, ElementAccumulator>(
+      args.scheduler, get_problem_shape_MNKL(args.problem_shape), args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
     return workspace_size;
   }
@@ -282,17 +409,18 @@ public:
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
     static constexpr uint32_t NumAccumulatorMtxs = 1;
 
-    status = CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
-    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    auto epilogue_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
+    status = CollectiveEpilogue::initialize_workspace(epilogue_problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(epilogue_problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
     }
 
-    status = TileScheduler::template initialize_workspace<ProblemShape, ElementAccumulator>(
-      args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
-    workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
+    status = TileScheduler::template initialize_workspace<ProblemShapeMNKL, ElementAccumulator>(
+      args.scheduler, workspace_ptr + workspace_offset, stream, get_problem_shape_MNKL(args.problem_shape), args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
+    workspace_offset += TileScheduler::template get_workspace_size<ProblemShapeMNKL, ElementAccumulator>(
+      args.scheduler, get_problem_shape_MNKL(args.problem_shape), args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
@@ -301,6 +429,20 @@ public:
     return status;
   }
 
+  // Returns the cluster shape the kernel is launched with
+  static auto
+  get_cluster_shape(KernelHardwareInfo const& hw_info) {
+    if constexpr (SupportsRuntimeClusterShape) {
+      if (hw_info.cluster_shape.x > 0) {
+        return cute::make_shape(int(hw_info.cluster_shape.x), int(hw_info.cluster_shape.y), cute::Int<1>{});
+      }
+      return cute::make_shape(int(cute::size<0>(ClusterShape{})), int(cute::size<1>(ClusterShape{})), cute::Int<1>{});
+    }
+    else {
+      return ClusterShape{};
+    }
+  }
+
   // Computes the kernel launch grid shape based on runtime parameters
   static dim3
   get_grid_shape(Params const& params) {
@@ -310,7 +452,23 @@ public:
       args.max_swizzle_size = 1 << params.scheduler.log_swizzle_size_;
     }
     args.raster_order = params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN ? TileScheduler::RasterOrderOptions::AlongN : TileScheduler::RasterOrderOptions::AlongM;
-    return TileScheduler::get_grid_shape(params.scheduler, params.problem_shape, TileShape{}, ClusterShape{}, params.hw_info, args);
+    auto cluster_shape = get_cluster_shape(params.hw_info);
+    KernelHardwareInfo hw_info = params.hw_info;
+    if constexpr (IsEpilogueSmemReuse) {
+      // Launch one CTA per output tile. The tile count is rounded up the way the scheduler rounds it, and
+      // passed as the number of co-resident clusters, which the scheduler launches without truncation.
+      auto problem_shape_MNKL = cute::append<4>(params.problem_shape, cute::Int<1>{});
+      dim3 problem_blocks = TileScheduler::get_tiled_cta_shape_mnl(problem_shape_MNKL, TileShape{}, cluster_shape);
+      int swizzle_size = 1 << params.scheduler.log_swizzle_size_;
+      int cluster_m = cute::size<0>(cluster_shape);
+      int cluster_n = cute::size<1>(cluster_shape);
+      int blocks_m = round_up(int(problem_blocks.x), swizzle_size * cluster_m);
+      int blocks_n = round_up(int(problem_blocks.y), swizzle_size * cluster_n);
+      int blocks_total = blocks_m * blocks_n * int(problem_blocks.z);
+      hw_info.sm_count = blocks_total;
+      hw_info.max_active_clusters = blocks_total / (cluster_m * cluster_n);
+    }
+    return TileScheduler::get_grid_shape(params.scheduler, params.problem_shape, TileShape{}, cluster_shape, hw_info, args);
   }
 
   static dim3
@@ -318,6 +476,19 @@ public:
     return dim3(MaxThreadsPerBlock, 1, 1);
   }
 
+  // Implicit GEMM convolution tiles returned by the mainloop have no batch mode
+  template <class WorkTileInfo, class TensorB>
+  CUTLASS_DEVICE
+  static auto
+  get_l_coord(WorkTileInfo const& work_tile_info, TensorB const& gB_nkl) {
+    if constexpr (IsConvProblemShape) {
+      return cute::Int<0>{};
+    }
+    else {
+      return idx2crd(work_tile_info.L_idx, cute::shape<4>(gB_nkl));
+    }
+  }
+
   CUTLASS_DEVICE
   void
   operator()(Params const& params, char* smem_buf) {
@@ -337,10 +508,10 @@ public:
     static_assert(size<0>(TileShape{}) >= 128,
         "Cooperative kernel requires Tile Size to be greater than or equal to 128 along the M-dimension.");
 
-    static_assert(cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
 
     /* In the Cooperative kernel, Consumer0 and Consumer1 collaborate on the same tile */
     enum class WarpGroupRole {
@@ -370,6 +541,8 @@ public:
     auto producer_warp_role = ProducerWarpRole(warp_idx_in_warp_group);
     int lane_predicate = cute::elect_one_sync();
     uint32_t block_rank_in_cluster = cute::block_rank_in_cluster();
+    // The CTAs of a split-K cluster load disjoint k ranges, each as the only CTA of its 1x1 (M,N) slice
+    uint32_t mainloop_rank_in_cluster = IsClusterSplitK ? 0 : block_rank_in_cluster;
 
     // Issue Tma Descriptor Prefetch from a single thread
     if ((warp_idx == 0) && lane_predicate) {
@@ -392,7 +565,15 @@ public:
     mainloop_pipeline_params.num_consumers = NumMMAThreads;
     mainloop_pipeline_params.num_producers = NumProducerThreads;
     mainloop_pipeline_params.transaction_bytes = params.mainloop.tma_transaction_bytes;
-    MainloopPipeline mainloop_pipeline(shared_storage.pipelines.mainloop, mainloop_pipeline_params, ClusterShape{});
+    MainloopPipeline mainloop_pipeline(shared_storage.pipelines.mainloop, mainloop_pipeline_params, [] () {
+      if constexpr (SupportsRuntimeClusterShape) {
+        dim3 cluster_shape = cute::cluster_shape();
+        return make_shape(int(cluster_shape.x), int(cluster_shape.y), Int<1>{});
+      }
+      else {
+        return ClusterShape{};
+      }
+    } ());
 
     // Epilogue Load pipeline
     using EpiLoadPipeline = typename CollectiveEpilogue::LoadPipeline;
@@ -422,6 +603,30 @@ public:
     params_load_order_barrier.group_size = NumThreadsPerWarp;
     LoadWarpOrderBarrier load_order_barrier(shared_storage.pipelines.load_order, params_load_order_barrier);
 
+    if constexpr (IsClusterSplitK) {
+      ClusterSplitKReduction::init(shared_storage.pipelines.cluster_split_k, warp_idx == 0 && lane_predicate);
+    }
+
+    // Dynamic schedulers initialize their smem work broadcast here, ahead of the post-init sync
+    TileScheduler scheduler = [&] () {
+      if constexpr (TileScheduler::IsDynamicPersistent) {
+        using SchedulerRole = typename TileScheduler::Role;
+        SchedulerRole scheduler_role = SchedulerRole::NonParticipant;
+        if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::Mainloop) {
+          scheduler_role = SchedulerRole::Producer;
+        }
+        else if (warp_group_role != WarpGroupRole::Producer ||
+                 (producer_warp_role == ProducerWarpRole::Epilogue && is_epi_load_needed)) {
+          scheduler_role = SchedulerRole::Consumer;
+        }
+        uint32_t num_scheduler_consumers = NumMMAThreads + (is_epi_load_needed ? NumThreadsPerWarp : 0);
+        return TileScheduler{params.scheduler, shared_storage.pipelines.scheduler, scheduler_role, num_scheduler_consumers};
+      }
+      else {
+        return TileScheduler{params.scheduler};
+      }
+    } ();
+
     // Initialize starting pipeline states for the collectives
     // Epilogue store pipe is producer-only (consumer is TMA unit, waits via scoreboarding)
     typename CollectiveMainloop::PipelineState mainloop_pipe_consumer_state;
@@ -454,7 +659,6 @@ public:
     TiledMma tiled_mma;
     auto blk_shape = TileShape{};                                                                // (BLK_M,BLK_N,BLK_K)
 
-    TileScheduler scheduler{params.scheduler};
     auto work_tile_info = scheduler.initial_work_tile_info(ClusterShape{});
     
     // In a warp specialized kernel, collectives expose data movement and compute operations separately
@@ -481,7 +685,8 @@ public:
         // Ensure that the prefetched kernel does not touch
         // unflushed global memory prior to this instruction
         cutlass::arch::wait_on_dependent_grids();
-        bool do_load_order_arrive = true;
+        // With epilogue smem reuse the epilogue load warp instead waits for the mainloop to drain
+        bool do_load_order_arrive = not IsEpilogueSmemReuse;
         while (work_tile_info.is_valid()) {
           if (!TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
             auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
@@ -492,7 +697,7 @@ public:
           // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
           auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
           auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-          auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+          auto l_coord = get_l_coord(work_tile_info, gB_nkl);
           auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
           // Get the number of K tiles to compute for this work as well as the starting K tile offset of the work.
@@ -508,7 +713,7 @@ public:
             blk_coord,
             k_tile_iter, work_k_tile_count,
             lane_idx,
-            block_rank_in_cluster,
+            mainloop_rank_in_cluster,
             shared_storage.tensors.mainloop
           );
           // Update starting pipeline state for the next tile
@@ -526,6 +731,12 @@ public:
           work_tile_info = next_work_tile_info;
         } // Scheduler work fetch loop
 
+        // All tiles of this kernel have been issued; warm the next kernel's weights into L2
+        // while the consumer warp groups drain the remaining stages.
+        if (lane_predicate) {
+          detail::Sm90L2Prefetch::prefetch(params.l2_prefetch);
+        }
+
         // Make sure all Consumer Warp Groups have been waited upon
         collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
@@ -538,7 +749,14 @@ public:
         // unflushed global memory prior to this instruction
         cutlass::arch::wait_on_dependent_grids();
 
-        if (!TileScheduler::requires_separate_reduction(params.scheduler) && work_tile_info.is_valid()) {
+        if constexpr (IsEpilogueSmemReuse) {
+          // The source is loaded into smem aliasing the mainloop stages, which the math WGs release in mma_tail
+          if (work_tile_info.is_valid()) {
+            cutlass::arch::NamedBarrier::arrive_and_wait(NumMMAThreads + NumEpilogueLoadThreads,
+                                                         cutlass::arch::ReservedNamedBarriers::EpilogueSmemReuseBarrier);
+          }
+        }
+        else if (!TileScheduler::requires_separate_reduction(params.scheduler) && work_tile_info.is_valid()) {
           load_order_barrier.wait();
         }
 
@@ -549,7 +767,7 @@ public:
             // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
             auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
             auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-            auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+            auto l_coord = get_l_coord(work_tile_info, gB_nkl);
             auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
             
             epi_load_pipe_producer_state =
@@ -582,13 +800,22 @@ public:
 
       CollectiveEpilogue collective_epilogue(params.epilogue, shared_storage.tensors.epilogue);
 
+      ClusterSplitKReduction cluster_split_k_reduction = [&] () {
+        if constexpr (IsClusterSplitK) {
+          return ClusterSplitKReduction{shared_storage.pipelines.cluster_split_k};
+        }
+        else {
+          return ClusterSplitKReduction{};
+        }
+      } ();
+
       // Do we potentially issue tail arrives for TMA stores, if epilogue load is waiting for it
       bool do_store_tail = false;
       while (work_tile_info.is_valid()) {
         // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
         auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
         auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-        auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+        auto l_coord = get_l_coord(work_tile_info, gB_nkl);
         auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
         auto work_k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, blk_shape);
         // Allocate the accumulators for the (M,N) blk_shape
@@ -616,6 +843,14 @@ public:
           // Update starting mainloop pipeline state for the next tile
           mainloop_pipe_consumer_state.advance(work_k_tile_count);
         }
+
+        if constexpr (IsEpilogueSmemReuse) {
+          // Both math WGs have released every mainloop stage of the tile, so the epilogue (and the epilogue
+          // load warp, if any) can now write smem aliasing the stage buffers
+          uint32_t num_reuse_threads = NumMMAThreads + (is_epi_load_needed ? NumEpilogueLoadThreads : 0);
+          cutlass::arch::NamedBarrier::arrive_and_wait(num_reuse_threads,
+                                                       cutlass::arch::ReservedNamedBarriers::EpilogueSmemReuseBarrier);
+        }
         #ifdef CUTLASS_ENABLE_GDC_FOR_SM90
         if (scheduler.is_last_tile(work_tile_info)) {
           // Hint on an early release of global memory resources.
@@ -633,6 +868,10 @@ public:
         TileScheduler::fixup(
           params.scheduler, work_tile_info, accumulators, NumMmaWarpGroups, consumer_warp_group_idx);
 
+        if constexpr (IsClusterSplitK) {
+          cluster_split_k_reduction.reduce(accumulators, mma_thread_idx);
+        }
+
         if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler)) {
           // Epilogue and write to gD
           auto [epi_load_pipe_consumer_state_next, epi_store_pipe_producer_state_next] =
@@ -653,6 +892,18 @@ public:
           epi_load_pipe_consumer_state = epi_load_pipe_consumer_state_next;
           epi_store_pipe_producer_state = epi_store_pipe_producer_state_next;
           do_store_tail = true;
+
+          if constexpr (IsInPlaceReductionSupported) {
+            // The reductions of this split into D must have landed before the next split of the tile issues its own.
+            // Only the TMA-issuing warp has stores in flight, so all Math WGs sync before signaling.
+            if (params.scheduler.reduction_mode_ == TileScheduler::ReductionMode::InPlace &&
+                TileScheduler::requires_fixup(params.scheduler, work_tile_info)) {
+              cute::tma_store_wait_complete<0>();
+              cutlass::arch::NamedBarrier::sync(NumMMAThreads, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier);
+              TileScheduler::in_place_reduction_arrive(
+                params.scheduler, work_tile_info, NumMmaWarpGroups, consumer_warp_group_idx);
+            }
+          }
         }
 
         // Get next work tile
@@ -661,6 +912,10 @@ public:
         work_tile_info = next_work_tile_info;
       } // Scheduler work fetch loop
 
+      if constexpr (IsClusterSplitK) {
+        cluster_split_k_reduction.tail();
+      }
+
       if (do_store_tail) {
         collective_epilogue.store_tail(
           epi_load_pipeline,
@@ -42,6 +42,7 @@
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/sm90_l2_prefetch.hpp"
 #include "cutlass/gemm/kernel/gemm_universal_decl.h"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/trace.h"
@@ -102,7 +103,6 @@ public:
   using EpilogueArguments = typename CollectiveEpilogue::Arguments;
   using EpilogueParams = typename CollectiveEpilogue::Params;
 
-  static_assert(!cute::is_same_v<TileScheduler_, StreamKScheduler>, "Ping-pong kernel does not currently support stream-K scheduler.");
   using TileSchedulerTag = TileScheduler_;
   using TileScheduler = typename detail::TileSchedulerSelector<
                                           TileSchedulerTag, 
@@ -112,6 +112,12 @@ public:
                                           >::Scheduler;
   using TileSchedulerArguments = typename TileScheduler::Arguments;
   using TileSchedulerParams = typename TileScheduler::Params;
+
+  // A runtime cluster shape (KernelHardwareInfo::cluster_shape) needs a mainloop that supports it and
+  // a tile scheduler that does not require a static cluster shape
+  static constexpr bool SupportsRuntimeClusterShape =
+    detail::Has_RuntimeClusterShape_v<CollectiveMainloop> &&
+    cute::is_same_v<TileScheduler, PersistentTileSchedulerSm90>;
   // Warp specialization thread count per threadblock
   static constexpr uint32_t NumMainloopLoadThreads = NumThreadsPerWarp;      // 1 warp
   static constexpr uint32_t NumEpilogueLoadThreads = NumThreadsPerWarp;      // 1 warp for C
@@ -120,13 +126,25 @@ public:
   static constexpr uint32_t NumMMAThreads = size(TiledMma{});                 // 4 warp 
   static constexpr uint32_t MaxThreadsPerBlock = NumMMAThreads * NumMmaWarpGroups + (NumLoadWarpGroups * NumThreadsPerWarpGroup);
   static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  // Each Math WG computes whole output tiles, so stream-K partials are reduced per output tile
+  // rather than per Math WG
+  static constexpr bool IsStreamK = cute::is_same_v<TileSchedulerTag, StreamKScheduler>;
+  // Stream-K splits can reduce in place only through an epilogue storing D with TMA reduce-add
+  static constexpr bool IsInPlaceReductionSupported =
+    IsStreamK && cute::is_same_v<typename CollectiveEpilogue::GmemTiledCopyD, SM90_TMA_REDUCE_ADD>;
+  static constexpr uint32_t NumFixupBarriers = 1;
+  static_assert(not cute::is_same_v<TileSchedulerTag, ClusterSplitKScheduler>,
+    "Cluster split-K is only supported by the cooperative kernel.");
   
   static_assert(NumMMAThreads == 128, "Pingpong kernel must have TiledMMA operating using 128 threads.");
   static_assert(MaxThreadsPerBlock == 384, "Pingpong kernel must have 384 threads in total.");
 
-  /// Register requirement for Load and Math WGs
-  static constexpr uint32_t LoadRegisterRequirement = 40;
-  static constexpr uint32_t MmaRegisterRequirement = 232;
+  /// Register requirement for Load and Math WGs, chosen from the accumulator tile and epilogue unless the schedule pins it
+  using RegisterRequirement = detail::Sm90RegisterRequirement<
+    typename DispatchPolicy::Schedule, TileShape, ElementAccumulator, size(TiledMma{}), CollectiveEpilogue>;
+  static constexpr uint32_t LoadRegisterRequirement = RegisterRequirement::Load;
+  static constexpr uint32_t MmaRegisterRequirement = RegisterRequirement::Mma;
 
   // 1 stage ordered sequence between mainloop and epilogue producer load threads
   using LoadWarpOrderBarrier = cutlass::OrderedSequenceBarrier<1,2>;
@@ -142,7 +160,7 @@ public:
 
   // Kernel level shared memory storage
   struct SharedStorage {
-    struct PipelineStorage : cute::aligned_struct<16, _1> {
+    struct PipelineStorage : cute::aligned_struct<16, _1>, detail::TileSchedulerSharedStorage<TileScheduler> {
       using MainloopPipelineStorage = typename CollectiveMainloop::PipelineStorage;
       using EpiLoadPipelineStorage = typename CollectiveEpilogue::PipelineStorage;
       using MathWarpGroupOrderBarrierStorage = MathWarpGroupOrderBarrierSharedStorage;
@@ -172,6 +190,8 @@ public:
     EpilogueArguments epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerArguments scheduler{};
+    // Optional range (e.g. the next layer's weights) prefetched into L2 during the kernel tail
+    L2PrefetchArguments l2_prefetch{};
   };
 
   // Kernel entry point API
@@ -182,6 +202,7 @@ public:
     EpilogueParams epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerParams scheduler{};
+    L2PrefetchParams l2_prefetch{};
   };
 
   //
@@ -224,6 +245,16 @@ public:
     }
 
     KernelHardwareInfo hw_info{args.hw_info.device_id, sm_count, max_active_clusters};
+    if constexpr (SupportsRuntimeClusterShape) {
+      auto cluster_shape = get_cluster_shape(args.hw_info);
+      hw_info.cluster_shape = dim3(cute::size<0>(cluster_shape), cute::size<1>(cluster_shape), 1);
+      // The user supplied max cluster count is only valid for the static cluster shape
+      if (int(cute::size(cluster_shape)) != int(cute::size(ClusterShape{}))) {
+        hw_info.max_active_clusters = 0;
+      }
+      CUTLASS_TRACE_HOST("to_underlying_arguments(): Setting cluster shape to "
+        << hw_info.cluster_shape.x << "x" << hw_info.cluster_shape.y);
+    }
 
     // Calculate workspace pointers
     uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
@@ -233,13 +264,16 @@ public:
     workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
+    // Precompute the sub tiles numbers in epilogue, pass into tile scheduler. Therefore it will be used
+    // in separate reduction scheme for streamk case.
+    constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
+
     void* scheduler_workspace = workspace_ptr + workspace_offset;
     workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+      args.scheduler, args.problem_shape, args.hw_info, NumFixupBarriers, NumEpilogueSubTiles);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* mainloop_workspace = nullptr;
-    constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
 
     return {
       args.mode,
@@ -248,8 +282,9 @@ public:
       CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, epilogue_workspace),
       hw_info,
       TileScheduler::to_underlying_arguments(
-        problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, scheduler_workspace, NumEpilogueSubTiles
-      )
+        problem_shape_MNKL, TileShape{}, get_cluster_shape(hw_info), hw_info, args.scheduler, scheduler_workspace, NumEpilogueSubTiles
+      ),
+      detail::Sm90L2Prefetch::to_underlying_arguments(args.l2_prefetch)
     };
   }
 
@@ -264,6 +299,27 @@ public:
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
     implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler);
+    implementable &= detail::Sm90L2Prefetch::can_implement(args.l2_prefetch);
+    if constexpr (IsStreamK) {
+      if (args.scheduler.reduction_mode == TileScheduler::ReductionMode::InPlace && !IsInPlaceReductionSupported) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: In-place stream-K reduction requires an epilogue storing D with SM90_TMA_REDUCE_ADD.\n");
+        return false;
+      }
+    }
+    if (args.hw_info.cluster_shape.x > 0) {
+      constexpr int StaticClusterM = cute::size<0>(ClusterShape{});
+      constexpr int StaticClusterN = cute::size<1>(ClusterShape{});
+      int cluster_m = args.hw_info.cluster_shape.x;
+      int cluster_n = args.hw_info.cluster_shape.y;
+      int cluster_l = args.hw_info.cluster_shape.z;
+      bool is_static_cluster_shape = cluster_m == StaticClusterM && cluster_n == StaticClusterN && cluster_l == 1;
+      bool is_valid_cluster_shape = SupportsRuntimeClusterShape && cluster_n > 0 && cluster_l == 1 &&
+                                    StaticClusterM % cluster_m == 0 && StaticClusterN % cluster_n == 0;
+      if (!is_static_cluster_shape && !is_valid_cluster_shape) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Runtime cluster shape must evenly divide the static ClusterShape.\n");
+        return false;
+      }
+    }
 
     return implementable;
   }
@@ -271,12 +327,13 @@ public:
   static size_t
   get_workspace_size(Arguments const& args) {
     size_t workspace_size = 0;
+    constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
 
     workspace_size += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
     workspace_size += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+      args.scheduler, args.problem_shape, args.hw_info, NumFixupBarriers, NumEpilogueSubTiles);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
     return workspace_size;
@@ -288,7 +345,7 @@ public:
     Status status = Status::kSuccess;
     uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
     size_t workspace_offset = 0;
-    static constexpr uint32_t NumEpilogueSubTiles = 1;
+    constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
     static constexpr uint32_t NumAccumulatorMtxs = 1;
 
     status = CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
@@ -299,9 +356,9 @@ public:
     }
 
     status = TileScheduler::template initialize_workspace<ProblemShape, ElementAccumulator>(
-      args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
+      args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, NumFixupBarriers, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
     workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+      args.scheduler, args.problem_shape, args.hw_info, NumFixupBarriers, NumEpilogueSubTiles);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
@@ -310,6 +367,20 @@ public:
     return status;
   }
 
+  // Returns the cluster shape the kernel is launched with
+  static auto
+  get_cluster_shape(KernelHardwareInfo const& hw_info) {
+    if constexpr (SupportsRuntimeClusterShape) {
+      if (hw_info.cluster_shape.x > 0) {
+        return cute::make_shape(int(hw_info.cluster_shape.x), int(hw_info.cluster_shape.y), cute::Int<1>{});
+      }
+      return cute::make_shape(int(cute::size<0>(ClusterShape{})), int(cute::size<1>(ClusterShape{})), cute::Int<1>{});
+    }
+    else {
+      return ClusterShape{};
+    }
+  }
+
   // Computes the kernel launch grid shape based on runtime parameters
   static dim3
   get_grid_shape(Params const& params) {
@@ -319,7 +390,7 @@ public:
       args.max_swizzle_size = 1 << params.scheduler.log_swizzle_size_;
     }
     args.raster_order = params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN ? TileScheduler::RasterOrderOptions::AlongN : TileScheduler::RasterOrderOptions::AlongM;
-    return TileScheduler::get_grid_shape(params.scheduler, params.problem_shape, TileShape{}, ClusterShape{}, params.hw_info, args);
+    return TileScheduler::get_grid_shape(params.scheduler, params.problem_shape, TileShape{}, get_cluster_shape(params.hw_info), params.hw_info, args);
   }
 
   static dim3
@@ -391,7 +462,15 @@ public:
     mainloop_pipeline_params.is_leader = warp_group_thread_idx == 0;
     mainloop_pipeline_params.num_consumers = NumThreadsPerWarpGroup;
     mainloop_pipeline_params.transaction_bytes = params.mainloop.tma_transaction_bytes;
-    MainloopPipeline mainloop_pipeline(shared_storage.pipelines.mainloop, mainloop_pipeline_params, ClusterShape{});
+    MainloopPipeline mainloop_pipeline(shared_storage.pipelines.mainloop, mainloop_pipeline_params, [] () {
+      if constexpr (SupportsRuntimeClusterShape) {
+        dim3 cluster_shape = cute::cluster_shape();
+        return make_shape(int(cluster_shape.x), int(cluster_shape.y), Int<1>{});
+      }
+      else {
+        return ClusterShape{};
+      }
+    } ());
 
     // Epilogue Load pipeline
     using EpiLoadPipeline = typename CollectiveEpilogue::LoadPipeline;
@@ -427,6 +506,27 @@ public:
     params_math_wg_order_barrier.group_size = NumThreadsPerWarpGroup; // Number of threads / participants in a group
     MathWarpGroupOrderBarrier math_wg_order_barrier(shared_storage.pipelines.math_wg_order, params_math_wg_order_barrier);
 
+    // Dynamic schedulers initialize their smem work broadcast here, ahead of the post-init sync
+    TileScheduler scheduler = [&] () {
+      if constexpr (TileScheduler::IsDynamicPersistent) {
+        bool is_epi_load_needed = CollectiveEpilogue(params.epilogue, shared_storage.tensors.epilogue).is_producer_load_needed();
+        using SchedulerRole = typename TileScheduler::Role;
+        SchedulerRole scheduler_role = SchedulerRole::NonParticipant;
+        if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::Mainloop) {
+          scheduler_role = SchedulerRole::Producer;
+        }
+        else if (warp_group_role != WarpGroupRole::Producer ||
+                 (producer_warp_role == ProducerWarpRole::Epilogue && is_epi_load_needed)) {
+          scheduler_role = SchedulerRole::Consumer;
+        }
+        uint32_t num_scheduler_consumers = NumMMAThreads * NumMmaWarpGroups + (is_epi_load_needed ? NumThreadsPerWarp : 0);
+        return TileScheduler{params.scheduler, shared_storage.pipelines.scheduler, scheduler_role, num_scheduler_consumers};
+      }
+      else {
+        return TileScheduler{params.scheduler};
+      }
+    } ();
+
     // Initialize starting pipeline states for the collectives
     // Epilogue store pipe is producer-only (consumer is TMA unit, waits via scoreboarding)
     typename CollectiveMainloop::PipelineState mainloop_pipe_consumer_state;
@@ -474,20 +574,9 @@ public:
     Tensor gB_nkl = get<1>(load_inputs);
 
     // Get pipeline stage increments from tensor shapes
-    auto k_tile_count = size<3>(gA_mkl);
     auto c_tile_count = CollectiveEpilogue::get_load_pipe_increment(blk_shape);
     auto d_tile_count = CollectiveEpilogue::get_store_pipe_increment(blk_shape);
 
-    TileScheduler scheduler{params.scheduler};
-    if (warp_group_role == WarpGroupRole::Consumer1) {
-
-      // Advance 2nd Math WG to the next work tile for the startup
-      scheduler.advance_to_next_work();
-      // Advance 2nd Math WG pipeline states to the end of 1st Math WG
-      mainloop_pipe_consumer_state.advance(k_tile_count);
-      epi_load_pipe_consumer_state.advance(c_tile_count);
-      epi_store_pipe_producer_state.advance(d_tile_count);
-    }
     auto work_tile_info = scheduler.initial_work_tile_info(ClusterShape{});
 
     // Wait for all thread blocks in the Cluster
@@ -503,13 +592,22 @@ public:
         cutlass::arch::wait_on_dependent_grids();
         bool do_load_order_arrive = true;
         while (work_tile_info.is_valid()) {
+          if (!TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
+            auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
+            work_tile_info = next_work_tile_info;
+            continue;
+          }
+
           // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
           auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
           auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
           auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
           auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
-          auto k_tile_iter  = cute::make_coord_iterator(shape<3>(gA_mkl));
+          // Get the number of K tiles to compute for this work as well as the starting K tile offset of the work.
+          auto work_k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, blk_shape);
+          auto work_k_tile_start = TileScheduler::get_work_k_tile_start(work_tile_info);
+          auto k_tile_iter = cute::make_coord_iterator(idx2crd(work_k_tile_start, shape<3>(gA_mkl)), shape<3>(gA_mkl));
 
           collective_mainloop.load(
             params.mainloop,
@@ -517,13 +615,13 @@ public:
             mainloop_pipe_producer_state,
             load_inputs,
             blk_coord,
-            k_tile_iter, k_tile_count,
+            k_tile_iter, work_k_tile_count,
             lane_idx,
             block_rank_in_cluster,
             shared_storage.tensors.mainloop
           );
           // Update starting pipeline state for the next tile
-          mainloop_pipe_producer_state.advance(k_tile_count);
+          mainloop_pipe_producer_state.advance(work_k_tile_count);
 
           // Signal for the epilogue load warp to begin
           if (do_load_order_arrive) {
@@ -532,10 +630,16 @@ public:
           }
 
           // Get next work tile
-          scheduler.advance_to_next_work();
-          work_tile_info = scheduler.get_current_work();
+          auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
+          work_tile_info = next_work_tile_info;
         } // Scheduler work fetch loop
 
+        // All tiles of this kernel have been issued; warm the next kernel's weights into L2
+        // while the consumer warp groups drain the remaining stages.
+        if (lane_predicate) {
+          detail::Sm90L2Prefetch::prefetch(params.l2_prefetch);
+        }
+
         // Make sure all Consumer Warp Groups have been waited upon
         collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
@@ -548,29 +652,35 @@ public:
         // unflushed global memory prior to this instruction
         cutlass::arch::wait_on_dependent_grids();
 
-        load_order_barrier.wait();
-        while (work_tile_info.is_valid()) {
-          // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
-          auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
-          auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-          auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
-          auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
+        if (!TileScheduler::requires_separate_reduction(params.scheduler) && work_tile_info.is_valid()) {
+          load_order_barrier.wait();
+        }
 
-          epi_load_pipe_producer_state =
-          collective_epilogue.load(
-            epi_load_pipeline,
-            epi_load_pipe_producer_state,
-            problem_shape_MNKL,
-            blk_shape,
-            blk_coord,
-            tiled_mma,
-            lane_idx,
-            shared_storage.tensors.epilogue
-          );
+        while (work_tile_info.is_valid()) {
+          if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler)) {
+            // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
+            auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
+            auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
+            auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+            auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
+
+            epi_load_pipe_producer_state =
+            collective_epilogue.load(
+              epi_load_pipeline,
+              epi_load_pipe_producer_state,
+              problem_shape_MNKL,
+              blk_shape,
+              blk_coord,
+              tiled_mma,
+              lane_idx,
+              shared_storage.tensors.epilogue,
+              work_tile_info.reduction_subtile_idx()
+            );
+          }
 
           // Get next work tile
-          scheduler.advance_to_next_work();
-          work_tile_info = scheduler.get_current_work();
+          auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
+          work_tile_info = next_work_tile_info;
         } // Scheduler work fetch loop
 
         // Make sure all Consumer Warp Groups have been waited upon
@@ -582,6 +692,30 @@ public:
     else if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
       cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
 
+      // Index of warp group within consumer warp groups
+      int consumer_warp_group_idx = canonical_warp_group_idx() - NumLoadWarpGroups;
+
+      // Work tiles alternate between the two Math WGs. Steps the pipeline states of this Math WG
+      // over the work tile computed by the other Math WG, then fetches the work tile that follows.
+      // Work tiles may differ in K tile count (stream-K) or skip the epilogue (stream-K partials).
+      auto skip_work_tile = [&] () {
+        if (TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
+          mainloop_pipe_consumer_state.advance(
+            TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, blk_shape));
+        }
+        if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler)) {
+          epi_load_pipe_consumer_state.advance(c_tile_count);
+          epi_store_pipe_producer_state.advance(d_tile_count);
+        }
+        auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
+        work_tile_info = next_work_tile_info;
+      };
+
+      // Advance 2nd Math WG past the work tile of the 1st Math WG for the startup
+      if (warp_group_role == WarpGroupRole::Consumer1 && work_tile_info.is_valid()) {
+        skip_work_tile();
+      }
+
       #ifdef CUTLASS_ENABLE_GDC_FOR_SM90
       // It is possible to have work tiles start off invalid,
       // so we have to check that first.
@@ -601,6 +735,7 @@ public:
         auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
         auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
         auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
+        auto work_k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, blk_shape);
 
         // Allocate the accumulators for the (M,N) blk_shape
         Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(blk_shape));               // (MMA,MMA_M,MMA_N)
@@ -608,27 +743,31 @@ public:
         // Order two Math WG's MMA one after the other, helps hide Epilogue
         math_wg_order_barrier.wait();
 
-        collective_mainloop.mma(
-          mainloop_pipeline,
-          mainloop_pipe_consumer_state,
-          accumulators,
-          k_tile_count,
-          warp_group_thread_idx,
-          shared_storage.tensors.mainloop,
-          params.mainloop
-        );
+        if (TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
+          collective_mainloop.mma(
+            mainloop_pipeline,
+            mainloop_pipe_consumer_state,
+            accumulators,
+            work_k_tile_count,
+            warp_group_thread_idx,
+            shared_storage.tensors.mainloop,
+            params.mainloop
+          );
+        }
 
         // Cue for next Math WG's MMA to start
         math_wg_order_barrier.arrive();
 
-        // Make sure the math instructions are done and free buffers before entering the epilogue
-        collective_mainloop.mma_tail(
-          mainloop_pipeline,
-          mainloop_pipe_consumer_state,
-          k_tile_count
-        );
-        // Update starting mainloop pipeline state for the next tile
-        mainloop_pipe_consumer_state.advance(k_tile_count * NumMmaWarpGroups);
+        if (TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
+          // Make sure the math instructions are done and free buffers before entering the epilogue
+          collective_mainloop.mma_tail(
+            mainloop_pipeline,
+            mainloop_pipe_consumer_state,
+            work_k_tile_count
+          );
+          // Update starting mainloop pipeline state for the next tile
+          mainloop_pipe_consumer_state.advance(work_k_tile_count);
+        }
 
         #ifdef CUTLASS_ENABLE_GDC_FOR_SM90
         if (scheduler.is_last_tile(work_tile_info, NumMmaWarpGroups)) {
@@ -640,49 +779,69 @@ public:
         }
         #endif
 
+        // Perform reduction across splits, if needed. Done ahead of the epilogue ordering so that
+        // a Math WG waiting on the partials of its peers overlaps the epilogue of the other Math WG.
+        if constexpr (IsStreamK) {
+          TileScheduler::fixup_warp_group_tile(
+            params.scheduler, work_tile_info, accumulators, consumer_warp_group_idx);
+        }
+
         // Order two Math WG's Epilogue one after the other
         math_wg_order_barrier.wait();
 
-        // Epilogue and write to gD
-        auto [epi_load_pipe_consumer_state_next, epi_store_pipe_producer_state_next] =
-        collective_epilogue.store(
-          epi_load_pipeline,
-          epi_load_pipe_consumer_state,
-          epi_store_pipeline,
-          epi_store_pipe_producer_state,
-          problem_shape_MNKL,
-          blk_shape,
-          blk_coord,
-          accumulators,
-          tiled_mma,
-          warp_group_thread_idx,
-          shared_storage.tensors.epilogue
-        );
-
-        // TMA store pipeline wait is only visible to TMA-issuing warp, so for multiple-consumer kernels
-        // we need to wait for all TMA stores to complete before issuing consumer order barrier arrives
-        // to ensure next math consumer doesn't overwrite smem of in-flight TMA stores of current consumer.
-        auto [epi_load_pipe_consumer_state_next_, epi_store_pipe_producer_state_next_] =
-        collective_epilogue.store_tail(
-          epi_load_pipeline,
-          epi_load_pipe_consumer_state_next,
-          epi_store_pipeline,
-          epi_store_pipe_producer_state_next
-        );
-
-        // Update starting load/store pipeline states for the next tile
-        // state has already been incremented by 1 tile in collective calls, advance once again for ping pong
-        epi_load_pipe_consumer_state = epi_load_pipe_consumer_state_next_;
-        epi_store_pipe_producer_state = epi_store_pipe_producer_state_next_;
-        epi_load_pipe_consumer_state.advance(c_tile_count);
-        epi_store_pipe_producer_state.advance(d_tile_count);
+        if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler)) {
+          // Epilogue and write to gD
+          auto [epi_load_pipe_consumer_state_next, epi_store_pipe_producer_state_next] =
+          collective_epilogue.store(
+            epi_load_pipeline,
+            epi_load_pipe_consumer_state,
+            epi_store_pipeline,
+            epi_store_pipe_producer_state,
+            problem_shape_MNKL,
+            blk_shape,
+            blk_coord,
+            accumulators,
+            tiled_mma,
+            warp_group_thread_idx,
+            shared_storage.tensors.epilogue,
+            work_tile_info.reduction_subtile_idx()
+          );
+
+          // TMA store pipeline wait is only visible to TMA-issuing warp, so for multiple-consumer kernels
+          // we need to wait for all TMA stores to complete before issuing consumer order barrier arrives
+          // to ensure next math consumer doesn't overwrite smem of in-flight TMA stores of current consumer.
+          auto [epi_load_pipe_consumer_state_next_, epi_store_pipe_producer_state_next_] =
+          collective_epilogue.store_tail(
+            epi_load_pipeline,
+            epi_load_pipe_consumer_state_next,
+            epi_store_pipeline,
+            epi_store_pipe_producer_state_next
+          );
+
+          // Update starting load/store pipeline states for the next tile
+          epi_load_pipe_consumer_state = epi_load_pipe_consumer_state_next_;
+          epi_store_pipe_producer_state = epi_store_pipe_producer_state_next_;
+
+          if constexpr (IsInPlaceReductionSupported) {
+            // The reductions of this split into D must have landed before the next split of the tile issues its own
+            if (params.scheduler.reduction_mode_ == TileScheduler::ReductionMode::InPlace &&
+                TileScheduler::requires_fixup(params.scheduler, work_tile_info)) {
+              cute::tma_store_wait_complete<0>();
+              TileScheduler::in_place_reduction_arrive_warp_group_tile(
+                params.scheduler, work_tile_info, consumer_warp_group_idx);
+            }
+          }
+        }
 
         // Cue for next Math WG's Epilogue to start
         math_wg_order_barrier.arrive();
 
-        // Get next work tile
-        scheduler.advance_to_next_work(NumMmaWarpGroups);
-        work_tile_info = scheduler.get_current_work();
+        // Get next work tile, and skip the one computed by the other Math WG
+        auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
+        work_tile_info = next_work_tile_info;
+        if (work_tile_info.is_valid()) {
+          skip_work_tile();
+        }
       } // Scheduler work fetch loop
     } // Consumer Warp Groups End
 #endif
@@ -161,7 +161,6 @@ public:
   static
   Params
   to_underlying_arguments(Arguments const& args, void* workspace) {
-    (void) workspace;
     auto problem_shape = args.problem_shape;
     if constexpr (detail::Has_SwapAB_v<CollectiveMainloop>) {
       // swap M/N
@@ -171,7 +170,7 @@ public:
     return {
       args.mode,
       problem_shape,
-      CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
+      CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, nullptr),
       CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace)
     };
   }
@@ -194,14 +193,14 @@ public:
   static
   size_t
   get_workspace_size(Arguments const& args) {
-    return 0;
+    return CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
   }
 
   static
   cutlass::Status
   initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
     CudaHostAdapter* cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    return CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace, stream, cuda_adapter);
   }
 
   // Computes the kernel launch grid shape based on runtime parameters
@@ -239,10 +238,20 @@ public:
     SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
 
     int thread_idx = int(threadIdx.x);
+    int lane_idx = canonical_lane_idx();
+    int warp_idx = canonical_warp_idx_sync();
     int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
     int warp_group_idx = canonical_warp_group_idx();
     CUTLASS_ASSERT(warp_group_idx < NumWarpGroups);
     WarpGroupRole warp_group_role = warp_group_idx < NumLoadWarpGroups ? WarpGroupRole::Producer : WarpGroupRole::Consumer;
+    // The first producer warp also issues the epilogue loads, which may be TMA based
+    bool is_epi_load_warp = warp_idx == 0;
+    int lane_predicate = cute::elect_one_sync();
+
+    // Issue Tma Descriptor Prefetch from a single thread
+    if (is_epi_load_warp && lane_predicate) {
+      CollectiveEpilogue::prefetch_tma_descriptors(params.epilogue);
+    }
 
     // Mainloop Load pipeline
     using MainloopPipeline = typename CollectiveMainloop::MainloopPipeline;
@@ -260,14 +269,18 @@ public:
     // Epilogue Load pipeline
     using EpiLoadPipeline = typename CollectiveEpilogue::LoadPipeline;
     typename EpiLoadPipeline::Params epi_load_pipeline_params;
-    if (warp_group_role == WarpGroupRole::Producer) {
+    if (warp_group_role == WarpGroupRole::Producer && is_epi_load_warp) {
       epi_load_pipeline_params.role = EpiLoadPipeline::ThreadCategory::Producer;
     }
     if (warp_group_role == WarpGroupRole::Consumer) {
       epi_load_pipeline_params.role = EpiLoadPipeline::ThreadCategory::Consumer;
     }
-    epi_load_pipeline_params.producer_arv_count = NumLoadWarpGroups * NumThreadsPerWarpGroup;
+    epi_load_pipeline_params.dst_blockid = cute::block_rank_in_cluster();
+    epi_load_pipeline_params.producer_arv_count = NumThreadsPerWarp;
     epi_load_pipeline_params.consumer_arv_count = NumMmaWarpGroups * NumThreadsPerWarpGroup;
+    if constexpr (CollectiveEpilogue::RequiresTransactionBytes) {
+      epi_load_pipeline_params.transaction_bytes = params.epilogue.tma_transaction_bytes;
+    }
     EpiLoadPipeline epi_load_pipeline(shared_storage.pipelines.epi_load, epi_load_pipeline_params);
 
     // Epilogue Store pipeline
@@ -338,8 +351,8 @@ public:
 
     if (warp_group_role == WarpGroupRole::Producer) {
       // Compute tile residues for predication
-      auto m_max_coord = M - size<0>(gA) * get<0>(blk_coord);                             // M - BLK_M * m_coord
-      auto n_max_coord = N - size<0>(gB) * get<1>(blk_coord);                             // N - BLK_N * n_coord
+      auto m_max_coord = cutlass::gemm::detail::tile_residue(M, size<0>(gA), get<0>(blk_coord)); // M - BLK_M * m_coord
+      auto n_max_coord = cutlass::gemm::detail::tile_residue(N, size<0>(gB), get<1>(blk_coord)); // N - BLK_N * n_coord
       auto k_residue   = K - size<1>(gA) * size<2>(gA);                                   // K - BLK_K * k_coord_max
       auto residue_mnk = make_tuple(m_max_coord, n_max_coord, k_residue);
 
@@ -358,7 +371,7 @@ public:
       // Make sure mainloop consumer has been waited upon before issuing epilogue load
       collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
-      if (collective_epilogue.is_producer_load_needed()) {
+      if (is_epi_load_warp && collective_epilogue.is_producer_load_needed()) {
         epi_load_pipe_producer_state =
         collective_epilogue.load(
           epi_load_pipeline,
@@ -367,7 +380,7 @@ public:
           blk_shape,
           blk_coord,
           tiled_mma,
-          thread_idx,
+          lane_idx,
           shared_storage.tensors.epilogue
         );
         collective_epilogue.load_tail(epi_load_pipeline, epi_load_pipe_producer_state);
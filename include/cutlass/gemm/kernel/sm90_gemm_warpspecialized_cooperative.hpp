@@ -31,6 +31,7 @@
 #pragma once
 
 #include "cutlass/cutlass.h"
+#include "cutlass/workspace.h"
 #include "cutlass/fast_math.h"
 #include "cutlass/kernel_hardware_info.hpp"
 #include "cute/arch/cluster_sm90.hpp"
@@ -194,14 +195,25 @@ public:
 
     KernelHardwareInfo hw_info{args.hw_info.device_id, sm_count, max_active_clusters};
 
+    // Calculate workspace pointers
+    uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+    size_t workspace_offset = 0;
+
+    void* epilogue_workspace = workspace_ptr + workspace_offset;
+    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
+
+    void* scheduler_workspace = workspace_ptr + workspace_offset;
     TileSchedulerParams scheduler = TileScheduler::to_underlying_arguments(
-      problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, workspace);
+      problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, scheduler_workspace);
+
+    void* mainloop_workspace = nullptr;
 
     return {
       args.mode,
       problem_shape,
-      CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
-      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace),
+      CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, mainloop_workspace),
+      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, epilogue_workspace),
       hw_info,
       scheduler
     };
@@ -218,6 +230,12 @@ public:
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
     implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler);
+    if constexpr (cute::is_same_v<TileSchedulerTag, StreamKScheduler>) {
+      if (args.scheduler.reduction_mode == TileScheduler::ReductionMode::InPlace) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: In-place stream-K reduction requires a TMA epilogue.\n");
+        return false;
+      }
+    }
 
     return implementable;
   }
@@ -225,20 +243,39 @@ public:
   static
   size_t
   get_workspace_size(Arguments const& args) {
+    size_t workspace_size = 0;
+
+    workspace_size += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
+
     TileScheduler t;
-    return t.template get_workspace_size<ProblemShape, ElementAccumulator>(
+    workspace_size += t.template get_workspace_size<ProblemShape, ElementAccumulator>(
       args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+    workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
+    return workspace_size;
   }
 
   static
   cutlass::Status
   initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
     CudaHostAdapter* cuda_adapter = nullptr) {
-    TileScheduler t;
+    Status status = Status::kSuccess;
+    uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+    size_t workspace_offset = 0;
     static constexpr uint32_t NumEpilogueSubTiles = 1;
     static constexpr uint32_t NumAccumulatorMtxs = 1;
-    return t.template initialize_workspace<ProblemShape, ElementAccumulator>(
-      args.scheduler, workspace, stream, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
+
+    status = CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    TileScheduler t;
+    status = t.template initialize_workspace<ProblemShape, ElementAccumulator>(
+      args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
+    return status;
   }
 
   // Computes the kernel launch grid shape based on runtime parameters
@@ -283,11 +320,20 @@ public:
     SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
 
     int thread_idx = int(threadIdx.x);
+    int lane_idx = canonical_lane_idx();
+    int warp_idx = canonical_warp_idx_sync();
     int mma_thread_idx = thread_idx % size(TiledMma{});
-    int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
     int warp_group_idx = canonical_warp_group_idx();
     CUTLASS_ASSERT(warp_group_idx < NumWarpGroups);
     WarpGroupRole warp_group_role = warp_group_idx < NumLoadWarpGroups ? WarpGroupRole::Producer : WarpGroupRole::Consumer;
+    // The first producer warp also issues the epilogue loads, which may be TMA based
+    bool is_epi_load_warp = warp_idx == 0;
+    int lane_predicate = cute::elect_one_sync();
+
+    // Issue Tma Descriptor Prefetch from a single thread
+    if (is_epi_load_warp && lane_predicate) {
+      CollectiveEpilogue::prefetch_tma_descriptors(params.epilogue);
+    }
 
     // Mainloop Load pipeline
     using MainloopPipeline = typename CollectiveMainloop::MainloopPipeline;
@@ -305,14 +351,18 @@ public:
     // Epilogue Load pipeline
     using EpiLoadPipeline = typename CollectiveEpilogue::LoadPipeline;
     typename EpiLoadPipeline::Params epi_load_pipeline_params;
-    if (warp_group_role == WarpGroupRole::Producer) {
+    if (warp_group_role == WarpGroupRole::Producer && is_epi_load_warp) {
       epi_load_pipeline_params.role = EpiLoadPipeline::ThreadCategory::Producer;
     }
     if (warp_group_role == WarpGroupRole::Consumer) {
       epi_load_pipeline_params.role = EpiLoadPipeline::ThreadCategory::Consumer;
     }
-    epi_load_pipeline_params.producer_arv_count = NumLoadWarpGroups * NumThreadsPerWarpGroup;
+    epi_load_pipeline_params.dst_blockid = cute::block_rank_in_cluster();
+    epi_load_pipeline_params.producer_arv_count = NumThreadsPerWarp;
     epi_load_pipeline_params.consumer_arv_count = NumMmaWarpGroups * NumThreadsPerWarpGroup;
+    if constexpr (CollectiveEpilogue::RequiresTransactionBytes) {
+      epi_load_pipeline_params.transaction_bytes = params.epilogue.tma_transaction_bytes;
+    }
     EpiLoadPipeline epi_load_pipeline(shared_storage.pipelines.epi_load, epi_load_pipeline_params);
 
     // Epilogue Store pipeline
@@ -381,8 +431,8 @@ public:
         auto k_tile_iter = cute::make_coord_iterator(idx2crd(work_k_tile_start, shape<2>(gA)), shape<2>(gA));
 
         // Compute tile residues for predication
-        auto m_max_coord = M - size<0>(gA) * get<0>(blk_coord);                             // M - BLK_M * m_coord
-        auto n_max_coord = N - size<0>(gB) * get<1>(blk_coord);                             // N - BLK_N * n_coord
+        auto m_max_coord = cutlass::gemm::detail::tile_residue(M, size<0>(gA), get<0>(blk_coord)); // M - BLK_M * m_coord
+        auto n_max_coord = cutlass::gemm::detail::tile_residue(N, size<0>(gB), get<1>(blk_coord)); // N - BLK_N * n_coord
         auto k_residue   = K - size<1>(gA) * size<2>(gA);                                   // K - BLK_K * k_coord_max
         auto residue_mnk = make_tuple(m_max_coord, n_max_coord, k_residue);
 
@@ -399,7 +449,7 @@ public:
         // Update starting pipeline state for the next tile
         mainloop_pipe_producer_state.advance(work_k_tile_count);
 
-        if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler) &&
+        if (is_epi_load_warp && TileScheduler::compute_epilogue(work_tile_info, params.scheduler) &&
            collective_epilogue.is_producer_load_needed()) {
           epi_load_pipe_producer_state =
           collective_epilogue.load(
@@ -409,10 +459,10 @@ public:
             blk_shape,
             blk_coord,
             tiled_mma,
-            warp_group_thread_idx,
+            lane_idx,
             shared_storage.tensors.epilogue
           );
-      }
+        }
 
         // Get next work tile
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
@@ -421,8 +471,8 @@ public:
 
       // Make sure all Consumer Warp Groups have been waited upon
       collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
-      
-      if (collective_epilogue.is_producer_load_needed()) {
+
+      if (is_epi_load_warp && collective_epilogue.is_producer_load_needed()) {
         collective_epilogue.load_tail(epi_load_pipeline, epi_load_pipe_producer_state);
       }
     } // Producer Warp Group End
@@ -0,0 +1,120 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Cross-kernel L2 weight prefetch for persistent SM90 GEMM kernels.
+
+    A kernel configured with a non-empty L2PrefetchArguments range issues bulk L2 prefetches
+    (cp.async.bulk.prefetch.L2) for that range from its mainloop producer warp once the producer
+    has run out of tiles to load, i.e. while the consumer warp groups are still draining the last
+    tiles. The intended use is back-to-back layers chained through programmatic dependent launch:
+    the range describes the next kernel's weights, which are read-only, so warming them into L2
+    before the dependent grid's griddepcontrol.wait cannot race with it.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/trace.h"
+#include "cute/arch/copy_sm90_tma.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Contiguous global memory range to warm into L2 during the kernel tail.
+// An empty range (the default) disables the prefetch.
+struct L2PrefetchArguments {
+  // Start of the range, typically the weights of the next kernel. Must be 16B aligned.
+  void const* ptr = nullptr;
+  // Prefetch budget in bytes. Rounded down to a multiple of 16B.
+  size_t bytes = 0;
+};
+
+using L2PrefetchParams = L2PrefetchArguments;
+
+namespace detail {
+
+struct Sm90L2Prefetch {
+  static constexpr int Alignment = 16;
+  // Upper bound on the size of a single bulk prefetch instruction
+  static constexpr size_t MaxBytesPerInstruction = size_t(1) << 20;
+
+  static L2PrefetchParams
+  to_underlying_arguments(L2PrefetchArguments const& args) {
+    L2PrefetchParams params = args;
+    params.bytes = args.ptr == nullptr ? 0 : args.bytes & ~size_t(Alignment - 1);
+    return params;
+  }
+
+  static bool
+  can_implement(L2PrefetchArguments const& args) {
+    if (args.ptr != nullptr && reinterpret_cast<uintptr_t>(args.ptr) % Alignment != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: L2 prefetch range must be 16B aligned.\n");
+      return false;
+    }
+    return true;
+  }
+
+  // Issues this CTA's share of the prefetch range. Must be called by a single thread.
+  CUTLASS_DEVICE
+  static void
+  prefetch(L2PrefetchParams const& params) {
+    if (params.bytes == 0) {
+      return;
+    }
+
+    size_t cta_count = size_t(gridDim.x) * gridDim.y * gridDim.z;
+    size_t cta_idx = blockIdx.x + size_t(blockIdx.y) * gridDim.x + size_t(blockIdx.z) * gridDim.x * gridDim.y;
+
+    // Split the range into 16B aligned slices, one per CTA
+    size_t slice_bytes = (params.bytes + cta_count - 1) / cta_count;
+    slice_bytes = (slice_bytes + Alignment - 1) & ~size_t(Alignment - 1);
+    size_t begin = cta_idx * slice_bytes;
+    if (begin >= params.bytes) {
+      return;
+    }
+    size_t end = cute::min(begin + slice_bytes, params.bytes);
+
+    char const* ptr = static_cast<char const*>(params.ptr);
+    for (size_t offset = begin; offset < end; offset += MaxBytesPerInstruction) {
+      int32_t bytes = static_cast<int32_t>(cute::min(end - offset, MaxBytesPerInstruction));
+      cute::SM90_BULK_COPY_G2S::PREFETCH::copy(ptr + offset, bytes);
+    }
+  }
+};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
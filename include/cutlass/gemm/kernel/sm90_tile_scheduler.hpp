@@ -46,6 +46,7 @@ public:
   using Params = PersistentTileSchedulerSm90Params;
   using RasterOrder = typename Params::RasterOrder;
   using RasterOrderOptions = typename Params::RasterOrderOptions;
+  using TileTraversal = typename Params::TileTraversal;
   using Arguments = BaseScheduler::Arguments;
 
   static constexpr bool IsDynamicPersistent = false;
@@ -0,0 +1,252 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler placing the batches of a shared operand in the same cluster.
+
+    The static persistent schedulers treat the batch mode L as the slowest linear dimension, so
+    every cluster works within one batch and TMA multicast never spans batches. For strided-batched
+    GEMMs with a small M x N per batch and one operand shared by all batches (stride 0 along L, e.g.
+    weights broadcast over a batch of activations), the shared tile is then fetched once per batch.
+
+    This scheduler folds L into the tile coordinate along which the shared operand is multicast:
+
+      - SharedOperand::B folds L into M. Tile m' of the folded grid is tile (m' / L) of batch
+        (m' % L), so the CTAs of a cluster column compute the same N tile of consecutive batches
+        and the multicast B tile serves all of them.
+      - SharedOperand::A folds L into N in the same way, for a shared A multicast along cluster rows.
+
+    Raster order, swizzling and super-tiling then operate on the folded grid. Folded tiles beyond
+    the problem, from rounding the folded extent up to the cluster shape, are out of bounds in M
+    (or N) and are masked by the kernel like any other partial cluster.
+
+    Multicast across batches is only correct when the shared operand really is the same for every
+    batch. Unless the cluster extent along the folded mode is 1, the shared operand must have a
+    zero batch stride, or for Ptr-Array GEMMs the same pointer in every batch. The Ptr-Array
+    mainloop then also skips rewriting the shared operand's tensormap when the batch changes.
+*/
+
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+class PersistentTileSchedulerSm90BatchBroadcast : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+public:
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using WorkTileInfo = BaseScheduler::WorkTileInfo;
+
+  static constexpr bool IsDynamicPersistent = false;
+
+  enum class SharedOperand {
+    A,
+    B
+  };
+
+  struct Arguments : BaseScheduler::Arguments {
+    SharedOperand shared_operand = SharedOperand::B;
+  };
+
+  struct Params : BaseScheduler::Params {
+    SharedOperand shared_operand_ = SharedOperand::B;
+    // Divides a folded M (or N) tile index into (tile, batch)
+    FastDivmodU64 divmod_folded_batch_{};
+  };
+
+  // Returns the problem shape whose tiled M (or N) extent is the tiled extent of problem_shape_mnkl
+  // times its batch count, with a batch count of one.
+  template <class ProblemShapeMNKL, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  fold_batch(ProblemShapeMNKL problem_shape_mnkl, TileShape tile_shape, SharedOperand shared_operand) {
+    int64_t tiles_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape_mnkl), cute::shape<0>(tile_shape)));
+    int64_t tiles_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape_mnkl), cute::shape<1>(tile_shape)));
+    int64_t batches = cute::size(cute::get<3>(problem_shape_mnkl));
+    int64_t folded_m = cute::size(cute::shape<0>(problem_shape_mnkl));
+    int64_t folded_n = cute::size(cute::shape<1>(problem_shape_mnkl));
+    if (shared_operand == SharedOperand::B) {
+      folded_m = tiles_m * batches * int64_t(cute::size<0>(tile_shape));
+    }
+    else {
+      folded_n = tiles_n * batches * int64_t(cute::size<1>(tile_shape));
+    }
+    return cute::make_shape(
+      static_cast<int>(folded_m),
+      static_cast<int>(folded_n),
+      static_cast<int>(cute::size(cute::get<2>(problem_shape_mnkl))),
+      1);
+  }
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace=nullptr,
+      const uint32_t epilogue_subtile = 1,
+      uint32_t ktile_start_alignment_count = 1u) {
+
+    Params params;
+    static_cast<typename BaseScheduler::Params&>(params) = BaseScheduler::to_underlying_arguments(
+      fold_batch(problem_shape_mnkl, tile_shape, arguments.shared_operand), tile_shape, cluster_shape, hw_info,
+      arguments, workspace, epilogue_subtile, ktile_start_alignment_count);
+
+    params.shared_operand_ = arguments.shared_operand;
+    params.divmod_folded_batch_ = FastDivmodU64(cute::size(cute::get<3>(problem_shape_mnkl)));
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    if (args.spatial_tiles_per_plane != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Batch-broadcast tile scheduler does not support spatial blocking.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args);
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape>
+  static dim3
+  get_grid_shape(
+      Params const& params,
+      ProblemShapeMNKL problem_shape_mnk,
+      BlockShape cta_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo hw_info,
+      Arguments arguments = Arguments{},
+      bool truncate_by_problem_size=true) {
+
+    // Kernels pass default arguments with only the raster order set, so fold as the params do
+    auto problem_shape_mnkl = cute::append<4>(problem_shape_mnk, cute::Int<1>{});
+    return BaseScheduler::get_grid_shape(
+      params, fold_batch(problem_shape_mnkl, cta_shape, params.shared_operand_), cta_shape, cluster_shape,
+      hw_info, arguments, truncate_by_problem_size);
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90BatchBroadcast() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90BatchBroadcast(Params const& params_)
+    : BaseScheduler(params_)
+    , shared_operand_(params_.shared_operand_)
+    , divmod_folded_batch_(params_.divmod_folded_batch_) {
+#if defined(__CUDA_ARCH__)
+    if (params_.raster_order_ == RasterOrder::AlongN) {
+      linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    }
+    else {
+      linear_idx_ = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+    }
+    grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    WorkTileInfo work_tile_info = BaseScheduler::get_current_work_for_linear_idx(linear_idx);
+    if (!work_tile_info.is_valid()) {
+      return work_tile_info;
+    }
+
+    // Unfold the batch from the folded tile coordinate
+    uint64_t tile, batch;
+    if (shared_operand_ == SharedOperand::B) {
+      divmod_folded_batch_(tile, batch, static_cast<uint64_t>(work_tile_info.M_idx));
+      work_tile_info.M_idx = static_cast<int32_t>(tile);
+    }
+    else {
+      divmod_folded_batch_(tile, batch, static_cast<uint64_t>(work_tile_info.N_idx));
+      work_tile_info.N_idx = static_cast<int32_t>(tile);
+    }
+    work_tile_info.L_idx = static_cast<int32_t>(batch);
+    return work_tile_info;
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    linear_idx_ += grid_size_ * uint64_t(advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo& work_tile_info, uint32_t advance_count = 1) const {
+    if (continue_current_work(work_tile_info)) {
+      return false;
+    }
+    return not get_current_work_for_linear_idx(linear_idx_ + (grid_size_ * uint64_t(advance_count))).is_valid();
+  }
+
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    if (continue_current_work(work_tile_info)) {
+      return cute::make_tuple(work_tile_info, true);
+    }
+
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+private:
+  SharedOperand shared_operand_ = SharedOperand::B;
+  FastDivmodU64 divmod_folded_batch_{};
+  uint64_t linear_idx_ = 0;
+  uint64_t grid_size_ = 0;
+};
+
+}
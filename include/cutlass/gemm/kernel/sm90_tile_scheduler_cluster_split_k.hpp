@@ -0,0 +1,357 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler splitting the K range of every output tile across the CTAs of a cluster.
+
+    With ClusterShape = 1x1xSplits, the CTAs of a cluster all visit the same output tile and each accumulates
+    a disjoint, contiguous share of its k tiles. The partial accumulators are then reduced into the first CTA
+    of the cluster over distributed shared memory (Sm90ClusterSplitKReduction), which alone runs the epilogue.
+    Unlike stream-K or split-K through the global workspace, the partials never leave the SM cluster.
+
+    Every output tile must have at least Splits k tiles.
+*/
+
+#include "cutlass/arch/barrier.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+#include "cute/algorithm/cluster_reduce.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <class ClusterShape>
+class PersistentTileSchedulerSm90ClusterSplitK : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+  static_assert(cute::is_static<ClusterShape>::value);
+  static_assert(cute::size<0>(ClusterShape{}) == 1 && cute::size<1>(ClusterShape{}) == 1,
+    "Cluster split-K tile scheduler requires a 1x1xSplits cluster shape.");
+
+public:
+  static constexpr int Splits = cute::size<2>(ClusterShape{});
+  static_assert(Splits > 1, "Cluster split-K tile scheduler requires at least two splits.");
+
+  struct Params : PersistentTileSchedulerSm90Params {
+    int32_t k_tiles_per_output_tile_ = 0;
+  };
+  using RasterOrder = typename Params::RasterOrder;
+  using RasterOrderOptions = typename Params::RasterOrderOptions;
+  using Arguments = BaseScheduler::Arguments;
+
+  struct WorkTileInfo : BaseScheduler::WorkTileInfo {
+    // First k tile and number of k tiles of the split accumulated by this CTA
+    int32_t K_idx = 0;
+    int32_t k_tile_count = 0;
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {{-1, -1, -1, false}, 0, 0};
+    }
+  };
+
+  static constexpr bool IsDynamicPersistent = false;
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape_>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      [[maybe_unused]] ClusterShape_ cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      [[maybe_unused]] void* workspace=nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<TileShape>::value);
+
+    // Output tiles are rasterized as for a 1x1x1 cluster, each cluster covering one tile
+    auto cluster_shape_mn = cute::Shape<cute::_1, cute::_1, cute::_1>{};
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cluster_shape_mn);
+
+    Params params;
+    params.initialize(
+      problem_blocks,
+      GemmCoord(1, 1, 1),
+      hw_info,
+      arguments.max_swizzle_size,
+      arguments.raster_order
+    );
+    params.k_tiles_per_output_tile_ = static_cast<int32_t>(
+      cute::size(cute::ceil_div(cute::get<2>(problem_shape_mnkl), cute::get<2>(tile_shape))));
+
+    return params;
+  }
+
+  // Each cluster of the grid spans the Splits CTAs of one output tile along z
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape_>
+  static dim3
+  get_grid_shape(
+      [[maybe_unused]] Params const& params,
+      ProblemShapeMNKL problem_shape_mnk,
+      BlockShape cta_shape,
+      [[maybe_unused]] ClusterShape_ cluster_shape,
+      KernelHardwareInfo hw_info,
+      [[maybe_unused]] Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size=true) {
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape_mnk, cute::Int<1>{});
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(
+      problem_shape_mnkl, cta_shape, cute::Shape<cute::_1, cute::_1, cute::_1>{});
+    uint64_t tiles = uint64_t(problem_blocks.x) * uint64_t(problem_blocks.y) * uint64_t(problem_blocks.z);
+
+    int max_clusters = hw_info.max_active_clusters;
+    if (max_clusters <= 0) {
+      int sm_count = hw_info.sm_count > 0 ?
+        hw_info.sm_count : KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+      max_clusters = cute::max(sm_count / Splits, 1);
+    }
+
+    return dim3(static_cast<uint32_t>(cute::min(tiles, static_cast<uint64_t>(max_clusters))), 1, Splits);
+  }
+
+  // The k range of every output tile is split between the CTAs of the cluster
+  template <class ProblemShape, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape, TileShape) {
+    return work_tile_info.k_tile_count;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    return static_cast<uint32_t>(work_tile_info.K_idx);
+  }
+
+  // Only the first CTA of the cluster, holding the reduced accumulators, stores the tile
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info, Params const&) {
+    return work_tile_info.K_idx == 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info) {
+    return work_tile_info.K_idx == 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90ClusterSplitK() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90ClusterSplitK(Params const& params_)
+      : BaseScheduler(params_), k_tiles_per_output_tile_(params_.k_tiles_per_output_tile_) {
+#if defined(__CUDA_ARCH__)
+    // The grid holds a single cluster along z, so blockIdx.z is the rank of this CTA in its cluster
+    linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y);
+    split_idx_ = static_cast<int32_t>(blockIdx.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  template <class ClusterShape_>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape_) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    auto tile = BaseScheduler::get_current_work_for_linear_idx(linear_idx);
+    if (not tile.is_valid()) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    // Balanced contiguous shares, the first splits taking the smaller ones
+    int32_t k_tile_start = (split_idx_ * k_tiles_per_output_tile_) / Splits;
+    int32_t k_tile_end = ((split_idx_ + 1) * k_tiles_per_output_tile_) / Splits;
+    return {tile, k_tile_start, k_tile_end - k_tile_start};
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    linear_idx_ += grid_size_ * uint64_t(advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo& work_tile_info, uint32_t advance_count = 1) const {
+    return not get_current_work_for_linear_idx(linear_idx_ + (grid_size_ * uint64_t(advance_count))).is_valid();
+  }
+
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+private:
+  uint64_t linear_idx_ = 0;
+  uint64_t grid_size_ = 0;
+  int32_t split_idx_ = 0;
+  int32_t k_tiles_per_output_tile_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Reduces the partial accumulators of a split-K cluster into its first CTA over distributed shared memory.
+//
+// The accumulators are exchanged in chunks of ChunkSize elements per thread through an smem buffer of
+// (Splits - 1) * NumThreads * ChunkSize accumulators, using cute::cluster_reduce. full_barrier of the first CTA
+// tracks the bytes pushed by the other CTAs; empty_barrier of each other CTA is arrived on by the first CTA
+// once it has read the chunk, before the next one may be pushed. With Splits == 1 the reduction is unused.
+template <int Splits_, uint32_t NumThreads, class ElementAccumulator, int ChunkSize = 16>
+class Sm90ClusterSplitKReduction {
+public:
+  static constexpr int Splits = Splits_;
+
+  struct SharedStorage {
+    alignas(16) uint32_t exchange[(Splits - 1) * NumThreads * ChunkSize * sizeof(ElementAccumulator) / sizeof(uint32_t)];
+    alignas(8) cutlass::arch::ClusterBarrier::ValueType full_barrier;
+    alignas(8) cutlass::arch::ClusterBarrier::ValueType empty_barrier;
+  };
+
+  // Must be made visible to the cluster (cluster_arrive + cluster_wait) before the first reduce
+  CUTLASS_DEVICE
+  static void
+  init(SharedStorage& storage, bool is_initializing_thread) {
+    if (is_initializing_thread) {
+      cutlass::arch::ClusterBarrier::init(&storage.full_barrier, 1);
+      cutlass::arch::ClusterBarrier::init(&storage.empty_barrier, 1);
+    }
+    cutlass::arch::fence_barrier_init();
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ClusterSplitKReduction() { }
+
+  CUTLASS_DEVICE explicit
+  Sm90ClusterSplitKReduction(SharedStorage& storage) : storage_(&storage) { }
+
+  // Called by all NumThreads threads holding accumulators. On return, the accumulators of the first CTA
+  // hold the sum over the cluster; those of the other CTAs are unchanged.
+  template <class FrgTensor>
+  CUTLASS_DEVICE
+  void
+  reduce(FrgTensor& accumulators, uint32_t thread_idx) {
+    constexpr int NumAccumulators = decltype(cute::size(accumulators))::value;
+    static_assert(sizeof(ElementAccumulator) % sizeof(uint32_t) == 0,
+      "Cluster split-K reduction requires accumulators of 4B multiples.");
+    static_assert(NumAccumulators % ChunkSize == 0,
+      "Cluster split-K reduction requires a multiple of ChunkSize accumulators per thread.");
+
+    bool is_first_split = cute::block_rank_in_cluster() == 0;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int chunk_idx = 0; chunk_idx < NumAccumulators / ChunkSize; ++chunk_idx) {
+      auto chunk = cute::make_tensor<ElementAccumulator>(cute::Int<ChunkSize>{});
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < ChunkSize; ++i) {
+        chunk(i) = accumulators(chunk_idx * ChunkSize + i);
+      }
+
+      if (is_first_split) {
+        cute::cluster_reduce<NumThreads>(
+          chunk, 0, thread_idx, storage_->exchange, &storage_->full_barrier, full_phase_);
+        full_phase_ ^= 1;
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < ChunkSize; ++i) {
+          accumulators(chunk_idx * ChunkSize + i) = chunk(i);
+        }
+
+        // Release the exchange buffer to the other CTAs once every thread has read its partials
+        cutlass::arch::NamedBarrier::sync(NumThreads, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier);
+        if (thread_idx > 0 && thread_idx < uint32_t(Splits)) {
+          cutlass::arch::ClusterBarrier::arrive(&storage_->empty_barrier, thread_idx, 1);
+        }
+      }
+      else {
+        if (is_push_pending_) {
+          cutlass::arch::ClusterBarrier::wait(&storage_->empty_barrier, empty_phase_);
+          empty_phase_ ^= 1;
+        }
+        cute::cluster_reduce<NumThreads>(
+          chunk, 0, thread_idx, storage_->exchange, &storage_->full_barrier, full_phase_);
+        is_push_pending_ = true;
+      }
+    }
+  }
+
+  // The other CTAs must not exit before the first CTA has released the buffer for their last push
+  CUTLASS_DEVICE
+  void
+  tail() {
+    if (is_push_pending_) {
+      cutlass::arch::ClusterBarrier::wait(&storage_->empty_barrier, empty_phase_);
+      empty_phase_ ^= 1;
+      is_push_pending_ = false;
+    }
+  }
+
+private:
+  SharedStorage* storage_ = nullptr;
+  uint32_t full_phase_ = 0;
+  uint32_t empty_phase_ = 0;
+  bool is_push_pending_ = false;
+};
+
+// Smem reserved by the persistent kernels for a cluster split-K reduction. Empty, and free as a base class,
+// for kernels without one.
+template <bool IsClusterSplitK, class Reduction>
+struct ClusterSplitKSharedStorage { };
+
+template <class Reduction>
+struct ClusterSplitKSharedStorage<true, Reduction> {
+  alignas(16) typename Reduction::SharedStorage cluster_split_k;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
@@ -0,0 +1,250 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler handing out output tiles through a global work counter.
+
+    Each CTA starts on the tile given by its block index, exactly like PersistentTileSchedulerSm90.
+    Every further tile is claimed with an atomic increment of a counter in the kernel workspace, so
+    CTAs slowed down by co-running kernels, MIG or green context partitions, or uneven per-tile work
+    simply claim fewer tiles instead of stretching the tail of the grid.
+
+    Only the mainloop producer warp claims tiles. It broadcasts each claimed tile to the other warps
+    of the CTA through a small smem ring buffer, and those warps still call fetch_next_work() once
+    per tile in the same order as with the static schedulers.
+
+    Exactly one claim is made per output tile over the whole grid, so the CTA that claims the last
+    index resets the counter and the workspace only needs to be zeroed once. The cluster shape must
+    be 1x1x1, since CTAs of a cluster would otherwise have to agree on their multicast tiles.
+*/
+
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/pipeline/sm90_pipeline.hpp"
+#include "cutlass/workspace.h"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+class PersistentTileSchedulerSm90Dynamic : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+public:
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using Arguments = BaseScheduler::Arguments;
+  using WorkTileInfo = BaseScheduler::WorkTileInfo;
+
+  static constexpr bool IsDynamicPersistent = true;
+
+  struct Params : PersistentTileSchedulerSm90Params {
+    // Global work counter, one claim per output tile beyond the first wave
+    uint32_t* tile_counter_ = nullptr;
+  };
+
+  // Depth of the ring buffer between the producer warp and the other warps of the CTA
+  static constexpr uint32_t Stages = 4;
+  using Pipeline = cutlass::PipelineAsync<Stages>;
+  using PipelineState = typename Pipeline::PipelineState;
+
+  struct SharedStorage {
+    typename Pipeline::SharedStorage pipeline;
+    uint32_t work_linear_idx[Stages];
+  };
+
+  enum class Role {
+    NonParticipant, // does not walk the work tiles
+    Producer,       // claims tiles, one warp per CTA
+    Consumer        // reads the tiles claimed by the producer
+  };
+
+private:
+  uint32_t* tile_counter_ = nullptr;
+  uint32_t* smem_work_linear_idx_ = nullptr;
+  uint64_t current_work_linear_idx_ = 0;
+  uint64_t total_grid_size_ = 0;
+  Role role_ = Role::NonParticipant;
+  Pipeline pipeline_;
+  PipelineState pipe_state_;
+
+  CUTLASS_DEVICE
+  static typename Pipeline::Params
+  make_pipeline_params(Role role, uint32_t num_consumer_threads) {
+    typename Pipeline::Params pipeline_params;
+    if (role == Role::Producer) {
+      pipeline_params.role = Pipeline::ThreadCategory::Producer;
+    }
+    if (role == Role::Consumer) {
+      pipeline_params.role = Pipeline::ThreadCategory::Consumer;
+    }
+    pipeline_params.producer_arv_count = NumThreadsPerWarp;
+    pipeline_params.consumer_arv_count = num_consumer_threads;
+    return pipeline_params;
+  }
+
+public:
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace=nullptr,
+      const uint32_t epilogue_subtile = 1,
+      uint32_t ktile_start_alignment_count = 1u) {
+
+    Params params;
+    static_cast<PersistentTileSchedulerSm90Params&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shape_mnkl, tile_shape, cluster_shape, hw_info, arguments, workspace, epilogue_subtile,
+      ktile_start_alignment_count);
+    params.tile_counter_ = reinterpret_cast<uint32_t*>(workspace);
+    return params;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&, uint32_t, const uint32_t = 1, uint32_t = 1) {
+    return sizeof(uint32_t);
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void* workspace, cudaStream_t stream, ProblemShape, KernelHardwareInfo const&,
+    uint32_t, const uint32_t = 1, uint32_t = 1, CudaHostAdapter* cuda_adapter = nullptr) {
+    return zero_workspace(workspace, sizeof(uint32_t), stream, cuda_adapter);
+  }
+
+  // Initializes the smem ring buffer barriers, so it must be constructed by all threads of the CTA
+  // before the kernel's post-init CTA sync. num_consumer_threads counts all threads with Role::Consumer.
+  CUTLASS_DEVICE
+  PersistentTileSchedulerSm90Dynamic(
+      Params const& params_,
+      SharedStorage& shared_storage,
+      Role role,
+      uint32_t num_consumer_threads)
+    : BaseScheduler(params_),
+      tile_counter_(params_.tile_counter_),
+      smem_work_linear_idx_(&shared_storage.work_linear_idx[0]),
+      role_(role),
+      pipeline_(shared_storage.pipeline, make_pipeline_params(role, num_consumer_threads)) {
+#if defined(__CUDA_ARCH__)
+    if (params_.raster_order_ == RasterOrder::AlongN) {
+      current_work_linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    }
+    else {
+      current_work_linear_idx_ = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+    }
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+
+    if (role == Role::Producer) {
+      pipe_state_ = cutlass::make_producer_start_state<Pipeline>();
+    }
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(current_work_linear_idx_);
+  }
+
+  // Must be called once per work tile, in order, by every thread with a participating role.
+  // The producer warp claims the next tile and publishes it, consumers wait for it.
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+#if defined(__CUDA_ARCH__)
+    if (role_ == Role::Producer) {
+      uint32_t claimed_idx = 0;
+      if (canonical_lane_idx() == 0) {
+        claimed_idx = atomicAdd(tile_counter_, 1u);
+        // Every output tile is claimed exactly once across the grid, including the final
+        // out-of-range claim of each CTA. Nobody touches the counter after the last claim.
+        if (claimed_idx + 1 == scheduler_params.blocks_per_problem_) {
+          atomicExch(tile_counter_, 0u);
+        }
+      }
+      claimed_idx = __shfl_sync(0xFFFFFFFF, claimed_idx, 0);
+      current_work_linear_idx_ = total_grid_size_ + claimed_idx;
+
+      pipeline_.producer_acquire(pipe_state_);
+      if (canonical_lane_idx() == 0) {
+        smem_work_linear_idx_[pipe_state_.index()] = static_cast<uint32_t>(cute::min(
+          current_work_linear_idx_, scheduler_params.blocks_per_problem_));
+      }
+      pipeline_.producer_commit(pipe_state_);
+      ++pipe_state_;
+    }
+    else if (role_ == Role::Consumer) {
+      pipeline_.consumer_wait(pipe_state_);
+      current_work_linear_idx_ = smem_work_linear_idx_[pipe_state_.index()];
+      pipeline_.consumer_release(pipe_state_);
+      ++pipe_state_;
+    }
+#endif
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  // The next tile is unknown until it has been claimed. Only used to time the early launch of
+  // dependent grids, so report the tiles of the last grid-sized wave, after which few claims remain.
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo&, uint32_t = 1) const {
+    return current_work_linear_idx_ + total_grid_size_ >= scheduler_params.blocks_per_problem_;
+  }
+};
+
+// Smem reserved by the persistent kernels for their tile scheduler. Empty, and free as a base class,
+// for schedulers that do not broadcast work through smem.
+template <class TileScheduler, class = void>
+struct TileSchedulerSharedStorage { };
+
+template <class TileScheduler>
+struct TileSchedulerSharedStorage<TileScheduler, cute::enable_if_t<TileScheduler::IsDynamicPersistent>> {
+  alignas(16) typename TileScheduler::SharedStorage scheduler;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
@@ -139,13 +139,14 @@ public:
       problem_blocks,
       problem_shapes.groups(),
       problem_shapes.problem_shapes,
-      problem_shapes.host_problem_shapes,
+      problem_shapes.is_host_problem_shape_available() ? problem_shapes.host_problem_shapes : nullptr,
       to_gemm_coord(tile_shape),
       to_gemm_coord(cluster_shape),
       hw_info,
       arguments.max_swizzle_size, 
       arguments.raster_order
     );
+    params.device_groups_ = problem_shapes.device_num_groups;
 
     return params;
   }
@@ -229,6 +230,14 @@ public:
 
     total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
 
+    // The group count may have been produced on device, in which case groups_ is only an upper bound
+    if (scheduler_params.device_groups_ != nullptr) {
+      scheduler_params.groups_ = cute::min(*scheduler_params.device_groups_, scheduler_params.groups_);
+    }
+    if (scheduler_params.groups_ <= 0) {
+      return;
+    }
+
     uint64_t ctas_along_m, ctas_along_n;
     if (is_tuple<decltype(cute::shape<0>(params_.problem_shapes_[0]))>::value ||
         is_tuple<decltype(cute::shape<1>(params_.problem_shapes_[0]))>::value) {
@@ -260,6 +269,10 @@ public:
       return WorkTileInfo::invalid_work_tile();
     }
 
+    if (scheduler_params.groups_ <= 0) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
     return get_work_idx_m_and_n(linear_idx,
                                 current_group_info_,
                                 scheduler_params.groups_,
@@ -280,6 +293,33 @@ public:
     current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
   }
 
+  // Returns whether the current work tile is the last one this CTA will process. The group walk
+  // is performed on a copy of the current group info so that scheduling state is left untouched.
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo const&, uint32_t advance_count = 1) const {
+    uint64_t next_linear_idx = current_work_linear_idx_ + total_grid_size_ * uint64_t(advance_count);
+    if (scheduler_params.pre_processed_problem_shapes) {
+      return next_linear_idx >= scheduler_params.blocks_across_problem_;
+    }
+    if (scheduler_params.groups_ <= 0) {
+      return true;
+    }
+    GroupInfo group_info = current_group_info_;
+    return not get_work_idx_m_and_n(next_linear_idx,
+                                    group_info,
+                                    scheduler_params.groups_,
+                                    scheduler_params.problem_shapes_,
+                                    scheduler_params.cta_shape_,
+                                    scheduler_params.cluster_shape_,
+                                    scheduler_params.divmod_cluster_shape_major_,
+                                    scheduler_params.divmod_cluster_shape_minor_,
+                                    scheduler_params.divmod_cta_shape_m_,
+                                    scheduler_params.divmod_cta_shape_n_,
+                                    scheduler_params.log_swizzle_size_,
+                                    scheduler_params.raster_order_).is_valid();
+  }
+
   // get work_idx_m, work_idx_n from linear_idx while applying swizzle
   static CUTLASS_DEVICE
   WorkTileInfo
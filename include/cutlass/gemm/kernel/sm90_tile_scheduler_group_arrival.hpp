@@ -0,0 +1,158 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler for Grouped GEMMs whose groups become ready at different times.
+
+    Every group has an arrival flag in device-accessible memory. Tiles of a group are only handed out
+    once its flag has reached the arrival epoch of the launch, so the tiles of early groups are computed
+    while the inputs of later ones are still being produced, e.g. tokens sent by peers in an
+    expert-parallel all-to-all. Producers publish a group by storing the epoch to its flag with release
+    semantics at system scope after writing the group's operands. Using an epoch that increases with
+    every launch avoids resetting flags between launches.
+
+    Problem shapes must be final at launch; only the operand data may arrive late. Groups are
+    traversed in order, so they should be listed in their expected order of arrival. Since resident
+    CTAs spin on flags, whatever produces the operands must not depend on SMs occupied by this kernel.
+*/
+
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <class GroupProblemShape>
+class PersistentTileSchedulerSm90GroupArrival : public PersistentTileSchedulerSm90Group<GroupProblemShape> {
+
+  using BaseScheduler = PersistentTileSchedulerSm90Group<GroupProblemShape>;
+
+public:
+  using WorkTileInfo = typename BaseScheduler::WorkTileInfo;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+
+  struct Arguments : BaseScheduler::Arguments {
+    // One flag per group
+    uint32_t const* group_arrival_flags = nullptr;
+    // Value a group's flag reaches once its operands have arrived in this launch
+    uint32_t arrival_epoch = 1;
+  };
+
+  struct Params : BaseScheduler::Params {
+    uint32_t const* group_arrival_flags_ = nullptr;
+    uint32_t arrival_epoch_ = 0;
+  };
+
+private:
+  uint32_t const* group_arrival_flags_ = nullptr;
+  uint32_t arrival_epoch_ = 0;
+
+  CUTLASS_DEVICE
+  void
+  wait_for_group(WorkTileInfo const& work_tile_info) const {
+#if defined(__CUDA_ARCH__)
+    if (not work_tile_info.is_valid()) {
+      return;
+    }
+    uint32_t const* flag = group_arrival_flags_ + work_tile_info.L_idx;
+    uint32_t value;
+    asm volatile ("ld.acquire.sys.global.u32 %0, [%1];\n" : "=r"(value) : "l"(flag) : "memory");
+    // Wrap-around safe comparison against the epoch
+    while (static_cast<int32_t>(value - arrival_epoch_) < 0) {
+      __nanosleep(40);
+      asm volatile ("ld.acquire.sys.global.u32 %0, [%1];\n" : "=r"(value) : "l"(flag) : "memory");
+    }
+#endif
+  }
+
+public:
+
+  template <class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    void* workspace=nullptr,
+    const uint32_t epilogue_subtile = 1,
+    uint32_t ktile_start_alignment_count = 1u
+    ) {
+
+    Params params;
+    static_cast<typename BaseScheduler::Params&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shapes, tile_shape, cluster_shape, hw_info, arguments, workspace, epilogue_subtile,
+      ktile_start_alignment_count);
+    params.group_arrival_flags_ = arguments.group_arrival_flags;
+    params.arrival_epoch_ = arguments.arrival_epoch;
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    if (args.group_arrival_flags == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Group arrival scheduler requires group_arrival_flags to be set.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args);
+  }
+
+  PersistentTileSchedulerSm90GroupArrival() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90GroupArrival(Params const& params_)
+    : BaseScheduler(params_)
+    , group_arrival_flags_(params_.group_arrival_flags_)
+    , arrival_epoch_(params_.arrival_epoch_) { }
+
+  // Kernel helper function to get next work tile. Returns once the tile's group has arrived.
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    auto [next_work_tile_info, increment_pipe] = BaseScheduler::fetch_next_work(work_tile_info);
+    wait_for_group(next_work_tile_info);
+    return cute::make_tuple(next_work_tile_info, increment_pipe);
+  }
+
+  // Returns the initial work tile info that will be computed over, once its group has arrived
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape cluster_shape) {
+    WorkTileInfo work_tile_info = BaseScheduler::initial_work_tile_info(cluster_shape);
+    wait_for_group(work_tile_info);
+    return work_tile_info;
+  }
+};
+
+} // namespace cutlass::gemm::kernel::detail
@@ -0,0 +1,601 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler for Grouped GEMMs whose problems are streamed in through a
+           device-side ring buffer while the kernel is resident.
+
+    The ring buffer slots are the problem shape and pointer/stride arrays of the grouped GEMM
+    arguments (GroupProblemShape::num_groups is the ring capacity). The i-th problem pushed to the
+    queue occupies slot (i % capacity). A producer (host thread writing mapped memory, or an upstream
+    kernel) fills a slot and then publishes it by incrementing GroupProblemQueue::head with release
+    semantics. Once no further problems will be pushed, the producer ORs GroupProblemQueue::kClosed
+    into head, after which the kernel exits as soon as all published problems are drained.
+
+    The kernel increments GroupProblemQueue::tail every time a problem has been retired by all CTAs.
+    A slot may be refilled with problem i only once tail > i - capacity.
+*/
+
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm_coord.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+namespace cutlass::gemm {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Control block of the device-side problem queue consumed by GroupQueueScheduler.
+// All pointers reference device-accessible memory (device or mapped host memory).
+struct GroupProblemQueue {
+  static constexpr uint32_t kClosed = 1u << 31;
+
+  // Number of problems published to the ring buffer, OR'd with kClosed once no further
+  // problems will be published. Written by the producer, zero-initialized before launch.
+  uint32_t const* head = nullptr;
+
+  // Number of problems fully retired by the kernel. Zero-initialized before launch.
+  uint32_t* tail = nullptr;
+
+  // One counter per ring buffer slot, zero-initialized before launch. Used by the kernel
+  // to detect when the last consumer has finished with a slot.
+  uint32_t* slot_arrivals = nullptr;
+};
+
+} // namespace cutlass::gemm
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler pulling grouped problems from a device-side queue
+template <class GroupProblemShape>
+class PersistentTileSchedulerSm90GroupQueue {
+  //
+  // Data members
+  //
+
+private:
+  uint64_t current_work_linear_idx_ = 0;
+  uint64_t total_grid_size_ = 0;
+
+  // Largest published problem count observed by this scheduler
+  uint32_t published_problems_ = 0;
+
+  // Number of problems retired by this scheduler
+  uint32_t retired_problems_ = 0;
+
+  // Consumer warp groups per CTA that retire problems, zero if this scheduler does not retire
+  uint32_t retire_num_consumer_groups_ = 0;
+  bool retire_is_leader_ = false;
+
+  // Tracking current problem, its starting linear idx and total tiles
+  struct GroupInfo {
+    uint32_t problem_idx = 0;
+    uint64_t start_linear_idx = 0;
+    uint64_t total_tiles = 0;
+    bool is_initialized = false;
+  } current_group_info_;
+
+public:
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    // Ring buffer slot holding the problem
+    int32_t L_idx = 0;
+    bool is_valid_tile = false;
+    // Position of the problem in the queue. Unlike L_idx, this is never reused.
+    uint32_t problem_idx = 0;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return is_valid_tile;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, false, 0};
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_final_split(uint32_t k_tiles_per_output_tile) const {
+      return true;
+    }
+
+    CUTLASS_HOST_DEVICE
+    int32_t
+    reduction_subtile_idx() const {
+      return -1;
+    }
+  };
+
+  using ProblemShape = typename GroupProblemShape::UnderlyingProblemShape;
+  using Params = PersistentTileSchedulerSm90GroupQueueParams<ProblemShape>;
+  using RasterOrder = typename Params::RasterOrder;
+  using RasterOrderOptions = typename Params::RasterOrderOptions;
+  static constexpr bool IsDynamicPersistent = false;
+  static constexpr bool IsProblemQueue = true;
+
+  struct Arguments {
+    int max_swizzle_size = 1;
+    // Not applying Heuristics for Grouped problems, since largest dimension can change per group
+    RasterOrderOptions raster_order = RasterOrderOptions::AlongM;
+    GroupProblemQueue queue{};
+  };
+
+  // Sink scheduler params as a member
+  Params scheduler_params;
+
+  //
+  // Methods
+  //
+
+  template <class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    [[maybe_unused]] void* workspace=nullptr,
+    [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+    [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u
+    ) {
+
+    // We only need the tile and cluster shape during scheduler setup, so let FTAD do the magic
+    static_assert(cute::is_static<TileShape>::value);
+    static_assert(cute::is_static<ClusterShape>::value);
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(
+      problem_shapes.groups(),
+      problem_shapes,
+      hw_info,
+      tile_shape, cluster_shape);
+
+    Params params;
+    params.initialize(
+      problem_blocks,
+      problem_shapes.groups(),
+      problem_shapes.problem_shapes,
+      to_gemm_coord(tile_shape),
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      arguments.max_swizzle_size,
+      arguments.raster_order,
+      arguments.queue.head,
+      arguments.queue.tail,
+      arguments.queue.slot_arrivals
+    );
+
+    return params;
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  // Problems are not known at launch time, so the grid always fills the device.
+  template<class TileShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+    [[maybe_unused]] Params const& params,
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo hw_info,
+    Arguments arguments,
+    bool truncate_by_problem_size=true) {
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(
+      problem_shapes.groups(),
+      problem_shapes,
+      hw_info,
+      tile_shape, cluster_shape);
+
+    return Params::get_grid_shape(
+      problem_blocks,
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      arguments.max_swizzle_size,
+      arguments.raster_order,
+      /* truncate_by_problem_size = */false
+    );
+  }
+
+  // The logical size of the grid is the whole device, since the problems are only known on device
+  template<class BlockShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_tiled_cta_shape_mnl(int groups, GroupProblemShape problem_shapes, KernelHardwareInfo hw_info, BlockShape cta_shape, ClusterShape cluster_shape) {
+    uint32_t total_ctas = hw_info.sm_count;
+    uint32_t cta_in_N_dim = 1; // We linearize the blocks across all the problems here
+
+    return Params::get_tiled_cta_shape_mnl(
+      to_gemm_coord(cluster_shape),
+      total_ctas, cta_in_N_dim
+    );
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    if (args.queue.head == nullptr || args.queue.tail == nullptr || args.queue.slot_arrivals == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: GroupProblemQueue requires head, tail and slot_arrivals to be set.\n");
+      return false;
+    }
+    return true;
+  }
+
+  PersistentTileSchedulerSm90GroupQueue() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90GroupQueue(Params const& params_) : scheduler_params(params_) {
+    // MSVC requires protecting use of CUDA-specific nonstandard syntax,
+    // like blockIdx and gridDim, with __CUDA_ARCH__.
+#if defined(__CUDA_ARCH__)
+    if (scheduler_params.raster_order_ == RasterOrder::AlongN) {
+      current_work_linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    }
+    else {
+      current_work_linear_idx_ = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+    }
+
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() {
+    return get_current_work_for_linear_idx(current_work_linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) {
+    if (not current_group_info_.is_initialized) {
+      if (not wait_for_problem(0)) {
+        return WorkTileInfo::invalid_work_tile();
+      }
+      current_group_info_.total_tiles = get_problem_tile_count(0);
+      current_group_info_.is_initialized = true;
+    }
+
+    while (current_group_info_.start_linear_idx + current_group_info_.total_tiles <= linear_idx) {
+      uint32_t next_problem_idx = current_group_info_.problem_idx + 1;
+      // Hand the problem we are moving past back to the producer before blocking on the next one.
+      // A CTA may walk past more problems than the ring holds, so holding on to them would deadlock.
+      retire_problems_before(next_problem_idx);
+      if (not wait_for_problem(next_problem_idx)) {
+        return WorkTileInfo::invalid_work_tile();
+      }
+      current_group_info_.problem_idx = next_problem_idx;
+      current_group_info_.start_linear_idx += current_group_info_.total_tiles;
+      current_group_info_.total_tiles = get_problem_tile_count(next_problem_idx);
+    }
+
+    return get_work_idx_m_and_n(linear_idx);
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
+  }
+
+  // Makes this scheduler retire every problem it moves past. Must be called before the first fetch
+  // by every consumer warp group with exactly one leader thread per warp group, since consumers are the
+  // last readers of the problem descriptors. num_consumer_groups is the number of consumer warp groups per CTA.
+  CUTLASS_DEVICE
+  void
+  enable_retirement(bool is_leader, uint32_t num_consumer_groups) {
+    retire_is_leader_ = is_leader;
+    retire_num_consumer_groups_ = num_consumer_groups;
+  }
+
+  // get work_idx_m, work_idx_n from linear_idx while applying swizzle
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_work_idx_m_and_n(uint64_t linear_idx) const {
+    auto const& divmod_cluster_shape_major = scheduler_params.divmod_cluster_shape_major_;
+    auto const& divmod_cluster_shape_minor = scheduler_params.divmod_cluster_shape_minor_;
+    int32_t log_swizzle_size = scheduler_params.log_swizzle_size_;
+    RasterOrder raster_order = scheduler_params.raster_order_;
+
+    auto [problem_blocks_m, problem_blocks_n] = get_problem_blocks_mn(current_group_info_.problem_idx);
+
+    uint64_t cluster_id, cluster_major_offset = 0, cluster_minor_offset = 0;
+    uint64_t blk_per_grid_dim = divmod_cluster_shape_minor.divide(linear_idx - current_group_info_.start_linear_idx);
+    divmod_cluster_shape_major(cluster_id, cluster_major_offset, blk_per_grid_dim);
+
+    // The grid is launched with all clusters in linear (1-D) order, see PersistentTileSchedulerSm90Group
+    if (raster_order == RasterOrder::AlongN) {
+      cluster_minor_offset = blockIdx.x;
+    }
+    else {
+      cluster_minor_offset = blockIdx.y;
+    }
+
+    uint64_t cluster_idx_minor, cluster_idx_major;
+
+    uint64_t cluster_idx_minor_div_swizzle, extra, offset;
+
+    offset = cluster_id & ((1 << log_swizzle_size) - 1);
+    extra = cluster_id >> log_swizzle_size;
+
+    uint64_t curr_group_cluster_blk_major;
+    if (raster_order == RasterOrder::AlongN) {
+      curr_group_cluster_blk_major = divmod_cluster_shape_major.divide(problem_blocks_n);
+    }
+    else {
+      curr_group_cluster_blk_major = divmod_cluster_shape_major.divide(problem_blocks_m);
+    }
+    cluster_idx_minor_div_swizzle = extra / curr_group_cluster_blk_major;
+    cluster_idx_major = extra % curr_group_cluster_blk_major;
+
+    cluster_idx_minor = cluster_idx_minor_div_swizzle * (1 << log_swizzle_size) + offset;
+
+    auto minor_work_idx = static_cast<int32_t>(cluster_idx_minor * divmod_cluster_shape_minor.divisor +
+                                               cluster_minor_offset);
+    auto major_work_idx = static_cast<int32_t>(cluster_idx_major * divmod_cluster_shape_major.divisor +
+                                               cluster_major_offset);
+
+    int32_t slot = static_cast<int32_t>(get_slot(current_group_info_.problem_idx));
+    if (raster_order == RasterOrder::AlongN) {
+      return {minor_work_idx, major_work_idx, slot, true, current_group_info_.problem_idx};
+    }
+    else {
+      return {major_work_idx, minor_work_idx, slot, true, current_group_info_.problem_idx};
+    }
+  }
+
+  // Returns whether the block assigned this work should compute the epilogue for the corresponding
+  // output tile. For the basic tile scheduler, this is always true.
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&, Params const&) {
+    return true;
+  }
+
+  // Performs the reduction across splits for a given output tile. Since this scheduler does
+  // not split output tiles, no reduction is needed.
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup(Params const&, WorkTileInfo const&, FrgTensorC&, uint32_t, uint32_t) {}
+
+  // Returns whether the current WorkTileInfo passed in should continue to be used. Since
+  // this scheduler only schedules work in units of single, full output tiles, the WorkTileInfo
+  // passed in should not be used after having been processed.
+  CUTLASS_DEVICE
+  static bool
+  continue_current_work(WorkTileInfo&) {
+    return false;
+  }
+
+  // The queue control block is owned by the caller, so no additional workspace is required
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&, uint32_t, const uint32_t = 1, uint32_t = 1) {
+    return 0;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void*, cudaStream_t, ProblemShape, KernelHardwareInfo const&,
+    uint32_t, const uint32_t = 1, uint32_t = 1, CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  template <class ProblemShape_MNKL, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape_MNKL problem_shape, TileShape tile_shape) {
+    // All work units returned by this scheduler cover the entire K iteration
+    // space of the output tile assigned to the work unit.
+    return cute::size(cute::ceil_div(cute::get<2>(problem_shape), cute::get<2>(tile_shape)));
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const&) {
+    // All work units returned by this scheduler start from K tile 0
+    return 0u;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  need_separate_reduction(Params const& params) {
+    return false;
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_work_tile_for_reduction(WorkTileInfo const& work_tile_info, Params const& params) {
+    return false;
+  }
+
+  CUTLASS_DEVICE
+  uint32_t
+  epilgoue_subtile_idx(WorkTileInfo const& work_tile_info, Params const& params) const {
+    return 0;
+  }
+
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  void
+  separate_reduction(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    FrgTensorC& accumulators,
+    uint32_t num_barriers,
+    uint32_t barrier_idx) {
+  }
+
+  // Shares the accumulator set with peers in the global workspace
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  share(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    FrgTensorC& accumulators,
+    uint32_t num_barriers,
+    uint32_t barrier_idx) {
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const& work_tile_info) {
+    return true;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  requires_separate_reduction(Params const& params) {
+    return false;
+  }
+
+  // Kernel helper function to get next work tile
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    if (continue_current_work(work_tile_info)) {
+      return cute::make_tuple(work_tile_info, true);
+    }
+
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+private:
+
+  CUTLASS_DEVICE
+  uint32_t
+  get_slot(uint32_t problem_idx) const {
+    return problem_idx % static_cast<uint32_t>(scheduler_params.groups_);
+  }
+
+  // Retires all problems preceding problem_idx, if retirement is enabled for this scheduler
+  CUTLASS_DEVICE
+  void
+  retire_problems_before(uint32_t problem_idx) {
+#if defined(__CUDA_ARCH__)
+    if (retire_num_consumer_groups_ == 0) {
+      return;
+    }
+    uint32_t const expected_arrivals = static_cast<uint32_t>(total_grid_size_) * retire_num_consumer_groups_;
+    while (retired_problems_ < problem_idx) {
+      if (retire_is_leader_) {
+        uint32_t* arrivals = scheduler_params.slot_arrivals_ + get_slot(retired_problems_);
+        // Make sure all reads of the slot's descriptors are ordered before the arrival
+        asm volatile ("fence.acq_rel.gpu;\n");
+        uint32_t prior = atomicAdd(arrivals, 1u);
+        if (prior + 1 == expected_arrivals) {
+          // Last consumer of the slot: reset it and hand it back to the producer
+          *arrivals = 0;
+          asm volatile ("fence.acq_rel.gpu;\n");
+          atomicAdd(scheduler_params.queue_tail_, 1u);
+        }
+      }
+      ++retired_problems_;
+    }
+#endif
+  }
+
+  // Blocks until the given problem has been published. Returns false if the queue
+  // was closed without publishing it. Every warp observes the same outcome for a given
+  // problem since head only grows and the closed bit is published together with the final count.
+  CUTLASS_DEVICE
+  bool
+  wait_for_problem(uint32_t problem_idx) {
+#if defined(__CUDA_ARCH__)
+    #pragma unroll 1
+    while (problem_idx >= published_problems_) {
+      uint32_t head = 0;
+      asm volatile ("ld.global.acquire.gpu.b32 %0, [%1];\n" : "=r"(head) : "l"(scheduler_params.queue_head_));
+      published_problems_ = head & ~GroupProblemQueue::kClosed;
+      if (problem_idx < published_problems_) {
+        break;
+      }
+      if (head & GroupProblemQueue::kClosed) {
+        return false;
+      }
+      __nanosleep(40);
+    }
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  CUTLASS_DEVICE
+  cute::tuple<uint64_t, uint64_t>
+  get_problem_blocks_mn(uint32_t problem_idx) const {
+    auto problem_shape = scheduler_params.problem_shapes_[get_slot(problem_idx)];
+    uint64_t ctas_along_m, ctas_along_n;
+    if (is_tuple<decltype(cute::shape<0>(problem_shape))>::value ||
+        is_tuple<decltype(cute::shape<1>(problem_shape))>::value) {
+      ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape), scheduler_params.cta_shape_.m()));
+      ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape), scheduler_params.cta_shape_.n()));
+    }
+    else {
+      ctas_along_m = scheduler_params.divmod_cta_shape_m_.divide(cute::shape<0>(problem_shape) +  scheduler_params.divmod_cta_shape_m_.divisor - 1);
+      ctas_along_n = scheduler_params.divmod_cta_shape_n_.divide(cute::shape<1>(problem_shape) +  scheduler_params.divmod_cta_shape_n_.divisor - 1);
+    }
+    auto problem_blocks_m = round_up(ctas_along_m, (1 << scheduler_params.log_swizzle_size_) * scheduler_params.cluster_shape_.m());
+    auto problem_blocks_n = round_up(ctas_along_n, (1 << scheduler_params.log_swizzle_size_) * scheduler_params.cluster_shape_.n());
+    return cute::make_tuple(static_cast<uint64_t>(problem_blocks_m), static_cast<uint64_t>(problem_blocks_n));
+  }
+
+  CUTLASS_DEVICE
+  uint64_t
+  get_problem_tile_count(uint32_t problem_idx) const {
+    auto [problem_blocks_m, problem_blocks_n] = get_problem_blocks_mn(problem_idx);
+    return problem_blocks_m * problem_blocks_n;
+  }
+};
+
+} // namespace cutlass::gemm::kernel::detail
@@ -0,0 +1,696 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler for Grouped GEMMs using a stream-K decomposition over the
+           concatenated tile space of all groups.
+
+    Output tiles of all groups are linearized group after group. The leading tiles are split into
+    stream-K units covering an equal number of K tile iterations each (one unit per CTA), so that the
+    tail wave left over after the data-parallel waves is spread evenly across all SMs. Since groups may
+    have different K extents, the stream-K iteration space is the concatenation of the K tiles of each
+    stream-K output tile. The remaining tiles are computed in data-parallel fashion after the stream-K work.
+
+    Host-side problem shapes are required to build the decomposition; without them the scheduler
+    falls back to a data-parallel decomposition, unless the groups are ragged along K only (see
+    Arguments::ragged_k_m), in which case the K tiles of the stream-K work are counted on device.
+*/
+
+#include "cutlass/barrier.h"
+#include "cutlass/block_striped.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm_coord.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler leveraging stream-K decomposition across groups
+template <
+  class GroupProblemShape,
+  class TileShape,
+  class ClusterShape
+>
+class PersistentTileSchedulerSm90GroupStreamK {
+  static_assert(cute::size(ClusterShape{}) == 1,
+    "Grouped stream-K scheduler currently only supports 1x1x1 cluster shapes.");
+
+public:
+  using ProblemShape = typename GroupProblemShape::UnderlyingProblemShape;
+  using Params = PersistentTileSchedulerSm90GroupStreamKParams<ProblemShape>;
+  using RasterOrder = typename Params::RasterOrder;
+  using RasterOrderOptions = typename Params::RasterOrderOptions;
+  using DecompositionMode = typename Params::DecompositionMode;
+  static constexpr bool IsDynamicPersistent = false;
+
+  // Use a dummy barrier manager to simply get the type used to store the barrier
+  using BarrierType = typename NamedBarrierManager<1>::T;
+
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    int32_t K_idx = 0;
+    int32_t L_idx = 0;
+
+    // Number of k tiles to compute for this unit of work
+    uint32_t k_tile_count = 0;
+
+    // Number of k tiles of the output tile as a whole
+    uint32_t k_tiles_per_output_tile = 0;
+
+    // Linearized index of the output tile across all groups
+    uint64_t tile_idx = 0;
+
+    bool is_valid_tile = false;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return is_valid_tile;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, -1, 0, 0, 0, false};
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_final_split(uint32_t k_tiles_per_output_tile) const {
+      return (K_idx + k_tile_count) == k_tiles_per_output_tile;
+    }
+
+    CUTLASS_HOST_DEVICE
+    int32_t
+    reduction_subtile_idx() const {
+      return -1;
+    }
+  };
+
+  struct Arguments {
+    // Swizzling is not supported by this scheduler
+    static constexpr int max_swizzle_size = 1;
+    // Not applying Heuristics for Grouped problems, since largest dimension can change per group
+    RasterOrderOptions raster_order = RasterOrderOptions::AlongM;
+    DecompositionMode decomposition_mode = DecompositionMode::Heuristic;
+    // Ragged-K groups (e.g. the expert weight gradients of a MoE layer) share M and N, while their K
+    // extents are only known on device. Passing the shared extents lets the decomposition be formed
+    // without host problem shapes: the host splits by tile count, and the stream-K units sum the K tiles
+    // of the stream-K tiles on device. The group count must then be exact (no device_num_groups).
+    // Stream-K units skip the tiles of groups with an empty K, leaving their D untouched as an
+    // accumulation with beta = 1 into D would; clear them beforehand otherwise.
+    int ragged_k_m = 0;
+    int ragged_k_n = 0;
+  };
+
+  // Sink scheduler params as a member
+  Params scheduler_params;
+
+private:
+  // Position of a group in the linearized tile and stream-K iteration spaces
+  struct GroupCursor {
+    int32_t group_idx = 0;
+    uint64_t tile_start = 0;
+    uint64_t iter_start = 0;
+    uint64_t ctas_m = 0;
+    uint64_t ctas_n = 0;
+    uint64_t k_tiles = 0;
+
+    CUTLASS_HOST_DEVICE
+    uint64_t tiles() const { return ctas_m * ctas_n; }
+
+    CUTLASS_HOST_DEVICE
+    uint64_t iters() const { return tiles() * k_tiles; }
+  };
+
+  uint64_t current_work_linear_idx_ = 0;
+  uint64_t total_grid_size_ = 0;
+
+  // Remaining stream-K iterations [unit_iter_begin_, unit_iter_end_) of this CTA. Tiles are
+  // consumed from the end of the range, see PersistentTileSchedulerSm90StreamK for the rationale.
+  uint64_t unit_iter_begin_ = 0;
+  uint64_t unit_iter_end_ = 0;
+
+  GroupCursor cursor_;
+
+public:
+
+  //
+  // Methods
+  //
+
+  // Decomposition computed on the host from the host-side problem shapes
+  struct Decomposition {
+    uint32_t grid_size = 0;
+    uint64_t total_tiles = 0;
+    uint64_t sk_tiles = 0;
+    uint32_t sk_units = 0;
+    uint64_t sk_iters = 0;
+  };
+
+  static Decomposition
+  get_decomposition(GroupProblemShape problem_shapes, KernelHardwareInfo const& hw_info, Arguments const& args) {
+    Decomposition decomposition;
+    // Workspace sizing and parameter construction must agree on the decomposition, so only the
+    // SM count (queried if not provided) determines the number of CTAs
+    int sm_count = hw_info.sm_count;
+    if (sm_count <= 0) {
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+    uint32_t const device_ctas = static_cast<uint32_t>(sm_count);
+
+    bool const host_problem_shapes = problem_shapes.is_host_problem_shape_available();
+    if (host_problem_shapes) {
+      for (int32_t group = 0; group < problem_shapes.groups(); ++group) {
+        decomposition.total_tiles += get_host_group_cursor(problem_shapes.get_host_problem_shape(group)).tiles();
+      }
+    }
+    else if (args.ragged_k_m > 0 && args.ragged_k_n > 0 && problem_shapes.device_num_groups == nullptr) {
+      // Every group has the same tiles, only their K extents differ
+      auto cursor = get_host_group_cursor(ProblemShape{args.ragged_k_m, args.ragged_k_n, 1});
+      decomposition.total_tiles = cursor.tiles() * static_cast<uint64_t>(problem_shapes.groups());
+    }
+    else {
+      CUTLASS_TRACE_HOST("  WARNING: Grouped stream-K requires host problem shapes. Falling back to data-parallel decomposition.\n");
+      decomposition.grid_size = device_ctas;
+      return decomposition;
+    }
+
+    uint64_t total_tiles = decomposition.total_tiles;
+    uint64_t sk_tiles = 0;
+    if (args.decomposition_mode == DecompositionMode::StreamK) {
+      sk_tiles = total_tiles;
+    }
+    else if (args.decomposition_mode == DecompositionMode::Heuristic) {
+      // Tiles of the partial final wave are computed via stream-K. When there are enough full waves,
+      // one of them is added to the stream-K work to avoid very short stream-K units.
+      sk_tiles = total_tiles % device_ctas;
+      if (sk_tiles != 0 && total_tiles >= 2 * device_ctas) {
+        sk_tiles += device_ctas;
+      }
+    }
+
+    if (sk_tiles == 0) {
+      decomposition.grid_size = static_cast<uint32_t>(
+        cute::max(uint64_t(1), cute::min(static_cast<uint64_t>(device_ctas), total_tiles)));
+      return decomposition;
+    }
+
+    // Count the K tile iterations of the stream-K tiles. Ragged-K decompositions leave sk_iters at zero
+    // for the stream-K units to count on device.
+    uint64_t remaining_sk_tiles = host_problem_shapes ? sk_tiles : 0;
+    for (int32_t group = 0; group < problem_shapes.groups() && remaining_sk_tiles > 0; ++group) {
+      auto cursor = get_host_group_cursor(problem_shapes.get_host_problem_shape(group));
+      uint64_t group_sk_tiles = cute::min(cursor.tiles(), remaining_sk_tiles);
+      decomposition.sk_iters += group_sk_tiles * cursor.k_tiles;
+      remaining_sk_tiles -= group_sk_tiles;
+    }
+
+    decomposition.grid_size = device_ctas;
+    decomposition.sk_tiles = sk_tiles;
+    decomposition.sk_units = device_ctas;
+    return decomposition;
+  }
+
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    void* workspace=nullptr,
+    [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+    [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u
+    ) {
+
+    // We only need the tile and cluster shape during scheduler setup, so let FTAD do the magic
+    static_assert(cute::is_static<TileShape>::value);
+    static_assert(cute::is_static<ClusterShape>::value);
+
+    auto decomposition = get_decomposition(problem_shapes, hw_info, arguments);
+
+    Params params;
+    params.raster_order_ = arguments.raster_order == RasterOrderOptions::AlongN ? RasterOrder::AlongN : RasterOrder::AlongM;
+    params.groups_ = problem_shapes.groups();
+    params.problem_shapes_ = problem_shapes.problem_shapes;
+    params.device_groups_ = problem_shapes.device_num_groups;
+    params.cta_shape_ = to_gemm_coord(tile_shape);
+    params.grid_size_ = decomposition.grid_size;
+    params.total_tiles_ = decomposition.total_tiles;
+    params.sk_tiles_ = decomposition.sk_tiles;
+    params.sk_units_ = decomposition.sk_units;
+    params.sk_iters_ = decomposition.sk_iters;
+    params.reduction_workspace_ = workspace;
+
+    CUTLASS_TRACE_HOST("to_underlying_arguments(): Grouped stream-K with " << params.sk_tiles_ << " of "
+      << params.total_tiles_ << " tiles split into " << params.sk_units_ << " stream-K units");
+
+    return params;
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+    Params const& params,
+    [[maybe_unused]] GroupProblemShape problem_shapes,
+    [[maybe_unused]] TileShape tile_shape,
+    [[maybe_unused]] ClusterShape cluster_shape,
+    KernelHardwareInfo hw_info,
+    [[maybe_unused]] Arguments arguments,
+    [[maybe_unused]] bool truncate_by_problem_size=true) {
+
+    uint32_t grid_size = params.grid_size_ > 0 ? params.grid_size_ : static_cast<uint32_t>(hw_info.sm_count);
+    return dim3(grid_size, 1, 1);
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    return args.decomposition_mode != DecompositionMode::SplitK;
+  }
+
+  PersistentTileSchedulerSm90GroupStreamK() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90GroupStreamK(Params const& params_) : scheduler_params(params_) {
+    // MSVC requires protecting use of CUDA-specific nonstandard syntax,
+    // like blockIdx and gridDim, with __CUDA_ARCH__.
+#if defined(__CUDA_ARCH__)
+    current_work_linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+
+    if (scheduler_params.sk_units_ > 0 && scheduler_params.sk_iters_ == 0) {
+      scheduler_params.sk_iters_ = get_device_sk_iters();
+    }
+
+    if (current_work_linear_idx_ < scheduler_params.sk_units_) {
+      // Big units computing one extra iteration precede the others
+      uint64_t iters_per_unit = scheduler_params.sk_iters_ / scheduler_params.sk_units_;
+      uint64_t big_units = scheduler_params.sk_iters_ % scheduler_params.sk_units_;
+      unit_iter_begin_ = current_work_linear_idx_ * iters_per_unit + cute::min(current_work_linear_idx_, big_units);
+      unit_iter_end_ = unit_iter_begin_ + iters_per_unit + (current_work_linear_idx_ < big_units ? 1 : 0);
+    }
+
+    // The group count may have been produced on device, in which case groups_ is only an upper bound.
+    // Stream-K units are never formed in that case, since the decomposition requires host problem shapes.
+    if (scheduler_params.device_groups_ != nullptr) {
+      scheduler_params.groups_ = cute::min(*scheduler_params.device_groups_, scheduler_params.groups_);
+    }
+    if (scheduler_params.groups_ <= 0) {
+      return;
+    }
+
+    load_group(cursor_, 0);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() {
+    if (current_work_linear_idx_ < scheduler_params.sk_units_) {
+      if (unit_iter_end_ > unit_iter_begin_) {
+        return assign_stream_k_work();
+      }
+      // This stream-K unit has no iterations, move on to data-parallel work
+      advance_to_next_work();
+    }
+
+    uint64_t tile_idx = scheduler_params.sk_tiles_ + (current_work_linear_idx_ - scheduler_params.sk_units_);
+    if (tile_idx >= scheduler_params.total_tiles_ && scheduler_params.total_tiles_ > 0) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+    if (scheduler_params.groups_ <= 0) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    if (tile_idx < cursor_.tile_start) {
+      // Stream-K work may have left the cursor past the first data-parallel tile
+      cursor_ = GroupCursor{};
+      load_group(cursor_, 0);
+    }
+    while (tile_idx >= cursor_.tile_start + cursor_.tiles()) {
+      if (cursor_.group_idx + 1 >= scheduler_params.groups_) {
+        // Only reachable without host problem shapes, where the total tile count is unknown
+        return WorkTileInfo::invalid_work_tile();
+      }
+      advance_group(cursor_);
+    }
+
+    WorkTileInfo work_tile_info = make_work_tile_info(tile_idx - cursor_.tile_start);
+    work_tile_info.K_idx = 0;
+    work_tile_info.k_tile_count = static_cast<uint32_t>(cursor_.k_tiles);
+    work_tile_info.k_tiles_per_output_tile = static_cast<uint32_t>(cursor_.k_tiles);
+    return work_tile_info;
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
+  }
+
+  // Returns whether the current stream-K unit has further output tiles to compute. If so,
+  // work_tile_info is updated to the next (preceding) output tile covered by the unit.
+  CUTLASS_DEVICE
+  bool
+  continue_current_work(WorkTileInfo& work_tile_info) {
+    if (current_work_linear_idx_ < scheduler_params.sk_units_ && unit_iter_end_ > unit_iter_begin_) {
+      work_tile_info = assign_stream_k_work();
+      return true;
+    }
+    return false;
+  }
+
+  // Returns whether fixup is needed for `work_tile_info`.
+  CUTLASS_HOST_DEVICE
+  static bool
+  requires_fixup(Params const& params, WorkTileInfo const& work_tile_info) {
+    // Fixup is not needed for invalid or data-parallel tiles
+    return work_tile_info.is_valid() && work_tile_info.k_tile_count != work_tile_info.k_tiles_per_output_tile;
+  }
+
+  // Returns whether the block assigned this work should compute the epilogue for the corresponding
+  // output tile. Only the unit computing the final split of a tile does so.
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info, Params const&) {
+    return work_tile_info.is_valid() && work_tile_info.is_final_split(work_tile_info.k_tiles_per_output_tile);
+  }
+
+  // Performs the reduction across splits for a given output tile. Reductions are always
+  // performed in a turnstile fashion in order of the K extent, and are thus deterministic.
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    FrgTensorC& accumulators,
+    uint32_t num_barriers,
+    uint32_t barrier_idx) {
+    static constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
+    static constexpr uint32_t MaxNumNamedBarriers = 2;
+    using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, MaxNumNamedBarriers>;
+    using ElementAccumulator = typename FrgTensorC::value_type;
+
+    if (!requires_fixup(params, work_tile_info)) {
+      return;
+    }
+
+    // Stream-K tiles are the leading tiles, so the tile index directly indexes the workspace
+    uint64_t tile_idx = work_tile_info.tile_idx;
+
+    // Index of the lock on which to wait
+    uint64_t lock_idx = (tile_idx * num_barriers) + barrier_idx;
+
+    // Reductions use BlockStripedReduce with a width of BarrierManager::ThreadCount under the hood.
+    // Thus, the start of the reduction space is the same across all threads in a warp group.
+    uint64_t reduction_offset =
+      (static_cast<uint64_t>(cute::size<0>(TileShape{})) * static_cast<uint64_t>(cute::size<1>(TileShape{})) * tile_idx) +
+      (static_cast<uint64_t>(size(accumulators)) * barrier_idx * BarrierManager::ThreadCount);
+
+    ElementAccumulator* group_reduction_workspace = reinterpret_cast<ElementAccumulator*>(params.reduction_workspace_) + reduction_offset;
+
+    using AccumulatorArrayT = Array<typename FrgTensorC::value_type, size(FrgTensorC{})>;
+    using BlockStripedReduceT = BlockStripedReduce<BarrierManager::ThreadCount, AccumulatorArrayT>;
+
+    AccumulatorArrayT* reduction_workspace_array = reinterpret_cast<AccumulatorArrayT*>(group_reduction_workspace);
+    AccumulatorArrayT* accumulator_array = reinterpret_cast<AccumulatorArrayT*>(accumulators.data());
+
+    uint32_t barrier_group_thread_idx = threadIdx.x % BarrierManager::ThreadCount;
+
+    size_t reduction_workspace_size = Params::get_reduction_workspace_size(
+      params.sk_tiles_, to_gemm_coord(TileShape{}), sizeof_bits<ElementAccumulator>::value);
+    BarrierType* lock_workspace = reinterpret_cast<BarrierType*>(
+      reinterpret_cast<uint8_t*>(params.reduction_workspace_) + reduction_workspace_size);
+
+    if (!compute_epilogue(work_tile_info, params)) {
+      if (work_tile_info.K_idx == 0) {
+        // The first peer initializes the workspace partials
+        BlockStripedReduceT::store(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      }
+      else {
+        // Wait until the preceding split added its accumulators
+        BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+
+        // Perform reduction in workspace
+        BlockStripedReduceT::reduce(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      }
+
+      // Signal our arrival
+      BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.k_tile_count);
+    }
+    else {
+      // Wait until the preceding split added its accumulators
+      BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+
+      // The block computing the final split for the tile adds previously-reduced partials
+      // to its accumulators and computes the epilogue.
+      BlockStripedReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+    }
+  }
+
+  template <class ProblemShape_, class ElementAccumulator>
+  static size_t
+  get_workspace_size(
+    Arguments const& args,
+    ProblemShape_ problem_shapes,
+    KernelHardwareInfo const& hw_info,
+    uint32_t mma_warp_groups,
+    [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+    [[maybe_unused]] uint32_t num_accumulator_mtxs = 1) {
+
+    static_assert(cute::is_same_v<ProblemShape_, GroupProblemShape>,
+      "Grouped stream-K workspace is sized from the grouped problem shape.");
+
+    auto decomposition = get_decomposition(problem_shapes, hw_info, args);
+    if (decomposition.sk_tiles == 0) {
+      return 0;
+    }
+
+    return Params::get_reduction_workspace_size(
+             decomposition.sk_tiles, to_gemm_coord(TileShape{}), sizeof_bits<ElementAccumulator>::value) +
+           Params::get_barrier_workspace_size(
+             decomposition.sk_tiles, mma_warp_groups, sizeof_bits<BarrierType>::value);
+  }
+
+  template <class ProblemShape_, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(
+    Arguments const& args,
+    void* workspace,
+    cudaStream_t stream,
+    ProblemShape_ const& problem_shapes,
+    KernelHardwareInfo const& hw_info,
+    uint32_t mma_warp_groups,
+    [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+    [[maybe_unused]] uint32_t num_accumulator_mtxs = 1,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    static_assert(cute::is_same_v<ProblemShape_, GroupProblemShape>,
+      "Grouped stream-K workspace is sized from the grouped problem shape.");
+
+#if !defined(__CUDACC_RTC__)
+    auto decomposition = get_decomposition(problem_shapes, hw_info, args);
+    if (decomposition.sk_tiles == 0) {
+      return Status::kSuccess;
+    }
+
+    if (workspace == nullptr) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    // Only the barrier workspace needs to be cleared. Barrier workspace follows reduction workspace.
+    size_t reduction_workspace_size = Params::get_reduction_workspace_size(
+      decomposition.sk_tiles, to_gemm_coord(TileShape{}), sizeof_bits<ElementAccumulator>::value);
+    size_t barrier_workspace_size = Params::get_barrier_workspace_size(
+      decomposition.sk_tiles, mma_warp_groups, sizeof_bits<BarrierType>::value);
+    uint8_t* barrier_workspace = reinterpret_cast<uint8_t*>(workspace) + reduction_workspace_size;
+    return zero_workspace(static_cast<void*>(barrier_workspace), barrier_workspace_size, stream, cuda_adapter);
+#else
+    return Status::kSuccess;
+#endif
+  }
+
+  template <class ProblemShape_MNKL>
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape_MNKL, TileShape) {
+    return work_tile_info.k_tile_count;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    return work_tile_info.K_idx;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const& work_tile_info) {
+    return true;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  requires_separate_reduction(Params const& params) {
+    return false;
+  }
+
+  // Kernel helper function to get next work tile
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    if (continue_current_work(work_tile_info)) {
+      return cute::make_tuple(work_tile_info, true);
+    }
+
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  // Returns the initial work tile info that will be computed over
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+private:
+
+  static GroupCursor
+  get_host_group_cursor(ProblemShape problem_shape) {
+    GroupCursor cursor;
+    auto problem_shape_mnkl = cute::append<4>(problem_shape, 1);
+    cursor.ctas_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape_mnkl), cute::shape<0>(TileShape{})));
+    cursor.ctas_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape_mnkl), cute::shape<1>(TileShape{})));
+    cursor.k_tiles = cute::size(cute::ceil_div(cute::shape<2>(problem_shape_mnkl), cute::shape<2>(TileShape{})));
+    return cursor;
+  }
+
+  CUTLASS_DEVICE
+  void
+  load_group(GroupCursor& cursor, int32_t group_idx) const {
+    auto problem_shape_mnkl = cute::append<4>(scheduler_params.problem_shapes_[group_idx], 1);
+    cursor.group_idx = group_idx;
+    cursor.ctas_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape_mnkl), cute::shape<0>(TileShape{})));
+    cursor.ctas_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape_mnkl), cute::shape<1>(TileShape{})));
+    cursor.k_tiles = cute::size(cute::ceil_div(cute::shape<2>(problem_shape_mnkl), cute::shape<2>(TileShape{})));
+  }
+
+  // K tile iterations of the stream-K tiles of a ragged-K decomposition, whose K extents are only
+  // known on device. Every CTA reads the problem shapes of the groups covering the stream-K tiles.
+  CUTLASS_DEVICE
+  uint64_t
+  get_device_sk_iters() const {
+    uint64_t sk_iters = 0;
+    uint64_t remaining_sk_tiles = scheduler_params.sk_tiles_;
+    GroupCursor cursor;
+    for (int32_t group = 0; group < scheduler_params.groups_ && remaining_sk_tiles > 0; ++group) {
+      load_group(cursor, group);
+      uint64_t group_sk_tiles = cute::min(cursor.tiles(), remaining_sk_tiles);
+      sk_iters += group_sk_tiles * cursor.k_tiles;
+      remaining_sk_tiles -= group_sk_tiles;
+    }
+    return sk_iters;
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_group(GroupCursor& cursor) const {
+    cursor.tile_start += cursor.tiles();
+    cursor.iter_start += cursor.iters();
+    load_group(cursor, cursor.group_idx + 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  retreat_group(GroupCursor& cursor) const {
+    load_group(cursor, cursor.group_idx - 1);
+    cursor.tile_start -= cursor.tiles();
+    cursor.iter_start -= cursor.iters();
+  }
+
+  // Assigns the output tile covering the last remaining iteration of the stream-K unit
+  CUTLASS_DEVICE
+  WorkTileInfo
+  assign_stream_k_work() {
+    uint64_t iter = unit_iter_end_ - 1;
+
+    while (iter < cursor_.iter_start) {
+      retreat_group(cursor_);
+    }
+    while (iter >= cursor_.iter_start + cursor_.iters()) {
+      advance_group(cursor_);
+    }
+
+    uint64_t tile_in_group = (iter - cursor_.iter_start) / cursor_.k_tiles;
+    uint64_t tile_iter_start = cursor_.iter_start + tile_in_group * cursor_.k_tiles;
+    uint64_t split_iter_start = cute::max(tile_iter_start, unit_iter_begin_);
+
+    WorkTileInfo work_tile_info = make_work_tile_info(tile_in_group);
+    work_tile_info.K_idx = static_cast<int32_t>(split_iter_start - tile_iter_start);
+    work_tile_info.k_tile_count = static_cast<uint32_t>(unit_iter_end_ - split_iter_start);
+    work_tile_info.k_tiles_per_output_tile = static_cast<uint32_t>(cursor_.k_tiles);
+
+    unit_iter_end_ = split_iter_start;
+    return work_tile_info;
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  make_work_tile_info(uint64_t tile_in_group) const {
+    WorkTileInfo work_tile_info;
+    if (scheduler_params.raster_order_ == RasterOrder::AlongN) {
+      work_tile_info.M_idx = static_cast<int32_t>(tile_in_group / cursor_.ctas_n);
+      work_tile_info.N_idx = static_cast<int32_t>(tile_in_group % cursor_.ctas_n);
+    }
+    else {
+      work_tile_info.M_idx = static_cast<int32_t>(tile_in_group % cursor_.ctas_m);
+      work_tile_info.N_idx = static_cast<int32_t>(tile_in_group / cursor_.ctas_m);
+    }
+    work_tile_info.L_idx = cursor_.group_idx;
+    work_tile_info.tile_idx = cursor_.tile_start + tile_in_group;
+    work_tile_info.is_valid_tile = true;
+    return work_tile_info;
+  }
+};
+
+} // namespace cutlass::gemm::kernel::detail
@@ -0,0 +1,308 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler ordering output tiles by decreasing cost.
+
+    The static persistent schedulers give every CTA the same number of output tiles. When the cost
+    of a tile depends on its position, as for causal attention or for a triangular operand where the
+    mainloop skips the K blocks outside the triangle, the CTAs that draw the expensive tiles finish
+    long after the others. This scheduler visits tiles in decreasing cost order instead:
+
+      - TileCost::IncreasingM / DecreasingM / IncreasingN / DecreasingN declare that the cost of a
+        tile grows linearly along one of the tile coordinates. Uniform keeps all tiles equal.
+      - Arguments::tile_order overrides the cost model with a device array holding the tile indices
+        (m * tiles_n + n) of one batch sorted by decreasing cost. sort_tiles_by_cost() builds it from
+        an arbitrary host cost function.
+
+    With WorkOrder::LongestFirst wave w of the grid takes ranks [w * grid, (w + 1) * grid) in
+    order, so the heaviest tiles run first and the cheap ones fill in the tail. WorkOrder::Paired
+    reverses every odd wave so that the CTA drawing the heaviest tile of one wave draws the lightest
+    tile of the next, which evens out the per-CTA sums of a static schedule.
+
+    The cluster shape must be 1x1x1.
+*/
+
+#include <algorithm>
+#include <numeric>
+
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+class PersistentTileSchedulerSm90LoadBalanced : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+public:
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using WorkTileInfo = BaseScheduler::WorkTileInfo;
+
+  static constexpr bool IsDynamicPersistent = false;
+
+  enum class TileCost {
+    Uniform,
+    IncreasingM,
+    DecreasingM,
+    IncreasingN,
+    DecreasingN
+  };
+
+  enum class WorkOrder {
+    LongestFirst,
+    Paired
+  };
+
+  struct Arguments : BaseScheduler::Arguments {
+    TileCost cost = TileCost::Uniform;
+    WorkOrder order = WorkOrder::Paired;
+    // Optional tile indices of one batch in decreasing cost order. Overrides cost when set.
+    int32_t const* tile_order = nullptr;
+  };
+
+  struct Params : BaseScheduler::Params {
+    TileCost cost_ = TileCost::Uniform;
+    WorkOrder order_ = WorkOrder::Paired;
+    int32_t const* tile_order_ = nullptr;
+    // Divides a cost rank into (band, tile within the band) and a band into (batch, tile)
+    FastDivmodU64 divmod_cost_band_{};
+    FastDivmodU64 divmod_band_tiles_{};
+    FastDivmodU64 divmod_batch_count_{};
+    FastDivmodU64 divmod_tiles_n_{};
+    uint32_t cost_bands_ = 0;
+  };
+
+  // Sorts the tiles of one tiles_m x tiles_n batch by decreasing cost(m, n), breaking ties by
+  // tile index, and writes their indices m * tiles_n + n to tile_order.
+  template <class CostFn>
+  static void
+  sort_tiles_by_cost(int tiles_m, int tiles_n, CostFn cost, int32_t* tile_order) {
+    int32_t tiles = tiles_m * tiles_n;
+    std::iota(tile_order, tile_order + tiles, 0);
+    std::stable_sort(tile_order, tile_order + tiles, [&](int32_t a, int32_t b) {
+      return cost(a / tiles_n, a % tiles_n) > cost(b / tiles_n, b % tiles_n);
+    });
+  }
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace=nullptr,
+      const uint32_t epilogue_subtile = 1,
+      uint32_t ktile_start_alignment_count = 1u) {
+
+    // Swizzling would pad the tile grid; every tile index must map to a real tile here
+    typename BaseScheduler::Arguments base_arguments = arguments;
+    base_arguments.max_swizzle_size = 1;
+
+    Params params;
+    static_cast<typename BaseScheduler::Params&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shape_mnkl, tile_shape, cluster_shape, hw_info, base_arguments, workspace, epilogue_subtile,
+      ktile_start_alignment_count);
+
+    uint64_t tiles_m = params.problem_tiles_m_;
+    uint64_t tiles_n = params.problem_tiles_n_;
+    uint64_t tiles_l = params.problem_tiles_l_;
+    bool cost_along_n = arguments.cost == TileCost::IncreasingN || arguments.cost == TileCost::DecreasingN;
+    uint64_t bands = cost_along_n ? tiles_n : tiles_m;
+    uint64_t band_tiles = cost_along_n ? tiles_m : tiles_n;
+
+    params.cost_ = arguments.cost;
+    params.order_ = arguments.order;
+    params.tile_order_ = arguments.tile_order;
+    params.divmod_cost_band_ = FastDivmodU64(band_tiles * tiles_l);
+    params.divmod_band_tiles_ = FastDivmodU64(band_tiles);
+    params.divmod_batch_count_ = FastDivmodU64(tiles_l);
+    params.divmod_tiles_n_ = FastDivmodU64(tiles_n);
+    params.cost_bands_ = static_cast<uint32_t>(bands);
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    if (args.traversal != BaseScheduler::TileTraversal::Raster || args.spatial_tiles_per_plane != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Load-balanced tile scheduler does not support super-tiling or spatial blocking.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args);
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape>
+  static dim3
+  get_grid_shape(
+      [[maybe_unused]] Params const& params,
+      ProblemShapeMNKL problem_shape_mnk,
+      BlockShape cta_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo hw_info,
+      [[maybe_unused]] Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size=true) {
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape_mnk, cute::Int<1>{});
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, cta_shape, cluster_shape);
+    uint64_t blocks = uint64_t(problem_blocks.x) * problem_blocks.y * problem_blocks.z;
+
+    int sm_count = hw_info.sm_count > 0 ?
+      hw_info.sm_count : KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+    return dim3(static_cast<uint32_t>(cute::min(blocks, static_cast<uint64_t>(sm_count))), 1, 1);
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90LoadBalanced() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90LoadBalanced(Params const& params_)
+    : BaseScheduler(params_)
+    , cost_(params_.cost_)
+    , order_(params_.order_)
+    , tile_order_(params_.tile_order_)
+    , divmod_cost_band_(params_.divmod_cost_band_)
+    , divmod_band_tiles_(params_.divmod_band_tiles_)
+    , divmod_batch_count_(params_.divmod_batch_count_)
+    , divmod_tiles_n_(params_.divmod_tiles_n_)
+    , cost_bands_(params_.cost_bands_) {
+#if defined(__CUDA_ARCH__)
+    linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    uint64_t tiles = scheduler_params.blocks_per_problem_;
+    if (linear_idx >= tiles) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    // Rank of the tile in decreasing cost order. Paired order mirrors every odd wave within the
+    // tiles that wave actually covers, so a partial last wave stays a permutation.
+    uint64_t wave = linear_idx / grid_size_;
+    uint64_t wave_start = wave * grid_size_;
+    uint64_t rank = linear_idx;
+    if (order_ == WorkOrder::Paired && (wave & 1)) {
+      uint64_t wave_width = cute::min(grid_size_, tiles - wave_start);
+      rank = wave_start + (wave_width - 1 - (linear_idx - wave_start));
+    }
+
+    uint64_t work_idx_m, work_idx_n, work_idx_l;
+    if (tile_order_ != nullptr) {
+      // Batches share the cost ranking, so consecutive ranks walk the batches of one tile
+      uint64_t tile_rank, tile;
+      divmod_batch_count_(tile_rank, work_idx_l, rank);
+      tile = static_cast<uint64_t>(tile_order_[tile_rank]);
+      divmod_tiles_n_(work_idx_m, work_idx_n, tile);
+    }
+    else {
+      uint64_t band_rank, band_remainder, band_tile;
+      divmod_cost_band_(band_rank, band_remainder, rank);
+      divmod_band_tiles_(work_idx_l, band_tile, band_remainder);
+
+      bool increasing = cost_ == TileCost::IncreasingM || cost_ == TileCost::IncreasingN;
+      uint64_t band = increasing ? cost_bands_ - 1 - band_rank : band_rank;
+      if (cost_ == TileCost::IncreasingN || cost_ == TileCost::DecreasingN) {
+        work_idx_m = band_tile;
+        work_idx_n = band;
+      }
+      else {
+        work_idx_m = band;
+        work_idx_n = band_tile;
+      }
+    }
+
+    return {static_cast<int32_t>(work_idx_m), static_cast<int32_t>(work_idx_n), static_cast<int32_t>(work_idx_l), true};
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    linear_idx_ += grid_size_ * uint64_t(advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo& work_tile_info, uint32_t advance_count = 1) const {
+    if (continue_current_work(work_tile_info)) {
+      return false;
+    }
+    return not get_current_work_for_linear_idx(linear_idx_ + (grid_size_ * uint64_t(advance_count))).is_valid();
+  }
+
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    if (continue_current_work(work_tile_info)) {
+      return cute::make_tuple(work_tile_info, true);
+    }
+
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+private:
+  TileCost cost_ = TileCost::Uniform;
+  WorkOrder order_ = WorkOrder::Paired;
+  int32_t const* tile_order_ = nullptr;
+  FastDivmodU64 divmod_cost_band_{};
+  FastDivmodU64 divmod_band_tiles_{};
+  FastDivmodU64 divmod_batch_count_{};
+  FastDivmodU64 divmod_tiles_n_{};
+  uint32_t cost_bands_ = 0;
+  uint64_t linear_idx_ = 0;
+  uint64_t grid_size_ = 0;
+};
+
+}
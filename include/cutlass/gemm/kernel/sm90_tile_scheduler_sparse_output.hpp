@@ -0,0 +1,266 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler visiting only the output tiles of a sparse output pattern.
+
+    A sampled dense-dense matmul (SDDMM) evaluates C = A * B^T only at the non-zeros of a sparsity
+    pattern. The dense schedulers would compute every output tile and let the epilogue discard most
+    of them. This scheduler instead walks a device array holding the indices (m * tiles_n + n) of the
+    tiles of one batch that contain at least one non-zero, so empty tiles cost nothing. The elements
+    of an active tile that are not in the pattern are masked by the epilogue store, see
+    Sm90SparseOutputStore.
+
+    make_active_tiles() builds the tile list on the host from a CSR or BSR pattern. Without a tile
+    list all tiles are active and the scheduler behaves like the 1D static persistent schedule.
+
+    The cluster shape must be 1x1x1.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+class PersistentTileSchedulerSm90SparseOutput : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+public:
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using WorkTileInfo = BaseScheduler::WorkTileInfo;
+
+  static constexpr bool IsDynamicPersistent = false;
+
+  struct Arguments : BaseScheduler::Arguments {
+    // Optional tile indices of one batch holding non-zeros, shared by all batches. All tiles when null.
+    int32_t const* active_tiles = nullptr;
+    int32_t active_tile_count = 0;
+  };
+
+  struct Params : BaseScheduler::Params {
+    int32_t const* active_tiles_ = nullptr;
+    uint64_t active_blocks_ = 0;
+    FastDivmodU64 divmod_batch_count_{};
+    FastDivmodU64 divmod_tiles_n_{};
+  };
+
+  // Returns the sorted indices m * tiles_n + n of the tile_m x tile_n output tiles of an M x N
+  // problem that overlap a non-zero block of a BSR pattern with block_m x block_n blocks, given by
+  // host copies of its block row offsets and block column indices. CSR patterns use 1x1 blocks.
+  static std::vector<int32_t>
+  make_active_tiles(
+      int M, int N,
+      int tile_m, int tile_n,
+      int block_m, int block_n,
+      int32_t const* block_row_offsets,
+      int32_t const* block_col_indices) {
+    int tiles_m = (M + tile_m - 1) / tile_m;
+    int tiles_n = (N + tile_n - 1) / tile_n;
+    int block_rows = (M + block_m - 1) / block_m;
+    std::vector<bool> active(static_cast<size_t>(tiles_m) * tiles_n, false);
+
+    for (int block_row = 0; block_row < block_rows; ++block_row) {
+      int tile_m_begin = block_row * block_m / tile_m;
+      int tile_m_end = std::min(tiles_m - 1, ((block_row + 1) * block_m - 1) / tile_m);
+      for (int32_t j = block_row_offsets[block_row]; j < block_row_offsets[block_row + 1]; ++j) {
+        int block_col = block_col_indices[j];
+        int tile_n_begin = block_col * block_n / tile_n;
+        int tile_n_end = std::min(tiles_n - 1, ((block_col + 1) * block_n - 1) / tile_n);
+        for (int m = tile_m_begin; m <= tile_m_end; ++m) {
+          for (int n = tile_n_begin; n <= tile_n_end; ++n) {
+            active[static_cast<size_t>(m) * tiles_n + n] = true;
+          }
+        }
+      }
+    }
+
+    std::vector<int32_t> active_tiles;
+    for (size_t tile = 0; tile < active.size(); ++tile) {
+      if (active[tile]) {
+        active_tiles.push_back(static_cast<int32_t>(tile));
+      }
+    }
+    return active_tiles;
+  }
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace=nullptr,
+      const uint32_t epilogue_subtile = 1,
+      uint32_t ktile_start_alignment_count = 1u) {
+
+    // Swizzling would pad the tile grid; every tile index must map to a real tile here
+    typename BaseScheduler::Arguments base_arguments = arguments;
+    base_arguments.max_swizzle_size = 1;
+
+    Params params;
+    static_cast<typename BaseScheduler::Params&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shape_mnkl, tile_shape, cluster_shape, hw_info, base_arguments, workspace, epilogue_subtile,
+      ktile_start_alignment_count);
+
+    uint64_t tiles_l = params.problem_tiles_l_;
+    params.active_tiles_ = arguments.active_tiles;
+    params.active_blocks_ = arguments.active_tiles != nullptr ?
+      static_cast<uint64_t>(arguments.active_tile_count) * tiles_l : params.blocks_per_problem_;
+    params.divmod_batch_count_ = FastDivmodU64(tiles_l);
+    params.divmod_tiles_n_ = FastDivmodU64(params.problem_tiles_n_);
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    if (args.traversal != BaseScheduler::TileTraversal::Raster || args.spatial_tiles_per_plane != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Sparse output tile scheduler does not support super-tiling or spatial blocking.\n");
+      return false;
+    }
+    if (args.active_tiles != nullptr && args.active_tile_count < 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Sparse output tile scheduler requires a non-negative active tile count.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args);
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape>
+  static dim3
+  get_grid_shape(
+      Params const& params,
+      ProblemShapeMNKL problem_shape_mnk,
+      BlockShape cta_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo hw_info,
+      [[maybe_unused]] Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size=true) {
+
+    int sm_count = hw_info.sm_count > 0 ?
+      hw_info.sm_count : KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+    // An empty pattern still launches one CTA, which finds no work
+    uint64_t blocks = cute::max(params.active_blocks_, uint64_t(1));
+    return dim3(static_cast<uint32_t>(cute::min(blocks, static_cast<uint64_t>(sm_count))), 1, 1);
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90SparseOutput() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90SparseOutput(Params const& params_)
+    : BaseScheduler(params_)
+    , active_tiles_(params_.active_tiles_)
+    , active_blocks_(params_.active_blocks_)
+    , divmod_batch_count_(params_.divmod_batch_count_)
+    , divmod_tiles_n_(params_.divmod_tiles_n_) {
+#if defined(__CUDA_ARCH__)
+    linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    if (linear_idx >= active_blocks_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    // Consecutive indices walk the batches of one tile, so CTAs of a wave share the pattern lookups
+    uint64_t tile_rank, work_idx_l;
+    divmod_batch_count_(tile_rank, work_idx_l, linear_idx);
+    uint64_t tile = active_tiles_ != nullptr ? static_cast<uint64_t>(active_tiles_[tile_rank]) : tile_rank;
+
+    uint64_t work_idx_m, work_idx_n;
+    divmod_tiles_n_(work_idx_m, work_idx_n, tile);
+    return {static_cast<int32_t>(work_idx_m), static_cast<int32_t>(work_idx_n), static_cast<int32_t>(work_idx_l), true};
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    linear_idx_ += grid_size_ * uint64_t(advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo& work_tile_info, uint32_t advance_count = 1) const {
+    if (continue_current_work(work_tile_info)) {
+      return false;
+    }
+    return not get_current_work_for_linear_idx(linear_idx_ + (grid_size_ * uint64_t(advance_count))).is_valid();
+  }
+
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    if (continue_current_work(work_tile_info)) {
+      return cute::make_tuple(work_tile_info, true);
+    }
+
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+private:
+  int32_t const* active_tiles_ = nullptr;
+  uint64_t active_blocks_ = 0;
+  FastDivmodU64 divmod_batch_count_{};
+  FastDivmodU64 divmod_tiles_n_{};
+  uint64_t linear_idx_ = 0;
+  uint64_t grid_size_ = 0;
+};
+
+}
@@ -74,6 +74,8 @@ public:
   using Params = PersistentTileSchedulerSm90StreamKParams;
   using ReductionMode = Params::ReductionMode;
   using DecompositionMode = Params::DecompositionMode;
+  using DecompositionCostModel = Params::DecompositionCostModel;
+  using DecompositionPlan = Params::DecompositionPlan;
 
   struct WorkTileInfo {
     int32_t M_idx = 0;
@@ -154,6 +156,9 @@ public:
       raster_order = args.raster_order;
       reduction_mode = args.reduction_mode;
       decomposition_mode = args.decomposition_mode;
+      cost_model = args.cost_model;
+      max_reduction_tiles = args.max_reduction_tiles;
+      reuse_cleared_workspace = args.reuse_cleared_workspace;
       return *this;
     }
 
@@ -165,6 +170,9 @@ public:
       raster_order = args.raster_order;
       reduction_mode = args.reduction_mode;
       decomposition_mode = args.decomposition_mode;
+      cost_model = args.cost_model;
+      max_reduction_tiles = args.max_reduction_tiles;
+      reuse_cleared_workspace = args.reuse_cleared_workspace;
       return *this;
     }
 
@@ -186,6 +194,18 @@ public:
     RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
     ReductionMode reduction_mode = ReductionMode::Deterministic;
     DecompositionMode decomposition_mode = DecompositionMode::Heuristic;
+    // Costs weighed by DecompositionMode::Heuristic (see get_decomposition_plan)
+    DecompositionCostModel cost_model{};
+    // Upper bound on the partial output tiles held in the reduction workspace by a split-K decomposition
+    // with ReductionMode::Deterministic; output tiles then reuse the slots round-robin. 0 is unbounded.
+    // Stream-K decompositions need at most two waves of partial tiles and ignore it.
+    uint32_t max_reduction_tiles = 0;
+    // The split that consumes a lock last returns it to zero, so the lock workspace is left cleared
+    // by every launch. When set, initialize_workspace skips clearing it, removing the memset from the
+    // critical path of repeated launches. The workspace must have been zeroed once (e.g. at allocation,
+    // or by a launch without this flag) for at least the current workspace size. Ignored when
+    // max_reduction_tiles bounds the workspace, whose slot locks keep their last generation.
+    bool reuse_cleared_workspace = false;
   };
 
   // Sink scheduler params as a member
@@ -214,23 +234,43 @@ public:
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cluster_shape);
     uint32_t k_tile_per_output_tile = cute::size(cute::ceil_div(cute::shape<2>(problem_shape_mnkl), cute::shape<2>(TileShape{})));
 
+    Arguments resolved_args = resolve_decomposition(args, problem_blocks, k_tile_per_output_tile, hw_info);
+
     Params params;
     params.initialize(
       problem_blocks,
       k_tile_per_output_tile,
       to_gemm_coord(cluster_shape),
       hw_info,
-      args.splits,
-      args.max_swizzle_size,
-      args.raster_order,
-      args.reduction_mode,
-      args.decomposition_mode,
+      resolved_args.splits,
+      resolved_args.max_swizzle_size,
+      resolved_args.raster_order,
+      resolved_args.reduction_mode,
+      resolved_args.decomposition_mode,
       workspace,
-      epilogue_subtile
+      epilogue_subtile,
+      resolved_args.max_reduction_tiles
     );
     return params;
   }
 
+  // Returns the decomposition to_underlying_arguments() selects for the problem together with the
+  // estimated cost of each candidate. The returned mode and splits may be copied into Arguments
+  // (or replaced) to pin the decomposition.
+  template <class ProblemShape>
+  static DecompositionPlan
+  get_decomposition_plan(
+      ProblemShape problem_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& args) {
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape, cute::Int<1>{});
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, TileShape{}, ClusterShape{});
+    uint32_t k_tile_per_output_tile = cute::size(cute::ceil_div(cute::shape<2>(problem_shape_mnkl), cute::shape<2>(TileShape{})));
+
+    return get_decomposition_plan(problem_blocks, k_tile_per_output_tile, hw_info, args);
+  }
+
   static bool
   can_implement(Arguments const& args) {
     // Split count > 1 is only valid for heuristic and split-K decomposition modes
@@ -402,6 +442,29 @@ public:
       params, work_tile_info, accumulators, num_barriers, barrier_idx);
   }
 
+  // Performs the reduction across splits for a given output tile in kernels whose consumer warp groups
+  // each compute entire output tiles (e.g., the ping-pong kernel). The partials and the lock of an output
+  // tile are thus shared by all warp groups, while the named barrier synchronizing the threads of a warp
+  // group is selected by `consumer_warp_group_idx`, since two warp groups may be in fixup concurrently.
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup_warp_group_tile(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    FrgTensorC& accumulators,
+    uint32_t consumer_warp_group_idx) {
+    static constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
+    if (consumer_warp_group_idx == 0) {
+      using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, 1>;
+      fixup_helper<FrgTensorC, BarrierManager>(params, work_tile_info, accumulators, 1, 0);
+    }
+    else {
+      using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset + 1, 1>;
+      fixup_helper<FrgTensorC, BarrierManager>(params, work_tile_info, accumulators, 1, 0);
+    }
+  }
+
   // Helper for performing the reduction across splits for a given output tile.
   template <class FrgTensorC, class BarrierManager>
   CUTLASS_DEVICE
@@ -425,6 +488,36 @@ public:
     // Index of the lock on which to wait
     uint64_t lock_idx = (tile_idx * num_barriers) + barrier_idx;
 
+    // The last wait on a lock resets it, leaving the lock workspace cleared for the next launch
+    bool last_accumulator_mtx = idx_accumulator_mtxs == (num_accumulator_mtxs - 1);
+
+    if (params.reduction_mode_ == ReductionMode::InPlace) {
+      // Partials are reduced into the destination by the epilogue of each split, so only wait until
+      // the preceding splits have completed theirs. The lock workspace is the whole workspace.
+      BarrierType* lock_workspace = reinterpret_cast<BarrierType*>(params.reduction_workspace_);
+      uint32_t barrier_group_thread_idx = threadIdx.x % BarrierManager::ThreadCount;
+      if (last_accumulator_mtx && work_tile_info.is_final_split(params.divmod_tiles_per_output_tile_.divisor)) {
+        BarrierManager::wait_eq_reset(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      }
+      else {
+        BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      }
+      return;
+    }
+
+    // When split-K tiles share a bounded number of reduction slots, tile_idx uses slot
+    // (tile_idx % reduction_slots_) in generation (tile_idx / reduction_slots_). Each generation advances
+    // the lock of the slot by the K tiles of one output tile, so the lock also orders the reuse of the slot.
+    bool bounded_reduction = params.reduction_slots_ > 0;
+    int32_t lock_base = 0;
+    if (bounded_reduction) {
+      uint64_t generation, slot;
+      params.divmod_reduction_slots_(generation, slot, tile_idx);
+      tile_idx = slot;
+      lock_idx = (slot * num_barriers) + barrier_idx;
+      lock_base = static_cast<int32_t>(generation) * params.divmod_tiles_per_output_tile_.divisor;
+    }
+
     uint64_t reduction_tile_idx = tile_idx;
     uint64_t num_peers = 0;
     uint64_t reduction_peer_offset = 0;
@@ -466,7 +559,7 @@ public:
     // the total number of output tiles.
     uint32_t reduction_tiles = 0;
     if (params.divmod_splits_.divisor > 1) {
-      reduction_tiles = params.units_per_problem_;
+      reduction_tiles = bounded_reduction ? params.reduction_slots_ : params.units_per_problem_;
     }
     else if (
       params.requires_separate_reduction()
@@ -485,7 +578,12 @@ public:
     if (work_tile_info.is_reduction_unit()) {
       // Wait until the peers collaborating on this output tile have all written
       // their accumulators to workspace.
-      BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, num_peers);
+      if (last_accumulator_mtx && !bounded_reduction) {
+        BarrierManager::wait_eq_reset(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, num_peers);
+      }
+      else {
+        BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, num_peers);
+      }
 
       separate_reduction<FrgTensorC, BarrierManager>(accumulators, num_barriers, group_reduction_workspace, barrier_group_thread_idx, num_peers, num_accumulator_mtxs);
     }
@@ -494,6 +592,10 @@ public:
         params.requires_separate_reduction()
         || work_tile_info.K_idx == 0
         ) {
+        if (bounded_reduction) {
+          // Wait until the final split of the previous output tile in this slot has consumed its partials
+          BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, lock_base);
+        }
         // The first peer initializes the workspace partials in the non-separate-reduction case,
         // and all peers write to their own location in workspace when using separate reduction
         BlockStripedReduceT::store(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
@@ -501,7 +603,7 @@ public:
       else {
         if (params.reduction_mode_ == ReductionMode::Deterministic) {
           // Wait until the preceding split added its accumulators
-          BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+          BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, lock_base + work_tile_info.K_idx);
         }
         else {
           // Wait until the first split has stored its accumulators. Note that the first split will have
@@ -521,18 +623,86 @@ public:
       uint32_t increment = params.requires_separate_reduction() ? 1 : work_tile_info.k_tile_count;
 
       // Signal our arrival
-      if (idx_accumulator_mtxs == (num_accumulator_mtxs - 1)) {
+      if (last_accumulator_mtx) {
         BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, increment);
       }
     }
     else {
       // Wait until the preceding split added its accumulators
-      BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      if (last_accumulator_mtx && !bounded_reduction) {
+        BarrierManager::wait_eq_reset(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, lock_base + work_tile_info.K_idx);
+      }
+      else {
+        BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, lock_base + work_tile_info.K_idx);
+      }
 
       // The block computing the final split for the tile adds previously-reduced partials
       // to its accumulators and computes the epilogue.
       BlockStripedReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+
+      if (bounded_reduction && last_accumulator_mtx) {
+        // Release the slot to the next output tile that uses it
+        BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.k_tile_count);
+      }
+    }
+  }
+
+  // Signals that the epilogue of a split has reduced its partials into the destination of an output tile
+  // when using ReductionMode::InPlace, allowing the next split in K order to issue its own. The caller must
+  // ensure that the reductions issued by all threads participating in `fixup` have completed beforehand.
+  CUTLASS_DEVICE
+  static void
+  in_place_reduction_arrive(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    uint32_t num_barriers,
+    uint32_t barrier_idx) {
+    static constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
+    static constexpr uint32_t MaxNumNamedBarriers = 2;
+    using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, MaxNumNamedBarriers>;
+    in_place_reduction_arrive_helper<BarrierManager>(params, work_tile_info, num_barriers, barrier_idx);
+  }
+
+  // Counterpart of `fixup_warp_group_tile` for in-place reductions
+  CUTLASS_DEVICE
+  static void
+  in_place_reduction_arrive_warp_group_tile(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    uint32_t consumer_warp_group_idx) {
+    static constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
+    if (consumer_warp_group_idx == 0) {
+      using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, 1>;
+      in_place_reduction_arrive_helper<BarrierManager>(params, work_tile_info, 1, 0);
+    }
+    else {
+      using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset + 1, 1>;
+      in_place_reduction_arrive_helper<BarrierManager>(params, work_tile_info, 1, 0);
+    }
+  }
+
+  template <class BarrierManager>
+  CUTLASS_DEVICE
+  static void
+  in_place_reduction_arrive_helper(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    uint32_t num_barriers,
+    uint32_t barrier_idx) {
+
+    if (params.reduction_mode_ != ReductionMode::InPlace || !requires_fixup(params, work_tile_info)) {
+      return;
+    }
+    // No split waits on the final one, whose fixup has already reset the lock
+    if (work_tile_info.is_final_split(params.divmod_tiles_per_output_tile_.divisor)) {
+      return;
     }
+    uint64_t tile_idx = output_tile_index(params, work_tile_info);
+    uint64_t lock_idx = (tile_idx * num_barriers) + barrier_idx;
+
+    BarrierType* lock_workspace = reinterpret_cast<BarrierType*>(params.reduction_workspace_);
+    uint32_t barrier_group_thread_idx = threadIdx.x % BarrierManager::ThreadCount;
+    BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.k_tile_count);
   }
 
   template <class FrgTensorC, class BarrierManager>
@@ -571,6 +741,10 @@ public:
     //  1. The tile is computed in data-parallel mode
     //  2. The tile is computed in split-/stream-K mode and this work unit represents the final split of the tile
     //  3. The tile is computed in split-/stream-K mode and separate reduction is used, and this is a separate reduction unit
+    // Every split computes the epilogue when reducing in place.
+    if (params.reduction_mode_ == ReductionMode::InPlace) {
+      return work_tile_info.is_valid();
+    }
     return work_tile_info.is_valid() &&
             (work_tile_info.is_final_split(params.divmod_tiles_per_output_tile_.divisor) &&
              !params.requires_separate_reduction()) || work_tile_info.is_separate_reduction;
@@ -611,21 +785,26 @@ public:
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cluster_shape);
     uint32_t k_tile_per_output_tile = cute::size(cute::ceil_div(cute::shape<2>(problem_shape_mnkl), cute::shape<2>(TileShape{})));
 
+    Arguments resolved_args = resolve_decomposition(args, problem_blocks, k_tile_per_output_tile, hw_info);
+
     return Params::get_workspace_size(
       problem_blocks,
       k_tile_per_output_tile,
       to_gemm_coord(tile_shape),
       to_gemm_coord(cluster_shape),
       hw_info,
-      args.splits,
-      args.max_swizzle_size,
-      args.raster_order,
-      args.decomposition_mode,
-      args.reduction_mode,
+      resolved_args.splits,
+      resolved_args.max_swizzle_size,
+      resolved_args.raster_order,
+      resolved_args.decomposition_mode,
+      resolved_args.reduction_mode,
       mma_warp_groups,
       sizeof_bits<BarrierType>::value,
       sizeof_bits<ElementAccumulator>::value,
-      epilogue_subtile
+      epilogue_subtile,
+      1,
+      1,
+      resolved_args.max_reduction_tiles
     );
   }
 
@@ -650,6 +829,12 @@ public:
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cluster_shape);
     uint32_t k_tile_per_output_tile = cute::size(cute::ceil_div(cute::shape<2>(problem_shape_mnkl), cute::shape<2>(TileShape{})));
 
+    Arguments resolved_args = resolve_decomposition(args, problem_blocks, k_tile_per_output_tile, hw_info);
+
+    if (args.reuse_cleared_workspace && resolved_args.max_reduction_tiles == 0) {
+      return Status::kSuccess;
+    }
+
     return Params::initialize_workspace(
       workspace,
       stream,
@@ -658,17 +843,19 @@ public:
       to_gemm_coord(tile_shape),
       to_gemm_coord(cluster_shape),
       hw_info,
-      args.splits,
-      args.max_swizzle_size,
-      args.raster_order,
-      args.decomposition_mode,
-      args.reduction_mode,
+      resolved_args.splits,
+      resolved_args.max_swizzle_size,
+      resolved_args.raster_order,
+      resolved_args.decomposition_mode,
+      resolved_args.reduction_mode,
       mma_warp_groups,
       sizeof_bits<BarrierType>::value,
       sizeof_bits<ElementAccumulator>::value,
       epilogue_subtile,
       1,
-      cuda_adapter
+      cuda_adapter,
+      1,
+      resolved_args.max_reduction_tiles
     );
   }
 
@@ -719,6 +906,44 @@ public:
 
 private:
 
+  static DecompositionPlan
+  get_decomposition_plan(
+      dim3 problem_blocks,
+      uint32_t k_tile_per_output_tile,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& args) {
+    return Params::get_decomposition_plan(
+      problem_blocks,
+      k_tile_per_output_tile,
+      to_gemm_coord(TileShape{}),
+      to_gemm_coord(ClusterShape{}),
+      hw_info,
+      args.splits,
+      args.max_swizzle_size,
+      args.raster_order,
+      args.decomposition_mode,
+      args.cost_model
+    );
+  }
+
+  // Replaces DecompositionMode::Heuristic with the mode and split count chosen by the cost model.
+  // The params, the workspace size and the workspace initialization all resolve the same arguments,
+  // so they agree on the decomposition.
+  static Arguments
+  resolve_decomposition(
+      Arguments const& args,
+      dim3 problem_blocks,
+      uint32_t k_tile_per_output_tile,
+      KernelHardwareInfo const& hw_info) {
+    Arguments resolved_args = args;
+    if (args.decomposition_mode == DecompositionMode::Heuristic && args.splits <= 1) {
+      DecompositionPlan plan = get_decomposition_plan(problem_blocks, k_tile_per_output_tile, hw_info, args);
+      resolved_args.decomposition_mode = plan.mode;
+      resolved_args.splits = plan.splits;
+    }
+    return resolved_args;
+  }
+
   CUTLASS_DEVICE
   static uint32_t
   get_current_work_iter_start_possible_update_work_tile_k_remaining(
@@ -762,7 +987,18 @@ private:
       k_tiles_in_group - (k_tiles_per_unit_in_group * params.divmod_sk_units_per_group_.divisor));
 
     uint64_t split;
-    params.divmod_clusters_mnl_(split, cluster_linear_work_idx, cluster_linear_work_idx);
+    if (params.reduction_slots_ > 0) {
+      // With shared reduction slots the splits of an output tile are adjacent in the linearized space,
+      // so that every unit waits only on units with smaller linear indices: the preceding splits of its
+      // tile and the final split of the tile that last used its slot.
+      int cluster_tile_idx, split_idx;
+      params.divmod_splits_(cluster_tile_idx, split_idx, static_cast<int>(cluster_linear_work_idx));
+      cluster_linear_work_idx = static_cast<uint64_t>(cluster_tile_idx);
+      split = static_cast<uint64_t>(split_idx);
+    }
+    else {
+      params.divmod_clusters_mnl_(split, cluster_linear_work_idx, cluster_linear_work_idx);
+    }
 
     bool is_split_k = params.divmod_splits_.divisor > 1;
     uint64_t big_unit_cmp_lhs = is_split_k ? split : cluster_linear_work_idx;
@@ -0,0 +1,292 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler visiting only the output tiles of one triangle of C.
+
+    Rank-k updates (SYRK) write only the lower or upper triangle of a square C. This scheduler
+    enumerates the tiles (m, n) with m >= n (FillMode::kLower) or m <= n (FillMode::kUpper) and
+    never launches work for tiles strictly outside the fill mode, roughly halving the mainloop
+    work of the equivalent GEMM. Tiles on the diagonal are computed in full; the elements outside
+    the fill mode must be masked by the epilogue (see collective::DefaultEpilogueTriangular).
+
+    With Rank == 2 (SYR2K) every output tile accumulates A * B^T followed by B * A^T, so each work
+    tile spans twice the k tiles of the problem. The mainloop must be the rank-2k collective
+    (MainloopSm90TmaGmmaWarpSpecializedRank2K), which swaps the operands for the second half.
+
+    The tile shape must be square in M and N, the cluster shape must be 1x1x1 and the problem must
+    have M == N.
+
+    PersistentTileSchedulerSm90TriangularK visits every output tile but narrows its k range to the
+    k tiles holding the FillModeA triangle of a triangular A operand (TRMM, SYMM). The elements of
+    A outside the triangle must be masked by the mainloop (MainloopSm90TmaGmmaWarpSpecializedTriangularA).
+    Since the k range depends on the M coordinate, clusters must have size 1 along M.
+*/
+
+#include "cutlass/blas3_types.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <FillMode FillModeC, int Rank = 1>
+class PersistentTileSchedulerSm90Triangular : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+  static_assert(FillModeC == FillMode::kLower || FillModeC == FillMode::kUpper,
+    "Triangular tile scheduler requires FillMode::kLower or FillMode::kUpper.");
+  static_assert(Rank == 1 || Rank == 2, "Triangular tile scheduler supports rank-k and rank-2k updates.");
+
+public:
+  using Params = PersistentTileSchedulerSm90Params;
+  using RasterOrder = typename Params::RasterOrder;
+  using RasterOrderOptions = typename Params::RasterOrderOptions;
+  using Arguments = BaseScheduler::Arguments;
+  using WorkTileInfo = BaseScheduler::WorkTileInfo;
+
+  static constexpr bool IsDynamicPersistent = false;
+  static constexpr FillMode kFillMode = FillModeC;
+  static constexpr int kRank = Rank;
+
+  // Number of tiles on and below the diagonal of a tiles x tiles grid
+  CUTLASS_HOST_DEVICE
+  static uint64_t
+  triangle_tile_count(uint64_t tiles) {
+    return tiles * (tiles + 1) / 2;
+  }
+
+  // Each rank contributes the full K extent of the problem to every output tile
+  template <class ProblemShape, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape problem_shape, TileShape tile_shape) {
+    return Rank * BaseScheduler::get_work_k_tile_count(work_tile_info, problem_shape, tile_shape);
+  }
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      [[maybe_unused]] void* workspace=nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<TileShape>::value);
+    static_assert(cute::size<0>(TileShape{}) == cute::size<1>(TileShape{}),
+      "Triangular tile scheduler requires square output tiles.");
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cluster_shape);
+    uint64_t tiles_per_batch = triangle_tile_count(problem_blocks.x);
+
+    // Raster order and swizzling do not apply to the triangular enumeration
+    Params params;
+    params.initialize(
+      problem_blocks,
+      GemmCoord(1, 1, 1),
+      hw_info,
+      1,
+      RasterOrderOptions::AlongN
+    );
+    params.divmod_batch_ = FastDivmodU64(tiles_per_batch);
+    params.blocks_per_problem_ = tiles_per_batch * problem_blocks.z;
+
+    return params;
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape>
+  static dim3
+  get_grid_shape(
+      [[maybe_unused]] Params const& params,
+      ProblemShapeMNKL problem_shape_mnk,
+      BlockShape cta_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo hw_info,
+      [[maybe_unused]] Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size=true) {
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape_mnk, cute::Int<1>{});
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, cta_shape, cluster_shape);
+    uint64_t blocks = triangle_tile_count(problem_blocks.x) * problem_blocks.z;
+
+    int sm_count = hw_info.sm_count > 0 ?
+      hw_info.sm_count : KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+    return dim3(static_cast<uint32_t>(cute::min(blocks, static_cast<uint64_t>(sm_count))), 1, 1);
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90Triangular() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90Triangular(Params const& params_) : BaseScheduler(params_) {
+#if defined(__CUDA_ARCH__)
+    linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    if (linear_idx >= scheduler_params.blocks_per_problem_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    uint64_t work_idx_l, tile_idx;
+    scheduler_params.divmod_batch_(work_idx_l, tile_idx, linear_idx);
+
+    // Tiles are enumerated row by row of the triangle: row r holds r + 1 tiles. Correct the
+    // floating point estimate of the row so that r * (r + 1) / 2 <= tile_idx < (r + 1) * (r + 2) / 2.
+    uint64_t row = static_cast<uint64_t>((sqrt(8.0 * double(tile_idx) + 1.0) - 1.0) * 0.5);
+    while (triangle_tile_count(row) > tile_idx) {
+      --row;
+    }
+    while (triangle_tile_count(row + 1) <= tile_idx) {
+      ++row;
+    }
+    uint64_t col = tile_idx - triangle_tile_count(row);
+
+    int32_t work_idx_m = static_cast<int32_t>(FillModeC == FillMode::kLower ? row : col);
+    int32_t work_idx_n = static_cast<int32_t>(FillModeC == FillMode::kLower ? col : row);
+
+    return {work_idx_m, work_idx_n, static_cast<int32_t>(work_idx_l), true};
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    linear_idx_ += grid_size_ * uint64_t(advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo& work_tile_info, uint32_t advance_count = 1) const {
+    if (continue_current_work(work_tile_info)) {
+      return false;
+    }
+    return not get_current_work_for_linear_idx(linear_idx_ + (grid_size_ * uint64_t(advance_count))).is_valid();
+  }
+
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    if (continue_current_work(work_tile_info)) {
+      return cute::make_tuple(work_tile_info, true);
+    }
+
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+private:
+  uint64_t linear_idx_ = 0;
+  uint64_t grid_size_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <FillMode FillModeA, class TileShape>
+class PersistentTileSchedulerSm90TriangularK : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+  static_assert(FillModeA == FillMode::kLower || FillModeA == FillMode::kUpper,
+    "Triangular-K tile scheduler requires FillMode::kLower or FillMode::kUpper.");
+  static_assert(cute::is_static<TileShape>::value);
+
+  static constexpr int TileM = cute::size<0>(TileShape{});
+  static constexpr int TileK = cute::size<2>(TileShape{});
+
+public:
+  using Params = PersistentTileSchedulerSm90Params;
+  using Arguments = BaseScheduler::Arguments;
+  using WorkTileInfo = BaseScheduler::WorkTileInfo;
+
+  static constexpr bool IsDynamicPersistent = false;
+  static constexpr FillMode kFillMode = FillModeA;
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90TriangularK() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90TriangularK(Params const& params_) : BaseScheduler(params_) { }
+
+  // Rows [m0, m0 + TileM) of a lower triangular A hold non-zeros in columns [0, m0 + TileM),
+  // those of an upper triangular A in columns [m0, K)
+  template <class ProblemShape, class BlockShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape problem_shape, BlockShape tile_shape) {
+    int k_tiles = BaseScheduler::get_work_k_tile_count(work_tile_info, problem_shape, tile_shape);
+    int k_tile_start = static_cast<int>(get_work_k_tile_start(work_tile_info));
+    if constexpr (FillModeA == FillMode::kLower) {
+      int k_tile_end = cute::ceil_div((work_tile_info.M_idx + 1) * TileM, TileK);
+      return cute::min(k_tile_end, k_tiles);
+    }
+    else {
+      return k_tiles - k_tile_start;
+    }
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    if constexpr (FillModeA == FillMode::kLower) {
+      return 0u;
+    }
+    else {
+      return static_cast<uint32_t>(work_tile_info.M_idx * TileM / TileK);
+    }
+  }
+};
+
+}
@@ -0,0 +1,223 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler skipping the padded tiles of a variable-length batched GEMM.
+
+    Batches of variable-length sequences are commonly padded to a common M (or N) so that a
+    strided-batched GEMM can process them with one dense layout. The dense schedulers then compute
+    every padded row. This scheduler takes device arrays with the valid M and/or N extent of each
+    batch and skips the clusters whose tiles lie entirely outside the valid extent of their batch,
+    so the work tracks the real sequence lengths while the strided layout is kept. The remainder of
+    a partially valid tile is computed and can be masked by the epilogue, see Sm90ValidLengthMask.
+
+    The tile order is the one of the static persistent scheduler, with padded clusters removed from
+    the sequence each CTA visits. Since every warp of a CTA walks the same sequence, skipping is a
+    local decision that needs no synchronization. The grid is sized for the padded problem, as the
+    valid extents are only known on the device.
+*/
+
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+class PersistentTileSchedulerSm90ValidLength : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+public:
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using WorkTileInfo = BaseScheduler::WorkTileInfo;
+
+  static constexpr bool IsDynamicPersistent = false;
+
+  struct Arguments : BaseScheduler::Arguments {
+    // Optional device arrays of the valid M and N extents of each of the L batches. A null array
+    // keeps the full extent of that mode.
+    int32_t const* valid_m = nullptr;
+    int32_t const* valid_n = nullptr;
+  };
+
+  struct Params : BaseScheduler::Params {
+    int32_t const* valid_m_ = nullptr;
+    int32_t const* valid_n_ = nullptr;
+    int32_t tile_m_ = 0;
+    int32_t tile_n_ = 0;
+  };
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace=nullptr,
+      const uint32_t epilogue_subtile = 1,
+      uint32_t ktile_start_alignment_count = 1u) {
+
+    Params params;
+    static_cast<typename BaseScheduler::Params&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shape_mnkl, tile_shape, cluster_shape, hw_info, arguments, workspace, epilogue_subtile,
+      ktile_start_alignment_count);
+
+    params.valid_m_ = arguments.valid_m;
+    params.valid_n_ = arguments.valid_n;
+    params.tile_m_ = static_cast<int32_t>(cute::size<0>(tile_shape));
+    params.tile_n_ = static_cast<int32_t>(cute::size<1>(tile_shape));
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    if (args.spatial_tiles_per_plane != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Valid length tile scheduler does not support spatial blocking.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args);
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90ValidLength() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90ValidLength(Params const& params_)
+    : BaseScheduler(params_)
+    , valid_m_(params_.valid_m_)
+    , valid_n_(params_.valid_n_)
+    , tile_m_(params_.tile_m_)
+    , tile_n_(params_.tile_n_) {
+#if defined(__CUDA_ARCH__)
+    if (params_.raster_order_ == RasterOrder::AlongN) {
+      linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    }
+    else {
+      linear_idx_ = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+    }
+    grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    linear_idx_ = next_valid_linear_idx(linear_idx_);
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    return BaseScheduler::get_current_work_for_linear_idx(linear_idx);
+  }
+
+  // Each advance moves to the next cluster holding valid work, so that warp groups stepping over
+  // each other's tiles (pingpong) see the same sequence as the producer
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    for (uint32_t i = 0; i < advance_count; ++i) {
+      linear_idx_ = next_valid_linear_idx(linear_idx_ + grid_size_);
+    }
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo& work_tile_info, uint32_t advance_count = 1) const {
+    if (continue_current_work(work_tile_info)) {
+      return false;
+    }
+    uint64_t linear_idx = linear_idx_;
+    for (uint32_t i = 0; i < advance_count; ++i) {
+      linear_idx = next_valid_linear_idx(linear_idx + grid_size_);
+    }
+    return not get_current_work_for_linear_idx(linear_idx).is_valid();
+  }
+
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    if (continue_current_work(work_tile_info)) {
+      return cute::make_tuple(work_tile_info, true);
+    }
+
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+private:
+  // Whether the cluster computing work_tile_info lies entirely in the padding of its batch. Tile
+  // indices grow within a cluster, so the cluster's first tile decides for all of its CTAs.
+  CUTLASS_DEVICE
+  bool
+  is_padded_cluster(WorkTileInfo const& work_tile_info) const {
+    auto [cta_m_in_cluster, cta_n_in_cluster, _] = cute::block_id_in_cluster();
+    int32_t cluster_m = work_tile_info.M_idx - static_cast<int32_t>(cta_m_in_cluster);
+    int32_t cluster_n = work_tile_info.N_idx - static_cast<int32_t>(cta_n_in_cluster);
+    return (valid_m_ != nullptr && cluster_m * tile_m_ >= valid_m_[work_tile_info.L_idx]) ||
+           (valid_n_ != nullptr && cluster_n * tile_n_ >= valid_n_[work_tile_info.L_idx]);
+  }
+
+  // First linear index from linear_idx onwards, in steps of the grid size, whose cluster holds valid
+  // work. Indices past the problem are returned as is and map to an invalid tile.
+  CUTLASS_DEVICE
+  uint64_t
+  next_valid_linear_idx(uint64_t linear_idx) const {
+    WorkTileInfo work_tile_info = get_current_work_for_linear_idx(linear_idx);
+    while (work_tile_info.is_valid() && is_padded_cluster(work_tile_info)) {
+      linear_idx += grid_size_;
+      work_tile_info = get_current_work_for_linear_idx(linear_idx);
+    }
+    return linear_idx;
+  }
+
+  int32_t const* valid_m_ = nullptr;
+  int32_t const* valid_n_ = nullptr;
+  int32_t tile_m_ = 0;
+  int32_t tile_n_ = 0;
+  uint64_t linear_idx_ = 0;
+  uint64_t grid_size_ = 0;
+};
+
+}
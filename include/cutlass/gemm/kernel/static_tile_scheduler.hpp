@@ -86,12 +86,23 @@ public:
   using Params = PersistentTileSchedulerSm90Params;
   using RasterOrder = typename Params::RasterOrder;
   using RasterOrderOptions = typename Params::RasterOrderOptions;
+  using TileTraversal = typename Params::TileTraversal;
   static constexpr bool IsDynamicPersistent = false;
 
 public:
   struct Arguments {
     int max_swizzle_size = 1;
     RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+    // Optional spatially blocked M order for convolutions (see
+    // PersistentTileSchedulerSm90Params::initialize_spatial_blocking). Disabled by default.
+    int spatial_tiles_per_plane = 0;
+    int spatial_planes_per_block = 1;
+    // Optional L2-aware traversal (see PersistentTileSchedulerSm90Params::initialize_super_tiling).
+    // super_tile_size is the side of a super-tile in clusters, 0 sizes it from the L2 capacity using
+    // super_tile_element_bytes as the size of an A/B element. Disabled by default.
+    TileTraversal traversal = TileTraversal::Raster;
+    int super_tile_size = 0;
+    int super_tile_element_bytes = 2;
   };
 
   template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
@@ -106,9 +117,9 @@ public:
       [[maybe_unused]] const uint32_t epilogue_subtile = 1,
       [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
 
-    // We only need the tile and cluster shape during scheduler setup, so let FTAD do the magic
+    // We only need the tile and cluster shape during scheduler setup, so let FTAD do the magic.
+    // The cluster shape may be dynamic for kernels launched with a runtime cluster shape.
     static_assert(cute::is_static<TileShape>::value);
-    static_assert(cute::is_static<ClusterShape>::value);
 
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cluster_shape);
 
@@ -120,6 +131,20 @@ public:
       arguments.max_swizzle_size,
       arguments.raster_order
     );
+    params.initialize_spatial_blocking(
+      problem_blocks,
+      to_gemm_coord(cluster_shape),
+      arguments.spatial_tiles_per_plane,
+      arguments.spatial_planes_per_block
+    );
+    params.initialize_super_tiling(
+      to_gemm_coord(tile_shape),
+      static_cast<int>(cute::size(cute::get<2>(problem_shape_mnkl))),
+      hw_info,
+      arguments.super_tile_element_bytes,
+      arguments.traversal,
+      arguments.super_tile_size
+    );
 
     return params;
   }
@@ -127,7 +152,8 @@ public:
   CUTLASS_HOST_DEVICE
   static bool
   can_implement(Arguments const& args) {
-    return args.max_swizzle_size >= 1;
+    return args.max_swizzle_size >= 1 && args.spatial_tiles_per_plane >= 0 && args.spatial_planes_per_block >= 1 &&
+           args.super_tile_size >= 0 && args.super_tile_element_bytes >= 1;
   }
 
   CUTLASS_HOST_DEVICE
@@ -176,6 +202,7 @@ public:
     scheduler_params.divmod_batch_(work_idx_l, remainder, linear_idx);
 
     uint64_t blk_per_grid_dim = scheduler_params.divmod_cluster_shape_minor_.divide(remainder);
+    blk_per_grid_dim = scheduler_params.get_super_tile_blk_idx(blk_per_grid_dim);
 
     auto [work_idx_m, work_idx_n] = Subclass::get_work_idx_m_and_n(blk_per_grid_dim,
                                                          scheduler_params.divmod_cluster_shape_major_,
@@ -184,6 +211,8 @@ public:
                                                          scheduler_params.log_swizzle_size_,
                                                          scheduler_params.raster_order_);
 
+    work_idx_m = scheduler_params.get_spatial_blocked_idx_m(work_idx_m);
+
     return {work_idx_m, work_idx_n, static_cast<int32_t>(work_idx_l), true};
   }
 
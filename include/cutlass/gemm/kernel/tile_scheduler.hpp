@@ -36,6 +36,7 @@
 */
 
 #include "cutlass/arch/arch.h"
+#include "cutlass/blas3_types.h"
 #include "cutlass/detail/dependent_false.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -50,14 +51,45 @@ struct PersistentScheduler { };
 
 struct StreamKScheduler { };
 
+struct DynamicPersistentScheduler { }; // Claims tiles from a global work counter instead of a static grid stride
+
+struct LoadBalancedScheduler { }; // Visits tiles in decreasing cost order for uneven (causal / triangular) work
+
+struct BatchBroadcastScheduler { }; // Places the batches of an operand shared across L in the same cluster for multicast
+
+struct SparseOutputScheduler { }; // Only visits output tiles holding non-zeros of a sparse output pattern (SDDMM)
+
+struct ValidLengthScheduler { }; // Skips the tiles of each batch past its device-side valid M / N extents
+
 struct GroupScheduler { }; // Only used for Grouped GEMMs
 
+struct GroupQueueScheduler { }; // Only used for Grouped GEMMs fed from a device-side problem queue
+struct GroupArrivalScheduler { }; // Only used for Grouped GEMMs whose groups are gated on per-group arrival flags
+
+template <FillMode FillModeC, int Rank = 1>
+struct TriangularScheduler { }; // Only visits output tiles on or inside the FillModeC triangle (SYRK, or SYR2K with Rank 2)
+
+template <FillMode FillModeA>
+struct TriangularKScheduler { }; // Only visits the k tiles holding the FillModeA triangle of A (TRMM, SYMM)
+
+struct ClusterSplitKScheduler { }; // Splits the k tiles of each output tile across a 1x1xS cluster, reduced over DSMEM
+
 } // namespace cutlass::gemm
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_dynamic.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_load_balanced.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_batch_broadcast.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_sparse_output.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_valid_length.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_stream_k.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group_queue.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group_arrival.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group_stream_k.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_triangular.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_cluster_split_k.hpp"
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::gemm::kernel::detail {
@@ -125,6 +157,20 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90StreamK<TileShape, ClusterShape>;
 };
 
+template <
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+    DynamicPersistentScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+  > {
+  static_assert(cute::size(ClusterShape{}) == 1, "Dynamic persistent tile scheduler requires a 1x1x1 cluster shape.");
+  using Scheduler = PersistentTileSchedulerSm90Dynamic;
+};
+
 template <
   class TileShape,
   class ClusterShape
@@ -140,6 +186,150 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90Group<GroupProblemShape>;
 };
 
+template <
+  class TileShape,
+  class ClusterShape
+  , class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    GroupQueueScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90GroupQueue<GroupProblemShape>;
+};
+
+template <
+  class TileShape,
+  class ClusterShape
+  , class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    GroupArrivalScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90GroupArrival<GroupProblemShape>;
+};
+
+template <
+  FillMode FillModeC,
+  int Rank,
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+    TriangularScheduler<FillModeC, Rank>,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+  > {
+  static_assert(cute::size(ClusterShape{}) == 1, "Triangular tile scheduler requires a 1x1x1 cluster shape.");
+  using Scheduler = PersistentTileSchedulerSm90Triangular<FillModeC, Rank>;
+};
+
+template <
+  FillMode FillModeA,
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+    TriangularKScheduler<FillModeA>,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+  > {
+  static_assert(cute::size<0>(ClusterShape{}) == 1, "Triangular-K tile scheduler requires cluster size 1 along M.");
+  using Scheduler = PersistentTileSchedulerSm90TriangularK<FillModeA, TileShape>;
+};
+
+template <
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+    ClusterSplitKScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90ClusterSplitK<ClusterShape>;
+};
+
+template <
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+    LoadBalancedScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+  > {
+  static_assert(cute::size(ClusterShape{}) == 1, "Load-balanced tile scheduler requires a 1x1x1 cluster shape.");
+  using Scheduler = PersistentTileSchedulerSm90LoadBalanced;
+};
+
+template <
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+    BatchBroadcastScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90BatchBroadcast;
+};
+
+template <
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+    SparseOutputScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+  > {
+  static_assert(cute::size(ClusterShape{}) == 1, "Sparse output tile scheduler requires a 1x1x1 cluster shape.");
+  using Scheduler = PersistentTileSchedulerSm90SparseOutput;
+};
+
+template <
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+    ValidLengthScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90ValidLength;
+};
+
+// Stream-K for Grouped GEMMs
+template <
+  class TileShape,
+  class ClusterShape
+  , class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    StreamKScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90GroupStreamK<GroupProblemShape, TileShape, ClusterShape>;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass::gemm::kernel::detail
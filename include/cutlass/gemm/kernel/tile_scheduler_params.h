@@ -88,6 +88,12 @@ struct PersistentTileSchedulerSm90Params {
     AlongN
   };
 
+  enum class TileTraversal {
+    Raster,     // Swizzled raster order selected by RasterOrderOptions and max_swizzle_size
+    SuperTile,  // Morton order within square super-tiles of clusters sized from the L2 capacity
+    Heuristic   // SuperTile when the A and B operands of the problem do not fit in L2, Raster otherwise
+  };
+
   FastDivmodU64Pow2 divmod_cluster_shape_major_{};
   FastDivmodU64Pow2 divmod_cluster_shape_minor_{};
   FastDivmodU64 divmod_batch_{};
@@ -103,6 +109,21 @@ struct PersistentTileSchedulerSm90Params {
   uint32_t cluster_shape_m_ = 0;
   uint32_t cluster_shape_n_ = 0;
 
+  // Spatially blocked M order for implicit GEMM convolutions. M tiles are viewed as a
+  // (tiles_per_plane, planes) grid in cluster units and visited tile-major within each block
+  // of planes. spatial_blocked_tiles_m_ == 0 disables the remapping.
+  FastDivmodU64 divmod_spatial_block_{};
+  FastDivmodU64 divmod_spatial_planes_{};
+  uint64_t spatial_tiles_per_plane_ = 0;
+  uint64_t spatial_blocked_tiles_m_ = 0;
+
+  // L2 super-tile traversal. Clusters are grouped into square super-tiles of (1 << log_super_tile_size_)
+  // clusters on a side. Super-tiles are visited in bands along the raster major mode, and clusters in
+  // Morton order within each super-tile. log_super_tile_size_ == 0 keeps the swizzled raster order.
+  int32_t log_super_tile_size_ = 0;
+  FastDivmodU64 divmod_super_tile_band_{};
+  uint64_t super_tile_clusters_minor_ = 0;
+
   // Initializes members. This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
   void
@@ -176,6 +197,192 @@ struct PersistentTileSchedulerSm90Params {
     }
   }
 
+  // Enables spatially blocked ordering of M tiles. For an NDHWC fprop, tiles_per_plane is the
+  // number of CTA tiles along M covering one output P*Q plane, and planes_per_block is the number
+  // of adjacent Z planes whose tiles are interleaved so that their shared input halos stay in L2.
+  // Only whole blocks of planes are remapped; any remaining tiles keep the linear order.
+  void
+  initialize_spatial_blocking(
+    dim3 problem_blocks,
+    GemmCoord cluster_shape,
+    int tiles_per_plane,
+    int planes_per_block
+  ) {
+    spatial_blocked_tiles_m_ = 0;
+    if (tiles_per_plane <= 0 || planes_per_block <= 1) {
+      return;
+    }
+
+    uint64_t cluster_tiles_per_plane = static_cast<uint64_t>(tiles_per_plane) / cluster_shape.m();
+    uint64_t cluster_tiles_per_block = cluster_tiles_per_plane * static_cast<uint64_t>(planes_per_block);
+    uint64_t cluster_tiles_m = problem_blocks.x / cluster_shape.m();
+    if (cluster_tiles_per_plane == 0 || cluster_tiles_m < cluster_tiles_per_block) {
+      return;
+    }
+
+    divmod_spatial_block_ = FastDivmodU64(cluster_tiles_per_block);
+    divmod_spatial_planes_ = FastDivmodU64(static_cast<uint64_t>(planes_per_block));
+    spatial_tiles_per_plane_ = cluster_tiles_per_plane;
+    spatial_blocked_tiles_m_ = (cluster_tiles_m / cluster_tiles_per_block) * cluster_tiles_per_block;
+  }
+
+  // Maps the M tile index produced by the linear rasterization onto the spatially blocked order.
+  CUTLASS_HOST_DEVICE
+  int32_t
+  get_spatial_blocked_idx_m(int32_t work_idx_m) const {
+    if (spatial_blocked_tiles_m_ == 0) {
+      return work_idx_m;
+    }
+
+    uint64_t cluster_idx_m = static_cast<uint64_t>(work_idx_m) / cluster_shape_m_;
+    if (cluster_idx_m >= spatial_blocked_tiles_m_) {
+      return work_idx_m;
+    }
+
+    uint64_t block_idx, idx_in_block, tile_idx, plane_idx;
+    divmod_spatial_block_(block_idx, idx_in_block, cluster_idx_m);
+    divmod_spatial_planes_(tile_idx, plane_idx, idx_in_block);
+
+    uint64_t blocked_idx_m = block_idx * divmod_spatial_block_.divisor + plane_idx * spatial_tiles_per_plane_ + tile_idx;
+    return static_cast<int32_t>(blocked_idx_m * cluster_shape_m_ + (work_idx_m - cluster_idx_m * cluster_shape_m_));
+  }
+
+  // Enables the L2 super-tile traversal. Must be called after initialize(). tile_shape is the CTA tile
+  // (M, N, K) and problem_k the GEMM K extent. Unless super_tile_size gives the side explicitly, the
+  // super-tile is the larger of the region whose full-K A and B panels fit in half of the L2 (H100 splits
+  // its L2 into two partitions) and the square covering one wave of clusters. In both cases it is
+  // rounded down to a power of two no larger than the cluster grid.
+  void
+  initialize_super_tiling(
+    GemmCoord tile_shape,
+    int problem_k,
+    KernelHardwareInfo const& hw_info,
+    int element_bytes,
+    TileTraversal traversal,
+    int super_tile_size
+  ) {
+    log_super_tile_size_ = 0;
+    if (traversal == TileTraversal::Raster) {
+      return;
+    }
+
+    uint64_t clusters_major = divmod_cluster_blk_major_.divisor;
+    uint64_t clusters_minor = raster_order_ == RasterOrder::AlongN ? problem_tiles_m_ : problem_tiles_n_;
+    uint64_t clusters_m = raster_order_ == RasterOrder::AlongN ? clusters_minor : clusters_major;
+    uint64_t clusters_n = raster_order_ == RasterOrder::AlongN ? clusters_major : clusters_minor;
+
+    int l2_cache_size = hw_info.l2_cache_size;
+#if !defined(__CUDACC_RTC__)
+    if (l2_cache_size <= 0) {
+      l2_cache_size = KernelHardwareInfo::query_device_l2_cache_size(hw_info.device_id);
+    }
+#endif
+    uint64_t l2_bytes = static_cast<uint64_t>(platform::max(l2_cache_size, 0)) / 2;
+
+    // Bytes of A read by one row of clusters and of B by one column of clusters over the full K extent
+    uint64_t bytes_k = static_cast<uint64_t>(problem_k) * static_cast<uint64_t>(element_bytes);
+    uint64_t bytes_a = static_cast<uint64_t>(cluster_shape_m_) * tile_shape.m() * bytes_k;
+    uint64_t bytes_b = static_cast<uint64_t>(cluster_shape_n_) * tile_shape.n() * bytes_k;
+
+    if (traversal == TileTraversal::Heuristic &&
+        (l2_bytes == 0 || clusters_m * bytes_a + clusters_n * bytes_b <= l2_bytes)) {
+      return;
+    }
+
+    uint64_t side;
+    if (super_tile_size > 0) {
+      side = static_cast<uint64_t>(super_tile_size);
+    }
+    else {
+      uint64_t side_l2 = 1;
+      while (2 * side_l2 * (bytes_a + bytes_b) <= l2_bytes) {
+        side_l2 *= 2;
+      }
+      uint64_t cluster_size = static_cast<uint64_t>(cluster_shape_m_) * cluster_shape_n_;
+      uint64_t clusters_per_wave = static_cast<uint64_t>(platform::max(hw_info.sm_count, 1)) / cluster_size;
+      uint64_t side_wave = 1;
+      while (4 * side_wave * side_wave <= clusters_per_wave) {
+        side_wave *= 2;
+      }
+      side = platform::max(side_l2, side_wave);
+    }
+    side = platform::min(side, platform::min(clusters_minor, clusters_major));
+
+    int32_t log_side = 0;
+    while ((uint64_t(2) << log_side) <= side) {
+      ++log_side;
+    }
+    if (log_side == 0) {
+      return;
+    }
+
+    // Super-tiles replace the swizzle, so clusters are decoded from a plain raster index
+    log_swizzle_size_ = 0;
+    log_super_tile_size_ = log_side;
+    divmod_super_tile_band_ = FastDivmodU64(clusters_major << log_side);
+    super_tile_clusters_minor_ = clusters_minor;
+  }
+
+  // Maps a block index of the linear rasterization onto the super-tile traversal. The result is the
+  // block index that the unswizzled raster order decodes to the same cluster.
+  CUTLASS_HOST_DEVICE
+  uint64_t
+  get_super_tile_blk_idx(uint64_t blk_per_grid_dim) const {
+    if (log_super_tile_size_ == 0) {
+      return blk_per_grid_dim;
+    }
+
+    uint64_t cluster_id, cluster_major_offset;
+    divmod_cluster_shape_major_(cluster_id, cluster_major_offset, blk_per_grid_dim);
+
+    uint64_t const side = uint64_t(1) << log_super_tile_size_;
+    uint64_t const clusters_major = divmod_cluster_blk_major_.divisor;
+
+    uint64_t band, idx_in_band;
+    divmod_super_tile_band_(band, idx_in_band, cluster_id);
+
+    // Only the last band and the last super-tile of each band can be partial
+    uint64_t band_height = platform::min(side, super_tile_clusters_minor_ - band * side);
+    uint64_t tile_in_band, idx_in_tile;
+    if (band_height == side) {
+      tile_in_band = idx_in_band >> (2 * log_super_tile_size_);
+      idx_in_tile = idx_in_band & ((uint64_t(1) << (2 * log_super_tile_size_)) - 1);
+    }
+    else {
+      tile_in_band = idx_in_band / (band_height * side);
+      idx_in_tile = idx_in_band - tile_in_band * band_height * side;
+    }
+    uint64_t tile_width = platform::min(side, clusters_major - tile_in_band * side);
+
+    uint64_t cluster_idx_minor, cluster_idx_major;
+    if (band_height == side && tile_width == side) {
+      cluster_idx_major = morton_compact_bits(idx_in_tile);
+      cluster_idx_minor = morton_compact_bits(idx_in_tile >> 1);
+    }
+    else {
+      cluster_idx_minor = idx_in_tile / tile_width;
+      cluster_idx_major = idx_in_tile - cluster_idx_minor * tile_width;
+    }
+    cluster_idx_minor += band * side;
+    cluster_idx_major += tile_in_band * side;
+
+    return (cluster_idx_minor * clusters_major + cluster_idx_major) * divmod_cluster_shape_major_.divisor +
+           cluster_major_offset;
+  }
+
+  // Gathers the even bits of x into the low half of the result
+  CUTLASS_HOST_DEVICE
+  static uint64_t
+  morton_compact_bits(uint64_t x) {
+    x &= 0x5555555555555555ull;
+    x = (x | (x >> 1)) & 0x3333333333333333ull;
+    x = (x | (x >> 2)) & 0x0f0f0f0f0f0f0f0full;
+    x = (x | (x >> 4)) & 0x00ff00ff00ff00ffull;
+    x = (x | (x >> 8)) & 0x0000ffff0000ffffull;
+    x = (x | (x >> 16)) & 0x00000000ffffffffull;
+    return x;
+  }
+
   // Given the inputs, computes the physical grid we should launch.
   // This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
@@ -395,7 +602,16 @@ struct PersistentTileSchedulerSm90StreamKParams {
     // Due to the nondeterminsitic ordering of accumulation, deterministic numeric behavior cannot
     // be guaranteed with this mode (e.g., floating-point rounding error will depend on the order
     // of accumulation)
-    Nondeterministic
+    Nondeterministic,
+
+    // Participating CTAs each run the epilogue on their own partial accumulators and reduce the result
+    // directly into the destination (e.g., with an epilogue storing D through TMA reduce-add), in turnstile
+    // order of the K extent covered by each CTA. No workspace is needed for partial accumulators, only for
+    // the per-tile locks, and no separate reduction is performed.
+    //
+    // Since every split applies the epilogue, the epilogue must be linear in the accumulators and must not
+    // read a source (beta == 0); D holds the initial value (e.g., zeros or a residual) before the kernel runs.
+    InPlace
   };
 
   // Strategies for decomposing the problem
@@ -410,6 +626,46 @@ struct PersistentTileSchedulerSm90StreamKParams {
     StreamK
   };
 
+  // Inputs to the cost model used by DecompositionMode::Heuristic. Costs are expressed in units of
+  // the time a CTA spends on one mainloop k tile, which is assumed to be bound by streaming its
+  // (tile_m + tile_n) * tile_k operand elements. Traffic to the reduction workspace and to D is
+  // charged at the same rate.
+  struct DecompositionCostModel {
+    // Bytes per A/B element
+    int operand_bytes = 2;
+    // Bytes per partial accumulator element spilled to the reduction workspace
+    int accumulator_bytes = 4;
+    // Bytes per D element written by the epilogue
+    int output_bytes = 2;
+    // Fixed cost of starting a work unit or a new output tile within one (prologue, pipeline fill)
+    float unit_overhead = 2.0f;
+    // Multiplier on the cost of reduction workspace traffic, e.g. > 1 when it spills out of L2
+    float fixup_scale = 1.0f;
+    // Largest split-K factor considered
+    int max_splits = 16;
+  };
+
+  // Decomposition chosen for a problem, together with the estimated cost of each candidate.
+  // Costs are makespans in the units of DecompositionCostModel; a negative cost marks a candidate
+  // that does not apply to the problem.
+  struct DecompositionPlan {
+    // Never Heuristic
+    DecompositionMode mode = DecompositionMode::DataParallel;
+    // Split-K factor, 1 unless mode is SplitK
+    int splits = 1;
+    uint64_t output_tiles = 0;
+    uint64_t ctas_per_wave = 0;
+    // Output tiles and work units of the stream-K candidate
+    uint32_t sk_tiles = 0;
+    uint64_t sk_units = 0;
+    float data_parallel_cost = 0.f;
+    float split_k_cost = -1.f;
+    int split_k_splits = 1;
+    float stream_k_cost = -1.f;
+    // Bytes of partial accumulators written to and read back from the reduction workspace
+    size_t fixup_bytes = 0;
+  };
+
   using UnderlyingParams = PersistentTileSchedulerSm90Params;
   using RasterOrder = UnderlyingParams::RasterOrder;
   using RasterOrderOptions = UnderlyingParams::RasterOrderOptions;
@@ -463,6 +719,11 @@ struct PersistentTileSchedulerSm90StreamKParams {
   // Number of tiles covered by stream-K work units
   uint32_t sk_tiles_ = 0;
 
+  // Number of reduction slots (a partial tile and its lock) that the output tiles of a split-K
+  // decomposition with deterministic reduction share round-robin. 0 gives every output tile its own slot.
+  uint32_t reduction_slots_ = 0;
+  FastDivmodU64 divmod_reduction_slots_{};
+
   // Number of work units computing stream-K tiles
   uint32_t sk_units_ = 0;
 
@@ -527,6 +788,20 @@ struct PersistentTileSchedulerSm90StreamKParams {
     return static_cast<uint32_t>(sk_units / sk_tiles + 2);
   }
 
+  // Returns the number of reduction slots used by a split-K decomposition of output_tiles tiles when the
+  // reduction workspace is capped at max_reduction_tiles partial tiles, or 0 if every output tile gets its
+  // own slot. Slots are only shared under deterministic reduction, whose turnstile locks can also order
+  // the reuse of a slot, and come in whole clusters.
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_reduction_slots(uint64_t output_tiles, uint64_t cluster_size, ReductionMode reduction_mode, uint32_t max_reduction_tiles) {
+    if (reduction_mode != ReductionMode::Deterministic || max_reduction_tiles == 0) {
+      return 0;
+    }
+    uint64_t slots = platform::max(uint64_t(max_reduction_tiles) / cluster_size, uint64_t(1)) * cluster_size;
+    return slots < output_tiles ? static_cast<uint32_t>(slots) : 0;
+  }
+
   // Initializes members. This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
   void
@@ -541,7 +816,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     ReductionMode reduction_mode,
     DecompositionMode decomposition_mode,
     void* workspace,
-    const uint32_t epilogue_subtile = 1u
+    const uint32_t epilogue_subtile = 1u,
+    uint32_t max_reduction_tiles = 0
   ) {
     dim3 problem_blocks = UnderlyingParams::get_tiled_cta_shape_mnl(
       problem_shape, tile_shape, cluster_shape);
@@ -560,7 +836,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
       reduction_mode,
       decomposition_mode,
       workspace,
-      epilogue_subtile
+      epilogue_subtile,
+      max_reduction_tiles
     );
   }
 
@@ -579,7 +856,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     ReductionMode reduction_mode,
     DecompositionMode decomposition_mode,
     void* workspace,
-    const uint32_t epilogue_subtile = 1
+    const uint32_t epilogue_subtile = 1,
+    uint32_t max_reduction_tiles = 0
   ) {
 
     #if !defined(__CUDACC_RTC__)
@@ -614,7 +892,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
       raster_order_option,
       decomposition_mode,
       reduction_mode,
-      epilogue_subtile
+      epilogue_subtile,
+      max_reduction_tiles
     ); 
   }
   
@@ -715,7 +994,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     RasterOrderOptions raster_order_option,
     DecompositionMode decomposition_mode,
     ReductionMode reduction_mode,
-    const uint32_t epilogue_subtile = 1
+    const uint32_t epilogue_subtile = 1,
+    uint32_t max_reduction_tiles = 0
     ) {
     uint32_t groups = 0;
     uint32_t sk_tiles = 0;
@@ -771,7 +1051,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
       cluster_shape,
       splits,
       epilogue_subtile,
-      reduction_mode
+      reduction_mode,
+      max_reduction_tiles
       );
   }
 
@@ -893,13 +1174,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
           // Rest scenario is streamk
           heuristic_mode = DecompositionMode::StreamK;
         }
-        // Refresh heuristic_mode using analytical model before choosing streamk/separate_reduction decomposition,
-        // ideally it's to get the final decomposition more accuracy. Comment it as it is place holder at this moment.
-        #if 0
-        uint32_t total_waves = static_cast<uint32_t>((output_tiles + ctas_per_wave - 1) / ctas_per_wave);
-        analytical_model(heuristic_mode, k_tiles_per_output_tile, k_tiles_per_sk_unit,
-          sk_splits, epilogue_subtile, total_waves);
-        #endif
+        // Schedulers that account for reduction and epilogue costs resolve the Heuristic mode through
+        // get_decomposition_plan() before initializing the params.
         return heuristic_mode;
       }
     }
@@ -923,7 +1199,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     GemmCoord cluster_shape,
     uint32_t splits,
     uint32_t epilogue_subtile,
-    ReductionMode reduction_mode
+    ReductionMode reduction_mode,
+    uint32_t max_reduction_tiles = 0
     ) {
     // The highest priority when customers set as splitk mode, may set
     // with a adpated splits value rather than the original splits
@@ -935,7 +1212,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         cluster_shape,
         sk_splits, // split-k set by customers
         k_tiles_per_output_tile,
-        reduction_mode
+        reduction_mode,
+        max_reduction_tiles
       );
     }
     else if (heuristic_mode == DecompositionMode::DataParallel) {
@@ -945,7 +1223,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         cluster_shape,
         1, // fast path to fall back to the mode without any split scheme
         k_tiles_per_output_tile,
-        reduction_mode
+        reduction_mode,
+        max_reduction_tiles
       );
     }
     else if (heuristic_mode == DecompositionMode::SplitK) {
@@ -955,7 +1234,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         cluster_shape,
         sk_splits, // splits calculated by heuristic
         k_tiles_per_output_tile,
-        reduction_mode
+        reduction_mode,
+        max_reduction_tiles
       );
     }
     else {
@@ -1102,6 +1382,133 @@ struct PersistentTileSchedulerSm90StreamKParams {
     return sk_units;
   }
 
+  // Estimates the makespan of data-parallel, split-K and stream-K decompositions of the problem and
+  // returns the cheapest one. An explicit decomposition_mode, or a split count greater than 1 with
+  // DecompositionMode::Heuristic, is kept as requested; the estimates are filled in either way.
+  // The stream-K candidate is the one DecompositionMode::StreamK produces: the last two waves of
+  // tiles (or all of them when there are fewer) shared by one wave of stream-K units.
+  static DecompositionPlan
+  get_decomposition_plan(
+    dim3 problem_blocks,
+    uint32_t k_tiles_per_output_tile,
+    GemmCoord tile_shape,
+    GemmCoord cluster_shape,
+    KernelHardwareInfo hw_info,
+    int splits,
+    int max_swizzle,
+    RasterOrderOptions raster_order_option,
+    DecompositionMode decomposition_mode,
+    DecompositionCostModel const& cost_model = {}) {
+
+    #if !defined(__CUDACC_RTC__)
+    if (hw_info.sm_count <= 0) {
+      hw_info.sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+    #endif // !defined(__CUDACC_RTC__)
+
+    auto log_swizzle_size = UnderlyingParams::get_log_swizzle_size(problem_blocks.x, problem_blocks.y, max_swizzle);
+    uint64_t problem_blocks_m = round_up(problem_blocks.x, (1 << log_swizzle_size) * cluster_shape.m());
+    uint64_t problem_blocks_n = round_up(problem_blocks.y, (1 << log_swizzle_size) * cluster_shape.n());
+    uint64_t output_tiles = problem_blocks_m * problem_blocks_n * problem_blocks.z;
+
+    dim3 grid = get_grid_shape(problem_blocks, cluster_shape, hw_info, max_swizzle, raster_order_option);
+    uint64_t ctas_per_wave = grid.x * grid.y;
+    uint64_t cluster_size = cluster_shape.m() * cluster_shape.n();
+
+    float k_tile_bytes = float(tile_shape.m() + tile_shape.n()) * float(tile_shape.k()) * float(cost_model.operand_bytes);
+    float tile_elements = float(tile_shape.m()) * float(tile_shape.n());
+    // Cost of writing or of reading back one partial output tile
+    float partial_cost = cost_model.fixup_scale * tile_elements * float(cost_model.accumulator_bytes) / k_tile_bytes;
+    float epilogue_cost = tile_elements * float(cost_model.output_bytes) / k_tile_bytes;
+    float k_tiles = float(k_tiles_per_output_tile);
+    size_t partial_bytes = size_t(tile_shape.m()) * size_t(tile_shape.n()) * size_t(cost_model.accumulator_bytes);
+
+    auto waves = [&](uint64_t units) {
+      return float((units + ctas_per_wave - 1) / ctas_per_wave);
+    };
+
+    DecompositionPlan plan;
+    plan.output_tiles = output_tiles;
+    plan.ctas_per_wave = ctas_per_wave;
+    plan.data_parallel_cost = waves(output_tiles) * (k_tiles + cost_model.unit_overhead + epilogue_cost);
+
+    // Split-K: every split but the last spills a partial tile, and each split after the first
+    // reads the running sum back before adding its own.
+    auto split_k_cost = [&](int s) {
+      float k_tiles_per_split = float((k_tiles_per_output_tile + s - 1) / s);
+      return waves(output_tiles * s) * (k_tiles_per_split + cost_model.unit_overhead + 2.f * partial_cost + epilogue_cost);
+    };
+    int max_splits = adjust_split_count(platform::max(cost_model.max_splits, 1), hw_info.sm_count, k_tiles_per_output_tile);
+    for (int s = 2; s <= max_splits; ++s) {
+      float cost = split_k_cost(s);
+      if (plan.split_k_cost < 0.f || cost < plan.split_k_cost) {
+        plan.split_k_cost = cost;
+        plan.split_k_splits = s;
+      }
+    }
+
+    // Stream-K: data-parallel waves followed by one wave of stream-K units, each of which covers
+    // a contiguous range of k tiles that may start and end partway through an output tile.
+    uint32_t sk_tiles = get_num_sk_tiles(output_tiles, ctas_per_wave, cluster_size, k_tiles_per_output_tile,
+                                         DecompositionMode::StreamK);
+    uint64_t sk_units = get_num_sk_units(cluster_shape, ctas_per_wave, sk_tiles, k_tiles_per_output_tile);
+    if (sk_tiles > 0 && sk_units > 0) {
+      uint64_t k_tiles_per_sk_unit = (uint64_t(sk_tiles) * k_tiles_per_output_tile + sk_units - 1) / sk_units;
+      uint64_t segments = platform::min(uint64_t(sk_tiles),
+                                        (k_tiles_per_sk_unit + k_tiles_per_output_tile - 1) / k_tiles_per_output_tile + 1);
+      uint64_t dp_tiles = output_tiles - sk_tiles;
+      plan.sk_tiles = sk_tiles;
+      plan.sk_units = sk_units;
+      plan.stream_k_cost =
+        waves(dp_tiles) * (k_tiles + cost_model.unit_overhead + epilogue_cost) +
+        float(k_tiles_per_sk_unit) +
+        float(segments) * (cost_model.unit_overhead + 2.f * partial_cost) +
+        float((sk_tiles + sk_units - 1) / sk_units) * epilogue_cost;
+    }
+
+    auto resolve = [&](DecompositionMode mode, int s) {
+      plan.mode = mode;
+      plan.splits = mode == DecompositionMode::SplitK ? s : 1;
+      if (mode == DecompositionMode::SplitK) {
+        plan.fixup_bytes = size_t(output_tiles) * size_t(2 * (s - 1)) * partial_bytes;
+      }
+      else if (mode == DecompositionMode::StreamK) {
+        // Each unit boundary inside a tile spills and reloads one partial tile
+        plan.fixup_bytes = size_t(sk_units) * 2 * partial_bytes;
+      }
+      else {
+        plan.fixup_bytes = 0;
+      }
+    };
+
+    if (decomposition_mode == DecompositionMode::SplitK ||
+        (decomposition_mode == DecompositionMode::Heuristic && splits > 1)) {
+      int adapted_splits = adjust_split_count(splits, hw_info.sm_count, k_tiles_per_output_tile);
+      resolve(adapted_splits > 1 ? DecompositionMode::SplitK : DecompositionMode::DataParallel, adapted_splits);
+    }
+    else if (decomposition_mode == DecompositionMode::StreamK) {
+      resolve(plan.stream_k_cost < 0.f ? DecompositionMode::DataParallel : DecompositionMode::StreamK, 1);
+    }
+    else if (decomposition_mode == DecompositionMode::DataParallel) {
+      resolve(DecompositionMode::DataParallel, 1);
+    }
+    else {
+      // Ties go to the decomposition that needs no reduction workspace
+      DecompositionMode best = DecompositionMode::DataParallel;
+      float best_cost = plan.data_parallel_cost;
+      if (plan.stream_k_cost >= 0.f && plan.stream_k_cost < best_cost) {
+        best = DecompositionMode::StreamK;
+        best_cost = plan.stream_k_cost;
+      }
+      if (plan.split_k_cost >= 0.f && plan.split_k_cost < best_cost) {
+        best = DecompositionMode::SplitK;
+        best_cost = plan.split_k_cost;
+      }
+      resolve(best, plan.split_k_splits);
+    }
+    return plan;
+  }
+
   // Calculates the size of the workspace needed for holding reduction barriers
   CUTLASS_HOST_DEVICE
   static size_t
@@ -1139,7 +1546,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t accumulator_bits,
     uint32_t epilogue_subtile = 1,
     uint32_t num_accumulator_mtxs = 1,
-    uint32_t ktile_start_alignment_count = 1) {
+    uint32_t ktile_start_alignment_count = 1,
+    uint32_t max_reduction_tiles = 0) {
 
     auto log_swizzle_size = UnderlyingParams::get_log_swizzle_size(problem_blocks.x, problem_blocks.y, max_swizzle);
     problem_blocks.x = round_up(problem_blocks.x, (1 << log_swizzle_size) * cluster_shape.m());
@@ -1197,9 +1605,12 @@ struct PersistentTileSchedulerSm90StreamKParams {
                               sk_units % sk_tiles == 0;
 
       if (split_k_required || split_k_selected) {
-        // Basic split-K variant requires workspace for all output tiles
-        barrier_workspace_size = get_barrier_workspace_size(output_tiles, mma_warp_groups, barrier_bits);
-        reduction_workspace_size = get_reduction_workspace_size(output_tiles, tile_shape, accumulator_bits, num_accumulator_mtxs);
+        // Basic split-K variant requires workspace for all output tiles, unless they share a bounded
+        // number of reduction slots
+        uint32_t reduction_slots = get_reduction_slots(output_tiles, cluster_size, reduction_mode, max_reduction_tiles);
+        uint64_t reduction_tiles = reduction_slots > 0 ? reduction_slots : output_tiles;
+        barrier_workspace_size = get_barrier_workspace_size(reduction_tiles, mma_warp_groups, barrier_bits);
+        reduction_workspace_size = get_reduction_workspace_size(reduction_tiles, tile_shape, accumulator_bits, num_accumulator_mtxs);
       }
       else {
         uint64_t reduction_tiles = sk_tiles;
@@ -1219,6 +1630,11 @@ struct PersistentTileSchedulerSm90StreamKParams {
         barrier_workspace_size = get_barrier_workspace_size(sk_tiles, mma_warp_groups, barrier_bits);
         reduction_workspace_size = get_reduction_workspace_size(reduction_tiles, tile_shape, accumulator_bits, num_accumulator_mtxs);
       }
+
+      // Splits reduce into the destination, so only the locks ordering them are needed
+      if (reduction_mode == ReductionMode::InPlace) {
+        reduction_workspace_size = 0;
+      }
     }
   }
   #endif // !defined(__CUDACC_RTC__)
@@ -1249,7 +1665,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t element_accumulator_bits,
     uint32_t epilogue_subtile,
     uint32_t num_accumulator_mtxs,
-    uint32_t ktile_start_alignment_count = 1) {
+    uint32_t ktile_start_alignment_count = 1,
+    uint32_t max_reduction_tiles = 0) {
 
     dim3 problem_blocks = UnderlyingParams::get_tiled_cta_shape_mnl(problem_shape, tile_shape, cluster_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -1270,7 +1687,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
       element_accumulator_bits,
       epilogue_subtile,
       num_accumulator_mtxs,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      max_reduction_tiles
     );
   }
 
@@ -1294,7 +1712,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t element_accumulator_bits,
     uint32_t epilogue_subtile = 1,
     uint32_t num_accumulator_mtxs = 1,
-    uint32_t ktile_start_alignment_count = 1) {
+    uint32_t ktile_start_alignment_count = 1,
+    uint32_t max_reduction_tiles = 0) {
 
     size_t barrier_workspace_size = 0;
     size_t reduction_workspace_size = 0;
@@ -1318,7 +1737,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         element_accumulator_bits,
         epilogue_subtile,
         num_accumulator_mtxs,
-        ktile_start_alignment_count
+        ktile_start_alignment_count,
+        max_reduction_tiles
       );
     #endif
 
@@ -1345,7 +1765,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t element_accumulator_bits,
     uint32_t epilogue_subtile,
     CudaHostAdapter* cuda_adapter = nullptr,
-    uint32_t ktile_start_alignment_count = 1) {
+    uint32_t ktile_start_alignment_count = 1,
+    uint32_t max_reduction_tiles = 0) {
 
     dim3 problem_blocks = UnderlyingParams::get_tiled_cta_shape_mnl(problem_shape, tile_shape, cluster_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -1369,7 +1790,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
       epilogue_subtile,
       1,
       cuda_adapter,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      max_reduction_tiles
     );
   }
 
@@ -1396,7 +1818,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t epilogue_subtile = 1,
     uint32_t num_accumulator_mtxs = 1,
     CudaHostAdapter* cuda_adapter = nullptr,
-    uint32_t ktile_start_alignment_count = 1) {
+    uint32_t ktile_start_alignment_count = 1,
+    uint32_t max_reduction_tiles = 0) {
 
     #if !defined(__CUDACC_RTC__)
       uint64_t barrier_workspace_size = 0;
@@ -1420,7 +1843,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         element_accumulator_bits,
         epilogue_subtile,
         num_accumulator_mtxs,
-        ktile_start_alignment_count
+        ktile_start_alignment_count,
+        max_reduction_tiles
       );
 
       if (barrier_workspace_size > 0) {
@@ -1456,7 +1880,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     GemmCoord cluster_shape,
     uint32_t splits,
     uint32_t k_tiles_per_output_tile,
-    ReductionMode reduction_mode) {
+    ReductionMode reduction_mode,
+    uint32_t max_reduction_tiles = 0) {
 
     auto blocks_l = problem_blocks.z;
     auto blocks_m = round_up(problem_blocks.x,
@@ -1472,6 +1897,9 @@ struct PersistentTileSchedulerSm90StreamKParams {
     divmod_clusters_mnl_ = FastDivmodU64((blocks_m * blocks_n * blocks_l) / cluster_size);
     divmod_splits_ = FastDivmod(splits);
     units_per_problem_ = blocks_m * blocks_n * blocks_l;
+    reduction_slots_ = splits > 1 ?
+      get_reduction_slots(units_per_problem_, cluster_size, reduction_mode, max_reduction_tiles) : 0;
+    divmod_reduction_slots_ = FastDivmodU64(platform::max(reduction_slots_, 1u));
     big_units_ = k_tiles_per_output_tile % splits;
     reduction_mode_ = reduction_mode;
     divmod_k_tiles_per_sk_unit_ = FastDivmod(k_tiles_per_output_tile / splits);
@@ -1525,6 +1953,7 @@ struct PersistentTileSchedulerSm90StreamKParams {
 
     big_groups_ = static_cast<uint32_t>(sk_big_groups);
     sk_tiles_ = sk_tiles;
+    reduction_slots_ = 0;
     sk_units_ = static_cast<uint32_t>(sk_units);
     divmod_k_tiles_per_sk_unit_ = FastDivmod(static_cast<uint32_t>(k_tiles_per_sk_unit));
     divmod_k_tiles_per_sk_big_unit_ = FastDivmod(static_cast<uint32_t>(k_tiles_per_sk_unit + 1));
@@ -1595,6 +2024,8 @@ struct PersistentTileSchedulerSm90GroupParams {
 
   int32_t groups_ = 0;
   ProblemShape* problem_shapes_ = nullptr;
+  // Device-resident number of groups. When set, groups_ is an upper bound on it.
+  int32_t const* device_groups_ = nullptr;
   GemmCoord cta_shape_;
   GemmCoord cluster_shape_;
 
@@ -1808,6 +2239,119 @@ struct PersistentTileSchedulerSm90GroupParams {
   }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM90 persistent group scheduler fed from a device-side problem queue
+// (only used for Grouped Gemms)
+template<class ProblemShape>
+struct PersistentTileSchedulerSm90GroupQueueParams : PersistentTileSchedulerSm90GroupParams<ProblemShape> {
+
+  using UnderlyingParams = PersistentTileSchedulerSm90GroupParams<ProblemShape>;
+  using RasterOrder = typename UnderlyingParams::RasterOrder;
+  using RasterOrderOptions = typename UnderlyingParams::RasterOrderOptions;
+
+  // Number of problems published to the ring buffer, OR'd with the closed bit once the
+  // producer will not publish any further problems. Written by the producer.
+  uint32_t const* queue_head_ = nullptr;
+  // Number of problems fully retired by the kernel. Written by the kernel.
+  uint32_t* queue_tail_ = nullptr;
+  // Per-slot count of consumer warp groups that have finished with the slot
+  uint32_t* slot_arrivals_ = nullptr;
+
+  void
+  initialize(
+    dim3 problem_blocks,
+    int32_t capacity,
+    ProblemShape* problem_shapes,
+    GemmCoord cta_shape,
+    GemmCoord cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    int max_swizzle_size,
+    RasterOrderOptions raster_order_option,
+    uint32_t const* queue_head,
+    uint32_t* queue_tail,
+    uint32_t* slot_arrivals
+  ) {
+    UnderlyingParams::initialize(
+      problem_blocks,
+      capacity,
+      problem_shapes,
+      /* host_problem_shapes = */ nullptr,
+      cta_shape,
+      cluster_shape,
+      hw_info,
+      max_swizzle_size,
+      raster_order_option
+    );
+
+    queue_head_ = queue_head;
+    queue_tail_ = queue_tail;
+    slot_arrivals_ = slot_arrivals;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM90 persistent group scheduler with stream-K decomposition over the
+// concatenated tile space of all groups (only used for Grouped Gemms)
+template<class ProblemShape>
+struct PersistentTileSchedulerSm90GroupStreamKParams {
+
+  using RasterOrder = typename PersistentTileSchedulerSm90GroupParams<ProblemShape>::RasterOrder;
+  using RasterOrderOptions = typename PersistentTileSchedulerSm90GroupParams<ProblemShape>::RasterOrderOptions;
+  using DecompositionMode = PersistentTileSchedulerSm90StreamKParams::DecompositionMode;
+  using ReductionMode = PersistentTileSchedulerSm90StreamKParams::ReductionMode;
+
+  // Swizzling is not applied by this scheduler; kept for uniformity with other schedulers
+  int32_t log_swizzle_size_ = 0;
+  RasterOrder raster_order_ = RasterOrder::AlongM;
+
+  int32_t groups_ = 0;
+  ProblemShape* problem_shapes_ = nullptr;
+  // Device-resident number of groups. When set, groups_ is an upper bound on it.
+  int32_t const* device_groups_ = nullptr;
+  GemmCoord cta_shape_;
+
+  // Number of CTAs launched
+  uint32_t grid_size_ = 0;
+
+  // Total number of output tiles across all groups. The first sk_tiles_ of them are
+  // computed by stream-K units, the remainder in data-parallel fashion.
+  uint64_t total_tiles_ = 0;
+  uint64_t sk_tiles_ = 0;
+
+  // Number of stream-K units (zero if no stream-K work) and the total number of K tile
+  // iterations they split amongst themselves
+  uint32_t sk_units_ = 0;
+  uint64_t sk_iters_ = 0;
+
+  void* reduction_workspace_ = nullptr;
+
+  // Size of the partial accumulator region of the workspace. Barriers follow it.
+  CUTLASS_HOST_DEVICE
+  static size_t
+  get_reduction_workspace_size(uint64_t sk_tiles, GemmCoord tile_shape, uint32_t accumulator_bits) {
+    size_t bytes = static_cast<size_t>(sk_tiles) * tile_shape.m() * tile_shape.n() * accumulator_bits / 8;
+    return round_up_to_l2_alignment(bytes);
+  }
+
+  CUTLASS_HOST_DEVICE
+  static size_t
+  get_barrier_workspace_size(uint64_t sk_tiles, uint32_t mma_warp_groups, uint32_t barrier_bits) {
+    size_t bytes = static_cast<size_t>(sk_tiles) * mma_warp_groups * barrier_bits / 8;
+    return round_up_to_l2_alignment(bytes);
+  }
+
+  private:
+  // Round up number of bytes to the nearest multiple of L2 cache line alignment
+  CUTLASS_HOST_DEVICE
+  static size_t
+  round_up_to_l2_alignment(size_t bytes) {
+    constexpr size_t L2CacheLineSizeBytes = 128u;
+    return (bytes + L2CacheLineSizeBytes - 1) / L2CacheLineSizeBytes * L2CacheLineSizeBytes;
+  }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 } // namespace detail
 } // namespace kernel
@@ -245,6 +245,13 @@ public:
         {Base::kWarpGemmIterations * warp_idx_k, warp_idx_n});
   }
 
+  /// Returns the warp-level MMA operator, for operators holding per-warp state that the kernel
+  /// sets before the mainloop (e.g. group-wise dequantization scales)
+  CUTLASS_DEVICE
+  Operator &warp_mma() {
+    return warp_mma_;
+  }
+
   /// Advance shared memory read-iterators to the next stage
   CUTLASS_DEVICE
   void advance_smem_read_stage()
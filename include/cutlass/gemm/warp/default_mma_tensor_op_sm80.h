@@ -39,6 +39,7 @@
 #include "cutlass/arch/mma.h"
 #include "cutlass/gemm/warp/mma_tensor_op.h"
 #include "cutlass/gemm/warp/mma_mixed_input_tensor_op.h"
+#include "cutlass/gemm/warp/mma_mixed_input_groupwise_tensor_op.h"
 #include "cutlass/gemm/warp/mma_tensor_op_fast_f32.h"
 #include "cutlass/gemm/warp/default_mma_tensor_op.h"
 
@@ -296,6 +297,58 @@ struct DefaultMmaTensorOp<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Partial Specialization - inputs are mixed types - uses wider datatype internally and
+/// dequantizes the narrower operand with group-wise scales and zero-points.
+/// (e.g. F16 <= F16 x S8 + F32 with per-group scales of the S8 operand)
+template <
+    /// Shape of one matrix production operation (concept: GemmShape)
+    typename WarpShape_,
+    /// Element type of A matrix
+    typename ElementA,
+    /// Layout of A matrix (concept: MatrixLayout)
+    typename LayoutA,
+    /// Element type of B matrix
+    typename ElementB,
+    /// Layout of B matrix (concept: MatrixLayout)
+    typename LayoutB,
+    /// Element type of C matrix
+    typename ElementC,
+    /// Layout of C matrix (concept: MatrixLayout)
+    typename LayoutC,
+    /// Number of partitions along K dimension
+    int PartitionsK,
+    /// Store the accumulators in row major or column major.  Row major is used
+    /// when output layout is interleaved.
+    bool AccumulatorsInRowMajor>
+struct DefaultMmaTensorOp<
+  WarpShape_,
+  GemmShape<16, 8, 16>,                          // InstructionShape
+  ElementA,                                      // Element type of A matrix in Global Memory
+  LayoutA,                                       // Layout of A matrix in Global Memory
+  ElementB,                                      // Element type of B matrix in Global Memory
+  LayoutB,                                       // Layout of B matrix in Global Memory
+  ElementC,                                      // Element type of C matrix in Global Memory
+  LayoutC,                                       // Layout of C matrix in Global Memory
+  arch::OpMultiplyAddMixedInputUpcastGroupwise,  // Tag to indicate mixed-input datatype with group-wise dequantization
+  PartitionsK, AccumulatorsInRowMajor> {
+
+  // The upcast, operand layout and instruction are those of the plain mixed-input operator
+  using Upcast = DefaultMmaTensorOp<
+    WarpShape_, GemmShape<16, 8, 16>,
+    ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+    arch::OpMultiplyAddMixedInputUpcast,
+    PartitionsK, AccumulatorsInRowMajor>;
+
+  using Policy = typename Upcast::Policy;
+
+  // Define the warp-level tensor op
+  using Type = cutlass::gemm::warp::MmaMixedInputGroupwiseTensorOp<
+      WarpShape_, ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+      Policy, PartitionsK, AccumulatorsInRowMajor>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Partial Specialization - inputs are mixed types  - uses wider datatype internally.
 /// (e.g. S32 <= S4 x S8 + S32, S32 <= S8 x S4 + S32)
 template <
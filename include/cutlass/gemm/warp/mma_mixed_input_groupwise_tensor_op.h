@@ -0,0 +1,295 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Warp-level mixed-input matrix multiply-accumulate with group-wise dequantization of the
+      narrow operand in registers.
+
+      The narrow operand is shuffled and upcasted exactly as in MmaMixedInputTensorOp, then each
+      element q is dequantized to q * scale + offset, where offset = -zero * scale, using the scale
+      and zero-point of its group of K. Scales and zero-points are stored in the wide operand's
+      data type as a (K / group_size) x extent matrix, with extent the M (narrow A) or N (narrow B)
+      extent of the problem and a leading dimension of ld_scale.
+
+      The operator keeps the scales of the current group and of the next one in registers. It
+      assumes transform() is called once per mma.sync K-step in increasing K order, which is the
+      case for the multistage threadblock mainloop when kPartitionsK is 1.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/functional.h"
+#include "cutlass/matrix_coord.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/platform/platform.h"
+
+#include "cutlass/arch/mma.h"
+
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/warp/mma_mixed_input_tensor_op.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace gemm {
+namespace warp {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Mixed-input tensor op dequantizing the narrow operand with group-wise scales and zero-points
+template <
+  /// Size of the Gemm problem - concept: gemm::GemmShape<>
+  typename Shape_,
+  /// Data type of A elements
+  typename ElementA_,
+  /// Layout of A matrix (concept: MatrixLayout)
+  typename LayoutA_,
+  /// Data type of B elements
+  typename ElementB_,
+  /// Layout of B matrix (concept: MatrixLayout)
+  typename LayoutB_,
+  /// Element type of C matrix
+  typename ElementC_,
+  /// Layout of C matrix (concept: MatrixLayout)
+  typename LayoutC_,
+  /// Policy describing warp-level MmaTensorOp (concept: MmaTensorOp policy)
+  typename Policy_,
+  /// Number of partitions along K dimension
+  int PartitionsK_ = 1,
+  /// Store the accumulators in row major or column major.  Row major is used
+  /// when output layout is interleaved.
+  bool AccumulatorsInRowMajor = false
+>
+class MmaMixedInputGroupwiseTensorOp : public MmaMixedInputTensorOp<
+  Shape_, ElementA_, LayoutA_, ElementB_, LayoutB_, ElementC_, LayoutC_,
+  Policy_, PartitionsK_, AccumulatorsInRowMajor> {
+public:
+
+  using Base = MmaMixedInputTensorOp<
+    Shape_, ElementA_, LayoutA_, ElementB_, LayoutB_, ElementC_, LayoutC_,
+    Policy_, PartitionsK_, AccumulatorsInRowMajor>;
+
+  using Shape = typename Base::Shape;
+  using ElementA = typename Base::ElementA;
+  using ElementB = typename Base::ElementB;
+  using ElementAMma = typename Base::ElementAMma;
+  using ElementBMma = typename Base::ElementBMma;
+  using InstructionShape = typename Base::InstructionShape;
+  using MmaIterations = typename Base::MmaIterations;
+
+  /// Indicates math operator - distinguishes these kernels from plain mixed-input ones
+  using MathOperator = arch::OpMultiplyAddMixedInputUpcastGroupwise;
+
+  using FragmentA = typename Base::FragmentA;
+  using FragmentB = typename Base::FragmentB;
+  using TransformedFragmentA = typename Base::TransformedFragmentA;
+  using TransformedFragmentB = typename Base::TransformedFragmentB;
+
+  /// Scales and zero-points are stored in the data type of the mma.sync operands
+  using ElementScale = ElementBMma;
+
+  /// True if A is the narrow (quantized) operand, false if B is
+  static bool const kNarrowA = (sizeof_bits<ElementA>::value < sizeof_bits<ElementAMma>::value);
+
+  static_assert(platform::is_same<ElementAMma, ElementBMma>::value,
+    "Group-wise dequantization requires both mma.sync operands in the same data type");
+
+  static_assert(kNarrowA || (sizeof_bits<ElementB>::value < sizeof_bits<ElementBMma>::value),
+    "Group-wise dequantization requires a narrow operand");
+
+  static_assert(Base::kPartitionsK == 1,
+    "Group-wise dequantization requires the warp to visit K in order (kPartitionsK == 1)");
+
+  static_assert(InstructionShape::kM == 16,
+    "Group-wise dequantization assumes the 16-row mma.sync A operand layout");
+
+  /// mma.sync operand fragment of the narrow operand
+  using MmaOperandNarrow = typename platform::conditional<
+    kNarrowA, typename Base::MmaOperandA, typename Base::MmaOperandB>::type;
+
+  /// Number of mma.sync operands of the narrow operand per K-step
+  static int const kNarrowIterations = (kNarrowA ? MmaIterations::kRow : MmaIterations::kColumn);
+
+  /// Extent of one mma.sync operand along the narrow operand's M or N mode
+  static int const kNarrowInstructionExtent = (kNarrowA ? InstructionShape::kM : InstructionShape::kN);
+
+  /// A thread holds rows g and g + 8 of each A operand but a single column g of each B operand
+  static int const kScalesPerIteration = (kNarrowA ? 2 : 1);
+
+  /// Number of scale (and offset) registers per thread
+  static int const kScaleCount = kNarrowIterations * kScalesPerIteration;
+
+  using FragmentScale = Array<ElementScale, kScaleCount>;
+
+private:
+
+  ElementScale const *ptr_scale_;
+  ElementScale const *ptr_zero_;
+  int64_t ld_scale_;
+  int group_size_;
+
+  /// Position along M (narrow A) or N (narrow B) of the thread's first scale
+  int position_;
+
+  /// Extent of the problem along M (narrow A) or N (narrow B)
+  int extent_;
+
+  /// K coordinate of the next transform() and bounds of the warp's K range
+  int k_;
+  int k_begin_;
+  int k_end_;
+
+  FragmentScale scale_;
+  FragmentScale offset_;
+  FragmentScale next_scale_;
+  FragmentScale next_offset_;
+
+public:
+
+  /// Ctor - dequantization is disabled until set_groupwise_scale() provides a scale tensor
+  CUTLASS_DEVICE
+  MmaMixedInputGroupwiseTensorOp():
+    ptr_scale_(nullptr), ptr_zero_(nullptr), ld_scale_(0), group_size_(1),
+    position_(0), extent_(0), k_(0), k_begin_(0), k_end_(0) {}
+
+  /// Sets the scale and zero-point tensors for the warp tile at warp_offset (M, N) of a problem
+  /// of the given (M, N) extent, whose mainloop covers [k_begin, k_end). A null ptr_scale
+  /// disables dequantization. A null ptr_zero denotes zero-points of zero.
+  CUTLASS_DEVICE
+  void set_groupwise_scale(
+    ElementScale const *ptr_scale,
+    ElementScale const *ptr_zero,
+    int64_t ld_scale,
+    int group_size,
+    MatrixCoord const &warp_offset,
+    MatrixCoord const &extent,
+    int k_begin,
+    int k_end,
+    int lane_idx) {
+
+    ptr_scale_ = ptr_scale;
+    ptr_zero_ = ptr_zero;
+    ld_scale_ = ld_scale;
+    group_size_ = group_size;
+    position_ = (kNarrowA ? warp_offset.row() : warp_offset.column()) + lane_idx / 4;
+    extent_ = (kNarrowA ? extent.row() : extent.column());
+    k_ = k_begin;
+    k_begin_ = k_begin;
+    k_end_ = k_end;
+
+    if (ptr_scale_) {
+      load_group_(scale_, offset_, k_begin);
+      load_group_(next_scale_, next_offset_, (k_begin / group_size_ + 1) * group_size_);
+    }
+  }
+
+  /// Transforms the operand fragments as MmaMixedInputTensorOp does and dequantizes the
+  /// narrow operand of the current K-step
+  CUTLASS_DEVICE
+  void transform(TransformedFragmentA &dst_A, TransformedFragmentB &dst_B,
+                 FragmentA const &A, FragmentB const &B) {
+
+    Base::transform(dst_A, dst_B, A, B);
+
+    if (!ptr_scale_) {
+      return;
+    }
+
+    // Group sizes are multiples of the instruction K, so a K-step never straddles two groups
+    if (k_ != k_begin_ && !(k_ % group_size_)) {
+      scale_ = next_scale_;
+      offset_ = next_offset_;
+      load_group_(next_scale_, next_offset_, k_ + group_size_);
+    }
+
+    using Pair = Array<ElementScale, 2>;
+    multiply_add<Pair> mad;
+
+    MmaOperandNarrow *ptr_operand = kNarrowA ?
+      reinterpret_cast<MmaOperandNarrow *>(&dst_A) : reinterpret_cast<MmaOperandNarrow *>(&dst_B);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kNarrowIterations; ++i) {
+
+      Pair *ptr_pair = reinterpret_cast<Pair *>(&ptr_operand[i]);
+
+      // Consecutive pairs of an A operand alternate between rows g and g + 8
+      CUTLASS_PRAGMA_UNROLL
+      for (int p = 0; p < MmaOperandNarrow::kElements / 2; ++p) {
+        int idx = i * kScalesPerIteration + (kNarrowA ? (p % 2) : 0);
+
+        Pair offset;
+        offset.fill(offset_[idx]);
+
+        ptr_pair[p] = mad(scale_[idx], ptr_pair[p], offset);
+      }
+    }
+
+    k_ += InstructionShape::kK;
+  }
+
+private:
+
+  /// Loads the scales of the group containing k, or identity scales beyond the problem
+  CUTLASS_DEVICE
+  void load_group_(FragmentScale &scale, FragmentScale &offset, int k) const {
+
+    int64_t row_offset = int64_t(k / group_size_) * ld_scale_;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int idx = 0; idx < kScaleCount; ++idx) {
+      int position = position_ +
+        (idx / kScalesPerIteration) * kNarrowInstructionExtent + (idx % kScalesPerIteration) * 8;
+
+      float s = 1.0f;
+      float z = 0.0f;
+
+      if (k < k_end_ && position < extent_) {
+        s = float(ptr_scale_[row_offset + position]);
+        if (ptr_zero_) {
+          z = float(ptr_zero_[row_offset + position]);
+        }
+      }
+
+      scale[idx] = ElementScale(s);
+      offset[idx] = ElementScale(-z * s);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace warp
+} // namespace gemm
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +51,8 @@ struct KernelHardwareInfo {
 
   // Kernel properties
   int max_active_clusters = 0;              // Maximum number of clusters that could co-exist on the target device.
+  dim3 cluster_shape = {0, 0, 0};           // Runtime cluster shape for kernels that support it. {0,0,0} selects the static ClusterShape.
+  int l2_cache_size = 0;                    // L2 capacity in bytes. 0 lets consumers that need it query the device.
   //
   // Methods
   //
@@ -77,6 +79,27 @@ struct KernelHardwareInfo {
     return multiprocessor_count;
   }
 
+  static inline int
+  query_device_l2_cache_size(int device_id = 0) {
+    cudaError_t result = cudaGetDevice(&device_id);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST(
+        "  cudaGetDevice() returned error "
+        << cudaGetErrorString(result));
+      return 0;
+    }
+    int l2_cache_size;
+    result = cudaDeviceGetAttribute(&l2_cache_size,
+      cudaDevAttrL2CacheSize, device_id);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST(
+        "  cudaDeviceGetAttribute() returned error "
+        << cudaGetErrorString(result));
+      return 0;
+    }
+    return l2_cache_size;
+  }
+
   // Query maximum number of active clusters that could co-exist on the target device
   // based on kernel properties such as cluster dims and threadblock dims
   static inline int
@@ -1615,6 +1615,29 @@ struct NumericArrayConverter<cutlass::half_t, cutlass::float_e4m3_t, 2, Round> {
         "cvt.rn.f16x2.e4m3x2 %0, %1;\n" \
         "}\n" : "=r"(reg): "h"(src_packed));
 
+    return out;
+  #elif defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+    // Every E4M3 value is exact in FP16. Placing the E4M3 exponent and mantissa in the low
+    // bits of the FP16 fields gives the value scaled by 2^-8 (E4M3 subnormals land on FP16
+    // subnormals), so one multiply finishes the conversion on targets without the FP8 cvt.
+    result_type out;
+    uint32_t& reg = reinterpret_cast<uint32_t&>(out);
+    uint32_t src_packed = static_cast<uint32_t>(reinterpret_cast<uint16_t const&>(source));
+
+    // {x1, 0, x0, 0}: each FP8 byte in the upper byte of a 16-bit lane
+    uint32_t spread;
+    asm volatile("prmt.b32 %0, %1, %2, %3;\n" : "=r"(spread) : "r"(src_packed), "n"(0), "n"(0x1404));
+    uint32_t bits = (spread & 0x80008000u) | ((spread >> 1) & 0x3F803F80u);
+
+    // E4M3 NaN (S.1111.111) is the only code whose magnitude bits are all set
+    uint32_t nan_lanes = (((bits & 0x3F803F80u) + 0x00800080u) & 0x40004000u) >> 14;
+
+    // {2^8, 2^8}
+    static constexpr uint32_t scale_rep = 0x5C005C00;
+    __half2 scaled = __hmul2(reinterpret_cast<__half2 const&>(bits),
+                             reinterpret_cast<__half2 const&>(scale_rep));
+    reg = reinterpret_cast<uint32_t const&>(scaled) | (nan_lanes * 0x7FFFu);
+
     return out;
   #else
     result_type result;
@@ -1694,15 +1717,14 @@ struct NumericArrayConverter<cutlass::half_t, cutlass::float_e5m2_t, 2, Round> {
   CUTLASS_DEVICE
   static result_type convert(source_type const & source) {
 
-  #if defined(CUDA_PTX_FP8_CVT_ENABLED)
+  #if defined(__CUDA_ARCH__)
+    // E5M2 is the upper byte of an FP16 (including Inf and NaN), so a byte permute is exact
+    // and avoids the lower-throughput cvt.
     result_type out;
     uint32_t& reg = reinterpret_cast<uint32_t&>(out);
-    uint16_t const& src_packed = reinterpret_cast<uint16_t const&>(source);
+    uint32_t src_packed = static_cast<uint32_t>(reinterpret_cast<uint16_t const&>(source));
 
-    asm volatile( \
-        "{\n" \
-        "cvt.rn.f16x2.e5m2x2 %0, %1;\n" \
-        "}\n" : "=r"(reg): "h"(src_packed));
+    asm volatile("prmt.b32 %0, %1, %2, %3;\n" : "=r"(reg) : "r"(src_packed), "n"(0), "n"(0x1404));
 
     return out;
   #else
@@ -1789,17 +1811,29 @@ struct NumericArrayConverter<cutlass::bfloat16_t, cutlass::float_e4m3_t, 2, Roun
   CUTLASS_DEVICE
   static result_type convert(source_type const & source) {
 
-  #if defined(CUDA_PTX_FP8_CVT_ENABLED)
-    uint32_t res_half;
-    uint16_t const& src_packed = reinterpret_cast<uint16_t const&>(source);
+  #if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+    // Every E4M3 value is exact in BF16. Placing the E4M3 exponent and mantissa in the low
+    // bits of the BF16 fields gives the value scaled by 2^-120 (E4M3 subnormals land on BF16
+    // subnormals), so one multiply finishes the conversion without going through FP32.
+    result_type out;
+    uint32_t& reg = reinterpret_cast<uint32_t&>(out);
+    uint32_t src_packed = static_cast<uint32_t>(reinterpret_cast<uint16_t const&>(source));
 
-    asm volatile( \
-        "{\n" \
-        "cvt.rn.f16x2.e4m3x2 %0, %1;\n" \
-        "}\n" : "=r"(res_half): "h"(src_packed));
-    float2 res_float = __half22float2(reinterpret_cast<__half2 &>(res_half));
-    NumericArrayConverter<cutlass::bfloat16_t, float, 2, Round> converter;
-    return converter(reinterpret_cast<Array<float, 2> const&>(res_float));
+    // {x1, 0, x0, 0}: each FP8 byte in the upper byte of a 16-bit lane
+    uint32_t spread;
+    asm volatile("prmt.b32 %0, %1, %2, %3;\n" : "=r"(spread) : "r"(src_packed), "n"(0), "n"(0x1404));
+    uint32_t bits = (spread & 0x80008000u) | ((spread >> 4) & 0x07F007F0u);
+
+    // E4M3 NaN (S.1111.111) is the only code whose magnitude bits are all set
+    uint32_t nan_lanes = (((bits & 0x07F007F0u) + 0x00100010u) & 0x08000800u) >> 11;
+
+    // {2^120, 2^120}
+    static constexpr uint32_t scale_rep = 0x7B807B80;
+    __nv_bfloat162 scaled = __hmul2(reinterpret_cast<__nv_bfloat162 const&>(bits),
+                                    reinterpret_cast<__nv_bfloat162 const&>(scale_rep));
+    reg = reinterpret_cast<uint32_t const&>(scaled) | (nan_lanes * 0x7FFFu);
+
+    return out;
   #else
     result_type result;
     NumericConverter<result_element, source_element, Round> converter;
@@ -1891,6 +1925,30 @@ struct NumericArrayConverter<cutlass::bfloat16_t, cutlass::float_e5m2_t, 2, Roun
     float2 res_float = __half22float2(reinterpret_cast<__half2 &>(res_half));
     NumericArrayConverter<cutlass::bfloat16_t, float, 2, Round> converter;
     return converter(reinterpret_cast<Array<float, 2> const&>(res_float));
+  #elif defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+    // Every finite E5M2 value is exact in BF16. Placing the E5M2 exponent and mantissa in the
+    // low bits of the BF16 fields gives the value scaled by 2^-112, as in the E4M3 converter.
+    result_type out;
+    uint32_t& reg = reinterpret_cast<uint32_t&>(out);
+    uint32_t src_packed = static_cast<uint32_t>(reinterpret_cast<uint16_t const&>(source));
+
+    // {x1, 0, x0, 0}: each FP8 byte in the upper byte of a 16-bit lane
+    uint32_t spread;
+    asm volatile("prmt.b32 %0, %1, %2, %3;\n" : "=r"(spread) : "r"(src_packed), "n"(0), "n"(0x1404));
+    uint32_t bits = (spread & 0x80008000u) | ((spread >> 3) & 0x0FE00FE0u);
+
+    // Inf and NaN (S.11111.xx) keep their sign and mantissa under an all ones BF16 exponent
+    uint32_t special_lanes = (((bits & 0x0F800F80u) + 0x00800080u) & 0x10001000u) >> 12;
+    uint32_t special_mask = special_lanes * 0xFFFFu;
+    uint32_t special = (bits & 0x80608060u) | 0x7F807F80u;
+
+    // {2^112, 2^112}
+    static constexpr uint32_t scale_rep = 0x77807780;
+    __nv_bfloat162 scaled = __hmul2(reinterpret_cast<__nv_bfloat162 const&>(bits),
+                                    reinterpret_cast<__nv_bfloat162 const&>(scale_rep));
+    reg = (reinterpret_cast<uint32_t const&>(scaled) & ~special_mask) | (special & special_mask);
+
+    return out;
   #else
     result_type result;
     NumericConverter<result_element, source_element, Round> converter;
@@ -2243,6 +2301,15 @@ struct NumericArrayConverterPacked4Element<cutlass::half_t, cutlass::float_e4m3_
         "cvt.rn.f16x2.e4m3x2 %1, hi;\n" \
         "}\n" : "=r"(out[0]), "=r"(out[1]) : "r"(src_packed));
     return reinterpret_cast<result_type const &>(out);
+  #elif defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+    result_type out;
+    Array<source_element, 2> const* packed_source = reinterpret_cast<Array<source_element, 2> const*>(&source);
+    Array<result_element, 2>* packed_out = reinterpret_cast<Array<result_element, 2>*>(&out);
+    NumericArrayConverter<result_element, source_element, 2, Round> converter;
+    packed_out[0] = converter(packed_source[0]);
+    packed_out[1] = converter(packed_source[1]);
+
+    return out;
   #else
     result_type result;
     NumericConverter<result_element, source_element, Round> converter;
@@ -2332,15 +2399,14 @@ struct NumericArrayConverterPacked4Element<cutlass::half_t, cutlass::float_e5m2_
   CUTLASS_DEVICE
   static result_type convert(source_type const & source) {
 
-  #if defined(CUDA_PTX_FP8_CVT_ENABLED)
+  #if defined(__CUDA_ARCH__)
+    // E5M2 is the upper byte of an FP16, see the two element converter
     uint32_t out[2];
     uint32_t const& src_packed = reinterpret_cast<uint32_t const&>(source);
     asm volatile( \
         "{\n" \
-        ".reg .b16 lo, hi;\n" \
-        "mov.b32 {lo, hi}, %2;\n" \
-        "cvt.rn.f16x2.e5m2x2 %0, lo;\n" \
-        "cvt.rn.f16x2.e5m2x2 %1, hi;\n" \
+        "prmt.b32 %0, %2, 0, 0x1404;\n" \
+        "prmt.b32 %1, %2, 0, 0x3424;\n" \
         "}\n" : "=r"(out[0]), "=r"(out[1]) : "r"(src_packed));
     return reinterpret_cast<result_type const &>(out);
   #else
@@ -2432,18 +2498,13 @@ struct NumericArrayConverterPacked4Element<cutlass::bfloat16_t, cutlass::float_e
   CUTLASS_DEVICE
   static result_type convert(source_type const & source) {
 
-  #if defined(CUDA_PTX_FP8_CVT_ENABLED)
-    // Convert f8 to float
-    NumericArrayConverterPacked4Element<float, source_element, Round> src2float;
-    Array<float, 4> tmp_floats = src2float(source);
-
-    // Convert float to bf16
+  #if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
     result_type out;
-    Array<float, 2>* packed_tmp = reinterpret_cast<Array<float, 2>*>(&tmp_floats);
+    Array<source_element, 2> const* packed_source = reinterpret_cast<Array<source_element, 2> const*>(&source);
     Array<result_element, 2>* packed_out = reinterpret_cast<Array<result_element, 2>*>(&out);
-    NumericArrayConverter<result_element, float, 2, Round> float2result;
-    packed_out[0] = float2result(packed_tmp[0]);
-    packed_out[1] = float2result(packed_tmp[1]);
+    NumericArrayConverter<result_element, source_element, 2, Round> converter;
+    packed_out[0] = converter(packed_source[0]);
+    packed_out[1] = converter(packed_source[1]);
 
     return out;
   #else
@@ -2545,6 +2606,15 @@ struct NumericArrayConverterPacked4Element<cutlass::bfloat16_t, cutlass::float_e
     packed_out[0] = float2result(packed_tmp[0]);
     packed_out[1] = float2result(packed_tmp[1]);
 
+    return out;
+  #elif defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+    result_type out;
+    Array<source_element, 2> const* packed_source = reinterpret_cast<Array<source_element, 2> const*>(&source);
+    Array<result_element, 2>* packed_out = reinterpret_cast<Array<result_element, 2>*>(&out);
+    NumericArrayConverter<result_element, source_element, 2, Round> converter;
+    packed_out[0] = converter(packed_source[0]);
+    packed_out[1] = converter(packed_source[1]);
+
     return out;
   #else
     result_type result;
@@ -2723,10 +2793,22 @@ public:
       packed_result[i] = packed_converter(packed_source[i]);
     }
 
-    // Handle leftovers
+    // Handle leftovers. A pair still goes through the packed two element converter; the
+    // N == 2 instantiation is that converter for types without a dedicated specialization.
+    constexpr int kPairs = (N >= 4) ? (N % 4) / 2 : 0;
+    if constexpr (kPairs > 0) {
+      NumericArrayConverter<result_element, source_element, 2, Round> pair_converter;
+      using packed_pair_result_type = Array<result_element, 2>;
+      using packed_pair_source_type = Array<source_element, 2>;
+      // The pair starts right after the last packed group of 4
+      packed_pair_result_type* pair_result = reinterpret_cast<packed_pair_result_type*>(packed_result + N / 4);
+      const packed_pair_source_type* pair_source = reinterpret_cast<const packed_pair_source_type*>(packed_source + N / 4);
+      *pair_result = pair_converter(*pair_source);
+    }
+
     NumericConverter<result_element, source_element, Round> converter;
     CUTLASS_PRAGMA_UNROLL
-    for (int i = 0; i < N % 4; ++i) {
+    for (int i = 2 * kPairs; i < N % 4; ++i) {
       int idx = ((N / 4) * 4) + i;
       result[idx] = converter(source[idx]);
     }
@@ -4948,6 +5030,307 @@ public:
   }
 };
 
+/// Partial specialization for Array<cutlass::float_e4m3_t, N> <= Array<cutlass::float_e2m1_t, N>
+template <FloatRoundStyle Round, int N>
+struct NumericArrayConverter<cutlass::float_e4m3_t, cutlass::float_e2m1_t, N, Round> {
+  using result_type = Array<cutlass::float_e4m3_t, N>;
+  using source_type = Array<cutlass::float_e2m1_t, N>;
+
+  static FloatRoundStyle const round_style = Round;
+
+private:
+  using result_type_packed_8 = Array<cutlass::float_e4m3_t, 8>;
+  using result_type_packed_4 = Array<cutlass::float_e4m3_t, 4>;
+  using source_type_packed_8 = Array<cutlass::float_e2m1_t, 8>;
+  using source_type_packed_4 = Array<cutlass::float_e2m1_t, 4>;
+
+  using ScalarConverter = NumericConverter<cutlass::float_e4m3_t, cutlass::float_e2m1_t, Round>;
+
+  CUTLASS_DEVICE
+  static uint32_t to_reg(source_type_packed_4 const& source) {
+    return static_cast<uint32_t>(
+      reinterpret_cast<const uint16_t&>(source));
+  }
+
+  CUTLASS_DEVICE
+  static uint32_t to_reg(source_type_packed_8 const& source) {
+    return reinterpret_cast<const uint32_t&>(source);
+  }
+
+  // Every E2M1 value is exactly representable in E4M3, so the converter is a lookup table
+  // indexed by the E2M1 magnitude, in the same way as the i4 -> e4m3 converter.
+  template <typename PackedResultType, typename PackedSrcType>
+  CUTLASS_DEVICE
+  static PackedResultType packed_convert(PackedSrcType const &source) {
+
+    static_assert((platform::is_same<PackedSrcType, source_type_packed_4>::value &&
+                   platform::is_same<PackedResultType, result_type_packed_4>::value) ||
+                  (platform::is_same<PackedSrcType, source_type_packed_8>::value &&
+                   platform::is_same<PackedResultType, result_type_packed_8>::value),
+                  "Invalid PackedSrcType/PackedResultType must be 4 or 8 to use private convert dispatch.");
+
+    // Hold FP8 outputs in reg. We need 1 reg for every 4 outputs.
+    cutlass::AlignedArray<uint32_t, PackedResultType::kElements / 4, sizeof(PackedResultType)> r;
+
+    // View the input as reg
+    uint32_t reg = to_reg(source);
+
+    // Determines if to get from the signed or unsigned candidates
+    uint32_t sign = (reg & 0x88888888) >> 1;
+
+    // Ignore sign bit when indexing into LUT
+    uint32_t lut_idx = (reg & 0x77777777);
+
+    // Signed is OR'd with 0x32103210 to find the correct value in the LUT
+    const uint32_t final_prmt_base = 0x32103210;
+
+    // [0, 0.5, 1, 1.5] encoded as FP8
+    static constexpr uint32_t POS_E4M3s_REG1 = 0x3C383000;
+    // [2, 3, 4, 6] encoded as FP8
+    static constexpr uint32_t POS_E4M3s_REG2 = 0x4C484440;
+    // [-0, -0.5, -1, -1.5] encoded as FP8
+    static constexpr uint32_t NEG_E4M3s_REG1 = 0xBCB8B080;
+    // [-2, -3, -4, -6] encoded as FP8
+    static constexpr uint32_t NEG_E4M3s_REG2 = 0xCCC8C4C0;
+
+    const int iters = PackedSrcType::kElements / 4;
+    #pragma unroll
+    for (int ii = 0; ii < iters; ++ii, lut_idx >>=16, sign >>=16) {
+      uint32_t final_prmt_idx = final_prmt_base | sign;
+
+      // Select both the positive and negative candidates, then use the sign bit to
+      // select the correct candidate.
+      asm volatile(
+          "{\n"
+          "  .reg .b32 pos_f8s, neg_f8s;\n"
+          "  prmt.b32 pos_f8s, %1, %2, %5;\n"
+          "  prmt.b32 neg_f8s, %3, %4, %5;\n"
+          "  prmt.b32 %0, pos_f8s, neg_f8s, %6;\n"
+          "}\n"
+          : "=r"(r[ii])
+          : "n"(POS_E4M3s_REG1), "n"(POS_E4M3s_REG2), "n"(NEG_E4M3s_REG1), "n"(NEG_E4M3s_REG2),
+            "r"(lut_idx), "r"(final_prmt_idx));
+    }
+    return reinterpret_cast<PackedResultType&>(r);
+  }
+
+  friend class detail::VectorizedConverter;
+
+public:
+  CUTLASS_DEVICE
+  static result_type convert(source_type const &source) {
+    result_type result;
+    using ConverterType = NumericArrayConverter<typename result_type::Element, typename source_type::Element, N, Round>;
+    detail::VectorizedConverter::convert<ConverterType,
+                                         result_type_packed_8, source_type_packed_8,
+                                         result_type_packed_4, source_type_packed_4>(result, source);
+
+    return result;
+  }
+
+  CUTLASS_DEVICE
+  result_type operator()(source_type const &s) const {
+    return convert(s);
+  }
+};
+
+/// Partial specialization for Array<cutlass::half_t, N> <= Array<cutlass::float_e2m1_t, N>
+template <FloatRoundStyle Round, int N>
+struct NumericArrayConverter<cutlass::half_t, cutlass::float_e2m1_t, N, Round> {
+  using result_type = Array<cutlass::half_t, N>;
+  using source_type = Array<cutlass::float_e2m1_t, N>;
+
+  static FloatRoundStyle const round_style = Round;
+
+private:
+  using result_type_packed_8 = Array<cutlass::half_t, 8>;
+  using result_type_packed_4 = Array<cutlass::half_t, 4>;
+  using result_type_packed_2 = Array<cutlass::half_t, 2>;
+  using source_type_packed_8 = Array<cutlass::float_e2m1_t, 8>;
+  using source_type_packed_4 = Array<cutlass::float_e2m1_t, 4>;
+  using source_type_packed_2 = Array<cutlass::float_e2m1_t, 2>;
+
+  using ScalarConverter = NumericConverter<cutlass::half_t, cutlass::float_e2m1_t, Round>;
+
+  CUTLASS_DEVICE
+  static uint32_t to_reg(source_type_packed_2 const& source) {
+    return static_cast<uint32_t>(
+      reinterpret_cast<const uint8_t&>(source));
+  }
+
+  CUTLASS_DEVICE
+  static uint32_t to_reg(source_type_packed_4 const& source) {
+    return static_cast<uint32_t>(
+      reinterpret_cast<const uint16_t&>(source));
+  }
+
+  CUTLASS_DEVICE
+  static uint32_t to_reg(source_type_packed_8 const& source) {
+    return reinterpret_cast<const uint32_t&>(source);
+  }
+
+  // The core converter moves the E2M1 exponent and mantissa into the low exponent bits and the
+  // top mantissa bit of an FP16. That FP16 is the E2M1 value scaled by 2^-14 (E2M1 subnormals
+  // land on FP16 subnormals), so a single multiply by 2^14 gives the exact result.
+  template <typename PackedResultType, typename PackedSrcType>
+  CUTLASS_DEVICE
+  static PackedResultType packed_convert(PackedSrcType const &source) {
+
+    static_assert((platform::is_same<PackedSrcType, source_type_packed_2>::value &&
+                   platform::is_same<PackedResultType, result_type_packed_2>::value) ||
+                  (platform::is_same<PackedSrcType, source_type_packed_4>::value &&
+                   platform::is_same<PackedResultType, result_type_packed_4>::value) ||
+                  (platform::is_same<PackedSrcType, source_type_packed_8>::value &&
+                   platform::is_same<PackedResultType, result_type_packed_8>::value),
+                  "Invalid PackedSrcType/PackedResultType must be 2, 4 or 8 to use private convert dispatch.");
+
+    // Hold output FP16s in reg. We need 1 reg for every 2 elements
+    using RegArray = cutlass::AlignedArray<uint32_t, PackedResultType::kElements / 2, sizeof(PackedResultType)>;
+    RegArray r;
+
+    // View the input as reg
+    uint32_t src_reg = to_reg(source);
+
+    // Each byte of the source holds two E2M1 values and produces one FP16x2:
+    //   low  FP16 : sign from bit 3, exponent/mantissa from bits [2:0] placed at bits [11:9]
+    //   high FP16 : sign from bit 7, exponent/mantissa from bits [6:4] placed at bits [27:25]
+    CUTLASS_PRAGMA_UNROLL
+    for (int ii = 0; ii < RegArray::kElements; ++ii) {
+      uint32_t x = (src_reg >> (8 * ii)) & 0xFF;
+      r[ii] = ((x & 0x07) <<  9) | ((x & 0x08) << 12) |
+              ((x & 0x70) << 21) | ((x & 0x80) << 24);
+    }
+
+    // {2^14, 2^14}
+    static constexpr uint32_t scale_rep = 0x74007400;
+    const half2& scale = reinterpret_cast<const half2&>(scale_rep);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int ii = 0; ii < RegArray::kElements; ++ii) {
+      half2& fp16x2_val = reinterpret_cast<__half2&>(r[ii]);
+      fp16x2_val = __hmul2(fp16x2_val, scale);
+    }
+    return reinterpret_cast<PackedResultType&>(r);
+  }
+
+  friend class detail::VectorizedConverter;
+
+public:
+  CUTLASS_DEVICE
+  static result_type convert(source_type const &source) {
+    result_type result;
+    using ConverterType = NumericArrayConverter<typename result_type::Element, typename source_type::Element, N, Round>;
+    detail::VectorizedConverter::convert<ConverterType,
+                                         result_type_packed_8, source_type_packed_8,
+                                         result_type_packed_4, source_type_packed_4,
+                                         result_type_packed_2, source_type_packed_2>(result, source);
+
+    return result;
+  }
+
+  CUTLASS_DEVICE
+  result_type operator()(source_type const &s) const {
+    return convert(s);
+  }
+};
+
+/// Partial specialization for Array<cutlass::bfloat16_t, N> <= Array<cutlass::float_e2m1_t, N>
+template <FloatRoundStyle Round, int N>
+struct NumericArrayConverter<cutlass::bfloat16_t, cutlass::float_e2m1_t, N, Round> {
+  using result_type = Array<cutlass::bfloat16_t, N>;
+  using source_type = Array<cutlass::float_e2m1_t, N>;
+
+  static FloatRoundStyle const round_style = Round;
+
+private:
+  using result_type_packed_8 = Array<cutlass::bfloat16_t, 8>;
+  using result_type_packed_4 = Array<cutlass::bfloat16_t, 4>;
+  using result_type_packed_2 = Array<cutlass::bfloat16_t, 2>;
+  using source_type_packed_8 = Array<cutlass::float_e2m1_t, 8>;
+  using source_type_packed_4 = Array<cutlass::float_e2m1_t, 4>;
+  using source_type_packed_2 = Array<cutlass::float_e2m1_t, 2>;
+
+  using ScalarConverter = NumericConverter<cutlass::bfloat16_t, cutlass::float_e2m1_t, Round>;
+
+  // Every E2M1 value is exactly representable in FP16 and BF16, so go through the FP16 converter.
+  template <typename PackedResultType, typename PackedSrcType>
+  CUTLASS_DEVICE
+  static PackedResultType packed_convert(PackedSrcType const &source) {
+
+    static_assert((platform::is_same<PackedSrcType, source_type_packed_2>::value &&
+                   platform::is_same<PackedResultType, result_type_packed_2>::value) ||
+                  (platform::is_same<PackedSrcType, source_type_packed_4>::value &&
+                   platform::is_same<PackedResultType, result_type_packed_4>::value) ||
+                  (platform::is_same<PackedSrcType, source_type_packed_8>::value &&
+                   platform::is_same<PackedResultType, result_type_packed_8>::value),
+                  "Invalid PackedSrcType/PackedResultType must be 2, 4 or 8 to use private convert dispatch.");
+
+    constexpr int kElements = PackedResultType::kElements;
+    using HalfConverter = NumericArrayConverter<cutlass::half_t, cutlass::float_e2m1_t, kElements, Round>;
+    Array<cutlass::half_t, kElements> tmp = HalfConverter::convert(source);
+
+    using RegArray = cutlass::AlignedArray<uint32_t, kElements / 2, sizeof(PackedResultType)>;
+    RegArray r;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int ii = 0; ii < RegArray::kElements; ++ii) {
+      float2 f = __half22float2(reinterpret_cast<const __half2&>(tmp[2 * ii]));
+      reinterpret_cast<__nv_bfloat162&>(r[ii]) = __float22bfloat162_rn(f);
+    }
+    return reinterpret_cast<PackedResultType&>(r);
+  }
+
+  friend class detail::VectorizedConverter;
+
+public:
+  CUTLASS_DEVICE
+  static result_type convert(source_type const &source) {
+    result_type result;
+    using ConverterType = NumericArrayConverter<typename result_type::Element, typename source_type::Element, N, Round>;
+    detail::VectorizedConverter::convert<ConverterType,
+                                         result_type_packed_8, source_type_packed_8,
+                                         result_type_packed_4, source_type_packed_4,
+                                         result_type_packed_2, source_type_packed_2>(result, source);
+
+    return result;
+  }
+
+  CUTLASS_DEVICE
+  result_type operator()(source_type const &s) const {
+    return convert(s);
+  }
+};
+
+/// Partial specialization for Array<cutlass::bfloat16_t, N> <= Array<cutlass::float_ue8m0_t, N>
+template <FloatRoundStyle Round, int N>
+struct NumericArrayConverter<cutlass::bfloat16_t, cutlass::float_ue8m0_t, N, Round> {
+  using result_type = Array<cutlass::bfloat16_t, N>;
+  using source_type = Array<cutlass::float_ue8m0_t, N>;
+
+  static FloatRoundStyle const round_style = Round;
+
+  // E8M0 shares the BF16 exponent field, so placing the byte at bits [14:7] gives the exact
+  // value. Only 2^-127 (a BF16 subnormal) and NaN need special encodings.
+  CUTLASS_DEVICE
+  static result_type convert(source_type const &source) {
+    result_type result;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      uint8_t s = source[i].storage;
+      uint16_t bits = s == 0 ? uint16_t(0x0040) :
+                      s == 0xFF ? uint16_t(0x7FFF) :
+                      uint16_t(uint16_t(s) << 7);
+      result[i] = cutlass::bfloat16_t::bitcast(bits);
+    }
+    return result;
+  }
+
+  CUTLASS_DEVICE
+  result_type operator()(source_type const &s) const {
+    return convert(s);
+  }
+};
+
 /// Partial specialization for Array<cutlass::bfloat16_t, N> <= Array<int8_t, N>
 template <FloatRoundStyle Round, int N>
 struct NumericArrayConverter<cutlass::bfloat16_t, int8_t, N, Round> {
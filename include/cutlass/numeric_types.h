@@ -81,6 +81,7 @@ struct get_unpacked_element_type {
 #include "cutlass/bfloat16.h"
 #include "cutlass/tfloat32.h"
 #include "cutlass/float8.h"
+#include "cutlass/float_subbyte.h"
 #include "cutlass/uint128.h"
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
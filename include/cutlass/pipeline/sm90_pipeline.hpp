@@ -41,6 +41,7 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/arch/barrier.h"
+#include "cutlass/arch/perf_trace.hpp"
 #include "cutlass/detail/dependent_false.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -384,12 +385,16 @@ public:
   PipelineTmaAsync(SharedStorage& storage, Params params, ClusterShape cluster_shape, InitBarriers = {})
       : PipelineTmaAsync(storage, params, cluster_shape, InitBarriers{}, cute::true_type{}) { }
 
+  // Blocks in different L slices of the cluster (e.g. the k splits of a split-K cluster) share no multicast loads
   template <class ClusterShape>
   CUTLASS_DEVICE
   bool is_same_row_or_col(int dst_block_id, dim3 block_id, ClusterShape cluster_shape) {
-    return (((dst_block_id % cute::size<0>(cluster_shape)) == block_id.x) ||
+    int const cluster_mn = cute::size<0>(cluster_shape) * cute::size<1>(cluster_shape);
+    int const dst_block_id_mn = dst_block_id % cluster_mn;
+    return ((dst_block_id / cluster_mn) == block_id.z) &&
+           (((dst_block_id_mn % cute::size<0>(cluster_shape)) == block_id.x) ||
             (
-              ((dst_block_id / cute::size<0>(cluster_shape)) == block_id.y)
+              ((dst_block_id_mn / cute::size<0>(cluster_shape)) == block_id.y)
             ));
   }
 
@@ -498,9 +503,11 @@ private:
   CUTLASS_DEVICE
   void producer_acquire(uint32_t stage, uint32_t phase, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_async, cutlass::arch::perf_trace_op_producer_acquire_begin, stage);
     if (barrier_token != BarrierStatus::WaitDone) {
       empty_barrier_ptr_[stage].wait(phase);
     }
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_async, cutlass::arch::perf_trace_op_producer_acquire_end, stage);
 
     if (params_.is_leader) {
       full_barrier_ptr_[stage].arrive_and_expect_tx(params_.transaction_bytes);
@@ -570,16 +577,20 @@ private:
   CUTLASS_DEVICE
   void consumer_wait(uint32_t stage, uint32_t phase) {
     detail::pipeline_check_is_consumer(params_.role);
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_async, cutlass::arch::perf_trace_op_consumer_wait_begin, stage);
     full_barrier_ptr_[stage].wait(phase);
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_async, cutlass::arch::perf_trace_op_consumer_wait_end, stage);
   }
 
   // Wait for producer to commit transactions (done by TMA)
   CUTLASS_DEVICE
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_async, cutlass::arch::perf_trace_op_consumer_wait_begin, stage);
     if (barrier_token == BarrierStatus::WaitAgain) {
       full_barrier_ptr_[stage].wait(phase);
     }
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_async, cutlass::arch::perf_trace_op_consumer_wait_end, stage);
   }
 
   // Consumer signalling Producer of completion
@@ -588,6 +599,7 @@ private:
   void consumer_release(uint32_t stage, uint32_t skip = false) {
     detail::pipeline_check_is_consumer(params_.role);
     empty_barrier_ptr_[stage].arrive(dst_blockid_, is_signaling_thread_ & (!skip));
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_async, cutlass::arch::perf_trace_op_consumer_release, stage);
     #ifndef NDEBUG
     if (params_.role == ThreadCategory::Producer || params_.role == ThreadCategory::NonParticipant) {
       asm volatile ("brkpt;\n" ::);
@@ -601,6 +613,266 @@ private:
   }
 };
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TMA load (producer) Async Pipeline class with independent consumer groups
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Circular Buffer Index + Associated Phase over a runtime-sized window [base, base + stages)
+// of a pipeline's smem stages. index() returns the absolute stage.
+struct PipelineStateDynamic {
+
+  uint32_t base_ = 0;
+  uint32_t stages_ = 1;
+  uint32_t index_ = 0;
+  uint32_t phase_ = 0;
+  uint32_t count_ = 0;
+
+  CUTLASS_DEVICE
+  PipelineStateDynamic() {}
+
+  CUTLASS_DEVICE
+  PipelineStateDynamic(uint32_t base, uint32_t stages, uint32_t index, uint32_t phase, uint32_t count)
+    : base_(base)
+    , stages_(stages)
+    , index_(index)
+    , phase_(phase)
+    , count_(count) {}
+
+  CUTLASS_DEVICE
+  int index() const {
+    return static_cast<int>(base_ + index_);
+  }
+
+  CUTLASS_DEVICE
+  uint32_t phase() const {
+    return phase_;
+  }
+
+  CUTLASS_DEVICE
+  uint32_t count() const {
+    return count_;
+  }
+
+  CUTLASS_DEVICE
+  void operator++() {
+    ++index_;
+    ++count_;
+    if (index_ == stages_) {
+      index_ = 0;
+      phase_ ^= 1;
+    }
+  }
+};
+
+// Each consumer group owns a disjoint window of the Stages smem buffers. The window depths are
+// chosen at runtime through Params::group_stages, e.g. to give a data-dependent expensive group
+// deeper buffering. Every stage's empty barrier counts only the arrivals of its owning group, and
+// the producer tracks one PipelineStateDynamic per group, so a slow group back-pressures only the
+// loads destined to it. Within a group, stages are produced and consumed in order.
+// Assumptions : cluster size 1, exactly one producer thread elected as the leader
+template <int Stages_, int NumConsumerGroups_>
+class PipelineTmaAsyncMultiConsumer {
+public:
+  using FullBarrier = cutlass::arch::ClusterTransactionBarrier;
+  using EmptyBarrier = cutlass::arch::ClusterBarrier;
+  using ProducerBarrierType = FullBarrier::ValueType;
+  using ConsumerBarrierType = EmptyBarrier::ValueType;
+  static constexpr uint32_t Stages = Stages_;
+  static constexpr uint32_t NumConsumerGroups = NumConsumerGroups_;
+  using PipelineState = cutlass::PipelineStateDynamic;
+
+  static_assert(NumConsumerGroups > 0 && Stages >= NumConsumerGroups,
+    "Every consumer group needs at least one stage.");
+
+  struct SharedStorage {
+    FullBarrier full_barrier_[Stages];
+    EmptyBarrier empty_barrier_[Stages];
+  };
+
+  enum class ThreadCategory {
+    NonParticipant,
+    Producer,
+    Consumer,
+    ProducerConsumer
+  };
+
+  struct Params {
+    uint32_t transaction_bytes = 0;
+    ThreadCategory role = ThreadCategory::NonParticipant;
+    uint32_t is_leader = 0;
+    uint32_t num_producers = 1;                        // Number of producer threads
+    uint32_t num_consumers[NumConsumerGroups] = {};    // Number of consumer threads of each group
+    uint32_t group_stages[NumConsumerGroups] = {};     // Stages owned by each group, all 0 for an even split
+  };
+
+  // Number of stages owned by a consumer group
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  group_depth(Params const& params, uint32_t group) {
+    if (params.group_stages[0] == 0) {
+      return Stages / NumConsumerGroups + (group < Stages % NumConsumerGroups ? 1 : 0);
+    }
+    return params.group_stages[group];
+  }
+
+  // First stage owned by a consumer group
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  group_base(Params const& params, uint32_t group) {
+    uint32_t base = 0;
+    for (uint32_t g = 0; g < group; ++g) {
+      base += group_depth(params, g);
+    }
+    return base;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  can_implement(Params const& params) {
+    uint32_t total = 0;
+    for (uint32_t g = 0; g < NumConsumerGroups; ++g) {
+      if (group_depth(params, g) == 0 || params.num_consumers[g] == 0) {
+        return false;
+      }
+      total += group_depth(params, g);
+    }
+    return total <= Stages;
+  }
+
+  static
+  CUTLASS_DEVICE
+  void
+  init_barriers(SharedStorage& storage, Params params) {
+    int warp_idx = canonical_warp_idx_sync();
+    bool is_initializing_warp = (warp_idx == 0);
+    if (is_initializing_warp && cute::elect_one_sync()) {
+      for (uint32_t g = 0; g < NumConsumerGroups; ++g) {
+        uint32_t base = group_base(params, g);
+        for (uint32_t stage = base; stage < base + group_depth(params, g); ++stage) {
+          storage.full_barrier_[stage].init(params.num_producers);
+          storage.empty_barrier_[stage].init(params.num_consumers[g]);
+        }
+      }
+    }
+    cutlass::arch::fence_barrier_init();
+  }
+
+  template<class InitBarriers = cute::true_type>
+  CUTLASS_DEVICE
+  PipelineTmaAsyncMultiConsumer(SharedStorage& storage, Params params, InitBarriers = {})
+      : params_(params)
+      , full_barrier_ptr_(&storage.full_barrier_[0])
+      , empty_barrier_ptr_(&storage.empty_barrier_[0]) {
+    static_assert(cute::is_same_v<InitBarriers, cute::true_type> || cute::is_same_v<InitBarriers, cute::false_type>);
+    if constexpr (cute::is_same_v<InitBarriers, cute::true_type>) {
+      init_barriers(storage, params_);
+    }
+  }
+
+  // Producer starts with an opposite phase as the buffers are initially empty
+  CUTLASS_DEVICE
+  PipelineState make_producer_start_state(uint32_t group) const {
+    return {group_base(params_, group), group_depth(params_, group), 0, 1, 0};
+  }
+
+  CUTLASS_DEVICE
+  PipelineState make_consumer_start_state(uint32_t group) const {
+    return {group_base(params_, group), group_depth(params_, group), 0, 0, 0};
+  }
+
+  ////////////////////
+  // Producer APIs
+  ////////////////////
+
+  CUTLASS_DEVICE
+  ProducerToken producer_try_acquire(PipelineState state, uint32_t skip_wait = false) {
+    detail::pipeline_check_is_producer(params_.role);
+    if (skip_wait) {
+      return {BarrierStatus::WaitDone};
+    }
+    bool barrier_status = empty_barrier_ptr_[state.index()].try_wait(state.phase());
+    return {static_cast<BarrierStatus>(barrier_status)};
+  }
+
+  // Waits only for the group that owns the stage to release it
+  CUTLASS_DEVICE
+  void producer_acquire(PipelineState state, ProducerToken barrier_token = {BarrierStatus::WaitAgain}) {
+    detail::pipeline_check_is_producer(params_.role);
+    if (barrier_token != BarrierStatus::WaitDone) {
+      empty_barrier_ptr_[state.index()].wait(state.phase());
+    }
+    if (params_.is_leader) {
+      full_barrier_ptr_[state.index()].arrive_and_expect_tx(params_.transaction_bytes);
+    }
+  }
+
+  // Transaction bytes of the stage when they differ between groups, instead of Params::transaction_bytes
+  CUTLASS_DEVICE
+  void producer_acquire(PipelineState state, uint32_t transaction_bytes) {
+    detail::pipeline_check_is_producer(params_.role);
+    empty_barrier_ptr_[state.index()].wait(state.phase());
+    if (params_.is_leader) {
+      full_barrier_ptr_[state.index()].arrive_and_expect_tx(transaction_bytes);
+    }
+  }
+
+  // NOP for TMA based mainloop
+  CUTLASS_DEVICE
+  void producer_commit(PipelineState, uint32_t) { }
+
+  // Prevents early exit of the producer while a consumer group still holds buffers.
+  // Called once per group with that group's producer state before the kernel exits.
+  CUTLASS_DEVICE
+  void producer_tail(PipelineState state) {
+    detail::pipeline_check_is_producer(params_.role);
+    for (uint32_t count = 0; count < state.stages_; ++count) {
+      empty_barrier_ptr_[state.index()].wait(state.phase());
+      ++state;
+    }
+  }
+
+  CUTLASS_DEVICE
+  ProducerBarrierType* producer_get_barrier(PipelineState state) {
+    return reinterpret_cast<ProducerBarrierType*>(&full_barrier_ptr_[state.index()]);
+  }
+
+  ////////////////////
+  // Consumer APIs
+  ////////////////////
+
+  CUTLASS_DEVICE
+  ConsumerToken consumer_try_wait(PipelineState state, uint32_t skip_wait = false) {
+    detail::pipeline_check_is_consumer(params_.role);
+    if (skip_wait) {
+      return {BarrierStatus::WaitDone};
+    }
+    bool barrier_status = full_barrier_ptr_[state.index()].try_wait(state.phase());
+    return {static_cast<BarrierStatus>(barrier_status)};
+  }
+
+  CUTLASS_DEVICE
+  void consumer_wait(PipelineState state, ConsumerToken barrier_token = {BarrierStatus::WaitAgain}) {
+    detail::pipeline_check_is_consumer(params_.role);
+    if (barrier_token == BarrierStatus::WaitAgain) {
+      full_barrier_ptr_[state.index()].wait(state.phase());
+    }
+  }
+
+  // Every consumer thread of the owning group arrives
+  CUTLASS_DEVICE
+  void consumer_release(PipelineState state) {
+    detail::pipeline_check_is_consumer(params_.role);
+    empty_barrier_ptr_[state.index()].arrive();
+  }
+
+private:
+  Params params_;
+  FullBarrier *full_barrier_ptr_ = nullptr;
+  EmptyBarrier *empty_barrier_ptr_ = nullptr;
+};
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // TMA store pipeline class
@@ -655,15 +927,18 @@ private:
   // or until at most UnacquiredStages TMA store batches are in-flight (if specified)
   CUTLASS_DEVICE
   void producer_acquire([[maybe_unused]] uint32_t stage, uint32_t count) {
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_store, cutlass::arch::perf_trace_op_producer_acquire_begin, stage);
     if (params_.always_wait || count > UnacquiredStages) {
       tma_store_wait<UnacquiredStages>();
     }
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_store, cutlass::arch::perf_trace_op_producer_acquire_end, stage);
   }
 
   // Commit the most recently issued batch of TMA stores
   CUTLASS_DEVICE
   void producer_commit([[maybe_unused]] uint32_t stage, [[maybe_unused]] uint32_t count) {
     tma_store_arrive();
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_tma_store, cutlass::arch::perf_trace_op_producer_commit, stage);
   }
 };
 
@@ -888,9 +1163,11 @@ private:
   CUTLASS_DEVICE
   void producer_acquire(uint32_t stage, uint32_t phase, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_transaction_async, cutlass::arch::perf_trace_op_producer_acquire_begin, stage);
     if (barrier_token == BarrierStatus::WaitAgain) {
       empty_barrier_ptr_[stage].wait(phase);
     }
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_transaction_async, cutlass::arch::perf_trace_op_producer_acquire_end, stage);
   }
 
   // Perform an expect-tx operation on the stage's full barrier. Must be called by 1 thread
@@ -904,6 +1181,7 @@ private:
   void producer_commit(uint32_t stage) {
     detail::pipeline_check_is_producer(params_.role);
     full_barrier_ptr_[stage].arrive(params_.dst_blockid);
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_transaction_async, cutlass::arch::perf_trace_op_producer_commit, stage);
   }
 
   CUTLASS_DEVICE
@@ -934,15 +1212,18 @@ private:
   CUTLASS_DEVICE
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_transaction_async, cutlass::arch::perf_trace_op_consumer_wait_begin, stage);
     if (barrier_token == BarrierStatus::WaitAgain) {
       full_barrier_ptr_[stage].wait(phase);
     }
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_transaction_async, cutlass::arch::perf_trace_op_consumer_wait_end, stage);
   }
 
   CUTLASS_DEVICE
   void consumer_release(uint32_t stage, uint32_t skip = false) {
     detail::pipeline_check_is_consumer(params_.role);
     empty_barrier_ptr_[stage].arrive(params_.dst_blockid, (not skip));
+    cutlass::arch::perf_trace_emit(cutlass::arch::perf_trace_pipeline_transaction_async, cutlass::arch::perf_trace_op_consumer_release, stage);
   }
 };
 
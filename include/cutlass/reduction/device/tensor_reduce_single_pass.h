@@ -0,0 +1,455 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Single-pass reduction over an arbitrary subset of the ranks of an affine tensor
+
+  Unlike TensorReductionAffineContiguous and TensorReductionAffineStrided, the reduced ranks need
+  not be leading or trailing, and reductions split across CTAs are completed by the last CTA to
+  finish within the same launch instead of by a second kernel. A pre-operator is applied to each
+  converted source element (e.g. cutlass::square or cutlass::absolute_value_op for norms) and a
+  post-operator to each result before it is converted to the output type (e.g.
+  kernel::TensorReductionScale for a mean; a narrow ElementOutput quantizes with the rounding
+  style Round).
+
+  The problem is described by a rank-N source and destination layout of identical shape, where the
+  destination has a stride of zero along each reduced rank. With CuTe:
+
+    auto src = make_layout(make_shape(B, H, S, D));                 // packed BHSD
+    auto dst = make_layout(shape(src), make_stride(H, 1, 0, 0));    // reduce S and D
+    TensorReductionSinglePass<4, float, half_t, plus<float>, float> reduction(src, dst);
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/device_kernel.h"
+#include "cute/layout.hpp"
+
+#include "cutlass/reduction/kernel/tensor_reduce_single_pass.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace reduction {
+namespace device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Single-pass tensor reduction operator on layouts which are affine
+template <
+  int MaxRank,                                ///< Maximum rank of source tensor
+  typename ElementOutput_,
+  typename ElementSource_,
+  typename ReductionOp_,
+  typename ElementCompute_ = ElementOutput_,
+  typename PreOp_ = kernel::TensorReductionPassThrough<ElementCompute_>,
+  typename PostOp_ = kernel::TensorReductionPassThrough<ElementCompute_>,
+  FloatRoundStyle Round = FloatRoundStyle::round_to_nearest,
+  int Threads = 256,                          ///< Number of participating threads
+  int BatchSize = 4                           ///< Number of elements to load per batch
+>
+struct TensorReductionSinglePass {
+
+  static int const kMaxRank = MaxRank;
+  static int const kThreads = Threads;
+  static int const kBatchSize = BatchSize;
+
+  /// Minimum number of batches each thread loads before the reduced space is split across CTAs
+  static int const kMinBatchesPerThread = 4;
+
+  using ElementOutput = ElementOutput_;
+  using ElementSource = ElementSource_;
+  using ReductionOp = ReductionOp_;
+  using ElementCompute = ElementCompute_;
+  using PreOp = PreOp_;
+  using PostOp = PostOp_;
+
+  using ReductionKernel = kernel::TensorReductionSinglePass<
+    kMaxRank,
+    ElementOutput,
+    ElementSource,
+    ReductionOp,
+    ElementCompute,
+    PreOp,
+    PostOp,
+    Round,
+    kThreads,
+    kBatchSize>;
+
+  using Params = typename ReductionKernel::Params;
+
+  //
+  // Data members
+  //
+
+  /// Internal status field
+  Status status;
+
+  /// Mapping of the problem, completed with pointers and operators by reduce()
+  Params params;
+
+  /// CUDA Grid shape (.x => outputs, .y => splits of the reduced index space)
+  dim3 grid_shape;
+
+  /// CUDA Threadblock shape (reduced index space along .x if params.reduce_along_x, else along .y)
+  dim3 threadblock_shape;
+
+private:
+
+  /// Rank of the source tensor
+  struct Mode {
+    int64_t extent;
+    int64_t src_stride;
+    int64_t dst_stride;
+  };
+
+  /// Smallest power of two no less than 'count', clamped to 'bound'
+  static int pow2_bound(uint64_t count, int bound) {
+    int x = 1;
+    while (x < bound && uint64_t(x) < count) {
+      x <<= 1;
+    }
+    return x;
+  }
+
+  /// Size (in bytes) of the partial results exchanged between the CTAs of a column
+  int64_t partials_size() const {
+    int64_t bytes = int64_t(params.outer_count) * grid_shape.y * int64_t(sizeof(ElementCompute));
+    return (bytes + 127) / 128 * 128;
+  }
+
+  /// Plans the parallel mapping strategy
+  void initialize(
+    int rank,
+    int64_t const extent[],
+    int64_t const src_stride[],
+    int64_t const dst_stride[],
+    int target_threadblock_count) {
+
+    status = Status::kSuccess;
+
+    if (rank < 0 || rank > kMaxRank) {
+      status = Status::kErrorInvalidProblem;
+      return;
+    }
+
+    //
+    // Separate kept and reduced ranks, dropping degenerate ones
+    //
+
+    Mode outer[kMaxRank];
+    Mode inner[kMaxRank];
+    int outer_rank = 0;
+    int inner_rank = 0;
+
+    params.outer_count = 1;
+    params.inner_count = 1;
+
+    for (int p = 0; p < rank; ++p) {
+      if (extent[p] < 0) {
+        status = Status::kErrorInvalidProblem;
+        return;
+      }
+      if (extent[p] == 0) {
+        // An empty reduced rank yields the identity, an empty kept rank yields no outputs
+        if (dst_stride[p] == 0) {
+          params.inner_count = 0;
+        }
+        else {
+          params.outer_count = 0;
+        }
+      }
+      if (extent[p] <= 1) {
+        continue;
+      }
+      Mode mode{extent[p], src_stride[p], dst_stride[p]};
+      if (dst_stride[p] == 0) {
+        inner[inner_rank++] = mode;
+        params.inner_count *= uint64_t(extent[p]);
+      }
+      else {
+        outer[outer_rank++] = mode;
+        params.outer_count *= uint64_t(extent[p]);
+      }
+    }
+
+    // Order each space by decreasing source stride so that the last rank varies fastest
+    auto by_decreasing_stride = [](Mode const &a, Mode const &b) {
+      return std::abs(a.src_stride) > std::abs(b.src_stride);
+    };
+    std::stable_sort(outer, outer + outer_rank, by_decreasing_stride);
+    std::stable_sort(inner, inner + inner_rank, by_decreasing_stride);
+
+    params.outer_rank = outer_rank;
+    params.inner_rank = inner_rank;
+
+    for (int p = 0; p < outer_rank; ++p) {
+      params.outer_divmod[p] = FastDivmodU64(uint64_t(outer[p].extent));
+      params.outer_src_stride[p] = outer[p].src_stride;
+      params.outer_dst_stride[p] = outer[p].dst_stride;
+    }
+
+    for (int p = 0; p < inner_rank; ++p) {
+      params.inner_divmod[p] = FastDivmodU64(uint64_t(inner[p].extent));
+      params.inner_src_stride[p] = inner[p].src_stride;
+    }
+
+    // Threads walk the reduced space when it holds the rank of smallest stride
+    params.reduce_along_x = inner_rank > 0 &&
+      (outer_rank == 0 || std::abs(inner[inner_rank - 1].src_stride) < std::abs(outer[outer_rank - 1].src_stride));
+
+    //
+    // Determine CTA shape
+    //
+
+    int in_threads, out_threads;
+    if (params.reduce_along_x) {
+      in_threads = pow2_bound(params.inner_count, kThreads);
+      out_threads = kThreads / in_threads;
+      threadblock_shape = dim3(in_threads, out_threads, 1);
+    }
+    else {
+      out_threads = pow2_bound(params.outer_count, kThreads);
+      in_threads = kThreads / out_threads;
+      threadblock_shape = dim3(out_threads, in_threads, 1);
+    }
+
+    uint64_t cta_count_x = (params.outer_count + out_threads - 1) / out_threads;
+    if (cta_count_x > uint64_t(std::numeric_limits<int>::max())) {
+      status = Status::kErrorInvalidProblem;
+      return;
+    }
+
+    //
+    // Split the reduced space across CTAs only if the outputs alone do not fill the device
+    //
+
+    if (target_threadblock_count <= 0) {
+      int device_idx = 0;
+      int sm_count = 0;
+      int max_threads_per_sm = 0;
+      if (cudaGetDevice(&device_idx) != cudaSuccess ||
+          cudaDeviceGetAttribute(&sm_count, cudaDevAttrMultiProcessorCount, device_idx) != cudaSuccess ||
+          cudaDeviceGetAttribute(&max_threads_per_sm, cudaDevAttrMaxThreadsPerMultiProcessor, device_idx) != cudaSuccess) {
+        status = Status::kErrorInternal;
+        return;
+      }
+      target_threadblock_count = sm_count * std::max(max_threads_per_sm / kThreads, 1);
+    }
+
+    uint64_t cta_count_y = 1;
+    uint64_t min_count_per_split = uint64_t(in_threads) * kBatchSize * kMinBatchesPerThread;
+
+    if (cta_count_x > 0 && cta_count_x < uint64_t(target_threadblock_count) &&
+        params.inner_count > min_count_per_split) {
+      cta_count_y = std::min({
+        (uint64_t(target_threadblock_count) + cta_count_x - 1) / cta_count_x,
+        (params.inner_count + min_count_per_split - 1) / min_count_per_split,
+        uint64_t(65535)});
+    }
+
+    params.inner_count_per_split = (params.inner_count + cta_count_y - 1) / cta_count_y;
+    if (params.inner_count_per_split > 0) {
+      cta_count_y = (params.inner_count + params.inner_count_per_split - 1) / params.inner_count_per_split;
+    }
+
+    grid_shape = dim3(uint32_t(cta_count_x), uint32_t(cta_count_y), 1);
+  }
+
+public:
+
+  /// Default ctor
+  TensorReductionSinglePass():
+    status(Status::kErrorInvalidProblem),
+    params(),
+    grid_shape(0, 0, 0),
+    threadblock_shape(0, 0, 0) { }
+
+  /// Constructor from extents and strides (units of elements). Ranks with a destination stride
+  /// of zero are reduced.
+  TensorReductionSinglePass(
+    int rank,
+    int64_t const extent[],
+    int64_t const src_stride[],
+    int64_t const dst_stride[],
+    int target_threadblock_count = 0       ///< Number of CTAs to fill the device, 0 queries it
+  ):
+    status(Status::kSuccess),
+    params(),
+    grid_shape(0, 0, 0),
+    threadblock_shape(0, 0, 0) {
+
+    initialize(rank, extent, src_stride, dst_stride, target_threadblock_count);
+  }
+
+  /// Constructor from CuTe layouts of identical shape. Modes of dst_layout with a stride of zero
+  /// are reduced. Hierarchical modes are flattened.
+  template <class SrcLayout, class DstLayout>
+  TensorReductionSinglePass(
+    SrcLayout const &src_layout,
+    DstLayout const &dst_layout,
+    int target_threadblock_count = 0       ///< Number of CTAs to fill the device, 0 queries it
+  ):
+    status(Status::kSuccess),
+    params(),
+    grid_shape(0, 0, 0),
+    threadblock_shape(0, 0, 0) {
+
+    auto flat_src = cute::flatten(src_layout);
+    auto flat_dst = cute::flatten(dst_layout);
+
+    constexpr int R = decltype(cute::rank(flat_src))::value;
+    static_assert(R == decltype(cute::rank(flat_dst))::value, "Source and destination layouts must have the same rank.");
+    static_assert(R <= kMaxRank, "Layout rank exceeds MaxRank.");
+
+    int64_t extent[kMaxRank];
+    int64_t src_stride[kMaxRank];
+    int64_t dst_stride[kMaxRank];
+
+    cute::for_each(cute::make_seq<R>{}, [&](auto i) {
+      extent[i] = int64_t(cute::size<i>(flat_src));
+      src_stride[i] = int64_t(cute::stride<i>(flat_src));
+      dst_stride[i] = int64_t(cute::stride<i>(flat_dst));
+    });
+
+    initialize(R, extent, src_stride, dst_stride, target_threadblock_count);
+  }
+
+  /// Simple check to verify the object is initialized correctly
+  bool good() const {
+    return status == Status::kSuccess;
+  }
+
+  /// Returns the size (in bytes) of a temporary workspace needed for reduction across CTAs
+  int64_t workspace_size() const {
+
+    // Error condition or no reduction across CTAs
+    if (!good() || grid_shape.y <= 1) {
+      return 0;
+    }
+
+    return partials_size() + int64_t(grid_shape.x) * int64_t(sizeof(int));
+  }
+
+  /// Performs a reduction
+  Status reduce(
+    ElementOutput *dst_ptr,                       ///< Pointer to destination tensor
+    ElementSource const *src_ptr,                 ///< Pointer to source tensor
+    void *device_workspace_ptr = nullptr,         ///< Device workspace
+    ElementCompute reduction_identity = ElementCompute(), ///< Reduction identity element
+    ReductionOp reduction_op = ReductionOp(),     ///< Reduction operator
+    PreOp pre_op = PreOp(),                       ///< Applied to each converted source element
+    PostOp post_op = PostOp(),                    ///< Applied to each result before conversion
+    cudaStream_t stream = nullptr) {              ///< CUDA Stream into which all kernels are launched
+
+    // Initial status check
+    if (!good()) {
+      return status;
+    }
+
+    // Nothing to compute
+    if (grid_shape.x == 0) {
+      return Status::kSuccess;
+    }
+
+    params.destination = dst_ptr;
+    params.source = src_ptr;
+    params.reduction_identity = reduction_identity;
+    params.reduction_op = reduction_op;
+    params.pre_op = pre_op;
+    params.post_op = post_op;
+    params.partials = nullptr;
+    params.arrivals = nullptr;
+
+    if (grid_shape.y > 1) {
+
+      // Guard against null workspace
+      if (device_workspace_ptr == nullptr) {
+        return Status::kErrorWorkspaceNull;
+      }
+
+      uint8_t *workspace = static_cast<uint8_t *>(device_workspace_ptr);
+      params.partials = reinterpret_cast<ElementCompute *>(workspace);
+      params.arrivals = reinterpret_cast<int *>(workspace + partials_size());
+
+      if (cudaMemsetAsync(params.arrivals, 0, grid_shape.x * sizeof(int), stream) != cudaSuccess) {
+        return Status::kErrorInternal;
+      }
+    }
+
+    // Shared memory size
+    int shared_mem_bytes = sizeof(typename ReductionKernel::SharedStorage);
+
+    // Launch the kernel
+    cutlass::arch::synclog_setup();
+    Kernel<ReductionKernel><<< grid_shape, threadblock_shape, shared_mem_bytes, stream >>>(params);
+
+    // Check error condition
+    if (cudaPeekAtLastError() == cudaSuccess) {
+      status = Status::kSuccess;
+    }
+    else {
+      status = Status::kErrorInternal;
+    }
+
+    return status;
+  }
+
+  /// Helper to use overloaded function call operator
+  Status operator()(
+    ElementOutput *dst_ptr,                       ///< Pointer to destination tensor
+    ElementSource const *src_ptr,                 ///< Pointer to source tensor
+    void *device_workspace_ptr = nullptr,         ///< Device workspace
+    ElementCompute reduction_identity = ElementCompute(), ///< Reduction identity element
+    ReductionOp reduction_op = ReductionOp(),     ///< Reduction operator
+    PreOp pre_op = PreOp(),                       ///< Applied to each converted source element
+    PostOp post_op = PostOp(),                    ///< Applied to each result before conversion
+    cudaStream_t stream = nullptr) {              ///< CUDA Stream into which all kernels are launched
+
+    return reduce(dst_ptr, src_ptr, device_workspace_ptr, reduction_identity, reduction_op, pre_op, post_op, stream);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace device
+} // namespace reduction
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,379 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Kernel performing a single-pass reduction over an arbitrary subset of the ranks of an
+    affine tensor
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/device_kernel.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace reduction {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Element-wise operator returning its argument. Default pre- and post-operator of the
+/// single-pass reduction.
+template <typename T>
+struct TensorReductionPassThrough {
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &value) const {
+    return value;
+  }
+};
+
+/// Element-wise operator multiplying its argument by a runtime factor, e.g. 1/N to turn a sum
+/// into a mean or the reciprocal of a quantization scale
+template <typename T>
+struct TensorReductionScale {
+  T scaling_factor = T(1);
+
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &value) const {
+    return value * scaling_factor;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Parameters structure
+///
+/// The source index space is split into an outer space (ranks kept in the destination) and an
+/// inner space (reduced ranks). Both are linearized with the rank of smallest source stride
+/// varying fastest.
+template <
+  int MaxRank,                                ///< Maximum rank of source tensor
+  typename ElementOutput,                     ///< Data type of output tensor
+  typename ElementSource,                     ///< Data type of source tensor
+  typename ReductionOp,                       ///< Reduction operator
+  typename ElementCompute,                    ///< Internal compute type - input type of reduction operation
+  typename PreOp,                             ///< Element-wise operator applied to each source element
+  typename PostOp                             ///< Element-wise operator applied to each result
+>
+struct TensorReductionSinglePassParams {
+
+  static int const kMaxRank = MaxRank;
+
+  int outer_rank;                               /// Number of ranks kept in the destination
+  int inner_rank;                               /// Number of reduced ranks
+  FastDivmodU64 outer_divmod[kMaxRank];         /// FastDivmod by the extent of each kept rank
+  int64_t outer_src_stride[kMaxRank];           /// Source stride (units of elements) of each kept rank
+  int64_t outer_dst_stride[kMaxRank];           /// Destination stride (units of elements) of each kept rank
+  FastDivmodU64 inner_divmod[kMaxRank];         /// FastDivmod by the extent of each reduced rank
+  int64_t inner_src_stride[kMaxRank];           /// Source stride (units of elements) of each reduced rank
+
+  uint64_t outer_count;                         /// Number of elements in outer index space
+  uint64_t inner_count;                         /// Number of elements in reduced index space
+  uint64_t inner_count_per_split;               /// Number of reduced elements per CTA along gridDim.y
+  bool reduce_along_x;                          /// Whether threadIdx.x walks the reduced index space
+
+  ElementOutput * destination;                  /// Pointer to output tensor
+  ElementSource const * source;                 /// Pointer to source tensor
+  ElementCompute * partials;                    /// Per-split partial results, [gridDim.y][outer_count]
+  int * arrivals;                               /// Per-CTA-column arrival counters, [gridDim.x], zeroed before launch
+
+  ReductionOp reduction_op;                     /// Reduction operator
+  ElementCompute reduction_identity;            /// Identity element used by reduction operator
+  PreOp pre_op;                                 /// Element-wise operator applied to each source element
+  PostOp post_op;                               /// Element-wise operator applied to each result
+
+  /// Ctor
+  CUTLASS_HOST_DEVICE
+  TensorReductionSinglePassParams() { }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel to reduce a tensor with affine layout over an arbitrary set of ranks in a single pass.
+///
+/// Each output is reduced by a group of threads of one CTA. When the reduced rank of smallest
+/// stride is contiguous in memory, threadIdx.x walks the reduced index space (one output per
+/// threadIdx.y). Otherwise threadIdx.x walks consecutive outputs so that loads stay coalesced.
+///
+/// When the reduced index space is split across CTAs (gridDim.y > 1), each CTA writes its partial
+/// results, and the last CTA of a column to arrive combines them and applies the post-operator
+/// within the same launch.
+template <
+  int MaxRank,                                ///< Maximum rank of source tensor
+  typename ElementOutput,                     ///< Data type of output tensor
+  typename ElementSource,                     ///< Data type of source tensor
+  typename ReductionOp,                       ///< Reduction operator
+  typename ElementCompute = ElementOutput,    ///< Internal compute type - input type of reduction operation
+  typename PreOp = TensorReductionPassThrough<ElementCompute>,  ///< Applied to each converted source element
+  typename PostOp = TensorReductionPassThrough<ElementCompute>, ///< Applied to each result before conversion
+  FloatRoundStyle Round = FloatRoundStyle::round_to_nearest,    ///< Rounding of the output conversion
+  int Threads = 256,                          ///< Number of participating threads
+  int BatchSize = 4                           ///< Number of elements to load per batch
+>
+class TensorReductionSinglePass {
+public:
+
+  static int const kMaxRank = MaxRank;
+  static int const kThreads = Threads;
+  static int const kBatchSize = BatchSize;
+
+  static_assert((kThreads & (kThreads - 1)) == 0, "Thread count must be a power of two.");
+  static_assert(sizeof(ElementCompute) == 2 || sizeof(ElementCompute) == 4 || sizeof(ElementCompute) == 8,
+    "Partial results are exchanged through 2, 4 or 8 byte loads.");
+
+  /// Shared memory allocation used for reduction within the CTA
+  struct SharedStorage {
+    Array<ElementCompute, kThreads> workspace;
+    int is_last_arrival;
+  };
+
+  /// Parameters structure
+  using Params = TensorReductionSinglePassParams<
+    MaxRank,
+    ElementOutput,
+    ElementSource,
+    ReductionOp,
+    ElementCompute,
+    PreOp,
+    PostOp
+  >;
+
+private:
+
+  /// Computes the offset of a linear index decomposed over 'rank' ranks, the last varying fastest
+  CUTLASS_DEVICE
+  static int64_t compute_offset_(
+    uint64_t linear_idx,
+    int rank,
+    FastDivmodU64 const *divmod,
+    int64_t const *stride) {
+
+    int64_t offset = 0;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int p = kMaxRank - 1; p > 0; --p) {
+      if (p < rank) {
+        uint64_t quotient, remainder;
+        divmod[p](quotient, remainder, linear_idx);
+        offset += int64_t(remainder) * stride[p];
+        linear_idx = quotient;
+      }
+    }
+
+    return rank > 0 ? offset + int64_t(linear_idx) * stride[0] : 0;
+  }
+
+  /// Loads a partial result written by another CTA during this launch, bypassing L1
+  CUTLASS_DEVICE
+  static ElementCompute load_partial_(ElementCompute const *ptr) {
+    ElementCompute value;
+#if defined(__CUDA_ARCH__)
+    if constexpr (sizeof(ElementCompute) == 2) {
+      unsigned short bits = __ldcg(reinterpret_cast<unsigned short const *>(ptr));
+      memcpy(&value, &bits, sizeof(bits));
+    }
+    else if constexpr (sizeof(ElementCompute) == 4) {
+      unsigned int bits = __ldcg(reinterpret_cast<unsigned int const *>(ptr));
+      memcpy(&value, &bits, sizeof(bits));
+    }
+    else {
+      unsigned long long bits = __ldcg(reinterpret_cast<unsigned long long const *>(ptr));
+      memcpy(&value, &bits, sizeof(bits));
+    }
+#else
+    value = *ptr;
+#endif
+    return value;
+  }
+
+  /// Reduces the values held by the threads of each group along the reduced thread dimension.
+  /// Returns the result in the thread of each group with in_lane == 0.
+  CUTLASS_DEVICE
+  static ElementCompute reduce_in_cta_(
+    Params const &params,
+    SharedStorage &shared_storage,
+    ElementCompute accumulator,
+    int in_lane,
+    int in_threads,
+    int in_pitch) {
+
+    int thread_idx = threadIdx.x + threadIdx.y * blockDim.x;
+    ElementCompute *frag_ptr = shared_storage.workspace.data();
+
+    frag_ptr[thread_idx] = accumulator;
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int count = in_threads / 2; count > 0; count /= 2) {
+      __syncthreads();
+
+      if (in_lane < count) {
+        accumulator = params.reduction_op(accumulator, frag_ptr[thread_idx + count * in_pitch]);
+        frag_ptr[thread_idx] = accumulator;
+      }
+    }
+
+    __syncthreads();
+
+    return accumulator;
+  }
+
+  /// Applies the post-operator and stores a result
+  CUTLASS_DEVICE
+  static void store_(Params const &params, uint64_t outer_idx, ElementCompute result) {
+    NumericConverter<ElementOutput, ElementCompute, Round> convert_output;
+
+    int64_t dst_offset = compute_offset_(
+      outer_idx, params.outer_rank, params.outer_divmod, params.outer_dst_stride);
+
+    params.destination[dst_offset] = convert_output(params.post_op(result));
+  }
+
+public:
+
+  /// Perform a reduction
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+
+    NumericConverter<ElementCompute, ElementSource> convert_source;
+
+    int in_threads = params.reduce_along_x ? blockDim.x : blockDim.y;
+    int in_lane = params.reduce_along_x ? threadIdx.x : threadIdx.y;
+    int in_pitch = params.reduce_along_x ? 1 : blockDim.x;
+    int out_threads = params.reduce_along_x ? blockDim.y : blockDim.x;
+    int out_lane = params.reduce_along_x ? threadIdx.y : threadIdx.x;
+
+    uint64_t outer_idx = uint64_t(blockIdx.x) * out_threads + out_lane;
+    bool outer_valid = outer_idx < params.outer_count;
+
+    uint64_t inner_begin = uint64_t(blockIdx.y) * params.inner_count_per_split;
+    uint64_t inner_end = cutlass::platform::min(inner_begin + params.inner_count_per_split, params.inner_count);
+
+    //
+    // Reduce this CTA's share of the reduced index space
+    //
+
+    ElementCompute accumulator = params.reduction_identity;
+
+    if (outer_valid) {
+      ElementSource const *src_ptr = params.source + compute_offset_(
+        outer_idx, params.outer_rank, params.outer_divmod, params.outer_src_stride);
+
+      uint64_t linear_idx = inner_begin + in_lane;
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      while (linear_idx < inner_end) {
+
+        ElementSource source_fragment[kBatchSize];
+        bool guards[kBatchSize];
+
+        // Issue a batch of loads
+        CUTLASS_PRAGMA_UNROLL
+        for (int b = 0; b < kBatchSize; ++b) {
+          guards[b] = linear_idx < inner_end;
+          if (guards[b]) {
+            source_fragment[b] = src_ptr[compute_offset_(
+              linear_idx, params.inner_rank, params.inner_divmod, params.inner_src_stride)];
+          }
+          linear_idx += in_threads;
+        }
+
+        // Perform a batch of reduction operations
+        CUTLASS_PRAGMA_UNROLL
+        for (int b = 0; b < kBatchSize; ++b) {
+          if (guards[b]) {
+            accumulator = params.reduction_op(accumulator, params.pre_op(convert_source(source_fragment[b])));
+          }
+        }
+      }
+    }
+
+    accumulator = reduce_in_cta_(params, shared_storage, accumulator, in_lane, in_threads, in_pitch);
+
+    if (gridDim.y == 1) {
+      if (in_lane == 0 && outer_valid) {
+        store_(params, outer_idx, accumulator);
+      }
+      return;
+    }
+
+    //
+    // Publish the partial results and let the last CTA of this column complete them
+    //
+
+    if (in_lane == 0 && outer_valid) {
+      params.partials[uint64_t(blockIdx.y) * params.outer_count + outer_idx] = accumulator;
+    }
+
+    __threadfence();
+    __syncthreads();
+
+    if (threadIdx.x == 0 && threadIdx.y == 0) {
+      int arrived = atomicAdd(params.arrivals + blockIdx.x, 1);
+      shared_storage.is_last_arrival = (arrived == int(gridDim.y) - 1);
+    }
+
+    __syncthreads();
+
+    if (!shared_storage.is_last_arrival) {
+      return;
+    }
+
+    __threadfence();
+
+    accumulator = params.reduction_identity;
+
+    if (outer_valid) {
+      for (int split = in_lane; split < int(gridDim.y); split += in_threads) {
+        accumulator = params.reduction_op(
+          accumulator, load_partial_(params.partials + uint64_t(split) * params.outer_count + outer_idx));
+      }
+    }
+
+    accumulator = reduce_in_cta_(params, shared_storage, accumulator, in_lane, in_threads, in_pitch);
+
+    if (in_lane == 0 && outer_valid) {
+      store_(params, outer_idx, accumulator);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace reduction
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,238 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Partitions the SMs of a device so that persistent kernels can run side by side.
+
+    Persistent CUTLASS kernels size their grid from KernelHardwareInfo::sm_count and assume that
+    every CTA of the grid is resident. Lowering sm_count lets a second kernel run concurrently, but
+    the hardware still places the CTAs of both kernels on any free SM, so the overlap depends on
+    launch order and block placement.
+
+    SmPartition splits the SMs of a device into disjoint groups, one green context per group, and
+    gives each group a stream. Work launched on a partition's stream only runs on that partition's
+    SMs. Passing hw_info(i) to a kernel sizes its persistent grid to exactly those SMs:
+
+      cutlass::SmPartition partition;
+      int sm_counts[] = {120, 0};                  // 0: all remaining SMs
+      partition.initialize(device_id, sm_counts, 2);
+
+      arguments.hw_info = partition.hw_info(0);    // GEMM on 120 SMs
+      gemm.run(arguments, workspace, partition.stream(0));
+      comm_kernel<<<grid, block, 0, partition.stream(1)>>>(...);
+
+    The driver rounds group sizes up to its SM allocation granularity; sm_count(i) reports the size
+    actually granted. Requires CUDA 12.5 or later.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/trace.h"
+
+#if !defined(__CUDACC_RTC__) && \
+    ((__CUDACC_VER_MAJOR__ >= 13) || ((__CUDACC_VER_MAJOR__ == 12) && (__CUDACC_VER_MINOR__ >= 5)))
+#define CUTLASS_SM_PARTITION_ENABLED
+#endif
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__CUDACC_RTC__)
+
+class SmPartition {
+public:
+  static constexpr int MaxPartitions = 8;
+
+  SmPartition() = default;
+  SmPartition(SmPartition const&) = delete;
+  SmPartition& operator=(SmPartition const&) = delete;
+
+  ~SmPartition() {
+    release();
+  }
+
+  /// Splits the SMs of device_id into num_partitions groups. Partition i receives at least
+  /// sm_counts[i] SMs; the last partition receives every remaining SM when sm_counts is 0 there.
+  Status
+  initialize(int device_id, int const* sm_counts, int num_partitions) {
+    release();
+    if (num_partitions < 1 || num_partitions > MaxPartitions) {
+      CUTLASS_TRACE_HOST("  SmPartition: num_partitions must be in [1, " << MaxPartitions << "].");
+      return Status::kErrorInvalidProblem;
+    }
+
+#if defined(CUTLASS_SM_PARTITION_ENABLED)
+    device_id_ = device_id;
+
+    // Make sure the runtime has initialized the driver and the primary context
+    cudaError_t cuda_status = cudaSetDevice(device_id);
+    if (cuda_status == cudaSuccess) {
+      cuda_status = cudaFree(nullptr);
+    }
+    if (cuda_status != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  SmPartition: failed to initialize device " << device_id << ": "
+        << cudaGetErrorString(cuda_status));
+      return Status::kErrorInternal;
+    }
+
+    CUdevice device;
+    CUdevResource remaining;
+    if (!check(CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuDeviceGet)(&device, device_id), "cuDeviceGet") ||
+        !check(CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuDeviceGetDevResource)(device, &remaining, CU_DEV_RESOURCE_TYPE_SM),
+               "cuDeviceGetDevResource")) {
+      return Status::kErrorNotSupported;
+    }
+
+    for (int i = 0; i < num_partitions; ++i) {
+      CUdevResource resource;
+      bool is_last = i == num_partitions - 1;
+      if (is_last && sm_counts[i] <= 0) {
+        resource = remaining;
+      }
+      else {
+        if (sm_counts[i] <= 0) {
+          CUTLASS_TRACE_HOST("  SmPartition: only the last partition may request the remaining SMs.");
+          release();
+          return Status::kErrorInvalidProblem;
+        }
+        unsigned int groups = 1;
+        CUdevResource rest;
+        if (!check(CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuDevSmResourceSplitByCount)(
+                     &resource, &groups, &remaining, &rest, 0u, static_cast<unsigned int>(sm_counts[i])),
+                   "cuDevSmResourceSplitByCount") || groups != 1) {
+          CUTLASS_TRACE_HOST("  SmPartition: cannot carve " << sm_counts[i] << " SMs for partition " << i << ".");
+          release();
+          return Status::kErrorInvalidProblem;
+        }
+        remaining = rest;
+      }
+
+      CUdevResourceDesc desc;
+      CUstream stream;
+      if (!check(CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuDevResourceGenerateDesc)(&desc, &resource, 1u),
+                 "cuDevResourceGenerateDesc") ||
+          !check(CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuGreenCtxCreate)(
+                   &green_contexts_[i], desc, device, CU_GREEN_CTX_DEFAULT_STREAM), "cuGreenCtxCreate")) {
+        release();
+        return Status::kErrorInternal;
+      }
+      ++num_partitions_;
+
+      if (!check(CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuGreenCtxStreamCreate)(
+                   &stream, green_contexts_[i], CU_STREAM_NON_BLOCKING, 0), "cuGreenCtxStreamCreate")) {
+        release();
+        return Status::kErrorInternal;
+      }
+      streams_[i] = static_cast<cudaStream_t>(stream);
+      sm_counts_[i] = static_cast<int>(resource.sm.smCount);
+    }
+    return Status::kSuccess;
+#else
+    CUTLASS_TRACE_HOST("  SmPartition: green contexts require CUDA 12.5 or later.");
+    return Status::kErrorNotSupported;
+#endif
+  }
+
+  /// Destroys the streams and green contexts
+  void
+  release() {
+#if defined(CUTLASS_SM_PARTITION_ENABLED)
+    for (int i = 0; i < num_partitions_; ++i) {
+      if (streams_[i] != nullptr) {
+        cudaStreamDestroy(streams_[i]);
+        streams_[i] = nullptr;
+      }
+      CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuGreenCtxDestroy)(green_contexts_[i]);
+      green_contexts_[i] = nullptr;
+      sm_counts_[i] = 0;
+    }
+#endif
+    num_partitions_ = 0;
+  }
+
+  int
+  num_partitions() const {
+    return num_partitions_;
+  }
+
+  /// Stream whose work only runs on the SMs of partition idx
+  cudaStream_t
+  stream(int idx) const {
+    return streams_[idx];
+  }
+
+  /// Number of SMs granted to partition idx
+  int
+  sm_count(int idx) const {
+    return sm_counts_[idx];
+  }
+
+  /// Hardware info sizing a persistent kernel to partition idx
+  KernelHardwareInfo
+  hw_info(int idx) const {
+    KernelHardwareInfo info;
+    info.device_id = device_id_;
+    info.sm_count = sm_counts_[idx];
+    return info;
+  }
+
+private:
+
+#if defined(CUTLASS_SM_PARTITION_ENABLED)
+  static bool
+  check(CUresult result, char const* call) {
+    if (result != CUDA_SUCCESS) {
+      CUTLASS_TRACE_HOST("  SmPartition: " << call << "() returned error " << static_cast<int>(result));
+      return false;
+    }
+    return true;
+  }
+
+  CUgreenCtx green_contexts_[MaxPartitions] = {};
+#endif
+
+  int device_id_ = 0;
+  int num_partitions_ = 0;
+  cudaStream_t streams_[MaxPartitions] = {};
+  int sm_counts_[MaxPartitions] = {};
+};
+
+#endif // !defined(__CUDACC_RTC__)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -743,10 +743,110 @@ make_transpose_operand_b(
   }
 }
 
+// Whether GMMA can only read an operand tiled with SmemLayoutAtom after transposing it in smem:
+// 8-bit and 32-bit operands tiled with one of the MN-major GMMA atoms
+template <class SmemLayoutAtom, class ElementType>
+constexpr bool
+is_gmma_transposed_operand() {
+  if constexpr (cute::is_void_v<SmemLayoutAtom> || sizeof(ElementType) == 2) {
+    return false;
+  }
+  else {
+    return cute::is_same_v<GMMA::Layout_MN_SW128_Atom<ElementType>, SmemLayoutAtom> ||
+           cute::is_same_v<GMMA::Layout_MN_SW64_Atom<ElementType>, SmemLayoutAtom>  ||
+           cute::is_same_v<GMMA::Layout_MN_SW32_Atom<ElementType>, SmemLayoutAtom>  ||
+           cute::is_same_v<GMMA::Layout_MN_INTER_Atom<ElementType>, SmemLayoutAtom>;
+  }
+}
+
 }; // namespace detail
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Transposes MN-major operand tiles in smem so that GMMA can read 8-bit and TF32 operands
+/// loaded from MN-major tensors.
+///
+/// A mainloop tiles its smem with SmemLayout (built from the MN-major SmemLayoutAtom) for TMA,
+/// partitions the K-major GmmaSmemLayout view of the same buffer for GMMA, and calls transpose()
+/// on each stage after it has landed and before issuing the GMMAs reading it. The TiledMma must
+/// use K-major GMMA for the operand. The transposition is in place and is shared by all warp groups
+/// of TiledMma. For 16-bit operands, K-major atoms or a void atom nothing is transposed,
+/// GmmaSmemLayout is SmemLayout and transpose() is a no-op.
+template <
+  class TiledMma_,
+  class Element_,
+  class SmemLayoutAtom_,
+  class SmemLayout_>
+class GmmaSmemTranspose {
+public:
+  using TiledMma = TiledMma_;
+  using Element = Element_;
+  using SmemLayoutAtom = SmemLayoutAtom_;
+  using SmemLayout = SmemLayout_;
+
+  static constexpr bool IsTransposed = detail::is_gmma_transposed_operand<SmemLayoutAtom, Element>();
+
+private:
+  static constexpr auto
+  gmma_smem_layout() {
+    if constexpr (IsTransposed) {
+      using GmmaSmemLayoutAtom = decltype(detail::gmma_smem_transpose_or_passthrough<true, SmemLayoutAtom, Element>());
+      return cute::tile_to_shape(GmmaSmemLayoutAtom{}, cute::shape(SmemLayout{}), cute::Step<cute::_2,cute::_1,cute::_3>{});
+    }
+    else {
+      return SmemLayout{};
+    }
+  }
+
+public:
+  // Layout of the (MN,K,PIPE) smem buffer as read by GMMA
+  using GmmaSmemLayout = decltype(gmma_smem_layout());
+
+  static_assert(cute::rank(SmemLayout{}) == 3, "SmemLayout must be rank 3 (M/N, K, PIPE)");
+  static_assert(!IsTransposed ||
+                cutlass::bits_to_bytes(cute::size<1>(SmemLayout{}) * cute::sizeof_bits_v<Element>) == 128,
+                "The K extent of a transposed smem tile must be 128 bytes.");
+  static_assert(!IsTransposed || !detail::use_universal_transposition<SmemLayoutAtom, Element>(),
+                "Warp specialized mainloops only support the asynchronous smem transpositions.");
+  static_assert(!IsTransposed || cute::size(TiledMma{}) <= 2 * NumThreadsPerWarpGroup,
+                "Smem transposition is shared by at most two math warp groups.");
+
+  CUTLASS_HOST_DEVICE
+  GmmaSmemTranspose(int warp_idx, int warp_group_thread_idx)
+    : warp_idx_(warp_idx)
+    , warp_group_thread_idx_(warp_group_thread_idx) { }
+
+  /// Makes the GMMA view of the smem buffer at ptr
+  CUTLASS_DEVICE static auto
+  make_gmma_tensor(Element* ptr) {
+    return cute::make_tensor(cute::make_smem_ptr(ptr), GmmaSmemLayout{});
+  }
+
+  /// Transposes stage read_stage of the smem buffer at ptr and makes it visible to GMMA.
+  /// All threads of TiledMma must call this with the same stage.
+  CUTLASS_DEVICE void
+  transpose(Element* ptr, int read_stage) const {
+    if constexpr (IsTransposed) {
+      using namespace cute;
+      Tensor s = as_position_independent_swizzle_tensor(
+        make_tensor(make_smem_ptr(ptr), SmemLayout{}));                                          // (BLK_MN,BLK_K,PIPE)
+      Tensor gmma_s = as_position_independent_swizzle_tensor(
+        make_tensor(make_smem_ptr(ptr), GmmaSmemLayout{}));                                      // (BLK_MN,BLK_K,PIPE)
+
+      auto transposer = detail::make_transpose_operand_b(
+        warp_idx_, warp_group_thread_idx_, TiledMma{}, SmemLayout{}, SmemLayoutAtom{}, Element{},
+        cute::true_type{});
+      transposer.transpose(s, gmma_s, read_stage);
+    }
+  }
+
+private:
+  int warp_idx_;
+  int warp_group_thread_idx_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace collective
 } // namespace transform
 } // namespace cutlass
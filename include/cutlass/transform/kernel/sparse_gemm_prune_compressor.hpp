@@ -0,0 +1,429 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Fused magnitude pruning and compression of dense operands for structured sparse GEMMs.
+
+  StructuredSparsePruneCompressor takes dense A tensors, keeps the largest-magnitude elements of
+  every chunk (2 of 4, or 1 of 2 for 32-bit types) and writes the compressed values and metadata
+  in the format expected by either the SM80 sparse GEMM (cutlass/gemm/device/gemm_sparse.h) or
+  the SM90 sparse collective (sm90_sparse_mma_tma_gmma_ss_warpspecialized.hpp). Many problems of
+  different shapes, e.g. all the weights of a model, are processed by a single launch through
+  cutlass::transform::device::TransformUniversalAdapter.
+
+  Each thread owns one metadata word of one row, so no two threads write to the same byte and
+  no shared memory is needed.
+*/
+
+#pragma once
+
+#include "cute/numeric/numeric_types.hpp"  // cute::sizeof_bits_v, cute::uint_bit_t
+#include "cute/pointer_sparse.hpp"         // cute::sparse_elem
+#include "cute/tensor.hpp"                 // cute::Tensor, cute::make_tensor
+#include "cutlass/arch/arch.h"             // cutlass::arch::SmXY
+#include "cutlass/cuda_host_adapter.hpp"   // cutlass::CudaHostAdapter
+#include "cutlass/cutlass.h"               // cutlass::Status
+#include "cutlass/fast_math.h"             // cutlass::ceil_div, cutlass::round_up
+#include "cutlass/gemm/gemm.h"             // cutlass::TagToStrideA_t
+#include "cutlass/kernel_hardware_info.h"  // cutlass::KernelHardwareInfo
+#include "cutlass/numeric_conversion.h"    // cutlass::NumericConverter
+
+namespace cutlass::transform::kernel {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Output format of the SM80 sparse GEMM: row-major compressed A of shape (M, K/2) and
+/// metadata reordered as by cutlass::reorder_meta() into ColumnMajorInterleaved<2>.
+struct SparseFormatSm80 { };
+
+/// Output format of the SM90 sparse GEMM described by SparseConfig (Sm90GemmSparseConfig):
+/// compressed A and metadata use SparseConfig::fill_layoutA() and fill_layoutE().
+template <class SparseConfig_>
+struct SparseFormatSm90 {
+  using SparseConfig = SparseConfig_;
+};
+
+namespace detail {
+
+template <class ElementA, class Format>
+struct SparsePruneFormatTraits;
+
+template <class ElementA>
+struct SparsePruneFormatTraits<ElementA, SparseFormatSm80> {
+  using ArchTag = arch::Sm80;
+
+  static constexpr bool IsTf32 = cute::sizeof_bits_v<ElementA> == 32;
+
+  // Logical elements per chunk, and elements kept per chunk
+  static constexpr int kChunk = IsTf32 ? 2 : 4;
+  static constexpr int kKeep = kChunk / 2;
+
+  // One metadata word covers 128 bits of compressed A
+  using ElementE = cute::conditional_t<(cute::sizeof_bits_v<ElementA> >= 16), uint16_t, uint32_t>;
+  static constexpr int kLogicalPerWord = 256 / cute::sizeof_bits_v<ElementA>;
+
+  // Row group reordered by reorder_meta()
+  static constexpr int kGroupM = sizeof(ElementE) == 2 ? 32 : 16;
+
+  CUTE_HOST_DEVICE static int work_m(int M, int K) { return M; }
+  CUTE_HOST_DEVICE static int work_k(int M, int K) { return K; }
+
+  static bool can_implement(int M, int K) {
+    return M % kGroupM == 0 && K % kLogicalPerWord == 0;
+  }
+
+  template <class Problem>
+  CUTE_DEVICE
+  static void store_compressed(Problem const& problem, int m, int k_compressed, int l, ElementA value) {
+    int64_t ld = problem.K / 2;
+    ElementA *ptr = reinterpret_cast<ElementA *>(problem.ptr_ACompress);
+    ptr[l * int64_t(problem.M) * ld + m * ld + k_compressed] = value;
+  }
+
+  template <class Problem>
+  CUTE_DEVICE
+  static void store_metadata(Problem const& problem, int m, int word, int l, uint32_t bits) {
+
+    // Row and column swizzle of cutlass::reorder_meta()
+    constexpr int kInterweave = sizeof(ElementE) == 2 ? 4 : 2;
+    int row = m / kGroupM * kGroupM + (m % 8) * kInterweave + (m % kGroupM) / 8;
+    int col = word;
+
+    if ((row % 2) == 0 && (col % 2) == 1) {
+      ++row;
+      --col;
+    }
+    else if ((row % 2) == 1 && (col % 2) == 0) {
+      --row;
+      ++col;
+    }
+
+    // ColumnMajorInterleaved<2> with packed stride 2 * M
+    int64_t words_k = problem.K / kLogicalPerWord;
+    int64_t offset = l * int64_t(problem.M) * words_k + (col / 2) * int64_t(2 * problem.M) + row * 2 + (col % 2);
+
+    reinterpret_cast<ElementE *>(problem.ptr_E)[offset] = ElementE(bits);
+  }
+};
+
+template <class ElementA, class SparseConfig>
+struct SparsePruneFormatTraits<ElementA, SparseFormatSm90<SparseConfig>> {
+  using ArchTag = arch::Sm90;
+
+  static constexpr int kChunk = typename SparseConfig::LogicalElemsAPerChunk{};
+  static constexpr int kKeep = typename SparseConfig::PhysicalElemsAPerChunk{};
+
+  using ElementEMma = typename SparseConfig::ElementEMma;
+  using ElementE = typename SparseConfig::ElementEMmaRaw;
+  static constexpr int kLogicalPerWord = typename SparseConfig::ElementEMmaSparsity{};
+
+  using ElementASparsity = typename SparseConfig::ElementASparsity;
+  using ElementAUint = cute::uint_bit_t<cute::sizeof_bits_v<ElementA>>;
+  using ElementAUintCompressed = cute::sparse_elem<ElementASparsity{}, ElementAUint>;
+
+  static_assert(typename SparseConfig::ElemsARawPerElementAMmaRaw{} == 1, "Hopper packs one element per MMA element.");
+  static_assert(kLogicalPerWord == cute::sizeof_bits_v<ElementE> / 4 * kChunk, "Metadata word must hold whole chunks.");
+
+  // The compressed tensors are padded to their alignments, and the padding is written as well.
+  CUTE_HOST_DEVICE static int work_m(int M, int K) {
+    return cutlass::round_up(M, cutlass::const_max(int(typename SparseConfig::TensorEAlignmentM{}),
+                                                   int(typename SparseConfig::TensorAAlignmentM{})));
+  }
+
+  CUTE_HOST_DEVICE static int work_k(int M, int K) {
+    return cutlass::round_up(K, cutlass::const_max(int(typename SparseConfig::TensorEAlignmentK{}),
+                                                   int(typename SparseConfig::TensorAAlignmentK{})));
+  }
+
+  static bool can_implement(int M, int K) {
+    return K % kChunk == 0;
+  }
+
+  template <class Problem>
+  CUTE_DEVICE
+  static void store_compressed(Problem const& problem, int m, int k_compressed, int l, ElementA value) {
+    auto problem_shape = cute::make_tuple(problem.M, 1, problem.K, problem.L);
+    auto layout_gAC = SparseConfig::fill_layoutA(problem_shape);
+
+    int M_AlignedAC = cutlass::round_up(problem.M, int(typename SparseConfig::TensorAAlignmentM{}));
+    int K_AlignedAC = cutlass::round_up(problem.K, int(typename SparseConfig::TensorAAlignmentK{}));
+
+    if (m < M_AlignedAC && k_compressed < K_AlignedAC / ElementASparsity{}) {
+      cute::Tensor gAC_sparse = cute::make_tensor(
+        cute::make_gmem_ptr(cute::recast_ptr<ElementAUintCompressed>(problem.ptr_ACompress)), layout_gAC);
+      cute::Tensor gAC = cute::recast<ElementAUint>(gAC_sparse);
+      gAC(m, k_compressed, l) = reinterpret_cast<ElementAUint const &>(value);
+    }
+  }
+
+  template <class Problem>
+  CUTE_DEVICE
+  static void store_metadata(Problem const& problem, int m, int word, int l, uint32_t bits) {
+    auto problem_shape = cute::make_tuple(problem.M, 1, problem.K, problem.L);
+    auto layout_gE = SparseConfig::fill_layoutE(problem_shape);
+
+    int M_AlignedE = cutlass::round_up(problem.M, int(typename SparseConfig::TensorEAlignmentM{}));
+    int K_AlignedE = cutlass::round_up(problem.K, int(typename SparseConfig::TensorEAlignmentK{}));
+
+    if (m < M_AlignedE && word < K_AlignedE / kLogicalPerWord) {
+      cute::Tensor gE_sparse = cute::make_tensor(
+        cute::make_gmem_ptr(cute::recast_ptr<ElementEMma>(problem.ptr_E)), layout_gE);
+      cute::Tensor gE = cute::recast<ElementE>(gE_sparse);
+      gE(m, word, l) = ElementE(bits);
+    }
+  }
+};
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+
+template<
+  class ElementA_,
+  class LayoutATag_,
+  class Format_
+>
+class StructuredSparsePruneCompressor {
+public:
+  using ElementA = ElementA_;
+  using LayoutATag = LayoutATag_;
+  using StrideA = cutlass::gemm::TagToStrideA_t<LayoutATag>;
+  using Format = Format_;
+  using FormatTraits = detail::SparsePruneFormatTraits<ElementA, Format>;
+  using ElementE = typename FormatTraits::ElementE;
+
+  static_assert(cute::sizeof_bits_v<ElementA> >= 8, "Sub-byte operands are not supported by the device pruner.");
+
+  static constexpr int kChunk = FormatTraits::kChunk;
+  static constexpr int kKeep = FormatTraits::kKeep;
+  static constexpr int kLogicalPerWord = FormatTraits::kLogicalPerWord;
+  static constexpr int kChunksPerWord = kLogicalPerWord / kChunk;
+
+  static_assert(kChunksPerWord * 4 == cute::sizeof_bits_v<ElementE>, "Each chunk contributes 4 bits of metadata.");
+
+  // Required by `device_kernel`
+  static constexpr int MaxThreadsPerBlock = 128;
+  static constexpr int MinBlocksPerMultiprocessor = 1;
+  using ArchTag = typename FormatTraits::ArchTag;
+
+  struct SharedStorage { };
+
+  static constexpr int SharedStorageSize = 0;
+
+  /// One dense tensor (M, K, L) and its compressed outputs
+  struct Problem {
+    int M{0};
+    int K{0};
+    int L{1};
+    void const* ptr_A{nullptr};
+    StrideA dA{};
+    void* ptr_ACompress{nullptr};
+    void* ptr_E{nullptr};
+  };
+
+  struct Arguments {
+    int problem_count{0};
+    Problem const* problems{nullptr};          ///< device array of problem_count problems
+    Problem const* host_problems{nullptr};     ///< optional host copy, used to size the grid
+    KernelHardwareInfo hw_info{};
+  };
+
+  struct Params {
+    int problem_count{0};
+    Problem const* problems{nullptr};
+    int blocks_per_problem{0};
+    void* workspace = nullptr;
+  };
+
+public:
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace = nullptr) {
+    CUTLASS_TRACE_HOST("StructuredSparsePruneCompressor::to_underlying_arguments()");
+
+    int blocks_per_problem = 0;
+    if (args.host_problems) {
+      int64_t max_work = 0;
+      for (int i = 0; i < args.problem_count; ++i) {
+        max_work = cute::max(max_work, work_count(args.host_problems[i]));
+      }
+      blocks_per_problem = int(cute::min(int64_t(1 << 16), (max_work + MaxThreadsPerBlock - 1) / MaxThreadsPerBlock));
+    }
+    else {
+      // Without host problem shapes, fill the device and grid-stride over each problem
+      int sm_count = args.hw_info.sm_count > 0 ? args.hw_info.sm_count : 132;
+      blocks_per_problem = cute::max(1, 4 * sm_count / cute::max(1, args.problem_count));
+    }
+
+    return Params{args.problem_count, args.problems, cute::max(1, blocks_per_problem), workspace};
+  }
+
+  static Status
+  can_implement(Arguments const& args) {
+    if (args.problem_count <= 0 || args.problem_count > 65535 || args.problems == nullptr) {
+      CUTLASS_TRACE_HOST("StructuredSparsePruneCompressor CAN NOT IMPLEMENT: invalid problem count");
+      return Status::kErrorInvalidProblem;
+    }
+    if (args.host_problems) {
+      for (int i = 0; i < args.problem_count; ++i) {
+        if (!FormatTraits::can_implement(args.host_problems[i].M, args.host_problems[i].K)) {
+          CUTLASS_TRACE_HOST("StructuredSparsePruneCompressor CAN NOT IMPLEMENT: problem " << i << " is misaligned");
+          return Status::kErrorInvalidProblem;
+        }
+      }
+    }
+    CUTLASS_TRACE_HOST("StructuredSparsePruneCompressor::can_implement() (True)");
+    return Status::kSuccess;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    CUTLASS_UNUSED(args);
+    return 0;
+  }
+
+  static Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+    CUTLASS_UNUSED(args);
+    CUTLASS_UNUSED(workspace);
+    CUTLASS_UNUSED(stream);
+    CUTLASS_UNUSED(cuda_adapter);
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    CUTLASS_TRACE_HOST("StructuredSparsePruneCompressor::get_grid_shape() ("
+      << params.blocks_per_problem << ", " << params.problem_count << ", 1)");
+    return dim3(params.blocks_per_problem, params.problem_count, 1);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  /// Number of metadata words, i.e. threads, needed by one problem
+  CUTE_HOST_DEVICE
+  static int64_t
+  work_count(Problem const& problem) {
+    return int64_t(FormatTraits::work_m(problem.M, problem.K)) *
+           (FormatTraits::work_k(problem.M, problem.K) / kLogicalPerWord) * problem.L;
+  }
+
+  CUTE_DEVICE
+  void
+  operator()(Params const& params, void* smem_buf = nullptr) {
+    CUTLASS_UNUSED(smem_buf);
+
+    Problem const problem = params.problems[blockIdx.y];
+
+    int const work_m = FormatTraits::work_m(problem.M, problem.K);
+    int const words_k = FormatTraits::work_k(problem.M, problem.K) / kLogicalPerWord;
+    int64_t const total = work_count(problem);
+
+    ElementA const *ptr_A = reinterpret_cast<ElementA const *>(problem.ptr_A);
+    auto layout_A = cute::make_layout(cute::make_shape(problem.M, problem.K, problem.L), problem.dA);
+
+    NumericConverter<float, ElementA> to_float;
+
+    // Consecutive threads handle consecutive rows so that M-major inputs are read coalesced
+    for (int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+         idx < total;
+         idx += int64_t(gridDim.x) * blockDim.x) {
+
+      int m = int(idx % work_m);
+      int word = int((idx / work_m) % words_k);
+      int l = int(idx / (int64_t(work_m) * words_k));
+
+      uint32_t metadata = 0;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int c = 0; c < kChunksPerWord; ++c) {
+
+        int k0 = word * kLogicalPerWord + c * kChunk;
+
+        ElementA values[kChunk];
+        float magnitude[kChunk];
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < kChunk; ++i) {
+          bool valid = m < problem.M && (k0 + i) < problem.K;
+          values[i] = valid ? ptr_A[layout_A(m, k0 + i, l)] : ElementA(0);
+          magnitude[i] = fabsf(to_float(values[i]));
+        }
+
+        // Padding beyond the problem extents is written as zeros with zero metadata
+        if (m >= problem.M || k0 >= problem.K) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < kKeep; ++i) {
+            FormatTraits::store_compressed(problem, m, (k0 / kChunk) * kKeep + i, l, ElementA(0));
+          }
+          continue;
+        }
+
+        // Keep the kKeep largest magnitudes, breaking ties toward lower indices
+        int kept = 0;
+        uint32_t chunk_bits = 0;
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < kChunk; ++i) {
+          int rank = 0;
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kChunk; ++j) {
+            rank += (magnitude[j] > magnitude[i] || (magnitude[j] == magnitude[i] && j < i)) ? 1 : 0;
+          }
+
+          if (rank < kKeep) {
+            FormatTraits::store_compressed(problem, m, (k0 / kChunk) * kKeep + kept, l, values[i]);
+
+            if constexpr (kChunk == 2) {
+              // 1:2 sparsity encodes the kept element as a 4-bit pair of indices
+              chunk_bits = (i == 0) ? 0b0100 : 0b1110;
+            }
+            else {
+              chunk_bits |= uint32_t(i) << (2 * kept);
+            }
+            ++kept;
+          }
+        }
+
+        metadata |= chunk_bits << (4 * c);
+      }
+
+      FormatTraits::store_metadata(problem, m, word, l, metadata);
+    }
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::transform::kernel
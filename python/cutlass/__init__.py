@@ -136,10 +136,19 @@ def get_option_registry():
 
 this.__version__ = '3.7.0'
 
-from cutlass.backend import create_memory_pool
+from cutlass.backend import create_memory_pool, set_device_allocator
 from cutlass.emit.pytorch import pytorch
 from cutlass.op.gemm import Gemm
-from cutlass.op.conv import Conv2d, Conv2dFprop, Conv2dDgrad, Conv2dWgrad
+from cutlass.op.conv import (
+    Conv2d,
+    Conv2dFprop,
+    Conv2dDgrad,
+    Conv2dWgrad,
+    Conv3d,
+    Conv3dFprop,
+    Conv3dDgrad,
+    Conv3dWgrad,
+)
 from cutlass.op.gemm_grouped import GroupedGemm
 from cutlass.op.op import OperationBase
 from cutlass.backend.evt.ir.tensor import Tensor
@@ -34,11 +34,12 @@ from cutlass.backend.arguments import *
 from cutlass.backend.c_types import *
 from cutlass.backend.compiler import ArtifactManager
 from cutlass.backend.conv2d_operation import *
+from cutlass.backend.conv3x_operation import *
 from cutlass.backend.epilogue import *
 from cutlass.backend.frontend import *
 from cutlass.backend.gemm_operation import *
 from cutlass.backend.library import *
-from cutlass.backend.memory_manager import PoolMemoryManager, create_memory_pool
+from cutlass.backend.memory_manager import PoolMemoryManager, create_memory_pool, set_device_allocator
 from cutlass.backend.operation import *
 from cutlass.backend.reduction_operation import *
 from cutlass.backend.type_hint import *
@@ -118,16 +118,11 @@ class ArgumentBase:
         """
         Frees allocated device-side memory
         """
-        # Free any device memory allocated manually
-        if not cutlass.use_rmm:
-            for name, buf in self.buffers.items():
-                if isinstance(buf, DevicePtrWrapper):
-                    err, = cudart.cudaFree(buf.ptr)
-                    if err != cudart.cudaError_t.cudaSuccess:
-                        raise RuntimeError(f"cudaFree failed with error {err}")
+        # Free any device memory allocated manually. RMM buffers are freed when garbage collected.
+        for name, buf in self.buffers.items():
+            if isinstance(buf, DevicePtrWrapper):
+                buf.free()
 
-            if hasattr(self, "workspace_buffer") and isinstance(self.workspace_buffer, DevicePtrWrapper):
-                err, = cudart.cudaFree(self.workspace_buffer.ptr)
-                if err != cudart.cudaError_t.cudaSuccess:
-                    raise RuntimeError(f"cudaFree failed with error {err}")
-                del self.workspace_buffer
+        if hasattr(self, "workspace_buffer") and isinstance(self.workspace_buffer, DevicePtrWrapper):
+            self.workspace_buffer.free()
+            del self.workspace_buffer
@@ -354,6 +354,38 @@ def get_gemm_grouped_arguments(epilogue_functor):
     return _GEMMGroupedArguments, _EpilogueOutputOpParams
 
 
+def get_gemm_grouped_arguments_3x(epilogue_functor):
+    """
+    Returns the ctypes structure describing a CUTLASS 3 grouped GEMM whose per-group problem shapes,
+    pointers, and strides are already resident in device memory. The structure mirrors the flat
+    argument struct emitted by ``GemmRTGrouped3x``, which assembles the kernel's ``Arguments`` in C++.
+    """
+    _EpilogueOutputOpParams = epilogue_functor.epilogue_type
+
+    class _GemmGroupedArguments3x(ctypes.Structure):
+        _fields_ = [
+            ("num_groups", ctypes.c_int),
+            ("problem_shapes", ctypes.c_void_p),
+            ("host_problem_shapes", ctypes.c_void_p),
+            ("device_num_groups", ctypes.c_void_p),
+            ("ptr_A", ctypes.c_void_p),
+            ("stride_A", ctypes.c_void_p),
+            ("ptr_B", ctypes.c_void_p),
+            ("stride_B", ctypes.c_void_p),
+            ("ptr_C", ctypes.c_void_p),
+            ("stride_C", ctypes.c_void_p),
+            ("ptr_D", ctypes.c_void_p),
+            ("stride_D", ctypes.c_void_p),
+            ("alpha_ptr_array", ctypes.c_void_p),
+            ("beta_ptr_array", ctypes.c_void_p),
+            ("alpha", ctypes.c_double),
+            ("beta", ctypes.c_double),
+            ("sm_count", ctypes.c_int),
+        ]
+
+    return _GemmGroupedArguments3x, _EpilogueOutputOpParams
+
+
 ############################################################################################
 # Convolution2D
 ############################################################################################
@@ -431,6 +463,68 @@ def get_conv2d_arguments(epilogue_functor):
     return _Conv2dArguments, _EpilogueOutputOpParams
 
 
+class ConvProblemShape3x_(ctypes.Structure):
+    """
+    Flat description of a 2D or 3D convolution consumed by ``Conv3xRT``, which builds the
+    kernel's ``cutlass::conv::ConvProblemShape`` from it. 2D problems leave the depth
+    fields at their unit defaults.
+    """
+    _fields_ = [
+        ("mode", ctypes.c_int),
+        ("N", ctypes.c_int),
+        ("D", ctypes.c_int),
+        ("H", ctypes.c_int),
+        ("W", ctypes.c_int),
+        ("C", ctypes.c_int),
+        ("K", ctypes.c_int),
+        ("T", ctypes.c_int),
+        ("R", ctypes.c_int),
+        ("S", ctypes.c_int),
+        ("pad_d", ctypes.c_int),
+        ("pad_h", ctypes.c_int),
+        ("pad_w", ctypes.c_int),
+        ("stride_d", ctypes.c_int),
+        ("stride_h", ctypes.c_int),
+        ("stride_w", ctypes.c_int),
+        ("dilation_d", ctypes.c_int),
+        ("dilation_h", ctypes.c_int),
+        ("dilation_w", ctypes.c_int),
+        ("groups", ctypes.c_int)
+    ]
+
+    _depth_defaults = {"D": 1, "T": 1, "pad_d": 0, "stride_d": 1, "dilation_d": 1}
+
+    def __init__(self, problem_size) -> None:
+        for field_name, _ in self._fields_:
+            default = self._depth_defaults.get(field_name)
+            setattr(self, field_name, getattr(problem_size, field_name, default))
+
+
+def get_conv3x_arguments(epilogue_functor):
+    """
+    Returns the ctypes structure mirroring the flat argument struct emitted by ``Conv3xRT``.
+    Kernels without a visitor epilogue use the builder's ``LinearCombination`` fusion, whose
+    arguments are described by ``epilogue_type_evt``.
+    """
+    if hasattr(epilogue_functor, "epilogue_type_evt"):
+        _EpilogueOutputOpParams = epilogue_functor.epilogue_type_evt
+    else:
+        _EpilogueOutputOpParams = epilogue_functor.epilogue_type
+
+    class _Conv3xArguments(ctypes.Structure):
+        _fields_ = [
+            ("problem_shape", ConvProblemShape3x_),
+            ("ptr_A", ctypes.c_void_p),
+            ("ptr_B", ctypes.c_void_p),
+            ("ptr_C", ctypes.c_void_p),
+            ("ptr_D", ctypes.c_void_p),
+            ("epilogue", _EpilogueOutputOpParams),
+            ("sm_count", ctypes.c_int)
+        ]
+
+    return _Conv3xArguments, _EpilogueOutputOpParams
+
+
 ############################################################################################
 # Reduction
 ############################################################################################
@@ -36,8 +36,10 @@ import os
 import sqlite3
 import subprocess
 import tempfile
+import threading
+from concurrent.futures import Future, ThreadPoolExecutor
 
-from cuda import cuda, nvrtc
+from cuda import cuda, cudart, nvrtc
 from cutlass_library import SubstituteTemplate
 
 import cutlass
@@ -146,6 +148,14 @@ class ArtifactManager:
                                                         op_attrs TEXT NOT NULL)
         """
         cursor.execute(sqlite_create_table_query)
+
+        # Configurations selected by autotuning, keyed by kernel signature and problem shape bucket
+        sqlite_create_table_query = """
+        CREATE TABLE IF NOT EXISTS tuned_operations(tuning_key TEXT NOT NULL UNIQUE,
+                                                     config TEXT NOT NULL,
+                                                     runtime REAL NOT NULL)
+        """
+        cursor.execute(sqlite_create_table_query)
         connection.commit()
         cursor.close()
 
@@ -156,9 +166,14 @@ class ArtifactManager:
             "-Xcudafe --diag_suppress=esa_on_defaulted_function_ignored",
         ]
         self.nvcc()
+        self.serial()
         self.compiled_cache_device = {}
         self.compiled_cache_host = {}
 
+        # Guards the caches against concurrent use by add_module_async()
+        self._lock = threading.RLock()
+        self._background = None
+
     def nvrtc(self):
         self.backend = "nvrtc"
         self.default_compile_options = self._nvrtc_compile_options
@@ -224,6 +239,29 @@ class ArtifactManager:
             self.compiled_cache_host[key] = compiled_host_fns
         return True
 
+    def insert_tuned_config(self, tuning_key, config, runtime):
+        """
+        Stores the configuration selected by autotuning for ``tuning_key``, replacing any previous one
+        """
+        connection = sqlite3.connect(CACHE_FILE)
+        cursor = connection.cursor()
+        sqlite_insert_query = """ INSERT OR REPLACE INTO tuned_operations (tuning_key, config, runtime) VALUES (?, ?, ?)"""
+        cursor.execute(sqlite_insert_query, (tuning_key, config, runtime))
+        connection.commit()
+        cursor.close()
+
+    def load_tuned_config(self, tuning_key):
+        """
+        Returns the configuration selected by autotuning for ``tuning_key``, or ``None`` if there is none
+        """
+        connection = sqlite3.connect(CACHE_FILE)
+        cursor = connection.cursor()
+        sqlite_fetch_query = """SELECT config from tuned_operations where tuning_key = ?"""
+        cursor.execute(sqlite_fetch_query, (tuning_key,))
+        record = cursor.fetchone()
+        cursor.close()
+        return None if record is None else record[0]
+
     def emit_compile_(self, operation_list, compilation_options, host_compilation_options):
         """
         Compile a list of kernels and store them into database
@@ -352,6 +390,97 @@ class ArtifactManager:
 
         return cubin_image, host_lib, temp_dst
 
+    def parallel(self, jobs: int = None):
+        """
+        Compiles each operation of a call to ``add_module`` as its own module, running up to ``jobs``
+        compilations concurrently. ``jobs`` defaults to the number of CPUs.
+        """
+        self.jobs = jobs if jobs is not None else (os.cpu_count() or 1)
+
+    def serial(self):
+        """
+        Compiles all operations of a call to ``add_module`` together as a single module (the default)
+        """
+        self.jobs = 0
+
+    def _compile_parallel_(self, operation_list, compilation_options, host_compilation_options):
+        """
+        Compiles each operation of ``operation_list`` as its own module. Each job is an nvcc process
+        (or an NVRTC compilation, which runs outside of the GIL), so a thread pool suffices to keep
+        ``self.jobs`` of them running.
+
+        :return: list of tuples (cubin image, host library, host library file), one per operation
+        """
+        with ThreadPoolExecutor(max_workers=self.jobs) as pool:
+            futures = [
+                pool.submit(self.emit_compile_, [operation,], compilation_options, host_compilation_options)
+                for operation in operation_list
+            ]
+            return [future.result() for future in futures]
+
+    def _register_module_(self, operation_list, operation_key, cubin_image, host_lib, host_file):
+        """
+        Loads a compiled module, binds its kernels and host functions to the operations it was
+        compiled from, and stores it in the cache
+        """
+        err, module = cuda.cuModuleLoadData(cubin_image)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("Cuda Error: {}".format(err))
+
+        operation_name = []
+        operation_attr = []
+        for operation, key in zip(operation_list, operation_key):
+            # get device kernels
+            err, operation.kernel = cuda.cuModuleGetFunction(
+                module,
+                bytes(str.encode(operation.name()))
+            )
+            operation_name.append(operation.name())
+            self.compiled_cache_device[key] = operation.kernel
+            # get host functions
+            compiled_host_fns = {}
+            op_attr = []
+
+            # get param size
+            func_name = operation.name() + "_get_param_size"
+            func = getattr(host_lib, func_name)
+            param_size = func()
+
+            func_name = operation.name() + "_get_params"
+            func = getattr(host_lib, func_name)
+            func.argtype = operation.argtype
+            func.restype = ctypes.POINTER(ctypes.c_char * param_size)
+            setattr(operation, "get_args", func)
+            compiled_host_fns["get_args"] = func
+
+            # set shared memory size
+            func_name = operation.name() + "_shared_memory_size"
+            func = getattr(host_lib, func_name)
+            setattr(operation, "shared_memory_capacity", func())
+            compiled_host_fns["shared_memory_capacity"] = func()
+            # set the maximum dynamic shared size
+            operation.initialize()
+
+            # get extra functions
+            op_attr.append(param_size)
+
+            if hasattr(operation, "extra_funcs"):
+                for suffix, ret_type  in operation.extra_funcs.items():
+                    func_name = operation.name() + "_" + suffix
+                    func = getattr(host_lib, func_name)
+                    if ret_type is not None:
+                        func.restype = ret_type
+                    setattr(operation, suffix, func)
+                    compiled_host_fns[suffix] = func
+                    op_attr.append(suffix)
+
+            operation_attr.append(op_attr)
+            self.compiled_cache_host[key] = compiled_host_fns
+
+        for (key, operation_name, operation_attr,) in zip(operation_key, operation_name, operation_attr):
+            self.insert_operation(
+                key, cubin_image, host_file.name, operation_name, operation_attr)
+
     def add_module(self, operations, compile_options=None, bypass_cache=False):
         """
         Insert a new compiled device module
@@ -374,86 +503,65 @@ class ArtifactManager:
         # save the cubin
         operation_key = []
         operation_list = []
-        for operation in operations:
-            # step 1: get kernel string as key
-            key = operation.rt_module.emit() + operation.procedural_name() + self.backend
-            # step 1: check if the operation is in cache
-            compiled_kernel = self.compiled_cache_device.get(key)
-
-            if compiled_kernel is None and not bypass_cache:
-                hit = self.load_operation(key, getattr( operation.rt_module, "extra_funcs", {}))
-                if hit:
-                    compiled_kernel = self.compiled_cache_device.get(key)
-                    assert compiled_kernel is not None
-            if compiled_kernel is not None:
-                operation.rt_module.kernel = compiled_kernel
-                compiled_host_fns = self.compiled_cache_host.get(key)
-                assert compiled_host_fns is not None
-                for key in compiled_host_fns.keys():
-                    setattr(operation.rt_module, key, compiled_host_fns[key])
-                operation.rt_module.initialize()
-            else:
-                operation_list.append(operation.rt_module)
-                operation_key.append(key)
-
-        if len(operation_list) > 0:
+        with self._lock:
+            for operation in operations:
+                # step 1: get kernel string as key
+                key = operation.rt_module.emit() + operation.procedural_name() + self.backend
+                # step 1: check if the operation is in cache
+                compiled_kernel = self.compiled_cache_device.get(key)
+
+                if compiled_kernel is None and not bypass_cache:
+                    hit = self.load_operation(key, getattr( operation.rt_module, "extra_funcs", {}))
+                    if hit:
+                        compiled_kernel = self.compiled_cache_device.get(key)
+                        assert compiled_kernel is not None
+                if compiled_kernel is not None:
+                    operation.rt_module.kernel = compiled_kernel
+                    compiled_host_fns = self.compiled_cache_host.get(key)
+                    assert compiled_host_fns is not None
+                    for key in compiled_host_fns.keys():
+                        setattr(operation.rt_module, key, compiled_host_fns[key])
+                    operation.rt_module.initialize()
+                else:
+                    operation_list.append(operation.rt_module)
+                    operation_key.append(key)
+
+        if len(operation_list) == 0:
+            return
+
+        # Compilation runs outside of the lock so that operations already compiled remain
+        # usable while a background compilation is in progress
+        if self.jobs > 1 and len(operation_list) > 1:
+            modules = self._compile_parallel_(operation_list, compile_options, host_compile_options)
+            with self._lock:
+                for operation, key, module in zip(operation_list, operation_key, modules):
+                    self._register_module_([operation,], [key,], *module)
+        else:
             cubin_image, host_lib, host_file = self.emit_compile_(
                 operation_list, compile_options, host_compile_options)
+            with self._lock:
+                self._register_module_(operation_list, operation_key, cubin_image, host_lib, host_file)
 
-            err, module = cuda.cuModuleLoadData(cubin_image)
-            if err != cuda.CUresult.CUDA_SUCCESS:
-                raise RuntimeError("Cuda Error: {}".format(err))
+    def add_module_async(self, operations, compile_options=None, bypass_cache=False) -> Future:
+        """
+        Compiles and inserts ``operations`` in the background. Operations already in the cache remain
+        usable meanwhile, so that a caller can run a fallback kernel and switch to ``operations`` once
+        the returned future completes.
 
-            operation_name = []
-            operation_attr = []
-            for operation, key in zip(operation_list, operation_key):
-                # get device kernels
-                err, operation.kernel = cuda.cuModuleGetFunction(
-                    module,
-                    bytes(str.encode(operation.name()))
-                )
-                operation_name.append(operation.name())
-                self.compiled_cache_device[key] = operation.kernel
-                # get host functions
-                compiled_host_fns = {}
-                op_attr = []
-
-                # get param size
-                func_name = operation.name() + "_get_param_size"
-                func = getattr(host_lib, func_name)
-                param_size = func()
-
-                func_name = operation.name() + "_get_params"
-                func = getattr(host_lib, func_name)
-                func.argtype = operation.argtype
-                func.restype = ctypes.POINTER(ctypes.c_char * param_size)
-                setattr(operation, "get_args", func)
-                compiled_host_fns["get_args"] = func
-
-                # set shared memory size
-                func_name = operation.name() + "_shared_memory_size"
-                func = getattr(host_lib, func_name)
-                setattr(operation, "shared_memory_capacity", func())
-                compiled_host_fns["shared_memory_capacity"] = func()
-                # set the maximum dynamic shared size
-                operation.initialize()
-
-                # get extra functions
-                op_attr.append(param_size)
-
-                if hasattr(operation, "extra_funcs"):
-                    for suffix, ret_type  in operation.extra_funcs.items():
-                        func_name = operation.name() + "_" + suffix
-                        func = getattr(host_lib, func_name)
-                        if ret_type is not None:
-                            func.restype = ret_type
-                        setattr(operation, suffix, func)
-                        compiled_host_fns[suffix] = func
-                        op_attr.append(suffix)
-
-                operation_attr.append(op_attr)
-                self.compiled_cache_host[key] = compiled_host_fns
-
-            for (key, operation_name, operation_attr,) in zip(operation_key, operation_name, operation_attr):
-                self.insert_operation(
-                    key, cubin_image, host_file.name, operation_name, operation_attr)
+        :return: future resolving to ``operations`` once they are ready to run
+        :rtype: concurrent.futures.Future
+        """
+        cutlass.initialize_cuda_context()
+        device = cutlass.device_id()
+
+        def compile_and_insert():
+            # Make the device's primary context, in which operations are loaded, current on this thread
+            err, = cudart.cudaSetDevice(device)
+            if err != cudart.cudaError_t.cudaSuccess:
+                raise RuntimeError(f"cudaSetDevice failed with error {err}")
+            self.add_module(operations, compile_options, bypass_cache)
+            return operations
+
+        if self._background is None:
+            self._background = ThreadPoolExecutor(max_workers=1, thread_name_prefix="cutlass_compile")
+        return self._background.submit(compile_and_insert)
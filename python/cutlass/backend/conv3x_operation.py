@@ -0,0 +1,641 @@
+#################################################################################################
+#
+# Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+CUTLASS 3 (SM90) implicit GEMM convolutions built from the convolution ``CollectiveBuilder``
+"""
+
+import ctypes
+
+from cuda import cuda
+from cutlass_library import (
+    ConvKind,
+    ConvKindNames,
+    ConvKindTag,
+    DataTypeNames,
+    DataTypeTag,
+    EpilogueScheduleSuffixes,
+    EpilogueScheduleTag,
+    EpilogueScheduleType,
+    KernelScheduleSuffixes,
+    KernelScheduleTag,
+    KernelScheduleType,
+    LayoutTag,
+    LayoutType,
+    OpcodeClassNames,
+    OpcodeClassTag,
+    OperationKind,
+    ShortLayoutTypeNames,
+    SubstituteTemplate,
+    TileSchedulerTag,
+    TileSchedulerType,
+)
+
+from cutlass.backend.arguments import ArgumentBase
+from cutlass.backend.c_types import ConvProblemShape3x_, dim3_, get_conv3x_arguments
+from cutlass.backend.gemm_operation import GemmRTUniversal3x
+from cutlass.backend.library import (
+    EmissionType,
+    TensorDescription,
+    TileDescription,
+)
+from cutlass.backend.memory_manager import device_mem_alloc
+from cutlass.backend.operation import ExecutableOperation, LaunchConfiguration
+from cutlass.backend.utils.device import device_sm_count, to_device_ptr
+
+
+class Conv3xArguments(ArgumentBase):
+    """
+    Argument wrapper for CUTLASS 3 convolutions. The problem is passed to the runtime module as
+    a flat description from which the kernel's ``ConvProblemShape`` and output strides are
+    built in C++.
+
+    :param operation: the convolution operation to take the argument
+    :type operation: :class:`cutlass.backend.Conv3xOperation`
+    :param problem_size: the convolution problem size
+    :type problem_size: :class:`cutlass.shape.Conv2DProblemSize` | :class:`cutlass.shape.Conv3DProblemSize`
+    :param A: tensor A
+    :type A: cuda.CUdeviceptr | numpy.ndarray | torch.Tensor | cupy.ndarray
+    :param B: tensor B
+    :type B: cuda.CUdeviceptr | numpy.ndarray | torch.Tensor | cupy.ndarray
+    :param C: tensor C
+    :type C: cuda.CUdeviceptr | numpy.ndarray | torch.Tensor | cupy.ndarray
+    :param D: tensor D
+    :type D: cuda.CUdeviceptr | numpy.ndarray | torch.Tensor | cupy.ndarray
+    :param output_op: output operator, optional
+    :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+    :type stream: :class:`cuda.cuda.CUstream`
+    """
+
+    def __init__(self, operation, problem_size, A, B, C, D, **kwargs) -> None:
+        self.operation = operation
+        self.conv_kind = operation.conv_kind
+
+        super().__init__(A, B, C, D, **kwargs)
+
+        if "output_op" in kwargs.keys():
+            self.output_op = kwargs["output_op"]
+        else:
+            self.output_op = self.operation.epilogue_type(1.0, 0.0)
+
+        self.problem_size = problem_size
+
+        self.initialize()
+
+    def get_arguments(self):
+        self.arguments = self.operation.argument_type(
+            ConvProblemShape3x_(self.problem_size),
+            int(to_device_ptr(self.ptr_A)),
+            int(to_device_ptr(self.ptr_B)),
+            int(to_device_ptr(self.ptr_C)),
+            int(to_device_ptr(self.ptr_D)),
+            self.output_op,
+            device_sm_count(),
+        )
+        return self.arguments
+
+    def initialize(self):
+        rt_module = self.operation.rt_module
+        self.get_arguments()
+
+        if not rt_module.can_implement(ctypes.byref(self.arguments)):
+            raise Exception(f"Operation {self.operation.procedural_name()} cannot implement the provided problem")
+
+        device_workspace_size = rt_module.get_kernel_workspace_size(ctypes.byref(self.arguments))
+        if device_workspace_size > 0:
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
+            workspace_ptr = self.workspace_buffer.ptr
+            err, = cuda.cuMemsetD8Async(workspace_ptr, 0, device_workspace_size, self.stream)
+            if err != cuda.CUresult.CUDA_SUCCESS:
+                raise RuntimeError(f"CUDA error on call to cuMemsetD8Async: {cuda.cuGetErrorString(err)[1]}")
+        else:
+            workspace_ptr = 0
+
+        status = rt_module.initialize_workspace(
+            ctypes.byref(self.arguments),
+            ctypes.c_void_p(int(workspace_ptr)),
+            ctypes.c_void_p(int(self.stream)),
+        )
+        if status != 0:
+            raise RuntimeError(f"Failed to initialize the convolution workspace (cutlass::Status {status})")
+
+        res_arg = rt_module.get_args(ctypes.byref(self.arguments), ctypes.c_void_p(int(workspace_ptr)))
+        self.host_workspace = bytearray(res_arg.contents)
+        self.device_workspace = None
+
+        grid = rt_module.get_grid_shape(ctypes.byref(self.arguments), ctypes.c_void_p(int(workspace_ptr)))
+        block = rt_module.get_block_shape()
+        self.launch_config = LaunchConfiguration(
+            [grid.x, grid.y, grid.z],
+            [block.x, block.y, block.z],
+            rt_module.shared_memory_capacity,
+        )
+
+    def sync(self, stream_sync=True):
+        super().sync(stream_sync)
+        if hasattr(self.output_op, "sync"):
+            self.output_op.sync()
+
+
+class Conv3xRT(ExecutableOperation):
+    """
+    Manages the CUTLASS runtime components for 3.x convolutions
+    """
+
+    KernelTemplate = GemmRTUniversal3x.KernelTemplate
+
+    HostTemplate = r"""
+using ConvType = ${operation_name}_base;
+using ProblemShape = typename ConvType::ProblemShape;
+using ThreadEpilogueArguments = decltype(typename ConvType::EpilogueArguments{}.thread);
+
+// Mirrors the ctypes structure ConvProblemShape3x_
+struct ${operation_name}_problem_size {
+  int mode;
+  int N, D, H, W, C;
+  int K, T, R, S;
+  int pad_d, pad_h, pad_w;
+  int stride_d, stride_h, stride_w;
+  int dilation_d, dilation_h, dilation_w;
+  int groups;
+};
+
+// Mirrors the ctypes structure returned by get_conv3x_arguments
+struct ${operation_name}_arguments {
+  ${operation_name}_problem_size problem_size;
+  void const* ptr_A;
+  void const* ptr_B;
+  void const* ptr_C;
+  void* ptr_D;
+  ThreadEpilogueArguments epilogue;
+  int sm_count;
+};
+
+static ProblemShape
+${operation_name}_make_problem_shape(${operation_name}_problem_size const& p) {
+  auto mode = static_cast<cutlass::conv::Mode>(p.mode);
+  if constexpr (ProblemShape::RankS == 2) {
+    return ProblemShape(mode,
+      {p.N, p.H, p.W, p.C}, {p.K, p.R, p.S, p.C},
+      {p.pad_h, p.pad_w}, {p.pad_h, p.pad_w},
+      {p.stride_h, p.stride_w}, {p.dilation_h, p.dilation_w}, p.groups);
+  }
+  else {
+    static_assert(ProblemShape::RankS == 3, "Only 2D and 3D convolutions are supported");
+    return ProblemShape(mode,
+      {p.N, p.D, p.H, p.W, p.C}, {p.K, p.T, p.R, p.S, p.C},
+      {p.pad_d, p.pad_h, p.pad_w}, {p.pad_d, p.pad_h, p.pad_w},
+      {p.stride_d, p.stride_h, p.stride_w}, {p.dilation_d, p.dilation_h, p.dilation_w}, p.groups);
+  }
+}
+
+// Packed output strides in the epilogue's view of C and D. Fprop and dgrad outputs are
+// ((Q,P,[Z,]N), K, _0) and ((W,H,[D,]N), C, _0), while wgrad outputs are (K, (C,S,R[,T]), _0).
+// Modes that an epilogue visitor tree made static are left untouched.
+template <class Stride>
+static Stride
+${operation_name}_make_output_stride(ProblemShape const& problem_shape) {
+  Stride stride{};
+  if constexpr (ProblemShape::ConvOp == cutlass::conv::Operator::kWgrad) {
+    cute::get<0>(stride) = problem_shape.stride_C[0];
+    cute::for_each(cute::make_seq<cute::rank<1>(Stride{})>{}, [&](auto i) {
+      if constexpr (!cute::is_static_v<cute::remove_cvref_t<decltype(cute::get<1, i>(stride))>>) {
+        cute::get<1, i>(stride) = problem_shape.stride_C[ProblemShape::RankT - 1 - i];
+      }
+    });
+  }
+  else {
+    cute::for_each(cute::make_seq<cute::rank<0>(Stride{})>{}, [&](auto i) {
+      if constexpr (!cute::is_static_v<cute::remove_cvref_t<decltype(cute::get<0, i>(stride))>>) {
+        cute::get<0, i>(stride) = problem_shape.stride_C[ProblemShape::RankT - 2 - i];
+      }
+    });
+  }
+  return stride;
+}
+
+static typename ConvType::Arguments
+${operation_name}_make_arguments(${operation_name}_arguments const& args) {
+  ProblemShape problem_shape = ${operation_name}_make_problem_shape(args.problem_size);
+
+  typename ConvType::Arguments arguments{};
+  arguments.mode = cutlass::gemm::GemmUniversalMode::kGemm;
+  arguments.problem_shape = problem_shape;
+  arguments.mainloop.ptr_A = static_cast<typename ConvType::ElementA const*>(args.ptr_A);
+  arguments.mainloop.ptr_B = static_cast<typename ConvType::ElementB const*>(args.ptr_B);
+  arguments.epilogue.thread = args.epilogue;
+  arguments.epilogue.ptr_C = static_cast<typename ConvType::ElementC const*>(args.ptr_C);
+  arguments.epilogue.dC = ${operation_name}_make_output_stride<typename ConvType::StrideC>(problem_shape);
+  arguments.epilogue.ptr_D = static_cast<typename ConvType::ElementD*>(args.ptr_D);
+  arguments.epilogue.dD = ${operation_name}_make_output_stride<typename ConvType::StrideD>(problem_shape);
+  arguments.hw_info.device_id = 0;
+  arguments.hw_info.sm_count = args.sm_count;
+  return arguments;
+}
+
+extern "C" {
+  // Get the size of params in bytes
+  int ${operation_name}_get_param_size(){
+    return sizeof(${operation_name}${operation_suffix}::Params);
+  }
+
+  // Get the size of dynamic shared memory in bytes
+  int ${operation_name}_shared_memory_size() {
+    return ${operation_name}${operation_suffix}::SharedStorageSize;
+  }
+
+  // Check whether the kernel supports the problem
+  bool ${operation_name}_can_implement(${operation_name}_arguments* argument) {
+    return ConvType::can_implement(${operation_name}_make_arguments(*argument));
+  }
+
+  // Get the workspace size
+  uint64_t ${operation_name}_get_kernel_workspace_size(${operation_name}_arguments* argument) {
+    return ConvType::get_workspace_size(${operation_name}_make_arguments(*argument));
+  }
+
+  // Initialize the workspace on the given stream
+  int ${operation_name}_initialize_workspace(${operation_name}_arguments* argument, void* workspace, void* stream) {
+    return int(ConvType::initialize_workspace(
+      ${operation_name}_make_arguments(*argument), workspace, static_cast<cudaStream_t>(stream)));
+  }
+
+  // Get the params as byte array
+  char* ${operation_name}_get_params(${operation_name}_arguments* argument, void* workspace){
+    ConvType::Params params = ConvType::to_underlying_arguments(
+      ${operation_name}_make_arguments(*argument), workspace);
+    char *bytes = ((char*)(&params));
+    char *output = new char[sizeof(ConvType::Params)];
+    for (unsigned int i = 0; i < sizeof(ConvType::Params); i ++)
+        output[i] = bytes[i];
+
+    return output;
+  }
+
+  // Get the grid shape
+  dim3 ${operation_name}_get_grid_shape(${operation_name}_arguments* argument, void* workspace) {
+    auto tmp_params = ConvType::to_underlying_arguments(
+      ${operation_name}_make_arguments(*argument), workspace);
+    return ConvType::get_grid_shape(tmp_params);
+  }
+
+  // Get the block shape
+  dim3 ${operation_name}_get_block_shape() {
+    return ConvType::get_block_shape();
+  }
+}
+  """
+
+    def __init__(self, operation: "Conv3xOperation"):
+        super().__init__(operation)
+        self.extra_funcs = {
+            "can_implement": ctypes.c_bool,
+            "get_grid_shape": dim3_,
+            "get_block_shape": dim3_,
+            "get_kernel_workspace_size": ctypes.c_uint64,
+            "initialize_workspace": ctypes.c_int,
+        }
+        self.argument_type, self.epilogue_type = get_conv3x_arguments(operation.epilogue_functor)
+        self.argtype = [ctypes.POINTER(self.argument_type), ctypes.c_void_p]
+        self.conv_kind = operation.conv_kind
+
+        self.operation: Conv3xOperation = operation
+
+        self.emitter = EmitConv3xInstance("_type")
+
+    def emit(self):
+        return self.emitter.emit(self.operation)
+
+    def initialize(self):
+        err, = cuda.cuFuncSetAttribute(
+            self.kernel,
+            attrib=cuda.CUfunction_attribute.CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES,
+            value=self.shared_memory_capacity)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError(f"CUDA Error: {err}")
+
+
+class Conv3xOperation:
+    """
+    CUTLASS 3 convolution operation description. The operation is 2D or 3D depending on the
+    layout of A (``TensorNHWC`` or ``TensorNDHWC``).
+
+    :param conv_kind: convolution operator
+    :type conv_kind: :class:`cutlass_library.library.ConvKind`
+
+    :param arch: GPU compute capability (sm_xx)
+    :type arch: int
+
+    :param tile_description: tile description
+    :type tile_description: :class:`cutlass.backend.TileDescription`
+
+    :param A: tensor A description
+    :type A: :class:`cutlass.backend.TensorDescription`
+
+    :param B: tensor B description
+    :type B: :class:`cutlass.backend.TensorDescription`
+
+    :param C: tensor C description. Its layout is that of the output, i.e. the filter layout for wgrad
+    :type C: :class:`cutlass.backend.TensorDescription`
+
+    :param epilogue_functor: linear combination or epilogue visitor tree
+    :type epilogue_functor: :class:`EpilogueFunctor`
+    """
+    def __init__(
+        self,
+        conv_kind,
+        arch: int,
+        tile_description: TileDescription,
+        A: TensorDescription,
+        B: TensorDescription,
+        C: TensorDescription,
+        epilogue_functor,
+        emission_type=EmissionType.Kernel,
+        **kwargs
+    ):
+        self.arch: int = arch
+        self.tile_description: TileDescription = tile_description
+        self.conv_kind = conv_kind
+        self.A: TensorDescription = A
+        self.B: TensorDescription = B
+        self.C: TensorDescription = C
+        self.epilogue_functor = epilogue_functor
+        if A.layout == LayoutType.TensorNDHWC:
+            self.operation_kind: OperationKind = OperationKind.Conv3d
+        else:
+            self.operation_kind: OperationKind = OperationKind.Conv2d
+
+        self.emission_type = emission_type
+
+        self.rt_module: Conv3xRT = Conv3xRT(self)
+        self.argument_type = self.rt_module.argument_type
+        self.epilogue_type = self.rt_module.epilogue_type
+
+    def run(self, arguments: Conv3xArguments) -> cuda.CUresult:
+        """
+        Launch the cuda kernel with input arguments
+
+        :param arguments: convolution arguments
+        :type arguments: :class:`cutlass.backend.Conv3xArguments`
+        """
+        err = self.rt_module.run(
+            arguments.host_workspace,
+            arguments.device_workspace,
+            arguments.launch_config,
+            arguments.stream
+        )
+
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError(f"CUDA Error {err}")
+
+        return err
+
+    #
+    # Get function name
+    #
+
+    def procedural_name(self):
+        """The full procedural name indicates architecture, extended name, tile size, and layout."""
+        return self.configuration_name()
+
+    def configuration_name(self):
+        """The full procedural name indicates architecture, extended name, tile size, and layout."""
+        opcode_class_name = OpcodeClassNames[self.tile_description.math_instruction.opcode_class]
+        kernel_name_template = "cutlass3x_sm{ar}_{op}_{ex}_{tbm}x{tbn}x{tbk}_{cm}x{cn}x{ck}_{l}_{s}_align{al}{k}{e}"
+        return kernel_name_template.format(
+            ar=self.arch,
+            op=opcode_class_name,
+            ex=self.extended_name(),
+            tbm=self.tile_description.threadblock_shape[0],
+            tbn=self.tile_description.threadblock_shape[1],
+            tbk=self.tile_description.threadblock_shape[2],
+            cm=self.tile_description.cluster_shape[0],
+            cn=self.tile_description.cluster_shape[1],
+            ck=self.tile_description.cluster_shape[2],
+            l=self.tile_description.stages,
+            s=self.layout_name(),
+            al=str(self.A.alignment),
+            k=KernelScheduleSuffixes[self.kernel_schedule()],
+            e=EpilogueScheduleSuffixes[self.epilogue_schedule()]
+        )
+
+    def extended_name(self):
+        return "{core_name}_{element_a}_{element_b}_{element_acc}_{element_c}_{element_d}".format(
+            core_name=self.core_name(),
+            element_a=DataTypeNames[self.A.element],
+            element_b=DataTypeNames[self.B.element],
+            element_acc=DataTypeNames[self.accumulator_type()],
+            element_c=DataTypeNames[self.C.element],
+            element_d=DataTypeNames[self.epilogue_functor.element_output])
+
+    def core_name(self):
+        dims = 3 if self.operation_kind == OperationKind.Conv3d else 2
+        return f"conv{dims}d_{ConvKindNames[self.conv_kind]}"
+
+    def layout_name(self):
+        return "{}{}{}".format(
+            ShortLayoutTypeNames[self.A.layout],
+            ShortLayoutTypeNames[self.B.layout],
+            ShortLayoutTypeNames[self.C.layout])
+
+    def kernel_schedule(self):
+        if self.tile_description.kernel_schedule is None:
+            return KernelScheduleType.ScheduleAuto
+        return self.tile_description.kernel_schedule
+
+    def epilogue_schedule(self):
+        if self.tile_description.epilogue_schedule is None:
+            return EpilogueScheduleType.ScheduleAuto
+        return self.tile_description.epilogue_schedule
+
+    def tile_scheduler(self):
+        if self.tile_description.tile_scheduler is None:
+            return TileSchedulerType.Default
+        return self.tile_description.tile_scheduler
+
+    def accumulator_type(self):
+        return self.tile_description.math_instruction.element_accumulator
+
+    def device_op(self):
+        """
+        Returns a new Conv3xOperation object that is constructed with emission type
+        ``EmissionType.Device``.
+
+        :return: operation ready for device-level code emission
+        :rtype: Conv3xOperation
+        """
+        return Conv3xOperation(
+            self.conv_kind, self.arch, self.tile_description,
+            self.A, self.B, self.C, self.epilogue_functor,
+            emission_type=EmissionType.Device)
+
+
+###################################################################################################
+#
+# Emits single instances of a CUTLASS device-wide operator
+#
+###################################################################################################
+
+
+class EmitConv3xInstance:
+    """Responsible for emitting a CUTLASS 3 convolution template definition"""
+
+    def __init__(self, operation_suffix=""):
+        self.operation_suffix = operation_suffix
+        self.includes = [
+            "cutlass/cutlass.h",
+            "cute/tensor.hpp",
+            "cutlass/numeric_types.h",
+            "cutlass/conv/convnd_problem_shape.hpp",
+            "cutlass/conv/collective/collective_builder.hpp",
+            "cutlass/conv/kernel/conv_universal.hpp",
+            "cutlass/epilogue/collective/collective_builder.hpp",
+        ]
+        self.epilogue_template = """
+using CollectiveEpilogue =
+  typename cutlass::epilogue::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${output_cta_tile_shape},
+    ${cluster_shape},
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ${element_accumulator}, ${element_epilogue},
+    ${element_c}, ${layout_c}, ${align_c},
+    ${element_d}, ${layout_d}, ${align_d},
+    ${epilogue_schedule}
+  >::CollectiveOp;
+"""
+        self.epilogue_template_visitor = """
+${callback_decl}
+
+using CollectiveEpilogue =
+  typename cutlass::epilogue::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${output_cta_tile_shape},
+    ${cluster_shape},
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ${element_accumulator}, ${element_epilogue},
+    ElementC, StrideC, ${align_c},
+    ElementD, StrideD, ${align_d},
+    ${epilogue_schedule},
+    ${callback_name}
+  >::CollectiveOp;
+"""
+        self.conv_template_kernel = """
+using CollectiveMainloop =
+  typename cutlass::conv::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${conv_kind},
+    ${element_a}, ${layout_a}, ${align_a},
+    ${element_b}, ${layout_b}, ${align_b},
+    ${element_accumulator},
+    ${mma_tile_shape},
+    ${cluster_shape},
+    ${stage_count_type},
+    ${kernel_schedule}
+  >::CollectiveOp;
+
+using ${operation_name}_problem_shape =
+  cutlass::conv::ConvProblemShape<${conv_kind}, CollectiveMainloop::NumSpatialDimensions>;
+
+// Conv${conv_kind_name} operator ${operation_name}
+using ${operation_name}_base = cutlass::conv::kernel::ConvUniversal<
+    ${operation_name}_problem_shape,
+    CollectiveMainloop,
+    CollectiveEpilogue,
+    ${tile_scheduler}
+>;
+
+// Define named type
+struct ${operation_name}${operation_suffix} :
+  public ${operation_name}_base { };
+"""
+
+    @staticmethod
+    def tile_shape(operation, shape):
+        """
+        Emits the CTA or MMA tile shape. Unlike GEMMs, the K mode is wrapped in a Shape for
+        all convolution kinds, as is the N mode of wgrad.
+        """
+        m, n, k = shape
+        n_mode = f"cute::Shape<cute::_{n}>" if operation.conv_kind == ConvKind.Wgrad else f"cute::_{n}"
+        return f"cute::Shape<cute::_{m}, {n_mode}, cute::Shape<cute::_{k}>>"
+
+    def emit(self, operation):
+        if operation.tile_description.stages is None or operation.tile_description.stages == 0:
+            stage_count_type = "cutlass::conv::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>"
+        else:
+            stage_count_type = f"cutlass::conv::collective::StageCount<{operation.tile_description.stages}>"
+
+        # The convolution builder selects among the implicit GEMM schedules of the conv namespace
+        kernel_schedule = KernelScheduleTag[operation.kernel_schedule()].replace("gemm::", "conv::")
+        cluster_shape = operation.tile_description.cluster_shape
+        threadblock_shape = operation.tile_description.threadblock_shape[:3]
+
+        values = {
+            "operation_name": operation.procedural_name(),
+            "operation_suffix": self.operation_suffix,
+            "conv_kind": ConvKindTag[operation.conv_kind],
+            "conv_kind_name": ConvKindNames[operation.conv_kind].capitalize(),
+            "element_a": DataTypeTag[operation.A.element],
+            "layout_a": LayoutTag[operation.A.layout],
+            "element_b": DataTypeTag[operation.B.element],
+            "layout_b": LayoutTag[operation.B.layout],
+            "element_c": DataTypeTag[operation.C.element],
+            "layout_c": LayoutTag[operation.C.layout],
+            "element_d": DataTypeTag[operation.epilogue_functor.element_output],
+            "layout_d": LayoutTag[operation.C.layout],
+            "element_accumulator": DataTypeTag[operation.accumulator_type()],
+            "element_epilogue": DataTypeTag[operation.epilogue_functor.element_epilogue],
+            "opcode_class": OpcodeClassTag[operation.tile_description.math_instruction.opcode_class],
+            "arch": "cutlass::arch::Sm%d" % operation.arch,
+            "output_cta_tile_shape": self.tile_shape(operation, threadblock_shape),
+            "mma_tile_shape": self.tile_shape(operation, threadblock_shape),
+            "cluster_shape": "cute::Shape<cute::_{}, cute::_{}, cute::_{}>".format(*cluster_shape),
+            "align_a": str(operation.A.alignment),
+            "align_b": str(operation.B.alignment),
+            "align_c": str(operation.C.alignment),
+            "align_d": str(operation.C.alignment),
+            "stage_count_type": stage_count_type,
+            "kernel_schedule": kernel_schedule,
+            "epilogue_schedule": EpilogueScheduleTag[operation.epilogue_schedule()],
+            "tile_scheduler": TileSchedulerTag[operation.tile_scheduler()],
+        }
+
+        if hasattr(operation.epilogue_functor, "visitor"):
+            callback_name, callback_decl = operation.epilogue_functor.emit(operation)
+            values["callback_name"] = callback_name
+            values["callback_decl"] = callback_decl
+            epilogue_template = self.epilogue_template_visitor
+        else:
+            epilogue_template = self.epilogue_template
+
+        return SubstituteTemplate("\nusing namespace cute;\n" + epilogue_template + self.conv_template_kernel, values)
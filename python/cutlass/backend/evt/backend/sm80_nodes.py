@@ -205,6 +205,8 @@ class Sm80ColumnReductionImpl(ColumnReductionImpl):
         if self._type_decl is not None:
             return self._type_decl
 
+        self.check_atomic()
+
         self._type_decl = f"""
 using {self.name_camel} = cutlass::epilogue::threadblock::VisitorColReduction<
     {op_tag(self.reg_reduce_fn)}, {op_tag(self.gmem_reduce_fn)},
@@ -226,6 +228,8 @@ class Sm80RowReductionImpl(RowReductionImpl):
         if self._type_decl is not None:
             return self._type_decl
 
+        self.check_atomic()
+
         self._type_decl = f"""
 using {self.name_camel} = cutlass::epilogue::threadblock::VisitorRowReduction<
     {op_tag(self.reg_reduce_fn)}, {op_tag(self.gmem_reduce_fn)},
@@ -247,6 +251,8 @@ class Sm80ScalarReductionImpl(ScalarReductionImpl):
         if self._type_decl is not None:
             return self._type_decl
 
+        self.check_atomic()
+
         self._type_decl = f"""
 using {self.name_camel} = cutlass::epilogue::threadblock::VisitorScalarReduction<
     {op_tag(self.reg_reduce_fn)}, {op_tag(self.gmem_reduce_fn)},
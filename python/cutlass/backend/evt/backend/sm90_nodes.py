@@ -319,6 +319,8 @@ class Sm90ScalarReductionImpl(ScalarReductionImpl):
         if self._type_decl is not None:
             return self._type_decl
 
+        self.check_atomic()
+
         self._type_decl = f"""
 using {self.name_camel} = cutlass::epilogue::fusion::Sm90ScalarReduction<
     {op_tag(self.reg_reduce_fn)}, {op_tag(self.gmem_reduce_fn)},
@@ -172,8 +172,9 @@ class EVTFrontendBase:
             if load_node.tensor.rank == 2:
                 new_shape = tuple([1, ] + list(load_node.tensor.shape))
                 load_node.tensor.broadcast(new_shape)
-            elif load_node.tensor.rank < 2 or load_node.tensor.rank > 3:
-                raise ValueError(f"Expect example inputs for 'accum' be a rank-2 or rank-3 tensor. Got {load_node.tensor.shape}.")
+            elif load_node.tensor.rank < 2 or load_node.tensor.rank > 5:
+                # Rank-4 and rank-5 accumulators are convolution outputs (N, [Z,] P, Q, K)
+                raise ValueError(f"Expect example inputs for 'accum' be a rank-2 to rank-5 tensor. Got {load_node.tensor.shape}.")
         self.add_node(load_node)
 
     def add_imm(self, value: Union[float,int]):
@@ -47,6 +47,9 @@ from cutlass.backend.library import FunctionalOp
 
 
 class PythonASTFrontend(EVTFrontendBase, ast.NodeVisitor):
+    # User-defined reductions: name -> (reg_reduce_fn, gmem_reduce_fn)
+    reductions = {}
+
     def __init__(self, element_compute=DataType.f32, **kwargs):
         super().__init__(element_compute, **kwargs)
         # Flags
@@ -75,10 +78,26 @@ class PythonASTFrontend(EVTFrontendBase, ast.NodeVisitor):
             "relu": relu.binding_type,
             "multiply_add": FunctionalOp.MultiplyAdd,
             "sum": (FunctionalOp.Plus, FunctionalOp.AtomicAdd),
-            "max": (FunctionalOp.Maximum, FunctionalOp.AtomicMaximum)
+            "max": (FunctionalOp.Maximum, FunctionalOp.AtomicMaximum),
+            "min": (FunctionalOp.Minimum, FunctionalOp.AtomicMinimum)
         }
+        if op in PythonASTFrontend.reductions:
+            return PythonASTFrontend.reductions[op]
         return mapping[op]
 
+    @staticmethod
+    def register_reduction(name: str, reg_reduce_fn: FunctionalOp, gmem_reduce_fn: FunctionalOp):
+        """
+        Register a reduction that can be called by name in traced epilogues
+
+        :param name: name under which the reduction is called
+        :param reg_reduce_fn: associative function combining two partial results
+        :param gmem_reduce_fn: function combining partial results of different CTAs in global memory.
+                               If it is not an atomic, the partial results of all CTAs are written to the
+                               workspace and reduced by the last CTA to finish (SM90 only).
+        """
+        PythonASTFrontend.reductions[name] = (reg_reduce_fn, gmem_reduce_fn)
+
     #
     # Visiting different node types
     #
@@ -51,6 +51,25 @@ class LoadImplBase(ImplBase):
         self.element = node.element
         self.element_output = node.element_output
         self.stride = node.tensor.stride
+        self.shape = node.tensor.shape
+
+    def _get_broadcast_conv_stride_mnl(self):
+        """
+        The Sm90 broadcast visitors only accept a flat M stride of 0 or 1. Collapse the
+        hierarchical conv M mode into one, which requires the broadcast vector to be either
+        constant or compact across (Q, P, [Z,] N).
+        """
+        m_stride = list(reversed(self.stride[:-1]))
+        m_shape = list(reversed(self.shape[:-1]))
+        if all(stride == 0 for stride in m_stride):
+            return (0, self.stride[-1], 0)
+        expected = 1
+        for stride, extent in zip(m_stride, m_shape):
+            if extent > 1 and stride != expected:
+                raise NotImplementedError(
+                    f"Broadcast {self.name} with stride {self.stride} is not compact over the convolution output")
+            expected *= extent
+        return (1, self.stride[-1], 0)
 
 
 class AccumulatorImpl(LoadImplBase):
@@ -135,6 +154,9 @@ class RowBroadcastImpl(LoadImplBase):
         super().__init__(node)
         self.stride_dtype = "int"
 
+    def _get_conv_stride_mnl(self):
+        return self._get_broadcast_conv_stride_mnl()
+
     @property
     def argument_type(self):
         stride_mnl = self.get_stride_mnl()
@@ -175,6 +197,9 @@ class ColumnBroadcastImpl(LoadImplBase):
         super().__init__(node)
         self.stride_dtype = "int"
 
+    def _get_conv_stride_mnl(self):
+        return self._get_broadcast_conv_stride_mnl()
+
     @property
     def argument_type(self):
         stride_mnl = self.get_stride_mnl()
@@ -215,6 +240,9 @@ class ScalarBroadcastImpl(LoadImplBase):
         super().__init__(node)
         self.stride_dtype = "int"
 
+    def _get_conv_stride_mnl(self):
+        return self._get_broadcast_conv_stride_mnl()
+
     @property
     def argument_type(self):
         stride_mnl = self.get_stride_mnl()
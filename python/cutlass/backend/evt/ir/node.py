@@ -103,8 +103,7 @@ class ImplBase:
         """
         Typename StrideMNL
         """
-        stride = _list_to_tuple([self.stride[-2], self.stride[-1]] + list(_reverse_tuple(tuple(self.stride[:-2]))))
-        return self._emit_cute_tuple(stride)
+        return self._emit_cute_tuple(self.get_stride_mnl())
 
     def get_non_constant_stride(self, py_tuple):
         if isinstance(py_tuple, int):
@@ -123,9 +122,26 @@ class ImplBase:
         """
         Get the non-zero stride mnl. This is used in argument construction
         """
+        if len(self.stride) > 3:
+            return self._get_conv_stride_mnl()
         stride = _list_to_tuple([self.stride[-2], self.stride[-1]] + list(_reverse_tuple(tuple(self.stride[:-2]))))
         return stride
 
+    def _get_conv_stride_mnl(self):
+        """
+        Stride of a convolution output traced as (N, [Z,] P, Q, K). The implicit GEMM M mode of
+        fprop is the hierarchical (Q, P, [Z,] N) and there is no batch mode, matching
+        ``TagToStrideC`` of the NHWC/NDHWC layouts.
+        """
+        stride = list(self.stride)
+        if stride[-1] == 1:
+            # Canonicalization zeroes the stride of unit extents. Restore the packed
+            # stride so that full tensors keep the dynamic stride types of the layout.
+            for i in reversed(range(len(stride) - 1)):
+                if stride[i] == 0:
+                    stride[i] = stride[i + 1] * self.shape[i + 1]
+        return (tuple(reversed(stride[:-1])), stride[-1], 0)
+
     def get_smem_size(self, *args, **kwargs):
         """
         Get the shared memory size and alignment of current node
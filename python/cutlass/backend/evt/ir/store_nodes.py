@@ -55,6 +55,7 @@ class StoreImplBase(ImplBase):
         self.element = node.element
         self.element_output = node.element_output
         self.stride = node.store_tensor.stride
+        self.shape = node.store_tensor.shape
 
 
 class StoreDImpl(StoreImplBase):
@@ -131,6 +132,23 @@ class ReductionImplBase(StoreImplBase):
         self.round_style = node.round_style
         self.stride_dtype = "int"
 
+    @property
+    def is_atomic(self):
+        """
+        Whether the partial results of different CTAs are combined with atomics
+        """
+        return self.gmem_reduce_fn in [
+            FunctionalOp.AtomicAdd, FunctionalOp.AtomicMaximum, FunctionalOp.AtomicMinimum]
+
+    def check_atomic(self):
+        """
+        Raise if the reduction requires combining partial results in the workspace
+        """
+        if not self.is_atomic:
+            raise NotImplementedError(
+                f"Reduction {self.name} uses the non-atomic global reduction {self.gmem_reduce_fn}, "
+                f"which is only supported by row and column reductions on SM90.")
+
     def get_reduce_identity(self):
         """
         Return the reduction identity of the current reduce_fn
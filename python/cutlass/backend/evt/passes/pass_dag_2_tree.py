@@ -53,13 +53,16 @@ class PassDAG2Tree(EVTPassBase):
     ]
 
     def call(self):
+        # Map from the output node of each fused region to the fused DAG node
+        self.fused_outputs = {}
+
         # Step 1: find the nodes that have multiple parents
         multi_parent_nodes = []
 
         for node in self.dag_ir.nodes_topological_order():
             if self.dag_ir.out_degree(node) > 1:
                 multi_parent_nodes.append(node)
-        # Step 2: find the lowest common ancestor (LCA) of all its parents
+        # Step 2: fuse the region between each of them and its lowest common ancestor (LCA)
         for node in multi_parent_nodes:
             # A multi-parent node could be already fused by the previous node
             if not self.dag_ir.has_node(node):
@@ -70,74 +73,105 @@ class PassDAG2Tree(EVTPassBase):
             if self.dag_ir.out_degree(node) <= 1:
                 continue
 
-            # Otherwise, the node still
-            reachable_nodes = []
-            # Complexity: O(Dout*N)
-            for parent in self.dag_ir.get_users(node):
-                reachable_nodes.append(set(self.dag_ir.all_reachable_nodes(parent)))
-            # get the common reachable objects
-            common_items = set.intersection(*reachable_nodes)
-
-            # If common ancestor exists, find the lowest one
-            if len(common_items) > 0:
-                topo_order = self.dag_ir.nodes_topological_order()
-                lca = None
-                topo_idx = -1
-                for item in common_items:
-                    if lca is None:
-                        lca = item
-                        topo_idx = topo_order.index(item)
-                    else:
-                        if topo_idx > topo_order.index(item):
-                            lca = item
-                            topo_idx = topo_order.index(item)
-                # The lca is the output node of the DAG node
-                # Get the nodes to be fused
-                node_to_fuse = set.union(*reachable_nodes).difference(common_items)
+            # A region may cover a DAG fused by a previous node. Inline it back
+            # into the graph so that the shared intermediates end up in a single
+            # flat topological visitor rather than a nested one.
+            while True:
+                node_to_fuse, lca = self.get_fusion_region(node)
+                nested = [n for n in node_to_fuse
+                          if isinstance(self.dag_ir.get_node_meta(n), TopoVisitorNode)]
+                if len(nested) == 0:
+                    break
+                for n in nested:
+                    self.unfuse(n)
+
+            # Get all the input nodes
+            all_input_nodes = []
+            all_output_nodes = []
+            for n in node_to_fuse:
+                all_input_nodes.append(set(self.dag_ir.get_all_inputs(n)))
+                all_output_nodes.append(set(self.dag_ir.get_users(n)))
+            all_input_nodes = set.union(*all_input_nodes).difference(node_to_fuse)
+            all_output_nodes = set.union(*all_output_nodes)
+
+            new_subgraph_nodes = set.union(node_to_fuse, all_input_nodes, all_output_nodes)
+
+            # Create the subgraph
+            subgraph_ = self.dag_ir._graph.subgraph(new_subgraph_nodes)
+            subgraph = DAGIR()
+            for n in subgraph_.nodes:
+                meta = deepcopy(self.dag_ir.get_node_meta(n))
+                if n not in node_to_fuse:
+                    meta.disabled = True
+                subgraph.add_node(meta)
+            for edge in subgraph_.edges:
+                subgraph.add_edge(edge[0], edge[1], self.dag_ir.get_edge_weight(edge[0], edge[1]))
+
+            # Create the fused node
+            dag_node = TopoVisitorNode(
+                name=f"dag_{lca}", subgraph=subgraph,
+                output_node=self.dag_ir.get_node_meta(lca))
+            self.dag_ir.add_node(dag_node)
+
+            # Add input edges
+            for idx, n in enumerate(sorted(all_input_nodes)):
+                self.dag_ir.add_edge(n, dag_node.name, weight=idx)
+
+            # Replace all uses with DAG node (only 1 output node)
+            self.dag_ir.replace_all_uses_with(lca, dag_node.name)
+            self.fused_outputs[lca] = dag_node.name
+
+            # Remove all fused nodes
+            node_to_fuse.remove(lca)
+            for n in node_to_fuse:
+                self.dag_ir.remove_node(n)
+
+    def get_fusion_region(self, node):
+        """
+        Get the nodes to be fused for a multi-parent node, together with the output
+        node of the region.
+
+        The output is the first common reachable node of all the users such that no
+        node inside the region has a user outside of it. Picking the first common
+        node alone would drop the edges of branches that only rejoin further down.
+        """
+        reachable_nodes = []
+        # Complexity: O(Dout*N)
+        for parent in self.dag_ir.get_users(node):
+            reachable_nodes.append(set(self.dag_ir.all_reachable_nodes(parent)))
+        # get the common reachable objects
+        common_items = set.intersection(*reachable_nodes)
+        all_items = set.union(*reachable_nodes)
+
+        topo_order = self.dag_ir.nodes_topological_order()
+        for lca in sorted(common_items, key=topo_order.index):
+            node_to_fuse = all_items.difference(self.dag_ir.all_reachable_nodes(lca))
+            closed = all(
+                set(self.dag_ir.get_users(n)).issubset(node_to_fuse.union({lca}))
+                for n in node_to_fuse)
+            if closed:
                 node_to_fuse.add(lca)
-                # Get all the input nodes
-                all_input_nodes = []
-                all_output_nodes = []
-                for node in node_to_fuse:
-                    all_input_nodes.append(set(self.dag_ir.get_all_inputs(node)))
-                    all_output_nodes.append(set(self.dag_ir.get_users(node)))
-                all_input_nodes = set.union(*all_input_nodes)
-                all_output_nodes = set.union(*all_output_nodes)
-
-                new_subgraph_nodes = set.union(node_to_fuse, all_input_nodes, all_output_nodes)
-
-                # Create the subgraph
-                subgraph_ = self.dag_ir._graph.subgraph(new_subgraph_nodes)
-                subgraph = DAGIR()
-                for node in subgraph_.nodes:
-                    meta = deepcopy(self.dag_ir.get_node_meta(node))
-                    if node not in node_to_fuse:
-                        meta.disabled = True
-                    subgraph.add_node(meta)
-                for edge in subgraph_.edges:
-                    subgraph.add_edge(edge[0], edge[1], self.dag_ir.get_edge_weight(edge[0], edge[1]))
-
-
-                # Create the fused node
-                dag_node = TopoVisitorNode(
-                    name=f"dag_{lca}", subgraph=subgraph,
-                    output_node=self.dag_ir.get_node_meta(lca))
-                self.dag_ir.add_node(dag_node)
-
-                # Add input edges
-                for idx, node in enumerate(all_input_nodes):
-                    self.dag_ir.add_edge(node, dag_node.name, weight=idx)
-
-                # Replace all uses with DAG node (only 1 output node)
-                self.dag_ir.replace_all_uses_with(lca, dag_node.name)
-
-                # Remove all fused nodes
-                node_to_fuse.remove(lca)
-                for node in node_to_fuse:
-                    self.dag_ir.remove_node(node)
-
-            else:
-                raise NotImplementedError("No LCA found. Consider SplitTreeVisitor.")
+                return node_to_fuse, lca
+
+        raise NotImplementedError("No LCA found. Consider SplitTreeVisitor.")
+
+    def unfuse(self, dag_node):
+        """
+        Inline a previously fused DAG node back into the graph
+        """
+        meta = self.dag_ir.get_node_meta(dag_node)
+        subgraph = meta.subgraph
+        members = [n for n in subgraph.nodes if not subgraph.get_node_meta(n).disabled]
+        for n in members:
+            self.dag_ir.add_node(subgraph.get_node_meta(n))
+        for src, dst in subgraph.edges:
+            if dst in members:
+                weight = subgraph.get_edge_weight(src, dst)
+                # The input may have been fused as the output of another region since
+                while not self.dag_ir.has_node(src):
+                    src = self.fused_outputs[src]
+                self.dag_ir.add_edge(src, dst, weight)
+        self.dag_ir.replace_all_uses_with(dag_node, meta.output_node.name)
 
     def ensures(self) -> None:
         # Ensure that after the pass, the resulting DAG becomes a tree
@@ -56,9 +56,13 @@ class GetSmemSize:
 
     def sm90_epilogue_tile(self, tile_description):
         # Get the epilogue tile size
+        # This mirrors sm90_compute_tile_shape_or_override and sm90_get_tma_dispatch_policy
+        # in the epilogue collective builder, as over-estimating the epilogue shared
+        # memory directly costs mainloop stages.
         schedule = tile_description.epilogue_schedule
+        element_d = self.dag_ir.get_node_meta("D").element
         if schedule == cutlass_library.EpilogueScheduleType.TmaWarpSpecialized:
-            epilogue_tile_mn = (64, 32)
+            epilogue_tile_mn = (64, 64 if DataTypeSize[element_d] == 8 else 32)
         elif schedule == cutlass_library.EpilogueScheduleType.TmaWarpSpecializedCooperative:
             if tile_description.threadblock_shape[0] >= 128:
                 epilogue_tile_mn = (128, 32)
@@ -68,19 +72,19 @@ class GetSmemSize:
             raise NotImplementedError(f"Unsupported schedule: {schedule}")
 
         # Get the pipeline stages
-        stages_d = 2
         epi_tiles = product(shape_div(tuple(tile_description.threadblock_shape)[:2], epilogue_tile_mn))
+        stages_d = min(epi_tiles, 2)
         if self.dag_ir.has_node("C"):
             element_c = self.dag_ir.get_node_meta("C").element
         else:
             element_c = None
 
-        element_d = self.dag_ir.get_node_meta("D").element
-        if element_c == element_d:
-            reuse_smem_c = True
-        else:
-            reuse_smem_c = False
-        stages_c = max(epi_tiles, stages_d + 1) if reuse_smem_c else epi_tiles
+        # 8b residuals are not staged through the smem of D
+        reuse_smem_c = (
+            element_c is not None and
+            DataTypeSize[element_c] == DataTypeSize[element_d] and
+            DataTypeSize[element_d] > 8)
+        stages_c = max(min(epi_tiles, 4), stages_d + 1) if reuse_smem_c else min(epi_tiles, 4)
 
         # Record the epilogue tile
         self.cta_tile_mnk = tuple(tile_description.threadblock_shape)
@@ -82,6 +82,7 @@ from cutlass.backend.c_types import (
     get_gemm_arguments_3x,
     get_gemm_arguments_streamk,
     get_gemm_grouped_arguments,
+    get_gemm_grouped_arguments_3x,
     get_mainloop_arguments_3x,
     get_tile_scheduler_arguments_3x,
 )
@@ -95,10 +96,11 @@ from cutlass.backend.library import (
     api_version,
 )
 from cutlass.backend.memory_manager import device_mem_alloc, todevice
-from cutlass.backend.operation import ExecutableOperation, LaunchConfiguration
+from cutlass.backend.operation import ExecutableOperation, LaunchConfiguration, supports_cluster_launch
 from cutlass.backend.type_hint import GemmOperation, Tensor
 from cutlass.backend.utils.device import device_sm_count
 from cutlass.shape import GemmCoord, MatrixCoord
+from cutlass.utils.datatypes import is_cupy_tensor, is_torch_tensor
 
 
 ################################################################################
@@ -329,10 +331,10 @@ class GemmArguments2x(ArgumentBase):
         device_workspace_size = self.operation.rt_module.get_device_workspace_size(self)
 
         if device_workspace_size > 0:
-            self.workspace_buffer = device_mem_alloc(device_workspace_size)
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
             workspace_ptr = self.workspace_buffer.ptr
-            err, = cuda.cuMemsetD32(
-                workspace_ptr, 0, device_workspace_size // 4)
+            err, = cuda.cuMemsetD32Async(
+                workspace_ptr, 0, device_workspace_size // 4, self.stream)
         else:
             workspace_ptr = None
 
@@ -343,12 +345,8 @@ class GemmArguments2x(ArgumentBase):
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
 
-        self.get_arguments()
-
-        arguments, grid_tiled_shape, gemm_k_size = self.arguments
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(arguments), ctypes.c_void_p(int(device_workspace)))
-        host_workspace = bytearray(res_arg.contents)
+        self.device_workspace_ptr = device_workspace
+        host_workspace = self.kernel_params()
 
         device_workspace = None
 
@@ -356,6 +354,17 @@ class GemmArguments2x(ArgumentBase):
         self.device_workspace = device_workspace
         self.launch_config = launch_config
 
+    def kernel_params(self) -> bytearray:
+        """
+        Returns the kernel parameters for the current pointers and problem of these arguments
+        """
+        self.get_arguments()
+
+        arguments, grid_tiled_shape, gemm_k_size = self.arguments
+        res_arg = self.operation.rt_module.get_args(
+            ctypes.byref(arguments), ctypes.c_void_p(int(self.device_workspace_ptr)))
+        return bytearray(res_arg.contents)
+
     def sync(self, stream_sync=True):
         super().sync(stream_sync)
         if hasattr(self.output_op, "sync"):
@@ -424,6 +433,20 @@ class GemmArguments2xStreamK(GemmArguments2x):
         )
         return arguments
 
+    def kernel_params(self) -> bytearray:
+        """
+        Returns the kernel parameters for the current pointers and problem of these arguments
+        """
+        arguments = self.get_arguments()
+
+        res_arg = self.operation.rt_module.get_args(
+            ctypes.byref(arguments),
+            ctypes.c_void_p(int(self.device_workspace_ptr)),
+            device_sm_count(),
+            self.operation.rt_module.occupancy
+        )
+        return bytearray(res_arg.contents)
+
     def initialize(self):
         # Get the host and device workspace
         device_workspace_size = self.operation.rt_module.get_device_workspace_size(
@@ -433,10 +456,10 @@ class GemmArguments2xStreamK(GemmArguments2x):
         )
 
         if device_workspace_size > 0:
-            self.workspace_buffer = device_mem_alloc(device_workspace_size)
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
             workspace_ptr = self.workspace_buffer.ptr
-            err, = cuda.cuMemsetD32(
-                workspace_ptr, 0, device_workspace_size // 4)
+            err, = cuda.cuMemsetD32Async(
+                workspace_ptr, 0, device_workspace_size // 4, self.stream)
         else:
             workspace_ptr = None
 
@@ -447,16 +470,10 @@ class GemmArguments2xStreamK(GemmArguments2x):
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
 
-        arguments = self.get_arguments()
-
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(arguments),
-            ctypes.c_void_p(int(device_workspace)),
-            device_sm_count(),
-            self.operation.rt_module.occupancy
-        )
-        host_workspace = bytearray(res_arg.contents)
+        self.device_workspace_ptr = device_workspace
+        host_workspace = self.kernel_params()
 
+        arguments = self.get_arguments()
         grid = self.operation.rt_module.get_grid_shape(
             ctypes.byref(arguments),
             device_sm_count(),
@@ -579,15 +596,26 @@ class GemmArguments3x(GemmArguments2x):
         )
         return self.arguments
 
+    def kernel_params(self) -> bytearray:
+        """
+        Returns the kernel parameters for the current pointers and problem of these arguments
+        """
+        self.get_arguments()
+        res_arg = self.operation.rt_module.get_args(
+            ctypes.byref(self.arguments),
+            ctypes.c_void_p(int(self.device_workspace_ptr)),
+        )
+        return bytearray(res_arg.contents)
+
     def initialize(self):
         # Get the host and evice workspace
         device_workspace_size = self.operation.rt_module.get_device_workspace_size(self)
 
         if device_workspace_size > 0:
-            self.workspace_buffer = device_mem_alloc(device_workspace_size)
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
             workspace_ptr = self.workspace_buffer.ptr
-            err, = cuda.cuMemsetD32(
-                workspace_ptr, 0, device_workspace_size // 4)
+            err, = cuda.cuMemsetD32Async(
+                workspace_ptr, 0, device_workspace_size // 4, self.stream)
         else:
             workspace_ptr = None
 
@@ -598,12 +626,8 @@ class GemmArguments3x(GemmArguments2x):
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
 
-        self.get_arguments()
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(self.arguments),
-            ctypes.c_void_p(int(device_workspace)),
-        )
-        host_workspace = bytearray(res_arg.contents)
+        self.device_workspace_ptr = device_workspace
+        host_workspace = self.kernel_params()
 
         grid = self.operation.rt_module.get_grid_shape(
             ctypes.byref(self.arguments),
@@ -661,6 +685,203 @@ def GemmArguments(operation, problem_size, A, B, C, D, gemm_mode=GemmUniversalMo
     return ArgClass(operation, problem_size, A, B, C, D, gemm_mode, **kwargs)
 
 
+def _device_pointer(tensor) -> int:
+    """
+    Returns the device address of ``tensor`` without the copies and bookkeeping of ``ArgumentBase``
+    """
+    if tensor is None:
+        return 0
+    if isinstance(tensor, int):
+        return tensor
+    if isinstance(tensor, cuda.CUdeviceptr):
+        return int(tensor)
+    if is_torch_tensor(tensor):
+        return tensor.data_ptr()
+    if is_cupy_tensor(tensor):
+        return tensor.data.ptr
+    raise TypeError("Bound launchers require device tensors (torch, cupy, or cuda.CUdeviceptr)")
+
+
+class BoundGemmLauncher:
+    """
+    Launches a GEMM repeatedly on a fixed problem with low host overhead. The kernel parameters
+    are built once from ``arguments``; subsequent launches only patch the operand pointers in
+    place and reuse the packed parameters and launch configuration. The launch itself neither
+    allocates nor synchronizes, so it may be captured into a CUDA graph.
+
+    Pointers are patched directly where they appear verbatim in the kernel parameters. Kernels
+    that derive other parameters from pointers (e.g., TMA descriptors of CUTLASS 3 kernels) have
+    their parameters rebuilt through ``arguments.kernel_params()`` whenever those pointers change.
+
+    :param operation: the GEMM operation to launch
+    :type operation: :class:`cutlass.backend.GemmOperationUniversal`
+    :param arguments: arguments describing the problem and the operands initially bound
+    :type arguments: :class:`cutlass.backend.GemmArguments2x` | :class:`cutlass.backend.GemmArguments3x`
+    """
+
+    # Displacement applied to an operand pointer to locate it in the kernel parameters
+    _probe_offset = 1 << 24
+
+    def __init__(self, operation, arguments):
+        if arguments.gemm_mode == GemmUniversalMode.Array:
+            raise Exception("Bound launchers do not support GemmUniversalMode.Array.")
+        if len(arguments.host_tensors) > 0:
+            raise Exception("Bound launchers require device tensors; outputs in host memory are not copied back.")
+
+        self.operation = operation
+        self.arguments = arguments
+        self.launch_config = arguments.launch_config
+
+        # Operands A and B are exchanged in the arguments of operations that compute the transposed problem
+        self._attributes = {"A": "ptr_A", "B": "ptr_B", "C": "ptr_C", "D": "ptr_D"}
+        if operation.switched:
+            self._attributes["A"], self._attributes["B"] = "ptr_B", "ptr_A"
+
+        self.params = arguments.kernel_params()
+        self._params_buffer = (ctypes.c_char * len(self.params)).from_buffer(self.params)
+        self._packed = (ctypes.c_void_p * 1)()
+        self._packed[0] = ctypes.addressof(self._params_buffer)
+
+        self._offsets = {name: self._locate(name) for name in self._attributes.keys()}
+
+        self._config = None
+        if supports_cluster_launch():
+            self._config = self._cluster_launch_config()
+
+    def _pointer(self, name: str) -> int:
+        return int(getattr(self.arguments, self._attributes[name]))
+
+    def _set_pointer(self, name: str, ptr: int):
+        setattr(self.arguments, self._attributes[name], cuda.CUdeviceptr(ptr))
+
+    def _locate(self, name: str):
+        """
+        Returns the offsets in the kernel parameters at which the pointer of operand ``name`` is
+        stored verbatim, or ``None`` if the parameters depend on the pointer in other ways
+        """
+        ptr = self._pointer(name)
+        if ptr == 0:
+            return None
+
+        self._set_pointer(name, ptr + self._probe_offset)
+        try:
+            probed = self.arguments.kernel_params()
+        finally:
+            self._set_pointer(name, ptr)
+
+        # Bytes that differ between identical builds (e.g., padding) are not attributed to the pointer
+        rebuilt = self.arguments.kernel_params()
+        offsets = []
+        changed = [i for i in range(len(self.params)) if self.params[i] != probed[i] and self.params[i] == rebuilt[i]]
+        for offset in range(0, len(self.params) - 7, 8):
+            if (int.from_bytes(self.params[offset:offset + 8], "little") == ptr and
+                int.from_bytes(probed[offset:offset + 8], "little") == ptr + self._probe_offset):
+                offsets.append(offset)
+
+        covered = set(i for offset in offsets for i in range(offset, offset + 8))
+        if len(offsets) == 0 or not set(changed).issubset(covered):
+            return None
+        return offsets
+
+    def _cluster_launch_config(self):
+        attrs = []
+        cluster_shape = getattr(self.operation.tile_description, "cluster_shape", None)
+        if cluster_shape is not None:
+            attr = cuda.CUlaunchAttribute()
+            attr.value.clusterDim.x, attr.value.clusterDim.y, attr.value.clusterDim.z = cluster_shape
+            attr.id = cuda.CUstreamAttrID.CU_LAUNCH_ATTRIBUTE_CLUSTER_DIMENSION
+            attrs.append(attr)
+
+            # Allow for non-portable cluster sizes
+            err, = cuda.cuFuncSetAttribute(
+                self.operation.rt_module.kernel,
+                cuda.CUfunction_attribute.CU_FUNC_ATTRIBUTE_NON_PORTABLE_CLUSTER_SIZE_ALLOWED, 1)
+            if err != cuda.CUresult.CUDA_SUCCESS:
+                raise RuntimeError("CUDA Error %s" % str(err))
+
+        config = cuda.CUlaunchConfig()
+        config.gridDimX, config.gridDimY, config.gridDimZ = self.launch_config.grid
+        config.blockDimX, config.blockDimY, config.blockDimZ = self.launch_config.block
+        config.sharedMemBytes = self.launch_config.shared_memory_capacity
+        config.attrs = attrs
+        config.numAttrs = len(attrs)
+        return config
+
+    def bind(self, A=None, B=None, C=None, D=None):
+        """
+        Rebinds the operands of subsequent launches. Operands that are ``None`` remain bound to
+        their previous tensors. Tensors must have the shapes and layouts of those initially bound.
+        """
+        rebuild = False
+        for name, tensor in (("A", A), ("B", B), ("C", C), ("D", D)):
+            if tensor is None:
+                continue
+            ptr = _device_pointer(tensor)
+            if ptr == self._pointer(name):
+                continue
+            self._set_pointer(name, ptr)
+            offsets = self._offsets[name]
+            if offsets is None:
+                rebuild = True
+            else:
+                raw = ptr.to_bytes(8, "little")
+                for offset in offsets:
+                    self.params[offset:offset + 8] = raw
+
+        if rebuild:
+            self._params_buffer[:] = bytes(self.arguments.kernel_params())
+
+    def __call__(self, A=None, B=None, C=None, D=None, stream: cuda.CUstream = None):
+        """
+        Rebinds any operands given and launches the kernel
+
+        :param stream: cuda stream, defaults to the stream of the arguments the launcher was built from
+        :type stream: :class:`cuda.cuda.CUstream`
+        """
+        if A is not None or B is not None or C is not None or D is not None:
+            self.bind(A, B, C, D)
+
+        if stream is None:
+            stream = self.arguments.stream
+
+        if self._config is not None:
+            self._config.hStream = stream
+            err, = cuda.cuLaunchKernelEx(
+                self._config, f=self.operation.rt_module.kernel, kernelParams=self._packed, extra=0)
+        else:
+            err = self.operation.rt_module.run_without_clusters(self.launch_config, self._packed, stream)
+
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+        return err
+
+    def graph(self, stream: cuda.CUstream = None):
+        """
+        Captures a launch with the currently bound operands into a CUDA graph. Replay it with
+        ``cuda.cuGraphLaunch(graph_exec, stream)``. Operands rebound later do not affect the graph.
+
+        :return: instantiated graph
+        :rtype: cuda.CUgraphExec
+        """
+        if stream is None or int(stream) == 0:
+            raise Exception("Capturing a CUDA graph requires a stream other than the legacy default stream.")
+
+        err, = cuda.cuStreamBeginCapture(stream, cuda.CUstreamCaptureMode.CU_STREAM_CAPTURE_MODE_THREAD_LOCAL)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+        try:
+            self(stream=stream)
+        finally:
+            err, graph = cuda.cuStreamEndCapture(stream)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+
+        err, graph_exec = cuda.cuGraphInstantiate(graph, 0)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+        return graph_exec
+
+
 class GemmGroupedArguments:
     """
     Argument wrapper for GEMM Grouped. It encodes problem information and
@@ -823,10 +1044,10 @@ class GemmGroupedArguments:
         device_workspace_size = self.operation.rt_module.get_device_workspace_size(self)
 
         if device_workspace_size > 0:
-            self.workspace_buffer = device_mem_alloc(device_workspace_size)
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
             workspace_ptr = self.workspace_buffer.ptr
-            err, = cuda.cuMemsetD32(
-                workspace_ptr, 0, device_workspace_size // 4)
+            err, = cuda.cuMemsetD32Async(
+                workspace_ptr, 0, device_workspace_size // 4, self.stream)
         else:
             workspace_ptr = None
 
@@ -857,6 +1078,211 @@ class GemmGroupedArguments:
             arg.sync(stream_sync=False)
 
 
+class GemmGroupedArguments3x:
+    """
+    Argument wrapper for CUTLASS 3 grouped GEMM (SM90 ptr-array kernels).
+
+    The group can be described in one of two ways:
+
+    * Host lists: ``problem_sizes`` is a list of :class:`cutlass.shape.GemmCoord` and ``A``, ``B``,
+      ``C``, and ``D`` are lists of tensors. The pointer, stride, and problem-shape arrays are
+      assembled and copied to the device, as for the CUTLASS 2 grouped GEMM.
+
+    * Device arrays: ``problem_sizes`` is a device tensor of ``num_groups`` packed (M, N, K) ``int32``
+      triples, ``A``, ``B``, ``C``, and ``D`` are device tensors of ``int64`` per-group pointers, and
+      ``stride_A``, ``stride_B``, ``stride_C``, and ``stride_D`` are device tensors of ``int64``
+      per-group leading dimensions. Nothing is read or copied on the host, so these arrays may be
+      written by a preceding kernel on ``stream`` (e.g., a mixture-of-experts router).
+
+    :param operation: the GEMM Grouped operation to take the argument
+    :type operation: :class:`cutlass.backend.GemmOperationGrouped`
+
+    :param problem_sizes: list of GEMM problem sizes, or device tensor of per-group (M, N, K)
+    :type problem_sizes: list[:class:`cutlass.shape.GemmCoord`] | torch.Tensor | cupy.ndarray | int
+
+    :param A: list of tensor A, or device tensor of pointers to A
+    :param B: list of tensor B, or device tensor of pointers to B
+    :param C: list of tensor C, or device tensor of pointers to C
+    :param D: list of tensor D, or device tensor of pointers to D
+
+    :param stride_A: device tensor of leading dimensions of A. Selects the device-array form when set
+    :param stride_B: device tensor of leading dimensions of B
+    :param stride_C: device tensor of leading dimensions of C
+    :param stride_D: device tensor of leading dimensions of D
+
+    :param num_groups: number of groups. Required with device arrays, in which case it is the
+                       capacity of the arrays
+    :type num_groups: int
+
+    :param device_num_groups: optional device pointer to an ``int32`` holding the number of groups
+                              to compute. ``num_groups`` then only bounds it
+    :type device_num_groups: torch.Tensor | cupy.ndarray | int
+
+    :param alpha: scalar scaling the product of A and B, defaults to 1
+    :param beta: scalar scaling C, defaults to 0
+    :param alpha_ptr_array: optional device array of per-group pointers to alpha, overriding ``alpha``
+    :param beta_ptr_array: optional device array of per-group pointers to beta, overriding ``beta``
+
+    :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+    :type stream: :class:`cuda.cuda.CUstream`
+    """
+
+    def __init__(self, operation, problem_sizes, A, B, C, D,
+                 stride_A=None, stride_B=None, stride_C=None, stride_D=None,
+                 num_groups: int = None, device_num_groups=None, **kwargs):
+        self.operation = operation
+        self.stream = kwargs.get("stream", cuda.CUstream(0))
+        self.alpha = kwargs.get("alpha", 1.0)
+        self.beta = kwargs.get("beta", 0.0)
+        self.alpha_ptr_array = _device_pointer(kwargs.get("alpha_ptr_array", None))
+        self.beta_ptr_array = _device_pointer(kwargs.get("beta_ptr_array", None))
+
+        self.gemm_arguments = []
+        self.host_problem_size_array = None
+
+        if stride_A is None:
+            self._from_host_lists(problem_sizes, A, B, C, D)
+        else:
+            if num_groups is None:
+                raise Exception("num_groups must be provided when describing the group with device arrays")
+            if device_num_groups is None and hasattr(problem_sizes, "shape") and problem_sizes.shape[0] < num_groups:
+                raise Exception(f"problem_sizes holds {problem_sizes.shape[0]} groups, fewer than num_groups={num_groups}")
+            self.problem_count = num_groups
+            self.problem_size_ptr = _device_pointer(problem_sizes)
+            self.ptr_A_ptr, self.ptr_B_ptr, self.ptr_C_ptr, self.ptr_D_ptr = (
+                _device_pointer(t) for t in (A, B, C, D))
+            self.lda_ptr, self.ldb_ptr, self.ldc_ptr, self.ldd_ptr = (
+                _device_pointer(t) for t in (stride_A, stride_B, stride_C, stride_D))
+            self.host_problem_size_ptr = 0
+
+        self.device_num_groups_ptr = _device_pointer(device_num_groups)
+
+        self.initialize()
+
+    def _from_host_lists(self, problem_sizes, A, B, C, D):
+        self.problem_count = len(problem_sizes)
+
+        assert len(A) == self.problem_count
+        assert len(B) == self.problem_count
+        assert len(C) == self.problem_count
+        assert len(D) == self.problem_count
+
+        problem_size_host = []
+        ptr_A_host, ptr_B_host, ptr_C_host, ptr_D_host = [], [], [], []
+        lda_host, ldb_host, ldc_host, ldd_host = [], [], [], []
+
+        for idx, problem_size in enumerate(problem_sizes):
+            temp_argument = GemmArguments2x(
+                operation=self.operation,
+                problem_size=GemmCoord(problem_size.m, problem_size.n, problem_size.k),
+                A=A[idx], B=B[idx], C=C[idx], D=D[idx])
+            self.gemm_arguments.append(temp_argument)
+
+            problem_size_host.append([problem_size.m, problem_size.n, problem_size.k])
+            ptr_A_host.append(int(temp_argument.ptr_A))
+            ptr_B_host.append(int(temp_argument.ptr_B))
+            ptr_C_host.append(int(temp_argument.ptr_C))
+            ptr_D_host.append(int(temp_argument.ptr_D))
+            lda_host.append(temp_argument.lda)
+            ldb_host.append(temp_argument.ldb)
+            ldc_host.append(temp_argument.ldc)
+            ldd_host.append(temp_argument.ldd)
+
+        self.problem_size_buffer = todevice(problem_size_host, np.int32)
+        self.ptr_A_buffer = todevice(ptr_A_host, np.int64)
+        self.ptr_B_buffer = todevice(ptr_B_host, np.int64)
+        self.ptr_C_buffer = todevice(ptr_C_host, np.int64)
+        self.ptr_D_buffer = todevice(ptr_D_host, np.int64)
+        self.lda_buffer = todevice(lda_host, np.int64)
+        self.ldb_buffer = todevice(ldb_host, np.int64)
+        self.ldc_buffer = todevice(ldc_host, np.int64)
+        self.ldd_buffer = todevice(ldd_host, np.int64)
+
+        self.problem_size_ptr = self.problem_size_buffer.ptr
+        self.ptr_A_ptr, self.ptr_B_ptr = self.ptr_A_buffer.ptr, self.ptr_B_buffer.ptr
+        self.ptr_C_ptr, self.ptr_D_ptr = self.ptr_C_buffer.ptr, self.ptr_D_buffer.ptr
+        self.lda_ptr, self.ldb_ptr = self.lda_buffer.ptr, self.ldb_buffer.ptr
+        self.ldc_ptr, self.ldd_ptr = self.ldc_buffer.ptr, self.ldd_buffer.ptr
+
+        # Host copy of the problem shapes lets the kernel size its grid to the actual number of tiles
+        self.host_problem_size_array = np.array(problem_size_host, dtype=np.int32)
+        self.host_problem_size_ptr = self.host_problem_size_array.__array_interface__["data"][0]
+
+    def get_arguments(self):
+        self.arguments = self.operation.argument_type(
+            self.problem_count,
+            int(self.problem_size_ptr),
+            int(self.host_problem_size_ptr),
+            int(self.device_num_groups_ptr),
+            int(self.ptr_A_ptr), int(self.lda_ptr),
+            int(self.ptr_B_ptr), int(self.ldb_ptr),
+            int(self.ptr_C_ptr), int(self.ldc_ptr),
+            int(self.ptr_D_ptr), int(self.ldd_ptr),
+            int(self.alpha_ptr_array),
+            int(self.beta_ptr_array),
+            float(self.alpha),
+            float(self.beta),
+            device_sm_count(),
+        )
+        return self.arguments
+
+    def kernel_params(self) -> bytearray:
+        """
+        Returns the kernel parameters for the current pointers and problem of these arguments
+        """
+        self.get_arguments()
+        res_arg = self.operation.rt_module.get_args(
+            ctypes.byref(self.arguments),
+            ctypes.c_void_p(int(self.device_workspace_ptr)),
+        )
+        return bytearray(res_arg.contents)
+
+    def initialize(self):
+        rt_module = self.operation.rt_module
+        self.get_arguments()
+
+        # The workspace holds the per-SM TMA descriptors that the kernel rewrites for each group
+        device_workspace_size = rt_module.get_kernel_workspace_size(ctypes.byref(self.arguments))
+        if device_workspace_size > 0:
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
+            workspace_ptr = self.workspace_buffer.ptr
+            err, = cuda.cuMemsetD8Async(workspace_ptr, 0, device_workspace_size, self.stream)
+            if err != cuda.CUresult.CUDA_SUCCESS:
+                raise RuntimeError(f"CUDA error on call to cuMemsetD8Async: {cuda.cuGetErrorString(err)[1]}")
+        else:
+            workspace_ptr = 0
+
+        status = rt_module.initialize_workspace(
+            ctypes.byref(self.arguments),
+            ctypes.c_void_p(int(workspace_ptr)),
+            ctypes.c_void_p(int(self.stream)),
+        )
+        if status != 0:
+            raise RuntimeError(f"Failed to initialize the grouped GEMM workspace (cutlass::Status {status})")
+
+        self.device_workspace_ptr = workspace_ptr
+        self.host_workspace = self.kernel_params()
+        self.device_workspace = None
+
+        grid = rt_module.get_grid_shape(
+            ctypes.byref(self.arguments),
+            ctypes.c_void_p(int(workspace_ptr)),
+        )
+        block = rt_module.get_block_shape()
+        self.launch_config = LaunchConfiguration(
+            [grid.x, grid.y, grid.z],
+            [block.x, block.y, block.z],
+            rt_module.shared_memory_capacity,
+        )
+
+    def sync(self):
+        err, = cudart.cudaDeviceSynchronize()
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+        for arg in self.gemm_arguments:
+            arg.sync(stream_sync=False)
+
+
 ################################################################################
 # Base class for GEMM runtime module
 ################################################################################
@@ -1481,6 +1907,211 @@ ${operation_name}(${operation_name}${operation_suffix}::Params params) {
             return 8 * entries_per_block * total_tiles  # three int32_t
 
 
+class GemmRTGrouped3x(GemmRTbase):
+    """
+    Manages the CUTLASS runtime components for 3.x grouped (ptr-array) kernels
+    """
+
+    KernelTemplate = GemmRTUniversal3x.KernelTemplate
+
+    HostTemplate = r"""
+using GemmType = ${operation_name}_base;
+using UnderlyingProblemShape = typename GemmType::ProblemShape::UnderlyingProblemShape;
+
+static_assert(sizeof(UnderlyingProblemShape) == 3 * sizeof(int),
+              "Problem shapes are passed as packed (M, N, K) int32 triples");
+static_assert(sizeof(typename GemmType::InternalStrideA) == sizeof(int64_t) &&
+              sizeof(typename GemmType::InternalStrideB) == sizeof(int64_t) &&
+              sizeof(typename GemmType::InternalStrideC) == sizeof(int64_t) &&
+              sizeof(typename GemmType::InternalStrideD) == sizeof(int64_t),
+              "Strides are passed as a single int64 leading dimension per group");
+
+// Mirrors the ctypes structure returned by get_gemm_grouped_arguments_3x
+struct ${operation_name}_grouped_arguments {
+  int num_groups;
+  void* problem_shapes;
+  void const* host_problem_shapes;
+  int32_t const* device_num_groups;
+  void const* ptr_A;
+  void* stride_A;
+  void const* ptr_B;
+  void* stride_B;
+  void const* ptr_C;
+  void* stride_C;
+  void* ptr_D;
+  void* stride_D;
+  void const* alpha_ptr_array;
+  void const* beta_ptr_array;
+  double alpha;
+  double beta;
+  int sm_count;
+};
+
+static GemmType::Arguments
+${operation_name}_make_arguments(${operation_name}_grouped_arguments const& args) {
+  using ElementScalar = decltype(GemmType::CollectiveEpilogue::Arguments{}.thread.alpha);
+
+  GemmType::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {
+      args.num_groups,
+      static_cast<UnderlyingProblemShape*>(args.problem_shapes),
+      static_cast<UnderlyingProblemShape const*>(args.host_problem_shapes),
+      args.device_num_groups
+    },
+    {
+      static_cast<typename GemmType::ElementA const**>(const_cast<void*>(args.ptr_A)),
+      static_cast<typename GemmType::InternalStrideA*>(args.stride_A),
+      static_cast<typename GemmType::ElementB const**>(const_cast<void*>(args.ptr_B)),
+      static_cast<typename GemmType::InternalStrideB*>(args.stride_B)
+    },
+    {
+      {},
+      static_cast<typename GemmType::ElementC const**>(const_cast<void*>(args.ptr_C)),
+      static_cast<typename GemmType::InternalStrideC*>(args.stride_C),
+      static_cast<typename GemmType::ElementD**>(args.ptr_D),
+      static_cast<typename GemmType::InternalStrideD*>(args.stride_D)
+    }
+  };
+  arguments.epilogue.thread.alpha = ElementScalar(args.alpha);
+  arguments.epilogue.thread.beta = ElementScalar(args.beta);
+  arguments.epilogue.thread.alpha_ptr_array = static_cast<ElementScalar const* const*>(args.alpha_ptr_array);
+  arguments.epilogue.thread.beta_ptr_array = static_cast<ElementScalar const* const*>(args.beta_ptr_array);
+  arguments.hw_info.device_id = 0;
+  arguments.hw_info.sm_count = args.sm_count;
+  return arguments;
+}
+
+extern "C" {
+  // Get the size of params in bytes
+  int ${operation_name}_get_param_size(){
+    return sizeof(${operation_name}${operation_suffix}::Params);
+  }
+
+  // Get the size of dynamic shared memory in bytes
+  int ${operation_name}_shared_memory_size() {
+    return ${operation_name}${operation_suffix}::SharedStorageSize;
+  }
+
+  // Get the workspace size
+  uint64_t ${operation_name}_get_kernel_workspace_size(${operation_name}_grouped_arguments* argument) {
+    return GemmType::get_workspace_size(${operation_name}_make_arguments(*argument));
+  }
+
+  // Initialize the workspace on the given stream
+  int ${operation_name}_initialize_workspace(${operation_name}_grouped_arguments* argument, void* workspace, void* stream) {
+    return int(GemmType::initialize_workspace(
+      ${operation_name}_make_arguments(*argument), workspace, static_cast<cudaStream_t>(stream)));
+  }
+
+  // Get the params as byte array
+  char* ${operation_name}_get_params(${operation_name}_grouped_arguments* argument, void* workspace){
+    GemmType::Params params = GemmType::to_underlying_arguments(
+      ${operation_name}_make_arguments(*argument), workspace);
+    char *bytes = ((char*)(&params));
+    char *output = new char[sizeof(GemmType::Params)];
+    for (unsigned int i = 0; i < sizeof(GemmType::Params); i ++)
+        output[i] = bytes[i];
+
+    return output;
+  }
+
+  // Get the grid shape
+  dim3 ${operation_name}_get_grid_shape(${operation_name}_grouped_arguments* argument, void* workspace) {
+    auto tmp_params = GemmType::to_underlying_arguments(
+      ${operation_name}_make_arguments(*argument), workspace);
+    return GemmType::get_grid_shape(tmp_params);
+  }
+
+  // Get the block shape
+  dim3 ${operation_name}_get_block_shape() {
+    return GemmType::get_block_shape();
+  }
+}
+  """
+
+    def __init__(self, operation: "GemmOperation"):
+        super(GemmRTGrouped3x, self).__init__(operation)
+        if hasattr(operation.epilogue_functor, "visitor"):
+            raise Exception("Epilogue visitor trees are not currently supported for CUTLASS 3 grouped GEMMs")
+        self.extra_funcs = {
+            "get_grid_shape": dim3_,
+            "get_block_shape": dim3_,
+            "get_kernel_workspace_size": ctypes.c_uint64,
+            "initialize_workspace": ctypes.c_int,
+        }
+        self.emitter = EmitGemmGroupedInstance3x("_type")
+        self.argument_type, self.epilogue_type = get_gemm_grouped_arguments_3x(operation.epilogue_functor)
+        self.argtype = [ctypes.POINTER(self.argument_type), ctypes.c_void_p]
+
+
+class EmitGemmGroupedInstance3x(EmitGemmUniversalInstance3x):
+    """Responsible for emitting a CUTLASS 3 grouped (ptr-array) template definition"""
+
+    def __init__(self, operation_suffix=""):
+        super().__init__(operation_suffix)
+        self.includes.append("cutlass/gemm/group_array_problem_shape.hpp")
+        self.gemm_template_kernel = """
+using namespace cute;
+
+using CollectiveEpilogue =
+  typename cutlass::epilogue::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    cute::Shape<cute::_${threadblock_shape_m}, cute::_${threadblock_shape_n}, cute::_${threadblock_shape_k}>,
+    cute::Shape<cute::_${cluster_m},cute::_${cluster_n},cute::_${cluster_k}>,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ${element_accumulator}, ${element_epilogue},
+    ${element_c}, ${layout_c} *, ${align_c},
+    ${element_d}, ${layout_d} *, ${align_d},
+    ${epilogue_schedule}
+  >::CollectiveOp;
+
+using CollectiveMainloop =
+  typename cutlass::gemm::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${element_a}, ${layout_a} *, ${align_a},
+    ${element_b}, ${layout_b} *, ${align_b},
+    ${element_accumulator},
+    cute::Shape<cute::_${threadblock_shape_m}, cute::_${threadblock_shape_n}, cute::_${threadblock_shape_k}>,
+    cute::Shape<cute::_${cluster_m},cute::_${cluster_n},cute::_${cluster_k}>,
+    ${stage_count_type},
+    ${kernel_schedule}
+  >::CollectiveOp;
+
+// Gemm operator ${operation_name}
+using ${operation_name}_base = cutlass::gemm::kernel::GemmUniversal<
+    cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+    CollectiveMainloop,
+    CollectiveEpilogue
+>;
+
+// Define named type
+struct ${operation_name}${operation_suffix} :
+  public ${operation_name}_base { };
+"""
+        self.gemm_template_device = self.gemm_template_kernel + """
+
+// Define device-level operator
+using DeviceKernel = cutlass::gemm::device::GemmUniversalAdapter<${operation_name}${operation_suffix}>;
+"""
+
+    def emit(self, operation):
+        kschedule = operation.tile_description.kernel_schedule
+        eschedule = operation.tile_description.epilogue_schedule
+        ptr_array_kernel_schedules = [
+            KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative,
+            KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong,
+        ]
+        ptr_array_epilogue_schedules = [
+            EpilogueScheduleType.PtrArrayTmaWarpSpecializedCooperative,
+            EpilogueScheduleType.PtrArrayTmaWarpSpecializedPingpong,
+        ]
+        if kschedule not in ptr_array_kernel_schedules or eschedule not in ptr_array_epilogue_schedules:
+            raise Exception("CUTLASS 3 grouped GEMMs require ptr-array kernel and epilogue schedules. "
+                            f"Got {kschedule} and {eschedule}.")
+        return super().emit(operation)
+
+
 ################################################################################
 # Runtime module for GEMM and grouped GEMM
 ################################################################################
@@ -1770,11 +2401,16 @@ class GemmOperationUniversal(GemmOperationBase):
 class GemmOperationGrouped(GemmOperationBase):
     def __init__(self, arch, tile_description: TileDescription, A: TensorDescription, B, C,
         epilogue_functor, swizzling_functor=SwizzlingFunctor.Identity1, **kwargs):
+        api = api_version(arch, tile_description.math_instruction.opcode_class, A.element)
         super(GemmOperationGrouped, self).__init__(GemmKind.Grouped, arch, tile_description,
-                                                   A, B, C, epilogue_functor, swizzling_functor, **kwargs)
+                                                   A, B, C, epilogue_functor, swizzling_functor,
+                                                   api=api, **kwargs)
         assert "precompute_mode" in kwargs.keys(), "missing keyword arguement 'precompute_mode'."
         self.precompute_mode = kwargs["precompute_mode"]
-        self.rt_module = GemmRTGrouped(self)
+        if api == ApiVersion.v3x:
+            self.rt_module = GemmRTGrouped3x(self)
+        else:
+            self.rt_module = GemmRTGrouped(self)
         self.argument_type = self.rt_module.argument_type
         self.epilogue_type = self.rt_module.epilogue_type
 
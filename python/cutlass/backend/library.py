@@ -111,6 +111,7 @@ ShortSchedulerModeNames = {SchedulerMode.Device: "Device", SchedulerMode.Host: "
 class FunctionalOp(enum.Enum):
     AtomicAdd = enum_auto()
     AtomicMaximum = enum_auto()
+    AtomicMinimum = enum_auto()
     Divides = enum_auto()
     Maximum = enum_auto()
     Minimum = enum_auto()
@@ -123,6 +124,7 @@ class FunctionalOp(enum.Enum):
 FunctionalOpTag = {
     FunctionalOp.AtomicAdd: "cutlass::atomic_add",
     FunctionalOp.AtomicMaximum: "cutlass::atomic_maximum",
+    FunctionalOp.AtomicMinimum: "cutlass::atomic_minimum",
     FunctionalOp.Divides: "cutlass::divides",
     FunctionalOp.Maximum: "cutlass::maximum",
     FunctionalOp.Minimum: "cutlass::minimum",
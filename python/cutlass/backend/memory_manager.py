@@ -35,10 +35,10 @@ import numpy as np
 import cutlass
 from cutlass.utils.datatypes import is_numpy_tensor
 
+from cuda import cuda, cudart
+
 if cutlass.use_rmm:
     import rmm
-else:
-    from cuda import cudart
 
 
 class PoolMemoryManager:
@@ -67,6 +67,123 @@ class DevicePtrWrapper:
     def ptr(self):
         return self.dev_ptr
 
+    def free(self):
+        """
+        Returns the memory to the allocator it was obtained from
+        """
+        err, = cudart.cudaFree(self.dev_ptr)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise RuntimeError(f"cudaFree failed with error {err}")
+
+
+class StreamOrderedPtrWrapper(DevicePtrWrapper):
+    """
+    Device memory obtained from the device's memory pool in stream order. It is returned to the
+    pool in the order of the stream it was allocated on, either explicitly or when the wrapper is
+    garbage collected, and may be reused by subsequent allocations without synchronization.
+    """
+    def __init__(self, dev_ptr, stream):
+        super().__init__(dev_ptr)
+        self.stream = stream
+
+    def free(self):
+        if self.dev_ptr is None:
+            return
+        err, = cudart.cudaFreeAsync(self.dev_ptr, self.stream)
+        self.dev_ptr = None
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise RuntimeError(f"cudaFreeAsync failed with error {err}")
+
+    def __del__(self):
+        try:
+            self.free()
+        except Exception:
+            # The CUDA context may already have been destroyed at interpreter shutdown
+            pass
+
+
+class BorrowedPtrWrapper(DevicePtrWrapper):
+    """
+    Device memory owned by another allocator (e.g., a tensor from the PyTorch caching allocator).
+    The memory is released by dropping the reference to its owner.
+    """
+    def __init__(self, dev_ptr, owner):
+        super().__init__(dev_ptr)
+        self.owner = owner
+
+    def free(self):
+        self.owner = None
+
+
+class StreamOrderedAllocator:
+    """
+    Allocates from the default memory pool of the current device with ``cudaMallocAsync``. Memory
+    freed back to the pool is retained up to ``release_threshold`` bytes (by default, all of it)
+    rather than returned to the driver, so workspaces are reused across calls.
+    """
+    def __init__(self, release_threshold: int = None):
+        err, self.pool = cudart.cudaDeviceGetDefaultMemPool(cutlass.device_id())
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise RuntimeError(f"cudaDeviceGetDefaultMemPool failed with error {err}")
+
+        if release_threshold is None:
+            release_threshold = 2 ** 64 - 1
+        err, = cudart.cudaMemPoolSetAttribute(
+            self.pool,
+            cudart.cudaMemPoolAttr.cudaMemPoolAttrReleaseThreshold,
+            cuda.cuuint64_t(release_threshold))
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise RuntimeError(f"cudaMemPoolSetAttribute failed with error {err}")
+
+    def __call__(self, size, stream):
+        err, ptr = cudart.cudaMallocFromPoolAsync(size, self.pool, stream)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise RuntimeError(f"cudaMallocFromPoolAsync failed with error {err}")
+        return StreamOrderedPtrWrapper(ptr, stream)
+
+
+class TorchAllocator:
+    """
+    Allocates through the PyTorch caching allocator, so that CUTLASS workspaces share the pool
+    of the surrounding PyTorch program instead of fragmenting memory with a second one
+    """
+    def __call__(self, size, stream):
+        import torch
+
+        device = torch.device("cuda", cutlass.device_id())
+        if int(stream) == 0:
+            tensor = torch.empty(size, dtype=torch.uint8, device=device)
+        else:
+            # Associate the allocation with ``stream`` so the caching allocator orders its reuse after it
+            with torch.cuda.stream(torch.cuda.ExternalStream(int(stream), device=device)):
+                tensor = torch.empty(size, dtype=torch.uint8, device=device)
+        return BorrowedPtrWrapper(tensor.data_ptr(), tensor)
+
+
+_device_allocator = None
+
+
+def set_device_allocator(allocator):
+    """
+    Sets the allocator used for device memory (e.g., workspaces and copies of host operands).
+
+    :param allocator: one of ``"default"`` (``cudaMalloc``, or RMM if it is in use), ``"stream_ordered"``
+                      (``StreamOrderedAllocator``), ``"torch"`` (``TorchAllocator``), or a callable
+                      taking a size in bytes and a stream and returning either a ``DevicePtrWrapper``
+                      or an object owning the memory that exposes ``data_ptr()`` or ``ptr``
+    """
+    global _device_allocator
+    if allocator is None or allocator == "default":
+        _device_allocator = None
+    elif allocator == "stream_ordered":
+        _device_allocator = StreamOrderedAllocator()
+    elif allocator == "torch":
+        _device_allocator = TorchAllocator()
+    elif callable(allocator):
+        _device_allocator = allocator
+    else:
+        raise Exception(f"Unsupported device allocator {allocator}")
+
 
 def _todevice(host_data):
     """
@@ -98,7 +215,18 @@ def todevice(host_data, dtype=np.float32):
         return _todevice(host_data)
 
 
-def device_mem_alloc(size):
+def device_mem_alloc(size, stream=None):
+    if _device_allocator is not None:
+        if stream is None:
+            stream = cuda.CUstream(0)
+        buffer = _device_allocator(size, stream)
+        if isinstance(buffer, DevicePtrWrapper):
+            return buffer
+        elif hasattr(buffer, "data_ptr"):
+            return BorrowedPtrWrapper(buffer.data_ptr(), buffer)
+        else:
+            return BorrowedPtrWrapper(int(buffer.ptr), buffer)
+
     if cutlass.use_rmm:
         return rmm.DeviceBuffer(size=size)
     else:
@@ -196,16 +196,13 @@ class ReductionArguments:
         """
         Frees allocated device-side memory
         """
-        # Free any device memory allocated manually
-        if not cutlass.use_rmm:
-            for attr in ["destination_buffer", "source_buffer"]:
-                if hasattr(self, attr):
-                    buf = getattr(self, attr)
-                    if isinstance(buf, DevicePtrWrapper):
-                        err, = cudart.cudaFree(buf.ptr)
-                        if err != cudart.cudaError_t.cudaSuccess:
-                            raise RuntimeError(f"cudaFree failed with error {err}")
-                        del buf
+        # Free any device memory allocated manually. RMM buffers are freed when garbage collected.
+        for attr in ["destination_buffer", "source_buffer"]:
+            if hasattr(self, attr):
+                buf = getattr(self, attr)
+                if isinstance(buf, DevicePtrWrapper):
+                    buf.free()
+                    del buf
 
 
 class ReductionRT(ExecutableOperation):
@@ -30,4 +30,5 @@
 #
 #################################################################################################
 
+from cutlass.emit.c_library import c_library
 from cutlass.emit.pytorch import pytorch
@@ -0,0 +1,431 @@
+#################################################################################################
+#
+# Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Utilities for ahead-of-time export of CUTLASS GEMMs built through the Python interface as a
+standalone shared library with a C ABI, so that they can be used by C and C++ applications without
+Python.
+
+Example usage:
+
+.. highlight:: python
+.. code-block:: python
+
+    plan = cutlass.op.Gemm(element=torch.float16, layout=cutlass.LayoutType.RowMajor)
+    plan.tile_description = ...  # e.g., the configuration selected by profiling
+    op = plan.construct()
+
+    cutlass.emit.c_library({"gemm_f16": op}, "my_kernels", cc=90, sourcedir="output", build=True,
+                           problem_shapes={"gemm_f16": [(4096, 4096, 4096)]})
+
+After this call, the directory ``output`` contains ``my_kernels.h``, ``my_kernels.cu``,
+``my_kernels_manifest.json``, and, since ``build=True``, ``libmy_kernels.so``. The shared library
+embeds the device code of every operation, and exposes the following functions for each of them,
+prefixed with the name under which the operation was passed:
+
+.. highlight:: c
+.. code-block:: c
+
+    int gemm_f16_can_implement(int M, int N, int K, int L);
+    size_t gemm_f16_workspace_size(int M, int N, int K, int L);
+    int gemm_f16_run(int M, int N, int K, int L,
+                     void const* A, void const* B, void const* C, void* D,
+                     float alpha, float beta, void* workspace, void* stream);
+
+Functions returning ``int`` return a ``cutlass::Status`` value, which is zero on success. Tensors
+are packed with the layouts of the operation, ``L`` is the batch count, and ``stream`` is a
+``cudaStream_t``. The manifest describes each operation (data types, layouts, alignments, tile and
+cluster shapes, schedules), along with the problem shapes it was selected for, if provided.
+
+Only GEMMs with linear combination epilogues can currently be exported.
+"""
+
+import json
+import os
+
+from cutlass_library import DataTypeNames, ShortLayoutTypeNames, SubstituteTemplate
+
+from cutlass import CUTLASS_PATH, cuda_install_path
+from cutlass.backend.compiler import compile_with_nvcc
+from cutlass.backend.gemm_operation import GemmOperationUniversal
+from cutlass.backend.library import ApiVersion
+from cutlass.emit import common
+
+# Incremented whenever the signature of an exported function changes
+_C_LIBRARY_ABI_VERSION = 1
+
+
+_C_LIBRARY_HEADER_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ${NAME}_ABI_VERSION ${abi_version}
+
+// Version of the C ABI the library was built with
+int ${name}_abi_version(void);
+
+${declarations}
+#ifdef __cplusplus
+}
+#endif
+"""
+
+_C_LIBRARY_GEMM_DECLARATION = """
+// ${symbol}: ${procedural_name}
+// Returns zero if the operation supports the problem
+int ${symbol}_can_implement(int M, int N, int K, int L);
+// Bytes of device workspace required by the operation for the problem
+size_t ${symbol}_workspace_size(int M, int N, int K, int L);
+// Computes D = alpha * (A @ B) + beta * C on `stream` (a cudaStream_t). C may be null if beta is zero.
+int ${symbol}_run(int M, int N, int K, int L,
+    void const* A, void const* B, void const* C, void* D,
+    float alpha, float beta, void* workspace, void* stream);
+"""
+
+_C_LIBRARY_CUDA_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
+#include <cuda_runtime.h>
+#include "cutlass/cutlass.h"
+#include "cutlass/kernel_hardware_info.h"
+${includes}
+#include "${name}.h"
+
+${impl}
+
+extern "C" {
+
+int ${name}_abi_version(void) {
+  return ${abi_version};
+}
+${exports}
+} // extern "C"
+"""
+
+_C_LIBRARY_GEMM_IMPL_2x = """
+namespace ${symbol}_impl {
+
+${declaration}
+
+using ElementCompute = typename DeviceKernel::EpilogueOutputOp::ElementCompute;
+
+typename DeviceKernel::Arguments
+make_arguments(int M, int N, int K, int L,
+               void const* A, void const* B, void const* C, void* D,
+               float alpha, float beta) {
+  return typename DeviceKernel::Arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {M, N, K},                                        // problem size
+      1,
+      {ElementCompute(alpha), ElementCompute(beta)},
+      A, B, C, D,
+      0, 0, 0, 0,                                       // batch strides
+      DeviceKernel::LayoutA::packed({M, K}).stride(0),  // lda
+      DeviceKernel::LayoutB::packed({K, N}).stride(0),  // ldb
+      DeviceKernel::LayoutC::packed({M, N}).stride(0),  // ldc
+      DeviceKernel::LayoutC::packed({M, N}).stride(0)   // ldd
+  };
+}
+
+// CUTLASS 2.x GEMMs are exported for single problems
+bool supports_batch(int L) {
+  return L == 1;
+}
+
+} // namespace ${symbol}_impl
+"""
+
+_C_LIBRARY_GEMM_IMPL_3x = """
+namespace ${symbol}_impl {
+
+${declaration}
+
+using StrideA = typename DeviceKernel::GemmKernel::StrideA;
+using StrideB = typename DeviceKernel::GemmKernel::StrideB;
+using StrideC = typename DeviceKernel::GemmKernel::StrideC;
+using StrideD = typename DeviceKernel::GemmKernel::StrideD;
+
+using ElementCompute = typename DeviceKernel::EpilogueOutputOp::ElementCompute;
+
+typename DeviceKernel::Arguments
+make_arguments(int M, int N, int K, int L,
+               void const* A, void const* B, void const* C, void* D,
+               float alpha, float beta) {
+  cutlass::KernelHardwareInfo hw_info;
+  cudaGetDevice(&hw_info.device_id);
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  return typename DeviceKernel::Arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {M, N, K, L},                                                                // problem size
+      {
+        static_cast<typename DeviceKernel::ElementA const*>(A),                    // ptrA
+        cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, L)),    // stride A
+        static_cast<typename DeviceKernel::ElementB const*>(B),                    // ptrB
+        cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(N, K, L)),    // stride B
+      },
+      {
+        {ElementCompute(alpha), ElementCompute(beta)},
+        static_cast<typename DeviceKernel::ElementC const*>(C),                    // ptrC
+        cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, L)),    // stride C
+        static_cast<typename DeviceKernel::ElementD*>(D),                          // ptrD
+        cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, L)),    // stride D
+      },
+      hw_info
+  };
+}
+
+bool supports_batch(int L) {
+  return L >= 1;
+}
+
+} // namespace ${symbol}_impl
+"""
+
+_C_LIBRARY_GEMM_EXPORT = """
+int ${symbol}_can_implement(int M, int N, int K, int L) {
+  if (!${symbol}_impl::supports_batch(L)) {
+    return int(cutlass::Status::kErrorInvalidProblem);
+  }
+  auto arguments = ${symbol}_impl::make_arguments(M, N, K, L, nullptr, nullptr, nullptr, nullptr, 1.f, 0.f);
+  return int(${symbol}_impl::DeviceKernel::can_implement(arguments));
+}
+
+size_t ${symbol}_workspace_size(int M, int N, int K, int L) {
+  auto arguments = ${symbol}_impl::make_arguments(M, N, K, L, nullptr, nullptr, nullptr, nullptr, 1.f, 0.f);
+  return ${symbol}_impl::DeviceKernel::get_workspace_size(arguments);
+}
+
+int ${symbol}_run(int M, int N, int K, int L,
+    void const* A, void const* B, void const* C, void* D,
+    float alpha, float beta, void* workspace, void* stream) {
+  if (!${symbol}_impl::supports_batch(L)) {
+    return int(cutlass::Status::kErrorInvalidProblem);
+  }
+  auto arguments = ${symbol}_impl::make_arguments(M, N, K, L, A, B, C, D, alpha, beta);
+
+  ${symbol}_impl::DeviceKernel gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  if (status != cutlass::Status::kSuccess) {
+    return int(status);
+  }
+  status = gemm_op.initialize(arguments, workspace, static_cast<cudaStream_t>(stream));
+  if (status != cutlass::Status::kSuccess) {
+    return int(status);
+  }
+  return int(gemm_op.run(static_cast<cudaStream_t>(stream)));
+}
+"""
+
+_C_LIBRARY_GEMM_INCLUDES = {
+    ApiVersion.v2x: [
+        "cutlass/gemm/device/gemm_universal.h",
+    ],
+    ApiVersion.v3x: [
+        "cutlass/gemm/collective/collective_builder.hpp",
+        "cutlass/gemm/device/gemm_universal_adapter.h",
+        "cutlass/gemm/kernel/gemm_universal.hpp",
+        "cutlass/epilogue/collective/collective_builder.hpp",
+        "cutlass/util/packed_stride.hpp",
+    ],
+}
+
+
+def _enum_name(value):
+    return None if value is None else value.name
+
+
+def _gemm_manifest_entry(symbol: str, op, problem_shapes: list) -> dict:
+    """
+    Describes the GEMM exported under ``symbol`` in the manifest of the library
+    """
+    td = op.tile_description
+
+    def operand(tensor):
+        return {
+            "element": DataTypeNames[tensor.element],
+            "layout": ShortLayoutTypeNames[tensor.layout],
+            "alignment": tensor.alignment,
+        }
+
+    return {
+        "symbol": symbol,
+        "procedural_name": op.procedural_name(),
+        "api": "3x" if op.api == ApiVersion.v3x else "2x",
+        "A": operand(op.A),
+        "B": operand(op.B),
+        "C": operand(op.C),
+        "element_d": DataTypeNames[op.epilogue_functor.element_output],
+        "element_accumulator": DataTypeNames[op.tile_description.math_instruction.element_accumulator],
+        "element_epilogue": DataTypeNames[op.epilogue_functor.element_epilogue],
+        "threadblock_shape": list(td.threadblock_shape),
+        "cluster_shape": list(td.cluster_shape),
+        "stages": td.stages,
+        "kernel_schedule": _enum_name(td.kernel_schedule),
+        "epilogue_schedule": _enum_name(td.epilogue_schedule),
+        "problem_shapes": [list(shape) for shape in problem_shapes],
+    }
+
+
+def _build(name: str, cc: int, cuda_file: str, sourcedir: str) -> str:
+    """
+    Compiles the library's source with nvcc into a shared library embedding the device code
+
+    :return: path to the shared library
+    :rtype: str
+    """
+    library_file = os.path.join(sourcedir, f"lib{name}.so")
+    arch = f"{cc}a" if cc == 90 else str(cc)
+
+    cmd = [f"{cuda_install_path()}/bin/nvcc"]
+    cmd.extend(["-std=c++17", "--expt-relaxed-constexpr", "-O3", "-Xcompiler=-fPIC", "-shared"])
+    cmd.append(f"--generate-code=arch=compute_{arch},code=[sm_{arch}]")
+    for incl in [
+        CUTLASS_PATH + "/include",
+        CUTLASS_PATH + "/tools/util/include",
+        sourcedir if sourcedir != "" else ".",
+    ]:
+        cmd.append(f"--include-path={incl}")
+    cmd.extend(["-o", library_file, cuda_file, "-lcudart"])
+
+    with open(cuda_file, "r") as infile:
+        source = infile.read()
+    compile_with_nvcc(cmd, source, error_file=os.path.join(sourcedir, f"{name}_compilation_error.txt"))
+    return library_file
+
+
+def c_library(ops: dict, name: str, cc: int, sourcedir: str = "", build: bool = False, problem_shapes: dict = None):
+    """
+    Generates the source, header, and manifest of a shared library with a C ABI exporting the CUTLASS
+    GEMMs in ``ops``. If the ``build`` parameter is set to true, the library is also compiled.
+
+    :param ops: operations to export, keyed by the prefix of the C functions exported for each
+    :type ops: dict
+    :param name: name of the library to generate
+    :type name: str
+    :param cc: compute capability of the device the library should target
+    :type cc: int
+    :param sourcedir: directory to which generated files should be written
+    :type sourcedir: str
+    :param build: whether the shared library should be compiled with nvcc
+    :type build: bool
+    :param problem_shapes: problem shapes (M, N, K[, L]) each operation was selected for, keyed as ``ops``,
+                           which are recorded in the manifest
+    :type problem_shapes: dict
+
+    :return: path to the shared library if ``build=True`` or ``None`` otherwise
+    """
+    if problem_shapes is None:
+        problem_shapes = {}
+
+    unknown = set(problem_shapes.keys()) - set(ops.keys())
+    if len(unknown) > 0:
+        raise Exception(f"Problem shapes were provided for operations that are not exported: {sorted(unknown)}")
+
+    impls = []
+    exports = []
+    declarations = []
+    includes = []
+    manifest_ops = []
+
+    for symbol, op in ops.items():
+        if not symbol.isidentifier():
+            raise Exception(f"'{symbol}' is not a valid C identifier.")
+        if not isinstance(op, GemmOperationUniversal):
+            raise Exception(
+                f"Operation type {type(op)} is not currently supported for export as a C library."
+            )
+        if hasattr(op.epilogue_functor, "visitor"):
+            raise Exception(
+                "Epilogue visitor trees are not currently supported for export as a C library."
+            )
+
+        device_op = op.device_op()
+        for incl in device_op.rt_module.emitter.includes + _C_LIBRARY_GEMM_INCLUDES[device_op.api]:
+            if incl not in includes:
+                includes.append(incl)
+
+        impl_template = _C_LIBRARY_GEMM_IMPL_3x if device_op.api == ApiVersion.v3x else _C_LIBRARY_GEMM_IMPL_2x
+        values = {"symbol": symbol, "procedural_name": device_op.procedural_name()}
+        impls.append(SubstituteTemplate(impl_template, {**values, "declaration": device_op.rt_module.emit()}))
+        exports.append(SubstituteTemplate(_C_LIBRARY_GEMM_EXPORT, values))
+        declarations.append(SubstituteTemplate(_C_LIBRARY_GEMM_DECLARATION, values))
+        manifest_ops.append(_gemm_manifest_entry(symbol, device_op, problem_shapes.get(symbol, [])))
+
+    if sourcedir != "" and not os.path.isdir(sourcedir):
+        os.makedirs(sourcedir)
+
+    header_file = os.path.join(sourcedir, name + ".h")
+    header_source = SubstituteTemplate(
+        _C_LIBRARY_HEADER_TEMPLATE,
+        {
+            "name": name,
+            "NAME": name.upper(),
+            "abi_version": str(_C_LIBRARY_ABI_VERSION),
+            "declarations": "".join(declarations),
+        },
+    )
+    with open(header_file, "w") as outfile:
+        outfile.write(header_source)
+
+    cuda_file = os.path.join(sourcedir, name + ".cu")
+    cuda_source = SubstituteTemplate(
+        _C_LIBRARY_CUDA_TEMPLATE,
+        {
+            "name": name,
+            "abi_version": str(_C_LIBRARY_ABI_VERSION),
+            "includes": "".join(f'#include "{incl}"\n' for incl in includes),
+            "impl": "".join(impls),
+            "exports": "".join(exports),
+        },
+    )
+    with open(cuda_file, "w") as outfile:
+        outfile.write(cuda_source)
+
+    manifest_file = os.path.join(sourcedir, name + "_manifest.json")
+    manifest = {
+        "name": name,
+        "abi_version": _C_LIBRARY_ABI_VERSION,
+        "cc": cc,
+        "operations": manifest_ops,
+    }
+    with open(manifest_file, "w") as outfile:
+        json.dump(manifest, outfile, indent=2)
+
+    if build:
+        return _build(name, cc, cuda_file, sourcedir)
+
+    return None
@@ -76,6 +76,21 @@ The module can later be used in Python via:
 
     # Run the module
     D = cutlass_gemm.run(A, B, C)
+
+GEMMs can instead be registered as ``torch.library`` operators by passing ``torch_library=True``.
+The module then defines ``torch.ops.<name>.run`` and an out-variant ``torch.ops.<name>.run_out``
+that writes into a preallocated output. Both have meta implementations, launch on the current
+stream, and allocate workspace through the PyTorch caching allocator, so they can be traced by
+``torch.compile`` without graph breaks and captured into CUDA graphs:
+
+.. highlight:: python
+.. code-block:: python
+
+    ops = cutlass.emit.pytorch(op, 'cutlass_gemm', 80, jit=True, torch_library=True)
+
+    @torch.compile
+    def f(A, B, C, D):
+        return ops.run_out(A, B, C, 1.0, 0.0, out=D)
 """
 
 import logging
@@ -322,6 +337,138 @@ at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional
 )
 
 
+def _graph_safe_kernel_run(template: str) -> str:
+    """
+    Adapts a GEMM ``kernel_run`` template to launch on the current PyTorch stream with a workspace
+    from the PyTorch caching allocator, so that it may be captured into a CUDA graph
+    """
+    replacements = [
+        ("  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);\n",
+         "  cudaStream_t stream = at::cuda::getCurrentCUDAStream();\n"
+         "  at::Tensor workspace = at::empty({(int64_t)workspace_size},\n"
+         "                                   at::TensorOptions().dtype(at::kByte).device(at::kCUDA, at::cuda::current_device()));\n"),
+        ("workspace.get()", "workspace.data_ptr()"),
+        ("nullptr);     // CUDA stream", "stream);"),
+        ("status = gemm_op();", "status = gemm_op(stream);"),
+    ]
+    for old, new in replacements:
+        template = template.replace(old, new)
+    return template
+
+
+_PYTORCH_GEMM_LIBRARY_CPP_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
+#include <torch/extension.h>
+#include <torch/library.h>
+#include <ATen/ATen.h>
+
+// CUDA forward declarations
+at::Tensor& ${name}_kernel_out(const at::Tensor& A, const at::Tensor& B, const c10::optional<at::Tensor>& C, double alpha, double beta, at::Tensor& D);
+
+at::Tensor& ${name}_run_out(const at::Tensor& A, const at::Tensor& B, const c10::optional<at::Tensor>& C, double alpha, double beta, at::Tensor& out) {
+  TORCH_CHECK(out.dim() == 2 && out.size(0) == A.size(0) && out.size(1) == B.size(1), "out must have shape (M, N)");
+  TORCH_CHECK(out.scalar_type() == ${torch_type_C} && out.is_contiguous(), "out must be a contiguous tensor of the output type");
+  return ${name}_kernel_out(A, B, C, alpha, beta, out);
+}
+
+at::Tensor ${name}_run(const at::Tensor& A, const at::Tensor& B, const c10::optional<at::Tensor>& C, double alpha, double beta) {
+  at::Tensor D = B.new_empty({A.size(0), B.size(1)}, ${torch_type_C});
+  return ${name}_kernel_out(A, B, C, alpha, beta, D);
+}
+
+// Meta implementations, used by torch.compile to propagate shapes through fake tensors
+at::Tensor& ${name}_run_out_meta(const at::Tensor& A, const at::Tensor& B, const c10::optional<at::Tensor>& C, double alpha, double beta, at::Tensor& out) {
+  return out;
+}
+
+at::Tensor ${name}_run_meta(const at::Tensor& A, const at::Tensor& B, const c10::optional<at::Tensor>& C, double alpha, double beta) {
+  return at::empty({A.size(0), B.size(1)}, A.options().dtype(${torch_type_C}));
+}
+
+TORCH_LIBRARY(${name}, m) {
+  m.def("run(Tensor A, Tensor B, Tensor? C=None, float alpha=1.0, float beta=0.0) -> Tensor");
+  m.def("run_out(Tensor A, Tensor B, Tensor? C, float alpha, float beta, *, Tensor(a!) out) -> Tensor(a!)");
+}
+
+TORCH_LIBRARY_IMPL(${name}, CUDA, m) {
+  m.impl("run", &${name}_run);
+  m.impl("run_out", &${name}_run_out);
+}
+
+TORCH_LIBRARY_IMPL(${name}, Meta, m) {
+  m.impl("run", &${name}_run_meta);
+  m.impl("run_out", &${name}_run_out_meta);
+}
+
+// Importing the built extension registers the operators above
+PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {}
+"""
+
+_PYTORCH_GEMM_LIBRARY_IMPL_TEMPLATE_2x = (
+    _graph_safe_kernel_run(common._CUTLASS_KERNEL_RUN_GEMM_2x)
+    + """
+at::Tensor& ${name}_kernel_out(const at::Tensor& A, const at::Tensor& B, const c10::optional<at::Tensor>& C, double alpha, double beta, at::Tensor& D) {
+    int M = A.size(0);
+    int N = B.size(1);
+    int K = A.size(1);
+
+    at::Tensor A_ = A.contiguous();
+    at::Tensor B_ = B.contiguous();
+    at::Tensor C_ = C.has_value() ? C->contiguous() : at::Tensor();
+    typename DeviceKernel::ElementC* ptrC = C.has_value() ?
+                                            reinterpret_cast<typename DeviceKernel::ElementC*>(C_.data_ptr()) :
+                                            nullptr;
+
+    cutlass::Status status = ${name}_kernel_run(M, N, K,
+                                                reinterpret_cast<typename DeviceKernel::ElementA*>(A_.data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementB*>(B_.data_ptr()),
+                                                ptrC,
+                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.data_ptr()),
+                                                ElementCompute(alpha), ElementCompute(beta));
+
+    TORCH_CHECK(status == cutlass::Status::kSuccess, "CUTLASS kernel failed");
+    return D;
+}
+"""
+)
+
+_PYTORCH_GEMM_LIBRARY_IMPL_TEMPLATE_3x = (
+    _graph_safe_kernel_run(common._CUTLASS_KERNEL_RUN_GEMM_3x)
+    + """
+at::Tensor& ${name}_kernel_out(const at::Tensor& A, const at::Tensor& B, const c10::optional<at::Tensor>& C, double alpha, double beta, at::Tensor& D) {
+    int M = A.size(0);
+    int N = B.size(1);
+    int K = A.size(1);
+    int L = 1;
+
+    // The SM count is queried once, outside of any graph capture
+    static cutlass::KernelHardwareInfo hw_info = [] {
+        cutlass::KernelHardwareInfo info;
+        info.device_id = 0;
+        info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(info.device_id);
+        return info;
+    }();
+
+    at::Tensor A_ = A.contiguous();
+    at::Tensor B_ = B.contiguous();
+    at::Tensor C_ = C.has_value() ? C->contiguous() : at::Tensor();
+    typename DeviceKernel::ElementC* ptrC = C.has_value() ?
+                                            reinterpret_cast<typename DeviceKernel::ElementC*>(C_.data_ptr()) :
+                                            nullptr;
+
+    cutlass::Status status = ${name}_kernel_run(M, N, K, L,
+                                                reinterpret_cast<typename DeviceKernel::ElementA*>(A_.data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementB*>(B_.data_ptr()),
+                                                ptrC,
+                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.data_ptr()),
+                                                ElementCompute(alpha), ElementCompute(beta),
+                                                hw_info);
+
+    TORCH_CHECK(status == cutlass::Status::kSuccess, "CUTLASS kernel failed");
+    return D;
+}
+"""
+)
+
 _PYTORCH_GROUPED_GEMM_IMPL_TEMPLATE = (
     common._CUTLASS_KERNEL_RUN_GROUPED_GEMM_2x
     + """
@@ -670,7 +817,7 @@ class _ArchListSetter:
             os.environ[_ArchListSetter._TORCH_CUDA_ARCH_LIST] = self.old_arch_list
 
 
-def _jit(name: str, cc: int, cpp_file: str, cuda_file: str):
+def _jit(name: str, cc: int, cpp_file: str, cuda_file: str, torch_library: bool = False):
     """
     JIT compiles and loads a PyTorch CUDA extension.
 
@@ -682,10 +829,13 @@ def _jit(name: str, cc: int, cpp_file: str, cuda_file: str):
     :type cpp_file: str
     :param cuda_file: path to file containing extension's CUDA interface
     :type cuda_file: str
+    :param torch_library: whether the extension registers ``torch.library`` operators rather than Python bindings
+    :type torch_library: bool
 
-    :return: loaded PyTorch module
+    :return: loaded PyTorch module, or the ``torch.ops`` namespace of its operators if ``torch_library=True``
     """
 
+    import torch
     from torch.utils.cpp_extension import load
 
     extra_cuda_cflags = ["-std=c++17"]
@@ -704,12 +854,15 @@ def _jit(name: str, cc: int, cpp_file: str, cuda_file: str):
                 os.path.join(CUTLASS_PATH, "tools/util/include"),
             ],
             extra_ldflags=["-lcuda"],
+            is_python_module=not torch_library,
             verbose=(logger.level == logging.DEBUG)
         )
+    if torch_library:
+        return getattr(torch.ops, name)
     return jitmodule
 
 
-def _pytorch_gemm(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""):
+def _pytorch_gemm(op, name: str, cc: int, jit: bool = False, sourcedir: str = "", torch_library: bool = False):
     """
     Generates source for building a PyTorch CUDA module that leverages the CUTLASS GEMM
     specified by ``op``. If the ``jit`` parameter is set to true, the module is just-in-time
@@ -724,6 +877,8 @@ def _pytorch_gemm(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""
     :type jit: bool
     :param sourcedir: directory to which generated source files should be written
     :type sourcedir: str
+    :param torch_library: whether to register the GEMM as ``torch.library`` operators
+    :type torch_library: bool
 
     :return: loaded PyTorch module if ``jit=True`` or ``None`` otherwise
     """
@@ -740,11 +895,18 @@ def _pytorch_gemm(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""
             extra_kw["args"] = common._CUTLASS_KERNEL_ARGS_2x_STREAM_K
         else:
             extra_kw["args"] = common._CUTLASS_KERNEL_ARGS_2x
-    impl_template = (
-        _PYTORCH_GEMM_IMPL_TEMPLATE_3x
-        if op.api == ApiVersion.v3x
-        else _PYTORCH_GEMM_IMPL_TEMPLATE_2x
-    )
+    if torch_library:
+        impl_template = (
+            _PYTORCH_GEMM_LIBRARY_IMPL_TEMPLATE_3x
+            if op.api == ApiVersion.v3x
+            else _PYTORCH_GEMM_LIBRARY_IMPL_TEMPLATE_2x
+        )
+    else:
+        impl_template = (
+            _PYTORCH_GEMM_IMPL_TEMPLATE_3x
+            if op.api == ApiVersion.v3x
+            else _PYTORCH_GEMM_IMPL_TEMPLATE_2x
+        )
     cuda_impl = SubstituteTemplate(impl_template, {"name": name, **extra_kw})
     cuda_source = SubstituteTemplate(
         _PYTORCH_CUDA_TEMPLATE,
@@ -761,8 +923,12 @@ def _pytorch_gemm(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""
 
     cpp_file = os.path.join(sourcedir, name + ".cpp")
     cpp_source = SubstituteTemplate(
-        _PYTORCH_GEMM_CPP_TEMPLATE,
-        {"name": name, "description": f"CUTLASS {op.procedural_name()} GEMM"},
+        _PYTORCH_GEMM_LIBRARY_CPP_TEMPLATE if torch_library else _PYTORCH_GEMM_CPP_TEMPLATE,
+        {
+            "name": name,
+            "description": f"CUTLASS {op.procedural_name()} GEMM",
+            "torch_type_C": _CUTLASS_TYPE_TO_TORCH_TYPE[op.C.element],
+        },
     )
     with open(cpp_file, "w") as outfile:
         outfile.write(cpp_source)
@@ -773,7 +939,7 @@ def _pytorch_gemm(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""
     _generate_setup(name, sourcedir, extra_compile_args)
 
     if jit:
-        return _jit(name, cc, cpp_file, cuda_file)
+        return _jit(name, cc, cpp_file, cuda_file, torch_library)
 
     return None
 
@@ -902,7 +1068,7 @@ def _pytorch_conv2d(op, name: str, cc: int, jit: bool = False, sourcedir: str =
     return None
 
 
-def pytorch(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""):
+def pytorch(op, name: str, cc: int, jit: bool = False, sourcedir: str = "", torch_library: bool = False):
     """
     Generates source for building a PyTorch CUDA module that leverages the CUTLASS kernel
     specified by ``op``. If the ``jit`` parameter is set to true, the module is just-in-time
@@ -920,12 +1086,19 @@ def pytorch(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""):
     :type jit: bool
     :param sourcedir: directory to which generated source files should be written
     :type sourcedir: str
+    :param torch_library: whether to register the kernel as ``torch.library`` operators (currently GEMMs only)
+    :type torch_library: bool
 
-    :return: loaded PyTorch module (if ``jit=True``) or None
+    :return: loaded PyTorch module (if ``jit=True``) or None. With ``torch_library=True``, the ``torch.ops``
+             namespace holding the module's operators is returned instead of the module.
     """
     device_op = op.device_op()
     if isinstance(op, GemmOperationUniversal):
-        return _pytorch_gemm(device_op, name, cc, jit, sourcedir)
+        return _pytorch_gemm(device_op, name, cc, jit, sourcedir, torch_library)
+    elif torch_library:
+        raise Exception(
+            f"Operation type {type(op)} is not currently supported for emission as torch.library operators."
+        )
     elif isinstance(op, GemmOperationGrouped):
         return _pytorch_grouped_gemm(device_op, name, cc, jit, sourcedir)
     elif isinstance(op, Conv2dOperation):
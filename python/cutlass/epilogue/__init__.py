@@ -46,7 +46,9 @@ from cutlass.epilogue.epilogue import (
 
 from cutlass.epilogue.evt_ops import (
     max,
+    min,
     multiply_add,
+    reduction,
     sum,
     permute,
     reshape,
@@ -60,6 +60,76 @@ def max(x, dim):
         return torch.amax(x, dim)
 
 
+def min(x, dim):
+    if is_numpy_tensor(x):
+        return x.min(axis=tuple(dim))
+    elif is_torch_tensor(x):
+        return torch.amin(x, dim)
+
+
+def reduction(name: str, reduce_fn, atomic: bool = True):
+    """
+    Define an associative reduction usable in traced epilogues.
+
+    The returned function computes the host reference and must be bound to ``name``
+    where the epilogue is defined, as the tracer resolves calls by name. Elementwise
+    preprocessing is expressed in the epilogue itself, e.g. a sum of squares is
+    ``sum_sq(F * F, dim=[0, 2])``.
+
+    .. highlight:: python
+    .. code-block:: python
+
+        # Deterministic row sums: per-CTA partials are combined by the last CTA of
+        # each row instead of through floating-point atomics
+        row_sum = cutlass.epilogue.reduction("row_sum", "sum", atomic=False)
+
+        def epilogue(accum, C):
+            D = accum + C
+            D_row_sum = row_sum(D, dim=[1,])
+            return D, D_row_sum
+
+    :param name: name under which the reduction is called in the epilogue
+    :type name: str
+    :param reduce_fn: combine function, one of "sum", "prod", "max" or "min"
+    :type reduce_fn: str
+    :param atomic: whether partial results of different CTAs are combined with atomics.
+                   Non-atomic reductions are supported for row and column reductions on SM90,
+                   and reductions without an atomic counterpart ("prod") must be non-atomic.
+    :type atomic: bool
+
+    :return: host reference of the reduction
+    """
+    from cutlass.backend.evt.frontend import PythonASTFrontend
+    from cutlass.backend.library import FunctionalOp
+
+    fns = {
+        "sum": (FunctionalOp.Plus, FunctionalOp.AtomicAdd, np.sum, torch.sum if is_torch_available() else None),
+        "prod": (FunctionalOp.Multiplies, None, np.prod, None),
+        "max": (FunctionalOp.Maximum, FunctionalOp.AtomicMaximum, np.max, torch.amax if is_torch_available() else None),
+        "min": (FunctionalOp.Minimum, FunctionalOp.AtomicMinimum, np.min, torch.amin if is_torch_available() else None),
+    }
+    if reduce_fn not in fns:
+        raise Exception(f"Unsupported reduction {reduce_fn}. Available reductions are: {list(fns.keys())}")
+    reg_reduce_fn, atomic_fn, np_fn, torch_fn = fns[reduce_fn]
+    if atomic and atomic_fn is None:
+        raise Exception(f"Reduction {reduce_fn} has no atomic implementation. Use atomic=False.")
+    PythonASTFrontend.register_reduction(name, reg_reduce_fn, atomic_fn if atomic else reg_reduce_fn)
+
+    def reference(x, dim):
+        if is_numpy_tensor(x):
+            return np_fn(x, axis=tuple(dim))
+        elif is_torch_tensor(x):
+            if torch_fn is None:
+                # torch.prod only reduces a single dimension at a time
+                for d in sorted(dim, reverse=True):
+                    x = torch.prod(x, d)
+                return x
+            return torch_fn(x, dim)
+
+    reference.__name__ = name
+    return reference
+
+
 def maximum(x, y):
     if is_numpy_tensor(x):
         return np.maximum(x, y)
@@ -197,7 +197,7 @@ class KernelsForDataType:
             ld = shape[-2]
         elif layout == cutlass.LayoutType.RowMajor:
             ld = shape[-1]
-        elif layout == cutlass.LayoutType.TensorNHWC:
+        elif layout in [cutlass.LayoutType.TensorNHWC, cutlass.LayoutType.TensorNDHWC]:
             ld = shape[-1]
         else:
             raise Exception(f"Unexpected or unsupported layout {layout}")
@@ -395,6 +395,10 @@ class ArchOptions:
             layouts = [
                 (cutlass_library.LayoutType.TensorNHWC, cutlass_library.LayoutType.TensorNHWC),
             ]
+        elif operation_kind == cutlass_library.OperationKind.Conv3d:
+            # Conv3d is only exposed through CUTLASS 3 kernels, which have no SIMT variants
+            types = []
+            layouts = []
         else:
             raise NotImplementedError(f"Operation kind {operation_kind} is currently unsupported.")
 
@@ -569,7 +573,11 @@ class OptionRegistry:
         self.registry = {}
 
         gemm_kinds = [cutlass_library.GemmKind.Universal, cutlass_library.GemmKind.Universal3x]
-        operation_kinds = [cutlass_library.OperationKind.Gemm, cutlass_library.OperationKind.Conv2d]
+        operation_kinds = [
+            cutlass_library.OperationKind.Gemm,
+            cutlass_library.OperationKind.Conv2d,
+            cutlass_library.OperationKind.Conv3d,
+        ]
         # Construct options for each CC
         for kernel_cc in _generator_ccs:
             self.registry[kernel_cc] = {}
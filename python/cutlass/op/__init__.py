@@ -30,7 +30,16 @@
 #
 #################################################################################################
 
-from cutlass.op.conv import Conv2d, Conv2dFprop, Conv2dDgrad, Conv2dWgrad
+from cutlass.op.conv import (
+    Conv2d,
+    Conv2dFprop,
+    Conv2dDgrad,
+    Conv2dWgrad,
+    Conv3d,
+    Conv3dFprop,
+    Conv3dDgrad,
+    Conv3dWgrad,
+)
 from cutlass.op.gemm import Gemm
 from cutlass.op.gemm_grouped import GroupedGemm
 from cutlass.op.op import OperationBase
@@ -110,6 +110,25 @@
         # Do other work...
 
         args.sync()
+
+    On SM90, ``Conv2d`` uses CUTLASS 3 implicit GEMM kernels built by the convolution
+    ``CollectiveBuilder`` whenever the data types are supported by them. ``Conv3d`` is available
+    only through these kernels. Both accept epilogue visitor trees for fprop:
+
+    .. highlight:: python
+    .. code-block:: python
+
+        # input: (N, D, H, W, C), weight: (K, T, R, S, C), output: (N, Z, P, Q, K) in channels-last
+        plan = cutlass.op.Conv3dFprop(element=torch.float16, element_accumulator=torch.float32)
+        plan.run(input, weight, C, output, stride=(1, 1, 1), padding=(1, 1, 1), dilation=(1, 1, 1))
+
+        def epilogue(accum, bias):
+            return cutlass.epilogue.relu(accum + bias)
+
+        examples = {"accum": output, "bias": bias, "D": output}
+        plan.epilogue_visitor = cutlass.epilogue.trace(epilogue, examples)
+        plan.run(input, weight, C, output, padding=(1, 1, 1),
+                 visitor_args={"bias": bias, "D": output})
 """
 
 from cuda import cuda
@@ -127,10 +146,14 @@ import cutlass
 from cutlass import epilogue
 from cutlass.backend import compiler
 from cutlass.backend.conv2d_operation import Conv2dArguments, Conv2dOperation
+from cutlass.backend.conv3x_operation import Conv3xArguments, Conv3xOperation
+from cutlass.backend.evt import EpilogueFunctorVisitor
+from cutlass.backend.evt.ir import AuxLoadImpl, TopoVisitorNode
+from cutlass.backend.evt.ir.store_nodes import ReductionImplBase
 from cutlass.backend.reduction_operation import ReductionOperation, ReductionArguments
 from cutlass.backend.library import TensorDescription, TileDescription
 from cutlass.op.op import OperationBase
-from cutlass.shape import Conv2DProblemSize, MatrixCoord
+from cutlass.shape import Conv2DProblemSize, Conv3DProblemSize, MatrixCoord
 from cutlass.utils import check, datatypes
 
 
@@ -198,6 +221,10 @@ class Conv2d(OperationBase):
     :param kernel_cc: compute capability of kernels to generate. For example, if running on SM90, but desiring to use a CUTLASS 2.x-style Ampere kernel, this should be set to 80
     :type kernel_cc: int
     """
+    _operation_kind = OperationKind.Conv2d
+    _activation_layout = cutlass.LayoutType.TensorNHWC
+    _filter_layout = cutlass.LayoutType.TensorKCSR
+
     def __init__(
         self, kind="fprop",
         A=None, B=None, C=None, D=None, alpha=1.0, beta=0.0,
@@ -206,18 +233,9 @@ class Conv2d(OperationBase):
         element_accumulator=None,
         cc: int = None, kernel_cc: int = None
     ):
-        super().__init__(cc=cc, kernel_cc=kernel_cc, operation_kind=OperationKind.Conv2d)
-        # Verify the kernel cc
-        if self.current_cc == 90:
-            # The Conv2d kernel on Hopper (SM90) is currently unsupported
-            # Revert to use SM80-tagged kernels
-            cutlass.logger.warning("Reverting to using SM80-tagged kernel. Opclass may change.")
-            self.specified_kernel_cc = 80
-            self._reset_options(80)
+        super().__init__(cc=cc, kernel_cc=kernel_cc, operation_kind=self._operation_kind)
 
-        # The arch is used in testing
-        self.arch = self.current_cc
-        self.name = "conv2d" + kind
+        self.name = self._operation_kind.name.lower() + kind
 
         # The convolution kind. (concept: cutlass_library.library.ConvKind)
         self.conv_kind = datatypes.getattr_enum(ConvKind, kind)
@@ -245,8 +263,8 @@ class Conv2d(OperationBase):
 
             assert elt_to_set is not None
 
-            # Currently we only support layout TensorNHWC
-            lay_to_set = cutlass.LayoutType.TensorNHWC
+            # Currently we only support channels-last layouts
+            lay_to_set = self._activation_layout
             elements.append(datatypes.library_type(elt_to_set))
             layouts.append(lay_to_set)
 
@@ -282,12 +300,34 @@ class Conv2d(OperationBase):
 
         self._reset_operations()
 
+        # The arch is used in testing
+        self.arch = self.current_cc
+
         # Arguments that will be determined online based on arguments of "run"
         # based on stride, input/output channels, alignment, and conv_kind
         self._iterator_algorithm = None
         self._stride_support = None
 
+    @property
+    def _is_3x(self) -> bool:
+        """
+        Returns whether CUTLASS 3 convolution kernels are currently targeted
+        """
+        return self.current_cc == 90
+
     def _reset_operations(self, reset_epilogue: bool = True):
+        # CUTLASS 3 convolutions are only generated for Tensor Core data type combinations.
+        # Other combinations revert to SM80-tagged kernels.
+        if self._is_3x and cutlass.OpcodeClass.TensorOp not in self.options.supporting_opclasses(
+                self._element_a, self._element_b, self._element_accumulator,
+                self._layout_a, self._layout_b, self._math_operation):
+            if self.specified_kernel_cc:
+                raise Exception(f"No SM90 convolution kernel supports the data type combination "
+                                f"({self._element_a}, {self._element_b}, {self._element_accumulator}). "
+                                "To use 2.x kernels, do not set the `kernel_cc` parameter when constructing the plan.")
+            cutlass.logger.warning("Reverting to using SM80-tagged kernel. Opclass may change.")
+            self._reset_options(80)
+
         # Set the default op class
         datatype_comb = (self._element_a, self._element_b, self._element_accumulator)
         layout_comb = (self._layout_a, self._layout_b)
@@ -320,6 +360,42 @@ class Conv2d(OperationBase):
         self.alignment_pref_C = min(
             128 // DataTypeSize[self._element_c], max(self.possible_operations.alignments("C")))
 
+    #
+    # Epilogue visitor Related
+    #
+
+    @property
+    def epilogue_visitor(self):
+        """
+        Return the epilogue functor
+        """
+        return self.epilogue_functor
+
+    @epilogue_visitor.setter
+    def epilogue_visitor(self, visitor):
+        """
+        Create the epilogue visitor. Convolution epilogue visitors are only supported by SM90
+        fprop kernels, whose output is indexed as the (N, [Z,] P, Q, K) activation tensor.
+        """
+        if not self._is_3x:
+            raise Exception("Epilogue visitors for convolutions are only supported by SM90 kernels.")
+        if self.conv_kind != ConvKind.Fprop:
+            raise Exception(f"Epilogue visitors are not supported for convolution kind {self.conv_kind}.")
+        self._verify_visitor_nodes(visitor.dag_ir)
+        OperationBase.epilogue_visitor.fset(self, visitor)
+
+    def _verify_visitor_nodes(self, dag_ir):
+        """
+        Rejects visitor nodes whose global memory access is not expressible with the packed output
+        strides of the convolution epilogue
+        """
+        for meta in dag_ir.nodes_meta:
+            if isinstance(meta, TopoVisitorNode):
+                self._verify_visitor_nodes(meta.subgraph)
+            elif isinstance(meta.underlying_impl, (AuxLoadImpl, ReductionImplBase)):
+                raise Exception(f"Node {meta.name} is not supported in convolution epilogue visitors. "
+                                "Only broadcasts, elementwise computations, and stores are supported.")
+
     #
     # Tile description Related
     #
@@ -353,7 +429,7 @@ class Conv2d(OperationBase):
             if self._tile_description is None:
                 op = self.possible_operations.default_operation(self._math_operation)
                 self._tile_description = datatypes.td_from_profiler_op(op)
-            if "cluster_shape" in td.keys():
+            if "cluster_shape" in td.keys() and not self._is_3x:
                 if td["cluster_shape"] != [1, 1, 1]:
                     cutlass.logger.warning("Conv2d currently only support 'cluster_shape'=[1, 1, 1]'.")
                     td["cluster_shape"] = [1, 1, 1]
@@ -534,6 +610,26 @@ class Conv2d(OperationBase):
 
         return StrideSupport.Strided
 
+    def _output_layout(self):
+        """
+        Returns the layout of operands C and D. SM90 wgrad kernels write the filter gradient in
+        the filter layout, while all 2.x kernels describe C with the activation layout.
+        """
+        if self._is_3x and self.conv_kind == ConvKind.Wgrad:
+            return self._filter_layout
+        return self._layout_c
+
+    def _alignment_3x(self, shape, element, name) -> int:
+        """
+        Returns the alignment used by SM90 kernels for an operand of ``shape``. TMA requires
+        16B-aligned strides, so the number of channels must be a multiple of this alignment.
+        """
+        alignment = 128 // DataTypeSize[element]
+        if shape[-1] % alignment != 0:
+            raise Exception(f"SM90 convolutions require the innermost extent of tensor {name} to be "
+                            f"divisible by {alignment}, got shape {tuple(shape)}.")
+        return alignment
+
     #
     # Construct and Compilation
     #
@@ -564,24 +660,31 @@ class Conv2d(OperationBase):
         :type swizzling_functor: cutlass.swizzle
         :param epilogue_functor: the epilogue functor
 
+        Iterator algorithm, stride support, and swizzling functor are ignored when constructing
+        SM90 operations.
+
         :return: operation that was constructed
-        :rtype: cutlass.backend.Conv2dOperation
+        :rtype: cutlass.backend.Conv2dOperation or cutlass.backend.Conv3xOperation
         """
         # Get alignment
         alignment_A = check.alignment_or_default(alignment_A, self.alignment_pref_A)
         alignment_B = check.alignment_or_default(alignment_B, self.alignment_pref_B)
         alignment_C = check.alignment_or_default(alignment_C, self.alignment_pref_C)
 
-        tensor_A = TensorDescription(self._element_a, self._layout_b, alignment_A)
+        tensor_A = TensorDescription(self._element_a, self._layout_a, alignment_A)
         tensor_B = TensorDescription(self._element_b, self._layout_b, alignment_B)
-        tensor_C = TensorDescription(self._element_c, self._layout_c, alignment_C)
+        tensor_C = TensorDescription(self._element_c, self._output_layout(), alignment_C)
 
         if tile_description is None:
             if self.tile_description is not None:
                 tile_description = self.tile_description
             else:
-                op = self.possible_operations.operations(alignment_A, alignment_B, alignment_C, self._math_operation)[0]
-                tile_description = datatypes.td_from_profiler_op(op)
+                ops = self.possible_operations.operations(alignment_A, alignment_B, alignment_C, self._math_operation)
+                if self._is_3x:
+                    # CUTLASS 3 operations of all convolution kinds share a data type combination.
+                    # Prefer the schedules generated for this kind (e.g., stream-K for wgrad)
+                    ops = [op for op in ops if op.conv_kind == self.conv_kind] or ops
+                tile_description = datatypes.td_from_profiler_op(ops[0])
         else:
             valid, err_str = self._valid_tile_description(tile_description)
             if not valid:
@@ -617,6 +720,17 @@ class Conv2d(OperationBase):
         # Reset the alignment of the epilogue functor
         epilogue_functor = self._reset_epilogue_functor_alignment(alignment_C, epilogue_functor)
 
+        if self._is_3x:
+            if self.op_class != cutlass.OpcodeClass.TensorOp:
+                raise Exception("SM90 convolutions are only supported with the TensorOp opcode class.")
+            return Conv3xOperation(
+                conv_kind=self.conv_kind,
+                arch=self.current_cc,
+                tile_description=tile_description,
+                A=tensor_A, B=tensor_B, C=tensor_C,
+                epilogue_functor=epilogue_functor,
+            )
+
         operation = Conv2dOperation(
             conv_kind=self.conv_kind,
             iterator_algorithm=iterator_algorithm,
@@ -658,7 +772,7 @@ class Conv2d(OperationBase):
         :param epilogue_functor: the epilogue functor
 
         :return: operation that was compiled
-        :rtype: cutlass.backend.Conv2dOperation
+        :rtype: cutlass.backend.Conv2dOperation or cutlass.backend.Conv3xOperation
         """
 
         self.operation = self.construct(
@@ -710,11 +824,21 @@ class Conv2d(OperationBase):
         else:
             raise Exception(f"Convolution kind {self.conv_kind} is not supported")
 
-        N_, H_, W_, C_ = datatypes.get_tensor_shape(input, op="CONV")
-        K_, R_, S_, _ = datatypes.get_tensor_shape(weight, op="CONV")
-        _, P_, Q_, _ = datatypes.get_tensor_shape(output, op="CONV")
+        input_size = datatypes.get_tensor_shape(input, op="CONV")
+        weight_size = datatypes.get_tensor_shape(weight, op="CONV")
+        output_size = tuple(datatypes.get_tensor_shape(output, op="CONV"))
 
-        problem_size = Conv2DProblemSize(
+        expected_size = self.output_size(input_size, weight_size, padding, stride, dilation)
+        if output_size[1:-1] != expected_size[1:-1]:
+            raise Exception(f"Tensor {output_tensor} size should be {expected_size}, got {output_size}")
+
+        return self._problem_size(input_size, weight_size, padding, stride, dilation)
+
+    @staticmethod
+    def _problem_size(input_size, weight_size, padding, stride, dilation):
+        N_, H_, W_, C_ = input_size
+        K_, R_, S_, _ = weight_size
+        return Conv2DProblemSize(
             N_, H_, W_, C_,
             K_, R_, S_, C_,
             padding[0], padding[1],
@@ -724,18 +848,13 @@ class Conv2d(OperationBase):
             1, 1
         )
 
-        if P_ != problem_size.P or Q_ != problem_size.Q:
-            raise Exception(
-                f"Tensor {output_tensor} size should be ({N_}, {problem_size.P}, {problem_size.Q}, {K_}), got ({N_}, {P_}, {Q_}, {K_})")
-
-        return problem_size
-
     def run(self, A=None, B=None, C=None, D=None,
             stride=(1, 1), padding=(0, 0), dilation=(1, 1),
             alpha=None, beta=None,
             split_k=("serial", 1), sync: bool = True,
             print_module: bool = False,
-            stream: cuda.CUstream = cuda.CUstream(0)) -> Conv2dArguments:
+            stream: cuda.CUstream = cuda.CUstream(0),
+            visitor_args: dict = None) -> Conv2dArguments:
         """
         Runs the kernel currently specified. If it has not already been, the kernel is emitted and
         compiled. Tensors holding operands and outputs of the kernel are sourced either from the
@@ -764,9 +883,11 @@ class Conv2d(OperationBase):
         :type print_module: bool
         :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
         :type stream: :class:`cuda.cuda.CUstream`
+        :param visitor_args: tensors and scalars consumed by the epilogue visitor, if one is set
+        :type visitor_args: dict
 
         :return: arguments passed in to the kernel
-        :rtype: cutlass.backend.Conv2dArguments
+        :rtype: cutlass.backend.Conv2dArguments or cutlass.backend.Conv3xArguments
         """
         super().run_setup()
 
@@ -788,6 +909,9 @@ class Conv2d(OperationBase):
         # It also verifies whether the A, B, C, D, stride, padding, and dilation are matching
         problem_size = self._get_and_verify_conv_problem_size(A, B, C, stride, padding, dilation)
 
+        if self._is_3x:
+            return self._run_3x(problem_size, A, B, C, D, alpha, beta, split_k, sync, print_module, stream, visitor_args)
+
         # Propose stride support based on input
         stride_support = self._propose_stride_support(stride)
 
@@ -886,6 +1010,40 @@ class Conv2d(OperationBase):
 
         return arguments
 
+    def _run_3x(self, problem_size, A, B, C, D, alpha, beta, split_k, sync, print_module, stream, visitor_args):
+        """
+        Runs an SM90 convolution. These kernels have no split-K or iterator algorithm variants,
+        and support only the identity activation.
+        """
+        if split_k[0] != "serial" or split_k[1] != 1:
+            raise Exception(f"SM90 convolutions do not support split-K, got split_k={split_k}.")
+
+        alignment_a = self._alignment_3x(datatypes.get_tensor_shape(A, op="CONV"), self._element_a, "A")
+        alignment_b = self._alignment_3x(datatypes.get_tensor_shape(B, op="CONV"), self._element_b, "B")
+        alignment_c = self._alignment_3x(datatypes.get_tensor_shape(D, op="CONV"), self._element_c, "C")
+
+        self.compile(tile_description=self.tile_description, alignment_A=alignment_a, alignment_B=alignment_b,
+                     alignment_C=alignment_c, epilogue_functor=self.epilogue_functor, print_module=print_module)
+
+        if isinstance(self.epilogue_functor, EpilogueFunctorVisitor):
+            output_op = self.operation.epilogue_type(visitor_args)
+        else:
+            output_op = self.operation.epilogue_type(alpha, beta)
+
+        arguments = Conv3xArguments(
+            operation=self.operation, problem_size=problem_size,
+            A=A, B=B, C=C, D=D,
+            output_op=output_op,
+            stream=stream
+        )
+
+        self.operation.run(arguments)
+
+        if sync:
+            arguments.sync()
+
+        return arguments
+
     #
     # Helper functions
     #
@@ -926,11 +1084,11 @@ class Conv2dFprop(Conv2d):
         self, input=None, weight=None, C=None, output=None, alpha=None, beta=None,
         stride=(1, 1), padding=(0, 0), dilation=(1, 1), split_k=("serial", 1),
         sync: bool = True, print_module: bool = False,
-        stream: cuda.CUstream = cuda.CUstream(0)) -> Conv2dArguments:
+        stream: cuda.CUstream = cuda.CUstream(0), visitor_args: dict = None) -> Conv2dArguments:
 
         A, B, D = input, weight, output
         return super().run(
-            A, B, C, D, alpha, beta, stride, padding, dilation, split_k, sync, print_module, stream)
+            A, B, C, D, stride, padding, dilation, alpha, beta, split_k, sync, print_module, stream, visitor_args)
 
 
 class Conv2dDgrad(Conv2d):
@@ -955,7 +1113,7 @@ class Conv2dDgrad(Conv2d):
         #
         A, B, D = grad_output, weight, grad_input
         return super().run(
-            A, B, C, D, alpha, beta, stride, padding, dilation, split_k, sync, print_module, stream)
+            A, B, C, D, stride, padding, dilation, alpha, beta, split_k, sync, print_module, stream)
 
 
 class Conv2dWgrad(Conv2d):
@@ -980,4 +1138,156 @@ class Conv2dWgrad(Conv2d):
         #
         A, B, D = grad_output, input, grad_weight
         return super().run(
-            A, B, C, D, alpha, beta, stride, padding, dilation, split_k, sync, print_module, stream)
+            A, B, C, D, stride, padding, dilation, alpha, beta, split_k, sync, print_module, stream)
+
+
+class Conv3d(Conv2d):
+    """
+    Constructs a ``Conv3d`` object for NDHWC activations and KTRSC filters.
+
+    Conv3d is only supported through CUTLASS 3 kernels and thus requires SM90. The constructor
+    parameters are those of ``Conv2d``, and ``stride``, ``padding``, and ``dilation`` passed to
+    ``run()`` are (d, h, w) tuples. Split-K, iterator algorithms, and elementwise activations
+    other than the identity are not supported; use an epilogue visitor for fusion in fprop.
+    """
+    _operation_kind = OperationKind.Conv3d
+    _activation_layout = cutlass.LayoutType.TensorNDHWC
+    _filter_layout = cutlass.LayoutType.TensorKCSRT
+
+    def __init__(
+        self, kind="fprop",
+        A=None, B=None, C=None, D=None, alpha=1.0, beta=0.0,
+        element=None,
+        element_A=None, element_B=None, element_C=None, element_D=None,
+        element_accumulator=None,
+        cc: int = None, kernel_cc: int = None
+    ):
+        super().__init__(
+            kind, A, B, C, D, alpha, beta, element,
+            element_A, element_B, element_C, element_D,
+            element_accumulator, cc, kernel_cc)
+        if not self._is_3x:
+            raise Exception(f"Conv3d requires SM90 kernels, but kernels for SM{self.current_cc} were selected.")
+
+    def _reset_options(self, cc: int):
+        if cc != 90:
+            raise Exception(f"Conv3d is only supported by SM90 kernels, but the requested configuration "
+                            f"requires SM{cc} kernels. SM90 kernels support neither non-identity activations "
+                            "nor specific math operations.")
+        super()._reset_options(cc)
+
+    def run(self, A=None, B=None, C=None, D=None,
+            stride=(1, 1, 1), padding=(0, 0, 0), dilation=(1, 1, 1),
+            alpha=None, beta=None,
+            split_k=("serial", 1), sync: bool = True,
+            print_module: bool = False,
+            stream: cuda.CUstream = cuda.CUstream(0),
+            visitor_args: dict = None) -> Conv3xArguments:
+        """
+        Runs the kernel currently specified. See ``Conv2d.run()``; ``stride``, ``padding``, and
+        ``dilation`` are given as (d, h, w) tuples.
+
+        :return: arguments passed in to the kernel
+        :rtype: cutlass.backend.Conv3xArguments
+        """
+        return super().run(
+            A, B, C, D, stride, padding, dilation, alpha, beta, split_k, sync, print_module, stream, visitor_args)
+
+    @staticmethod
+    def _problem_size(input_size, weight_size, padding, stride, dilation):
+        N_, D_, H_, W_, C_ = input_size
+        K_, T_, R_, S_, _ = weight_size
+        return Conv3DProblemSize(
+            N_, D_, H_, W_, C_,
+            K_, T_, R_, S_, C_,
+            padding[0], padding[1], padding[2],
+            stride[0], stride[1], stride[2],
+            dilation[0], dilation[1], dilation[2],
+            ConvMode.CrossCorrelation,
+            1, 1
+        )
+
+    @staticmethod
+    def output_size(input_size, weight_size, padding, stride, dilation):
+        problem_size = Conv3d._problem_size(input_size, weight_size, padding, stride, dilation)
+        return (problem_size.N, problem_size.Z, problem_size.P, problem_size.Q, problem_size.K)
+
+
+#
+# Easy to use interfaces for 3D fprop, wgrad, and dgrad
+#
+
+class Conv3dFprop(Conv3d):
+    def __init__(
+        self,
+        input=None, weight=None, C=None, output=None, alpha=1, beta=0,
+        element=None,
+        element_input=None, element_weight=None, element_C=None, element_output=None,
+        element_accumulator=None,
+        cc: int = None, kernel_cc: int = None):
+        A, B, D = input, weight, output
+        element_A, element_B, element_D = element_input, element_weight, element_output
+        super().__init__(
+            "fprop", A, B, C, D, alpha, beta, element,
+            element_A, element_B, element_C, element_D,
+            element_accumulator, cc, kernel_cc)
+
+    def run(
+        self, input=None, weight=None, C=None, output=None, alpha=None, beta=None,
+        stride=(1, 1, 1), padding=(0, 0, 0), dilation=(1, 1, 1),
+        sync: bool = True, print_module: bool = False,
+        stream: cuda.CUstream = cuda.CUstream(0), visitor_args: dict = None) -> Conv3xArguments:
+
+        A, B, D = input, weight, output
+        return super().run(
+            A, B, C, D, stride, padding, dilation, alpha, beta, ("serial", 1), sync, print_module, stream, visitor_args)
+
+
+class Conv3dDgrad(Conv3d):
+    def __init__(
+        self,
+        grad_output=None, weight=None, C=None, grad_input=None, alpha=1, beta=0,
+        element=None,
+        element_grad_output=None, element_weight=None, element_C=None, element_grad_input=None,
+        element_accumulator=None,
+        cc: int = None, kernel_cc: int = None):
+        A, B, D = grad_output, weight, grad_input
+        element_A, element_B, element_D = element_grad_output, element_weight, element_grad_input
+        super().__init__(
+            "dgrad", A, B, C, D, alpha, beta, element,
+            element_A, element_B, element_C, element_D,
+            element_accumulator, cc, kernel_cc)
+
+    def run(self, grad_output=None, weight=None, C=None, grad_input=None, alpha=None, beta=None,
+        stride=(1, 1, 1), padding=(0, 0, 0), dilation=(1, 1, 1),
+        sync: bool = True, print_module: bool = False,
+        stream: cuda.CUstream = cuda.CUstream(0)) -> Conv3xArguments:
+        #
+        A, B, D = grad_output, weight, grad_input
+        return super().run(
+            A, B, C, D, stride, padding, dilation, alpha, beta, ("serial", 1), sync, print_module, stream)
+
+
+class Conv3dWgrad(Conv3d):
+    def __init__(
+        self,
+        grad_output=None, input=None, C=None, grad_weight=None, alpha=1, beta=0,
+        element=None,
+        element_grad_output=None, element_input=None, element_C=None, element_grad_weight=None,
+        element_accumulator=None,
+        cc: int = None, kernel_cc: int = None):
+        A, B, D = grad_output, input, grad_weight
+        element_A, element_B, element_D = element_grad_output, element_input, element_grad_weight
+        super().__init__(
+            "wgrad", A, B, C, D, alpha, beta, element,
+            element_A, element_B, element_C, element_D,
+            element_accumulator, cc, kernel_cc)
+
+    def run(self, grad_output=None, input=None, C=None, grad_weight=None, alpha=None, beta=None,
+        stride=(1, 1, 1), padding=(0, 0, 0), dilation=(1, 1, 1),
+        sync: bool = True, print_module: bool = False,
+        stream: cuda.CUstream = cuda.CUstream(0)) -> Conv3xArguments:
+        #
+        A, B, D = grad_output, input, grad_weight
+        return super().run(
+            A, B, C, D, stride, padding, dilation, alpha, beta, ("serial", 1), sync, print_module, stream)
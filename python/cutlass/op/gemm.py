@@ -112,6 +112,17 @@
         # Do other work...
 
         args.sync()
+
+    The fastest tile description for a problem can be selected by timing candidate kernels on
+    the operands themselves. Subsequent runs of problems of similar size dispatch to the winner:
+
+    .. highlight:: python
+    .. code-block:: python
+
+        plan = cutlass.op.Gemm(element=np.float32, layout=cutlass.LayoutType.RowMajor)
+        td = plan.autotune(A0, B0, C0, D0, budget=8)
+
+        plan.run(A0, B0, C0, D0)
 """
 
 from math import prod
@@ -127,7 +138,7 @@ import cutlass
 from cutlass import epilogue, swizzle
 from cutlass.backend import compiler
 from cutlass.backend.evt import EpilogueFunctorVisitor
-from cutlass.backend.gemm_operation import GemmArguments, GemmOperationUniversal
+from cutlass.backend.gemm_operation import BoundGemmLauncher, GemmArguments, GemmOperationUniversal
 from cutlass.backend.library import TensorDescription, TileDescription
 from cutlass.op.op import OperationBase
 from cutlass.shape import GemmCoord
@@ -274,6 +285,12 @@ class Gemm(OperationBase):
         self.op_class = None
         self._tile_description = None
 
+        # Tile descriptions selected by ``autotune()``, keyed by ``_tuning_key()``. Misses are cached as ``None``.
+        self._tuned_tile_descriptions = {}
+
+        # Launchers returned by ``bind()``, keyed by problem and kernel
+        self._launchers = {}
+
         self._reset_operations()
 
         self._swizzling_functor = cutlass.swizzle.IdentitySwizzle1
@@ -621,38 +638,14 @@ class Gemm(OperationBase):
                                 f'does not match the expected type and '
                                 f'layout of ({ref_type}, {ref_layout}) and transpose failed.')
 
-    def run(self, A=None, B=None, C=None, D=None,
-            alpha=None, beta=None, sync: bool = True, print_module: bool = False, visitor_args: dict = None,
-            stream: cuda.CUstream = cuda.CUstream(0)) -> GemmArguments:
+    def _prepare_operands(self, A, B, C, D, alpha, beta) -> tuple:
         """
-        Runs the kernel currently specified. If it has not already been, the kernel is emitted and
-        compiled. Tensors holding operands and outputs of the kernel are sourced either from the
-        ``A``, ``B``, ``C``, ``D``, ``alpha``, and ``beta``
-        parameters provided in this call, or from those
-        passed in on the construction of this object -- one of the two must be specified.
-
-        By default, this call returns only once the kernel has completed. To launch the kernel
-        and immediately return, set ``sync=False``. In this case, it is the responsibility of the
-        caller to syncrhonize the results of the kernel before attempting to access outputs
-        by calling ``sync()`` on the arguments returned from this call.
-
-        :param A: tensor representing data type and layout of operand A
-        :param B: tensor representing data type and layout of operand B
-        :param C: tensor representing data type and layout of operand C
-        :param D: tensor representing data type and layout of operand D
-        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
-        :param beta: scalar parameter beta from GEMM operation that scales operand C
-        :param sync: whether the call should wait for the kernel to complete before returning
-        :type sync: bool
-        :param print_module: whether to print the emitted C++ code
-        :type print_module: bool
-        :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
-        :type stream: :class:`cuda.cuda.CUstream`
+        Resolves and verifies the operands of a call to ``run()`` or ``autotune()`` and determines
+        the alignments of A, B, and C to use for them
 
-        :return: arguments passed in to the kernel
-        :rtype: cutlass.backend.GemmArguments
+        :return: tuple of the operands A, B, C, D, alpha, and beta, and the tuple of alignments of A, B, and C
+        :rtype: tuple
         """
-        super().run_setup()
         A = self._verify_tensor(A, self.A, self._element_a, self._layout_a, "A")
         B = self._verify_tensor(B, self.B, self._element_b, self._layout_b, "B")
         C = self._verify_tensor(C, self.C, self._element_c, self._layout_c, "C")
@@ -674,9 +667,16 @@ class Gemm(OperationBase):
         # Set C alignment based on D.shape so as to correctly get an alignment with void-C
         # kernels, for which `C` is None.
         alignment_c = self.possible_operations.find_alignment(D.shape, self._layout_c, operand="C")
-        self.compile(self._tile_description, alignment_A=alignment_a, alignment_B=alignment_b,
-                     alignment_C=alignment_c, print_module=print_module)
 
+        return A, B, C, D, alpha, beta, (alignment_a, alignment_b, alignment_c)
+
+    def _make_arguments(self, operation, A, B, C, D, alpha, beta, visitor_args, stream) -> GemmArguments:
+        """
+        Constructs the arguments with which ``operation`` computes the GEMM on the given operands
+
+        :return: arguments to pass in to the kernel
+        :rtype: cutlass.backend.GemmArguments
+        """
         problem_size, mode, batch_count = self._get_problem_args(A, B, C, D)
 
         if mode == GemmUniversalMode.Gemm or batch_count == 1:
@@ -695,18 +695,295 @@ class Gemm(OperationBase):
         kwargs['stream'] = stream
 
         if isinstance(self.epilogue_functor, EpilogueFunctorVisitor):
-            output_op = self.operation.epilogue_type(visitor_args)
+            output_op = operation.epilogue_type(visitor_args)
         else:
-            output_op = self.operation.epilogue_type(alpha, beta)
+            output_op = operation.epilogue_type(alpha, beta)
 
-        arguments = GemmArguments(
-            operation=self.operation, problem_size=problem_size,
+        return GemmArguments(
+            operation=operation, problem_size=problem_size,
             A=A, B=B, C=C, D=D,
             output_op=output_op,
             gemm_mode=mode,
             **kwargs
         )
 
+    def _compile_preserving_tile_description(self, tile_description, alignments, print_module: bool = False):
+        """
+        Compiles the kernel for ``tile_description`` without making it the tile description set
+        on this plan. This allows kernels selected by ``autotune()`` to vary across problem shapes.
+        """
+        tile_description_set = self._tile_description
+        try:
+            self.compile(tile_description, alignment_A=alignments[0], alignment_B=alignments[1],
+                         alignment_C=alignments[2], print_module=print_module)
+        finally:
+            self._tile_description = tile_description_set
+        return self.operation
+
+    @staticmethod
+    def _tile_description_key(td: TileDescription) -> str:
+        """
+        Returns a string identifying ``td`` among the tile descriptions of this plan
+
+        :rtype: str
+        """
+        return "_".join(str(x) for x in [
+            td.threadblock_shape, td.cluster_shape, td.warp_count, td.stages,
+            td.math_instruction.instruction_shape, td.math_instruction.math_operation,
+            td.kernel_schedule, td.epilogue_schedule, td.tile_scheduler])
+
+    def _tuning_key(self, A, B, C, D, alignments) -> str:
+        """
+        Returns the key under which the tile description selected by ``autotune()`` for these operands
+        is stored. The key identifies the kernel signature of this plan (compute capability, data types,
+        layouts, alignments, math operation, epilogue, and swizzling functor) and buckets the problem
+        size by rounding M, N, K, and the batch count up to powers of two.
+
+        :rtype: str
+        """
+        problem_size, mode, batch_count = self._get_problem_args(A, B, C, D)
+        bucket = lambda x: 1 << max(int(x) - 1, 0).bit_length()
+
+        if isinstance(self.epilogue_functor, EpilogueFunctorVisitor):
+            epilogue_name = type(self.epilogue_functor).__name__
+        else:
+            activation = self.activation
+            epilogue_name = getattr(activation, "__name__", str(activation))
+
+        signature = [
+            self.current_cc, self.opclass, self._math_operation,
+            self._element_a, self._element_b, self._element_c, self._element_d, self._element_accumulator,
+            self._layout_a, self._layout_b, self._layout_c,
+            "x".join(str(a) for a in alignments),
+            epilogue_name, self._swizzling_functor.__name__,
+            mode,
+            f"{bucket(problem_size.m)}x{bucket(problem_size.n)}x{bucket(problem_size.k)}x{bucket(batch_count)}",
+        ]
+        return "gemm|" + "|".join(str(x) for x in signature)
+
+    def _tuned_tile_description(self, A, B, C, D, alignments) -> TileDescription:
+        """
+        Returns the tile description selected by ``autotune()`` for the shape bucket of these operands,
+        either in this plan or in a previous process, or ``None`` if the bucket has not been tuned
+
+        :rtype: cutlass.backend.TileDescription or None
+        """
+        key = self._tuning_key(A, B, C, D, alignments)
+        if key not in self._tuned_tile_descriptions:
+            td = None
+            config = compiler.load_tuned_config(key)
+            if config is not None:
+                # Persisted configurations are resolved against the tile descriptions of this plan
+                for candidate in self.tile_descriptions():
+                    if self._tile_description_key(candidate) == config:
+                        td = candidate
+                        break
+            self._tuned_tile_descriptions[key] = td
+        return self._tuned_tile_descriptions[key]
+
+    def autotune(self, A=None, B=None, C=None, D=None, alpha=None, beta=None,
+                 candidates: list = None, budget: int = None,
+                 warmup_iterations: int = 10, iterations: int = 50, visitor_args: dict = None,
+                 stream: cuda.CUstream = cuda.CUstream(0)) -> TileDescription:
+        """
+        Selects the fastest tile description for the given operands. Candidate kernels are compiled
+        together in a single module and timed on the operands themselves with CUDA events. The
+        winner is stored in the compilation cache, keyed by the kernel signature of this plan and
+        a power-of-two bucket of the problem size, and subsequent calls to ``run()`` with problems
+        in the same bucket dispatch to it unless a tile description has been set explicitly.
+
+        Note that D is overwritten by each candidate.
+
+        :param A: tensor representing data type and layout of operand A
+        :param B: tensor representing data type and layout of operand B
+        :param C: tensor representing data type and layout of operand C
+        :param D: tensor representing data type and layout of operand D
+        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
+        :param beta: scalar parameter beta from GEMM operation that scales operand C
+        :param candidates: tile descriptions to consider. Defaults to those of all kernels supporting the operands' alignments
+        :type candidates: list
+        :param budget: maximum number of candidates to compile and time. Defaults to all candidates
+        :type budget: int
+        :param warmup_iterations: number of untimed runs of each candidate
+        :type warmup_iterations: int
+        :param iterations: number of timed runs of each candidate
+        :type iterations: int
+        :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+        :type stream: :class:`cuda.cuda.CUstream`
+
+        :return: tile description of the fastest candidate
+        :rtype: cutlass.backend.TileDescription
+        """
+        from cutlass.utils.profiler import GpuTimer
+
+        super().run_setup()
+        A, B, C, D, alpha, beta, alignments = self._prepare_operands(A, B, C, D, alpha, beta)
+
+        if candidates is None:
+            ops = self.possible_operations.operations(*alignments, self._math_operation)
+            candidates = [datatypes.td_from_profiler_op(op) for op in ops]
+
+        # Drop duplicates and tile descriptions that are invalid on this device
+        unique = {}
+        for td in candidates:
+            if self._valid_tile_description(td)[0]:
+                unique.setdefault(self._tile_description_key(td), td)
+        candidates = list(unique.values())
+        if budget is not None and budget > 0:
+            candidates = candidates[:budget]
+
+        if len(candidates) == 0:
+            raise Exception("No valid tile descriptions to autotune over.")
+
+        tile_description_set = self._tile_description
+        operation_set = getattr(self, "operation", None)
+        try:
+            operations = [self.construct(td, *alignments) for td in candidates]
+        finally:
+            self._tile_description = tile_description_set
+
+        try:
+            compiler.add_module(operations)
+        except Exception:
+            # A single kernel failing to compile fails the whole module, so fall back to compiling
+            # candidates individually and dropping those that fail
+            compiled = []
+            for td, operation in zip(candidates, operations):
+                try:
+                    compiler.add_module([operation,])
+                    compiled.append((td, operation))
+                except Exception as e:
+                    cutlass.logger.warning(f"Skipping tile description that failed to compile: {td}\n{e}")
+            candidates, operations = [list(x) for x in zip(*compiled)] if compiled else ([], [])
+
+        if len(operations) == 0:
+            raise Exception("No candidate kernels could be compiled.")
+
+        timer = GpuTimer()
+        best = None
+        for td, operation in zip(candidates, operations):
+            arguments = self._make_arguments(operation, A, B, C, D, alpha, beta, visitor_args, stream)
+
+            for _ in range(warmup_iterations):
+                operation.run(arguments)
+
+            timer.start(stream)
+            for _ in range(iterations):
+                operation.run(arguments)
+            timer.stop_and_wait(stream)
+
+            runtime = timer.duration(iterations)
+            cutlass.logger.info(f"Autotuning: {runtime:.4f} ms for {td}")
+            if best is None or runtime < best[1]:
+                best = (td, runtime)
+
+        if operation_set is not None:
+            self.operation = operation_set
+
+        key = self._tuning_key(A, B, C, D, alignments)
+        self._tuned_tile_descriptions[key] = best[0]
+        compiler.insert_tuned_config(key, self._tile_description_key(best[0]), best[1])
+
+        return best[0]
+
+    def bind(self, A=None, B=None, C=None, D=None, alpha=None, beta=None,
+             stream: cuda.CUstream = cuda.CUstream(0)) -> BoundGemmLauncher:
+        """
+        Returns a launcher that runs the kernel for the shapes of the given operands with low host
+        overhead. Its kernel parameters are built once; calling it with new tensors of the same
+        shapes only patches their pointers:
+
+        .. highlight:: python
+        .. code-block:: python
+
+            launch = plan.bind(A, B, C, D)
+            for A, D in requests:
+                launch(A=A, D=D, stream=stream)
+
+        Launchers are cached per problem shape, scalars, and kernel, so repeated calls to ``bind()``
+        with tensors of the same shapes return the same launcher rebound to those tensors. Operands
+        must reside in device memory, and the launcher does not synchronize.
+
+        :param A: tensor representing data type and layout of operand A
+        :param B: tensor representing data type and layout of operand B
+        :param C: tensor representing data type and layout of operand C
+        :param D: tensor representing data type and layout of operand D
+        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
+        :param beta: scalar parameter beta from GEMM operation that scales operand C
+        :param stream: default stream of launches, defaults to cuda.cuda.CUstream(0)
+        :type stream: :class:`cuda.cuda.CUstream`
+
+        :return: launcher bound to the given operands
+        :rtype: cutlass.backend.BoundGemmLauncher
+        """
+        if isinstance(self.epilogue_functor, EpilogueFunctorVisitor):
+            raise Exception("Bound launchers do not support epilogue visitors.")
+
+        super().run_setup()
+        A, B, C, D, alpha, beta, alignments = self._prepare_operands(A, B, C, D, alpha, beta)
+
+        tile_description = self._tile_description
+        if tile_description is None:
+            tile_description = self._tuned_tile_description(A, B, C, D, alignments)
+
+        shape = lambda x: None if x is None else tuple(x.shape)
+        key = (shape(A), shape(B), shape(C), shape(D), alignments, alpha, beta, int(stream),
+               None if tile_description is None else self._tile_description_key(tile_description),
+               self.activation, self._swizzling_functor)
+
+        launcher = self._launchers.get(key)
+        if launcher is None:
+            operation = self._compile_preserving_tile_description(tile_description, alignments)
+            arguments = self._make_arguments(operation, A, B, C, D, alpha, beta, None, stream)
+            launcher = BoundGemmLauncher(operation, arguments)
+            self._launchers[key] = launcher
+        else:
+            launcher.bind(A, B, C, D)
+
+        return launcher
+
+    def run(self, A=None, B=None, C=None, D=None,
+            alpha=None, beta=None, sync: bool = True, print_module: bool = False, visitor_args: dict = None,
+            stream: cuda.CUstream = cuda.CUstream(0)) -> GemmArguments:
+        """
+        Runs the kernel currently specified. If it has not already been, the kernel is emitted and
+        compiled. Tensors holding operands and outputs of the kernel are sourced either from the
+        ``A``, ``B``, ``C``, ``D``, ``alpha``, and ``beta``
+        parameters provided in this call, or from those
+        passed in on the construction of this object -- one of the two must be specified.
+
+        By default, this call returns only once the kernel has completed. To launch the kernel
+        and immediately return, set ``sync=False``. In this case, it is the responsibility of the
+        caller to syncrhonize the results of the kernel before attempting to access outputs
+        by calling ``sync()`` on the arguments returned from this call.
+
+        :param A: tensor representing data type and layout of operand A
+        :param B: tensor representing data type and layout of operand B
+        :param C: tensor representing data type and layout of operand C
+        :param D: tensor representing data type and layout of operand D
+        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
+        :param beta: scalar parameter beta from GEMM operation that scales operand C
+        :param sync: whether the call should wait for the kernel to complete before returning
+        :type sync: bool
+        :param print_module: whether to print the emitted C++ code
+        :type print_module: bool
+        :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+        :type stream: :class:`cuda.cuda.CUstream`
+
+        :return: arguments passed in to the kernel
+        :rtype: cutlass.backend.GemmArguments
+        """
+        super().run_setup()
+        A, B, C, D, alpha, beta, alignments = self._prepare_operands(A, B, C, D, alpha, beta)
+
+        # An explicitly set tile description takes precedence over one selected by ``autotune()``
+        tile_description = self._tile_description
+        if tile_description is None:
+            tile_description = self._tuned_tile_description(A, B, C, D, alignments)
+
+        self._compile_preserving_tile_description(tile_description, alignments, print_module)
+        arguments = self._make_arguments(self.operation, A, B, C, D, alpha, beta, visitor_args, stream)
+
         self.operation.run(arguments)
 
         if sync:
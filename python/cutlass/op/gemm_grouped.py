@@ -49,19 +49,40 @@
         # As, Bs, Cs, and Ds are torch/numpy/cupy tensor objects
         plan = cutlass.op.GroupedGemm(element=cutlass.DataType.f16, layout=cutlass.LayoutType.RowMajor)
         plan.run([A0, A1], [B0, B1], [C0, C1], [D0, D1])
+
+    On SM90, grouped GEMMs use the CUTLASS 3 ptr-array kernels. These can also be launched directly
+    from per-group arrays that already reside in device memory, including a device-resident group
+    count, so that no host synchronization is needed between, e.g., a mixture-of-experts router
+    and the expert GEMMs:
+
+    .. highlight:: python
+    .. code-block:: python
+
+        # problem_sizes: (G, 3) int32 device tensor of (M, N, K)
+        # ptr_*: (G,) int64 device tensors of operand addresses; ld_*: (G,) int64 leading dimensions
+        # count: (1,) int32 device tensor holding the number of groups to compute (<= G)
+        plan.run_device(problem_sizes, ptr_A, ptr_B, ptr_C, ptr_D, ld_A, ld_B, ld_C, ld_D,
+                        num_groups=G, device_num_groups=count)
 """
 
-from cutlass_library import DataTypeSize
+from cutlass_library import (
+    DataTypeSize,
+    EpilogueScheduleType,
+    KernelScheduleType,
+)
 
 from cuda import cuda
 from cutlass.backend.gemm_operation import (
     GemmGroupedArguments,
+    GemmGroupedArguments3x,
     GemmOperationGrouped,
 )
 from cutlass.backend.library import (
+    ApiVersion,
     SchedulerMode,
     TensorDescription,
     TileDescription,
+    api_version,
 )
 from cutlass.op.gemm import Gemm
 from cutlass.shape import GemmCoord
@@ -130,8 +151,9 @@ class GroupedGemm(Gemm):
             cc=cc
         )
 
-        # Grouped GEMM specializations for SM90 are currently unavailable. Revert to using SM80
-        if self.current_cc == 90:
+        # SM90 grouped GEMMs use the CUTLASS 3 ptr-array kernels, which are only available for
+        # the configurations emitted via CUTLASS 3. Revert to using SM80 otherwise
+        if self.current_cc == 90 and not self._uses_ptr_array():
             self._reset_options(80)
             self._reset_operations(reset_epilogue=False)
 
@@ -144,6 +166,44 @@ class GroupedGemm(Gemm):
         """
         raise Exception('Grouped GEMM does not currently support different swizzling functors')
 
+    def _uses_ptr_array(self) -> bool:
+        """
+        Returns whether the kernels emitted for the current configuration are CUTLASS 3 ptr-array kernels
+        """
+        return api_version(self.current_cc, self.opclass, self._element_a) == ApiVersion.v3x
+
+    @staticmethod
+    def _ptr_array_tile_description(tile_description: TileDescription) -> TileDescription:
+        """
+        Returns a copy of ``tile_description`` whose kernel and epilogue schedules are the ptr-array
+        counterparts of its own. Pingpong schedules stay pingpong; everything else, including auto
+        schedules with a tile M of at least 128, becomes cooperative.
+
+        :param tile_description: tile description selected for a CUTLASS 3 GEMM
+        :type tile_description: cutlass.backend.TileDescription
+
+        :return: tile description to use for a CUTLASS 3 grouped GEMM
+        :rtype: cutlass.backend.TileDescription
+        """
+        pingpong_schedules = [
+            KernelScheduleType.TmaWarpSpecializedPingpong,
+            KernelScheduleType.TmaWarpSpecializedPingpongFP8FastAccum,
+            KernelScheduleType.CpAsyncWarpSpecializedPingpong,
+            KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong,
+        ]
+        kschedule = tile_description.kernel_schedule
+        if kschedule in pingpong_schedules or tile_description.threadblock_shape[0] % 128 != 0:
+            kschedule = KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong
+            eschedule = EpilogueScheduleType.PtrArrayTmaWarpSpecializedPingpong
+        else:
+            kschedule = KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative
+            eschedule = EpilogueScheduleType.PtrArrayTmaWarpSpecializedCooperative
+        return tile_description.clone_and_update({
+            "kernel_schedule": kschedule,
+            "epilogue_schedule": eschedule,
+            "tile_scheduler": None,
+        })
+
     def construct(self, tile_description: TileDescription = None,
                   alignment_A: int = None,
                   alignment_B: int = None,
@@ -170,7 +230,7 @@ class GroupedGemm(Gemm):
 
         self.epilogue_functor = self._reset_epilogue_functor_alignment(alignment_C, self.epilogue_functor)
 
-        tensor_A = TensorDescription(self._element_a, self._layout_b, alignment_A)
+        tensor_A = TensorDescription(self._element_a, self._layout_a, alignment_A)
         tensor_B = TensorDescription(self._element_b, self._layout_b, alignment_B)
         tensor_C = TensorDescription(self._element_c, self._layout_c, alignment_C)
 
@@ -183,6 +243,9 @@ class GroupedGemm(Gemm):
                 raise Exception(f"Invalid tile description. {err_str}")
             self.tile_description = tile_description
 
+        if self._uses_ptr_array():
+            tile_description = self._ptr_array_tile_description(tile_description)
+
         operation = GemmOperationGrouped(
             arch=self.current_cc,
             tile_description=tile_description,
@@ -248,11 +311,90 @@ class GroupedGemm(Gemm):
         self.compile(self.tile_description, alignment_A=alignment_a, alignment_B=alignment_b,
                      alignment_C=alignment_c, print_module=print_module)
 
-        arguments = GemmGroupedArguments(
+        if self.operation.api == ApiVersion.v3x:
+            arguments = GemmGroupedArguments3x(
+                operation=self.operation,
+                problem_sizes=problem_sizes,
+                A=As, B=Bs, C=Cs, D=Ds,
+                alpha=alpha, beta=beta,
+                stream=stream
+            )
+        else:
+            arguments = GemmGroupedArguments(
+                operation=self.operation,
+                problem_sizes=problem_sizes,
+                A=As, B=Bs, C=Cs, D=Ds,
+                output_op=self.operation.epilogue_type(alpha, beta),
+                stream=stream
+            )
+
+        self.operation.run(arguments)
+
+        if sync:
+            arguments.sync()
+
+        return arguments
+
+    def run_device(self, problem_sizes, ptr_A, ptr_B, ptr_C, ptr_D,
+                   stride_A, stride_B, stride_C, stride_D,
+                   num_groups: int, device_num_groups=None,
+                   alpha=None, beta=None, alpha_ptr_array=None, beta_ptr_array=None,
+                   sync: bool = True, print_module: bool = False,
+                   stream: cuda.CUstream = cuda.CUstream(0)) -> GemmGroupedArguments3x:
+        """
+        Runs the SM90 ptr-array kernel on a group described entirely by arrays in device memory.
+
+        None of the arrays is read on the host, so they may be produced by preceding work on ``stream``.
+        Because problem sizes are unknown on the host, the kernel is compiled for the maximum alignment
+        supported by the current configuration: every pointer and leading dimension must be aligned to
+        it (128 bits for most data types). The grid is sized for all SMs rather than for the actual
+        number of tiles.
+
+        :param problem_sizes: ``num_groups`` packed (M, N, K) ``int32`` triples
+        :param ptr_A: ``num_groups`` ``int64`` pointers to operand A of each group
+        :param ptr_B: ``num_groups`` ``int64`` pointers to operand B of each group
+        :param ptr_C: ``num_groups`` ``int64`` pointers to operand C of each group
+        :param ptr_D: ``num_groups`` ``int64`` pointers to output D of each group
+        :param stride_A: ``num_groups`` ``int64`` leading dimensions of A
+        :param stride_B: ``num_groups`` ``int64`` leading dimensions of B
+        :param stride_C: ``num_groups`` ``int64`` leading dimensions of C
+        :param stride_D: ``num_groups`` ``int64`` leading dimensions of D
+        :param num_groups: capacity of the arrays above
+        :type num_groups: int
+        :param device_num_groups: optional ``int32`` device scalar holding the number of groups to compute,
+                                  at most ``num_groups``
+        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
+        :param beta: scalar parameter beta from GEMM operation that scales operand C
+        :param alpha_ptr_array: optional ``num_groups`` pointers to per-group alpha, overriding ``alpha``
+        :param beta_ptr_array: optional ``num_groups`` pointers to per-group beta, overriding ``beta``
+        :param sync: whether the call should wait for the kernel to complete before returning
+        :type sync: bool
+        :param print_module: whether to print the emitted C++ code
+        :type print_module: bool
+        :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+        :type stream: :class:`cuda.cuda.CUstream`
+
+        :return: arguments passed in to the kernel
+        :rtype: cutlass.backend.GemmGroupedArguments3x
+        """
+        if not self._uses_ptr_array():
+            raise Exception("Grouped GEMMs from device arrays require the SM90 ptr-array kernels")
+
+        super().run_setup()
+
+        alpha = self._verify_scalar(alpha, self.alpha, self._element_c, "alpha")
+        beta = self._verify_scalar(beta, self.beta, self._element_c, "beta")
+
+        self.compile(self.tile_description, print_module=print_module)
+
+        arguments = GemmGroupedArguments3x(
             operation=self.operation,
             problem_sizes=problem_sizes,
-            A=As, B=Bs, C=Cs, D=Ds,
-            output_op=self.operation.epilogue_type(alpha, beta),
+            A=ptr_A, B=ptr_B, C=ptr_C, D=ptr_D,
+            stride_A=stride_A, stride_B=stride_B, stride_C=stride_C, stride_D=stride_D,
+            num_groups=num_groups, device_num_groups=device_num_groups,
+            alpha=alpha, beta=beta,
+            alpha_ptr_array=alpha_ptr_array, beta_ptr_array=beta_ptr_array,
             stream=stream
         )
 
@@ -41,6 +41,7 @@ from cutlass_library import (
 )
 from cutlass.backend.c_types import (
     Conv2DProblemSize_,
+    ConvProblemShape3x_,
     GemmCoord_,
     GemmCoordBatched_
 )
@@ -182,3 +183,85 @@ class Conv2DProblemSize:
             stride_h, stride_w,
             dilation_h, dilation_w
         )
+
+
+class Conv3DProblemSize:
+    """
+    Problem size of a 3D convolution with an NDHWC activation and a KTRSC filter.
+
+    Unlike ``Conv2DProblemSize`` there is no 2.x kernel consuming this type: it is only
+    used to describe problems run by the SM90 implicit-GEMM convolutions. Output extents
+    are computed for general dilation.
+    """
+    def __init__(
+        self, n: int, d: int, h: int, w: int, c: int,
+        k: int, t: int, r: int, s: int, c_: int,
+        pad_d: int, pad_h: int, pad_w: int,
+        stride_d: int, stride_h: int, stride_w: int,
+        dilation_d: int, dilation_h: int, dilation_w: int,
+        mode: ConvMode=ConvMode.CrossCorrelation,
+        split_k_slices: int=1, groups: int=1):
+
+        self.N = n
+        self.D = d
+        self.H = h
+        self.W = w
+        self.C = c
+        self.K = k
+        self.T = t
+        self.R = r
+        self.S = s
+        self.pad_d = pad_d
+        self.pad_h = pad_h
+        self.pad_w = pad_w
+        self.stride_d = stride_d
+        self.stride_h = stride_h
+        self.stride_w = stride_w
+        self.dilation_d = dilation_d
+        self.dilation_h = dilation_h
+        self.dilation_w = dilation_w
+        self.mode = int(mode)
+        self.split_k_slices = split_k_slices
+        self.groups = groups
+        self.Z = Conv3DProblemSize.output_extent(d, t, pad_d, stride_d, dilation_d)
+        self.P = Conv3DProblemSize.output_extent(h, r, pad_h, stride_h, dilation_h)
+        self.Q = Conv3DProblemSize.output_extent(w, s, pad_w, stride_w, dilation_w)
+
+    @staticmethod
+    def output_extent(extent: int, filter_extent: int, pad: int, stride: int, dilation: int) -> int:
+        return (extent + 2 * pad - dilation * (filter_extent - 1) - 1) // stride + 1
+
+    @property
+    def ctype(self) -> ConvProblemShape3x_:
+        return ConvProblemShape3x_(self)
+
+    def implicit_gemm_size(self, kind: ConvKind):
+        if kind == ConvKind.Fprop:
+            return GemmCoord(
+                self.N * self.Z * self.P * self.Q,
+                self.K,
+                self.T * self.R * self.S * self.C // self.groups
+            )
+        elif kind == ConvKind.Dgrad:
+            return GemmCoord(
+                self.N * self.D * self.H * self.W,
+                self.C,
+                self.T * self.R * self.S * self.K
+            )
+        elif kind == ConvKind.Wgrad:
+            return GemmCoord(
+                self.K,
+                self.T * self.R * self.S * self.C,
+                self.N * self.Z * self.P * self.Q
+            )
+
+    @staticmethod
+    def from_sizes(input_size, weight_size):
+        K, T, R, S, _ = weight_size
+        return Conv3DProblemSize(
+            *input_size,
+            *weight_size,
+            T // 2, R // 2, S // 2,
+            1, 1, 1,
+            1, 1, 1
+        )
@@ -284,7 +284,9 @@ def get_tensor_shape(tensor, op="GEMM"):
     elif is_torch_tensor(tensor):
         size = tensor.size()
         if op == "CONV":
-            # PyTorch Tensors have shape NCHW
+            # PyTorch Tensors have shape NCHW or NCDHW
+            if len(size) == 5:
+                return (size[0], size[2], size[3], size[4], size[1])
             return (size[0], size[2], size[3], size[1])
         else:
             return tuple(tensor.size())
@@ -284,6 +284,34 @@ class EmitConv2dInstance:
     cutlass::MatrixShape<${dilation_r}, ${dilation_s}>
   >::Kernel;
 """
+    self.template_winograd = """
+  // Conv2d${conv_kind_name} ${iterator_algorithm_name} kernel instance "${operation_name}"
+  using ${operation_name}_base =
+  typename cutlass::conv::kernel::DefaultWinogradConv2d${conv_kind_name}<
+    ${element_a},
+    ${layout_a},
+    ${element_b},
+    ${layout_b},
+    ${element_c},
+    ${layout_c},
+    ${element_accumulator},
+    ${opcode_class},
+    ${arch},
+    cutlass::gemm::GemmShape<${threadblock_shape_m}, ${threadblock_shape_n}, ${threadblock_shape_k}>,
+    cutlass::gemm::GemmShape<${warp_shape_m}, ${warp_shape_n}, ${warp_shape_k} >,
+    cutlass::gemm::GemmShape<${instruction_shape_m}, ${instruction_shape_n}, ${instruction_shape_k}>,
+    ${epilogue_functor}<
+      ${element_c},
+      ${epilogue_vector_length},
+      ${element_accumulator},
+      ${element_epilogue}
+    >,
+    ${stages},
+    ${math_operator},
+    ${align_a},
+    ${align_b}
+  >::Kernel;
+"""
 
   def arch_number_to_type(self, arch: int):
     return f"cutlass::arch::Sm{arch}"
@@ -338,6 +366,10 @@ class EmitConv2dInstance:
       'align_b': str(operation.B.alignment),
     }
 
+    if operation.iterator_algorithm == IteratorAlgorithm.Winograd:
+      _LOGGER.debug("***   iterator_algorithm=Winograd")
+      return SubstituteTemplate(self.template_winograd, values)
+
     if operation.group_mode == GroupMode.NoneGroup:
       _LOGGER.debug("***   group_mode=NoneGroup")
       return SubstituteTemplate(self.template, values)
@@ -593,15 +625,18 @@ ${stub_end}
         stub_begin = "// STUB for now\n#if 0"
         stub_end = "#endif // 0"
 
-      if operation.group_mode == GroupMode.Depthwise:
+      if self.operation_is_3x(operation):
+        kernel_name = 'ConvUniversalAdapter'
+        operation_wrapper = 'ConvOperation3x'
+      elif operation.group_mode == GroupMode.Depthwise:
         kernel_name = 'DirectConvolution'
         operation_wrapper = 'DirectConv2dOperation'
+      elif operation.iterator_algorithm == IteratorAlgorithm.Winograd:
+        kernel_name = 'WinogradConv2dFprop'
+        operation_wrapper = 'Conv2dOperation'
       else:
         kernel_name = 'ImplicitGemmConvolution'
         operation_wrapper = 'Conv2dOperation'
-      if self.operation_is_3x(operation):
-        kernel_name = 'ConvUniversalAdapter'
-        operation_wrapper = 'ConvOperation3x'
 
       self.configuration_file.write(SubstituteTemplate(self.configuration_instance, {
         'configuration_name': self.configuration_name,
@@ -76,7 +76,7 @@ using ${operation_name}_epilogue =
     ${element_compute},
     ${element_c}, ${layout_c}, 128 / cute::sizeof_bits_v<${element_c}>,
     ${element_d}, ${layout_d}, 128 / cute::sizeof_bits_v<${element_d}>,
-    ${epilogue_schedule}
+    ${epilogue_schedule}${epilogue_fusion}
     // , class FusionOpOrCallbacks = cutlass::epilogue::fusion::LinearCombination<ElementD,ElementCompute>
   >::CollectiveOp;
 
@@ -173,6 +173,22 @@ using ${operation_name}_base = cutlass::conv::kernel::ConvUniversal<
     else:
       return f"{namespace_prefix}StageCountAutoCarveout<sizeof(typename {operation.procedural_name()}_epilogue::SharedStorage)>"
 
+  def epilogue_fusion(self, operation) -> str:
+    # LinearCombination is the epilogue builder's default fusion, so it is left implicit.
+    if operation.epilogue_functor == EpilogueFunctor3x.LinearCombination:
+      return ''
+    elif operation.epilogue_functor == EpilogueFunctor3x.PerColLinCombPerColBias:
+      # Per-output-channel alpha and bias, e.g. the dequantization of 8-bit convolutions.
+      # Output channels are the N mode of fprop's implicit GEMM.
+      element_d = DataTypeTag[operation.D.element]
+      element_c = DataTypeTag[operation.C.element]
+      element_compute = DataTypeTag[operation.element_compute]
+      return (f",\n    {EpilogueFunctor3xTag[operation.epilogue_functor]}<"
+              f"cutlass::epilogue::thread::Identity, {element_d}, {element_compute}, "
+              f"{element_compute}, {element_c}, {element_compute}>")
+    else:
+      raise RuntimeError(f"Unsupported CUTLASS 3 convolution epilogue functor {operation.epilogue_functor}")
+
   def emit(self, operation) -> str:
     _LOGGER.debug("*** EmitConv3xInstance::emit")
     _LOGGER.debug("***   operation: procedural_name()=" + operation.procedural_name())
@@ -232,6 +248,7 @@ using ${operation_name}_base = cutlass::conv::kernel::ConvUniversal<
       'stages':                self.stage_count(operation),
       'kernel_schedule':       kernel_schedule,
       'epilogue_schedule':     epilogue_schedule,
+      'epilogue_fusion':       self.epilogue_fusion(operation),
       'tile_scheduler':        tile_scheduler,
       'element_compute':       DataTypeTag[operation.element_compute]
     }
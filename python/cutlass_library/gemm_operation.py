@@ -144,6 +144,7 @@ class GemmOperation:
       MathOperation.xor_popc: 'xor',
       MathOperation.and_popc: 'and',
       MathOperation.multiply_add_fast_accum: 'fastaccum',
+      MathOperation.multiply_add_mixed_input_upcast_groupwise: 'groupwise',
     }
 
     tensor_ops = [
@@ -249,6 +250,12 @@ class GemmOperation:
   def epilogue_schedule_name_3x(self):
     return EpilogueScheduleSuffixes[self.epilogue_schedule]
 
+  # Generates a short string representing a fused epilogue, empty for a linear combination
+  def epilogue_functor_name_3x(self):
+    if isinstance(self.epilogue_functor, EpilogueFunctor3x):
+      return EpilogueFunctor3xSuffixes[self.epilogue_functor]
+    return ''
+
   # Generate a short string representing the operation class
   def opcode_class_name(self):
     return OpcodeClassNames[self.tile_description.math_instruction.opcode_class]
@@ -258,7 +265,7 @@ class GemmOperation:
     ''' The full procedural name indicates architecture, extended name, tile size, and layout. '''
     opcode_class_name = OpcodeClassNames[self.tile_description.math_instruction.opcode_class]
     if self.arch >= 90:
-      kernel_name_template = "cutlass{p}_sm{ar}_{op}_{ex}{ct}{cs}_{l}_{s}_align{al}{t}{k}{e}"
+      kernel_name_template = "cutlass{p}_sm{ar}_{op}_{ex}{ct}{cs}_{l}_{s}_align{al}{t}{k}{e}{f}"
       return kernel_name_template.format(
           p = self.prefix,
           ar = self.arch,
@@ -271,7 +278,8 @@ class GemmOperation:
           al = str(max(self.A.alignment, self.B.alignment)),
           t = TileSchedulerSuffixes[self.tile_scheduler],
           k = self.kernel_schedule_name_3x(),
-          e = self.epilogue_schedule_name_3x())
+          e = self.epilogue_schedule_name_3x(),
+          f = self.epilogue_functor_name_3x())
     else:
       threadblock = self.tile_description.procedural_name()
       return "cutlass{p}_{op}_{ex}_{tb}_{l}_align{a}".format(
@@ -550,6 +558,7 @@ class EmitGemmUniversalInstance:
       "cutlass/gemm/device/gemm.h",
       "cutlass/gemm/device/gemm_universal_adapter.h",
       "cutlass/gemm/kernel/default_gemm_universal.h",
+      "cutlass/gemm/kernel/default_gemm_universal_mixed_input_groupwise.h",
     ]
     self.builtin_epilogue_functor_template = """
     ${epilogue_functor}<
@@ -562,7 +571,7 @@ class EmitGemmUniversalInstance:
     self.gemm_template = """
 // Gemm operator ${operation_name}
 using ${operation_name}_base =
-  typename cutlass::gemm::kernel::DefaultGemmUniversal<
+  typename ${default_gemm_universal}<
     ${element_b}, ${layout_b}, ${transform_b}, ${align_b},    // transposed B operand
     ${element_a}, ${layout_a}, ${transform_a}, ${align_a},    // transposed A operand
     ${element_c}, ${layout_c},
@@ -585,7 +594,7 @@ struct ${operation_name}${operation_suffix} :
     self.gemm_template_interleaved = """
 // Gemm operator ${operation_name}
 using ${operation_name}_base =
-  typename cutlass::gemm::kernel::DefaultGemmUniversal<
+  typename ${default_gemm_universal}<
     ${element_a}, ${layout_a}, ${transform_a}, ${align_a},
     ${element_b}, ${layout_b}, ${transform_b}, ${align_b},
     ${element_c}, ${layout_c},
@@ -645,6 +654,13 @@ ${compile_guard_end}
       gemm_template = self.gemm_template_interleaved
     #
 
+    # Group-wise dequantizing mixed-input kernels carry scale arguments in their own kernel
+    if operation.tile_description.math_instruction.math_operation == \
+      MathOperation.multiply_add_mixed_input_upcast_groupwise:
+      default_gemm_universal = 'cutlass::gemm::kernel::DefaultGemmUniversalMixedInputGroupwise'
+    else:
+      default_gemm_universal = 'cutlass::gemm::kernel::DefaultGemmUniversal'
+
     # Support built-in epilogue functors or user-defined functions
     if isinstance(operation.epilogue_functor, enum.Enum):
 
@@ -664,6 +680,7 @@ ${compile_guard_end}
     values = {
       'operation_name': operation.procedural_name(),
       'operation_suffix': self.operation_suffix,
+      'default_gemm_universal': default_gemm_universal,
       'element_a': DataTypeTag[operation.A.element],
       'layout_a': LayoutTag[instance_layout_A],
       'element_b': DataTypeTag[operation.B.element],
@@ -717,6 +734,28 @@ class EmitGemmUniversal3xInstance:
       ${element_c},
       ${element_epilogue}
     >"""
+    self.bias_act_epilogue_functor_template = \
+"""${epilogue_functor}<
+      ${activation},
+      ${element_d},
+      ${element_epilogue},
+      ${element_bias},
+      ${element_c},
+      ${element_epilogue}
+    >"""
+    self.scaled_bias_act_amax_aux_epilogue_functor_template = \
+"""${epilogue_functor}<
+      ${layout_aux},
+      ${activation},
+      ${element_d},
+      ${element_epilogue},
+      ${element_aux},
+      ${element_epilogue},
+      ${element_bias},
+      ${element_c},
+      ${element_epilogue},
+      ${align_aux}
+    >"""
 
     self.gemm_template = """
 
@@ -811,6 +850,22 @@ ${compile_guard_end}
         'epilogue_functor': EpilogueFunctor3xTag[operation.epilogue_functor],
       }
       epilogue_functor = SubstituteTemplate(self.builtin_epilogue_functor_template, values)
+
+      # Fused epilogues take the bias in the output type, or in the compute type for an FP8 output.
+      # The auxiliary output has the type and layout of D.
+      if operation.epilogue_functor in EpilogueFunctor3xActivationTag:
+        element_bias = operation.element_epilogue if operation.D.element in [DataType.e4m3, DataType.e5m2] else operation.D.element
+        values.update({
+          'activation': EpilogueFunctor3xActivationTag[operation.epilogue_functor],
+          'element_bias': DataTypeTag[element_bias],
+          'element_aux': DataTypeTag[operation.D.element],
+          'layout_aux': LayoutTag[operation.D.layout],
+          'align_aux': str(128 // DataTypeSize[operation.D.element]),
+        })
+        if operation.epilogue_functor == EpilogueFunctor3x.ScaledLinCombPerRowBiasReLUAmaxAux:
+          epilogue_functor = SubstituteTemplate(self.scaled_bias_act_amax_aux_epilogue_functor_template, values)
+        else:
+          epilogue_functor = SubstituteTemplate(self.bias_act_epilogue_functor_template, values)
     else:
       epilogue_functor = self.epilogue_functor.emit_declaration()
     #
@@ -219,6 +219,11 @@ def CreateGemmUniversal3xOperator(
 
   return operations
 
+# Fused epilogue functors need an epilogue staging D through shared memory with TMA
+def get_fused_epilogue_schedules(schedules):
+  return [s for s in schedules
+          if s[1] in [EpilogueScheduleType.TmaWarpSpecialized, EpilogueScheduleType.TmaWarpSpecializedCooperative]]
+
 # Generates 3.0 API based GemmUniversal API kernels. Alignment constraints are folded in with layouts
 def CreateSparseGemmUniversal3xOperator(
     manifest, layouts, tile_descriptions, data_types,
@@ -421,6 +426,70 @@ def CreateRankKOperator(manifest, layouts, fill_modes, tile_descriptions, data_t
 
   return operations
 
+#
+def CreateRankKOperator3x(manifest, layouts, fill_modes, tile_descriptions, data_type, \
+  alignment_constraints, schedules, blas_mode = BlasMode.symmetric, \
+  epilogue_functor = EpilogueFunctor.LinearCombination):
+
+  element_a, element_c, element_epilogue = data_type
+
+  operations = []
+
+  # by default, only generate the largest tile and largest alignment
+  if manifest.kernel_filter == '':
+    tile_descriptions = [tile_descriptions[0],]
+    alignment_constraints = [alignment_constraints[0],]
+
+  for layout in layouts:
+    for fill_mode in fill_modes:
+      for tile_description in tile_descriptions:
+        for alignment in alignment_constraints:
+          for kernel_schedule in schedules:
+
+            A = TensorDescription(element_a, layout[0], alignment, ComplexTransform.none)
+            C = SymmetricTensorDescription(element_c, layout[1], fill_mode, 1)
+
+            new_operation = RankKOperation(RankKKind.Universal3x, tile_description.minimum_compute_capability, \
+              tile_description, A, C, element_epilogue, epilogue_functor, SwizzlingFunctor.Identity1, \
+              blas_mode, kernel_schedule)
+
+            manifest.append(new_operation)
+            operations.append(new_operation)
+
+  return operations
+
+#
+def CreateRank2KOperator3x(manifest, layouts, fill_modes, tile_descriptions, data_type, \
+  alignment_constraints, schedules, blas_mode = BlasMode.symmetric, \
+  epilogue_functor = EpilogueFunctor.LinearCombination):
+
+  element_a, element_c, element_epilogue = data_type
+
+  operations = []
+
+  # by default, only generate the largest tile and largest alignment
+  if manifest.kernel_filter == '':
+    tile_descriptions = [tile_descriptions[0],]
+    alignment_constraints = [alignment_constraints[0],]
+
+  for layout in layouts:
+    for fill_mode in fill_modes:
+      for tile_description in tile_descriptions:
+        for alignment in alignment_constraints:
+          for kernel_schedule in schedules:
+
+            A = TensorDescription(element_a, layout[0], alignment, ComplexTransform.none)
+            C = SymmetricTensorDescription(element_c, layout[1], fill_mode, 1)
+
+            new_operation = Rank2KOperation(RankKKind.Universal3x, tile_description.minimum_compute_capability, \
+              tile_description, A, C, element_epilogue, epilogue_functor, SwizzlingFunctor.Identity1, \
+              blas_mode, kernel_schedule)
+
+            manifest.append(new_operation)
+            operations.append(new_operation)
+
+  return operations
+
 #
 def CreateTrmmOperator(manifest, layouts, side_modes, fill_modes, diag_types, tile_descriptions, data_type, \
   alignment_constraints, complex_transforms = None, epilogue_functor = EpilogueFunctor.LinearCombination, \
@@ -461,6 +530,39 @@ def CreateTrmmOperator(manifest, layouts, side_modes, fill_modes, diag_types, ti
 
   return operations
 
+#
+def CreateTrmmOperator3x(manifest, layouts, fill_modes, diag_types, tile_descriptions, data_type, \
+  alignment_constraints, epilogue_functor = EpilogueFunctor.LinearCombination):
+
+  element_a, element_b, element_c, element_epilogue = data_type
+
+  operations = []
+
+  # by default, only generate the largest tile and largest alignment
+  if manifest.kernel_filter == '':
+    tile_descriptions = [tile_descriptions[0],]
+    alignment_constraints = [alignment_constraints[0],]
+
+  for layout in layouts:
+    for fill_mode in fill_modes:
+      for diag_type in diag_types:
+        for tile_description in tile_descriptions:
+          for alignment in alignment_constraints:
+
+            # The triangular operand is always on the left
+            A = TriangularTensorDescription(element_a, layout[0], SideMode.Left, fill_mode, diag_type,
+                                            alignment, ComplexTransform.none)
+            B = TensorDescription(element_b, layout[1], alignment)
+            C = TensorDescription(element_c, layout[2], 1)
+
+            new_operation = TrmmOperation(TrmmKind.Universal3x, tile_description.minimum_compute_capability, \
+              tile_description, A, B, C, element_epilogue, epilogue_functor, SwizzlingFunctor.Identity1)
+
+            manifest.append(new_operation)
+            operations.append(new_operation)
+
+  return operations
+
 #
 def CreateSymmOperator(manifest, layouts, side_modes, fill_modes, tile_descriptions, data_type, \
   alignment_constraints, blas_mode, epilogue_functor = EpilogueFunctor.LinearCombination, \
@@ -508,6 +610,38 @@ def CreateSymmOperator(manifest, layouts, side_modes, fill_modes, tile_descripti
 
   return operations
 
+#
+def CreateSymmOperator3x(manifest, layouts, fill_modes, tile_descriptions, data_type, \
+  alignment_constraints, epilogue_functor = EpilogueFunctor.LinearCombination):
+
+  element_a, element_b, element_c, element_epilogue = data_type
+
+  operations = []
+
+  # by default, only generate the largest tile and largest alignment
+  if manifest.kernel_filter == '':
+    tile_descriptions = [tile_descriptions[0],]
+    alignment_constraints = [alignment_constraints[0],]
+
+  for layout in layouts:
+    for fill_mode in fill_modes:
+      for tile_description in tile_descriptions:
+        for alignment in alignment_constraints:
+
+          # The symmetric operand is always on the left, B shares its layout
+          A = SymmetricTensorDescription(element_a, layout[0], fill_mode, alignment, ComplexTransform.none, SideMode.Left)
+          B = TensorDescription(element_b, layout[0], alignment)
+          C = TensorDescription(element_c, layout[1], 1)
+
+          new_operation = SymmOperation(SymmKind.Universal3x, tile_description.minimum_compute_capability, \
+            tile_description, A, B, C, element_epilogue, epilogue_functor, SwizzlingFunctor.Identity1, \
+            BlasMode.symmetric)
+
+          manifest.append(new_operation)
+          operations.append(new_operation)
+
+  return operations
+
 ###########################################################################################################
 #   ConvolutionOperator support variations
 #        ____________________________________________________________________
@@ -676,6 +810,41 @@ def CreateConv2dFixedChannelsOperator(manifest, layout, tile_descriptions, data_
 
   return operations
 
+# Winograd F(4x4, 3x3) fprop for 3x3 unit-stride filters. The Winograd-domain products accumulate
+# in F32, so only tensor core math instructions with F32 accumulation are instantiated.
+def CreateConv2dWinogradOperator(manifest, layout, tile_descriptions, data_type, alignment_constraints, \
+  epilogue_functor = EpilogueFunctor.LinearCombination):
+
+  element_a, element_b, element_c, element_epilogue = data_type
+
+  # by default, only generate the largest tile size and largest alignment
+  if manifest.kernel_filter == '':
+    tile_descriptions = [tile_descriptions[0],]
+    alignment_constraints = [alignment_constraints[0],]
+
+  operations = []
+
+  for tile in tile_descriptions:
+    if tile.math_instruction.opcode_class != OpcodeClass.TensorOp or \
+      tile.math_instruction.element_accumulator != DataType.f32:
+      continue
+
+    for alignment in alignment_constraints:
+
+      alignment_c = min(8, alignment)
+
+      A = TensorDescription(element_a, layout[0], alignment)
+      B = TensorDescription(element_b, layout[1], alignment)
+      C = TensorDescription(element_c, layout[2], alignment_c)
+
+      new_operation = Conv2dOperation(ConvKind.Fprop, IteratorAlgorithm.Winograd, tile.minimum_compute_capability, tile,\
+        A, B, C, element_epilogue, StrideSupport.Unity, epilogue_functor)
+
+      manifest.append(new_operation)
+      operations.append(new_operation)
+
+  return operations
+
 # Convolution for 2D operations specialized for few channels
 def CreateConv2dFewChannelsOperator(manifest, layout, tile_descriptions, data_type, channel_counts, \
   conv_kinds = [ConvKind.Fprop, ConvKind.Dgrad, ConvKind.Wgrad], \
@@ -874,6 +1043,7 @@ class ConvOperation3x:
                kernel_schedule: KernelScheduleType = KernelScheduleType.ScheduleAuto,
                epilogue_schedule: EpilogueScheduleType = EpilogueScheduleType.ScheduleAuto,
                tile_scheduler: TileSchedulerType = TileSchedulerType.Default,
+               epilogue_functor: EpilogueFunctor3x = EpilogueFunctor3x.LinearCombination,
                log_indent_level: int = 1):
     log_debug_line(f'ConvOperation3x::init: conv_kind: {conv_kind}', log_indent_level)
     log_indent_level = log_indent_level + 1
@@ -889,6 +1059,7 @@ class ConvOperation3x:
 
     self.arch = tile_description.minimum_compute_capability
     self.tile_scheduler = tile_scheduler
+    self.epilogue_functor = epilogue_functor
     if D == None:
       self.D = C
     else:
@@ -1027,8 +1198,9 @@ class ConvOperation3x:
     tile_scheduler = TileSchedulerSuffixes[self.tile_scheduler]
     kernel_schedule = KernelScheduleSuffixes[self.kernel_schedule]
     epilogue_schedule = EpilogueScheduleSuffixes[self.epilogue_schedule]
+    epilogue_functor = EpilogueFunctor3xSuffixes[self.epilogue_functor]
 
-    return f"{prefix}_sm{arch}_{opcode_class_name}_{self.extended_name()}_{tbm}x{tbn}x{tbk}_{cm}x{cn}x{ck}_{self.tile_description.stages}_align{alignment}{tile_scheduler}{kernel_schedule}{epilogue_schedule}"
+    return f"{prefix}_sm{arch}_{opcode_class_name}_{self.extended_name()}_{tbm}x{tbn}x{tbk}_{cm}x{cn}x{ck}_{self.tile_description.stages}_align{alignment}{tile_scheduler}{kernel_schedule}{epilogue_schedule}{epilogue_functor}"
 
   def procedural_name(self):
     return self.configuration_name()
@@ -1050,6 +1222,7 @@ def CreateConvOperator3x(manifest: Manifest,
                          complex_transforms: Optional[Sequence[ComplexTransform]] = None,
                          tile_schedulers: Sequence[TileSchedulerType] = [TileSchedulerType.Default],
                          conv_kind: ConvKind = ConvKind.Fprop,
+                         epilogue_functor: EpilogueFunctor3x = EpilogueFunctor3x.LinearCombination,
                          log_indent_level: int = 1):
   """
   Create zero or more CUTLASS 3 two-dimensional convolution operators.
@@ -1096,6 +1269,9 @@ def CreateConvOperator3x(manifest: Manifest,
   schedule_pairs: [(kernel_schedule, epilogue_schedule), ...]
 
   conv_kind: Convolution kind (Fprop, Dgrad, or Wgrad).
+
+  epilogue_functor: Epilogue fusion of the operators, e.g. PerColLinCombPerColBias
+    for per-output-channel dequantization of 8-bit convolutions.
   """
   log_debug_line('CreateConvOperator3x', log_indent_level)
   log_indent_level = log_indent_level + 1
@@ -1203,6 +1379,7 @@ def CreateConvOperator3x(manifest: Manifest,
                                 kernel_schedule=kernel_schedule,
                                 epilogue_schedule=epilogue_schedule,
                                 tile_scheduler=tile_scheduler,
+                                epilogue_functor=epilogue_functor,
                                 log_indent_level=log_indent_level)
     log_debug_line(f'Created ConvOperation3x: {str(operation)}', log_indent_level)
     manifest.append(operation)
@@ -2438,6 +2615,7 @@ def GenerateSM80_TensorOp_16816(manifest, cuda_version):
     conv_layout = (LayoutType.TensorNHWC, LayoutType.TensorNHWC, LayoutType.TensorNHWC)
     CreateConv2dOperator(manifest, conv_layout, tile_descriptions, data_type, alignment_constraints)
     CreateConv2dFixedChannelsOperator(manifest, conv_layout, tile_descriptions, data_type, [4, 8])
+    CreateConv2dWinogradOperator(manifest, conv_layout, tile_descriptions, data_type, alignment_constraints)
     CreateConv3dOperator(manifest, LayoutType.TensorNDHWC, tile_descriptions, data_type, 8)
 
     # Avoid emitting two kernels if the accumulator type does not differ from the input type (e.g. F16 accumulation)
@@ -2455,6 +2633,7 @@ def GenerateSM80_TensorOp_16816(manifest, cuda_version):
 
       CreateConv2dOperator(manifest, conv_layout, tile_descriptions, data_type_mixed, alignment_constraints)
       CreateConv2dFixedChannelsOperator(manifest, conv_layout, tile_descriptions, data_type_mixed, [4, 8])
+      CreateConv2dWinogradOperator(manifest, conv_layout, tile_descriptions, data_type_mixed, alignment_constraints)
       CreateConv3dOperator(manifest, LayoutType.TensorNDHWC, tile_descriptions, data_type_mixed, 8)
 #
 
@@ -2811,6 +2990,129 @@ def GenerateSM80_TensorOp_16816_mixed_input_upcast_b(manifest, cuda_version):
       if op.tile_description.threadblock_shape[1] <= 32:
         op.C.alignment = 4
 
+#
+def GenerateSM80_TensorOp_16816_mixed_input_groupwise_b(manifest, cuda_version):
+
+  if not CudaToolkitVersionSatisfies(cuda_version, 11, 0):
+    return
+
+  layouts = [
+    (LayoutType.RowMajor, LayoutType.ColumnMajor, LayoutType.ColumnMajor),
+  ]
+
+  # The 8-bit B operand is upcasted to the 16-bit A type and dequantized in registers with
+  # scales and zero-points shared by groups of K (e.g. 128) per column of B
+  math_instructions = [
+    MathInstruction(                                  \
+      [16, 8, 16],                                    \
+      DataType.f16, DataType.s8, DataType.f32,        \
+      OpcodeClass.TensorOp,                           \
+      MathOperation.multiply_add_mixed_input_upcast_groupwise),
+    MathInstruction(                                  \
+      [16, 8, 16],                                    \
+      DataType.f16, DataType.u8, DataType.f32,        \
+      OpcodeClass.TensorOp,                           \
+      MathOperation.multiply_add_mixed_input_upcast_groupwise),
+    MathInstruction(                                  \
+      [16, 8, 16],                                    \
+      DataType.bf16, DataType.s8, DataType.f32,       \
+      OpcodeClass.TensorOp,                           \
+      MathOperation.multiply_add_mixed_input_upcast_groupwise),
+    MathInstruction(                                  \
+      [16, 8, 16],                                    \
+      DataType.bf16, DataType.u8, DataType.f32,       \
+      OpcodeClass.TensorOp,                           \
+      MathOperation.multiply_add_mixed_input_upcast_groupwise),
+  ]
+
+  min_cc = 80
+  max_cc = 1024
+
+  # [[alignA, alignB, alignC],..]
+  alignment_constraints = [[8, 16, 8],]
+
+  for math_inst in math_instructions:
+    # Multistage mainloops only: the dequantizing warp-level operator is set up by the kernel
+    # through the multistage mainloop
+    tile_descriptions = [
+      TileDescription([128, 128, 64],  4, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 128, 64],  3, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 64, 64],  4, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 32, 64],  5, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 16, 64],  5, [2, 1, 1], math_inst, min_cc, max_cc),
+      TileDescription([256, 16, 32],  5, [2, 1, 1], math_inst, min_cc, max_cc),
+    ]
+
+    data_type_mixed = [
+      math_inst.element_a,
+      math_inst.element_b,
+      math_inst.element_a,
+      math_inst.element_accumulator,
+    ]
+
+    operations = CreateGemmOperator(manifest, layouts, tile_descriptions, \
+      data_type_mixed, alignment_constraints, None, EpilogueFunctor.LinearCombination, SwizzlingFunctor.Identity8)
+
+    for op in operations:
+      if op.tile_description.threadblock_shape[1] <= 32:
+        op.C.alignment = 4
+
+#
+def GenerateSM80_TensorOp_16816_mixed_input_fp8_b(manifest, cuda_version):
+
+  if not CudaToolkitVersionSatisfies(cuda_version, 11, 8):
+    return
+
+  layouts = [
+    (LayoutType.RowMajor, LayoutType.ColumnMajor, LayoutType.ColumnMajor),
+  ]
+
+  # FP8 weights (B) are upcasted in registers to the 16-bit activation type (A), since SM80 has
+  # no FP8 tensor cores. The groupwise variant applies per-channel scales of B in the mainloop,
+  # with a single group spanning K.
+  math_instructions = []
+  for element_a in [DataType.f16, DataType.bf16]:
+    for element_b in [DataType.e4m3, DataType.e5m2]:
+      for math_op in [MathOperation.multiply_add_mixed_input_upcast, MathOperation.multiply_add_mixed_input_upcast_groupwise]:
+        math_instructions.append(
+          MathInstruction(                                  \
+            [16, 8, 16],                                    \
+            element_a, element_b, DataType.f32,             \
+            OpcodeClass.TensorOp,                           \
+            math_op))
+
+  min_cc = 80
+  max_cc = 1024
+
+  # [[alignA, alignB, alignC],..]
+  alignment_constraints = [[8, 16, 8],]
+
+  for math_inst in math_instructions:
+    # Multistage mainloops only, as the dequantizing warp-level operator of the groupwise
+    # variant is set up by the kernel through the multistage mainloop
+    tile_descriptions = [
+      TileDescription([128, 128, 64],  4, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 128, 64],  3, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 64, 64],  4, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 32, 64],  5, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 16, 64],  5, [2, 1, 1], math_inst, min_cc, max_cc),
+      TileDescription([256, 16, 32],  5, [2, 1, 1], math_inst, min_cc, max_cc),
+    ]
+
+    data_type_mixed = [
+      math_inst.element_a,
+      math_inst.element_b,
+      math_inst.element_a,
+      math_inst.element_accumulator,
+    ]
+
+    operations = CreateGemmOperator(manifest, layouts, tile_descriptions, \
+      data_type_mixed, alignment_constraints, None, EpilogueFunctor.LinearCombination, SwizzlingFunctor.Identity8)
+
+    for op in operations:
+      if op.tile_description.threadblock_shape[1] <= 32:
+        op.C.alignment = 4
+
 #
 def GenerateSM80_TensorOp_16832_TN(manifest, cuda_version):
 
@@ -4910,6 +5212,8 @@ def GenerateSM80(manifest, cuda_version):
   GenerateSM80_TensorOp_884_symm_complex_gaussian(manifest, cuda_version)
   GenerateSM80_TensorOp_16816_mixed_input_upcast_a(manifest, cuda_version)
   GenerateSM80_TensorOp_16816_mixed_input_upcast_b(manifest, cuda_version)
+  GenerateSM80_TensorOp_16816_mixed_input_groupwise_b(manifest, cuda_version)
+  GenerateSM80_TensorOp_16816_mixed_input_fp8_b(manifest, cuda_version)
   GenerateSM80_TensorOp_16832_TN(manifest, cuda_version)
   GenerateSM80_TensorOp_16832_TN_mixed_input_upcast_a(manifest, cuda_version)
   GenerateSM80_TensorOp_16832_TN_mixed_input_upcast_b(manifest, cuda_version)
@@ -5045,6 +5349,23 @@ def GenerateSM89_TensorOp_16832_fp8(manifest, cuda_version):
         DataType.bf16,
         math_inst.element_accumulator
       ],
+      [
+        math_inst.element_a,
+        math_inst.element_b,
+        DataType.f16,
+        math_inst.element_accumulator
+      ],
+    ]
+
+    # Grouped kernels see many small per-expert problems, so lead with tiles
+    # that keep enough CTAs resident rather than the largest dense tile.
+    grouped_tile_descriptions = [
+      TileDescription([128, 128,  64],  4, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([ 64, 128,  64],  4, [1, 4, 1], math_inst, min_cc, max_cc),
+      TileDescription([128,  64,  64],  4, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([ 64,  64, 128],  5, [2, 2, 1], math_inst, min_cc, max_cc),
+      TileDescription([128, 256,  64],  3, [2, 4, 1], math_inst, min_cc, max_cc),
+      TileDescription([256, 128,  64],  3, [4, 2, 1], math_inst, min_cc, max_cc),
     ]
 
     operations = []
@@ -5052,6 +5373,14 @@ def GenerateSM89_TensorOp_16832_fp8(manifest, cuda_version):
       operations += CreateGemmOperator(manifest, layouts, tile_descriptions, data_type,
         alignment_constraints, None, EpilogueFunctor.LinearCombination)
 
+      operations += CreateGemmGroupedOperator(manifest, layouts, grouped_tile_descriptions, data_type,
+        alignment_constraints, None, EpilogueFunctor.LinearCombination)
+
+      # FP16 output is only needed by the GEMM and grouped GEMM kernels; emitting it for conv
+      # as well would add another third of the conv kernels to every SM89 library build.
+      if data_type[2] == DataType.f16:
+        continue
+
       conv_layout = (LayoutType.TensorNHWC, LayoutType.TensorNHWC, LayoutType.TensorNHWC)
       operations += CreateConv2dOperator(manifest, conv_layout, tile_descriptions,
         data_type, alignment_constraints, [ConvKind.Fprop], EpilogueFunctor.LinearCombination)
@@ -5263,6 +5592,13 @@ def GenerateSM90_TensorOp_16b_WGMMA_gemm(manifest, cuda_version):
                                               stream_k_schedules,
                                               tile_schedulers=[TileSchedulerType.StreamK])
 
+            # Bias + activation fusions for kernels reading C and writing D in the A/B format
+            fused_schedules = get_fused_epilogue_schedules(schedules)
+            if len(fused_schedules) and data_type["c_type"] != DataType.void and data_type["d_type"] == math_inst.element_a:
+              for epilogue_functor in [EpilogueFunctor3x.LinCombPerRowBiasReLU, EpilogueFunctor3x.LinCombPerRowBiasGELU]:
+                CreateGemmUniversal3xOperator(manifest, [layout], [tile_desc], data_type, fused_schedules,
+                                              epilogue_functor=epilogue_functor)
+
 
 def GenerateSM90_TensorOp_16b_WGMMA_alignx_gemm(manifest, cuda_version):
   if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
@@ -5784,6 +6120,22 @@ def GenerateSM90_TensorOp_fp8_WGMMA_gemm(manifest, cuda_version):
                                               stream_k_schedules,
                                               tile_schedulers=[TileSchedulerType.StreamK])
 
+            # Scaled bias + activation fusions with amax and an auxiliary output, for FP8 outputs of a 16b source
+            if data_type["d_type"] in fp8_types and data_type["c_type"] in [DataType.f16, DataType.bf16]:
+              fused_layout = fix_alignments(data_type, layout, alignment_bits=128)
+              fused_schedules, _ = get_valid_schedules(
+                tile_description=tile_desc,
+                cuda_version=cuda_version,
+                is_aligned=is_aligned,
+                data_types=data_type,
+                instantiation_level=instantiation_level,
+                layout=fused_layout,
+              )
+              fused_schedules = get_fused_epilogue_schedules(fused_schedules)
+              if len(fused_schedules):
+                CreateGemmUniversal3xOperator(manifest, [fused_layout], [tile_desc], data_type, fused_schedules,
+                                              epilogue_functor=EpilogueFunctor3x.ScaledLinCombPerRowBiasReLUAmaxAux)
+
 
 def GenerateSM90_TensorOp_fp8_WGMMA_alignx_gemm(manifest, cuda_version):
   if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
@@ -5843,6 +6195,62 @@ def GenerateSM90_TensorOp_fp8_WGMMA_alignx_gemm(manifest, cuda_version):
                                               tile_schedulers=[TileSchedulerType.StreamK])
 
 
+# Skinny FP8 GEMMs for small-batch decode (16 or fewer tokens). These are meant to be run with swapped
+# operands (D^T = W^T @ X^T), so that the weights run over the GMMA M extent and the tokens over a
+# CTA tile N of 16. The stream-K variants split K when there are too few output tiles to fill the device.
+def GenerateSM90_TensorOp_fp8_WGMMA_skinny_gemm(manifest, cuda_version):
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 1):
+    return
+
+  # Tiles with N = 16 are already emitted by GenerateSM90_TensorOp_fp8_WGMMA_gemm once its
+  # instantiation level includes the 64x16x32 WGMMA shape.
+  fp8_instantiation_level = manifest.get_sm90_instantiation_level(pruned_level=20, default_level=121, exhaustive_level=9992)
+  if any(tuple(math_inst.instruction_shape) == (64, 16, 32)
+         for math_inst in generate_fp8_math_instructions_sm90(fp8_instantiation_level)):
+    return
+
+  # layouts for ABC and their alignments
+  layouts = [
+    [[LayoutType.RowMajor, 16], [LayoutType.ColumnMajor, 16], [LayoutType.ColumnMajor, 1]],  # TN Layout
+  ]
+
+  math_inst = MathInstruction(
+    [64, 16, 32],
+    DataType.e4m3, DataType.e4m3, DataType.f32,
+    OpcodeClass.TensorOp,
+    MathOperation.multiply_add)
+
+  min_cc = 90
+  max_cc = 90
+
+  tile_and_schedules = [
+    # 128x16 tiles: both math warp groups share one weight tile
+    (TileDescription([128, 16, 128], 0, [4, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+     [KernelScheduleType.TmaWarpSpecializedCooperativeFP8FastAccum, EpilogueScheduleType.TmaWarpSpecializedCooperative]),
+    (TileDescription([128, 16, 256], 0, [4, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+     [KernelScheduleType.TmaWarpSpecializedCooperativeFP8FastAccum, EpilogueScheduleType.TmaWarpSpecializedCooperative]),
+    # 64x16 tiles: twice the output tiles for narrow weight matrices
+    (TileDescription([64, 16, 128], 0, [4, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+     [KernelScheduleType.TmaWarpSpecializedPingpongFP8FastAccum, EpilogueScheduleType.TmaWarpSpecialized]),
+  ]
+
+  data_types = []
+  for d_type in [DataType.f16, DataType.bf16, DataType.f32]:
+    for c_type in [DataType.void, d_type]:
+      data_types.append(
+        generate_data_types_from_math_instruction(
+          math_inst,
+          element_source=c_type,
+          element_dest=d_type,
+        )
+      )
+
+  for tile_desc, schedule in tile_and_schedules:
+    for layout in layouts:
+      CreateGemmUniversal3xOperator(manifest, [layout], [tile_desc], data_types, [schedule],
+                                    tile_schedulers=[TileSchedulerType.Default, TileSchedulerType.StreamK])
+
+
 def GenerateSM90_SparseTensorOp_fp8_WGMMA_gemm(manifest, cuda_version):
   if not CudaToolkitVersionSatisfies(cuda_version, 12, 2):
     return
@@ -6104,6 +6512,67 @@ def GenerateSM90_TensorOp_1684_rank_k(manifest, cuda_version):
     data_type, alignment_constraints, BlasMode.symmetric)
 #
 
+#
+def GenerateSM90_TensorOp_tf32_WGMMA_rank_k(manifest, cuda_version):
+
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
+    return
+
+  # TF32 WGMMA reads both operands K-major, so A must be row-major: the
+  # mainloop's B operand is the same buffer viewed as A^T.
+  layouts = [
+    (LayoutType.RowMajor, LayoutType.ColumnMajor),
+  ]
+
+  fill_modes = [
+    FillMode.Lower, FillMode.Upper,
+  ]
+
+  math_inst =                                             \
+    MathInstruction(                                      \
+      [64, 128, 8],                                       \
+      DataType.tf32, DataType.tf32, DataType.f32,         \
+      OpcodeClass.TensorOp,                               \
+      MathOperation.multiply_add)
+
+  min_cc = 90
+  max_cc = 90
+
+  alignment_constraints = [4,]
+
+  # The triangular scheduler requires square tiles and a 1x1x1 cluster
+  tile_descriptions = [
+    TileDescription([128, 128, 32], 0, [2, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+  ]
+
+  data_type = [DataType.f32, DataType.f32, DataType.f32]
+
+  CreateRankKOperator3x(manifest, layouts, fill_modes, tile_descriptions, \
+    data_type, alignment_constraints, [KernelScheduleType.TmaWarpSpecializedCooperative])
+
+  tile_descriptions = [
+    TileDescription([64, 64, 32], 0, [1, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+  ]
+
+  CreateRankKOperator3x(manifest, layouts, fill_modes, tile_descriptions, \
+    data_type, alignment_constraints, [KernelScheduleType.TmaWarpSpecializedPingpong])
+
+  # SYR2K: B shares the row-major layout of A
+  tile_descriptions = [
+    TileDescription([128, 128, 32], 0, [2, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+  ]
+
+  CreateRank2KOperator3x(manifest, layouts, fill_modes, tile_descriptions, \
+    data_type, alignment_constraints, [KernelScheduleType.TmaWarpSpecializedCooperative])
+
+  tile_descriptions = [
+    TileDescription([64, 64, 32], 0, [1, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+  ]
+
+  CreateRank2KOperator3x(manifest, layouts, fill_modes, tile_descriptions, \
+    data_type, alignment_constraints, [KernelScheduleType.TmaWarpSpecializedPingpong])
+#
+
 #
 def GenerateSM90_TensorOp_1684_rank_k_complex(manifest, cuda_version):
 
@@ -6356,6 +6825,56 @@ def GenerateSM90_TensorOp_1684_trmm_complex_gaussian(manifest, cuda_version):
     data_type, alignment_constraints, complex_transforms)
 #
 
+#
+def GenerateSM90_TensorOp_16b_WGMMA_trmm(manifest, cuda_version):
+
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
+    return
+
+  layouts = [
+    (LayoutType.ColumnMajor, LayoutType.ColumnMajor, LayoutType.ColumnMajor),
+    (LayoutType.RowMajor, LayoutType.ColumnMajor, LayoutType.ColumnMajor),
+  ]
+
+  fill_modes = [
+    FillMode.Lower, FillMode.Upper,
+  ]
+
+  diag_types = [
+    DiagType.NonUnit, DiagType.Unit,
+  ]
+
+  math_instructions = [
+    MathInstruction(
+      [64, 128, 16],
+      DataType.f16, DataType.f16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+    MathInstruction(
+      [64, 128, 16],
+      DataType.bf16, DataType.bf16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+  ]
+
+  min_cc = 90
+  max_cc = 90
+
+  alignment_constraints = [8,]
+
+  for math_inst in math_instructions:
+    # The triangular-A mainloop is cooperative and requires a cluster of size 1 along M
+    tile_descriptions = [
+      TileDescription([128, 128, 64], 0, [2, 1, 1], math_inst, min_cc, max_cc, [1, 2, 1]),
+      TileDescription([128, 128, 64], 0, [2, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+    ]
+
+    data_type = [math_inst.element_a, math_inst.element_b, DataType.f32, DataType.f32]
+
+    CreateTrmmOperator3x(manifest, layouts, fill_modes, diag_types, tile_descriptions, \
+      data_type, alignment_constraints)
+#
+
 #
 def GenerateSM90_TensorOp_1684_symm(manifest, cuda_version):
 
@@ -6508,6 +7027,53 @@ def GenerateSM90_TensorOp_1684_symm_complex_gaussian(manifest, cuda_version):
     data_type, alignment_constraints, BlasMode.hermitian)
 #
 
+#
+def GenerateSM90_TensorOp_16b_WGMMA_symm(manifest, cuda_version):
+
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
+    return
+
+  # The mirrored triangle reads A through the transposed layout, so both layouts of A must be
+  # valid for an smem-sourced GMMA: only 16b inputs, tf32 requires a K-major A.
+  layouts = [
+    (LayoutType.ColumnMajor, LayoutType.ColumnMajor),
+  ]
+
+  fill_modes = [
+    FillMode.Lower, FillMode.Upper,
+  ]
+
+  math_instructions = [
+    MathInstruction(
+      [64, 128, 16],
+      DataType.f16, DataType.f16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+    MathInstruction(
+      [64, 128, 16],
+      DataType.bf16, DataType.bf16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+  ]
+
+  min_cc = 90
+  max_cc = 90
+
+  alignment_constraints = [8,]
+
+  for math_inst in math_instructions:
+    # The triangular-A mainloop is cooperative and requires a cluster of size 1 along M
+    tile_descriptions = [
+      TileDescription([128, 128, 64], 0, [2, 1, 1], math_inst, min_cc, max_cc, [1, 2, 1]),
+      TileDescription([128, 128, 64], 0, [2, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+    ]
+
+    data_type = [math_inst.element_a, math_inst.element_b, DataType.f32, DataType.f32]
+
+    CreateSymmOperator3x(manifest, layouts, fill_modes, tile_descriptions, \
+      data_type, alignment_constraints)
+#
+
 
 ###################################################################################################
 
@@ -6875,6 +7441,122 @@ def GenerateSM90_Conv3x(manifest, cuda_version,
                          conv_kind = conv_kind,
                          log_indent_level = log_indent_level)
 
+  # Dgrad and especially wgrad often have few output tiles and a long
+  # implicit GEMM K mode (N*Z*P*Q for wgrad), which leaves most SMs idle
+  # with the data-parallel schedule above.  These kernels run on the
+  # persistent cooperative kernel with the stream-K tile scheduler, which
+  # splits the K mode across CTAs.  Split-K is selected at run time through
+  # the scheduler's `splits` and `decomposition_mode` arguments.
+  # The cooperative kernel requires TILE_M >= 128.
+  streamk_schedule_pairs = (
+    (KernelScheduleType.ImplicitTmaWarpSpecializedSm90Cooperative,
+     EpilogueScheduleType.TmaWarpSpecializedCooperative),
+  )
+  streamk_tile_schedulers = (
+    TileSchedulerType.StreamK,
+  )
+  streamk_combinations_of_parameters = product(
+    (
+      ConvKind.Dgrad,
+      ConvKind.Wgrad,
+    ),
+    spatial_dims,
+    (
+      fp16_fp32_fp16_fp32,
+      fp16_fp32_fp32_fp32,
+    ),
+    (
+      (128, 128, 16),
+      (128, 256, 16),
+    ),
+    cluster_shapes
+  )
+
+  for (conv_kind, spatial_dim, data_types, mma_shape, cluster_shape) in streamk_combinations_of_parameters:
+    math_inst = make_math_instruction(data_types, mma_shape)
+    tile_shape = (mma_shape[0], mma_shape[1], num_mma_per_tile * mma_shape[2])
+    tile_description = TileDescription(tile_shape, stages, warp_count, math_inst,
+      minimum_compute_capability, maximum_compute_capability, cluster_shape)
+    dims_and_alignments = (
+      (
+        (spatial_dim, tma_byte_alignments['A']),
+        (spatial_dim, tma_byte_alignments['B']),
+        (spatial_dim, tma_byte_alignments['C']),
+      ),
+    )
+    CreateConvOperator3x(manifest,
+                         dims_and_alignments = dims_and_alignments,
+                         tile_descriptions = [tile_description],
+                         data_types = data_types,
+                         schedule_pairs = streamk_schedule_pairs,
+                         tile_schedulers = streamk_tile_schedulers,
+                         conv_kind = conv_kind,
+                         log_indent_level = log_indent_level)
+
+  # Quantized fprop: int8 and e4m3 activations and filters with a
+  # 16-bit output, dequantized in the epilogue with per-output-channel
+  # alpha (the product of the activation and filter scales) and bias.
+  # 8-bit GMMA requires K-major operands, which only fprop has.
+  # Unlike the dictionaries above, the MMA accumulates in 'acc_type'
+  # while C and D are 16-bit.
+  e4m3 = DataType.e4m3
+  s8_s32_f16_f32_dequant = {
+    'a_type':     s8,
+    'b_type':     s8,
+    'c_type':   fp16,
+    'd_type':   fp16,
+    'acc_type':  s32,
+    'epi_type': fp32,
+  }
+  e4m3_f32_f16_f32_dequant = {
+    'a_type':   e4m3,
+    'b_type':   e4m3,
+    'c_type':   fp16,
+    'd_type':   fp16,
+    'acc_type': fp32,
+    'epi_type': fp32,
+  }
+  dequant_combinations_of_parameters = product(
+    spatial_dims,
+    (
+      s8_s32_f16_f32_dequant,
+      e4m3_f32_f16_f32_dequant,
+    ),
+    (
+      ( 64, 128, 32),
+      (128, 128, 32),
+      (128, 256, 32),
+    ),
+    cluster_shapes
+  )
+
+  for (spatial_dim, data_types, mma_shape, cluster_shape) in dequant_combinations_of_parameters:
+    math_inst = MathInstruction(
+      mma_shape,
+      data_types['a_type'], data_types['b_type'], data_types['acc_type'],
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add
+    )
+    tile_shape = (mma_shape[0], mma_shape[1], num_mma_per_tile * mma_shape[2])
+    tile_description = TileDescription(tile_shape, stages, warp_count, math_inst,
+      minimum_compute_capability, maximum_compute_capability, cluster_shape)
+    dims_and_alignments = (
+      (
+        (spatial_dim, tma_byte_alignments['A']),
+        (spatial_dim, tma_byte_alignments['B']),
+        (spatial_dim, tma_byte_alignments['C']),
+      ),
+    )
+    CreateConvOperator3x(manifest,
+                         dims_and_alignments = dims_and_alignments,
+                         tile_descriptions = [tile_description],
+                         data_types = data_types,
+                         schedule_pairs = schedule_pairs,
+                         tile_schedulers = tile_schedulers,
+                         conv_kind = ConvKind.Fprop,
+                         epilogue_functor = EpilogueFunctor3x.PerColLinCombPerColBias,
+                         log_indent_level = log_indent_level)
+
 def GenerateSM90(manifest, cuda_version):
   GenerateSM90_TensorOp_16b_WGMMA_gemm(manifest, cuda_version)
   GenerateSM90_TensorOp_16b_WGMMA_alignx_gemm(manifest, cuda_version)
@@ -6884,18 +7566,22 @@ def GenerateSM90(manifest, cuda_version):
   GenerateSM90_TensorOp_int8_WGMMA_alignx_gemm(manifest, cuda_version)
   GenerateSM90_TensorOp_fp8_WGMMA_gemm(manifest, cuda_version)
   GenerateSM90_TensorOp_fp8_WGMMA_alignx_gemm(manifest, cuda_version)
+  GenerateSM90_TensorOp_fp8_WGMMA_skinny_gemm(manifest, cuda_version)
   GenerateSM90_TensorOp_1684(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_complex(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_complex_gaussian(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_rank_k(manifest, cuda_version)
+  GenerateSM90_TensorOp_tf32_WGMMA_rank_k(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_rank_k_complex(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_rank_k_complex_gaussian(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_trmm(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_trmm_complex(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_trmm_complex_gaussian(manifest, cuda_version)
+  GenerateSM90_TensorOp_16b_WGMMA_trmm(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_symm(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_symm_complex(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_symm_complex_gaussian(manifest, cuda_version)
+  GenerateSM90_TensorOp_16b_WGMMA_symm(manifest, cuda_version)
   GenerateSM90_Conv3x(manifest, cuda_version)
   GenerateSM90_SparseTensorOp_16b_WGMMA_gemm(manifest, cuda_version)
   GenerateSM90_SparseTensorOp_tf32_WGMMA_gemm(manifest, cuda_version)
@@ -6945,6 +7631,15 @@ def define_parser():
   parser.add_argument("--filter-by-cc", default='True', type=str, help='If enabled, kernels whose compute capability range is not satisfied by the build target are excluded.')
   parser.add_argument("--cuda-version", default="11.0.0", help="Semantic version string of CUDA Toolkit")
   parser.add_argument('--kernel-filter-file',   type=str, default=None, required=False, help='Full path of filter file')
+  parser.add_argument('--tuning-logs', type=str, default='', required=False,
+                      help='Comma-delimited list of cutlass_profiler CSV reports. If given, only the fewest kernels ' +
+                      'within --tuning-tolerance of the fastest kernel for every profiled problem are generated.')
+  parser.add_argument('--tuning-tolerance', type=float, default=5.0, required=False,
+                      help='Percentage by which a selected kernel may be slower than the fastest profiled kernel for a problem')
+  parser.add_argument('--tuning-budget', type=int, default=0, required=False,
+                      help='Maximum number of kernels selected from the tuning logs (0 is unlimited)')
+  parser.add_argument('--tuning-shapes', type=str, default=None, required=False,
+                      help='File listing one MxNxK problem shape per line. If given, only these problems in the tuning logs are considered.')
   parser.add_argument('--selected-kernel-list',   type=str, default=None, required=False,
                         help='Specify the output log file containing all enabled kernels in this build')
   parser.add_argument("--interface-dir", default=None, required=False, help="Interface header to kernels")
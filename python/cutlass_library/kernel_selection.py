@@ -0,0 +1,213 @@
+#################################################################################################
+#
+# Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Utilities for selecting a compact set of CUTLASS library kernels from profiler results
+
+Each problem profiled by cutlass_profiler is satisfied by any kernel whose runtime is within a
+tolerance of the fastest kernel for that problem. The selection is the smallest set of kernels
+that satisfies every problem, found greedily: the kernel satisfying the most unsatisfied problems
+is taken first, with ties broken by the lowest total runtime relative to the fastest kernels.
+"""
+
+import csv
+import logging
+import os.path
+
+_LOGGER = logging.getLogger(__name__)
+
+# Columns of the profiler CSV report preceding the problem and kernel arguments
+_LEADING_COLUMNS = ['Problem', 'Provider', 'OperationKind', 'Operation', 'Disposition', 'Status']
+
+# First column of the profiler CSV report following the problem and kernel arguments
+_TRAILING_COLUMN = 'Bytes'
+
+# Arguments that describe the kernel or how it is launched rather than the problem
+_KERNEL_COLUMNS = set([
+  'op_class', 'accum',
+  'cta_m', 'cta_n', 'cta_k',
+  'cluster_m', 'cluster_n', 'cluster_k',
+  'cluster_m_fallback', 'cluster_n_fallback', 'cluster_k_fallback',
+  'stages', 'warps_m', 'warps_n', 'warps_k',
+  'inst_m', 'inst_n', 'inst_k',
+  'min_cc', 'max_cc',
+  'raster_order', 'swizzle_size',
+])
+
+# Dispositions of results whose runtimes can be trusted
+_VALID_DISPOSITIONS = set(['passed', 'not_verified', 'not_run'])
+
+###################################################################################################
+
+class ProfiledProblem:
+  """Runtimes of the kernels profiled on one problem"""
+
+  def __init__(self, key):
+    self.key = key
+    self.runtimes = {}
+
+  def add(self, kernel, runtime):
+    if kernel not in self.runtimes or runtime < self.runtimes[kernel]:
+      self.runtimes[kernel] = runtime
+
+  def best_runtime(self):
+    return min(self.runtimes.values())
+
+###################################################################################################
+
+def _parse_shape(token):
+  """Parses a problem shape of the form MxNxK, "M,N,K" or "M N K" into a tuple of strings"""
+  return tuple(token.replace('x', ' ').replace(',', ' ').split())
+
+def load_shapes(path):
+  """Reads one problem shape per line. Text after '#' is ignored."""
+  shapes = set()
+  with open(path, 'r') as shape_file:
+    for line in shape_file:
+      line = line.split('#')[0].strip()
+      if line:
+        shapes.add(_parse_shape(line))
+  return shapes
+
+def _problem_shape(row):
+  return tuple(row.get(mode, '') for mode in ('m', 'n', 'k'))
+
+def load_profiler_results(paths, shapes = None):
+  """
+  Reads CUTLASS results from profiler CSV reports (--output). Returns a list of ProfiledProblem.
+
+  Problems are identified by their operation kind and problem arguments, so results for the same
+  problem may be spread across several reports. If `shapes` is given, only problems whose
+  (m, n, k) extents are listed are kept.
+  """
+  problems = {}
+
+  for path in paths:
+    if not os.path.isfile(path):
+      raise RuntimeError("Tuning log '{}' does not exist".format(path))
+
+    with open(path, 'r', newline='') as log_file:
+      reader = csv.reader(log_file)
+      header = next(reader, None)
+
+      if header is None or 'Operation' not in header or _TRAILING_COLUMN not in header or 'Runtime' not in header:
+        raise RuntimeError("Tuning log '{}' is not a cutlass_profiler CSV report".format(path))
+
+      first = header.index('Status') + 1
+      last = header.index(_TRAILING_COLUMN)
+      problem_columns = [i for i in range(first, last) if header[i] not in _KERNEL_COLUMNS]
+
+      # Pivot tags precede the leading columns and are treated as part of the problem
+      problem_columns = list(range(header.index('Problem'))) + problem_columns
+
+      for values in reader:
+        if len(values) != len(header):
+          continue
+
+        row = dict(zip(header, values))
+
+        if row['Provider'].lower() != 'cutlass' or row['Disposition'] not in _VALID_DISPOSITIONS:
+          continue
+
+        try:
+          runtime = float(row['Runtime'])
+        except ValueError:
+          continue
+
+        if runtime <= 0:
+          continue
+
+        if shapes is not None and _problem_shape(row) not in shapes:
+          continue
+
+        key = (row['OperationKind'],) + tuple((header[i], values[i]) for i in problem_columns)
+
+        if key not in problems:
+          problems[key] = ProfiledProblem(key)
+        problems[key].add(row['Operation'], runtime)
+
+  return list(problems.values())
+
+###################################################################################################
+
+def select_kernels(problems, tolerance = 0.05, budget = 0):
+  """
+  Greedily selects kernels so that every problem has a selected kernel within `tolerance` (a
+  fraction) of its fastest profiled kernel. At most `budget` kernels are selected if `budget` is
+  positive, in which case some problems may be left without a kernel within the tolerance.
+
+  Returns the selected kernel names in the order they were selected.
+  """
+  # Kernels within the tolerance of each problem and their runtime relative to the fastest kernel
+  candidates = {}
+  for index, problem in enumerate(problems):
+    best = problem.best_runtime()
+    for kernel, runtime in problem.runtimes.items():
+      if runtime <= best * (1.0 + tolerance):
+        candidates.setdefault(kernel, {})[index] = runtime / best
+
+  unsatisfied = set(range(len(problems)))
+  selected = []
+
+  while unsatisfied and (budget <= 0 or len(selected) < budget):
+
+    def score(kernel):
+      covered = [index for index in candidates[kernel] if index in unsatisfied]
+      return (len(covered), -sum(candidates[kernel][index] for index in covered), kernel)
+
+    kernel = max(candidates.keys(), key = score)
+    covered = set(candidates[kernel].keys()) & unsatisfied
+
+    if not covered:
+      break
+
+    selected.append(kernel)
+    unsatisfied -= covered
+    del candidates[kernel]
+
+  if unsatisfied:
+    _LOGGER.warning("Kernel budget of {} leaves {} of {} profiled problems without a kernel within {:.1f}% of the fastest".format(
+      budget, len(unsatisfied), len(problems), tolerance * 100.0))
+
+  return selected
+
+def selection_slowdown(problems, selected):
+  """Returns the worst ratio of the fastest selected kernel to the fastest profiled kernel"""
+  selected = set(selected)
+  worst = 1.0
+  for problem in problems:
+    runtimes = [runtime for kernel, runtime in problem.runtimes.items() if kernel in selected]
+    if runtimes:
+      worst = max(worst, min(runtimes) / problem.best_runtime())
+  return worst
+
+###################################################################################################
@@ -0,0 +1,620 @@
+#################################################################################################
+#
+# Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Analytic design-space exploration of SM90 GEMM mainloop configurations
+
+Candidate configurations are enumerated from the tile shapes, cluster shapes, kernel schedules and
+GMMA shared memory layout atoms that the SM90 CollectiveBuilder accepts for a data type and layout
+combination. Each candidate is evaluated without compiling anything:
+
+  - the shared memory footprint per stage, the epilogue carveout and the resulting stage count
+    follow the CollectiveBuilder's StageCountAutoCarveout and EpilogueTileAuto rules,
+  - the registers held per consumer thread are estimated from the accumulator and, for RS
+    mainloops, operand A fragments,
+  - shared memory bank conflicts are measured by applying a copy atom's access pattern to the
+    swizzled shared memory layouts, which are built and evaluated with pycute,
+  - a roofline-style model of one output tile (tensor core, global memory and shared memory
+    throughput, plus the latency left exposed by the pipeline depth) gives the estimated
+    throughput used for ranking.
+
+The highest ranked candidates are printed as CollectiveBuilder declarations and as kernel name
+patterns for CUTLASS_LIBRARY_KERNELS, so that only a short list needs to be compiled and profiled.
+
+Example:
+
+  python -m cutlass_library.layout_search --element-a f16 --element-b f16 --element-accumulator f32 \
+      --layout-a t --layout-b n --problem 4096x4096x4096 --top 8
+"""
+
+import argparse
+import functools
+import logging
+import math
+
+import pycute
+
+try:
+  import builtins
+  if hasattr(builtins, "CUTLASS_IGNORE_PACKAGE") and CUTLASS_IGNORE_PACKAGE == True:
+    raise ImportError("Disabling attempt to import cutlass_library")
+  from cutlass_library.library import *
+except ImportError:
+  from library import *
+
+_LOGGER = logging.getLogger(__name__)
+
+###################################################################################################
+
+class DeviceModel:
+  """
+  Per-SM throughputs and capacities used by the analytic model. Defaults describe H100 SXM.
+  """
+
+  def __init__(self,
+               sm_count = 132,
+               smem_capacity_bytes = 232448,
+               gmem_bytes_per_clock = 16,
+               smem_bytes_per_clock = 128,
+               gmem_latency_clocks = 800,
+               mma_flops_per_clock = {8: 8192, 16: 4096, 32: 2048}):
+    self.sm_count = sm_count
+    self.smem_capacity_bytes = smem_capacity_bytes
+    self.gmem_bytes_per_clock = gmem_bytes_per_clock
+    self.smem_bytes_per_clock = smem_bytes_per_clock
+    self.gmem_latency_clocks = gmem_latency_clocks
+    self.mma_flops_per_clock = mma_flops_per_clock
+
+  def mma_rate(self, element_bits):
+    """Dense tensor core FLOP per clock per SM for GMMA operands of `element_bits`"""
+    return self.mma_flops_per_clock[min(max(element_bits, 8), 32)]
+
+###################################################################################################
+
+class CopyAtom:
+  """
+  Shared memory access pattern of a copy instruction. Each thread moves `vector_bits` contiguous
+  bits, and one shared memory phase is formed by `phase_cols` vectors along the contiguous mode
+  of the layout and `phase_rows` rows along its strided mode.
+  """
+
+  def __init__(self, name, vector_bits, phase_cols, phase_rows):
+    self.name = name
+    self.vector_bits = vector_bits
+    self.phase_cols = phase_cols
+    self.phase_rows = phase_rows
+
+  def ideal_wavefronts(self):
+    """Wavefronts of a phase without bank conflicts"""
+    return max(1, self.phase_cols * self.phase_rows * self.vector_bits // (8 * 128))
+
+  def __str__(self):
+    return self.name
+
+#
+CopyAtoms = {
+  # ldmatrix / stmatrix: each 8x8 matrix is one phase of eight 16B rows
+  'ldmatrix': CopyAtom('ldmatrix', 128, 1, 8),
+  'stmatrix': CopyAtom('stmatrix', 128, 1, 8),
+  # Stores of GMMA accumulator fragments: four threads per row of a warp's 8-row slab
+  'sts16_acc': CopyAtom('sts16_acc', 16, 4, 8),
+  'sts32_acc': CopyAtom('sts32_acc', 32, 4, 8),
+  'sts64_acc': CopyAtom('sts64_acc', 64, 4, 4),
+  # Fully vectorized row-contiguous accesses
+  'sts128': CopyAtom('sts128', 128, 8, 1),
+  'lds128': CopyAtom('lds128', 128, 8, 1),
+}
+
+def epilogue_copy_atom(element_d_bits):
+  """Copy atom storing accumulators to the epilogue's shared memory, as chosen by the SM90 epilogue builder"""
+  return CopyAtoms[{8: 'sts16_acc', 16: 'stmatrix', 32: 'sts64_acc'}.get(element_d_bits, 'sts128')]
+
+###################################################################################################
+
+class SmemLayoutAtom:
+  """
+  GMMA shared memory layout atom: 8 rows of `width_bytes` contiguous bytes whose 16B chunks are
+  XOR-swizzled with the row index, i.e. Swizzle<B,4,3> on byte addresses (cute's
+  Layout_{K,MN}_{INTER,SW32,SW64,SW128}_Atom).
+  """
+
+  def __init__(self, name, swizzle_bits):
+    self.name = name
+    self.swizzle_bits = swizzle_bits
+    self.width_bytes = 16 << swizzle_bits
+
+  def width(self, element_bits):
+    """Elements along the contiguous mode of the atom"""
+    return self.width_bytes * 8 // element_bits
+
+  def swizzle(self, element_bits):
+    """Swizzle functor acting on element offsets"""
+    return pycute.Swizzle(self.swizzle_bits, int(math.log2(128 // element_bits)), 3)
+
+  def cute_type(self, major, element):
+    return "cute::GMMA::Layout_{}_{}_Atom<{}>".format(major, self.name, DataTypeTag[element])
+
+  def __str__(self):
+    return self.name
+
+# Ordered from the widest swizzle, which the CollectiveBuilder prefers
+SmemLayoutAtoms = [
+  SmemLayoutAtom('SW128', 3),
+  SmemLayoutAtom('SW64', 2),
+  SmemLayoutAtom('SW32', 1),
+  SmemLayoutAtom('INTER', 0),
+]
+
+def legal_smem_layout_atoms(contiguous, strided, element_bits):
+  """Layout atoms that tile a (strided, contiguous) shared memory tile"""
+  if strided % 8 != 0:
+    return []
+  return [atom for atom in SmemLayoutAtoms if contiguous % atom.width(element_bits) == 0]
+
+def builder_smem_layout_atom(contiguous, strided, element_bits, major, rmem):
+  """The layout atom chosen by the CollectiveBuilder's ss_smem_selector or rs_smem_selector"""
+  atoms = legal_smem_layout_atoms(contiguous, strided, element_bits)
+  if rmem and major == 'MN' and element_bits % 32 == 0:
+    # Whole-word types in RS mainloops fall into SW32, which is free of bank conflicts
+    atoms = [atom for atom in atoms if atom.name in ('SW32', 'INTER')]
+  return atoms[0] if atoms else None
+
+def make_smem_layout(atom, element_bits, rows, cols):
+  """
+  Tiles `atom` over a (rows, cols) tile with cols contiguous, in the column-major atom order of
+  cute::tile_to_shape, and returns the swizzled pycute layout mapping (row, col) to an element offset
+  """
+  width = atom.width(element_bits)
+  layout = pycute.Layout(((8, rows // 8), (width, cols // width)),
+                         ((width, 8 * width), (1, rows * width)))
+  return pycute.ComposedLayout(atom.swizzle(element_bits), 0, layout)
+
+@functools.lru_cache(maxsize = None)
+def bank_conflicts(atom_name, element_bits, rows, cols, copy_atom_name):
+  """
+  Average number of shared memory wavefronts per phase, relative to a conflict-free access, when
+  `copy_atom_name` sweeps a (rows, cols) tile laid out with `atom_name`. 1.0 is conflict free.
+  """
+  atom = next(atom for atom in SmemLayoutAtoms if atom.name == atom_name)
+  copy_atom = CopyAtoms[copy_atom_name]
+  if copy_atom.vector_bits < element_bits:
+    raise ValueError("Copy atom {} moves fewer bits than one {}-bit element".format(copy_atom, element_bits))
+
+  layout = make_smem_layout(atom, element_bits, rows, cols)
+  vector = copy_atom.vector_bits // element_bits
+  vector_bytes = copy_atom.vector_bits // 8
+
+  wavefronts = 0
+  phases = 0
+  for row0 in range(0, rows, copy_atom.phase_rows):
+    for col0 in range(0, cols, copy_atom.phase_cols * vector):
+      words_per_bank = {}
+      for r in range(copy_atom.phase_rows):
+        for c in range(copy_atom.phase_cols):
+          row, col = row0 + r, col0 + c * vector
+          if row >= rows or col >= cols:
+            continue
+          address = layout(row, col) * element_bits // 8
+          for word in range(address // 4, (address + vector_bytes - 1) // 4 + 1):
+            words_per_bank.setdefault(word % 32, set()).add(word)
+      wavefronts += max(len(words) for words in words_per_bank.values())
+      phases += 1
+
+  return wavefronts / (phases * copy_atom.ideal_wavefronts())
+
+###################################################################################################
+
+class SearchProblem:
+  """Data types, layouts and optional problem size of the GEMM to configure"""
+
+  def __init__(self, element_a, element_b, element_accumulator, element_c, element_d,
+               layout_a, layout_b, layout_d = LayoutType.RowMajor, problem_size = None,
+               operand_copy_atom = None, epilogue_copy_atom = None):
+    self.element_a = element_a
+    self.element_b = element_b
+    self.element_accumulator = element_accumulator
+    self.element_c = element_c
+    self.element_d = element_d
+    self.layout_a = layout_a
+    self.layout_b = layout_b
+    self.layout_d = layout_d
+    self.problem_size = problem_size
+    self.operand_copy_atom = operand_copy_atom
+    self.epilogue_copy_atom = epilogue_copy_atom
+
+  def bits(self, element):
+    return DataTypeSize[element]
+
+  def major_a(self):
+    return 'K' if self.layout_a == LayoutType.RowMajor else 'MN'
+
+  def major_b(self):
+    return 'K' if self.layout_b == LayoutType.ColumnMajor else 'MN'
+
+  def uses_rmem_a(self):
+    """Mirrors the CollectiveBuilder's is_use_rmem_A: whether the mainloop sources A from registers (RS)"""
+    bits_a, bits_b = self.bits(self.element_a), self.bits(self.element_b)
+    two_byte_inputs = bits_a == 16 and bits_b == 16
+    k_major = self.major_a() == 'K' and self.major_b() == 'K'
+    return (not two_byte_inputs and not k_major) or bits_a != bits_b
+
+#
+class Schedule:
+  """SM90 kernel schedule with its consumer warp group count and register budget"""
+
+  def __init__(self, kernel_schedule, epilogue_schedule, consumer_warp_groups, consumer_register_cap,
+               tile_m_multiple, overlaps_epilogue):
+    self.kernel_schedule = kernel_schedule
+    self.epilogue_schedule = epilogue_schedule
+    self.consumer_warp_groups = consumer_warp_groups
+    self.consumer_register_cap = consumer_register_cap
+    self.tile_m_multiple = tile_m_multiple
+    self.overlaps_epilogue = overlaps_epilogue
+
+Schedules = [
+  Schedule(KernelScheduleType.TmaWarpSpecialized, EpilogueScheduleType.TmaWarpSpecialized, 1, 255, 64, False),
+  Schedule(KernelScheduleType.TmaWarpSpecializedPingpong, EpilogueScheduleType.TmaWarpSpecialized, 1, 232, 64, True),
+  Schedule(KernelScheduleType.TmaWarpSpecializedCooperative, EpilogueScheduleType.TmaWarpSpecializedCooperative, 2, 232, 128, False),
+]
+
+# Registers per consumer thread assumed for addressing, pipeline state and epilogue fragments
+_REGISTER_OVERHEAD = 40
+
+# Bytes of one stage's pipeline barriers (PipelineTmaAsync::SharedStorage)
+_PIPELINE_BYTES_PER_STAGE = 16
+
+# K-mode tiles of the mainloop assumed when no problem size is given
+_DEFAULT_K_TILES = 64
+
+###################################################################################################
+
+class Candidate:
+  """One evaluated mainloop configuration"""
+
+  def __init__(self, problem, tile_shape, cluster_shape, schedule, atom_a, atom_b):
+    self.problem = problem
+    self.tile_shape = tile_shape
+    self.cluster_shape = cluster_shape
+    self.schedule = schedule
+    self.atom_a = atom_a
+    self.atom_b = atom_b
+    self.builder_layouts = True
+    self.stages = 0
+    self.smem_bytes = 0
+    self.registers = 0
+    self.conflicts_a = 1.0
+    self.conflicts_b = 1.0
+    self.conflicts_d = 1.0
+    self.flops_per_clock = 0.0
+
+  def configuration_name(self):
+    m, n, k = self.tile_shape
+    return "{}x{}x{}_{}x{}x1_{}{}".format(m, n, k, self.cluster_shape[0], self.cluster_shape[1], self.stages,
+                                         KernelScheduleSuffixes[self.schedule.kernel_schedule])
+
+  def kernel_pattern(self):
+    """Kernel name pattern for CUTLASS_LIBRARY_KERNELS matching the generator's procedural names"""
+    m, n, k = self.tile_shape
+    return "cutlass3x_sm90_tensorop_*gemm_*{}_{}_{}_{}x{}x{}_{}x{}x1_*{}{}".format(
+      DataTypeNames[self.problem.element_a], DataTypeNames[self.problem.element_b],
+      DataTypeNames[self.problem.element_accumulator], m, n, k,
+      self.cluster_shape[0], self.cluster_shape[1],
+      KernelScheduleSuffixes[self.schedule.kernel_schedule],
+      EpilogueScheduleSuffixes[self.schedule.epilogue_schedule])
+
+  def __str__(self):
+    return "{:<44} stages={:<2} smem={:>6}B regs={:>3} conflicts(A,B,D)=({:.2f},{:.2f},{:.2f}) smem(A,B)=({},{}) {:>7.0f} FLOP/clk/SM".format(
+      self.configuration_name(), self.stages, self.smem_bytes, self.registers,
+      self.conflicts_a, self.conflicts_b, self.conflicts_d, self.atom_a, self.atom_b,
+      self.flops_per_clock)
+
+#
+def _epilogue_smem_bytes(problem, tile_shape, schedule):
+  """Shared memory of the TMA epilogue with EpilogueTileAuto, following sm90_get_tma_dispatch_policy"""
+  m, n, _ = tile_shape
+  bits_c = problem.bits(problem.element_c) if problem.element_c != DataType.void else 0
+  bits_d = problem.bits(problem.element_d)
+  if schedule.consumer_warp_groups == 2:
+    epi_m, epi_n = min(128, m), min(32, n)
+  else:
+    epi_m, epi_n = min(64, m), min(64 if bits_d == 8 else 32, n)
+  epi_tiles = (m // epi_m) * (n // epi_n)
+  stages_d = min(epi_tiles, 2)
+  reuse_smem = bits_c == bits_d and bits_d > 8
+  stages_c = max(min(epi_tiles, 4), stages_d + 1) if reuse_smem else min(epi_tiles, 4)
+  bytes_c = stages_c * epi_m * epi_n * bits_c // 8
+  bytes_d = 0 if reuse_smem else stages_d * epi_m * epi_n * bits_d // 8
+  return bytes_c + bytes_d, (epi_m, epi_n)
+
+def _round_up(value, multiple):
+  return (value + multiple - 1) // multiple * multiple
+
+def evaluate(candidate, device):
+  """
+  Fills in the analytic estimates of `candidate`. Returns False if the candidate cannot be built
+  (fewer than two stages) or would exceed its register budget.
+  """
+  problem = candidate.problem
+  m, n, k = candidate.tile_shape
+  cm, cn = candidate.cluster_shape
+  schedule = candidate.schedule
+  bits_a, bits_b = problem.bits(problem.element_a), problem.bits(problem.element_b)
+  bits_acc = problem.bits(problem.element_accumulator)
+  bits_d = problem.bits(problem.element_d)
+  rmem_a = problem.uses_rmem_a()
+
+  # Stage count from StageCountAutoCarveout
+  epilogue_bytes, epilogue_tile = _epilogue_smem_bytes(problem, candidate.tile_shape, schedule)
+  if m % epilogue_tile[0] != 0 or n % epilogue_tile[1] != 0:
+    return False
+  stage_bytes = _round_up((m * k * bits_a + n * k * bits_b) // 8, 128) + _PIPELINE_BYTES_PER_STAGE
+  capacity = device.smem_capacity_bytes // 128 * 128
+  candidate.stages = (capacity - _round_up(epilogue_bytes, 128)) // stage_bytes
+  if candidate.stages < 2:
+    return False
+  candidate.smem_bytes = candidate.stages * stage_bytes + epilogue_bytes
+
+  # Registers of one consumer thread: accumulators of its warp group's share of the tile, plus a
+  # double-buffered k-block of A for RS mainloops
+  threads = 128 * schedule.consumer_warp_groups
+  candidate.registers = m * n * bits_acc // 32 // threads + _REGISTER_OVERHEAD
+  if rmem_a:
+    mma_k = 256 // bits_a
+    candidate.registers += 2 * (m // schedule.consumer_warp_groups) * mma_k * bits_a // 32 // 128
+  if candidate.registers > schedule.consumer_register_cap:
+    return False
+
+  # Bank conflicts of the shared memory accessed by threads. GMMA reads SS operands through
+  # descriptors and TMA writes them, so operands only conflict when a copy atom reads them.
+  def operand_conflicts(atom, major, mn, bits, copy_atom):
+    if copy_atom is None:
+      return 1.0
+    rows, cols = (mn, k) if major == 'K' else (k, mn)
+    return bank_conflicts(atom.name, bits, rows, cols, copy_atom)
+
+  copy_atom_a = problem.operand_copy_atom or ('ldmatrix' if rmem_a else None)
+  candidate.conflicts_a = operand_conflicts(candidate.atom_a, problem.major_a(), m, bits_a, copy_atom_a)
+  candidate.conflicts_b = operand_conflicts(candidate.atom_b, problem.major_b(), n, bits_b, problem.operand_copy_atom)
+
+  epi_m, epi_n = epilogue_tile
+  rows_d, cols_d = (epi_m, epi_n) if problem.layout_d == LayoutType.RowMajor else (epi_n, epi_m)
+  atom_d = builder_smem_layout_atom(cols_d, rows_d, bits_d, 'K', False)
+  copy_atom_d = problem.epilogue_copy_atom or epilogue_copy_atom(bits_d).name
+  candidate.conflicts_d = bank_conflicts(atom_d.name, bits_d, rows_d, cols_d, copy_atom_d) if atom_d else 1.0
+
+  # Clocks of one K-mode tile: the slowest of the tensor cores, global memory (with TMA multicast of
+  # A across the cluster's N mode and of B across its M mode) and thread-level shared memory
+  # traffic, or the memory latency left exposed by a pipeline of `stages` tiles
+  flops = 2 * m * n * k
+  mma_clocks = flops / device.mma_rate(max(bits_a, bits_b))
+  gmem_bytes = m * k * bits_a / 8 / cn + n * k * bits_b / 8 / cm
+  gmem_clocks = gmem_bytes / device.gmem_bytes_per_clock
+  smem_clocks = 0.0
+  if copy_atom_a is not None:
+    smem_clocks += m * k * bits_a / 8 / device.smem_bytes_per_clock * candidate.conflicts_a
+  if problem.operand_copy_atom is not None:
+    smem_clocks += n * k * bits_b / 8 / device.smem_bytes_per_clock * candidate.conflicts_b
+  k_tile_clocks = max(mma_clocks, gmem_clocks, smem_clocks,
+                      device.gmem_latency_clocks / (candidate.stages - 1))
+
+  # Clocks of the epilogue: staging through shared memory and storing D (and loading C)
+  bits_c = problem.bits(problem.element_c) if problem.element_c != DataType.void else 0
+  epilogue_clocks = (m * n * bits_d / 8 / device.smem_bytes_per_clock * candidate.conflicts_d +
+                     m * n * (bits_c + bits_d) / 8 / device.gmem_bytes_per_clock)
+
+  if problem.problem_size is not None:
+    pm, pn, pk = problem.problem_size
+    k_tiles = (pk + k - 1) // k
+    tiles_m = _round_up((pm + m - 1) // m, cm)
+    tiles_n = _round_up((pn + n - 1) // n, cn)
+    waves = (tiles_m * tiles_n + device.sm_count - 1) // device.sm_count
+    useful_flops = 2 * pm * pn * pk / device.sm_count
+  else:
+    k_tiles = _DEFAULT_K_TILES
+    waves = 1
+    useful_flops = flops * k_tiles
+
+  tile_clocks = k_tiles * k_tile_clocks
+  if not (schedule.overlaps_epilogue and waves > 1):
+    tile_clocks += epilogue_clocks
+  candidate.flops_per_clock = useful_flops / (waves * tile_clocks)
+  return True
+
+###################################################################################################
+
+def enumerate_candidates(problem, device = DeviceModel(), custom_layouts = False,
+                         cluster_shapes = ((1, 1), (2, 1), (1, 2), (2, 2))):
+  """
+  Enumerates and evaluates the legal SM90 configurations for `problem`. Only the shared memory
+  layout atoms chosen by the CollectiveBuilder are considered unless `custom_layouts` is set, in
+  which case every legal atom is evaluated; the others require a hand-written CollectiveMma.
+  """
+  bits_a, bits_b = problem.bits(problem.element_a), problem.bits(problem.element_b)
+  bits = max(bits_a, bits_b)
+  rmem_a = problem.uses_rmem_a()
+
+  tile_ms = [64, 128, 192, 256]
+  tile_ns = list(range(16, 257, 16))
+  # A GMMA k-block spans 32 bytes; tiles hold one to eight of them
+  tile_ks = [k for k in (16, 32, 64, 128, 256) if k * bits // 8 >= 32 and k * bits // 8 <= 256]
+
+  candidates = []
+  for schedule in Schedules:
+    for m in tile_ms:
+      if m % schedule.tile_m_multiple != 0:
+        continue
+      for n in tile_ns:
+        for k in tile_ks:
+          contiguous_a, strided_a = (k, m) if problem.major_a() == 'K' else (m, k)
+          contiguous_b, strided_b = (k, n) if problem.major_b() == 'K' else (n, k)
+          builder_a = builder_smem_layout_atom(contiguous_a, strided_a, bits_a, problem.major_a(), rmem_a)
+          builder_b = builder_smem_layout_atom(contiguous_b, strided_b, bits_b, problem.major_b(), False)
+          if builder_a is None or builder_b is None:
+            continue
+
+          if custom_layouts:
+            atoms_a = legal_smem_layout_atoms(contiguous_a, strided_a, bits_a)
+            atoms_b = legal_smem_layout_atoms(contiguous_b, strided_b, bits_b)
+          else:
+            atoms_a, atoms_b = [builder_a], [builder_b]
+
+          for cluster_shape in cluster_shapes:
+            for atom_a in atoms_a:
+              for atom_b in atoms_b:
+                candidate = Candidate(problem, (m, n, k), cluster_shape, schedule, atom_a, atom_b)
+                candidate.builder_layouts = atom_a is builder_a and atom_b is builder_b
+                if evaluate(candidate, device):
+                  candidates.append(candidate)
+
+  _LOGGER.info("Evaluated {} legal configurations".format(len(candidates)))
+  return candidates
+
+def rank_candidates(candidates, top = 10):
+  """Returns the `top` candidates by estimated throughput, preferring smaller tiles on ties"""
+  key = lambda c: (-round(c.flops_per_clock), c.tile_shape[0] * c.tile_shape[1], c.configuration_name())
+  return sorted(candidates, key = key)[:top]
+
+###################################################################################################
+
+def emit_collective_builder(candidate):
+  """Emits the CollectiveBuilder declarations of `candidate`"""
+  problem = candidate.problem
+  m, n, k = candidate.tile_shape
+  bits_a, bits_b = problem.bits(problem.element_a), problem.bits(problem.element_b)
+  bits_c = problem.bits(problem.element_c) if problem.element_c != DataType.void else problem.bits(problem.element_d)
+  bits_d = problem.bits(problem.element_d)
+
+  lines = ["// {}".format(candidate)]
+  if not candidate.builder_layouts:
+    lines.append("// Requires a custom CollectiveMma: SmemLayoutAtomA = {}, SmemLayoutAtomB = {}".format(
+      candidate.atom_a.cute_type(problem.major_a(), problem.element_a),
+      candidate.atom_b.cute_type(problem.major_b(), problem.element_b)))
+
+  values = {
+    'tile': "cute::Shape<cute::_{}, cute::_{}, cute::_{}>".format(m, n, k),
+    'cluster': "cute::Shape<cute::_{}, cute::_{}, cute::_1>".format(*candidate.cluster_shape),
+    'element_a': DataTypeTag[problem.element_a],
+    'element_b': DataTypeTag[problem.element_b],
+    'element_c': DataTypeTag[problem.element_c],
+    'element_d': DataTypeTag[problem.element_d],
+    'element_accumulator': DataTypeTag[problem.element_accumulator],
+    'layout_a': LayoutTag[problem.layout_a],
+    'layout_b': LayoutTag[problem.layout_b],
+    'layout_d': LayoutTag[problem.layout_d],
+    'align_a': str(128 // bits_a),
+    'align_b': str(128 // bits_b),
+    'align_c': str(128 // bits_c),
+    'align_d': str(128 // bits_d),
+    'stages': str(candidate.stages),
+    'kernel_schedule': KernelScheduleTag[candidate.schedule.kernel_schedule],
+    'epilogue_schedule': EpilogueScheduleTag[candidate.schedule.epilogue_schedule],
+  }
+
+  lines.append(SubstituteTemplate("""using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    ${tile}, ${cluster},
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ${element_accumulator}, ${element_accumulator},
+    ${element_c}, ${layout_d}, ${align_c},
+    ${element_d}, ${layout_d}, ${align_d},
+    ${epilogue_schedule}
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    ${element_a}, ${layout_a}, ${align_a},
+    ${element_b}, ${layout_b}, ${align_b},
+    ${element_accumulator},
+    ${tile}, ${cluster},
+    cutlass::gemm::collective::StageCount<${stages}>,
+    ${kernel_schedule}
+  >::CollectiveOp;""", values))
+  return "\n".join(lines)
+
+###################################################################################################
+
+def _parse_enum(enum_type, names, value):
+  for key, name in names.items():
+    if name == value:
+      return key
+  raise argparse.ArgumentTypeError("Unknown {} '{}'".format(enum_type.__name__, value))
+
+def _parse_layout(value):
+  return {'t': LayoutType.RowMajor, 'n': LayoutType.ColumnMajor}[value]
+
+def main(args = None):
+  parser = argparse.ArgumentParser(description = "Ranks SM90 GEMM mainloop configurations analytically.")
+  parser.add_argument("--element-a", default = "f16", help = "Data type of A, e.g. f16, bf16, e4m3, tf32")
+  parser.add_argument("--element-b", default = "f16", help = "Data type of B")
+  parser.add_argument("--element-accumulator", default = "f32", help = "Data type of the accumulator")
+  parser.add_argument("--element-c", default = None, help = "Data type of C (defaults to D; 'void' for no source)")
+  parser.add_argument("--element-d", default = None, help = "Data type of D (defaults to A)")
+  parser.add_argument("--layout-a", default = "t", choices = ['t', 'n'], help = "t: row-major (K-major) A, n: column-major")
+  parser.add_argument("--layout-b", default = "n", choices = ['t', 'n'], help = "n: column-major (K-major) B, t: row-major")
+  parser.add_argument("--layout-d", default = "t", choices = ['t', 'n'], help = "Layout of C and D")
+  parser.add_argument("--problem", default = None, help = "MxNxK problem size used for wave quantization")
+  parser.add_argument("--operand-copy-atom", default = None, choices = list(CopyAtoms.keys()),
+                      help = "Copy atom reading both operands from shared memory (RS mainloops read A with ldmatrix by default)")
+  parser.add_argument("--epilogue-copy-atom", default = None, choices = list(CopyAtoms.keys()),
+                      help = "Copy atom writing accumulators to the epilogue's shared memory")
+  parser.add_argument("--custom-layouts", action = "store_true",
+                      help = "Also evaluate shared memory layout atoms the CollectiveBuilder would not choose")
+  parser.add_argument("--sm-count", type = int, default = 132, help = "Number of SMs")
+  parser.add_argument("--top", type = int, default = 10, help = "Number of configurations to emit")
+  options = parser.parse_args(args)
+
+  element = lambda value: _parse_enum(DataType, DataTypeNames, value)
+  element_a = element(options.element_a)
+  element_d = element(options.element_d) if options.element_d else element_a
+  element_c = element(options.element_c) if options.element_c else element_d
+  problem_size = tuple(int(x) for x in options.problem.split('x')) if options.problem else None
+
+  problem = SearchProblem(
+    element_a, element(options.element_b), element(options.element_accumulator), element_c, element_d,
+    _parse_layout(options.layout_a), _parse_layout(options.layout_b), _parse_layout(options.layout_d),
+    problem_size, options.operand_copy_atom, options.epilogue_copy_atom)
+
+  candidates = enumerate_candidates(problem, DeviceModel(sm_count = options.sm_count), options.custom_layouts)
+  shortlist = rank_candidates(candidates, options.top)
+
+  for candidate in shortlist:
+    print(emit_collective_builder(candidate))
+    print()
+
+  patterns = list(dict.fromkeys(candidate.kernel_pattern() for candidate in shortlist))
+  print("// CUTLASS_LIBRARY_KERNELS=" + ",".join(patterns))
+  return shortlist
+
+###################################################################################################
+
+if __name__ == "__main__":
+  main()
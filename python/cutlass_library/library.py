@@ -312,6 +312,7 @@ class MathOperation(enum.Enum):
   multiply_add = enum_auto()
   multiply_add_saturate = enum_auto()
   multiply_add_mixed_input_upcast = enum_auto()
+  multiply_add_mixed_input_upcast_groupwise = enum_auto()
   xor_popc = enum_auto()
   and_popc = enum_auto()
   multiply_add_fast_bf16 = enum_auto()
@@ -327,6 +328,7 @@ MathOperationTag = {
   MathOperation.multiply_add: 'cutlass::arch::OpMultiplyAdd',
   MathOperation.multiply_add_saturate: 'cutlass::arch::OpMultiplyAddSaturate',
   MathOperation.multiply_add_mixed_input_upcast: 'cutlass::arch::OpMultiplyAddMixedInputUpcast',
+  MathOperation.multiply_add_mixed_input_upcast_groupwise: 'cutlass::arch::OpMultiplyAddMixedInputUpcastGroupwise',
   MathOperation.xor_popc: 'cutlass::arch::OpXorPopc',
   MathOperation.and_popc: 'cutlass::arch::OpAndPopc',
   MathOperation.multiply_add_fast_bf16: 'cutlass::arch::OpMultiplyAddFastBF16',
@@ -447,6 +449,9 @@ class KernelScheduleType(enum.Enum):
   TmaWarpSpecializedCooperativeFP8FastAccum = enum_auto()
   TmaWarpSpecializedPingpongFP8FastAccum = enum_auto()
   ImplicitTmaWarpSpecializedSm90 = enum_auto()
+  ImplicitTmaWarpSpecializedSm90Cooperative = enum_auto()
+  PtrArrayTmaWarpSpecializedCooperative = enum_auto()
+  PtrArrayTmaWarpSpecializedPingpong = enum_auto()
 #
 KernelScheduleTag = {
   KernelScheduleType.ScheduleAuto: 'cutlass::gemm::collective::KernelScheduleAuto',
@@ -462,6 +467,9 @@ KernelScheduleTag = {
   KernelScheduleType.TmaWarpSpecializedCooperativeFP8FastAccum: 'cutlass::gemm::KernelTmaWarpSpecializedCooperativeFP8FastAccum',
   KernelScheduleType.TmaWarpSpecializedPingpongFP8FastAccum: 'cutlass::gemm::KernelTmaWarpSpecializedPingpongFP8FastAccum',
   KernelScheduleType.ImplicitTmaWarpSpecializedSm90: 'cutlass::conv::KernelImplicitTmaWarpSpecializedSm90',
+  KernelScheduleType.ImplicitTmaWarpSpecializedSm90Cooperative: 'cutlass::conv::KernelImplicitTmaWarpSpecializedSm90Cooperative',
+  KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative',
+  KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpong',
 }
 
 #
@@ -479,6 +487,9 @@ KernelScheduleSuffixes = {
   KernelScheduleType.TmaWarpSpecializedCooperativeFP8FastAccum: '_warpspecialized_cooperative_fp8_fastaccum',
   KernelScheduleType.TmaWarpSpecializedPingpongFP8FastAccum: '_warpspecialized_pingpong_fp8_fastaccum',
   KernelScheduleType.ImplicitTmaWarpSpecializedSm90: '_warpspecialized',
+  KernelScheduleType.ImplicitTmaWarpSpecializedSm90Cooperative: '_warpspecialized_cooperative',
+  KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative: '_ptr_array_warpspecialized_cooperative',
+  KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong: '_ptr_array_warpspecialized_pingpong',
 }
 
 class EpilogueScheduleType(enum.Enum):
@@ -487,6 +498,8 @@ class EpilogueScheduleType(enum.Enum):
   NoSmemWarpSpecialized = enum_auto()
   TmaWarpSpecialized = enum_auto()
   TmaWarpSpecializedCooperative = enum_auto()
+  PtrArrayTmaWarpSpecializedCooperative = enum_auto()
+  PtrArrayTmaWarpSpecializedPingpong = enum_auto()
 #
 EpilogueScheduleTag = {
   EpilogueScheduleType.ScheduleAuto: 'cutlass::epilogue::collective::EpilogueScheduleAuto',
@@ -494,6 +507,8 @@ EpilogueScheduleTag = {
   EpilogueScheduleType.NoSmemWarpSpecialized: 'cutlass::epilogue::NoSmemWarpSpecialized',
   EpilogueScheduleType.TmaWarpSpecialized: 'cutlass::epilogue::TmaWarpSpecialized',
   EpilogueScheduleType.TmaWarpSpecializedCooperative: 'cutlass::epilogue::TmaWarpSpecializedCooperative',
+  EpilogueScheduleType.PtrArrayTmaWarpSpecializedCooperative: 'cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative',
+  EpilogueScheduleType.PtrArrayTmaWarpSpecializedPingpong: 'cutlass::epilogue::PtrArrayTmaWarpSpecializedPingpong',
 }
 
 #
@@ -503,13 +518,39 @@ EpilogueScheduleSuffixes = {
   EpilogueScheduleType.NoSmemWarpSpecialized: '_epi_nosmem',
   EpilogueScheduleType.TmaWarpSpecialized: '_epi_tma',
   EpilogueScheduleType.TmaWarpSpecializedCooperative: '_epi_tma',
+  EpilogueScheduleType.PtrArrayTmaWarpSpecializedCooperative: '_epi_tma',
+  EpilogueScheduleType.PtrArrayTmaWarpSpecializedPingpong: '_epi_tma',
 }
 
 class EpilogueFunctor3x(enum.Enum):
   LinearCombination = enum_auto()
+  PerColLinCombPerColBias = enum_auto()
+  LinCombPerRowBiasReLU = enum_auto()
+  LinCombPerRowBiasGELU = enum_auto()
+  ScaledLinCombPerRowBiasReLUAmaxAux = enum_auto()
 #
 EpilogueFunctor3xTag = {
   EpilogueFunctor3x.LinearCombination: 'cutlass::epilogue::fusion::LinearCombination',
+  EpilogueFunctor3x.PerColLinCombPerColBias: 'cutlass::epilogue::fusion::PerColLinCombPerColBiasEltAct',
+  EpilogueFunctor3x.LinCombPerRowBiasReLU: 'cutlass::epilogue::fusion::LinCombPerRowBiasEltAct',
+  EpilogueFunctor3x.LinCombPerRowBiasGELU: 'cutlass::epilogue::fusion::LinCombPerRowBiasEltAct',
+  EpilogueFunctor3x.ScaledLinCombPerRowBiasReLUAmaxAux: 'cutlass::epilogue::fusion::ScaledLinCombPerRowBiasEltActAmaxAux',
+}
+
+#
+EpilogueFunctor3xSuffixes = {
+  EpilogueFunctor3x.LinearCombination: '',
+  EpilogueFunctor3x.PerColLinCombPerColBias: '_percol',
+  EpilogueFunctor3x.LinCombPerRowBiasReLU: '_bias_relu',
+  EpilogueFunctor3x.LinCombPerRowBiasGELU: '_bias_gelu',
+  EpilogueFunctor3x.ScaledLinCombPerRowBiasReLUAmaxAux: '_scaled_bias_relu_amax_aux',
+}
+
+# Activation applied by fused 3.x epilogue functors
+EpilogueFunctor3xActivationTag = {
+  EpilogueFunctor3x.LinCombPerRowBiasReLU: 'cutlass::epilogue::thread::ReLu',
+  EpilogueFunctor3x.LinCombPerRowBiasGELU: 'cutlass::epilogue::thread::GELU',
+  EpilogueFunctor3x.ScaledLinCombPerRowBiasReLUAmaxAux: 'cutlass::epilogue::thread::ReLu',
 }
 
 class TileSchedulerType(enum.Enum):
@@ -703,28 +744,34 @@ GemmKindNames = {
 #
 class RankKKind(enum.Enum):
   Universal = enum_auto()
+  Universal3x = enum_auto()
 
 #
 RankKKindNames = {
-  RankKKind.Universal: "rank_k"
+  RankKKind.Universal: "rank_k",
+  RankKKind.Universal3x: "rank_k_3x"
 }
 
 #
 class TrmmKind(enum.Enum):
   Universal = enum_auto()
+  Universal3x = enum_auto()
 
 #
 TrmmKindNames = {
-  TrmmKind.Universal: "trmm"
+  TrmmKind.Universal: "trmm",
+  TrmmKind.Universal3x: "trmm_3x"
 }
 
 #
 class SymmKind(enum.Enum):
   Universal = enum_auto()
+  Universal3x = enum_auto()
 
 #
 SymmKindNames = {
-  SymmKind.Universal: "symm"
+  SymmKind.Universal: "symm",
+  SymmKind.Universal3x: "symm_3x"
 }
 
 #
@@ -812,6 +859,7 @@ class IteratorAlgorithm(enum.Enum):
   FixedChannels = 2
   FewChannels = 3
   FixedStrideDilation = 4
+  Winograd = 5
 
 #
 IteratorAlgorithmTag = {
@@ -819,7 +867,8 @@ IteratorAlgorithmTag = {
   IteratorAlgorithm.Optimized: 'cutlass::conv::IteratorAlgorithm::kOptimized',
   IteratorAlgorithm.FixedChannels: 'cutlass::conv::IteratorAlgorithm::kFixedChannels',
   IteratorAlgorithm.FewChannels: 'cutlass::conv::IteratorAlgorithm::kFewChannels',
-  IteratorAlgorithm.FixedStrideDilation: 'cutlass::conv::IteratorAlgorithm::kFixedStrideDilation'
+  IteratorAlgorithm.FixedStrideDilation: 'cutlass::conv::IteratorAlgorithm::kFixedStrideDilation',
+  IteratorAlgorithm.Winograd: 'cutlass::conv::IteratorAlgorithm::kWinograd'
 }
 
 IteratorAlgorithmNames = {
@@ -827,7 +876,8 @@ IteratorAlgorithmNames = {
   IteratorAlgorithm.Optimized: 'optimized',
   IteratorAlgorithm.FixedChannels: 'fixed_channels',
   IteratorAlgorithm.FewChannels: 'few_channels',
-  IteratorAlgorithm.FixedStrideDilation: 'fixed_stride_dilation'
+  IteratorAlgorithm.FixedStrideDilation: 'fixed_stride_dilation',
+  IteratorAlgorithm.Winograd: 'winograd'
 }
 
 #
@@ -52,6 +52,7 @@ try:
   from cutlass_library.symm_operation import *
   from cutlass_library.conv2d_operation import *
   from cutlass_library.conv3d_operation import *
+  from cutlass_library.kernel_selection import *
 except ImportError:
   from library import *
   from gemm_operation import *
@@ -61,6 +62,7 @@ except ImportError:
   from symm_operation import *
   from conv2d_operation import *
   from conv3d_operation import *
+  from kernel_selection import *
 
 ###################################################################################################
 _LOGGER = logging.getLogger(__name__)
@@ -390,12 +392,19 @@ class EmitInterfaceLibrary:
   or trmm for triangular solve with multiple right-hand sides).
   The definitions of these functions live in subdirectories.
 
-  The file also _defines_ the following function in that namespace.
+  The file also _defines_ the following functions in that namespace.
 
   void initialize_all(Manifest& manifest);
 
   That function first prepares the manifest, and then
   calls all of the functions declared in this file.
+
+  void initialize_all_index(Manifest& manifest);
+
+  That function hands the manifest a static table mapping each
+  operation name to the initialize_{configuration_name} function that
+  constructs it, so that Manifest::initialize_lazy() can defer
+  constructing operations until they are looked up.
   """
 
   def __init__(self, generated_path, operation_count, args):
@@ -404,6 +413,8 @@ class EmitInterfaceLibrary:
 
     self.prototypes = []
     self.fn_calls = []
+    self.configuration_prototypes = []
+    self.index_entries = []
     self.operation_count = str(operation_count)
 
     self.top_level_hdr_template = '''
@@ -433,6 +444,17 @@ ${fn_calls}
 \t\t\tmanifest.reserve(${operation_count});\n
 ${fn_calls}
 \t\t}
+'''
+
+    self.top_level_index = '''
+\t\tstatic ManifestIndexEntry const kOperationIndex[] = {
+${index_entries}
+\t\t\t{OperationKind::kInvalid, nullptr, nullptr}
+\t\t};
+
+\t\tvoid initialize_all_index(Manifest &manifest) {
+\t\t\tmanifest.append_index(kOperationIndex, ${index_count});
+\t\t}
 '''
 
     self.top_level_suffix = '''
@@ -468,16 +490,39 @@ ${fn_calls}
       "\t\t\tinitialize_all_${operation_kind}_operations(manifest);",
       {'operation_kind': operation_name}))
 
+  #
+  def emit_index(self, operation_kind, configuration_name, operations):
+    _LOGGER.debug("*** EmitInterfaceLibrary::emit_index")
+    _LOGGER.debug("***   configuration_name: " + configuration_name)
+
+    self.configuration_prototypes.append(SubstituteTemplate(
+      "\t\tvoid initialize_${configuration_name}(Manifest &manifest);",
+      {'configuration_name': configuration_name}))
+
+    for operation in operations:
+      self.index_entries.append(SubstituteTemplate(
+        "\t\t\t{OperationKind::k${operation_kind}, \"${operation_name}\", initialize_${configuration_name}},",
+        {
+          'operation_kind': operation_kind.name,
+          'operation_name': operation.procedural_name(),
+          'configuration_name': configuration_name
+        }))
+
   #
   def __exit__(self, exception_type, exception_value, traceback):
     _LOGGER.debug("*** EmitInterfaceLibrary::__exit__")
 
-    self.top_level_file.write(SubstituteTemplate(self.top_level_prologue, {'prototypes':"\n".join(self.prototypes)}))
+    self.top_level_file.write(SubstituteTemplate(self.top_level_prologue,
+      {'prototypes':"\n".join(self.prototypes + self.configuration_prototypes)}))
 
     # Write out initialize_all method
     self.top_level_file.write(SubstituteTemplate(self.top_level_initialize,
                               {'operation_count': self.operation_count, 'fn_calls':"\n".join(self.fn_calls)}))
 
+    # Write out the static operation index used by lazy initialization
+    self.top_level_file.write(SubstituteTemplate(self.top_level_index,
+                              {'index_entries': "\n".join(self.index_entries), 'index_count': str(len(self.index_entries))}))
+
     self.top_level_file.write(self.top_level_suffix)
     self.top_level_file.close()
 
@@ -507,6 +552,7 @@ class Manifest:
     self.selected_kernels = []
     self.ignore_kernel_names = []
     self.exclude_kernel_names = []
+    self.tuned_kernel_names = None
     self.compute_capabilities = [50,]
     self.curr_build_dir = '.'
     self.filter_by_cc = True
@@ -559,6 +605,15 @@ class Manifest:
             filter_count = len(self.kernel_filter_list),
             filter_file = args.kernel_filter_file))
 
+    tuning_logs = [x for x in getattr(args, 'tuning_logs', '').replace(';', ',').split(',') if x != '']
+    if len(tuning_logs):
+      self.tuned_kernel_names = set(self.get_tuned_kernels(tuning_logs))
+
+      # Tuned kernels may come from outside the default kernel set, so every kernel is generated
+      # and then filtered, as with a kernel filter file
+      if self.kernel_filter == '':
+        self.kernel_filter = '*'
+
     self.operation_count = 0
     self.operations_by_name = {}
     self.disable_full_archs_compilation = args.disable_full_archs_compilation
@@ -600,6 +655,30 @@ class Manifest:
     else:
         return []
 
+  def get_tuned_kernels(self, tuning_logs):
+    ''' Selects the fewest kernels within the tuning tolerance of the fastest kernel for every problem
+        in the profiler reports '''
+    shapes = None
+    if self.args.tuning_shapes:
+      shapes = load_shapes(self.args.tuning_shapes)
+
+    problems = load_profiler_results(tuning_logs, shapes)
+    tolerance = float(self.args.tuning_tolerance) / 100.0
+    budget = int(self.args.tuning_budget)
+
+    if not len(problems):
+      raise RuntimeError("No CUTLASS results found in tuning logs: " + ', '.join(tuning_logs))
+
+    selected = select_kernels(problems, tolerance, budget)
+
+    _LOGGER.info("Selected {} kernels for {} profiled problems from {} (worst slowdown {:.1f}%)".format(
+      len(selected), len(problems), ', '.join(tuning_logs), (selection_slowdown(problems, selected) - 1.0) * 100.0))
+
+    for name in selected:
+      _LOGGER.debug(f"Kernel {name} selected from tuning logs.")
+
+    return selected
+
   #
   def filter_out_kernels(self, kernel_name, kernel_filter_list):
 
@@ -679,6 +758,11 @@ class Manifest:
         _LOGGER.debug(f"Kernel {name} culled due to no match in kernel filter file.")
         enabled = False
 
+    if self.tuned_kernel_names is not None:
+      enabled = name in self.tuned_kernel_names
+      if not enabled:
+        _LOGGER.debug(f"Kernel {name} culled due to not being selected from tuning logs.")
+
     # CUTLASS_LIBRARY_IGNORE_KERNELS ("ignore" list) only takes effect
     # if CUTLASS_LIBRARY_KERNELS was specified.
     # Changing that would break backwards compatibility.
@@ -837,6 +921,11 @@ class Manifest:
       for operation_kind in self.operations.keys():
         iface_emitter.emit(OperationKindNames[operation_kind])
 
+      for operation_kind, ops in self.operations.items():
+        for min_cc, configurations in sorted(ops.items()):
+          for configuration_name, operations in configurations.items():
+            iface_emitter.emit_index(operation_kind, configuration_name, operations)
+
     source_files = {}
     for kind in self.operations.keys():
       source_files[kind] = {}
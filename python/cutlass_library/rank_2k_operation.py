@@ -60,9 +60,10 @@ class Rank2KOperation:
   #
   def __init__(self, rank_k_kind, arch, tile_description, A, C, element_epilogue, \
       epilogue_functor = EpilogueFunctor.LinearCombination, swizzling_functor = SwizzlingFunctor.Identity8, \
-      blas_mode = BlasMode.symmetric):
+      blas_mode = BlasMode.symmetric, kernel_schedule = KernelScheduleType.ScheduleAuto):
 
     self.blas_mode = blas_mode
+    self.kernel_schedule = kernel_schedule
     self.operation_kind = OperationKind.Rank2K
     self.arch = arch
     self.tile_description = tile_description
@@ -179,6 +180,21 @@ class Rank2KOperation:
     ''' The full procedural name indicates architecture, extended name, tile size, and layout. '''
     threadblock = self.tile_description.procedural_name()
 
+    if self.rank_k_kind == RankKKind.Universal3x:
+      return SubstituteTemplate(
+        "cutlass3x_sm${arch}_${opcode_class}_${extended_name}_${threadblock}_${layout}_${fill_mode}_align${alignment}${kernel_schedule}",
+        {
+          'arch': str(self.arch),
+          'opcode_class': OpcodeClassNames[self.tile_description.math_instruction.opcode_class],
+          'extended_name': self.extended_name(),
+          'threadblock': threadblock,
+          'layout': self.layout_name(),
+          'fill_mode': self.fill_mode_name(),
+          'alignment': "%d" % self.A.alignment,
+          'kernel_schedule': KernelScheduleSuffixes[self.kernel_schedule],
+        }
+      )
+
     opcode_class_name = OpcodeClassNames[self.tile_description.math_instruction.opcode_class]
 
     alignment = max([self.A.alignment, self.C.alignment])
@@ -319,6 +335,83 @@ using Operation_${operation_name} =
 
 ###################################################################################################
 
+#
+class EmitRank2KUniversal3xInstance:
+  ''' Responsible for emitting a CUTLASS 3.x rank-2k update: a GEMM over A * B^T followed by B * A^T
+      in one mainloop, scheduled over one triangle of C and masked on the diagonal tiles. '''
+
+  def __init__(self):
+    self.rank_k_template = """
+// Rank 2K operator ${operation_name}
+using ${operation_name}_epilogue =
+  cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+    cutlass::epilogue::collective::DefaultEpilogueTriangular<
+      ${fill_mode},
+      ${element_c},
+      cutlass::detail::TagToStrideC_t<${layout_c}>,
+      cutlass::detail::TagToStrideC_t<${layout_c}>,
+      cutlass::epilogue::thread::LinearCombination<
+        ${element_c}, 1, ${element_accumulator}, ${element_epilogue}>,
+      cutlass::gemm::EpilogueDefault>>;
+
+using ${operation_name}_mainloop =
+  typename cutlass::gemm::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${element_a}, ${layout_a}, ${align_a},
+    ${element_a}, ${layout_b}, ${align_a},
+    ${element_accumulator},
+    cute::Shape<cute::_${tile_shape_m}, cute::_${tile_shape_n}, cute::_${tile_shape_k}>,
+    cute::Shape<cute::_1, cute::_1, cute::_1>,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename ${operation_name}_epilogue::SharedStorage))>,
+    ${kernel_schedule}
+  >::CollectiveOp;
+
+// Rank 2K operator ${operation_name} kernel
+using ${operation_name}_base = cutlass::gemm::kernel::GemmUniversal<
+    cute::Shape<int,int,int,int>,
+    ${operation_name}_mainloop,
+    ${operation_name}_epilogue,
+    cutlass::gemm::TriangularScheduler<${fill_mode}, 2>>;
+
+// Define named type
+struct ${operation_name} :
+  public ${operation_name}_base { };
+
+using Operation_${operation_name} = cutlass::gemm::device::GemmUniversalAdapter<${operation_name}>;
+"""
+
+  def emit(self, operation):
+
+    tile_shape = operation.tile_description.tile_shape
+
+    # B shares the layout of A and is read as an (N,K) operand, i.e. B^T in the GEMM's (K,N) convention
+    layout_b = LayoutType.ColumnMajor if operation.A.layout == LayoutType.RowMajor else LayoutType.RowMajor
+
+    values = {
+      'operation_name': operation.procedural_name(),
+      'element_a': DataTypeTag[operation.A.element],
+      'layout_a': LayoutTag[operation.A.layout],
+      'layout_b': LayoutTag[layout_b],
+      'element_c': DataTypeTag[operation.C.element],
+      'layout_c': LayoutTag[operation.C.layout],
+      'fill_mode': FillModeTag[operation.C.fill_mode],
+      'element_accumulator': DataTypeTag[operation.accumulator_type()],
+      'element_epilogue': str(DataTypeTag[operation.element_epilogue]),
+      'opcode_class': OpcodeClassTag[operation.tile_description.math_instruction.opcode_class],
+      'arch': "cutlass::arch::Sm%d" % operation.arch,
+      'tile_shape_m': str(tile_shape[0]),
+      'tile_shape_n': str(tile_shape[1]),
+      'tile_shape_k': str(tile_shape[2]),
+      'align_a': str(operation.A.alignment),
+      # The rank-2k mainloop is selected by the Rank2K flavor of the warp-specialized schedule
+      'kernel_schedule': KernelScheduleTag[operation.kernel_schedule] + 'Rank2K',
+    }
+
+    return SubstituteTemplate(self.rank_k_template, values)
+
+###################################################################################################
+
 
 ###################################################################################################
 #
@@ -333,10 +426,12 @@ class EmitRank2KConfigurationLibrary:
 
     self.instance_emitter = {
       RankKKind.Universal: EmitRank2KUniversalInstance,
+      RankKKind.Universal3x: EmitRank2KUniversal3xInstance,
     }
 
     self.rank_k_kind_wrappers = {
       RankKKind.Universal: 'Rank2KOperation',
+      RankKKind.Universal3x: 'RankK3xOperation',
     }
 
     self.instance_template = {
@@ -346,6 +441,13 @@ ${compile_guard_start}
     Operation_${operation_name}
   >("${operation_name}"));
 ${compile_guard_end}
+""",
+      RankKKind.Universal3x: """
+${compile_guard_start}
+  manifest.append(new ${rank_k_kind}<
+    Operation_${operation_name}
+  >("${operation_name}"));
+${compile_guard_end}
 """
     }
 
@@ -361,6 +463,7 @@ ${compile_guard_end}
 
 #include "library_internal.h"
 #include "rank_2k_operation.h"
+#include "rank_k_operation_3x.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
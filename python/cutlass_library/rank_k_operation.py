@@ -60,9 +60,10 @@ class RankKOperation:
   #
   def __init__(self, rank_k_kind, arch, tile_description, A, C, element_epilogue, \
       epilogue_functor = EpilogueFunctor.LinearCombination, swizzling_functor = SwizzlingFunctor.Identity8, \
-      blas_mode = BlasMode.symmetric):
+      blas_mode = BlasMode.symmetric, kernel_schedule = KernelScheduleType.ScheduleAuto):
 
     self.blas_mode = blas_mode
+    self.kernel_schedule = kernel_schedule
     self.operation_kind = OperationKind.RankK
     self.arch = arch
     self.tile_description = tile_description
@@ -177,6 +178,21 @@ class RankKOperation:
     ''' The full procedural name indicates architecture, extended name, tile size, and layout. '''
     threadblock = self.tile_description.procedural_name()
 
+    if self.rank_k_kind == RankKKind.Universal3x:
+      return SubstituteTemplate(
+        "cutlass3x_sm${arch}_${opcode_class}_${extended_name}_${threadblock}_${layout}_${fill_mode}_align${alignment}${kernel_schedule}",
+        {
+          'arch': str(self.arch),
+          'opcode_class': OpcodeClassNames[self.tile_description.math_instruction.opcode_class],
+          'extended_name': self.extended_name(),
+          'threadblock': threadblock,
+          'layout': self.layout_name(),
+          'fill_mode': self.fill_mode_name(),
+          'alignment': "%d" % self.A.alignment,
+          'kernel_schedule': KernelScheduleSuffixes[self.kernel_schedule],
+        }
+      )
+
     opcode_class_name = OpcodeClassNames[self.tile_description.math_instruction.opcode_class]
 
     alignment = max([self.A.alignment, self.C.alignment])
@@ -308,6 +324,82 @@ using Operation_${operation_name} =
 
 ###################################################################################################
 
+#
+class EmitRankKUniversal3xInstance:
+  ''' Responsible for emitting a CUTLASS 3.x rank-k update: a GEMM reading A as both operands,
+      scheduled over one triangle of C and masked on the diagonal tiles. '''
+
+  def __init__(self):
+    self.rank_k_template = """
+// Rank K operator ${operation_name}
+using ${operation_name}_epilogue =
+  cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+    cutlass::epilogue::collective::DefaultEpilogueTriangular<
+      ${fill_mode},
+      ${element_c},
+      cutlass::detail::TagToStrideC_t<${layout_c}>,
+      cutlass::detail::TagToStrideC_t<${layout_c}>,
+      cutlass::epilogue::thread::LinearCombination<
+        ${element_c}, 1, ${element_accumulator}, ${element_epilogue}>,
+      cutlass::gemm::EpilogueDefault>>;
+
+using ${operation_name}_mainloop =
+  typename cutlass::gemm::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${element_a}, ${layout_a}, ${align_a},
+    ${element_a}, ${layout_b}, ${align_a},
+    ${element_accumulator},
+    cute::Shape<cute::_${tile_shape_m}, cute::_${tile_shape_n}, cute::_${tile_shape_k}>,
+    cute::Shape<cute::_1, cute::_1, cute::_1>,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename ${operation_name}_epilogue::SharedStorage))>,
+    ${kernel_schedule}
+  >::CollectiveOp;
+
+// Rank K operator ${operation_name} kernel
+using ${operation_name}_base = cutlass::gemm::kernel::GemmUniversal<
+    cute::Shape<int,int,int,int>,
+    ${operation_name}_mainloop,
+    ${operation_name}_epilogue,
+    cutlass::gemm::TriangularScheduler<${fill_mode}>>;
+
+// Define named type
+struct ${operation_name} :
+  public ${operation_name}_base { };
+
+using Operation_${operation_name} = cutlass::gemm::device::GemmUniversalAdapter<${operation_name}>;
+"""
+
+  def emit(self, operation):
+
+    tile_shape = operation.tile_description.tile_shape
+
+    # B is A viewed as an (N,K) operand, i.e. A^T in the GEMM's (K,N) convention
+    layout_b = LayoutType.ColumnMajor if operation.A.layout == LayoutType.RowMajor else LayoutType.RowMajor
+
+    values = {
+      'operation_name': operation.procedural_name(),
+      'element_a': DataTypeTag[operation.A.element],
+      'layout_a': LayoutTag[operation.A.layout],
+      'layout_b': LayoutTag[layout_b],
+      'element_c': DataTypeTag[operation.C.element],
+      'layout_c': LayoutTag[operation.C.layout],
+      'fill_mode': FillModeTag[operation.C.fill_mode],
+      'element_accumulator': DataTypeTag[operation.accumulator_type()],
+      'element_epilogue': str(DataTypeTag[operation.element_epilogue]),
+      'opcode_class': OpcodeClassTag[operation.tile_description.math_instruction.opcode_class],
+      'arch': "cutlass::arch::Sm%d" % operation.arch,
+      'tile_shape_m': str(tile_shape[0]),
+      'tile_shape_n': str(tile_shape[1]),
+      'tile_shape_k': str(tile_shape[2]),
+      'align_a': str(operation.A.alignment),
+      'kernel_schedule': KernelScheduleTag[operation.kernel_schedule],
+    }
+
+    return SubstituteTemplate(self.rank_k_template, values)
+
+###################################################################################################
+
 
 ###################################################################################################
 #
@@ -322,10 +414,12 @@ class EmitRankKConfigurationLibrary:
 
     self.instance_emitter = {
       RankKKind.Universal: EmitRankKUniversalInstance,
+      RankKKind.Universal3x: EmitRankKUniversal3xInstance,
     }
 
     self.rank_k_kind_wrappers = {
       RankKKind.Universal: 'RankKOperation',
+      RankKKind.Universal3x: 'RankK3xOperation',
     }
 
     self.instance_template = {
@@ -335,6 +429,13 @@ ${compile_guard_start}
     Operation_${operation_name}
   >("${operation_name}"));
 ${compile_guard_end}
+""",
+      RankKKind.Universal3x: """
+${compile_guard_start}
+  manifest.append(new ${rank_k_kind}<
+    Operation_${operation_name}
+  >("${operation_name}"));
+${compile_guard_end}
 """
     }
 
@@ -350,6 +451,13 @@ ${compile_guard_end}
 
 #include "library_internal.h"
 #include "rank_k_operation.h"
+#include "rank_k_operation_3x.hpp"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_epilogue.hpp"
+#include "cutlass/epilogue/thread/linear_combination.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -183,6 +183,21 @@ class SymmOperation:
     ''' The full procedural name indicates architecture, extended name, tile size, and layout. '''
     threadblock = self.tile_description.procedural_name()
 
+    if self.symm_kind == SymmKind.Universal3x:
+      return SubstituteTemplate(
+        "cutlass3x_sm${arch}_${opcode_class}_${extended_name}_${threadblock}_${layout}_${side_mode}_${fill_mode}_align${alignment}",
+        {
+          'arch': str(self.arch),
+          'opcode_class': OpcodeClassNames[self.tile_description.math_instruction.opcode_class],
+          'extended_name': self.extended_name(),
+          'threadblock': threadblock,
+          'layout': self.layout_name(),
+          'side_mode': self.side_mode_name(),
+          'fill_mode': self.fill_mode_name(),
+          'alignment': "%d" % self.A.alignment,
+        }
+      )
+
     opcode_class_name = OpcodeClassNames[self.tile_description.math_instruction.opcode_class]
 
     alignment = self.C.alignment
@@ -321,6 +336,98 @@ using Operation_${operation_name} =
 
 ###################################################################################################
 
+#
+class EmitSymmUniversal3xInstance:
+  ''' Responsible for emitting a CUTLASS 3.x SYMM: two triangular-A GEMMs, the second reading the
+      stored triangle of A through the transposed layout as the mirrored one, without its diagonal. '''
+
+  def __init__(self):
+    self.symm_kernel_template = """
+// Symm operator ${operation_name}${kernel_suffix}
+using ${operation_name}${kernel_suffix}_epilogue =
+  cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+    cutlass::epilogue::collective::DefaultEpilogue<
+      ${element_c},
+      cutlass::detail::TagToStrideC_t<${layout_c}>,
+      cutlass::detail::TagToStrideC_t<${layout_c}>,
+      cutlass::epilogue::thread::LinearCombination<
+        ${element_c}, 1, ${element_accumulator}, ${element_epilogue}>,
+      cutlass::gemm::EpilogueDefault>>;
+
+using ${operation_name}${kernel_suffix}_mainloop =
+  typename cutlass::gemm::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${element_a}, ${layout_a}, ${align_a},
+    ${element_b}, ${layout_b}, ${align_b},
+    ${element_accumulator},
+    cute::Shape<cute::_${tile_shape_m}, cute::_${tile_shape_n}, cute::_${tile_shape_k}>,
+    cute::Shape<cute::_${cluster_m}, cute::_${cluster_n}, cute::_${cluster_k}>,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename ${operation_name}${kernel_suffix}_epilogue::SharedStorage))>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperativeTriangularA<${fill_mode}, ${diag_type}>
+  >::CollectiveOp;
+
+// Symm operator ${operation_name}${kernel_suffix} kernel
+using ${operation_name}${kernel_suffix}_base = cutlass::gemm::kernel::GemmUniversal<
+    cute::Shape<int,int,int,int>,
+    ${operation_name}${kernel_suffix}_mainloop,
+    ${operation_name}${kernel_suffix}_epilogue,
+    cutlass::gemm::TriangularKScheduler<${fill_mode}>>;
+
+// Define named type
+struct ${operation_name}${kernel_suffix} :
+  public ${operation_name}${kernel_suffix}_base { };
+
+using Operation_${operation_name}${kernel_suffix} = cutlass::gemm::device::GemmUniversalAdapter<${operation_name}${kernel_suffix}>;
+"""
+
+  def emit(self, operation):
+
+    tile_shape = operation.tile_description.tile_shape
+    cluster_shape = operation.tile_description.cluster_shape
+
+    values = {
+      'operation_name': operation.procedural_name(),
+      'element_a': DataTypeTag[operation.A.element],
+      'element_b': DataTypeTag[operation.B.element],
+      'layout_b': LayoutTag[operation.B.layout],
+      'element_c': DataTypeTag[operation.C.element],
+      'layout_c': LayoutTag[operation.C.layout],
+      'element_accumulator': DataTypeTag[operation.accumulator_type()],
+      'element_epilogue': str(DataTypeTag[operation.element_epilogue]),
+      'opcode_class': OpcodeClassTag[operation.tile_description.math_instruction.opcode_class],
+      'arch': "cutlass::arch::Sm%d" % operation.arch,
+      'tile_shape_m': str(tile_shape[0]),
+      'tile_shape_n': str(tile_shape[1]),
+      'tile_shape_k': str(tile_shape[2]),
+      'cluster_m': str(cluster_shape[0]),
+      'cluster_n': str(cluster_shape[1]),
+      'cluster_k': str(cluster_shape[2]),
+      'align_a': str(operation.A.alignment),
+      'align_b': str(operation.B.alignment),
+    }
+
+    # The stored triangle, including the diagonal
+    stored = SubstituteTemplate(self.symm_kernel_template, dict(values, **{
+      'kernel_suffix': '',
+      'layout_a': LayoutTag[operation.A.layout],
+      'fill_mode': FillModeTag[operation.A.fill_mode],
+      'diag_type': 'cutlass::DiagType::kNonUnit',
+    }))
+
+    # The mirrored triangle: the same memory read as A^T, with the opposite fill mode and no diagonal
+    mirrored_fill_mode = FillMode.Upper if operation.A.fill_mode == FillMode.Lower else FillMode.Lower
+    mirrored = SubstituteTemplate(self.symm_kernel_template, dict(values, **{
+      'kernel_suffix': '_mirrored',
+      'layout_a': LayoutTag[TransposedLayout[operation.A.layout]],
+      'fill_mode': FillModeTag[mirrored_fill_mode],
+      'diag_type': 'cutlass::DiagType::kZero',
+    }))
+
+    return stored + mirrored
+
+###################################################################################################
+
 
 ###################################################################################################
 #
@@ -335,10 +442,12 @@ class EmitSymmConfigurationLibrary:
 
     self.instance_emitter = {
       SymmKind.Universal: EmitSymmUniversalInstance,
+      SymmKind.Universal3x: EmitSymmUniversal3xInstance,
     }
 
     self.symm_kind_wrappers = {
       SymmKind.Universal: 'SymmOperation',
+      SymmKind.Universal3x: 'Symm3xOperation',
     }
 
     self.instance_template = {
@@ -348,6 +457,14 @@ ${compile_guard_start}
     Operation_${operation_name}
   >("${operation_name}"));
 ${compile_guard_end}
+""",
+      SymmKind.Universal3x: """
+${compile_guard_start}
+  manifest.append(new ${symm_kind}<
+    Operation_${operation_name},
+    Operation_${operation_name}_mirrored
+  >("${operation_name}"));
+${compile_guard_end}
 """
     }
 
@@ -363,6 +480,7 @@ ${compile_guard_end}
 
 #include "library_internal.h"
 #include "symm_operation.h"
+#include "symm_operation_3x.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -133,7 +133,7 @@ class TrmmOperation:
         self.tile_description.math_instruction.element_a != self.tile_description.math_instruction.element_accumulator:
         intermediate_type = DataTypeNames[self.tile_description.math_instruction.element_a]
 
-    return "%s%s%s%s" % (self.short_math_name(), inst_shape, intermediate_type, TrmmKindNames[self.trmm_kind])
+    return "%s%s%s%s" % (self.short_math_name(), inst_shape, intermediate_type, TrmmKindNames[TrmmKind.Universal])
 
   #
   def extended_name(self):
@@ -184,6 +184,22 @@ class TrmmOperation:
     ''' The full procedural name indicates architecture, extended name, tile size, and layout. '''
     threadblock = self.tile_description.procedural_name()
 
+    if self.trmm_kind == TrmmKind.Universal3x:
+      return SubstituteTemplate(
+        "cutlass3x_sm${arch}_${opcode_class}_${extended_name}_${threadblock}_${layout}_${side_mode}_${fill_mode}_${diag_type}_align${alignment}",
+        {
+          'arch': str(self.arch),
+          'opcode_class': OpcodeClassNames[self.tile_description.math_instruction.opcode_class],
+          'extended_name': self.extended_name(),
+          'threadblock': threadblock,
+          'layout': self.layout_name(),
+          'side_mode': self.side_mode_name(),
+          'fill_mode': self.fill_mode_name(),
+          'diag_type': self.diag_type_name(),
+          'alignment': "%d" % self.A.alignment,
+        }
+      )
+
     opcode_class_name = OpcodeClassNames[self.tile_description.math_instruction.opcode_class]
 
     alignment = max([self.C.alignment])
@@ -328,6 +344,85 @@ using Operation_${operation_name} =
 
 ###################################################################################################
 
+#
+class EmitTrmmUniversal3xInstance:
+  ''' Responsible for emitting a CUTLASS 3.x TRMM: a GEMM whose mainloop only visits the k tiles
+      holding the stored triangle of A and masks the tiles crossing its diagonal. '''
+
+  def __init__(self):
+    self.trmm_template = """
+// Trmm operator ${operation_name}
+using ${operation_name}_epilogue =
+  cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+    cutlass::epilogue::collective::DefaultEpilogue<
+      ${element_c},
+      cutlass::detail::TagToStrideC_t<${layout_c}>,
+      cutlass::detail::TagToStrideC_t<${layout_c}>,
+      cutlass::epilogue::thread::LinearCombination<
+        ${element_c}, 1, ${element_accumulator}, ${element_epilogue},
+        cutlass::epilogue::thread::ScaleType::OnlyAlphaScaling>,
+      cutlass::gemm::EpilogueDefault>>;
+
+using ${operation_name}_mainloop =
+  typename cutlass::gemm::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${element_a}, ${layout_a}, ${align_a},
+    ${element_b}, ${layout_b}, ${align_b},
+    ${element_accumulator},
+    cute::Shape<cute::_${tile_shape_m}, cute::_${tile_shape_n}, cute::_${tile_shape_k}>,
+    cute::Shape<cute::_${cluster_m}, cute::_${cluster_n}, cute::_${cluster_k}>,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename ${operation_name}_epilogue::SharedStorage))>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperativeTriangularA<${fill_mode}, ${diag_type}>
+  >::CollectiveOp;
+
+// Trmm operator ${operation_name} kernel
+using ${operation_name}_base = cutlass::gemm::kernel::GemmUniversal<
+    cute::Shape<int,int,int,int>,
+    ${operation_name}_mainloop,
+    ${operation_name}_epilogue,
+    cutlass::gemm::TriangularKScheduler<${fill_mode}>>;
+
+// Define named type
+struct ${operation_name} :
+  public ${operation_name}_base { };
+
+using Operation_${operation_name} = cutlass::gemm::device::GemmUniversalAdapter<${operation_name}>;
+"""
+
+  def emit(self, operation):
+
+    tile_shape = operation.tile_description.tile_shape
+    cluster_shape = operation.tile_description.cluster_shape
+
+    values = {
+      'operation_name': operation.procedural_name(),
+      'element_a': DataTypeTag[operation.A.element],
+      'layout_a': LayoutTag[operation.A.layout],
+      'fill_mode': FillModeTag[operation.A.fill_mode],
+      'diag_type' : DiagTypeTag[operation.A.diag_type],
+      'element_b': DataTypeTag[operation.B.element],
+      'layout_b': LayoutTag[operation.B.layout],
+      'element_c': DataTypeTag[operation.C.element],
+      'layout_c': LayoutTag[operation.C.layout],
+      'element_accumulator': DataTypeTag[operation.accumulator_type()],
+      'element_epilogue': str(DataTypeTag[operation.element_epilogue]),
+      'opcode_class': OpcodeClassTag[operation.tile_description.math_instruction.opcode_class],
+      'arch': "cutlass::arch::Sm%d" % operation.arch,
+      'tile_shape_m': str(tile_shape[0]),
+      'tile_shape_n': str(tile_shape[1]),
+      'tile_shape_k': str(tile_shape[2]),
+      'cluster_m': str(cluster_shape[0]),
+      'cluster_n': str(cluster_shape[1]),
+      'cluster_k': str(cluster_shape[2]),
+      'align_a': str(operation.A.alignment),
+      'align_b': str(operation.B.alignment),
+    }
+
+    return SubstituteTemplate(self.trmm_template, values)
+
+###################################################################################################
+
 
 ###################################################################################################
 #
@@ -342,10 +437,12 @@ class EmitTrmmConfigurationLibrary:
 
     self.instance_emitter = {
       TrmmKind.Universal: EmitTrmmUniversalInstance,
+      TrmmKind.Universal3x: EmitTrmmUniversal3xInstance,
     }
 
     self.trmm_kind_wrappers = {
       TrmmKind.Universal: 'TrmmOperation',
+      TrmmKind.Universal3x: 'Trmm3xOperation',
     }
 
     self.instance_template = {
@@ -355,6 +452,13 @@ ${compile_guard_start}
     Operation_${operation_name}
   >("${operation_name}"));
 ${compile_guard_end}
+""",
+      TrmmKind.Universal3x: """
+${compile_guard_start}
+  manifest.append(new ${trmm_kind}<
+    Operation_${operation_name}
+  >("${operation_name}"));
+${compile_guard_end}
 """
     }
 
@@ -370,6 +474,7 @@ ${compile_guard_end}
 
 #include "library_internal.h"
 #include "trmm_operation.h"
+#include "trmm_operation_3x.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
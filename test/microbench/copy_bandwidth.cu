@@ -0,0 +1,512 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Bandwidth sweep over CuTe copy atoms on the gmem->smem and smem->rmem paths.
+
+    gmem->smem cases stream a row-major fp16 matrix larger than L2 through a multi-stage smem
+    buffer with one persistent CTA per SM. They report DRAM bandwidth for:
+      - SM80_CP_ASYNC_CACHEGLOBAL / CACHEALWAYS with 4, 8 and 16 byte vectors
+      - SM90_TMA_LOAD over the GMMA K-major swizzle atoms and several box sizes
+      - SM90_BULK_COPY_G2S over several contiguous chunk sizes
+
+    smem->rmem cases repeatedly load an SM80 16x8x16 MMA A-operand tile from a resident 64x64 smem
+    tile. They report the aggregate shared memory bandwidth of the LDSM variants and of 32-bit
+    loads, with and without swizzling.
+
+    Usage:
+
+      $ cutlass_microbench_copy [--footprint-mib=<int>] [--repeats=<int>] [--iterations=<int>]
+                                [--device=<int>] [--output=<file.json>]
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cute/tensor.hpp"
+#include "cute/atom/copy_atom.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/atom/copy_traits_sm90_tma.hpp"
+#include "cute/atom/mma_traits_sm90_gmma.hpp"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/arch/barrier.h"
+
+#include "cutlass/util/command_line.h"
+
+using namespace cute;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using Element = cutlass::half_t;
+
+constexpr int kThreads = 128;
+constexpr int kStages = 4;
+constexpr int kGmemCols = 4096;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// gmem -> smem kernels
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Row-major view of the source matrix, split into (TILE_M,TILE_K,tiles)
+template <class TileShape, class Tensor>
+CUTE_DEVICE auto
+tile_source(Tensor const& mA, TileShape tile_shape) {
+  return group_modes<2,4>(local_tile(mA, tile_shape, make_coord(_,_)));
+}
+
+/// cp.async: every thread copies its vectors of one tile per stage and keeps kStages - 1 in flight
+template <class SmemLayout, class TiledCopy>
+__global__ static
+void cp_async_g2s_kernel(Element const* src, int rows, TiledCopy tiled_copy) {
+  extern __shared__ char shared_memory[];
+  Tensor sA = make_tensor(make_smem_ptr(reinterpret_cast<Element*>(shared_memory)), SmemLayout{});  // (TILE_M,TILE_K,PIPE)
+
+  Tensor mA = make_tensor(make_gmem_ptr(src), make_shape(rows, kGmemCols), make_stride(kGmemCols, _1{}));
+  Tensor gA = tile_source(mA, take<0,2>(shape(SmemLayout{})));                                      // (TILE_M,TILE_K,tiles)
+
+  auto thr_copy = tiled_copy.get_thread_slice(threadIdx.x);
+  Tensor tAgA = thr_copy.partition_S(gA);                                                           // (CPY,CPY_M,CPY_K,tiles)
+  Tensor tAsA = thr_copy.partition_D(sA);                                                           // (CPY,CPY_M,CPY_K,PIPE)
+
+  int const num_tiles = size<2>(gA);
+  int stage = 0;
+  for (int tile = blockIdx.x; tile < num_tiles; tile += gridDim.x) {
+    copy(tiled_copy, tAgA(_,_,_,tile), tAsA(_,_,_,stage));
+    cp_async_fence();
+    cp_async_wait<kStages - 1>();
+    stage = (stage + 1) % kStages;
+  }
+  cp_async_wait<0>();
+}
+
+template <class SmemLayout>
+struct TmaSharedStorage {
+  ArrayEngine<Element, cosize_v<SmemLayout>> smem;
+  alignas(16) uint64_t mbar[kStages];
+};
+
+/// Issues one TMA (or bulk) load per tile from a single thread, reusing a stage once its previous load landed
+template <class IssueLoad>
+CUTE_DEVICE void
+run_single_thread_pipeline(uint64_t* mbar, int num_tiles, uint32_t transaction_bytes, IssueLoad&& issue_load) {
+  CUTE_UNROLL
+  for (int s = 0; s < kStages; ++s) {
+    initialize_barrier(mbar[s], 1);
+  }
+  cutlass::arch::fence_barrier_init();
+
+  int k = 0;
+  for (int tile = blockIdx.x; tile < num_tiles; tile += gridDim.x, ++k) {
+    int s = k % kStages;
+    if (k >= kStages) {
+      wait_barrier(mbar[s], ((k / kStages) - 1) & 1);
+    }
+    set_barrier_transaction_bytes(mbar[s], transaction_bytes);
+    issue_load(tile, s);
+  }
+  for (int j = cute::max(0, k - kStages); j < k; ++j) {
+    wait_barrier(mbar[j % kStages], (j / kStages) & 1);
+  }
+}
+
+template <class SmemLayout, class TmaLoad>
+__global__ static
+void tma_g2s_kernel(CUTE_GRID_CONSTANT TmaLoad const tma, int rows) {
+  extern __shared__ char shared_memory[];
+  auto& storage = *reinterpret_cast<TmaSharedStorage<SmemLayout>*>(shared_memory);
+  if (threadIdx.x != 0) {
+    return;
+  }
+
+  Tensor sA = make_tensor(make_smem_ptr(storage.smem.begin()), SmemLayout{});                       // (TILE_M,TILE_K,PIPE)
+  Tensor mA = tma.get_tma_tensor(make_shape(rows, kGmemCols));
+  Tensor gA = tile_source(mA, take<0,2>(shape(SmemLayout{})));                                      // (TILE_M,TILE_K,tiles)
+
+  auto cta_tma = tma.get_slice(Int<0>{});
+  Tensor tAgA = cta_tma.partition_S(gA);                                                            // (TMA,TMA_M,TMA_K,tiles)
+  Tensor tAsA = cta_tma.partition_D(sA);                                                            // (TMA,TMA_M,TMA_K,PIPE)
+
+  constexpr uint32_t transaction_bytes = sizeof(Element) * size(take<0,2>(SmemLayout{}));
+  run_single_thread_pipeline(storage.mbar, size<2>(gA), transaction_bytes,
+    [&](int tile, int stage) {
+      copy(tma.with(storage.mbar[stage]), tAgA(_,_,_,tile), tAsA(_,_,_,stage));
+    });
+}
+
+template <int ChunkBytes>
+struct BulkSharedStorage {
+  alignas(128) uint8_t smem[kStages][ChunkBytes];
+  alignas(16) uint64_t mbar[kStages];
+};
+
+template <int ChunkBytes>
+__global__ static
+void bulk_g2s_kernel(uint8_t const* src, int num_chunks) {
+  extern __shared__ char shared_memory[];
+  auto& storage = *reinterpret_cast<BulkSharedStorage<ChunkBytes>*>(shared_memory);
+  if (threadIdx.x != 0) {
+    return;
+  }
+
+  run_single_thread_pipeline(storage.mbar, num_chunks, ChunkBytes,
+    [&](int chunk, int stage) {
+      SM90_BULK_COPY_G2S::copy(src + size_t(chunk) * ChunkBytes, &storage.mbar[stage], storage.smem[stage], ChunkBytes);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// smem -> rmem kernel
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+using S2RTiledMma = TiledMMA<MMA_Atom<SM80_16x8x16_F32F16F16F32_TN>, Layout<Shape<_2,_2,_1>>, Tile<_32,_32,_16>>;
+
+/// Reloads the A-operand fragments of a resident 64x64 tile `iterations` times
+template <class SmemLayout, class CopyAtom>
+__global__ static
+void s2r_kernel(int iterations, uint32_t* sink) {
+  extern __shared__ char shared_memory[];
+  Tensor sA = make_tensor(make_smem_ptr(reinterpret_cast<Element*>(shared_memory)), SmemLayout{});  // (64,64)
+  for (int i = threadIdx.x; i < size(sA); i += blockDim.x) {
+    sA(i) = Element(float(i % 7));
+  }
+  __syncthreads();
+
+  S2RTiledMma tiled_mma;
+  auto thr_mma = tiled_mma.get_thread_slice(threadIdx.x);
+  Tensor tCrA = thr_mma.partition_fragment_A(sA);                                                   // (MMA,MMA_M,MMA_K)
+
+  auto s2r_copy = make_tiled_copy_A(CopyAtom{}, tiled_mma);
+  auto thr_s2r = s2r_copy.get_thread_slice(threadIdx.x);
+  Tensor tXsA = thr_s2r.partition_S(sA);                                                            // (CPY,CPY_M,CPY_K)
+  Tensor tXrA = thr_s2r.retile_D(tCrA);                                                             // (CPY,CPY_M,CPY_K)
+
+  uint32_t acc = 0;
+  Tensor tCrA_u32 = recast<uint32_t>(tCrA);
+  for (int it = 0; it < iterations; ++it) {
+    copy(s2r_copy, tXsA, tXrA);
+    CUTE_UNROLL
+    for (int i = 0; i < size(tCrA_u32); ++i) {
+      acc ^= tCrA_u32(i);
+    }
+    // Keep the loads inside the loop
+    asm volatile("" ::: "memory");
+  }
+  if (acc == 0x9e3779b9u) {
+    sink[0] = acc;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Host side
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+  bool help = false;
+  int footprint_mib = 512;
+  int repeats = 10;
+  int iterations = 4096;
+  int device = 0;
+  std::string output;
+
+  void parse(int argc, char const** args) {
+    cutlass::CommandLine cmd(argc, args);
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+    }
+    cmd.get_cmd_line_argument("footprint-mib", footprint_mib, 512);
+    cmd.get_cmd_line_argument("repeats", repeats, 10);
+    cmd.get_cmd_line_argument("iterations", iterations, 4096);
+    cmd.get_cmd_line_argument("device", device, 0);
+    cmd.get_cmd_line_argument("output", output);
+  }
+
+  std::ostream& print_usage(std::ostream& out) const {
+    out << "cutlass_microbench_copy\n\n"
+      << "  Sweeps CuTe copy atoms on the gmem->smem and smem->rmem paths and reports bandwidth.\n\n"
+      << "Options:\n\n"
+      << "  --help                  Display this usage statement.\n\n"
+      << "  --footprint-mib=<int>   Size of the gmem source in MiB. Keep it well above L2.\n\n"
+      << "  --repeats=<int>         Timed launches per case.\n\n"
+      << "  --iterations=<int>      Fragment reloads per CTA in the smem->rmem cases.\n\n"
+      << "  --device=<int>          CUDA device to run on.\n\n"
+      << "  --output=<file.json>    Write the JSON report to a file instead of stdout.\n\n";
+    return out;
+  }
+};
+
+struct Result {
+  std::string path;
+  std::string atom;
+  std::string smem_layout;
+  std::string box;
+  int vector_bytes = 0;
+  double gbps = 0;
+  bool passed = false;
+};
+
+struct Context {
+  Options options;
+  cudaDeviceProp prop;
+  Element* src = nullptr;
+  int rows = 0;
+  uint32_t* sink = nullptr;
+  std::vector<Result> results;
+};
+
+/// Times `repeats` launches of one case after a warmup launch
+template <class... KernelArgs, class... Args>
+void time_case(Context& ctx, Result result, double bytes_per_launch,
+               dim3 grid, int smem_size, void (*kernel)(KernelArgs...), Args... args) {
+  if (cudaFuncSetAttribute(kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, smem_size) != cudaSuccess) {
+    (void) cudaGetLastError();
+    ctx.results.push_back(result);
+    return;
+  }
+
+  cudaEvent_t events[2];
+  cudaEventCreate(&events[0]);
+  cudaEventCreate(&events[1]);
+
+  kernel<<<grid, kThreads, smem_size>>>(args...);
+  cudaEventRecord(events[0]);
+  for (int i = 0; i < ctx.options.repeats; ++i) {
+    kernel<<<grid, kThreads, smem_size>>>(args...);
+  }
+  cudaEventRecord(events[1]);
+
+  if (cudaDeviceSynchronize() == cudaSuccess && cudaGetLastError() == cudaSuccess) {
+    float elapsed_ms = 0;
+    cudaEventElapsedTime(&elapsed_ms, events[0], events[1]);
+    result.gbps = bytes_per_launch * ctx.options.repeats / (double(elapsed_ms) * 1.0e6);
+    result.passed = true;
+  }
+  else {
+    (void) cudaGetLastError();
+  }
+
+  cudaEventDestroy(events[0]);
+  cudaEventDestroy(events[1]);
+  ctx.results.push_back(result);
+}
+
+template <int TileM, int TileK>
+std::string box_name() {
+  return std::to_string(TileM) + "x" + std::to_string(TileK);
+}
+
+/// 128x64 tile, 128 threads, VectorElements contiguous elements per thread per copy
+template <class CopyOp, int VectorElements>
+void run_cp_async(Context& ctx, char const* atom_name) {
+  constexpr int TileM = 128;
+  constexpr int TileK = 64;
+  constexpr int ThrK = TileK / VectorElements;
+  constexpr int ThrM = kThreads / ThrK;
+
+  using SmemLayoutAtom = decltype(composition(Swizzle<3,3,3>{}, Layout<Shape<_8,Int<TileK>>, Stride<Int<TileK>,_1>>{}));
+  using SmemLayout = decltype(tile_to_shape(SmemLayoutAtom{}, Shape<Int<TileM>,Int<TileK>,Int<kStages>>{}));
+
+  auto tiled_copy = make_tiled_copy(Copy_Atom<CopyOp, Element>{},
+                                    Layout<Shape<Int<ThrM>,Int<ThrK>>, Stride<Int<ThrK>,_1>>{},
+                                    Layout<Shape<_1,Int<VectorElements>>>{});
+
+  Result result;
+  result.path = "gmem->smem";
+  result.atom = atom_name;
+  result.smem_layout = "Swizzle<3,3,3>";
+  result.box = box_name<TileM, TileK>();
+  result.vector_bytes = VectorElements * int(sizeof(Element));
+
+  int smem_size = int(cosize(SmemLayout{}) * sizeof(Element));
+  double bytes = double(ctx.rows) * kGmemCols * sizeof(Element);
+  time_case(ctx, result, bytes, dim3(ctx.prop.multiProcessorCount), smem_size,
+            &cp_async_g2s_kernel<SmemLayout, decltype(tiled_copy)>, ctx.src, ctx.rows, tiled_copy);
+}
+
+template <class SmemLayoutAtom, int TileM, int TileK>
+void run_tma_load(Context& ctx, char const* swizzle_name) {
+  using SmemLayout = decltype(tile_to_shape(SmemLayoutAtom{}, Shape<Int<TileM>,Int<TileK>,Int<kStages>>{}));
+
+  Tensor mA = make_tensor(make_gmem_ptr(ctx.src), make_shape(ctx.rows, kGmemCols), make_stride(kGmemCols, _1{}));
+  auto tma = make_tma_copy(SM90_TMA_LOAD{}, mA, SmemLayout{}(_,_,0));
+
+  Result result;
+  result.path = "gmem->smem";
+  result.atom = "SM90_TMA_LOAD";
+  result.smem_layout = swizzle_name;
+  result.box = box_name<TileM, TileK>();
+
+  int smem_size = int(sizeof(TmaSharedStorage<SmemLayout>));
+  double bytes = double(ctx.rows) * kGmemCols * sizeof(Element);
+  time_case(ctx, result, bytes, dim3(ctx.prop.multiProcessorCount), smem_size,
+            &tma_g2s_kernel<SmemLayout, decltype(tma)>, tma, ctx.rows);
+}
+
+template <int ChunkBytes>
+void run_bulk_copy(Context& ctx) {
+  Result result;
+  result.path = "gmem->smem";
+  result.atom = "SM90_BULK_COPY_G2S";
+  result.smem_layout = "linear";
+  result.box = std::to_string(ChunkBytes) + "B";
+
+  size_t total_bytes = size_t(ctx.rows) * kGmemCols * sizeof(Element);
+  int num_chunks = int(total_bytes / ChunkBytes);
+  int smem_size = int(sizeof(BulkSharedStorage<ChunkBytes>));
+  time_case(ctx, result, double(num_chunks) * ChunkBytes, dim3(ctx.prop.multiProcessorCount), smem_size,
+            &bulk_g2s_kernel<ChunkBytes>, reinterpret_cast<uint8_t const*>(ctx.src), num_chunks);
+}
+
+template <class CopyOp, bool Swizzled>
+void run_s2r(Context& ctx, char const* atom_name) {
+  using SmemLayout = cute::conditional_t<Swizzled,
+    decltype(tile_to_shape(composition(Swizzle<3,3,3>{}, Layout<Shape<_8,_64>, Stride<_64,_1>>{}), Shape<_64,_64>{})),
+    Layout<Shape<_64,_64>, Stride<_64,_1>>>;
+
+  Result result;
+  result.path = "smem->rmem";
+  result.atom = atom_name;
+  result.smem_layout = Swizzled ? "Swizzle<3,3,3>" : "row-major";
+  result.box = "64x64";
+
+  int num_ctas = ctx.prop.multiProcessorCount;
+  int smem_size = int(cosize(SmemLayout{}) * sizeof(Element));
+  double bytes = double(num_ctas) * ctx.options.iterations * 64 * 64 * sizeof(Element);
+  time_case(ctx, result, bytes, dim3(num_ctas), smem_size,
+            &s2r_kernel<SmemLayout, Copy_Atom<CopyOp, Element>>, ctx.options.iterations, ctx.sink);
+}
+
+void write_json(std::ostream& out, Context const& ctx) {
+  out << "{\n"
+      << "  \"device\": \"" << ctx.prop.name << "\",\n"
+      << "  \"compute_capability\": " << ctx.prop.major * 10 + ctx.prop.minor << ",\n"
+      << "  \"cuda_runtime_version\": " << CUDART_VERSION << ",\n"
+      << "  \"element\": \"f16\",\n"
+      << "  \"stages\": " << kStages << ",\n"
+      << "  \"results\": [\n";
+  for (size_t i = 0; i < ctx.results.size(); ++i) {
+    Result const& r = ctx.results[i];
+    out << "    {\"path\": \"" << r.path << "\""
+        << ", \"atom\": \"" << r.atom << "\""
+        << ", \"smem_layout\": \"" << r.smem_layout << "\""
+        << ", \"box\": \"" << r.box << "\""
+        << ", \"vector_bytes\": " << r.vector_bytes
+        << ", \"passed\": " << (r.passed ? "true" : "false")
+        << ", \"gbps\": " << r.gbps
+        << "}" << (i + 1 < ctx.results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n"
+      << "}\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const** argv) {
+  Context ctx;
+  ctx.options.parse(argc, argv);
+  if (ctx.options.help) {
+    ctx.options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (cudaSetDevice(ctx.options.device) != cudaSuccess) {
+    std::cerr << "Failed to select device " << ctx.options.device << std::endl;
+    return -1;
+  }
+  cudaGetDeviceProperties(&ctx.prop, ctx.options.device);
+  if (ctx.prop.major < 9) {
+    std::cerr << "cutlass_microbench_copy requires a device with compute capability 90 or higher." << std::endl;
+    return 0;
+  }
+
+  // Whole 256-row bands keep every tile shape below in bounds
+  size_t footprint = size_t(ctx.options.footprint_mib) << 20;
+  ctx.rows = int(footprint / (kGmemCols * sizeof(Element))) / 256 * 256;
+  if (ctx.rows == 0 ||
+      cudaMalloc(&ctx.src, size_t(ctx.rows) * kGmemCols * sizeof(Element)) != cudaSuccess ||
+      cudaMalloc(&ctx.sink, sizeof(uint32_t)) != cudaSuccess) {
+    std::cerr << "Failed to allocate the source buffer." << std::endl;
+    return -1;
+  }
+  cudaMemset(ctx.src, 0, size_t(ctx.rows) * kGmemCols * sizeof(Element));
+
+  run_cp_async<SM80_CP_ASYNC_CACHEGLOBAL<uint128_t>, 8>(ctx, "SM80_CP_ASYNC_CACHEGLOBAL<uint128_t>");
+  run_cp_async<SM80_CP_ASYNC_CACHEALWAYS<uint128_t>, 8>(ctx, "SM80_CP_ASYNC_CACHEALWAYS<uint128_t>");
+  run_cp_async<SM80_CP_ASYNC_CACHEALWAYS<uint64_t>, 4>(ctx, "SM80_CP_ASYNC_CACHEALWAYS<uint64_t>");
+  run_cp_async<SM80_CP_ASYNC_CACHEALWAYS<uint32_t>, 2>(ctx, "SM80_CP_ASYNC_CACHEALWAYS<uint32_t>");
+
+  run_tma_load<GMMA::Layout_K_INTER_Atom<Element>, 128, 64>(ctx, "K_INTER");
+  run_tma_load<GMMA::Layout_K_SW32_Atom<Element>,  128, 64>(ctx, "K_SW32");
+  run_tma_load<GMMA::Layout_K_SW64_Atom<Element>,  128, 64>(ctx, "K_SW64");
+  run_tma_load<GMMA::Layout_K_SW128_Atom<Element>,  64, 64>(ctx, "K_SW128");
+  run_tma_load<GMMA::Layout_K_SW128_Atom<Element>, 128, 64>(ctx, "K_SW128");
+  run_tma_load<GMMA::Layout_K_SW128_Atom<Element>, 256, 64>(ctx, "K_SW128");
+
+  run_bulk_copy< 4096>(ctx);
+  run_bulk_copy< 8192>(ctx);
+  run_bulk_copy<16384>(ctx);
+  run_bulk_copy<32768>(ctx);
+
+  run_s2r<SM75_U32x4_LDSM_N,       true >(ctx, "SM75_U32x4_LDSM_N");
+  run_s2r<SM75_U32x4_LDSM_N,       false>(ctx, "SM75_U32x4_LDSM_N");
+  run_s2r<SM75_U32x2_LDSM_N,       true >(ctx, "SM75_U32x2_LDSM_N");
+  run_s2r<SM75_U32x1_LDSM_N,       true >(ctx, "SM75_U32x1_LDSM_N");
+  run_s2r<UniversalCopy<uint32_t>, true >(ctx, "UniversalCopy<uint32_t>");
+  run_s2r<UniversalCopy<uint32_t>, false>(ctx, "UniversalCopy<uint32_t>");
+
+  bool passed = true;
+  for (Result const& r : ctx.results) {
+    passed = passed && r.passed;
+  }
+
+  if (ctx.options.output.empty()) {
+    write_json(std::cout, ctx);
+  }
+  else {
+    std::ofstream out(ctx.options.output);
+    write_json(out, ctx);
+  }
+
+  cudaFree(ctx.src);
+  cudaFree(ctx.sink);
+  return passed ? 0 : -1;
+}
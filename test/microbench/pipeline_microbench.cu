@@ -0,0 +1,491 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Latency microbenchmarks for the SM90 pipeline and barrier primitives.
+
+    Each case runs a producer/consumer (or barrier) loop that does no other work. It reports
+    the device cycles per iteration measured on the SM, plus the wall time per iteration from CUDA
+    events. Results are printed as JSON to stdout or written to --output.
+
+    Usage:
+
+      $ cutlass_microbench [--iterations=<int>] [--warmup=<int>] [--device=<int>] [--output=<file.json>]
+*/
+
+// producer_commit(stage, bytes) stands in for the TMA transaction only when this is set
+#define CUTLASS_UNIT_TEST_PIPELINE true
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/cluster_launch.hpp"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/pipeline/pipeline.hpp"
+
+#include "cutlass/util/command_line.h"
+
+using namespace cute;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr int kThreadsPerWarpGroup = 128;
+
+/// Records the cycles spent in the timed loop of one CTA
+CUTLASS_DEVICE
+void record_cycles(long long* cycles, long long start, long long stop) {
+  uint32_t const block_idx = blockIdx.x + blockIdx.y * gridDim.x;
+  cycles[block_idx] = stop - start;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Kernels
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// PipelineTmaAsync: one producer thread in WG0, one consumer warp group in WG1. The producer
+/// commits the transaction bytes the multicast TMA loads of a cluster would deliver.
+template <class ClusterShape, uint32_t Stages>
+__global__ static
+void pipeline_tma_async_kernel(uint32_t iterations, long long* cycles) {
+  using Pipeline = cutlass::PipelineTmaAsync<Stages>;
+  using PipelineState = cutlass::PipelineState<Stages>;
+
+  extern __shared__ char shared_memory[];
+  auto& storage = *reinterpret_cast<typename Pipeline::SharedStorage*>(shared_memory);
+
+  int warp_group_idx = threadIdx.x / kThreadsPerWarpGroup;
+  int warp_group_thread_idx = threadIdx.x % kThreadsPerWarpGroup;
+  uint32_t const num_producers = size<0>(ClusterShape{}) + size<1>(ClusterShape{}) - 1;
+  uint32_t const per_cta_bytes = sizeof(uint32_t);
+
+  typename Pipeline::Params params;
+  params.transaction_bytes = per_cta_bytes * num_producers;
+  params.role = warp_group_idx == 0 ? Pipeline::ThreadCategory::Producer : Pipeline::ThreadCategory::Consumer;
+  params.is_leader = warp_group_idx == 0 && warp_group_thread_idx == 0;
+  params.num_consumers = kThreadsPerWarpGroup;
+  Pipeline pipeline(storage, params, ClusterShape{});
+
+  __syncthreads();
+  cute::cluster_arrive_relaxed();
+  cute::cluster_wait();
+
+  if (warp_group_idx == 0) {
+    if (warp_group_thread_idx == 0) {
+      PipelineState write_state = cutlass::make_producer_start_state<Pipeline>();
+      for (uint32_t i = 0; i < iterations; ++i) {
+        pipeline.producer_acquire(write_state);
+        pipeline.producer_commit(write_state, per_cta_bytes);
+        ++write_state;
+      }
+      pipeline.producer_tail(write_state);
+    }
+  }
+  else {
+    PipelineState read_state;
+    long long start = clock64();
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (uint32_t i = 0; i < iterations; ++i) {
+      pipeline.consumer_wait(read_state);
+      pipeline.consumer_release(read_state);
+      ++read_state;
+    }
+    long long stop = clock64();
+    if (warp_group_thread_idx == 0) {
+      record_cycles(cycles, start, stop);
+    }
+  }
+
+  // Keep the remote barriers alive until every CTA of the cluster is done
+  cute::cluster_arrive();
+  cute::cluster_wait();
+}
+
+/// PipelineAsync: a producer warp group and a consumer warp group, every thread arrives
+template <class ClusterShape, uint32_t Stages>
+__global__ static
+void pipeline_async_kernel(uint32_t iterations, long long* cycles) {
+  using Pipeline = cutlass::PipelineAsync<Stages>;
+  using PipelineState = cutlass::PipelineState<Stages>;
+
+  extern __shared__ char shared_memory[];
+  auto& storage = *reinterpret_cast<typename Pipeline::SharedStorage*>(shared_memory);
+
+  int warp_group_idx = threadIdx.x / kThreadsPerWarpGroup;
+  int warp_group_thread_idx = threadIdx.x % kThreadsPerWarpGroup;
+
+  typename Pipeline::Params params;
+  params.role = warp_group_idx == 0 ? Pipeline::ThreadCategory::Producer : Pipeline::ThreadCategory::Consumer;
+  params.producer_arv_count = kThreadsPerWarpGroup;
+  params.consumer_arv_count = kThreadsPerWarpGroup;
+  Pipeline pipeline(storage, params);
+
+  __syncthreads();
+
+  if (warp_group_idx == 0) {
+    PipelineState write_state = cutlass::make_producer_start_state<Pipeline>();
+    for (uint32_t i = 0; i < iterations; ++i) {
+      pipeline.producer_acquire(write_state);
+      pipeline.producer_commit(write_state);
+      ++write_state;
+    }
+  }
+  else {
+    PipelineState read_state;
+    long long start = clock64();
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (uint32_t i = 0; i < iterations; ++i) {
+      pipeline.consumer_wait(read_state);
+      pipeline.consumer_release(read_state);
+      ++read_state;
+    }
+    long long stop = clock64();
+    if (warp_group_thread_idx == 0) {
+      record_cycles(cycles, start, stop);
+    }
+  }
+}
+
+/// OrderedSequenceBarrier: two warp groups hand a token back and forth, as the ping-pong
+/// kernels do between their math warp groups. One iteration is one handoff per group.
+template <class ClusterShape, uint32_t Stages>
+__global__ static
+void ordered_sequence_barrier_kernel(uint32_t iterations, long long* cycles) {
+  using SequenceBarrier = cutlass::OrderedSequenceBarrier<Stages, 2>;
+
+  extern __shared__ char shared_memory[];
+  auto& storage = *reinterpret_cast<typename SequenceBarrier::SharedStorage*>(shared_memory);
+
+  typename SequenceBarrier::Params params;
+  params.group_id = threadIdx.x / kThreadsPerWarpGroup;
+  params.group_size = kThreadsPerWarpGroup;
+  SequenceBarrier barrier(storage, params);
+
+  __syncthreads();
+
+  long long start = clock64();
+  CUTLASS_PRAGMA_NO_UNROLL
+  for (uint32_t i = 0; i < iterations; ++i) {
+    barrier.wait();
+    barrier.arrive();
+  }
+  long long stop = clock64();
+  if (threadIdx.x == 0) {
+    record_cycles(cycles, start, stop);
+  }
+}
+
+/// Cluster barrier: arrive + wait across all CTAs of the cluster
+template <class ClusterShape, uint32_t Stages>
+__global__ static
+void cluster_barrier_kernel(uint32_t iterations, long long* cycles) {
+  cute::cluster_arrive_relaxed();
+  cute::cluster_wait();
+
+  long long start = clock64();
+  CUTLASS_PRAGMA_NO_UNROLL
+  for (uint32_t i = 0; i < iterations; ++i) {
+    cute::cluster_arrive();
+    cute::cluster_wait();
+  }
+  long long stop = clock64();
+  if (threadIdx.x == 0) {
+    record_cycles(cycles, start, stop);
+  }
+}
+
+/// Named barrier: bar.sync over every thread of the CTA
+template <class ClusterShape, uint32_t Stages>
+__global__ static
+void named_barrier_kernel(uint32_t iterations, long long* cycles) {
+  __syncthreads();
+
+  long long start = clock64();
+  CUTLASS_PRAGMA_NO_UNROLL
+  for (uint32_t i = 0; i < iterations; ++i) {
+    cutlass::arch::NamedBarrier::arrive_and_wait(blockDim.x, 0);
+  }
+  long long stop = clock64();
+  if (threadIdx.x == 0) {
+    record_cycles(cycles, start, stop);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Host side
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+  bool help = false;
+  int iterations = 10000;
+  int warmup = 2;
+  int device = 0;
+  std::string output;
+
+  void parse(int argc, char const** args) {
+    cutlass::CommandLine cmd(argc, args);
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+    }
+    cmd.get_cmd_line_argument("iterations", iterations, 10000);
+    cmd.get_cmd_line_argument("warmup", warmup, 2);
+    cmd.get_cmd_line_argument("device", device, 0);
+    cmd.get_cmd_line_argument("output", output);
+  }
+
+  std::ostream& print_usage(std::ostream& out) const {
+    out << "cutlass_microbench\n\n"
+      << "  Measures per-stage latency of the SM90 pipeline and barrier primitives.\n\n"
+      << "Options:\n\n"
+      << "  --help                  Display this usage statement.\n\n"
+      << "  --iterations=<int>      Iterations of the timed loop per case.\n\n"
+      << "  --warmup=<int>          Untimed launches per case before the measured one.\n\n"
+      << "  --device=<int>          CUDA device to run on.\n\n"
+      << "  --output=<file.json>    Write the JSON report to a file instead of stdout.\n\n";
+    return out;
+  }
+};
+
+struct Result {
+  std::string primitive;
+  int stages = 0;
+  int cluster_m = 1;
+  int cluster_n = 1;
+  int threads = 0;
+  double cycles_per_iteration = 0;
+  double ns_per_iteration = 0;
+  bool passed = false;
+};
+
+using KernelFn = void (*)(uint32_t, long long*);
+
+/// Launches one case (warmup + one timed launch) and reduces the per-CTA cycle counts
+Result run_case(
+    Options const& options,
+    char const* primitive, KernelFn kernel,
+    int stages, int cluster_m, int cluster_n, int threads, int smem_size) {
+
+  Result result;
+  result.primitive = primitive;
+  result.stages = stages;
+  result.cluster_m = cluster_m;
+  result.cluster_n = cluster_n;
+  result.threads = threads;
+
+  dim3 grid(cluster_m, cluster_n, 1);
+  dim3 cluster(cluster_m, cluster_n, 1);
+  dim3 block(threads, 1, 1);
+  int num_ctas = cluster_m * cluster_n;
+
+  long long* cycles_d = nullptr;
+  if (cudaMalloc(&cycles_d, sizeof(long long) * num_ctas) != cudaSuccess) {
+    return result;
+  }
+  if (cudaFuncSetAttribute(kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, smem_size) != cudaSuccess) {
+    cudaFree(cycles_d);
+    return result;
+  }
+
+  uint32_t iterations = uint32_t(options.iterations);
+  void* kernel_params[] = {&iterations, &cycles_d};
+  auto launch = [&]() {
+    return cutlass::ClusterLauncher::launch(
+      grid, cluster, block, smem_size, nullptr, (void const*) kernel, kernel_params);
+  };
+
+  cudaEvent_t events[2];
+  cudaEventCreate(&events[0]);
+  cudaEventCreate(&events[1]);
+
+  bool ok = true;
+  for (int i = 0; i < options.warmup && ok; ++i) {
+    ok = launch() == cutlass::Status::kSuccess;
+  }
+  ok = ok && cudaEventRecord(events[0]) == cudaSuccess;
+  ok = ok && launch() == cutlass::Status::kSuccess;
+  ok = ok && cudaEventRecord(events[1]) == cudaSuccess;
+  ok = ok && cudaDeviceSynchronize() == cudaSuccess;
+
+  if (ok) {
+    float elapsed_ms = 0;
+    cudaEventElapsedTime(&elapsed_ms, events[0], events[1]);
+    std::vector<long long> cycles_h(num_ctas);
+    cudaMemcpy(cycles_h.data(), cycles_d, sizeof(long long) * num_ctas, cudaMemcpyDeviceToHost);
+
+    // The slowest CTA bounds the stage time seen by the kernel
+    long long max_cycles = 0;
+    for (long long c : cycles_h) {
+      max_cycles = std::max(max_cycles, c);
+    }
+    result.cycles_per_iteration = double(max_cycles) / double(iterations);
+    result.ns_per_iteration = double(elapsed_ms) * 1.0e6 / double(iterations);
+    result.passed = true;
+  }
+  else {
+    (void) cudaGetLastError();
+  }
+
+  cudaEventDestroy(events[0]);
+  cudaEventDestroy(events[1]);
+  cudaFree(cycles_d);
+  return result;
+}
+
+template <int ClusterM, int ClusterN, uint32_t Stages>
+void run_pipeline_tma_async(Options const& options, std::vector<Result>& results) {
+  using ClusterShape = Shape<Int<ClusterM>, Int<ClusterN>, _1>;
+  results.push_back(run_case(options, "PipelineTmaAsync",
+    &pipeline_tma_async_kernel<ClusterShape, Stages>, Stages, ClusterM, ClusterN, 2 * kThreadsPerWarpGroup,
+    int(sizeof(typename cutlass::PipelineTmaAsync<Stages>::SharedStorage))));
+}
+
+template <uint32_t Stages>
+void run_single_cta_pipelines(Options const& options, std::vector<Result>& results) {
+  using ClusterShape = Shape<_1,_1,_1>;
+  results.push_back(run_case(options, "PipelineAsync",
+    &pipeline_async_kernel<ClusterShape, Stages>, Stages, 1, 1, 2 * kThreadsPerWarpGroup,
+    int(sizeof(typename cutlass::PipelineAsync<Stages>::SharedStorage))));
+  results.push_back(run_case(options, "OrderedSequenceBarrier",
+    &ordered_sequence_barrier_kernel<ClusterShape, Stages>, Stages, 1, 1, 2 * kThreadsPerWarpGroup,
+    int(sizeof(typename cutlass::OrderedSequenceBarrier<Stages, 2>::SharedStorage))));
+}
+
+template <int ClusterM, int ClusterN>
+void run_cluster_barrier(Options const& options, std::vector<Result>& results) {
+  using ClusterShape = Shape<Int<ClusterM>, Int<ClusterN>, _1>;
+  results.push_back(run_case(options, "ClusterBarrier",
+    &cluster_barrier_kernel<ClusterShape, 0>, 0, ClusterM, ClusterN, kThreadsPerWarpGroup, 0));
+}
+
+void run_named_barrier(Options const& options, std::vector<Result>& results, int threads) {
+  results.push_back(run_case(options, "NamedBarrier",
+    &named_barrier_kernel<Shape<_1,_1,_1>, 0>, 0, 1, 1, threads, 0));
+}
+
+void write_json(std::ostream& out, cudaDeviceProp const& prop, Options const& options, std::vector<Result> const& results) {
+  out << "{\n"
+      << "  \"device\": \"" << prop.name << "\",\n"
+      << "  \"compute_capability\": " << prop.major * 10 + prop.minor << ",\n"
+      << "  \"cuda_runtime_version\": " << CUDART_VERSION << ",\n"
+      << "  \"iterations\": " << options.iterations << ",\n"
+      << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    Result const& r = results[i];
+    out << "    {\"primitive\": \"" << r.primitive << "\""
+        << ", \"stages\": " << r.stages
+        << ", \"cluster\": [" << r.cluster_m << ", " << r.cluster_n << "]"
+        << ", \"threads\": " << r.threads
+        << ", \"passed\": " << (r.passed ? "true" : "false")
+        << ", \"cycles_per_iteration\": " << r.cycles_per_iteration
+        << ", \"ns_per_iteration\": " << r.ns_per_iteration
+        << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n"
+      << "}\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const** argv) {
+  Options options;
+  options.parse(argc, argv);
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (cudaSetDevice(options.device) != cudaSuccess) {
+    std::cerr << "Failed to select device " << options.device << std::endl;
+    return -1;
+  }
+  cudaDeviceProp prop;
+  cudaGetDeviceProperties(&prop, options.device);
+  if (prop.major < 9) {
+    std::cerr << "cutlass_microbench requires a device with compute capability 90 or higher." << std::endl;
+    return 0;
+  }
+
+#if defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
+  std::vector<Result> results;
+
+  run_pipeline_tma_async<1, 1, 2>(options, results);
+  run_pipeline_tma_async<1, 1, 4>(options, results);
+  run_pipeline_tma_async<1, 1, 8>(options, results);
+  run_pipeline_tma_async<2, 1, 4>(options, results);
+  run_pipeline_tma_async<1, 2, 4>(options, results);
+  run_pipeline_tma_async<2, 2, 4>(options, results);
+  run_pipeline_tma_async<4, 1, 4>(options, results);
+
+  run_single_cta_pipelines<2>(options, results);
+  run_single_cta_pipelines<4>(options, results);
+  run_single_cta_pipelines<8>(options, results);
+
+  run_cluster_barrier<1, 1>(options, results);
+  run_cluster_barrier<2, 1>(options, results);
+  run_cluster_barrier<1, 2>(options, results);
+  run_cluster_barrier<2, 2>(options, results);
+  run_cluster_barrier<4, 1>(options, results);
+
+  run_named_barrier(options, results, 128);
+  run_named_barrier(options, results, 256);
+  run_named_barrier(options, results, 384);
+
+  bool passed = true;
+  for (Result const& r : results) {
+    passed = passed && r.passed;
+  }
+
+  if (options.output.empty()) {
+    write_json(std::cout, prop, options, results);
+  }
+  else {
+    std::ofstream out(options.output);
+    write_json(out, prop, options, results);
+  }
+  return passed ? 0 : -1;
+#else
+  std::cerr << "cutlass_microbench requires CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED." << std::endl;
+  return 0;
+#endif
+}
@@ -0,0 +1,115 @@
+#################################################################################################
+#
+# Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Tests exporting CUTLASS kernels as a shared library with a C ABI
+"""
+
+import ctypes
+import json
+import os
+import tempfile
+import unittest
+
+import cutlass
+
+if cutlass.utils.datatypes.is_torch_available():
+    import torch
+
+
+def _run_gemm(lib, symbol: str, A, B, C, D, alpha: float, beta: float):
+    """
+    Runs the GEMM exported by ``lib`` under ``symbol`` on the current PyTorch stream
+    """
+    M, K = A.shape
+    N = B.shape[1]
+
+    workspace_size = getattr(lib, f"{symbol}_workspace_size")
+    workspace_size.restype = ctypes.c_size_t
+    workspace = torch.empty((workspace_size(M, N, K, 1),), dtype=torch.uint8, device='cuda')
+
+    run = getattr(lib, f"{symbol}_run")
+    run.argtypes = [ctypes.c_int] * 4 + [ctypes.c_void_p] * 4 + [ctypes.c_float] * 2 + [ctypes.c_void_p] * 2
+    return run(M, N, K, 1,
+               A.data_ptr(), B.data_ptr(), C.data_ptr() if C is not None else None, D.data_ptr(),
+               alpha, beta, workspace.data_ptr(), torch.cuda.current_stream().cuda_stream)
+
+
+@unittest.skipIf(not cutlass.utils.datatypes.is_torch_available(), 'PyTorch must be available to run C library export tests')
+class CLibraryExportTest(unittest.TestCase):
+
+    def test_gemm(self):
+        dtype = torch.float16
+        plan = cutlass.op.Gemm(element=dtype, layout=cutlass.LayoutType.RowMajor)
+        ops = {
+            "gemm_f16": plan.construct(),
+            "gemm_f16_alt": plan.construct(plan.tile_descriptions()[-1]),
+        }
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            lib_file = cutlass.emit.c_library(ops, "gemm_lib", cc=plan.cc, sourcedir=tmpdir, build=True,
+                                              problem_shapes={"gemm_f16": [(1024, 256, 512)]})
+
+            with open(os.path.join(tmpdir, "gemm_lib_manifest.json"), "r") as infile:
+                manifest = json.load(infile)
+            assert [op["symbol"] for op in manifest["operations"]] == list(ops.keys())
+            assert manifest["operations"][0]["problem_shapes"] == [[1024, 256, 512]]
+            assert manifest["operations"][1]["problem_shapes"] == []
+
+            lib = ctypes.CDLL(lib_file)
+
+            assert lib.gemm_lib_abi_version() == manifest["abi_version"]
+
+            A, B, C = [torch.randint(-3, 3, size, device='cuda').to(dtype) for size in [(1024, 512), (512, 256), (1024, 256)]]
+            for symbol in ops.keys():
+                assert getattr(lib, f"{symbol}_can_implement")(1024, 256, 512, 1) == 0
+
+                D = torch.empty_like(C)
+                assert _run_gemm(lib, symbol, A, B, None, D, 1.0, 0.0) == 0
+                torch.cuda.synchronize()
+                assert torch.allclose(D, A @ B)
+
+                alpha = 2.0
+                beta = -1.0
+                assert _run_gemm(lib, symbol, A, B, C, D, alpha, beta) == 0
+                torch.cuda.synchronize()
+                assert torch.allclose(D, (A @ B) * alpha + (beta * C))
+
+    def test_unsupported_operation(self):
+        plan = cutlass.op.GroupedGemm(element=torch.float16, layout=cutlass.LayoutType.RowMajor)
+        with tempfile.TemporaryDirectory() as tmpdir:
+            with self.assertRaises(Exception):
+                cutlass.emit.c_library({"grouped": plan.construct()}, "grouped_lib", cc=plan.cc, sourcedir=tmpdir)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -63,6 +63,52 @@ int CutlassUnitTestProblemCount();
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Reads environment variables `CUTLASS_UNIT_TEST_PERF_BASELINE` and `CUTLASS_UNIT_TEST_PERF_OUTPUT`.
+//  When either is set, testbeds that support it time each verified configuration.
+bool CutlassUnitTestPerfRegressionEnabled();
+
+/// Number of timed iterations per configuration, from `CUTLASS_UNIT_TEST_PERF_ITERATIONS`
+int CutlassUnitTestPerfIterations();
+
+/// Records the throughput of one configuration of the current test and fails the test if it is
+//  slower than the baseline for this device by more than `CUTLASS_UNIT_TEST_PERF_TOLERANCE`
+bool CutlassUnitTestCheckPerf(std::string const &config, double tflops);
+
+/// Runs `launch` once to warm up, then returns the average time in milliseconds of
+//  `CutlassUnitTestPerfIterations()` further calls. Returns a negative value if a launch fails.
+template <typename Launch>
+double CutlassUnitTestTimeKernel(Launch &&launch) {
+  if (!launch()) {
+    return -1;
+  }
+
+  cudaEvent_t events[2];
+  cudaEventCreate(&events[0]);
+  cudaEventCreate(&events[1]);
+
+  int iterations = CutlassUnitTestPerfIterations();
+  bool launched = true;
+  cudaEventRecord(events[0]);
+  for (int iter = 0; iter < iterations && launched; ++iter) {
+    launched = launch();
+  }
+  cudaEventRecord(events[1]);
+
+  float elapsed_ms = 0;
+  if (launched && cudaEventSynchronize(events[1]) == cudaSuccess) {
+    cudaEventElapsedTime(&elapsed_ms, events[0], events[1]);
+  }
+  else {
+    launched = false;
+  }
+
+  cudaEventDestroy(events[0]);
+  cudaEventDestroy(events[1]);
+  return launched ? double(elapsed_ms) / iterations : -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 // active test macro
 #define CUTLASS_TEST_LEVEL_ACTIVE(LEVEL,NAME_STATIC,NAME_DYNAMIC,...) \
     TEST(NAME_STATIC,L##LEVEL##_##NAME_DYNAMIC) __VA_ARGS__
@@ -0,0 +1,317 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Opt-in performance regression checks for the device-level unit test testbeds.
+
+    The mode is enabled by setting either of the following environment variables:
+
+      CUTLASS_UNIT_TEST_PERF_BASELINE=<file.json>   Baseline to compare against
+      CUTLASS_UNIT_TEST_PERF_OUTPUT=<file.json>     File the measured results are merged into
+
+    Optional settings:
+
+      CUTLASS_UNIT_TEST_PERF_TOLERANCE=<float>      Allowed relative slowdown (default: 0.05)
+      CUTLASS_UNIT_TEST_PERF_ITERATIONS=<int>       Timed iterations per configuration (default: 20)
+
+    Both files map a device name to the TFLOP/s measured for each "<TestSuite>.<Test>/<config>" key:
+
+      {
+        "NVIDIA H100 80GB HBM3": {
+          "SM90_Device_Gemm_f16t_f16n_f32n_tensor_op_gmma_f32.128x128x64/m4608_n4608_k8192_l1": 612.4
+        }
+      }
+
+    Configurations without a baseline entry are recorded but never fail.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <cuda_runtime_api.h>
+
+#include "cutlass_unit_test.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// TFLOP/s keyed by device name, then by test configuration
+using PerfTable = std::map<std::string, std::map<std::string, double>>;
+
+/// Minimal reader for the two-level object of numbers used by the baseline files
+class PerfTableReader {
+public:
+  explicit PerfTableReader(std::string text): text_(std::move(text)) {}
+
+  bool read(PerfTable &table) {
+    if (!consume('{')) {
+      return false;
+    }
+    if (consume('}')) {
+      return true;
+    }
+    do {
+      std::string device;
+      if (!read_string(device) || !consume(':') || !consume('{')) {
+        return false;
+      }
+      auto &entries = table[device];
+      if (!consume('}')) {
+        do {
+          std::string key;
+          double value = 0;
+          if (!read_string(key) || !consume(':') || !read_number(value)) {
+            return false;
+          }
+          entries[key] = value;
+        } while (consume(','));
+        if (!consume('}')) {
+          return false;
+        }
+      }
+    } while (consume(','));
+    return consume('}');
+  }
+
+private:
+  std::string text_;
+  size_t pos_ = 0;
+
+  void skip_whitespace() {
+    while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+      ++pos_;
+    }
+  }
+
+  bool consume(char c) {
+    skip_whitespace();
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  bool read_string(std::string &out) {
+    if (!consume('"')) {
+      return false;
+    }
+    out.clear();
+    while (pos_ < text_.size() && text_[pos_] != '"') {
+      if (text_[pos_] == '\\' && pos_ + 1 < text_.size()) {
+        ++pos_;
+      }
+      out.push_back(text_[pos_++]);
+    }
+    return consume('"');
+  }
+
+  bool read_number(double &out) {
+    skip_whitespace();
+    char const *begin = text_.c_str() + pos_;
+    char *end = nullptr;
+    out = std::strtod(begin, &end);
+    if (end == begin) {
+      return false;
+    }
+    pos_ += size_t(end - begin);
+    return true;
+  }
+};
+
+bool read_perf_table(std::string const &path, PerfTable &table) {
+  std::ifstream file(path);
+  if (!file.good()) {
+    return false;
+  }
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return PerfTableReader(ss.str()).read(table);
+}
+
+void write_json_string(std::ostream &out, std::string const &str) {
+  out << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      out << '\\';
+    }
+    out << c;
+  }
+  out << '"';
+}
+
+void write_perf_table(std::string const &path, PerfTable const &table) {
+  std::ofstream out(path);
+  out << "{\n";
+  size_t device_idx = 0;
+  for (auto const &device : table) {
+    out << "  ";
+    write_json_string(out, device.first);
+    out << ": {\n";
+    size_t entry_idx = 0;
+    for (auto const &entry : device.second) {
+      out << "    ";
+      write_json_string(out, entry.first);
+      out << ": " << std::fixed << std::setprecision(3) << entry.second
+          << (++entry_idx < device.second.size() ? "," : "") << "\n";
+    }
+    out << "  }" << (++device_idx < table.size() ? "," : "") << "\n";
+  }
+  out << "}\n";
+}
+
+char const *get_env(char const *name) {
+  char const *value = std::getenv(name);
+  return (value && *value) ? value : nullptr;
+}
+
+/// Loads the baseline on first use and merges the measurements into the output file at exit
+class PerfRegressionState {
+public:
+  std::string baseline_path;
+  std::string output_path;
+  double tolerance = 0.05;
+  int iterations = 20;
+  std::string device_name;
+  PerfTable baseline;
+  std::map<std::string, double> measured;
+
+  PerfRegressionState() {
+    if (char const *path = get_env("CUTLASS_UNIT_TEST_PERF_BASELINE")) {
+      baseline_path = path;
+    }
+    if (char const *path = get_env("CUTLASS_UNIT_TEST_PERF_OUTPUT")) {
+      output_path = path;
+    }
+    if (char const *value = get_env("CUTLASS_UNIT_TEST_PERF_TOLERANCE")) {
+      tolerance = std::stod(value);
+    }
+    if (char const *value = get_env("CUTLASS_UNIT_TEST_PERF_ITERATIONS")) {
+      iterations = std::max(1, std::stoi(value));
+    }
+
+    if (!enabled()) {
+      return;
+    }
+
+    device_name = GetCudaDevice().name;
+
+    if (!baseline_path.empty() && !read_perf_table(baseline_path, baseline)) {
+      std::cerr << "*** Warning: could not read performance baseline '" << baseline_path
+                << "'. Measurements will be recorded without checks." << std::endl;
+      baseline.clear();
+    }
+  }
+
+  ~PerfRegressionState() {
+    if (output_path.empty() || measured.empty()) {
+      return;
+    }
+    PerfTable table;
+    read_perf_table(output_path, table);
+    for (auto const &entry : measured) {
+      table[device_name][entry.first] = entry.second;
+    }
+    write_perf_table(output_path, table);
+  }
+
+  bool enabled() const {
+    return !baseline_path.empty() || !output_path.empty();
+  }
+
+  /// Returns a pointer to the baseline of the given key on this device, if any
+  double const *find_baseline(std::string const &key) const {
+    auto device = baseline.find(device_name);
+    if (device == baseline.end()) {
+      return nullptr;
+    }
+    auto entry = device->second.find(key);
+    return entry == device->second.end() ? nullptr : &entry->second;
+  }
+};
+
+PerfRegressionState &perf_regression_state() {
+  static PerfRegressionState state;
+  return state;
+}
+
+std::string current_test_name() {
+  ::testing::TestInfo const *info = ::testing::UnitTest::GetInstance()->current_test_info();
+  if (!info) {
+    return "unknown";
+  }
+  return std::string(info->test_suite_name()) + "." + info->name();
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CutlassUnitTestPerfRegressionEnabled() {
+  return perf_regression_state().enabled();
+}
+
+int CutlassUnitTestPerfIterations() {
+  return perf_regression_state().iterations;
+}
+
+bool CutlassUnitTestCheckPerf(std::string const &config, double tflops) {
+  PerfRegressionState &state = perf_regression_state();
+  std::string key = current_test_name() + "/" + config;
+  state.measured[key] = tflops;
+
+  std::cout << "[ PERF     ] " << key << ": " << std::fixed << std::setprecision(2) << tflops << " TFLOP/s";
+
+  double const *baseline = state.find_baseline(key);
+  if (!baseline) {
+    std::cout << " (no baseline)" << std::endl;
+    return true;
+  }
+
+  double ratio = *baseline > 0 ? tflops / *baseline : 1.0;
+  std::cout << " (baseline " << *baseline << ", " << std::setprecision(1) << ratio * 100.0 << "%)" << std::endl;
+
+  bool passed = ratio >= 1.0 - state.tolerance;
+  EXPECT_TRUE(passed) << "Performance regression on " << state.device_name << ": " << key
+                      << " ran at " << tflops << " TFLOP/s, baseline is " << *baseline
+                      << " TFLOP/s, tolerance is " << state.tolerance * 100.0 << "%";
+  return passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -781,6 +781,19 @@ bool TestAllConv2d(
     2.0
   };
 
+  // stream-K splits the k-dimension across a single wave of threadblocks
+  if (ImplicitGemm::kSupportsStreamK) {
+    passed = testbed.run(
+      conv2d_split_k_test_size.reset_split_k_slices(1),
+      cutlass::conv::SplitKMode::kStreamK,
+      cutlass::from_real<typename ImplicitGemm::ElementCompute>(problem_alpha[0]),
+      cutlass::from_real<typename ImplicitGemm::ElementCompute>(problem_beta[0]));
+
+    if (!passed) {
+      return false;
+    }
+  }
+
   for (auto split_k_mode : split_k_modes) {
     for (auto split_k_slice : split_k_slices) {
       for (auto alpha : problem_alpha) {
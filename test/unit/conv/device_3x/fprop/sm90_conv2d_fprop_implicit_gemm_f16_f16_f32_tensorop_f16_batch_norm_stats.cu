@@ -0,0 +1,269 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/conv/device/conv_universal_adapter.hpp"
+#include "cutlass/conv/kernel/conv_universal.hpp"
+#include "cutlass/conv/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "cutlass/util/device_memory.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace conv {
+namespace device {
+
+/// Runs a 2D fprop with per-channel batch-norm statistics on small integer inputs, so that every
+/// sum is exact in fp32, and compares D, the sums and the sums of squares against a direct host
+/// convolution. The statistics are reduced over the whole N*P*Q extent of each output channel,
+/// with the cross-tile partials kept in the workspace sized by the adapter.
+template <class Conv>
+bool TestConv2dFpropBatchNormStats(
+    int n, int h, int w, int c, int k, int r, int s, int pad, float alpha, float beta) {
+  using ConvKernel = typename Conv::ConvKernel;
+  using ProblemShape = typename ConvKernel::ProblemShape;
+  using ElementA = typename Conv::ElementA;
+  using ElementB = typename Conv::ElementB;
+  using ElementC = typename Conv::ElementC;
+  using ElementD = typename Conv::ElementD;
+  using StrideC = typename ConvKernel::StrideC;
+  using StrideD = typename ConvKernel::StrideD;
+  using FusionArguments = typename ConvKernel::CollectiveEpilogue::FusionCallbacks::Arguments;
+
+  ProblemShape problem_shape{
+    cutlass::conv::Mode::kCrossCorrelation,
+    {n, h, w, c},   // nhwc
+    {k, r, s, c},   // krsc
+    {pad, pad},     // padding lower (pad_h, pad_w)
+    {pad, pad},     // padding upper (pad_h, pad_w)
+    {1, 1},         // stride (stride_h, stride_w)
+    {1, 1},         // dilation (dilation_h, dilation_w)
+    1               // group
+  };
+
+  int p = h + 2 * pad - r + 1;
+  int q = w + 2 * pad - s + 1;
+
+  std::vector<ElementA> host_A(problem_shape.size_A());
+  std::vector<ElementB> host_B(problem_shape.size_B());
+  std::vector<ElementC> host_C(problem_shape.size_C());
+  std::vector<ElementD> host_D(problem_shape.size_C());
+  std::vector<float> host_sum(k, -1.f);
+  std::vector<float> host_sum_squares(k, -1.f);
+
+  for (size_t i = 0; i < host_A.size(); ++i) {
+    host_A[i] = ElementA(int((i * 7 + 3) % 3) - 1);
+  }
+  for (size_t i = 0; i < host_B.size(); ++i) {
+    host_B[i] = ElementB(int((i * 11 + 1) % 3) - 1);
+  }
+  for (size_t i = 0; i < host_C.size(); ++i) {
+    host_C[i] = ElementC(int((i * 13 + 2) % 7) - 3);
+  }
+
+  cutlass::DeviceAllocation<ElementA> block_A(host_A.size());
+  cutlass::DeviceAllocation<ElementB> block_B(host_B.size());
+  cutlass::DeviceAllocation<ElementC> block_C(host_C.size());
+  cutlass::DeviceAllocation<ElementD> block_D(host_D.size());
+  cutlass::DeviceAllocation<float> block_sum(k);
+  cutlass::DeviceAllocation<float> block_sum_squares(k);
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+  block_sum.copy_from_host(host_sum.data());
+  block_sum_squares.copy_from_host(host_sum_squares.data());
+
+  auto stride_C = StrideC{};
+  auto stride_D = StrideD{};
+  cute::for_each(cute::make_seq<cute::rank<0>(StrideC{})>{}, [&](auto i) {
+    cute::get<0, i>(stride_C) = problem_shape.stride_C[ProblemShape::RankT-2-i];
+  });
+  cute::for_each(cute::make_seq<cute::rank<0>(StrideD{})>{}, [&](auto i) {
+    cute::get<0, i>(stride_D) = problem_shape.stride_C[ProblemShape::RankT-2-i];
+  });
+
+  cutlass::KernelHardwareInfo hw_info;
+  cudaGetDevice(&hw_info.device_id);
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Conv::Arguments args{
+    problem_shape,
+    {block_A.get(), block_B.get()},
+    {{}, block_C.get(), stride_C, block_D.get(), stride_D},
+    hw_info
+  };
+  // Output channels are the N mode of the implicit GEMM, there is a single L
+  typename FusionArguments::StrideStats stride_stats = {_0{}, _1{}, int64_t(k)};
+  auto& fusion_args = args.epilogue.thread;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.sum_ptr = block_sum.get();
+  fusion_args.dSum = stride_stats;
+  fusion_args.sum_squares_ptr = block_sum_squares.get();
+  fusion_args.dSumSquares = stride_stats;
+
+  Conv conv_op;
+  if (conv_op.can_implement(args) != cutlass::Status::kSuccess) {
+    std::cerr << "can_implement failed for the given problem_shape.\n";
+    return false;
+  }
+
+  cutlass::DeviceAllocation<uint8_t> workspace(Conv::get_workspace_size(args));
+  if (conv_op.initialize(args, workspace.get()) != cutlass::Status::kSuccess ||
+      conv_op.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "Conv failed to run.\n";
+    return false;
+  }
+
+  block_D.copy_to_host(host_D.data());
+  block_sum.copy_to_host(host_sum.data());
+  block_sum_squares.copy_to_host(host_sum_squares.data());
+
+  std::vector<float> sum(k, 0.f);
+  std::vector<float> sum_squares(k, 0.f);
+  for (int ni = 0; ni < n; ++ni) {
+    for (int pi = 0; pi < p; ++pi) {
+      for (int qi = 0; qi < q; ++qi) {
+        for (int ki = 0; ki < k; ++ki) {
+          float accum = 0.f;
+          for (int ri = 0; ri < r; ++ri) {
+            for (int si = 0; si < s; ++si) {
+              int hi = pi + ri - pad;
+              int wi = qi + si - pad;
+              if (hi < 0 || hi >= h || wi < 0 || wi >= w) {
+                continue;
+              }
+              for (int ci = 0; ci < c; ++ci) {
+                accum += float(host_A[((size_t(ni) * h + hi) * w + wi) * c + ci]) *
+                         float(host_B[((size_t(ki) * r + ri) * s + si) * c + ci]);
+              }
+            }
+          }
+          size_t idx_D = ((size_t(ni) * p + pi) * q + qi) * k + ki;
+          float expected = alpha * accum + beta * float(host_C[idx_D]);
+          if (float(host_D[idx_D]) != expected) {
+            std::cerr << "D mismatch at (n, p, q, k) = (" << ni << ", " << pi << ", " << qi << ", " << ki
+                      << "): " << float(host_D[idx_D]) << " != " << expected << "\n";
+            return false;
+          }
+          sum[ki] += expected;
+          sum_squares[ki] += expected * expected;
+        }
+      }
+    }
+  }
+
+  for (int ki = 0; ki < k; ++ki) {
+    if (host_sum[ki] != sum[ki] || host_sum_squares[ki] != sum_squares[ki]) {
+      std::cerr << "Statistics mismatch at channel " << ki << ": sum " << host_sum[ki] << " != " << sum[ki]
+                << ", sum of squares " << host_sum_squares[ki] << " != " << sum_squares[ki] << "\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace conv
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_device_conv2d_fprop_implicitgemm_f16nhwc_f16nhwc_f16nhwc_tensor_op_f32_batch_norm_stats, 128x128x64_1x1x1) {
+  using ElementAct     = cutlass::half_t;
+  using ElementFlt     = cutlass::half_t;
+  using ElementOut     = cutlass::half_t;
+  using ElementAcc     = float;
+  using ElementCompute = float;
+  using TileShapeMNK = Shape<_128, _128, Shape<_64>>;
+  using ClusterShapeMNK = Shape<_1,_1,_1>;
+
+  using FusionOperation = cutlass::epilogue::fusion::LinCombPerColBatchNormStats<ElementOut, ElementCompute>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAcc, ElementCompute,
+      ElementOut, cutlass::layout::TensorNHWC, 128 / cutlass::sizeof_bits<ElementOut>::value,
+      ElementOut, cutlass::layout::TensorNHWC, 128 / cutlass::sizeof_bits<ElementOut>::value,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::conv::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::conv::Operator::kFprop,
+      ElementAct, cutlass::layout::TensorNHWC, 8,
+      ElementFlt, cutlass::layout::TensorNHWC, 8,
+      ElementAcc,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::conv::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::conv::KernelImplicitTmaWarpSpecializedSm90Cooperative
+    >::CollectiveOp;
+
+  using ProblemShape=cutlass::conv::ConvProblemShape<CollectiveMainloop::DispatchPolicy::ConvOp, CollectiveMainloop::DispatchPolicy::NumSpatialDimensions>;
+  using ConvKernel = cutlass::conv::kernel::ConvUniversal<
+      ProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Conv = cutlass::conv::device::ConvUniversalAdapter<ConvKernel>;
+
+  // The cooperative kernel hands the epilogue its workspace and the transformed MNKL problem shape
+  // N*P*Q is not a multiple of the 128 row tile in either case
+  // 1x1 filter: M = 1 * 25 * 27 = 675
+  EXPECT_TRUE(test::conv::device::TestConv2dFpropBatchNormStats<Conv>(1, 25, 27, 64, 128, 1, 1, 0, 1.f, 1.f));
+  // 3x3 filter with padding: M = 2 * 15 * 17 = 510
+  EXPECT_TRUE(test::conv::device::TestConv2dFpropBatchNormStats<Conv>(2, 15, 17, 64, 64, 3, 3, 1, 2.f, -1.f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -573,9 +573,61 @@ struct ConvTestbed {
     #endif
 
     EXPECT_TRUE(passed);
+
+    if (passed && CutlassUnitTestPerfRegressionEnabled()) {
+      passed = check_perf(problem_shape, alpha, beta, conv_op, args, workspace);
+    }
     return passed;
   }
 
+  /// Times a verified configuration and checks it against the performance baseline
+  bool check_perf(
+    ProblemShape const& problem_shape,
+    ElementScalar alpha,
+    ElementScalar beta,
+    Conv& conv_op,
+    typename Conv::Arguments& args,
+    thrust::universal_vector<uint8_t>& workspace) {
+
+    auto append_extents = [](std::stringstream& ss, char const* name, auto const& extents) {
+      ss << "_" << name;
+      for (size_t i = 0; i < extents.size(); ++i) {
+        ss << (i ? "x" : "") << extents[i];
+      }
+    };
+
+    std::stringstream config;
+    config << "g" << problem_shape.groups;
+    append_extents(config, "a", problem_shape.shape_A);
+    append_extents(config, "b", problem_shape.shape_B);
+    append_extents(config, "c", problem_shape.shape_C);
+    append_extents(config, "pad", problem_shape.lower_padding);
+    append_extents(config, "stride", problem_shape.traversal_stride);
+    append_extents(config, "dilation", problem_shape.dilation);
+    config << "_alpha" << alpha << "_beta" << beta;
+
+    // Implicit GEMM extents: M and N are the modes of C, K is the reduction mode of A (wgrad) or B
+    double gemm_mn = double(cute::size(problem_shape.get_shape_C()));
+    double gemm_k = 0;
+    if constexpr (ConvOp == cutlass::conv::Operator::kWgrad) {
+      gemm_k = double(cute::size<1>(problem_shape.get_shape_A()));
+    }
+    else {
+      gemm_k = double(cute::size<1>(problem_shape.get_shape_B()));
+    }
+
+    double runtime_ms = CutlassUnitTestTimeKernel([&]() {
+      return conv_op(args, workspace.data().get()) == cutlass::Status::kSuccess;
+    });
+    if (runtime_ms < 0) {
+      EXPECT_GE(runtime_ms, 0) << "Error while timing " << config.str();
+      return false;
+    }
+
+    double tflops = 2.0 * gemm_mn * gemm_k / (runtime_ms * 1.0e9);
+    return CutlassUnitTestCheckPerf(config.str(), tflops);
+  }
+
   template<
     class Engine, class Layout,
     class EngineA, class LayoutA,
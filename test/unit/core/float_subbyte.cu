@@ -0,0 +1,108 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for basic FP4, FP6 and E8M0 functionality
+*/
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/numeric_types.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void run_round_trip(int num_encodings) {
+  for (int i = 0; i < num_encodings; ++i) {
+    T x = T::bitcast(uint8_t(i));
+    T y = static_cast<T>(static_cast<float>(x));
+    // -0 and +0 compare equal
+    EXPECT_TRUE(x == y) << "encoding " << i;
+  }
+}
+
+TEST(float_e2m1_t, host_conversion) {
+  using FP4 = cutlass::float_e2m1_t;
+
+  float const magnitudes[] = {0.0f, 0.5f, 1.0f, 1.5f, 2.0f, 3.0f, 4.0f, 6.0f};
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(static_cast<float>(FP4::bitcast(uint8_t(i))) == magnitudes[i]);
+    EXPECT_TRUE(static_cast<float>(FP4::bitcast(uint8_t(i | 0x8))) == -magnitudes[i]);
+  }
+  run_round_trip<FP4>(16);
+
+  // Round to nearest even
+  EXPECT_TRUE(static_cast<float>(FP4(0.25f)) == 0.0f);
+  EXPECT_TRUE(static_cast<float>(FP4(0.75f)) == 1.0f);
+  EXPECT_TRUE(static_cast<float>(FP4(2.5f)) == 2.0f);
+  EXPECT_TRUE(static_cast<float>(FP4(5.0f)) == 4.0f);
+  EXPECT_TRUE(static_cast<float>(FP4(5.1f)) == 6.0f);
+
+  // Saturation
+  EXPECT_TRUE(static_cast<float>(FP4(100.0f)) == 6.0f);
+  EXPECT_TRUE(static_cast<float>(FP4(-100.0f)) == -6.0f);
+  EXPECT_TRUE(static_cast<float>(std::numeric_limits<FP4>::max()) == 6.0f);
+  EXPECT_TRUE(static_cast<float>(std::numeric_limits<FP4>::lowest()) == -6.0f);
+}
+
+TEST(float_e3m2_t, host_conversion) {
+  using FP6 = cutlass::float_e3m2_t;
+  run_round_trip<FP6>(64);
+  EXPECT_TRUE(static_cast<float>(std::numeric_limits<FP6>::max()) == 28.0f);
+  EXPECT_TRUE(static_cast<float>(std::numeric_limits<FP6>::denorm_min()) == 0.0625f);
+  EXPECT_TRUE(static_cast<float>(FP6(1000.0f)) == 28.0f);
+}
+
+TEST(float_e2m3_t, host_conversion) {
+  using FP6 = cutlass::float_e2m3_t;
+  run_round_trip<FP6>(64);
+  EXPECT_TRUE(static_cast<float>(std::numeric_limits<FP6>::max()) == 7.5f);
+  EXPECT_TRUE(static_cast<float>(std::numeric_limits<FP6>::denorm_min()) == 0.125f);
+  EXPECT_TRUE(static_cast<float>(FP6(-1000.0f)) == -7.5f);
+}
+
+TEST(float_ue8m0_t, host_conversion) {
+  using E8M0 = cutlass::float_ue8m0_t;
+
+  for (int e = -126; e <= 127; ++e) {
+    float f = std::ldexp(1.0f, e);
+    E8M0 x = static_cast<E8M0>(f);
+    EXPECT_TRUE(x.exponent() == e);
+    EXPECT_TRUE(static_cast<float>(x) == f);
+  }
+
+  // Conversion keeps the exponent, rounding magnitudes down to a power of two
+  EXPECT_TRUE(static_cast<float>(E8M0(3.0f)) == 2.0f);
+  EXPECT_TRUE(static_cast<float>(E8M0(-0.75f)) == 0.5f);
+  EXPECT_TRUE(static_cast<float>(E8M0::bitcast(0)) == std::ldexp(1.0f, -127));
+  EXPECT_TRUE(isnan(E8M0::bitcast(0xff)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +153,45 @@ void run_test_with_scalefactor(const char dest_name[], const char source_name[],
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Fills the source with every encoding of a narrow type and checks the conversion is exact.
+/// NaN must convert to NaN.
+template <typename Destination, typename Source, int Count>
+void run_test_all_encodings(const char dest_name[], const char source_name[], const int num_encodings) {
+  const int kN = Count;
+
+  dim3 grid(1, 1);
+  dim3 block(1, 1);
+
+  cutlass::HostTensor<Destination, cutlass::layout::RowMajor> destination({1, kN});
+  cutlass::HostTensor<Source, cutlass::layout::RowMajor> source({1, kN});
+  auto source_ref = source.host_ref();
+  auto destination_ref = destination.host_ref();
+
+  for (int i = 0; i < kN; ++i) {
+    source_ref.at({0, i}) = Source::bitcast(uint8_t(i % num_encodings));
+  }
+
+  source.sync_device();
+
+  convert<Destination, Source, kN><<< grid, block >>>(
+    reinterpret_cast<cutlass::Array<Destination, kN> *>(destination.device_data()),
+    reinterpret_cast<cutlass::Array<Source, kN> const *>(source.device_data())
+  );
+
+  destination.sync_host();
+
+  for (int i = 0; i < kN; ++i) {
+    float dst = float(destination_ref.at({0, i}));
+    float src = float(source_ref.at({0, i}));
+    EXPECT_TRUE(dst == src || (std::isnan(dst) && std::isnan(src)))
+      << "Destination type: " << dest_name << " "<< dst
+      << ", Source type: " << source_name << " " << src
+      << ", idx: " << i;
+  }
+}
+
 } // namespace kernel
 } // namespace core
 } // namespace test
@@ -637,6 +676,80 @@ TEST(NumericConversion, int_to_fe4m3_t_array_32) {
   test::core::kernel::run_test<Destination, Source, kN>(dest_name, source_name);
 }
 
+TEST(NumericConversion, fe2m1_to_fe4m3_array) {
+  int const kN = 37;
+  using Source = cutlass::float_e2m1_t;
+  const char source_name[] = "float_e2m1_t";
+  using Destination = cutlass::float_e4m3_t;
+  const char dest_name[] = "float_e4m3_t";
+  test::core::kernel::run_test_all_encodings<Destination, Source, kN>(dest_name, source_name, 16);
+}
+
+TEST(NumericConversion, fe2m1_to_f16_array) {
+  int const kN = 37;
+  using Source = cutlass::float_e2m1_t;
+  const char source_name[] = "float_e2m1_t";
+  using Destination = cutlass::half_t;
+  const char dest_name[] = "half_t";
+  test::core::kernel::run_test_all_encodings<Destination, Source, kN>(dest_name, source_name, 16);
+}
+
+TEST(NumericConversion, fe2m1_to_bf16_array) {
+  int const kN = 37;
+  using Source = cutlass::float_e2m1_t;
+  const char source_name[] = "float_e2m1_t";
+  using Destination = cutlass::bfloat16_t;
+  const char dest_name[] = "bfloat16_t";
+  test::core::kernel::run_test_all_encodings<Destination, Source, kN>(dest_name, source_name, 16);
+}
+
+TEST(NumericConversion, fe3m2_to_f32_array) {
+  int const kN = 64;
+  using Source = cutlass::float_e3m2_t;
+  const char source_name[] = "float_e3m2_t";
+  using Destination = float;
+  const char dest_name[] = "float";
+  test::core::kernel::run_test_all_encodings<Destination, Source, kN>(dest_name, source_name, 64);
+}
+
+TEST(NumericConversion, fe2m3_to_f32_array) {
+  int const kN = 64;
+  using Source = cutlass::float_e2m3_t;
+  const char source_name[] = "float_e2m3_t";
+  using Destination = float;
+  const char dest_name[] = "float";
+  test::core::kernel::run_test_all_encodings<Destination, Source, kN>(dest_name, source_name, 64);
+}
+
+TEST(NumericConversion, fe4m3_to_bf16_all_encodings) {
+  // 256 encodings plus a residue of 2 elements for the packed pair path
+  int const kN = 258;
+  using Source = cutlass::float_e4m3_t;
+  const char source_name[] = "float_e4m3_t";
+  using Destination = cutlass::bfloat16_t;
+  const char dest_name[] = "bfloat16_t";
+  test::core::kernel::run_test_all_encodings<Destination, Source, kN>(dest_name, source_name, 256);
+}
+
+TEST(NumericConversion, fe5m2_to_f16_all_encodings) {
+  int const kN = 259;
+  using Source = cutlass::float_e5m2_t;
+  const char source_name[] = "float_e5m2_t";
+  using Destination = cutlass::half_t;
+  const char dest_name[] = "half_t";
+  test::core::kernel::run_test_all_encodings<Destination, Source, kN>(dest_name, source_name, 256);
+}
+
+TEST(NumericConversion, ue8m0_to_bf16_array) {
+  int const kN = 255;
+  using Source = cutlass::float_ue8m0_t;
+  const char source_name[] = "float_ue8m0_t";
+  using Destination = cutlass::bfloat16_t;
+  const char dest_name[] = "bfloat16_t";
+  // Every encoding except NaN
+  test::core::kernel::run_test_all_encodings<Destination, Source, kN>(dest_name, source_name, 255);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <typename T>
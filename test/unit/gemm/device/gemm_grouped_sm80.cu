@@ -345,6 +345,93 @@ TEST(SM80_Device_GemmGrouped_f16n_f16t_f32n_tensor_op_f32, 128x128x32_64x64x32)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+TEST(SM80_Device_GemmGrouped_f16n_f16t_f32n_tensor_op_f32, 128x128x32_64x64x32_streamk) {
+
+  using ElementOutput = float;
+  using ElementAccumulator = float;
+
+  using GemmKernel = typename cutlass::gemm::kernel::DefaultGemmGrouped<
+    cutlass::half_t,
+    cutlass::layout::ColumnMajor,
+    cutlass::ComplexTransform::kNone,
+    8,
+    cutlass::half_t,
+    cutlass::layout::ColumnMajor,
+    cutlass::ComplexTransform::kNone,
+    8,
+    ElementOutput, cutlass::layout::ColumnMajor,
+    ElementAccumulator,
+    cutlass::arch::OpClassTensorOp,
+    cutlass::arch::Sm80,
+    cutlass::gemm::GemmShape<128, 128, 32>,
+    cutlass::gemm::GemmShape<64, 64, 32>,
+    cutlass::gemm::GemmShape<16, 8, 16>,
+    cutlass::epilogue::thread::LinearCombination<
+        ElementOutput, 128 / cutlass::sizeof_bits<ElementOutput>::value,
+        ElementAccumulator, ElementAccumulator>,
+    cutlass::gemm::threadblock::GemmBatchedIdentityThreadblockSwizzle,
+    3,
+    cutlass::gemm::kernel::GroupScheduleMode::kStreamK>::GemmKernel;
+
+  using Gemm = cutlass::gemm::device::GemmGrouped<GemmKernel>;
+
+  //
+  // Test
+  //
+
+  test::gemm::device::TestbedGrouped<Gemm> testbed;
+
+  bool passed = testbed.run(24);
+  EXPECT_TRUE(passed);
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmGrouped_f16n_f16t_f32n_tensor_op_f32, 128x128x32_64x64x32_device_precompute) {
+
+  using ElementOutput = float;
+  using ElementAccumulator = float;
+
+  using GemmKernel = typename cutlass::gemm::kernel::DefaultGemmGrouped<
+    cutlass::half_t,
+    cutlass::layout::ColumnMajor,
+    cutlass::ComplexTransform::kNone,
+    8,
+    cutlass::half_t,
+    cutlass::layout::ColumnMajor,
+    cutlass::ComplexTransform::kNone,
+    8,
+    ElementOutput, cutlass::layout::ColumnMajor,
+    ElementAccumulator,
+    cutlass::arch::OpClassTensorOp,
+    cutlass::arch::Sm80,
+    cutlass::gemm::GemmShape<128, 128, 32>,
+    cutlass::gemm::GemmShape<64, 64, 32>,
+    cutlass::gemm::GemmShape<16, 8, 16>,
+    cutlass::epilogue::thread::LinearCombination<
+        ElementOutput, 128 / cutlass::sizeof_bits<ElementOutput>::value,
+        ElementAccumulator, ElementAccumulator>,
+    cutlass::gemm::threadblock::GemmBatchedIdentityThreadblockSwizzle,
+    3,
+    cutlass::gemm::kernel::GroupScheduleMode::kDevicePrecompute>::GemmKernel;
+
+  using Gemm = cutlass::gemm::device::GemmGrouped<GemmKernel>;
+
+  //
+  // Test
+  //
+
+  test::gemm::device::TestbedGrouped<Gemm> testbed;
+
+  // More problems than threads of the kernel scanning their tile counts
+  bool passed = testbed.run(300);
+  EXPECT_TRUE(passed);
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 TEST(SM80_Device_GemmGrouped_f16n_f16t_f32t_tensor_op_f32, 128x128x32_64x64x32) {
 
   using ElementOutput = float;
@@ -1380,7 +1380,7 @@ struct HostCollectiveEpilogue {
 
     if constexpr (IsAuxInEnabled) {
       auto aux_coord = cutlass::make_Coord(M * L, N);
-      auto aux_layout = cutlass::layout::Affine2Layout_Factory<LayoutTagD>::layout_factory(aux_coord, typename LayoutTagAux::Stride{});
+      auto aux_layout = cutlass::layout::Affine2Layout_Factory<LayoutTagAux>::layout_factory(aux_coord, typename LayoutTagAux::Stride{});
       tensor_Aux.resize(aux_coord, aux_layout);
       EXPECT_TRUE(initialize_tensor(tensor_Aux.host_view(), init_C, seed + 2023));
       tensor_Aux.sync_device();
@@ -1389,7 +1389,7 @@ struct HostCollectiveEpilogue {
 
     if constexpr (IsAuxOutEnabled) {
       auto aux_coord = cutlass::make_Coord(M * L, N);
-      auto aux_layout = cutlass::layout::Affine2Layout_Factory<LayoutTagD>::layout_factory(aux_coord, typename LayoutTagAux::Stride{});
+      auto aux_layout = cutlass::layout::Affine2Layout_Factory<LayoutTagAux>::layout_factory(aux_coord, typename LayoutTagAux::Stride{});
       tensor_Aux.resize(aux_coord, aux_layout);
       reference_Aux.resize(aux_coord, aux_layout, false);
       tensor_Aux.sync_device();
@@ -1996,6 +1996,33 @@ struct TestbedImpl {
     return true;
   }
 
+  /// Times a verified configuration and checks it against the performance baseline
+  bool check_perf(
+    std::string const& config,
+    ProblemShapeType problem_size,
+    Gemm& gemm_op,
+    typename Gemm::Arguments& arguments,
+    cutlass::device_memory::allocation<uint8_t>& workspace) {
+    double M = cute::size<0>(problem_size);
+    double N = cute::size<1>(problem_size);
+    double K = cute::size<2>(problem_size);
+    double L = 1;
+    if constexpr (cute::rank(ProblemShapeType{}) == 4) {
+      L = cute::size<3>(problem_size);
+    }
+
+    double runtime_ms = CutlassUnitTestTimeKernel([&]() {
+      return gemm_op(arguments, workspace.get()) == cutlass::Status::kSuccess;
+    });
+    if (runtime_ms < 0) {
+      EXPECT_GE(runtime_ms, 0) << "Error while timing " << config;
+      return false;
+    }
+
+    double tflops = 2.0 * M * N * K * L / (runtime_ms * 1.0e9);
+    return CutlassUnitTestCheckPerf(config, tflops);
+  }
+
   /// Executes one test
   bool run(
     ProblemShapeType problem_size,
@@ -2174,6 +2201,19 @@ struct TestbedImpl {
       }
 #endif
 
+      if (passed && CutlassUnitTestPerfRegressionEnabled()) {
+        std::stringstream config;
+        config << "m" << cute::size<0>(problem_size) << "_n" << cute::size<1>(problem_size)
+               << "_k" << cute::size<2>(problem_size);
+        if constexpr (cute::rank(ProblemShapeType{}) == 4) {
+          config << "_l" << cute::size<3>(problem_size);
+        }
+        config << "_alpha" << alpha << "_beta" << beta
+               << "_raster" << int(raster_order) << "_swizzle" << static_cast<int>(max_swizzle)
+               << "_splits" << static_cast<int>(splits) << "_decomp" << int(decomposition_mode);
+        passed = check_perf(config.str(), problem_size, gemm_op, arguments, workspace);
+      }
+
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
       CUTLASS_TRACE_HOST("TestbedImpl::run: Reached end");
 #endif
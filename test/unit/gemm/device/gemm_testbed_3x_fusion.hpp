@@ -0,0 +1,235 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Testbed for SM90 EVT fusions whose side outputs are checked by hand-written host references
+*/
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// f16 x f16 GEMM with K-major operands, f32 accumulation and a row-major D of the fusion's output type
+template <
+  class FusionOperation,
+  class TileShape_MNK = cute::Shape<cute::_128,cute::_128,cute::_64>,
+  class ClusterShape_MNK = cute::Shape<cute::_1,cute::_1,cute::_1>,
+  class KernelSchedule = cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+  class EpilogueSchedule = cutlass::epilogue::TmaWarpSpecializedCooperative,
+  class EpilogueTile = cutlass::epilogue::collective::EpilogueTileAuto
+>
+struct Sm90FusionGemm {
+  using ElementOutput = typename FusionOperation::ElementOutput;
+  static constexpr int AlignmentD = 128 / cutlass::sizeof_bits<ElementOutput>::value;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      EpilogueTile,
+      float, typename FusionOperation::ElementCompute,
+      ElementOutput, cutlass::layout::RowMajor, AlignmentD,
+      ElementOutput, cutlass::layout::RowMajor, AlignmentD,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Deterministic integers in [-range, range]. Products and sums of a few thousand of them are exact
+/// in fp32, so fused outputs can be compared bit for bit regardless of the accumulation order.
+template <class Element>
+void fill_small_integers(std::vector<Element>& data, uint32_t seed, int range) {
+  for (size_t i = 0; i < data.size(); ++i) {
+    uint32_t hash = (static_cast<uint32_t>(i) + seed * 0x9E3779B9u) * 2654435761u;
+    hash ^= hash >> 16;
+    data[i] = Element(static_cast<int>(hash % uint32_t(2 * range + 1)) - range);
+  }
+}
+
+/// Runs a 3.x GEMM whose fusion-specific arguments are filled in by the caller, and provides the host
+/// reference Z = alpha * A * B + beta * C that the fused outputs are derived from.
+/// Operands are small integers, so Z is exact in fp32.
+template <class Gemm>
+struct FusionTestbed {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Arguments = typename Gemm::Arguments;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+
+  int M, N, K, L;
+  float alpha = 1.f;
+  float beta = 0.f;
+
+  StrideA stride_A;
+  StrideB stride_B;
+  StrideC stride_C;
+  StrideD stride_D;
+
+  std::vector<ElementA> host_A;
+  std::vector<ElementB> host_B;
+  std::vector<ElementC> host_C;
+  std::vector<ElementD> host_D;
+
+  cutlass::DeviceAllocation<ElementA> block_A;
+  cutlass::DeviceAllocation<ElementB> block_B;
+  cutlass::DeviceAllocation<ElementC> block_C;
+  cutlass::DeviceAllocation<ElementD> block_D;
+  cutlass::DeviceAllocation<uint8_t> workspace;
+
+  FusionTestbed(int M, int N, int K, int L = 1, int range = 1)
+    : M(M), N(N), K(K), L(L),
+      stride_A(cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, L))),
+      stride_B(cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(N, K, L))),
+      stride_C(cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, L))),
+      stride_D(cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, L))),
+      host_A(size_t(M) * K * L),
+      host_B(size_t(N) * K * L),
+      host_C(size_t(M) * N * L),
+      host_D(size_t(M) * N * L),
+      block_A(host_A.size()),
+      block_B(host_B.size()),
+      block_C(host_C.size()),
+      block_D(host_D.size()) {
+    fill_small_integers(host_A, 1, range);
+    fill_small_integers(host_B, 2, range);
+    fill_small_integers(host_C, 3, 3);
+    block_A.copy_from_host(host_A.data());
+    block_B.copy_from_host(host_B.data());
+    block_C.copy_from_host(host_C.data());
+  }
+
+  /// Arguments with the operands, alpha and beta bound. Fusion-specific members are left to the caller.
+  Arguments arguments() {
+    cutlass::KernelHardwareInfo hw_info;
+    hw_info.device_id = 0;
+    hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+    Arguments args{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {M, N, K, L},
+      {block_A.get(), stride_A, block_B.get(), stride_B},
+      {{}, block_C.get(), stride_C, block_D.get(), stride_D},
+      hw_info
+    };
+    args.epilogue.thread.alpha = alpha;
+    args.epilogue.thread.beta = beta;
+    return args;
+  }
+
+  /// Runs the GEMM with a workspace of the size it asks for, then copies D back to the host
+  bool run(Arguments const& args) {
+    Gemm gemm;
+    if (gemm.can_implement(args) != cutlass::Status::kSuccess) {
+      std::cerr << "Problem is not supported.\n";
+      return false;
+    }
+
+    workspace.reset(Gemm::get_workspace_size(args));
+    if (gemm.initialize(args, workspace.get()) != cutlass::Status::kSuccess ||
+        gemm.run() != cutlass::Status::kSuccess ||
+        cudaDeviceSynchronize() != cudaSuccess) {
+      std::cerr << "GEMM failed to run.\n";
+      return false;
+    }
+
+    block_D.copy_to_host(host_D.data());
+    return true;
+  }
+
+  /// Host reference of alpha * A * B + beta * C at (m,n,l)
+  float reference(int m, int n, int l) const {
+    auto tA = cute::make_tensor(host_A.data(), cute::make_shape(M, K, L), stride_A);
+    auto tB = cute::make_tensor(host_B.data(), cute::make_shape(N, K, L), stride_B);
+    auto tC = cute::make_tensor(host_C.data(), cute::make_shape(M, N, L), stride_C);
+    float accum = 0.f;
+    for (int k = 0; k < K; ++k) {
+      accum += float(tA(m, k, l)) * float(tB(n, k, l));
+    }
+    return alpha * accum + beta * float(tC(m, n, l));
+  }
+
+  /// Computed D at (m,n,l)
+  ElementD D(int m, int n, int l) const {
+    auto tD = cute::make_tensor(host_D.data(), cute::make_shape(M, N, L), stride_D);
+    return tD(m, n, l);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
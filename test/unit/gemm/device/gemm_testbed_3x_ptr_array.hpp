@@ -309,6 +309,8 @@ struct HostCollectiveMainloop {
   cutlass::DeviceAllocation<const ElementB *> device_tensors_B;
   // Whether to use relative equality checks
   CheckEquality check_relative_equality = CheckEquality::EXACT;
+  // Whether every batch of a Ptr-Array GEMM points at the B operand of the first batch
+  bool shared_B = false;
 
   uint64_t seed;
   static constexpr uint64_t kDefaultSeed = 4096;
@@ -386,7 +388,7 @@ struct HostCollectiveMainloop {
 
     for (int32_t i = 0; i < L; ++i) {
       ptr_A_host.at(i) = tensors_A[i].device_data();
-      ptr_B_host.at(i) = tensors_B[i].device_data();
+      ptr_B_host.at(i) = tensors_B[shared_B ? 0 : i].device_data();
     }
 
     device_tensors_A.reset(L);
@@ -427,7 +429,7 @@ struct HostCollectiveMainloop {
     auto [M, N, K, L] = cute::append<4>(problem_shapes.get_host_problem_shape(batch), 1);
     auto A = make_tensor(make_iterator(tensors_A[batch].host_data()),
           make_layout(make_shape(M, K, 1), stride_a_host[batch]));
-    auto B = make_tensor(make_iterator(tensors_B[batch].host_data()),
+    auto B = make_tensor(make_iterator(tensors_B[shared_B ? 0 : batch].host_data()),
         make_layout(make_shape(N, K, 1), stride_b_host[batch]));
 
     cutlass::reference::host::GettMainloopParams<ElementAccumulator, 
@@ -445,7 +447,7 @@ struct HostCollectiveMainloop {
 
   void print_tensors(std::ofstream& file, int batch) {
     file << "A =\n" << tensors_A[batch].host_view()
-         << "\nB =\n" << tensors_B[batch].host_view();
+         << "\nB =\n" << tensors_B[shared_B ? 0 : batch].host_view();
   }
 
   template <
@@ -1735,11 +1737,13 @@ template <
   typename Gemm,
   template <class T> class ActivationFunctor = cutlass::epilogue::thread::Identity
 >
-bool TestAll(double alpha = 1.0, double beta = 0.0, CheckEquality check_relative_equality = CheckEquality::RELATIVE) {
+bool TestAll(double alpha = 1.0, double beta = 0.0, CheckEquality check_relative_equality = CheckEquality::RELATIVE,
+             bool shared_B = false) {
   using ElementScalar = typename Gemm::EpilogueOutputOp::ElementScalar;
   using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
 
   Testbed3x<Gemm, ActivationFunctor> testbed(check_relative_equality, ScalarLoc::ON_DEVICE, VectorScale::DISABLED);
+  testbed.impl_.collective_mma_inputs.shared_B = shared_B;
 
   int max_alignment = std::max(Gemm::kAlignmentA, Gemm::kAlignmentB);
   std::vector<int> problem_size_m = {max_alignment, 512 - 3 * max_alignment};
@@ -0,0 +1,204 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the mixed-input GEMM dequantizing B with group-wise scales and zero-points
+*/
+
+#include <iostream>
+
+#include "../../common/cutlass_unit_test.h"
+#include "cutlass/cutlass.h"
+
+#include "cutlass/gemm/device/gemm_universal_base.h"
+#include "cutlass/gemm/kernel/default_gemm_universal_mixed_input_groupwise.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+#include "cutlass/util/tensor_view_io.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template <typename GemmKernel>
+bool TestGroupwiseGemm(
+  cutlass::gemm::GemmCoord problem_size,
+  int group_size,
+  int split_k_slices = 1,
+  bool with_zero = true) {
+
+  using Gemm = cutlass::gemm::device::GemmUniversalBase<GemmKernel>;
+
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using ElementC = typename GemmKernel::ElementC;
+  using ElementScale = typename GemmKernel::ElementScale;
+  using ElementCompute = typename GemmKernel::EpilogueOutputOp::ElementCompute;
+
+  int groups = (problem_size.k() + group_size - 1) / group_size;
+
+  cutlass::HostTensor<ElementA, cutlass::layout::RowMajor> tensor_A(problem_size.mk());
+  cutlass::HostTensor<ElementB, cutlass::layout::ColumnMajor> tensor_B(problem_size.kn());
+  cutlass::HostTensor<ElementScale, cutlass::layout::RowMajor> tensor_scale({groups, problem_size.n()});
+  cutlass::HostTensor<ElementScale, cutlass::layout::RowMajor> tensor_zero({groups, problem_size.n()});
+  cutlass::HostTensor<ElementC, cutlass::layout::RowMajor> tensor_C(problem_size.mn());
+  cutlass::HostTensor<ElementC, cutlass::layout::RowMajor> tensor_D(problem_size.mn());
+  cutlass::HostTensor<ElementC, cutlass::layout::RowMajor> reference_D(problem_size.mn(), false);
+
+  // Integer operands and scales with few fractional bits keep the dequantized values exact
+  cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), 2023, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), 2024, 8, -8, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_scale.host_view(), 2025, 2, 0.25, 2);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_zero.host_view(), 2026, 3, -3, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_C.host_view(), 2027, 4, -4, 0);
+  cutlass::reference::host::TensorFill(tensor_D.host_view());
+
+  tensor_A.sync_device();
+  tensor_B.sync_device();
+  tensor_scale.sync_device();
+  tensor_zero.sync_device();
+  tensor_C.sync_device();
+  tensor_D.sync_device();
+
+  ElementCompute alpha = ElementCompute(1);
+  ElementCompute beta = ElementCompute(split_k_slices > 1 ? 0 : 1);
+
+  typename GemmKernel::Base::Arguments base_args(
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    problem_size,
+    split_k_slices,
+    {alpha, beta},
+    tensor_A.device_data(),
+    tensor_B.device_data(),
+    tensor_C.device_data(),
+    tensor_D.device_data(),
+    0, 0, 0, 0,
+    tensor_A.layout().stride(0),
+    tensor_B.layout().stride(0),
+    tensor_C.layout().stride(0),
+    tensor_D.layout().stride(0));
+
+  typename GemmKernel::Arguments args(
+    base_args,
+    tensor_scale.device_data(),
+    with_zero ? tensor_zero.device_data() : nullptr,
+    tensor_scale.layout().stride(0),
+    group_size);
+
+  Gemm gemm_op;
+
+  cutlass::Status status = gemm_op.can_implement(args);
+  EXPECT_TRUE(status == cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+
+  size_t workspace_size = Gemm::get_workspace_size(args);
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  status = gemm_op.initialize(args, workspace.get());
+  EXPECT_TRUE(status == cutlass::Status::kSuccess);
+
+  status = gemm_op.run();
+  EXPECT_TRUE(status == cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+
+  tensor_D.sync_host();
+
+  // Host reference: D = alpha * A * ((B - zero) * scale) + beta * C
+  for (int m = 0; m < problem_size.m(); ++m) {
+    for (int n = 0; n < problem_size.n(); ++n) {
+      float accum = 0;
+      for (int k = 0; k < problem_size.k(); ++k) {
+        float s = float(tensor_scale.at({k / group_size, n}));
+        float z = with_zero ? float(tensor_zero.at({k / group_size, n})) : 0.0f;
+        accum += float(tensor_A.at({m, k})) * ((float(tensor_B.at({k, n})) - z) * s);
+      }
+      reference_D.at({m, n}) = ElementC(
+        float(alpha) * accum + float(beta) * float(tensor_C.at({m, n})));
+    }
+  }
+
+  bool passed = cutlass::reference::host::TensorEquals(reference_D.host_view(), tensor_D.host_view());
+
+  EXPECT_TRUE(passed) << " problem: " << problem_size << ", group_size: " << group_size
+    << ", split_k_slices: " << split_k_slices;
+
+  return passed;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmUniversal_f16t_s8n_f32t_mixed_input_groupwise_tensor_op_f32, 128x128x64_64x64x64) {
+
+  using ElementA = cutlass::half_t;
+  using ElementB = int8_t;
+  using ElementOutput = float;
+  using ElementAccumulator = float;
+
+  using GemmKernel = typename cutlass::gemm::kernel::DefaultGemmUniversalMixedInputGroupwise<
+    ElementA, cutlass::layout::RowMajor, cutlass::ComplexTransform::kNone, 8,
+    ElementB, cutlass::layout::ColumnMajor, cutlass::ComplexTransform::kNone, 16,
+    ElementOutput, cutlass::layout::RowMajor,
+    ElementAccumulator,
+    cutlass::arch::OpClassTensorOp,
+    cutlass::arch::Sm80,
+    cutlass::gemm::GemmShape<128, 128, 64>,
+    cutlass::gemm::GemmShape<64, 64, 64>,
+    cutlass::gemm::GemmShape<16, 8, 16>,
+    cutlass::epilogue::thread::LinearCombination<
+        ElementOutput, 128 / cutlass::sizeof_bits<ElementOutput>::value,
+        ElementAccumulator, ElementAccumulator>,
+    cutlass::gemm::threadblock::GemmIdentityThreadblockSwizzle<>,
+    4  // Stages
+  >::GemmKernel;
+
+  EXPECT_TRUE(TestGroupwiseGemm<GemmKernel>({256, 256, 512}, 128));
+  EXPECT_TRUE(TestGroupwiseGemm<GemmKernel>({136, 264, 320}, 128));
+  EXPECT_TRUE(TestGroupwiseGemm<GemmKernel>({128, 128, 256}, 32, 1, false));
+  EXPECT_TRUE(TestGroupwiseGemm<GemmKernel>({256, 128, 1024}, 128, 3));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // #if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+////////////////////////////////////////////////////////////////////////////////
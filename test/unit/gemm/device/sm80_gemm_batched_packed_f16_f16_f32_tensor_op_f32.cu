@@ -0,0 +1,206 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the packed batched GEMM of many tiny problems
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/gemm/device/gemm_batched_packed.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Runs a packed batched GEMM on small integer inputs and compares it against a host reference.
+/// A non-zero batch_padding separates consecutive problems in memory.
+template <class Gemm>
+bool TestGemmBatchedPacked(int M, int N, int K, int L, int batch_padding = 0, float alpha = 1.f, float beta = 0.f) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+
+  auto dA = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, make_shape(M, K, 1));
+  auto dB = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, make_shape(N, K, 1));
+  auto dC = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, make_shape(M, N, 1));
+  auto dD = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, make_shape(M, N, 1));
+  get<2>(dA) = int64_t(M) * K + batch_padding;
+  get<2>(dB) = int64_t(N) * K + batch_padding;
+  get<2>(dC) = int64_t(M) * N + batch_padding;
+  get<2>(dD) = int64_t(M) * N + batch_padding;
+
+  size_t size_A = size_t(get<2>(dA)) * L;
+  size_t size_B = size_t(get<2>(dB)) * L;
+  size_t size_C = size_t(get<2>(dC)) * L;
+
+  std::vector<ElementA> host_A(size_A);
+  std::vector<ElementB> host_B(size_B);
+  std::vector<ElementC> host_C(size_C);
+  std::vector<ElementD> host_D(size_C, ElementD(-1));
+
+  for (size_t i = 0; i < size_A; ++i) {
+    host_A[i] = ElementA(int((i * 7 + 3) % 5) - 2);
+  }
+  for (size_t i = 0; i < size_B; ++i) {
+    host_B[i] = ElementB(int((i * 11 + 1) % 5) - 2);
+  }
+  for (size_t i = 0; i < size_C; ++i) {
+    host_C[i] = ElementC(int((i * 13 + 2) % 7) - 3);
+  }
+
+  cutlass::DeviceAllocation<ElementA> block_A(size_A);
+  cutlass::DeviceAllocation<ElementB> block_B(size_B);
+  cutlass::DeviceAllocation<ElementC> block_C(size_C);
+  cutlass::DeviceAllocation<ElementD> block_D(size_C);
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+  block_D.copy_from_host(host_D.data());
+
+  typename Gemm::Arguments arguments{
+    {M, N, K, L},
+    block_A.get(), dA,
+    block_B.get(), dB,
+    block_C.get(), dC,
+    block_D.get(), dD,
+    alpha, beta
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "Problem is not supported.\n";
+    return false;
+  }
+
+  cutlass::Status status = gemm(arguments);
+  if (status != cutlass::Status::kSuccess || cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "GEMM failed to run.\n";
+    return false;
+  }
+
+  block_D.copy_to_host(host_D.data());
+
+  Tensor tA = make_tensor(host_A.data(), make_shape(M, K, L), dA);
+  Tensor tB = make_tensor(host_B.data(), make_shape(N, K, L), dB);
+  Tensor tC = make_tensor(host_C.data(), make_shape(M, N, L), dC);
+  Tensor tD = make_tensor(host_D.data(), make_shape(M, N, L), dD);
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float accum = 0.f;
+        for (int k = 0; k < K; ++k) {
+          accum += float(tA(m, k, l)) * float(tB(n, k, l));
+        }
+        float expected = alpha * accum + beta * float(tC(m, n, l));
+        if (float(tD(m, n, l)) != expected) {
+          std::cerr << "Mismatch at (m, n, l) = (" << m << ", " << n << ", " << l << "): "
+                    << float(tD(m, n, l)) << " != " << expected << "\n";
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+namespace {
+
+using TiledMmaF16 = TiledMMA<
+  MMA_Atom<SM80_16x8x16_F32F16F16F32_TN>,
+  Layout<Shape<_1,_1,_1>>,
+  Tile<_16,_16,_16>>;
+
+template <class TileShape, int ProblemsPerCta, class StrideA>
+using GemmBatchedPackedF16 = cutlass::gemm::device::GemmBatchedPacked<
+  cutlass::gemm::kernel::GemmBatchedPacked<
+    TileShape, ProblemsPerCta, TiledMmaF16,
+    cutlass::half_t, StrideA,
+    cutlass::half_t, cutlass::gemm::TagToStrideB_t<cutlass::layout::ColumnMajor>,
+    float, cutlass::gemm::TagToStrideC_t<cutlass::layout::RowMajor>,
+    float, cutlass::gemm::TagToStrideC_t<cutlass::layout::RowMajor>>>;
+
+using StrideRowMajorA = cutlass::gemm::TagToStrideA_t<cutlass::layout::RowMajor>;
+using StrideColumnMajorA = cutlass::gemm::TagToStrideA_t<cutlass::layout::ColumnMajor>;
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmBatchedPacked_f16t_f16n_f32t_tensor_op_f32, 16x16x16_8problems) {
+  using Gemm = GemmBatchedPackedF16<Shape<_16,_16,_16>, 8, StrideRowMajorA>;
+  EXPECT_TRUE(test::gemm::device::TestGemmBatchedPacked<Gemm>(16, 16, 16, 1000));
+  EXPECT_TRUE(test::gemm::device::TestGemmBatchedPacked<Gemm>(8, 8, 8, 4099));
+  EXPECT_TRUE(test::gemm::device::TestGemmBatchedPacked<Gemm>(12, 16, 40, 333, 0, 2.f, -1.f));
+  EXPECT_TRUE(test::gemm::device::TestGemmBatchedPacked<Gemm>(16, 9, 16, 257, 24, 1.f, 1.f));
+}
+
+TEST(SM80_Device_GemmBatchedPacked_f16t_f16n_f32t_tensor_op_f32, 32x32x32_4problems) {
+  using Gemm = GemmBatchedPackedF16<Shape<_32,_32,_32>, 4, StrideRowMajorA>;
+  EXPECT_TRUE(test::gemm::device::TestGemmBatchedPacked<Gemm>(32, 32, 32, 513));
+  EXPECT_TRUE(test::gemm::device::TestGemmBatchedPacked<Gemm>(24, 20, 72, 130, 0, 1.f, 0.5f));
+}
+
+TEST(SM80_Device_GemmBatchedPacked_f16n_f16n_f32t_tensor_op_f32, 64x64x32_2problems) {
+  using Gemm = GemmBatchedPackedF16<Shape<_64,_64,_32>, 2, StrideColumnMajorA>;
+  EXPECT_TRUE(test::gemm::device::TestGemmBatchedPacked<Gemm>(64, 64, 64, 65));
+  EXPECT_TRUE(test::gemm::device::TestGemmBatchedPacked<Gemm>(48, 56, 24, 31, 8, 1.f, 2.f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
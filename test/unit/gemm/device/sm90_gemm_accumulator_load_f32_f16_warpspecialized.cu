@@ -0,0 +1,194 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for running SM90 collective epilogues standalone with the accumulator load mainloop
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_mma.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace {
+
+// Builds D = ReLU(alpha * X + beta * C) with X (float, row-major) in place of the accumulators
+template <class TileShape, class AtomLayout, class KernelSchedule, class EpilogueSchedule>
+struct AccumulatorLoadGemm {
+  using ElementX = float;
+  using StrideX = cute::Stride<int64_t, cute::Int<1>, int64_t>;
+  using ElementC = cutlass::half_t;
+  using LayoutC = cutlass::layout::ColumnMajor;
+  using ClusterShape = Shape<_1,_1,_1>;
+
+  using TiledMma = decltype(cute::make_tiled_mma(
+      cute::GMMA::ss_op_selector<cutlass::half_t, cutlass::half_t, float, TileShape>(), AtomLayout{}));
+
+  using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+      cutlass::gemm::MainloopSm90TmaAccumulatorLoadWarpSpecialized<2, ClusterShape, KernelSchedule>,
+      TileShape,
+      ElementX, StrideX,
+      void, void,
+      TiledMma,
+      cute::SM90_TMA_LOAD, cute::GMMA::Layout_K_SW128_Atom<ElementX>, void, cute::identity,
+      void, void, void, void
+    >;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementC, LayoutC, 8,
+      ElementC, LayoutC, 8,
+      EpilogueSchedule,
+      cutlass::epilogue::fusion::LinCombEltAct<cutlass::epilogue::thread::ReLu, ElementC, float>
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class Gemm>
+bool run_accumulator_load(int M, int N, int L, float alpha, float beta) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementX = typename GemmKernel::ElementA;
+  using StrideX = typename GemmKernel::StrideA;
+  using ElementC = typename GemmKernel::ElementC;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+
+  auto dX = cutlass::make_cute_packed_stride(StrideX{}, cute::make_shape(M, N, L));
+  auto dC = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, L));
+  auto dD = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, L));
+
+  // Small integers keep every intermediate exact, so D must match bit for bit
+  size_t count = size_t(M) * N * L;
+  std::vector<ElementX> host_X(count);
+  std::vector<ElementC> host_C(count);
+  for (size_t i = 0; i < count; ++i) {
+    host_X[i] = ElementX(int(i * 7 % 17) - 8);
+    host_C[i] = ElementC(int(i * 5 % 11) - 5);
+  }
+
+  cutlass::DeviceAllocation<ElementX> X(count);
+  cutlass::DeviceAllocation<ElementC> C(count);
+  cutlass::DeviceAllocation<ElementC> D(count);
+  X.copy_from_host(host_X.data());
+  C.copy_from_host(host_C.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, 1, L},
+    {X.get(), dX},
+    {{}, C.get(), dC, D.get(), dD},
+    hw_info
+  };
+  arguments.epilogue.thread.alpha = alpha;
+  arguments.epilogue.thread.beta = beta;
+
+  Gemm gemm;
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess ||
+      gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    return false;
+  }
+
+  std::vector<ElementC> host_D(count);
+  D.copy_to_host(host_D.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int n = 0; n < N; ++n) {
+      for (int m = 0; m < M; ++m) {
+        float x = float(host_X[m * get<0>(dX) + n + l * get<2>(dX)]);
+        int64_t c_idx = m + n * get<1>(dC) + l * get<2>(dC);
+        float expected = std::max(alpha * x + beta * float(host_C[c_idx]), 0.f);
+        if (float(host_D[m + n * get<1>(dD) + l * get<2>(dD)]) != expected) {
+          std::cerr << "Mismatch at (" << m << "," << n << "," << l << "): expected " << expected << "\n";
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+TEST(SM90_Device_Gemm_accumulator_load_f32t_f16n_warpspecialized_cooperative, 128x128_relu) {
+  using Gemm = AccumulatorLoadGemm<
+      Shape<_128,_128,_64>, Layout<Shape<_2,_1,_1>>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+      cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+  EXPECT_TRUE(run_accumulator_load<Gemm>(256, 384, 1, 1.0f, 0.0f));
+  EXPECT_TRUE(run_accumulator_load<Gemm>(200, 136, 3, 2.0f, 1.0f));
+}
+
+TEST(SM90_Device_Gemm_accumulator_load_f32t_f16n_warpspecialized_pingpong, 64x128_relu) {
+  using Gemm = AccumulatorLoadGemm<
+      Shape<_64,_128,_64>, Layout<Shape<_1,_1,_1>>,
+      cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+      cutlass::epilogue::TmaWarpSpecialized>::Gemm;
+  EXPECT_TRUE(run_accumulator_load<Gemm>(256, 384, 1, 1.0f, 0.0f));
+  EXPECT_TRUE(run_accumulator_load<Gemm>(200, 136, 3, 2.0f, 1.0f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,240 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the per-column batch-norm statistics epilogue
+    D = alpha * acc + beta * C, sum = sum over M of D, sum_squares = sum over M of D^2
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Runs a GEMM with per-column batch-norm statistics on small integer inputs, so that every sum is
+/// exact in fp32, and compares D, the sums and the sums of squares against a host reference.
+template <class Gemm>
+bool TestBatchNormStats(int M, int N, int K, int L, float alpha, float beta) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using FusionArguments = typename GemmKernel::CollectiveEpilogue::FusionCallbacks::Arguments;
+
+  auto dA = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, make_shape(M, K, L));
+  auto dB = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, make_shape(N, K, L));
+  auto dC = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, make_shape(M, N, L));
+  auto dD = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, make_shape(M, N, L));
+  typename FusionArguments::StrideStats dStats = {_0{}, _1{}, int64_t(N)};
+
+  size_t size_A = size_t(M) * K * L;
+  size_t size_B = size_t(N) * K * L;
+  size_t size_C = size_t(M) * N * L;
+  size_t size_stats = size_t(N) * L;
+
+  std::vector<ElementA> host_A(size_A);
+  std::vector<ElementB> host_B(size_B);
+  std::vector<ElementC> host_C(size_C);
+  std::vector<ElementD> host_D(size_C);
+  std::vector<float> host_sum(size_stats, -1.f);
+  std::vector<float> host_sum_squares(size_stats, -1.f);
+
+  for (size_t i = 0; i < size_A; ++i) {
+    host_A[i] = ElementA(int((i * 7 + 3) % 3) - 1);
+  }
+  for (size_t i = 0; i < size_B; ++i) {
+    host_B[i] = ElementB(int((i * 11 + 1) % 3) - 1);
+  }
+  for (size_t i = 0; i < size_C; ++i) {
+    host_C[i] = ElementC(int((i * 13 + 2) % 7) - 3);
+  }
+
+  cutlass::DeviceAllocation<ElementA> block_A(size_A);
+  cutlass::DeviceAllocation<ElementB> block_B(size_B);
+  cutlass::DeviceAllocation<ElementC> block_C(size_C);
+  cutlass::DeviceAllocation<ElementD> block_D(size_C);
+  cutlass::DeviceAllocation<float> block_sum(size_stats);
+  cutlass::DeviceAllocation<float> block_sum_squares(size_stats);
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+  block_sum.copy_from_host(host_sum.data());
+  block_sum_squares.copy_from_host(host_sum_squares.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, L},
+    {block_A.get(), dA, block_B.get(), dB},
+    {{}, block_C.get(), dC, block_D.get(), dD},
+    hw_info
+  };
+  auto& fusion_args = arguments.epilogue.thread;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.sum_ptr = block_sum.get();
+  fusion_args.dSum = dStats;
+  fusion_args.sum_squares_ptr = block_sum_squares.get();
+  fusion_args.dSumSquares = dStats;
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "Problem is not supported.\n";
+    return false;
+  }
+
+  // The final reduction across M tiles keeps its partials in the workspace
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "GEMM failed to run.\n";
+    return false;
+  }
+
+  block_D.copy_to_host(host_D.data());
+  block_sum.copy_to_host(host_sum.data());
+  block_sum_squares.copy_to_host(host_sum_squares.data());
+
+  Tensor tA = make_tensor(host_A.data(), make_shape(M, K, L), dA);
+  Tensor tB = make_tensor(host_B.data(), make_shape(N, K, L), dB);
+  Tensor tC = make_tensor(host_C.data(), make_shape(M, N, L), dC);
+  Tensor tD = make_tensor(host_D.data(), make_shape(M, N, L), dD);
+
+  for (int l = 0; l < L; ++l) {
+    for (int n = 0; n < N; ++n) {
+      float sum = 0.f;
+      float sum_squares = 0.f;
+      for (int m = 0; m < M; ++m) {
+        float accum = 0.f;
+        for (int k = 0; k < K; ++k) {
+          accum += float(tA(m, k, l)) * float(tB(n, k, l));
+        }
+        float expected = alpha * accum + beta * float(tC(m, n, l));
+        if (float(tD(m, n, l)) != expected) {
+          std::cerr << "D mismatch at (m, n, l) = (" << m << ", " << n << ", " << l << "): "
+                    << float(tD(m, n, l)) << " != " << expected << "\n";
+          return false;
+        }
+        sum += expected;
+        sum_squares += expected * expected;
+      }
+      if (host_sum[n + size_t(N) * l] != sum || host_sum_squares[n + size_t(N) * l] != sum_squares) {
+        std::cerr << "Statistics mismatch at (n, l) = (" << n << ", " << l << "): sum "
+                  << host_sum[n + size_t(N) * l] << " != " << sum << ", sum of squares "
+                  << host_sum_squares[n + size_t(N) * l] << " != " << sum_squares << "\n";
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_PerColBatchNormStats) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_2,_1,_1>;
+
+  using FusionOperation = cutlass::epilogue::fusion::LinCombPerColBatchNormStats<cutlass::half_t, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, LayoutC, 8,
+      cutlass::half_t, LayoutC, 8,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, LayoutB, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  // M is not a multiple of the tile, so the last M tile of every column contributes a partial tile
+  EXPECT_TRUE(test::gemm::device::TestBatchNormStats<Gemm>(1000, 256, 64, 1, 1.f, 1.f));
+  EXPECT_TRUE(test::gemm::device::TestBatchNormStats<Gemm>(72, 136, 128, 1, 1.f, 0.f));
+  EXPECT_TRUE(test::gemm::device::TestBatchNormStats<Gemm>(520, 128, 64, 3, 2.f, -1.f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,157 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the bias-gradient column reduction epilogue
+    D = alpha * acc + beta * C, db(k) = sum_m A(m,k)
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Reduces the rows of the A operand into a float bias gradient and compares it bitwise with the
+/// host column sums, which are exact for the small-integer operands. Also checks D, and that a
+/// rerun reproduces the bias gradient bit for bit.
+template <class Gemm>
+bool TestBiasGrad(int M, int N, int K, int L) {
+  using ElementBiasGrad = float;
+  using ElementD = typename Gemm::ElementD;
+
+  FusionTestbed<Gemm> testbed(M, N, K, L, 3);
+  testbed.beta = 1.f;
+
+  int64_t const batch_stride_bias_grad = K + 8;
+  // Padding between batches keeps the NaN sentinel
+  std::vector<ElementBiasGrad> bias_grad(size_t(L) * batch_stride_bias_grad, ElementBiasGrad(NAN));
+  cutlass::DeviceAllocation<ElementBiasGrad> block_bias_grad(bias_grad.size());
+  block_bias_grad.copy_from_host(bias_grad.data());
+
+  auto arguments = testbed.arguments();
+  auto& reduction = arguments.epilogue.thread.bias_grad;
+  reduction.ptr_operand = testbed.block_A.get();
+  reduction.stride_operand = K;
+  reduction.batch_stride_operand = int64_t(M) * K;
+  reduction.ptr_bias_grad = block_bias_grad.get();
+  reduction.batch_stride_bias_grad = batch_stride_bias_grad;
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+  block_bias_grad.copy_to_host(bias_grad.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        if (float(testbed.D(m, n, l)) != float(ElementD(testbed.reference(m, n, l)))) {
+          std::cerr << "D mismatch at (m, n, l) = (" << m << ", " << n << ", " << l << ")\n";
+          return false;
+        }
+      }
+    }
+    for (int k = 0; k < K; ++k) {
+      float expected = 0.f;
+      for (int m = 0; m < M; ++m) {
+        expected += float(testbed.host_A[(size_t(l) * M + m) * K + k]);
+      }
+      float computed = bias_grad[l * batch_stride_bias_grad + k];
+      if (computed != expected) {
+        std::cerr << "Bias gradient mismatch at (k, l) = (" << k << ", " << l << "): "
+                  << computed << " != " << expected << "\n";
+        return false;
+      }
+    }
+  }
+
+  std::vector<ElementBiasGrad> first_run = bias_grad;
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+  block_bias_grad.copy_to_host(bias_grad.data());
+  for (int l = 0; l < L; ++l) {
+    for (int k = 0; k < K; ++k) {
+      if (bias_grad[l * batch_stride_bias_grad + k] != first_run[l * batch_stride_bias_grad + k]) {
+        std::cerr << "Rerun changed the bias gradient at (k, l) = (" << k << ", " << l << ")\n";
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_BiasGrad) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombBiasGrad<cutlass::half_t, float, cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  // Residue N tile, K split evenly over the two tile columns
+  EXPECT_TRUE(test::gemm::device::TestBiasGrad<Gemm>(300, 200, 320, 2));
+  // Last K chunk shorter than the others
+  EXPECT_TRUE(test::gemm::device::TestBiasGrad<Gemm>(300, 200, 136, 1));
+  // More tile columns than K chunks, the trailing tiles reduce nothing
+  EXPECT_TRUE(test::gemm::device::TestBiasGrad<Gemm>(200, 1000, 64, 1));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x64x64_2x1x1_BiasGrad) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombBiasGrad<cutlass::half_t, float, cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<
+      FusionOperation, Shape<_128,_64,_64>, Shape<_2,_1,_1>>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestBiasGrad<Gemm>(300, 200, 320, 2));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
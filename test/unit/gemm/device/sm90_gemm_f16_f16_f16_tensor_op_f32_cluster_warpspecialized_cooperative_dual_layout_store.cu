@@ -0,0 +1,129 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the dual-layout D store epilogue
+    D = alpha * acc + beta * C, stored in LayoutC and again in the aux layout
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+template <class LayoutC, class LayoutAux, class TileShape_MNK, class ClusterShape_MNK, class EpilogueSchedule, class KernelSchedule>
+struct Sm90DualLayoutStoreGemm {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombDualLayoutStore<
+      LayoutAux, cutlass::half_t, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, LayoutC, 8,
+      cutlass::half_t, LayoutC, 8,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+} // namespace test::gemm::device
+
+// The testbed checks D in LayoutC and Aux in the aux layout against the host reference
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 256x128x64_2x2x1_DualLayoutStore_ColumnMajorAux) {
+  using Gemm = typename test::gemm::device::Sm90DualLayoutStoreGemm<
+      cutlass::layout::RowMajor, cutlass::layout::ColumnMajor,
+      Shape<_256,_128,_64>, Shape<_2,_2,_1>,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(1, 1));
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(2, 0));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16n_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x2x1_DualLayoutStore_RowMajorAux) {
+  using Gemm = typename test::gemm::device::Sm90DualLayoutStoreGemm<
+      cutlass::layout::ColumnMajor, cutlass::layout::RowMajor,
+      Shape<_128,_128,_64>, Shape<_1,_2,_1>,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(1, 1));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_DualLayoutStore_ColumnMajorAux) {
+  using Gemm = typename test::gemm::device::Sm90DualLayoutStoreGemm<
+      cutlass::layout::RowMajor, cutlass::layout::ColumnMajor,
+      Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+      cutlass::epilogue::TmaWarpSpecialized,
+      cutlass::gemm::KernelTmaWarpSpecializedPingpong
+    >::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(1, 1));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
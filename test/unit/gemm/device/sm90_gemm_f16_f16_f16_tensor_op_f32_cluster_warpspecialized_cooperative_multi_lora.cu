@@ -0,0 +1,157 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the multi-LoRA expand epilogue
+    D = alpha * acc + beta * C + scale(i) * T(m,:) * B_i, i = adapter_idx(m)
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Every CTA tile mixes rows of all adapters with pass-through rows (adapter -1), and the rows
+/// past the last full M tile exercise the residue. T and B hold small integers and the scales are
+/// powers of two, so D is exact and compared bitwise with the host reference.
+template <class Gemm>
+bool TestMultiLoRA(int M, int N, int rank, int64_t stride_T, int num_adapters) {
+  using ElementLoRA = cutlass::half_t;
+  using ElementD = typename Gemm::ElementD;
+
+  FusionTestbed<Gemm> testbed(M, N, 64);
+  testbed.beta = 1.f;
+
+  int64_t const stride_B = N + 8;
+  int64_t const stride_adapter = rank * stride_B;
+  std::vector<ElementLoRA> T(size_t(M) * stride_T);
+  std::vector<ElementLoRA> B(size_t(num_adapters) * stride_adapter);
+  fill_small_integers(T, 5, 2);
+  fill_small_integers(B, 6, 2);
+
+  std::vector<int32_t> adapter_idx(M);
+  for (int m = 0; m < M; ++m) {
+    adapter_idx[m] = (m * 7) % (num_adapters + 1) - 1;
+  }
+  std::vector<float> scales(num_adapters);
+  for (int i = 0; i < num_adapters; ++i) {
+    scales[i] = float(1 << i) * 0.5f;
+  }
+
+  cutlass::DeviceAllocation<ElementLoRA> block_T(T.size());
+  cutlass::DeviceAllocation<ElementLoRA> block_B(B.size());
+  cutlass::DeviceAllocation<int32_t> block_adapter_idx(M);
+  cutlass::DeviceAllocation<float> block_scales(num_adapters);
+  block_T.copy_from_host(T.data());
+  block_B.copy_from_host(B.data());
+  block_adapter_idx.copy_from_host(adapter_idx.data());
+  block_scales.copy_from_host(scales.data());
+
+  auto arguments = testbed.arguments();
+  auto& lora = arguments.epilogue.thread.lora;
+  lora.ptr_T = block_T.get();
+  lora.stride_T = stride_T;
+  lora.ptr_adapter_idx = block_adapter_idx.get();
+  lora.ptr_B = block_B.get();
+  lora.stride_adapter = stride_adapter;
+  lora.stride_B = stride_B;
+  lora.ptr_scales = block_scales.get();
+  lora.rank = rank;
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+
+  for (int m = 0; m < M; ++m) {
+    int32_t adapter = adapter_idx[m];
+    for (int n = 0; n < N; ++n) {
+      float expected = testbed.reference(m, n, 0);
+      if (adapter >= 0) {
+        float update = 0.f;
+        for (int r = 0; r < rank; ++r) {
+          update += float(T[m * stride_T + r]) * float(B[adapter * stride_adapter + r * stride_B + n]);
+        }
+        expected += scales[adapter] * update;
+      }
+      if (testbed.D(m, n, 0) != ElementD(expected)) {
+        std::cerr << "D mismatch at (m, n) = (" << m << ", " << n << "), adapter " << adapter << ": "
+                  << float(testbed.D(m, n, 0)) << " != " << expected << "\n";
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_MultiLoRA) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombMultiLoRA<16, cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  // Full rank
+  EXPECT_TRUE(test::gemm::device::TestMultiLoRA<Gemm>(300, 256, 16, 16, 3));
+  // Rank below MaxRank with padded T rows
+  EXPECT_TRUE(test::gemm::device::TestMultiLoRA<Gemm>(300, 200, 8, 24, 3));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x64x64_2x1x1_MultiLoRA) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombMultiLoRA<16, cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<
+      FusionOperation, Shape<_128,_64,_64>, Shape<_2,_1,_1>>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestMultiLoRA<Gemm>(300, 256, 16, 16, 3));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
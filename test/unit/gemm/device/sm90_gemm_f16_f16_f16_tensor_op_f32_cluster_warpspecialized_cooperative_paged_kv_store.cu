@@ -0,0 +1,221 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the paged FP8 KV-cache store epilogue
+    D = alpha * acc + beta * C, K and V heads of D scaled, converted to e4m3 and written through a block table
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Projects `tokens` tokens dealt round-robin to three sequences, with every 13th token a padding
+/// token, and checks every byte of the K (and V) caches against a host paged store of Z.
+/// Pages are handed out in a scrambled order and heads are padded, so the page, slot and head
+/// strides are all exercised, and tokens beyond the last full M tile exercise the residue.
+template <class Gemm>
+bool TestPagedKVCacheStore(int tokens, int num_kv_heads, int head_dim, bool store_v) {
+  using ElementCache = cutlass::float_e4m3_t;
+  using ElementD = typename Gemm::ElementD;
+
+  int const N = (store_v ? 2 : 1) * num_kv_heads * head_dim;
+  FusionTestbed<Gemm> testbed(tokens, N, 64);
+  testbed.beta = 1.f;
+
+  int const num_seqs = 3;
+  int const page_size = 16;
+  std::vector<int32_t> seq_idx(tokens);
+  std::vector<int32_t> positions(tokens);
+  std::vector<int> seq_len(num_seqs, 0);
+  for (int m = 0; m < tokens; ++m) {
+    bool is_padding = m % 13 == 5;
+    seq_idx[m] = is_padding ? -1 : m % num_seqs;
+    positions[m] = is_padding ? 0 : seq_len[m % num_seqs]++;
+  }
+
+  int const max_pages = (*std::max_element(seq_len.begin(), seq_len.end()) + page_size - 1) / page_size;
+  int const num_pages = num_seqs * max_pages;
+  std::vector<int32_t> block_table(num_pages);
+  for (int i = 0; i < num_pages; ++i) {
+    block_table[i] = i % 2 == 0 ? i / 2 : num_pages - 1 - i / 2;
+  }
+
+  int64_t const stride_head = head_dim + 16;
+  int64_t const stride_slot = num_kv_heads * stride_head;
+  int64_t const stride_page = page_size * stride_slot;
+  size_t const cache_size = size_t(num_pages) * stride_page;
+
+  // Power-of-two scales keep the division exact on host and device
+  std::vector<float> k_scale(num_kv_heads);
+  std::vector<float> v_scale(num_kv_heads);
+  for (int h = 0; h < num_kv_heads; ++h) {
+    k_scale[h] = h % 2 == 0 ? 0.5f : 2.f;
+    v_scale[h] = h % 2 == 0 ? 4.f : 0.25f;
+  }
+
+  // Slots never written keep the NaN sentinel
+  ElementCache const sentinel = ElementCache::bitcast(0x7F);
+  std::vector<ElementCache> host_k_cache(cache_size, sentinel);
+  std::vector<ElementCache> host_v_cache(store_v ? cache_size : 0, sentinel);
+
+  cutlass::DeviceAllocation<int32_t> block_seq_idx(tokens);
+  cutlass::DeviceAllocation<int32_t> block_positions(tokens);
+  cutlass::DeviceAllocation<int32_t> block_block_table(num_pages);
+  cutlass::DeviceAllocation<float> block_k_scale(num_kv_heads);
+  cutlass::DeviceAllocation<float> block_v_scale(num_kv_heads);
+  cutlass::DeviceAllocation<ElementCache> block_k_cache(cache_size);
+  cutlass::DeviceAllocation<ElementCache> block_v_cache(host_v_cache.size());
+  block_seq_idx.copy_from_host(seq_idx.data());
+  block_positions.copy_from_host(positions.data());
+  block_block_table.copy_from_host(block_table.data());
+  block_k_scale.copy_from_host(k_scale.data());
+  block_v_scale.copy_from_host(v_scale.data());
+  block_k_cache.copy_from_host(host_k_cache.data());
+  if (store_v) {
+    block_v_cache.copy_from_host(host_v_cache.data());
+  }
+
+  auto arguments = testbed.arguments();
+  auto& cache = arguments.epilogue.thread.cache;
+  cache.ptr_k_cache = block_k_cache.get();
+  cache.ptr_v_cache = store_v ? block_v_cache.get() : nullptr;
+  cache.ptr_k_scale = block_k_scale.get();
+  cache.ptr_v_scale = block_v_scale.get();
+  cache.ptr_seq_idx = block_seq_idx.get();
+  cache.ptr_positions = block_positions.get();
+  cache.ptr_block_table = block_block_table.get();
+  cache.stride_block_table = max_pages;
+  cache.stride_page = stride_page;
+  cache.stride_slot = stride_slot;
+  cache.stride_head = stride_head;
+  cache.page_size = page_size;
+  cache.head_dim = head_dim;
+  cache.num_kv_heads = num_kv_heads;
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+
+  std::vector<ElementCache> k_cache(cache_size);
+  std::vector<ElementCache> v_cache(host_v_cache.size());
+  block_k_cache.copy_to_host(k_cache.data());
+  if (store_v) {
+    block_v_cache.copy_to_host(v_cache.data());
+  }
+
+  // Host paged store of Z, D passes Z through
+  cutlass::NumericConverter<ElementCache, float> convert_cache;
+  int const k_columns = num_kv_heads * head_dim;
+  for (int m = 0; m < tokens; ++m) {
+    for (int n = 0; n < N; ++n) {
+      float z = testbed.reference(m, n, 0);
+      if (float(testbed.D(m, n, 0)) != float(ElementD(z))) {
+        std::cerr << "D mismatch at (m, n) = (" << m << ", " << n << ")\n";
+        return false;
+      }
+      if (seq_idx[m] < 0) {
+        continue;
+      }
+      bool is_v = n >= k_columns;
+      int col = is_v ? n - k_columns : n;
+      int head = col / head_dim;
+      int page = block_table[seq_idx[m] * max_pages + positions[m] / page_size];
+      int64_t offset = page * stride_page + (positions[m] % page_size) * stride_slot + head * stride_head + col % head_dim;
+      float scale = is_v ? v_scale[head] : k_scale[head];
+      (is_v ? host_v_cache : host_k_cache)[offset] = convert_cache(z / scale);
+    }
+  }
+
+  for (size_t i = 0; i < cache_size; ++i) {
+    if (k_cache[i].raw() != host_k_cache[i].raw()) {
+      std::cerr << "K cache mismatch at element " << i << ": " << float(k_cache[i])
+                << " != " << float(host_k_cache[i]) << "\n";
+      return false;
+    }
+  }
+  for (size_t i = 0; i < v_cache.size(); ++i) {
+    if (v_cache[i].raw() != host_v_cache[i].raw()) {
+      std::cerr << "V cache mismatch at element " << i << ": " << float(v_cache[i])
+                << " != " << float(host_v_cache[i]) << "\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_PagedKVCacheStore) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombPagedKVCacheStore<cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  // Fused K and V projection
+  EXPECT_TRUE(test::gemm::device::TestPagedKVCacheStore<Gemm>(300, 2, 64, true));
+  // K projection only
+  EXPECT_TRUE(test::gemm::device::TestPagedKVCacheStore<Gemm>(77, 1, 128, false));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x64x64_2x1x1_PagedKVCacheStore) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombPagedKVCacheStore<cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<
+      FusionOperation, Shape<_128,_64,_64>, Shape<_2,_1,_1>>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestPagedKVCacheStore<Gemm>(520, 4, 64, true));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
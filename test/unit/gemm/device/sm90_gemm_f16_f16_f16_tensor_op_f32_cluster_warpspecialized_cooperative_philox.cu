@@ -0,0 +1,266 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the Philox driven dropout and stochastic rounding epilogues
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_philox.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Host replica of the device RNG, drawing from the same Philox counters
+inline cutlass::epilogue::fusion::detail::PhiloxElementRng
+host_philox_rng(uint64_t seed, uint32_t offset, uint32_t subsequence) {
+  return {make_uint2(static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)), offset, subsequence};
+}
+
+/// Dropout with a packed keep mask. Checks D and the mask bitwise against a host replica of the RNG,
+/// the keep rate against 1 - p, that a rerun with the same seed and offset is bit-identical and
+/// that advancing the offset draws a different mask.
+template <class Gemm>
+bool TestDropout(int M, int N, int K, int L, float dropout_probability) {
+  using ElementD = typename Gemm::ElementD;
+
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+  testbed.beta = 1.f;
+
+  uint64_t const seed = 0x0123456789ABCDEFull;
+  uint32_t const offset = 17;
+  int64_t const ld_mask = (N + 31) / 32 + 1;
+  int64_t const batch_stride_mask = M * ld_mask;
+  size_t const mask_words = size_t(L) * batch_stride_mask;
+
+  cutlass::DeviceAllocation<uint32_t> block_mask(mask_words);
+
+  auto arguments = testbed.arguments();
+  auto& dropout = arguments.epilogue.thread.dropout;
+  dropout.seed = seed;
+  dropout.offset = offset;
+  dropout.dropout_probability = dropout_probability;
+  dropout.ptr_mask = block_mask.get();
+  dropout.ld_mask = ld_mask;
+  dropout.batch_stride_mask = batch_stride_mask;
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+  std::vector<ElementD> D = testbed.host_D;
+  std::vector<uint32_t> mask(mask_words);
+  block_mask.copy_to_host(mask.data());
+
+  // Host dropout of Z
+  double p = static_cast<double>(dropout_probability);
+  uint32_t threshold = static_cast<uint32_t>(std::min(p * 4294967296.0, 4294967295.0));
+  float scale = static_cast<float>(1.0 / (1.0 - p));
+  auto rng = host_philox_rng(seed, offset, 0);
+  std::vector<uint32_t> expected_mask(mask_words, 0);
+  size_t kept = 0;
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        bool keep = rng(m, n, l) >= threshold;
+        kept += keep;
+        expected_mask[l * batch_stride_mask + m * ld_mask + n / 32] |= uint32_t(keep) << (n % 32);
+        ElementD expected = ElementD(keep ? testbed.reference(m, n, l) * scale : 0.f);
+        if (testbed.D(m, n, l) != expected) {
+          std::cerr << "D mismatch at (m, n, l) = (" << m << ", " << n << ", " << l << "): "
+                    << float(testbed.D(m, n, l)) << " != " << float(expected) << "\n";
+          return false;
+        }
+      }
+    }
+  }
+  if (mask != expected_mask) {
+    std::cerr << "Keep mask mismatch.\n";
+    return false;
+  }
+
+  double keep_rate = double(kept) / (double(M) * N * L);
+  if (std::abs(keep_rate - (1.0 - p)) > 0.01) {
+    std::cerr << "Keep rate " << keep_rate << " is not within 1% of " << 1.0 - p << "\n";
+    return false;
+  }
+
+  // Same seed and offset, bit-identical output and mask
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+  block_mask.copy_to_host(mask.data());
+  for (size_t i = 0; i < D.size(); ++i) {
+    if (D[i].raw() != testbed.host_D[i].raw()) {
+      std::cerr << "Rerun with the same seed and offset differs at element " << i << "\n";
+      return false;
+    }
+  }
+  if (mask != expected_mask) {
+    std::cerr << "Rerun with the same seed and offset changed the keep mask.\n";
+    return false;
+  }
+
+  // Next offset, a fresh mask
+  dropout.offset = offset + 1;
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+  block_mask.copy_to_host(mask.data());
+  if (mask == expected_mask) {
+    std::cerr << "Advancing the offset did not change the keep mask.\n";
+    return false;
+  }
+
+  return true;
+}
+
+/// Stochastic rounding of Z = A * B / 3, which is rarely representable in the output type.
+/// Checks D bitwise against a host replica of the RNG and rounding, that a rerun is bit-identical,
+/// and that the rounding is unbiased: the summed rounding error, in units of the bracket width of
+/// each element, stays within 5 standard deviations of 0.
+template <class Gemm>
+bool TestStochasticRound(int M, int N, int K) {
+  using ElementD = typename Gemm::ElementD;
+  using cutlass::epilogue::fusion::detail::stochastic_round;
+
+  FusionTestbed<Gemm> testbed(M, N, K, 1, 2);
+  testbed.alpha = 1.f / 3.f;
+
+  uint64_t const seed = 42;
+  uint32_t const offset = 3;
+
+  auto arguments = testbed.arguments();
+  auto& rounding = arguments.epilogue.thread.rounding;
+  rounding.seed = seed;
+  rounding.offset = offset;
+  rounding.enable = true;
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+  std::vector<ElementD> D = testbed.host_D;
+
+  auto rng = host_philox_rng(seed, offset, 1);
+  double bias = 0.;
+  double variance = 0.;
+  size_t rounded_away = 0;
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < N; ++n) {
+      float z = testbed.reference(m, n, 0);
+      ElementD expected = stochastic_round<ElementD>(z, rng(m, n, 0));
+      if (testbed.D(m, n, 0).raw() != expected.raw()) {
+        std::cerr << "D mismatch at (m, n) = (" << m << ", " << n << "): "
+                  << float(testbed.D(m, n, 0)) << " != " << float(expected) << "\n";
+        return false;
+      }
+
+      // A zero draw always selects the bracketing value other than the nearest
+      ElementD nearest = ElementD(z);
+      float width = std::abs(float(stochastic_round<ElementD>(z, 0u)) - float(nearest));
+      if (width == 0.f) {
+        continue;
+      }
+      bias += (double(float(expected)) - double(z)) / width;
+      variance += 0.25;
+      rounded_away += expected.raw() != nearest.raw();
+    }
+  }
+  if (std::abs(bias) > 5. * std::sqrt(variance)) {
+    std::cerr << "Stochastic rounding is biased: " << bias << " bracket widths over "
+              << 4. * variance << " rounded elements\n";
+    return false;
+  }
+  if (rounded_away == 0) {
+    std::cerr << "No element was rounded away from the nearest value.\n";
+    return false;
+  }
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+  for (size_t i = 0; i < D.size(); ++i) {
+    if (D[i].raw() != testbed.host_D[i].raw()) {
+      std::cerr << "Rerun with the same seed and offset differs at element " << i << "\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_Dropout) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombDropout<cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestDropout<Gemm>(300, 200, 64, 2, 0.3f));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_StochasticRound) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombStochasticRound<cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestStochasticRound<Gemm>(300, 256, 64));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_bf16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_StochasticRound) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombStochasticRound<cutlass::bfloat16_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestStochasticRound<Gemm>(300, 256, 64));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
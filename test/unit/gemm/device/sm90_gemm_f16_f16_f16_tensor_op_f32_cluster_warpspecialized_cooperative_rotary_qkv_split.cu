@@ -0,0 +1,234 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the rotary embedding and QKV split epilogue
+    D = rope(alpha * acc + beta * C), the Q, K and V heads of D scattered to three strided outputs
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Rotates the Q and K heads of a fused QKV projection and checks D and the three split outputs
+/// against a host reference. Q is dense, K is paged through a scrambled slot mapping with padding
+/// tokens, and V has padded heads, so all three output addressing modes are exercised.
+/// The cos / sin tables hold dyadic fractions, so the rotation is exact and the comparison bitwise.
+template <class Gemm>
+bool TestRotaryQKVSplit(int tokens, int num_q_heads, int num_kv_heads, int head_dim, int rotary_dim) {
+  using ElementD = typename Gemm::ElementD;
+
+  int const N = (num_q_heads + 2 * num_kv_heads) * head_dim;
+  int const num_rotary_heads = num_q_heads + num_kv_heads;
+  FusionTestbed<Gemm> testbed(tokens, N, 64);
+  testbed.beta = 1.f;
+
+  int const max_position = 97;
+  int const table_stride = rotary_dim / 2 + 3;
+  std::vector<int32_t> position_ids(tokens);
+  for (int m = 0; m < tokens; ++m) {
+    position_ids[m] = (m * 5) % max_position;
+  }
+  std::vector<float> cos_table(max_position * table_stride);
+  std::vector<float> sin_table(max_position * table_stride);
+  for (int i = 0; i < max_position * table_stride; ++i) {
+    cos_table[i] = float((i * 3) % 5 - 2) * 0.5f;
+    sin_table[i] = float((i * 7) % 5 - 2) * 0.25f;
+  }
+
+  // K is paged with blocks of 16 tokens, every 11th token is padding
+  int const block_size = 16;
+  int const num_slots = 256;
+  std::vector<int32_t> slot_mapping(tokens);
+  for (int m = 0; m < tokens; ++m) {
+    slot_mapping[m] = m % 11 == 3 ? -1 : (m * 37) % num_slots;
+  }
+
+  int64_t const q_stride_head = head_dim;
+  int64_t const q_stride_token = num_q_heads * q_stride_head;
+  int64_t const k_stride_head = head_dim;
+  int64_t const k_stride_token = num_kv_heads * k_stride_head;
+  int64_t const k_stride_block = block_size * k_stride_token;
+  int64_t const v_stride_head = head_dim + 8;
+  int64_t const v_stride_token = num_kv_heads * v_stride_head;
+
+  // Elements never written keep the sentinel
+  ElementD const sentinel = ElementD(-1000.f);
+  std::vector<ElementD> host_q(size_t(tokens) * q_stride_token, sentinel);
+  std::vector<ElementD> host_k(size_t(num_slots / block_size) * k_stride_block, sentinel);
+  std::vector<ElementD> host_v(size_t(tokens) * v_stride_token, sentinel);
+
+  cutlass::DeviceAllocation<int32_t> block_position_ids(tokens);
+  cutlass::DeviceAllocation<float> block_cos(cos_table.size());
+  cutlass::DeviceAllocation<float> block_sin(sin_table.size());
+  cutlass::DeviceAllocation<int32_t> block_slot_mapping(tokens);
+  cutlass::DeviceAllocation<ElementD> block_q(host_q.size());
+  cutlass::DeviceAllocation<ElementD> block_k(host_k.size());
+  cutlass::DeviceAllocation<ElementD> block_v(host_v.size());
+  block_position_ids.copy_from_host(position_ids.data());
+  block_cos.copy_from_host(cos_table.data());
+  block_sin.copy_from_host(sin_table.data());
+  block_slot_mapping.copy_from_host(slot_mapping.data());
+  block_q.copy_from_host(host_q.data());
+  block_k.copy_from_host(host_k.data());
+  block_v.copy_from_host(host_v.data());
+
+  auto arguments = testbed.arguments();
+  auto& rotary = arguments.epilogue.thread.rotary;
+  rotary.ptr_position_ids = block_position_ids.get();
+  rotary.ptr_cos = block_cos.get();
+  rotary.ptr_sin = block_sin.get();
+  rotary.table_stride = table_stride;
+  rotary.head_dim = head_dim;
+  rotary.rotary_dim = rotary_dim;
+  rotary.num_rotary_heads = num_rotary_heads;
+  auto& qkv = arguments.epilogue.thread.qkv;
+  qkv.q = {block_q.get(), q_stride_token, q_stride_head};
+  qkv.k = {block_k.get(), k_stride_token, k_stride_head, k_stride_block, block_slot_mapping.get(), block_size};
+  qkv.v = {block_v.get(), v_stride_token, v_stride_head};
+  qkv.head_dim = head_dim;
+  qkv.num_q_heads = num_q_heads;
+  qkv.num_kv_heads = num_kv_heads;
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+
+  std::vector<ElementD> q(host_q.size());
+  std::vector<ElementD> k(host_k.size());
+  std::vector<ElementD> v(host_v.size());
+  block_q.copy_to_host(q.data());
+  block_k.copy_to_host(k.data());
+  block_v.copy_to_host(v.data());
+
+  // Host rotation of Z, then the split
+  int const q_columns = num_q_heads * head_dim;
+  int const kv_columns = num_kv_heads * head_dim;
+  for (int m = 0; m < tokens; ++m) {
+    for (int n = 0; n < N; n += 2) {
+      float y[2] = {testbed.reference(m, n, 0), testbed.reference(m, n + 1, 0)};
+      int head_col = n % head_dim;
+      if (n < num_rotary_heads * head_dim && head_col < rotary_dim) {
+        int64_t table_idx = int64_t(position_ids[m]) * table_stride + head_col / 2;
+        float c = cos_table[table_idx];
+        float s = sin_table[table_idx];
+        float x0 = y[0];
+        float x1 = y[1];
+        y[0] = x0 * c - x1 * s;
+        y[1] = x0 * s + x1 * c;
+      }
+
+      for (int i = 0; i < 2; ++i) {
+        ElementD expected = ElementD(y[i]);
+        if (testbed.D(m, n + i, 0) != expected) {
+          std::cerr << "D mismatch at (m, n) = (" << m << ", " << n + i << "): "
+                    << float(testbed.D(m, n + i, 0)) << " != " << float(expected) << "\n";
+          return false;
+        }
+
+        int col = n + i;
+        if (col < q_columns) {
+          host_q[m * q_stride_token + (col / head_dim) * q_stride_head + col % head_dim] = expected;
+        }
+        else if (col < q_columns + kv_columns) {
+          col -= q_columns;
+          int32_t slot = slot_mapping[m];
+          if (slot >= 0) {
+            host_k[(slot / block_size) * k_stride_block + (slot % block_size) * k_stride_token +
+                   (col / head_dim) * k_stride_head + col % head_dim] = expected;
+          }
+        }
+        else {
+          col -= q_columns + kv_columns;
+          host_v[m * v_stride_token + (col / head_dim) * v_stride_head + col % head_dim] = expected;
+        }
+      }
+    }
+  }
+
+  auto compare = [](char const* name, std::vector<ElementD> const& computed, std::vector<ElementD> const& expected) {
+    for (size_t i = 0; i < computed.size(); ++i) {
+      if (computed[i] != expected[i]) {
+        std::cerr << name << " mismatch at element " << i << ": " << float(computed[i])
+                  << " != " << float(expected[i]) << "\n";
+        return false;
+      }
+    }
+    return true;
+  };
+
+  return compare("Q", q, host_q) && compare("K", k, host_k) && compare("V", v, host_v);
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_RotaryQKVSplit) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombRotaryQKVSplit<cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  // Partial rotation of grouped-query attention heads
+  EXPECT_TRUE(test::gemm::device::TestRotaryQKVSplit<Gemm>(200, 4, 2, 64, 32));
+  // Full rotation
+  EXPECT_TRUE(test::gemm::device::TestRotaryQKVSplit<Gemm>(77, 2, 2, 64, 64));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x64x64_2x1x1_RotaryQKVSplit) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombRotaryQKVSplit<cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<
+      FusionOperation, Shape<_128,_64,_64>, Shape<_2,_1,_1>>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestRotaryQKVSplit<Gemm>(200, 4, 2, 64, 32));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,398 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the weighted row scatter-reduce epilogue
+    out(dst_row(m), n) += weight(m) * (alpha * acc + beta * C), for batched and grouped GEMMs
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Destination row of source row m of batch (or group) l. Rows are folded onto fewer
+/// destinations, so several rows (of several batches) reduce into the same row, and the
+/// leading destinations are negative, so some rows are skipped.
+inline int32_t scatter_dst_row(int m, int l, int num_rows) {
+  return (m * 13 + l * 7) % (num_rows + 32) - 32;
+}
+
+/// Weights are powers of two (and -1), so every partial sum is exact in the output type
+inline float scatter_weight(int m, int l) {
+  float const weights[4] = {0.5f, 1.f, 2.f, -1.f};
+  return weights[(m * 3 + l) % 4];
+}
+
+/// Compares the accumulated output to the host scatter-reduce, accumulated in float
+template <class Element>
+bool compare_scatter_output(std::vector<Element> const& computed, std::vector<float> const& expected) {
+  for (size_t i = 0; i < computed.size(); ++i) {
+    if (float(computed[i]) != float(Element(expected[i]))) {
+      std::cerr << "Scatter-reduce mismatch at element " << i << ": " << float(computed[i])
+                << " != " << expected[i] << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Batched GEMM whose L batches all reduce into one output pre-filled with a residual.
+/// N leaves a residue tile, and the padded output row stride keeps the vector reductions aligned.
+template <class Gemm>
+bool TestRowScatterReduce(int M, int N, int K, int L, int num_rows) {
+  using ElementOutput = typename Gemm::ElementD;
+
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+  testbed.beta = 1.f;
+
+  int64_t const stride_out = N + 8;
+  std::vector<int32_t> dst_rows(size_t(M) * L);
+  std::vector<float> weights(size_t(M) * L);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      dst_rows[l * M + m] = scatter_dst_row(m, l, num_rows);
+      weights[l * M + m] = scatter_weight(m, l);
+    }
+  }
+
+  std::vector<ElementOutput> residual(size_t(num_rows) * stride_out);
+  fill_small_integers(residual, 4, 3);
+  std::vector<float> expected(residual.begin(), residual.end());
+
+  cutlass::DeviceAllocation<int32_t> block_dst_rows(dst_rows.size());
+  cutlass::DeviceAllocation<float> block_weights(weights.size());
+  cutlass::DeviceAllocation<ElementOutput> block_out(residual.size());
+  block_dst_rows.copy_from_host(dst_rows.data());
+  block_weights.copy_from_host(weights.data());
+  block_out.copy_from_host(residual.data());
+
+  auto arguments = testbed.arguments();
+  auto& scatter = arguments.epilogue.thread.scatter;
+  scatter.ptr_out = block_out.get();
+  scatter.stride_out = stride_out;
+  scatter.ptr_dst_rows = block_dst_rows.get();
+  scatter.ptr_weights = block_weights.get();
+  scatter.batch_stride = M;
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+
+  std::vector<ElementOutput> out(residual.size());
+  block_out.copy_to_host(out.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      int32_t dst_row = dst_rows[l * M + m];
+      if (dst_row < 0) {
+        continue;
+      }
+      for (int n = 0; n < N; ++n) {
+        expected[dst_row * stride_out + n] += weights[l * M + m] * testbed.reference(m, n, l);
+      }
+    }
+  }
+
+  return compare_scatter_output(out, expected);
+}
+
+/// Grouped f16 GEMM with ElementOutput C and D, e.g. the experts of a MoE layer
+template <
+  class ElementOutput,
+  class KernelSchedule = cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative,
+  class EpilogueSchedule = cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative
+>
+struct Sm90GroupedScatterReduceGemm {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+  using FusionOperation = cutlass::epilogue::fusion::LinCombRowScatterReduce<ElementOutput, float>;
+  static constexpr int AlignmentD = 128 / cutlass::sizeof_bits<ElementOutput>::value;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementOutput, cutlass::layout::RowMajor *, AlignmentD,
+      ElementOutput, cutlass::layout::RowMajor *, AlignmentD,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor *, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor *, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Groups of different M and K reduce through per-group destination and weight arrays into one output
+template <class Gemm>
+bool TestGroupedRowScatterReduce(std::vector<int> const& group_M, std::vector<int> const& group_K, int N, int num_rows) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ProblemShape = typename GemmKernel::ProblemShape;
+  using UnderlyingProblemShape = typename ProblemShape::UnderlyingProblemShape;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementOutput = typename Gemm::ElementD;
+  using StrideA = typename GemmKernel::InternalStrideA;
+  using StrideB = typename GemmKernel::InternalStrideB;
+  using StrideC = typename GemmKernel::InternalStrideC;
+  using StrideD = typename GemmKernel::InternalStrideD;
+
+  int const groups = static_cast<int>(group_M.size());
+  int64_t const stride_out = N + 8;
+
+  std::vector<UnderlyingProblemShape> problem_sizes;
+  std::vector<StrideA> stride_A;
+  std::vector<StrideB> stride_B;
+  std::vector<StrideC> stride_C;
+  std::vector<StrideD> stride_D;
+  std::vector<std::vector<ElementA>> host_A;
+  std::vector<std::vector<ElementB>> host_B;
+  std::vector<std::vector<ElementOutput>> host_C;
+  std::vector<std::vector<int32_t>> dst_rows;
+  std::vector<std::vector<float>> weights;
+  std::vector<cutlass::DeviceAllocation<ElementA>> block_A(groups);
+  std::vector<cutlass::DeviceAllocation<ElementB>> block_B(groups);
+  std::vector<cutlass::DeviceAllocation<ElementOutput>> block_C(groups);
+  std::vector<cutlass::DeviceAllocation<ElementOutput>> block_D(groups);
+  std::vector<cutlass::DeviceAllocation<int32_t>> block_dst_rows(groups);
+  std::vector<cutlass::DeviceAllocation<float>> block_weights(groups);
+
+  for (int g = 0; g < groups; ++g) {
+    int M = group_M[g];
+    int K = group_K[g];
+    problem_sizes.push_back({M, N, K});
+    stride_A.push_back(cutlass::make_cute_packed_stride(StrideA{}, make_shape(M, K, 1)));
+    stride_B.push_back(cutlass::make_cute_packed_stride(StrideB{}, make_shape(N, K, 1)));
+    stride_C.push_back(cutlass::make_cute_packed_stride(StrideC{}, make_shape(M, N, 1)));
+    stride_D.push_back(cutlass::make_cute_packed_stride(StrideD{}, make_shape(M, N, 1)));
+
+    host_A.emplace_back(size_t(M) * K);
+    host_B.emplace_back(size_t(N) * K);
+    host_C.emplace_back(size_t(M) * N);
+    fill_small_integers(host_A[g], 10 + g, 1);
+    fill_small_integers(host_B[g], 20 + g, 1);
+    fill_small_integers(host_C[g], 30 + g, 3);
+
+    dst_rows.emplace_back(M);
+    weights.emplace_back(M);
+    for (int m = 0; m < M; ++m) {
+      dst_rows[g][m] = scatter_dst_row(m, g, num_rows);
+      weights[g][m] = scatter_weight(m, g);
+    }
+
+    block_A[g].reset(host_A[g].size());
+    block_B[g].reset(host_B[g].size());
+    block_C[g].reset(host_C[g].size());
+    block_D[g].reset(host_C[g].size());
+    block_dst_rows[g].reset(M);
+    block_weights[g].reset(M);
+    block_A[g].copy_from_host(host_A[g].data());
+    block_B[g].copy_from_host(host_B[g].data());
+    block_C[g].copy_from_host(host_C[g].data());
+    block_dst_rows[g].copy_from_host(dst_rows[g].data());
+    block_weights[g].copy_from_host(weights[g].data());
+  }
+
+  std::vector<ElementA const*> ptr_A;
+  std::vector<ElementB const*> ptr_B;
+  std::vector<ElementOutput const*> ptr_C;
+  std::vector<ElementOutput*> ptr_D;
+  std::vector<int32_t const*> ptr_dst_rows;
+  std::vector<float const*> ptr_weights;
+  for (int g = 0; g < groups; ++g) {
+    ptr_A.push_back(block_A[g].get());
+    ptr_B.push_back(block_B[g].get());
+    ptr_C.push_back(block_C[g].get());
+    ptr_D.push_back(block_D[g].get());
+    ptr_dst_rows.push_back(block_dst_rows[g].get());
+    ptr_weights.push_back(block_weights[g].get());
+  }
+
+  cutlass::DeviceAllocation<UnderlyingProblemShape> device_problem_sizes(groups);
+  cutlass::DeviceAllocation<StrideA> device_stride_A(groups);
+  cutlass::DeviceAllocation<StrideB> device_stride_B(groups);
+  cutlass::DeviceAllocation<StrideC> device_stride_C(groups);
+  cutlass::DeviceAllocation<StrideD> device_stride_D(groups);
+  cutlass::DeviceAllocation<ElementA const*> device_ptr_A(groups);
+  cutlass::DeviceAllocation<ElementB const*> device_ptr_B(groups);
+  cutlass::DeviceAllocation<ElementOutput const*> device_ptr_C(groups);
+  cutlass::DeviceAllocation<ElementOutput*> device_ptr_D(groups);
+  cutlass::DeviceAllocation<int32_t const*> device_ptr_dst_rows(groups);
+  cutlass::DeviceAllocation<float const*> device_ptr_weights(groups);
+  device_problem_sizes.copy_from_host(problem_sizes.data());
+  device_stride_A.copy_from_host(stride_A.data());
+  device_stride_B.copy_from_host(stride_B.data());
+  device_stride_C.copy_from_host(stride_C.data());
+  device_stride_D.copy_from_host(stride_D.data());
+  device_ptr_A.copy_from_host(ptr_A.data());
+  device_ptr_B.copy_from_host(ptr_B.data());
+  device_ptr_C.copy_from_host(ptr_C.data());
+  device_ptr_D.copy_from_host(ptr_D.data());
+  device_ptr_dst_rows.copy_from_host(ptr_dst_rows.data());
+  device_ptr_weights.copy_from_host(ptr_weights.data());
+
+  std::vector<ElementOutput> residual(size_t(num_rows) * stride_out);
+  fill_small_integers(residual, 4, 3);
+  std::vector<float> expected(residual.begin(), residual.end());
+  cutlass::DeviceAllocation<ElementOutput> block_out(residual.size());
+  block_out.copy_from_host(residual.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {groups, device_problem_sizes.get(), problem_sizes.data()},
+    {device_ptr_A.get(), device_stride_A.get(), device_ptr_B.get(), device_stride_B.get()},
+    {{}, device_ptr_C.get(), device_stride_C.get(), device_ptr_D.get(), device_stride_D.get()},
+    hw_info
+  };
+  auto& fusion_args = arguments.epilogue.thread;
+  fusion_args.alpha = 1.f;
+  fusion_args.beta = 1.f;
+  fusion_args.scatter.ptr_out = block_out.get();
+  fusion_args.scatter.stride_out = stride_out;
+  fusion_args.scatter.ptr_dst_rows_array = device_ptr_dst_rows.get();
+  fusion_args.scatter.ptr_weights_array = device_ptr_weights.get();
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "Problem is not supported.\n";
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "GEMM failed to run.\n";
+    return false;
+  }
+
+  std::vector<ElementOutput> out(residual.size());
+  block_out.copy_to_host(out.data());
+
+  for (int g = 0; g < groups; ++g) {
+    int M = group_M[g];
+    int K = group_K[g];
+    auto tA = make_tensor(host_A[g].data(), make_shape(M, K), take<0,2>(stride_A[g]));
+    auto tB = make_tensor(host_B[g].data(), make_shape(N, K), take<0,2>(stride_B[g]));
+    auto tC = make_tensor(host_C[g].data(), make_shape(M, N), take<0,2>(stride_C[g]));
+    for (int m = 0; m < M; ++m) {
+      int32_t dst_row = dst_rows[g][m];
+      if (dst_row < 0) {
+        continue;
+      }
+      for (int n = 0; n < N; ++n) {
+        float accum = 0.f;
+        for (int k = 0; k < K; ++k) {
+          accum += float(tA(m, k)) * float(tB(n, k));
+        }
+        expected[dst_row * stride_out + n] += weights[g][m] * (accum + float(tC(m, n)));
+      }
+    }
+  }
+
+  return compare_scatter_output(out, expected);
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_RowScatterReduce) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombRowScatterReduce<float, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestRowScatterReduce<Gemm>(300, 200, 64, 2, 160));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_RowScatterReduce) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombRowScatterReduce<cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<FusionOperation>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestRowScatterReduce<Gemm>(300, 200, 64, 2, 160));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_group_gemm_epilogue, 128x128x64_1x1x1_RowScatterReduce) {
+  using Gemm = typename test::gemm::device::Sm90GroupedScatterReduceGemm<float>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestGroupedRowScatterReduce<Gemm>({96, 200, 33}, {64, 128, 64}, 136, 100));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_group_gemm_epilogue, 128x128x64_1x1x1_RowScatterReduce) {
+  using Gemm = typename test::gemm::device::Sm90GroupedScatterReduceGemm<cutlass::half_t>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestGroupedRowScatterReduce<Gemm>({96, 200, 33}, {64, 128, 64}, 136, 100));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
@@ -0,0 +1,145 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with the cross-CTA top-K column reduction epilogue
+    D = alpha * acc + beta * C, topk_values, topk_indices = top_k(D) over all of N
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Merges the partial top-K of every N tile of a row and compares the values and indices with a
+/// host top-K of each row of D. The small-integer operands produce many ties, which must go to the
+/// smaller column index however the CTAs of a row arrive.
+template <class Gemm, int TopK>
+bool TestTopKColReduction(int M, int N, int K, int L) {
+  using ElementD = typename Gemm::ElementD;
+  using ElementTopK = float;
+
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+  testbed.beta = 1.f;
+
+  cutlass::DeviceAllocation<ElementTopK> block_topk_values(size_t(M) * TopK * L);
+  cutlass::DeviceAllocation<int32_t> block_topk_indices(size_t(M) * TopK * L);
+
+  auto arguments = testbed.arguments();
+  arguments.epilogue.thread.topk_values_ptr = block_topk_values.get();
+  arguments.epilogue.thread.topk_indices_ptr = block_topk_indices.get();
+  arguments.epilogue.thread.dTopK = {Int<TopK>{}, _1{}, int64_t(M) * TopK};
+
+  if (not testbed.run(arguments)) {
+    return false;
+  }
+
+  std::vector<ElementTopK> topk_values(size_t(M) * TopK * L);
+  std::vector<int32_t> topk_indices(size_t(M) * TopK * L);
+  block_topk_values.copy_to_host(topk_values.data());
+  block_topk_indices.copy_to_host(topk_indices.data());
+
+  std::vector<float> row(N);
+  std::vector<int32_t> order(N);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        row[n] = testbed.reference(m, n, l);
+        if (float(testbed.D(m, n, l)) != float(ElementD(row[n]))) {
+          std::cerr << "D mismatch at (m, n, l) = (" << m << ", " << n << ", " << l << ")\n";
+          return false;
+        }
+      }
+
+      // Descending values, ties to the smaller column
+      std::iota(order.begin(), order.end(), 0);
+      std::partial_sort(order.begin(), order.begin() + std::min(TopK, N), order.end(),
+        [&](int32_t a, int32_t b) { return row[a] > row[b] || (row[a] == row[b] && a < b); });
+
+      for (int i = 0; i < TopK; ++i) {
+        size_t offset = (size_t(l) * M + m) * TopK + i;
+        bool is_padding = i >= N;
+        float expected_value = is_padding ? -std::numeric_limits<float>::infinity() : row[order[i]];
+        int32_t expected_index = is_padding ? -1 : order[i];
+        if (topk_values[offset] != expected_value || topk_indices[offset] != expected_index) {
+          std::cerr << "Top-" << TopK << " mismatch at (m, i, l) = (" << m << ", " << i << ", " << l << "): ("
+                    << topk_values[offset] << ", " << topk_indices[offset] << ") != ("
+                    << expected_value << ", " << expected_index << ")\n";
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_pingpong_epilogue, 64x64x128_1x1x1_TopK4) {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombTopKColReduction<4, cutlass::half_t, float>;
+  using Gemm = typename test::gemm::device::Sm90FusionGemm<
+      FusionOperation, Shape<_64,_64,_128>, Shape<_1,_1,_1>,
+      cutlass::gemm::KernelTmaWarpSpecializedPingpong, cutlass::epilogue::TmaWarpSpecialized,
+      Shape<_64,_64>>::Gemm;
+
+  // 16 N tiles, the last one partial
+  EXPECT_TRUE((test::gemm::device::TestTopKColReduction<Gemm, 4>(200, 1000, 128, 2)));
+  // Single partial N tile
+  EXPECT_TRUE((test::gemm::device::TestTopKColReduction<Gemm, 4>(77, 40, 128, 1)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
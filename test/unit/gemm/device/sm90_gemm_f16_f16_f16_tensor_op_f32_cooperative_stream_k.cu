@@ -33,6 +33,7 @@
 */
 
 #include <iostream>
+#include <vector>
 
 #include "cutlass/cutlass.h"
 #include "cute/tensor.hpp"
@@ -48,6 +49,8 @@
 #include "cutlass/epilogue/collective/sm70_epilogue_vectorized.hpp"
 #include "cutlass/epilogue/collective/default_epilogue.hpp"
 #include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
 
 #include "../../common/cutlass_unit_test.h"
 
@@ -1011,4 +1014,210 @@ TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_stream_k_epi
   EXPECT_TRUE(test::gemm::device::TestAllBiasElementwise<Gemm>(1.0, 1.0));
 }
 
+namespace {
+
+// Runs the GEMM on the first M rows of A with the given SM count in deterministic mode
+template <class Gemm>
+bool run_deterministic(
+    typename Gemm::GemmKernel::ElementA const* ptr_A,
+    typename Gemm::GemmKernel::ElementB const* ptr_B,
+    int M, int N, int K, int sm_count,
+    std::vector<typename Gemm::GemmKernel::ElementD>& host_D) {
+  using GemmKernel = typename Gemm::GemmKernel;
+
+  auto dA = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, cute::make_shape(M, K, 1));
+  auto dB = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, cute::make_shape(N, K, 1));
+  auto dD = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, cute::make_shape(M, N, 1));
+  cutlass::DeviceAllocation<typename GemmKernel::ElementD> D(size_t(M) * N);
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = sm_count;
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, 1},
+    {ptr_A, dA, ptr_B, dB},
+    {{}, D.get(), dD, D.get(), dD},
+    hw_info
+  };
+  arguments.epilogue.thread.alpha = 1.0f;
+  arguments.epilogue.thread.beta = 0.0f;
+  arguments = Gemm::make_deterministic_arguments(arguments);
+
+  Gemm gemm;
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess ||
+      gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    return false;
+  }
+
+  host_D.resize(size_t(M) * N);
+  D.copy_to_host(host_D.data());
+  return true;
+}
+
+} // namespace
+
+// The rows shared by a small and a large batch must be bitwise identical, whatever the SM count
+TEST(SM90_Device_Gemm_f16t_f16t_f32n_tensor_op_gmma_f32_cooperative_stream_k_deterministic, 128x128x64_1x1x1) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      cutlass::epilogue::collective::EpilogueScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  // A long K would be split by stream-K for the small batch
+  int const small_M = 128, large_M = 2048, N = 256, K = 8192;
+
+  // Inexact values, so that a different reduction order would show in the result
+  std::vector<cutlass::half_t> host_A(size_t(large_M) * K);
+  std::vector<cutlass::half_t> host_B(size_t(N) * K);
+  for (size_t i = 0; i < host_A.size(); ++i) {
+    host_A[i] = cutlass::half_t(float((i * 2654435761u >> 16) % 2001) / 1000.f - 1.f);
+  }
+  for (size_t i = 0; i < host_B.size(); ++i) {
+    host_B[i] = cutlass::half_t(float((i * 40503u >> 8) % 2001) / 1000.f - 1.f);
+  }
+  cutlass::DeviceAllocation<cutlass::half_t> A(host_A.size());
+  cutlass::DeviceAllocation<cutlass::half_t> B(host_B.size());
+  A.copy_from_host(host_A.data());
+  B.copy_from_host(host_B.data());
+
+  int sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0);
+
+  // Row-major A, so the small batch is a prefix of the large one
+  std::vector<cutlass::half_t> small_D, large_D;
+  ASSERT_TRUE(run_deterministic<Gemm>(A.get(), B.get(), small_M, N, K, sm_count, small_D));
+  ASSERT_TRUE(run_deterministic<Gemm>(A.get(), B.get(), large_M, N, K, 8, large_D));
+
+  for (int n = 0; n < N; ++n) {
+    for (int m = 0; m < small_M; ++m) {
+      ASSERT_EQ(small_D[m + size_t(n) * small_M].raw(), large_D[m + size_t(n) * large_M].raw())
+        << "at (" << m << "," << n << ")";
+    }
+  }
+}
+
+// Launches that skip the lock workspace clear must reuse the locks reset by the previous launch
+TEST(SM90_Device_Gemm_f16t_f16t_f32n_tensor_op_gmma_f32_cooperative_stream_k_reuse_cleared_workspace, 128x128x64_1x1x1) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      cutlass::epilogue::collective::EpilogueScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  using DecompositionMode = typename GemmKernel::TileScheduler::DecompositionMode;
+
+  int const M = 256, N = 256, K = 4096;
+
+  std::vector<cutlass::half_t> host_A(size_t(M) * K);
+  std::vector<cutlass::half_t> host_B(size_t(N) * K);
+  for (size_t i = 0; i < host_A.size(); ++i) {
+    host_A[i] = cutlass::half_t(float((i * 2654435761u >> 16) % 2001) / 1000.f - 1.f);
+  }
+  for (size_t i = 0; i < host_B.size(); ++i) {
+    host_B[i] = cutlass::half_t(float((i * 40503u >> 8) % 2001) / 1000.f - 1.f);
+  }
+  cutlass::DeviceAllocation<cutlass::half_t> A(host_A.size());
+  cutlass::DeviceAllocation<cutlass::half_t> B(host_B.size());
+  cutlass::DeviceAllocation<cutlass::half_t> D(size_t(M) * N);
+  A.copy_from_host(host_A.data());
+  B.copy_from_host(host_B.data());
+
+  auto dA = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, cute::make_shape(M, K, 1));
+  auto dB = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, cute::make_shape(N, K, 1));
+  auto dD = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, cute::make_shape(M, N, 1));
+
+  // Fewer SMs than output tiles, so that stream-K splits the K loop of some tiles
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = 3;
+
+  for (auto decomposition : {DecompositionMode::StreamK, DecompositionMode::SplitK}) {
+    typename Gemm::Arguments arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {M, N, K, 1},
+      {A.get(), dA, B.get(), dB},
+      {{}, D.get(), dD, D.get(), dD},
+      hw_info
+    };
+    arguments.epilogue.thread.alpha = 1.0f;
+    arguments.epilogue.thread.beta = 0.0f;
+    arguments.scheduler.decomposition_mode = decomposition;
+    arguments.scheduler.splits = decomposition == DecompositionMode::SplitK ? 4 : 1;
+
+    Gemm gemm;
+    cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+    std::vector<cutlass::half_t> expected_D(size_t(M) * N), host_D(size_t(M) * N);
+
+    // The first launch clears the workspace, the following ones rely on the locks being reset
+    for (int launch = 0; launch < 4; ++launch) {
+      arguments.scheduler.reuse_cleared_workspace = launch > 0;
+      ASSERT_EQ(gemm.can_implement(arguments), cutlass::Status::kSuccess);
+      ASSERT_EQ(gemm.initialize(arguments, workspace.get()), cutlass::Status::kSuccess);
+      ASSERT_EQ(gemm.run(), cutlass::Status::kSuccess);
+      ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+      D.copy_to_host(launch == 0 ? expected_D.data() : host_D.data());
+      if (launch > 0) {
+        for (size_t i = 0; i < host_D.size(); ++i) {
+          ASSERT_EQ(expected_D[i].raw(), host_D[i].raw()) << "launch " << launch << " at " << i;
+        }
+      }
+    }
+  }
+}
+
 #endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,329 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Grouped GEMM fed from a device-side problem queue (GroupQueueScheduler)
+*/
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Array in mapped host memory, so that the host can fill ring buffer slots while the kernel runs
+template <class T>
+struct MappedArray {
+  T* host = nullptr;
+  T* device = nullptr;
+
+  explicit MappedArray(size_t count) {
+    if (cudaHostAlloc(&host, count * sizeof(T), cudaHostAllocMapped) == cudaSuccess) {
+      cudaHostGetDevicePointer(reinterpret_cast<void**>(&device), host, 0);
+    }
+  }
+
+  ~MappedArray() {
+    if (host) {
+      cudaFreeHost(host);
+    }
+  }
+
+  MappedArray(MappedArray const&) = delete;
+  MappedArray& operator=(MappedArray const&) = delete;
+};
+
+/// Streams problem_count problems through a ring buffer of the given capacity while the kernel is
+/// resident on sm_count CTAs, and compares every output against a host reference. Problem i has
+/// (1 + i % 2) tiles along M, so a capacity below sm_count / 2 forces CTAs to walk past more
+/// problems than the ring holds.
+template <class Gemm>
+bool TestGroupQueue(int capacity, int problem_count, int sm_count) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ProblemShape = typename GemmKernel::ProblemShape;
+  using UnderlyingProblemShape = typename ProblemShape::UnderlyingProblemShape;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using StrideA = typename GemmKernel::InternalStrideA;
+  using StrideB = typename GemmKernel::InternalStrideB;
+  using StrideC = typename GemmKernel::InternalStrideC;
+  using StrideD = typename GemmKernel::InternalStrideD;
+
+  int const tile_m = size<0>(typename GemmKernel::TileShape{});
+  int const tile_n = size<1>(typename GemmKernel::TileShape{});
+  int const N = tile_n;
+  int const K = 128;
+
+  std::vector<int> problem_m(problem_count);
+  std::vector<size_t> offset_A(problem_count + 1, 0);
+  std::vector<size_t> offset_C(problem_count + 1, 0);
+  for (int i = 0; i < problem_count; ++i) {
+    problem_m[i] = tile_m * (1 + i % 2);
+    offset_A[i + 1] = offset_A[i] + size_t(problem_m[i]) * K;
+    offset_C[i + 1] = offset_C[i] + size_t(problem_m[i]) * N;
+  }
+  size_t size_B = size_t(N) * K * problem_count;
+
+  std::vector<ElementA> host_A(offset_A.back());
+  std::vector<ElementB> host_B(size_B);
+  std::vector<ElementC> host_C(offset_C.back());
+  std::vector<ElementD> host_D(offset_C.back(), ElementD(-1));
+  for (size_t i = 0; i < host_A.size(); ++i) {
+    host_A[i] = ElementA(int((i * 7 + 3) % 5) - 2);
+  }
+  for (size_t i = 0; i < host_B.size(); ++i) {
+    host_B[i] = ElementB(int((i * 11 + 1) % 5) - 2);
+  }
+  for (size_t i = 0; i < host_C.size(); ++i) {
+    host_C[i] = ElementC(int((i * 13 + 2) % 7) - 3);
+  }
+
+  cutlass::DeviceAllocation<ElementA> block_A(host_A.size());
+  cutlass::DeviceAllocation<ElementB> block_B(host_B.size());
+  cutlass::DeviceAllocation<ElementC> block_C(host_C.size());
+  cutlass::DeviceAllocation<ElementD> block_D(host_D.size());
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+  block_D.copy_from_host(host_D.data());
+
+  // Ring buffer slots and queue control block
+  MappedArray<UnderlyingProblemShape> problem_shapes(capacity);
+  MappedArray<ElementA const*> ptr_A(capacity);
+  MappedArray<ElementB const*> ptr_B(capacity);
+  MappedArray<ElementC const*> ptr_C(capacity);
+  MappedArray<ElementD*> ptr_D(capacity);
+  MappedArray<StrideA> stride_A(capacity);
+  MappedArray<StrideB> stride_B(capacity);
+  MappedArray<StrideC> stride_C(capacity);
+  MappedArray<StrideD> stride_D(capacity);
+  MappedArray<uint32_t> queue_head(1);
+  MappedArray<uint32_t> queue_tail(1);
+  cutlass::DeviceAllocation<uint32_t> slot_arrivals(capacity);
+  if (queue_head.host == nullptr || queue_tail.host == nullptr || stride_D.host == nullptr) {
+    std::cerr << "Failed to allocate mapped memory.\n";
+    return false;
+  }
+  *queue_head.host = 0;
+  *queue_tail.host = 0;
+  cudaMemset(slot_arrivals.get(), 0, capacity * sizeof(uint32_t));
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = sm_count;
+
+  typename GemmKernel::TileSchedulerArguments scheduler;
+  scheduler.queue.head = queue_head.device;
+  scheduler.queue.tail = queue_tail.device;
+  scheduler.queue.slot_arrivals = slot_arrivals.get();
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {capacity, problem_shapes.device, nullptr},
+    {ptr_A.device, stride_A.device, ptr_B.device, stride_B.device},
+    {{}, ptr_C.device, stride_C.device, ptr_D.device, stride_D.device},
+    hw_info,
+    scheduler
+  };
+  arguments.epilogue.thread.alpha = 1.f;
+  arguments.epilogue.thread.beta = 1.f;
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "Problem is not supported.\n";
+    return false;
+  }
+
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch.\n";
+    return false;
+  }
+
+  // Produce problems while the kernel runs. If the kernel stops retiring problems, close the
+  // queue so that the resident CTAs drain and the test fails instead of hanging.
+  volatile uint32_t* head = queue_head.host;
+  volatile uint32_t* tail = queue_tail.host;
+  bool stalled = false;
+  int published = 0;
+  for (; published < problem_count; ++published) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (uint32_t(published) >= *tail + uint32_t(capacity)) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        stalled = true;
+        break;
+      }
+    }
+    if (stalled) {
+      break;
+    }
+
+    int slot = published % capacity;
+    int M = problem_m[published];
+    problem_shapes.host[slot] = {M, N, K};
+    ptr_A.host[slot] = block_A.get() + offset_A[published];
+    ptr_B.host[slot] = block_B.get() + size_t(N) * K * published;
+    ptr_C.host[slot] = block_C.get() + offset_C[published];
+    ptr_D.host[slot] = block_D.get() + offset_C[published];
+    stride_A.host[slot] = cutlass::make_cute_packed_stride(StrideA{}, {M, K, 1});
+    stride_B.host[slot] = cutlass::make_cute_packed_stride(StrideB{}, {N, K, 1});
+    stride_C.host[slot] = cutlass::make_cute_packed_stride(StrideC{}, {M, N, 1});
+    stride_D.host[slot] = cutlass::make_cute_packed_stride(StrideD{}, {M, N, 1});
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    *head = uint32_t(published + 1);
+  }
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  *head = uint32_t(published) | cutlass::gemm::GroupProblemQueue::kClosed;
+
+  if (cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "GEMM failed to run.\n";
+    return false;
+  }
+  if (stalled) {
+    std::cerr << "Kernel stopped retiring problems after " << *tail << " of " << published << ".\n";
+    return false;
+  }
+  if (*tail != uint32_t(problem_count)) {
+    std::cerr << "Kernel retired " << *tail << " of " << problem_count << " problems.\n";
+    return false;
+  }
+
+  block_D.copy_to_host(host_D.data());
+
+  for (int i = 0; i < problem_count; ++i) {
+    int M = problem_m[i];
+    Tensor tA = make_tensor(host_A.data() + offset_A[i], make_shape(M, K), take<0,2>(cutlass::make_cute_packed_stride(StrideA{}, {M, K, 1})));
+    Tensor tB = make_tensor(host_B.data() + size_t(N) * K * i, make_shape(N, K), take<0,2>(cutlass::make_cute_packed_stride(StrideB{}, {N, K, 1})));
+    Tensor tC = make_tensor(host_C.data() + offset_C[i], make_shape(M, N), take<0,2>(cutlass::make_cute_packed_stride(StrideC{}, {M, N, 1})));
+    Tensor tD = make_tensor(host_D.data() + offset_C[i], make_shape(M, N), take<0,2>(cutlass::make_cute_packed_stride(StrideD{}, {M, N, 1})));
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float accum = 0.f;
+        for (int k = 0; k < K; ++k) {
+          accum += float(tA(m, k)) * float(tB(n, k));
+        }
+        float expected = accum + float(tC(m, n));
+        if (float(tD(m, n)) != expected) {
+          std::cerr << "Mismatch in problem " << i << " at (m, n) = (" << m << ", " << n << "): "
+                    << float(tD(m, n)) << " != " << expected << "\n";
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16n_tensor_op_gmma_f32_group_gemm_queue, 128x128x64_1x1x1) {
+  using ElementA = cutlass::half_t;
+  using LayoutA = cutlass::layout::RowMajor;
+  using ElementB = cutlass::half_t;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using ElementC = cutlass::half_t;
+  using LayoutC = cutlass::layout::ColumnMajor;
+  constexpr int Alignment = 128 / cutlass::sizeof_bits<cutlass::half_t>::value;
+
+  using TileShape = Shape<_128,_128,_64>;
+  using ClusterShape = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementC, LayoutC *, Alignment,
+      ElementC, LayoutC *, Alignment,
+      cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      ElementA, LayoutA *, Alignment,
+      ElementB, LayoutB *, Alignment,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<
+        static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::GroupQueueScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  // Ring capacity below grid size / tiles-per-problem: a single CTA walks past the whole ring
+  EXPECT_TRUE(test::gemm::device::TestGroupQueue<Gemm>(2, 37, 16));
+  EXPECT_TRUE(test::gemm::device::TestGroupQueue<Gemm>(1, 20, 8));
+  // Ring larger than the grid
+  EXPECT_TRUE(test::gemm::device::TestGroupQueue<Gemm>(16, 37, 4));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
@@ -0,0 +1,160 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm90 cooperative GEMM with the k tiles of each output tile split across a cluster
+    and reduced over distributed shared memory
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/epilogue/collective/collective_epilogue.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// D = alpha * A * B + beta * C with the k tiles of every 128x128 output tile split across a 1x1xSplits cluster
+template <int Splits>
+struct Sm90ClusterSplitKGemm {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,Int<Splits>>;
+
+  using CollectiveEpilogue = cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+      cutlass::epilogue::collective::DefaultEpilogue<
+        float,
+        cutlass::detail::TagToStrideC_t<cutlass::layout::ColumnMajor>,
+        cutlass::detail::TagToStrideC_t<cutlass::layout::ColumnMajor>,
+        cutlass::epilogue::thread::LinearCombination<float, 1, float, float>,
+        cutlass::gemm::EpilogueDefault>>;
+
+  // The stages share smem with the exchange buffer of the reduction
+  using ClusterSplitKReduction = cutlass::gemm::kernel::detail::Sm90ClusterSplitKReduction<Splits, 256, float>;
+  static constexpr int Carveout = static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage) +
+                                                   sizeof(typename ClusterSplitKReduction::SharedStorage));
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<Carveout>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::ClusterSplitKScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Runs the GEMM on at most max_clusters clusters, so that each cluster reduces several output tiles
+/// through the same exchange buffer, and compares D exactly against the host reference
+template <class Gemm>
+bool TestClusterSplitK(int M, int N, int K, int L, int max_clusters) {
+  constexpr int Splits = Gemm::GemmKernel::TileScheduler::Splits;
+
+  FusionTestbed<Gemm> testbed(M, N, K, L, 2);
+  testbed.alpha = 2.f;
+  testbed.beta = -1.f;
+
+  auto args = testbed.arguments();
+  args.hw_info.sm_count = max_clusters * Splits;
+  if (!testbed.run(args)) {
+    return false;
+  }
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float expected = testbed.reference(m, n, l);
+        if (testbed.D(m, n, l) != expected) {
+          std::cerr << "Mismatch at (" << m << ", " << n << ", " << l << "): "
+                    << testbed.D(m, n, l) << " != " << expected << "\n";
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32n_tensor_op_gmma_f32_cluster_split_k, 128x128x64_1x1x2) {
+  using Gemm = typename test::gemm::device::Sm90ClusterSplitKGemm<2>::Gemm;
+
+  // 3x2x2 output tiles on 2 clusters, with partial M and N tiles and an odd number of k tiles
+  EXPECT_TRUE(test::gemm::device::TestClusterSplitK<Gemm>(328, 200, 576, 2, 2));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32n_tensor_op_gmma_f32_cluster_split_k, 128x128x64_1x1x2_partial_k) {
+  using Gemm = typename test::gemm::device::Sm90ClusterSplitKGemm<2>::Gemm;
+
+  // Two k tiles, the second one partial
+  EXPECT_TRUE(test::gemm::device::TestClusterSplitK<Gemm>(256, 128, 72, 1, 132));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32n_tensor_op_gmma_f32_cluster_split_k, 128x128x64_1x1x4) {
+  using Gemm = typename test::gemm::device::Sm90ClusterSplitKGemm<4>::Gemm;
+
+  // 10 k tiles split 2 / 3 / 2 / 3 across the cluster
+  EXPECT_TRUE(test::gemm::device::TestClusterSplitK<Gemm>(256, 384, 640, 1, 3));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
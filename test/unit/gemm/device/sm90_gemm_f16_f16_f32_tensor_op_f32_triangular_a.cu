@@ -0,0 +1,351 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm90 triangular-A mainloop: TRMM, and SYMM as the two triangular-A GEMMs
+    issued by the library's Symm3xOperation
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/blas3_types.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/epilogue/collective/collective_epilogue.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// D = alpha * tri(A) * B + beta * C with a square f16 A of which only the FillModeA triangle is read
+template <
+  cutlass::FillMode FillModeA,
+  cutlass::DiagType DiagTypeA,
+  class LayoutA,
+  class ClusterShape_MNK = Shape<_1,_1,_1>
+>
+struct Sm90TriangularAGemm {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+
+  using CollectiveEpilogue = cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+      cutlass::epilogue::collective::DefaultEpilogue<
+        float,
+        cutlass::detail::TagToStrideC_t<cutlass::layout::ColumnMajor>,
+        cutlass::detail::TagToStrideC_t<cutlass::layout::ColumnMajor>,
+        cutlass::epilogue::thread::LinearCombination<float, 1, float, float>,
+        cutlass::gemm::EpilogueDefault>>;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperativeTriangularA<FillModeA, DiagTypeA>
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::TriangularKScheduler<FillModeA>
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Runs D = alpha * tri(A) * B + beta * C on device buffers, with A viewed as M x M through the layout of Gemm
+template <class Gemm>
+bool RunTriangularA(
+    int M, int N, int L,
+    cutlass::half_t const* ptr_A, cutlass::half_t const* ptr_B,
+    float const* ptr_C, float* ptr_D,
+    float alpha, float beta) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    L > 1 ? cutlass::gemm::GemmUniversalMode::kBatched : cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, M, L},
+    {ptr_A, cutlass::make_cute_packed_stride(StrideA{}, make_shape(M, M, L)),
+     ptr_B, cutlass::make_cute_packed_stride(StrideB{}, make_shape(N, M, L))},
+    {{alpha, beta},
+     ptr_C, cutlass::make_cute_packed_stride(StrideC{}, make_shape(M, N, L)),
+     ptr_D, cutlass::make_cute_packed_stride(StrideD{}, make_shape(M, N, L))},
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "Problem is not supported.\n";
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "Triangular-A GEMM failed to run.\n";
+    return false;
+  }
+  return true;
+}
+
+inline bool in_triangle(cutlass::FillMode fill_mode, int m, int k) {
+  return fill_mode == cutlass::FillMode::kLower ? m >= k : m <= k;
+}
+
+/// Compares D against the host product of the effective M x M matrix a(m, k, l) with B, plus beta * C
+template <class TensorB, class TensorC, class TensorD, class EffectiveA>
+bool verify_triangular_product(
+    int M, int N, int L, EffectiveA const& a,
+    TensorB const& tB, TensorC const& tC, TensorD const& tD,
+    float alpha, float beta) {
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float accum = 0.f;
+        for (int k = 0; k < M; ++k) {
+          accum += a(m, k, l) * float(tB(n, k, l));
+        }
+        float expected = alpha * accum + beta * tC(m, n, l);
+        if (tD(m, n, l) != expected) {
+          std::cerr << "Mismatch at (" << m << ", " << n << ", " << l << "): "
+                    << tD(m, n, l) << " != " << expected << "\n";
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/// TRMM: the triangle of A opposite to FillModeA holds values that must not be read, as does the
+/// diagonal for DiagType::kUnit
+template <class Gemm>
+bool TestTrmm(int M, int N, int L) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+
+  constexpr cutlass::FillMode FillModeA = GemmKernel::CollectiveMainloop::kFillModeA;
+  constexpr cutlass::DiagType DiagTypeA = GemmKernel::CollectiveMainloop::kDiagTypeA;
+
+  StrideA stride_A = cutlass::make_cute_packed_stride(StrideA{}, make_shape(M, M, L));
+  StrideB stride_B = cutlass::make_cute_packed_stride(StrideB{}, make_shape(N, M, L));
+  StrideC stride_C = cutlass::make_cute_packed_stride(StrideC{}, make_shape(M, N, L));
+  StrideD stride_D = cutlass::make_cute_packed_stride(StrideD{}, make_shape(M, N, L));
+
+  std::vector<cutlass::half_t> host_A(size_t(M) * M * L);
+  std::vector<cutlass::half_t> host_B(size_t(N) * M * L);
+  std::vector<float> host_C(size_t(M) * N * L);
+  std::vector<float> host_D(host_C.size());
+  fill_small_integers(host_A, 1, 2);
+  fill_small_integers(host_B, 2, 2);
+  fill_small_integers(host_C, 3, 3);
+
+  auto tA = make_tensor(host_A.data(), make_shape(M, M, L), stride_A);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int k = 0; k < M; ++k) {
+        if (!in_triangle(FillModeA, m, k) || (m == k && DiagTypeA == cutlass::DiagType::kUnit)) {
+          tA(m, k, l) = cutlass::half_t(64);
+        }
+      }
+    }
+  }
+
+  cutlass::DeviceAllocation<cutlass::half_t> block_A(host_A.size());
+  cutlass::DeviceAllocation<cutlass::half_t> block_B(host_B.size());
+  cutlass::DeviceAllocation<float> block_C(host_C.size());
+  cutlass::DeviceAllocation<float> block_D(host_D.size());
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+
+  if (!RunTriangularA<Gemm>(M, N, L, block_A.get(), block_B.get(), block_C.get(), block_D.get(), 2.f, -1.f)) {
+    return false;
+  }
+  block_D.copy_to_host(host_D.data());
+
+  auto effective_A = [&](int m, int k, int l) {
+    if (!in_triangle(FillModeA, m, k)) {
+      return 0.f;
+    }
+    if (m == k && DiagTypeA == cutlass::DiagType::kUnit) {
+      return 1.f;
+    }
+    return float(tA(m, k, l));
+  };
+
+  return verify_triangular_product(M, N, L, effective_A,
+      make_tensor(host_B.data(), make_shape(N, M, L), stride_B),
+      make_tensor(host_C.data(), make_shape(M, N, L), stride_C),
+      make_tensor(host_D.data(), make_shape(M, N, L), stride_D),
+      2.f, -1.f);
+}
+
+/// SYMM as issued by Symm3xOperation: the stored FillModeA triangle of A with its diagonal, then the
+/// same memory read as A^T with the opposite fill mode and no diagonal, accumulating onto D
+template <cutlass::FillMode FillModeA, class LayoutA>
+bool TestSymm(int M, int N, int L) {
+  constexpr cutlass::FillMode MirroredFillModeA =
+      FillModeA == cutlass::FillMode::kLower ? cutlass::FillMode::kUpper : cutlass::FillMode::kLower;
+  using Gemm = typename Sm90TriangularAGemm<FillModeA, cutlass::DiagType::kNonUnit, LayoutA>::Gemm;
+  using GemmMirrored = typename Sm90TriangularAGemm<MirroredFillModeA, cutlass::DiagType::kZero,
+      typename cutlass::layout::LayoutTranspose<LayoutA>::type>::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+
+  StrideA stride_A = cutlass::make_cute_packed_stride(StrideA{}, make_shape(M, M, L));
+  StrideB stride_B = cutlass::make_cute_packed_stride(StrideB{}, make_shape(N, M, L));
+  StrideC stride_C = cutlass::make_cute_packed_stride(StrideC{}, make_shape(M, N, L));
+  StrideD stride_D = cutlass::make_cute_packed_stride(StrideD{}, make_shape(M, N, L));
+
+  std::vector<cutlass::half_t> host_A(size_t(M) * M * L);
+  std::vector<cutlass::half_t> host_B(size_t(N) * M * L);
+  std::vector<float> host_C(size_t(M) * N * L);
+  std::vector<float> host_D(host_C.size());
+  fill_small_integers(host_A, 4, 2);
+  fill_small_integers(host_B, 5, 2);
+  fill_small_integers(host_C, 6, 3);
+
+  // Only the stored triangle is meaningful
+  auto tA = make_tensor(host_A.data(), make_shape(M, M, L), stride_A);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int k = 0; k < M; ++k) {
+        if (!in_triangle(FillModeA, m, k)) {
+          tA(m, k, l) = cutlass::half_t(64);
+        }
+      }
+    }
+  }
+
+  cutlass::DeviceAllocation<cutlass::half_t> block_A(host_A.size());
+  cutlass::DeviceAllocation<cutlass::half_t> block_B(host_B.size());
+  cutlass::DeviceAllocation<float> block_C(host_C.size());
+  cutlass::DeviceAllocation<float> block_D(host_D.size());
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+
+  if (!RunTriangularA<Gemm>(M, N, L, block_A.get(), block_B.get(), block_C.get(), block_D.get(), 2.f, -1.f) ||
+      !RunTriangularA<GemmMirrored>(M, N, L, block_A.get(), block_B.get(), block_D.get(), block_D.get(), 2.f, 1.f)) {
+    return false;
+  }
+  block_D.copy_to_host(host_D.data());
+
+  auto symmetric_A = [&](int m, int k, int l) {
+    return in_triangle(FillModeA, m, k) ? float(tA(m, k, l)) : float(tA(k, m, l));
+  };
+
+  return verify_triangular_product(M, N, L, symmetric_A,
+      make_tensor(host_B.data(), make_shape(N, M, L), stride_B),
+      make_tensor(host_C.data(), make_shape(M, N, L), stride_C),
+      make_tensor(host_D.data(), make_shape(M, N, L), stride_D),
+      2.f, -1.f);
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Trmm_f16n_f16n_f32n_tensor_op_gmma_f32, 128x128x64_1x1x1_lower_nonunit) {
+  using Gemm = typename test::gemm::device::Sm90TriangularAGemm<
+      cutlass::FillMode::kLower, cutlass::DiagType::kNonUnit, cutlass::layout::ColumnMajor>::Gemm;
+
+  // Partial M tiles and k-tiles, and k-tiles crossing the diagonal at every offset
+  EXPECT_TRUE(test::gemm::device::TestTrmm<Gemm>(328, 136, 2));
+}
+
+TEST(SM90_Device_Trmm_f16n_f16n_f32n_tensor_op_gmma_f32, 128x128x64_1x1x1_upper_nonunit) {
+  using Gemm = typename test::gemm::device::Sm90TriangularAGemm<
+      cutlass::FillMode::kUpper, cutlass::DiagType::kNonUnit, cutlass::layout::ColumnMajor>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestTrmm<Gemm>(328, 136, 2));
+}
+
+TEST(SM90_Device_Trmm_f16t_f16n_f32n_tensor_op_gmma_f32, 128x128x64_1x1x1_lower_unit) {
+  using Gemm = typename test::gemm::device::Sm90TriangularAGemm<
+      cutlass::FillMode::kLower, cutlass::DiagType::kUnit, cutlass::layout::RowMajor>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestTrmm<Gemm>(200, 64, 1));
+}
+
+TEST(SM90_Device_Trmm_f16t_f16n_f32n_tensor_op_gmma_f32, 128x128x64_1x2x1_upper_unit) {
+  using Gemm = typename test::gemm::device::Sm90TriangularAGemm<
+      cutlass::FillMode::kUpper, cutlass::DiagType::kUnit, cutlass::layout::RowMajor, Shape<_1,_2,_1>>::Gemm;
+
+  // A multicast across the cluster along N
+  EXPECT_TRUE(test::gemm::device::TestTrmm<Gemm>(256, 512, 1));
+}
+
+TEST(SM90_Device_Symm_f16n_f16n_f32n_tensor_op_gmma_f32, 128x128x64_1x1x1_ls_lower) {
+  EXPECT_TRUE((test::gemm::device::TestSymm<cutlass::FillMode::kLower, cutlass::layout::ColumnMajor>(328, 136, 2)));
+}
+
+TEST(SM90_Device_Symm_f16n_f16n_f32n_tensor_op_gmma_f32, 128x128x64_1x1x1_ls_upper) {
+  EXPECT_TRUE((test::gemm::device::TestSymm<cutlass::FillMode::kUpper, cutlass::layout::ColumnMajor>(200, 64, 1)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
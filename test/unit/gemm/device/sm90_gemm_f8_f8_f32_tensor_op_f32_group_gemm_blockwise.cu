@@ -0,0 +1,318 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the FP8 blockwise-scaled Grouped GEMM (KernelPtrArrayTmaWarpSpecializedCooperativeFP8BlockScaledAccum)
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// e4m3 x e4m3 grouped GEMM with f32 C and D, scaled per (ScaleGranularityM x BLK_K) block of A
+/// and per (BLK_N x BLK_K) block of B
+template <int ScaleGranularityM, class TileShape_MNK = Shape<_128,_128,_128>>
+struct Sm90GroupedBlockwiseGemm {
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+  using KernelSchedule = cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperativeFP8BlockScaledAccum<ScaleGranularityM>;
+  using EpilogueSchedule = cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, cutlass::layout::RowMajor *, 4,
+      float, cutlass::layout::RowMajor *, 4,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::float_e4m3_t, cutlass::layout::RowMajor *, 16,
+      cutlass::float_e4m3_t, cutlass::layout::ColumnMajor *, 16,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Groups of different M, N and K, each with its own A and B scale factors. Operands are small
+/// integers and scales are powers of two, so every scaled K-block partial sum is exact and D is
+/// compared bitwise with the host reference
+///
+///   D(m,n) = alpha * sum_kb scale_A(m / ScaleGranularityM, kb) * scale_B(n / BLK_N, kb) * sum_{k in kb} A(m,k) * B(n,k)
+///          + beta * C(m,n)
+template <class Gemm>
+bool TestGroupedBlockwiseGemm(std::vector<cute::tuple<int,int,int>> const& problems, float alpha, float beta) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using CollectiveMainloop = typename GemmKernel::CollectiveMainloop;
+  using ProblemShape = typename GemmKernel::ProblemShape;
+  using UnderlyingProblemShape = typename ProblemShape::UnderlyingProblemShape;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using ElementBlockScale = typename CollectiveMainloop::ElementBlockScale;
+  using StrideA = typename GemmKernel::InternalStrideA;
+  using StrideB = typename GemmKernel::InternalStrideB;
+  using StrideC = typename GemmKernel::InternalStrideC;
+  using StrideD = typename GemmKernel::InternalStrideD;
+
+  constexpr int ScaleGranularityM = CollectiveMainloop::ScaleGranularityM;
+  constexpr int BlockN = size<1>(typename GemmKernel::TileShape{});
+  constexpr int BlockK = size<2>(typename GemmKernel::TileShape{});
+  float const scale_values[4] = {0.25f, 0.5f, 1.f, 2.f};
+
+  int const groups = static_cast<int>(problems.size());
+
+  std::vector<UnderlyingProblemShape> problem_sizes;
+  std::vector<StrideA> stride_A;
+  std::vector<StrideB> stride_B;
+  std::vector<StrideC> stride_C;
+  std::vector<StrideD> stride_D;
+  std::vector<std::vector<ElementA>> host_A(groups);
+  std::vector<std::vector<ElementB>> host_B(groups);
+  std::vector<std::vector<ElementC>> host_C(groups);
+  std::vector<std::vector<ElementD>> host_D(groups);
+  std::vector<std::vector<ElementBlockScale>> host_scale_A(groups);
+  std::vector<std::vector<ElementBlockScale>> host_scale_B(groups);
+  std::vector<cutlass::DeviceAllocation<ElementA>> block_A(groups);
+  std::vector<cutlass::DeviceAllocation<ElementB>> block_B(groups);
+  std::vector<cutlass::DeviceAllocation<ElementC>> block_C(groups);
+  std::vector<cutlass::DeviceAllocation<ElementD>> block_D(groups);
+  std::vector<cutlass::DeviceAllocation<ElementBlockScale>> block_scale_A(groups);
+  std::vector<cutlass::DeviceAllocation<ElementBlockScale>> block_scale_B(groups);
+
+  for (int g = 0; g < groups; ++g) {
+    auto [M, N, K] = problems[g];
+    int scale_m = (M + ScaleGranularityM - 1) / ScaleGranularityM;
+    int scale_n = (N + BlockN - 1) / BlockN;
+    int scale_k = (K + BlockK - 1) / BlockK;
+
+    problem_sizes.push_back({M, N, K});
+    stride_A.push_back(cutlass::make_cute_packed_stride(StrideA{}, make_shape(M, K, 1)));
+    stride_B.push_back(cutlass::make_cute_packed_stride(StrideB{}, make_shape(N, K, 1)));
+    stride_C.push_back(cutlass::make_cute_packed_stride(StrideC{}, make_shape(M, N, 1)));
+    stride_D.push_back(cutlass::make_cute_packed_stride(StrideD{}, make_shape(M, N, 1)));
+
+    host_A[g].resize(size_t(M) * K);
+    host_B[g].resize(size_t(N) * K);
+    host_C[g].resize(size_t(M) * N);
+    host_D[g].resize(size_t(M) * N);
+    fill_small_integers(host_A[g], 10 + g, 2);
+    fill_small_integers(host_B[g], 20 + g, 2);
+    fill_small_integers(host_C[g], 30 + g, 3);
+
+    // scale_A is M-major, scale_B is K-major
+    host_scale_A[g].resize(size_t(scale_m) * scale_k);
+    host_scale_B[g].resize(size_t(scale_n) * scale_k);
+    for (size_t i = 0; i < host_scale_A[g].size(); ++i) {
+      host_scale_A[g][i] = scale_values[(i * 3 + g) % 4];
+    }
+    for (size_t i = 0; i < host_scale_B[g].size(); ++i) {
+      host_scale_B[g][i] = scale_values[(i * 5 + g + 1) % 4];
+    }
+
+    block_A[g].reset(host_A[g].size());
+    block_B[g].reset(host_B[g].size());
+    block_C[g].reset(host_C[g].size());
+    block_D[g].reset(host_D[g].size());
+    block_scale_A[g].reset(host_scale_A[g].size());
+    block_scale_B[g].reset(host_scale_B[g].size());
+    block_A[g].copy_from_host(host_A[g].data());
+    block_B[g].copy_from_host(host_B[g].data());
+    block_C[g].copy_from_host(host_C[g].data());
+    block_scale_A[g].copy_from_host(host_scale_A[g].data());
+    block_scale_B[g].copy_from_host(host_scale_B[g].data());
+  }
+
+  std::vector<ElementA const*> ptr_A;
+  std::vector<ElementB const*> ptr_B;
+  std::vector<ElementC const*> ptr_C;
+  std::vector<ElementD*> ptr_D;
+  std::vector<ElementBlockScale const*> ptr_scale_A;
+  std::vector<ElementBlockScale const*> ptr_scale_B;
+  for (int g = 0; g < groups; ++g) {
+    ptr_A.push_back(block_A[g].get());
+    ptr_B.push_back(block_B[g].get());
+    ptr_C.push_back(block_C[g].get());
+    ptr_D.push_back(block_D[g].get());
+    ptr_scale_A.push_back(block_scale_A[g].get());
+    ptr_scale_B.push_back(block_scale_B[g].get());
+  }
+
+  cutlass::DeviceAllocation<UnderlyingProblemShape> device_problem_sizes(groups);
+  cutlass::DeviceAllocation<StrideA> device_stride_A(groups);
+  cutlass::DeviceAllocation<StrideB> device_stride_B(groups);
+  cutlass::DeviceAllocation<StrideC> device_stride_C(groups);
+  cutlass::DeviceAllocation<StrideD> device_stride_D(groups);
+  cutlass::DeviceAllocation<ElementA const*> device_ptr_A(groups);
+  cutlass::DeviceAllocation<ElementB const*> device_ptr_B(groups);
+  cutlass::DeviceAllocation<ElementC const*> device_ptr_C(groups);
+  cutlass::DeviceAllocation<ElementD*> device_ptr_D(groups);
+  cutlass::DeviceAllocation<ElementBlockScale const*> device_ptr_scale_A(groups);
+  cutlass::DeviceAllocation<ElementBlockScale const*> device_ptr_scale_B(groups);
+  device_problem_sizes.copy_from_host(problem_sizes.data());
+  device_stride_A.copy_from_host(stride_A.data());
+  device_stride_B.copy_from_host(stride_B.data());
+  device_stride_C.copy_from_host(stride_C.data());
+  device_stride_D.copy_from_host(stride_D.data());
+  device_ptr_A.copy_from_host(ptr_A.data());
+  device_ptr_B.copy_from_host(ptr_B.data());
+  device_ptr_C.copy_from_host(ptr_C.data());
+  device_ptr_D.copy_from_host(ptr_D.data());
+  device_ptr_scale_A.copy_from_host(ptr_scale_A.data());
+  device_ptr_scale_B.copy_from_host(ptr_scale_B.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {groups, device_problem_sizes.get(), problem_sizes.data()},
+    {device_ptr_A.get(), device_stride_A.get(), device_ptr_B.get(), device_stride_B.get(), 4,
+     device_ptr_scale_A.get(), device_ptr_scale_B.get()},
+    {{}, device_ptr_C.get(), device_stride_C.get(), device_ptr_D.get(), device_stride_D.get()},
+    hw_info
+  };
+  arguments.epilogue.thread.alpha = alpha;
+  arguments.epilogue.thread.beta = beta;
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "Problem is not supported.\n";
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "GEMM failed to run.\n";
+    return false;
+  }
+
+  for (int g = 0; g < groups; ++g) {
+    auto [M, N, K] = problems[g];
+    int scale_m = (M + ScaleGranularityM - 1) / ScaleGranularityM;
+    int scale_k = (K + BlockK - 1) / BlockK;
+    block_D[g].copy_to_host(host_D[g].data());
+
+    auto tA = make_tensor(host_A[g].data(), make_shape(M, K), take<0,2>(stride_A[g]));
+    auto tB = make_tensor(host_B[g].data(), make_shape(N, K), take<0,2>(stride_B[g]));
+    auto tC = make_tensor(host_C[g].data(), make_shape(M, N), take<0,2>(stride_C[g]));
+    auto tD = make_tensor(host_D[g].data(), make_shape(M, N), take<0,2>(stride_D[g]));
+
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float accum = 0.f;
+        for (int kb = 0; kb < scale_k; ++kb) {
+          float block_accum = 0.f;
+          for (int k = kb * BlockK; k < std::min(K, (kb + 1) * BlockK); ++k) {
+            block_accum += float(tA(m, k)) * float(tB(n, k));
+          }
+          accum += host_scale_A[g][kb * scale_m + m / ScaleGranularityM] *
+                   host_scale_B[g][(n / BlockN) * scale_k + kb] * block_accum;
+        }
+        float expected = alpha * accum + beta * float(tC(m, n));
+        if (float(tD(m, n)) != expected) {
+          std::cerr << "Group " << g << ": D mismatch at (m, n) = (" << m << ", " << n << "): "
+                    << float(tD(m, n)) << " != " << expected << "\n";
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+// One A scale per 128x128 block
+TEST(SM90_Device_Gemm_e4m3t_e4m3n_f32t_tensor_op_gmma_f32_group_gemm_blockwise, 128x128x128_1x1x1_ScaleGranularityM0) {
+  using Gemm = typename test::gemm::device::Sm90GroupedBlockwiseGemm<0>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestGroupedBlockwiseGemm<Gemm>({{128, 128, 256}, {200, 256, 384}, {72, 136, 128}}, 1.f, 0.f));
+  EXPECT_TRUE(test::gemm::device::TestGroupedBlockwiseGemm<Gemm>({{256, 384, 512}, {33, 128, 272}}, 2.f, 1.f));
+}
+
+// One A scale per 1x128 row block
+TEST(SM90_Device_Gemm_e4m3t_e4m3n_f32t_tensor_op_gmma_f32_group_gemm_blockwise, 128x128x128_1x1x1_ScaleGranularityM1) {
+  using Gemm = typename test::gemm::device::Sm90GroupedBlockwiseGemm<1>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestGroupedBlockwiseGemm<Gemm>({{128, 128, 256}, {200, 256, 384}, {72, 136, 128}}, 1.f, 0.f));
+  EXPECT_TRUE(test::gemm::device::TestGroupedBlockwiseGemm<Gemm>({{256, 384, 512}, {33, 128, 272}}, 2.f, 1.f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
@@ -333,6 +333,35 @@ TEST(SM90_Device_Gemm_stream_k_scheduler, 128x128x64_2x1x1) {
   EXPECT_TRUE(test_scheduler({128, 512, 2048, 1}, tile_shape, cluster_shape, 114));
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_stream_k_scheduler, decomposition_plan) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+  using Scheduler = cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90StreamK<TileShape_MNK, ClusterShape_MNK>;
+  using DecompositionMode = typename Scheduler::DecompositionMode;
+
+  cutlass::KernelHardwareInfo hw_info{0, 132};
+
+  // A single full wave has no tail to balance
+  auto plan = Scheduler::get_decomposition_plan(ProblemShape_MNKL{128 * 12, 128 * 11, 4096, 1}, hw_info, {});
+  EXPECT_TRUE(plan.mode == DecompositionMode::DataParallel);
+  EXPECT_EQ(plan.splits, 1);
+  EXPECT_EQ(plan.fixup_bytes, size_t(0));
+
+  // One tile past a full wave doubles the data-parallel makespan
+  plan = Scheduler::get_decomposition_plan(ProblemShape_MNKL{128 * 133, 128, 4096, 1}, hw_info, {});
+  EXPECT_TRUE(plan.mode == DecompositionMode::StreamK);
+  EXPECT_LT(plan.stream_k_cost, plan.data_parallel_cost);
+  EXPECT_GT(plan.fixup_bytes, size_t(0));
+
+  // An explicit split count is kept
+  typename Scheduler::Arguments args{4};
+  plan = Scheduler::get_decomposition_plan(ProblemShape_MNKL{128 * 133, 128, 4096, 1}, hw_info, args);
+  EXPECT_TRUE(plan.mode == DecompositionMode::SplitK);
+  EXPECT_EQ(plan.splits, 4);
+}
+
 #endif // defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,321 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm90 rank-k (SYRK) and rank-2k (SYR2K) updates built on the triangular tile
+    scheduler, including that the elements outside the fill mode of C are never written
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/blas3_types.h"
+#include "cutlass/epilogue/collective/collective_epilogue.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Rank-k (Rank 1) or rank-2k (Rank 2) update of a column-major float C from row-major tf32 operands.
+/// A and B are both N x K row-major, the mainloop reads B as the (N,K) operand, i.e. A^T.
+template <
+  cutlass::FillMode FillModeC,
+  class KernelSchedule,
+  class TileShape_MNK,
+  int Rank = 1
+>
+struct Sm90RankKGemm {
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+      cutlass::epilogue::collective::DefaultEpilogueTriangular<
+        FillModeC,
+        float,
+        cutlass::detail::TagToStrideC_t<cutlass::layout::ColumnMajor>,
+        cutlass::detail::TagToStrideC_t<cutlass::layout::ColumnMajor>,
+        cutlass::epilogue::thread::LinearCombination<float, 1, float, float>,
+        cutlass::gemm::EpilogueDefault>>;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      float, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::ColumnMajor, 4,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::TriangularScheduler<FillModeC, Rank>
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// D = alpha * (A * A^T) + beta * C, or D = alpha * (A * B^T + B * A^T) + beta * C for a rank-2k kernel,
+/// on the FillModeC triangle of every batch. D is filled with a sentinel beforehand, which must
+/// survive outside the triangle: the tiles strictly outside are never scheduled, and the diagonal
+/// tiles are masked by the epilogue.
+template <class Gemm>
+bool TestRankK(int N, int K, int L) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+
+  constexpr cutlass::FillMode FillModeC = GemmKernel::TileScheduler::kFillMode;
+  constexpr int Rank = GemmKernel::TileScheduler::kRank;
+  constexpr float Sentinel = 12345.f;
+
+  StrideA stride_A = cutlass::make_cute_packed_stride(StrideA{}, make_shape(N, K, L));
+  StrideB stride_B = cutlass::make_cute_packed_stride(StrideB{}, make_shape(N, K, L));
+  StrideC stride_C = cutlass::make_cute_packed_stride(StrideC{}, make_shape(N, N, L));
+  StrideD stride_D = cutlass::make_cute_packed_stride(StrideD{}, make_shape(N, N, L));
+
+  std::vector<float> host_A(size_t(N) * K * L);
+  std::vector<float> host_B(size_t(N) * K * L);
+  std::vector<float> host_C(size_t(N) * N * L);
+  std::vector<float> host_D(size_t(N) * N * L, Sentinel);
+  fill_small_integers(host_A, 1, 2);
+  fill_small_integers(host_B, 2, 2);
+  fill_small_integers(host_C, 3, 3);
+
+  cutlass::DeviceAllocation<float> block_A(host_A.size());
+  cutlass::DeviceAllocation<float> block_B(host_B.size());
+  cutlass::DeviceAllocation<float> block_C(host_C.size());
+  cutlass::DeviceAllocation<float> block_D(host_D.size());
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+  block_D.copy_from_host(host_D.data());
+
+  // A rank-k update reads A for both operands
+  float const* ptr_B = Rank == 2 ? block_B.get() : block_A.get();
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    L > 1 ? cutlass::gemm::GemmUniversalMode::kBatched : cutlass::gemm::GemmUniversalMode::kGemm,
+    {N, N, K, L},
+    {block_A.get(), stride_A, ptr_B, stride_B},
+    {{2.f, -1.f}, block_C.get(), stride_C, block_D.get(), stride_D},
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "Problem is not supported.\n";
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "Rank-k update failed to run.\n";
+    return false;
+  }
+  block_D.copy_to_host(host_D.data());
+
+  auto tA = make_tensor(host_A.data(), make_shape(N, K, L), stride_A);
+  auto tB = make_tensor(host_B.data(), make_shape(N, K, L), stride_B);
+  auto tC = make_tensor(host_C.data(), make_shape(N, N, L), stride_C);
+  auto tD = make_tensor(host_D.data(), make_shape(N, N, L), stride_D);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < N; ++m) {
+      for (int n = 0; n < N; ++n) {
+        bool inside = FillModeC == cutlass::FillMode::kLower ? m >= n : m <= n;
+        float expected = Sentinel;
+        if (inside) {
+          float accum = 0.f;
+          for (int k = 0; k < K; ++k) {
+            accum += Rank == 2 ? tA(m, k, l) * tB(n, k, l) + tB(m, k, l) * tA(n, k, l)
+                               : tA(m, k, l) * tA(n, k, l);
+          }
+          expected = 2.f * accum - tC(m, n, l);
+        }
+        if (tD(m, n, l) != expected) {
+          std::cerr << "Mismatch at (" << m << ", " << n << ", " << l << "): "
+                    << tD(m, n, l) << " != " << expected << "\n";
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+/// Records every output tile the scheduler hands out, across all persistent CTAs
+template <class Scheduler>
+__global__ void
+visit_triangular_tiles(int* visits, typename Scheduler::Params params, int tiles) {
+  Scheduler scheduler{params};
+  auto work_tile_info = scheduler.initial_work_tile_info(Shape<_1,_1,_1>{});
+  while (work_tile_info.is_valid()) {
+    if (threadIdx.x == 0) {
+      int tile = (work_tile_info.L_idx * tiles + work_tile_info.N_idx) * tiles + work_tile_info.M_idx;
+      atomicAdd(visits + tile, 1);
+    }
+    scheduler.advance_to_next_work();
+    work_tile_info = scheduler.get_current_work();
+  }
+}
+
+/// Every tile on or inside the FillModeC triangle is visited exactly once, those outside never,
+/// for a grid smaller than the number of tiles so that CTAs loop over several of them
+template <cutlass::FillMode FillModeC>
+bool TestTriangularScheduler(int N, int L, int sm_count) {
+  using Scheduler = cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90Triangular<FillModeC>;
+  using TileShape = Shape<_64,_64,_32>;
+  using ClusterShape = Shape<_1,_1,_1>;
+
+  auto problem_shape_mnkl = make_shape(N, N, 32, L);
+  int tiles = (N + 63) / 64;
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = sm_count;
+
+  typename Scheduler::Params params = Scheduler::to_underlying_arguments(
+      problem_shape_mnkl, TileShape{}, ClusterShape{}, hw_info, {});
+  dim3 grid = Scheduler::get_grid_shape(params, problem_shape_mnkl, TileShape{}, ClusterShape{}, hw_info);
+
+  std::vector<int> host_visits(size_t(tiles) * tiles * L, 0);
+  cutlass::DeviceAllocation<int> visits(host_visits.size());
+  visits.copy_from_host(host_visits.data());
+
+  visit_triangular_tiles<Scheduler><<<grid, 32>>>(visits.get(), params, tiles);
+  if (cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "Scheduler kernel failed to run.\n";
+    return false;
+  }
+  visits.copy_to_host(host_visits.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int n = 0; n < tiles; ++n) {
+      for (int m = 0; m < tiles; ++m) {
+        bool inside = FillModeC == cutlass::FillMode::kLower ? m >= n : m <= n;
+        int visited = host_visits[(size_t(l) * tiles + n) * tiles + m];
+        if (visited != (inside ? 1 : 0)) {
+          std::cerr << "Tile (" << m << ", " << n << ", " << l << ") visited " << visited << " times.\n";
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_triangular_scheduler, lower) {
+  EXPECT_TRUE(test::gemm::device::TestTriangularScheduler<cutlass::FillMode::kLower>(1000, 3, 7));
+}
+
+TEST(SM90_Device_Gemm_triangular_scheduler, upper) {
+  EXPECT_TRUE(test::gemm::device::TestTriangularScheduler<cutlass::FillMode::kUpper>(1000, 3, 7));
+}
+
+TEST(SM90_Device_Syrk_tf32t_f32n_tensor_op_gmma_f32, 128x128x32_1x1x1_lower_cooperative) {
+  using Gemm = typename test::gemm::device::Sm90RankKGemm<
+      cutlass::FillMode::kLower, cutlass::gemm::KernelTmaWarpSpecializedCooperative, Shape<_128,_128,_32>>::Gemm;
+
+  // Partial diagonal tiles and a partial k-tile
+  EXPECT_TRUE(test::gemm::device::TestRankK<Gemm>(328, 72, 2));
+}
+
+TEST(SM90_Device_Syrk_tf32t_f32n_tensor_op_gmma_f32, 128x128x32_1x1x1_upper_cooperative) {
+  using Gemm = typename test::gemm::device::Sm90RankKGemm<
+      cutlass::FillMode::kUpper, cutlass::gemm::KernelTmaWarpSpecializedCooperative, Shape<_128,_128,_32>>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestRankK<Gemm>(328, 72, 2));
+}
+
+TEST(SM90_Device_Syrk_tf32t_f32n_tensor_op_gmma_f32, 64x64x32_1x1x1_lower_pingpong) {
+  using Gemm = typename test::gemm::device::Sm90RankKGemm<
+      cutlass::FillMode::kLower, cutlass::gemm::KernelTmaWarpSpecializedPingpong, Shape<_64,_64,_32>>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestRankK<Gemm>(300, 256, 1));
+}
+
+TEST(SM90_Device_Syrk_tf32t_f32n_tensor_op_gmma_f32, 64x64x32_1x1x1_upper_pingpong) {
+  using Gemm = typename test::gemm::device::Sm90RankKGemm<
+      cutlass::FillMode::kUpper, cutlass::gemm::KernelTmaWarpSpecializedPingpong, Shape<_64,_64,_32>>::Gemm;
+
+  // A single tile, which is a diagonal tile
+  EXPECT_TRUE(test::gemm::device::TestRankK<Gemm>(40, 32, 1));
+}
+
+TEST(SM90_Device_Syr2k_tf32t_f32n_tensor_op_gmma_f32, 128x128x32_1x1x1_lower_cooperative) {
+  using Gemm = typename test::gemm::device::Sm90RankKGemm<
+      cutlass::FillMode::kLower, cutlass::gemm::KernelTmaWarpSpecializedCooperativeRank2K, Shape<_128,_128,_32>, 2>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestRankK<Gemm>(328, 72, 2));
+}
+
+TEST(SM90_Device_Syr2k_tf32t_f32n_tensor_op_gmma_f32, 64x64x32_1x1x1_upper_pingpong) {
+  using Gemm = typename test::gemm::device::Sm90RankKGemm<
+      cutlass::FillMode::kUpper, cutlass::gemm::KernelTmaWarpSpecializedPingpongRank2K, Shape<_64,_64,_32>, 2>::Gemm;
+
+  // A single k-tile per rank
+  EXPECT_TRUE(test::gemm::device::TestRankK<Gemm>(200, 32, 1));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
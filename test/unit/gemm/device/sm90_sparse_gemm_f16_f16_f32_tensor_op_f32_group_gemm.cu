@@ -0,0 +1,307 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm90 2:4 sparse grouped GEMM, where every group has its own
+    compressed A, metadata E and problem shape
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/arch/mma_sm90.h"
+
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/transform/device/transform_universal_adapter.hpp"
+#include "cutlass/transform/kernel/sparse_gemm_compressor.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Grouped f16 GEMM with a 2:4 sparse RowMajor A and float C and D
+template <
+  class KernelSchedule = cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative,
+  class EpilogueSchedule = cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative
+>
+struct Sm90GroupedSparseGemm {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, cutlass::layout::RowMajor *, 4,
+      float, cutlass::layout::RowMajor *, 4,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  // The layout of the sparse A is rebuilt per group from its problem shape, so only B takes a pointer layout
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassSparseTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 16,
+      cutlass::half_t, cutlass::layout::ColumnMajor *, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Groups of different M and K, each with its own 2:4 pruned A compressed on the device into its
+/// own compressed A and metadata E, checked against a dense host GEMM of the pruned A
+template <class Gemm>
+bool TestGroupedSparse(std::vector<int> const& group_M, std::vector<int> const& group_K, int N) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using CollectiveMainloop = typename GemmKernel::CollectiveMainloop;
+  using ProblemShape = typename GemmKernel::ProblemShape;
+  using UnderlyingProblemShape = typename ProblemShape::UnderlyingProblemShape;
+  using ElementA = typename CollectiveMainloop::ElementA;
+  using ElementB = typename CollectiveMainloop::ElementB;
+  using ElementE = typename CollectiveMainloop::ElementE;
+  using ElementOutput = typename Gemm::ElementD;
+  using StrideB = typename GemmKernel::InternalStrideB;
+  using StrideC = typename GemmKernel::InternalStrideC;
+  using StrideD = typename GemmKernel::InternalStrideD;
+
+  // The compressor works on the uncompressed A, described by its layout tag
+  using SparseConfig = typename CollectiveMainloop::SparseConfig;
+  using LayoutTagA = decltype(SparseConfig::deduce_layoutA_tag(typename CollectiveMainloop::LayoutA{}));
+  using StrideA = cutlass::gemm::TagToStrideA_t<LayoutTagA>;
+  using CompressorUtility = cutlass::transform::kernel::StructuredSparseCompressorUtility<
+      Shape<int,int,int,int>, ElementA, LayoutTagA, SparseConfig>;
+  using CompressorKernel = cutlass::transform::kernel::StructuredSparseCompressor<
+      Shape<int,int,int,int>, ElementA, LayoutTagA, SparseConfig, cutlass::arch::Sm90>;
+  using Compressor = cutlass::transform::device::TransformUniversalAdapter<CompressorKernel>;
+
+  int const groups = static_cast<int>(group_M.size());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  std::vector<UnderlyingProblemShape> problem_sizes;
+  std::vector<StrideA> stride_A;
+  std::vector<StrideB> stride_B;
+  std::vector<StrideC> stride_C;
+  std::vector<StrideD> stride_D;
+  std::vector<std::vector<ElementA>> host_A;
+  std::vector<std::vector<ElementB>> host_B;
+  std::vector<std::vector<ElementOutput>> host_C;
+  std::vector<cutlass::DeviceAllocation<ElementA>> block_A(groups);
+  std::vector<cutlass::DeviceAllocation<ElementA>> block_A_compressed(groups);
+  std::vector<cutlass::DeviceAllocation<ElementE>> block_E(groups);
+  std::vector<cutlass::DeviceAllocation<ElementB>> block_B(groups);
+  std::vector<cutlass::DeviceAllocation<ElementOutput>> block_C(groups);
+  std::vector<cutlass::DeviceAllocation<ElementOutput>> block_D(groups);
+
+  for (int g = 0; g < groups; ++g) {
+    int M = group_M[g];
+    int K = group_K[g];
+    problem_sizes.push_back({M, N, K});
+    stride_A.push_back(cutlass::make_cute_packed_stride(StrideA{}, make_shape(M, K, 1)));
+    stride_B.push_back(cutlass::make_cute_packed_stride(StrideB{}, make_shape(N, K, 1)));
+    stride_C.push_back(cutlass::make_cute_packed_stride(StrideC{}, make_shape(M, N, 1)));
+    stride_D.push_back(cutlass::make_cute_packed_stride(StrideD{}, make_shape(M, N, 1)));
+
+    host_A.emplace_back(size_t(M) * K);
+    host_B.emplace_back(size_t(N) * K);
+    host_C.emplace_back(size_t(M) * N);
+    // Nonzero A values, so the pruning pattern (and with it E) differs visibly per group
+    fill_small_integers(host_A[g], 10 + g, 2);
+    for (auto& a : host_A[g]) {
+      a = (float(a) == 0.f) ? ElementA(3) : a;
+    }
+    fill_small_integers(host_B[g], 20 + g, 1);
+    fill_small_integers(host_C[g], 30 + g, 3);
+
+    CompressorUtility compressor_utility(make_shape(M, N, K, 1), stride_A[g]);
+    compressor_utility.structure_sparse_zero_mask_fill(host_A[g].data(), 2023 + g);
+
+    block_A[g].reset(host_A[g].size());
+    block_A_compressed[g].reset(size_t(compressor_utility.get_tensorA_m_physical()) *
+                                compressor_utility.get_tensorA_k_physical());
+    block_E[g].reset(compressor_utility.get_tensor_E_bytes() / sizeof(ElementE));
+    block_B[g].reset(host_B[g].size());
+    block_C[g].reset(host_C[g].size());
+    block_D[g].reset(host_C[g].size());
+    block_A[g].copy_from_host(host_A[g].data());
+    block_B[g].copy_from_host(host_B[g].data());
+    block_C[g].copy_from_host(host_C[g].data());
+
+    typename Compressor::Arguments compressor_arguments{
+      {M, N, K, 1},
+      {block_A[g].get(), stride_A[g], block_A_compressed[g].get(), block_E[g].get()},
+      {hw_info}
+    };
+    Compressor compressor;
+    cutlass::DeviceAllocation<uint8_t> compressor_workspace(Compressor::get_workspace_size(compressor_arguments));
+    if (compressor.can_implement(compressor_arguments) != cutlass::Status::kSuccess ||
+        compressor.initialize(compressor_arguments, compressor_workspace.get()) != cutlass::Status::kSuccess ||
+        compressor.run() != cutlass::Status::kSuccess ||
+        cudaDeviceSynchronize() != cudaSuccess) {
+      std::cerr << "Compressor failed to run for group " << g << ".\n";
+      return false;
+    }
+  }
+
+  std::vector<ElementA const*> ptr_A;
+  std::vector<ElementE const*> ptr_E;
+  std::vector<ElementB const*> ptr_B;
+  std::vector<ElementOutput const*> ptr_C;
+  std::vector<ElementOutput*> ptr_D;
+  for (int g = 0; g < groups; ++g) {
+    ptr_A.push_back(block_A_compressed[g].get());
+    ptr_E.push_back(block_E[g].get());
+    ptr_B.push_back(block_B[g].get());
+    ptr_C.push_back(block_C[g].get());
+    ptr_D.push_back(block_D[g].get());
+  }
+
+  cutlass::DeviceAllocation<UnderlyingProblemShape> device_problem_sizes(groups);
+  cutlass::DeviceAllocation<StrideB> device_stride_B(groups);
+  cutlass::DeviceAllocation<StrideC> device_stride_C(groups);
+  cutlass::DeviceAllocation<StrideD> device_stride_D(groups);
+  cutlass::DeviceAllocation<ElementA const*> device_ptr_A(groups);
+  cutlass::DeviceAllocation<ElementE const*> device_ptr_E(groups);
+  cutlass::DeviceAllocation<ElementB const*> device_ptr_B(groups);
+  cutlass::DeviceAllocation<ElementOutput const*> device_ptr_C(groups);
+  cutlass::DeviceAllocation<ElementOutput*> device_ptr_D(groups);
+  device_problem_sizes.copy_from_host(problem_sizes.data());
+  device_stride_B.copy_from_host(stride_B.data());
+  device_stride_C.copy_from_host(stride_C.data());
+  device_stride_D.copy_from_host(stride_D.data());
+  device_ptr_A.copy_from_host(ptr_A.data());
+  device_ptr_E.copy_from_host(ptr_E.data());
+  device_ptr_B.copy_from_host(ptr_B.data());
+  device_ptr_C.copy_from_host(ptr_C.data());
+  device_ptr_D.copy_from_host(ptr_D.data());
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {groups, device_problem_sizes.get(), problem_sizes.data()},
+    {device_ptr_A.get(), device_ptr_B.get(), device_stride_B.get(), device_ptr_E.get()},
+    {{}, device_ptr_C.get(), device_stride_C.get(), device_ptr_D.get(), device_stride_D.get()},
+    hw_info
+  };
+  arguments.epilogue.thread.alpha = 2.f;
+  arguments.epilogue.thread.beta = 1.f;
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "Problem is not supported.\n";
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "GEMM failed to run.\n";
+    return false;
+  }
+
+  for (int g = 0; g < groups; ++g) {
+    int M = group_M[g];
+    int K = group_K[g];
+    std::vector<ElementOutput> host_D(host_C[g].size());
+    block_D[g].copy_to_host(host_D.data());
+
+    auto tA = make_tensor(host_A[g].data(), make_shape(M, K), take<0,2>(stride_A[g]));
+    auto tB = make_tensor(host_B[g].data(), make_shape(N, K), take<0,2>(stride_B[g]));
+    auto tC = make_tensor(host_C[g].data(), make_shape(M, N), take<0,2>(stride_C[g]));
+    auto tD = make_tensor(host_D.data(), make_shape(M, N), take<0,2>(stride_D[g]));
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float accum = 0.f;
+        for (int k = 0; k < K; ++k) {
+          accum += float(tA(m, k)) * float(tB(n, k));
+        }
+        float expected = 2.f * accum + float(tC(m, n));
+        if (float(tD(m, n)) != expected) {
+          std::cerr << "Group " << g << " mismatch at (" << m << ", " << n << "): "
+                    << float(tD(m, n)) << " != " << expected << "\n";
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SPARSE_SM90_SUPPORTED) && defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Sparse_Gemm_f16t_f16n_f32t_tensorop_f32_group_gemm, 128x128x64_1x1x1_cooperative) {
+  using Gemm = typename test::gemm::device::Sm90GroupedSparseGemm<>::Gemm;
+
+  // Groups with partial M tiles, several k-tiles and a single k-tile
+  EXPECT_TRUE(test::gemm::device::TestGroupedSparse<Gemm>({128, 200, 64}, {128, 256, 64}, 136));
+}
+
+TEST(SM90_Device_Sparse_Gemm_f16t_f16n_f32t_tensorop_f32_group_gemm, 128x128x64_1x1x1_pingpong) {
+  using Gemm = typename test::gemm::device::Sm90GroupedSparseGemm<
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpong,
+      cutlass::epilogue::PtrArrayTmaWarpSpecializedPingpong>::Gemm;
+
+  EXPECT_TRUE(test::gemm::device::TestGroupedSparse<Gemm>({96, 256, 128, 40}, {192, 64, 128, 320}, 200));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SPARSE_SM90_SUPPORTED) && defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,216 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the single-pass TensorReductionSinglePass device-wide operator
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/core_io.h"
+#include "cutlass/functional.h"
+#include "cutlass/reduction/device/tensor_reduce_single_pass.h"
+
+#include "cutlass/util/device_memory.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Reduces a packed rank-4 tensor (last rank contiguous) over the ranks set in 'reduced' and
+/// compares against a host reference. Sources are small integers, so sums are exact.
+template <typename TensorReduction>
+bool TestSinglePassReduction(
+  int64_t const (&extent)[4],
+  bool const (&reduced)[4],
+  typename TensorReduction::PreOp pre_op = typename TensorReduction::PreOp(),
+  typename TensorReduction::PostOp post_op = typename TensorReduction::PostOp(),
+  double tolerance = 0) {
+
+  using ElementOutput = typename TensorReduction::ElementOutput;
+  using ElementSource = typename TensorReduction::ElementSource;
+  using ElementCompute = typename TensorReduction::ElementCompute;
+
+  int64_t src_stride[4];
+  int64_t dst_stride[4];
+  int64_t src_count = 1;
+  int64_t dst_count = 1;
+
+  for (int p = 3; p >= 0; --p) {
+    src_stride[p] = src_count;
+    src_count *= extent[p];
+    dst_stride[p] = reduced[p] ? 0 : dst_count;
+    dst_count *= reduced[p] ? 1 : extent[p];
+  }
+
+  std::vector<ElementSource> src_host(src_count);
+  for (int64_t i = 0; i < src_count; ++i) {
+    src_host[i] = ElementSource(int((i * 7 + 3) % 17) - 8);
+  }
+
+  // Host reference
+  typename TensorReduction::ReductionOp reduction_op;
+  std::vector<ElementCompute> expected(dst_count, ElementCompute(0));
+
+  for (int64_t i = 0; i < src_count; ++i) {
+    int64_t dst_offset = 0;
+    int64_t idx = i;
+    for (int p = 3; p >= 0; --p) {
+      dst_offset += (idx % extent[p]) * dst_stride[p];
+      idx /= extent[p];
+    }
+    expected[dst_offset] = reduction_op(expected[dst_offset], pre_op(ElementCompute(src_host[i])));
+  }
+
+  cutlass::DeviceAllocation<ElementSource> src_device(src_count);
+  cutlass::DeviceAllocation<ElementOutput> dst_device(dst_count);
+  src_device.copy_from_host(src_host.data());
+
+  TensorReduction reduction(4, extent, src_stride, dst_stride);
+  EXPECT_TRUE(reduction.good());
+
+  cutlass::DeviceAllocation<uint8_t> device_workspace(reduction.workspace_size());
+
+  cutlass::Status status = reduction.reduce(
+    dst_device.get(),
+    src_device.get(),
+    device_workspace.get(),
+    ElementCompute(0),
+    reduction_op,
+    pre_op,
+    post_op);
+
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  std::vector<ElementOutput> dst_host(dst_count);
+  dst_device.copy_to_host(dst_host.data());
+
+  for (int64_t i = 0; i < dst_count; ++i) {
+    double want = double(ElementOutput(post_op(expected[i])));
+    double got = double(dst_host[i]);
+    bool equal = std::abs(want - got) <= tolerance * std::abs(want);
+
+    EXPECT_TRUE(equal);
+    if (!equal) {
+      std::cerr
+        << "Error at output " << i << std::endl
+        << "  expected: " << want << std::endl
+        << "       got: " << got << std::endl
+        << "   Grid: " << reduction.grid_shape
+        << "\n   Block: " << reduction.threadblock_shape << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Reduces non-adjacent ranks, including and excluding the contiguous rank
+TEST(Reduction_TensorReduceSinglePass, f32_sum_rank_subsets) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionSinglePass<
+    4,
+    float,
+    float,
+    cutlass::plus<float>
+  >;
+
+  int64_t const extent[4] = {3, 5, 7, 129};
+
+  bool const reduced_list[][4] = {
+    {false, false, false, true},
+    {false, true,  false, true},
+    {true,  false, true,  false},
+    {true,  false, false, false},
+    {true,  true,  true,  true}
+  };
+
+  for (auto const &reduced : reduced_list) {
+    EXPECT_TRUE(TestSinglePassReduction<TensorReduction>(extent, reduced));
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Few outputs over a large reduced space, which splits the reduction across CTAs
+TEST(Reduction_TensorReduceSinglePass, f16_f32_sum_split) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionSinglePass<
+    4,
+    float,
+    cutlass::half_t,
+    cutlass::plus<float>,
+    float
+  >;
+
+  int64_t const extent[4] = {2, 64, 32, 257};
+
+  bool const reduced_list[][4] = {
+    {false, true, true, true},
+    {true, true, true, false}
+  };
+
+  for (auto const &reduced : reduced_list) {
+    EXPECT_TRUE(TestSinglePassReduction<TensorReduction>(extent, reduced));
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Mean of squares with fused pre- and post-operators
+TEST(Reduction_TensorReduceSinglePass, f16_mean_square) {
+
+  using PostOp = cutlass::reduction::kernel::TensorReductionScale<float>;
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionSinglePass<
+    4,
+    cutlass::half_t,
+    cutlass::half_t,
+    cutlass::plus<float>,
+    float,
+    cutlass::square<float>,
+    PostOp
+  >;
+
+  int64_t const extent[4] = {4, 3, 16, 1024};
+  bool const reduced[4] = {false, false, true, true};
+
+  PostOp post_op{1.0f / float(extent[2] * extent[3])};
+
+  EXPECT_TRUE(TestSinglePassReduction<TensorReduction>(extent, reduced, cutlass::square<float>(), post_op, 1e-3));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
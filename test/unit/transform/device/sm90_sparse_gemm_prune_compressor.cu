@@ -0,0 +1,159 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "cute/atom/mma_traits_sm90_gmma.hpp"                         // cute::GMMA::Major
+#include "cutlass/arch/config.h"                                      // CUTLASS_ARCH_MMA_SM90_SUPPORTED
+#include "cutlass/transform/kernel/sparse_gemm_compressor.hpp"        // StructuredSparseCompressor
+#include "cutlass/transform/kernel/sparse_gemm_prune_compressor.hpp"  // StructuredSparsePruneCompressor
+#include "cutlass/transform/device/transform_universal_adapter.hpp"   // TransformUniversalAdapter
+#include "cutlass/gemm/collective/builders/sm90_common.inl"           // gmma_ss_tag_to_major_A
+#include "cutlass/gemm/collective/builders/sm90_sparse_config.inl"    // Sm90GemmSparseConfig
+#include "cutlass/util/device_memory.h"                               // cutlass::device_memory::allocation
+#include "cutlass/util/packed_stride.hpp"                             // cutlass::make_cute_packed_stride
+#include "cutlass/util/reference/host/tensor_fill.h"                  // cutlass::reference::host::BlockFillRandomUniform
+
+#include "../../common/cutlass_unit_test.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// * Test Plan
+// Prune several dense fp16 tensors of different shapes in one launch, and compare the output with
+// the SM90 compressor applied to the same tensors pruned on the host.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(SM90_Structured_Sparse_Gemm_Prune_Compressor_Device, f16_t_batched)
+{
+  using ElementA = cutlass::half_t;
+  using LayoutATag = cutlass::layout::RowMajor;
+
+  static constexpr cute::GMMA::Major GmmaMajorA = cutlass::gemm::collective::detail::gmma_rs_tag_to_major_A<LayoutATag>();
+  using ElementAMma = cute::sparse_elem<2, ElementA>;
+  using ElementEMma = cute::sparse_elem<8, uint8_t>;
+  using SparseConfig = cutlass::Sm90GemmSparseConfig<ElementAMma, GmmaMajorA, ElementEMma, cute::Int<32>>;
+
+  using ProblemShape = cute::Shape<int, int, int, int>;
+  using CompressorKernel = cutlass::transform::kernel::
+      StructuredSparseCompressor<ProblemShape, ElementA, LayoutATag, SparseConfig, cutlass::arch::Sm90>;
+  using Compressor = cutlass::transform::device::TransformUniversalAdapter<CompressorKernel>;
+  using CompressorUtility = cutlass::transform::kernel::
+      StructuredSparseCompressorUtility<ProblemShape, ElementA, LayoutATag, SparseConfig>;
+
+  using PruneKernel = cutlass::transform::kernel::StructuredSparsePruneCompressor<
+      ElementA, LayoutATag, cutlass::transform::kernel::SparseFormatSm90<SparseConfig>>;
+  using Pruner = cutlass::transform::device::TransformUniversalAdapter<PruneKernel>;
+  using StrideA = typename PruneKernel::StrideA;
+
+  std::vector<ProblemShape> shapes = {{128, 1, 256, 1}, {72, 1, 96, 2}, {300, 1, 4, 1}};
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0);
+
+  std::vector<cutlass::device_memory::allocation<ElementA>> dense;
+  std::vector<cutlass::device_memory::allocation<uint8_t>> comp, meta, comp_ref, meta_ref;
+  std::vector<typename PruneKernel::Problem> problems;
+
+  for (size_t p = 0; p < shapes.size(); ++p) {
+    auto [M, N, K, L] = shapes[p];
+    StrideA stride_a = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, L));
+    CompressorUtility utility(shapes[p], stride_a);
+
+    size_t count = size_t(M) * K * L;
+    std::vector<ElementA> host_A(count);
+    cutlass::reference::host::BlockFillRandomUniform(host_A.data(), count, 2024 + p, 4.0, -4.0, -1);
+
+    // Host reference pruning: keep the two largest magnitudes of every four along K
+    std::vector<ElementA> host_A_pruned(host_A);
+    for (size_t chunk = 0; chunk < count; chunk += 4) {
+      for (int i = 0; i < 4; ++i) {
+        int rank = 0;
+        for (int j = 0; j < 4; ++j) {
+          float mi = std::abs(float(host_A[chunk + i]));
+          float mj = std::abs(float(host_A[chunk + j]));
+          rank += (mj > mi || (mj == mi && j < i)) ? 1 : 0;
+        }
+        if (rank >= 2) {
+          host_A_pruned[chunk + i] = ElementA(0);
+        }
+      }
+    }
+
+    dense.emplace_back(count);
+    cutlass::device_memory::allocation<ElementA> pruned(count);
+    cutlass::device_memory::copy_to_device(dense.back().get(), host_A.data(), count);
+    cutlass::device_memory::copy_to_device(pruned.get(), host_A_pruned.data(), count);
+
+    for (auto *list : {&comp, &comp_ref}) {
+      list->emplace_back(utility.get_compressed_tensor_A_bytes());
+      ASSERT_EQ(cudaMemset(list->back().get(), 0, list->back().bytes()), cudaSuccess);
+    }
+    for (auto *list : {&meta, &meta_ref}) {
+      list->emplace_back(utility.get_tensor_E_bytes());
+      ASSERT_EQ(cudaMemset(list->back().get(), 0, list->back().bytes()), cudaSuccess);
+    }
+
+    // Reference: existing compressor on the host-pruned tensor
+    typename Compressor::Arguments arguments{
+      shapes[p], {pruned.get(), stride_a, comp_ref.back().get(), meta_ref.back().get()}, {hw_info}};
+    Compressor compressor;
+    cutlass::device_memory::allocation<uint8_t> workspace(Compressor::get_workspace_size(arguments));
+    ASSERT_EQ(compressor.run(arguments, workspace.get()), cutlass::Status::kSuccess);
+    ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+    problems.push_back({M, K, L, dense.back().get(), stride_a, comp.back().get(), meta.back().get()});
+  }
+
+  // All problems in a single launch
+  cutlass::device_memory::allocation<typename PruneKernel::Problem> device_problems(problems.size());
+  cutlass::device_memory::copy_to_device(device_problems.get(), problems.data(), problems.size());
+
+  typename Pruner::Arguments arguments{int(problems.size()), device_problems.get(), problems.data(), hw_info};
+  Pruner pruner;
+  ASSERT_EQ(Pruner::can_implement(arguments), cutlass::Status::kSuccess);
+  ASSERT_EQ(pruner.run(arguments), cutlass::Status::kSuccess);
+  ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  for (size_t p = 0; p < shapes.size(); ++p) {
+    std::vector<uint8_t> a(comp[p].bytes()), a_ref(comp[p].bytes()), e(meta[p].bytes()), e_ref(meta[p].bytes());
+    cutlass::device_memory::copy_to_host(a.data(), comp[p].get(), a.size());
+    cutlass::device_memory::copy_to_host(a_ref.data(), comp_ref[p].get(), a_ref.size());
+    cutlass::device_memory::copy_to_host(e.data(), meta[p].get(), e.size());
+    cutlass::device_memory::copy_to_host(e_ref.data(), meta_ref[p].get(), e_ref.size());
+
+    EXPECT_TRUE(a == a_ref) << "compressed A mismatch in problem " << p;
+    EXPECT_TRUE(e == e_ref) << "metadata mismatch in problem " << p;
+  }
+}
+
+#endif // #if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
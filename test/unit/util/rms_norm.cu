@@ -31,6 +31,7 @@
 #include "../common/cutlass_unit_test.h"
 
 #include "cutlass/util/device_rmsnorm.h"
+#include "cutlass/util/device_fused_norm.h"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/constants.h"
 #include "cutlass/util/reference/host/tensor_copy.h"
@@ -115,6 +116,160 @@ void run_test(int M, int N) {
     << "Mean absolute difference: " << mean_abs_diff;
 }
 
+/// Normalizes with the per-row sum of squares a fused GEMM epilogue would have produced
+void run_test_from_sum_squares(int M, int N) {
+  cutlass::HostTensor<ElementType, Layout> input, output_ref, output, weight;
+  cutlass::HostTensor<float, Layout> sum_squares;
+  input.reset({M, N});
+  output.reset({M, N});
+  output_ref.reset({M, N});
+  weight.reset({1, N});
+  sum_squares.reset({M, 1});
+
+  const unsigned seed = 2022;
+
+  cutlass::reference::host::TensorFillRandomUniform(input.host_view(),
+						    seed,
+						    ElementType(5),
+						    ElementType(-5),
+						    0);
+
+  cutlass::reference::host::TensorFillRandomUniform(weight.host_view(),
+						    seed,
+						    ElementType(5),
+						    ElementType(-5),
+						    0);
+
+  for (int m = 0; m < M; ++m) {
+    float square_sum{0};
+    for (int n = 0; n < N; ++n) {
+      float inp = static_cast<float>(input.at({m, n}));
+      square_sum += inp * inp;
+    }
+    sum_squares.at({m, 0}) = square_sum;
+  }
+
+  input.sync_device();
+  weight.sync_device();
+  sum_squares.sync_device();
+
+  rmsnorm_host({M, N}, output_ref.host_ref(), input.host_ref(), weight.host_ref(), (float)1e-5);
+  cutlass::rmsnorm_from_sum_squares({M, N}, output.device_ref(),
+		   input.device_ref(), weight.device_ref(), sum_squares.device_data(), NULL, (float)1e-5L);
+
+  output.sync_host();
+
+  float max_abs_diff = -1;
+  float mean_abs_diff = 0;
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < N; ++n) {
+      auto diff = abs(static_cast<float>(output_ref.at({m, n}) - output.at({m, n})));
+      mean_abs_diff += diff;
+      max_abs_diff = cutlass::platform::max(max_abs_diff, diff);
+    }
+  }
+
+  mean_abs_diff /= float(M * N);
+
+  EXPECT_TRUE(max_abs_diff < 0.001f && mean_abs_diff < 0.001f)
+    << "Max absolute difference  : " << max_abs_diff << "\n"
+    << "Mean absolute difference: " << mean_abs_diff;
+}
+
+/// Single-pass RMSNorm of input + residual, compared against the unfused host reference
+void run_test_fused_residual(int M, int N) {
+  cutlass::HostTensor<ElementType, Layout> input, residual, residual_out, sum, output_ref, output, weight;
+  input.reset({M, N});
+  residual.reset({M, N});
+  residual_out.reset({M, N});
+  sum.reset({M, N});
+  output.reset({M, N});
+  output_ref.reset({M, N});
+  weight.reset({1, N});
+
+  const unsigned seed = 2022;
+
+  cutlass::reference::host::TensorFillRandomUniform(input.host_view(), seed, ElementType(5), ElementType(-5), 0);
+  cutlass::reference::host::TensorFillRandomUniform(residual.host_view(), seed + 1, ElementType(5), ElementType(-5), 0);
+  cutlass::reference::host::TensorFillRandomUniform(weight.host_view(), seed + 2, ElementType(5), ElementType(-5), 0);
+
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < N; ++n) {
+      sum.at({m, n}) = ElementType(static_cast<float>(input.at({m, n})) + static_cast<float>(residual.at({m, n})));
+    }
+  }
+
+  input.sync_device();
+  residual.sync_device();
+  weight.sync_device();
+
+  rmsnorm_host({M, N}, output_ref.host_ref(), sum.host_ref(), weight.host_ref(), (float)1e-5);
+  cutlass::rmsnorm_fused({M, N}, output.device_ref(), input.device_ref(), weight.device_ref(), NULL,
+                         (float)1e-5, residual.device_data(), residual_out.device_data());
+
+  output.sync_host();
+  residual_out.sync_host();
+
+  EXPECT_TRUE(cutlass::reference::host::TensorEquals(residual_out.host_view(), sum.host_view()));
+
+  float max_abs_diff = -1;
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < N; ++n) {
+      auto diff = abs(static_cast<float>(output_ref.at({m, n}) - output.at({m, n})));
+      max_abs_diff = cutlass::platform::max(max_abs_diff, diff);
+    }
+  }
+
+  EXPECT_TRUE(max_abs_diff < 0.01f) << "Max absolute difference  : " << max_abs_diff;
+}
+
+/// Single-pass RMSNorm with FP8 output and per-token scales
+void run_test_fused_fp8(int M, int N) {
+  using ElementOutput = cutlass::float_e4m3_t;
+
+  cutlass::HostTensor<ElementType, Layout> input, output_ref, weight;
+  cutlass::HostTensor<ElementOutput, Layout> output;
+  cutlass::HostTensor<float, Layout> token_scale;
+  input.reset({M, N});
+  output.reset({M, N});
+  output_ref.reset({M, N});
+  weight.reset({1, N});
+  token_scale.reset({M, 1});
+
+  const unsigned seed = 2022;
+
+  cutlass::reference::host::TensorFillRandomUniform(input.host_view(), seed, ElementType(5), ElementType(-5), 0);
+  cutlass::reference::host::TensorFillRandomUniform(weight.host_view(), seed, ElementType(5), ElementType(-5), 0);
+
+  input.sync_device();
+  weight.sync_device();
+
+  rmsnorm_host({M, N}, output_ref.host_ref(), input.host_ref(), weight.host_ref(), (float)1e-5);
+  cutlass::rmsnorm_fused({M, N}, output.device_ref(), input.device_ref(), weight.device_ref(), NULL,
+                         (float)1e-5, (ElementType const *)nullptr, (ElementType *)nullptr, token_scale.device_data());
+
+  output.sync_host();
+  token_scale.sync_host();
+
+  float max_rel_diff = 0;
+  for (int m = 0; m < M; ++m) {
+    float amax = 0;
+    for (int n = 0; n < N; ++n) {
+      amax = cutlass::platform::max(amax, abs(static_cast<float>(output_ref.at({m, n}))));
+    }
+    EXPECT_NEAR(token_scale.at({m, 0}), amax / 448.0f, amax / 448.0f * 0.01f);
+
+    for (int n = 0; n < N; ++n) {
+      float dequantized = static_cast<float>(output.at({m, n})) * token_scale.at({m, 0});
+      float diff = abs(dequantized - static_cast<float>(output_ref.at({m, n})));
+      max_rel_diff = cutlass::platform::max(max_rel_diff, diff / amax);
+    }
+  }
+
+  // e4m3 keeps 3 mantissa bits: half an ulp is at most 1/16 of the row maximum
+  EXPECT_TRUE(max_rel_diff <= 0.0625f) << "Max difference relative to the row maximum: " << max_rel_diff;
+}
+
 TEST(RMSNorm, 16x1024) {
   run_test(16, 1024);
 }
@@ -122,3 +277,23 @@ TEST(RMSNorm, 16x1024) {
 TEST(RMSNorm, 1x127) {
   run_test(1, 127);
 }
+
+TEST(RMSNorm, FromSumSquares_16x1024) {
+  run_test_from_sum_squares(16, 1024);
+}
+
+TEST(RMSNorm, FromSumSquares_3x127) {
+  run_test_from_sum_squares(3, 127);
+}
+
+TEST(RMSNorm, FusedResidual_16x4096) {
+  run_test_fused_residual(16, 4096);
+}
+
+TEST(RMSNorm, FusedResidual_3x127) {
+  run_test_fused_residual(3, 127);
+}
+
+TEST(RMSNorm, FusedFp8TokenScale_8x16384) {
+  run_test_fused_fp8(8, 16384);
+}
@@ -218,6 +218,33 @@ struct TensorDescription {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Operands of a fused 3.x epilogue beyond alpha, beta and the source C
+struct EpilogueFusionDescription {
+
+  /// Element of the per-row (length M) bias vector, or kInvalid if the epilogue adds no bias
+  NumericTypeID element_bias{NumericTypeID::kInvalid};
+
+  /// Element of the auxiliary output, which has the extent and layout of D, or kInvalid if there is none
+  NumericTypeID element_aux{NumericTypeID::kInvalid};
+
+  /// Element of the absolute-maximum reductions of D and aux, or kInvalid if none are computed
+  NumericTypeID element_amax{NumericTypeID::kInvalid};
+
+  /// Whether the epilogue takes the scale_a, scale_b, scale_c, scale_d and scale_aux scale factors
+  bool has_scale_factors{false};
+
+  /// Whether an elementwise activation is applied
+  bool has_activation{false};
+
+  /// Whether D differs from a linear combination of the accumulator and the source
+  bool is_fused() const {
+    return element_bias != NumericTypeID::kInvalid || element_aux != NumericTypeID::kInvalid ||
+           element_amax != NumericTypeID::kInvalid || has_scale_factors || has_activation;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Description of all GEMM computations
 struct GemmDescription : public OperationDescription {
 
@@ -251,6 +278,9 @@ struct GemmDescription : public OperationDescription {
   /// Transformation on B operand
   ComplexTransform transform_B;
 
+  /// Operands of a fused 3.x epilogue
+  EpilogueFusionDescription epilogue_fusion;
+
   //
   // Methods
   //
@@ -0,0 +1,220 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*
+  \file
+  \brief Cache mapping GEMM problems onto the operation selected for them, either from
+        profiling results or by autotuning at runtime.
+
+  Entries are keyed by the functional behavior of the GEMM, the device, the largest alignment
+  satisfied by the problem, and power-of-two buckets of the problem extents. The cache is
+  persisted by operation name, so persisted caches always resolve against the operations
+  actually present in the Manifest.
+*/
+
+#pragma once
+
+#include <iosfwd>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+#include "cutlass/library/operation_table.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Tuple identifying a bucket of GEMM problems sharing a selected operation
+struct GemmSelectionKey {
+
+  GemmFunctionalKey functional_key;
+  int compute_capability;
+  int sm_count;
+  int alignment;
+  int m_bucket;
+  int n_bucket;
+  int k_bucket;
+
+  //
+  // Methods
+  //
+
+  inline
+  GemmSelectionKey(
+    GemmFunctionalKey const &functional_key = GemmFunctionalKey(Provider::kInvalid),
+    int compute_capability = 0,
+    int sm_count = 0,
+    int alignment = 0,
+    int m_bucket = 0,
+    int n_bucket = 0,
+    int k_bucket = 0
+  ):
+    functional_key(functional_key),
+    compute_capability(compute_capability),
+    sm_count(sm_count),
+    alignment(alignment),
+    m_bucket(m_bucket),
+    n_bucket(n_bucket),
+    k_bucket(k_bucket)
+  { }
+
+  /// Constructs a key from the problem extents
+  static GemmSelectionKey from_problem(
+    GemmFunctionalKey const &functional_key,
+    int compute_capability,
+    int sm_count,
+    int alignment,
+    int64_t m,
+    int64_t n,
+    int64_t k) {
+
+    return GemmSelectionKey(
+      functional_key,
+      compute_capability,
+      sm_count,
+      alignment,
+      extent_bucket(m),
+      extent_bucket(n),
+      extent_bucket(k));
+  }
+
+  /// Bucket b holds extents in (2^(b-1), 2^b]
+  static int extent_bucket(int64_t extent) {
+    int bucket = 0;
+    while (bucket < 62 && (int64_t(1) << bucket) < extent) {
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  inline
+  bool operator==(GemmSelectionKey const &rhs) const {
+    return
+      (functional_key == rhs.functional_key) &&
+      (compute_capability == rhs.compute_capability) &&
+      (sm_count == rhs.sm_count) &&
+      (alignment == rhs.alignment) &&
+      (m_bucket == rhs.m_bucket) &&
+      (n_bucket == rhs.n_bucket) &&
+      (k_bucket == rhs.k_bucket);
+  }
+
+  inline
+  bool operator!=(GemmSelectionKey const &rhs) const {
+    return !(*this == rhs);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Hash function for GemmSelectionKey
+struct GemmSelectionKeyHasher {
+  using IntHash = std::hash<int>;
+
+  inline
+  size_t operator()(GemmSelectionKey const &key) const {
+    IntHash hash;
+
+    return
+      GemmFunctionalKeyHasher()(key.functional_key) ^
+      GemmFunctionalKeyHasher::rotl(hash(key.compute_capability), 15) ^
+      GemmFunctionalKeyHasher::rotl(hash(key.sm_count),           17) ^
+      GemmFunctionalKeyHasher::rotl(hash(key.alignment),          19) ^
+      GemmFunctionalKeyHasher::rotl(hash(key.m_bucket),           21) ^
+      GemmFunctionalKeyHasher::rotl(hash(key.n_bucket),           25) ^
+      GemmFunctionalKeyHasher::rotl(hash(key.k_bucket),           29);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Cache of selected GEMM operations. Lookups and insertions may run concurrently from several
+/// threads, e.g. handles of a HandlePool sharing one cache.
+class GemmSelectionCache {
+public:
+
+  using SelectionMap = std::unordered_map<
+    GemmSelectionKey,
+    Operation const *,
+    GemmSelectionKeyHasher
+  >;
+
+private:
+
+  /// Selected operations
+  SelectionMap selections_;
+
+  /// Guards selections_; lookups take it shared
+  mutable std::shared_mutex mutex_;
+
+public:
+
+  /// Finds the operation selected for a key. If there is no entry at the key's alignment, entries
+  /// recorded for smaller alignments are considered, since their operations remain valid.
+  Operation const *find(GemmSelectionKey const &key) const;
+
+  /// Records the operation selected for a key, replacing any previous selection
+  void insert(GemmSelectionKey const &key, Operation const *operation);
+
+  /// Removes all entries
+  void clear();
+
+  /// Number of entries
+  size_t size() const;
+
+  /// Returns the entries of the cache. Not synchronized with concurrent insertions.
+  SelectionMap const &selections() const;
+
+  /// Writes the cache as text, one entry per line naming the selected operation
+  Status save(std::ostream &out) const;
+
+  /// Writes the cache to a file
+  Status save(std::string const &path) const;
+
+  /// Reads entries written by save(), resolving operation names against the manifest. Entries
+  /// naming operations absent from the manifest are skipped.
+  Status load(std::istream &in, Manifest const &manifest);
+
+  /// Reads entries from a file
+  Status load(std::string const &path, Manifest const &manifest);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
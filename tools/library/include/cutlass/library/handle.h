@@ -34,7 +34,11 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 #include "cutlass/library/library.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +48,50 @@ namespace library {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+class GemmSelectionCache;
+struct GemmFunctionalKey;
+struct GemmPreferenceKey;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// One GEMM of a heterogeneous list executed by Handle::gemm_batch(): D <= alpha * A*B + beta * C
+struct GemmBatchProblem {
+
+  int M{0};                                   /// GEMM M dimension
+  int N{0};                                   /// GEMM N dimension
+  int K{0};                                   /// GEMM K dimension
+
+  NumericTypeID element_compute{NumericTypeID::kInvalid};   /// Data type of internal accumulation
+  NumericTypeID element_scalar{NumericTypeID::kInvalid};    /// Data type of alpha/beta scalars
+
+  void const *alpha{nullptr};                 /// Pointer to alpha scalar
+  void const *beta{nullptr};                  /// Pointer to beta scalar
+
+  NumericTypeID element_A{NumericTypeID::kInvalid};         /// Data type of A matrix elements
+  LayoutTypeID layout_A{LayoutTypeID::kInvalid};            /// Layout of A matrix
+  ComplexTransform transform_A{ComplexTransform::kNone};    /// Complex transformation applied to A matrix
+  void const *ptr_A{nullptr};                 /// Pointer to A matrix in Global Memory
+  int64_t lda{0};                             /// Leading dimension of A matrix
+
+  NumericTypeID element_B{NumericTypeID::kInvalid};         /// Data type of B matrix elements
+  LayoutTypeID layout_B{LayoutTypeID::kInvalid};            /// Layout of B matrix
+  ComplexTransform transform_B{ComplexTransform::kNone};    /// Complex transformation applied to B matrix
+  void const *ptr_B{nullptr};                 /// Pointer to B matrix in Global Memory
+  int64_t ldb{0};                             /// Leading dimension of B matrix
+
+  NumericTypeID element_C{NumericTypeID::kInvalid};         /// Data type of C matrix
+  LayoutTypeID layout_C{LayoutTypeID::kInvalid};            /// Layout of C matrix
+  void const *ptr_C{nullptr};                 /// Pointer to C matrix
+  int64_t ldc{0};                             /// Leading dimension of C matrix
+
+  NumericTypeID element_D{NumericTypeID::kInvalid};         /// Data type of D matrix
+  LayoutTypeID layout_D{LayoutTypeID::kInvalid};            /// Layout of D matrix
+  void *ptr_D{nullptr};                       /// Pointer to D matrix
+  int64_t ldd{0};                             /// Leading dimension of D matrix
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Handle object
 class Handle {
 private:
@@ -66,14 +114,73 @@ private:
   /// Size of device workspace in bytes
   size_t workspace_size_;
 
+  /// Size of the device workspace allocation in bytes. The allocation grows geometrically
+  /// and is never shrunk, so this may exceed workspace_size_.
+  size_t workspace_capacity_;
+
+  /// Stream-ordered memory pool backing the device workspace. Null if the device does not
+  /// support memory pools, in which case the workspace is allocated synchronously.
+  cudaMemPool_t workspace_pool_;
+
+  /// If true, the device workspace is owned by the caller and is neither grown nor freed
+  bool external_workspace_;
+
   /// Indicates whether scalars are host or device pointers
   ScalarPointerMode scalar_pointer_mode_;
 
+  /// If true, kernels are launched with programmatic dependent launch so that each operation's
+  /// prologue overlaps the tail of the preceding kernel on the stream
+  bool use_pdl_;
+
   /// Pointer to the most recently executed operation
   Operation const *last_operation_;
 
   int device_idx_;
 
+  /// Cache of selected GEMM operations, consulted before the default heuristic
+  std::shared_ptr<GemmSelectionCache> gemm_selection_cache_;
+
+  /// If true, GEMM problems missing from the selection cache are autotuned
+  bool gemm_autotuning_;
+
+  /// If true, GEMMs are computed with a K reduction order that is independent of M and the SM count
+  bool deterministic_;
+
+  /// Selects the operation used for a GEMM problem from the selection cache, by autotuning
+  /// or by the default heuristic. Returns nullptr if no operation is applicable.
+  Operation const *select_gemm_operation_(
+    GemmFunctionalKey const &functional_key,
+    GemmPreferenceKey const &preference_key,
+    int M,
+    int N,
+    int K,
+    void const *configuration,
+    void const *arguments,
+    bool allow_autotuning);
+
+  /// Runs each candidate operation on the problem and returns the fastest one
+  Operation const *autotune_gemm_operation_(
+    std::vector<Operation const *> const &candidates,
+    void const *configuration,
+    void const *arguments);
+
+  /// Grows the device workspace allocation to hold at least `bytes`, ordered on the current stream
+  Status grow_workspace_(size_t bytes);
+
+  /// Ensures the device workspace holds at least `bytes` and asynchronously clears them on
+  /// the current stream ahead of an operation
+  Status prepare_workspace_(size_t bytes);
+
+  /// Releases the device workspace allocation, ordered on the current stream
+  void free_workspace_();
+
+  /// Releases the device workspace and its memory pool on the handle's device, ordered on the
+  /// current stream
+  void release_resources_();
+
+  /// Runs a set of compatible problems from a batch as a single grouped GEMM kernel
+  Status gemm_grouped_(GemmBatchProblem const *problems, std::vector<int> const &indices);
+
 public:
 
   /// Constructor
@@ -113,18 +220,61 @@ public:
   /// Gets a pointer to the device workspace allocation in Global Memory
   void *get_workspace() const;
 
-  /// Sets the size of device workspace, invalidating calls to get_device_workspace()
+  /// Sets the size of device workspace, invalidating calls to get_device_workspace(). The workspace
+  /// is cleared asynchronously on the current stream.
   void set_workspace_size(size_t bytes);
 
+  /// Runs operations on a caller-owned device workspace of `bytes` in place of the handle's own
+  /// allocation. The workspace is not grown: operations needing more fail with kErrorWorkspaceNull.
+  /// A null workspace returns the handle to allocating its own.
+  void set_external_workspace(void *workspace, size_t bytes);
+
   /// Gets the scalar pointer mode
   ScalarPointerMode get_scalar_pointer_mode() const;
 
   /// Sets the scalar pointer mode
   void set_scalar_pointer_mode(ScalarPointerMode mode);
 
+  /// Gets whether kernels are launched with programmatic dependent launch
+  bool get_use_pdl() const;
+
+  /// Enables programmatic dependent launch for subsequent operations. Consecutive operations issued
+  /// on the current stream then overlap their prologue with the previous kernel. Has no effect
+  /// unless the kernels are compiled with CUTLASS_ENABLE_GDC_FOR_SM90.
+  void set_use_pdl(bool use_pdl);
+
   /// Gets the most recently executed operation
   Operation const *get_last_operation() const;
 
+  /// Sets the cache of selected GEMM operations consulted by GEMM calls. Passing nullptr restores
+  /// the default heuristic.
+  void set_gemm_selection_cache(std::shared_ptr<GemmSelectionCache> cache);
+
+  /// Gets the cache of selected GEMM operations
+  std::shared_ptr<GemmSelectionCache> get_gemm_selection_cache() const;
+
+  /// Loads a GEMM selection table, such as one exported by the profiler, and uses it as the
+  /// selection cache. Operations are resolved against the library's manifest.
+  Status load_gemm_selection_cache(std::string const &path);
+
+  /// Enables autotuning of GEMM problems missing from the selection cache, creating an empty
+  /// cache if none is set. Autotuning runs every candidate operation on the caller's operands,
+  /// so it is skipped when C and D alias.
+  void set_gemm_autotuning(bool enabled);
+
+  /// Returns whether GEMM autotuning is enabled
+  bool get_gemm_autotuning() const;
+
+  /// Enables deterministic, batch-invariant GEMMs: every output element is then reduced over K in an
+  /// order that depends on neither M nor the SM count, so results are bitwise identical across batch
+  /// sizes. The operation is selected without regard to M, bypassing the selection cache and
+  /// autotuning, and problems whose M the selected operation cannot implement are rejected rather than
+  /// served by a different kernel. Stream-K kernels run data-parallel (or split-K with a fixed count).
+  void set_deterministic(bool enabled);
+
+  /// Returns whether deterministic GEMMs are enabled
+  bool get_deterministic() const;
+
   //
   // Computations
   //
@@ -216,6 +366,19 @@ public:
     int64_t batch_stride_D = 0                /// Batch stride of D operand
   );
 
+  /// Executes a list of independent GEMMs with heterogeneous shapes.
+  //
+  // Problems that share data types, layouts and scalars are coalesced into grouped GEMM kernels.
+  // Problems large enough to fill the device on their own, and groups with no applicable grouped
+  // kernel, run as individual gemm_universal() calls. If `launch_count` is non-null it receives
+  // the number of kernels launched.
+  //
+  Status gemm_batch(
+    GemmBatchProblem const *problems,         /// Array of problems in host memory
+    int problem_count,                        /// Number of problems
+    int *launch_count = nullptr               /// Optional number of kernels launched
+  );
+
   /// Planar complex GEMM
   ///
   /// Note, all data types are the real-valued base types used by the planar-complex GEMM kernel.
@@ -341,6 +504,90 @@ public:
 /// Unique pointer storing the handle
 using HandlePtr = std::unique_ptr<Handle>;
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Pool of handles for dispatching operations concurrently from several host threads.
+///
+/// The operation tables of the library Singleton are immutable once initialized, so lookups from
+/// pooled handles take no locks. Each handle runs on its own slice of a single device workspace
+/// allocation, and all handles share one GEMM selection cache. A thread acquires a handle for its
+/// stream and returns it when the lease is destroyed; work a later lease enqueues on another
+/// stream is ordered after the work already using the slice.
+class HandlePool {
+public:
+
+  /// Exclusive use of a pooled handle, returned to the pool on destruction
+  class Lease {
+  public:
+
+    Lease() = default;
+    Lease(HandlePool *pool, int index): pool_(pool), index_(index) { }
+    Lease(Lease &&lease): pool_(lease.pool_), index_(lease.index_) { lease.pool_ = nullptr; }
+    Lease &operator=(Lease &&lease);
+    Lease(Lease const &) = delete;
+    Lease &operator=(Lease const &) = delete;
+    ~Lease() { release(); }
+
+    /// Returns the handle to the pool
+    void release();
+
+    /// True if the lease holds a handle
+    explicit operator bool() const { return pool_ != nullptr; }
+
+    Handle &operator*() const { return *pool_->handles_[index_]; }
+    Handle *operator->() const { return pool_->handles_[index_].get(); }
+
+  private:
+    HandlePool *pool_{nullptr};
+    int index_{-1};
+  };
+
+  /// Creates `handle_count` handles on the current device, each with a workspace slice of
+  /// `workspace_slice_size` bytes. A null cache creates one shared by the handles.
+  HandlePool(
+    int handle_count,
+    size_t workspace_slice_size = (4<<20),
+    std::shared_ptr<GemmSelectionCache> cache = nullptr);
+
+  ~HandlePool();
+
+  HandlePool(HandlePool const &) = delete;
+  HandlePool &operator=(HandlePool const &) = delete;
+
+  /// Acquires a handle for work on `stream`, waiting until one is free
+  Lease acquire(cudaStream_t stream = nullptr);
+
+  /// Acquires a handle for work on `stream` if one is free, or returns an empty lease
+  Lease try_acquire(cudaStream_t stream = nullptr);
+
+  /// Number of handles in the pool
+  int size() const;
+
+  /// Size of the workspace slice of each handle in bytes
+  size_t get_workspace_slice_size() const;
+
+  /// Cache of selected GEMM operations shared by the handles
+  std::shared_ptr<GemmSelectionCache> get_gemm_selection_cache() const;
+
+private:
+
+  /// Binds a handle taken from the free list to a stream
+  Lease lease_(int index, cudaStream_t stream);
+
+  /// Returns a handle to the free list
+  void release_(int index);
+
+  std::vector<HandlePtr> handles_;
+  std::vector<int> free_handles_;
+  void *workspace_{nullptr};
+  size_t workspace_slice_size_{0};
+  int device_idx_{0};
+  std::shared_ptr<GemmSelectionCache> gemm_selection_cache_;
+
+  std::mutex mutex_;
+  std::condition_variable handle_available_;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 /// Finds conv2d operation instances with Conv2d::ElementC = Reduction::ElementWorkspace
 Operation const* find_conv_operation_for_parallel_reduction(Operation const *operation);
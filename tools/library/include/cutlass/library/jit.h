@@ -0,0 +1,136 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*
+  \file
+  \brief Runtime generation and compilation of CUTLASS 3.x GEMM kernels with NVRTC.
+
+  A JitGemmSpec names the kernel the way the library generator does: operand types, layouts and
+  alignments, the CTA tile, the cluster shape and the kernel schedule. make_jit_gemm_operation()
+  emits the CollectiveBuilder source for it, compiles it with NVRTC for the current device,
+  caches the cubin on disk under a hash of the source and compile options, and returns a
+  library::Operation accepting GemmUniversalConfiguration and GemmUniversalArguments like any
+  generated GEMM.
+
+  Kernel Params are built on the device by a small companion kernel compiled into the same
+  module, since no host compiler is available at runtime. Kernel schedules whose Params hold TMA
+  descriptors need the host driver API to build them, so only the cp.async warp-specialized
+  schedules with a non-TMA epilogue are supported for now.
+
+  Available when the library is built with CUTLASS_LIBRARY_ENABLE_JIT=ON.
+*/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cutlass/library/library.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// SM90 kernel schedules the GEMM JIT can instantiate
+enum class JitGemmSchedule {
+  kCpAsyncWarpSpecialized,
+  kCpAsyncWarpSpecializedPingpong,
+  kCpAsyncWarpSpecializedCooperative,
+  kInvalid
+};
+
+/// Describes one SM90 GEMM: D = alpha * A * B + beta * C
+struct JitGemmSpec {
+
+  NumericTypeID element_A{NumericTypeID::kF16};
+  LayoutTypeID layout_A{LayoutTypeID::kRowMajor};
+  int alignment_A{8};
+
+  NumericTypeID element_B{NumericTypeID::kF16};
+  LayoutTypeID layout_B{LayoutTypeID::kColumnMajor};
+  int alignment_B{8};
+
+  NumericTypeID element_C{NumericTypeID::kF16};
+  NumericTypeID element_D{NumericTypeID::kF16};
+  LayoutTypeID layout_C{LayoutTypeID::kColumnMajor};
+  int alignment_C{8};
+
+  NumericTypeID element_accumulator{NumericTypeID::kF32};
+  NumericTypeID element_epilogue{NumericTypeID::kF32};
+
+  gemm::GemmCoord tile_shape{128, 128, 64};
+  gemm::GemmCoord cluster_shape{1, 1, 1};
+
+  JitGemmSchedule schedule{JitGemmSchedule::kCpAsyncWarpSpecializedCooperative};
+};
+
+/// Controls how JIT kernels are compiled and cached
+struct JitCompileOptions {
+
+  /// Directories holding the CUTLASS, cute and CUDA headers. Defaults to the directories the
+  /// library was configured with.
+  std::vector<std::string> include_paths;
+
+  /// Directory cubins are cached in. Caching is disabled when empty.
+  std::string cache_dir;
+
+  /// Compute capability to compile for. Zero selects the current device.
+  int compute_capability{0};
+
+  /// Additional NVRTC options, e.g. "-lineinfo"
+  std::vector<std::string> extra_options;
+
+  JitCompileOptions();
+};
+
+/// Returns the CUTLASS source emitted for a spec
+std::string emit_jit_gemm_source(JitGemmSpec const &spec);
+
+/// Returns the operation name of a spec, following the library's kernel naming
+std::string jit_gemm_operation_name(JitGemmSpec const &spec);
+
+/// Compiles the spec, or loads it from the cubin cache, and returns an operation running it.
+/// On failure, `log` receives the NVRTC or driver diagnostics when it is non-null.
+Status make_jit_gemm_operation(
+  std::unique_ptr<Operation> &operation,
+  JitGemmSpec const &spec,
+  JitCompileOptions const &options = JitCompileOptions(),
+  std::string *log = nullptr);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
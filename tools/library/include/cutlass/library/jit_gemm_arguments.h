@@ -0,0 +1,102 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*
+  \file
+  \brief Plain structures exchanged between the host and kernels compiled at runtime by the
+        GEMM JIT (see cutlass/library/jit.h).
+
+  This header is compiled both by the host compiler and by NVRTC, so it must not include any
+  other header. Pointers and 64-bit integers are spelled with builtin types for that reason.
+*/
+
+#pragma once
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Problem and operands of one JIT GEMM launch. Mirrors GemmUniversalArguments with the scalars
+/// widened to double so that the same structure serves every epilogue compute type.
+struct JitGemmKernelArguments {
+  int m;
+  int n;
+  int k;
+  int batch_count;
+
+  void const *A;
+  void const *B;
+  void const *C;
+  void *D;
+
+  long long lda;
+  long long ldb;
+  long long ldc;
+  long long ldd;
+
+  long long batch_stride_A;
+  long long batch_stride_B;
+  long long batch_stride_C;
+  long long batch_stride_D;
+
+  /// Host scalars, used when the pointers below are null
+  double alpha;
+  double beta;
+
+  /// Device scalars of the epilogue compute type
+  void const *alpha_ptr;
+  void const *beta_ptr;
+
+  int sm_count;
+  int raster_order;     ///< 0: heuristic, 1: along N, 2: along M
+  int swizzle_size;
+};
+
+/// Results written by the query and params kernels of a JIT GEMM module
+struct JitGemmKernelQuery {
+  int status;                           ///< cutlass::Status of can_implement()
+  int shared_storage_size;
+  int max_threads_per_block;
+  int grid_x;
+  int grid_y;
+  int grid_z;
+  unsigned long long workspace_size;    ///< Kernel workspace, excluding the JIT params scratch
+  unsigned long long params_size;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
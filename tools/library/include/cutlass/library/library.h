@@ -78,6 +78,39 @@ using GemmUniversalMode = cutlass::gemm::GemmUniversalMode;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Sizes of the buffers used to compress the dense A operand of a structured-sparse GEMM
+struct SparseGemmCompressionSizes {
+  uint64_t tensor_a_compressed_bytes{0};  /// compressed A operand
+  uint64_t tensor_e_bytes{0};             /// metadata (E) operand
+  uint64_t workspace_bytes{0};            /// device workspace of the compressor
+};
+
+/// Resources used by the compiled kernel of an operation, as reported by cudaFuncGetAttributes
+struct KernelResourceUsage {
+  int registers_per_thread{0};
+  uint64_t local_bytes_per_thread{0};   /// local memory, nonzero when the kernel spills
+  uint64_t static_smem_bytes{0};
+  uint64_t dynamic_smem_bytes{0};       /// dynamic shared memory requested at launch
+  int max_threads_per_block{0};         /// limit imposed by the register and smem usage
+  int threads_per_block{0};             /// block size the kernel is launched with
+  int max_active_blocks_per_sm{0};      /// occupancy on the current device
+
+  /// True if registers were spilled to local memory
+  bool spills() const {
+    return local_bytes_per_thread > 0;
+  }
+};
+
+/// Arguments for compressing the dense A operand of a structured-sparse GEMM
+struct SparseGemmCompressionArguments {
+  void const *A{nullptr};        /// dense A operand; every group must satisfy the sparsity pattern
+  void *A_compressed{nullptr};   /// compressed A operand
+  void *E{nullptr};              /// metadata (E) operand
+  int sm_count{0};               /// SMs the compressor may use; zero queries the device
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Base class for all operations
 class Operation {
 public:
@@ -119,6 +152,31 @@ public:
     void *device_workspace = nullptr,
     cudaStream_t stream = nullptr) const = 0;
 
+  /// Gets the registers, local memory, shared memory and occupancy of the kernel on the current device
+  virtual Status get_kernel_resource_usage(
+    KernelResourceUsage *usage) const {
+    return Status::kErrorNotSupported;
+  }
+
+  /// Structured-sparse GEMMs consuming a compressed A operand: gets the buffer sizes needed to
+  /// compress a dense A for `configuration`
+  virtual Status get_compression_sizes(
+    void const *configuration,
+    SparseGemmCompressionSizes *sizes) const {
+    return Status::kErrorNotSupported;
+  }
+
+  /// Structured-sparse GEMMs consuming a compressed A operand: compresses a dense A into the
+  /// operand and metadata layouts the operation expects. `device_workspace` holds at least
+  /// SparseGemmCompressionSizes::workspace_bytes.
+  virtual Status compress(
+    void const *configuration,
+    SparseGemmCompressionArguments const *arguments,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const {
+    return Status::kErrorNotSupported;
+  }
+
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -312,6 +370,35 @@ struct GemmUniversalArguments {
   int device_index{0};
   
   bool use_pdl{false};
+
+  // Restricts 3.x kernels to a deterministic K reduction whose order depends on neither M nor the
+  // SM count (see GemmUniversalAdapter::make_deterministic_arguments)
+  bool deterministic{false};
+
+  // Group-wise dequantization of the narrow operand of mixed-input kernels using
+  // MathOperationID::kMultiplyAddMixedInputUpcastGroupwise. Scales and zero-points are
+  // (K / group_size) x N for a narrow B (x M for a narrow A). Null scales disable dequantization.
+  void const *scale{nullptr};
+  void const *zero{nullptr};
+  int64_t ld_scale{0};
+  int64_t batch_stride_scale{0};
+  int group_size{0};
+
+  // Operands of fused 3.x epilogues (see GemmDescription::epilogue_fusion). The per-row bias has M
+  // elements per batch, and the auxiliary output the extent and layout of D. Scale factors and amax
+  // outputs are device-resident scalars of the epilogue compute type. Null operands are not fused.
+  void const *bias{nullptr};
+  int64_t batch_stride_bias{0};
+  void *aux{nullptr};
+  int64_t ld_aux{0};
+  int64_t batch_stride_aux{0};
+  void const *scale_a{nullptr};
+  void const *scale_b{nullptr};
+  void const *scale_c{nullptr};
+  void const *scale_d{nullptr};
+  void const *scale_aux{nullptr};
+  void *amax_d{nullptr};
+  void *amax_aux{nullptr};
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,6 +40,10 @@
 #include <list>
 #include <memory>
 #include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +64,25 @@ void initialize_all(Manifest &manifest);
 // init and insert all reduction op in manifest object (manually instantiated in library/reduction)
 void initialize_all_reduction_op(Manifest &manifest);
 
+// hand the static operation index to the manifest object (procedurally generated using generator.py)
+void initialize_all_index(Manifest &manifest);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Entry of the static operation index emitted by the generator. Each entry names one operation
+/// and the generated function which constructs it, together with the rest of its configuration.
+struct ManifestIndexEntry {
+
+  /// Kind of the operation
+  OperationKind kind;
+
+  /// Procedural name of the operation (matches OperationDescription::name)
+  char const *name;
+
+  /// Generated initializer appending every operation of the configuration to a manifest
+  void (*initialize)(Manifest &manifest);
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// List of operations
@@ -75,7 +98,34 @@ private:
   Provider provider_;
 
   /// Global list of operations
-  OperationVector operations_;
+  mutable OperationVector operations_;
+
+  /// Static operation index supplied by initialize_all_index()
+  ManifestIndexEntry const *index_ = nullptr;
+
+  /// Number of entries in the static operation index
+  size_t index_count_ = 0;
+
+  /// Maps operation names to entries of the static operation index
+  std::unordered_map<std::string, ManifestIndexEntry const *> index_by_name_;
+
+  /// Maps names of constructed operations to their position in operations_
+  mutable std::unordered_map<std::string, size_t> operations_by_name_;
+
+  /// Configuration initializers which have already run
+  mutable std::set<void (*)(Manifest &)> initialized_;
+
+  /// True once every entry of the index has been constructed
+  mutable bool materialized_ = false;
+
+  /// Guards on-demand construction
+  mutable std::recursive_mutex mutex_;
+
+  /// Runs a configuration initializer if it has not run yet
+  void initialize_configuration_(void (*initialize)(Manifest &)) const;
+
+  /// Constructs every operation of the index which has not been constructed yet
+  void materialize_() const;
 
 public:
   Manifest (Provider provider = library::Provider::kCUTLASS) : provider_(provider) { }
@@ -83,6 +133,24 @@ public:
   /// Top-level initialization
   Status initialize();
 
+  /// Top-level initialization which only records the static operation index. Generated
+  /// operations are constructed on first lookup through find(), or all at once when the
+  /// operation list is first enumerated.
+  Status initialize_lazy();
+
+  /// Used by initialize_all_index() to supply the static operation index
+  void append_index(ManifestIndexEntry const *index, size_t count);
+
+  /// Returns the static operation index (nullptr if initialized eagerly)
+  ManifestIndexEntry const *index() const { return index_; }
+
+  /// Number of entries in the static operation index
+  size_t index_count() const { return index_count_; }
+
+  /// Returns the operation with the given name, constructing its configuration if needed.
+  /// Returns nullptr if no such operation exists.
+  Operation const *find(std::string const &name) const;
+
   /// Used for initialization
   void reserve(size_t operation_count);
 
@@ -96,7 +164,7 @@ public:
     operations_.emplace_back(operation_ptr);
   }
 
-  /// Returns an iterator to the first operation
+  /// Returns the list of operations. In lazy mode, constructs all outstanding operations.
   OperationVector const &operations() const;
 
   /// Returns a const iterator
@@ -236,6 +236,11 @@ using GemmOperationVectorMap = std::map<
   std::vector<Operation const *>
 >;
 
+/// Builds the functional key under which a GEMM operation is stored in the OperationTable
+GemmFunctionalKey gemm_functional_key(GemmDescription const &desc);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Maps a GemmFunctionalKey onto a vector of Operation * objects expected to be of kind kGemm
 using GemmOperationFunctionalMap = std::unordered_map<
   GemmFunctionalKey,
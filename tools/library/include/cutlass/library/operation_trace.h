@@ -0,0 +1,185 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*
+  \file
+  \brief Instrumentation of the library run path.
+
+  When the library is built with CUTLASS_LIBRARY_ENABLE_NVTX, each call to Operation::run() is
+  wrapped in an NVTX range named after the operation and its problem shape. This links the
+  kernels seen in Nsight Systems back to library operations.
+
+  Independently of NVTX, OperationTrace counts the calls to each operation and accumulates their
+  host dispatch time and, optionally, their device time. It is enabled by the environment
+  variable CUTLASS_LIBRARY_TRACE or by OperationTrace::set_mode(), and dumped at exit when
+  enabled through the environment.
+
+    CUTLASS_LIBRARY_TRACE=calls    counts calls and host time spent in Operation::run()
+    CUTLASS_LIBRARY_TRACE=device   also records device time between events around each call
+    CUTLASS_LIBRARY_TRACE_FILE     path the registry is written to at exit (stderr by default)
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "cutlass/library/library.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// What the trace registry records
+enum class OperationTraceMode {
+  kDisabled,
+  kCalls,           ///< calls and host time spent in Operation::run()
+  kDevice           ///< additionally device time between events recorded around each call
+};
+
+/// Statistics accumulated for one operation
+struct OperationTraceStats {
+
+  /// Number of calls to Operation::run()
+  uint64_t calls{0};
+
+  /// Total host time spent in Operation::run() (ms)
+  double host_ms{0};
+
+  /// Number of calls whose device time was measured
+  uint64_t device_calls{0};
+
+  /// Total device time of the measured calls (ms)
+  double device_ms{0};
+};
+
+/// Process-wide registry of operation calls and timings
+class OperationTrace {
+public:
+
+  /// Returns the registry, configured from the environment on first use
+  static OperationTrace &get();
+
+  ~OperationTrace();
+
+  OperationTraceMode mode() const {
+    return mode_.load(std::memory_order_relaxed);
+  }
+
+  /// Enables or disables recording. Statistics recorded so far are kept.
+  void set_mode(OperationTraceMode mode);
+
+  /// Records a call. `start` and `stop` are events recorded around the call in kDevice mode, or
+  /// null. The registry takes ownership of the events.
+  void record(std::string const &name, double host_ms, cudaEvent_t start, cudaEvent_t stop);
+
+  /// Returns the statistics of every operation called so far, waiting for pending device timings
+  std::map<std::string, OperationTraceStats> stats();
+
+  /// Clears all statistics
+  void reset();
+
+  /// Writes the statistics as CSV, sorted by decreasing total time
+  void dump(std::ostream &out);
+
+private:
+
+  OperationTrace();
+
+  /// Device timing whose events may not have completed yet
+  struct PendingTiming {
+    std::string name;
+    cudaEvent_t start;
+    cudaEvent_t stop;
+  };
+
+  /// Folds completed device timings into the statistics. If `wait` is set, waits for all of them.
+  void resolve_(bool wait);
+
+  std::atomic<OperationTraceMode> mode_;
+  std::mutex mutex_;
+  std::map<std::string, OperationTraceStats> stats_;
+  std::vector<PendingTiming> pending_;
+
+  /// Path the registry is written to at exit, if it was enabled through the environment
+  bool dump_at_exit_;
+  std::string dump_path_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Scope of one call to Operation::run(). Pushes an NVTX range if the library is built with NVTX
+/// and records the call in OperationTrace if it is enabled.
+class OperationRange {
+public:
+
+  /// Range for an operation whose problem shape is not known at run time
+  OperationRange(OperationDescription const &desc, cudaStream_t stream = nullptr);
+
+  /// Range for a GEMM-like operation
+  OperationRange(
+    OperationDescription const &desc,
+    gemm::GemmCoord problem_size,
+    int batch_count = 1,
+    cudaStream_t stream = nullptr);
+
+  ~OperationRange();
+
+  OperationRange(OperationRange const &) = delete;
+  OperationRange &operator=(OperationRange const &) = delete;
+
+private:
+
+  void begin_(OperationDescription const &desc, gemm::GemmCoord const *problem_size, int batch_count);
+
+  OperationDescription const *desc_;
+  cudaStream_t stream_;
+  bool nvtx_;
+  bool traced_;
+  uint64_t start_ns_;
+  cudaEvent_t start_event_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
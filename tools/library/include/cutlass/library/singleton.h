@@ -42,7 +42,10 @@ namespace library {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Singleton instance stores a Manifest and Operation table
+/// Singleton instance stores a Manifest and Operation table.
+///
+/// The instance is constructed once, thread-safely, on the first call to get(), and is immutable
+/// afterwards: concurrent operation lookups from any number of threads read it without locking.
 class Singleton {
 public:
 
@@ -140,6 +140,8 @@ enum class OperationKind {
   kEqGemm,
   kSparseGemm,
   kReduction,
+  kGroupedGemm,     // Selects kGemm operations of GemmKind::kGrouped in the profiler
+  kDistributedGemm, // GEMMs distributed across devices, compiled into the profiler
   kInvalid
 };
 
@@ -173,6 +175,7 @@ enum class MathOperationID {
   kMultiplyAdd,
   kMultiplyAddSaturate,
   kMultiplyAddMixedInputUpcast,
+  kMultiplyAddMixedInputUpcastGroupwise,
   kMultiplyAddFastBF16,
   kMultiplyAddFastF16,
   kMultiplyAddFastF32,
@@ -236,6 +239,7 @@ enum class IteratorAlgorithmID {
   kOptimized,
   kFixedChannels,
   kFewChannels,
+  kWinograd,
   kInvalid
 };
 
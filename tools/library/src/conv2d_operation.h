@@ -40,10 +40,13 @@
 #include "cutlass/conv/kernel/default_depthwise_fprop.h"
 #include "cutlass/conv/kernel/default_conv2d_dgrad.h"
 #include "cutlass/conv/kernel/default_conv2d_wgrad.h"
+#include "cutlass/conv/kernel/default_winograd_conv2d_fprop.h"
 #include "cutlass/conv/device/implicit_gemm_convolution.h"
 #include "cutlass/conv/device/direct_convolution.h"
+#include "cutlass/conv/device/winograd_conv2d_fprop.h"
 
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 #include "cutlass/util/host_tensor.h"
 
@@ -332,6 +335,8 @@ public:
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
 
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
 
     Status status = update_arguments_(
@@ -588,6 +593,8 @@ public:
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
 
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
 
     Status status = update_arguments_(
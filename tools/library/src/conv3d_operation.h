@@ -41,6 +41,7 @@
 #include "cutlass/conv/device/implicit_gemm_convolution.h"
 
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 #include "cutlass/util/host_tensor.h"
 
@@ -323,6 +324,8 @@ public:
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
 
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
 
     Status status = update_arguments_(
@@ -36,6 +36,7 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 #include "cutlass/conv/convnd_problem_shape.hpp"
 #include "cutlass/util/packed_stride.hpp"
@@ -336,6 +337,9 @@ public:
     void* device_workspace = nullptr,
     cudaStream_t stream = nullptr) const override
   {
+
+    OperationRange range(this->description(), stream);
+
     auto status = Status::kInvalid;
 
     // The Operator doesn't appear to save the last configuration (it
@@ -471,6 +475,7 @@ private:
         fusion_args.beta = 0;
         fusion_args.alpha_ptr = static_cast<ElementCompute const *>(arguments.alpha);
         fusion_args.beta_ptr = static_cast<ElementCompute const *>(arguments.beta);
+        broadcast_scalar_ptrs_(fusion_args, 0);
 
         return Status::kSuccess;
       }
@@ -478,6 +483,19 @@ private:
         return Status::kErrorInvalidProblem;
       }
     }
+
+  private:
+    // Per-channel fusions index alpha_ptr and beta_ptr along the output channels by default,
+    // but the library passes a single device-side scalar.
+    template<class Args>
+    static auto broadcast_scalar_ptrs_(Args& fusion_args, int)
+        -> decltype(cute::get<1>(fusion_args.dAlpha) = false, cute::get<1>(fusion_args.dBeta) = false, void()) {
+      cute::get<1>(fusion_args.dAlpha) = false;
+      cute::get<1>(fusion_args.dBeta) = false;
+    }
+
+    template<class Args>
+    static void broadcast_scalar_ptrs_(Args&, long) { }
   };
 
   static Status update_operator_arguments_from_configuration(
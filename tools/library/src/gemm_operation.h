@@ -45,6 +45,7 @@
 #include "cutlass/gemm/kernel/default_gemm_planar_complex_universal.h"
 
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,6 +303,8 @@ public:
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
 
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
 
     Status status = update_arguments_(
@@ -509,6 +512,8 @@ public:
     void *host_workspace, 
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
+
+    OperationRange range(this->description(), stream);
  
     OperatorArguments args;
 
@@ -631,6 +636,18 @@ protected:
     operator_args.batch_stride_B = arguments->batch_stride_B;
     operator_args.batch_stride_C = arguments->batch_stride_C;
     operator_args.batch_stride_D = arguments->batch_stride_D;
+
+    if constexpr (platform::is_same<
+        typename Operator::MathOperator, arch::OpMultiplyAddMixedInputUpcastGroupwise>::value) {
+      operator_args.ptr_scale = arguments->scale;
+      operator_args.ptr_zero = arguments->zero;
+      operator_args.ld_scale = arguments->ld_scale;
+      operator_args.batch_stride_scale = arguments->batch_stride_scale;
+      operator_args.group_size = arguments->group_size;
+    }
+    else if (arguments->scale) {
+      return Status::kErrorNotSupported;
+    }
     
     if (arguments->use_pdl) {
       return Status::kErrorNotSupported; 
@@ -735,6 +752,9 @@ public:
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
 
+    GemmUniversalArguments const *range_args = static_cast<GemmUniversalArguments const *>(arguments_ptr);
+    OperationRange range(this->description(), range_args->problem_size, range_args->batch_count, stream);
+
     OperatorArguments args;
     
     Status status = update_arguments_(
@@ -757,6 +777,16 @@ public:
     
     return status;
   }
+
+  /// Gets the resources used by the kernel on the current device
+  virtual Status get_kernel_resource_usage(KernelResourceUsage *usage) const {
+    using GemmKernel = typename Operator::GemmKernel;
+    return query_kernel_resource_usage(
+      (void const *)Kernel2<GemmKernel>,
+      int(GemmKernel::kThreadCount),
+      sizeof(typename GemmKernel::SharedStorage),
+      usage);
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -943,6 +973,9 @@ public:
     void *host_workspace,
     void *device_workspace = nullptr,
     cudaStream_t stream = nullptr) const {
+
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
 
     Status status = update_arguments_(
@@ -1150,6 +1183,8 @@ public:
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
 
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
     
     Status status = update_arguments_(
@@ -1358,6 +1393,8 @@ public:
     void *device_workspace = nullptr,
     cudaStream_t stream = nullptr) const {
 
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
 
     Status status = update_arguments_(
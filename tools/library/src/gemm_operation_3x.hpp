@@ -37,6 +37,7 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/detail/collective.hpp"
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include <unordered_map>
@@ -47,6 +48,39 @@ namespace cutlass::library {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+/// Describes the operands of a fused epilogue from the metadata of its fusion operation
+template <class FusionOp, class = void>
+struct EpilogueFusionDescriptionMap {
+  static EpilogueFusionDescription get() {
+    return EpilogueFusionDescription{};
+  }
+};
+
+template <class FusionOp>
+struct EpilogueFusionDescriptionMap<FusionOp, cute::void_t<decltype(FusionOp::IsAuxOutSupported)>> {
+  static EpilogueFusionDescription get() {
+    EpilogueFusionDescription fusion;
+    if constexpr (FusionOp::IsPerRowBiasSupported) {
+      fusion.element_bias = NumericTypeMap<typename FusionOp::ElementBias>::kId;
+    }
+    if constexpr (FusionOp::IsAuxOutSupported) {
+      fusion.element_aux = NumericTypeMap<typename FusionOp::ElementAux>::kId;
+    }
+    if constexpr (FusionOp::IsAbsMaxSupported) {
+      fusion.element_amax = NumericTypeMap<typename FusionOp::ElementAmax>::kId;
+    }
+    fusion.has_scale_factors = FusionOp::IsScaleFactorSupported;
+    fusion.has_activation = FusionOp::IsEltActSupported;
+    return fusion;
+  }
+};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <typename Operator_>
 class GemmOperation3xBase : public Operation {
 public:
@@ -126,6 +160,8 @@ public:
     description_.split_k_mode = SplitKMode::kNone;
     description_.transform_A = ComplexTransformMap<Operator::kTransformA>::kId;
     description_.transform_B = ComplexTransformMap<Operator::kTransformB>::kId;
+    description_.epilogue_fusion =
+      detail::EpilogueFusionDescriptionMap<typename Operator::EpilogueOutputOp>::get();
   }
 
   /// Returns the description of the GEMM operation
@@ -137,6 +173,16 @@ public:
   GemmDescription const& get_gemm_description() const {
     return description_;
   }
+
+  /// Gets the resources used by the kernel on the current device
+  Status get_kernel_resource_usage(KernelResourceUsage *usage) const override {
+    using GemmKernel = typename Operator::GemmKernel;
+    return query_kernel_resource_usage(
+      (void const *)device_kernel<GemmKernel>,
+      int(GemmKernel::MaxThreadsPerBlock),
+      size_t(GemmKernel::SharedStorageSize),
+      usage);
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -215,17 +261,91 @@ protected:
     }
   };
 
+  // The operands of fused epilogues are bound when the fusion arguments have the corresponding members
+
+  template<class FusionArgs, class = void>
+  struct UpdateBiasArgs {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) { }
+  };
+
+  template<class FusionArgs>
+  struct UpdateBiasArgs<FusionArgs, cute::void_t<decltype(FusionArgs{}.bias_ptr)>> {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) {
+      fusion_args.bias_ptr = static_cast<decltype(fusion_args.bias_ptr)>(arguments.bias);
+      cute::get<2>(fusion_args.dBias) = arguments.batch_stride_bias;
+    }
+  };
+
+  template<class FusionArgs, class = void>
+  struct UpdateAuxArgs {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) { }
+  };
+
+  template<class FusionArgs>
+  struct UpdateAuxArgs<FusionArgs, cute::void_t<decltype(FusionArgs{}.aux_ptr)>> {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) {
+      fusion_args.aux_ptr = static_cast<decltype(fusion_args.aux_ptr)>(arguments.aux);
+      fusion_args.dAux = cute::make_int_tuple_from<decltype(fusion_args.dAux)>(
+        arguments.ld_aux, arguments.batch_stride_aux);
+    }
+  };
+
+  template<class FusionArgs, class = void>
+  struct UpdateScaleFactorArgs {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) { }
+  };
+
+  template<class FusionArgs>
+  struct UpdateScaleFactorArgs<FusionArgs, cute::void_t<decltype(FusionArgs{}.scale_a_ptr)>> {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) {
+      fusion_args.scale_a_ptr = static_cast<decltype(fusion_args.scale_a_ptr)>(arguments.scale_a);
+      fusion_args.scale_b_ptr = static_cast<decltype(fusion_args.scale_b_ptr)>(arguments.scale_b);
+      fusion_args.scale_c_ptr = static_cast<decltype(fusion_args.scale_c_ptr)>(arguments.scale_c);
+      fusion_args.scale_d_ptr = static_cast<decltype(fusion_args.scale_d_ptr)>(arguments.scale_d);
+    }
+  };
+
+  template<class FusionArgs, class = void>
+  struct UpdateAmaxArgs {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) { }
+  };
+
+  template<class FusionArgs>
+  struct UpdateAmaxArgs<FusionArgs, cute::void_t<decltype(FusionArgs{}.amax_D_ptr)>> {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) {
+      fusion_args.amax_D_ptr = static_cast<decltype(fusion_args.amax_D_ptr)>(arguments.amax_d);
+    }
+  };
+
+  template<class FusionArgs, class = void>
+  struct UpdateAuxScaleFactorArgs {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) { }
+  };
+
+  template<class FusionArgs>
+  struct UpdateAuxScaleFactorArgs<FusionArgs, cute::void_t<decltype(FusionArgs{}.scale_aux_ptr), decltype(FusionArgs{}.amax_aux_ptr)>> {
+    static void update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) {
+      fusion_args.scale_aux_ptr = static_cast<decltype(fusion_args.scale_aux_ptr)>(arguments.scale_aux);
+      fusion_args.amax_aux_ptr = static_cast<decltype(fusion_args.amax_aux_ptr)>(arguments.amax_aux);
+    }
+  };
+
   /// Constructs the arguments structure given the configuration and arguments
   static Status update_arguments_(
       OperatorArguments &operator_args,
       GemmUniversalArguments const *arguments) {
     Status status = Status::kSuccess;
 
-    status = UpdateFusionArgs<decltype(operator_args.epilogue.thread)>::update_(
-      operator_args.epilogue.thread, *arguments);
+    using FusionArguments = decltype(operator_args.epilogue.thread);
+    status = UpdateFusionArgs<FusionArguments>::update_(operator_args.epilogue.thread, *arguments);
     if (status != Status::kSuccess) {
       return status;
     }
+    UpdateBiasArgs<FusionArguments>::update_(operator_args.epilogue.thread, *arguments);
+    UpdateAuxArgs<FusionArguments>::update_(operator_args.epilogue.thread, *arguments);
+    UpdateScaleFactorArgs<FusionArguments>::update_(operator_args.epilogue.thread, *arguments);
+    UpdateAmaxArgs<FusionArguments>::update_(operator_args.epilogue.thread, *arguments);
+    UpdateAuxScaleFactorArgs<FusionArguments>::update_(operator_args.epilogue.thread, *arguments);
 
     // TODO: type erase Arguments structure in 3.0 GEMM
     operator_args.problem_shape = cute::make_shape(
@@ -277,6 +397,10 @@ protected:
       }
     }
 
+    if (arguments->deterministic) {
+      operator_args = Operator::make_deterministic_arguments(operator_args);
+    }
+
     return status;
   }
 
@@ -334,6 +458,9 @@ public:
       void *device_workspace = nullptr,
       cudaStream_t stream = nullptr) const override {
 
+    GemmUniversalArguments const *range_args = static_cast<GemmUniversalArguments const *>(arguments_ptr);
+    OperationRange range(this->description(), range_args->problem_size, range_args->batch_count, stream);
+
     OperatorArguments args;
     Status status = update_arguments_(args, static_cast<GemmUniversalArguments const *>(arguments_ptr));
     if (status != Status::kSuccess) {
@@ -0,0 +1,192 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*
+  \file
+  \brief Cache mapping GEMM problems onto the operation selected for them.
+*/
+
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include "cutlass/library/gemm_selection_cache.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// First line of persisted caches, identifying the format version
+char const *kGemmSelectionCacheHeader = "# cutlass gemm selection cache v1";
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+Operation const *GemmSelectionCache::find(GemmSelectionKey const &key) const {
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  if (selections_.empty()) {
+    return nullptr;
+  }
+
+  // Alignments are powers of two, so at most a handful of probes are needed
+  GemmSelectionKey probe = key;
+  for (; probe.alignment > 0; probe.alignment /= 2) {
+    auto it = selections_.find(probe);
+    if (it != selections_.end()) {
+      return it->second;
+    }
+  }
+
+  return nullptr;
+}
+
+void GemmSelectionCache::insert(GemmSelectionKey const &key, Operation const *operation) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  selections_[key] = operation;
+}
+
+void GemmSelectionCache::clear() {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  selections_.clear();
+}
+
+size_t GemmSelectionCache::size() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return selections_.size();
+}
+
+GemmSelectionCache::SelectionMap const &GemmSelectionCache::selections() const {
+  return selections_;
+}
+
+Status GemmSelectionCache::save(std::ostream &out) const {
+
+  out << kGemmSelectionCacheHeader << "\n"
+    << "# compute_capability sm_count alignment m_bucket n_bucket k_bucket operation\n";
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  for (auto const &entry : selections_) {
+    GemmSelectionKey const &key = entry.first;
+
+    out << key.compute_capability << " "
+      << key.sm_count << " "
+      << key.alignment << " "
+      << key.m_bucket << " "
+      << key.n_bucket << " "
+      << key.k_bucket << " "
+      << entry.second->description().name << "\n";
+  }
+
+  return out.good() ? Status::kSuccess : Status::kErrorInternal;
+}
+
+Status GemmSelectionCache::save(std::string const &path) const {
+
+  std::ofstream out(path);
+  if (!out.good()) {
+    return Status::kErrorInternal;
+  }
+
+  return save(out);
+}
+
+Status GemmSelectionCache::load(std::istream &in, Manifest const &manifest) {
+
+  std::string line;
+  if (!std::getline(in, line) || line != kGemmSelectionCacheHeader) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  // Index GEMM operations by name
+  std::unordered_map<std::string, Operation const *> operations_by_name;
+  for (auto const &operation : manifest) {
+    if (operation->description().kind == OperationKind::kGemm) {
+      operations_by_name[operation->description().name] = operation.get();
+    }
+  }
+
+  while (std::getline(in, line)) {
+
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::stringstream ss(line);
+    GemmSelectionKey key;
+    std::string name;
+
+    ss >> key.compute_capability >> key.sm_count >> key.alignment
+      >> key.m_bucket >> key.n_bucket >> key.k_bucket >> name;
+
+    if (ss.fail()) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    auto it = operations_by_name.find(name);
+    if (it == operations_by_name.end()) {
+      continue;
+    }
+
+    key.functional_key = gemm_functional_key(
+      static_cast<GemmDescription const &>(it->second->description()));
+
+    insert(key, it->second);
+  }
+
+  return Status::kSuccess;
+}
+
+Status GemmSelectionCache::load(std::string const &path, Manifest const &manifest) {
+
+  std::ifstream in(path);
+  if (!in.good()) {
+    return Status::kErrorInternal;
+  }
+
+  return load(in, manifest);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
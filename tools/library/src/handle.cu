@@ -32,11 +32,14 @@
 /*! \file
     \brief CUTLASS Library handle.
 */
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 #include <cstdint>
+#include <cstring>
 
 #include "cutlass/library/handle.h"
+#include "cutlass/library/gemm_selection_cache.h"
 #include "cutlass/library/singleton.h"
 #include "cutlass/library/util.h"
 
@@ -54,8 +57,14 @@ Handle::Handle(
   stream_(stream),
   workspace_(nullptr),
   workspace_size_(0),
+  workspace_capacity_(0),
+  workspace_pool_(nullptr),
+  external_workspace_(false),
   scalar_pointer_mode_(ScalarPointerMode::kHost),
-  last_operation_(nullptr) {
+  use_pdl_(false),
+  last_operation_(nullptr),
+  gemm_autotuning_(false),
+  deterministic_(false) {
 
   cudaError_t error = cudaGetDevice(&device_idx_);
   if (error != cudaSuccess) {
@@ -67,6 +76,26 @@ Handle::Handle(
     throw std::runtime_error("cudaGetDeviceProperties() failed");
   }
 
+  int pools_supported = 0;
+  error = cudaDeviceGetAttribute(&pools_supported, cudaDevAttrMemoryPoolsSupported, device_idx_);
+  if (error == cudaSuccess && pools_supported) {
+
+    // A pool private to the handle keeps released workspace memory cached, so that
+    // regrowing the workspace does not synchronize with other users of the device.
+    cudaMemPoolProps pool_props = {};
+    pool_props.allocType = cudaMemAllocationTypePinned;
+    pool_props.location.type = cudaMemLocationTypeDevice;
+    pool_props.location.id = device_idx_;
+
+    error = cudaMemPoolCreate(&workspace_pool_, &pool_props);
+    if (error != cudaSuccess) {
+      throw std::runtime_error("cudaMemPoolCreate() failed");
+    }
+
+    uint64_t release_threshold = UINT64_MAX;
+    cudaMemPoolSetAttribute(workspace_pool_, cudaMemPoolAttrReleaseThreshold, &release_threshold);
+  }
+
   set_workspace_size(workspace_size);
 
   Singleton::get();
@@ -74,19 +103,32 @@ Handle::Handle(
 
 /// Destructor
 Handle::~Handle() {
-  if (workspace_) {
+  release_resources_();
+}
+
+/// Releases the device workspace and its memory pool on the handle's device, ordered on the
+/// current stream
+void Handle::release_resources_() {
+  if (workspace_ || workspace_pool_) {
 
     int device_before;
     cudaGetDevice(&device_before);
     if (device_before != device_idx_) {
       cudaSetDevice(device_idx_);
     }
-    cudaFree(workspace_);
+
+    free_workspace_();
+
+    // Resources of the pool are released once outstanding stream-ordered frees complete
+    if (workspace_pool_) {
+      cudaMemPoolDestroy(workspace_pool_);
+      workspace_pool_ = nullptr;
+    }
+
     if (device_before != device_idx_) {
       cudaSetDevice(device_before);
     }
 
-    workspace_ = nullptr;
     workspace_size_ = 0;
   }
 }
@@ -99,26 +141,53 @@ Handle::Handle(Handle && handle) {
   }
   device_ = handle.device_;
   workspace_size_ = handle.workspace_size_;
+  workspace_capacity_ = handle.workspace_capacity_;
   workspace_ = handle.workspace_;
+  workspace_pool_ = handle.workspace_pool_;
+  external_workspace_ = handle.external_workspace_;
   stream_ = handle.stream_;
   scalar_pointer_mode_ = handle.scalar_pointer_mode_;
+  use_pdl_ = handle.use_pdl_;
+  gemm_selection_cache_ = std::move(handle.gemm_selection_cache_);
+  gemm_autotuning_ = handle.gemm_autotuning_;
+  deterministic_ = handle.deterministic_;
 
   handle.workspace_ = nullptr;
   handle.workspace_size_ = 0;
+  handle.workspace_capacity_ = 0;
+  handle.workspace_pool_ = nullptr;
+  handle.external_workspace_ = false;
 }
 
 /// Move assignment operator
 Handle & Handle::operator=(Handle && handle) {
 
+  if (this == &handle) {
+    return *this;
+  }
+
+  // The target owns the workspace and pool created by its constructor
+  release_resources_();
+
   provider_ = handle.provider_;
   device_ = handle.device_;
   workspace_size_ = handle.workspace_size_;
+  workspace_capacity_ = handle.workspace_capacity_;
   workspace_ = handle.workspace_;
+  workspace_pool_ = handle.workspace_pool_;
+  external_workspace_ = handle.external_workspace_;
   stream_ = handle.stream_;
   scalar_pointer_mode_ = handle.scalar_pointer_mode_;
+  use_pdl_ = handle.use_pdl_;
+  gemm_selection_cache_ = std::move(handle.gemm_selection_cache_);
+  gemm_autotuning_ = handle.gemm_autotuning_;
+  deterministic_ = handle.deterministic_;
 
   handle.workspace_ = nullptr;
   handle.workspace_size_ = 0;
+  handle.workspace_capacity_ = 0;
+  handle.workspace_pool_ = nullptr;
+  handle.external_workspace_ = false;
 
   device_idx_ = handle.device_idx_;
 
@@ -131,6 +200,18 @@ int Handle::compute_capability() const {
 
 /// Sets the current CUDA stream
 void Handle::set_stream(cudaStream_t stream) {
+
+  // The workspace is reused by work on the new stream, so order it after work already
+  // enqueued on the previous stream.
+  if (workspace_ && stream != stream_) {
+    cudaEvent_t event;
+    if (cudaEventCreateWithFlags(&event, cudaEventDisableTiming) == cudaSuccess) {
+      cudaEventRecord(event, stream_);
+      cudaStreamWaitEvent(stream, event, 0);
+      cudaEventDestroy(event);
+    }
+  }
+
   stream_ = stream;
 }
 
@@ -167,35 +248,129 @@ void Handle::set_workspace_size(size_t bytes) {
     cudaSetDevice(device_idx_);
   }
 
-  if (bytes != workspace_size_) {
+  Status status = grow_workspace_(bytes);
+  workspace_size_ = bytes;
 
-    if (workspace_) {
-      cudaFree(workspace_);
+  if (status == Status::kSuccess && workspace_) {
+    if (cudaMemsetAsync(workspace_, 0, workspace_size_, stream_) != cudaSuccess) {
+      status = Status::kErrorInternal;
     }
+  }
 
-    workspace_ = nullptr;
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_before);
+  }
+
+  if (status == Status::kErrorMemoryAllocation) {
+    throw std::runtime_error("Failed to allocate workspace");
+  }
+  if (status == Status::kErrorWorkspaceNull) {
+    throw std::runtime_error("Workspace size exceeds the external workspace");
+  }
+  if (status != Status::kSuccess) {
+    throw std::runtime_error("Failed to clear workspace");
+  }
+}
+
+/// Runs operations on a caller-owned device workspace
+void Handle::set_external_workspace(void *workspace, size_t bytes) {
+
+  if (!external_workspace_) {
+    free_workspace_();
+  }
+
+  if (workspace) {
+    workspace_ = workspace;
     workspace_size_ = bytes;
+    workspace_capacity_ = bytes;
+    external_workspace_ = true;
+  }
+  else {
+    workspace_ = nullptr;
+    workspace_size_ = 0;
+    workspace_capacity_ = 0;
+    external_workspace_ = false;
+  }
+}
 
-    if (workspace_size_) {
+/// Grows the device workspace allocation to hold at least `bytes`, ordered on the current stream
+Status Handle::grow_workspace_(size_t bytes) {
 
-      cudaError_t error = cudaMalloc((void **)&workspace_, workspace_size_);
+  if (bytes <= workspace_capacity_) {
+    return Status::kSuccess;
+  }
 
-      if (error != cudaSuccess) {
-        throw std::runtime_error("Failed to allocate workspace");
-      }
-    }
+  if (external_workspace_) {
+    return Status::kErrorWorkspaceNull;
   }
 
-  if (workspace_) {
-    cudaError_t error = cudaMemset(workspace_, 0, workspace_size_);
+  // Grow geometrically so that a sequence of increasing requests reallocates only a
+  // logarithmic number of times
+  size_t capacity = std::max(bytes, 2 * workspace_capacity_);
 
-    if (error != cudaSuccess) {
-      throw std::runtime_error("Failed to clear workspace");
+  free_workspace_();
+
+  cudaError_t error;
+  if (workspace_pool_) {
+    error = cudaMallocFromPoolAsync(&workspace_, capacity, workspace_pool_, stream_);
+  }
+  else {
+    error = cudaMalloc(&workspace_, capacity);
+  }
+
+  if (error != cudaSuccess) {
+    workspace_ = nullptr;
+    return Status::kErrorMemoryAllocation;
+  }
+
+  workspace_capacity_ = capacity;
+  return Status::kSuccess;
+}
+
+/// Ensures the device workspace holds at least `bytes` and asynchronously clears them on
+/// the current stream ahead of an operation
+Status Handle::prepare_workspace_(size_t bytes) {
+
+  if (bytes == 0) {
+    return Status::kSuccess;
+  }
+
+  int device_before;
+  cudaGetDevice(&device_before);
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_idx_);
+  }
+
+  Status status = grow_workspace_(bytes);
+
+  if (status == Status::kSuccess) {
+    workspace_size_ = std::max(workspace_size_, bytes);
+
+    if (cudaMemsetAsync(workspace_, 0, bytes, stream_) != cudaSuccess) {
+      status = Status::kErrorInternal;
     }
   }
+
   if (device_before != device_idx_) {
     cudaSetDevice(device_before);
   }
+
+  return status;
+}
+
+/// Releases the device workspace allocation, ordered on the current stream
+void Handle::free_workspace_() {
+  if (workspace_ && !external_workspace_) {
+    if (workspace_pool_) {
+      cudaFreeAsync(workspace_, stream_);
+    }
+    else {
+      cudaFree(workspace_);
+    }
+  }
+
+  workspace_ = nullptr;
+  workspace_capacity_ = 0;
 }
 
 /// Gets the scalar pointer mode
@@ -208,11 +383,68 @@ void Handle::set_scalar_pointer_mode(ScalarPointerMode mode) {
   scalar_pointer_mode_ = mode;
 }
 
+/// Gets whether kernels are launched with programmatic dependent launch
+bool Handle::get_use_pdl() const {
+  return use_pdl_;
+}
+
+/// Enables programmatic dependent launch for subsequent operations
+void Handle::set_use_pdl(bool use_pdl) {
+  use_pdl_ = use_pdl;
+}
+
 /// Gets the last operation
 Operation const *Handle::get_last_operation() const {
   return last_operation_;
 }
 
+/// Sets the cache of selected GEMM operations
+void Handle::set_gemm_selection_cache(std::shared_ptr<GemmSelectionCache> cache) {
+  gemm_selection_cache_ = std::move(cache);
+}
+
+/// Gets the cache of selected GEMM operations
+std::shared_ptr<GemmSelectionCache> Handle::get_gemm_selection_cache() const {
+  return gemm_selection_cache_;
+}
+
+/// Loads a GEMM selection table and uses it as the selection cache
+Status Handle::load_gemm_selection_cache(std::string const &path) {
+
+  auto cache = std::make_shared<GemmSelectionCache>();
+
+  Status status = cache->load(path, Singleton::get().manifest);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  gemm_selection_cache_ = std::move(cache);
+  return Status::kSuccess;
+}
+
+/// Enables autotuning of GEMM problems missing from the selection cache
+void Handle::set_gemm_autotuning(bool enabled) {
+  gemm_autotuning_ = enabled;
+  if (gemm_autotuning_ && !gemm_selection_cache_) {
+    gemm_selection_cache_ = std::make_shared<GemmSelectionCache>();
+  }
+}
+
+/// Returns whether GEMM autotuning is enabled
+bool Handle::get_gemm_autotuning() const {
+  return gemm_autotuning_;
+}
+
+/// Enables deterministic, batch-invariant GEMMs
+void Handle::set_deterministic(bool enabled) {
+  deterministic_ = enabled;
+}
+
+/// Returns whether deterministic GEMMs are enabled
+bool Handle::get_deterministic() const {
+  return deterministic_;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Returns the maximum required alignment for each operator
@@ -303,6 +535,23 @@ static int gemm_problem_alignment(
   return 0;
 }
 
+/// Returns true if the operation may compute problems matching the preference key
+static bool satisfies_gemm_preference(
+  Operation const *op,
+  GemmPreferenceKey const &preference_key) {
+
+  GemmDescription const &desc = static_cast<GemmDescription const &>(op->description());
+
+  int min_cc = desc.tile_description.minimum_compute_capability;
+  int max_cc = desc.tile_description.maximum_compute_capability;
+
+  int op_alignment = maximum_alignment_requirement(desc);
+
+  return (min_cc <= preference_key.compute_capability) &&
+    (preference_key.compute_capability <= max_cc) &&
+    (op_alignment <= preference_key.alignment);
+}
+
 /// Find the best kernel in descending order of preference.
 static Operation const * find_gemm_operation(
   GemmOperationFunctionalMap::const_iterator operators_it,
@@ -322,25 +571,151 @@ static Operation const * find_gemm_operation(
 
     // Search tile sizes in order, for now.
     for (auto const * op : cc_it->second) {
+      if (satisfies_gemm_preference(op, preference_key)) {
+        operation = op;
+        break;
+      }
+    }
+  } while (!operation && cc_it != operators_it->second.begin());
 
-      GemmDescription const &desc = static_cast<GemmDescription const &>(op->description());
+  return operation;
+}
 
-      int min_cc = desc.tile_description.minimum_compute_capability;
-      int max_cc = desc.tile_description.maximum_compute_capability;
+/// Finds all kernels applicable to the preference key in descending order of preference.
+static std::vector<Operation const *> find_gemm_candidates(
+  GemmOperationFunctionalMap::const_iterator operators_it,
+  GemmPreferenceKey const preference_key) {
 
-      int op_alignment = maximum_alignment_requirement(desc);
+  std::vector<Operation const *> candidates;
 
-      if ((min_cc <= preference_key.compute_capability) &&
-        (preference_key.compute_capability <= max_cc) &&
-        (op_alignment <= preference_key.alignment)) {
+  auto cc_it = operators_it->second.upper_bound(preference_key);
 
-        operation = op;
-        break;
+  while (cc_it != operators_it->second.begin()) {
+    --cc_it;
+
+    for (auto const * op : cc_it->second) {
+      if (satisfies_gemm_preference(op, preference_key)) {
+        candidates.push_back(op);
       }
     }
-  } while (!operation && cc_it != operators_it->second.begin());
+  }
 
-  return operation;
+  return candidates;
+}
+
+/// Selects the operation used for a GEMM problem
+Operation const *Handle::select_gemm_operation_(
+  GemmFunctionalKey const &functional_key,
+  GemmPreferenceKey const &preference_key,
+  int M,
+  int N,
+  int K,
+  void const *configuration,
+  void const *arguments,
+  bool allow_autotuning) {
+
+  auto operators_it = Singleton::get().operation_table.gemm_operations.find(functional_key);
+
+  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+    return nullptr;
+  }
+
+  // Cached and autotuned selections depend on M, which would change the reduction order across batches
+  if (gemm_selection_cache_ && !deterministic_) {
+
+    GemmSelectionKey selection_key = GemmSelectionKey::from_problem(
+      functional_key,
+      preference_key.compute_capability,
+      device_.multiProcessorCount,
+      preference_key.alignment,
+      M, N, K);
+
+    Operation const *operation = gemm_selection_cache_->find(selection_key);
+
+    // Buckets span a range of extents, so the cached operation is only a candidate
+    if (operation && operation->can_implement(configuration, arguments) == Status::kSuccess) {
+      return operation;
+    }
+
+    if (gemm_autotuning_ && allow_autotuning) {
+      operation = autotune_gemm_operation_(
+        find_gemm_candidates(operators_it, preference_key), configuration, arguments);
+
+      if (operation) {
+        gemm_selection_cache_->insert(selection_key, operation);
+        return operation;
+      }
+    }
+  }
+
+  return find_gemm_operation(operators_it, preference_key);
+}
+
+/// Runs each candidate operation on the problem and returns the fastest one
+Operation const *Handle::autotune_gemm_operation_(
+  std::vector<Operation const *> const &candidates,
+  void const *configuration,
+  void const *arguments) {
+
+  int const kIterations = 3;
+
+  cudaEvent_t events[2];
+  for (auto &event : events) {
+    if (cudaEventCreate(&event) != cudaSuccess) {
+      return nullptr;
+    }
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  Operation const *best_operation = nullptr;
+  float best_runtime = 0;
+
+  for (auto const *op : candidates) {
+
+    if (op->can_implement(configuration, arguments) != Status::kSuccess) {
+      continue;
+    }
+
+    if (uint64_t(kHostWorkspaceSize) < op->get_host_workspace_size(configuration)) {
+      continue;
+    }
+
+    if (prepare_workspace_(op->get_device_workspace_size(configuration, arguments)) != Status::kSuccess) {
+      continue;
+    }
+
+    if (op->initialize(configuration, host_workspace, workspace_, stream_) != Status::kSuccess) {
+      continue;
+    }
+
+    // Warm up
+    Status status = op->run(arguments, host_workspace, workspace_, stream_);
+
+    cudaEventRecord(events[0], stream_);
+    for (int iteration = 0; iteration < kIterations && status == Status::kSuccess; ++iteration) {
+      status = op->run(arguments, host_workspace, workspace_, stream_);
+    }
+    cudaEventRecord(events[1], stream_);
+
+    float runtime = 0;
+    if (cudaEventSynchronize(events[1]) != cudaSuccess ||
+        cudaEventElapsedTime(&runtime, events[0], events[1]) != cudaSuccess ||
+        status != Status::kSuccess) {
+      continue;
+    }
+
+    if (!best_operation || runtime < best_runtime) {
+      best_operation = op;
+      best_runtime = runtime;
+    }
+  }
+
+  for (auto &event : events) {
+    cudaEventDestroy(event);
+  }
+
+  return best_operation;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -421,28 +796,15 @@ Status Handle::gemm(
   // Maximum alignment expectation among all kernels (in units of bytes)
   int const kMaximumAlignmentSize = 16;
 
+  // In deterministic mode the operation must not depend on M, so M does not constrain the alignment
   int alignment = gemm_problem_alignment(
-    M, N, K,
+    deterministic_ ? 0 : M, N, K,
     element_A, ptr_A, lda, 0,
     element_B, ptr_B, ldb, 0,
     element_C, ptr_C, ldc, 0,
     ptr_D, ldd, 0, kMaximumAlignmentSize
   );
 
-  //
-  // Find the best kernel in descending order of preference.
-  //
-
-  GemmPreferenceKey preference_key(compute_capability(), alignment);
-
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
-
-  if (!operation) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
-  last_operation_ = operation;
-
   //
   // Configure operation
   //
@@ -456,6 +818,42 @@ Status Handle::gemm(
     1
   };
 
+  GemmArguments arguments{
+    ptr_A,
+    ptr_B,
+    ptr_C,
+    ptr_D,
+    alpha,
+    beta,
+    scalar_pointer_mode_
+  };
+
+  arguments.use_pdl = use_pdl_;
+
+  //
+  // Find the best kernel in descending order of preference.
+  //
+
+  GemmPreferenceKey preference_key(compute_capability(), alignment);
+
+  // Autotuning overwrites D, which is only safe if D does not alias C
+  bool allow_autotuning = (ptr_C != ptr_D);
+
+  Operation const *operation = select_gemm_operation_(
+    key, preference_key, M, N, K, &configuration, &arguments, allow_autotuning);
+
+  if (!operation) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Deterministic mode selects the operation without regard to M, so an M it cannot implement is
+  // rejected instead of falling back to another kernel with a different reduction order
+  if (deterministic_ && operation->can_implement(&configuration, &arguments) != Status::kSuccess) {
+    return cutlass::Status::kErrorMisalignedOperand;
+  }
+
+  last_operation_ = operation;
+
   // Query host work space size
   uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
 
@@ -468,8 +866,11 @@ Status Handle::gemm(
   // Query device workspace size
   uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
 
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
-    return cutlass::Status::kErrorNotSupported;
+  // Grow the workspace if needed and clear the bytes this operation uses
+  Status workspace_status = prepare_workspace_(device_workspace_size_needed);
+
+  if (workspace_status != cutlass::Status::kSuccess) {
+    return workspace_status;
   }
 
   // Initialize host and device workspaces
@@ -484,16 +885,6 @@ Status Handle::gemm(
   }
 
   // Run the operator
-  GemmArguments arguments{
-    ptr_A,
-    ptr_B,
-    ptr_C,
-    ptr_D,
-    alpha,
-    beta,
-    scalar_pointer_mode_
-  };
-
   return operation->run(&arguments, host_workspace, workspace_, stream_);
 }
 
@@ -600,28 +991,15 @@ Status Handle::gemm_universal(
     ptr_D_check = nullptr;
   }
 
+  // In deterministic mode the operation must not depend on M, so M does not constrain the alignment
   int alignment = gemm_problem_alignment(
-    M, N, K,
+    deterministic_ ? 0 : M, N, K,
     element_A, ptr_A_check, lda, 0,
     element_B, ptr_B_check, ldb, 0,
     element_C, ptr_C_check, ldc, 0,
     ptr_D_check, ldd, 0, kMaximumAlignmentSize
   );
 
-  //
-  // Find the best kernel in descending order of preference.
-  //
-
-  GemmPreferenceKey preference_key(compute_capability(), alignment);
-
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
-
-  if (!operation) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
-  last_operation_ = operation;
-
   //
   // Configure operation
   //
@@ -636,15 +1014,6 @@ Status Handle::gemm_universal(
     ldd
   };
 
-  // Query host work space size
-  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
-
-  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
-  char host_workspace[kHostWorkspaceSize];
-
   GemmUniversalArguments arguments{
     {M, N, K},
     batch_count,
@@ -665,11 +1034,51 @@ Status Handle::gemm_universal(
     batch_stride_D
   };
 
+  arguments.use_pdl = use_pdl_;
+  arguments.deterministic = deterministic_;
+
+  //
+  // Find the best kernel in descending order of preference.
+  //
+
+  GemmPreferenceKey preference_key(compute_capability(), alignment);
+
+  // Autotuning overwrites D, which is only safe if D does not alias C. Aliasing of
+  // individual batches cannot be checked from the host in array mode.
+  bool allow_autotuning = (ptr_C != ptr_D) && (mode != GemmUniversalMode::kArray);
+
+  Operation const *operation = select_gemm_operation_(
+    key, preference_key, M, N, K, &configuration, &arguments, allow_autotuning);
+
+  if (!operation) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Deterministic mode selects the operation without regard to M, so an M it cannot implement is
+  // rejected instead of falling back to another kernel with a different reduction order
+  if (deterministic_ && operation->can_implement(&configuration, &arguments) != Status::kSuccess) {
+    return cutlass::Status::kErrorMisalignedOperand;
+  }
+
+  last_operation_ = operation;
+
+  // Query host work space size
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
   // Query device workspace size
   uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
 
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
-    return cutlass::Status::kErrorNotSupported;
+  // Grow the workspace if needed and clear the bytes this operation uses
+  Status workspace_status = prepare_workspace_(device_workspace_size_needed);
+
+  if (workspace_status != cutlass::Status::kSuccess) {
+    return workspace_status;
   }
 
   // Initialize host and device workspaces
@@ -690,6 +1099,323 @@ Status Handle::gemm_universal(
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Returns true if two scalars of the given type hold the same value (host pointer mode) or refer
+/// to the same location (device pointer mode)
+static bool same_scalar(
+  void const *lhs,
+  void const *rhs,
+  NumericTypeID element_scalar,
+  ScalarPointerMode mode) {
+
+  if (lhs == rhs) {
+    return true;
+  }
+  if (mode == ScalarPointerMode::kDevice || !lhs || !rhs) {
+    return false;
+  }
+  int bytes = (library::sizeof_bits(element_scalar) + 7) / 8;
+  return std::memcmp(lhs, rhs, bytes) == 0;
+}
+
+/// Returns true if two problems of a batch may execute within the same grouped GEMM kernel
+static bool gemm_batch_compatible(
+  GemmBatchProblem const &lhs,
+  GemmBatchProblem const &rhs,
+  ScalarPointerMode mode) {
+
+  return lhs.element_compute == rhs.element_compute &&
+    lhs.element_scalar == rhs.element_scalar &&
+    lhs.element_A == rhs.element_A && lhs.layout_A == rhs.layout_A && lhs.transform_A == rhs.transform_A &&
+    lhs.element_B == rhs.element_B && lhs.layout_B == rhs.layout_B && lhs.transform_B == rhs.transform_B &&
+    lhs.element_C == rhs.element_C && lhs.layout_C == rhs.layout_C &&
+    lhs.element_D == rhs.element_D && lhs.layout_D == rhs.layout_D &&
+    same_scalar(lhs.alpha, rhs.alpha, lhs.element_scalar, mode) &&
+    same_scalar(lhs.beta, rhs.beta, lhs.element_scalar, mode);
+}
+
+/// Executes a list of independent GEMMs with heterogeneous shapes
+Status Handle::gemm_batch(
+  GemmBatchProblem const *problems,
+  int problem_count,
+  int *launch_count) {
+
+  if (launch_count) {
+    *launch_count = 0;
+  }
+
+  if (problem_count <= 0) {
+    return Status::kSuccess;
+  }
+
+  if (!problems) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  // A problem whose output alone covers this many 128x128 tiles fills the device, so grouping
+  // it with others gains nothing over its dedicated kernel
+  int64_t const kStandaloneTileCount = device_.multiProcessorCount;
+
+  //
+  // Bucket problems by data types, layouts and scalars, keeping the order of first appearance
+  //
+
+  std::vector<std::vector<int>> buckets;
+  std::vector<int> standalone;
+
+  for (int idx = 0; idx < problem_count; ++idx) {
+    GemmBatchProblem const &problem = problems[idx];
+
+    int64_t tiles = int64_t((problem.M + 127) / 128) * int64_t((problem.N + 127) / 128);
+    if (tiles >= kStandaloneTileCount) {
+      standalone.push_back(idx);
+      continue;
+    }
+
+    auto bucket_it = std::find_if(buckets.begin(), buckets.end(), [&](std::vector<int> const &bucket) {
+      return gemm_batch_compatible(problems[bucket.front()], problem, scalar_pointer_mode_);
+    });
+
+    if (bucket_it == buckets.end()) {
+      buckets.push_back({idx});
+    }
+    else {
+      bucket_it->push_back(idx);
+    }
+  }
+
+  //
+  // Launch each bucket as one grouped kernel where possible
+  //
+
+  for (auto const &bucket : buckets) {
+    if (bucket.size() > 1 && gemm_grouped_(problems, bucket) == Status::kSuccess) {
+      if (launch_count) {
+        ++*launch_count;
+      }
+    }
+    else {
+      standalone.insert(standalone.end(), bucket.begin(), bucket.end());
+    }
+  }
+
+  //
+  // Remaining problems execute individually
+  //
+
+  for (int idx : standalone) {
+    GemmBatchProblem const &problem = problems[idx];
+
+    Status status = gemm_universal(
+      GemmUniversalMode::kGemm,
+      problem.M, problem.N, problem.K,
+      problem.element_compute,
+      problem.element_scalar,
+      problem.alpha,
+      problem.element_A, problem.layout_A, problem.transform_A, problem.ptr_A, problem.lda,
+      problem.element_B, problem.layout_B, problem.transform_B, problem.ptr_B, problem.ldb,
+      problem.beta,
+      problem.element_C, problem.layout_C, problem.ptr_C, problem.ldc,
+      problem.element_D, problem.layout_D, problem.ptr_D, problem.ldd);
+
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    if (launch_count) {
+      ++*launch_count;
+    }
+  }
+
+  return Status::kSuccess;
+}
+
+/// Runs a set of compatible problems from a batch as a single grouped GEMM kernel
+Status Handle::gemm_grouped_(
+  GemmBatchProblem const *problems,
+  std::vector<int> const &indices) {
+
+  GemmBatchProblem const &front = problems[indices.front()];
+
+  // Grouped kernels write D with the type and layout of C
+  if (front.element_C != front.element_D || front.layout_C != front.layout_D) {
+    return Status::kErrorNotSupported;
+  }
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kGrouped,
+    front.element_compute,
+    front.element_scalar,
+    front.element_A,
+    front.layout_A,
+    front.transform_A,
+    front.element_B,
+    front.layout_B,
+    front.transform_B,
+    front.element_C,
+    front.layout_C,
+    front.element_D,
+    front.layout_D
+  );
+
+  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+
+  if (operators_it == Singleton::get().operation_table.gemm_operations.end() ||
+      operators_it->second.empty()) {
+    return Status::kErrorNotSupported;
+  }
+
+  // The kernel must satisfy the alignment of every problem in the group
+  int const kMaximumAlignmentSize = 16;
+  int alignment = kMaximumAlignmentSize;
+
+  for (int idx : indices) {
+    GemmBatchProblem const &problem = problems[idx];
+    alignment = std::min(alignment, gemm_problem_alignment(
+      problem.M, problem.N, problem.K,
+      problem.element_A, problem.ptr_A, problem.lda, 0,
+      problem.element_B, problem.ptr_B, problem.ldb, 0,
+      problem.element_C, problem.ptr_C, problem.ldc, 0,
+      problem.ptr_D, problem.ldd, 0, kMaximumAlignmentSize));
+  }
+
+  Operation const *operation = find_gemm_operation(
+    operators_it, GemmPreferenceKey(compute_capability(), alignment));
+
+  if (!operation) {
+    return Status::kErrorNotSupported;
+  }
+
+  //
+  // Size the persistent grid from the total tile count
+  //
+
+  GemmDescription const &desc = static_cast<GemmDescription const &>(operation->description());
+  gemm::GemmCoord tile = desc.tile_description.threadblock_shape;
+  gemm::GemmCoord warps = desc.tile_description.warp_count;
+
+  int64_t total_tiles = 0;
+  for (int idx : indices) {
+    total_tiles += int64_t((problems[idx].M + tile.m() - 1) / tile.m()) *
+                   int64_t((problems[idx].N + tile.n() - 1) / tile.n());
+  }
+
+  int threads_per_block = 32 * warps.m() * warps.n() * warps.k();
+  int64_t resident_blocks = int64_t(device_.multiProcessorCount) *
+    std::max(1, device_.maxThreadsPerMultiProcessor / std::max(1, threads_per_block));
+
+  GemmGroupedConfiguration configuration{
+    int(indices.size()),
+    int(std::max<int64_t>(1, std::min(total_tiles, resident_blocks)))
+  };
+
+  //
+  // Problem descriptors are staged into the device workspace after the operation's own workspace
+  //
+
+  int problem_count = int(indices.size());
+
+  size_t const kArrayAlignment = 256;
+  size_t sizes_bytes = sizeof(gemm::GemmCoord) * problem_count;
+  size_t ptrs_bytes = sizeof(void *) * problem_count;
+  size_t lds_bytes = sizeof(int64_t) * problem_count;
+
+  auto align_up = [&](size_t offset) {
+    return (offset + kArrayAlignment - 1) / kArrayAlignment * kArrayAlignment;
+  };
+
+  size_t sizes_offset = 0;
+  size_t ptrs_offset = align_up(sizes_offset + sizes_bytes);
+  size_t lds_offset = align_up(ptrs_offset + 4 * ptrs_bytes);
+  size_t staging_bytes = lds_offset + 4 * lds_bytes;
+
+  std::vector<uint8_t> staging(staging_bytes, 0);
+
+  gemm::GemmCoord *host_sizes = reinterpret_cast<gemm::GemmCoord *>(staging.data() + sizes_offset);
+  void const **host_ptrs = reinterpret_cast<void const **>(staging.data() + ptrs_offset);
+  int64_t *host_lds = reinterpret_cast<int64_t *>(staging.data() + lds_offset);
+
+  for (int i = 0; i < problem_count; ++i) {
+    GemmBatchProblem const &problem = problems[indices[i]];
+    host_sizes[i] = gemm::GemmCoord(problem.M, problem.N, problem.K);
+    host_ptrs[0 * problem_count + i] = problem.ptr_A;
+    host_ptrs[1 * problem_count + i] = problem.ptr_B;
+    host_ptrs[2 * problem_count + i] = problem.ptr_C;
+    host_ptrs[3 * problem_count + i] = problem.ptr_D;
+    host_lds[0 * problem_count + i] = problem.lda;
+    host_lds[1 * problem_count + i] = problem.ldb;
+    host_lds[2 * problem_count + i] = problem.ldc;
+    host_lds[3 * problem_count + i] = problem.ldd;
+  }
+
+  // The operation's workspace size does not depend on the device addresses of the descriptors
+  GemmGroupedArguments arguments{
+    nullptr,
+    nullptr, nullptr, nullptr, nullptr,
+    nullptr, nullptr, nullptr, nullptr,
+    front.alpha,
+    front.beta,
+    scalar_pointer_mode_
+  };
+
+  // Grouped kernels do not support programmatic dependent launch, so use_pdl is left unset
+
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  size_t operation_workspace_bytes = align_up(operation->get_device_workspace_size(&configuration, &arguments));
+
+  Status status = prepare_workspace_(operation_workspace_bytes + staging_bytes);
+
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  uint8_t *device_staging = static_cast<uint8_t *>(workspace_) + operation_workspace_bytes;
+
+  // The copy is ordered on the stream after any prior use of the workspace
+  cudaError_t error = cudaMemcpyAsync(
+    device_staging, staging.data(), staging_bytes, cudaMemcpyHostToDevice, stream_);
+
+  if (error != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+
+  void **device_ptrs = reinterpret_cast<void **>(device_staging + ptrs_offset);
+  int64_t *device_lds = reinterpret_cast<int64_t *>(device_staging + lds_offset);
+
+  arguments.problem_sizes = reinterpret_cast<gemm::GemmCoord *>(device_staging + sizes_offset);
+  arguments.ptr_A = device_ptrs + 0 * problem_count;
+  arguments.ptr_B = device_ptrs + 1 * problem_count;
+  arguments.ptr_C = device_ptrs + 2 * problem_count;
+  arguments.ptr_D = device_ptrs + 3 * problem_count;
+  arguments.lda = device_lds + 0 * problem_count;
+  arguments.ldb = device_lds + 1 * problem_count;
+  arguments.ldc = device_lds + 2 * problem_count;
+  arguments.ldd = device_lds + 3 * problem_count;
+
+  if (operation->can_implement(&configuration, &arguments) != Status::kSuccess) {
+    return Status::kErrorNotSupported;
+  }
+
+  status = operation->initialize(&configuration, host_workspace, workspace_, stream_);
+
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  last_operation_ = operation;
+
+  return operation->run(&arguments, host_workspace, workspace_, stream_);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Planar complex GEMM
 Status Handle::gemm_planar_complex(
 
@@ -849,8 +1575,11 @@ Status Handle::gemm_planar_complex(
   // Query device workspace size
   uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
 
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
-    return cutlass::Status::kErrorNotSupported;
+  // Grow the workspace if needed and clear the bytes this operation uses
+  Status workspace_status = prepare_workspace_(device_workspace_size_needed);
+
+  if (workspace_status != cutlass::Status::kSuccess) {
+    return workspace_status;
   }
 
   // Initialize host and device workspaces
@@ -887,6 +1616,8 @@ Status Handle::gemm_planar_complex(
     batch_stride_D_imag
   };
 
+  arguments.use_pdl = use_pdl_;
+
   return operation->run(&arguments, host_workspace, workspace_, stream_);
 }
 
@@ -1045,8 +1776,11 @@ Status Handle::gemm_planar_complex_array(
   // Query device workspace size
   uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
 
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
-    return cutlass::Status::kErrorNotSupported;
+  // Grow the workspace if needed and clear the bytes this operation uses
+  Status workspace_status = prepare_workspace_(device_workspace_size_needed);
+
+  if (workspace_status != cutlass::Status::kSuccess) {
+    return workspace_status;
   }
 
   // Initialize host and device workspaces
@@ -1076,6 +1810,8 @@ Status Handle::gemm_planar_complex_array(
     scalar_pointer_mode_
   };
 
+  arguments.use_pdl = use_pdl_;
+
   return operation->run(&arguments, host_workspace, workspace_, stream_);
 }
 
@@ -1214,6 +1950,156 @@ Operation const* find_gemm_operation_for_parallel_reduction(Operation const *ope
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Creates the handles and their workspace slices on the current device
+HandlePool::HandlePool(
+  int handle_count,
+  size_t workspace_slice_size,
+  std::shared_ptr<GemmSelectionCache> cache
+):
+  gemm_selection_cache_(cache ? std::move(cache) : std::make_shared<GemmSelectionCache>()) {
+
+  if (handle_count <= 0) {
+    throw std::runtime_error("HandlePool requires at least one handle");
+  }
+
+  cudaError_t error = cudaGetDevice(&device_idx_);
+  if (error != cudaSuccess) {
+    throw std::runtime_error("cudaGetDevice() failed");
+  }
+
+  // Keep every slice aligned for the widest vectorized accesses of a kernel workspace
+  size_t const kSliceAlignment = 256;
+  workspace_slice_size_ = (workspace_slice_size + kSliceAlignment - 1) / kSliceAlignment * kSliceAlignment;
+
+  if (workspace_slice_size_) {
+    error = cudaMalloc(&workspace_, workspace_slice_size_ * handle_count);
+    if (error != cudaSuccess) {
+      throw std::runtime_error("Failed to allocate workspace");
+    }
+  }
+
+  handles_.reserve(handle_count);
+  free_handles_.reserve(handle_count);
+
+  for (int idx = 0; idx < handle_count; ++idx) {
+    handles_.emplace_back(new Handle(nullptr, 0));
+
+    if (workspace_) {
+      handles_.back()->set_external_workspace(
+        static_cast<uint8_t *>(workspace_) + idx * workspace_slice_size_, workspace_slice_size_);
+    }
+    handles_.back()->set_gemm_selection_cache(gemm_selection_cache_);
+
+    // Handles are taken from the back of the free list
+    free_handles_.push_back(handle_count - 1 - idx);
+  }
+}
+
+/// Destroys the handles and frees the workspace once work using it completes
+HandlePool::~HandlePool() {
+
+  int device_before;
+  cudaGetDevice(&device_before);
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_idx_);
+  }
+
+  handles_.clear();
+
+  if (workspace_) {
+    cudaFree(workspace_);
+    workspace_ = nullptr;
+  }
+
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_before);
+  }
+}
+
+/// Acquires a handle for work on `stream`, waiting until one is free
+HandlePool::Lease HandlePool::acquire(cudaStream_t stream) {
+
+  int index;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    handle_available_.wait(lock, [this] { return !free_handles_.empty(); });
+
+    index = free_handles_.back();
+    free_handles_.pop_back();
+  }
+
+  return lease_(index, stream);
+}
+
+/// Acquires a handle for work on `stream` if one is free
+HandlePool::Lease HandlePool::try_acquire(cudaStream_t stream) {
+
+  int index;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_handles_.empty()) {
+      return Lease();
+    }
+
+    index = free_handles_.back();
+    free_handles_.pop_back();
+  }
+
+  return lease_(index, stream);
+}
+
+/// Binds a handle taken from the free list to a stream. Work on the new stream is ordered after
+/// the work the previous lease enqueued on the handle's workspace slice.
+HandlePool::Lease HandlePool::lease_(int index, cudaStream_t stream) {
+  handles_[index]->set_stream(stream);
+  return Lease(this, index);
+}
+
+/// Returns a handle to the free list
+void HandlePool::release_(int index) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_handles_.push_back(index);
+  }
+  handle_available_.notify_one();
+}
+
+/// Number of handles in the pool
+int HandlePool::size() const {
+  return int(handles_.size());
+}
+
+/// Size of the workspace slice of each handle in bytes
+size_t HandlePool::get_workspace_slice_size() const {
+  return workspace_slice_size_;
+}
+
+/// Cache of selected GEMM operations shared by the handles
+std::shared_ptr<GemmSelectionCache> HandlePool::get_gemm_selection_cache() const {
+  return gemm_selection_cache_;
+}
+
+/// Returns the handle to the pool
+void HandlePool::Lease::release() {
+  if (pool_) {
+    pool_->release_(index_);
+    pool_ = nullptr;
+  }
+}
+
+/// Move assignment releases the handle held before
+HandlePool::Lease &HandlePool::Lease::operator=(Lease &&lease) {
+  if (this != &lease) {
+    release();
+    pool_ = lease.pool_;
+    index_ = lease.index_;
+    lease.pool_ = nullptr;
+  }
+  return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace library
 } // namespace cutlass
 
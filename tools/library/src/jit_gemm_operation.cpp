@@ -0,0 +1,807 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*
+  \file
+  \brief Runtime generation and compilation of CUTLASS 3.x GEMM kernels with NVRTC.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+#include <nvrtc.h>
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/library/jit.h"
+#include "cutlass/library/jit_gemm_arguments.h"
+#include "cutlass/library/util.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Bumped whenever the emitted source or the module interface changes, to invalidate cached cubins
+constexpr char const *kJitModuleVersion = "cutlass_jit_gemm_v1";
+
+char const *jit_type_name(NumericTypeID type) {
+  switch (type) {
+    case NumericTypeID::kF16:   return "cutlass::half_t";
+    case NumericTypeID::kBF16:  return "cutlass::bfloat16_t";
+    case NumericTypeID::kTF32:  return "cutlass::tfloat32_t";
+    case NumericTypeID::kF32:   return "float";
+    case NumericTypeID::kF64:   return "double";
+    case NumericTypeID::kFE4M3: return "cutlass::float_e4m3_t";
+    case NumericTypeID::kFE5M2: return "cutlass::float_e5m2_t";
+    case NumericTypeID::kS8:    return "int8_t";
+    case NumericTypeID::kU8:    return "uint8_t";
+    case NumericTypeID::kS32:   return "int32_t";
+    default: break;
+  }
+  return nullptr;
+}
+
+char const *jit_layout_name(LayoutTypeID layout) {
+  switch (layout) {
+    case LayoutTypeID::kColumnMajor: return "cutlass::layout::ColumnMajor";
+    case LayoutTypeID::kRowMajor:    return "cutlass::layout::RowMajor";
+    default: break;
+  }
+  return nullptr;
+}
+
+/// Layout letter used in kernel names: 't' for row-major, 'n' for column-major
+char jit_layout_letter(LayoutTypeID layout) {
+  return layout == LayoutTypeID::kRowMajor ? 't' : 'n';
+}
+
+char const *jit_schedule_name(JitGemmSchedule schedule) {
+  switch (schedule) {
+    case JitGemmSchedule::kCpAsyncWarpSpecialized:
+      return "cutlass::gemm::KernelCpAsyncWarpSpecialized";
+    case JitGemmSchedule::kCpAsyncWarpSpecializedPingpong:
+      return "cutlass::gemm::KernelCpAsyncWarpSpecializedPingpong";
+    case JitGemmSchedule::kCpAsyncWarpSpecializedCooperative:
+      return "cutlass::gemm::KernelCpAsyncWarpSpecializedCooperative";
+    default: break;
+  }
+  return nullptr;
+}
+
+char const *jit_schedule_suffix(JitGemmSchedule schedule) {
+  switch (schedule) {
+    case JitGemmSchedule::kCpAsyncWarpSpecialized:            return "cpasync_warpspecialized";
+    case JitGemmSchedule::kCpAsyncWarpSpecializedPingpong:    return "cpasync_warpspecialized_pingpong";
+    case JitGemmSchedule::kCpAsyncWarpSpecializedCooperative: return "cpasync_warpspecialized_cooperative";
+    default: break;
+  }
+  return "invalid";
+}
+
+bool is_supported(JitGemmSpec const &spec) {
+  return jit_type_name(spec.element_A) && jit_type_name(spec.element_B) &&
+         jit_type_name(spec.element_C) && jit_type_name(spec.element_D) &&
+         jit_type_name(spec.element_accumulator) && jit_type_name(spec.element_epilogue) &&
+         jit_layout_name(spec.layout_A) && jit_layout_name(spec.layout_B) && jit_layout_name(spec.layout_C) &&
+         jit_schedule_name(spec.schedule) &&
+         spec.cluster_shape.m() == 1 && spec.cluster_shape.n() == 1 && spec.cluster_shape.k() == 1;
+}
+
+/// 64-bit FNV-1a
+uint64_t hash_bytes(std::string const &bytes, uint64_t hash = 0xcbf29ce484222325ull) {
+  for (unsigned char c : bytes) {
+    hash ^= c;
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+std::vector<std::string> split_paths(std::string const &paths) {
+  std::vector<std::string> result;
+  std::stringstream ss(paths);
+  std::string path;
+  while (std::getline(ss, path, ';')) {
+    if (!path.empty()) {
+      result.push_back(path);
+    }
+  }
+  return result;
+}
+
+int current_compute_capability() {
+  int device = 0;
+  int major = 0;
+  int minor = 0;
+  if (cudaGetDevice(&device) != cudaSuccess ||
+      cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device) != cudaSuccess ||
+      cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device) != cudaSuccess) {
+    return 0;
+  }
+  return major * 10 + minor;
+}
+
+bool read_file(std::string const &path, std::vector<char> &bytes) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.good()) {
+    return false;
+  }
+  bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  return !bytes.empty();
+}
+
+/// Writes through a temporary file so that concurrent processes never observe a partial cubin
+void write_file(std::string const &path, std::vector<char> const &bytes) {
+  std::string tmp_path = path + ".tmp" +
+    std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+  {
+    std::ofstream out(tmp_path, std::ios::binary);
+    if (!out.good()) {
+      return;
+    }
+    out.write(bytes.data(), std::streamsize(bytes.size()));
+  }
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+  }
+}
+
+Status compile_cubin(
+  std::string const &source,
+  std::string const &name,
+  std::vector<std::string> const &options,
+  std::vector<char> &cubin,
+  std::string *log) {
+
+  nvrtcProgram program;
+  if (nvrtcCreateProgram(&program, source.c_str(), (name + ".cu").c_str(), 0, nullptr, nullptr) != NVRTC_SUCCESS) {
+    return Status::kErrorInternal;
+  }
+
+  std::vector<char const *> option_ptrs;
+  for (auto const &option : options) {
+    option_ptrs.push_back(option.c_str());
+  }
+
+  nvrtcResult result = nvrtcCompileProgram(program, int(option_ptrs.size()), option_ptrs.data());
+
+  if (log) {
+    size_t log_size = 0;
+    nvrtcGetProgramLogSize(program, &log_size);
+    std::string program_log(log_size, '\0');
+    if (log_size) {
+      nvrtcGetProgramLog(program, &program_log[0]);
+    }
+    *log += program_log;
+  }
+
+  if (result == NVRTC_SUCCESS) {
+    size_t cubin_size = 0;
+    result = nvrtcGetCUBINSize(program, &cubin_size);
+    if (result == NVRTC_SUCCESS) {
+      cubin.resize(cubin_size);
+      result = nvrtcGetCUBIN(program, cubin.data());
+    }
+  }
+
+  nvrtcDestroyProgram(&program);
+  return result == NVRTC_SUCCESS ? Status::kSuccess : Status::kErrorInternal;
+}
+
+template <typename T>
+T round_up(T value, T alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Host workspace: the kernel Params built for the most recent arguments follow this header
+struct JitGemmHostWorkspace {
+  bool valid;
+  void *device_workspace;
+  JitGemmKernelArguments arguments;
+  JitGemmKernelQuery query;
+};
+
+/// Operation running a GEMM kernel loaded from a JIT-compiled module. The module exports:
+///
+///   cutlass_jit_gemm_query(JitGemmKernelArguments, JitGemmKernelQuery *)
+///   cutlass_jit_gemm_params(JitGemmKernelArguments, void *workspace, Params *, JitGemmKernelQuery *)
+///   cutlass_jit_gemm_kernel(Params)
+///
+/// The device workspace holds the Params and query scratch followed by the kernel's own workspace.
+class JitGemmOperation : public Operation {
+public:
+
+  JitGemmOperation(JitGemmSpec const &spec, std::string name):
+    spec_(spec), name_(std::move(name)) {
+
+    description_.name = name_.c_str();
+    description_.provider = Provider::kCUTLASS;
+    description_.kind = OperationKind::kGemm;
+    description_.gemm_kind = GemmKind::kUniversal;
+
+    description_.tile_description.threadblock_shape = spec.tile_shape;
+    description_.tile_description.cluster_shape = spec.cluster_shape;
+    description_.tile_description.threadblock_stages = 0;
+    description_.tile_description.math_instruction.element_accumulator = spec.element_accumulator;
+    description_.tile_description.math_instruction.opcode_class = OpcodeClassID::kTensorOp;
+    description_.tile_description.math_instruction.math_operation = MathOperationID::kMultiplyAdd;
+    description_.tile_description.minimum_compute_capability = 90;
+    description_.tile_description.maximum_compute_capability = 90;
+
+    description_.A = TensorDescription(spec.element_A, spec.layout_A, spec.alignment_A);
+    description_.B = TensorDescription(spec.element_B, spec.layout_B, spec.alignment_B);
+    description_.C = TensorDescription(spec.element_C, spec.layout_C, spec.alignment_C);
+    description_.D = TensorDescription(spec.element_D, spec.layout_C, spec.alignment_C);
+    description_.element_epilogue = spec.element_epilogue;
+    description_.split_k_mode = SplitKMode::kNone;
+    description_.transform_A = ComplexTransform::kNone;
+    description_.transform_B = ComplexTransform::kNone;
+  }
+
+  ~JitGemmOperation() override {
+    if (device_scratch_) {
+      cuMemFree(device_scratch_);
+    }
+    if (module_) {
+      cuModuleUnload(module_);
+    }
+  }
+
+  /// Loads the module and queries the static properties of its kernel
+  Status load(std::vector<char> const &cubin, std::string *log) {
+
+    // Make sure the runtime's primary context is current for the driver API calls below
+    cudaFree(nullptr);
+
+    CUresult result = cuModuleLoadData(&module_, cubin.data());
+    if (result == CUDA_SUCCESS) {
+      result = cuModuleGetFunction(&query_fn_, module_, "cutlass_jit_gemm_query");
+    }
+    if (result == CUDA_SUCCESS) {
+      result = cuModuleGetFunction(&params_fn_, module_, "cutlass_jit_gemm_params");
+    }
+    if (result == CUDA_SUCCESS) {
+      result = cuModuleGetFunction(&kernel_fn_, module_, "cutlass_jit_gemm_kernel");
+    }
+    if (result == CUDA_SUCCESS) {
+      result = cuMemAlloc(&device_scratch_, sizeof(JitGemmKernelQuery));
+    }
+    if (result != CUDA_SUCCESS) {
+      return driver_error_(result, log);
+    }
+
+    JitGemmKernelArguments arguments{};
+    JitGemmKernelQuery query{};
+    Status status = query_(arguments, query);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    params_size_ = size_t(query.params_size);
+    shared_storage_size_ = query.shared_storage_size;
+    max_threads_per_block_ = query.max_threads_per_block;
+
+    result = cuFuncSetAttribute(kernel_fn_, CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES, shared_storage_size_);
+    if (result != CUDA_SUCCESS) {
+      return driver_error_(result, log);
+    }
+
+    return Status::kSuccess;
+  }
+
+  OperationDescription const & description() const override {
+    return description_;
+  }
+
+  Status can_implement(void const *configuration_ptr, void const *arguments_ptr) const override {
+
+    JitGemmKernelArguments arguments{};
+    Status status = to_kernel_arguments_(arguments, static_cast<GemmUniversalArguments const *>(arguments_ptr));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    JitGemmKernelQuery query{};
+    status = query_(arguments, query);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    return static_cast<Status>(query.status);
+  }
+
+  uint64_t get_host_workspace_size(void const *configuration) const override {
+    return round_up(sizeof(JitGemmHostWorkspace), size_t(16)) + params_size_;
+  }
+
+  uint64_t get_device_workspace_size(void const *configuration_ptr, void const *arguments_ptr) const override {
+
+    uint64_t kernel_workspace_size = 0;
+    if (arguments_ptr) {
+      JitGemmKernelArguments arguments{};
+      JitGemmKernelQuery query{};
+      if (to_kernel_arguments_(arguments, static_cast<GemmUniversalArguments const *>(arguments_ptr)) == Status::kSuccess &&
+          query_(arguments, query) == Status::kSuccess) {
+        kernel_workspace_size = query.workspace_size;
+      }
+    }
+    return scratch_size_() + kernel_workspace_size;
+  }
+
+  Status initialize(
+    void const *configuration_ptr,
+    void *host_workspace,
+    void *device_workspace,
+    cudaStream_t stream = nullptr) const override {
+
+    auto *workspace = static_cast<JitGemmHostWorkspace *>(host_workspace);
+    *workspace = JitGemmHostWorkspace{};
+    return Status::kSuccess;
+  }
+
+  Status run(
+    void const *arguments_ptr,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const override {
+
+    if (!device_workspace) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    JitGemmKernelArguments arguments{};
+    Status status = to_kernel_arguments_(arguments, static_cast<GemmUniversalArguments const *>(arguments_ptr));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    auto *workspace = static_cast<JitGemmHostWorkspace *>(host_workspace);
+    uint8_t *host_params = reinterpret_cast<uint8_t *>(host_workspace) + round_up(sizeof(JitGemmHostWorkspace), size_t(16));
+
+    CUdeviceptr device_params = reinterpret_cast<CUdeviceptr>(device_workspace);
+    CUdeviceptr device_query = device_params + round_up(params_size_, size_t(128));
+    void *kernel_workspace = static_cast<uint8_t *>(device_workspace) + scratch_size_();
+    CUstream cu_stream = reinterpret_cast<CUstream>(stream);
+
+    // Params only depend on the arguments and the workspace, so repeated launches reuse them
+    // without another round trip through the params kernel
+    bool rebuild = !workspace->valid ||
+                   workspace->device_workspace != device_workspace ||
+                   std::memcmp(&workspace->arguments, &arguments, sizeof(arguments)) != 0;
+
+    if (rebuild) {
+      workspace->valid = false;
+
+      void *params_args[] = { &arguments, &kernel_workspace, &device_params, &device_query };
+      CUresult result = cuLaunchKernel(params_fn_, 1, 1, 1, 1, 1, 1, 0, cu_stream, params_args, nullptr);
+      if (result == CUDA_SUCCESS) {
+        result = cuMemcpyDtoHAsync(host_params, device_params, params_size_, cu_stream);
+      }
+      if (result == CUDA_SUCCESS) {
+        result = cuMemcpyDtoHAsync(&workspace->query, device_query, sizeof(JitGemmKernelQuery), cu_stream);
+      }
+      if (result == CUDA_SUCCESS) {
+        result = cuStreamSynchronize(cu_stream);
+      }
+      if (result != CUDA_SUCCESS) {
+        return Status::kErrorInternal;
+      }
+      if (static_cast<Status>(workspace->query.status) != Status::kSuccess) {
+        return static_cast<Status>(workspace->query.status);
+      }
+
+      workspace->valid = true;
+      workspace->device_workspace = device_workspace;
+      workspace->arguments = arguments;
+    }
+
+    if (workspace->query.workspace_size) {
+      if (cuMemsetD8Async(reinterpret_cast<CUdeviceptr>(kernel_workspace), 0,
+                          size_t(workspace->query.workspace_size), cu_stream) != CUDA_SUCCESS) {
+        return Status::kErrorInternal;
+      }
+    }
+
+    void *kernel_args[] = { host_params };
+    CUresult result = cuLaunchKernel(
+      kernel_fn_,
+      workspace->query.grid_x, workspace->query.grid_y, workspace->query.grid_z,
+      max_threads_per_block_, 1, 1,
+      shared_storage_size_,
+      cu_stream,
+      kernel_args,
+      nullptr);
+
+    return result == CUDA_SUCCESS ? Status::kSuccess : Status::kErrorInternal;
+  }
+
+private:
+
+  JitGemmSpec spec_;
+  std::string name_;
+  GemmDescription description_;
+
+  CUmodule module_{nullptr};
+  CUfunction query_fn_{nullptr};
+  CUfunction params_fn_{nullptr};
+  CUfunction kernel_fn_{nullptr};
+
+  /// Query results of can_implement() and workspace queries, guarded by query_mutex_
+  CUdeviceptr device_scratch_{0};
+  mutable std::mutex query_mutex_;
+
+  size_t params_size_{0};
+  int shared_storage_size_{0};
+  int max_threads_per_block_{0};
+
+  size_t scratch_size_() const {
+    return round_up(params_size_, size_t(128)) + round_up(sizeof(JitGemmKernelQuery), size_t(128));
+  }
+
+  static Status driver_error_(CUresult result, std::string *log) {
+    if (log) {
+      char const *message = nullptr;
+      cuGetErrorString(result, &message);
+      *log += std::string("CUDA driver error: ") + (message ? message : "unknown") + "\n";
+    }
+    return Status::kErrorInternal;
+  }
+
+  /// Runs the query kernel synchronously on the default stream
+  Status query_(JitGemmKernelArguments const &arguments, JitGemmKernelQuery &query) const {
+    std::lock_guard<std::mutex> lock(query_mutex_);
+
+    JitGemmKernelArguments kernel_arguments = arguments;
+    CUdeviceptr device_query = device_scratch_;
+    void *args[] = { &kernel_arguments, &device_query };
+
+    CUresult result = cuLaunchKernel(query_fn_, 1, 1, 1, 1, 1, 1, 0, nullptr, args, nullptr);
+    if (result == CUDA_SUCCESS) {
+      result = cuMemcpyDtoH(&query, device_scratch_, sizeof(JitGemmKernelQuery));
+    }
+    return result == CUDA_SUCCESS ? Status::kSuccess : Status::kErrorInternal;
+  }
+
+  /// Reads a host scalar of the epilogue compute type
+  Status read_scalar_(double &value, void const *ptr) const {
+    switch (spec_.element_epilogue) {
+      case NumericTypeID::kF16:  value = double(float(*static_cast<half_t const *>(ptr))); break;
+      case NumericTypeID::kBF16: value = double(float(*static_cast<bfloat16_t const *>(ptr))); break;
+      case NumericTypeID::kF32:  value = double(*static_cast<float const *>(ptr)); break;
+      case NumericTypeID::kF64:  value = *static_cast<double const *>(ptr); break;
+      case NumericTypeID::kS32:  value = double(*static_cast<int32_t const *>(ptr)); break;
+      default: return Status::kErrorNotSupported;
+    }
+    return Status::kSuccess;
+  }
+
+  Status to_kernel_arguments_(JitGemmKernelArguments &kernel_args, GemmUniversalArguments const *arguments) const {
+
+    kernel_args.m = arguments->problem_size.m();
+    kernel_args.n = arguments->problem_size.n();
+    kernel_args.k = arguments->problem_size.k();
+    kernel_args.batch_count = arguments->batch_count;
+
+    kernel_args.A = arguments->A;
+    kernel_args.B = arguments->B;
+    kernel_args.C = arguments->C;
+    kernel_args.D = arguments->D;
+
+    kernel_args.lda = arguments->lda;
+    kernel_args.ldb = arguments->ldb;
+    kernel_args.ldc = arguments->ldc;
+    kernel_args.ldd = arguments->ldd;
+
+    kernel_args.batch_stride_A = arguments->batch_stride_A;
+    kernel_args.batch_stride_B = arguments->batch_stride_B;
+    kernel_args.batch_stride_C = arguments->batch_stride_C;
+    kernel_args.batch_stride_D = arguments->batch_stride_D;
+
+    if (arguments->pointer_mode == ScalarPointerMode::kHost) {
+      Status status = read_scalar_(kernel_args.alpha, arguments->alpha);
+      if (status == Status::kSuccess) {
+        status = read_scalar_(kernel_args.beta, arguments->beta);
+      }
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    else if (arguments->pointer_mode == ScalarPointerMode::kDevice) {
+      kernel_args.alpha_ptr = arguments->alpha;
+      kernel_args.beta_ptr = arguments->beta;
+    }
+    else {
+      return Status::kErrorInvalidProblem;
+    }
+
+    kernel_args.sm_count = arguments->sm_count;
+    if (kernel_args.sm_count <= 0) {
+      int device = 0;
+      cudaGetDevice(&device);
+      cudaDeviceGetAttribute(&kernel_args.sm_count, cudaDevAttrMultiProcessorCount, device);
+    }
+
+    switch (arguments->raster_order) {
+      case RasterOrder::kAlongN: kernel_args.raster_order = 1; break;
+      case RasterOrder::kAlongM: kernel_args.raster_order = 2; break;
+      default:                   kernel_args.raster_order = 0; break;
+    }
+    kernel_args.swizzle_size = arguments->swizzle_size;
+
+    return Status::kSuccess;
+  }
+};
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+JitCompileOptions::JitCompileOptions() {
+#if defined(CUTLASS_LIBRARY_JIT_INCLUDE_DIRS)
+  include_paths = split_paths(CUTLASS_LIBRARY_JIT_INCLUDE_DIRS);
+#endif
+}
+
+std::string jit_gemm_operation_name(JitGemmSpec const &spec) {
+  std::stringstream ss;
+  ss << "cutlass3x_jit_sm90_tensorop_gemm_"
+     << to_string(spec.element_A) << "_" << to_string(spec.element_B) << "_"
+     << to_string(spec.element_accumulator) << "_"
+     << to_string(spec.element_C) << "_" << to_string(spec.element_D) << "_"
+     << spec.tile_shape.m() << "x" << spec.tile_shape.n() << "x" << spec.tile_shape.k() << "_"
+     << spec.cluster_shape.m() << "x" << spec.cluster_shape.n() << "x" << spec.cluster_shape.k() << "_"
+     << jit_layout_letter(spec.layout_A) << jit_layout_letter(spec.layout_B) << jit_layout_letter(spec.layout_C)
+     << "_align" << spec.alignment_A << "_" << jit_schedule_suffix(spec.schedule);
+  return ss.str();
+}
+
+std::string emit_jit_gemm_source(JitGemmSpec const &spec) {
+
+  if (!is_supported(spec)) {
+    return std::string();
+  }
+
+  std::stringstream ss;
+  ss << "// " << jit_gemm_operation_name(spec) << "\n"
+     << "// " << kJitModuleVersion << "\n\n"
+     << "#include \"cutlass/cutlass.h\"\n"
+     << "#include \"cutlass/numeric_types.h\"\n"
+     << "#include \"cutlass/gemm/gemm.h\"\n"
+     << "#include \"cutlass/gemm/kernel/gemm_universal.hpp\"\n"
+     << "#include \"cutlass/gemm/collective/collective_builder.hpp\"\n"
+     << "#include \"cutlass/epilogue/collective/collective_builder.hpp\"\n"
+     << "#include \"cutlass/library/jit_gemm_arguments.h\"\n\n"
+     << "using namespace cute;\n\n"
+     << "using ElementA           = " << jit_type_name(spec.element_A) << ";\n"
+     << "using ElementB           = " << jit_type_name(spec.element_B) << ";\n"
+     << "using ElementC           = " << jit_type_name(spec.element_C) << ";\n"
+     << "using ElementD           = " << jit_type_name(spec.element_D) << ";\n"
+     << "using ElementAccumulator = " << jit_type_name(spec.element_accumulator) << ";\n"
+     << "using ElementCompute     = " << jit_type_name(spec.element_epilogue) << ";\n\n"
+     << "using TileShape    = Shape<_" << spec.tile_shape.m() << ", _" << spec.tile_shape.n()
+                                << ", _" << spec.tile_shape.k() << ">;\n"
+     << "using ClusterShape = Shape<_1, _1, _1>;\n\n"
+     << "using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<\n"
+     << "    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,\n"
+     << "    TileShape, ClusterShape,\n"
+     << "    cutlass::epilogue::collective::EpilogueTileAuto,\n"
+     << "    ElementAccumulator, ElementCompute,\n"
+     << "    ElementC, " << jit_layout_name(spec.layout_C) << ", " << spec.alignment_C << ",\n"
+     << "    ElementD, " << jit_layout_name(spec.layout_C) << ", " << spec.alignment_C << ",\n"
+     << "    cutlass::epilogue::NoSmemWarpSpecialized\n"
+     << "  >::CollectiveOp;\n\n"
+     << "using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<\n"
+     << "    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,\n"
+     << "    ElementA, " << jit_layout_name(spec.layout_A) << ", " << spec.alignment_A << ",\n"
+     << "    ElementB, " << jit_layout_name(spec.layout_B) << ", " << spec.alignment_B << ",\n"
+     << "    ElementAccumulator,\n"
+     << "    TileShape, ClusterShape,\n"
+     << "    cutlass::gemm::collective::StageCountAutoCarveout<\n"
+     << "      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,\n"
+     << "    " << jit_schedule_name(spec.schedule) << "\n"
+     << "  >::CollectiveOp;\n\n"
+     << R"(using JitGemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int, int, int, int>,
+    CollectiveMainloop,
+    CollectiveEpilogue>;
+
+using JitParams = typename JitGemmKernel::Params;
+using cutlass::library::JitGemmKernelArguments;
+using cutlass::library::JitGemmKernelQuery;
+
+// Mirrors GemmUniversal3xOperation::update_arguments_() in the library
+CUTLASS_DEVICE typename JitGemmKernel::Arguments
+make_arguments(JitGemmKernelArguments const& a) {
+  typename JitGemmKernel::Arguments args{};
+  args.mode = a.batch_count > 1 ? cutlass::gemm::GemmUniversalMode::kBatched
+                                : cutlass::gemm::GemmUniversalMode::kGemm;
+  args.problem_shape = make_shape(a.m, a.n, a.k, a.batch_count);
+
+  args.mainloop.ptr_A = static_cast<ElementA const*>(a.A);
+  args.mainloop.ptr_B = static_cast<ElementB const*>(a.B);
+  args.mainloop.dA = make_int_tuple_from<typename JitGemmKernel::StrideA>(int64_t(a.lda), int64_t(a.batch_stride_A));
+  args.mainloop.dB = make_int_tuple_from<typename JitGemmKernel::StrideB>(int64_t(a.ldb), int64_t(a.batch_stride_B));
+
+  args.epilogue.ptr_C = static_cast<ElementC const*>(a.C);
+  args.epilogue.ptr_D = static_cast<ElementD*>(a.D);
+  args.epilogue.dC = make_int_tuple_from<typename JitGemmKernel::StrideC>(int64_t(a.ldc), int64_t(a.batch_stride_C));
+  args.epilogue.dD = make_int_tuple_from<typename JitGemmKernel::StrideD>(int64_t(a.ldd), int64_t(a.batch_stride_D));
+
+  if (a.alpha_ptr) {
+    args.epilogue.thread.alpha_ptr = static_cast<ElementCompute const*>(a.alpha_ptr);
+    args.epilogue.thread.beta_ptr = static_cast<ElementCompute const*>(a.beta_ptr);
+  }
+  else {
+    args.epilogue.thread.alpha = static_cast<ElementCompute>(a.alpha);
+    args.epilogue.thread.beta = static_cast<ElementCompute>(a.beta);
+  }
+
+  args.hw_info.sm_count = a.sm_count;
+
+  if constexpr (!cute::is_const_v<decltype(args.scheduler.max_swizzle_size)>) {
+    args.scheduler.max_swizzle_size = a.swizzle_size;
+  }
+  if constexpr (!cute::is_const_v<decltype(args.scheduler.raster_order)>) {
+    using Enum_t = decltype(args.scheduler.raster_order);
+    args.scheduler.raster_order = a.raster_order == 1 ? Enum_t::AlongN :
+                                  a.raster_order == 2 ? Enum_t::AlongM : Enum_t::Heuristic;
+  }
+  return args;
+}
+
+extern "C" __global__ void
+cutlass_jit_gemm_query(JitGemmKernelArguments const a, JitGemmKernelQuery* query) {
+  auto args = make_arguments(a);
+  query->status = int(JitGemmKernel::can_implement(args) ? cutlass::Status::kSuccess
+                                                         : cutlass::Status::kErrorInvalidProblem);
+  query->shared_storage_size = int(JitGemmKernel::SharedStorageSize);
+  query->max_threads_per_block = int(JitGemmKernel::MaxThreadsPerBlock);
+  query->workspace_size = (unsigned long long)(JitGemmKernel::get_workspace_size(args));
+  query->params_size = (unsigned long long)(sizeof(JitParams));
+}
+
+extern "C" __global__ void
+cutlass_jit_gemm_params(JitGemmKernelArguments const a, void* workspace, JitParams* params, JitGemmKernelQuery* query) {
+  auto args = make_arguments(a);
+  query->status = int(JitGemmKernel::can_implement(args) ? cutlass::Status::kSuccess
+                                                         : cutlass::Status::kErrorInvalidProblem);
+  query->workspace_size = (unsigned long long)(JitGemmKernel::get_workspace_size(args));
+  *params = JitGemmKernel::to_underlying_arguments(args, workspace);
+  dim3 grid = JitGemmKernel::get_grid_shape(*params);
+  query->grid_x = int(grid.x);
+  query->grid_y = int(grid.y);
+  query->grid_z = int(grid.z);
+}
+
+extern "C" __global__ void
+__launch_bounds__(JitGemmKernel::MaxThreadsPerBlock, JitGemmKernel::MinBlocksPerMultiprocessor)
+cutlass_jit_gemm_kernel(JitParams const params) {
+  extern __shared__ char smem[];
+  JitGemmKernel op;
+  op(params, smem);
+}
+)";
+
+  return ss.str();
+}
+
+Status make_jit_gemm_operation(
+  std::unique_ptr<Operation> &operation,
+  JitGemmSpec const &spec,
+  JitCompileOptions const &options,
+  std::string *log) {
+
+  operation.reset();
+
+  std::string source = emit_jit_gemm_source(spec);
+  if (source.empty()) {
+    if (log) {
+      *log += "Unsupported JIT GEMM spec: types, layouts or schedule have no JIT mapping, "
+              "or the cluster shape is not 1x1x1.\n";
+    }
+    return Status::kErrorNotSupported;
+  }
+
+  int compute_capability = options.compute_capability ? options.compute_capability : current_compute_capability();
+  if (compute_capability != 90) {
+    return Status::kErrorArchMismatch;
+  }
+
+  std::vector<std::string> nvrtc_options = {
+    "--std=c++17",
+    "-default-device",
+    "--gpu-architecture=sm_90a",
+    "-DNDEBUG",
+  };
+  for (auto const &path : options.include_paths) {
+    nvrtc_options.push_back("--include-path=" + path);
+  }
+  nvrtc_options.insert(nvrtc_options.end(), options.extra_options.begin(), options.extra_options.end());
+
+  int nvrtc_major = 0;
+  int nvrtc_minor = 0;
+  nvrtcVersion(&nvrtc_major, &nvrtc_minor);
+
+  // The cubin depends on the source, the options and the compiler
+  uint64_t key = hash_bytes(source);
+  for (auto const &option : nvrtc_options) {
+    key = hash_bytes(option + '\n', key);
+  }
+  key = hash_bytes(std::to_string(nvrtc_major) + "." + std::to_string(nvrtc_minor), key);
+
+  std::string name = jit_gemm_operation_name(spec);
+  std::string cache_path;
+  if (!options.cache_dir.empty()) {
+    char key_str[17];
+    std::snprintf(key_str, sizeof(key_str), "%016llx", static_cast<unsigned long long>(key));
+    cache_path = options.cache_dir + "/" + name + "_" + key_str + ".cubin";
+  }
+
+  std::vector<char> cubin;
+  if (cache_path.empty() || !read_file(cache_path, cubin)) {
+    Status status = compile_cubin(source, name, nvrtc_options, cubin, log);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    if (!cache_path.empty()) {
+      write_file(cache_path, cubin);
+    }
+  }
+
+  auto jit_operation = std::make_unique<JitGemmOperation>(spec, name);
+  Status status = jit_operation->load(cubin, log);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  operation = std::move(jit_operation);
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,6 +187,10 @@ template <> struct MathOperationMap<cutlass::arch::OpMultiplyAddMixedInputUpcast
   static MathOperationID const kId = MathOperationID::kMultiplyAddMixedInputUpcast;
 };
 
+template <> struct MathOperationMap<cutlass::arch::OpMultiplyAddMixedInputUpcastGroupwise> {
+  static MathOperationID const kId = MathOperationID::kMultiplyAddMixedInputUpcastGroupwise;
+};
+
 template <> struct MathOperationMap<cutlass::arch::OpMultiplyAddComplex> {
   static MathOperationID const kId = MathOperationID::kMultiplyAddComplex;
 };
@@ -362,6 +366,10 @@ template <> struct IteratorAlgorithmMap<conv::IteratorAlgorithm::kFewChannels> {
   static IteratorAlgorithmID const kId = IteratorAlgorithmID::kFewChannels;
 };
 
+template <> struct IteratorAlgorithmMap<conv::IteratorAlgorithm::kWinograd> {
+  static IteratorAlgorithmID const kId = IteratorAlgorithmID::kWinograd;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <typename Element, typename Layout>
@@ -379,6 +387,46 @@ TensorDescription make_TensorDescription(int alignment = 1) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Queries the attributes of a kernel and its occupancy on the current device
+inline Status query_kernel_resource_usage(
+  void const *kernel,
+  int threads_per_block,
+  size_t dynamic_smem_bytes,
+  KernelResourceUsage *usage) {
+
+  cudaFuncAttributes attributes;
+  cudaError_t result = cudaFuncGetAttributes(&attributes, kernel);
+  if (result != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+
+  usage->registers_per_thread = attributes.numRegs;
+  usage->local_bytes_per_thread = attributes.localSizeBytes;
+  usage->static_smem_bytes = attributes.sharedSizeBytes;
+  usage->dynamic_smem_bytes = dynamic_smem_bytes;
+  usage->max_threads_per_block = attributes.maxThreadsPerBlock;
+  usage->threads_per_block = threads_per_block;
+  usage->max_active_blocks_per_sm = 0;
+
+  // Kernels with more than 48 KB of dynamic smem must opt in before the occupancy query
+  if (dynamic_smem_bytes >= (48 << 10)) {
+    result = cudaFuncSetAttribute(kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, int(dynamic_smem_bytes));
+    if (result != cudaSuccess) {
+      return Status::kErrorInternal;
+    }
+  }
+
+  result = cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &usage->max_active_blocks_per_sm, kernel, threads_per_block, dynamic_smem_bytes);
+  if (result != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace library
 } // namespace cutlass
 
@@ -50,9 +50,7 @@ void initialize_reference_operations(Manifest &manifest);
 /// Top-level initialization
 Status Manifest::initialize() {
 
-  if (!operations_.empty()) {
-    operations_.clear();
-  }
+  release();
 
   // initialize procedurally generated cutlass op in manifest object
   initialize_all(*this);
@@ -66,6 +64,80 @@ Status Manifest::initialize() {
   return Status::kSuccess;
 }
 
+/// Top-level initialization which defers construction of generated operations
+Status Manifest::initialize_lazy() {
+
+  release();
+
+  // record the procedurally generated operation index without constructing operations
+  initialize_all_index(*this);
+
+  // reference and reduction ops are not part of the index and are constructed eagerly
+  initialize_reference_operations(*this);
+  initialize_all_reduction_op(*this);
+
+  return Status::kSuccess;
+}
+
+/// Used by initialize_all_index() to supply the static operation index
+void Manifest::append_index(ManifestIndexEntry const *index, size_t count) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+  index_ = index;
+  index_count_ = count;
+
+  index_by_name_.clear();
+  index_by_name_.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    index_by_name_.emplace(index[i].name, &index[i]);
+  }
+}
+
+/// Runs a configuration initializer if it has not run yet
+void Manifest::initialize_configuration_(void (*initialize)(Manifest &)) const {
+  if (!initialized_.insert(initialize).second) {
+    return;
+  }
+
+  // Generated initializers only append to the operation list
+  initialize(const_cast<Manifest &>(*this));
+}
+
+/// Constructs every operation of the index which has not been constructed yet
+void Manifest::materialize_() const {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+  if (materialized_) {
+    return;
+  }
+
+  for (size_t i = 0; i < index_count_; ++i) {
+    initialize_configuration_(index_[i].initialize);
+  }
+  materialized_ = true;
+}
+
+/// Returns the operation with the given name, constructing its configuration if needed
+Operation const *Manifest::find(std::string const &name) const {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+  auto index_it = index_by_name_.find(name);
+  if (index_it != index_by_name_.end()) {
+    initialize_configuration_(index_it->second->initialize);
+  }
+
+  // Index newly appended operations by name
+  for (size_t i = operations_by_name_.size(); i < operations_.size(); ++i) {
+    operations_by_name_.emplace(operations_[i]->description().name, i);
+  }
+
+  auto it = operations_by_name_.find(name);
+  if (it == operations_by_name_.end()) {
+    return nullptr;
+  }
+  return operations_[it->second].get();
+}
+
 /// Used for initialization
 void Manifest::reserve(size_t operation_count) {
   operations_.reserve(operation_count);
@@ -73,23 +145,32 @@ void Manifest::reserve(size_t operation_count) {
 
 /// Graceful shutdown
 Status Manifest::release() {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+
   operations_.clear();
+  operations_by_name_.clear();
+  initialized_.clear();
+  materialized_ = false;
+  index_by_name_.clear();
+  index_ = nullptr;
+  index_count_ = 0;
   return Status::kSuccess;
 }
 
-/// Returns an iterator to the first operation
+/// Returns the list of operations. In lazy mode, constructs all outstanding operations.
 OperationVector const & Manifest::operations() const {
+  materialize_();
   return operations_;
 }
 
 /// Returns a const iterator
 OperationVector::const_iterator Manifest::begin() const {
-  return operations_.begin();
+  return operations().begin();
 }
 
 /// Returns a const iterator
 OperationVector::const_iterator Manifest::end() const {
-  return operations_.end();
+  return operations().end();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,27 @@ namespace library {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+GemmFunctionalKey gemm_functional_key(GemmDescription const &desc) {
+  return GemmFunctionalKey(
+    desc.provider,
+    desc.gemm_kind,
+    desc.tile_description.math_instruction.element_accumulator,
+    desc.element_epilogue,
+    desc.A.element,
+    desc.A.layout,
+    desc.transform_A,
+    desc.B.element,
+    desc.B.layout,
+    desc.transform_B,
+    desc.C.element,
+    desc.C.layout,
+    desc.D.element,
+    desc.D.layout
+  );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 void OperationTable::append(Manifest const &manifest) {
 
   // Insert operations into appropriate data structure
@@ -53,22 +74,7 @@ void OperationTable::append(Manifest const &manifest) {
       GemmDescription const &gemm_desc = static_cast<GemmDescription const &>(desc);
     
 
-      GemmFunctionalKey functional_key(
-        gemm_desc.provider,
-        gemm_desc.gemm_kind,
-        gemm_desc.tile_description.math_instruction.element_accumulator,
-        gemm_desc.element_epilogue,
-        gemm_desc.A.element,
-        gemm_desc.A.layout,
-        gemm_desc.transform_A,
-        gemm_desc.B.element,
-        gemm_desc.B.layout,
-        gemm_desc.transform_B,
-        gemm_desc.C.element,
-        gemm_desc.C.layout,
-        gemm_desc.D.element,
-        gemm_desc.D.layout
-      );
+      GemmFunctionalKey functional_key = gemm_functional_key(gemm_desc);
 
       Operation const *op = operation.get();
 
@@ -0,0 +1,315 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*
+  \file
+  \brief Instrumentation of the library run path.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#if defined(CUTLASS_LIBRARY_ENABLE_NVTX)
+#include <nvtx3/nvToolsExt.h>
+#endif
+
+#include "cutlass/library/operation_trace.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Device timings awaiting completion beyond which further calls are only counted
+size_t const kMaxPendingTimings = 4096;
+
+uint64_t now_ns() {
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+OperationTraceMode mode_from_environment() {
+  char const *value = std::getenv("CUTLASS_LIBRARY_TRACE");
+
+  if (!value) {
+    return OperationTraceMode::kDisabled;
+  }
+
+  std::string mode(value);
+
+  if (mode == "device") {
+    return OperationTraceMode::kDevice;
+  }
+  if (mode == "calls" || mode == "1") {
+    return OperationTraceMode::kCalls;
+  }
+  return OperationTraceMode::kDisabled;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+OperationTrace &OperationTrace::get() {
+  static OperationTrace trace;
+  return trace;
+}
+
+OperationTrace::OperationTrace():
+  mode_(mode_from_environment()), dump_at_exit_(false) {
+
+  dump_at_exit_ = (mode_.load() != OperationTraceMode::kDisabled);
+
+  char const *path = std::getenv("CUTLASS_LIBRARY_TRACE_FILE");
+  if (path) {
+    dump_path_ = path;
+  }
+}
+
+OperationTrace::~OperationTrace() {
+
+  if (dump_at_exit_) {
+
+    // The CUDA runtime may already be shutting down, so timings still pending are dropped
+    resolve_(false);
+
+    if (dump_path_.empty()) {
+      dump(std::cerr);
+    }
+    else {
+      std::ofstream file(dump_path_);
+      dump(file);
+    }
+  }
+
+  for (auto &timing : pending_) {
+    cudaEventDestroy(timing.start);
+    cudaEventDestroy(timing.stop);
+  }
+}
+
+void OperationTrace::set_mode(OperationTraceMode mode) {
+  mode_.store(mode, std::memory_order_relaxed);
+}
+
+void OperationTrace::record(std::string const &name, double host_ms, cudaEvent_t start, cudaEvent_t stop) {
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  OperationTraceStats &stats = stats_[name];
+  ++stats.calls;
+  stats.host_ms += host_ms;
+
+  if (start && stop) {
+    resolve_(false);
+
+    if (pending_.size() < kMaxPendingTimings) {
+      pending_.push_back({name, start, stop});
+    }
+    else {
+      cudaEventDestroy(start);
+      cudaEventDestroy(stop);
+    }
+  }
+}
+
+void OperationTrace::resolve_(bool wait) {
+
+  auto it = std::remove_if(pending_.begin(), pending_.end(), [&](PendingTiming &timing) {
+
+    cudaError_t result = wait ? cudaEventSynchronize(timing.stop) : cudaEventQuery(timing.stop);
+
+    if (result == cudaErrorNotReady) {
+      return false;
+    }
+
+    float elapsed_ms = 0;
+    if (result == cudaSuccess && cudaEventElapsedTime(&elapsed_ms, timing.start, timing.stop) == cudaSuccess) {
+      OperationTraceStats &stats = stats_[timing.name];
+      ++stats.device_calls;
+      stats.device_ms += elapsed_ms;
+    }
+
+    cudaEventDestroy(timing.start);
+    cudaEventDestroy(timing.stop);
+    return true;
+  });
+
+  pending_.erase(it, pending_.end());
+}
+
+std::map<std::string, OperationTraceStats> OperationTrace::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  resolve_(true);
+  return stats_;
+}
+
+void OperationTrace::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  resolve_(true);
+  stats_.clear();
+}
+
+void OperationTrace::dump(std::ostream &out) {
+
+  std::vector<std::pair<std::string, OperationTraceStats>> entries;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries.assign(stats_.begin(), stats_.end());
+  }
+
+  std::sort(entries.begin(), entries.end(), [](auto const &lhs, auto const &rhs) {
+    if (lhs.second.device_ms != rhs.second.device_ms) {
+      return lhs.second.device_ms > rhs.second.device_ms;
+    }
+    return lhs.second.host_ms > rhs.second.host_ms;
+  });
+
+  out << "Operation,Calls,HostTime(ms),HostTimePerCall(us),DeviceCalls,DeviceTime(ms),DeviceTimePerCall(us)\n";
+
+  for (auto const &entry : entries) {
+    OperationTraceStats const &stats = entry.second;
+
+    out << entry.first
+      << "," << stats.calls
+      << "," << stats.host_ms
+      << "," << (stats.calls ? stats.host_ms * 1000.0 / double(stats.calls) : 0)
+      << "," << stats.device_calls
+      << "," << stats.device_ms
+      << "," << (stats.device_calls ? stats.device_ms * 1000.0 / double(stats.device_calls) : 0)
+      << "\n";
+  }
+
+  out.flush();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+OperationRange::OperationRange(OperationDescription const &desc, cudaStream_t stream):
+  desc_(&desc), stream_(stream), nvtx_(false), traced_(false), start_ns_(0), start_event_(nullptr) {
+
+  begin_(desc, nullptr, 1);
+}
+
+OperationRange::OperationRange(
+  OperationDescription const &desc,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  cudaStream_t stream):
+  desc_(&desc), stream_(stream), nvtx_(false), traced_(false), start_ns_(0), start_event_(nullptr) {
+
+  begin_(desc, &problem_size, batch_count);
+}
+
+void OperationRange::begin_(OperationDescription const &desc, gemm::GemmCoord const *problem_size, int batch_count) {
+
+#if defined(CUTLASS_LIBRARY_ENABLE_NVTX)
+  std::stringstream message;
+  message << desc.name;
+
+  if (problem_size) {
+    message << " " << problem_size->m() << "x" << problem_size->n() << "x" << problem_size->k();
+    if (batch_count > 1) {
+      message << "x" << batch_count;
+    }
+  }
+
+  nvtxRangePushA(message.str().c_str());
+  nvtx_ = true;
+#endif
+
+  OperationTraceMode mode = OperationTrace::get().mode();
+
+  if (mode == OperationTraceMode::kDisabled) {
+    return;
+  }
+
+  traced_ = true;
+
+  // Events recorded while the stream is captured into a graph do not time anything
+  cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+
+  if (mode == OperationTraceMode::kDevice &&
+      cudaStreamIsCapturing(stream_, &capture_status) == cudaSuccess &&
+      capture_status == cudaStreamCaptureStatusNone) {
+
+    if (cudaEventCreate(&start_event_) != cudaSuccess || cudaEventRecord(start_event_, stream_) != cudaSuccess) {
+      if (start_event_) {
+        cudaEventDestroy(start_event_);
+      }
+      start_event_ = nullptr;
+    }
+  }
+
+  start_ns_ = now_ns();
+}
+
+OperationRange::~OperationRange() {
+
+  if (traced_) {
+    double host_ms = double(now_ns() - start_ns_) / 1.0e6;
+
+    cudaEvent_t stop_event = nullptr;
+
+    if (start_event_ &&
+        (cudaEventCreate(&stop_event) != cudaSuccess || cudaEventRecord(stop_event, stream_) != cudaSuccess)) {
+      if (stop_event) {
+        cudaEventDestroy(stop_event);
+      }
+      cudaEventDestroy(start_event_);
+      start_event_ = nullptr;
+      stop_event = nullptr;
+    }
+
+    OperationTrace::get().record(desc_->name, host_ms, start_event_, stop_event);
+  }
+
+#if defined(CUTLASS_LIBRARY_ENABLE_NVTX)
+  if (nvtx_) {
+    nvtxRangePop();
+  }
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,7 @@
 #include "cutlass/gemm/kernel/default_rank_k_universal.h"
 
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -316,6 +317,8 @@ public:
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
 
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
     
     Status status = update_arguments_(
@@ -0,0 +1,300 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Defines rank-k update operations (Syrk, Syr2k) built from CUTLASS 3.x GEMM kernels.
+
+  The kernel computes D = alpha * A * A^T + beta * C as a GEMM whose B operand is A itself,
+  with cutlass::gemm::TriangularScheduler skipping the tiles outside the fill mode and
+  collective::DefaultEpilogueTriangular masking the diagonal tiles. Kernels scheduled with a
+  rank-2 TriangularScheduler compute D = alpha * (A * B^T + B * A^T) + beta * C instead.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/detail/collective.hpp"
+#include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
+#include "library_internal.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Operator_>
+class RankK3xOperation : public Operation {
+public:
+  using Operator = Operator_;
+  using OperatorArguments = typename Operator::Arguments;
+  using GemmKernel = typename Operator::GemmKernel;
+  using ElementA = typename Operator::ElementA;
+  using LayoutA = typename Operator::LayoutA;
+  using ElementC = typename Operator::ElementC;
+  using LayoutC = typename Operator::LayoutC;
+  using ElementAccumulator = typename Operator::ElementAccumulator;
+  using ElementCompute = typename Operator::EpilogueOutputOp::ElementCompute;
+
+  static FillMode const kFillModeC = GemmKernel::CollectiveEpilogue::kFillMode;
+  static int const kNumRanks = GemmKernel::TileScheduler::kRank;
+
+  static_assert(cute::is_same_v<typename GemmKernel::StrideA, typename GemmKernel::StrideB>,
+    "The B operand of a rank-k update is A or shares the layout of A, and must share its stride.");
+
+private:
+
+  /// The configuration is only passed to initialize(), so it is kept next to the operator
+  struct HostWorkspace {
+    Operator op;
+    RankKConfiguration configuration;
+  };
+
+  RankKDescription description_;
+
+public:
+
+  /// Constructor
+  RankK3xOperation(char const *name = "unknown_rank_k") {
+
+    description_.name = name;
+    description_.provider = Provider::kCUTLASS;
+    description_.rank_k_kind = RankKKind::kUniversal;
+    description_.fill_mode = kFillModeC;
+    description_.blas_mode = BlasMode::kSymmetric;
+    description_.num_ranks = kNumRanks;
+
+    description_.kind = kNumRanks == 2 ? OperationKind::kRank2K : OperationKind::kRankK;
+
+    description_.tile_description.threadblock_shape = make_Coord(
+      Operator::ThreadblockShape::kM,
+      Operator::ThreadblockShape::kN,
+      Operator::ThreadblockShape::kK);
+
+    description_.tile_description.cluster_shape = make_Coord(
+      Operator::ClusterShape::kM,
+      Operator::ClusterShape::kN,
+      Operator::ClusterShape::kK);
+
+    description_.tile_description.threadblock_stages = Operator::kStages;
+
+    description_.tile_description.warp_count = make_Coord(
+      Operator::WarpCount::kM,
+      Operator::WarpCount::kN,
+      Operator::WarpCount::kK);
+
+    description_.tile_description.math_instruction.instruction_shape = make_Coord(
+      Operator::InstructionShape::kM,
+      Operator::InstructionShape::kN,
+      Operator::InstructionShape::kK);
+
+    description_.tile_description.math_instruction.element_accumulator =
+      NumericTypeMap<ElementAccumulator>::kId;
+
+    description_.tile_description.math_instruction.opcode_class =
+      OpcodeClassMap<typename Operator::OperatorClass>::kId;
+
+    description_.tile_description.math_instruction.math_operation =
+      MathOperationMap<typename Operator::MathOperator>::kId;
+
+    description_.tile_description.minimum_compute_capability =
+      ArchMap<typename Operator::ArchTag, typename Operator::OperatorClass>::kMin;
+
+    description_.tile_description.maximum_compute_capability =
+      ArchMap<typename Operator::ArchTag, typename Operator::OperatorClass>::kMax;
+
+    description_.A = make_TensorDescription<ElementA, LayoutA>(Operator::kAlignmentA);
+    description_.B = make_TensorDescription<ElementA, LayoutA>(Operator::kAlignmentA);
+    description_.C = make_TensorDescription<ElementC, LayoutC>(Operator::kAlignmentC);
+    description_.element_epilogue = NumericTypeMap<ElementCompute>::kId;
+
+    description_.split_k_mode = SplitKMode::kNone;
+    description_.transform_A = ComplexTransform::kNone;
+    description_.transform_B = ComplexTransform::kNone;
+  }
+
+  /// Returns the description of the SYRK operation
+  OperationDescription const & description() const override {
+    return description_;
+  }
+
+protected:
+
+  /// Constructs the arguments structure given the configuration and arguments
+  static Status update_arguments_(
+    OperatorArguments &operator_args,
+    RankKConfiguration const *configuration,
+    RankKArguments const *arguments) {
+
+    if (configuration->problem_size.m() != configuration->problem_size.n()) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (arguments->pointer_mode == ScalarPointerMode::kHost) {
+      operator_args.epilogue.thread = typename Operator::EpilogueOutputOp::Params(
+        *static_cast<ElementCompute const *>(arguments->alpha),
+        *static_cast<ElementCompute const *>(arguments->beta));
+    }
+    else if (arguments->pointer_mode == ScalarPointerMode::kDevice) {
+      operator_args.epilogue.thread = typename Operator::EpilogueOutputOp::Params(
+        static_cast<ElementCompute const *>(arguments->alpha),
+        static_cast<ElementCompute const *>(arguments->beta));
+    }
+    else {
+      return Status::kErrorInvalidProblem;
+    }
+
+    operator_args.mode = configuration->batch_count > 1 ?
+      gemm::GemmUniversalMode::kBatched : gemm::GemmUniversalMode::kGemm;
+
+    operator_args.problem_shape = cute::make_shape(
+      configuration->problem_size.n(),
+      configuration->problem_size.n(),
+      configuration->problem_size.k(),
+      configuration->batch_count);
+
+    // For rank-k updates B is A viewed as an (N,K) operand
+    operator_args.mainloop.ptr_A = static_cast<ElementA const *>(arguments->A);
+    operator_args.mainloop.ptr_B = static_cast<ElementA const *>(kNumRanks == 2 ? arguments->B : arguments->A);
+    operator_args.epilogue.ptr_C = static_cast<ElementC const *>(arguments->C);
+    operator_args.epilogue.ptr_D = static_cast<ElementC       *>(arguments->D);
+
+    operator_args.mainloop.dA = cute::make_int_tuple_from<typename GemmKernel::StrideA>(
+        configuration->lda, arguments->batch_stride_A);
+    if constexpr (kNumRanks == 2) {
+      operator_args.mainloop.dB = cute::make_int_tuple_from<typename GemmKernel::StrideB>(
+          configuration->ldb, arguments->batch_stride_B);
+    }
+    else {
+      operator_args.mainloop.dB = operator_args.mainloop.dA;
+    }
+    operator_args.epilogue.dC = cute::make_int_tuple_from<typename GemmKernel::StrideC>(
+        configuration->ldc, arguments->batch_stride_C);
+    operator_args.epilogue.dD = cute::make_int_tuple_from<typename GemmKernel::StrideD>(
+        configuration->ldd, arguments->batch_stride_D);
+
+    return Status::kSuccess;
+  }
+
+public:
+
+  /// Returns success if the operation can proceed
+  Status can_implement(
+    void const *configuration_ptr,
+    void const *arguments_ptr) const override {
+
+    OperatorArguments args;
+
+    Status status = update_arguments_(
+      args,
+      static_cast<RankKConfiguration const *>(configuration_ptr),
+      static_cast<RankKArguments const *>(arguments_ptr));
+
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    return Operator::can_implement(args);
+  }
+
+  /// Gets the host-side workspace
+  uint64_t get_host_workspace_size(
+    void const *configuration) const override {
+
+    return sizeof(HostWorkspace);
+  }
+
+  /// Gets the device-side workspace
+  uint64_t get_device_workspace_size(
+    void const *configuration_ptr,
+    void const *arguments_ptr = nullptr) const override {
+
+    if (!arguments_ptr) {
+      return 0;
+    }
+
+    OperatorArguments args;
+
+    Status status = update_arguments_(
+      args,
+      static_cast<RankKConfiguration const *>(configuration_ptr),
+      static_cast<RankKArguments const *>(arguments_ptr));
+
+    if (status != Status::kSuccess) {
+      return 0;
+    }
+
+    return Operator::get_workspace_size(args);
+  }
+
+  /// Initializes the workspace
+  Status initialize(
+    void const *configuration_ptr,
+    void *host_workspace,
+    void *device_workspace,
+    cudaStream_t stream = nullptr) const override {
+
+    HostWorkspace *workspace = new (host_workspace) HostWorkspace;
+    workspace->configuration = *static_cast<RankKConfiguration const *>(configuration_ptr);
+
+    return Status::kSuccess;
+  }
+
+  /// Runs the kernel
+  Status run(
+    void const *arguments_ptr,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const override {
+
+    OperationRange range(this->description(), stream);
+
+    HostWorkspace *workspace = static_cast<HostWorkspace *>(host_workspace);
+    RankKArguments const *arguments = static_cast<RankKArguments const *>(arguments_ptr);
+
+    OperatorArguments args;
+
+    Status status = update_arguments_(args, &workspace->configuration, arguments);
+
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    return workspace->op.run(args, device_workspace, stream, nullptr, arguments->use_pdl);
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::library
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
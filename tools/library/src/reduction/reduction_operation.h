@@ -41,6 +41,7 @@
 #include "cutlass/reduction/device/reduce_split_k.h"
 
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 #include "cutlass/core_io.h"
 
@@ -236,6 +237,8 @@ public:
     void *host_workspace, 
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
+
+    OperationRange range(this->description(), stream);
  
     OperatorArguments args;
 
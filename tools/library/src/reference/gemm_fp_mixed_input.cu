@@ -187,6 +187,35 @@ void initialize_gemm_reference_operations_fp_mixed_input(Manifest &manifest) {
     bfloat16_t,
     float
   >(manifest);
+
+  // 16-bit floating point mixed with FP8 input
+  make_gemm_real_canonical_layouts<
+    half_t,
+    float_e4m3_t,
+    half_t,
+    float
+  >(manifest);
+
+  make_gemm_real_canonical_layouts<
+    half_t,
+    float_e5m2_t,
+    half_t,
+    float
+  >(manifest);
+
+  make_gemm_real_canonical_layouts<
+    bfloat16_t,
+    float_e4m3_t,
+    bfloat16_t,
+    float
+  >(manifest);
+
+  make_gemm_real_canonical_layouts<
+    bfloat16_t,
+    float_e5m2_t,
+    bfloat16_t,
+    float
+  >(manifest);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/detail/collective.hpp"
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "cutlass/transform/kernel/sparse_gemm_compressor.hpp" // StructuredSparseCompressor
 #include "cutlass/transform/device/transform_universal_adapter.hpp" // TransformUniversalAdapter
 #include "cutlass/util/packed_stride.hpp"        // make_cute_packed_stride
@@ -341,36 +342,13 @@ public:
     CUDA_CHECK(cudaGetLastError());
 
     // * Compress DTensorA and get DTensorAC & DTensorE
-    cutlass::KernelHardwareInfo hw_info;
-    CUDA_CHECK(cudaGetDevice(&hw_info.device_id));
-    hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
-    typename Compressor::Arguments arguments{
-        {compressor_utility.M, 0, compressor_utility.K, compressor_utility.L},
-        {device_a_raw_ptr,
-         compressor_utility.dA,
-         device_a_compressed_ptr_iter1,
-         device_e_ptr_iter1},
-        {hw_info}
-    };
-
-    cutlass::Status status {cutlass::Status::kSuccess };
-
-    Compressor compressor_op;
-    status = compressor_op.can_implement(arguments);
+    cutlass::Status status = compress_(
+      compressor_utility, device_a_raw_ptr, device_a_compressed_ptr_iter1, device_e_ptr_iter1,
+      0, device_compressor_workspace_ptr_iter1, stream);
     if (status != Status::kSuccess) {
       return status;
     }
 
-    status = compressor_op.initialize(arguments, device_compressor_workspace_ptr_iter1, stream);
-    if (status != Status::kSuccess) {
-       return status;
-    }
-
-    status = compressor_op.run(stream);
-    if (status != Status::kSuccess) {
-       return status;
-    }
-
     // * Copy Iter1's DTensorAC DTensorE to each iteration's DTensorAC DTensorE
     for (int iter_i = 1; iter_i < problem_count; iter_i++) {
       // * Device AC E Ptr per iteration
@@ -400,6 +378,9 @@ public:
       void *device_workspace,
       cudaStream_t stream = nullptr) const override {
 
+    GemmUniversalArguments const *range_args = static_cast<GemmUniversalArguments const *>(arguments_ptr);
+    OperationRange range(this->description(), range_args->problem_size, range_args->batch_count, stream);
+
     OperatorArguments operator_args;
 
 
@@ -425,7 +406,89 @@ public:
     return status;
   }
 
+  /// Gets the buffer sizes needed to compress a dense A operand
+  Status get_compression_sizes(
+      void const *configuration_ptr,
+      SparseGemmCompressionSizes *sizes) const override {
+
+    CompressorUtility utility = make_compressor_utility_(
+      *static_cast<GemmUniversalConfiguration const *>(configuration_ptr));
+
+    typename Compressor::Arguments compress_arguments {
+      {utility.M, 0, utility.K, utility.L},
+      {/*Empty Not Use*/},
+      {/*Empty Not Use*/} };
+
+    sizes->tensor_a_compressed_bytes = utility.get_compressed_tensor_A_bytes();
+    sizes->tensor_e_bytes            = utility.get_tensor_E_bytes();
+    sizes->workspace_bytes           = Compressor::get_workspace_size(compress_arguments);
+    return Status::kSuccess;
+  }
+
+  /// Compresses a dense A operand into the compressed A and E operands consumed by run()
+  Status compress(
+      void const *configuration_ptr,
+      SparseGemmCompressionArguments const *arguments,
+      void *device_workspace,
+      cudaStream_t stream = nullptr) const override {
+
+    CompressorUtility utility = make_compressor_utility_(
+      *static_cast<GemmUniversalConfiguration const *>(configuration_ptr));
+
+    return compress_(
+      utility, arguments->A, arguments->A_compressed, arguments->E,
+      arguments->sm_count, device_workspace, stream);
+  }
+
 private:
+  /// Builds the compressor utility for a packed A operand of the configured problem
+  static CompressorUtility make_compressor_utility_(GemmUniversalConfiguration const &configuration) {
+    const int M = configuration.problem_size.m();
+    const int N = configuration.problem_size.n();
+    const int K = configuration.problem_size.k();
+    const int L = configuration.batch_count;
+    using StrideA = typename CompressorUtility::StrideA;
+    auto dA = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, L));
+    return CompressorUtility(cute::make_shape(M, N, K, L), dA);
+  }
+
+  /// Launches the compressor on `stream`
+  static Status compress_(
+      CompressorUtility const &utility,
+      void const *device_a_raw_ptr,
+      void *device_a_compressed_ptr,
+      void *device_e_ptr,
+      int sm_count,
+      void *device_compressor_workspace_ptr,
+      cudaStream_t stream) {
+
+    cutlass::KernelHardwareInfo hw_info;
+    CUDA_CHECK(cudaGetDevice(&hw_info.device_id));
+    hw_info.sm_count = sm_count > 0 ? sm_count :
+      cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    typename Compressor::Arguments arguments{
+        {utility.M, 0, utility.K, utility.L},
+        {device_a_raw_ptr,
+         utility.dA,
+         device_a_compressed_ptr,
+         device_e_ptr},
+        {hw_info}
+    };
+
+    Compressor compressor_op;
+    Status status = compressor_op.can_implement(arguments);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    status = compressor_op.initialize(arguments, device_compressor_workspace_ptr, stream);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    return compressor_op.run(stream);
+  }
+
   // Variables that must change in the const functions.
   mutable CompressorUtility compressor_utility;
   mutable int problem_count = 1;
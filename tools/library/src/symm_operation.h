@@ -43,6 +43,7 @@
 #include "cutlass/gemm/kernel/default_symm_universal.h"
 
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 #include "cutlass/core_io.h"
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -317,6 +318,9 @@ public:
     void *host_workspace, 
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
+
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
     
     Status status = update_arguments_(
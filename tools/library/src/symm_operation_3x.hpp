@@ -0,0 +1,350 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Defines symmetric matrix-matrix products (Symm) built from CUTLASS 3.x GEMM kernels.
+
+  Only the FillModeA triangle of the symmetric A is stored, and a TMA box cannot read the mirrored
+  half of a tile. The product D = alpha * A * B + beta * C for A on the left is therefore computed
+  by two triangular-A GEMMs (see Trmm3xOperation) issued back to back on the same stream:
+
+    D = alpha * tri(A) * B + beta * C                  FillModeA, stored diagonal
+    D = alpha * tri(A^T) * B + D                       opposite fill mode, zero diagonal
+
+  where the second kernel reads the same memory as A^T through the transposed layout.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/detail/collective.hpp"
+#include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
+#include "library_internal.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Operator_, typename OperatorTransposed_>
+class Symm3xOperation : public Operation {
+public:
+  using Operator = Operator_;
+  using OperatorTransposed = OperatorTransposed_;
+  using OperatorArguments = typename Operator::Arguments;
+  using OperatorTransposedArguments = typename OperatorTransposed::Arguments;
+  using GemmKernel = typename Operator::GemmKernel;
+  using GemmKernelTransposed = typename OperatorTransposed::GemmKernel;
+  using ElementA = typename Operator::ElementA;
+  using LayoutA = typename Operator::LayoutA;
+  using ElementB = typename Operator::ElementB;
+  using LayoutB = typename Operator::LayoutB;
+  using ElementC = typename Operator::ElementC;
+  using LayoutC = typename Operator::LayoutC;
+  using ElementAccumulator = typename Operator::ElementAccumulator;
+  using ElementCompute = typename Operator::EpilogueOutputOp::ElementCompute;
+
+  static FillMode const kFillModeA = GemmKernel::CollectiveMainloop::kFillModeA;
+
+  static_assert(GemmKernel::CollectiveMainloop::kDiagTypeA == DiagType::kNonUnit &&
+                GemmKernelTransposed::CollectiveMainloop::kDiagTypeA == DiagType::kZero,
+    "The stored triangle of A includes the diagonal, the mirrored triangle excludes it.");
+  static_assert(GemmKernelTransposed::CollectiveMainloop::kFillModeA != kFillModeA,
+    "The mirrored triangle of A must use the opposite fill mode.");
+  static_assert(cute::is_same_v<typename OperatorTransposed::ElementA, ElementA> &&
+                cute::is_same_v<typename OperatorTransposed::LayoutA, typename layout::LayoutTranspose<LayoutA>::type>,
+    "The mirrored triangle of A is read through the transposed layout.");
+
+private:
+
+  /// The configuration is only passed to initialize(), so it is kept next to the operators
+  struct HostWorkspace {
+    Operator op;
+    OperatorTransposed op_transposed;
+    SymmConfiguration configuration;
+  };
+
+  SymmDescription description_;
+
+public:
+
+  /// Constructor
+  Symm3xOperation(char const *name = "unknown_symm") {
+
+    description_.name = name;
+    description_.provider = Provider::kCUTLASS;
+    description_.symm_kind = SymmKind::kUniversal;
+    description_.side_mode = SideMode::kLeft;
+    description_.fill_mode = kFillModeA;
+    description_.blas_mode = BlasMode::kSymmetric;
+
+    description_.kind = OperationKind::kSymm;
+
+    description_.tile_description.threadblock_shape = make_Coord(
+      Operator::ThreadblockShape::kM,
+      Operator::ThreadblockShape::kN,
+      Operator::ThreadblockShape::kK);
+
+    description_.tile_description.cluster_shape = make_Coord(
+      Operator::ClusterShape::kM,
+      Operator::ClusterShape::kN,
+      Operator::ClusterShape::kK);
+
+    description_.tile_description.threadblock_stages = Operator::kStages;
+
+    description_.tile_description.warp_count = make_Coord(
+      Operator::WarpCount::kM,
+      Operator::WarpCount::kN,
+      Operator::WarpCount::kK);
+
+    description_.tile_description.math_instruction.instruction_shape = make_Coord(
+      Operator::InstructionShape::kM,
+      Operator::InstructionShape::kN,
+      Operator::InstructionShape::kK);
+
+    description_.tile_description.math_instruction.element_accumulator =
+      NumericTypeMap<ElementAccumulator>::kId;
+
+    description_.tile_description.math_instruction.opcode_class =
+      OpcodeClassMap<typename Operator::OperatorClass>::kId;
+
+    description_.tile_description.math_instruction.math_operation =
+      MathOperationMap<typename Operator::MathOperator>::kId;
+
+    description_.tile_description.minimum_compute_capability =
+      ArchMap<typename Operator::ArchTag, typename Operator::OperatorClass>::kMin;
+
+    description_.tile_description.maximum_compute_capability =
+      ArchMap<typename Operator::ArchTag, typename Operator::OperatorClass>::kMax;
+
+    description_.A = make_TensorDescription<ElementA, LayoutA>(Operator::kAlignmentA);
+    description_.B = make_TensorDescription<ElementB, LayoutB>(Operator::kAlignmentB);
+    description_.C = make_TensorDescription<ElementC, LayoutC>(Operator::kAlignmentC);
+    description_.element_epilogue = NumericTypeMap<ElementCompute>::kId;
+
+    description_.split_k_mode = SplitKMode::kNone;
+    description_.transform_A = ComplexTransform::kNone;
+    description_.transform_B = ComplexTransform::kNone;
+  }
+
+  /// Returns the description of the SYMM operation
+  OperationDescription const & description() const override {
+    return description_;
+  }
+
+protected:
+
+  /// Constructs the arguments of both kernels given the configuration and arguments
+  static Status update_arguments_(
+    OperatorArguments &operator_args,
+    OperatorTransposedArguments &operator_transposed_args,
+    SymmConfiguration const *configuration,
+    SymmArguments const *arguments) {
+
+    // The mirrored triangle accumulates onto the D written by the stored one
+    ElementCompute const one(1);
+    if (arguments->pointer_mode == ScalarPointerMode::kHost) {
+      operator_args.epilogue.thread = typename Operator::EpilogueOutputOp::Params(
+        *static_cast<ElementCompute const *>(arguments->alpha),
+        *static_cast<ElementCompute const *>(arguments->beta));
+      operator_transposed_args.epilogue.thread = typename OperatorTransposed::EpilogueOutputOp::Params(
+        *static_cast<ElementCompute const *>(arguments->alpha), one);
+    }
+    else if (arguments->pointer_mode == ScalarPointerMode::kDevice) {
+      operator_args.epilogue.thread = typename Operator::EpilogueOutputOp::Params(
+        static_cast<ElementCompute const *>(arguments->alpha),
+        static_cast<ElementCompute const *>(arguments->beta));
+      typename OperatorTransposed::EpilogueOutputOp::Params params(ElementCompute(0), one);
+      params.alpha_ptr = static_cast<ElementCompute const *>(arguments->alpha);
+      operator_transposed_args.epilogue.thread = params;
+    }
+    else {
+      return Status::kErrorInvalidProblem;
+    }
+
+    operator_args.mode = configuration->batch_count > 1 ?
+      gemm::GemmUniversalMode::kBatched : gemm::GemmUniversalMode::kGemm;
+    operator_transposed_args.mode = operator_args.mode;
+
+    // A is M x M on the left of the M x N matrix B
+    operator_args.problem_shape = cute::make_shape(
+      configuration->problem_size.m(),
+      configuration->problem_size.n(),
+      configuration->problem_size.m(),
+      configuration->batch_count);
+    operator_transposed_args.problem_shape = operator_args.problem_shape;
+
+    operator_args.mainloop.ptr_A = static_cast<ElementA const *>(arguments->A);
+    operator_args.mainloop.ptr_B = static_cast<ElementB const *>(arguments->B);
+    operator_args.epilogue.ptr_C = static_cast<ElementC const *>(arguments->C);
+    operator_args.epilogue.ptr_D = static_cast<ElementC       *>(arguments->D);
+
+    operator_args.mainloop.dA = cute::make_int_tuple_from<typename GemmKernel::StrideA>(
+        configuration->lda, arguments->batch_stride_A);
+    operator_args.mainloop.dB = cute::make_int_tuple_from<typename GemmKernel::StrideB>(
+        configuration->ldb, arguments->batch_stride_B);
+    operator_args.epilogue.dC = cute::make_int_tuple_from<typename GemmKernel::StrideC>(
+        configuration->ldc, arguments->batch_stride_C);
+    operator_args.epilogue.dD = cute::make_int_tuple_from<typename GemmKernel::StrideD>(
+        configuration->ldd, arguments->batch_stride_D);
+
+    // Same memory, A^T through the transposed layout
+    operator_transposed_args.mainloop.ptr_A = static_cast<ElementA const *>(arguments->A);
+    operator_transposed_args.mainloop.ptr_B = static_cast<ElementB const *>(arguments->B);
+    operator_transposed_args.epilogue.ptr_C = static_cast<ElementC const *>(arguments->D);
+    operator_transposed_args.epilogue.ptr_D = static_cast<ElementC       *>(arguments->D);
+
+    operator_transposed_args.mainloop.dA = cute::make_int_tuple_from<typename GemmKernelTransposed::StrideA>(
+        configuration->lda, arguments->batch_stride_A);
+    operator_transposed_args.mainloop.dB = cute::make_int_tuple_from<typename GemmKernelTransposed::StrideB>(
+        configuration->ldb, arguments->batch_stride_B);
+    operator_transposed_args.epilogue.dC = cute::make_int_tuple_from<typename GemmKernelTransposed::StrideC>(
+        configuration->ldd, arguments->batch_stride_D);
+    operator_transposed_args.epilogue.dD = cute::make_int_tuple_from<typename GemmKernelTransposed::StrideD>(
+        configuration->ldd, arguments->batch_stride_D);
+
+    return Status::kSuccess;
+  }
+
+public:
+
+  /// Returns success if the operation can proceed
+  Status can_implement(
+    void const *configuration_ptr,
+    void const *arguments_ptr) const override {
+
+    OperatorArguments args;
+    OperatorTransposedArguments args_transposed;
+
+    Status status = update_arguments_(
+      args,
+      args_transposed,
+      static_cast<SymmConfiguration const *>(configuration_ptr),
+      static_cast<SymmArguments const *>(arguments_ptr));
+
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    status = Operator::can_implement(args);
+
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    return OperatorTransposed::can_implement(args_transposed);
+  }
+
+  /// Gets the host-side workspace
+  uint64_t get_host_workspace_size(
+    void const *configuration) const override {
+
+    return sizeof(HostWorkspace);
+  }
+
+  /// Gets the device-side workspace, shared by the two kernels that run one after the other
+  uint64_t get_device_workspace_size(
+    void const *configuration_ptr,
+    void const *arguments_ptr = nullptr) const override {
+
+    if (!arguments_ptr) {
+      return 0;
+    }
+
+    OperatorArguments args;
+    OperatorTransposedArguments args_transposed;
+
+    Status status = update_arguments_(
+      args,
+      args_transposed,
+      static_cast<SymmConfiguration const *>(configuration_ptr),
+      static_cast<SymmArguments const *>(arguments_ptr));
+
+    if (status != Status::kSuccess) {
+      return 0;
+    }
+
+    return std::max(
+      static_cast<uint64_t>(Operator::get_workspace_size(args)),
+      static_cast<uint64_t>(OperatorTransposed::get_workspace_size(args_transposed)));
+  }
+
+  /// Initializes the workspace
+  Status initialize(
+    void const *configuration_ptr,
+    void *host_workspace,
+    void *device_workspace,
+    cudaStream_t stream = nullptr) const override {
+
+    HostWorkspace *workspace = new (host_workspace) HostWorkspace;
+    workspace->configuration = *static_cast<SymmConfiguration const *>(configuration_ptr);
+
+    return Status::kSuccess;
+  }
+
+  /// Runs the two kernels
+  Status run(
+    void const *arguments_ptr,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const override {
+
+    OperationRange range(this->description(), stream);
+
+    HostWorkspace *workspace = static_cast<HostWorkspace *>(host_workspace);
+    SymmArguments const *arguments = static_cast<SymmArguments const *>(arguments_ptr);
+
+    OperatorArguments args;
+    OperatorTransposedArguments args_transposed;
+
+    Status status = update_arguments_(args, args_transposed, &workspace->configuration, arguments);
+
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    status = workspace->op.run(args, device_workspace, stream, nullptr, arguments->use_pdl);
+
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    return workspace->op_transposed.run(args_transposed, device_workspace, stream, nullptr, arguments->use_pdl);
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::library
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,7 @@
 #include "cutlass/gemm/kernel/trmm_universal.h"
 
 #include "cutlass/library/library.h"
+#include "cutlass/library/operation_trace.h"
 #include "library_internal.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,6 +311,8 @@ public:
     void *device_workspace = nullptr, 
     cudaStream_t stream = nullptr) const {
 
+    OperationRange range(this->description(), stream);
+
     OperatorArguments args;
     
     Status status = update_arguments_(
@@ -341,6 +341,8 @@ OperationKind_enumerants[] = {
   {"conv2d", "Conv2d", OperationKind::kConv2d},           
   {"conv3d", "Conv3d", OperationKind::kConv3d},           
   {"spgemm", "SparseGemm", OperationKind::kSparseGemm},
+  {"grouped_gemm", "GroupedGemm", OperationKind::kGroupedGemm},
+  {"dist_gemm", "DistributedGemm", OperationKind::kDistributedGemm},
 };
 
 /// Converts a Status enumerant to a string
@@ -929,6 +931,7 @@ IteratorAlgorithmID_enumerants[] = {
   {"optimized", "<optimized>", IteratorAlgorithmID::kOptimized},
   {"fixed_channels", "<fixed_channels>", IteratorAlgorithmID::kFixedChannels},
   {"few_channels", "<few_channels>", IteratorAlgorithmID::kFewChannels},
+  {"winograd", "<winograd>", IteratorAlgorithmID::kWinograd},
 };
 
 /// Converts a ConvModeID enumerant to a string
@@ -35,6 +35,8 @@
 #pragma once
 
 #if CUTLASS_ENABLE_CUBLAS
+#include <vector>
+
 #include <cublas_v2.h>
 #include <cublasLt.h>
 
@@ -250,6 +252,65 @@ struct cublasGemmExDispatcher {
   cublasStatus_t operator()(cublasHandle_t handle);
 };
 
+#if defined(CUBLAS_VERSION) && (CUBLAS_VERSION >= 120500)
+#define CUTLASS_PROFILER_CUBLAS_GROUPED_GEMM_ENABLED
+
+/// Dispatcher to cublasGemmGroupedBatchedEx() computing each problem of a grouped GEMM as a group of one.
+/// cuBLAS updates C in place, so C doubles as the output. Row-major C is computed as the transposed problem.
+struct cublasGemmGroupedDispatcher {
+
+  //
+  // Data members
+  //
+
+  cudaDataType_t data_type_A;
+  cudaDataType_t data_type_B;
+  cudaDataType_t data_type_C;
+  cublasComputeType_t compute_type;
+
+  // Per-group cublas API call arguments
+  std::vector<cublasOperation_t> trans_first;
+  std::vector<cublasOperation_t> trans_second;
+  std::vector<int> m;
+  std::vector<int> n;
+  std::vector<int> k;
+  std::vector<int> ld_first;
+  std::vector<int> ld_second;
+  std::vector<int> ldc;
+  std::vector<int> group_size;
+  std::vector<uint8_t> alpha;
+  std::vector<uint8_t> beta;
+
+  // Device arrays of per-group pointers
+  void const * const *ptr_first;
+  void const * const *ptr_second;
+  void * const *ptr_C;
+
+  Status status;
+
+  //
+  // Methods
+  //
+
+  cublasGemmGroupedDispatcher(
+    library::GemmDescription const &op_desc,
+    std::vector<gemm::GemmCoord> const &problem_sizes,
+    std::vector<int64_t> const &lda,
+    std::vector<int64_t> const &ldb,
+    std::vector<int64_t> const &ldc,
+    void const *alpha,
+    void const *beta,
+    void const * const *ptr_A,
+    void const * const *ptr_B,
+    void * const *ptr_C
+  );
+
+  /// Executes the grouped GEMM using these arguments
+  cublasStatus_t operator()(cublasHandle_t handle);
+};
+
+#endif // CUBLAS_VERSION >= 120500
+
 /// Dispatcher to cublaslt kernels 
 //
 struct cublasLtGemmExDispatcher {
@@ -76,6 +76,12 @@ private:
   /// Profiles all operations
   int profile_();
 
+  /// Profiles all operations with the sweep sharded across the listed devices
+  int profile_parallel_();
+
+  /// Constructs the entry points for each operation
+  static OperationProfilerVector make_operation_profilers_(Options const &options);
+
 public:
 
   CutlassProfiler(Options const &options);
@@ -231,6 +231,9 @@ public:
   /// Writes a tensor to csv
   void write_tensor_csv(std::ostream &out);
 
+  /// Writes a tensor to a binary NumPy .npy file, streaming it from device memory
+  void write_tensor_npy(std::string const &path);
+
 private:
   /// A wrapper that sets the device, performs malloc, and sets back
   cudaError_t malloc(void** ptr, size_t size);
@@ -0,0 +1,160 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Device clock, power and thermal telemetry sampled through NVML
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "cutlass/cutlass.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Clock, power and thermal state of a device over one measurement
+struct DeviceTelemetry {
+
+  /// True if telemetry was sampled during the measurement
+  bool valid{false};
+
+  /// Lowest SM and memory clocks observed (MHz)
+  unsigned sm_clock{0};
+  unsigned memory_clock{0};
+
+  /// Highest power draw (W) and GPU temperature (C) observed
+  double power{0};
+  unsigned temperature{0};
+
+  /// Union of the NVML clock throttle reasons observed
+  uint64_t throttle_reasons{0};
+
+  /// Time the device spent in power or thermal violation during the measurement (ms)
+  double violation_time{0};
+
+  //
+  // Methods
+  //
+
+  /// Returns true if power or thermal limits slowed the device during the measurement. Clocks held
+  /// back by an idle device or by the application clock setting do not count.
+  bool throttled() const;
+
+  /// Folds an instantaneous sample into the measurement
+  void accumulate(DeviceTelemetry const &sample);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Samples the telemetry of one CUDA device over successive measurements. If the profiler is built
+/// without NVML or NVML cannot be initialized, measurements yield invalid telemetry.
+class DeviceTelemetryMonitor {
+private:
+
+  /// NVML device handle, or null if unavailable
+  void *device_{nullptr};
+
+  /// Cumulative power and thermal violation time at the start of the measurement (ns)
+  unsigned long long violation_start_[2]{0, 0};
+
+  /// Measurement in progress
+  DeviceTelemetry measurement_;
+
+  /// Samples the instantaneous state of the device
+  DeviceTelemetry sample_() const;
+
+  /// Reads the cumulative power and thermal violation times (ns)
+  void violation_time_(unsigned long long (&time)[2]) const;
+
+public:
+
+  /// Ctor from a CUDA device ordinal
+  explicit DeviceTelemetryMonitor(int device);
+
+  DeviceTelemetryMonitor(DeviceTelemetryMonitor const &) = delete;
+  DeviceTelemetryMonitor &operator=(DeviceTelemetryMonitor const &) = delete;
+
+  ~DeviceTelemetryMonitor();
+
+  /// Returns true if telemetry is available for the device
+  bool good() const { return device_ != nullptr; }
+
+  /// Starts a measurement
+  void begin();
+
+  /// Samples the device while the measured work executes
+  void sample();
+
+  /// Completes the measurement and returns the telemetry observed since begin()
+  DeviceTelemetry end();
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Locks the SM clock of a CUDA device for the lifetime of the object, restoring the default clock
+/// policy on destruction. Locking usually requires administrator privileges.
+class DeviceClockLock {
+private:
+
+  /// NVML device handle, or null if unavailable
+  void *device_{nullptr};
+
+  /// How the clock was locked
+  enum class Method { kNone, kLockedClocks, kApplicationClocks } method_{Method::kNone};
+
+  /// Locked SM clock (MHz)
+  unsigned sm_clock_{0};
+
+public:
+
+  /// Locks the SM clock of the device to `sm_clock` MHz, or to its default application clock if
+  /// `sm_clock` is negative
+  DeviceClockLock(int device, int sm_clock);
+
+  DeviceClockLock(DeviceClockLock const &) = delete;
+  DeviceClockLock &operator=(DeviceClockLock const &) = delete;
+
+  ~DeviceClockLock();
+
+  /// Returns true if the clock is locked
+  bool locked() const { return method_ != Method::kNone; }
+
+  /// Locked SM clock (MHz)
+  unsigned sm_clock() const { return sm_clock_; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
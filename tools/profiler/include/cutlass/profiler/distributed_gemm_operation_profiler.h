@@ -0,0 +1,210 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Profiler for tensor-parallel GEMMs distributed across devices
+*/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// CUTLASS Library includes
+#include "cutlass/library/library.h"
+#include "cutlass/library/util.h"
+#include "cutlass/library/manifest.h"
+
+// Profiler includes
+#include "options.h"
+#include "device_context.h"
+#include "operation_profiler.h"
+#include "performance_result.h"
+#include "problem_space.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Distributed GEMM compiled into the profiler for one schedule and tensor-parallel size. Distributed
+/// GEMMs run on several devices at once, so they are not library operations in the manifest.
+class DistributedGemmInstance {
+public:
+
+  virtual ~DistributedGemmInstance() { }
+
+  /// Procedural name of the instance
+  virtual std::string name() const = 0;
+
+  /// Name of the schedule in cutlass::distributed::schedules
+  virtual char const *schedule() const = 0;
+
+  /// Tensor-parallel size, which is the number of devices
+  virtual int tp() const = 0;
+
+  /// Threadblock and cluster shapes of the GEMM kernel run on each device
+  virtual gemm::GemmCoord tile_shape() const = 0;
+  virtual gemm::GemmCoord cluster_shape() const = 0;
+
+  /// Returns true if the schedule can shard the global problem
+  virtual bool can_implement(gemm::GemmCoord problem_size) const = 0;
+
+  /// GEMM computed by each device in each iteration
+  virtual gemm::GemmCoord local_gemm_shape(gemm::GemmCoord problem_size) const = 0;
+
+  /// Number of iterations each device performs
+  virtual int iterations() const = 0;
+
+  /// Bytes each device exchanges with its peers in one distributed GEMM
+  virtual int64_t peer_bytes(gemm::GemmCoord problem_size) const = 0;
+
+  /// Allocates operands on each device and initializes the distributed GEMM. `devices` lists
+  /// tp() devices with peer access to each other.
+  virtual Status initialize(
+    gemm::GemmCoord problem_size,
+    std::vector<int> const &devices,
+    std::vector<cudaStream_t> const &streams) = 0;
+
+  /// Launches the distributed GEMM on one device
+  virtual Status run(int device_index, cudaStream_t stream) = 0;
+
+  /// Launches only the local GEMMs of every iteration on one device, without communication
+  virtual Status run_compute(int device_index, cudaStream_t stream) = 0;
+
+  /// Launches only the peer transfers of every iteration on one device, without computation
+  virtual Status run_communication(int device_index, cudaStream_t stream) = 0;
+
+  /// Releases device allocations
+  virtual void release() = 0;
+};
+
+/// Vector of owning distributed GEMM instances
+using DistributedGemmInstanceVector = std::vector<std::unique_ptr<DistributedGemmInstance>>;
+
+/// Returns the distributed GEMMs compiled into the profiler, which is empty unless the profiler is
+/// built for SM90a with CUDA 12.4 or later
+DistributedGemmInstanceVector make_distributed_gemm_instances();
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Profiles distributed GEMM schedules over tensor-parallel sizes. Each distributed GEMM is compared
+/// against running only its local GEMMs and only its peer transfers to measure how well the
+/// schedule overlaps communication with computation.
+class DistributedGemmOperationProfiler : public OperationProfiler {
+private:
+
+  /// Instances compiled into the profiler
+  DistributedGemmInstanceVector instances_;
+
+  /// Columns appended to the report after the problem space arguments
+  static std::vector<std::string> const kResultColumns;
+
+  /// Times `launch` running concurrently on the first `devices.size()` devices, returning the
+  /// average runtime of the slowest device (ms)
+  Status time_on_devices_(
+    double &runtime,
+    Options const &options,
+    std::vector<int> const &devices,
+    std::vector<cudaStream_t> const &streams,
+    std::function<Status(int, cudaStream_t)> const &launch);
+
+  /// Profiles one instance on one problem
+  Status profile_instance_(
+    PerformanceResult &result,
+    Options const &options,
+    DistributedGemmInstance &instance,
+    gemm::GemmCoord problem_size,
+    std::vector<int> const &devices);
+
+public:
+
+  DistributedGemmOperationProfiler(Options const &options);
+
+  virtual ~DistributedGemmOperationProfiler();
+
+  /// Prints usage statement for the math function
+  virtual void print_usage(std::ostream &out) const;
+
+  /// Prints examples
+  virtual void print_examples(std::ostream &out) const;
+
+  /// Profiles the compiled instances over the problem space. Runs only if distributed GEMMs are
+  /// selected explicitly with --operation=DistributedGemm.
+  virtual int profile_all(
+    Options const &options,
+    library::Manifest const &manifest,
+    DeviceContext &device_context);
+
+  //
+  // Distributed GEMMs are not library operations, so the per-operation phases are unused
+  //
+
+  virtual Status initialize_configuration(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem) { return Status::kErrorNotSupported; }
+
+  virtual Status initialize_workspace(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem) { return Status::kErrorNotSupported; }
+
+  virtual bool verify_cutlass(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem) { return true; }
+
+  virtual bool profile(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem) { return true; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
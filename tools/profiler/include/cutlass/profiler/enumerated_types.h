@@ -125,6 +125,39 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// File format of saved workspaces
+enum class WorkspaceFormat {
+  kCsv,         ///< text matrices written through tensor_view_io.h
+  kNpy,         ///< binary NumPy arrays streamed from device memory
+  kInvalid
+};
+
+/// Converts a WorkspaceFormat enumerant to a string
+char const *to_string(WorkspaceFormat format, bool pretty = false);
+
+/// Parses a WorkspaceFormat enumerant from a string
+template <>
+WorkspaceFormat from_string<WorkspaceFormat>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Background load run on the device while kernels are timed
+enum class InterferenceLoad {
+  kNone,
+  kBandwidth,   ///< streams through a buffer larger than the L2 to contend for DRAM bandwidth
+  kOccupancy,   ///< holds SMs with idle persistent thread blocks
+  kInvalid
+};
+
+/// Converts an InterferenceLoad enumerant to a string
+char const *to_string(InterferenceLoad load, bool pretty = false);
+
+/// Parses an InterferenceLoad enumerant from a string
+template <>
+InterferenceLoad from_string<InterferenceLoad>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Indicates the type of kernel argument
 // ArgumentType can be both ScalarType or NumericType. Thus, enums kScalar and kNumeric
 // 1) kScalar: e.g. of a Scalar ArgumentType is u32 is a Scalar type.
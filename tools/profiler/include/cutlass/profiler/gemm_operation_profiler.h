@@ -94,6 +94,9 @@ public:
 
     bool use_pdl{false};
 
+    // structured-sparse GEMMs: also profile compressing the dense A operand
+    bool sparse_compression{false};
+
     //
     // Methods
     //
@@ -126,6 +129,12 @@ public:
     DeviceAllocation *Computed{nullptr};
     DeviceAllocation *Reference{nullptr};
 
+    /// Operands of a fused epilogue, allocated only when the operation consumes them
+    DeviceAllocation *Bias{nullptr};
+    DeviceAllocation *Aux{nullptr};
+    DeviceAllocation *ScaleFactors{nullptr};
+    DeviceAllocation *Amax{nullptr};
+
     /// Number of copies of the problem workspace which are visited sequentially during
     /// profiling to avoid camping in the last level cache.
     int problem_count{1};
@@ -139,6 +148,9 @@ public:
     /// Buffer used for the operations' device workspace
     DeviceAllocation device_workspace;
 
+    /// Buffer holding the compressed A, metadata and compressor workspace of a sparse GEMM
+    DeviceAllocation compression_workspace;
+
     /// Library configuration and arguments for reduction operator
     library::ReductionConfiguration reduction_configuration;
     library::ReductionArguments reduction_arguments;
@@ -221,6 +233,13 @@ public:
 
 protected:
 
+  /// Relative roofline cost of the operation derived from tile and wave quantization
+  virtual double modeled_cost_(
+    Options const &options,
+    library::OperationDescription const &op_desc,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem) const;
+
   /// Initializes the performance result
   void initialize_result_(
     PerformanceResult &result,
@@ -228,6 +247,9 @@ protected:
     library::GemmDescription const &operation_desc,
     ProblemSpace const &problem_space);
 
+  /// Points the bias and auxiliary output of a fused epilogue at the given batch of the workspace
+  void set_epilogue_fusion_arguments_(GemmWorkspace &workspace, int problem_idx);
+
   /// Verifies CUTLASS against references
   bool verify_with_cublas_(
     Options const &options,
@@ -258,6 +280,13 @@ protected:
     void *host_workspace,
     void *device_workspace);
 
+  /// Profiles compressing the dense A operand of a structured-sparse GEMM, appending a compression
+  /// result and an end-to-end (compression followed by GEMM) result after `gemm_result`
+  Status profile_sparse_compression_(
+    Options const &options,
+    library::Operation const *operation,
+    PerformanceResult const &gemm_result);
+
   /// Initialize reduction problem dimensions and library::Operation
   bool initialize_reduction_configuration_(
     library::Operation const *operation,
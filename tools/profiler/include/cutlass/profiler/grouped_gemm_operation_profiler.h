@@ -0,0 +1,259 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Profiler for grouped GEMM operations (GemmKind::kGrouped)
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <unordered_map>
+
+// CUTLASS Library includes
+#include "cutlass/library/library.h"
+#include "cutlass/library/util.h"
+#include "cutlass/library/manifest.h"
+
+// Profiler includes
+#include "options.h"
+#include "device_context.h"
+#include "operation_profiler.h"
+#include "performance_result.h"
+#include "problem_space.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Profiles grouped GEMMs, which compute a list of independent GEMM problems in one kernel launch
+class GroupedGemmOperationProfiler : public OperationProfiler {
+public:
+
+  /// Problem structure obtained from problem space and command line
+  struct GroupedGemmProblem {
+
+    /// Problem size of each group. Groups with an empty M extent are allowed.
+    std::vector<gemm::GemmCoord> problem_sizes;
+
+    std::vector<int64_t> lda;
+    std::vector<int64_t> ldb;
+    std::vector<int64_t> ldc;
+
+    std::vector<uint8_t> alpha;
+    std::vector<uint8_t> beta;
+
+    /// Parameters of the synthesized workload when problem sizes are not listed explicitly
+    int64_t groups{8};
+    int64_t m{1024};
+    int64_t n{1024};
+    int64_t k{1024};
+    double skew{0};
+
+    /// True if problem sizes were given by --problem-sizes or --problem-sizes-file
+    bool listed{false};
+
+    //
+    // Methods
+    //
+
+    /// Parses the problem
+    Status parse(
+      library::GemmDescription const &operation_desc,
+      Options const &options,
+      ProblemSpace const &problem_space,
+      ProblemSpace::Problem const &problem);
+
+    /// Total number of bytes loaded
+    int64_t bytes(library::GemmDescription const &operation_desc) const;
+
+    /// Total number of flops computed
+    int64_t flops(library::GemmDescription const &operation_desc) const;
+
+    /// Number of groups
+    int problem_count() const { return int(problem_sizes.size()); }
+
+    /// Initializes a performance result
+    void initialize_result(
+      PerformanceResult &result,
+      library::GemmDescription const &operation_desc,
+      ProblemSpace const &problem_space);
+  };
+
+  /// Workspace used
+  struct GroupedGemmWorkspace {
+
+    /// Per-group operands. Empty groups have null entries.
+    std::vector<DeviceAllocation *> A;
+    std::vector<DeviceAllocation *> B;
+    std::vector<DeviceAllocation *> C;
+    std::vector<DeviceAllocation *> Computed;
+    std::vector<DeviceAllocation *> Reference;
+
+    /// Device arrays of problem sizes, leading dimensions and per-group pointers
+    DeviceAllocation problem_sizes;
+    DeviceAllocation lda;
+    DeviceAllocation ldb;
+    DeviceAllocation ldc;
+    DeviceAllocation ptr_A;
+    DeviceAllocation ptr_B;
+    DeviceAllocation ptr_C;
+    DeviceAllocation ptr_Computed;
+    DeviceAllocation ptr_Reference;
+
+    library::GemmGroupedConfiguration configuration;
+    library::GemmGroupedArguments arguments;
+
+    /// Buffer used for the operation's host workspace
+    std::vector<uint8_t> host_workspace;
+
+    /// Buffer used for the operations' device workspace
+    DeviceAllocation device_workspace;
+  };
+
+protected:
+
+  //
+  // Data members
+  //
+
+  /// Grouped GEMM problem obtained from problem space
+  GroupedGemmProblem problem_;
+
+  /// Device memory allocations
+  GroupedGemmWorkspace gemm_workspace_;
+
+  /// Data types, scalars and problem sizes of the last cuBLAS measurement
+  std::string cublas_profiled_key_;
+
+public:
+  //
+  // Methods
+  //
+
+  /// Ctor
+  GroupedGemmOperationProfiler(Options const &options);
+
+  /// Destructor
+  virtual ~GroupedGemmOperationProfiler();
+
+  /// Prints usage statement for the math function
+  virtual void print_usage(std::ostream &out) const;
+
+  /// Prints examples
+  virtual void print_examples(std::ostream &out) const;
+
+  /// Extracts the problem dimensions
+  virtual Status initialize_configuration(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+  /// Initializes workspace
+  virtual Status initialize_workspace(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+  /// Verifies CUTLASS against references
+  virtual bool verify_cutlass(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+  /// Measures performance results
+  virtual bool profile(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+protected:
+
+  /// Grouped GEMMs are registered as GEMM operations of GemmKind::kGrouped
+  virtual bool profiles_operation_kind_(library::OperationDescription const &op_desc) const;
+
+  /// Initializes the performance result
+  void initialize_result_(
+    PerformanceResult &result,
+    Options const &options,
+    library::GemmDescription const &operation_desc,
+    ProblemSpace const &problem_space);
+
+  /// Sets the arguments to compute into the Computed tensors
+  void set_cutlass_arguments_();
+
+  /// Verifies CUTLASS against cuBLAS grouped GEMM
+  bool verify_with_cublas_(
+    Options const &options,
+    DeviceContext &device_context,
+    library::Operation const *operation);
+
+  /// Verifies CUTLASS against host and device references, one group at a time
+  bool verify_with_reference_(
+    Options const &options,
+    DeviceContext &device_context,
+    library::Operation const *operation);
+
+  /// Compares each group's Computed tensor against its Reference tensor
+  Disposition compare_groups_(Options const &options);
+
+  /// Restores each group's Reference tensor to C, as cuBLAS updates C in place
+  void reset_reference_();
+
+  /// Measures cuBLAS grouped GEMM on the same problem for comparison
+  bool profile_cublas_(
+    Options const &options,
+    library::Operation const *operation);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,83 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Background device load used to profile kernels under contention
+*/
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "cutlass/cutlass.h"
+#include "enumerated_types.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs a persistent background kernel on the current device for the lifetime of the object. Each
+/// thread block of the background kernel reserves all of the shared memory of an SM, so that the
+/// profiled kernel is confined to the remaining SMs. The blocks either stream through a buffer
+/// larger than the L2 to contend for DRAM bandwidth or idle to merely occupy their SMs.
+class InterferenceGenerator {
+private:
+
+  /// Host-mapped flags shared with the background kernel
+  struct Flags;
+
+  Flags *flags_{nullptr};
+
+  /// Non-blocking stream running the background kernel
+  cudaStream_t stream_{nullptr};
+
+  /// Buffer streamed through by the bandwidth load
+  void *buffer_{nullptr};
+
+  /// Releases the background kernel and frees its resources
+  void release_();
+
+public:
+
+  /// Launches the background load on `sm_count` SMs of the current device and waits until all of
+  /// its thread blocks are resident. At least one SM is left free for the profiled kernel.
+  InterferenceGenerator(InterferenceLoad load, int sm_count);
+
+  InterferenceGenerator(InterferenceGenerator const &) = delete;
+  InterferenceGenerator &operator=(InterferenceGenerator const &) = delete;
+
+  ~InterferenceGenerator();
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
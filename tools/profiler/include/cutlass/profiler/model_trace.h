@@ -0,0 +1,125 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Replays the GEMM and convolution calls of one model step
+*/
+
+#pragma once
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "options.h"
+#include "operation_profiler.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// One call of a model trace
+struct ModelTraceOperation {
+
+  /// Name of the call within the model (e.g. qkv_proj)
+  std::string label;
+
+  /// Number of times the call is made per step
+  int count{1};
+
+  /// Profiler arguments describing the problem (e.g. {"operation", "Gemm"}, {"m", "4096"})
+  std::vector<std::pair<std::string, std::string>> arguments;
+};
+
+/// Sequence of calls one model step makes. Traces are text files with one call per line:
+///
+///   <label> [--count=<int>] --operation=<kind> --<argument>=<value> ...
+///
+/// where the arguments are those accepted by the profiler for the operation kind. Text following
+/// '#' is ignored.
+struct ModelTrace {
+
+  /// Trace name
+  std::string name;
+
+  /// Calls in the order they are made
+  std::vector<ModelTraceOperation> operations;
+
+  //
+  // Methods
+  //
+
+  /// Loads a built-in trace by name or a trace file by path
+  static ModelTrace load(std::string const &name_or_path);
+
+  /// Parses a trace
+  static ModelTrace parse(std::string const &name, std::istream &in);
+
+  /// Returns the names of the built-in traces
+  static std::vector<std::string> builtin_names();
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Profiles each call of a model trace, then replays the fastest kernel of every call back to back
+/// to measure the step end-to-end. The replay captures effects a per-problem sweep misses, such as
+/// L2 reuse between consecutive calls and the share of the step spent launching kernels.
+class ModelTraceProfiler {
+public:
+
+  /// Constructs the operation profilers for a set of options
+  using OperationProfilerFactory = std::function<OperationProfilerVector(Options const &)>;
+
+private:
+
+  /// Options of the run
+  Options const &options_;
+
+  /// Constructs operation profilers for the calls of the trace
+  OperationProfilerFactory make_operation_profilers_;
+
+  /// Returns the command line of the run with the arguments of a call substituted
+  CommandLine operation_cmdline_(ModelTraceOperation const &operation) const;
+
+public:
+
+  ModelTraceProfiler(Options const &options, OperationProfilerFactory make_operation_profilers);
+
+  /// Profiles and replays the trace, returning nonzero on failure
+  int profile(ModelTrace const &trace);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <string>
 #include <memory>
@@ -52,6 +53,7 @@
 #include "device_context.h"
 #include "performance_result.h"
 #include "performance_report.h"
+#include "device_telemetry.h"
 #include "problem_space.h"
 #include "debug.h"
 
@@ -62,6 +64,41 @@ namespace profiler {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Work queue shared by the per-device workers of a parallel sweep. Every worker enumerates the
+/// same sequence of (problem, operation) pairs and profiles only the pairs it claims, so faster
+/// devices naturally take on more of the sweep.
+class SweepSchedule {
+private:
+
+  /// Position of the next unclaimed pair in the sweep
+  std::atomic<size_t> next_{0};
+
+  /// Set by any worker that encounters an error which terminates profiling
+  std::atomic<bool> stopped_{false};
+
+  /// Number of operations profiled by all workers
+  std::atomic<int> profiled_operation_count_{0};
+
+public:
+
+  /// Claims the next unclaimed pair and returns its position in the sweep
+  size_t claim() { return next_.fetch_add(1); }
+
+  /// Terminates the sweep on all workers
+  void stop() { stopped_.store(true); }
+
+  /// Returns true if any worker terminated the sweep
+  bool stopped() const { return stopped_.load(); }
+
+  /// Records operations profiled by a worker
+  void add_profiled_operations(int count) { profiled_operation_count_.fetch_add(count); }
+
+  /// Number of operations profiled by all workers
+  int profiled_operation_count() const { return profiled_operation_count_.load(); }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Abstract base class for each math function
 class OperationProfiler {
 public:
@@ -91,6 +128,17 @@ protected:
   /// Performance result vector constructed by profiling the operation
   PerformanceResultVector results_;
 
+  /// Upper bound of the confidence interval of the fastest kernel timed adaptively for the current
+  /// problem (ms)
+  double adaptive_best_upper_bound_{0};
+
+  /// Samples device telemetry while kernels are timed, created on first use if requested
+  std::unique_ptr<DeviceTelemetryMonitor> telemetry_;
+
+  /// If set, the next kernel passed to profile_kernel_() is captured into this graph instead of
+  /// being timed
+  cudaGraph_t *capture_graph_{nullptr};
+
 public:
 
   //
@@ -137,6 +185,25 @@ public:
     library::Manifest const &manifest, 
     DeviceContext &device_context);
 
+  /// Profiles the operations in the manifest over the problem space, appending results to `report`.
+  /// If `schedule` is given, only the (problem, operation) pairs claimed from it are profiled.
+  int profile_problems(
+    Options const &options,
+    library::Manifest const &manifest,
+    DeviceContext &device_context,
+    PerformanceReport &report,
+    SweepSchedule *schedule = nullptr);
+
+  /// Initializes the operation for the first problem of the problem space and captures one launch
+  /// of it into `graph`. The graph refers to workspace owned by this profiler and `device_context`,
+  /// so neither may be used to profile another operation while the graph is in use.
+  Status capture_operation(
+    Options const &options,
+    library::Operation const *operation,
+    DeviceContext &device_context,
+    PerformanceReport &report,
+    cudaGraph_t &graph);
+
 public:
 
   //
@@ -224,6 +291,34 @@ public:
 
 protected:
 
+  /// Returns true if operations of this description are profiled by this profiler. Profilers whose
+  /// kind_ selects a subset of another operation kind (e.g. grouped GEMMs) override this.
+  virtual bool profiles_operation_kind_(library::OperationDescription const &op_desc) const {
+    return op_desc.kind == kind_;
+  }
+
+  /// Returns a relative cost estimate of running the operation on the problem, or zero if the
+  /// operation cannot be modeled. Costs are only compared among operations sharing a math
+  /// instruction, so they need not be in any particular unit.
+  virtual double modeled_cost_(
+    Options const &options,
+    library::OperationDescription const &op_desc,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem) const {
+    return 0;
+  }
+
+  /// Returns true if the operation is run by this profiler on the current device and passes the
+  /// kernel selection filters for the given problem
+  bool selects_operation_(
+    Options const &options,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+  /// Key grouping operations whose modeled costs are comparable
+  static std::string math_instruction_key_(library::OperationDescription const &op_desc);
+
   /// Sets operation description 
   static void initialize_result_(
     PerformanceResult &result,
@@ -247,13 +342,47 @@ protected:
     const std::function<Status(int, cudaStream_t, int)> &func,
     const std::vector<cudaStream_t> &streams);
 
-  /// Profiles the GPU kernel launched in `func` on the `stream`
+  /// Profiles the GPU kernel launched in `func` on the `stream`. With CUDA Graphs, a null stream is
+  /// replaced by an internal stream, since the legacy default stream cannot be captured.
   Status profile_kernel_(
     PerformanceResult &result,
     Options const &options,
     const std::function<Status(cudaStream_t, int)> &func,
     cudaStream_t stream = nullptr);
 
+  /// Returns the telemetry monitor of the profiled device if telemetry was requested, otherwise null
+  DeviceTelemetryMonitor *telemetry_monitor_(Options const &options);
+
+  /// Captures one launch of the GPU kernel in `func` into *capture_graph_
+  Status capture_kernel_(
+    const std::function<Status(cudaStream_t, int)> &func,
+    cudaStream_t stream);
+
+  /// Profiles the GPU kernel launched in `func` on the `stream` in batches until its runtime is
+  /// known to the requested precision or it is confidently slower than the best kernel so far
+  Status profile_kernel_adaptive_(
+    PerformanceResult &result,
+    Options const &options,
+    const std::function<Status(cudaStream_t, int)> &func,
+    cudaStream_t stream);
+
+  /// Captures `iterations` launches of the GPU kernel in `func` on `stream` into an instantiated CUDA Graph
+  Status capture_profiled_graph_(
+    cudaGraph_t &graph,
+    cudaGraphExec_t &graph_exec,
+    int iterations,
+    Options const &options,
+    const std::function<Status(cudaStream_t, int)> &func,
+    cudaStream_t stream);
+
+  /// Profiles `iterations` launches of the GPU kernel in `func` captured into a CUDA Graph on `stream`
+  Status profile_kernel_graph_(
+    PerformanceResult &result,
+    int iterations,
+    Options const &options,
+    const std::function<Status(cudaStream_t, int)> &func,
+    cudaStream_t stream);
+
 private:
   /// finds string matches filter_string in operation_name
   bool find_string_matches_(
@@ -94,6 +94,10 @@ public:
     /// Total memory allocation on each device
     size_t maximum_capacity;
 
+    /// If true and several devices are listed, the (problem x kernel) sweep is sharded across the
+    /// devices with one worker per device instead of running every kernel on all devices at once
+    bool parallel_sweep{false};
+
     //
     // Methods
     //
@@ -173,6 +177,9 @@ public:
     /// Indicates when to save the workspace
     SaveWorkspace save_workspace;
 
+    /// File format of saved workspaces
+    WorkspaceFormat save_workspace_format;
+
     //
     // Methods
     //
@@ -214,6 +221,58 @@ public:
     /// If true, profiling is actually conducted.
     bool enabled{true};
 
+    /// If true, profiled iterations are captured into a CUDA Graph and the replay of the graph is timed
+    bool use_cuda_graphs{false};
+
+    /// If true, each kernel is timed in batches until the confidence interval of its mean runtime is
+    /// narrow enough, and kernels that are confidently slower than the fastest kernel already profiled
+    /// for the current problem stop being timed early.
+    bool adaptive{false};
+
+    /// Number of kernel launches per timed batch in adaptive mode
+    int adaptive_batch_iterations{10};
+
+    /// Minimum and maximum number of timed batches per kernel in adaptive mode
+    int adaptive_min_batches{3};
+    int adaptive_max_batches{50};
+
+    /// Relative half-width of the 95% confidence interval at which adaptive timing stops
+    double adaptive_precision{0.01};
+
+    /// If positive, kernels whose modeled cost exceeds this multiple of the lowest modeled cost among
+    /// candidates with the same math instruction are not profiled
+    double model_prune_ratio{0};
+
+    /// If positive, kernels using more registers per thread than this are not profiled
+    int max_registers{0};
+
+    /// If false, kernels that spill registers to local memory are not profiled
+    bool allow_spills{true};
+
+    /// If positive, kernels with fewer resident thread blocks per SM than this are not profiled
+    int min_occupancy{0};
+
+    /// If true, device clocks, power, temperature and throttle reasons are sampled through NVML while
+    /// each kernel is timed and added to the report
+    bool telemetry{false};
+
+    /// If nonzero, the SM clock of each device is locked to this frequency (MHz) for the run.
+    /// Negative values lock the default application clock.
+    int lock_sm_clock{0};
+
+    /// Background load run on the device while kernels are timed
+    InterferenceLoad interference{InterferenceLoad::kNone};
+
+    /// Number of SMs occupied by the background load
+    int interference_sms{8};
+
+    /// If positive, the SM count passed to kernels that size their grid from the device, such as
+    /// persistent and stream-K kernels
+    int sm_count{0};
+
+    /// Path or built-in name of a model trace to replay instead of sweeping a problem space
+    std::string model_trace;
+
     /// If true, profiling returns an error code if no kernels are found to match the filters.
     bool error_on_no_match{false};
 
@@ -252,6 +311,10 @@ public:
     /// Path to a file containing junit xml results
     std::string junit_output_path;
 
+    /// Path to a file receiving the best GEMM operation per problem, loadable by
+    /// library::GemmSelectionCache
+    std::string gemm_selection_output_path;
+
     /// Sequence of tags to attach to each result
     std::vector<std::pair<std::string, std::string>> pivot_tags;
 
@@ -340,6 +403,13 @@ public:
 
   explicit Options(CommandLine const &cmdline);
 
+  /// Returns a copy of the options restricted to the listed device at `device_index`
+  Options select_device(size_t device_index) const;
+
+  /// Returns the SM count passed to kernels: --sm-count if given, otherwise the SMs of the first
+  /// listed device not occupied by an interference load
+  int kernel_sm_count() const;
+
   void print_usage(std::ostream &out) const;
   void print_options(std::ostream &out) const;
 
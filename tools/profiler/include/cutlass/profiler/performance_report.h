@@ -36,6 +36,10 @@
 
 #include <vector>
 #include <fstream>
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <mutex>
 
 // CUTLASS Profiler includes
 #include "options.h"
@@ -44,6 +48,7 @@
 
 // CUTLASS Library includes
 #include "cutlass/library/library.h"
+#include "cutlass/library/gemm_selection_cache.h"
 
 namespace cutlass {
 namespace profiler {
@@ -83,6 +88,25 @@ private:
   /// Collection of all results
   PerformanceResultVector concatenated_results_;
 
+  /// Fastest GEMM operation per selection key, exported if requested
+  library::GemmSelectionCache gemm_selection_;
+
+  /// Throughput of the operations in gemm_selection_ in GFLOP/s
+  std::unordered_map<
+    library::GemmSelectionKey, double, library::GemmSelectionKeyHasher> gemm_selection_gflops_;
+
+  /// GEMM operations of the manifest indexed by name
+  std::unordered_map<std::string, library::Operation const *> gemm_operations_by_name_;
+
+  /// Serializes appends from concurrent workers
+  std::recursive_mutex mutex_;
+
+  /// Result closest to the roofline for each problem
+  std::map<size_t, PerformanceResult> best_roofline_results_;
+
+  /// Fastest correct CUTLASS result for each problem
+  std::map<size_t, PerformanceResult> fastest_results_;
+
 public:
 
   PerformanceReport(Options const &options, std::vector<std::string> const &argument_names, library::OperationKind const &op_kind);
@@ -95,6 +119,31 @@ public:
   void sort_results(PerformanceResultVector &results);
   void append_results(PerformanceResultVector const &results);
 
+  /// Appends results of an explicitly numbered problem. These may be called concurrently by the
+  /// workers of a parallel sweep.
+  void append_result(PerformanceResult result, size_t problem_index);
+  void append_results(PerformanceResultVector const &results, size_t problem_index);
+
+  /// Returns the fastest correct CUTLASS result of a problem, or null if none was profiled
+  PerformanceResult const *fastest_result(size_t problem_index) const;
+
+private:
+
+  /// Records the result as a candidate for the fastest result of its problem
+  void record_fastest_(PerformanceResult const &result);
+
+  /// Records the result as a GEMM selection candidate
+  void record_gemm_selection_(PerformanceResult const &result);
+
+  /// Writes the GEMM selection table
+  void write_gemm_selection_();
+
+  /// Records the result as a candidate for the best roofline efficiency of its problem
+  void record_roofline_(PerformanceResult const &result);
+
+  /// Prints the problems whose best result is furthest from the roofline
+  void print_roofline_summary_(std::ostream &out);
+
 public:
 
   /// Prints the CSV header
@@ -34,12 +34,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "cutlass/cutlass.h"
 
 // CUTLASS Profiler includes
 #include "enumerated_types.h"
+#include "device_telemetry.h"
 
 // CUTLASS Library includes
 #include "cutlass/library/library.h"
@@ -89,6 +91,21 @@ struct PerformanceResult {
   /// Average runtime in ms per device
   std::vector<double> runtime_vector;
 
+  /// Device clocks, power and temperature observed while measuring runtime
+  DeviceTelemetry telemetry;
+
+  /// Peak math throughput (GFLOP/s) of the device for the operation, or zero if unknown
+  double peak_gflops{0};
+
+  /// Peak DRAM bandwidth (GiB/s) of the device, or zero if unknown
+  double peak_gbytes{0};
+
+  /// Registers, spills, shared memory and occupancy of the compiled kernel
+  library::KernelResourceUsage resource_usage;
+
+  /// True if the operation reported its resource usage
+  bool resource_usage_valid{false};
+
   //
   // Members
   //
@@ -120,6 +137,43 @@ struct PerformanceResult {
     return double(bytes) / double(1 << 30) / runtime * 1000.0;
   }
 
+  /// Math operations per byte of memory traffic
+  double arithmetic_intensity() const {
+    return bytes ? double(flops) / double(bytes) : 0;
+  }
+
+  /// Returns true if the roofline of the device is known for this result
+  bool has_roofline() const {
+    return peak_gflops > 0 && peak_gbytes > 0;
+  }
+
+  /// Throughput attainable at this arithmetic intensity under the roofline in units of GFLOP/s
+  double roofline_gflops() const {
+    double bandwidth_bound = arithmetic_intensity() * peak_gbytes * double(1 << 30) / 1.0e9;
+    return std::min(peak_gflops, bandwidth_bound);
+  }
+
+  /// Returns true if the roofline limits this problem by math throughput rather than bandwidth
+  bool compute_bound() const {
+    return roofline_gflops() >= peak_gflops;
+  }
+
+  /// Fraction of the device's peak math throughput achieved
+  double math_efficiency() const {
+    return peak_gflops > 0 ? gflops_per_sec() / peak_gflops : 0;
+  }
+
+  /// Fraction of the device's peak DRAM bandwidth achieved
+  double memory_efficiency() const {
+    return peak_gbytes > 0 ? gbytes_per_sec() / peak_gbytes : 0;
+  }
+
+  /// Fraction of the attainable roofline throughput achieved
+  double roofline_efficiency() const {
+    double attainable = roofline_gflops();
+    return attainable > 0 ? gflops_per_sec() / attainable : 0;
+  }
+
 };
 
 using PerformanceResultVector = std::vector<PerformanceResult>;
@@ -77,7 +77,7 @@ Conv2dOperationProfiler::Conv2dOperationProfiler(Options const &options):
       {ArgumentTypeID::kTensor, {"Filter"}, "Tensor storing the Filter operand"},
       {ArgumentTypeID::kTensor, {"Output"}, "Tensor storing the Output operand"},
       {ArgumentTypeID::kEnumerated, {"conv_mode"}, "Convolution filter mode (conv, cross)"},
-      {ArgumentTypeID::kEnumerated, {"iterator_algorithm", "iterator_algo"}, "Convolution iterator algorithm (analytic, optimized)"},
+      {ArgumentTypeID::kEnumerated, {"iterator_algorithm", "iterator_algo"}, "Convolution iterator algorithm (analytic, optimized, winograd)"},
       {ArgumentTypeID::kScalar, {"alpha", "epilogue::alpha"}, "Epilogue scalar alpha"},
       {ArgumentTypeID::kScalar, {"beta", "epilogue::beta"}, "Epilogue scalar beta"},
       {ArgumentTypeID::kEnumerated, {"split_k_mode", "split-k-mode"}, "SplitK mode for serial or parallel reduction (serial, parallel)"},
@@ -1292,7 +1292,7 @@ Status Conv2dOperationProfiler::profile_cutlass_(
     }
   }
 
-  auto func = [&](cudaStream_t, int iteration) {
+  auto func = [&](cudaStream_t stream, int iteration) {
     // Setup rotating workspace
     int problem_idx = iteration % conv_workspace_.problem_count;
 
@@ -1315,7 +1315,8 @@ Status Conv2dOperationProfiler::profile_cutlass_(
     Status status = underlying_operation->run(
       arguments,
       host_workspace,
-      device_workspace);
+      device_workspace,
+      stream);
 
     // Run parallel reduction kernel for parallel split_k_mode
     if (conv_workspace_.configuration.split_k_mode == conv::SplitKMode::kParallel) {
@@ -1323,7 +1324,8 @@ Status Conv2dOperationProfiler::profile_cutlass_(
       status = reduction_op_->run(
         &conv_workspace_.reduction_arguments,
         conv_workspace_.reduction_host_workspace.data(),
-        nullptr);
+        nullptr,
+        stream);
     }
 
     if (status != Status::kSuccess) {
@@ -424,6 +424,146 @@ cublasStatus_t cublasGemmExDispatcher::operator()(cublasHandle_t handle) {
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_PROFILER_CUBLAS_GROUPED_GEMM_ENABLED)
+
+cublasGemmGroupedDispatcher::cublasGemmGroupedDispatcher(
+  library::GemmDescription const &op_desc,
+  std::vector<gemm::GemmCoord> const &problem_sizes,
+  std::vector<int64_t> const &lda,
+  std::vector<int64_t> const &ldb,
+  std::vector<int64_t> const &ldc_,
+  void const *alpha_,
+  void const *beta_,
+  void const * const *ptr_A,
+  void const * const *ptr_B,
+  void * const *ptr_C_
+):
+  ptr_first(ptr_A), ptr_second(ptr_B), ptr_C(ptr_C_), status(Status::kSuccess) {
+
+  bool good = true;
+
+  good = (good && get_cublas_datatype(data_type_A, op_desc.A.element));
+  good = (good && get_cublas_datatype(data_type_B, op_desc.B.element));
+  good = (good && get_cublas_datatype(data_type_C, op_desc.C.element));
+  good = (good && op_desc.C.element == op_desc.D.element);
+
+  cublasOperation_t trans_A = CUBLAS_OP_N;
+  cublasOperation_t trans_B = CUBLAS_OP_N;
+
+  // Row-major C is computed as C^T = B^T * A^T, which flips the transpose of each operand
+  bool transposed = (op_desc.C.layout == library::LayoutTypeID::kRowMajor);
+
+  auto flip = [](library::LayoutTypeID layout) {
+    return layout == library::LayoutTypeID::kRowMajor ?
+      library::LayoutTypeID::kColumnMajor : library::LayoutTypeID::kRowMajor;
+  };
+
+  if (transposed) {
+    good = (good && op_desc.transform_A == library::ComplexTransform::kNone);
+    good = (good && op_desc.transform_B == library::ComplexTransform::kNone);
+    good = (good && get_cublas_transpose_operation(trans_A, flip(op_desc.A.layout)));
+    good = (good && get_cublas_transpose_operation(trans_B, flip(op_desc.B.layout)));
+  }
+  else {
+    good = (good && op_desc.C.layout == library::LayoutTypeID::kColumnMajor);
+    good = (good && get_cublas_transpose_operation(trans_A, op_desc.A.layout, op_desc.transform_A));
+    good = (good && get_cublas_transpose_operation(trans_B, op_desc.B.layout, op_desc.transform_B));
+  }
+
+  library::OpcodeClassID const & opcode_class =
+    op_desc.tile_description.math_instruction.opcode_class;
+
+  switch (op_desc.tile_description.math_instruction.element_accumulator) {
+    case library::NumericTypeID::kF32:
+      compute_type = (op_desc.A.element == library::NumericTypeID::kF32 &&
+                      op_desc.B.element == library::NumericTypeID::kF32 &&
+                      opcode_class == library::OpcodeClassID::kTensorOp) ?
+        CUBLAS_COMPUTE_32F_FAST_TF32 : CUBLAS_COMPUTE_32F;
+      break;
+    case library::NumericTypeID::kF64:
+      compute_type = CUBLAS_COMPUTE_64F;
+      break;
+    default:
+      good = false;
+      break;
+  }
+
+  if (!good) {
+    status = Status::kErrorNotSupported;
+    return;
+  }
+
+  int group_count = int(problem_sizes.size());
+  size_t scalar_bytes = size_t(library::sizeof_bits(op_desc.element_epilogue) / 8);
+
+  for (int i = 0; i < group_count; ++i) {
+    gemm::GemmCoord const &problem = problem_sizes[i];
+
+    if (transposed) {
+      trans_first.push_back(trans_B);
+      trans_second.push_back(trans_A);
+      m.push_back(problem.n());
+      n.push_back(problem.m());
+      ld_first.push_back(int(ldb[i]));
+      ld_second.push_back(int(lda[i]));
+    }
+    else {
+      trans_first.push_back(trans_A);
+      trans_second.push_back(trans_B);
+      m.push_back(problem.m());
+      n.push_back(problem.n());
+      ld_first.push_back(int(lda[i]));
+      ld_second.push_back(int(ldb[i]));
+    }
+
+    k.push_back(problem.k());
+    ldc.push_back(int(ldc_[i]));
+    group_size.push_back(1);
+
+    alpha.insert(alpha.end(),
+      static_cast<uint8_t const *>(alpha_), static_cast<uint8_t const *>(alpha_) + scalar_bytes);
+    beta.insert(beta.end(),
+      static_cast<uint8_t const *>(beta_), static_cast<uint8_t const *>(beta_) + scalar_bytes);
+  }
+
+  if (transposed) {
+    std::swap(ptr_first, ptr_second);
+    std::swap(data_type_A, data_type_B);
+  }
+}
+
+/// Executes the grouped GEMM using these arguments
+cublasStatus_t cublasGemmGroupedDispatcher::operator()(cublasHandle_t handle) {
+
+  return cublasGemmGroupedBatchedEx(
+    handle,
+    trans_first.data(),
+    trans_second.data(),
+    m.data(),
+    n.data(),
+    k.data(),
+    alpha.data(),
+    ptr_first,
+    data_type_A,
+    ld_first.data(),
+    ptr_second,
+    data_type_B,
+    ld_second.data(),
+    beta.data(),
+    ptr_C,
+    data_type_C,
+    ldc.data(),
+    int(group_size.size()),
+    group_size.data(),
+    compute_type
+  );
+}
+
+#endif // defined(CUTLASS_PROFILER_CUBLAS_GROUPED_GEMM_ENABLED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
 
 cublasLtGemmExDispatcher::cublasLtGemmExDispatcher(
   library::GemmDescription const &op_desc,
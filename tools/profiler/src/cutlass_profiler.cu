@@ -34,9 +34,15 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
 
 // Profiler includes
 #include "cutlass/profiler/cutlass_profiler.h"
+#include "cutlass/profiler/device_telemetry.h"
+#include "cutlass/profiler/model_trace.h"
 #include "cutlass/profiler/gemm_operation_profiler.h"
 #include "cutlass/profiler/rank_k_operation_profiler.h"
 #include "cutlass/profiler/rank_2k_operation_profiler.h"
@@ -45,6 +51,8 @@
 #include "cutlass/profiler/conv2d_operation_profiler.h"
 #include "cutlass/profiler/conv3d_operation_profiler.h"
 #include "cutlass/profiler/sparse_gemm_operation_profiler.h"
+#include "cutlass/profiler/grouped_gemm_operation_profiler.h"
+#include "cutlass/profiler/distributed_gemm_operation_profiler.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -56,23 +64,36 @@ namespace profiler {
 CutlassProfiler::CutlassProfiler(
   Options const &options
 ):
-  options_(options) {
+  options_(options), operation_profilers_(make_operation_profilers_(options)) {
 
-  operation_profilers_.emplace_back(new GemmOperationProfiler(options));
+}
+
+/// Constructs the entry points for each operation
+OperationProfilerVector CutlassProfiler::make_operation_profilers_(Options const &options) {
+
+  OperationProfilerVector operation_profilers;
+
+  operation_profilers.emplace_back(new GemmOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new SparseGemmOperationProfiler(options));
+  operation_profilers.emplace_back(new SparseGemmOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new Conv2dOperationProfiler(options));
+  operation_profilers.emplace_back(new GroupedGemmOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new Conv3dOperationProfiler(options));
+  operation_profilers.emplace_back(new Conv2dOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new RankKOperationProfiler(options));
+  operation_profilers.emplace_back(new Conv3dOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new Rank2KOperationProfiler(options));
+  operation_profilers.emplace_back(new RankKOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new TrmmOperationProfiler(options));
+  operation_profilers.emplace_back(new Rank2KOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new SymmOperationProfiler(options));
+  operation_profilers.emplace_back(new TrmmOperationProfiler(options));
+
+  operation_profilers.emplace_back(new SymmOperationProfiler(options));
+
+  operation_profilers.emplace_back(new DistributedGemmOperationProfiler(options));
+
+  return operation_profilers;
 }
 
 CutlassProfiler::~CutlassProfiler() {
@@ -143,6 +164,28 @@ void CutlassProfiler::enumerate_() {
 /// Profiles all operations
 int CutlassProfiler::profile_() {
 
+  // Optionally lock clocks for the duration of the run so that results are comparable
+  std::vector<std::unique_ptr<DeviceClockLock>> clock_locks;
+  if (options_.profiling.lock_sm_clock != 0) {
+    for (int device : options_.device.devices) {
+      clock_locks.emplace_back(new DeviceClockLock(device, options_.profiling.lock_sm_clock));
+
+      if (!clock_locks.back()->locked()) {
+        std::cerr << "Warning: could not lock the SM clock of device " << device
+                  << " [--lock-clocks]" << std::endl;
+      }
+    }
+  }
+
+  if (!options_.profiling.model_trace.empty()) {
+    ModelTraceProfiler model_trace_profiler(options_, make_operation_profilers_);
+    return model_trace_profiler.profile(ModelTrace::load(options_.profiling.model_trace));
+  }
+
+  if (options_.device.parallel_sweep && options_.device.devices.size() > 1) {
+    return profile_parallel_();
+  }
+
   // Keep track of all device memory tensor in map
   DeviceContext device_context;
 
@@ -165,6 +208,106 @@ int CutlassProfiler::profile_() {
   return result;
 }
 
+/// Profiles all operations with the sweep sharded across the listed devices. Each device is driven
+/// by its own worker thread with its own operation profilers, options restricted to that device,
+/// and device allocations. Workers claim (problem, operation) pairs from a shared schedule and
+/// append their results to one report per operation kind.
+int CutlassProfiler::profile_parallel_() {
+
+  size_t device_count = options_.device.devices.size();
+
+  std::vector<Options> device_options;
+  for (size_t device_index = 0; device_index < device_count; ++device_index) {
+    device_options.push_back(options_.select_device(device_index));
+  }
+
+  // Each worker owns its profilers, which keep per-problem state between calls
+  std::vector<OperationProfilerVector> device_profilers;
+  for (size_t device_index = 0; device_index < device_count; ++device_index) {
+    device_profilers.push_back(make_operation_profilers_(device_options[device_index]));
+  }
+
+  int result = 0;
+  // For all profilers (e.g. gemm/sparse_gemm/conv2d...)
+  for (size_t profiler_index = 0; profiler_index < operation_profilers_.size(); ++profiler_index) {
+
+    auto & profiler = operation_profilers_[profiler_index];
+
+    if (options_.operation_kind != library::OperationKind::kInvalid &&
+        options_.operation_kind != profiler->kind()) {
+      continue;
+    }
+
+    // Distributed GEMMs already run on several of the listed devices at once
+    if (profiler->kind() == library::OperationKind::kDistributedGemm) {
+      DeviceContext device_context;
+      result |= profiler->profile_all(options_, library::Singleton::get().manifest, device_context);
+      if (result) {
+        return result;
+      }
+      continue;
+    }
+
+    ProblemSpace problem_space(profiler->arguments(), options_.cmdline);
+    PerformanceReport report(options_, problem_space.argument_names(), profiler->kind());
+
+    SweepSchedule schedule;
+    std::vector<int> worker_results(device_count, 0);
+    std::vector<std::exception_ptr> worker_exceptions(device_count);
+    std::vector<std::thread> workers;
+
+    for (size_t device_index = 0; device_index < device_count; ++device_index) {
+      workers.emplace_back([&, device_index]() {
+        try {
+          Options const &options = device_options[device_index];
+
+          if (cudaSetDevice(options.device.device_id(0)) != cudaSuccess) {
+            throw std::runtime_error("cudaSetDevice() failed.");
+          }
+
+          DeviceContext device_context;
+
+          worker_results[device_index] = device_profilers[device_index][profiler_index]->profile_problems(
+            options, library::Singleton::get().manifest, device_context, report, &schedule);
+        }
+        catch (...) {
+          worker_exceptions[device_index] = std::current_exception();
+          schedule.stop();
+        }
+      });
+    }
+
+    for (auto & worker : workers) {
+      worker.join();
+    }
+
+    for (auto const & exception : worker_exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+
+    for (int worker_result : worker_results) {
+      result |= worker_result;
+    }
+
+    if (options_.profiling.error_if_nothing_is_profiled && options_.profiling.enabled &&
+        schedule.profiled_operation_count() <= 0) {
+      #if !NDEBUG
+      std::cerr << "Error: No kernels profiled found with kernel selection filters [--error_if_nothing_is_profiled]" << std::endl;
+      #endif
+      result |= 1;
+    }
+
+    // If some profile failed, terminate immediately
+    if (result) {
+      return result;
+    }
+  }
+
+  return result;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Prints all options
@@ -198,6 +341,8 @@ void CutlassProfiler::print_usage_(std::ostream &out) {
     << "  $ cutlass_profiler --operation=Conv3d --help\n\n"
     << "  $ cutlass_profiler --operation=Conv2d --help\n\n"
     << "  $ cutlass_profiler --operation=SparseGemm --help\n\n"
+    << "  $ cutlass_profiler --operation=GroupedGemm --help\n\n"
+    << "  $ cutlass_profiler --operation=DistributedGemm --help\n\n"
   ;
 }
 
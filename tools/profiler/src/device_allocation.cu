@@ -43,6 +43,7 @@
 #include "cutlass/util/reference/host/tensor_fill.h"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/util/tensor_view_io.h"
+#include "cutlass/util/tensor_view_npy.h"
 
 #include "cutlass/library/util.h"
 
@@ -540,12 +541,13 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     throw std::runtime_error("Attempting to initialize invalid allocation.");
   }
 
-  // Instantiate calls to CURAND here. This file takes a long time to compile for
-  // this reason.
+  // Real types use the counter-based Philox fill, which needs no per-thread CURAND state.
+  // Complex types still instantiate calls to CURAND here. This file takes a long time to
+  // compile for this reason.
 
   switch (type_) {
   case library::NumericTypeID::kF16:
-    cutlass::reference::device::BlockFillRandom<cutlass::half_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::half_t>(
       reinterpret_cast<cutlass::half_t *>(pointer_),
       capacity_,
       seed,
@@ -553,7 +555,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kBF16:
-    cutlass::reference::device::BlockFillRandom<cutlass::bfloat16_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::bfloat16_t>(
       reinterpret_cast<cutlass::bfloat16_t *>(pointer_),
       capacity_,
       seed,
@@ -561,7 +563,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kTF32:
-    cutlass::reference::device::BlockFillRandom<cutlass::tfloat32_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::tfloat32_t>(
       reinterpret_cast<cutlass::tfloat32_t *>(pointer_),
       capacity_,
       seed,
@@ -569,7 +571,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF32:
-    cutlass::reference::device::BlockFillRandom<float>(
+    cutlass::reference::device::BlockFillRandomPhilox<float>(
       reinterpret_cast<float *>(pointer_),
       capacity_,
       seed,
@@ -601,7 +603,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE4M3:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e4m3_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_e4m3_t>(
       reinterpret_cast<cutlass::float_e4m3_t *>(pointer_),
       capacity_,
       seed,
@@ -609,7 +611,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE5M2:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e5m2_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_e5m2_t>(
       reinterpret_cast<cutlass::float_e5m2_t *>(pointer_),
       capacity_,
       seed,
@@ -617,7 +619,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF64:
-    cutlass::reference::device::BlockFillRandom<double>(
+    cutlass::reference::device::BlockFillRandomPhilox<double>(
       reinterpret_cast<double *>(pointer_),
       capacity_,
       seed,
@@ -633,7 +635,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS2:
-    cutlass::reference::device::BlockFillRandom<int2b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int2b_t>(
       reinterpret_cast<int2b_t *>(pointer_),
       capacity_,
       seed,
@@ -641,7 +643,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS4:
-    cutlass::reference::device::BlockFillRandom<int4b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int4b_t>(
       reinterpret_cast<int4b_t *>(pointer_),
       capacity_,
       seed,
@@ -649,7 +651,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS8:
-    cutlass::reference::device::BlockFillRandom<int8_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int8_t>(
       reinterpret_cast<int8_t *>(pointer_),
       capacity_,
       seed,
@@ -657,7 +659,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS16:
-    cutlass::reference::device::BlockFillRandom<int16_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int16_t>(
       reinterpret_cast<int16_t *>(pointer_),
       capacity_,
       seed,
@@ -665,7 +667,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS32:
-    cutlass::reference::device::BlockFillRandom<int32_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int32_t>(
       reinterpret_cast<int32_t *>(pointer_),
       capacity_,
       seed,
@@ -673,7 +675,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS64:
-    cutlass::reference::device::BlockFillRandom<int64_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int64_t>(
       reinterpret_cast<int64_t *>(pointer_),
       capacity_,
       seed,
@@ -681,7 +683,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kB1:
-    cutlass::reference::device::BlockFillRandom<uint1b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint1b_t>(
       reinterpret_cast<uint1b_t *>(pointer_),
       capacity_,
       seed,
@@ -689,7 +691,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU2:
-    cutlass::reference::device::BlockFillRandom<uint2b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint2b_t>(
       reinterpret_cast<uint2b_t *>(pointer_),
       capacity_,
       seed,
@@ -697,7 +699,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU4:
-    cutlass::reference::device::BlockFillRandom<uint4b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint4b_t>(
       reinterpret_cast<uint4b_t *>(pointer_),
       capacity_,
       seed,
@@ -705,7 +707,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU8:
-    cutlass::reference::device::BlockFillRandom<uint8_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint8_t>(
       reinterpret_cast<uint8_t *>(pointer_),
       capacity_,
       seed,
@@ -713,7 +715,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU16:
-    cutlass::reference::device::BlockFillRandom<uint16_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint16_t>(
       reinterpret_cast<uint16_t *>(pointer_),
       capacity_,
       seed,
@@ -721,7 +723,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU32:
-    cutlass::reference::device::BlockFillRandom<uint32_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint32_t>(
       reinterpret_cast<uint32_t *>(pointer_),
       capacity_,
       seed,
@@ -729,7 +731,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU64:
-    cutlass::reference::device::BlockFillRandom<uint64_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint64_t>(
       reinterpret_cast<uint64_t *>(pointer_),
       capacity_,
       seed,
@@ -756,7 +758,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
 
   switch (type_) {
   case library::NumericTypeID::kFE4M3:
-    cutlass::reference::host::BlockFillRandom<cutlass::float_e4m3_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<cutlass::float_e4m3_t>(
       reinterpret_cast<cutlass::float_e4m3_t *>(host_data.data()),
       capacity_,
       seed,
@@ -764,7 +766,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE5M2:
-    cutlass::reference::host::BlockFillRandom<cutlass::float_e5m2_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<cutlass::float_e5m2_t>(
       reinterpret_cast<cutlass::float_e5m2_t *>(host_data.data()),
       capacity_,
       seed,
@@ -772,7 +774,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF16:
-    cutlass::reference::host::BlockFillRandom<cutlass::half_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<cutlass::half_t>(
       reinterpret_cast<cutlass::half_t *>(host_data.data()),
       capacity_,
       seed,
@@ -780,7 +782,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kBF16:
-    cutlass::reference::host::BlockFillRandom<cutlass::bfloat16_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<cutlass::bfloat16_t>(
       reinterpret_cast<cutlass::bfloat16_t *>(host_data.data()),
       capacity_,
       seed,
@@ -788,7 +790,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kTF32:
-    cutlass::reference::host::BlockFillRandom<cutlass::tfloat32_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<cutlass::tfloat32_t>(
       reinterpret_cast<cutlass::tfloat32_t *>(host_data.data()),
       capacity_,
       seed,
@@ -796,7 +798,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF32:
-    cutlass::reference::host::BlockFillRandom<float>(
+    cutlass::reference::host::BlockFillRandomPhilox<float>(
       reinterpret_cast<float *>(host_data.data()),
       capacity_,
       seed,
@@ -836,7 +838,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF64:
-    cutlass::reference::host::BlockFillRandom<double>(
+    cutlass::reference::host::BlockFillRandomPhilox<double>(
       reinterpret_cast<double *>(host_data.data()),
       capacity_,
       seed,
@@ -852,7 +854,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS2:
-    cutlass::reference::host::BlockFillRandom<int2b_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<int2b_t>(
       reinterpret_cast<int2b_t *>(host_data.data()),
       capacity_,
       seed,
@@ -860,7 +862,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS4:
-    cutlass::reference::host::BlockFillRandom<int4b_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<int4b_t>(
       reinterpret_cast<int4b_t *>(host_data.data()),
       capacity_,
       seed,
@@ -868,7 +870,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS8:
-    cutlass::reference::host::BlockFillRandom<int8_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<int8_t>(
       reinterpret_cast<int8_t *>(host_data.data()),
       capacity_,
       seed,
@@ -876,7 +878,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS16:
-    cutlass::reference::host::BlockFillRandom<int16_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<int16_t>(
       reinterpret_cast<int16_t *>(host_data.data()),
       capacity_,
       seed,
@@ -884,7 +886,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS32:
-    cutlass::reference::host::BlockFillRandom<int32_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<int32_t>(
       reinterpret_cast<int32_t *>(host_data.data()),
       capacity_,
       seed,
@@ -892,7 +894,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS64:
-    cutlass::reference::host::BlockFillRandom<int64_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<int64_t>(
       reinterpret_cast<int64_t *>(host_data.data()),
       capacity_,
       seed,
@@ -900,7 +902,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kB1:
-    cutlass::reference::host::BlockFillRandom<uint1b_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<uint1b_t>(
       reinterpret_cast<uint1b_t *>(host_data.data()),
       capacity_,
       seed,
@@ -908,7 +910,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU2:
-    cutlass::reference::host::BlockFillRandom<uint2b_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<uint2b_t>(
       reinterpret_cast<uint2b_t *>(host_data.data()),
       capacity_,
       seed,
@@ -916,7 +918,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU4:
-    cutlass::reference::host::BlockFillRandom<uint4b_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<uint4b_t>(
       reinterpret_cast<uint4b_t *>(host_data.data()),
       capacity_,
       seed,
@@ -924,7 +926,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU8:
-    cutlass::reference::host::BlockFillRandom<uint8_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<uint8_t>(
       reinterpret_cast<uint8_t *>(host_data.data()),
       capacity_,
       seed,
@@ -932,7 +934,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU16:
-    cutlass::reference::host::BlockFillRandom<uint16_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<uint16_t>(
       reinterpret_cast<uint16_t *>(host_data.data()),
       capacity_,
       seed,
@@ -940,7 +942,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU32:
-    cutlass::reference::host::BlockFillRandom<uint32_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<uint32_t>(
       reinterpret_cast<uint32_t *>(host_data.data()),
       capacity_,
       seed,
@@ -948,7 +950,7 @@ void DeviceAllocation::initialize_random_host(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU64:
-    cutlass::reference::host::BlockFillRandom<uint64_t>(
+    cutlass::reference::host::BlockFillRandomPhilox<uint64_t>(
       reinterpret_cast<uint64_t *>(host_data.data()),
       capacity_,
       seed,
@@ -2119,6 +2121,66 @@ void DeviceAllocation::write_tensor_csv(
   }
 }
 
+/// Returns the NumPy type string for a numeric type. Types without a NumPy equivalent are
+/// written as unsigned integers of the same width.
+static std::string npy_descr(library::NumericTypeID type) {
+  switch (type) {
+  case library::NumericTypeID::kF16: return "<f2";
+  case library::NumericTypeID::kTF32: return "<f4";
+  case library::NumericTypeID::kF32: return "<f4";
+  case library::NumericTypeID::kF64: return "<f8";
+  case library::NumericTypeID::kCF32: return "<c8";
+  case library::NumericTypeID::kCF64: return "<c16";
+  case library::NumericTypeID::kS8: return "|i1";
+  case library::NumericTypeID::kS16: return "<i2";
+  case library::NumericTypeID::kS32: return "<i4";
+  case library::NumericTypeID::kS64: return "<i8";
+  default:
+    return cutlass::detail::npy_descr(library::sizeof_bits(type), 'u');
+  }
+}
+
+void DeviceAllocation::write_tensor_npy(std::string const &path) {
+
+  int bits = library::sizeof_bits(type_);
+
+  std::vector<int64_t> shape;
+  bool fortran_order = false;
+
+  bool row_major = (layout_ == library::LayoutTypeID::kRowMajor);
+  bool column_major = (layout_ == library::LayoutTypeID::kColumnMajor);
+
+  // Packed matrices keep their logical shape, with the batch as the slowest-varying mode
+  if (bits >= 8 && extent_.size() == 2 && stride_.size() == 1 && (row_major || column_major) &&
+      stride_.at(0) == (row_major ? extent_.at(1) : extent_.at(0)) &&
+      (batch_count_ == 1 || batch_stride_ == size_t(extent_.at(0)) * extent_.at(1))) {
+
+    if (row_major) {
+      if (batch_count_ > 1) {
+        shape.push_back(batch_count_);
+      }
+      shape.push_back(extent_.at(0));
+      shape.push_back(extent_.at(1));
+    }
+    else {
+      fortran_order = true;
+      shape.push_back(extent_.at(0));
+      shape.push_back(extent_.at(1));
+      if (batch_count_ > 1) {
+        shape.push_back(batch_count_);
+      }
+    }
+  }
+  else {
+    // Flat array of the allocation
+    shape.push_back(bits >= 8 ? int64_t(capacity_) : int64_t(bytes()));
+  }
+
+  cutlass::NpyWriter writer(path, npy_descr(type_), shape, fortran_order);
+  writer.write_from_device(data(), writer.bytes_expected());
+  writer.close();
+}
+
 template <typename Element, typename Layout>
 static void tensor_fill_tensor_view(DeviceAllocation &allocation, Element val = Element()) {
   Coord<Layout::kRank> extent;
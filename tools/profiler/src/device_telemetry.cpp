@@ -0,0 +1,274 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Device clock, power and thermal telemetry sampled through NVML
+*/
+
+#include <algorithm>
+
+#include <cuda_runtime.h>
+
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+#include <nvml.h>
+#endif
+
+#include "cutlass/profiler/device_telemetry.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+
+/// Throttle reasons indicating the device was slowed by power or thermal limits
+constexpr unsigned long long kThrottleReasonMask =
+  nvmlClocksThrottleReasonSwPowerCap |
+  nvmlClocksThrottleReasonHwSlowdown |
+  nvmlClocksThrottleReasonSwThermalSlowdown |
+  nvmlClocksThrottleReasonHwThermalSlowdown |
+  nvmlClocksThrottleReasonHwPowerBrakeSlowdown;
+
+/// Initializes NVML and returns the handle of a CUDA device, or null on failure. NVML enumerates
+/// devices in its own order, so the device is matched by PCI bus ID. A non-null handle holds a
+/// reference to NVML which must be released with nvmlShutdown().
+nvmlDevice_t nvml_device(int device) {
+
+  char pci_bus_id[32];
+  if (cudaDeviceGetPCIBusId(pci_bus_id, int(sizeof(pci_bus_id)), device) != cudaSuccess) {
+    return nullptr;
+  }
+
+  if (nvmlInit() != NVML_SUCCESS) {
+    return nullptr;
+  }
+
+  nvmlDevice_t handle;
+  if (nvmlDeviceGetHandleByPciBusId(pci_bus_id, &handle) != NVML_SUCCESS) {
+    nvmlShutdown();
+    return nullptr;
+  }
+
+  return handle;
+}
+
+#else
+
+constexpr unsigned long long kThrottleReasonMask = 0;
+
+#endif
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DeviceTelemetry::throttled() const {
+  return valid && ((throttle_reasons & kThrottleReasonMask) != 0 || violation_time > 0);
+}
+
+void DeviceTelemetry::accumulate(DeviceTelemetry const &sample) {
+
+  if (!sample.valid) {
+    return;
+  }
+
+  if (!valid) {
+    *this = sample;
+    return;
+  }
+
+  sm_clock = std::min(sm_clock, sample.sm_clock);
+  memory_clock = std::min(memory_clock, sample.memory_clock);
+  power = std::max(power, sample.power);
+  temperature = std::max(temperature, sample.temperature);
+  throttle_reasons |= sample.throttle_reasons;
+  violation_time += sample.violation_time;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+DeviceTelemetryMonitor::DeviceTelemetryMonitor(int device) {
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  device_ = nvml_device(device);
+#endif
+}
+
+DeviceTelemetryMonitor::~DeviceTelemetryMonitor() {
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  if (device_) {
+    nvmlShutdown();
+  }
+#endif
+}
+
+DeviceTelemetry DeviceTelemetryMonitor::sample_() const {
+
+  DeviceTelemetry sample;
+
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  if (!device_) {
+    return sample;
+  }
+
+  nvmlDevice_t device = static_cast<nvmlDevice_t>(device_);
+
+  unsigned int power_mw = 0;
+  unsigned long long throttle_reasons = 0;
+
+  sample.valid =
+    nvmlDeviceGetClockInfo(device, NVML_CLOCK_SM, &sample.sm_clock) == NVML_SUCCESS &&
+    nvmlDeviceGetClockInfo(device, NVML_CLOCK_MEM, &sample.memory_clock) == NVML_SUCCESS;
+
+  // Power, temperature and throttle reasons are not supported by every device
+  if (nvmlDeviceGetPowerUsage(device, &power_mw) == NVML_SUCCESS) {
+    sample.power = double(power_mw) / 1000.0;
+  }
+
+  nvmlDeviceGetTemperature(device, NVML_TEMPERATURE_GPU, &sample.temperature);
+
+  if (nvmlDeviceGetCurrentClocksThrottleReasons(device, &throttle_reasons) == NVML_SUCCESS) {
+    sample.throttle_reasons = throttle_reasons;
+  }
+#endif
+
+  return sample;
+}
+
+void DeviceTelemetryMonitor::violation_time_(unsigned long long (&time)[2]) const {
+
+  time[0] = time[1] = 0;
+
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  if (!device_) {
+    return;
+  }
+
+  nvmlDevice_t device = static_cast<nvmlDevice_t>(device_);
+  nvmlPerfPolicyType_t const policies[2] = {NVML_PERF_POLICY_POWER, NVML_PERF_POLICY_THERMAL};
+
+  for (int i = 0; i < 2; ++i) {
+    nvmlViolationTime_t violation;
+    if (nvmlDeviceGetViolationStatus(device, policies[i], &violation) == NVML_SUCCESS) {
+      time[i] = violation.violationTime;
+    }
+  }
+#endif
+}
+
+void DeviceTelemetryMonitor::begin() {
+  measurement_ = sample_();
+  violation_time_(violation_start_);
+}
+
+void DeviceTelemetryMonitor::sample() {
+  measurement_.accumulate(sample_());
+}
+
+DeviceTelemetry DeviceTelemetryMonitor::end() {
+
+  measurement_.accumulate(sample_());
+
+  unsigned long long violation_end[2];
+  violation_time_(violation_end);
+
+  if (measurement_.valid) {
+    for (int i = 0; i < 2; ++i) {
+      if (violation_end[i] > violation_start_[i]) {
+        measurement_.violation_time += double(violation_end[i] - violation_start_[i]) / 1.0e6;
+      }
+    }
+  }
+
+  return measurement_;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+DeviceClockLock::DeviceClockLock(int device, int sm_clock) {
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  nvmlDevice_t handle = nvml_device(device);
+  if (!handle) {
+    return;
+  }
+  device_ = handle;
+
+  unsigned int memory_clock = 0;
+  if (nvmlDeviceGetDefaultApplicationsClock(handle, NVML_CLOCK_MEM, &memory_clock) != NVML_SUCCESS) {
+    return;
+  }
+
+  if (sm_clock < 0) {
+    unsigned int default_sm_clock = 0;
+    if (nvmlDeviceGetDefaultApplicationsClock(handle, NVML_CLOCK_GRAPHICS, &default_sm_clock) != NVML_SUCCESS) {
+      return;
+    }
+    sm_clock_ = default_sm_clock;
+  }
+  else {
+    sm_clock_ = unsigned(sm_clock);
+  }
+
+  // Locked clocks also prevent boosting above the requested frequency. Older devices only support
+  // application clocks.
+  if (nvmlDeviceSetGpuLockedClocks(handle, sm_clock_, sm_clock_) == NVML_SUCCESS) {
+    method_ = Method::kLockedClocks;
+  }
+  else if (nvmlDeviceSetApplicationsClocks(handle, memory_clock, sm_clock_) == NVML_SUCCESS) {
+    method_ = Method::kApplicationClocks;
+  }
+#endif
+}
+
+DeviceClockLock::~DeviceClockLock() {
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  if (!device_) {
+    return;
+  }
+
+  nvmlDevice_t handle = static_cast<nvmlDevice_t>(device_);
+
+  if (method_ == Method::kLockedClocks) {
+    nvmlDeviceResetGpuLockedClocks(handle);
+  }
+  else if (method_ == Method::kApplicationClocks) {
+    nvmlDeviceResetApplicationsClocks(handle);
+  }
+
+  nvmlShutdown();
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
@@ -0,0 +1,543 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Profiler for grouped GEMM operations (GemmKind::kGrouped)
+/* \file
+   \brief Distributed GEMM instances compiled into the profiler
+
+   Distributed GEMMs are built from the experimental Distributed GEMM API, which requires SM90a and
+   CUDA 12.4 or later. The kernel configuration follows examples/65_distributed_gemm.
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/profiler/distributed_gemm_operation_profiler.h"
+
+#if defined(CUTLASS_PROFILER_ENABLE_DISTRIBUTED_GEMM) && defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED) && \
+    ((__CUDACC_VER_MAJOR__ > 12) || ((__CUDACC_VER_MAJOR__ == 12) && (__CUDACC_VER_MINOR__ >= 4)))
+#define CUTLASS_PROFILER_DISTRIBUTED_GEMM_SUPPORTED 1
+#endif
+
+#if defined(CUTLASS_PROFILER_DISTRIBUTED_GEMM_SUPPORTED)
+
+#include "cute/tensor.hpp"
+#include "cutlass/numeric_types.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "cutlass/experimental/distributed/device/dist_gemm_universal_wrapper.hpp"
+#include "cutlass/experimental/distributed/kernel/dist_gemm_kernel_wrapper.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+
+#define CUDA_CHECK(call)                                                                                               \
+  do {                                                                                                                 \
+    cudaError_t err = call;                                                                                            \
+    if (err != cudaSuccess) {                                                                                          \
+      std::cerr << "CUDA error at " << __FILE__ << ":" << __LINE__ << " code=" << err << " \""                         \
+                << cudaGetErrorString(err) << "\"\n";                                                                  \
+      return Status::kErrorInternal;                                                                                   \
+    }                                                                                                                  \
+  } while (0)
+
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+#if defined(CUTLASS_PROFILER_DISTRIBUTED_GEMM_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using namespace cute;
+
+using ElementA           = cutlass::half_t;
+using LayoutA            = cutlass::layout::RowMajor;
+constexpr int AlignmentA = 128 / cutlass::sizeof_bits<ElementA>::value;
+
+using ElementB           = cutlass::half_t;
+using LayoutB            = cutlass::layout::ColumnMajor;
+constexpr int AlignmentB = 128 / cutlass::sizeof_bits<ElementB>::value;
+
+using ElementC           = cutlass::half_t;
+using LayoutC            = cutlass::layout::ColumnMajor;
+constexpr int AlignmentC = 128 / cutlass::sizeof_bits<ElementC>::value;
+
+using ElementD           = ElementC;
+using LayoutD            = LayoutC;
+constexpr int AlignmentD = AlignmentC;
+
+using ElementAccumulator = float;
+using ElementCompute     = float;
+using TileShape          = Shape<_128,_256,_64>;
+using ClusterShape       = Shape<_1,_2,_1>;
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    TileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementCompute,
+    ElementC, LayoutC, AlignmentC,
+    ElementD, LayoutD, AlignmentD,
+    cutlass::epilogue::TmaWarpSpecialized
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    ElementA, LayoutA, AlignmentA,
+    ElementB, LayoutB, AlignmentB,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))
+    >,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong
+  >::CollectiveOp;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>,
+    CollectiveMainloop,
+    CollectiveEpilogue
+>;
+
+/// Local GEMM run alone to measure the compute-only baseline
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+using StrideA = typename GemmKernel::StrideA;
+using StrideB = typename GemmKernel::StrideB;
+using StrideC = typename GemmKernel::StrideC;
+using StrideD = typename GemmKernel::StrideD;
+
+/// Fills a device allocation with random values in [-2, 2]
+template <typename Element>
+void fill_random(cutlass::device_memory::allocation<Element> &block, uint64_t seed, cudaStream_t stream) {
+  cutlass::reference::device::BlockFillRandomUniform(
+    block.get(), block.size(), seed, Element(2), Element(-2), 0, 0, stream);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Distributed GEMM of one schedule at one tensor-parallel size
+template <template <class> class Schedule_, int TP_>
+class DistributedGemmInstanceImpl : public DistributedGemmInstance {
+public:
+
+  using TP = cute::Int<TP_>;
+  using DistSchedule = Schedule_<TP>;
+  using DistGemmKernel = cutlass::distributed::kernel::DistributedGemmKernelWrapper<GemmKernel, DistSchedule>;
+  using DistGemm = cutlass::distributed::device::DistributedGemmUniversalAdapter<DistGemmKernel>;
+  using DistGemmArguments = typename DistGemm::Arguments;
+
+  static int const kIterations = DistSchedule::NumIterations;
+
+private:
+
+  /// Name of the schedule
+  char const *schedule_;
+
+  /// Devices and global problem of the current initialization
+  std::vector<int> devices_;
+  gemm::GemmCoord problem_size_;
+
+  /// Distributed GEMM state and operands of each device
+  DistGemm dist_gemm_[TP_];
+  DistGemmArguments arguments_[TP_];
+
+  cutlass::device_memory::allocation<ElementA> tensor_A_[TP_];
+  cutlass::device_memory::allocation<ElementB> tensor_B_[TP_];
+  cutlass::device_memory::allocation<ElementC> tensor_C_[TP_];
+  cutlass::device_memory::allocation<ElementD> tensor_D_[TP_];
+  cutlass::device_memory::allocation<uint8_t> workspace_[TP_];
+  cutlass::device_memory::allocation<uint8_t> exclusive_workspace_[TP_];
+
+  /// Local GEMM and operands of each device for the compute-only baseline
+  Gemm gemm_[TP_];
+  cutlass::device_memory::allocation<ElementA> local_A_[TP_];
+  cutlass::device_memory::allocation<ElementB> local_B_[TP_];
+  cutlass::device_memory::allocation<ElementD> local_D_[TP_];
+  cutlass::device_memory::allocation<uint8_t> local_workspace_[TP_];
+
+  /// Source and destination of each device's peer transfers for the communication-only baseline
+  cutlass::device_memory::allocation<uint8_t> send_buffer_[TP_];
+  cutlass::device_memory::allocation<uint8_t> receive_buffer_[TP_];
+
+  static auto problem_shape_(gemm::GemmCoord problem_size) {
+    return cute::make_tuple(problem_size.m(), problem_size.n(), problem_size.k(), 1);
+  }
+
+  /// Bytes each device receives from a peer in each iteration after the first
+  static int64_t iteration_bytes_(gemm::GemmCoord problem_size) {
+    auto problem_shape = problem_shape_(problem_size);
+    int64_t bytes = 0;
+
+    if (DistSchedule::MemcpyA) {
+      bytes += int64_t(size(DistSchedule::get_local_a_shape(problem_shape))) * sizeof(ElementA);
+    }
+    if (DistSchedule::MemcpyB) {
+      bytes += int64_t(size(DistSchedule::get_local_b_shape(problem_shape))) * sizeof(ElementB);
+    }
+    if (DistSchedule::RemoteC) {
+      bytes += int64_t(size(DistSchedule::get_local_c_shape(problem_shape))) * sizeof(ElementC);
+    }
+
+    return bytes;
+  }
+
+  /// Bytes of each slice of D gathered from a peer, or zero if D is not gathered
+  static int64_t gathered_slice_bytes_(gemm::GemmCoord problem_size) {
+    if (!DistSchedule::GatherOutput) {
+      return 0;
+    }
+    auto problem_shape = problem_shape_(problem_size);
+    return int64_t(size(DistSchedule::get_local_d_shape(problem_shape))) / TP_ * sizeof(ElementD);
+  }
+
+public:
+
+  DistributedGemmInstanceImpl(char const *schedule): schedule_(schedule) { }
+
+  virtual ~DistributedGemmInstanceImpl() {
+    release();
+  }
+
+  virtual std::string name() const {
+    return std::string("cutlass3x_sm90_dist_gemm_f16_f16_f32_128x256x64_1x2x1_pingpong_") +
+      schedule_ + "_tp" + std::to_string(TP_);
+  }
+
+  virtual char const *schedule() const {
+    return schedule_;
+  }
+
+  virtual int tp() const {
+    return TP_;
+  }
+
+  virtual gemm::GemmCoord tile_shape() const {
+    return gemm::GemmCoord(128, 256, 64);
+  }
+
+  virtual gemm::GemmCoord cluster_shape() const {
+    return gemm::GemmCoord(1, 2, 1);
+  }
+
+  virtual bool can_implement(gemm::GemmCoord problem_size) const {
+    if (!DistSchedule::can_implement_global(problem_shape_(problem_size))) {
+      return false;
+    }
+    gemm::GemmCoord local = local_gemm_shape(problem_size);
+
+    // Local operands must keep 128-bit alignment
+    return local.m() % AlignmentA == 0 && local.n() % AlignmentB == 0 && local.k() % AlignmentA == 0;
+  }
+
+  virtual gemm::GemmCoord local_gemm_shape(gemm::GemmCoord problem_size) const {
+    auto local = DistSchedule::get_local_gemm_shape(problem_shape_(problem_size));
+    return gemm::GemmCoord(int(get<0>(local)), int(get<1>(local)), int(get<2>(local)));
+  }
+
+  virtual int iterations() const {
+    return kIterations;
+  }
+
+  virtual int64_t peer_bytes(gemm::GemmCoord problem_size) const {
+    return (kIterations - 1) * iteration_bytes_(problem_size) +
+      (TP_ - 1) * gathered_slice_bytes_(problem_size);
+  }
+
+  virtual Status initialize(
+    gemm::GemmCoord problem_size,
+    std::vector<int> const &devices,
+    std::vector<cudaStream_t> const &streams) {
+
+    if (int(devices.size()) < TP_ || int(streams.size()) < TP_) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    release();
+
+    devices_ = devices;
+    problem_size_ = problem_size;
+
+    auto problem_shape = problem_shape_(problem_size);
+
+    auto local_shape_A = DistSchedule::get_local_a_shape(problem_shape);
+    auto local_shape_B = DistSchedule::get_local_b_shape(problem_shape);
+    auto local_shape_C = DistSchedule::get_local_c_shape(problem_shape);
+    auto local_shape_D = DistSchedule::get_local_d_shape(problem_shape);
+
+    gemm::GemmCoord local = local_gemm_shape(problem_size);
+    auto local_problem_shape = cute::make_tuple(local.m(), local.n(), local.k(), 1);
+
+    size_t transfer_bytes = size_t(std::max(iteration_bytes_(problem_size), gathered_slice_bytes_(problem_size)));
+
+    void *workspace_ptrs[TP_];
+    void *exclusive_workspace_ptrs[TP_];
+
+    for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+      CUDA_CHECK(cudaSetDevice(devices_[device_idx]));
+      cudaStream_t stream = streams[device_idx];
+      uint64_t seed = 2024 + 4 * device_idx;
+
+      tensor_A_[device_idx].reset(size(local_shape_A));
+      tensor_B_[device_idx].reset(size(local_shape_B));
+      tensor_C_[device_idx].reset(size(local_shape_C));
+      tensor_D_[device_idx].reset(size(local_shape_D));
+
+      fill_random(tensor_A_[device_idx], seed, stream);
+      fill_random(tensor_B_[device_idx], seed + 1, stream);
+      fill_random(tensor_C_[device_idx], seed + 2, stream);
+
+      arguments_[device_idx] = DistGemmArguments{
+        cutlass::gemm::GemmUniversalMode::kGemm,
+        problem_shape,
+        {
+          tensor_A_[device_idx].get(), cutlass::make_cute_packed_stride(StrideA{}, local_shape_A),
+          tensor_B_[device_idx].get(), cutlass::make_cute_packed_stride(StrideB{}, local_shape_B)
+        },
+        {
+          {ElementCompute(1), ElementCompute(0)},
+          tensor_C_[device_idx].get(), cutlass::make_cute_packed_stride(StrideC{}, local_shape_C),
+          tensor_D_[device_idx].get(), cutlass::make_cute_packed_stride(StrideD{}, local_shape_D)
+        },
+        {},
+        {}
+      };
+
+      workspace_[device_idx].reset(DistGemm::get_workspace_size(arguments_[device_idx]));
+      exclusive_workspace_[device_idx].reset(DistGemm::get_exclusive_workspace_size());
+
+      workspace_ptrs[device_idx] = workspace_[device_idx].get();
+      exclusive_workspace_ptrs[device_idx] = exclusive_workspace_[device_idx].get();
+
+      CUDA_CHECK(cudaMemsetAsync(
+        exclusive_workspace_ptrs[device_idx], 0, DistGemm::get_exclusive_workspace_size(), stream));
+
+      // Compute-only baseline
+      local_A_[device_idx].reset(size_t(local.m()) * local.k());
+      local_B_[device_idx].reset(size_t(local.n()) * local.k());
+      local_D_[device_idx].reset(size_t(local.m()) * local.n());
+
+      fill_random(local_A_[device_idx], seed + 3, stream);
+      fill_random(local_B_[device_idx], seed + 3, stream);
+
+      typename Gemm::Arguments gemm_arguments{
+        cutlass::gemm::GemmUniversalMode::kGemm,
+        local_problem_shape,
+        {
+          local_A_[device_idx].get(), cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(local.m(), local.k(), 1)),
+          local_B_[device_idx].get(), cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(local.n(), local.k(), 1))
+        },
+        {
+          {ElementCompute(1), ElementCompute(0)},
+          local_D_[device_idx].get(), cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(local.m(), local.n(), 1)),
+          local_D_[device_idx].get(), cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(local.m(), local.n(), 1))
+        }
+      };
+
+      Status status = gemm_[device_idx].can_implement(gemm_arguments);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+
+      local_workspace_[device_idx].reset(Gemm::get_workspace_size(gemm_arguments));
+      status = gemm_[device_idx].initialize(gemm_arguments, local_workspace_[device_idx].get(), stream);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+
+      // Communication-only baseline
+      send_buffer_[device_idx].reset(transfer_bytes);
+      receive_buffer_[device_idx].reset(transfer_bytes);
+
+      CUDA_CHECK(cudaStreamSynchronize(stream));
+    }
+
+#if defined(CUTLASS_ENABLE_GDC_FOR_SM90)
+    bool launch_with_pdl = true;
+#else
+    bool launch_with_pdl = false;
+#endif
+
+    for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+      CUDA_CHECK(cudaSetDevice(devices_[device_idx]));
+
+      Status status = dist_gemm_[device_idx].can_implement(arguments_[device_idx]);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+
+      status = dist_gemm_[device_idx].initialize(
+        arguments_,
+        workspace_ptrs,
+        exclusive_workspace_ptrs,
+        device_idx,
+        streams[device_idx],
+        launch_with_pdl);
+
+      if (status != Status::kSuccess) {
+        return status;
+      }
+
+      CUDA_CHECK(cudaStreamSynchronize(streams[device_idx]));
+    }
+
+    return Status::kSuccess;
+  }
+
+  virtual Status run(int device_index, cudaStream_t stream) {
+    return dist_gemm_[device_index].run(stream);
+  }
+
+  virtual Status run_compute(int device_index, cudaStream_t stream) {
+    for (int iteration = 0; iteration < kIterations; ++iteration) {
+      Status status = gemm_[device_index].run(stream);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    return Status::kSuccess;
+  }
+
+  virtual Status run_communication(int device_index, cudaStream_t stream) {
+
+    // The first iteration works on resident operands, and every later one exchanges with a peer
+    size_t bytes = size_t(iteration_bytes_(problem_size_));
+
+    for (int iteration = 1; bytes && iteration < kIterations; ++iteration) {
+      int peer_index = DistSchedule::get_remote_peer_id(device_index, iteration);
+
+      if (cudaMemcpyPeerAsync(
+            receive_buffer_[device_index].get(), devices_[device_index],
+            send_buffer_[peer_index].get(), devices_[peer_index],
+            bytes, stream) != cudaSuccess) {
+        return Status::kErrorInternal;
+      }
+    }
+
+    // All-reduce schedules then gather the reduced slices of D from every peer
+    size_t slice_bytes = size_t(gathered_slice_bytes_(problem_size_));
+
+    for (int peer_index = 0; slice_bytes && peer_index < TP_; ++peer_index) {
+      if (peer_index == device_index) {
+        continue;
+      }
+
+      if (cudaMemcpyPeerAsync(
+            receive_buffer_[device_index].get(), devices_[device_index],
+            send_buffer_[peer_index].get(), devices_[peer_index],
+            slice_bytes, stream) != cudaSuccess) {
+        return Status::kErrorInternal;
+      }
+    }
+
+    return Status::kSuccess;
+  }
+
+  virtual void release() {
+    for (int device_idx = 0; device_idx < int(devices_.size()) && device_idx < TP_; ++device_idx) {
+      cudaSetDevice(devices_[device_idx]);
+
+      tensor_A_[device_idx].reset();
+      tensor_B_[device_idx].reset();
+      tensor_C_[device_idx].reset();
+      tensor_D_[device_idx].reset();
+      workspace_[device_idx].reset();
+      exclusive_workspace_[device_idx].reset();
+      local_A_[device_idx].reset();
+      local_B_[device_idx].reset();
+      local_D_[device_idx].reset();
+      local_workspace_[device_idx].reset();
+      send_buffer_[device_idx].reset();
+      receive_buffer_[device_idx].reset();
+    }
+    devices_.clear();
+  }
+};
+
+/// Adds a schedule at each supported tensor-parallel size
+template <template <class> class Schedule_>
+void append_schedule(DistributedGemmInstanceVector &instances, char const *schedule) {
+  instances.emplace_back(new DistributedGemmInstanceImpl<Schedule_, 2>(schedule));
+  instances.emplace_back(new DistributedGemmInstanceImpl<Schedule_, 4>(schedule));
+  instances.emplace_back(new DistributedGemmInstanceImpl<Schedule_, 8>(schedule));
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+DistributedGemmInstanceVector make_distributed_gemm_instances() {
+
+  namespace schedules = cutlass::distributed::schedules;
+
+  DistributedGemmInstanceVector instances;
+
+  append_schedule<schedules::AllGather1D_TilingCD_RotatingA>(instances, "AllGather1D_TilingCD_RotatingA");
+  append_schedule<schedules::AllGather1D_TilingCD_RotatingB>(instances, "AllGather1D_TilingCD_RotatingB");
+  append_schedule<schedules::ReduceScatter1D_TilingA_RotatingC>(instances, "ReduceScatter1D_TilingA_RotatingC");
+  append_schedule<schedules::ReduceScatter1D_TilingB_RotatingC>(instances, "ReduceScatter1D_TilingB_RotatingC");
+
+  // AllReduce1D_TilingA_RotatingC gathers slices of D along M and requires a row-major D
+  append_schedule<schedules::AllReduce1D_TilingB_RotatingC>(instances, "AllReduce1D_TilingB_RotatingC");
+
+  return instances;
+}
+
+#else
+
+DistributedGemmInstanceVector make_distributed_gemm_instances() {
+  return DistributedGemmInstanceVector();
+}
+
+#endif // defined(CUTLASS_PROFILER_DISTRIBUTED_GEMM_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
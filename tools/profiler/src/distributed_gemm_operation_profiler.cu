@@ -0,0 +1,469 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Profiler for grouped GEMM operations (GemmKind::kGrouped)
+/* \file
+   \brief Profiler for tensor-parallel GEMMs distributed across devices
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <cuda/atomic>
+
+#include "cutlass/profiler/distributed_gemm_operation_profiler.h"
+#include "cutlass/profiler/gpu_timer.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define CUDA_CHECK(call)                                                                                               \
+  do {                                                                                                                 \
+    cudaError_t err = call;                                                                                            \
+    if (err != cudaSuccess) {                                                                                          \
+      std::cerr << "CUDA error at " << __FILE__ << ":" << __LINE__ << " code=" << err << " \""                         \
+                << cudaGetErrorString(err) << "\"\n";                                                                  \
+      return Status::kErrorInternal;                                                                                   \
+    }                                                                                                                  \
+  } while (0)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Holds a stream until the host releases every device at once
+__global__ void distributed_delay(cuda::atomic<bool> const *release) {
+  while (!release->load(cuda::memory_order_acquire)) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 700)
+    __nanosleep(40);
+#endif
+  }
+}
+
+/// Returns true if the schedule satisfies the enumerated argument, which is a schedule name
+bool schedule_satisfies(
+  char const *schedule,
+  char const *name,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  KernelArgument::Value const *value_ptr = problem.at(problem_space.argument_index(name)).get();
+
+  if (value_ptr->argument->description->type != ArgumentTypeID::kEnumerated) {
+    throw std::runtime_error("Kernel argument mismatch");
+  }
+
+  auto const *enumerated = static_cast<EnumeratedTypeArgument::EnumeratedTypeValue const *>(value_ptr);
+
+  return !enumerated->not_null || enumerated->element == schedule;
+}
+
+/// Enables peer access between every pair of devices, returning false if some pair cannot access
+/// each other
+bool enable_peer_access(std::vector<int> const &devices) {
+
+  for (int device : devices) {
+    if (cudaSetDevice(device) != cudaSuccess) {
+      return false;
+    }
+
+    for (int peer : devices) {
+      if (peer == device) {
+        continue;
+      }
+
+      int can_access = 0;
+      if (cudaDeviceCanAccessPeer(&can_access, device, peer) != cudaSuccess || !can_access) {
+        return false;
+      }
+
+      cudaError_t result = cudaDeviceEnablePeerAccess(peer, 0);
+      if (result == cudaErrorPeerAccessAlreadyEnabled) {
+        (void)cudaGetLastError();
+      }
+      else if (result != cudaSuccess) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<std::string> const DistributedGemmOperationProfiler::kResultColumns = {
+  "compute_runtime", "comm_runtime", "overlap"
+};
+
+/// Ctor
+DistributedGemmOperationProfiler::DistributedGemmOperationProfiler(Options const &options):
+  OperationProfiler(
+    options,
+    library::OperationKind::kDistributedGemm,
+    {
+      {ArgumentTypeID::kInteger, {"m", "problem-size::m"}, "M dimension of the global GEMM problem space"},
+      {ArgumentTypeID::kInteger, {"n", "problem-size::n"}, "N dimension of the global GEMM problem space"},
+      {ArgumentTypeID::kInteger, {"k", "problem-size::k"}, "K dimension of the global GEMM problem space"},
+      {ArgumentTypeID::kInteger, {"tp", "tensor-parallel"}, "Number of devices the GEMM is distributed across"},
+      {ArgumentTypeID::kEnumerated, {"schedule"}, "Distributed GEMM schedule (e.g. AllGather1D_TilingCD_RotatingA)"},
+    },
+    {}
+  ),
+  instances_(make_distributed_gemm_instances()) {
+
+  description_ = "      Distributed matrix-matrix product. D = A * B with operands sharded across devices";
+}
+
+/// Destructor
+DistributedGemmOperationProfiler::~DistributedGemmOperationProfiler() {
+
+}
+
+/// Prints usage statement for the math function
+void DistributedGemmOperationProfiler::print_usage(std::ostream &out) const {
+  out << "Distributed GEMM" << "\n\n";
+
+  OperationProfiler::print_usage(out);
+
+  out << "\n  Distributed GEMMs run on the first --tp devices listed in --devices, which must be SM90 devices\n"
+    << "  with peer access to each other. Each schedule is also timed running only its local GEMMs\n"
+    << "  (compute_runtime) and only its peer transfers (comm_runtime). The overlap column is the fraction\n"
+    << "  of the shorter of the two hidden behind the other: (compute + comm - runtime) / min(compute, comm).\n"
+    << "\n  Compiled schedules:\n";
+
+  if (instances_.empty()) {
+    out << "    (none, the profiler was not built for SM90a with CUDA 12.4 or later)\n";
+  }
+
+  for (auto const &instance : instances_) {
+    if (instance->tp() == instances_.front()->tp()) {
+      out << "    " << instance->schedule() << "\n";
+    }
+  }
+}
+
+/// Prints examples
+void DistributedGemmOperationProfiler::print_examples(std::ostream &out) const {
+
+  out << "\nExamples:\n\n"
+    << "Profile every compiled schedule on 8 devices:\n"
+    << "  $ cutlass_profiler --operation=DistributedGemm --devices=0,1,2,3,4,5,6,7 --tp=8 --m=16384 --n=106496 --k=16384\n\n"
+
+    << "Sweep tensor-parallel sizes of one schedule:\n"
+    << "  $ cutlass_profiler --operation=DistributedGemm --devices=0,1,2,3,4,5,6,7 --tp=2,4,8 --schedule=ReduceScatter1D_TilingB_RotatingC\n\n";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Times `launch` running concurrently on the listed devices. A spinning kernel holds every stream
+/// until all devices have been given their start events, so that devices start together and
+/// schedules that wait on peers are not timed while their peers are still being enqueued.
+Status DistributedGemmOperationProfiler::time_on_devices_(
+  double &runtime,
+  Options const &options,
+  std::vector<int> const &devices,
+  std::vector<cudaStream_t> const &streams,
+  std::function<Status(int, cudaStream_t)> const &launch) {
+
+  size_t device_count = devices.size();
+
+  // Duration-based profiling would calibrate on one device, which deadlocks schedules waiting on peers
+  int iterations = options.profiling.iterations > 0 ? options.profiling.iterations : 100;
+
+  for (int iteration = 0; iteration < options.profiling.warmup_iterations; ++iteration) {
+    for (size_t i = 0; i < device_count; ++i) {
+      CUDA_CHECK(cudaSetDevice(devices[i]));
+      Status status = launch(int(i), streams[i]);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < device_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(devices[i]));
+    CUDA_CHECK(cudaStreamSynchronize(streams[i]));
+  }
+
+  sleep(options.profiling.sleep_duration);
+
+  cuda::atomic<bool> *release;
+  CUDA_CHECK(cudaHostAlloc(&release, sizeof(*release), cudaHostAllocPortable));
+  release->store(false, cuda::memory_order_release);
+
+  std::vector<GpuTimer> timer;
+  for (size_t i = 0; i < device_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(devices[i]));
+    timer.emplace_back();
+
+    distributed_delay<<<1, 1, 0, streams[i]>>>(release);
+    timer[i].start(streams[i]);
+  }
+
+  release->store(true, cuda::memory_order_release);
+
+  Status status = Status::kSuccess;
+
+  for (int iteration = 0; status == Status::kSuccess && iteration < iterations; ++iteration) {
+    for (size_t i = 0; status == Status::kSuccess && i < device_count; ++i) {
+      CUDA_CHECK(cudaSetDevice(devices[i]));
+      status = launch(int(i), streams[i]);
+    }
+  }
+
+  runtime = 0;
+  for (size_t i = 0; i < device_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(devices[i]));
+    timer[i].stop_and_wait(streams[i]);
+
+    // Devices finish a distributed GEMM together, so the slowest device bounds its runtime
+    runtime = std::max(runtime, timer[i].duration(iterations));
+  }
+
+  for (size_t i = 0; i < device_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(devices[device_count - i - 1]));
+    timer.pop_back();
+  }
+
+  CUDA_CHECK(cudaFreeHost(release));
+
+  return status;
+}
+
+/// Profiles one instance on one problem
+Status DistributedGemmOperationProfiler::profile_instance_(
+  PerformanceResult &result,
+  Options const &options,
+  DistributedGemmInstance &instance,
+  gemm::GemmCoord problem_size,
+  std::vector<int> const &devices) {
+
+  std::vector<cudaStream_t> streams(devices.size(), nullptr);
+
+  for (size_t i = 0; i < devices.size(); ++i) {
+    CUDA_CHECK(cudaSetDevice(devices[i]));
+    CUDA_CHECK(cudaStreamCreateWithFlags(&streams[i], cudaStreamNonBlocking));
+  }
+
+  Status status = instance.initialize(problem_size, devices, streams);
+
+  double compute_runtime = 0;
+  double comm_runtime = 0;
+
+  if (status == Status::kSuccess) {
+    status = time_on_devices_(result.runtime, options, devices, streams,
+      [&](int device_index, cudaStream_t stream) { return instance.run(device_index, stream); });
+  }
+
+  if (status == Status::kSuccess) {
+    status = time_on_devices_(compute_runtime, options, devices, streams,
+      [&](int device_index, cudaStream_t stream) { return instance.run_compute(device_index, stream); });
+  }
+
+  if (status == Status::kSuccess) {
+    status = time_on_devices_(comm_runtime, options, devices, streams,
+      [&](int device_index, cudaStream_t stream) { return instance.run_communication(device_index, stream); });
+  }
+
+  instance.release();
+
+  for (size_t i = 0; i < devices.size(); ++i) {
+    cudaSetDevice(devices[i]);
+    cudaStreamDestroy(streams[i]);
+  }
+
+  if (status != Status::kSuccess) {
+    (void)cudaGetLastError();
+    result.runtime = 0;
+    return status;
+  }
+
+  // Fraction of the shorter of computation and communication hidden behind the longer one
+  double overlap = 0;
+  double hideable = std::min(compute_runtime, comm_runtime);
+
+  if (hideable > 0) {
+    overlap = (compute_runtime + comm_runtime - result.runtime) / hideable;
+  }
+
+  double values[] = {compute_runtime, comm_runtime, overlap};
+
+  size_t column = result.arguments.size() - kResultColumns.size();
+  for (size_t i = 0; i < kResultColumns.size(); ++i) {
+    std::stringstream ss;
+    ss << values[i];
+    result.arguments[column + i] = std::make_pair(kResultColumns[i], ss.str());
+  }
+
+  return Status::kSuccess;
+}
+
+/// Profiles the compiled instances over the problem space
+int DistributedGemmOperationProfiler::profile_all(
+  Options const &options,
+  library::Manifest const &manifest,
+  DeviceContext &device_context) {
+
+  // Distributed GEMMs take over several devices and are only profiled when selected explicitly
+  if (options.operation_kind != kind_) {
+    return 0;
+  }
+
+  if (instances_.empty()) {
+    std::cerr << "Warning: no distributed GEMMs were compiled into the profiler, which requires "
+              << "building for SM90a with CUDA 12.4 or later" << std::endl;
+    return 0;
+  }
+
+  ProblemSpace problem_space(arguments_, options.cmdline);
+
+  std::vector<std::string> argument_names = problem_space.argument_names();
+  argument_names.insert(argument_names.end(), kResultColumns.begin(), kResultColumns.end());
+
+  PerformanceReport report(options, argument_names, kind_);
+
+  int retval = 0;
+  size_t problem_index = 0;
+
+  for (auto problem_it = problem_space.begin(); problem_it != problem_space.end(); ++problem_it) {
+    ProblemSpace::Problem problem = problem_it.at();
+    ++problem_index;
+
+    int64_t m = 8192;
+    int64_t n = 8192;
+    int64_t k = 8192;
+    int64_t tp = 0;
+
+    arg_as_int(m, "m", problem_space, problem);
+    arg_as_int(n, "n", problem_space, problem);
+    arg_as_int(k, "k", problem_space, problem);
+    bool tp_specified = arg_as_int(tp, "tp", problem_space, problem);
+
+    gemm::GemmCoord problem_size(int(m), int(n), int(k));
+
+    for (auto &instance : instances_) {
+
+      if ((tp_specified && instance->tp() != tp) ||
+          !schedule_satisfies(instance->schedule(), "schedule", problem_space, problem)) {
+        continue;
+      }
+
+      if (int(options.device.devices.size()) < instance->tp()) {
+        if (tp_specified) {
+          std::cerr << "Warning: " << instance->name() << " requires " << instance->tp()
+                    << " devices but only " << options.device.devices.size() << " are listed [--devices]" << std::endl;
+        }
+        continue;
+      }
+
+      std::vector<int> devices(options.device.devices.begin(), options.device.devices.begin() + instance->tp());
+
+      bool supported = true;
+      for (int i = 0; i < instance->tp(); ++i) {
+        supported = supported && options.device.compute_capability(i) >= 90;
+      }
+
+      if (!supported || !instance->can_implement(problem_size)) {
+        continue;
+      }
+
+      if (!enable_peer_access(devices)) {
+        std::cerr << "Warning: " << instance->name() << " requires peer access between devices" << std::endl;
+        (void)cudaGetLastError();
+        continue;
+      }
+
+      PerformanceResult result;
+
+      result.op_kind = kind_;
+      result.provider = library::Provider::kCUTLASS;
+      result.disposition = Disposition::kNotVerified;
+      result.operation_name = instance->name();
+      result.runtime_vector.resize(options.device.devices.size(), 0);
+
+      result.arguments.resize(problem_space.rank() + kResultColumns.size());
+
+      set_argument(result, "m", problem_space, m);
+      set_argument(result, "n", problem_space, n);
+      set_argument(result, "k", problem_space, k);
+      set_argument(result, "tp", problem_space, instance->tp());
+      set_argument(result, "schedule", problem_space, instance->schedule());
+
+      set_argument(result, "op_class", problem_space, library::to_string(library::OpcodeClassID::kTensorOp));
+      set_argument(result, "accum", problem_space, library::to_string(library::NumericTypeID::kF32));
+      set_argument(result, "cta_m", problem_space, instance->tile_shape().m());
+      set_argument(result, "cta_n", problem_space, instance->tile_shape().n());
+      set_argument(result, "cta_k", problem_space, instance->tile_shape().k());
+      set_argument(result, "cluster_m", problem_space, instance->cluster_shape().m());
+      set_argument(result, "cluster_n", problem_space, instance->cluster_shape().n());
+      set_argument(result, "cluster_k", problem_space, instance->cluster_shape().k());
+      set_argument(result, "min_cc", problem_space, 90);
+      set_argument(result, "max_cc", problem_space, 90);
+
+      // Work and peer traffic of each device
+      result.flops = 2 * m * n * k / instance->tp();
+      result.bytes = instance->peer_bytes(problem_size);
+
+      if (options.profiling.enabled) {
+        result.status = profile_instance_(result, options, *instance, problem_size, devices);
+
+        if (result.status != Status::kSuccess) {
+          result.disposition = Disposition::kFailed;
+          retval = 1;
+        }
+
+        for (int i = 0; i < instance->tp(); ++i) {
+          result.runtime_vector[i] = result.runtime;
+        }
+      }
+
+      report.append_result(result, problem_index);
+    }
+  }
+
+  return retval;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
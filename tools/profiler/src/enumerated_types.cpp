@@ -221,6 +221,93 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+static struct {
+  char const *text;
+  char const *pretty;
+  WorkspaceFormat enumerant;
+}
+WorkspaceFormat_enumerants[] = {
+  {"csv", "CSV", WorkspaceFormat::kCsv},
+  {"npy", "NPY", WorkspaceFormat::kNpy}
+};
+
+/// Converts a WorkspaceFormat enumerant to a string
+char const *to_string(WorkspaceFormat format, bool pretty) {
+
+  for (auto const & possible : WorkspaceFormat_enumerants) {
+    if (format == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Parses a WorkspaceFormat enumerant from a string
+template <>
+WorkspaceFormat from_string<WorkspaceFormat>(std::string const &str) {
+
+  for (auto const & possible : WorkspaceFormat_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return WorkspaceFormat::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static struct {
+  char const *text;
+  char const *pretty;
+  InterferenceLoad enumerant;
+}
+InterferenceLoad_enumerants[] = {
+  {"none", "None", InterferenceLoad::kNone},
+  {"bandwidth", "Bandwidth", InterferenceLoad::kBandwidth},
+  {"occupancy", "Occupancy", InterferenceLoad::kOccupancy}
+};
+
+/// Converts an InterferenceLoad enumerant to a string
+char const *to_string(InterferenceLoad load, bool pretty) {
+
+  for (auto const & possible : InterferenceLoad_enumerants) {
+    if (load == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Parses an InterferenceLoad enumerant from a string
+template <>
+InterferenceLoad from_string<InterferenceLoad>(std::string const &str) {
+
+  for (auto const & possible : InterferenceLoad_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return InterferenceLoad::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 static struct {
   char const *text;
   char const *pretty;
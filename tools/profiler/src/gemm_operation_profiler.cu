@@ -37,6 +37,7 @@
 #include <iomanip>
 #include <ios>
 #include <vector>
+#include <algorithm>
 
 #include "cutlass/core_io.h"
 #include <cuda_runtime_api.h>
@@ -77,6 +78,7 @@ GemmOperationProfiler::GemmOperationProfiler(Options const &options):
       {ArgumentTypeID::kInteger, {"batch_count", "batch-count"}, "Number of GEMMs computed in one batch"},
       {ArgumentTypeID::kEnumerated, {"raster_order", "raster-order"}, "Raster order (heuristic, along_n, along_m)"},
       {ArgumentTypeID::kInteger, {"use_pdl", "use-pdl"}, "Use PDL (true, false)"}, 
+      {ArgumentTypeID::kInteger, {"sparse_compression", "sparse-compression"}, "Also profile compressing A and compression followed by the GEMM, for structured-sparse GEMMs (true, false)"},
       {ArgumentTypeID::kInteger, {"swizzle_size", "swizzle-size"}, "Size to swizzle"},
     },
     { library::Provider::kCUBLAS}
@@ -177,6 +179,11 @@ Status GemmOperationProfiler::GemmProblem::parse(
     this->use_pdl = false;
   }
 
+  if (!arg_as_bool(this->sparse_compression, "sparse_compression", problem_space, problem)) {
+    // default value
+    this->sparse_compression = false;
+  }
+
   if (!arg_as_SplitKModeID(this->split_k_mode, "split_k_mode", problem_space, problem)) {
     // default value
     this->split_k_mode = library::SplitKMode::kSerial;
@@ -282,6 +289,15 @@ int64_t GemmOperationProfiler::GemmProblem::bytes(library::GemmDescription const
     bytes += int64_t(library::sizeof_bits(operation_desc.C.element) * m / 8) * n;
   }
 
+  // Bias read and auxiliary output written by a fused epilogue
+  library::EpilogueFusionDescription const &fusion = operation_desc.epilogue_fusion;
+  if (fusion.element_bias != library::NumericTypeID::kInvalid) {
+    bytes += int64_t(library::sizeof_bits(fusion.element_bias) * m / 8);
+  }
+  if (fusion.element_aux != library::NumericTypeID::kInvalid) {
+    bytes += int64_t(library::sizeof_bits(fusion.element_aux) * m / 8) * n;
+  }
+
   bytes *= batch_count;
 
   return bytes;
@@ -344,6 +360,7 @@ void GemmOperationProfiler::GemmProblem::initialize_result(
   set_argument(result, "raster_order", problem_space, library::to_string(raster_order));
   set_argument(result, "swizzle_size", problem_space, swizzle_size);
   set_argument(result, "use_pdl", problem_space, library::to_string(use_pdl));
+  set_argument(result, "sparse_compression", problem_space, library::to_string(sparse_compression));
 
   set_argument(result, "alpha", problem_space,
     library::lexical_cast(alpha, operation_desc.element_epilogue));
@@ -439,6 +456,62 @@ Status GemmOperationProfiler::initialize_configuration(
   return status;
 }
 
+/// Relative roofline cost of the operation: the number of waves of output tiles the problem
+/// quantizes into, times the per-tile time bounded by either math or operand traffic
+double GemmOperationProfiler::modeled_cost_(
+  Options const &options,
+  library::OperationDescription const &op_desc,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) const {
+
+  // Approximate MACs a tile can issue per operand element it fetches from L2 before becoming
+  // bandwidth bound. Tiles with a smaller m*n/(m+n) ratio than this are modeled as memory bound.
+  constexpr double kMacsPerOperandElement = 32;
+
+  library::GemmDescription const &gemm_desc = static_cast<library::GemmDescription const &>(op_desc);
+
+  GemmProblem gemm_problem;
+  if (gemm_problem.parse(gemm_desc, problem_space, problem) != Status::kSuccess) {
+    return 0;
+  }
+
+  library::TileDescription const &tile = op_desc.tile_description;
+
+  int64_t cta_m = tile.threadblock_shape.m();
+  int64_t cta_n = tile.threadblock_shape.n();
+  int64_t cta_k = tile.threadblock_shape.k();
+  int64_t cluster_m = std::max(tile.cluster_shape.m(), 1);
+  int64_t cluster_n = std::max(tile.cluster_shape.n(), 1);
+
+  if (cta_m <= 0 || cta_n <= 0 || cta_k <= 0 || options.device.properties.empty()) {
+    return 0;
+  }
+
+  // Clusters launch whole, so the tile grid is padded to a multiple of the cluster shape
+  int64_t tiles_m = (gemm_problem.m + cta_m - 1) / cta_m;
+  int64_t tiles_n = (gemm_problem.n + cta_n - 1) / cta_n;
+  tiles_m = (tiles_m + cluster_m - 1) / cluster_m * cluster_m;
+  tiles_n = (tiles_n + cluster_n - 1) / cluster_n * cluster_n;
+
+  int64_t split_k = std::max(gemm_problem.split_k_slices, 1);
+  int64_t tiles = tiles_m * tiles_n * std::max(gemm_problem.batch_count, 1) * split_k;
+
+  int64_t k_per_tile = (gemm_problem.k + split_k - 1) / split_k;
+  k_per_tile = (k_per_tile + cta_k - 1) / cta_k * cta_k;
+
+  // Each wave fills as many whole clusters as fit on the device
+  int64_t sm_count = options.kernel_sm_count();
+  int64_t cluster_size = cluster_m * cluster_n;
+  int64_t tiles_per_wave = std::max(sm_count / cluster_size, int64_t(1)) * cluster_size;
+  int64_t waves = (tiles + tiles_per_wave - 1) / tiles_per_wave;
+
+  double tile_time = std::max(
+    double(cta_m * cta_n),
+    kMacsPerOperandElement * double(cta_m + cta_n)) * double(k_per_tile);
+
+  return double(waves) * tile_time;
+}
+
 /// Initializes the performance result
 void GemmOperationProfiler::initialize_result_(
   PerformanceResult &result,
@@ -616,6 +689,65 @@ Status GemmOperationProfiler::initialize_workspace(
         problem_.batch_count * gemm_workspace_[i].problem_count,
         i // device_index
       );
+
+      // Operands of a fused epilogue
+      library::EpilogueFusionDescription const &fusion = operation_desc.epilogue_fusion;
+      if (fusion.element_bias != library::NumericTypeID::kInvalid) {
+        gemm_workspace_[i].Bias = device_context.allocate_and_initialize_tensor(
+          options,
+          "Bias",
+          fusion.element_bias,
+          library::LayoutTypeID::kColumnMajor,
+          {int(problem_.m), 1},
+          {int(problem_.m)},
+          problem_.batch_count * gemm_workspace_[i].problem_count,
+          seed_shift++,
+          i // device_index
+        );
+      }
+
+      if (fusion.element_aux != library::NumericTypeID::kInvalid) {
+        gemm_workspace_[i].Aux = device_context.allocate_tensor(
+          options,
+          "Aux",
+          fusion.element_aux,
+          operation_desc.D.layout,
+          {int(problem_.m), int(problem_.n)},
+          {int(problem_.ldc)},
+          problem_.batch_count * gemm_workspace_[i].problem_count,
+          i // device_index
+        );
+      }
+
+      // Unit scale factors scale_a, scale_b, scale_c, scale_d and scale_aux, one scalar per batch entry
+      if (fusion.has_scale_factors) {
+        gemm_workspace_[i].ScaleFactors = device_context.allocate_tensor(
+          options,
+          "ScaleFactors",
+          operation_desc.element_epilogue,
+          library::LayoutTypeID::kColumnMajor,
+          {1, 1},
+          {1},
+          5,
+          i // device_index
+        );
+        gemm_workspace_[i].ScaleFactors->fill_device(1);
+      }
+
+      // amax_d and amax_aux
+      if (fusion.element_amax != library::NumericTypeID::kInvalid) {
+        gemm_workspace_[i].Amax = device_context.allocate_tensor(
+          options,
+          "Amax",
+          fusion.element_amax,
+          library::LayoutTypeID::kColumnMajor,
+          {1, 1},
+          {1},
+          2,
+          i // device_index
+        );
+        gemm_workspace_[i].Amax->fill_device(0);
+      }
     }
 
     if (options.execution_mode != ExecutionMode::kDryRun) {
@@ -631,8 +763,28 @@ Status GemmOperationProfiler::initialize_workspace(
       gemm_workspace_[i].arguments.batch_stride_C = gemm_workspace_[i].C->batch_stride();
       gemm_workspace_[i].arguments.batch_stride_D = gemm_workspace_[i].Computed->batch_stride();
 
+      if (gemm_workspace_[i].Bias) {
+        gemm_workspace_[i].arguments.batch_stride_bias = gemm_workspace_[i].Bias->batch_stride();
+      }
+      if (gemm_workspace_[i].Aux) {
+        gemm_workspace_[i].arguments.ld_aux = problem_.ldc;
+        gemm_workspace_[i].arguments.batch_stride_aux = gemm_workspace_[i].Aux->batch_stride();
+      }
+      if (gemm_workspace_[i].ScaleFactors) {
+        gemm_workspace_[i].arguments.scale_a = gemm_workspace_[i].ScaleFactors->batch_data(0);
+        gemm_workspace_[i].arguments.scale_b = gemm_workspace_[i].ScaleFactors->batch_data(1);
+        gemm_workspace_[i].arguments.scale_c = gemm_workspace_[i].ScaleFactors->batch_data(2);
+        gemm_workspace_[i].arguments.scale_d = gemm_workspace_[i].ScaleFactors->batch_data(3);
+        gemm_workspace_[i].arguments.scale_aux = gemm_workspace_[i].ScaleFactors->batch_data(4);
+      }
+      if (gemm_workspace_[i].Amax) {
+        gemm_workspace_[i].arguments.amax_d = gemm_workspace_[i].Amax->batch_data(0);
+        gemm_workspace_[i].arguments.amax_aux = gemm_workspace_[i].Amax->batch_data(1);
+      }
+      set_epilogue_fusion_arguments_(gemm_workspace_[i], 0);
+
       /* Query device SM count to pass onto the kernel as an argument, where needed */
-      gemm_workspace_[i].arguments.sm_count = options.device.properties[0].multiProcessorCount;
+      gemm_workspace_[i].arguments.sm_count = options.kernel_sm_count();
       gemm_workspace_[i].arguments.device_index = static_cast<int>(i);
     }
   }
@@ -725,6 +877,18 @@ Status GemmOperationProfiler::initialize_workspace(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Points the bias and auxiliary output of a fused epilogue at the given batch of the workspace
+void GemmOperationProfiler::set_epilogue_fusion_arguments_(GemmWorkspace &workspace, int problem_idx) {
+  if (workspace.Bias) {
+    workspace.arguments.bias = workspace.Bias->batch_data(problem_idx);
+  }
+  if (workspace.Aux) {
+    workspace.arguments.aux = workspace.Aux->batch_data(problem_idx);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Verifies CUTLASS against references
 bool GemmOperationProfiler::verify_cutlass(
   Options const &options,
@@ -748,6 +912,7 @@ bool GemmOperationProfiler::verify_cutlass(
     gemm_workspace_[i].arguments.B = gemm_workspace_[i].B->data();
     gemm_workspace_[i].arguments.C = gemm_workspace_[i].C->data();
     gemm_workspace_[i].arguments.D = gemm_workspace_[i].Computed->data();
+    set_epilogue_fusion_arguments_(gemm_workspace_[i], 0);
     gemm_workspace_[i].arguments.alpha = problem_.alpha.data();
     gemm_workspace_[i].arguments.beta = problem_.beta.data();
     gemm_workspace_[i].arguments.pointer_mode = library::ScalarPointerMode::kHost;
@@ -826,7 +991,16 @@ bool GemmOperationProfiler::verify_cutlass(
   // Run verification providers
   //
 
-  if (options.verification.enabled) {
+  library::GemmDescription const &fusion_desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  // Reference GEMMs compute a linear combination only, so fused epilogues are profiled unverified
+  if (options.verification.enabled && fusion_desc.epilogue_fusion.is_fused()) {
+    for (auto provider : options.verification.providers) {
+      results_.back().verification_map[provider] = Disposition::kNotSupported;
+    }
+  }
+  else if (options.verification.enabled) {
 
 #if CUTLASS_ENABLE_CUBLAS
     if (options.verification.provider_enabled(library::Provider::kCUBLAS)) {
@@ -1179,6 +1353,7 @@ bool GemmOperationProfiler::profile(
       gemm_workspace_[i].arguments.B = gemm_workspace_[i].B->data();
       gemm_workspace_[i].arguments.C = gemm_workspace_[i].C->data();
       gemm_workspace_[i].arguments.D = gemm_workspace_[i].Computed->data();
+      set_epilogue_fusion_arguments_(gemm_workspace_[i], 0);
       gemm_workspace_[i].arguments.alpha = problem_.alpha.data();
       gemm_workspace_[i].arguments.beta = problem_.beta.data();
       gemm_workspace_[i].arguments.pointer_mode = library::ScalarPointerMode::kHost;
@@ -1209,12 +1384,109 @@ bool GemmOperationProfiler::profile(
       nullptr,
       nullptr
     );
+
+    library::GemmDescription const &operation_desc =
+      static_cast<library::GemmDescription const &>(operation->description());
+
+    bool is_sparse = operation_desc.tile_description.math_instruction.opcode_class == cutlass::library::OpcodeClassID::kSparseTensorOp;
+
+    if (is_sparse && problem_.sparse_compression &&
+        problem_.split_k_mode != library::SplitKMode::kParallel &&
+        results_.back().status == Status::kSuccess) {
+      PerformanceResult gemm_result = results_.back();
+      profile_sparse_compression_(options, operation, gemm_result);
+    }
   }
   return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Profiles compressing the dense A operand of a structured-sparse GEMM
+Status GemmOperationProfiler::profile_sparse_compression_(
+  Options const &options,
+  library::Operation const *operation,
+  PerformanceResult const &gemm_result) {
+
+  library::GemmDescription const &operation_desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  // Compression is profiled on the first device only
+  GemmWorkspace &workspace = gemm_workspace_[0];
+  cudaSetDevice(options.device.device_id(0));
+
+  library::SparseGemmCompressionSizes sizes;
+  Status status = operation->get_compression_sizes(&workspace.configuration, &sizes);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  // Compression workspace : | tensor_ac | tensor_e | compressor workspace |
+  workspace.compression_workspace.reset(
+    library::NumericTypeID::kU8,
+    sizes.tensor_a_compressed_bytes + sizes.tensor_e_bytes + sizes.workspace_bytes);
+
+  auto *compression_ptr = static_cast<uint8_t *>(workspace.compression_workspace.data());
+
+  library::SparseGemmCompressionArguments arguments;
+  arguments.A_compressed = compression_ptr;
+  arguments.E = compression_ptr + sizes.tensor_a_compressed_bytes;
+  arguments.sm_count = options.kernel_sm_count();
+  void *compressor_workspace = compression_ptr + sizes.tensor_a_compressed_bytes + sizes.tensor_e_bytes;
+
+  auto launch_compression = [&](cudaStream_t stream, int iteration) {
+    int problem_idx = (iteration % workspace.problem_count) * problem_.batch_count;
+    arguments.A = workspace.A->batch_data(problem_idx);
+    return operation->compress(&workspace.configuration, &arguments, compressor_workspace, stream);
+  };
+
+  // Compression reads the dense A and writes the compressed A and its metadata
+  PerformanceResult compression_result = gemm_result;
+  compression_result.operation_name = gemm_result.operation_name + "_compress";
+  compression_result.bytes =
+    int64_t(library::sizeof_bits(operation_desc.A.element) * problem_.m / 8) * problem_.k * problem_.batch_count +
+    int64_t(sizes.tensor_a_compressed_bytes + sizes.tensor_e_bytes);
+  compression_result.flops = 0;
+  compression_result.status = profile_kernel_(compression_result, options, launch_compression, workspace.stream);
+  results_.push_back(compression_result);
+
+  if (compression_result.status != Status::kSuccess) {
+    return compression_result.status;
+  }
+
+  // Dense-to-sparse GEMM: each iteration compresses A and then runs the GEMM. The GEMM reads the
+  // compressed copy held in the operation's workspace, which has the same size and layout.
+  auto launch_compression_and_gemm = [&](cudaStream_t stream, int iteration) {
+    Status status = launch_compression(stream, iteration);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    int problem_idx = (iteration % workspace.problem_count) * problem_.batch_count;
+    workspace.arguments.A = workspace.A->batch_data(problem_idx);
+    workspace.arguments.B = workspace.B->batch_data(problem_idx);
+    workspace.arguments.C = workspace.C->batch_data(problem_idx);
+    workspace.arguments.D = workspace.Computed->batch_data(problem_idx);
+    set_epilogue_fusion_arguments_(workspace, problem_idx);
+
+    return operation->run(
+      &workspace.arguments,
+      workspace.host_workspace.data(),
+      workspace.device_workspace.data(),
+      stream);
+  };
+
+  PerformanceResult end_to_end_result = gemm_result;
+  end_to_end_result.operation_name = gemm_result.operation_name + "_compress_gemm";
+  end_to_end_result.bytes = gemm_result.bytes + compression_result.bytes;
+  end_to_end_result.status = profile_kernel_(end_to_end_result, options, launch_compression_and_gemm, workspace.stream);
+  results_.push_back(end_to_end_result);
+
+  return end_to_end_result.status;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Method to profile a CUTLASS Operation
 Status GemmOperationProfiler::profile_cutlass_(
   PerformanceResult &result,
@@ -1240,6 +1512,7 @@ Status GemmOperationProfiler::profile_cutlass_(
     gemm_workspace_[dev_id].arguments.B = gemm_workspace_[dev_id].B->batch_data(problem_idx);
     gemm_workspace_[dev_id].arguments.C = gemm_workspace_[dev_id].C->batch_data(problem_idx);
     gemm_workspace_[dev_id].arguments.D = gemm_workspace_[dev_id].Computed->batch_data(problem_idx);
+    set_epilogue_fusion_arguments_(gemm_workspace_[dev_id], problem_idx);
 
     if (problem_.split_k_mode == library::SplitKMode::kParallel) {
       gemm_workspace_[dev_id].arguments.D                     = gemm_workspace_[dev_id].device_workspace.data();
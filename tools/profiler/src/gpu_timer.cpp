@@ -96,9 +96,11 @@ void GpuTimer::stop_and_wait(cudaStream_t stream, const unsigned int flag) {
     }
   }
   else {
-    result = cudaDeviceSynchronize();
+    // Waiting on the event rather than the device allows background work on other streams, such
+    // as an interference load, to keep running
+    result = cudaEventSynchronize(events[1]);
     if (result != cudaSuccess) {
-      throw std::runtime_error("Failed to synchronize with CUDA device.");
+      throw std::runtime_error("Failed to synchronize with stop event.");
     }
   }
 }
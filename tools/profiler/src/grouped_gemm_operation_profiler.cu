@@ -0,0 +1,1217 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Profiler for grouped GEMM operations (GemmKind::kGrouped)
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "cutlass/profiler/cublas_helpers.h"
+#include "cutlass/profiler/grouped_gemm_operation_profiler.h"
+#include "cutlass/profiler/gpu_timer.h"
+#include "cutlass/library/handle.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Parses a problem size of the form MxNxK (or "M N K", "M,N,K")
+bool parse_problem_size(gemm::GemmCoord &problem_size, std::string token) {
+
+  std::replace(token.begin(), token.end(), 'x', ' ');
+  std::replace(token.begin(), token.end(), ',', ' ');
+
+  std::istringstream stream(token);
+  int m = 0;
+  int n = 0;
+  int k = 0;
+
+  if (!(stream >> m >> n >> k) || m < 0 || n <= 0 || k <= 0) {
+    return false;
+  }
+
+  problem_size = gemm::GemmCoord(m, n, k);
+  return true;
+}
+
+/// Splits groups * m rows across groups with weights proportional to (i + 1)^-skew, as tokens are
+/// routed to experts in a mixture-of-experts layer. Rows are assigned in multiples of 8 so that
+/// column-major operands keep 128-bit alignment; a remainder of the total goes to the first group.
+std::vector<int> skewed_group_rows(int64_t groups, int64_t m, double skew) {
+
+  std::vector<int> rows(size_t(groups), int(m));
+
+  if (skew == 0) {
+    return rows;
+  }
+
+  int64_t const kGranularity = 8;
+  int64_t total = groups * m;
+  int64_t units = total / kGranularity;
+
+  std::vector<double> weights(size_t(groups));
+  double weight_sum = 0;
+
+  for (int64_t i = 0; i < groups; ++i) {
+    weights[i] = std::pow(double(i + 1), -skew);
+    weight_sum += weights[i];
+  }
+
+  int64_t assigned = 0;
+  for (int64_t i = 0; i < groups; ++i) {
+    int64_t group_units = int64_t(std::floor(double(units) * weights[i] / weight_sum));
+    rows[i] = int(group_units);
+    assigned += group_units;
+  }
+
+  // Units lost to rounding go to the heaviest groups first
+  for (int64_t i = 0; assigned < units; i = (i + 1) % groups, ++assigned) {
+    ++rows[i];
+  }
+
+  for (auto &group_rows : rows) {
+    group_rows *= int(kGranularity);
+  }
+
+  rows[0] += int(total - units * kGranularity);
+
+  return rows;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Ctor
+GroupedGemmOperationProfiler::GroupedGemmOperationProfiler(Options const &options):
+  OperationProfiler(
+    options,
+    library::OperationKind::kGroupedGemm,
+    {
+      {ArgumentTypeID::kInteger, {"groups", "problem-count"}, "Number of groups of a synthesized workload"},
+      {ArgumentTypeID::kInteger, {"m", "problem-size::m"}, "Mean M extent per group of a synthesized workload"},
+      {ArgumentTypeID::kInteger, {"n", "problem-size::n"}, "N extent of every group of a synthesized workload"},
+      {ArgumentTypeID::kInteger, {"k", "problem-size::k"}, "K extent of every group of a synthesized workload"},
+      {ArgumentTypeID::kScalar, {"skew"}, "Zipf exponent of the M distribution across groups (0 is uniform)"},
+      {ArgumentTypeID::kTensor, {"A"}, "Tensor storing the A operand"},
+      {ArgumentTypeID::kTensor, {"B"}, "Tensor storing the B operand"},
+      {ArgumentTypeID::kTensor, {"C"}, "Tensor storing the C operand"},
+      {ArgumentTypeID::kScalar, {"alpha", "epilogue::alpha"}, "Epilogue scalar alpha"},
+      {ArgumentTypeID::kScalar, {"beta", "epilogue::beta"}, "Epilogue scalar beta"},
+    },
+    { library::Provider::kCUBLAS}
+  ) {
+
+  description_ = "      Grouped matrix-matrix product. D[i] = alpha * A[i]*B[i] + beta * C[i]";
+}
+
+/// Destructor
+GroupedGemmOperationProfiler::~GroupedGemmOperationProfiler() {
+
+}
+
+/// Prints usage statement for the math function
+void GroupedGemmOperationProfiler::print_usage(std::ostream &out) const {
+  out << "Grouped GEMM" << "\n\n";
+
+  OperationProfiler::print_usage(out);
+
+  out << "\n  Problem sizes may instead be listed explicitly, overriding --groups, --m, --n, --k and --skew:\n"
+    << "  --problem-sizes=<MxNxK,...>                       Problem size of each group\n"
+    << "  --problem-sizes-file=<path>                       File with one MxNxK problem size per line ('#' starts a comment)\n";
+}
+
+/// Prints examples
+void GroupedGemmOperationProfiler::print_examples(std::ostream &out) const {
+
+  out << "\nExamples:\n\n"
+    << "Profile a list of problem sizes:\n"
+    << "  $ cutlass_profiler --operation=GroupedGemm --problem-sizes=1024x512x256,256x512x256,64x512x256\n\n"
+
+    << "Profile problem sizes read from a file:\n"
+    << "  $ cutlass_profiler --operation=GroupedGemm --problem-sizes-file=experts.txt\n\n"
+
+    << "Schmoo over the skew of 64 experts receiving 512 tokens on average:\n"
+    << "  $ cutlass_profiler --operation=GroupedGemm --groups=64 --m=512 --n=4096 --k=7168 --skew=0,0.5,1,1.5\n\n"
+
+    << "Compare CUTLASS against cuBLAS grouped GEMM:\n"
+    << "  $ cutlass_profiler --operation=GroupedGemm --problem-sizes-file=experts.txt --providers=cutlass,cublas\n\n";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+Status GroupedGemmOperationProfiler::GroupedGemmProblem::parse(
+  library::GemmDescription const &operation_desc,
+  Options const &options,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  problem_sizes.clear();
+
+  //
+  // Explicit problem sizes from a file or the command line
+  //
+
+  std::vector<std::string> tokens;
+  std::string path;
+
+  options.cmdline.get_cmd_line_argument("problem-sizes-file", path);
+
+  if (!path.empty()) {
+    std::ifstream file(path);
+
+    if (!file.good()) {
+      std::cerr << "Failed to open problem sizes file: " << path << "\n";
+      return Status::kErrorInvalidProblem;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+      size_t comment = line.find('#');
+      if (comment != std::string::npos) {
+        line.resize(comment);
+      }
+      if (line.find_first_not_of(" \t\r") != std::string::npos) {
+        tokens.push_back(line);
+      }
+    }
+  }
+  else {
+    options.cmdline.get_cmd_line_arguments("problem-sizes", tokens);
+  }
+
+  for (auto const &token : tokens) {
+    gemm::GemmCoord problem_size;
+
+    if (!parse_problem_size(problem_size, token)) {
+      std::cerr << "Invalid grouped GEMM problem size: " << token << "\n";
+      return Status::kErrorInvalidProblem;
+    }
+
+    problem_sizes.push_back(problem_size);
+  }
+
+  listed = !problem_sizes.empty();
+
+  //
+  // Synthesized workload
+  //
+
+  if (!arg_as_int(this->groups, "groups", problem_space, problem)) {
+    // default value
+    this->groups = 8;
+  }
+
+  if (!arg_as_int(this->m, "m", problem_space, problem)) {
+    // default value
+    this->m = 1024;
+  }
+
+  if (!arg_as_int(this->n, "n", problem_space, problem)) {
+    // default value
+    this->n = 1024;
+  }
+
+  if (!arg_as_int(this->k, "k", problem_space, problem)) {
+    // default value
+    this->k = 1024;
+  }
+
+  std::vector<uint8_t> skew_bytes;
+  if (arg_as_scalar(skew_bytes, library::NumericTypeID::kF64, "skew", problem_space, problem)) {
+    std::memcpy(&this->skew, skew_bytes.data(), sizeof(double));
+  }
+  else {
+    // default value
+    this->skew = 0;
+  }
+
+  if (!listed) {
+    if (this->groups <= 0 || this->m < 0 || this->n <= 0 || this->k <= 0 || this->skew < 0) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    for (int rows : skewed_group_rows(this->groups, this->m, this->skew)) {
+      problem_sizes.push_back(gemm::GemmCoord(rows, int(this->n), int(this->k)));
+    }
+  }
+
+  if (!tensor_description_satisfies(operation_desc.A, "A", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!tensor_description_satisfies(operation_desc.B, "B", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!tensor_description_satisfies(operation_desc.C, "C", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!arg_as_scalar(
+    this->alpha,
+    operation_desc.element_epilogue,
+    "alpha",
+    problem_space,
+    problem)) {
+
+    if (!cast_from_double(this->alpha, operation_desc.element_epilogue, 1)) {
+      return Status::kErrorInternal;
+    }
+  }
+
+  if (!arg_as_scalar(
+    this->beta,
+    operation_desc.element_epilogue,
+    "beta",
+    problem_space,
+    problem)) {
+
+    if (!cast_from_double(this->beta, operation_desc.element_epilogue, 0)) {
+      return Status::kErrorInternal;
+    }
+  }
+
+  lda.clear();
+  ldb.clear();
+  ldc.clear();
+
+  // Empty groups still need valid leading dimensions
+  for (auto const &problem_size : problem_sizes) {
+    int rows = std::max(problem_size.m(), 1);
+
+    lda.push_back(DeviceAllocation::get_packed_layout(
+      operation_desc.A.layout, {rows, problem_size.k()}).front());
+
+    ldb.push_back(DeviceAllocation::get_packed_layout(
+      operation_desc.B.layout, {problem_size.k(), problem_size.n()}).front());
+
+    ldc.push_back(DeviceAllocation::get_packed_layout(
+      operation_desc.C.layout, {rows, problem_size.n()}).front());
+  }
+
+  return Status::kSuccess;
+}
+
+/// Total number of bytes loaded
+int64_t GroupedGemmOperationProfiler::GroupedGemmProblem::bytes(
+  library::GemmDescription const &operation_desc) const {
+
+  // Set is_beta_zero true if beta is zero
+  bool is_beta_zero = std::all_of(beta.begin(), beta.end(), [](uint8_t i) { return i==0; });
+
+  int64_t bytes = 0;
+
+  for (auto const &problem_size : problem_sizes) {
+    int64_t m = problem_size.m();
+    int64_t n = problem_size.n();
+    int64_t k = problem_size.k();
+
+    // Input bytes read and Output bytes written for the gemm problem
+    bytes +=
+      int64_t(library::sizeof_bits(operation_desc.A.element) * m / 8) * k +
+      int64_t(library::sizeof_bits(operation_desc.B.element) * n / 8) * k +
+      int64_t(library::sizeof_bits(operation_desc.C.element) * m / 8) * n;
+
+    // Output bytes read for the gemm problem for non-zero beta values
+    if (!is_beta_zero) {
+      bytes += int64_t(library::sizeof_bits(operation_desc.C.element) * m / 8) * n;
+    }
+  }
+
+  return bytes;
+}
+
+/// Total number of flops computed
+int64_t GroupedGemmOperationProfiler::GroupedGemmProblem::flops(
+  library::GemmDescription const &operation_desc) const {
+
+  int64_t flops_ = 0;
+
+  for (auto const &problem_size : problem_sizes) {
+    int64_t m = problem_size.m();
+    int64_t n = problem_size.n();
+    int64_t k = problem_size.k();
+
+    flops_ += (m * n * k + m * n) * 2;
+  }
+
+  // complex-valued support
+  switch (operation_desc.tile_description.math_instruction.math_operation) {
+  case library::MathOperationID::kMultiplyAddComplex:
+    flops_ *= 4;
+    break;
+
+  case library::MathOperationID::kMultiplyAddComplexFastF32:
+    flops_ *= 4;
+    break;
+
+  case library::MathOperationID::kMultiplyAddGaussianComplex:
+    flops_ *= 3;
+    break;
+
+  default: break;
+  }
+
+  return flops_;
+}
+
+/// Initializes a performance result
+void GroupedGemmOperationProfiler::GroupedGemmProblem::initialize_result(
+  PerformanceResult &result,
+  library::GemmDescription const &operation_desc,
+  ProblemSpace const &problem_space) {
+
+  result.arguments.resize(problem_space.rank());
+
+  set_argument(result, "A", problem_space,
+    std::string(library::to_string(operation_desc.A.element)) + ":" + library::to_string(operation_desc.A.layout));
+
+  set_argument(result, "B", problem_space,
+    std::string(library::to_string(operation_desc.B.element)) + ":" + library::to_string(operation_desc.B.layout));
+
+  set_argument(result, "C", problem_space,
+    std::string(library::to_string(operation_desc.C.element)) + ":" + library::to_string(operation_desc.C.layout));
+
+  set_argument(result, "groups", problem_space, int64_t(problem_sizes.size()));
+
+  // Listed problem sizes have no single m, n, k or skew to report
+  if (!listed) {
+    set_argument(result, "m", problem_space, m);
+    set_argument(result, "n", problem_space, n);
+    set_argument(result, "k", problem_space, k);
+
+    std::ostringstream skew_str;
+    skew_str << skew;
+    set_argument(result, "skew", problem_space, skew_str.str());
+  }
+
+  set_argument(result, "alpha", problem_space,
+    library::lexical_cast(alpha, operation_desc.element_epilogue));
+
+  set_argument(result, "beta", problem_space,
+    library::lexical_cast(beta, operation_desc.element_epilogue));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Grouped GEMMs are registered as GEMM operations of GemmKind::kGrouped
+bool GroupedGemmOperationProfiler::profiles_operation_kind_(
+  library::OperationDescription const &op_desc) const {
+
+  return op_desc.kind == library::OperationKind::kGemm &&
+    static_cast<library::GemmDescription const &>(op_desc).gemm_kind == library::GemmKind::kGrouped;
+}
+
+/// Extracts the problem dimensions
+Status GroupedGemmOperationProfiler::initialize_configuration(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  library::GemmDescription const &operation_desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  if (operation_desc.gemm_kind != library::GemmKind::kGrouped) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  Status status = problem_.parse(operation_desc, options, problem_space, problem);
+
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  //
+  // Size the persistent grid from the total tile count
+  //
+
+  gemm::GemmCoord tile = operation_desc.tile_description.threadblock_shape;
+  gemm::GemmCoord warps = operation_desc.tile_description.warp_count;
+
+  int64_t total_tiles = 0;
+  for (auto const &problem_size : problem_.problem_sizes) {
+    total_tiles += int64_t((problem_size.m() + tile.m() - 1) / tile.m()) *
+                   int64_t((problem_size.n() + tile.n() - 1) / tile.n());
+  }
+
+  cudaDeviceProp const &properties = options.device.properties.at(0);
+  int threads_per_block = 32 * warps.m() * warps.n() * warps.k();
+  int64_t resident_blocks = int64_t(properties.multiProcessorCount) *
+    std::max(1, properties.maxThreadsPerMultiProcessor / std::max(1, threads_per_block));
+
+  gemm_workspace_.configuration.problem_count = problem_.problem_count();
+  gemm_workspace_.configuration.threadblock_count =
+    int(std::max<int64_t>(1, std::min(total_tiles, resident_blocks)));
+
+  gemm_workspace_.arguments = library::GemmGroupedArguments{};
+  gemm_workspace_.arguments.alpha = problem_.alpha.data();
+  gemm_workspace_.arguments.beta = problem_.beta.data();
+  gemm_workspace_.arguments.pointer_mode = library::ScalarPointerMode::kHost;
+
+  initialize_result_(this->model_result_, options, operation_desc, problem_space);
+
+  return operation->can_implement(&gemm_workspace_.configuration, &gemm_workspace_.arguments);
+}
+
+/// Initializes the performance result
+void GroupedGemmOperationProfiler::initialize_result_(
+  PerformanceResult &result,
+  Options const &options,
+  library::GemmDescription const &operation_desc,
+  ProblemSpace const &problem_space) {
+
+  result.provider = library::Provider::kCUTLASS;
+  result.disposition = Disposition::kNotRun;
+  result.status = Status::kSuccess;
+  result.operation_name = operation_desc.name;
+
+  problem_.initialize_result(result, operation_desc, problem_space);
+
+  OperationProfiler::initialize_result_(result, operation_desc, problem_space);
+
+  // Aggregate over all groups, so reported GFLOP/s is the throughput of the whole grouped launch
+  result.bytes = problem_.bytes(operation_desc);
+  result.flops = problem_.flops(operation_desc);
+  result.runtime = 0;
+}
+
+/// Initializes workspace
+Status GroupedGemmOperationProfiler::initialize_workspace(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (options.device.devices.size() != 1) {
+    throw std::runtime_error("This operation profiler only supports a single "
+                             "device.");
+  }
+
+  cudaError_t result;
+  result = cudaSetDevice(options.device.device_id(0));
+  if (result != cudaSuccess) {
+    throw std::runtime_error("cudaSetDevice() failed.");
+  }
+
+  library::GemmDescription const &operation_desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  if (options.execution_mode != ExecutionMode::kDryRun) {
+
+    int problem_count = problem_.problem_count();
+
+    gemm_workspace_.A.assign(problem_count, nullptr);
+    gemm_workspace_.B.assign(problem_count, nullptr);
+    gemm_workspace_.C.assign(problem_count, nullptr);
+    gemm_workspace_.Computed.assign(problem_count, nullptr);
+    gemm_workspace_.Reference.assign(problem_count, nullptr);
+
+    std::vector<void *> ptr_A(problem_count, nullptr);
+    std::vector<void *> ptr_B(problem_count, nullptr);
+    std::vector<void *> ptr_C(problem_count, nullptr);
+    std::vector<void *> ptr_Computed(problem_count, nullptr);
+    std::vector<void *> ptr_Reference(problem_count, nullptr);
+
+    int seed_shift = 0;
+
+    for (int i = 0; i < problem_count; ++i) {
+      gemm::GemmCoord const &problem_size = problem_.problem_sizes[i];
+
+      // Groups without rows (e.g. experts receiving no tokens) have nothing to allocate
+      if (problem_size.m() == 0) {
+        continue;
+      }
+
+      std::string const group = std::to_string(i);
+
+      gemm_workspace_.A[i] = device_context.allocate_and_initialize_tensor(
+        options,
+        "A" + group,
+        operation_desc.A.element,
+        operation_desc.A.layout,
+        {problem_size.m(), problem_size.k()},
+        {problem_.lda[i]},
+        1, // batch_count
+        seed_shift++,
+        0 // device_index
+      );
+
+      gemm_workspace_.B[i] = device_context.allocate_and_initialize_tensor(
+        options,
+        "B" + group,
+        operation_desc.B.element,
+        operation_desc.B.layout,
+        {problem_size.k(), problem_size.n()},
+        {problem_.ldb[i]},
+        1, // batch_count
+        seed_shift++,
+        0 // device_index
+      );
+
+      gemm_workspace_.C[i] = device_context.allocate_and_initialize_tensor(
+        options,
+        "C" + group,
+        operation_desc.C.element,
+        operation_desc.C.layout,
+        {problem_size.m(), problem_size.n()},
+        {problem_.ldc[i]},
+        1, // batch_count
+        seed_shift++,
+        0 // device_index
+      );
+
+      gemm_workspace_.Computed[i] = device_context.allocate_tensor(
+        options,
+        "D" + group,
+        operation_desc.C.element,
+        operation_desc.C.layout,
+        {problem_size.m(), problem_size.n()},
+        {problem_.ldc[i]},
+        1, // batch_count
+        0 // device_index
+      );
+
+      gemm_workspace_.Reference[i] = device_context.allocate_tensor(
+        options,
+        "Reference" + group,
+        operation_desc.C.element,
+        operation_desc.C.layout,
+        {problem_size.m(), problem_size.n()},
+        {problem_.ldc[i]},
+        1, // batch_count
+        0 // device_index
+      );
+
+      gemm_workspace_.Reference[i]->copy_from_device(gemm_workspace_.C[i]->data());
+
+      ptr_A[i] = gemm_workspace_.A[i]->data();
+      ptr_B[i] = gemm_workspace_.B[i]->data();
+      ptr_C[i] = gemm_workspace_.C[i]->data();
+      ptr_Computed[i] = gemm_workspace_.Computed[i]->data();
+      ptr_Reference[i] = gemm_workspace_.Reference[i]->data();
+    }
+
+    //
+    // Stage problem descriptors in device memory
+    //
+
+    static_assert(sizeof(gemm::GemmCoord) == 3 * sizeof(int), "GemmCoord must be packed");
+
+    gemm_workspace_.problem_sizes.reset(library::NumericTypeID::kS32, 3 * problem_count);
+    gemm_workspace_.problem_sizes.copy_from_host(problem_.problem_sizes.data());
+
+    gemm_workspace_.lda.reset(library::NumericTypeID::kS64, problem_count);
+    gemm_workspace_.lda.copy_from_host(problem_.lda.data());
+
+    gemm_workspace_.ldb.reset(library::NumericTypeID::kS64, problem_count);
+    gemm_workspace_.ldb.copy_from_host(problem_.ldb.data());
+
+    gemm_workspace_.ldc.reset(library::NumericTypeID::kS64, problem_count);
+    gemm_workspace_.ldc.copy_from_host(problem_.ldc.data());
+
+    gemm_workspace_.ptr_A.reset(library::NumericTypeID::kU64, problem_count);
+    gemm_workspace_.ptr_A.copy_from_host(ptr_A.data());
+
+    gemm_workspace_.ptr_B.reset(library::NumericTypeID::kU64, problem_count);
+    gemm_workspace_.ptr_B.copy_from_host(ptr_B.data());
+
+    gemm_workspace_.ptr_C.reset(library::NumericTypeID::kU64, problem_count);
+    gemm_workspace_.ptr_C.copy_from_host(ptr_C.data());
+
+    gemm_workspace_.ptr_Computed.reset(library::NumericTypeID::kU64, problem_count);
+    gemm_workspace_.ptr_Computed.copy_from_host(ptr_Computed.data());
+
+    gemm_workspace_.ptr_Reference.reset(library::NumericTypeID::kU64, problem_count);
+    gemm_workspace_.ptr_Reference.copy_from_host(ptr_Reference.data());
+
+    set_cutlass_arguments_();
+  }
+
+  //
+  // Initialize the CUTLASS operation
+  //
+
+  Status status = Status::kSuccess;
+
+  if (options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+
+    if (options.execution_mode != ExecutionMode::kDryRun) {
+
+      uint64_t workspace_size = operation->get_host_workspace_size(&gemm_workspace_.configuration);
+      gemm_workspace_.host_workspace.resize(workspace_size, 0);
+
+      workspace_size = operation->get_device_workspace_size(
+        &gemm_workspace_.configuration, &gemm_workspace_.arguments);
+      gemm_workspace_.device_workspace.reset(library::NumericTypeID::kU8, workspace_size);
+
+      status = operation->initialize(
+        &gemm_workspace_.configuration,
+        gemm_workspace_.host_workspace.data(),
+        gemm_workspace_.device_workspace.data());
+    }
+
+    //
+    // If CUTLASS is enabled, generate a result for it
+    //
+
+    results_.push_back(model_result_);
+    results_.back().provider = library::Provider::kCUTLASS;
+    results_.back().op_kind = library::OperationKind::kGroupedGemm;
+    results_.back().disposition = Disposition::kNotRun;
+
+    for(auto &verification_provider : options.verification.providers) {
+      results_.back().verification_map[verification_provider] = Disposition::kNotRun;
+    }
+  }
+
+  return status;
+}
+
+/// Sets the arguments to compute into the Computed tensors
+void GroupedGemmOperationProfiler::set_cutlass_arguments_() {
+
+  library::GemmGroupedArguments &arguments = gemm_workspace_.arguments;
+
+  arguments.problem_sizes = static_cast<gemm::GemmCoord *>(gemm_workspace_.problem_sizes.data());
+  arguments.ptr_A = gemm_workspace_.ptr_A.data();
+  arguments.ptr_B = gemm_workspace_.ptr_B.data();
+  arguments.ptr_C = gemm_workspace_.ptr_C.data();
+  arguments.ptr_D = gemm_workspace_.ptr_Computed.data();
+  arguments.lda = static_cast<int64_t *>(gemm_workspace_.lda.data());
+  arguments.ldb = static_cast<int64_t *>(gemm_workspace_.ldb.data());
+  arguments.ldc = static_cast<int64_t *>(gemm_workspace_.ldc.data());
+  arguments.ldd = static_cast<int64_t *>(gemm_workspace_.ldc.data());
+  arguments.alpha = problem_.alpha.data();
+  arguments.beta = problem_.beta.data();
+  arguments.pointer_mode = library::ScalarPointerMode::kHost;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Verifies CUTLASS against references
+bool GroupedGemmOperationProfiler::verify_cutlass(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (!options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+    return true;
+  }
+
+  if (options.execution_mode == ExecutionMode::kDryRun) {
+    return true;
+  }
+
+  set_cutlass_arguments_();
+
+  //
+  // Run the CUTLASS operation
+  //
+
+  results_.back().status = operation->run(
+    &gemm_workspace_.arguments,
+    gemm_workspace_.host_workspace.data(),
+    gemm_workspace_.device_workspace.data());
+
+  if (results_.back().status != Status::kSuccess) {
+    results_.back().disposition = Disposition::kFailed;
+    return false;
+  }
+
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    results_.back().disposition = Disposition::kFailed;
+    return false;
+  }
+
+  // CUTLASS op ran the but not yet verified against any verification provider
+  results_.back().disposition = Disposition::kNotVerified;
+
+  //
+  // Run verification providers
+  //
+
+  if (options.verification.enabled) {
+
+#if CUTLASS_ENABLE_CUBLAS
+    if (options.verification.provider_enabled(library::Provider::kCUBLAS)) {
+
+      // Guard against unsupported cases
+      auto const & gemm_desc = static_cast<library::GemmDescription const &>(operation->description());
+
+      if (cublas_satisfies(gemm_desc) == Status::kSuccess) {
+        verify_with_cublas_(options, device_context, operation);
+      }
+      else {
+        // set verification map for cublas to not supported
+        results_.back().verification_map[library::Provider::kCUBLAS] = Disposition::kNotSupported;
+      }
+    }
+#endif // #if CUTLASS_ENABLE_CUBLAS
+
+    verify_with_reference_(options, device_context, operation);
+
+    // Update disposition to worst case verification outcome among all
+    // verification providers which are supported
+    bool is_any_verification_run_passed = false;
+    for (auto &m : results_.back().verification_map) {
+      if (m.second == Disposition::kFailed || m.second == Disposition::kIncorrect) {
+        results_.back().disposition = m.second;
+        return true;
+      }
+      if (!is_any_verification_run_passed && m.second == Disposition::kPassed) {
+        is_any_verification_run_passed = true;
+      }
+    }
+
+    if (is_any_verification_run_passed) {
+      results_.back().disposition = Disposition::kPassed;
+    }
+  }
+
+  // if verification.required is set, then return success iff at least one ref-check was run
+  if (options.verification.required) {
+    bool did_any_verification_run = false;
+    for (auto provider : options.verification.providers) {
+      did_any_verification_run |= (Disposition::kNotRun != results_.back().verification_map[provider]);
+    }
+
+    if (not did_any_verification_run) {
+      results_.back().status = Status::kErrorNotSupported;
+      return false;
+    }
+  }
+
+  // Return true means continue profiling
+  return true;
+}
+
+/// Compares each group's Computed tensor against its Reference tensor
+Disposition GroupedGemmOperationProfiler::compare_groups_(Options const &options) {
+
+  for (size_t i = 0; i < gemm_workspace_.Computed.size(); ++i) {
+    if (!gemm_workspace_.Computed[i]) {
+      continue;
+    }
+
+    Disposition disposition = compare_tensors(
+      options,
+      *gemm_workspace_.Computed[i],
+      *gemm_workspace_.Reference[i],
+      gemm_workspace_.Computed[i]->batch_stride());
+
+    if (disposition != Disposition::kPassed) {
+      return disposition;
+    }
+  }
+
+  return Disposition::kPassed;
+}
+
+/// Restores each group's Reference tensor to C, as cuBLAS updates C in place
+void GroupedGemmOperationProfiler::reset_reference_() {
+
+  for (size_t i = 0; i < gemm_workspace_.Reference.size(); ++i) {
+    if (gemm_workspace_.Reference[i]) {
+      gemm_workspace_.Reference[i]->copy_from_device(gemm_workspace_.C[i]->data());
+    }
+  }
+}
+
+/// Verifies CUTLASS against cuBLAS grouped GEMM
+bool GroupedGemmOperationProfiler::verify_with_cublas_(
+  Options const &options,
+  DeviceContext &device_context,
+  library::Operation const *operation) {
+
+#if CUTLASS_ENABLE_CUBLAS
+
+#if defined(CUTLASS_PROFILER_CUBLAS_GROUPED_GEMM_ENABLED)
+
+  library::GemmDescription const &gemm_desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  CublasCreate handle;
+  cublasStatus_t status = handle.get_cublas_create_status();
+
+  if (status != CUBLAS_STATUS_SUCCESS) {
+    results_.back().verification_map[library::Provider::kCUBLAS] = get_cutlass_disposition(status);
+    return true;
+  }
+
+  try {
+
+    reset_reference_();
+
+    detail::cublasGemmGroupedDispatcher gemm_op(
+      gemm_desc,
+      problem_.problem_sizes,
+      problem_.lda,
+      problem_.ldb,
+      problem_.ldc,
+      problem_.alpha.data(),
+      problem_.beta.data(),
+      static_cast<void const * const *>(gemm_workspace_.ptr_A.data()),
+      static_cast<void const * const *>(gemm_workspace_.ptr_B.data()),
+      static_cast<void * const *>(gemm_workspace_.ptr_Reference.data()));
+
+    if (gemm_op.status != Status::kSuccess) {
+      results_.back().verification_map[library::Provider::kCUBLAS] = Disposition::kNotSupported;
+      return true;
+    }
+
+    status = gemm_op(handle);
+
+    // Handle errors
+    if (status != CUBLAS_STATUS_SUCCESS) {
+      results_.back().verification_map[library::Provider::kCUBLAS] = get_cutlass_disposition(status);
+      return true;
+    }
+
+    results_.back().status = Status::kSuccess;
+
+    //
+    // Verify results
+    //
+
+    results_.back().verification_map[library::Provider::kCUBLAS] = compare_groups_(options);
+
+    // Save workspace if incorrect
+    if (options.verification.save_workspace == SaveWorkspace::kIncorrect &&
+      results_.back().verification_map[library::Provider::kCUBLAS] == Disposition::kIncorrect) {
+
+      save_workspace(
+        device_context,
+        options,
+        gemm_desc,
+        library::Provider::kCUTLASS,
+        library::Provider::kCUBLAS);
+    }
+  }
+  catch (...) {
+    results_.back().verification_map[library::Provider::kCUBLAS] = Disposition::kFailed;
+  }
+
+#else
+
+  // cublasGemmGroupedBatchedEx() requires cuBLAS 12.5
+  results_.back().verification_map[library::Provider::kCUBLAS] = Disposition::kNotSupported;
+
+#endif // defined(CUTLASS_PROFILER_CUBLAS_GROUPED_GEMM_ENABLED)
+
+#endif // #if CUTLASS_ENABLE_CUBLAS
+
+  // Return true means continue profiling
+  return true;
+}
+
+/// Verifies CUTLASS against host and device references, one group at a time
+bool GroupedGemmOperationProfiler::verify_with_reference_(
+  Options const &options,
+  DeviceContext &device_context,
+  library::Operation const *operation) {
+
+  library::GemmDescription const &gemm_desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  for (auto provider : options.verification.providers) {
+
+    // Skip providers that are not enabled or are not references
+    if (!options.verification.provider_enabled(provider) ||
+        (provider != library::Provider::kReferenceDevice &&
+         provider != library::Provider::kReferenceHost)) {
+      continue;
+    }
+
+    bool ran = true;
+
+    for (size_t i = 0; i < gemm_workspace_.Computed.size(); ++i) {
+
+      if (!gemm_workspace_.Computed[i]) {
+        continue;
+      }
+
+      gemm::GemmCoord const &problem_size = problem_.problem_sizes[i];
+
+      void *ptr_A = gemm_workspace_.A[i]->data();
+      void *ptr_B = gemm_workspace_.B[i]->data();
+      void *ptr_C = gemm_workspace_.C[i]->data();
+      void *ptr_D = gemm_workspace_.Reference[i]->data();
+
+      // To support the host-side reference, conditionally allocate and
+      // copy tensors to host memory.
+      std::vector<uint8_t> host_data_A;
+      std::vector<uint8_t> host_data_B;
+      std::vector<uint8_t> host_data_C;
+      std::vector<uint8_t> host_data_D;
+
+      if (provider == library::Provider::kReferenceHost) {
+
+        host_data_A.resize(gemm_workspace_.A[i]->bytes());
+        ptr_A = host_data_A.data();
+        gemm_workspace_.A[i]->copy_to_host(ptr_A);
+
+        host_data_B.resize(gemm_workspace_.B[i]->bytes());
+        ptr_B = host_data_B.data();
+        gemm_workspace_.B[i]->copy_to_host(ptr_B);
+
+        host_data_C.resize(gemm_workspace_.C[i]->bytes());
+        ptr_C = host_data_C.data();
+        gemm_workspace_.C[i]->copy_to_host(ptr_C);
+
+        host_data_D.resize(gemm_workspace_.Reference[i]->bytes());
+        ptr_D = host_data_D.data();
+      }
+
+      //
+      // Launch
+      //
+
+      library::Handle handle;
+
+      handle.set_provider(provider);
+
+      Status status = handle.gemm_universal(
+        library::GemmUniversalMode::kGemm,
+        problem_size.m(),
+        problem_size.n(),
+        problem_size.k(),
+        gemm_desc.tile_description.math_instruction.element_accumulator,
+        gemm_desc.element_epilogue,
+
+        problem_.alpha.data(),
+
+        gemm_desc.A.element,
+        gemm_desc.A.layout,
+        gemm_desc.transform_A,
+        ptr_A,
+        int(problem_.lda[i]),
+
+        gemm_desc.B.element,
+        gemm_desc.B.layout,
+        gemm_desc.transform_B,
+        ptr_B,
+        int(problem_.ldb[i]),
+
+        problem_.beta.data(),
+
+        gemm_desc.C.element,
+        gemm_desc.C.layout,
+        ptr_C,
+        int(problem_.ldc[i]),
+
+        gemm_desc.D.element,
+        gemm_desc.D.layout,
+        ptr_D,
+        int(problem_.ldc[i]),
+
+        1, // batch_count
+        0, 0, 0, 0);
+
+      if (status != Status::kSuccess) {
+        results_.back().verification_map[provider] = Disposition::kNotRun;
+        ran = false;
+        break;
+      }
+
+      if (provider == library::Provider::kReferenceHost) {
+        gemm_workspace_.Reference[i]->copy_from_host(ptr_D);
+      }
+    }
+
+    if (!ran) {
+      continue;
+    }
+
+    results_.back().status = Status::kSuccess;
+
+    //
+    // Verify results
+    //
+
+    results_.back().verification_map[provider] = compare_groups_(options);
+
+    // Save workspace if incorrect
+    if (options.verification.save_workspace == SaveWorkspace::kIncorrect &&
+      results_.back().verification_map[provider] == Disposition::kIncorrect) {
+
+      save_workspace(
+        device_context,
+        options,
+        gemm_desc,
+        library::Provider::kCUTLASS,
+        provider);
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Measures performance results
+bool GroupedGemmOperationProfiler::profile(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+
+    set_cutlass_arguments_();
+
+    results_.back().status = profile_cutlass_(
+      results_.back(),
+      options,
+      operation,
+      &gemm_workspace_.arguments,
+      gemm_workspace_.host_workspace.data(),
+      gemm_workspace_.device_workspace.data()
+    );
+  }
+
+  if (options.profiling.provider_enabled(library::Provider::kCUBLAS)) {
+    profile_cublas_(options, operation);
+  }
+
+  return true;
+}
+
+/// Measures cuBLAS grouped GEMM on the same problem for comparison
+bool GroupedGemmOperationProfiler::profile_cublas_(
+  Options const &options,
+  library::Operation const *operation) {
+
+#if CUTLASS_ENABLE_CUBLAS && defined(CUTLASS_PROFILER_CUBLAS_GROUPED_GEMM_ENABLED)
+
+  library::GemmDescription const &gemm_desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  if (cublas_satisfies(gemm_desc) != Status::kSuccess) {
+    return true;
+  }
+
+  // Every CUTLASS kernel of the same data types profiles the same cuBLAS call, so measure it once
+  std::ostringstream key;
+  key << library::to_string(gemm_desc.A.element) << library::to_string(gemm_desc.A.layout)
+    << library::to_string(gemm_desc.B.element) << library::to_string(gemm_desc.B.layout)
+    << library::to_string(gemm_desc.C.element) << library::to_string(gemm_desc.C.layout)
+    << library::to_string(gemm_desc.tile_description.math_instruction.element_accumulator)
+    << library::to_string(gemm_desc.tile_description.math_instruction.opcode_class)
+    << library::lexical_cast(problem_.alpha, gemm_desc.element_epilogue)
+    << library::lexical_cast(problem_.beta, gemm_desc.element_epilogue);
+
+  for (auto const &problem_size : problem_.problem_sizes) {
+    key << ":" << problem_size.m() << "x" << problem_size.n() << "x" << problem_size.k();
+  }
+
+  if (key.str() == cublas_profiled_key_) {
+    return true;
+  }
+
+  cublas_profiled_key_ = key.str();
+
+  PerformanceResult result = model_result_;
+  result.provider = library::Provider::kCUBLAS;
+  result.op_kind = library::OperationKind::kGroupedGemm;
+  result.operation_name = "cublasGemmGroupedBatchedEx";
+  result.disposition = Disposition::kNotVerified;
+
+  CublasCreate handle;
+  cublasStatus_t status = handle.get_cublas_create_status();
+
+  if (status != CUBLAS_STATUS_SUCCESS) {
+    return true;
+  }
+
+  detail::cublasGemmGroupedDispatcher gemm_op(
+    gemm_desc,
+    problem_.problem_sizes,
+    problem_.lda,
+    problem_.ldb,
+    problem_.ldc,
+    problem_.alpha.data(),
+    problem_.beta.data(),
+    static_cast<void const * const *>(gemm_workspace_.ptr_A.data()),
+    static_cast<void const * const *>(gemm_workspace_.ptr_B.data()),
+    static_cast<void * const *>(gemm_workspace_.ptr_Reference.data()));
+
+  if (gemm_op.status != Status::kSuccess) {
+    return true;
+  }
+
+  // cuBLAS stages the per-group host arrays itself, so it cannot be captured into a CUDA Graph
+  // and is timed eagerly on the legacy stream
+  auto func = [&](cudaStream_t, int) { return get_cutlass_status(gemm_op(handle)); };
+
+  Options eager_options = options;
+  if (eager_options.profiling.use_cuda_graphs) {
+    std::cerr << "Warning: cuBLAS grouped GEMM is profiled without CUDA Graphs [--use-cuda-graphs]" << std::endl;
+    eager_options.profiling.use_cuda_graphs = false;
+  }
+
+  result.status = profile_kernel_(result, eager_options, func, nullptr);
+
+  results_.push_back(result);
+
+#endif
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,201 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Background device load used to profile kernels under contention
+*/
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <cuda/atomic>
+
+#include "cutlass/profiler/interference.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct InterferenceGenerator::Flags {
+
+  /// Set by the host to stop the background kernel
+  cuda::atomic<bool> release;
+
+  /// Number of background thread blocks resident on the device
+  cuda::atomic<int> resident;
+};
+
+namespace {
+
+/// Persistent background kernel. If `buffer` is non-null, each thread block repeatedly reads and
+/// writes back its slice of the buffer; otherwise it idles. Blocks exit once released by the host.
+__global__ void interference_kernel(
+  cuda::atomic<bool> const *release,
+  cuda::atomic<int> *resident,
+  float4 *buffer,
+  size_t elements_per_block) {
+
+  if (threadIdx.x == 0) {
+    resident->fetch_add(1, cuda::memory_order_relaxed);
+  }
+
+  float4 *slice = buffer ? buffer + blockIdx.x * elements_per_block : nullptr;
+
+  while (true) {
+    int released = 0;
+    if (threadIdx.x == 0) {
+      released = release->load(cuda::memory_order_acquire);
+    }
+    if (__syncthreads_or(released)) {
+      break;
+    }
+
+    if (slice) {
+      for (size_t i = threadIdx.x; i < elements_per_block; i += blockDim.x) {
+        float4 value = slice[i];
+        value.x += 1.0f;
+        slice[i] = value;
+      }
+    }
+    else {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 700)
+      __nanosleep(1000);
+#endif
+    }
+  }
+}
+
+void check(cudaError_t result, char const *what) {
+  if (result != cudaSuccess) {
+    throw std::runtime_error(std::string(what) + " failed: " + cudaGetErrorString(result));
+  }
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+InterferenceGenerator::InterferenceGenerator(InterferenceLoad load, int sm_count) {
+
+  if (load == InterferenceLoad::kNone) {
+    return;
+  }
+
+  int device;
+  check(cudaGetDevice(&device), "cudaGetDevice()");
+
+  cudaDeviceProp properties;
+  check(cudaGetDeviceProperties(&properties, device), "cudaGetDeviceProperties()");
+
+  int blocks = std::min(std::max(sm_count, 1), properties.multiProcessorCount - 1);
+  if (blocks < 1) {
+    return;
+  }
+
+  // Requesting the entire opt-in shared memory of an SM limits the kernel to one block per SM and
+  // keeps thread blocks of the profiled kernel, which all use shared memory, off that SM
+  int smem_size = int(properties.sharedMemPerBlockOptin);
+  check(cudaFuncSetAttribute(
+    interference_kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, smem_size),
+    "cudaFuncSetAttribute()");
+
+  check(cudaHostAlloc(reinterpret_cast<void **>(&flags_), sizeof(Flags), cudaHostAllocPortable),
+    "cudaHostAlloc()");
+  new (flags_) Flags{};
+  flags_->release.store(false, cuda::memory_order_release);
+  flags_->resident.store(0, cuda::memory_order_release);
+
+  try {
+    check(cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking), "cudaStreamCreateWithFlags()");
+
+    size_t elements_per_block = 0;
+    if (load == InterferenceLoad::kBandwidth) {
+      // Twice the L2 capacity, so that the traffic reaches DRAM
+      size_t bytes = std::max(size_t(2) * properties.l2CacheSize, size_t(64) << 20);
+      elements_per_block = (bytes / sizeof(float4) + blocks - 1) / blocks;
+      check(cudaMalloc(&buffer_, elements_per_block * blocks * sizeof(float4)), "cudaMalloc()");
+      check(cudaMemsetAsync(buffer_, 0, elements_per_block * blocks * sizeof(float4), stream_),
+        "cudaMemsetAsync()");
+    }
+
+    interference_kernel<<<blocks, 256, smem_size, stream_>>>(
+      &flags_->release, &flags_->resident, static_cast<float4 *>(buffer_), elements_per_block);
+    check(cudaGetLastError(), "interference kernel launch");
+
+    // Timing must not start before the SMs are actually occupied
+    while (flags_->resident.load(cuda::memory_order_acquire) < blocks) {
+      cudaError_t status = cudaStreamQuery(stream_);
+      if (status != cudaErrorNotReady) {
+        check(status, "interference kernel");
+        throw std::runtime_error("interference kernel exited before it was released");
+      }
+    }
+  }
+  catch (...) {
+    release_();
+    throw;
+  }
+}
+
+InterferenceGenerator::~InterferenceGenerator() {
+  release_();
+}
+
+void InterferenceGenerator::release_() {
+
+  if (flags_) {
+    flags_->release.store(true, cuda::memory_order_release);
+  }
+
+  if (stream_) {
+    cudaStreamSynchronize(stream_);
+    cudaStreamDestroy(stream_);
+    stream_ = nullptr;
+  }
+
+  if (buffer_) {
+    cudaFree(buffer_);
+    buffer_ = nullptr;
+  }
+
+  if (flags_) {
+    flags_->~Flags();
+    cudaFreeHost(flags_);
+    flags_ = nullptr;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
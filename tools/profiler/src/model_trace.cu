@@ -0,0 +1,560 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Replays the GEMM and convolution calls of one model step
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+#include "cutlass/library/singleton.h"
+
+#include "cutlass/profiler/model_trace.h"
+#include "cutlass/profiler/gpu_timer.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Built-in traces of common models with half-precision operands and single-precision accumulation
+struct BuiltinModelTrace {
+  char const *name;
+  char const *text;
+};
+
+#define CUTLASS_TRACE_GEMM " --operation=Gemm --A=f16:row --B=f16:column --C=f16:column --accumulator-type=f32"
+#define CUTLASS_TRACE_CONV " --operation=Conv2d --conv_kind=fprop --Activation=f16:nhwc --Filter=f16:nhwc" \
+  " --Output=f16:nhwc --accumulator-type=f32 --n=32 --dilation_h=1 --dilation_w=1"
+
+BuiltinModelTrace const kBuiltinModelTraces[] = {
+  {
+    // Llama-style 7B decoder, 2048 prompt tokens, 32 layers
+    "llama-7b-prefill",
+    "qkv_proj  --count=32" CUTLASS_TRACE_GEMM " --m=2048 --n=12288 --k=4096\n"
+    "o_proj    --count=32" CUTLASS_TRACE_GEMM " --m=2048 --n=4096 --k=4096\n"
+    "gate_up   --count=32" CUTLASS_TRACE_GEMM " --m=2048 --n=22016 --k=4096\n"
+    "down_proj --count=32" CUTLASS_TRACE_GEMM " --m=2048 --n=4096 --k=11008\n"
+    "lm_head   --count=1"  CUTLASS_TRACE_GEMM " --m=2048 --n=32000 --k=4096\n"
+  },
+  {
+    // Llama-style 7B decoder, one token for each of 16 sequences, 32 layers
+    "llama-7b-decode",
+    "qkv_proj  --count=32" CUTLASS_TRACE_GEMM " --m=16 --n=12288 --k=4096\n"
+    "o_proj    --count=32" CUTLASS_TRACE_GEMM " --m=16 --n=4096 --k=4096\n"
+    "gate_up   --count=32" CUTLASS_TRACE_GEMM " --m=16 --n=22016 --k=4096\n"
+    "down_proj --count=32" CUTLASS_TRACE_GEMM " --m=16 --n=4096 --k=11008\n"
+    "lm_head   --count=1"  CUTLASS_TRACE_GEMM " --m=16 --n=32000 --k=4096\n"
+  },
+  {
+    // BERT-large encoder, 8 sequences of 512 tokens, 16 heads, 24 layers
+    "bert-large",
+    "qkv_proj  --count=24" CUTLASS_TRACE_GEMM " --m=4096 --n=3072 --k=1024\n"
+    "scores    --count=24" CUTLASS_TRACE_GEMM " --m=512 --n=512 --k=64 --batch_count=128\n"
+    "context   --count=24" CUTLASS_TRACE_GEMM " --m=512 --n=64 --k=512 --batch_count=128\n"
+    "o_proj    --count=24" CUTLASS_TRACE_GEMM " --m=4096 --n=1024 --k=1024\n"
+    "ffn_up    --count=24" CUTLASS_TRACE_GEMM " --m=4096 --n=4096 --k=1024\n"
+    "ffn_down  --count=24" CUTLASS_TRACE_GEMM " --m=4096 --n=1024 --k=4096\n"
+  },
+  {
+    // ResNet-50 v1.5 inference on 32 images. The stem is padded to 8 input channels.
+    "resnet50",
+    "stem        --count=1" CUTLASS_TRACE_CONV " --h=224 --w=224 --c=8 --k=64 --r=7 --s=7 --pad_h=3 --pad_w=3 --stride_h=2 --stride_w=2\n"
+    "s1_reduce0  --count=1" CUTLASS_TRACE_CONV " --h=56 --w=56 --c=64 --k=64 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s1_conv     --count=3" CUTLASS_TRACE_CONV " --h=56 --w=56 --c=64 --k=64 --r=3 --s=3 --pad_h=1 --pad_w=1 --stride_h=1 --stride_w=1\n"
+    "s1_expand   --count=3" CUTLASS_TRACE_CONV " --h=56 --w=56 --c=64 --k=256 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s1_shortcut --count=1" CUTLASS_TRACE_CONV " --h=56 --w=56 --c=64 --k=256 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s1_reduce   --count=2" CUTLASS_TRACE_CONV " --h=56 --w=56 --c=256 --k=64 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s2_reduce0  --count=1" CUTLASS_TRACE_CONV " --h=56 --w=56 --c=256 --k=128 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s2_conv0    --count=1" CUTLASS_TRACE_CONV " --h=56 --w=56 --c=128 --k=128 --r=3 --s=3 --pad_h=1 --pad_w=1 --stride_h=2 --stride_w=2\n"
+    "s2_conv     --count=3" CUTLASS_TRACE_CONV " --h=28 --w=28 --c=128 --k=128 --r=3 --s=3 --pad_h=1 --pad_w=1 --stride_h=1 --stride_w=1\n"
+    "s2_expand   --count=4" CUTLASS_TRACE_CONV " --h=28 --w=28 --c=128 --k=512 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s2_shortcut --count=1" CUTLASS_TRACE_CONV " --h=56 --w=56 --c=256 --k=512 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=2 --stride_w=2\n"
+    "s2_reduce   --count=3" CUTLASS_TRACE_CONV " --h=28 --w=28 --c=512 --k=128 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s3_reduce0  --count=1" CUTLASS_TRACE_CONV " --h=28 --w=28 --c=512 --k=256 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s3_conv0    --count=1" CUTLASS_TRACE_CONV " --h=28 --w=28 --c=256 --k=256 --r=3 --s=3 --pad_h=1 --pad_w=1 --stride_h=2 --stride_w=2\n"
+    "s3_conv     --count=5" CUTLASS_TRACE_CONV " --h=14 --w=14 --c=256 --k=256 --r=3 --s=3 --pad_h=1 --pad_w=1 --stride_h=1 --stride_w=1\n"
+    "s3_expand   --count=6" CUTLASS_TRACE_CONV " --h=14 --w=14 --c=256 --k=1024 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s3_shortcut --count=1" CUTLASS_TRACE_CONV " --h=28 --w=28 --c=512 --k=1024 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=2 --stride_w=2\n"
+    "s3_reduce   --count=5" CUTLASS_TRACE_CONV " --h=14 --w=14 --c=1024 --k=256 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s4_reduce0  --count=1" CUTLASS_TRACE_CONV " --h=14 --w=14 --c=1024 --k=512 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s4_conv0    --count=1" CUTLASS_TRACE_CONV " --h=14 --w=14 --c=512 --k=512 --r=3 --s=3 --pad_h=1 --pad_w=1 --stride_h=2 --stride_w=2\n"
+    "s4_conv     --count=2" CUTLASS_TRACE_CONV " --h=7 --w=7 --c=512 --k=512 --r=3 --s=3 --pad_h=1 --pad_w=1 --stride_h=1 --stride_w=1\n"
+    "s4_expand   --count=3" CUTLASS_TRACE_CONV " --h=7 --w=7 --c=512 --k=2048 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "s4_shortcut --count=1" CUTLASS_TRACE_CONV " --h=14 --w=14 --c=1024 --k=2048 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=2 --stride_w=2\n"
+    "s4_reduce   --count=2" CUTLASS_TRACE_CONV " --h=7 --w=7 --c=2048 --k=512 --r=1 --s=1 --pad_h=0 --pad_w=0 --stride_h=1 --stride_w=1\n"
+    "fc          --count=1" CUTLASS_TRACE_GEMM " --m=32 --n=1000 --k=2048\n"
+  }
+};
+
+#undef CUTLASS_TRACE_GEMM
+#undef CUTLASS_TRACE_CONV
+
+/// Profiling state of one call of the trace. The profiler and device context own the workspace
+/// referenced by the captured graph.
+struct TracedOperation {
+  ModelTraceOperation const *call{nullptr};
+  std::unique_ptr<Options> options;
+  OperationProfilerVector profilers;
+  OperationProfiler *profiler{nullptr};
+  std::unique_ptr<DeviceContext> device_context;
+  std::string operation_name;
+  double runtime{0};
+  cudaGraph_t graph{nullptr};
+  cudaGraphExec_t graph_exec{nullptr};
+
+  /// Time spent in the call during a replayed step (ms)
+  double step_runtime{0};
+
+  ~TracedOperation() {
+    if (graph_exec) {
+      cudaGraphExecDestroy(graph_exec);
+    }
+    if (graph) {
+      cudaGraphDestroy(graph);
+    }
+  }
+};
+
+void check(cudaError_t result, char const *what) {
+  if (result != cudaSuccess) {
+    throw std::runtime_error(std::string(what) + " failed: " + cudaGetErrorString(result));
+  }
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Loads a built-in trace by name or a trace file by path
+ModelTrace ModelTrace::load(std::string const &name_or_path) {
+
+  for (auto const & builtin : kBuiltinModelTraces) {
+    if (name_or_path == builtin.name) {
+      std::istringstream in(builtin.text);
+      return parse(builtin.name, in);
+    }
+  }
+
+  std::ifstream file(name_or_path);
+  if (!file.good()) {
+    throw std::runtime_error("Could not open model trace '" + name_or_path + "'");
+  }
+
+  return parse(name_or_path, file);
+}
+
+/// Parses a trace
+ModelTrace ModelTrace::parse(std::string const &name, std::istream &in) {
+
+  ModelTrace trace;
+  trace.name = name;
+
+  std::string line;
+  int line_number = 0;
+
+  while (std::getline(in, line)) {
+    ++line_number;
+
+    std::istringstream tokens(line.substr(0, line.find('#')));
+
+    ModelTraceOperation operation;
+    if (!(tokens >> operation.label)) {
+      continue;
+    }
+
+    std::string token;
+    while (tokens >> token) {
+      if (token.compare(0, 2, "--") != 0 || token.find('=') == std::string::npos) {
+        throw std::runtime_error("Invalid argument '" + token + "' on line " +
+          std::to_string(line_number) + " of model trace '" + name + "'");
+      }
+
+      size_t pos = token.find('=');
+      std::string key = token.substr(2, pos - 2);
+      std::string value = token.substr(pos + 1);
+
+      if (key == "count") {
+        operation.count = std::stoi(value);
+      }
+      else {
+        operation.arguments.emplace_back(key, value);
+      }
+    }
+
+    if (operation.count > 0) {
+      trace.operations.push_back(operation);
+    }
+  }
+
+  if (trace.operations.empty()) {
+    throw std::runtime_error("Model trace '" + name + "' contains no operations");
+  }
+
+  return trace;
+}
+
+/// Returns the names of the built-in traces
+std::vector<std::string> ModelTrace::builtin_names() {
+
+  std::vector<std::string> names;
+  for (auto const & builtin : kBuiltinModelTraces) {
+    names.push_back(builtin.name);
+  }
+  return names;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+ModelTraceProfiler::ModelTraceProfiler(
+  Options const &options,
+  OperationProfilerFactory make_operation_profilers
+):
+  options_(options), make_operation_profilers_(make_operation_profilers) {
+
+}
+
+/// Returns the command line of the run with the arguments of a call substituted
+CommandLine ModelTraceProfiler::operation_cmdline_(ModelTraceOperation const &operation) const {
+
+  std::set<std::string> replaced = {"model-trace"};
+  for (auto const & argument : operation.arguments) {
+    replaced.insert(argument.first);
+  }
+
+  // Problem space arguments accumulate over repeated keys, so arguments of the call replace those
+  // of the run rather than being appended
+  CommandLine cmdline = options_.cmdline;
+  cmdline.keys.clear();
+  cmdline.values.clear();
+
+  for (size_t i = 0; i < options_.cmdline.keys.size(); ++i) {
+    if (!replaced.count(options_.cmdline.keys[i])) {
+      cmdline.keys.push_back(options_.cmdline.keys[i]);
+      cmdline.values.push_back(options_.cmdline.values[i]);
+    }
+  }
+
+  for (auto const & argument : operation.arguments) {
+    cmdline.keys.push_back(argument.first);
+    cmdline.values.push_back(argument.second);
+  }
+
+  return cmdline;
+}
+
+/// Profiles and replays the trace, returning nonzero on failure
+int ModelTraceProfiler::profile(ModelTrace const &trace) {
+
+  library::Manifest const &manifest = library::Singleton::get().manifest;
+
+  int retval = 0;
+
+  std::vector<std::unique_ptr<TracedOperation>> traced;
+  std::set<library::OperationKind> reported_kinds;
+
+  //
+  // 1. Profile each call and capture its fastest kernel
+  //
+
+  for (auto const & call : trace.operations) {
+
+    std::unique_ptr<TracedOperation> op(new TracedOperation);
+    op->call = &call;
+    op->options.reset(new Options(operation_cmdline_(call)));
+
+    library::OperationKind kind = op->options->operation_kind;
+    if (kind == library::OperationKind::kInvalid) {
+      kind = library::OperationKind::kGemm;
+    }
+
+    // Calls of the same kind share one CSV file
+    op->options->report.append = options_.report.append || reported_kinds.count(kind);
+    reported_kinds.insert(kind);
+
+    op->profilers = make_operation_profilers_(*op->options);
+    for (auto & profiler : op->profilers) {
+      if (profiler->kind() == kind) {
+        op->profiler = profiler.get();
+      }
+    }
+
+    if (!op->profiler) {
+      throw std::runtime_error("Model trace operation '" + call.label + "' has unsupported kind " +
+        library::to_string(kind));
+    }
+
+    op->device_context.reset(new DeviceContext);
+
+    ProblemSpace problem_space(op->profiler->arguments(), op->options->cmdline);
+    PerformanceReport report(*op->options, problem_space.argument_names(), kind);
+
+    retval |= op->profiler->profile_problems(*op->options, manifest, *op->device_context, report);
+
+    // Each call describes a single problem, numbered from one
+    PerformanceResult const *fastest = report.fastest_result(1);
+
+    if (!fastest) {
+      std::cerr << "Warning: no kernel was profiled for model trace operation '" << call.label
+                << "'" << std::endl;
+      traced.push_back(std::move(op));
+      continue;
+    }
+
+    op->operation_name = fastest->operation_name;
+    op->runtime = fastest->runtime;
+
+    library::Operation const *operation = nullptr;
+    for (auto const & operation_ptr : manifest) {
+      if (op->operation_name == operation_ptr->description().name) {
+        operation = operation_ptr.get();
+        break;
+      }
+    }
+
+    Status status = Status::kErrorNotSupported;
+    if (operation) {
+      status = op->profiler->capture_operation(
+        *op->options, operation, *op->device_context, report, op->graph);
+    }
+
+    if (status != Status::kSuccess) {
+      std::cerr << "Warning: model trace operation '" << call.label
+                << "' cannot be replayed: " << library::to_string(status) << std::endl;
+      op->graph = nullptr;
+    }
+
+    traced.push_back(std::move(op));
+  }
+
+  //
+  // 2. Replay the step
+  //
+
+  int steps = options_.profiling.iterations > 0 ?
+    options_.profiling.iterations : options_.profiling.min_iterations;
+  steps = std::max(steps, 1);
+
+  std::vector<TracedOperation *> replayed;
+  for (auto & op : traced) {
+    if (op->graph) {
+      replayed.push_back(op.get());
+    }
+  }
+
+  double step_runtime = 0;
+  double graph_step_runtime = 0;
+
+  if (!replayed.empty() && options_.profiling.enabled) {
+
+    cudaStream_t stream;
+    check(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking), "cudaStreamCreateWithFlags()");
+
+    // Step as one graph of all calls, launched once
+    cudaGraph_t step_graph;
+    cudaGraphExec_t step_graph_exec;
+    check(cudaGraphCreate(&step_graph, 0), "cudaGraphCreate()");
+
+    cudaGraphNode_t previous = nullptr;
+    for (auto * op : replayed) {
+      check(cudaGraphInstantiate(&op->graph_exec, op->graph, nullptr, nullptr, 0), "cudaGraphInstantiate()");
+      check(cudaGraphUpload(op->graph_exec, stream), "cudaGraphUpload()");
+
+      for (int i = 0; i < op->call->count; ++i) {
+        cudaGraphNode_t node;
+        check(cudaGraphAddChildGraphNode(
+          &node, step_graph, previous ? &previous : nullptr, previous ? 1 : 0, op->graph),
+          "cudaGraphAddChildGraphNode()");
+        previous = node;
+      }
+    }
+
+    check(cudaGraphInstantiate(&step_graph_exec, step_graph, nullptr, nullptr, 0), "cudaGraphInstantiate()");
+    check(cudaGraphUpload(step_graph_exec, stream), "cudaGraphUpload()");
+
+    // Step as one launch per call, with an event after each call to attribute the step runtime
+    std::vector<cudaEvent_t> events(replayed.size() + 1);
+    for (auto & event : events) {
+      check(cudaEventCreate(&event), "cudaEventCreate()");
+    }
+
+    auto launch_step = [&](bool record) {
+      if (record) {
+        check(cudaEventRecord(events[0], stream), "cudaEventRecord()");
+      }
+      for (size_t j = 0; j < replayed.size(); ++j) {
+        for (int i = 0; i < replayed[j]->call->count; ++i) {
+          check(cudaGraphLaunch(replayed[j]->graph_exec, stream), "cudaGraphLaunch()");
+        }
+        if (record) {
+          check(cudaEventRecord(events[j + 1], stream), "cudaEventRecord()");
+        }
+      }
+    };
+
+    OperationProfiler::sleep(options_.profiling.sleep_duration);
+
+    for (int step = 0; step < std::max(options_.profiling.warmup_iterations, 1); ++step) {
+      launch_step(false);
+    }
+
+    for (int step = 0; step < steps; ++step) {
+      launch_step(true);
+      check(cudaEventSynchronize(events.back()), "cudaEventSynchronize()");
+
+      for (size_t j = 0; j < replayed.size(); ++j) {
+        float elapsed;
+        check(cudaEventElapsedTime(&elapsed, events[j], events[j + 1]), "cudaEventElapsedTime()");
+        replayed[j]->step_runtime += double(elapsed) / steps;
+        step_runtime += double(elapsed) / steps;
+      }
+    }
+
+    for (int step = 0; step < std::max(options_.profiling.warmup_iterations, 1); ++step) {
+      check(cudaGraphLaunch(step_graph_exec, stream), "cudaGraphLaunch()");
+    }
+
+    GpuTimer timer;
+    timer.start(stream);
+    for (int step = 0; step < steps; ++step) {
+      check(cudaGraphLaunch(step_graph_exec, stream), "cudaGraphLaunch()");
+    }
+    timer.stop_and_wait(stream);
+    graph_step_runtime = timer.duration(steps);
+
+    for (auto & event : events) {
+      cudaEventDestroy(event);
+    }
+    cudaGraphExecDestroy(step_graph_exec);
+    cudaGraphDestroy(step_graph);
+    cudaStreamDestroy(stream);
+  }
+
+  //
+  // 3. Report
+  //
+
+  double isolated_runtime = 0;
+  double replayed_isolated_runtime = 0;
+  int launches = 0;
+
+  for (auto & op : traced) {
+    isolated_runtime += op->runtime * op->call->count;
+    if (op->graph) {
+      replayed_isolated_runtime += op->runtime * op->call->count;
+    }
+    launches += op->call->count;
+  }
+
+  std::ostream &out = std::cout;
+
+  out << "\n\nModel trace: " << trace.name << " (" << traced.size() << " operations, "
+      << launches << " launches per step)\n\n";
+
+  out << "  " << std::left << std::setw(16) << "Operation" << std::right
+      << std::setw(7) << "Count"
+      << std::setw(14) << "Runtime(ms)"
+      << std::setw(14) << "Step(ms)"
+      << std::setw(8) << "Share"
+      << "  Kernel\n";
+
+  out << std::fixed;
+  for (auto & op : traced) {
+    out << "  " << std::left << std::setw(16) << op->call->label << std::right
+        << std::setw(7) << op->call->count
+        << std::setw(14) << std::setprecision(4) << op->runtime
+        << std::setw(14) << std::setprecision(4) << op->step_runtime
+        << std::setw(7) << std::setprecision(1)
+        << (step_runtime > 0 ? 100.0 * op->step_runtime / step_runtime : 0.0) << "%"
+        << "  " << (op->operation_name.empty() ? "-" : op->operation_name) << "\n";
+  }
+
+  out << std::setprecision(4)
+      << "\n  Sum of isolated runtimes (ms):         " << isolated_runtime << "\n";
+
+  if (step_runtime > 0) {
+    out << "  Step, one launch per call (ms):        " << step_runtime << "\n"
+        << "  Step, one CUDA graph (ms):             " << graph_step_runtime << "\n"
+        << std::setprecision(1)
+        << "  Launch overhead share:                 "
+        << 100.0 * std::max(step_runtime - graph_step_runtime, 0.0) / step_runtime << "%\n"
+        << "  Step versus isolated runtimes:         "
+        << 100.0 * (graph_step_runtime - replayed_isolated_runtime) / replayed_isolated_runtime << "%\n";
+
+    if (replayed.size() < traced.size()) {
+      out << "  Step runtimes exclude " << traced.size() - replayed.size()
+          << " operations that could not be replayed.\n";
+    }
+  }
+
+  out << std::defaultfloat << std::endl;
+
+  if (!options_.report.output_path.empty()) {
+
+    std::string path = options_.report.output_path;
+    path = path.substr(0, path.rfind(".csv")) + ".model_trace.csv";
+
+    bool print_header = !options_.report.append || !std::ifstream(path).is_open();
+
+    std::ofstream csv(path, options_.report.append ? std::ios::app : std::ios::out);
+    if (!csv.good()) {
+      std::cerr << "Could not open output file at path '" << path << "'" << std::endl;
+      return 1;
+    }
+
+    if (print_header) {
+      csv << "Trace,Operation,Count,OperationName,Runtime,StepRuntime\n";
+    }
+    for (auto & op : traced) {
+      csv << trace.name << "," << op->call->label << "," << op->call->count << ","
+          << op->operation_name << "," << op->runtime << "," << op->step_runtime << "\n";
+    }
+
+    // The step row reports the sum of isolated runtimes and the runtime of the step as one graph
+    csv << trace.name << ",step," << launches << ",," << isolated_runtime << ","
+        << graph_step_runtime << "\n";
+  }
+
+  return retval;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
@@ -38,6 +38,9 @@
 #include <cstring>
 #include <fstream>
 #include <sstream>
+#include <limits>
+#include <map>
+#include <cmath>
 
 #ifdef __unix__
 #include <unistd.h>
@@ -52,6 +55,8 @@
 #include "cutlass/profiler/options.h"
 #include "cutlass/profiler/operation_profiler.h"
 #include "cutlass/profiler/gpu_timer.h"
+#include "cutlass/profiler/roofline.h"
+#include "cutlass/profiler/interference.h"
 
 #include "cutlass/trace.h"
 
@@ -71,6 +76,35 @@ namespace cutlass {
 namespace profiler {
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+/// Owns the CUDA objects created to profile with CUDA Graphs and releases them on every exit path
+struct CudaGraphResources {
+  cudaStream_t stream = nullptr;
+  cudaGraph_t graph = nullptr;
+  cudaGraphExec_t graph_exec = nullptr;
+
+  CudaGraphResources() = default;
+  CudaGraphResources(CudaGraphResources const &) = delete;
+  CudaGraphResources &operator=(CudaGraphResources const &) = delete;
+
+  ~CudaGraphResources() {
+    if (graph_exec) {
+      cudaGraphExecDestroy(graph_exec);
+    }
+    if (graph) {
+      cudaGraphDestroy(graph);
+    }
+    if (stream) {
+      cudaStreamDestroy(stream);
+    }
+  }
+};
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 OperationProfiler::OperationProfiler(): kind_(library::OperationKind::kInvalid) { }
 
 /// Ctor
@@ -323,6 +357,12 @@ std::ostream& operator<<(std::ostream& out, library::OperationKind provider) {
   else if (provider == library::OperationKind::kReduction) {
     out << "kReduction";
   }
+  else if (provider == library::OperationKind::kGroupedGemm) {
+    out << "kGroupedGemm";
+  }
+  else if (provider == library::OperationKind::kDistributedGemm) {
+    out << "kDistributedGemm";
+  }
   else {
     out << "kInvalid";
   }
@@ -342,17 +382,67 @@ int OperationProfiler::profile_all(
   // 1. Construct performance report
   PerformanceReport report(options, problem_space.argument_names(), kind_);
 
-  // 2. For each problem in problem space
+  // 2. Profile each problem in problem space
+  return profile_problems(options, manifest, device_context, report);
+}
+
+/// Profiles the operations in the manifest over the problem space, appending results to `report`
+int OperationProfiler::profile_problems(
+  Options const &options,
+  library::Manifest const &manifest,
+  DeviceContext &device_context,
+  PerformanceReport &report,
+  SweepSchedule *schedule) {
+  ProblemSpace problem_space(arguments_, options.cmdline);
+
   ProblemSpace::Iterator problem_it = problem_space.begin();
   ProblemSpace::Iterator problem_end = problem_space.end();
 
   bool continue_profiling = true;
   int retval = 0;
 
+  // Problems are numbered explicitly rather than by the report, which may be shared by the workers
+  // of a parallel sweep
+  size_t problem_index = 0;
+
+  // Position of the current (problem, operation) pair in the sweep and of the next pair claimed by
+  // this worker
+  size_t sweep_position = 0;
+  size_t claimed_position = schedule ? schedule->claim() : 0;
+
+  int total_profiled_operation_count = 0;
+
   // For each problem in problem space
   for (; continue_profiling && problem_it != problem_end; ++problem_it) {
     ProblemSpace::Problem problem = problem_it.at();
-    report.next_problem();
+    ++problem_index;
+
+    // Adaptive early termination compares kernels of the same problem only
+    adaptive_best_upper_bound_ = std::numeric_limits<double>::infinity();
+
+    // Lowest modeled cost among the selected kernels sharing each math instruction
+    std::map<std::string, double> min_modeled_cost;
+
+    if (options.profiling.model_prune_ratio > 0) {
+      for (auto const& operation_ptr : manifest) {
+        library::Operation const *operation = operation_ptr.get();
+
+        if (!selects_operation_(options, operation, problem_space, problem)) {
+          continue;
+        }
+
+        double cost = modeled_cost_(options, operation->description(), problem_space, problem);
+        if (cost <= 0) {
+          continue;
+        }
+
+        std::string key = math_instruction_key_(operation->description());
+        auto it = min_modeled_cost.find(key);
+        if (it == min_modeled_cost.end() || cost < it->second) {
+          min_modeled_cost[key] = cost;
+        }
+      }
+    }
 
     // For each operation in manifest
     int matched_operation_count = 0;
@@ -367,10 +457,10 @@ int OperationProfiler::profile_all(
                 << "    provider: " << operation->description().provider << "\n";
 #endif // CUTLASS_DEBUG_TRACE_LEVEL
 
+#if defined(CUTLASS_DEBUG_TRACE_LEVEL) && (CUTLASS_DEBUG_TRACE_LEVEL > 1)
       auto min_cc = operation->description().tile_description.minimum_compute_capability;
       auto max_cc = operation->description().tile_description.maximum_compute_capability;
 
-#if defined(CUTLASS_DEBUG_TRACE_LEVEL) && (CUTLASS_DEBUG_TRACE_LEVEL > 1)
       std::cerr << "    min_cc: " << min_cc << "\n";
       std::cerr << "    max_cc: " << min_cc << "\n";
 #endif
@@ -379,7 +469,7 @@ int OperationProfiler::profile_all(
       device_context.free();
 
 #if defined(CUTLASS_DEBUG_TRACE_LEVEL) && (CUTLASS_DEBUG_TRACE_LEVEL > 1)
-      if (operation->description().kind != kind_) {
+      if (!profiles_operation_kind_(operation->description())) {
         std::cerr << "    @ kind " << operation->description().kind
                   << " != kind_ " << kind_ << "\n";
       }
@@ -400,37 +490,54 @@ int OperationProfiler::profile_all(
 #endif
 
       // Execute compatible cutlass operations if they satisfy the current device's compute capability
-      if (operation->description().kind == kind_ &&
-          operation->description().provider == library::Provider::kCUTLASS &&
-          options.device.compute_capability(0) >= min_cc &&
-          options.device.compute_capability(0) <= max_cc) {
+      // and the kernel selection filters
+      if (selects_operation_(options, operation, problem_space, problem)) {
 
         std::string operation_name(operation->description().name);
-        // Filter kernels by name
-        bool filtered_by_name = options.operation_names.empty();
-        if (!filtered_by_name) {
-
-          for (auto const & op_name : options.operation_names) {
-            if (find_string_matches_(op_name, operation_name)) {
-              filtered_by_name = true;
-              break;
-            }
+
+        // we have found a kernel match, so increment the counter for match kernels
+        ++matched_operation_count;
+
+        // Skip kernels the cost model rules out before paying for their workspace
+        if (options.profiling.model_prune_ratio > 0) {
+          double cost = modeled_cost_(options, operation->description(), problem_space, problem);
+          auto min_cost_it = min_modeled_cost.find(math_instruction_key_(operation->description()));
+
+          if (cost > 0 && min_cost_it != min_modeled_cost.end() &&
+              cost > options.profiling.model_prune_ratio * min_cost_it->second) {
+            continue;
           }
         }
 
-        for (auto const & op_name : options.excluded_operation_names) {
-          if (find_string_matches_(op_name, operation_name)) {
-            filtered_by_name = false;
-            break;
+        // Skip kernels whose registers, spills or occupancy are ruled out
+        library::KernelResourceUsage resource_usage;
+        bool resource_usage_valid =
+          (operation->get_kernel_resource_usage(&resource_usage) == Status::kSuccess);
+
+        if (resource_usage_valid) {
+          if ((options.profiling.max_registers > 0 &&
+                resource_usage.registers_per_thread > options.profiling.max_registers) ||
+              (!options.profiling.allow_spills && resource_usage.spills()) ||
+              (options.profiling.min_occupancy > 0 &&
+                resource_usage.max_active_blocks_per_sm < options.profiling.min_occupancy)) {
+            continue;
           }
         }
-
-        if (!filtered_by_name || !satisfies(operation->description(), problem_space, problem)) {
-          continue;
+        else {
+          (void)cudaGetLastError();
         }
 
-        // we have found a kernel match, so increment the counter for match kernels
-        ++matched_operation_count;
+        // In a parallel sweep, pairs not claimed by this worker are profiled by another device
+        if (schedule) {
+          if (sweep_position++ != claimed_position) {
+            continue;
+          }
+          if (schedule->stopped()) {
+            continue_profiling = false;
+            break;
+          }
+          claimed_position = schedule->claim();
+        }
 
         // A. Initialize configuration
         Status status = this->initialize_configuration(
@@ -446,7 +553,7 @@ int OperationProfiler::profile_all(
           // If there was an internal error, consume the CUDA error and move to the next operation.
           (void)cudaGetLastError();
 
-          report.append_result(model_result_);
+          report.append_result(model_result_, problem_index);
           continue;
         }
         else if (status != Status::kSuccess) {
@@ -475,7 +582,7 @@ int OperationProfiler::profile_all(
             // If there was an internal error, consume the CUDA error and move to the next operation.
             (void)cudaGetLastError();
 
-            report.append_results(results_);
+            report.append_results(results_, problem_index);
             continue;
           }
           else if (status != Status::kSuccess) {
@@ -504,7 +611,7 @@ int OperationProfiler::profile_all(
         }
 
         if (options.execution_mode == ExecutionMode::kDryRun) {
-          report.append_results(results_);
+          report.append_results(results_, problem_index);
           results_.clear();
           continue;
         }
@@ -539,7 +646,18 @@ int OperationProfiler::profile_all(
           profiled_operation_count++;
         }
 
-        report.append_results(results_);
+        // Place the results on the roofline of the device for the operation's math
+        double peak_gflops = peak_math_throughput(options.device, operation->description());
+        double peak_gbytes = peak_memory_bandwidth(options.device);
+
+        for (auto & result : results_) {
+          result.peak_gflops = peak_gflops;
+          result.peak_gbytes = peak_gbytes;
+          result.resource_usage = resource_usage;
+          result.resource_usage_valid = resource_usage_valid;
+        }
+
+        report.append_results(results_, problem_index);
         results_.clear();
       } // if op satisfied compute capacity
 
@@ -560,7 +678,10 @@ int OperationProfiler::profile_all(
       continue_profiling = false;
     }
 
-    if (options.profiling.error_if_nothing_is_profiled && options.profiling.enabled && profiled_operation_count <= 0) {
+    total_profiled_operation_count += profiled_operation_count;
+
+    // A parallel sweep checks this over all workers once the sweep completes
+    if (!schedule && options.profiling.error_if_nothing_is_profiled && options.profiling.enabled && profiled_operation_count <= 0) {
       #if !NDEBUG
       std::cerr << "Error: No kernels profiled found with kernel selection filters [--error_if_nothing_is_profiled]" << std::endl;
       #endif
@@ -571,11 +692,119 @@ int OperationProfiler::profile_all(
 
   } // for each problem in problem space
 
+  if (schedule) {
+    if (!continue_profiling) {
+      schedule->stop();
+    }
+    schedule->add_profiled_operations(total_profiled_operation_count);
+  }
+
   return retval;
 }
 
+/// Initializes the operation for the first problem of the problem space and captures one launch
+/// of it into `graph`
+Status OperationProfiler::capture_operation(
+  Options const &options,
+  library::Operation const *operation,
+  DeviceContext &device_context,
+  PerformanceReport &report,
+  cudaGraph_t &graph) {
+
+  ProblemSpace problem_space(arguments_, options.cmdline);
+  ProblemSpace::Problem problem = problem_space.begin().at();
+
+  graph = nullptr;
+
+  device_context.free();
+  results_.clear();
+
+  Status status = this->initialize_configuration(
+    options, report, device_context, operation, problem_space, problem);
+
+  if (status == Status::kSuccess) {
+    status = this->initialize_workspace(
+      options, report, device_context, operation, problem_space, problem);
+  }
+
+  if (status == Status::kSuccess && !results_.empty()) {
+
+    capture_graph_ = &graph;
+
+    this->profile(options, report, device_context, operation, problem_space, problem);
+
+    capture_graph_ = nullptr;
+
+    status = results_.back().status;
+  }
+
+  if (status == Status::kSuccess && !graph) {
+    status = Status::kErrorNotSupported;
+  }
+
+  results_.clear();
+  return status;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Returns true if the operation is run by this profiler on the current device and passes the
+/// kernel selection filters for the given problem
+bool OperationProfiler::selects_operation_(
+  Options const &options,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  library::OperationDescription const &desc = operation->description();
+
+  if (!profiles_operation_kind_(desc) ||
+      desc.provider != library::Provider::kCUTLASS ||
+      options.device.compute_capability(0) < desc.tile_description.minimum_compute_capability ||
+      options.device.compute_capability(0) > desc.tile_description.maximum_compute_capability) {
+    return false;
+  }
+
+  std::string operation_name(desc.name);
+
+  // Filter kernels by name
+  bool filtered_by_name = options.operation_names.empty();
+  if (!filtered_by_name) {
+
+    for (auto const & op_name : options.operation_names) {
+      if (find_string_matches_(op_name, operation_name)) {
+        filtered_by_name = true;
+        break;
+      }
+    }
+  }
+
+  for (auto const & op_name : options.excluded_operation_names) {
+    if (find_string_matches_(op_name, operation_name)) {
+      filtered_by_name = false;
+      break;
+    }
+  }
+
+  return filtered_by_name && satisfies(desc, problem_space, problem);
+}
+
+/// Kernels are only pruned by modeled cost against candidates sharing the same math instruction,
+/// since the model does not know the relative throughput of different instructions
+std::string OperationProfiler::math_instruction_key_(library::OperationDescription const &op_desc) {
+
+  library::MathInstructionDescription const &math = op_desc.tile_description.math_instruction;
+
+  std::stringstream ss;
+  ss << library::to_string(math.opcode_class) << "_"
+     << library::to_string(math.element_accumulator) << "_"
+     << math.instruction_shape.m() << "x"
+     << math.instruction_shape.n() << "x"
+     << math.instruction_shape.k();
+
+  return ss.str();
+}
+
 /// Sleep for a given duration in ms
 void OperationProfiler::sleep(int sleep_duration) {
   if (sleep_duration) {
@@ -651,12 +880,19 @@ void OperationProfiler::save_workspace(
       filename << "verified_by_" << library::to_string(verification_provider) << "_";
     }
 
-    filename << named_allocation.first + ".mat";
+    if (options.verification.save_workspace_format == WorkspaceFormat::kNpy) {
+      filename << named_allocation.first + ".npy";
+
+      allocation->write_tensor_npy(filename.str());
+    }
+    else {
+      filename << named_allocation.first + ".mat";
 
-    std::ofstream out(filename.str());
+      std::ofstream out(filename.str());
 
-    allocation->write_tensor_csv(out);
-    out << "\n";
+      allocation->write_tensor_csv(out);
+      out << "\n";
+    }
 
     if (options.report.verbose) {
       std::cout << "wrote '" << filename.str() << "'" << std::endl;
@@ -709,6 +945,23 @@ Status predict_iters(
   return Status::kSuccess;
 };
 
+/// Two-sided 95% quantile of Student's t distribution with `dof` degrees of freedom
+double student_t_975(int dof) {
+  static double const kQuantiles[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+     2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+     2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+  };
+
+  if (dof < 1) {
+    return std::numeric_limits<double>::infinity();
+  }
+  if (dof <= 30) {
+    return kQuantiles[dof - 1];
+  }
+  return 1.96;
+}
+
 } // namespace
 
 /// This profiling method is designed to run a kernel on several GPUs to
@@ -825,10 +1078,30 @@ Status OperationProfiler::profile_kernel_(
   const std::function<Status(cudaStream_t, int)> &func,
   cudaStream_t stream) {
 
+  if (capture_graph_) {
+    return capture_kernel_(func, stream);
+  }
+
+  // The legacy default stream cannot be captured, so operations profiled on it with CUDA Graphs
+  // run on an internal stream instead. The stream is blocking so that it stays ordered after any
+  // initialization work still in flight on the legacy stream.
+  CudaGraphResources internal;
+  if (options.profiling.use_cuda_graphs && !stream) {
+    CUDA_CHECK(cudaStreamCreate(&internal.stream));
+    stream = internal.stream;
+  }
+
   GpuTimer timer;
   // Optional sleep to limit power consumption and thermals
   sleep(options.profiling.sleep_duration);
 
+  // Optional background load contending with the profiled kernel for SMs and memory bandwidth
+  InterferenceGenerator interference(options.profiling.interference, options.profiling.interference_sms);
+
+  if (options.profiling.adaptive) {
+    return profile_kernel_adaptive_(result, options, func, stream);
+  }
+
   Status status = Status::kSuccess;
 
   int iterations;
@@ -844,6 +1117,15 @@ Status OperationProfiler::profile_kernel_(
     }
   }
 
+  if (options.profiling.use_cuda_graphs) {
+    return profile_kernel_graph_(result, iterations, options, func, stream);
+  }
+
+  DeviceTelemetryMonitor *telemetry = telemetry_monitor_(options);
+  if (telemetry) {
+    telemetry->begin();
+  }
+
   timer.start(stream);
 
   int iteration = 0;
@@ -856,14 +1138,270 @@ Status OperationProfiler::profile_kernel_(
     }
   }
 
+  // Launches are asynchronous, so the device is typically still busy with the timed work here
+  if (telemetry) {
+    telemetry->sample();
+  }
+
   timer.stop_and_wait(stream);
 
+  if (telemetry) {
+    result.telemetry = telemetry->end();
+  }
+
   result.runtime = timer.duration(iteration);
   result.status  = status;
 
   return status;
 }
 
+/// Captures one launch of the GPU kernel in `func` into *capture_graph_
+Status OperationProfiler::capture_kernel_(
+  const std::function<Status(cudaStream_t, int)> &func,
+  cudaStream_t stream) {
+
+  // The legacy default stream cannot be captured
+  cudaStream_t capture_stream = stream;
+  if (!capture_stream) {
+    CUDA_CHECK(cudaStreamCreateWithFlags(&capture_stream, cudaStreamNonBlocking));
+  }
+
+  cudaGraph_t graph = nullptr;
+
+  CUDA_CHECK(cudaStreamBeginCapture(capture_stream, cudaStreamCaptureModeThreadLocal));
+  Status status = func(capture_stream, 0);
+
+  cudaError_t result = cudaStreamEndCapture(capture_stream, &graph);
+
+  if (!stream) {
+    cudaStreamDestroy(capture_stream);
+  }
+
+  if (status != Status::kSuccess || result != cudaSuccess) {
+    if (graph) {
+      cudaGraphDestroy(graph);
+    }
+    (void)cudaGetLastError();
+    return status != Status::kSuccess ? status : Status::kErrorInternal;
+  }
+
+  // Operations that ignore the stream they are given run eagerly and leave the graph empty
+  size_t node_count = 0;
+  CUDA_CHECK(cudaGraphGetNodes(graph, nullptr, &node_count));
+
+  if (node_count == 0) {
+    cudaGraphDestroy(graph);
+    return Status::kErrorNotSupported;
+  }
+
+  *capture_graph_ = graph;
+  return Status::kSuccess;
+}
+
+/// Returns the telemetry monitor of the profiled device if telemetry was requested, otherwise null
+DeviceTelemetryMonitor *OperationProfiler::telemetry_monitor_(Options const &options) {
+
+  if (!options.profiling.telemetry) {
+    return nullptr;
+  }
+
+  if (!telemetry_) {
+    telemetry_.reset(new DeviceTelemetryMonitor(options.device.device_id(0)));
+
+    if (!telemetry_->good()) {
+      std::cerr << "Warning: device telemetry is unavailable [--telemetry]" << std::endl;
+    }
+  }
+
+  return telemetry_->good() ? telemetry_.get() : nullptr;
+}
+
+/// Method to profile GPU execution time of a kernel launched in func by timing batches of launches
+/// until the mean batch runtime is known to the requested precision. Timing stops early once the
+/// kernel's confidence interval lies entirely above the best upper bound seen for this problem.
+Status OperationProfiler::profile_kernel_adaptive_(
+  PerformanceResult &result,
+  Options const &options,
+  const std::function<Status(cudaStream_t, int)> &func,
+  cudaStream_t stream) {
+
+  Status status = Status::kSuccess;
+
+  for (int iteration = 0; iteration < options.profiling.warmup_iterations; ++iteration) {
+    status = func(stream, iteration);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+  }
+
+  int const batch_iterations = options.profiling.adaptive_batch_iterations;
+
+  // With CUDA Graphs, one batch is captured once and replayed for every sample
+  bool const use_graph = options.profiling.use_cuda_graphs;
+
+  CudaGraphResources resources;
+
+  if (use_graph) {
+    status = capture_profiled_graph_(resources.graph, resources.graph_exec, batch_iterations, options, func, stream);
+    if (status != Status::kSuccess) {
+      result.status = status;
+      return status;
+    }
+  }
+
+  DeviceTelemetryMonitor *telemetry = telemetry_monitor_(options);
+  if (telemetry) {
+    telemetry->begin();
+  }
+
+  GpuTimer timer;
+
+  double sum = 0;
+  double sum_squares = 0;
+  double half_width = std::numeric_limits<double>::infinity();
+  int samples = 0;
+  int iteration = options.profiling.warmup_iterations;
+
+  while (samples < options.profiling.adaptive_max_batches) {
+
+    timer.start(stream);
+
+    if (use_graph) {
+      CUDA_CHECK(cudaGraphLaunch(resources.graph_exec, stream));
+    }
+    else {
+      for (int i = 0; i < batch_iterations; ++i, ++iteration) {
+        status = func(stream, iteration);
+
+        if (status != Status::kSuccess) {
+          timer.stop_and_wait(stream);
+          result.status = status;
+          return status;
+        }
+      }
+    }
+
+    if (telemetry) {
+      telemetry->sample();
+    }
+
+    timer.stop_and_wait(stream);
+
+    double sample = timer.duration(batch_iterations);
+    sum += sample;
+    sum_squares += sample * sample;
+    ++samples;
+
+    if (samples < options.profiling.adaptive_min_batches) {
+      continue;
+    }
+
+    double mean = sum / samples;
+    double variance = std::max((sum_squares - samples * mean * mean) / (samples - 1), 0.0);
+    half_width = student_t_975(samples - 1) * std::sqrt(variance / samples);
+
+    // Precise enough, or confidently slower than a kernel already profiled
+    if (half_width <= options.profiling.adaptive_precision * mean ||
+        mean - half_width > adaptive_best_upper_bound_) {
+      break;
+    }
+  }
+
+  if (telemetry) {
+    result.telemetry = telemetry->end();
+  }
+
+  result.runtime = sum / samples;
+  result.status = Status::kSuccess;
+
+  adaptive_best_upper_bound_ = std::min(adaptive_best_upper_bound_, result.runtime + half_width);
+
+  return Status::kSuccess;
+}
+
+/// Captures `iterations` launches of the GPU kernel in `func` on `stream` and instantiates the
+/// resulting graph. On failure, the capture is terminated so that the stream remains usable.
+Status OperationProfiler::capture_profiled_graph_(
+  cudaGraph_t &graph,
+  cudaGraphExec_t &graph_exec,
+  int iterations,
+  Options const &options,
+  const std::function<Status(cudaStream_t, int)> &func,
+  cudaStream_t stream) {
+
+  CUDA_CHECK(cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal));
+
+  Status status = Status::kSuccess;
+  for (int iteration = 0; iteration < iterations && status == Status::kSuccess; ++iteration) {
+    status = func(stream, iteration + options.profiling.warmup_iterations);
+  }
+
+  cudaError_t error = cudaStreamEndCapture(stream, &graph);
+  if (status != Status::kSuccess) {
+    (void)cudaGetLastError();
+    return status;
+  }
+  CUDA_CHECK(error);
+
+  // Operations that ignore the stream they are given run eagerly and leave the graph empty,
+  // which would otherwise be reported as a near-zero runtime
+  size_t node_count = 0;
+  CUDA_CHECK(cudaGraphGetNodes(graph, nullptr, &node_count));
+  if (node_count == 0) {
+    std::cerr << "Error: operation did not launch on the profiling stream and cannot be captured [--use-cuda-graphs]\n";
+    return Status::kErrorNotSupported;
+  }
+
+  CUDA_CHECK(cudaGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+
+  // Upload the graph so that its first replay does not include instantiation costs
+  CUDA_CHECK(cudaGraphUpload(graph_exec, stream));
+
+  return Status::kSuccess;
+}
+
+/// Method to profile GPU execution time of a kernel launched in func by replaying a CUDA Graph
+/// capturing all profiled iterations
+Status OperationProfiler::profile_kernel_graph_(
+  PerformanceResult &result,
+  int iterations,
+  Options const &options,
+  const std::function<Status(cudaStream_t, int)> &func,
+  cudaStream_t stream) {
+
+  CudaGraphResources resources;
+
+  Status status = capture_profiled_graph_(resources.graph, resources.graph_exec, iterations, options, func, stream);
+  if (status != Status::kSuccess) {
+    result.status = status;
+    return status;
+  }
+
+  DeviceTelemetryMonitor *telemetry = telemetry_monitor_(options);
+  if (telemetry) {
+    telemetry->begin();
+  }
+
+  GpuTimer timer;
+  timer.start(stream);
+  CUDA_CHECK(cudaGraphLaunch(resources.graph_exec, stream));
+
+  if (telemetry) {
+    telemetry->sample();
+  }
+
+  timer.stop_and_wait(stream);
+
+  if (telemetry) {
+    result.telemetry = telemetry->end();
+  }
+
+  result.runtime = timer.duration(iterations);
+  result.status  = Status::kSuccess;
+
+  return Status::kSuccess;
+}
+
 /// Method to profile a CUTLASS Operation
 Status OperationProfiler::profile_cutlass_(
   PerformanceResult &result,
@@ -873,7 +1411,7 @@ Status OperationProfiler::profile_cutlass_(
   void *host_workspace,
   void *device_workspace) {
 
-  auto op = [=](cudaStream_t, int) { return operation->run(arguments, host_workspace, device_workspace); };
+  auto op = [=](cudaStream_t stream, int) { return operation->run(arguments, host_workspace, device_workspace, stream); };
   return profile_kernel_(result, options, op);
 }
 
@@ -34,6 +34,8 @@
 
 #include <algorithm>
 #include <set>
+#include <cstdlib>
+#include <string>
 
 #include "cutlass/cutlass.h"
 #include "cutlass/version.h"
@@ -88,6 +90,8 @@ Options::Device::Device(cutlass::CommandLine const &cmdline) {
     }
   }
 
+  cmdline.get_cmd_line_argument("parallel-sweep", parallel_sweep, false);
+
   properties.resize(devices.size());
   // Retrieves properties for all specified devices
   for (size_t device_index = 0; device_index < devices.size(); device_index++) {
@@ -146,7 +150,13 @@ void Options::Device::print_usage(std::ostream &out) const {
 
   out << "Device:\n"
     << "  --devices=<int>,<int>,...                      "
-    << "    CUDA Device IDs\n\n";
+    << "    CUDA Device IDs\n\n"
+
+    << "  --parallel-sweep=<bool>                      "
+    << "    If true and several --devices are listed, the (problem x kernel) space" << end_of_line
+    << "      is sharded across the devices with one worker per device, and results" << end_of_line
+    << "      are merged into one report. Otherwise each kernel runs on all devices" << end_of_line
+    << "      at once.\n\n";
 
   int device_count = 0;
   cudaError_t result = cudaGetDeviceCount(&device_count);
@@ -218,7 +228,8 @@ void Options::Device::print_options(std::ostream &out, int indent) const {
   out
     << "\n"
     << indent_str(indent) << "clock: " << int(double(properties[0].clockRate) / 1000.0) << "\n"
-    << indent_str(indent) << "compute-capability: " << compute_capability(0) << "\n";
+    << indent_str(indent) << "compute-capability: " << compute_capability(0) << "\n"
+    << indent_str(indent) << "parallel-sweep: " << parallel_sweep << "\n";
 }
 
 /// Returns the device ID from a device index
@@ -476,6 +487,48 @@ Options::Profiling::Profiling(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("profiling-enabled", enabled, true);
   cmdline.get_cmd_line_argument("profiling-duration", duration, 10);
   cmdline.get_cmd_line_argument("min-iterations", min_iterations, 10);
+  cmdline.get_cmd_line_argument("use-cuda-graphs", use_cuda_graphs, false);
+  cmdline.get_cmd_line_argument("adaptive-profiling", adaptive, false);
+  cmdline.get_cmd_line_argument("adaptive-batch-iterations", adaptive_batch_iterations, 10);
+  cmdline.get_cmd_line_argument("adaptive-min-batches", adaptive_min_batches, 3);
+  cmdline.get_cmd_line_argument("adaptive-max-batches", adaptive_max_batches, 50);
+  cmdline.get_cmd_line_argument("adaptive-precision", adaptive_precision, 0.01);
+  cmdline.get_cmd_line_argument("model-prune-ratio", model_prune_ratio, 0.0);
+  cmdline.get_cmd_line_argument("max-registers", max_registers, 0);
+  cmdline.get_cmd_line_argument("allow-spills", allow_spills, true);
+  cmdline.get_cmd_line_argument("min-occupancy", min_occupancy, 0);
+  cmdline.get_cmd_line_argument("telemetry", telemetry, false);
+  cmdline.get_cmd_line_argument("interference-sms", interference_sms, 8);
+  cmdline.get_cmd_line_argument("sm-count", sm_count, 0);
+  cmdline.get_cmd_line_argument("model-trace", model_trace);
+
+  if (cmdline.check_cmd_line_flag("interference")) {
+    std::string value;
+    cmdline.get_cmd_line_argument("interference", value);
+    interference = from_string<InterferenceLoad>(value);
+
+    if (interference == InterferenceLoad::kInvalid) {
+      throw std::runtime_error("Invalid interference load: " + value);
+    }
+  }
+
+  interference_sms = std::max(interference_sms, 1);
+
+  if (cmdline.check_cmd_line_flag("lock-clocks")) {
+    std::string lock_clocks;
+    cmdline.get_cmd_line_argument("lock-clocks", lock_clocks);
+
+    if (lock_clocks == "default" || lock_clocks == "true") {
+      lock_sm_clock = -1;
+    }
+    else if (lock_clocks != "false") {
+      lock_sm_clock = std::max(std::atoi(lock_clocks.c_str()), 0);
+    }
+  }
+
+  adaptive_batch_iterations = std::max(adaptive_batch_iterations, 1);
+  adaptive_min_batches = std::max(adaptive_min_batches, 2);
+  adaptive_max_batches = std::max(adaptive_max_batches, adaptive_min_batches);
 
   if (cmdline.check_cmd_line_flag("providers")) {
 
@@ -527,6 +580,80 @@ void Options::Profiling::print_usage(std::ostream &out) const {
     << "  --profiling-enabled=<bool>                   "
     << "    If true, profiling is actually conducted.\n\n"
 
+    << "  --use-cuda-graphs=<bool>                     "
+    << "    If true, the profiled iterations are captured into a CUDA Graph and the" << end_of_line
+    << "      replay of the graph is timed. This excludes host launch overhead from" << end_of_line
+    << "      the measured runtime.\n\n"
+
+    << "  --adaptive-profiling=<bool>                  "
+    << "    If true, each kernel is timed in batches of --adaptive-batch-iterations" << end_of_line
+    << "      launches until the 95% confidence interval of its mean runtime is within" << end_of_line
+    << "      --adaptive-precision of the mean. Kernels whose interval lies entirely above" << end_of_line
+    << "      that of the fastest kernel profiled so far for the problem are stopped early." << end_of_line
+    << "      Replaces --profiling-iterations and --profiling-duration.\n\n"
+
+    << "  --adaptive-batch-iterations=<iterations>     "
+    << "    Number of launches per timed batch in adaptive mode (default: 10).\n\n"
+
+    << "  --adaptive-min-batches=<batches>             "
+    << "    Minimum number of batches timed per kernel in adaptive mode (default: 3).\n\n"
+
+    << "  --adaptive-max-batches=<batches>             "
+    << "    Maximum number of batches timed per kernel in adaptive mode (default: 50).\n\n"
+
+    << "  --adaptive-precision=<ratio>                 "
+    << "    Relative confidence interval half-width at which adaptive timing stops" << end_of_line
+    << "      (default: 0.01).\n\n"
+
+    << "  --model-prune-ratio=<ratio>                  "
+    << "    If positive, kernels whose modeled cost (tile and wave quantization of the" << end_of_line
+    << "      problem) exceeds this multiple of the cheapest candidate with the same math" << end_of_line
+    << "      instruction are skipped without being run. Zero (default) disables pruning.\n\n"
+
+    << "  --max-registers=<int>                        "
+    << "    If positive, kernels using more registers per thread are skipped.\n\n"
+
+    << "  --allow-spills=<bool>                        "
+    << "    If false, kernels that spill registers to local memory are skipped" << end_of_line
+    << "      (default: true).\n\n"
+
+    << "  --min-occupancy=<blocks>                     "
+    << "    If positive, kernels with fewer resident thread blocks per SM are" << end_of_line
+    << "      skipped, e.g. to leave room for kernels running concurrently.\n\n"
+
+    << "  --telemetry=<bool>                           "
+    << "    If true, SM and memory clocks, power draw, temperature and throttle" << end_of_line
+    << "      reasons are sampled through NVML while each kernel is timed and added" << end_of_line
+    << "      to the report. Results measured while power or thermal limits slowed" << end_of_line
+    << "      the device are flagged as throttled.\n\n"
+
+    << "  --lock-clocks=<MHz|default>                  "
+    << "    Locks the SM clock of each device to the given frequency, or to its" << end_of_line
+    << "      default application clock, for the duration of the run. This usually" << end_of_line
+    << "      requires administrator privileges.\n\n"
+
+    << "  --interference=<none|bandwidth|occupancy>    "
+    << "    Background load run on the device while kernels are timed, so that" << end_of_line
+    << "      rankings reflect contended conditions." << end_of_line
+    << "       --interference=none       no background load (default)" << end_of_line
+    << "       --interference=bandwidth  stream through a buffer larger than the L2" << end_of_line
+    << "       --interference=occupancy  hold SMs with idle persistent thread blocks\n\n"
+
+    << "  --interference-sms=<int>                     "
+    << "    Number of SMs occupied by the background load (default: 8).\n\n"
+
+    << "  --sm-count=<int>                             "
+    << "    SM count passed to kernels that size their grid from the device, such" << end_of_line
+    << "      as persistent and stream-K kernels. Defaults to the SMs left free by" << end_of_line
+    << "      the background load.\n\n"
+
+    << "  --model-trace=<path|name>                    "
+    << "    Replays the GEMM and convolution calls of one model step. Each call" << end_of_line
+    << "      is profiled with the kernel selection filters, then the fastest" << end_of_line
+    << "      kernels are replayed back to back to measure the step end-to-end." << end_of_line
+    << "      Built-in traces: llama-7b-prefill, llama-7b-decode, bert-large," << end_of_line
+    << "      resnet50.\n\n"
+
   ;
 }
 
@@ -536,6 +663,18 @@ void Options::Profiling::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "profiling_iterations: " << iterations << "\n"
     << indent_str(indent) << "sleep_duration: " << sleep_duration << "\n"
     << indent_str(indent) << "profiling_enabled: " << enabled << "\n"
+    << indent_str(indent) << "use_cuda_graphs: " << use_cuda_graphs << "\n"
+    << indent_str(indent) << "adaptive_profiling: " << adaptive << "\n"
+    << indent_str(indent) << "model_prune_ratio: " << model_prune_ratio << "\n"
+    << indent_str(indent) << "max_registers: " << max_registers << "\n"
+    << indent_str(indent) << "allow_spills: " << allow_spills << "\n"
+    << indent_str(indent) << "min_occupancy: " << min_occupancy << "\n"
+    << indent_str(indent) << "telemetry: " << telemetry << "\n"
+    << indent_str(indent) << "lock_sm_clock: " << lock_sm_clock << "\n"
+    << indent_str(indent) << "interference: " << to_string(interference) << "\n"
+    << indent_str(indent) << "interference_sms: " << interference_sms << "\n"
+    << indent_str(indent) << "sm_count: " << sm_count << "\n"
+    << indent_str(indent) << "model_trace: " << model_trace << "\n"
     << indent_str(indent) << "providers: [";
 
   int j = 0;
@@ -584,6 +723,13 @@ Options::Verification::Verification(cutlass::CommandLine const &cmdline) {
     save_workspace = SaveWorkspace::kNever;
   }
 
+  save_workspace_format = WorkspaceFormat::kCsv;
+  if (cmdline.check_cmd_line_flag("save-workspace-format")) {
+    std::string value;
+    cmdline.get_cmd_line_argument("save-workspace-format", value);
+    save_workspace_format = from_string<WorkspaceFormat>(value);
+  }
+
   if (cmdline.check_cmd_line_flag("verification-providers")) {
 
     std::vector<std::string> tokens;
@@ -626,6 +772,11 @@ void Options::Verification::print_usage(std::ostream &out) const {
     << "       --save-workspace=incorrect  save workspace for incorrect results" << end_of_line
     << "       --save-workspace=always     always save workspace\n\n"
 
+    << "  --save-workspace-format=<string>             "
+    << "    File format of saved workspaces." << end_of_line
+    << "       --save-workspace-format=csv  text matrices in .mat files (default)" << end_of_line
+    << "       --save-workspace-format=npy  binary NumPy arrays in .npy files, streamed from device\n\n"
+
     << "  --verification-providers=<providers>         "
     << "    List of providers used to verify result. (default: '*')" << end_of_line
     << "      Gemm verification-providers {cublas*}" << end_of_line
@@ -639,6 +790,7 @@ void Options::Verification::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "verification_enabled: " << enabled << "\n"
     << indent_str(indent) << "epsilon: " << epsilon << "\n"
     << indent_str(indent) << "save_workspace: " << to_string(save_workspace) << "\n"
+    << indent_str(indent) << "save_workspace_format: " << to_string(save_workspace_format) << "\n"
     << indent_str(indent) << "verification_providers: [";
 
   int j = 0;
@@ -672,6 +824,7 @@ Options::Report::Report(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("append", append, false);
   cmdline.get_cmd_line_argument("output", output_path);
   cmdline.get_cmd_line_argument("junit-output", junit_output_path);
+  cmdline.get_cmd_line_argument("export-gemm-selection", gemm_selection_output_path);
 
   if (cmdline.check_cmd_line_flag("tags")) {
     cmdline.get_cmd_line_argument_pairs("tags", pivot_tags);
@@ -700,6 +853,10 @@ void Options::Report::print_usage(std::ostream &out) const {
     << "  --junit-output=<path>                        "
     << "    Path to junit output file for result reporting. Operation kind and '.junit.xml' is appended.\n\n"
 
+    << "  --export-gemm-selection=<path>               "
+    << "    Path to output file listing the fastest CUTLASS GEMM operation per problem. The file is" << end_of_line
+    << "      loadable by library::GemmSelectionCache and library::Handle::load_gemm_selection_cache().\n\n"
+
     << "  --print-kernel-before-running=<bool>                "
     << "    Prints the name of the kernel being profiled before running the kernel." << end_of_line
     << "      This is useful for determining which kernel is causing a run of the profiler to hang\n\n"
@@ -725,6 +882,7 @@ void Options::Report::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "append: " << append << "\n"
     << indent_str(indent) << "output: " << output_path << "\n"
     << indent_str(indent) << "junit-output: " << junit_output_path << "\n"
+    << indent_str(indent) << "export-gemm-selection: " << gemm_selection_output_path << "\n"
     << indent_str(indent) << "print-kernel-before-running: " << print_kernel_before_running << "\n"
     << indent_str(indent) << "report-not-run: " << report_not_run << "\n"
     << indent_str(indent) << "tags:\n";
@@ -829,6 +987,34 @@ Options::Options(cutlass::CommandLine const &cmdline):
   }
 }
 
+/// Returns the SM count passed to kernels
+int Options::kernel_sm_count() const {
+
+  if (profiling.sm_count > 0) {
+    return profiling.sm_count;
+  }
+
+  int device_sm_count = device.properties.at(0).multiProcessorCount;
+
+  if (profiling.interference != InterferenceLoad::kNone) {
+    return std::max(device_sm_count - profiling.interference_sms, 1);
+  }
+
+  return device_sm_count;
+}
+
+/// Returns a copy of the options restricted to the listed device at `device_index`
+Options Options::select_device(size_t device_index) const {
+
+  Options selected(*this);
+
+  selected.device.devices = {device.device_id(device_index)};
+  selected.device.properties = {device.properties.at(device_index)};
+  selected.device.parallel_sweep = false;
+
+  return selected;
+}
+
 void Options::print_usage(std::ostream &out) const {
 
   out
@@ -37,10 +37,10 @@
 #include <iomanip>
 #include <algorithm>
 #include <cstring>
+#include <cstdlib>
 
 #include "cutlass/library/util.h"
-
-#include "cutlass/library/util.h"
+#include "cutlass/library/singleton.h"
 
 #include "cutlass/profiler/performance_report.h"
 #include "cutlass/profiler/debug.h"
@@ -140,8 +140,14 @@ void PerformanceReport::next_problem() {
 }
 
 void PerformanceReport::append_result(PerformanceResult result) {
+  append_result(result, problem_index_);
+}
+
+void PerformanceReport::append_result(PerformanceResult result, size_t problem_index) {
 
-  result.problem_index = problem_index_;
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+  result.problem_index = problem_index;
 
   if (options_.report.verbose) {
     std::cout << "\n";
@@ -158,6 +164,178 @@ void PerformanceReport::append_result(PerformanceResult result) {
   else {
     concatenated_results_.push_back(result);
   }
+
+  if (!options_.report.gemm_selection_output_path.empty()) {
+    record_gemm_selection_(result);
+  }
+
+  record_roofline_(result);
+  record_fastest_(result);
+}
+
+void PerformanceReport::record_fastest_(PerformanceResult const &result) {
+
+  if (result.status != Status::kSuccess || !result.good() ||
+      result.provider != library::Provider::kCUTLASS ||
+      result.disposition == Disposition::kFailed ||
+      result.disposition == Disposition::kIncorrect) {
+    return;
+  }
+
+  auto fastest_it = fastest_results_.find(result.problem_index);
+  if (fastest_it == fastest_results_.end() || result.runtime < fastest_it->second.runtime) {
+    fastest_results_[result.problem_index] = result;
+  }
+}
+
+/// Returns the fastest correct CUTLASS result of a problem, or null if none was profiled
+PerformanceResult const *PerformanceReport::fastest_result(size_t problem_index) const {
+
+  auto fastest_it = fastest_results_.find(problem_index);
+  return fastest_it == fastest_results_.end() ? nullptr : &fastest_it->second;
+}
+
+void PerformanceReport::record_roofline_(PerformanceResult const &result) {
+
+  if (result.status != Status::kSuccess || !result.good() || !result.has_roofline()) {
+    return;
+  }
+
+  auto best_it = best_roofline_results_.find(result.problem_index);
+  if (best_it == best_roofline_results_.end() ||
+      best_it->second.roofline_efficiency() < result.roofline_efficiency()) {
+    best_roofline_results_[result.problem_index] = result;
+  }
+}
+
+void PerformanceReport::print_roofline_summary_(std::ostream &out) {
+
+  // Number of problems listed
+  size_t const kSummaryCount = 10;
+
+  std::vector<PerformanceResult const *> ranked;
+  for (auto const &entry : best_roofline_results_) {
+    ranked.push_back(&entry.second);
+  }
+
+  std::stable_sort(ranked.begin(), ranked.end(),
+    [](PerformanceResult const *a, PerformanceResult const *b) {
+      return a->roofline_efficiency() < b->roofline_efficiency();
+    });
+
+  if (ranked.size() > kSummaryCount) {
+    ranked.resize(kSummaryCount);
+  }
+
+  out << "\n\n";
+  out << "=============================\n\n";
+  out << "Problems furthest from roofline:\n\n";
+
+  for (auto const *result : ranked) {
+    out
+      << "  Problem " << result->problem_index << ": "
+      << std::fixed << std::setprecision(1) << 100.0 * result->roofline_efficiency() << "% of roofline ("
+      << (result->compute_bound() ? "compute" : "memory") << " bound, "
+      << std::setprecision(2) << result->arithmetic_intensity() << " flops/byte)"
+      << std::defaultfloat << std::setprecision(6) << "\n"
+      << "    Best: " << result->operation_name << " (" << library::to_string(result->provider, true) << ")\n"
+      << "    Arguments:";
+
+    for (auto const &arg : result->arguments) {
+      if (!arg.second.empty()) {
+        out << " --" << arg.first << "=" << arg.second;
+      }
+    }
+    out << "\n\n";
+  }
+}
+
+void PerformanceReport::record_gemm_selection_(PerformanceResult const &result) {
+
+  if (result.op_kind != library::OperationKind::kGemm ||
+      result.provider != library::Provider::kCUTLASS ||
+      result.status != Status::kSuccess ||
+      !result.good() ||
+      (result.disposition != Disposition::kPassed && result.disposition != Disposition::kNotVerified)) {
+    return;
+  }
+
+  if (gemm_operations_by_name_.empty()) {
+    for (auto const &operation : library::Singleton::get().manifest) {
+      if (operation->description().kind == library::OperationKind::kGemm) {
+        gemm_operations_by_name_[operation->description().name] = operation.get();
+      }
+    }
+  }
+
+  auto operation_it = gemm_operations_by_name_.find(result.operation_name);
+  if (operation_it == gemm_operations_by_name_.end()) {
+    return;
+  }
+
+  int64_t extents[3] = {0, 0, 0};
+  char const *extent_names[3] = {"m", "n", "k"};
+
+  for (int i = 0; i < 3; ++i) {
+    auto arg_it = std::find_if(result.arguments.begin(), result.arguments.end(),
+      [&](std::pair<std::string, std::string> const &arg) { return arg.first == extent_names[i]; });
+
+    if (arg_it == result.arguments.end()) {
+      return;
+    }
+
+    extents[i] = std::strtoll(arg_it->second.c_str(), nullptr, 10);
+  }
+
+  library::GemmDescription const &desc =
+    static_cast<library::GemmDescription const &>(operation_it->second->description());
+
+  // Problems at least as aligned as the operation requires may use it
+  int alignment = std::max(std::max(desc.A.alignment, desc.B.alignment), desc.C.alignment);
+
+  library::GemmSelectionKey key = library::GemmSelectionKey::from_problem(
+    library::gemm_functional_key(desc),
+    options_.device.compute_capability(0),
+    options_.device.properties.at(0).multiProcessorCount,
+    alignment,
+    extents[0], extents[1], extents[2]);
+
+  double gflops = result.gflops_per_sec();
+
+  auto best_it = gemm_selection_gflops_.find(key);
+  if (best_it == gemm_selection_gflops_.end() || best_it->second < gflops) {
+    gemm_selection_gflops_[key] = gflops;
+    gemm_selection_.insert(key, operation_it->second);
+  }
+}
+
+void PerformanceReport::write_gemm_selection_() {
+
+  std::string const &path = options_.report.gemm_selection_output_path;
+
+  library::GemmSelectionCache exported;
+
+  if (options_.report.append) {
+    std::ifstream existing(path);
+    if (existing.is_open() &&
+        exported.load(existing, library::Singleton::get().manifest) != Status::kSuccess) {
+      std::cerr << "Ignoring malformed GEMM selection table '" << path << "'" << std::endl;
+      exported.clear();
+    }
+  }
+
+  for (auto const &entry : gemm_selection_.selections()) {
+    exported.insert(entry.first, entry.second);
+  }
+
+  if (exported.save(path) != Status::kSuccess) {
+    std::cerr << "Failed to write GEMM selection table '" << path << "'" << std::endl;
+    return;
+  }
+
+  if (options_.report.verbose) {
+    std::cout << "\nWrote GEMM selection table to '" << path << "'" << std::endl;
+  }
 }
 
 void PerformanceReport::sort_results(PerformanceResultVector &results) {
@@ -177,6 +355,13 @@ void PerformanceReport::sort_results(PerformanceResultVector &results) {
 }
 
 void PerformanceReport::append_results(PerformanceResultVector const &results) {
+  append_results(results, problem_index_);
+}
+
+void PerformanceReport::append_results(PerformanceResultVector const &results, size_t problem_index) {
+
+  // Keep the results of one operation together when workers append concurrently
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
 
   if (options_.report.verbose) {
     std::cout << "\n\n";
@@ -184,7 +369,7 @@ void PerformanceReport::append_results(PerformanceResultVector const &results) {
 
   // For each result
   for (auto const & result : results) {
-    append_result(result);
+    append_result(result, problem_index);
   }
 }
 
@@ -213,6 +398,10 @@ PerformanceReport::~PerformanceReport() {
     std::cout << "\nWrote results to '" << op_file_name_ << "'" << std::endl;
   }
 
+  if (options_.report.verbose && !best_roofline_results_.empty()) {
+    print_roofline_summary_(std::cout);
+  }
+
   if (output_file_.is_open()) {
     output_file_.close();
   }
@@ -222,6 +411,10 @@ PerformanceReport::~PerformanceReport() {
     junit_output_file_.close();
     std::cout << "\nWrote jUnit results to '" << op_junit_file_name_ << "'" << std::endl;
   }
+
+  if (!options_.report.gemm_selection_output_path.empty() && op_kind_ == library::OperationKind::kGemm) {
+    write_gemm_selection_();
+  }
 }
 
 static const char *disposition_status_color(Disposition disposition) {
@@ -300,7 +493,7 @@ std::ostream & PerformanceReport::print_result_pretty_(
   out
     << "           Bytes: " << result.bytes << "  bytes\n"
     << "           FLOPs: " << result.flops << "  flops\n"
-    << "           FLOPs/Byte: " << (result.flops / result.bytes) << "\n\n";
+    << "           FLOPs/Byte: " << result.arithmetic_intensity() << "\n\n";
 
   if (result.good()) {
 
@@ -309,6 +502,42 @@ std::ostream & PerformanceReport::print_result_pretty_(
       << "          Memory: " << result.gbytes_per_sec() << " GiB/s\n"
       << "\n            Math: " << result.gflops_per_sec() << " GFLOP/s\n";
 
+    if (result.has_roofline()) {
+      out
+        << "\n        Roofline: " << (result.compute_bound() ? "compute" : "memory") << " bound, "
+        << 100.0 * result.roofline_efficiency() << "% of roofline\n"
+        << "       Peak Math: " << 100.0 * result.math_efficiency() << "% of " << result.peak_gflops << " GFLOP/s\n"
+        << "     Peak Memory: " << 100.0 * result.memory_efficiency() << "% of " << result.peak_gbytes << " GiB/s\n";
+    }
+  }
+
+  if (result.resource_usage_valid) {
+
+    library::KernelResourceUsage const &usage = result.resource_usage;
+    out
+      << "\n       Registers: " << usage.registers_per_thread << " per thread\n"
+      << "    Local Memory: " << usage.local_bytes_per_thread << " bytes per thread"
+      << (usage.spills() ? " (spills)" : "") << "\n"
+      << "   Shared Memory: " << usage.static_smem_bytes << " static, "
+      << usage.dynamic_smem_bytes << " dynamic bytes\n"
+      << "       Occupancy: " << usage.max_active_blocks_per_sm << " blocks of "
+      << usage.threads_per_block << " threads per SM\n";
+  }
+
+  if (result.telemetry.valid) {
+
+    out
+      << "\n          Clocks: SM " << result.telemetry.sm_clock << " MHz, memory "
+      << result.telemetry.memory_clock << " MHz\n"
+      << "           Power: " << result.telemetry.power << " W\n"
+      << "     Temperature: " << result.telemetry.temperature << " C\n";
+
+    if (result.telemetry.throttled()) {
+      out
+        << "       Throttled: " << (use_shell_coloring ? SHELL_COLOR_RED() : "") << "yes"
+        << shell_color_end << " (reasons 0x" << std::hex << result.telemetry.throttle_reasons << std::dec
+        << ", " << result.telemetry.violation_time << " ms in violation)\n";
+    }
   }
 
   return out;
@@ -339,7 +568,8 @@ std::ostream & PerformanceReport::print_csv_header_(
     << ",Flops/Byte"
     << ",Runtime";
 
-  if (options_.device.devices.size() > 1) {
+  // Per-device runtimes are only measured when every kernel runs on all devices at once
+  if (options_.device.devices.size() > 1 && !options_.device.parallel_sweep) {
     for (size_t i = 0; i < options_.device.devices.size(); i++) {
       out << ",Runtime_" << i;
     }
@@ -348,8 +578,28 @@ std::ostream & PerformanceReport::print_csv_header_(
   out
     << ",GB/s"
     << ",GFLOPs"
+    << ",Bound"
+    << ",%PeakMath"
+    << ",%PeakMemory"
+    << ",%Roofline"
+    << ",Registers"
+    << ",LocalBytes"
+    << ",StaticSmem"
+    << ",DynamicSmem"
+    << ",BlocksPerSM"
     ;
 
+  if (options_.profiling.telemetry) {
+    out
+      << ",SMClock"
+      << ",MemoryClock"
+      << ",Power"
+      << ",Temperature"
+      << ",ThrottleReasons"
+      << ",Throttled"
+      ;
+  }
+
   return out;
 }
 
@@ -381,10 +631,10 @@ std::ostream & PerformanceReport::print_result_csv_(
   out
     << "," << result.bytes
     << "," << result.flops
-    << "," << result.flops / result.bytes
+    << "," << result.arithmetic_intensity()
     << "," << result.runtime;
 
-  if (options_.device.devices.size() > 1) {
+  if (options_.device.devices.size() > 1 && !options_.device.parallel_sweep) {
     if (result.runtime_vector.size() != options_.device.devices.size()) {
       throw std::runtime_error("Runtime vector size mismatch");
     }
@@ -408,6 +658,47 @@ std::ostream & PerformanceReport::print_result_csv_(
     );
   }
 
+  if (result.good() && result.has_roofline()) {
+    out
+      << "," << (result.compute_bound() ? "compute" : "memory")
+      << "," << 100.0 * result.math_efficiency()
+      << "," << 100.0 * result.memory_efficiency()
+      << "," << 100.0 * result.roofline_efficiency()
+      ;
+  }
+  else {
+    out << std::string(4, ',');
+  }
+
+  if (result.resource_usage_valid) {
+    out
+      << "," << result.resource_usage.registers_per_thread
+      << "," << result.resource_usage.local_bytes_per_thread
+      << "," << result.resource_usage.static_smem_bytes
+      << "," << result.resource_usage.dynamic_smem_bytes
+      << "," << result.resource_usage.max_active_blocks_per_sm
+      ;
+  }
+  else {
+    out << std::string(5, ',');
+  }
+
+  if (options_.profiling.telemetry) {
+    if (result.telemetry.valid) {
+      out
+        << "," << result.telemetry.sm_clock
+        << "," << result.telemetry.memory_clock
+        << "," << result.telemetry.power
+        << "," << result.telemetry.temperature
+        << ",0x" << std::hex << result.telemetry.throttle_reasons << std::dec
+        << "," << (result.telemetry.throttled() ? "true" : "false")
+        ;
+    }
+    else {
+      out << std::string(6, ',');
+    }
+  }
+
   return out;
 }
 
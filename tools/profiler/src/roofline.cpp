@@ -0,0 +1,214 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Peak device throughput used to place profiling results on a roofline
+*/
+
+#include <algorithm>
+
+#include <cuda_runtime.h>
+
+#include "cutlass/library/util.h"
+
+#include "cutlass/profiler/roofline.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Dense math throughput of one SM per clock (FLOPs, counting a multiply-add as two). Tensor Core
+/// rates are for the datacenter part of each architecture; zero marks unsupported math.
+struct SmMathRate {
+  int compute_capability;
+  int f16;
+  int tf32;
+  int f8;
+  int s8;
+  int s4;
+  int f64_tensor;
+  int f32_simt;
+  int f64_simt;
+};
+
+SmMathRate const kSmMathRates[] = {
+  // cc     f16   tf32     f8     s8    s4  f64 tensor  f32  f64
+  {   70,  1024,     0,     0,     0,    0,    0,       128,  64 },
+  {   75,  1024,     0,     0,  2048, 4096,    0,       128,   4 },
+  {   80,  2048,  1024,     0,  4096, 8192,  128,       128,  64 },
+  {   86,  1024,   512,     0,  2048, 4096,    0,       256,   4 },
+  {   89,  1024,   512,  2048,  2048, 4096,    0,       256,   4 },
+  {   90,  4096,  2048,  8192,  8192,    0,  256,       256, 128 },
+  {  100,  8192,  4096, 16384, 16384,    0,  256,       256, 128 },
+};
+
+/// Returns the rates of the newest architecture not newer than the compute capability
+SmMathRate const *find_sm_math_rate(int compute_capability) {
+  SmMathRate const *rate = nullptr;
+  for (auto const &candidate : kSmMathRates) {
+    if (candidate.compute_capability <= compute_capability) {
+      rate = &candidate;
+    }
+  }
+  return rate;
+}
+
+/// Returns the element type of the operands that determines the math rate
+template <typename Description>
+library::NumericTypeID math_element(Description const &desc) {
+  // Mixed-input math upconverts the narrower operand, so it runs at the rate of the wider one
+  library::NumericTypeID a = library::get_real_type(desc.A.element);
+  library::NumericTypeID b = library::get_real_type(desc.B.element);
+  return library::sizeof_bits(a) >= library::sizeof_bits(b) ? a : b;
+}
+
+/// Returns the element type of the operands that determines the math rate of the operation
+library::NumericTypeID math_element(library::OperationDescription const &op_desc) {
+  switch (op_desc.kind) {
+  case library::OperationKind::kGemm:
+  case library::OperationKind::kSparseGemm:
+    return math_element(static_cast<library::GemmDescription const &>(op_desc));
+  case library::OperationKind::kConv2d:
+  case library::OperationKind::kConv3d:
+    return math_element(static_cast<library::ConvDescription const &>(op_desc));
+  case library::OperationKind::kRankK:
+  case library::OperationKind::kRank2K:
+    return math_element(static_cast<library::RankKDescription const &>(op_desc));
+  case library::OperationKind::kTrmm:
+    return math_element(static_cast<library::TrmmDescription const &>(op_desc));
+  case library::OperationKind::kSymm:
+    return math_element(static_cast<library::SymmDescription const &>(op_desc));
+  default:
+    return library::NumericTypeID::kInvalid;
+  }
+}
+
+/// Returns the dense math throughput of one SM per clock for the operation
+double sm_math_rate(SmMathRate const &rate, library::OperationDescription const &op_desc) {
+
+  library::MathInstructionDescription const &math = op_desc.tile_description.math_instruction;
+  library::NumericTypeID element = math_element(op_desc);
+
+  if (math.opcode_class == library::OpcodeClassID::kSimt) {
+    if (element == library::NumericTypeID::kF64) {
+      return rate.f64_simt;
+    }
+    return rate.f32_simt;
+  }
+
+  // Fast F32 modes run F32 operands through lower-precision Tensor Core math
+  switch (math.math_operation) {
+  case library::MathOperationID::kMultiplyAddFastBF16:
+  case library::MathOperationID::kMultiplyAddFastF16:
+    return rate.f16;
+  case library::MathOperationID::kMultiplyAddFastF32:
+  case library::MathOperationID::kMultiplyAddComplexFastF32:
+    // Three TF32 products per F32 product
+    return rate.tf32 / 3.0;
+  default:
+    break;
+  }
+
+  switch (element) {
+  case library::NumericTypeID::kF16:
+  case library::NumericTypeID::kBF16:
+    return rate.f16;
+  case library::NumericTypeID::kTF32:
+  case library::NumericTypeID::kF32:
+    return rate.tf32;
+  case library::NumericTypeID::kFE4M3:
+  case library::NumericTypeID::kFE5M2:
+    return rate.f8;
+  case library::NumericTypeID::kS8:
+  case library::NumericTypeID::kU8:
+    return rate.s8;
+  case library::NumericTypeID::kS4:
+  case library::NumericTypeID::kU4:
+    return rate.s4;
+  case library::NumericTypeID::kF64:
+    return rate.f64_tensor;
+  default:
+    return 0;
+  }
+}
+
+/// Returns a device attribute, or zero if it cannot be queried
+int device_attribute(cudaDeviceAttr attribute, int device) {
+  int value = 0;
+  if (cudaDeviceGetAttribute(&value, attribute, device) != cudaSuccess) {
+    return 0;
+  }
+  return value;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+double peak_math_throughput(
+  Options::Device const &device,
+  library::OperationDescription const &op_desc) {
+
+  SmMathRate const *rate = find_sm_math_rate(device.compute_capability(0));
+  if (!rate) {
+    return 0;
+  }
+
+  double flops_per_clock = sm_math_rate(*rate, op_desc);
+
+  // Sparse Tensor Core math skips the pruned half of A
+  if (op_desc.kind == library::OperationKind::kSparseGemm) {
+    flops_per_clock *= 2;
+  }
+
+  double clock_khz = device_attribute(cudaDevAttrClockRate, device.device_id(0));
+  double sm_count = device.properties.at(0).multiProcessorCount;
+
+  return flops_per_clock * sm_count * clock_khz / 1.0e6;
+}
+
+double peak_memory_bandwidth(Options::Device const &device) {
+
+  int device_id = device.device_id(0);
+
+  // Double data rate, in kHz, across a bus width in bits
+  double clock_khz = device_attribute(cudaDevAttrMemoryClockRate, device_id);
+  double bus_width = device_attribute(cudaDevAttrGlobalMemoryBusWidth, device_id);
+
+  return 2.0 * clock_khz * 1.0e3 * (bus_width / 8.0) / double(1 << 30);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
@@ -31,8 +31,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include <cuda_runtime.h>
 
+#include "cutlass/arch/kernel_timer.hpp"
+
 struct GPU_Clock
 {
   GPU_Clock() {
@@ -65,3 +69,40 @@ struct GPU_Clock
  private:
   cudaEvent_t start_, stop_;
 };
+
+// Measures kernel execution rather than stream time, from timestamps taken inside each CTA of
+// cutlass::device_kernel launches. Requires CUTLASS_ENABLE_KERNEL_TIMER; otherwise no launches
+// are recorded and the elapsed time is zero.
+struct GPU_KernelClock
+{
+  GPU_KernelClock() {
+    cutlass::arch::kernel_timer_setup();
+  }
+
+  void start() {
+    cutlass::arch::kernel_timer_setup();
+  }
+
+  // Sum of the execution times of the launches since start(). Concurrent launches each count
+  // their full duration.
+  float milliseconds() {
+    launches_ = cutlass::arch::kernel_timer_collect();
+    double time = 0;
+    for (auto const& launch : launches_) {
+      time += launch.milliseconds();
+    }
+    return float(time);
+  }
+
+  float seconds() {
+    return milliseconds() * float(1e-3);
+  }
+
+  // Per-launch start/end and SM residency gathered by the last call to milliseconds()
+  std::vector<cutlass::arch::KernelLaunchTiming> const& launches() const {
+    return launches_;
+  }
+
+ private:
+  std::vector<cutlass::arch::KernelLaunchTiming> launches_;
+};
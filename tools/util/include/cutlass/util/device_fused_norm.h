@@ -0,0 +1,347 @@
+/******************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+
+/**
+ * \file
+ * \brief Single-pass RMSNorm / LayerNorm with an optional fused residual add and quantized
+ * (FP8 / int8) output on a device memory tensor with RowMajor layout.
+ */
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/platform/platform.h"
+#include "cutlass/util/device_utils.h"
+
+#include <cfloat>
+#include <cstdint>
+#include <iostream>
+
+namespace cutlass {
+
+/// Arguments of fused_add_norm_stored_locally
+template <typename TOut, typename T>
+struct FusedNormParams {
+  TOut* output;             ///< [m, n] normalized (and quantized) output
+  float* token_scale;       ///< [m] per-token dequantization scales, or nullptr to use output_scale_inv
+  T* residual_out;          ///< [m, n] input + residual, or nullptr
+  const T* input;           ///< [m, n]
+  const T* residual;        ///< [m, n] added to the input before normalization, or nullptr
+  const T* gamma;           ///< [n]
+  const T* beta;            ///< [n], LayerNorm only
+  int m;
+  int n;
+  float epsilon;
+  float output_scale_inv;   ///< Static scale applied before conversion if token_scale is nullptr
+  float output_max;         ///< Largest finite value of TOut
+};
+
+/**
+ * One CTA normalizes one row in a single pass over global memory. The row is loaded with
+ * kVecSize-element (128-bit for 16-bit types) vectors and kept in registers across the
+ * reductions. If params.residual is given, the normalized row is input + residual rounded to T,
+ * exactly as if the sum were written out and read back, and it is stored to params.residual_out.
+ *
+ * With params.token_scale, each row is scaled so that its absolute maximum maps to the largest
+ * finite value of TOut and the dequantization scale amax / max(TOut) is written per row.
+ *
+ * grid(m)
+ * block(block_size) -- each thread holds kItemsPerThread vectors of the row
+ */
+template <typename TOut, typename T, int kVecSize, int kItemsPerThread, bool kLayerNorm>
+__global__ void fused_add_norm_stored_locally(FusedNormParams<TOut, T> params)
+{
+  using Vector = cutlass::AlignedArray<T, kVecSize>;
+  using OutputVector = cutlass::AlignedArray<TOut, kVecSize>;
+
+  const int tid = threadIdx.x;
+  const int bdimx = blockDim.x;
+  const int n = params.n;
+  const int n_vec = n / kVecSize;
+  const int64_t offset = static_cast<int64_t>(blockIdx.x) * n;
+
+  __shared__ float s_mean, s_variance, s_scale_inv;
+  float local_val[kItemsPerThread][kVecSize];
+  float local_sums[1] = {0.0f};
+
+  #pragma unroll
+  for (int i = 0; i < kItemsPerThread; i++) {
+    int index = tid + i * bdimx;
+    if (index < n_vec) {
+      Vector x = reinterpret_cast<const Vector *>(params.input + offset)[index];
+      if (params.residual) {
+        Vector r = reinterpret_cast<const Vector *>(params.residual + offset)[index];
+        #pragma unroll
+        for (int v = 0; v < kVecSize; v++) {
+          x[v] = T(static_cast<float>(x[v]) + static_cast<float>(r[v]));
+        }
+        if (params.residual_out) {
+          reinterpret_cast<Vector *>(params.residual_out + offset)[index] = x;
+        }
+      }
+      #pragma unroll
+      for (int v = 0; v < kVecSize; v++) {
+        local_val[i][v] = static_cast<float>(x[v]);
+        local_sums[0] += kLayerNorm ? local_val[i][v] : local_val[i][v] * local_val[i][v];
+      }
+    }
+    else {
+      #pragma unroll
+      for (int v = 0; v < kVecSize; v++) {
+        local_val[i][v] = 0.0f;
+      }
+    }
+  }
+
+  if (blockDim.x <= 32) {
+    warpReduceSum<float, 1>(local_sums);
+  }
+  else {
+    blockReduceSum<float, 1>(local_sums);
+  }
+  if (threadIdx.x == 0) {
+    if (kLayerNorm) {
+      s_mean = local_sums[0] / n;
+    }
+    else {
+      s_mean = 0.0f;
+      s_variance = rsqrtf(local_sums[0] / n + params.epsilon);
+    }
+  }
+  __syncthreads();
+
+  if (kLayerNorm) {
+    local_sums[0] = 0.0f;
+    #pragma unroll
+    for (int i = 0; i < kItemsPerThread; i++) {
+      if (tid + i * bdimx < n_vec) {
+        #pragma unroll
+        for (int v = 0; v < kVecSize; v++) {
+          const float tmp = local_val[i][v] - s_mean;
+          local_sums[0] += tmp * tmp;
+        }
+      }
+    }
+    if (blockDim.x <= 32) {
+      warpReduceSum<float, 1>(local_sums);
+    }
+    else {
+      blockReduceSum<float, 1>(local_sums);
+    }
+    if (threadIdx.x == 0) {
+      s_variance = rsqrtf(local_sums[0] / n + params.epsilon);
+    }
+    __syncthreads();
+  }
+
+  float local_max[1] = {0.0f};
+
+  #pragma unroll
+  for (int i = 0; i < kItemsPerThread; i++) {
+    int index = tid + i * bdimx;
+    if (index < n_vec) {
+      Vector gamma_val = reinterpret_cast<const Vector *>(params.gamma)[index];
+      Vector beta_val;
+      if (kLayerNorm) {
+        beta_val = reinterpret_cast<const Vector *>(params.beta)[index];
+      }
+      #pragma unroll
+      for (int v = 0; v < kVecSize; v++) {
+        float y = (local_val[i][v] - s_mean) * s_variance * static_cast<float>(gamma_val[v]);
+        if (kLayerNorm) {
+          y += static_cast<float>(beta_val[v]);
+        }
+        local_val[i][v] = y;
+        local_max[0] = fmaxf(local_max[0], fabsf(y));
+      }
+    }
+  }
+
+  if (params.token_scale) {
+    if (blockDim.x <= 32) {
+      warpReduceMax<float, 1>(local_max);
+    }
+    else {
+      blockReduceMax<float, 1>(local_max);
+    }
+    if (threadIdx.x == 0) {
+      const float scale = local_max[0] > 0.0f ? local_max[0] / params.output_max : 1.0f;
+      params.token_scale[blockIdx.x] = scale;
+      s_scale_inv = 1.0f / scale;
+    }
+  }
+  else if (threadIdx.x == 0) {
+    s_scale_inv = params.output_scale_inv;
+  }
+  __syncthreads();
+
+  NumericConverter<TOut, float> convert_op;
+
+  #pragma unroll
+  for (int i = 0; i < kItemsPerThread; i++) {
+    int index = tid + i * bdimx;
+    if (index < n_vec) {
+      OutputVector out;
+      #pragma unroll
+      for (int v = 0; v < kVecSize; v++) {
+        out[v] = convert_op(local_val[i][v] * s_scale_inv);
+      }
+      reinterpret_cast<OutputVector *>(params.output + offset)[index] = out;
+    }
+  }
+}
+
+namespace detail {
+
+/// Largest hidden size handled by fused_add_norm_stored_locally: at most 32 values are kept in
+/// registers per thread, with up to 1024 threads per row
+static constexpr int kFusedNormMaxRowSize = 32 * 1024;
+
+/// Picks the number of vectors per thread (a power of two) and launches the kernel
+template <typename TOut, typename T, int kVecSize, bool kLayerNorm, int kItemsPerThread = 1>
+void fused_add_norm_launch(FusedNormParams<TOut, T> const& params, int items_per_thread, cudaStream_t stream) {
+  if constexpr (kItemsPerThread * kVecSize < 32) {
+    if (kItemsPerThread < items_per_thread) {
+      fused_add_norm_launch<TOut, T, kVecSize, kLayerNorm, kItemsPerThread * 2>(params, items_per_thread, stream);
+      return;
+    }
+  }
+
+  const int n_vec = params.n / kVecSize;
+  dim3 grid(params.m);
+  dim3 block(((n_vec + kItemsPerThread - 1) / kItemsPerThread + 31) / 32 * 32);
+
+  fused_add_norm_stored_locally<TOut, T, kVecSize, kItemsPerThread, kLayerNorm><<<grid, block, 0, stream>>>(params);
+}
+
+template <typename TOut, typename T, int kVecSize, bool kLayerNorm>
+void fused_add_norm_dispatch(FusedNormParams<TOut, T> const& params, cudaStream_t stream) {
+  // Prefer CTAs of at most 512 threads and grow the per-thread register tile up to 32 values
+  const int n_vec = params.n / kVecSize;
+  int items_per_thread = 1;
+  while (items_per_thread * kVecSize < 32 && items_per_thread * 512 < n_vec) {
+    items_per_thread *= 2;
+  }
+  fused_add_norm_launch<TOut, T, kVecSize, kLayerNorm>(params, items_per_thread, stream);
+}
+
+template <typename T>
+bool is_aligned_pointer(T const* ptr, int alignment) {
+  return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+template <typename TOut, typename T, bool kLayerNorm>
+void fused_add_norm(FusedNormParams<TOut, T> params, cudaStream_t stream) {
+  if (params.n > kFusedNormMaxRowSize) {
+    std::cerr << "Fused normalization supports rows of up to " << kFusedNormMaxRowSize << " elements" << std::endl;
+    abort();
+  }
+
+  params.output_max = static_cast<float>(cutlass::platform::numeric_limits<TOut>::max());
+
+  // 128-bit accesses of the input, or narrower if the row or any pointer is misaligned
+  constexpr int kVecSize = 16 / int(sizeof(T));
+  bool vectorized = (params.n % kVecSize == 0) &&
+    is_aligned_pointer(params.input, 16) && is_aligned_pointer(params.gamma, 16) &&
+    (!params.residual || is_aligned_pointer(params.residual, 16)) &&
+    (!params.residual_out || is_aligned_pointer(params.residual_out, 16)) &&
+    (!kLayerNorm || is_aligned_pointer(params.beta, 16)) &&
+    is_aligned_pointer(params.output, kVecSize * int(sizeof(TOut)));
+
+  if (vectorized) {
+    fused_add_norm_dispatch<TOut, T, kVecSize, kLayerNorm>(params, stream);
+  }
+  else {
+    fused_add_norm_dispatch<TOut, T, 1, kLayerNorm>(params, stream);
+  }
+
+  auto result = cudaGetLastError();
+  if (result != cudaSuccess) {
+    std::cerr << "CUDA error: " << cudaGetErrorString(result) << std::endl;
+    abort();
+  }
+}
+
+} // namespace detail
+
+/// RMSNorm of (input + residual) in a single pass, optionally writing the sum to residual_out
+/// and quantizing the output, e.g. to FP8 or int8. With token_scale, per-row dequantization
+/// scales are computed from the row's absolute maximum; otherwise the normalized values are
+/// divided by output_scale before conversion.
+template <typename TOut, typename T>
+void rmsnorm_fused(cutlass::MatrixCoord tensor_size,
+                   TensorRef<TOut, layout::RowMajor> ref_output,
+                   TensorRef<T, layout::RowMajor> ref_input,
+                   TensorRef<T, layout::RowMajor> ref_weight,
+                   cudaStream_t stream,
+                   float epsilon = 1e-5f,
+                   T const* residual = nullptr,
+                   T* residual_out = nullptr,
+                   float* token_scale = nullptr,
+                   float output_scale = 1.0f) {
+  FusedNormParams<TOut, T> params{
+    ref_output.data(), token_scale, residual_out, ref_input.data(), residual,
+    ref_weight.data(), nullptr, tensor_size.row(), tensor_size.column(),
+    epsilon, 1.0f / output_scale, 0.0f};
+
+  detail::fused_add_norm<TOut, T, false>(params, stream);
+}
+
+/// LayerNorm of (input + residual) in a single pass, with the same residual and quantization
+/// options as rmsnorm_fused()
+template <typename TOut, typename T>
+void layernorm_fused(cutlass::MatrixCoord tensor_size,
+                     TensorRef<TOut, layout::RowMajor> ref_output,
+                     TensorRef<T, layout::RowMajor> ref_input,
+                     TensorRef<T, layout::RowMajor> ref_gamma,
+                     TensorRef<T, layout::RowMajor> ref_beta,
+                     cudaStream_t stream,
+                     float epsilon = 1e-5f,
+                     T const* residual = nullptr,
+                     T* residual_out = nullptr,
+                     float* token_scale = nullptr,
+                     float output_scale = 1.0f) {
+  FusedNormParams<TOut, T> params{
+    ref_output.data(), token_scale, residual_out, ref_input.data(), residual,
+    ref_gamma.data(), ref_beta.data(), tensor_size.row(), tensor_size.column(),
+    epsilon, 1.0f / output_scale, 0.0f};
+
+  detail::fused_add_norm<TOut, T, true>(params, stream);
+}
+
+} // namespace cutlass
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+
+#pragma once
+
+/**
+ * \file
+ * \brief cuda kernel to expand a grouped convolution filter into the block diagonal filter
+ *        consumed by SM90 multiple-group and depthwise implicit GEMM kernels.
+ *
+ * A grouped filter has layout [K, T, R, S, C/groups]. A multiple-group kernel tile covers
+ * groups_per_tile = TileN / (K/groups) consecutive groups, and reads one window of
+ * groups_per_tile * C/groups activation channels for the whole tile. The expanded filter has
+ * layout [K, T, R, S, groups_per_tile * C/groups]: output channel k keeps its weights at the
+ * position of its group within the tile's window, and holds zeros elsewhere.
+ */
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+
+namespace cutlass {
+
+template <typename T>
+__global__ void expand_grouped_conv_filter_kernel(T *output,
+                                                  const T *input,
+                                                  const int k,
+                                                  const int trs,
+                                                  const int group_c,
+                                                  const int group_k,
+                                                  const int groups_per_tile) {
+  const int expanded_c = groups_per_tile * group_c;
+  const int64_t total_elements = int64_t(k) * trs * expanded_c;
+
+  for (int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < total_elements;
+       idx += int64_t(blockDim.x) * gridDim.x) {
+    const int ci = int(idx % expanded_c);
+    const int64_t krs = idx / expanded_c;
+    const int ki = int(krs / trs);
+
+    // Position of output channel ki's group within its tile's channel window
+    const int group_in_tile = (ki / group_k) % groups_per_tile;
+    const int ci_group = ci - group_in_tile * group_c;
+
+    output[idx] = (ci_group >= 0 && ci_group < group_c) ? input[krs * group_c + ci_group] : T(0);
+  }
+}
+
+/** \brief expands a grouped conv filter [K, T, R, S, C/groups] into the block diagonal filter
+ *         [K, T, R, S, groups_per_tile * C/groups] of a multiple-group or depthwise kernel.
+ * \tparam T: data type
+ * \param k: number of output channels K
+ * \param trs: filter spatial extent T*R*S
+ * \param group_c: input channels per group C/groups
+ * \param groups: number of groups
+ * \param tile_n: N extent of the kernel's tile shape
+ */
+template <typename T>
+void expand_grouped_conv_filter(const T *input,
+                                T *output,
+                                int k,
+                                int trs,
+                                int group_c,
+                                int groups,
+                                int tile_n,
+                                cudaStream_t stream) {
+
+  const int group_k = k / groups;
+  assert(k % groups == 0 && tile_n % group_k == 0);
+  const int groups_per_tile = tile_n / group_k;
+
+  const int64_t total_elements = int64_t(k) * trs * groups_per_tile * group_c;
+  const int block = 256;
+  const int64_t blocks = (total_elements + block - 1) / block;
+  const int grid = int(blocks < 65536 ? blocks : 65536);
+  expand_grouped_conv_filter_kernel<<<grid, block, 0, stream>>>(
+    output, input, k, trs, group_c, group_k, groups_per_tile);
+}
+
+/// Returns the number of elements of the expanded filter written by expand_grouped_conv_filter()
+inline size_t expanded_grouped_conv_filter_size(int k, int trs, int group_c, int groups, int tile_n) {
+  const int group_k = k / groups;
+  return size_t(k) * trs * (tile_n / group_k) * group_c;
+}
+
+} //namespace cutlass
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+/**
+ * \file
+ * \brief cuda kernel which permutes, pads and converts a tensor in device memory in a single pass.
+ *
+ * Source and destination are described by CuTe layouts of the same rank. Mode i of both layouts
+ * is the same logical dimension, and the destination may be larger in any mode (padding). Each
+ * destination element is
+ *
+ *   dst(crd) = convert(scale * src(crd))   if crd is within the source shape
+ *   dst(crd) = pad_value                   otherwise
+ *
+ * so layout conversions (NCHW <-> NHWC, interleaved, padded channels) and quantization
+ * (e.g. FP16 -> FP8/int8 with a scale) happen in a single read and write of the tensor.
+ *
+ * Example: NCHW half_t to NHWC int8_t with C padded to 8.
+ *
+ *   auto src = make_layout(make_shape(C, W, H, N), make_stride(H * W, 1, W, C * H * W));
+ *   auto dst = make_layout(make_shape(8, W, H, N));                       // compact, C fastest
+ *   cutlass::layout_convert(src_ptr, src, dst_ptr, dst, 1.0f / amax * 127.0f);
+ *
+ * Example: row-major matrix to ColumnMajorInterleaved<32>, with logical modes (row, column).
+ *
+ *   auto src = make_layout(make_shape(M, K), make_stride(K, 1));
+ *   auto dst = make_layout(make_shape(M, make_shape(_32{}, K / 32)),
+ *                          make_stride(_32{}, make_stride(_1{}, 32 * M)));
+ *
+ * The destination is traversed in colexicographic order of its shape. When the first leaf of the
+ * destination layout has unit stride, each thread writes 16 bytes at a time, so order the modes
+ * (or their sublayouts) with the destination's contiguous dimension first.
+ */
+
+#include <algorithm>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/layout.hpp"
+
+namespace cutlass {
+
+template <
+  typename SrcT,
+  typename DstT,
+  typename SrcLayout,
+  typename DstLayout,
+  int kVectorLength
+>
+__global__ void layout_convert_kernel(SrcT const *src,
+                                      SrcLayout src_layout,
+                                      DstT *dst,
+                                      DstLayout dst_layout,
+                                      float scale,
+                                      DstT pad_value,
+                                      int64_t vector_count) {
+
+  using Vector = AlignedArray<DstT, kVectorLength, kVectorLength * sizeof(DstT)>;
+
+  NumericConverter<float, SrcT> convert_input;
+  NumericConverter<DstT, float> convert_output;
+
+  auto dst_extent = cute::product_each(cute::shape(dst_layout));
+  auto src_extent = cute::product_each(cute::shape(src_layout));
+
+  for (int64_t v = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+       v < vector_count;
+       v += int64_t(gridDim.x) * blockDim.x) {
+
+    int64_t idx = v * kVectorLength;
+
+    Vector frag;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kVectorLength; ++i) {
+      auto crd = cute::idx2crd(idx + i, dst_extent);
+
+      if (cute::elem_less(crd, src_extent)) {
+        frag[i] = convert_output(scale * convert_input(src[src_layout(crd)]));
+      }
+      else {
+        frag[i] = pad_value;
+      }
+    }
+
+    *reinterpret_cast<Vector *>(dst + dst_layout(idx)) = frag;
+  }
+}
+
+/** \brief Permutes, pads and converts a device memory tensor in one pass
+ * \tparam SrcT: source data type
+ * \tparam DstT: destination data type
+ * \param src_layout: CuTe layout of the source, one top-level mode per logical dimension
+ * \param dst_layout: CuTe layout of the destination, same rank and at least the source extents
+ * \param scale: factor applied in fp32 before conversion to DstT
+ * \param pad_value: value written to destination elements outside the source extents
+ */
+template <typename SrcT, typename DstT, typename SrcLayout, typename DstLayout>
+void layout_convert(SrcT const *src,
+                    SrcLayout const &src_layout,
+                    DstT *dst,
+                    DstLayout const &dst_layout,
+                    float scale = 1.0f,
+                    DstT pad_value = DstT(0),
+                    cudaStream_t stream = nullptr) {
+
+  static_assert(decltype(cute::rank(src_layout))::value == decltype(cute::rank(dst_layout))::value,
+    "Source and destination layouts must have the same rank.");
+  static_assert(sizeof_bits<DstT>::value % 8 == 0, "Sub-byte destination types are not supported.");
+
+  static constexpr int kVectorLength = (sizeof(DstT) < 16 ? int(16 / sizeof(DstT)) : 1);
+
+  int64_t total = int64_t(cute::size(dst_layout));
+  if (total == 0) {
+    return;
+  }
+
+  // Vector stores require a unit-stride first leaf whose extent is a multiple of the vector length
+  // and every other stride to be a multiple of the vector length.
+  auto dst_flat = cute::flatten(dst_layout);
+  bool vectorize = (kVectorLength > 1) &&
+    (reinterpret_cast<uintptr_t>(dst) % 16 == 0) &&
+    int64_t(cute::stride<0>(dst_flat)) == 1 &&
+    int64_t(cute::shape<0>(dst_flat)) % kVectorLength == 0;
+
+  int leaf = 0;
+  cute::for_each(cute::stride(dst_flat), [&](auto stride) {
+    if (leaf++ > 0) {
+      vectorize = vectorize && (int64_t(stride) % kVectorLength == 0);
+    }
+  });
+
+  int const kThreads = 256;
+  auto grid_size = [&](int64_t vector_count) {
+    return dim3(unsigned((std::min)(int64_t(1) << 16, (vector_count + kThreads - 1) / kThreads)));
+  };
+
+  if (vectorize) {
+    int64_t vector_count = total / kVectorLength;
+    layout_convert_kernel<SrcT, DstT, SrcLayout, DstLayout, kVectorLength>
+      <<<grid_size(vector_count), kThreads, 0, stream>>>(
+        src, src_layout, dst, dst_layout, scale, pad_value, vector_count);
+  }
+  else {
+    layout_convert_kernel<SrcT, DstT, SrcLayout, DstLayout, 1>
+      <<<grid_size(total), kThreads, 0, stream>>>(
+        src, src_layout, dst, dst_layout, scale, pad_value, total);
+  }
+}
+
+} //namespace cutlass
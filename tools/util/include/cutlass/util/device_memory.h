@@ -38,6 +38,7 @@
 
 #include <memory>
 #include <sstream>
+#include <type_traits>
 
 #include "cutlass/platform/platform.h"
 #include "cutlass/numeric_types.h"
@@ -92,6 +93,75 @@ void free(T* ptr) {
   }
 }
 
+/// Policy for host-side allocations
+enum class HostAllocationPolicy {
+  kPageable,      ///< ordinary pageable memory (operator new)
+  kPinned         ///< page-locked memory from cudaHostAlloc()
+};
+
+/// Standard allocator for host memory which may be pageable or pinned. Pinned memory enables
+/// truly asynchronous host-device copies at full interconnect bandwidth.
+template <typename T>
+class host_allocator {
+public:
+
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  HostAllocationPolicy policy;
+
+  host_allocator(HostAllocationPolicy policy_ = HostAllocationPolicy::kPageable): policy(policy_) { }
+
+  template <typename U>
+  host_allocator(host_allocator<U> const &other): policy(other.policy) { }
+
+  T* allocate(size_t count) {
+    if (policy == HostAllocationPolicy::kPageable) {
+      return std::allocator<T>().allocate(count);
+    }
+
+    T* ptr = nullptr;
+    size_t bytes = count * sizeof(T);
+
+    cudaError_t cuda_error = cudaHostAlloc((void**)&ptr, bytes, cudaHostAllocDefault);
+
+    if (cuda_error != cudaSuccess) {
+#if (CUTLASS_DEBUG_TRACE_LEVEL > 0)
+      std::ostringstream os;
+      os << "cutlass::device_memory::host_allocator: cudaHostAlloc failed: bytes=" << bytes;
+      CUTLASS_TRACE_HOST(os.str());
+#endif
+      throw cuda_exception("Failed to allocate pinned host memory", cuda_error);
+    }
+
+    return ptr;
+  }
+
+  void deallocate(T* ptr, size_t count) {
+    if (policy == HostAllocationPolicy::kPageable) {
+      std::allocator<T>().deallocate(ptr, count);
+    }
+    else if (ptr) {
+      cudaError_t cuda_error = cudaFreeHost(ptr);
+      if (cuda_error != cudaSuccess) {
+        throw cuda_exception("Failed to free pinned host memory", cuda_error);
+      }
+    }
+  }
+
+  template <typename U>
+  bool operator==(host_allocator<U> const &rhs) const {
+    return policy == rhs.policy;
+  }
+
+  template <typename U>
+  bool operator!=(host_allocator<U> const &rhs) const {
+    return policy != rhs.policy;
+  }
+};
+
 /******************************************************************************
  * Data movement
  ******************************************************************************/
@@ -132,6 +202,26 @@ void copy(T* dst, T const* src, size_t count, cudaMemcpyKind kind) {
   }
 }
 
+/// Enqueues a copy on \p stream. The copy overlaps with host execution and other streams only if
+/// host memory is pinned; otherwise CUDA stages it synchronously.
+template <typename T>
+void copy_async(T* dst, T const* src, size_t count, cudaMemcpyKind kind, cudaStream_t stream) {
+  size_t bytes = count * sizeof_bits<T>::value / 8;
+  if (bytes == 0 && count > 0) {
+    bytes = 1;
+  }
+  cudaError_t cuda_error = (cudaMemcpyAsync(dst, src, bytes, kind, stream));
+  if (cuda_error != cudaSuccess) {
+    std::ostringstream os;
+    os << "cutlass::device_memory::copy_async: cudaMemcpyAsync() failed: "
+       << "dst=" << dst << ", src=" << src
+       << ", bytes=" << bytes << ", count=" << count
+       << ", error: " << cudaGetErrorString(cuda_error);
+
+    throw cuda_exception(os.str().c_str(), cuda_error);
+  }
+}
+
 template <typename T>
 void copy_to_device(T* dst, T const* src, size_t count = 1) {
   copy(dst, src, count, cudaMemcpyHostToDevice);
@@ -152,6 +242,16 @@ void copy_host_to_host(T* dst, T const* src, size_t count = 1) {
   copy(dst, src, count, cudaMemcpyHostToHost);
 }
 
+template <typename T>
+void copy_to_device_async(T* dst, T const* src, size_t count, cudaStream_t stream) {
+  copy_async(dst, src, count, cudaMemcpyHostToDevice, stream);
+}
+
+template <typename T>
+void copy_to_host_async(T* dst, T const* src, size_t count, cudaStream_t stream) {
+  copy_async(dst, src, count, cudaMemcpyDeviceToHost, stream);
+}
+
 /// Copies elements from device memory to host-side range
 template <typename OutputIterator, typename T>
 void insert_to_host(OutputIterator begin, OutputIterator end, T const* device_begin) {
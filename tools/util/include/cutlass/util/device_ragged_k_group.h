@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+/**
+ * \file
+ * \brief cuda kernel to build the per-group arguments of a ragged-K grouped GEMM, e.g. the expert
+ *        weight gradients dW_e = X_e^T * dY_e of a MoE layer.
+ *
+ * The tokens of all groups are stored contiguously: X is a row-major [tokens, M] and dY a row-major
+ * [tokens, N] tensor, and group g owns rows [offsets[g], offsets[g+1]). Every group computes an
+ * M x N output from K = offsets[g+1] - offsets[g] tokens, with
+ *
+ *   A_g = X + offsets[g] * M    (M x K, M-major, i.e. cutlass::layout::ColumnMajor)
+ *   B_g = dY + offsets[g] * N   (N x K, N-major, i.e. cutlass::layout::RowMajor)
+ *   C_g = C + g * M * N, D_g = D + g * M * N
+ *
+ * The arguments are written into a cutlass::gemm::GroupedGemmPackedArguments buffer on device,
+ * so the offsets never need to be copied to the host. Each thread writes one group, so every
+ * field of the struct-of-arrays buffer is written with coalesced stores.
+ */
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/util/packed_stride.hpp"
+
+namespace cutlass {
+
+template <typename PackedArguments, typename OffsetT>
+__global__ void make_ragged_k_group_arguments_kernel(PackedArguments packed,
+                                                     const OffsetT *offsets,
+                                                     const typename PackedArguments::ElementA *ptr_X,
+                                                     const typename PackedArguments::ElementB *ptr_dY,
+                                                     const typename PackedArguments::ElementC *ptr_C,
+                                                     typename PackedArguments::ElementD *ptr_D,
+                                                     const int m,
+                                                     const int n,
+                                                     const int groups) {
+  using UnderlyingProblemShape = typename PackedArguments::UnderlyingProblemShape;
+
+  for (int g = blockIdx.x * blockDim.x + threadIdx.x; g < groups; g += blockDim.x * gridDim.x) {
+    const int64_t token_begin = int64_t(offsets[g]);
+    const int k = int(int64_t(offsets[g + 1]) - token_begin);
+    const int64_t output_offset = int64_t(g) * m * n;
+
+    packed.problem_shapes[g] = UnderlyingProblemShape{m, n, k};
+    packed.ptr_A[g] = ptr_X + token_begin * m;
+    packed.ptr_B[g] = ptr_dY + token_begin * n;
+    packed.ptr_C[g] = ptr_C != nullptr ? ptr_C + output_offset : nullptr;
+    packed.ptr_D[g] = ptr_D + output_offset;
+    packed.dA[g] = make_cute_packed_stride(typename PackedArguments::StrideA{}, {m, k, 1});
+    packed.dB[g] = make_cute_packed_stride(typename PackedArguments::StrideB{}, {n, k, 1});
+    packed.dC[g] = make_cute_packed_stride(typename PackedArguments::StrideC{}, {m, n, 1});
+    packed.dD[g] = make_cute_packed_stride(typename PackedArguments::StrideD{}, {m, n, 1});
+  }
+}
+
+/** \brief writes the problem shapes, pointers and strides of a ragged-K grouped GEMM into a packed
+ *         device buffer. Pass packed.problem_shapes as the device problem shapes (without host
+ *         problem shapes), and m and n as the ragged_k_m and ragged_k_n arguments of the grouped
+ *         stream-K scheduler to balance the uneven K extents across SMs.
+ * \tparam PackedArguments: cutlass::gemm::GroupedGemmPackedArguments of the grouped kernel
+ * \param packed: view of the device buffer (PackedArguments::make_view)
+ * \param offsets: device array of groups + 1 token offsets, offsets[0] = 0
+ * \param ptr_X: [tokens, M] row-major
+ * \param ptr_dY: [tokens, N] row-major
+ * \param ptr_C: [groups, M, N] source, or nullptr
+ * \param ptr_D: [groups, M, N] output
+ */
+template <typename PackedArguments, typename OffsetT>
+void make_ragged_k_group_arguments(PackedArguments packed,
+                                   const OffsetT *offsets,
+                                   const typename PackedArguments::ElementA *ptr_X,
+                                   const typename PackedArguments::ElementB *ptr_dY,
+                                   const typename PackedArguments::ElementC *ptr_C,
+                                   typename PackedArguments::ElementD *ptr_D,
+                                   int m,
+                                   int n,
+                                   int groups,
+                                   cudaStream_t stream) {
+
+  const int block = 128;
+  const int grid = (groups + block - 1) / block;
+  make_ragged_k_group_arguments_kernel<<<grid, block, 0, stream>>>(
+    packed, offsets, ptr_X, ptr_dY, ptr_C, ptr_D, m, n, groups);
+}
+
+} //namespace cutlass
@@ -183,4 +183,54 @@ void rmsnorm(cutlass::MatrixCoord tensor_size,
   }
 }
 
+/// Applies RMSNorm with a precomputed per-row sum of squares, e.g. produced by the
+/// LinCombPerRowSumSquares epilogue of the GEMM that wrote the input.
+/// The input is only read once and the rows need no reduction, so every thread handles
+/// independent elements. The output may be narrower than the input (e.g. FP8), in which case
+/// the normalized values are multiplied by output_scale_inv before conversion.
+template<typename TOut, typename T>
+__global__ void rmsnorm_apply_sum_squares(TOut* output,
+                                          const T* input,
+                                          const T* weight,
+                                          const float* sum_squares,
+                                          const int m, const int n,
+                                          float epsilon,
+                                          float output_scale_inv)
+{
+  const int64_t size = static_cast<int64_t>(m) * n;
+  for (int64_t index = blockIdx.x * static_cast<int64_t>(blockDim.x) + threadIdx.x;
+       index < size; index += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+    const int m_idx = static_cast<int>(index / n);
+    const int n_idx = static_cast<int>(index - static_cast<int64_t>(m_idx) * n);
+    const float s_mean = rsqrtf(sum_squares[m_idx] / n + epsilon);
+    const float local_val = static_cast<float>(input[index]);
+    const float weight_val = static_cast<float>(weight[n_idx]);
+    output[index] = TOut(local_val * s_mean * weight_val * output_scale_inv);
+  }
+}
+
+template <typename TOut, typename T>
+void rmsnorm_from_sum_squares(cutlass::MatrixCoord tensor_size,
+                              TensorRef<TOut, layout::RowMajor> ref_output,
+                              TensorRef<T, layout::RowMajor> ref_input,
+                              TensorRef<T, layout::RowMajor> ref_weight,
+                              const float* sum_squares,
+                              cudaStream_t stream, float epsilon = 1e-5f,
+                              float output_scale = 1.0f){
+  const int m = tensor_size.row();
+  const int n = tensor_size.column();
+  const int64_t size = static_cast<int64_t>(m) * n;
+  dim3 block(256);
+  dim3 grid(static_cast<unsigned>(cutlass::platform::min<int64_t>(65535, (size + 255) / 256)));
+
+  rmsnorm_apply_sum_squares<<<grid, block, 0, stream>>>(
+      ref_output.data(), ref_input.data(), ref_weight.data(), sum_squares, m, n, epsilon, 1.0f / output_scale);
+
+  auto result = cudaGetLastError();
+  if (result != cudaSuccess) {
+    std::cerr << "CUDA error: " << cudaGetErrorString(result) << std::endl;
+    abort();
+  }
+}
+
 } // namespace cutlass
@@ -37,6 +37,9 @@
   host memory synchronize device memory automatically. Explicit copy operations provide abstractions
   for CUDA memcpy operations.
 
+  Host memory may be pinned (HostAllocationPolicy::kPinned), in which case sync_{host, device}_async()
+  overlap with host execution and kernels running on other streams.
+
   Call {host, device}_{data, ref, view}() for accessing host or device memory.
 
   See cutlass/tensor_ref.h and cutlass/tensor_view.h for more details.
@@ -104,6 +107,9 @@ public:
   /// Constant reference to element in tensor
   using ConstReference = typename ConstTensorRef::Reference;
 
+  /// Policy for the host-side allocation (pageable or pinned)
+  using HostAllocationPolicy = device_memory::HostAllocationPolicy;
+
 private:
   using StorageUnit = typename platform::conditional_t<std::is_same_v<Element, bool>, uint8_t,            // Avoid the std::vector<bool> specialization
                                   typename platform::conditional_t<sizeof_bits<Element>::value % 8 == 0,  // Handle subbyte types
@@ -114,6 +120,9 @@ private:
   static constexpr int kContainerTypeNumBytes = StorageContainerCalculator::kContainerTypeNumBytes;
   static constexpr int kContainerTypeNumStorageUnit = StorageContainerCalculator::kContainerTypeNumStorageUnit;
 
+  using HostAllocator = device_memory::host_allocator<StorageUnit>;
+  using HostStorage = std::vector<StorageUnit, HostAllocator>;
+
   //
   // Data members
   //
@@ -125,7 +134,10 @@ private:
   Layout layout_;
 
   /// Host-side memory allocation
-  std::vector<StorageUnit> host_;
+  HostStorage host_;
+
+  /// Whether host memory is pageable or pinned
+  HostAllocationPolicy host_policy_ = HostAllocationPolicy::kPageable;
 
   /// Device-side memory
   device_memory::allocation<StorageUnit> device_;
@@ -146,8 +158,9 @@ public:
   /// Constructs a tensor given an extent. Assumes a packed layout
   HostTensor(
     TensorCoord const &extent,
-    bool device_backed = true
-  ) {
+    bool device_backed = true,
+    HostAllocationPolicy host_policy = HostAllocationPolicy::kPageable
+  ): host_policy_(host_policy) {
 
     this->reset(extent, Layout::packed(extent), device_backed);
   }
@@ -156,8 +169,9 @@ public:
   HostTensor(
     TensorCoord const &extent,
     Layout const &layout,
-    bool device_backed = true
-  ) {
+    bool device_backed = true,
+    HostAllocationPolicy host_policy = HostAllocationPolicy::kPageable
+  ): host_policy_(host_policy) {
 
     this->reset(extent, layout, device_backed);
   }
@@ -182,7 +196,13 @@ public:
 #endif
 
     device_.reset();
-    host_.clear();
+
+    if (host_.get_allocator().policy != host_policy_) {
+      host_ = HostStorage(HostAllocator(host_policy_));
+    }
+    else {
+      host_.clear();
+    }
 
     size_t count_container = count_to_container_storage_unit_count(count);
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
@@ -250,6 +270,30 @@ public:
     resize(extent, Layout::packed(extent), device_backed_);
   }
 
+  /// Returns the policy used for host memory
+  HostAllocationPolicy host_allocation_policy() const {
+    return host_policy_;
+  }
+
+  /// Returns true if host memory is pinned
+  bool host_pinned() const {
+    return host_policy_ == HostAllocationPolicy::kPinned;
+  }
+
+  /// Changes the policy used for host memory. An existing host allocation is moved to the
+  /// new kind of memory, preserving its contents.
+  void set_host_allocation_policy(HostAllocationPolicy host_policy) {
+    if (host_policy == host_policy_) {
+      return;
+    }
+    host_policy_ = host_policy;
+
+    if (host_.get_allocator().policy != host_policy_) {
+      HostStorage host(host_.begin(), host_.end(), HostAllocator(host_policy_));
+      host_ = std::move(host);
+    }
+  }
+
   /// Returns the logical number of elements stored in the host tensor
   size_t size() const {
     return layout_.capacity(extent_);
@@ -407,6 +451,26 @@ public:
     }
   }
 
+  /// Enqueues a copy from device to host on the given stream. The copy is asynchronous with
+  /// respect to the host only if host memory is pinned. Host data may not be accessed until the
+  /// stream is synchronized.
+  void sync_host_async(cudaStream_t stream) {
+    if (device_backed()) {
+      device_memory::copy_to_host_async(
+          host_.data(), device_.get(), device_.size(), stream);
+    }
+  }
+
+  /// Enqueues a copy from host to device on the given stream. The copy is asynchronous with
+  /// respect to the host only if host memory is pinned. Host data must not be modified until the
+  /// copy has completed.
+  void sync_device_async(cudaStream_t stream) {
+    if (device_backed()) {
+      device_memory::copy_to_device_async(
+          device_.get(), host_.data(), host_.size(), stream);
+    }
+  }
+
   /// Copy data from a caller-supplied device pointer into host memory.
   void copy_in_device_to_host(
     Element const* ptr_device,        ///< source device memory
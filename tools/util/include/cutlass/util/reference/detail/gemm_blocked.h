@@ -0,0 +1,137 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Cache-blocked, multithreaded inner loop shared by the host reference GEMMs.
+*/
+#pragma once
+
+#include <algorithm>
+
+#include "cutlass/cutlass.h"
+
+namespace cutlass {
+namespace reference {
+namespace detail {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Computes D(row, col) = store(sum_k A(row, k) * B(k, col)) on the host.
+///
+/// Output tiles are distributed across OpenMP threads when compiled with OpenMP. Within a tile,
+/// panels of A and B are converted to ComputeType once and packed contiguously, so the innermost
+/// loop runs over contiguous accumulators. Each output element is still accumulated by a single
+/// thread in increasing k order starting from initial_accum, so results are identical to the
+/// unblocked loop for any InnerProductOp.
+///
+///   load_a(row, k)  returns A(row, k) converted to ComputeType
+///   load_b(k, col)  returns B(k, col) converted to ComputeType
+///   store(row, col, accum)  applies the epilogue to one accumulator
+///
+template <
+  typename ComputeType,
+  typename InnerProductOp,
+  typename LoadA,
+  typename LoadB,
+  typename Store
+>
+void gemm_blocked_host(
+  int M,
+  int N,
+  int K,
+  ComputeType initial_accum,
+  LoadA const &load_a,
+  LoadB const &load_b,
+  Store const &store) {
+
+  static int constexpr kBlockM = 32;
+  static int constexpr kBlockN = 32;
+  static int constexpr kBlockK = 64;
+
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(2) schedule(dynamic)
+#endif
+  for (int row_block = 0; row_block < M; row_block += kBlockM) {
+    for (int col_block = 0; col_block < N; col_block += kBlockN) {
+
+      InnerProductOp inner_product_op;
+
+      int const rows = std::min(kBlockM, M - row_block);
+      int const cols = std::min(kBlockN, N - col_block);
+
+      ComputeType accum[kBlockM][kBlockN];
+      ComputeType packed_a[kBlockM][kBlockK];
+      ComputeType packed_b[kBlockK][kBlockN];
+
+      for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+          accum[i][j] = initial_accum;
+        }
+      }
+
+      for (int k_block = 0; k_block < K; k_block += kBlockK) {
+        int const depth = std::min(kBlockK, K - k_block);
+
+        for (int i = 0; i < rows; ++i) {
+          for (int k = 0; k < depth; ++k) {
+            packed_a[i][k] = load_a(row_block + i, k_block + k);
+          }
+        }
+
+        for (int k = 0; k < depth; ++k) {
+          for (int j = 0; j < cols; ++j) {
+            packed_b[k][j] = load_b(k_block + k, col_block + j);
+          }
+        }
+
+        for (int k = 0; k < depth; ++k) {
+          for (int i = 0; i < rows; ++i) {
+            ComputeType const a_ik = packed_a[i][k];
+            for (int j = 0; j < cols; ++j) {
+              accum[i][j] = inner_product_op(a_ik, packed_b[k][j], accum[i][j]);
+            }
+          }
+        }
+      }
+
+      for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+          store(row_block + i, col_block + j, accum[i][j]);
+        }
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace detail
+} // namespace reference
+} // namespace cutlass
@@ -0,0 +1,274 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Counter-based (Philox4x32-10) random number generation shared by the host and device
+      block fills.
+
+    Every element is a pure function of (seed, element index), so host and device fills produce
+    identical data for the same seed, independently of the launch configuration or thread count.
+*/
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/distribution.h"
+
+namespace cutlass {
+namespace reference {
+namespace detail {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Philox4x32-10 block function (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3").
+/// Replaces the counter with four random 32-bit words.
+CUTLASS_HOST_DEVICE
+void philox4x32_10(uint32_t (&ctr)[4], uint32_t key0, uint32_t key1) {
+
+  uint32_t const kMultiplier0 = 0xD2511F53u;
+  uint32_t const kMultiplier1 = 0xCD9E8D57u;
+  uint32_t const kWeyl0 = 0x9E3779B9u;
+  uint32_t const kWeyl1 = 0xBB67AE85u;
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int round = 0; round < 10; ++round) {
+    uint64_t product0 = uint64_t(kMultiplier0) * ctr[0];
+    uint64_t product1 = uint64_t(kMultiplier1) * ctr[2];
+
+    uint32_t next0 = uint32_t(product1 >> 32) ^ ctr[1] ^ key0;
+    uint32_t next1 = uint32_t(product1);
+    uint32_t next2 = uint32_t(product0 >> 32) ^ ctr[3] ^ key1;
+    uint32_t next3 = uint32_t(product0);
+
+    ctr[0] = next0;
+    ctr[1] = next1;
+    ctr[2] = next2;
+    ctr[3] = next3;
+
+    key0 += kWeyl0;
+    key1 += kWeyl1;
+  }
+}
+
+/// Uniform random float in [0, 1) from the upper 24 bits of a word
+CUTLASS_HOST_DEVICE
+float philox_uniform_float(uint32_t word) {
+  return float(word >> 8) * (1.0f / 16777216.0f);
+}
+
+/// Uniform random double in [0, 1) from the upper 53 bits of two words
+CUTLASS_HOST_DEVICE
+double philox_uniform_double(uint32_t word0, uint32_t word1) {
+  return double(((uint64_t(word0) << 32) | word1) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Generates random elements with a uniform or Gaussian distribution in vectors of 128 bits.
+///
+/// Element i draws its value from Philox block i / kElementsPerBlock of stream 0 and, if NaNs or
+/// zeros are injected, its Bernoulli trial from the same block of stream 1. Values are rounded as
+/// in the curand-based fills: optionally truncated to int_scale fractional bits, then converted.
+template <typename Element>
+struct RandomPhiloxFunc {
+
+  using FloatType = typename std::conditional<(sizeof(Element) > 4), double, float>::type;
+  using IntType = typename std::conditional<(sizeof(Element) > 4), int64_t, int>::type;
+
+  /// Elements generated from one Philox block of four words
+  static int const kElementsPerBlock = (sizeof(FloatType) == 8 ? 2 : 4);
+
+  /// Elements per 128-bit vector
+  static int const kElementsPerVector = 128 / sizeof_bits<Element>::value;
+
+  static_assert(kElementsPerVector % kElementsPerBlock == 0,
+    "A vector must hold a whole number of Philox blocks.");
+
+  using Vector = AlignedArray<Element, kElementsPerVector, 16>;
+
+  /// Parameters structure
+  struct Params {
+
+    uint64_t seed;
+    bool gaussian;
+    FloatType offset;           ///< Uniform: max, Gaussian: mean
+    FloatType scale;            ///< Uniform: -(max - min), Gaussian: stddev
+    int int_scale;
+    FloatType float_scale_up;
+    FloatType float_scale_down;
+    float pnan;                 ///< Uniform: probability of a NaN
+    float pzero;                ///< Gaussian: probability of a zero (1 - pnz)
+
+    /// Default ctor
+    CUTLASS_HOST_DEVICE
+    Params() { }
+
+    /// Constructs from a uniform or Gaussian distribution
+    Params(uint64_t seed_, Distribution const &dist):
+      seed(seed_),
+      gaussian(dist.kind == Distribution::Gaussian),
+      int_scale(dist.int_scale),
+      pnan(0),
+      pzero(0) {
+
+      if (gaussian) {
+        offset = static_cast<FloatType>(dist.gaussian.mean);
+        scale = static_cast<FloatType>(dist.gaussian.stddev);
+        pzero = float(1.0 - dist.gaussian.pnz);
+      }
+      else {
+        offset = static_cast<FloatType>(dist.uniform.max);
+        scale = -(static_cast<FloatType>(dist.uniform.max) - static_cast<FloatType>(dist.uniform.min));
+        pnan = float(dist.uniform.pnan);
+      }
+
+      float_scale_up = FloatType(IntType(1) << (int_scale > 0 ? int_scale : 0));
+      float_scale_down = FloatType(1) / float_scale_up;
+    }
+  };
+
+  //
+  // Data members
+  //
+
+  Params params;
+
+  //
+  // Methods
+  //
+
+  CUTLASS_HOST_DEVICE
+  RandomPhiloxFunc(Params const &params): params(params) { }
+
+  /// Draws the random words of one block
+  CUTLASS_HOST_DEVICE
+  void block_words(uint32_t (&words)[4], uint64_t block, uint32_t stream) const {
+    words[0] = uint32_t(block);
+    words[1] = uint32_t(block >> 32);
+    words[2] = stream;
+    words[3] = 0;
+    philox4x32_10(words, uint32_t(params.seed), uint32_t(params.seed >> 32));
+  }
+
+  /// Draws kElementsPerBlock standard uniform or Gaussian values
+  CUTLASS_HOST_DEVICE
+  void block_values(FloatType (&values)[kElementsPerBlock], uint64_t block) const {
+
+    uint32_t words[4];
+    block_words(words, block, 0);
+
+    FloatType uniform[kElementsPerBlock];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kElementsPerBlock; ++i) {
+      if constexpr (kElementsPerBlock == 2) {
+        uniform[i] = FloatType(philox_uniform_double(words[2 * i], words[2 * i + 1]));
+      }
+      else {
+        uniform[i] = FloatType(philox_uniform_float(words[i]));
+      }
+    }
+
+    if (params.gaussian) {
+      // Box-Muller transform of each pair of uniform values
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kElementsPerBlock; i += 2) {
+        FloatType radius = std::sqrt(FloatType(-2) * std::log(FloatType(1) - uniform[i]));
+        FloatType theta = FloatType(6.283185307179586) * uniform[i + 1];
+        values[i] = radius * std::cos(theta);
+        values[i + 1] = radius * std::sin(theta);
+      }
+    }
+    else {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kElementsPerBlock; ++i) {
+        values[i] = uniform[i];
+      }
+    }
+  }
+
+  /// Computes the vector of elements starting at element index `first`
+  CUTLASS_HOST_DEVICE
+  void operator()(Vector &frag, uint64_t first) const {
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int b = 0; b < kElementsPerVector / kElementsPerBlock; ++b) {
+
+      uint64_t block = first / kElementsPerBlock + b;
+
+      FloatType values[kElementsPerBlock];
+      block_values(values, block);
+
+      uint32_t trials[4] = {0, 0, 0, 0};
+      float const probability = (params.gaussian ? params.pzero : params.pnan);
+      if (probability > 0) {
+        block_words(trials, block, 1);
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kElementsPerBlock; ++i) {
+
+        FloatType rnd = params.offset + params.scale * values[i];
+
+        Element result;
+        if (params.int_scale >= 0) {
+          rnd = FloatType(std::llround(rnd * params.float_scale_up));
+          result = Element(rnd * params.float_scale_down);
+        }
+        else {
+          result = Element(rnd);
+        }
+
+        if (probability > 0 && philox_uniform_float(trials[i]) < probability) {
+          if (params.gaussian) {
+            result = Element(0);
+          }
+          else if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
+            result = Element(NAN);
+          }
+        }
+
+        frag[b * kElementsPerBlock + i] = result;
+      }
+    }
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace detail
+} // namespace reference
+} // namespace cutlass
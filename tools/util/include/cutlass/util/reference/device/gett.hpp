@@ -35,6 +35,13 @@
 
 #include <cute/tensor.hpp>
 
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/platform/platform.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/host/gett.hpp"
+
 namespace cutlass::reference::device {
 
 template <
@@ -143,4 +150,399 @@ gett(
   gett_kernel<<< dimGrid, dimBlock, 0, stream >>>(D, A, B, C, alpha, beta, ElementAccumulator(0));
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// GETT with the mainloop and epilogue semantics of cutlass::reference::host::Gett
+//
+// Operands are described by host::GettMainloopParams and host::GettEpilogueParams whose tensors
+// reference device memory. Each of the (M,K,L), (N,K,L) and (M,N,L) modes may itself be
+// hierarchical with arbitrary strides, so general rank-N contractions are expressed by grouping
+// their modes, exactly as for the host reference.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+static constexpr int kGettTileM = 16;
+static constexpr int kGettTileN = 16;
+static constexpr int kGettTileK = 16;
+
+/// Compile-time properties of the epilogue, shared by the kernels and the launcher
+template <class EpilogueParams>
+struct GettEpilogueTraits {
+  using ElementCompute = typename EpilogueParams::ElementCompute;
+  using ElementD = typename EpilogueParams::TensorD::value_type;
+  using ElementAux = typename EpilogueParams::TensorAux::value_type;
+  using ActivationFunctor = typename EpilogueParams::ActivationFunctor;
+
+  static constexpr bool IsScalingAndAmaxOutputNeeded =
+      cute::is_same_v<ElementD, cutlass::float_e4m3_t> or
+      cute::is_same_v<ElementD, cutlass::float_e5m2_t>;
+
+  static constexpr bool IsScalingAndAmaxAuxOutputNeeded =
+      cute::is_same_v<ElementAux, cutlass::float_e4m3_t> or
+      cute::is_same_v<ElementAux, cutlass::float_e5m2_t>;
+
+  static constexpr bool IsReLUAuxNeeded =
+      (cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::ReLu<ElementCompute>> or
+       cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::Clamp<ElementCompute>>) and
+      cute::is_same_v<ElementAux, cutlass::uint1b_t>;
+
+  static constexpr bool IsClamp =
+      cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::Clamp<ElementCompute>>;
+
+  static constexpr bool IsBackpropFusion =
+      cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::dGELU<ElementCompute>> or
+      cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::dReLU<ElementCompute>>;
+};
+
+/// Writes one element of a tensor. Sub-byte elements of different threads may share a storage
+/// byte, so they are merged into their 32b word with atomics.
+template <class Tensor, class Coord, class Element>
+CUTLASS_DEVICE
+void gett_store(Tensor const& tensor, Coord const& coord, Element const& value) {
+  if constexpr (cute::is_subbyte_v<Element>) {
+    static_assert(32 % cute::sizeof_bits_v<Element> == 0, "Sub-byte elements must not straddle 32b words.");
+    constexpr uint32_t kMask = (uint32_t(1) << cute::sizeof_bits_v<Element>) - 1;
+
+    int64_t bit = int64_t(reinterpret_cast<uintptr_t>(cute::raw_pointer_cast(tensor.data()))) * 8 +
+                  int64_t(tensor.layout()(coord)) * cute::sizeof_bits_v<Element>;
+    uint32_t* word = reinterpret_cast<uint32_t*>(uintptr_t(bit / 32) * 4);
+    int shift = int(bit % 32);
+    uint32_t item = uint32_t(reinterpret_cast<uint8_t const&>(value)) & kMask;
+
+    atomicAnd(word, ~(kMask << shift));
+    atomicOr(word, item << shift);
+  }
+  else {
+    tensor(coord) = value;
+  }
+}
+
+} // namespace detail
+
+/// Computes a 16x16 tile of D per thread block, staging K-slices of A and B in shared memory.
+/// Per-block partial sums of dBias are written to dbias_partials when the epilogue is a
+/// backprop fusion; they are folded into Bias by gett_dbias_kernel.
+template <class MainloopParams, class EpilogueParams>
+__global__ static
+void
+gett_tiled_kernel(
+  MainloopParams mainloop_params,
+  EpilogueParams epilogue_params,
+  typename EpilogueParams::ElementCompute* dbias_partials)
+{
+  using namespace cute;
+  using detail::kGettTileM;
+  using detail::kGettTileN;
+  using detail::kGettTileK;
+  using Traits = cutlass::reference::device::detail::GettEpilogueTraits<EpilogueParams>;
+
+  using ElementAccumulator = typename MainloopParams::ElementAccumulator;
+  using ElementA = typename cutlass::reference::host::ElementTraits<typename MainloopParams::EngineA::value_type>::type;
+  using ElementB = typename cutlass::reference::host::ElementTraits<typename MainloopParams::EngineB::value_type>::type;
+
+  using ElementCompute = typename EpilogueParams::ElementCompute;
+  using ElementC = typename EpilogueParams::TensorC::value_type;
+  using ElementD = typename EpilogueParams::TensorD::value_type;
+  using ElementAux = typename EpilogueParams::TensorAux::value_type;
+  using ElementBias = typename EpilogueParams::VectorBias::value_type;
+  using ElementScalar = typename EpilogueParams::ElementScalar;
+  using ElementScalingFactor = typename EpilogueParams::ElementScalingFactor;
+
+  constexpr bool PerColBias = EpilogueParams::PerColumnBias;
+
+  __shared__ alignas(16) uint8_t smem_a_buf[kGettTileK * kGettTileM * sizeof(ElementAccumulator)];
+  __shared__ alignas(16) uint8_t smem_b_buf[kGettTileK * kGettTileN * sizeof(ElementAccumulator)];
+  __shared__ alignas(16) uint8_t smem_reduce_buf[kGettTileM * kGettTileN * sizeof(ElementCompute)];
+
+  ElementAccumulator* smem_a = reinterpret_cast<ElementAccumulator*>(smem_a_buf);
+  ElementAccumulator* smem_b = reinterpret_cast<ElementAccumulator*>(smem_b_buf);
+  ElementCompute* smem_reduce = reinterpret_cast<ElementCompute*>(smem_reduce_buf);
+
+  int64_t const M = size<0>(mainloop_params.A.layout());
+  int64_t const N = size<0>(mainloop_params.B.layout());
+  int64_t const K = size<1>(mainloop_params.A.layout());
+  int64_t const L = size<2>(mainloop_params.A.layout());
+  int64_t const tiles_n = (N + kGettTileN - 1) / kGettTileN;
+
+  int const thread_m = threadIdx.x;
+  int const thread_n = threadIdx.y;
+  int const thread_idx = thread_m + thread_n * kGettTileM;
+
+  int64_t const m = int64_t(blockIdx.x) * kGettTileM + thread_m;
+  bool const m_valid = m < M;
+
+  multiply_add<ElementAccumulator, ElementAccumulator, ElementAccumulator> fma_op;
+
+  NumericConverter<ElementCompute, ElementAccumulator> accumulator_converter;
+  NumericConverter<ElementCompute, ElementC> source_converter;
+  NumericConverter<ElementCompute, ElementBias> bias_converter;
+  [[maybe_unused]] NumericConverter<ElementCompute, ElementAux> aux_source_converter;
+  NumericConverter<ElementCompute, ElementScalar> scale_converter;
+  NumericConverter<ElementCompute, ElementScalingFactor> scaling_factor_converter;
+  [[maybe_unused]] NumericConverter<ElementAccumulator, ElementCompute> abs_max_output_converter;
+  NumericConverter<ElementD, ElementCompute> destination_converter;
+  [[maybe_unused]] NumericConverter<ElementAux, ElementCompute> aux_destination_converter;
+
+  multiply_add<ElementCompute, ElementCompute, ElementCompute> epilogue_fma;
+  multiplies<ElementCompute> mul;
+  plus<ElementCompute> add;
+  typename EpilogueParams::ActivationFunctor activation;
+  typename EpilogueParams::BiasBinaryOp bias_op;
+
+  ElementCompute converted_scale_a = scaling_factor_converter(epilogue_params.scale_a);
+  ElementCompute converted_scale_b = scaling_factor_converter(epilogue_params.scale_b);
+  ElementCompute converted_scale_c = scaling_factor_converter(epilogue_params.scale_c);
+  ElementCompute converted_scale_d = scaling_factor_converter(epilogue_params.scale_d);
+  ElementCompute converted_scale_aux = scaling_factor_converter(epilogue_params.scale_aux);
+  ElementCompute const scale_ab = mul(converted_scale_a, converted_scale_b);
+
+  [[maybe_unused]] ElementCompute local_abs_max_output = ElementCompute(0);
+  [[maybe_unused]] ElementCompute local_abs_max_aux_output = ElementCompute(0);
+
+  for (int64_t l = blockIdx.z; l < L; l += gridDim.z) {
+    for (int64_t tile_n = blockIdx.y; tile_n < tiles_n; tile_n += gridDim.y) {
+      int64_t const n = tile_n * kGettTileN + thread_n;
+      bool const valid = m_valid && n < N;
+
+      ElementAccumulator acc = ElementAccumulator(0);
+
+      for (int64_t k_tile = 0; k_tile < K; k_tile += kGettTileK) {
+        // Each thread stages one element of the A and B slices
+        int const load_mn = thread_idx % kGettTileM;
+        int const load_k = thread_idx / kGettTileM;
+        int64_t const k = k_tile + load_k;
+
+        int64_t const load_m = int64_t(blockIdx.x) * kGettTileM + load_mn;
+        ElementAccumulator a = ElementAccumulator(0);
+        if (load_m < M && k < K) {
+          a = static_cast<ElementAccumulator>(ElementA(mainloop_params.A(load_m, k, l)));
+          if (mainloop_params.transform_A == ComplexTransform::kConjugate) {
+            a = conj(a);
+          }
+        }
+        smem_a[load_k * kGettTileM + load_mn] = a;
+
+        int64_t const load_n = tile_n * kGettTileN + load_mn;
+        ElementAccumulator b = ElementAccumulator(0);
+        if (load_n < N && k < K) {
+          b = static_cast<ElementAccumulator>(ElementB(mainloop_params.B(load_n, k, l)));
+          if (mainloop_params.transform_B == ComplexTransform::kConjugate) {
+            b = conj(b);
+          }
+        }
+        smem_b[load_k * kGettTileN + load_mn] = b;
+
+        __syncthreads();
+
+        for (int k_b = 0; k_b < kGettTileK; ++k_b) {
+          acc = fma_op(smem_a[k_b * kGettTileM + thread_m], smem_b[k_b * kGettTileN + thread_n], acc);
+        }
+
+        __syncthreads();
+      }
+
+      [[maybe_unused]] ElementCompute dbias_contribution = ElementCompute(0);
+
+      if (valid) {
+        auto mnl = make_coord(m, n, l);
+
+        ElementCompute converted_alpha = mul(scale_converter(epilogue_params.alpha), scale_ab);
+        ElementCompute converted_beta = mul(scale_converter(epilogue_params.beta), converted_scale_c);
+
+        // per-row alpha
+        if (raw_pointer_cast(epilogue_params.Valpha.data())) {
+          converted_alpha = mul(scale_converter(epilogue_params.Valpha(m, n, l)), scale_ab);
+        }
+        ElementCompute output = mul(converted_alpha, accumulator_converter(acc));
+
+        if (raw_pointer_cast(epilogue_params.Bias.data()) && not Traits::IsBackpropFusion) {
+          ElementCompute converted_bias = bias_converter(epilogue_params.Bias(PerColBias ? n : m));
+          output = bias_op(output, converted_bias);
+        }
+
+        if (raw_pointer_cast(epilogue_params.C.data())) {
+          ElementCompute converted_src = source_converter(epilogue_params.C(m, n, l));
+          // per-row beta
+          if (raw_pointer_cast(epilogue_params.Vbeta.data())) {
+            converted_beta = mul(scale_converter(epilogue_params.Vbeta(m, n, l)), converted_scale_c);
+          }
+          output = epilogue_fma(converted_beta, converted_src, output);
+        }
+
+        if constexpr (Traits::IsBackpropFusion) {
+          ElementAux aux_input = ElementAux(0);
+          if (raw_pointer_cast(epilogue_params.Aux.data())) {
+            aux_input = epilogue_params.Aux(m, n, l);
+          }
+
+          output = activation(output, aux_source_converter(aux_input));
+          dbias_contribution = output;
+        }
+        else {
+          if (raw_pointer_cast(epilogue_params.Aux.data())) {
+            auto aux_output = output;
+            if constexpr (Traits::IsScalingAndAmaxAuxOutputNeeded) {
+              maximum_absolute_value_reduction<ElementCompute, true> amax_op;
+              local_abs_max_aux_output = amax_op(local_abs_max_aux_output, aux_output);
+              aux_output = epilogue_fma(converted_scale_aux, aux_output, ElementCompute(0));
+            }
+
+            if constexpr (Traits::IsReLUAuxNeeded) {
+              cutlass::reference::device::detail::gett_store(
+                epilogue_params.Aux, mnl, not (aux_output < 0) ? uint1b_t(1) : uint1b_t(0));
+            }
+            else {
+              cutlass::reference::device::detail::gett_store(
+                epilogue_params.Aux, mnl, aux_destination_converter(aux_output));
+            }
+          }
+
+          if constexpr (Traits::IsClamp) { // Treat Clamp as ReLU
+            output = activation(output, {0, cutlass::platform::numeric_limits<ElementCompute>::max()});
+          }
+          else {
+            output = activation(output);
+          }
+        }
+
+        if constexpr (Traits::IsScalingAndAmaxOutputNeeded) {
+          maximum_absolute_value_reduction<ElementCompute, true> amax_op;
+          local_abs_max_output = amax_op(local_abs_max_output, output);
+          output = epilogue_fma(converted_scale_d, output, ElementCompute(0));
+        }
+
+        cutlass::reference::device::detail::gett_store(epilogue_params.D, mnl, destination_converter(output));
+      }
+
+      if constexpr (Traits::IsBackpropFusion) {
+        if (dbias_partials) {
+          // Reduce this tile's contribution to dBias across its N threads
+          smem_reduce[thread_idx] = dbias_contribution;
+          __syncthreads();
+          if (thread_n == 0 && m_valid) {
+            ElementCompute sum = ElementCompute(0);
+            for (int n_b = 0; n_b < kGettTileN; ++n_b) {
+              sum = add(sum, smem_reduce[thread_m + n_b * kGettTileM]);
+            }
+            dbias_partials[(l * tiles_n + tile_n) * M + m] = sum;
+          }
+          __syncthreads();
+        }
+      }
+    }
+  }
+
+  // Fold the per-thread absolute maxima into the global amax outputs
+  auto reduce_abs_max = [&](ElementCompute local, ElementAccumulator* ptr) {
+    smem_reduce[thread_idx] = local;
+    __syncthreads();
+    if (thread_idx == 0 && ptr) {
+      maximum<ElementCompute, true> max_op;
+      ElementCompute block_max = smem_reduce[0];
+      for (int i = 1; i < kGettTileM * kGettTileN; ++i) {
+        block_max = max_op(block_max, smem_reduce[i]);
+      }
+      atomic_maximum<ElementAccumulator>{}(ptr, abs_max_output_converter(block_max));
+    }
+    __syncthreads();
+  };
+
+  if constexpr (Traits::IsScalingAndAmaxOutputNeeded) {
+    reduce_abs_max(local_abs_max_output, epilogue_params.abs_max_D);
+  }
+
+  if constexpr (Traits::IsScalingAndAmaxAuxOutputNeeded) {
+    reduce_abs_max(local_abs_max_aux_output, epilogue_params.abs_max_Aux);
+  }
+}
+
+/// Adds the per-tile dBias partial sums of gett_tiled_kernel into Bias, in a fixed order.
+template <class EpilogueParams>
+__global__ static
+void
+gett_dbias_kernel(
+  EpilogueParams epilogue_params,
+  typename EpilogueParams::ElementCompute const* dbias_partials,
+  int64_t M,
+  int64_t partial_count)
+{
+  using ElementCompute = typename EpilogueParams::ElementCompute;
+  using ElementBias = typename EpilogueParams::VectorBias::value_type;
+
+  NumericConverter<ElementCompute, ElementBias> bias_converter;
+  NumericConverter<ElementBias, ElementCompute> dBias_converter;
+  plus<ElementCompute> add;
+
+  for (int64_t m = threadIdx.x + int64_t(blockDim.x) * blockIdx.x;
+       m < M;
+       m += int64_t(blockDim.x) * gridDim.x) {
+    ElementCompute local_dBias = bias_converter(epilogue_params.Bias(m));
+    for (int64_t p = 0; p < partial_count; ++p) {
+      local_dBias = add(local_dBias, dbias_partials[p * M + m]);
+    }
+    cutlass::reference::device::detail::gett_store(epilogue_params.Bias, m, dBias_converter(local_dBias));
+  }
+}
+
+/// GETT - General Tensor-Tensor contraction reference kernel. Device counterpart of
+/// cutlass::reference::host::Gett accepting the same parameter structures.
+template <
+  class MainloopParams,
+  class EpilogueParams
+>
+void
+Gett(
+    MainloopParams const& mainloop_params,
+    EpilogueParams const& epilogue_params,
+    cudaStream_t stream = 0)
+{
+  using namespace cute;
+  using ElementCompute = typename EpilogueParams::ElementCompute;
+  using Traits = detail::GettEpilogueTraits<EpilogueParams>;
+
+  static_assert(cute::rank(typename MainloopParams::LayoutA{}) == 3, "M, K, B");
+  static_assert(cute::rank(typename MainloopParams::LayoutB{}) == 3, "N, K, B");
+  static_assert(cute::rank(typename EpilogueParams::LayoutC{}) == 3, "M, N, B");
+  static_assert(cute::rank(typename EpilogueParams::LayoutD{}) == 3, "M, N, B");
+
+  int64_t M = size<0>(mainloop_params.A.layout());
+  int64_t N = size<0>(mainloop_params.B.layout());
+  int64_t L = size<2>(mainloop_params.A.layout());
+
+  if (M == 0 || N == 0 || L == 0) {
+    return;
+  }
+
+  int64_t tiles_m = (M + detail::kGettTileM - 1) / detail::kGettTileM;
+  int64_t tiles_n = (N + detail::kGettTileN - 1) / detail::kGettTileN;
+
+  // dBias is reduced over both N and L, which requires a second pass over per-tile partial sums
+  cutlass::DeviceAllocation<ElementCompute> dbias_partials;
+  if (Traits::IsBackpropFusion && raw_pointer_cast(epilogue_params.Bias.data())) {
+    dbias_partials.reset(size_t(M * tiles_n * L));
+  }
+
+  dim3 block(detail::kGettTileM, detail::kGettTileN);
+  dim3 grid(
+    uint32_t(tiles_m),
+    uint32_t(cute::min(tiles_n, int64_t(65535))),
+    uint32_t(cute::min(L, int64_t(65535))));
+
+  gett_tiled_kernel<<< grid, block, 0, stream >>>(mainloop_params, epilogue_params, dbias_partials.get());
+
+  if (dbias_partials.get()) {
+    int threads = 256;
+    int blocks = int(cute::min((M + threads - 1) / threads, int64_t(1024)));
+    gett_dbias_kernel<<< blocks, threads, 0, stream >>>(
+      epilogue_params, dbias_partials.get(), M, tiles_n * L);
+
+    // The partial sums are released on return
+    cudaStreamSynchronize(stream);
+  }
+}
+
 } // namespace cutlass::reference::device
@@ -34,15 +34,22 @@
 
 #pragma once
 // Standard Library includes
+#include <cstdint>
+#include <cmath>
 #include <utility>
 
 // Cutlass includes
 #include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
 #include "cutlass/relatively_equal.h"
+#include "cutlass/tensor_view.h"
 
+#include "cutlass/util/device_memory.h"
 #include "cutlass/util/distribution.h"
+#include "cutlass/util/reference/detail/linear_to_coordinate.h"
 
 #include "tensor_foreach.h"
+#include "tensor_reduce.h"
 
 namespace cutlass {
 namespace reference {
@@ -241,6 +248,254 @@ bool BlockCompareRelativelyEqual(
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Summary of an elementwise comparison of a computed tensor against a reference tensor
+template <typename Layout>
+struct TensorComparisonSummary {
+
+  using TensorCoord = typename Layout::TensorCoord;
+
+  /// Number of elements compared
+  int64_t size = 0;
+
+  /// Number of elements that are not (relatively) equal
+  int64_t mismatch_count = 0;
+
+  /// Coordinate of the first mismatching element in linear order. Valid if mismatch_count > 0.
+  TensorCoord first_mismatch;
+
+  /// Maximum of |computed - reference|
+  double max_abs_error = 0;
+
+  /// Maximum of |computed - reference| / |reference| over elements with nonzero reference
+  double max_rel_error = 0;
+
+  /// || computed - reference ||_2, as computed by TensorNormDiff()
+  double norm_diff = 0;
+
+  /// || reference ||_2, as computed by TensorNorm()
+  double norm_reference = 0;
+
+  /// True if no element mismatched
+  bool passed() const {
+    return mismatch_count == 0;
+  }
+
+  /// Relative error metric of host::TensorRelativeErrorMetric()
+  double relative_error_metric() const {
+    return norm_diff / norm_reference;
+  }
+};
+
+namespace detail {
+
+/// Partial comparison result of a subset of the elements. Trivially constructible so that it can
+/// be staged in shared memory.
+struct TensorComparePartial {
+
+  int64_t mismatch_count;
+  int64_t first_mismatch;           ///< Linear index of the first mismatch, or INT64_MAX if none
+  double max_abs_error;
+  double max_rel_error;
+  double sum_sq_diff;
+  double sum_sq_reference;
+
+  CUTLASS_HOST_DEVICE
+  static TensorComparePartial identity() {
+    TensorComparePartial partial;
+    partial.mismatch_count = 0;
+    partial.first_mismatch = INT64_MAX;
+    partial.max_abs_error = 0;
+    partial.max_rel_error = 0;
+    partial.sum_sq_diff = 0;
+    partial.sum_sq_reference = 0;
+    return partial;
+  }
+};
+
+/// Combines two partial comparison results
+struct TensorComparePartialReduce {
+  CUTLASS_HOST_DEVICE
+  TensorComparePartial operator()(TensorComparePartial lhs, TensorComparePartial const &rhs) const {
+    lhs.mismatch_count += rhs.mismatch_count;
+    lhs.first_mismatch = (rhs.first_mismatch < lhs.first_mismatch ? rhs.first_mismatch : lhs.first_mismatch);
+    lhs.max_abs_error = (rhs.max_abs_error > lhs.max_abs_error ? rhs.max_abs_error : lhs.max_abs_error);
+    lhs.max_rel_error = (rhs.max_rel_error > lhs.max_rel_error ? rhs.max_rel_error : lhs.max_rel_error);
+    lhs.sum_sq_diff += rhs.sum_sq_diff;
+    lhs.sum_sq_reference += rhs.sum_sq_reference;
+    return lhs;
+  }
+};
+
+} // namespace detail
+
+namespace kernel {
+
+/// Compares two tensors in a single pass and writes one partial result per threadblock
+template <
+  typename Element,
+  typename Layout,
+  int kBlockSize = 128
+>
+__global__ void TensorCompareSummaryPartial(
+  TensorView<Element, Layout> view_computed,
+  TensorView<Element, Layout> view_reference,
+  Element epsilon,
+  Element nonzero_floor,
+  detail::TensorComparePartial *workspace) {
+
+  using Partial = detail::TensorComparePartial;
+
+  detail::TensorComparePartialReduce reduce;
+  magnitude_squared<Element, double> magnitude_sq;
+  magnitude_squared_difference<Element, double> difference_sq;
+
+  Partial partial = Partial::identity();
+
+  int64_t idx = threadIdx.x + blockIdx.x * blockDim.x;
+  auto size = static_cast<int64_t>(view_computed.size());
+
+  for (; idx < size; idx += blockDim.x * gridDim.x) {
+
+    // Map linear thread ID onto tensor coordinate
+    typename Layout::TensorCoord coord;
+
+    cutlass::reference::detail::LinearToCoordinate<Layout::kRank>()(coord, idx, view_computed.extent());
+
+    if (view_computed.contains(coord)) {
+
+      Element a = view_computed.at(coord);
+      Element b = view_reference.at(coord);
+
+      bool equal = (epsilon == Element(0)) ? (a == b) : relatively_equal(a, b, epsilon, nonzero_floor);
+
+      if (!equal) {
+        ++partial.mismatch_count;
+        if (idx < partial.first_mismatch) {
+          partial.first_mismatch = idx;
+        }
+      }
+
+      double diff_sq = difference_sq(a, b);
+      double reference_sq = magnitude_sq(b);
+      double abs_error = sqrt(diff_sq);
+
+      partial.sum_sq_diff += diff_sq;
+      partial.sum_sq_reference += reference_sq;
+      partial.max_abs_error = (abs_error > partial.max_abs_error ? abs_error : partial.max_abs_error);
+
+      if (reference_sq > 0) {
+        double rel_error = abs_error / sqrt(reference_sq);
+        partial.max_rel_error = (rel_error > partial.max_rel_error ? rel_error : partial.max_rel_error);
+      }
+    }
+  }
+
+  __shared__ Partial scratchpad[kBlockSize];
+
+  scratchpad[threadIdx.x] = partial;
+
+  __syncthreads();
+
+  // Tree reduction within the threadblock
+  for (int stride = kBlockSize / 2; stride > 0; stride /= 2) {
+    if (threadIdx.x < stride) {
+      scratchpad[threadIdx.x] = reduce(scratchpad[threadIdx.x], scratchpad[threadIdx.x + stride]);
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    workspace[blockIdx.x] = scratchpad[0];
+  }
+}
+
+} // namespace kernel
+
+/// Compares a computed tensor against a reference tensor on the device and returns a summary of
+/// the mismatches and error metrics. Only the summary is copied to the host.
+///
+/// Elements are compared with relatively_equal(computed, reference, epsilon, nonzero_floor), or
+/// for exact equality if epsilon is zero.
+template <
+  typename Element,
+  typename Layout
+>
+TensorComparisonSummary<Layout> TensorCompareSummary(
+  TensorView<Element, Layout> view_computed,
+  TensorView<Element, Layout> view_reference,
+  Element epsilon = Element(0),
+  Element nonzero_floor = Element(0),
+  cudaStream_t stream = nullptr,
+  int workspace_size = 0) {
+
+  using Partial = detail::TensorComparePartial;
+
+  if (view_computed.extent() != view_reference.extent()) {
+    throw std::runtime_error("Extents must be equal.");
+  }
+
+  // Optionally query for the SM count to size the workspace.
+  if (!workspace_size) {
+
+    int device_idx = 0;
+    cudaDeviceProp prop;
+
+    cudaError_t result = cudaGetDevice(&device_idx);
+    if (result != cudaSuccess) {
+      throw std::runtime_error("cudaGetDevice() failed");
+    }
+
+    result = cudaGetDeviceProperties(&prop, device_idx);
+    if (result != cudaSuccess) {
+      throw std::runtime_error("cudaGetDeviceProp() failed");
+    }
+
+    workspace_size = int(prop.multiProcessorCount);
+  }
+
+  DeviceAllocation<Partial> workspace(workspace_size);
+
+  int const kBlockSize = 128;
+
+  kernel::TensorCompareSummaryPartial<Element, Layout, kBlockSize>
+    <<< dim3(workspace_size, 1), dim3(kBlockSize, 1), 0, stream >>>(
+      view_computed, view_reference, epsilon, nonzero_floor, workspace.get());
+
+  int const kFinalizeBlockSize = 32;
+
+  kernel::TensorTransformReduceFinalize<
+    Partial, detail::TensorComparePartialReduce, kFinalizeBlockSize
+  ><<< dim3(1, 1), dim3(kFinalizeBlockSize, 1), 0, stream >>>(
+    workspace.get(), Partial::identity(), workspace_size, detail::TensorComparePartialReduce());
+
+  Partial partial;
+  cudaError_t result = cudaMemcpyAsync(&partial, workspace.get(), sizeof(Partial), cudaMemcpyDeviceToHost, stream);
+  if (result == cudaSuccess) {
+    result = cudaStreamSynchronize(stream);
+  }
+  if (result != cudaSuccess) {
+    throw std::runtime_error("Failed to copy comparison summary from device.");
+  }
+
+  TensorComparisonSummary<Layout> summary;
+
+  summary.size = static_cast<int64_t>(view_computed.size());
+  summary.mismatch_count = partial.mismatch_count;
+  summary.max_abs_error = partial.max_abs_error;
+  summary.max_rel_error = partial.max_rel_error;
+  summary.norm_diff = std::sqrt(partial.sum_sq_diff);
+  summary.norm_reference = std::sqrt(partial.sum_sq_reference);
+
+  if (partial.mismatch_count) {
+    cutlass::reference::detail::LinearToCoordinate<Layout::kRank>()(
+      summary.first_mismatch, partial.first_mismatch, view_computed.extent());
+  }
+
+  return summary;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // device
 } // reference
 } // cutlass
@@ -62,6 +62,7 @@
 #include "cutlass/layout/vector.h"
 
 #include "cutlass/util/reference/device/tensor_foreach.h"
+#include "cutlass/util/reference/detail/philox_fill.h"
 #include "cutlass/util/distribution.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1854,6 +1855,95 @@ void BlockFillRandom(
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace kernel {
+
+/// Fills a block of memory with counter-based random values, one 128-bit vector at a time
+template <typename Element>
+__global__ void BlockFillRandomPhilox(
+  Element *ptr,
+  size_t capacity,
+  typename cutlass::reference::detail::RandomPhiloxFunc<Element>::Params params) {
+
+  using Func = cutlass::reference::detail::RandomPhiloxFunc<Element>;
+  using Vector = typename Func::Vector;
+
+  Func func(params);
+
+  size_t const vector_count = capacity / Func::kElementsPerVector;
+  Vector *vectors = reinterpret_cast<Vector *>(ptr);
+
+  for (size_t idx = threadIdx.x + size_t(blockIdx.x) * blockDim.x;
+       idx < vector_count;
+       idx += size_t(gridDim.x) * blockDim.x) {
+
+    Vector frag;
+    func(frag, idx * Func::kElementsPerVector);
+    vectors[idx] = frag;
+  }
+
+  // Partial trailing vector
+  size_t const tail = vector_count * Func::kElementsPerVector;
+
+  if (tail < capacity && blockIdx.x == 0 && threadIdx.x == 0) {
+    Vector frag;
+    func(frag, tail);
+    for (size_t i = tail; i < capacity; ++i) {
+      cutlass::ReferenceFactory<Element>::get(ptr, int64_t(i)) = frag[int(i - tail)];
+    }
+  }
+}
+
+} // namespace kernel
+
+/// Fills a block of memory with uniform or Gaussian random values drawn from a counter-based
+/// (Philox4x32-10) generator. Unlike BlockFillRandom(), no per-thread generator state is
+/// initialized and each thread writes whole 128-bit vectors, so the fill runs at memory bandwidth
+/// for every real numeric type, including FP8 and sub-byte types.
+///
+/// The values depend only on the seed and the element index. host::BlockFillRandomPhilox()
+/// produces identical data.
+template <typename Element>
+void BlockFillRandomPhilox(
+  Element *ptr,
+  size_t capacity,
+  uint64_t seed,
+  Distribution dist,
+  cudaStream_t stream = nullptr) {
+
+  static_assert(!is_complex<Element>::value, "Complex types are filled by BlockFillRandom().");
+
+  if (dist.kind != Distribution::Gaussian && dist.kind != Distribution::Uniform) {
+    return;
+  }
+
+  if (reinterpret_cast<uintptr_t>(ptr) % 16) {
+    throw std::runtime_error("BlockFillRandomPhilox() requires a 16B-aligned pointer.");
+  }
+
+  using Func = cutlass::reference::detail::RandomPhiloxFunc<Element>;
+
+  int grid_size = 0;
+  int block_size = 0;
+
+  cudaError_t result = cudaOccupancyMaxPotentialBlockSize(
+    &grid_size,
+    &block_size,
+    reinterpret_cast<void const *>(kernel::BlockFillRandomPhilox<Element>));
+
+  if (result != cudaSuccess) {
+    throw std::runtime_error("Failed to query occupancy.");
+  }
+
+  size_t vector_count = (capacity + Func::kElementsPerVector - 1) / Func::kElementsPerVector;
+  size_t needed_blocks = (vector_count + block_size - 1) / block_size;
+  grid_size = int(needed_blocks < size_t(grid_size) ? (needed_blocks ? needed_blocks : 1) : grid_size);
+
+  kernel::BlockFillRandomPhilox<Element><<< grid_size, block_size, 0, stream >>>(
+    ptr, capacity, typename Func::Params(seed, dist));
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -82,6 +82,9 @@ void Conv2dFprop(
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(4)
+#endif
   for (int n = 0; n < problem_size.N; ++n) {
     for (int p = 0; p < problem_size.P; ++p) {
       for (int q = 0; q < problem_size.Q; ++q) {
@@ -161,6 +164,9 @@ void Depsep_Fprop(cutlass::TensorView<ElementA, LayoutA> tensor_A,
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(4)
+#endif
   for (int n = 0; n < tensor_C.extent().n(); ++n) {
     for (int p = 0; p < tensor_C.extent().h(); ++p) {
       for (int q = 0; q < tensor_C.extent().w(); ++q) {
@@ -228,6 +234,9 @@ void Conv2dDgrad(
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(4)
+#endif
   for (int n = 0; n < problem_size.N; ++n) {
     for (int h = 0; h < problem_size.H; ++h) {
       for (int w = 0; w < problem_size.W; ++w) {
@@ -331,6 +340,9 @@ void Conv2dWgrad(
   ConvertOp convert_op;
 
   // Apply MMA and accumulate ElementAccumulator
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(4)
+#endif
   for (int k = 0; k < problem_size.K; ++k) {
     for (int r = 0; r < problem_size.R; ++r) {
       for (int s = 0; s < problem_size.S; ++s) {
@@ -482,6 +494,9 @@ void Conv3dFprop(
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(5)
+#endif
   for (int n = 0; n < problem_size.N; ++n) {
     for (int z = 0; z < problem_size.Z; ++z) {
       for (int p = 0; p < problem_size.P; ++p) {
@@ -570,6 +585,9 @@ void Conv3dDgrad(
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(5)
+#endif
   for (int n = 0; n < problem_size.N; ++n) {
     for (int d = 0; d < problem_size.D; ++d) {
       for (int h = 0; h < problem_size.H; ++h) {
@@ -666,6 +684,9 @@ void Conv3dWgrad(
   ConvertOp convert_op;
 
   // Apply MMA and accumulate ElementAccumulator
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(5)
+#endif
   for (int k = 0; k < problem_size.K; ++k) {
     for (int t = 0; t < problem_size.T; ++t) {
       for (int r = 0; r < problem_size.R; ++r) {
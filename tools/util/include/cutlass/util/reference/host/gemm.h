@@ -43,6 +43,7 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/arch/mma.h"
 #include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/detail/gemm_blocked.h"
 
 namespace cutlass {
 namespace reference {
@@ -114,59 +115,25 @@ void compute_gemm(
   int const N = problem_size.n();
   int const K = problem_size.k();
 
-  // Blocking necessary to speedup reference implementation
-  int const Mblock = 16;
-  int const Nblock = 16;
-
   ConvertOp convert_op;
-  InnerProductOp inner_product_op;
-
-  for (int row_block = 0; row_block < M; row_block += Mblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
-
-      ComputeType accum[Mblock][Nblock];
-
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          accum[i][j] = initial_accum;
-        }
-      }
-
-      for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            if (row < M && col < N) {
-              ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-              ElementB b = tensor_b.at(MatrixCoord(k_block, col));
-
-              ComputeType compute_a(cast_if_scalar<ComputeType>(a));
-              ComputeType compute_b(cast_if_scalar<ComputeType>(b));
-
-              accum[i][j] = inner_product_op(compute_a, compute_b, accum[i][j]);
-            }
-          }
-        }
-      }
-
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
-
-          MatrixCoord coord = MatrixCoord(row, col);
-
-          if (row < M && col < N) {
-            tensor_d.at(coord) = convert_op(
-              alpha * ScalarType(accum[i][j]) +
-              beta * ScalarType(tensor_c.at(coord)));
-          }
-        }
-      }
-    }
-  }
+
+  auto load_a = [&](int row, int k) {
+    return ComputeType(cast_if_scalar<ComputeType>(tensor_a.at(MatrixCoord(row, k))));
+  };
+
+  auto load_b = [&](int k, int col) {
+    return ComputeType(cast_if_scalar<ComputeType>(tensor_b.at(MatrixCoord(k, col))));
+  };
+
+  auto store = [&](int row, int col, ComputeType const &accum) {
+    MatrixCoord coord = MatrixCoord(row, col);
+    tensor_d.at(coord) = convert_op(
+      alpha * ScalarType(accum) +
+      beta * ScalarType(tensor_c.at(coord)));
+  };
+
+  cutlass::reference::detail::gemm_blocked_host<ComputeType, InnerProductOp>(
+    M, N, K, initial_accum, load_a, load_b, store);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,6 +45,8 @@
 
 #include "cutlass/gemm/gemm.h"
 
+#include "cutlass/util/reference/detail/gemm_blocked.h"
+
 namespace cutlass {
 namespace reference {
 namespace host {
@@ -98,72 +100,35 @@ void GemmComplex(
   int const N = problem_size.n();
   int const K = problem_size.k();
 
-  // Blocking necessary to speedup reference implementation
-  int const Mblock = 16;
-  int const Nblock = 16;
-
   ConvertOp convert_op;
-  InnerProductOp inner_product_op;
 
   for (int batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
 
-    // Compute matrix product using blocks
-    for (int row_block = 0; row_block < M; row_block += Mblock) {
-      for (int col_block = 0; col_block < N; col_block += Nblock) {
-
-        ComputeType accum[Mblock][Nblock];
-
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            accum[i][j] = initial_accum;
-          }
-        }
-
-        for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              if (row < M && col < N) {
-                ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-                ElementB b = tensor_b.at(MatrixCoord(k_block, col));
-
-                ComputeType a_ik = ComputeType(a);
-                ComputeType b_kj = ComputeType(b);
-
-                if (transform_a == ComplexTransform::kConjugate) {
-                  a_ik = conj(a_ik);
-                }
-
-                if (transform_b == ComplexTransform::kConjugate) {
-                  b_kj = conj(b_kj);
-                }
-
-                accum[i][j] = inner_product_op(a_ik, b_kj,  accum[i][j]);
-              }
-            }
-          }
-        }
-
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            MatrixCoord coord = MatrixCoord(row, col);
-
-            if (row < M && col < N) {
-
-              tensor_d.at(coord) = convert_op(
-                alpha * ScalarType(accum[i][j]) + 
-                beta * ScalarType(tensor_c.at(coord)));
-            }
-          }
-        }
-
-      } // for (col_block)
-    } // for (row_block)
+    auto load_a = [&](int row, int k) {
+      ComputeType a_ik = ComputeType(tensor_a.at(MatrixCoord(row, k)));
+      if (transform_a == ComplexTransform::kConjugate) {
+        a_ik = conj(a_ik);
+      }
+      return a_ik;
+    };
+
+    auto load_b = [&](int k, int col) {
+      ComputeType b_kj = ComputeType(tensor_b.at(MatrixCoord(k, col)));
+      if (transform_b == ComplexTransform::kConjugate) {
+        b_kj = conj(b_kj);
+      }
+      return b_kj;
+    };
+
+    auto store = [&](int row, int col, ComputeType const &accum) {
+      MatrixCoord coord = MatrixCoord(row, col);
+      tensor_d.at(coord) = convert_op(
+        alpha * ScalarType(accum) + 
+        beta * ScalarType(tensor_c.at(coord)));
+    };
+
+    cutlass::reference::detail::gemm_blocked_host<ComputeType, InnerProductOp>(
+      M, N, K, initial_accum, load_a, load_b, store);
 
     tensor_a.add_pointer_offset(batch_stride_A);
     tensor_b.add_pointer_offset(batch_stride_B);
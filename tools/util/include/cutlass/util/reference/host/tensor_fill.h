@@ -36,10 +36,14 @@
 
 // Standard Library includes
 #include <utility>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <cmath>
 #include <random>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 // Cutlass includes
 #include "cutlass/cutlass.h"
@@ -53,6 +57,7 @@
 #include "cutlass/blas3.h"
 
 #include "cutlass/util/distribution.h"
+#include "cutlass/util/reference/detail/philox_fill.h"
 #include "tensor_foreach.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1509,6 +1514,79 @@ void BlockFillRandom(
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Fills a block of memory with uniform or Gaussian random values drawn from a counter-based
+/// (Philox4x32-10) generator, using all hardware threads. The values depend only on the seed and
+/// the element index, so the result matches device::BlockFillRandomPhilox() and does not depend
+/// on the number of threads.
+template <typename Element>
+void BlockFillRandomPhilox(
+  Element *ptr,
+  size_t capacity,
+  uint64_t seed,
+  Distribution dist,
+  int thread_count = 0) {
+
+  static_assert(!is_complex<Element>::value, "Complex types are filled by BlockFillRandom().");
+
+  if (dist.kind != Distribution::Gaussian && dist.kind != Distribution::Uniform) {
+    return;
+  }
+
+  using Func = cutlass::reference::detail::RandomPhiloxFunc<Element>;
+  using Vector = typename Func::Vector;
+
+  Func func(typename Func::Params(seed, dist));
+
+  size_t const vector_count = (capacity + Func::kElementsPerVector - 1) / Func::kElementsPerVector;
+
+  // Fills vectors [begin, end). Whole vectors are copied bytewise, so `ptr` needs no alignment.
+  auto fill = [&](size_t begin, size_t end) {
+    for (size_t idx = begin; idx < end; ++idx) {
+      Vector frag;
+      func(frag, idx * Func::kElementsPerVector);
+
+      size_t first = idx * Func::kElementsPerVector;
+      if (first + Func::kElementsPerVector <= capacity) {
+        std::memcpy(reinterpret_cast<uint8_t *>(ptr) + idx * sizeof(Vector), &frag, sizeof(Vector));
+      }
+      else {
+        for (size_t i = first; i < capacity; ++i) {
+          cutlass::ReferenceFactory<Element>::get(ptr, int64_t(i)) = frag[int(i - first)];
+        }
+      }
+    }
+  };
+
+  if (thread_count <= 0) {
+    thread_count = int(std::thread::hardware_concurrency());
+  }
+
+  // Small blocks are not worth spawning threads for
+  size_t const kVectorsPerThreadMin = size_t(1) << 14;
+  size_t max_threads = (vector_count + kVectorsPerThreadMin - 1) / kVectorsPerThreadMin;
+  thread_count = int(std::max<size_t>(1, std::min<size_t>(size_t(thread_count), max_threads)));
+
+  if (thread_count == 1) {
+    fill(0, vector_count);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  size_t const chunk = (vector_count + thread_count - 1) / thread_count;
+
+  for (int t = 0; t < thread_count; ++t) {
+    size_t begin = std::min(vector_count, t * chunk);
+    size_t end = std::min(vector_count, begin + chunk);
+    threads.emplace_back(fill, begin, end);
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
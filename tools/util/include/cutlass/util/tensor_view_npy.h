@@ -0,0 +1,516 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+**************************************************************************************************/
+/*! \file
+    \brief Streaming binary tensor I/O in the NumPy .npy format.
+
+    NpyWriter and NpyReader move raw tensor bytes between files and host or device memory. Device
+    transfers are chunked through two pinned staging buffers, so copying one chunk overlaps with
+    file I/O on the other, and memory use is bounded for multi-GB tensors.
+
+    Element types without a NumPy equivalent (bfloat16_t, FP8, complex half) are stored as
+    unsigned integers of the same width and can be reinterpreted with ndarray.view(). Sub-byte
+    types are stored as packed bytes.
+*/
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/complex.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/layout/tensor.h"
+
+#include "cutlass/util/exceptions.h"
+#include "cutlass/util/host_tensor.h"
+
+namespace cutlass {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// NumPy type string of a native element type, or of an unsigned integer of the same width
+inline std::string npy_descr(int bits, char kind) {
+  if (bits < 8) {
+    return "|u1";
+  }
+  std::ostringstream ss;
+  ss << (bits == 8 ? '|' : '<') << kind << bits / 8;
+  return ss.str();
+}
+
+template <typename T> struct NpyDescr { static std::string get() { return npy_descr(sizeof_bits<T>::value, 'u'); } };
+
+template <> struct NpyDescr<half_t> { static std::string get() { return "<f2"; } };
+template <> struct NpyDescr<float> { static std::string get() { return "<f4"; } };
+template <> struct NpyDescr<tfloat32_t> { static std::string get() { return "<f4"; } };
+template <> struct NpyDescr<double> { static std::string get() { return "<f8"; } };
+template <> struct NpyDescr<complex<float>> { static std::string get() { return "<c8"; } };
+template <> struct NpyDescr<complex<double>> { static std::string get() { return "<c16"; } };
+template <> struct NpyDescr<int8_t> { static std::string get() { return "|i1"; } };
+template <> struct NpyDescr<int16_t> { static std::string get() { return "<i2"; } };
+template <> struct NpyDescr<int32_t> { static std::string get() { return "<i4"; } };
+template <> struct NpyDescr<int64_t> { static std::string get() { return "<i8"; } };
+
+/// Storage order of packed layouts expressible as NumPy arrays: 0 for C order, 1 for Fortran
+/// order, -1 if the tensor must be written as a flat array of storage.
+template <typename Layout> struct NpyOrder { static int const value = -1; };
+
+template <> struct NpyOrder<layout::RowMajor> { static int const value = 0; };
+template <> struct NpyOrder<layout::ColumnMajor> { static int const value = 1; };
+template <> struct NpyOrder<layout::TensorNHWC> { static int const value = 0; };
+template <> struct NpyOrder<layout::TensorNDHWC> { static int const value = 0; };
+
+/// Pinned double buffer and stream used for chunked host-device transfers
+struct NpyStaging {
+
+  std::vector<void *> buffers;
+  std::vector<cudaEvent_t> events;
+  cudaStream_t stream = nullptr;
+  size_t chunk_bytes;
+
+  explicit NpyStaging(size_t chunk_bytes_): chunk_bytes(chunk_bytes_) {
+    if (cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking) != cudaSuccess) {
+      throw cuda_exception("NpyStaging: failed to create stream");
+    }
+    for (int i = 0; i < 2; ++i) {
+      void *ptr = nullptr;
+      cudaEvent_t event = nullptr;
+      if (cudaHostAlloc(&ptr, chunk_bytes, cudaHostAllocDefault) != cudaSuccess) {
+        release();
+        throw cuda_exception("NpyStaging: failed to allocate pinned staging buffer");
+      }
+      buffers.push_back(ptr);
+      if (cudaEventCreateWithFlags(&event, cudaEventDisableTiming) != cudaSuccess) {
+        release();
+        throw cuda_exception("NpyStaging: failed to create event");
+      }
+      events.push_back(event);
+    }
+  }
+
+  ~NpyStaging() {
+    release();
+  }
+
+  void release() {
+    for (void *ptr : buffers) {
+      cudaFreeHost(ptr);
+    }
+    for (cudaEvent_t event : events) {
+      cudaEventDestroy(event);
+    }
+    buffers.clear();
+    events.clear();
+    if (stream) {
+      cudaStreamDestroy(stream);
+      stream = nullptr;
+    }
+  }
+};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Writes one array to a .npy file, streaming its data from host or device memory
+class NpyWriter {
+public:
+
+  /// Default chunk size for device transfers
+  static size_t const kDefaultChunkBytes = size_t(64) << 20;
+
+private:
+
+  FILE *file_ = nullptr;
+  size_t bytes_expected_ = 0;
+  size_t bytes_written_ = 0;
+
+public:
+
+  /// Creates the file and writes the header
+  NpyWriter(
+    std::string const &path,
+    std::string const &descr,
+    std::vector<int64_t> const &shape,
+    bool fortran_order = false) {
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+      throw std::runtime_error("NpyWriter: failed to open '" + path + "' for writing");
+    }
+
+    bytes_expected_ = 1;
+    std::ostringstream dict;
+    dict << "{'descr': '" << descr << "', 'fortran_order': " << (fortran_order ? "True" : "False") << ", 'shape': (";
+    for (int64_t extent : shape) {
+      dict << extent << ", ";
+      bytes_expected_ *= size_t(extent);
+    }
+    dict << "), }";
+
+    int element_bytes = std::atoi(descr.c_str() + 2);
+    bytes_expected_ *= size_t(element_bytes);
+
+    // Pad with spaces so that the data begins on a 64-byte boundary
+    std::string header = dict.str();
+    size_t preamble = 10;
+    bool version2 = header.size() + 1 + preamble > 65535;
+    if (version2) {
+      preamble = 12;
+    }
+    size_t total = (preamble + header.size() + 1 + 63) / 64 * 64;
+    header.append(total - preamble - header.size() - 1, ' ');
+    header.push_back('\n');
+
+    char magic[8] = {'\x93', 'N', 'U', 'M', 'P', 'Y', char(version2 ? 2 : 1), 0};
+    write_raw(magic, 8);
+
+    uint32_t header_len = uint32_t(header.size());
+    uint8_t len_bytes[4] = {
+      uint8_t(header_len), uint8_t(header_len >> 8), uint8_t(header_len >> 16), uint8_t(header_len >> 24)};
+    write_raw(len_bytes, version2 ? 4 : 2);
+    write_raw(header.data(), header.size());
+  }
+
+  ~NpyWriter() {
+    if (file_) {
+      std::fclose(file_);
+    }
+  }
+
+  NpyWriter(NpyWriter const &) = delete;
+  NpyWriter &operator=(NpyWriter const &) = delete;
+
+  /// Number of data bytes implied by the header
+  size_t bytes_expected() const {
+    return bytes_expected_;
+  }
+
+  /// Appends bytes from host memory
+  void write(void const *host_ptr, size_t bytes) {
+    write_raw(host_ptr, bytes);
+    bytes_written_ += bytes;
+  }
+
+  /// Appends bytes from device memory through pinned double buffering
+  void write_from_device(void const *device_ptr, size_t bytes, size_t chunk_bytes = kDefaultChunkBytes) {
+
+    if (!bytes) {
+      return;
+    }
+
+    chunk_bytes = (chunk_bytes < bytes ? chunk_bytes : bytes);
+    detail::NpyStaging staging(chunk_bytes);
+
+    size_t chunk_count = (bytes + chunk_bytes - 1) / chunk_bytes;
+    uint8_t const *src = reinterpret_cast<uint8_t const *>(device_ptr);
+
+    auto issue = [&](size_t chunk) {
+      size_t offset = chunk * chunk_bytes;
+      size_t size = (bytes - offset < chunk_bytes ? bytes - offset : chunk_bytes);
+      int slot = int(chunk % 2);
+      if (cudaMemcpyAsync(staging.buffers[slot], src + offset, size, cudaMemcpyDeviceToHost, staging.stream) != cudaSuccess ||
+          cudaEventRecord(staging.events[slot], staging.stream) != cudaSuccess) {
+        throw cuda_exception("NpyWriter: failed to copy from device");
+      }
+    };
+
+    issue(0);
+
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+
+      // The other buffer was written to the file in the previous iteration
+      if (chunk + 1 < chunk_count) {
+        issue(chunk + 1);
+      }
+
+      int slot = int(chunk % 2);
+      if (cudaEventSynchronize(staging.events[slot]) != cudaSuccess) {
+        throw cuda_exception("NpyWriter: failed to copy from device");
+      }
+
+      size_t offset = chunk * chunk_bytes;
+      write(staging.buffers[slot], (bytes - offset < chunk_bytes ? bytes - offset : chunk_bytes));
+    }
+  }
+
+  /// Flushes and closes the file, checking that the data matches the header
+  void close() {
+    if (!file_) {
+      return;
+    }
+    int result = std::fclose(file_);
+    file_ = nullptr;
+    if (result != 0) {
+      throw std::runtime_error("NpyWriter: failed to close file");
+    }
+    if (bytes_written_ != bytes_expected_) {
+      throw std::runtime_error("NpyWriter: number of bytes written does not match the array shape");
+    }
+  }
+
+private:
+
+  void write_raw(void const *ptr, size_t bytes) {
+    if (std::fwrite(ptr, 1, bytes, file_) != bytes) {
+      throw std::runtime_error("NpyWriter: write failed");
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Reads one array from a .npy file, streaming its data into host or device memory
+class NpyReader {
+public:
+
+  static size_t const kDefaultChunkBytes = NpyWriter::kDefaultChunkBytes;
+
+private:
+
+  FILE *file_ = nullptr;
+  std::string descr_;
+  bool fortran_order_ = false;
+  std::vector<int64_t> shape_;
+  size_t bytes_ = 0;
+
+public:
+
+  /// Opens the file and parses the header
+  explicit NpyReader(std::string const &path) {
+
+    file_ = std::fopen(path.c_str(), "rb");
+    if (!file_) {
+      throw std::runtime_error("NpyReader: failed to open '" + path + "'");
+    }
+
+    char magic[8];
+    read_raw(magic, 8);
+    if (std::memcmp(magic, "\x93NUMPY", 6) != 0 || (magic[6] != 1 && magic[6] != 2 && magic[6] != 3)) {
+      throw std::runtime_error("NpyReader: '" + path + "' is not a .npy file");
+    }
+
+    uint8_t len_bytes[4] = {0, 0, 0, 0};
+    read_raw(len_bytes, magic[6] == 1 ? 2 : 4);
+    size_t header_len = len_bytes[0] | (len_bytes[1] << 8) | (size_t(len_bytes[2]) << 16) | (size_t(len_bytes[3]) << 24);
+
+    std::string header(header_len, ' ');
+    read_raw(&header[0], header_len);
+
+    // descr
+    size_t pos = header.find("'descr'");
+    size_t begin = header.find('\'', header.find(':', pos)) + 1;
+    size_t end = header.find('\'', begin);
+    if (pos == std::string::npos || end == std::string::npos) {
+      throw std::runtime_error("NpyReader: malformed header");
+    }
+    descr_ = header.substr(begin, end - begin);
+
+    // fortran_order
+    pos = header.find("'fortran_order'");
+    fortran_order_ = (pos != std::string::npos && header.compare(header.find(':', pos) + 2, 4, "True") == 0);
+
+    // shape
+    pos = header.find("'shape'");
+    begin = header.find('(', pos) + 1;
+    end = header.find(')', begin);
+    if (pos == std::string::npos || end == std::string::npos) {
+      throw std::runtime_error("NpyReader: malformed header");
+    }
+    std::istringstream shape_stream(header.substr(begin, end - begin));
+    std::string token;
+    bytes_ = size_t(std::atoi(descr_.c_str() + 2));
+    while (std::getline(shape_stream, token, ',')) {
+      if (token.find_first_not_of(' ') != std::string::npos) {
+        shape_.push_back(std::stoll(token));
+        bytes_ *= size_t(shape_.back());
+      }
+    }
+  }
+
+  ~NpyReader() {
+    if (file_) {
+      std::fclose(file_);
+    }
+  }
+
+  NpyReader(NpyReader const &) = delete;
+  NpyReader &operator=(NpyReader const &) = delete;
+
+  std::string const &descr() const { return descr_; }
+  bool fortran_order() const { return fortran_order_; }
+  std::vector<int64_t> const &shape() const { return shape_; }
+
+  /// Number of data bytes
+  size_t bytes() const { return bytes_; }
+
+  /// Reads the next bytes into host memory
+  void read(void *host_ptr, size_t bytes) {
+    read_raw(host_ptr, bytes);
+  }
+
+  /// Reads the next bytes into device memory through pinned double buffering
+  void read_to_device(void *device_ptr, size_t bytes, size_t chunk_bytes = kDefaultChunkBytes) {
+
+    if (!bytes) {
+      return;
+    }
+
+    chunk_bytes = (chunk_bytes < bytes ? chunk_bytes : bytes);
+    detail::NpyStaging staging(chunk_bytes);
+
+    size_t chunk_count = (bytes + chunk_bytes - 1) / chunk_bytes;
+    uint8_t *dst = reinterpret_cast<uint8_t *>(device_ptr);
+
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+      int slot = int(chunk % 2);
+      size_t offset = chunk * chunk_bytes;
+      size_t size = (bytes - offset < chunk_bytes ? bytes - offset : chunk_bytes);
+
+      // Wait until the copy issued from this buffer two chunks ago has completed
+      if (chunk >= 2 && cudaEventSynchronize(staging.events[slot]) != cudaSuccess) {
+        throw cuda_exception("NpyReader: failed to copy to device");
+      }
+
+      read_raw(staging.buffers[slot], size);
+
+      if (cudaMemcpyAsync(dst + offset, staging.buffers[slot], size, cudaMemcpyHostToDevice, staging.stream) != cudaSuccess ||
+          cudaEventRecord(staging.events[slot], staging.stream) != cudaSuccess) {
+        throw cuda_exception("NpyReader: failed to copy to device");
+      }
+    }
+
+    if (cudaStreamSynchronize(staging.stream) != cudaSuccess) {
+      throw cuda_exception("NpyReader: failed to copy to device");
+    }
+  }
+
+private:
+
+  void read_raw(void *ptr, size_t bytes) {
+    if (std::fread(ptr, 1, bytes, file_) != bytes) {
+      throw std::runtime_error("NpyReader: unexpected end of file");
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Shape and order under which a HostTensor is stored
+template <typename Element, typename Layout>
+void npy_shape(HostTensor<Element, Layout> const &tensor, std::vector<int64_t> &shape, bool &fortran_order) {
+
+  int64_t elements = 1;
+  for (int i = 0; i < Layout::kRank; ++i) {
+    elements *= tensor.extent().at(i);
+  }
+
+  shape.clear();
+  fortran_order = (NpyOrder<Layout>::value == 1);
+
+  if (NpyOrder<Layout>::value >= 0 && sizeof_bits<Element>::value >= 8 &&
+      int64_t(tensor.layout().capacity(tensor.extent())) == elements) {
+    for (int i = 0; i < Layout::kRank; ++i) {
+      shape.push_back(tensor.extent().at(i));
+    }
+  }
+  else {
+    // Flat array of the underlying storage
+    fortran_order = false;
+    int64_t bits = int64_t(tensor.capacity()) * sizeof_bits<Element>::value;
+    shape.push_back(sizeof_bits<Element>::value >= 8 ? int64_t(tensor.capacity()) : (bits + 7) / 8);
+  }
+}
+
+} // namespace detail
+
+/// Writes a HostTensor to a .npy file. If from_device is true, device memory is streamed to the
+/// file without touching the host allocation.
+template <typename Element, typename Layout>
+void write_npy(std::string const &path, HostTensor<Element, Layout> const &tensor, bool from_device = false) {
+
+  std::vector<int64_t> shape;
+  bool fortran_order;
+  detail::npy_shape(tensor, shape, fortran_order);
+
+  NpyWriter writer(path, detail::NpyDescr<Element>::get(), shape, fortran_order);
+
+  if (from_device) {
+    writer.write_from_device(tensor.device_data(), writer.bytes_expected());
+  }
+  else {
+    writer.write(tensor.host_data(), writer.bytes_expected());
+  }
+
+  writer.close();
+}
+
+/// Reads a .npy file into a HostTensor of matching size. If to_device is true, the data is
+/// streamed into device memory instead of the host allocation.
+template <typename Element, typename Layout>
+void read_npy(std::string const &path, HostTensor<Element, Layout> &tensor, bool to_device = false) {
+
+  NpyReader reader(path);
+
+  std::vector<int64_t> shape;
+  bool fortran_order;
+  detail::npy_shape(tensor, shape, fortran_order);
+
+  size_t bytes = size_t(std::atoi(detail::NpyDescr<Element>::get().c_str() + 2));
+  for (int64_t extent : shape) {
+    bytes *= size_t(extent);
+  }
+
+  if (reader.bytes() != bytes || reader.descr() != detail::NpyDescr<Element>::get()) {
+    throw std::runtime_error("read_npy: '" + path + "' does not match the tensor's type and size");
+  }
+
+  if (to_device) {
+    reader.read_to_device(tensor.device_data(), bytes);
+  }
+  else {
+    reader.read(tensor.host_data(), bytes);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass